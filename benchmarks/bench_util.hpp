@@ -0,0 +1,36 @@
+#ifndef FASTCOMMENTS_BENCHMARKS_BENCH_UTIL_HPP
+#define FASTCOMMENTS_BENCHMARKS_BENCH_UTIL_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace fastcomments {
+namespace bench {
+
+// Keeps the optimizer from discarding a benchmarked result.
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs fn `iterations` times and prints the mean cost per call.
+template <typename Fn>
+double measure(const std::string& name, long iterations, Fn&& fn) {
+    for (long i = 0; i < iterations / 10 + 1; ++i) {
+        fn();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double nsPerOp = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    std::printf("%-48s %12.1f ns/op\n", name.c_str(), nsPerOp);
+    return nsPerOp;
+}
+
+} // namespace bench
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_BENCHMARKS_BENCH_UTIL_HPP
@@ -0,0 +1,119 @@
+// Decoding nested container responses: per-question aggregation maps and the
+// domain configuration listing.
+
+#include "bench_util.hpp"
+
+#include "FastCommentsClient/model/APITenant.h"
+#include "FastCommentsClient/model/BulkAggregateQuestionResultsResponse.h"
+#include "FastCommentsClient/model/GetDomainConfigsResponse.h"
+
+#include <string>
+
+using namespace org::openapitools::client::model;
+
+namespace {
+
+utility::string_t key(const std::string& prefix, int i) {
+    return utility::conversions::to_string_t(prefix + std::to_string(i));
+}
+
+web::json::value datum(int i) {
+    web::json::value v = web::json::value::object();
+    for (int j = 0; j < 5; ++j) {
+        v[key("", j + 1)] = web::json::value::number((i + j) % 9 / 10.0);
+    }
+    web::json::value d = web::json::value::object();
+    d[U("v")] = v;
+    d[U("total")] = web::json::value::number(100 + i);
+    return d;
+}
+
+web::json::value aggregationResponse(int questions, int buckets) {
+    web::json::value data = web::json::value::object();
+    for (int q = 0; q < questions; ++q) {
+        web::json::value byDate = web::json::value::object();
+        web::json::value byUrl = web::json::value::object();
+        web::json::value counts = web::json::value::object();
+        for (int b = 0; b < buckets; ++b) {
+            byDate[key("2024-05-", b + 1)] = datum(b);
+            byUrl[key("https://example.com/articles/", b)] = datum(b + q);
+            counts[key("", b)] = web::json::value::number(b * 3 + q);
+        }
+        web::json::value overall = web::json::value::object();
+        overall[U("dataByDateBucket")] = byDate;
+        overall[U("dataByUrlId")] = byUrl;
+        overall[U("countsByValue")] = counts;
+        overall[U("total")] = web::json::value::number(1000 + q);
+        overall[U("average")] = web::json::value::number(3.5);
+        overall[U("createdAt")] = web::json::value::string(U("2024-05-01T00:00:00Z"));
+        data[key("question-", q)] = overall;
+    }
+    web::json::value response = web::json::value::object();
+    response[U("status")] = web::json::value::string(U("success"));
+    response[U("data")] = data;
+    return response;
+}
+
+web::json::value domainConfig(int i) {
+    web::json::value c = web::json::value::object();
+    c[U("id")] = web::json::value::string(key("config-", i));
+    c[U("domain")] = web::json::value::string(key("site", i) + U(".example.com"));
+    c[U("emailFromName")] = web::json::value::string(U("Example Comments"));
+    c[U("emailFromEmail")] = web::json::value::string(U("noreply@example.com"));
+    c[U("logoSrc")] = web::json::value::string(U("https://cdn.example.com/logo.png"));
+    c[U("createdAt")] = web::json::value::string(U("2024-01-01T00:00:00Z"));
+    web::json::value headers = web::json::value::object();
+    headers[U("X-Site")] = web::json::value::string(key("site", i));
+    headers[U("X-Env")] = web::json::value::string(U("production"));
+    c[U("emailHeaders")] = headers;
+    return c;
+}
+
+web::json::value domainConfigsResponse(int domains) {
+    web::json::value configurations = web::json::value::object();
+    for (int i = 0; i < domains; ++i) {
+        configurations[key("site", i)] = domainConfig(i);
+    }
+    web::json::value response = web::json::value::object();
+    response[U("status")] = web::json::value::object();
+    response[U("configurations")] = configurations;
+    return response;
+}
+
+web::json::value tenant(int domains) {
+    std::vector<web::json::value> list;
+    for (int i = 0; i < domains; ++i) {
+        list.push_back(domainConfig(i));
+    }
+    web::json::value t = web::json::value::object();
+    t[U("id")] = web::json::value::string(U("demo-tenant"));
+    t[U("name")] = web::json::value::string(U("Demo"));
+    t[U("domainConfiguration")] = web::json::value::array(list);
+    return t;
+}
+
+template <typename Model>
+void decode(const std::string& name, const web::json::value& json, long iterations) {
+    fastcomments::bench::measure(name, iterations, [&]() {
+        Model model;
+        model.fromJson(json);
+        fastcomments::bench::doNotOptimize(model);
+    });
+}
+
+} // anonymous namespace
+
+int main() {
+    decode<BulkAggregateQuestionResultsResponse>("BulkAggregateQuestionResultsResponse 20x30",
+                                                 aggregationResponse(20, 30), 200);
+    decode<GetDomainConfigsResponse>("GetDomainConfigsResponse 200 domains", domainConfigsResponse(200), 2000);
+    decode<APITenant>("APITenant 200 domainConfiguration", tenant(200), 500);
+
+    const utility::string_t counts = aggregationResponse(1, 200).at(U("data")).at(U("question-0")).at(U("countsByValue")).serialize();
+    fastcomments::bench::measure("fromString map<string, int32_t> 200", 5000, [&]() {
+        std::map<utility::string_t, int32_t> out;
+        ModelBase::fromString(counts, out);
+        fastcomments::bench::doNotOptimize(out);
+    });
+    return 0;
+}
@@ -0,0 +1,89 @@
+// Per-field cost of the scalar and ISO-8601 conversions in ModelBase, and what
+// it adds up to when decoding comments and audit logs.
+
+#include "bench_util.hpp"
+
+#include "FastCommentsClient/ApiClient.h"
+#include "FastCommentsClient/model/APIAuditLog.h"
+#include "FastCommentsClient/model/APIComment.h"
+
+#include <string>
+
+using namespace org::openapitools::client::model;
+using org::openapitools::client::api::ApiClient;
+
+namespace {
+
+const char* kAuditLog = R"({
+    "_id": "6553f1a2b54764421b7156c3", "userId": "demo-tenant:jane", "username": "jane",
+    "resourceName": "Comment", "crudType": "u", "from": "api", "url": "https://example.com/articles/42",
+    "ip": "203.0.113.7", "when": "2024-05-01T10:20:30.512Z", "description": "Approved comment",
+    "serverStartDate": "2024-04-30T23:59:01Z", "objectDetails": {"approved": true}
+})";
+
+const char* kComment = R"({
+    "id": "5f8d0d55b54764421b7156c3", "tenantId": "demo-tenant", "urlId": "https://example.com/articles/42",
+    "commenterName": "Jane Doe", "comment": "Great write-up", "commentHTML": "<p>Great write-up</p>",
+    "date": 1700000000000, "votes": 12, "votesUp": 14, "votesDown": 2, "approved": true,
+    "verifiedDate": "2024-05-01T10:20:30.5Z", "expireAt": "2025-05-01T00:00:00Z"
+})";
+
+template <typename Model>
+void decode(const char* name, const char* json, long iterations) {
+    const web::json::value value = web::json::value::parse(utility::conversions::to_string_t(json));
+    fastcomments::bench::measure(std::string(name) + " fromJson", iterations, [&]() {
+        Model model;
+        model.fromJson(value);
+        fastcomments::bench::doNotOptimize(model);
+    });
+    Model model;
+    model.fromJson(value);
+    fastcomments::bench::measure(std::string(name) + " toJson", iterations, [&]() {
+        auto out = model.toJson();
+        fastcomments::bench::doNotOptimize(out);
+    });
+}
+
+} // anonymous namespace
+
+int main() {
+    const long iterations = 200000;
+
+    const web::json::value date = web::json::value::string(utility::conversions::to_string_t("2024-05-01T10:20:30.512Z"));
+    fastcomments::bench::measure("fromJson(datetime)", iterations, [&]() {
+        utility::datetime out;
+        ModelBase::fromJson(date, out);
+        fastcomments::bench::doNotOptimize(out);
+    });
+    utility::datetime when;
+    ModelBase::fromJson(date, when);
+    fastcomments::bench::measure("toString(datetime)", iterations, [&]() {
+        auto out = ModelBase::toString(when);
+        fastcomments::bench::doNotOptimize(out);
+    });
+
+    const utility::string_t number = utility::conversions::to_string_t("1700000000000");
+    fastcomments::bench::measure("fromString(int64_t)", iterations, [&]() {
+        int64_t out = 0;
+        ModelBase::fromString(number, out);
+        fastcomments::bench::doNotOptimize(out);
+    });
+    const utility::string_t real = utility::conversions::to_string_t("0.8125");
+    fastcomments::bench::measure("fromString(double)", iterations, [&]() {
+        double out = 0;
+        ModelBase::fromString(real, out);
+        fastcomments::bench::doNotOptimize(out);
+    });
+    fastcomments::bench::measure("toString(int64_t)", iterations, [&]() {
+        auto out = ModelBase::toString(int64_t(1700000000000));
+        fastcomments::bench::doNotOptimize(out);
+    });
+    fastcomments::bench::measure("parameterToString(int32_t)", iterations, [&]() {
+        auto out = ApiClient::parameterToString(int32_t(30));
+        fastcomments::bench::doNotOptimize(out);
+    });
+
+    decode<APIComment>("APIComment", kComment, iterations / 4);
+    decode<APIAuditLog>("APIAuditLog", kAuditLog, iterations / 4);
+    return 0;
+}
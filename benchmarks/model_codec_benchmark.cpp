@@ -0,0 +1,70 @@
+// Cache round trip cost: JSON text (toJson().serialize() + parse + fromJson)
+// versus the tagged binary encoding (toBinary + fromBinary).
+
+#include "bench_util.hpp"
+
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/UserBadge.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace org::openapitools::client::model;
+
+namespace {
+
+const char* kComment = R"({
+    "id": "5f8d0d55b54764421b7156c3", "tenantId": "demo-tenant", "urlId": "https://example.com/articles/42",
+    "url": "https://example.com/articles/42", "urlIdRaw": "https://example.com/articles/42?ref=home",
+    "pageTitle": "An Article About Things", "commenterName": "Jane Doe", "userId": "demo-tenant:jane",
+    "avatarSrc": "https://cdn.example.com/avatars/jane.png",
+    "comment": "Great write-up, thanks! I especially liked the section on caching.",
+    "commentHTML": "<p>Great write-up, thanks! I especially liked the section on caching.</p>",
+    "date": 1700000000000, "votes": 12, "votesUp": 14, "votesDown": 2, "approved": true,
+    "reviewed": true, "verified": true, "isSpam": false, "locale": "en_us", "flagCount": 0,
+    "badges": [{"id": "b1", "type": 2, "description": "Top commenter", "displayLabel": "Top",
+                "displaySrc": "https://cdn.example.com/badges/top.png", "backgroundColor": "#000",
+                "borderColor": "#fff", "textColor": "#fff", "cssClass": "top"}],
+    "feedbackIds": ["f1", "f2"]
+})";
+
+template <typename Model>
+void report(const char* name, const char* json, long iterations) {
+    Model model;
+    model.fromJson(web::json::value::parse(utility::conversions::to_string_t(json)));
+    const utility::string_t text = model.toJson().serialize();
+    const std::string binary = model.toBinary();
+    std::printf("%s: json %zu bytes, binary %zu bytes\n", name, text.size(), binary.size());
+
+    fastcomments::bench::measure(std::string(name) + " json encode", iterations, [&]() {
+        auto out = model.toJson().serialize();
+        fastcomments::bench::doNotOptimize(out);
+    });
+    fastcomments::bench::measure(std::string(name) + " json decode", iterations, [&]() {
+        Model decoded;
+        decoded.fromJson(web::json::value::parse(text));
+        fastcomments::bench::doNotOptimize(decoded);
+    });
+    fastcomments::bench::measure(std::string(name) + " binary encode", iterations, [&]() {
+        auto out = model.toBinary();
+        fastcomments::bench::doNotOptimize(out);
+    });
+    fastcomments::bench::measure(std::string(name) + " binary decode", iterations, [&]() {
+        Model decoded;
+        decoded.fromBinary(binary);
+        fastcomments::bench::doNotOptimize(decoded);
+    });
+}
+
+} // anonymous namespace
+
+int main() {
+    const long iterations = 100000;
+    report<APIComment>("APIComment", kComment, iterations);
+    report<UserBadge>("UserBadge", R"({"id": "b1", "userId": "u1", "badgeId": "bb", "type": 2, "threshold": 10,
+        "description": "Top commenter", "displayLabel": "Top", "displaySrc": "https://cdn.example.com/badges/top.png",
+        "backgroundColor": "#000", "borderColor": "#fff", "textColor": "#fff", "cssClass": "top",
+        "veteranUserThresholdMillis": 0, "displayedOnComments": true, "receivedAt": "2024-01-01T00:00:00Z",
+        "order": 1, "urlId": "page", "tenantId": "demo-tenant"})", iterations);
+    return 0;
+}
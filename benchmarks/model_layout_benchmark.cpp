@@ -0,0 +1,39 @@
+// Footprint and construction cost of the models we keep in large caches.
+
+#include "bench_util.hpp"
+
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/APIPage.h"
+#include "FastCommentsClient/model/PublicComment.h"
+#include "FastCommentsClient/model/UserBadge.h"
+
+#include <cstdio>
+#include <memory>
+
+using namespace org::openapitools::client::model;
+
+namespace {
+
+template <typename Model>
+void report(const char* name, long iterations) {
+    std::printf("sizeof(%s) = %zu bytes\n", name, sizeof(Model));
+    fastcomments::bench::measure(std::string("construct ") + name, iterations, []() {
+        Model model;
+        fastcomments::bench::doNotOptimize(model);
+    });
+    fastcomments::bench::measure(std::string("make_shared ") + name, iterations, []() {
+        auto model = std::make_shared<Model>();
+        fastcomments::bench::doNotOptimize(model);
+    });
+}
+
+} // anonymous namespace
+
+int main() {
+    const long iterations = 2000000;
+    report<APIComment>("APIComment", iterations);
+    report<PublicComment>("PublicComment", iterations);
+    report<APIPage>("APIPage", iterations);
+    report<UserBadge>("UserBadge", iterations);
+    return 0;
+}
@@ -0,0 +1,60 @@
+// Cost of serializing a saveCommentsBulk request body: building a json::value DOM
+// and serializing it, versus streaming the models through JsonBody/writeJson.
+
+#include "bench_util.hpp"
+
+#include "FastCommentsClient/JsonBody.h"
+#include "FastCommentsClient/model/CreateCommentParams.h"
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using namespace org::openapitools::client::model;
+
+namespace {
+
+std::vector<std::shared_ptr<CreateCommentParams>> makeComments(size_t count) {
+    std::vector<std::shared_ptr<CreateCommentParams>> comments;
+    comments.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto c = std::make_shared<CreateCommentParams>();
+        c->setDate(1700000000000 + static_cast<int64_t>(i));
+        c->setCommenterName(utility::conversions::to_string_t("Commenter " + std::to_string(i)));
+        c->setCommenterEmail(utility::conversions::to_string_t("user" + std::to_string(i) + "@example.com"));
+        c->setComment(utility::conversions::to_string_t("This is comment number " + std::to_string(i) + ", with \"quotes\" and a\nnewline."));
+        c->setUrl(utility::conversions::to_string_t("https://example.com/articles/some-article"));
+        c->setUrlId(utility::conversions::to_string_t("some-article"));
+        c->setPageTitle(utility::conversions::to_string_t("Some Article"));
+        c->setLocale(utility::conversions::to_string_t("en_us"));
+        c->setApproved(true);
+        c->setRating(4.5);
+        comments.push_back(c);
+    }
+    return comments;
+}
+
+} // anonymous namespace
+
+int main() {
+    const auto comments = makeComments(1000);
+    const long iterations = 200;
+
+    fastcomments::bench::measure("DOM body, 1000 comments", iterations, [&]() {
+        std::vector<web::json::value> array;
+        for (const auto& c : comments) {
+            array.push_back(c->toJson());
+        }
+        JsonBody body(web::json::value::array(array));
+        std::stringstream out;
+        body.writeTo(out);
+        fastcomments::bench::doNotOptimize(out);
+    });
+    fastcomments::bench::measure("streamed body, 1000 comments", iterations, [&]() {
+        JsonBody body(comments);
+        std::stringstream out;
+        body.writeTo(out);
+        fastcomments::bench::doNotOptimize(out);
+    });
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Heap retained by one decoded page of comments from a single thread, where
+// tenantId, urlId, url, pageTitle and friends repeat on every comment.
+
+#include "bench_util.hpp"
+
+#include "FastCommentsClient/model/APIGetCommentsResponse.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using namespace org::openapitools::client::model;
+
+namespace {
+
+std::atomic<long> g_liveBytes{0};
+
+web::json::value makePage(int comments) {
+    web::json::value page = web::json::value::object();
+    web::json::value list = web::json::value::array(comments);
+    for (int i = 0; i < comments; ++i) {
+        web::json::value c = web::json::value::object();
+        auto set = [&](const char* key, const std::string& value) {
+            c[utility::conversions::to_string_t(key)] = web::json::value::string(utility::conversions::to_string_t(value));
+        };
+        set("id", "comment-" + std::to_string(i));
+        set("tenantId", "demo-tenant-0123456789");
+        set("urlId", "https://example.com/articles/an-article-about-things");
+        set("url", "https://example.com/articles/an-article-about-things");
+        set("urlIdRaw", "https://example.com/articles/an-article-about-things?utm_source=feed");
+        set("pageTitle", "An Article About Things, And Other Things Besides");
+        set("commenterName", "Commenter " + std::to_string(i % 20));
+        set("avatarSrc", "https://cdn.example.com/avatars/user-" + std::to_string(i % 20) + ".png");
+        set("comment", "Comment body number " + std::to_string(i));
+        set("commentHTML", "<p>Comment body number " + std::to_string(i) + "</p>");
+        c[utility::conversions::to_string_t("date")] = web::json::value::number(1700000000000.0 + i);
+        c[utility::conversions::to_string_t("votes")] = web::json::value::number(i % 7);
+        list[i] = c;
+    }
+    page[utility::conversions::to_string_t("status")] = web::json::value::string(utility::conversions::to_string_t("success"));
+    page[utility::conversions::to_string_t("comments")] = list;
+    return page;
+}
+
+} // anonymous namespace
+
+void* operator new(std::size_t size) {
+    void* p = std::malloc(size + sizeof(std::max_align_t));
+    if (p == nullptr) throw std::bad_alloc();
+    *static_cast<std::size_t*>(p) = size;
+    g_liveBytes += static_cast<long>(size);
+    return static_cast<char*>(p) + sizeof(std::max_align_t);
+}
+
+void operator delete(void* p) noexcept {
+    if (p == nullptr) return;
+    void* base = static_cast<char*>(p) - sizeof(std::max_align_t);
+    g_liveBytes -= static_cast<long>(*static_cast<std::size_t*>(base));
+    std::free(base);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+int main() {
+    const int comments = 1000;
+    const web::json::value page = makePage(comments);
+
+    long before = g_liveBytes;
+    auto response = std::make_shared<APIGetCommentsResponse>();
+    response->fromJson(page);
+    long retained = g_liveBytes - before;
+    std::printf("retained by %d decoded comments: %ld bytes (%ld per comment)\n",
+                comments, retained, retained / comments);
+
+    fastcomments::bench::measure("decode page of 1000 comments", 50, [&]() {
+        APIGetCommentsResponse decoded;
+        decoded.fromJson(page);
+        fastcomments::bench::doNotOptimize(decoded);
+    });
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * BinaryCodec.h
+ *
+ * Compact tagged binary encoding of models, for local caches and IPC.
+ *
+ * A model is a sequence of fields. Each field starts with the FNV-1a hash of its
+ * JSON key (4 bytes, little endian) and a wire type byte, followed by the value:
+ *
+ *   Varint   zigzag LEB128 (bool, int32, int64, datetime ticks)
+ *   Fixed32  4 bytes (float)
+ *   Fixed64  8 bytes (double)
+ *   String   varint length + UTF-8 bytes (strings, JSON text)
+ *   Block    4 byte length + payload (nested models, arrays, maps);
+ *            a length of 0xFFFFFFFF encodes a null model
+ *   Named    String key + String JSON text (additional properties)
+ *
+ * Readers skip fields whose tag they don't know, so fields can be added to the
+ * schema without invalidating stored data. A top level buffer starts with
+ * kBinaryMagic and kBinaryFormatVersion; the version only changes when the wire
+ * format itself does.
+ */
+
+#ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_BinaryCodec_H_
+#define ORG_OPENAPITOOLS_CLIENT_MODEL_BinaryCodec_H_
+
+
+#include <cpprest/details/basic_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace model {
+
+static const uint8_t kBinaryMagic = 0xFC;
+static const uint8_t kBinaryFormatVersion = 1;
+
+enum class BinaryWireType : uint8_t
+{
+    Varint = 0,
+    Fixed32 = 1,
+    Fixed64 = 2,
+    String = 3,
+    Block = 4,
+    Named = 5
+};
+
+struct BinaryField
+{
+    uint32_t tag;
+    BinaryWireType wireType;
+};
+
+class  BinaryWriter
+{
+public:
+    BinaryWriter();
+
+    void fieldHeader( uint32_t tag, BinaryWireType wireType );
+
+    void writeByte( uint8_t val );
+    void writeVarint( uint64_t val );
+    void writeSignedVarint( int64_t val );
+    void writeFixed32( uint32_t val );
+    void writeFixed64( uint64_t val );
+    void writeString( const utility::string_t& val );
+    void writeBytes( const char* data, size_t length );
+
+    // Reserves a Block length prefix and returns its position for endBlock().
+    size_t beginBlock();
+    void endBlock( size_t position );
+    void nullBlock();
+
+    const std::string& data() const;
+    std::string release();
+
+private:
+    std::string m_Buffer;
+};
+
+class  BinaryReader
+{
+public:
+    BinaryReader();
+    BinaryReader( const char* data, size_t size );
+
+    // Reads the next field header. Returns false at the end of the input or once
+    // the input turned out to be malformed; check ok() to tell the two apart.
+    bool nextField( BinaryField& field );
+    bool skip( const BinaryField& field );
+
+    bool readByte( uint8_t& val );
+    bool readVarint( uint64_t& val );
+    bool readSignedVarint( int64_t& val );
+    bool readFixed32( uint32_t& val );
+    bool readFixed64( uint64_t& val );
+    bool readString( utility::string_t& val );
+
+    // Reads a Block and points block at its payload; isNull is set for a null model.
+    bool readBlock( BinaryReader& block, bool& isNull );
+
+    bool ok() const;
+    bool atEnd() const;
+    size_t remaining() const;
+    bool fail();
+
+private:
+    const char* m_Pos;
+    const char* m_End;
+    bool m_Ok;
+};
+
+}
+}
+}
+}
+
+#endif /* ORG_OPENAPITOOLS_CLIENT_MODEL_BinaryCodec_H_ */
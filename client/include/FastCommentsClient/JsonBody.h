@@ -20,9 +20,13 @@
 
 
 #include "FastCommentsClient/IHttpBody.h"
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/ModelBase.h"
 
 #include <cpprest/json.h>
 
+#include <functional>
+
 namespace org {
 namespace openapitools {
 namespace client {
@@ -33,14 +37,25 @@ class  JsonBody
 {
 public:
     JsonBody( const web::json::value& value );
+    // Keeps the model (or vector of models) and streams it with ModelBase::writeJson
+    // when the request is sent, so no intermediate web::json::value is built.
+    template<typename T>
+    explicit JsonBody( const T& value );
     virtual ~JsonBody();
 
     void writeTo( std::ostream& target ) override;
 
 protected:
     web::json::value m_Json;
+    std::function<void( JsonWriter& )> m_Writer;
 };
 
+template<typename T>
+JsonBody::JsonBody( const T& value )
+    : m_Writer([value]( JsonWriter& writer ) { ModelBase::writeJson(writer, value); })
+{
+}
+
 }
 }
 }
@@ -0,0 +1,85 @@
+/*
+ * JsonWriter.h
+ *
+ * Streams JSON text into a buffer without building a web::json::value tree.
+ */
+
+#ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_JsonWriter_H_
+#define ORG_OPENAPITOOLS_CLIENT_MODEL_JsonWriter_H_
+
+
+#include <cpprest/asyncrt_utils.h>
+#include <cpprest/details/basic_types.h>
+#include <cpprest/json.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace model {
+
+// Writes UTF-8 JSON. Commas and colons are inserted automatically; callers only
+// pair begin/end calls and precede each object member with key(). When a sink is
+// given the buffer is flushed to it whenever it grows past flushThreshold.
+class  JsonWriter
+{
+public:
+    JsonWriter();
+    explicit JsonWriter( std::ostream& sink, size_t flushThreshold = 64 * 1024 );
+    ~JsonWriter();
+
+    JsonWriter( const JsonWriter& ) = delete;
+    JsonWriter& operator=( const JsonWriter& ) = delete;
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    void key( const utility::char_t* name );
+    void key( const utility::string_t& name );
+
+    void null();
+    void value( bool val );
+    void value( int32_t val );
+    void value( int64_t val );
+    void value( float val );
+    void value( double val );
+    void value( const utility::char_t* val );
+    void value( const utility::string_t& val );
+    void value( const utility::datetime& val );
+    // Fallback for values that only exist as a DOM (free-form objects, AnyType).
+    void value( const web::json::value& val );
+
+    // Ends a top-level value with a newline so the next one starts a new line
+    // (newline-delimited JSON).
+    void endLine();
+
+    // Text written so far and not yet flushed to the sink.
+    const std::string& str() const;
+    void flush();
+
+private:
+    void beforeKey();
+    void beforeValue();
+    void writeString( const char* data, size_t length );
+    void writeString( const utility::string_t& val );
+    void maybeFlush();
+
+    std::string m_Buffer;
+    std::ostream* m_Sink;
+    size_t m_FlushThreshold;
+    bool m_NeedComma;
+    bool m_AfterKey;
+};
+
+}
+}
+}
+}
+
+#endif /* ORG_OPENAPITOOLS_CLIENT_MODEL_JsonWriter_H_ */
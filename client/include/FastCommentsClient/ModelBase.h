@@ -20,15 +20,20 @@
 
 
 
+#include "FastCommentsClient/BinaryCodec.h"
 #include "FastCommentsClient/HttpContent.h"
+#include "FastCommentsClient/JsonWriter.h"
 #include "FastCommentsClient/MultipartFormData.h"
+#include "FastCommentsClient/StringInternTable.h"
 
 #include <cpprest/details/basic_types.h>
 #include <cpprest/json.h>
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 namespace org {
@@ -52,12 +57,40 @@ public:
 
     virtual bool isSet() const;
 
+    // Streams the model as JSON without building a web::json::value. Object models
+    // override this with a field-by-field writer; the default serializes toJson().
+    virtual void writeJson( JsonWriter& writer ) const;
+
+    // Tagged binary encoding (see BinaryCodec.h). Object models override these;
+    // the defaults carry the JSON text in a single field.
+    virtual void writeBinary( BinaryWriter& writer ) const;
+    virtual bool readBinary( BinaryReader& reader );
+
+    // Versioned top level buffer for caches and IPC. fromBinary returns false for
+    // data written by an incompatible format version or truncated data.
+    std::string toBinary() const;
+    bool fromBinary( const std::string& data );
+    bool fromBinary( const char* data, size_t size );
+
+    // FNV-1a hash of a JSON object key. The model decoders walk the object once and
+    // switch on the hash of each key; duplicate case labels don't compile, so the hash
+    // is collision-free (perfect) over each model's key set by construction.
+    static constexpr uint32_t fieldHash( const utility::char_t* key );
+    static uint32_t fieldHash( const utility::string_t& key );
+
+    // ISO-8601 codec behind every datetime conversion: "YYYY-MM-DD", optionally
+    // followed by "THH:MM[:SS[.fraction]]" and "Z" or a "+HH:MM" offset (UTC when
+    // absent). Formatting writes UTC with trailing zeros of the fraction dropped.
+    static bool parseDateTime( const utility::string_t& val, utility::datetime& outVal );
+    static utility::string_t formatDateTime( const utility::datetime& val );
+
     static utility::string_t toString( const bool val );
     static utility::string_t toString( const float val );
     static utility::string_t toString( const double val );
     static utility::string_t toString( const int32_t val );
     static utility::string_t toString( const int64_t val );
     static utility::string_t toString( const utility::string_t &val );
+    static utility::string_t toString( const InternedString &val );
     static utility::string_t toString( const utility::datetime &val );
     static utility::string_t toString( const web::json::value &val );
     static utility::string_t toString( const std::shared_ptr<HttpContent>& val );
@@ -74,6 +107,7 @@ public:
     static web::json::value toJson( int32_t val );
     static web::json::value toJson( int64_t val );
     static web::json::value toJson( const utility::string_t& val );
+    static web::json::value toJson( const InternedString& val );
     static web::json::value toJson( const utility::datetime& val );
     static web::json::value toJson( const web::json::value& val );
     static web::json::value toJson( const std::shared_ptr<HttpContent>& val );
@@ -87,6 +121,95 @@ public:
     template<typename T>
     static web::json::value toJson( const std::map<utility::string_t, T>& val );
 
+    static void writeJson( JsonWriter& writer, bool val );
+    static void writeJson( JsonWriter& writer, float val );
+    static void writeJson( JsonWriter& writer, double val );
+    static void writeJson( JsonWriter& writer, int32_t val );
+    static void writeJson( JsonWriter& writer, int64_t val );
+    static void writeJson( JsonWriter& writer, const utility::string_t& val );
+    static void writeJson( JsonWriter& writer, const InternedString& val );
+    static void writeJson( JsonWriter& writer, const utility::datetime& val );
+    static void writeJson( JsonWriter& writer, const web::json::value& val );
+    static void writeJson( JsonWriter& writer, const std::shared_ptr<HttpContent>& val );
+    template<typename T>
+    static void writeJson( JsonWriter& writer, const std::shared_ptr<T>& val );
+    static void writeJson( JsonWriter& writer, const std::shared_ptr<utility::datetime>& val );
+    template<typename T>
+    static void writeJson( JsonWriter& writer, const std::vector<T>& val );
+    template<typename T>
+    static void writeJson( JsonWriter& writer, const std::set<T>& val );
+    template<typename T>
+    static void writeJson( JsonWriter& writer, const std::map<utility::string_t, T>& val );
+
+    // Field level binary helpers used by the generated writeBinary/readBinary. A null
+    // shared_ptr is omitted, matching fromJson treating null as unset.
+    template<typename T>
+    static void writeBinary( BinaryWriter& writer, uint32_t tag, const T& val );
+    template<typename T>
+    static void writeBinary( BinaryWriter& writer, uint32_t tag, const std::shared_ptr<T>& val );
+    template<typename T>
+    static bool readBinary( BinaryReader& reader, const BinaryField& field, T& val );
+
+    static BinaryWireType binaryWireType( bool );
+    static BinaryWireType binaryWireType( float );
+    static BinaryWireType binaryWireType( double );
+    static BinaryWireType binaryWireType( int32_t );
+    static BinaryWireType binaryWireType( int64_t );
+    static BinaryWireType binaryWireType( const utility::string_t& );
+    static BinaryWireType binaryWireType( const InternedString& );
+    static BinaryWireType binaryWireType( const utility::datetime& );
+    static BinaryWireType binaryWireType( const web::json::value& );
+    static BinaryWireType binaryWireType( const std::shared_ptr<HttpContent>& );
+    static BinaryWireType binaryWireType( const std::shared_ptr<utility::datetime>& );
+    template<typename T>
+    static BinaryWireType binaryWireType( const std::shared_ptr<T>& );
+    template<typename T>
+    static BinaryWireType binaryWireType( const std::vector<T>& );
+    template<typename T>
+    static BinaryWireType binaryWireType( const std::set<T>& );
+    template<typename T>
+    static BinaryWireType binaryWireType( const std::map<utility::string_t, T>& );
+
+    static void writeBinaryValue( BinaryWriter& writer, bool val );
+    static void writeBinaryValue( BinaryWriter& writer, float val );
+    static void writeBinaryValue( BinaryWriter& writer, double val );
+    static void writeBinaryValue( BinaryWriter& writer, int32_t val );
+    static void writeBinaryValue( BinaryWriter& writer, int64_t val );
+    static void writeBinaryValue( BinaryWriter& writer, const utility::string_t& val );
+    static void writeBinaryValue( BinaryWriter& writer, const InternedString& val );
+    static void writeBinaryValue( BinaryWriter& writer, const utility::datetime& val );
+    static void writeBinaryValue( BinaryWriter& writer, const web::json::value& val );
+    static void writeBinaryValue( BinaryWriter& writer, const std::shared_ptr<HttpContent>& val );
+    static void writeBinaryValue( BinaryWriter& writer, const std::shared_ptr<utility::datetime>& val );
+    template<typename T>
+    static void writeBinaryValue( BinaryWriter& writer, const std::shared_ptr<T>& val );
+    template<typename T>
+    static void writeBinaryValue( BinaryWriter& writer, const std::vector<T>& val );
+    template<typename T>
+    static void writeBinaryValue( BinaryWriter& writer, const std::set<T>& val );
+    template<typename T>
+    static void writeBinaryValue( BinaryWriter& writer, const std::map<utility::string_t, T>& val );
+
+    static bool readBinaryValue( BinaryReader& reader, bool& val );
+    static bool readBinaryValue( BinaryReader& reader, float& val );
+    static bool readBinaryValue( BinaryReader& reader, double& val );
+    static bool readBinaryValue( BinaryReader& reader, int32_t& val );
+    static bool readBinaryValue( BinaryReader& reader, int64_t& val );
+    static bool readBinaryValue( BinaryReader& reader, utility::string_t& val );
+    static bool readBinaryValue( BinaryReader& reader, InternedString& val );
+    static bool readBinaryValue( BinaryReader& reader, utility::datetime& val );
+    static bool readBinaryValue( BinaryReader& reader, web::json::value& val );
+    static bool readBinaryValue( BinaryReader& reader, std::shared_ptr<HttpContent>& val );
+    static bool readBinaryValue( BinaryReader& reader, std::shared_ptr<utility::datetime>& val );
+    template<typename T>
+    static bool readBinaryValue( BinaryReader& reader, std::shared_ptr<T>& val );
+    template<typename T>
+    static bool readBinaryValue( BinaryReader& reader, std::vector<T>& val );
+    template<typename T>
+    static bool readBinaryValue( BinaryReader& reader, std::set<T>& val );
+    template<typename T>
+    static bool readBinaryValue( BinaryReader& reader, std::map<utility::string_t, T>& val );
+
     static bool fromString( const utility::string_t& val, bool & );
     static bool fromString( const utility::string_t& val, float & );
     static bool fromString( const utility::string_t& val, double & );
@@ -112,6 +235,8 @@ public:
     static bool fromJson( const web::json::value& val, int32_t & );
     static bool fromJson( const web::json::value& val, int64_t & );
     static bool fromJson( const web::json::value& val, utility::string_t & );
+    // Interns through StringInternTable::current().
+    static bool fromJson( const web::json::value& val, InternedString & );
     static bool fromJson( const web::json::value& val, utility::datetime & );
     static bool fromJson( const web::json::value& val, web::json::value & );
     static bool fromJson( const web::json::value& val, std::shared_ptr<HttpContent> & );
@@ -132,6 +257,7 @@ public:
     static std::shared_ptr<HttpContent> toHttpContent( const utility::string_t& name, int32_t value, const utility::string_t& contentType = utility::conversions::to_string_t("") );
     static std::shared_ptr<HttpContent> toHttpContent( const utility::string_t& name, int64_t value, const utility::string_t& contentType = utility::conversions::to_string_t("") );
     static std::shared_ptr<HttpContent> toHttpContent( const utility::string_t& name, const utility::string_t& value, const utility::string_t& contentType = utility::conversions::to_string_t(""));
+    static std::shared_ptr<HttpContent> toHttpContent( const utility::string_t& name, const InternedString& value, const utility::string_t& contentType = utility::conversions::to_string_t(""));
     static std::shared_ptr<HttpContent> toHttpContent( const utility::string_t& name, const utility::datetime& value, const utility::string_t& contentType = utility::conversions::to_string_t(""));
     static std::shared_ptr<HttpContent> toHttpContent( const utility::string_t& name, const web::json::value& value, const utility::string_t& contentType = utility::conversions::to_string_t("application/json") );
     static std::shared_ptr<HttpContent> toHttpContent( const utility::string_t& name, const std::shared_ptr<HttpContent>& );
@@ -170,6 +296,26 @@ protected:
     bool m_IsSet;
 };
 
+constexpr uint32_t ModelBase::fieldHash( const utility::char_t* key )
+{
+    uint32_t hash = 2166136261u;
+    for ( ; *key != 0; ++key )
+    {
+        hash = ( hash ^ static_cast<uint32_t>( *key ) ) * 16777619u;
+    }
+    return hash;
+}
+
+inline uint32_t ModelBase::fieldHash( const utility::string_t& key )
+{
+    uint32_t hash = 2166136261u;
+    for ( const auto c : key )
+    {
+        hash = ( hash ^ static_cast<uint32_t>( c ) ) * 16777619u;
+    }
+    return hash;
+}
+
 template <typename T>
 utility::string_t ModelBase::toString( const std::shared_ptr<T>& val )
 {
@@ -190,7 +336,7 @@ utility::string_t ModelBase::toString( const std::vector<T> & val )
     {
         strArray.append( toString(item) + "," );
     }
-    if (val.count() > 0)
+    if (!val.empty())
     {
         strArray.pop_back();
     }
@@ -206,7 +352,7 @@ utility::string_t ModelBase::toString( const std::set<T> & val )
     {
         strArray.append( toString(item) + "," );
     }
-    if (val.count() > 0)
+    if (!val.empty())
     {
         strArray.pop_back();
     }
@@ -230,11 +376,12 @@ template<typename T>
 web::json::value ModelBase::toJson( const std::vector<T>& value )
 {
     std::vector<web::json::value> ret;
+    ret.reserve( value.size() );
     for ( const auto& x : value )
     {
         ret.push_back( toJson(x) );
     }
-    return web::json::value::array(ret);
+    return web::json::value::array(std::move(ret));
 }
 
 // std::set to json
@@ -243,11 +390,12 @@ web::json::value ModelBase::toJson( const std::set<T>& value )
 {
     // There's no prototype web::json::value::array(...) taking a std::set parameter. Converting to std::vector to get an array.
     std::vector<web::json::value> ret;
+    ret.reserve( value.size() );
     for ( const auto& x : value )
     {
         ret.push_back( toJson(x) );
     }
-    return web::json::value::array(ret);
+    return web::json::value::array(std::move(ret));
 }
 
 
@@ -262,6 +410,220 @@ web::json::value ModelBase::toJson( const std::map<utility::string_t, T>& val )
     return obj;
 }
 template<typename T>
+void ModelBase::writeJson( JsonWriter& writer, const std::shared_ptr<T>& val )
+{
+    if(val != nullptr)
+    {
+        val->writeJson(writer);
+    }
+    else
+    {
+        writer.null();
+    }
+}
+template<typename T>
+void ModelBase::writeJson( JsonWriter& writer, const std::vector<T>& value )
+{
+    writer.beginArray();
+    for ( const auto& x : value )
+    {
+        writeJson(writer, x);
+    }
+    writer.endArray();
+}
+template<typename T>
+void ModelBase::writeJson( JsonWriter& writer, const std::set<T>& value )
+{
+    writer.beginArray();
+    for ( const auto& x : value )
+    {
+        writeJson(writer, x);
+    }
+    writer.endArray();
+}
+template<typename T>
+void ModelBase::writeJson( JsonWriter& writer, const std::map<utility::string_t, T>& val )
+{
+    writer.beginObject();
+    for ( const auto &itemkey : val )
+    {
+        writer.key(itemkey.first);
+        writeJson(writer, itemkey.second);
+    }
+    writer.endObject();
+}
+template<typename T>
+void ModelBase::writeBinary( BinaryWriter& writer, uint32_t tag, const T& val )
+{
+    writer.fieldHeader(tag, binaryWireType(val));
+    writeBinaryValue(writer, val);
+}
+template<typename T>
+void ModelBase::writeBinary( BinaryWriter& writer, uint32_t tag, const std::shared_ptr<T>& val )
+{
+    if(val != nullptr)
+    {
+        writer.fieldHeader(tag, binaryWireType(val));
+        writeBinaryValue(writer, val);
+    }
+}
+template<typename T>
+bool ModelBase::readBinary( BinaryReader& reader, const BinaryField& field, T& val )
+{
+    if(field.wireType != binaryWireType(val))
+    {
+        reader.skip(field);
+        return false;
+    }
+    return readBinaryValue(reader, val);
+}
+template<typename T>
+BinaryWireType ModelBase::binaryWireType( const std::shared_ptr<T>& )
+{
+    return BinaryWireType::Block;
+}
+template<typename T>
+BinaryWireType ModelBase::binaryWireType( const std::vector<T>& )
+{
+    return BinaryWireType::Block;
+}
+template<typename T>
+BinaryWireType ModelBase::binaryWireType( const std::set<T>& )
+{
+    return BinaryWireType::Block;
+}
+template<typename T>
+BinaryWireType ModelBase::binaryWireType( const std::map<utility::string_t, T>& )
+{
+    return BinaryWireType::Block;
+}
+template<typename T>
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const std::shared_ptr<T>& val )
+{
+    if(val == nullptr)
+    {
+        writer.nullBlock();
+        return;
+    }
+    const size_t block = writer.beginBlock();
+    val->writeBinary(writer);
+    writer.endBlock(block);
+}
+template<typename T>
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const std::vector<T>& val )
+{
+    const size_t block = writer.beginBlock();
+    writer.writeVarint(val.size());
+    for ( const auto& x : val )
+    {
+        writeBinaryValue(writer, x);
+    }
+    writer.endBlock(block);
+}
+template<typename T>
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const std::set<T>& val )
+{
+    const size_t block = writer.beginBlock();
+    writer.writeVarint(val.size());
+    for ( const auto& x : val )
+    {
+        writeBinaryValue(writer, x);
+    }
+    writer.endBlock(block);
+}
+template<typename T>
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const std::map<utility::string_t, T>& val )
+{
+    const size_t block = writer.beginBlock();
+    writer.writeVarint(val.size());
+    for ( const auto& itemkey : val )
+    {
+        writer.writeString(itemkey.first);
+        writeBinaryValue(writer, itemkey.second);
+    }
+    writer.endBlock(block);
+}
+template<typename T>
+bool ModelBase::readBinaryValue( BinaryReader& reader, std::shared_ptr<T>& val )
+{
+    BinaryReader block;
+    bool isNull = false;
+    if(!reader.readBlock(block, isNull))
+    {
+        return false;
+    }
+    if(isNull)
+    {
+        val.reset();
+        return true;
+    }
+    val = std::make_shared<T>();
+    return val->readBinary(block);
+}
+template<typename T>
+bool ModelBase::readBinaryValue( BinaryReader& reader, std::vector<T>& val )
+{
+    BinaryReader block;
+    bool isNull = false;
+    uint64_t count = 0;
+    if(!reader.readBlock(block, isNull) || !block.readVarint(count))
+    {
+        return false;
+    }
+    bool ok = true;
+    val.clear();
+    // count is untrusted; every item takes at least one byte of the block.
+    val.reserve(static_cast<size_t>(std::min<uint64_t>(count, block.remaining())));
+    for(uint64_t i = 0; i < count && ok; ++i)
+    {
+        T item;
+        ok = readBinaryValue(block, item);
+        val.push_back(std::move(item));
+    }
+    return ok && block.atEnd();
+}
+template<typename T>
+bool ModelBase::readBinaryValue( BinaryReader& reader, std::set<T>& val )
+{
+    BinaryReader block;
+    bool isNull = false;
+    uint64_t count = 0;
+    if(!reader.readBlock(block, isNull) || !block.readVarint(count))
+    {
+        return false;
+    }
+    bool ok = true;
+    val.clear();
+    for(uint64_t i = 0; i < count && ok; ++i)
+    {
+        T item;
+        ok = readBinaryValue(block, item);
+        val.insert(std::move(item));
+    }
+    return ok && block.atEnd();
+}
+template<typename T>
+bool ModelBase::readBinaryValue( BinaryReader& reader, std::map<utility::string_t, T>& val )
+{
+    BinaryReader block;
+    bool isNull = false;
+    uint64_t count = 0;
+    if(!reader.readBlock(block, isNull) || !block.readVarint(count))
+    {
+        return false;
+    }
+    bool ok = true;
+    val.clear();
+    for(uint64_t i = 0; i < count && ok; ++i)
+    {
+        utility::string_t key;
+        T item;
+        ok = block.readString(key) && readBinaryValue(block, item);
+        val.emplace(std::move(key), std::move(item));
+    }
+    return ok && block.atEnd();
+}
+template<typename T>
 bool ModelBase::fromString( const utility::string_t& val, std::shared_ptr<T>& outVal )
 {
     bool ok = false;
@@ -282,18 +644,13 @@ bool ModelBase::fromString(const utility::string_t& val, std::vector<T>& outVal
     web::json::value jsonValue = web::json::value::parse(val);
     if (jsonValue.is_array())
     {
-        for (const web::json::value& jitem : jsonValue.as_array())
-        {
-            T item;
-            ok &= fromJson(jitem, item);
-            outVal.push_back(item);
-        }
+        ok = fromJson(jsonValue, outVal);
     }
     else
     {
         T item;
         ok = fromJson(jsonValue, item);
-        outVal.push_back(item);
+        outVal.push_back(std::move(item));
     }
     return ok;
 }
@@ -304,42 +661,21 @@ bool ModelBase::fromString(const utility::string_t& val, std::set<T>& outVal )
     web::json::value jsonValue = web::json::value::parse(val);
     if (jsonValue.is_array())
     {
-        for (const web::json::value& jitem : jsonValue.as_array())
-        {
-            T item;
-            ok &= fromJson(jitem, item);
-            outVal.insert(item);
-        }
+        ok = fromJson(jsonValue, outVal);
     }
     else
     {
         T item;
         ok = fromJson(jsonValue, item);
-        outVal.insert(item);
+        outVal.insert(std::move(item));
     }
     return ok;
 }
 template<typename T>
 bool ModelBase::fromString(const utility::string_t& val, std::map<utility::string_t, T>& outVal )
 {
-    bool ok = false;
-    web::json::value jsonValue = web::json::value::parse(val);
-    if (jsonValue.is_array())
-    {
-        for (const web::json::value& jitem : jsonValue.as_array())
-        {
-            T item;
-            ok &= fromJson(jitem, item);
-            outVal.insert({ val, item });
-        }
-    }
-    else
-    {
-        T item;
-        ok = fromJson(jsonValue, item);
-        outVal.insert({ val, item });
-    }
-    return ok;
+    // A map is only ever serialized as a JSON object; its keys are the map keys.
+    return fromJson(web::json::value::parse(val), outVal);
 }
 template<typename T>
 bool ModelBase::fromJson( const web::json::value& val, std::shared_ptr<T> &outVal )
@@ -361,11 +697,13 @@ bool ModelBase::fromJson( const web::json::value& val, std::vector<T> &outVal )
     bool ok = true;
     if (val.is_array())
     {
-        for (const web::json::value & jitem : val.as_array())
+        const web::json::array& items = val.as_array();
+        outVal.reserve(outVal.size() + items.size());
+        for (const web::json::value & jitem : items)
         {
             T item;
             ok &= fromJson(jitem, item);
-            outVal.push_back(item);
+            outVal.push_back(std::move(item));
         }
     }
     else
@@ -384,14 +722,14 @@ bool ModelBase::fromJson(const web::json::value& val, std::set<T>& outVal )
         {
             T item;
             ok &= fromJson(jitem, item);
-            outVal.insert(item);
+            outVal.insert(std::move(item));
         }
     }
     else
     {
         T item;
         ok = fromJson(val, item);
-        outVal.insert(item);
+        outVal.insert(std::move(item));
     }
     return ok;
 }
@@ -401,12 +739,12 @@ bool ModelBase::fromJson( const web::json::value& jval, std::map<utility::string
     bool ok = true;
     if ( jval.is_object() )
     {
-        auto obj = jval.as_object();
-        for( auto objItr = obj.begin() ; objItr != obj.end() ; objItr++ )
+        // json objects iterate in key order, so appending at end() is constant time.
+        for( const auto& field : jval.as_object() )
         {
             T itemVal;
-            ok &= fromJson(objItr->second, itemVal);
-            outVal.insert(std::pair<utility::string_t, T>(objItr->first, itemVal));
+            ok &= fromJson(field.second, itemVal);
+            outVal.emplace_hint(outVal.end(), field.first, std::move(itemVal));
         }
     }
     else
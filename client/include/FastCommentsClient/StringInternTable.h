@@ -0,0 +1,111 @@
+/*
+ * StringInternTable.h
+ *
+ * Shared storage for string values that repeat across the models of a response
+ * (tenantId, urlId, pageTitle, ... on every comment of a thread).
+ */
+
+#ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_StringInternTable_H_
+#define ORG_OPENAPITOOLS_CLIENT_MODEL_StringInternTable_H_
+
+
+#include <cpprest/details/basic_types.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace model {
+
+// Immutable string handle. Copies share one allocation; values decoded through a
+// StringInternTable also share it with every other model holding the same text.
+class  InternedString
+{
+public:
+    InternedString();
+    InternedString( const utility::string_t& value );
+    InternedString( utility::string_t&& value );
+    explicit InternedString( std::shared_ptr<const utility::string_t> value );
+
+    const utility::string_t& str() const;
+    operator const utility::string_t&() const;
+    bool empty() const;
+
+    // True when both handles point at the same storage, i.e. were interned together.
+    bool sharesStorageWith( const InternedString& other ) const;
+
+private:
+    std::shared_ptr<const utility::string_t> m_Value;
+};
+
+bool operator==( const InternedString& a, const InternedString& b );
+bool operator!=( const InternedString& a, const InternedString& b );
+
+// Entries are split over stripes by hash, each with its own lock, so decoders
+// on different threads rarely wait on each other in the shared table.
+class  StringInternTable
+{
+public:
+    StringInternTable();
+
+    StringInternTable( const StringInternTable& ) = delete;
+    StringInternTable& operator=( const StringInternTable& ) = delete;
+
+    InternedString intern( const utility::string_t& value );
+
+    // Drops entries no model refers to any more.
+    void prune();
+    void clear();
+    size_t size() const;
+
+    // Table used by the model decoders on this thread: the innermost active Scope,
+    // or the process-wide shared() table when there is none.
+    static StringInternTable& current();
+    static StringInternTable& shared();
+
+    // Routes the decoders on this thread to a table of the caller's choosing, e.g.
+    // one table per response or per cached thread.
+    class  Scope
+    {
+    public:
+        explicit Scope( StringInternTable& table );
+        ~Scope();
+
+        Scope( const Scope& ) = delete;
+        Scope& operator=( const Scope& ) = delete;
+
+    private:
+        StringInternTable* m_Previous;
+    };
+
+private:
+    static const size_t kStripes = 16;
+
+    struct Stripe
+    {
+        Stripe();
+
+        mutable std::mutex mutex;
+        // Keys view the text owned by the mapped value, so each string is stored once.
+        std::unordered_map<std::basic_string_view<utility::char_t>, std::shared_ptr<const utility::string_t>> entries;
+        size_t pruneAt;
+    };
+
+    // Caller holds stripe.mutex.
+    static void pruneLocked( Stripe& stripe );
+
+    std::array<Stripe, kStripes> m_Stripes;
+};
+
+}
+}
+}
+}
+
+#endif /* ORG_OPENAPITOOLS_CLIENT_MODEL_StringInternTable_H_ */
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APIAuditLog_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -144,38 +147,36 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_UserId,
+        FieldBit_Username,
+        FieldBit_ResourceName,
+        FieldBit_CrudType,
+        FieldBit_From,
+        FieldBit_Url,
+        FieldBit_Ip,
+        FieldBit_When,
+        FieldBit_Description,
+        FieldBit_ServerStartDate,
+        FieldBit_ObjectDetails,
+        FieldBitCount
+    };
 
+    CrudTypeEnum m_CrudType;
+    FromEnum m_From;
+    utility::string_t m__id;
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
     utility::string_t m_ResourceName;
-    bool m_ResourceNameIsSet;
-
-    CrudTypeEnum m_CrudType;
-    bool m_CrudTypeIsSet;
-
-    FromEnum m_From;
-    bool m_FromIsSet;
-
-    boost::optional<utility::string_t> m_Url;
-
-    boost::optional<utility::string_t> m_Ip;
-
+    utility::string_t m_Url;
+    utility::string_t m_Ip;
     utility::datetime m_When;
-    bool m_WhenIsSet;
-
     utility::string_t m_Description;
-    bool m_DescriptionIsSet;
-
     utility::datetime m_ServerStartDate;
-    bool m_ServerStartDateIsSet;
-
-    boost::optional<std::map<utility::string_t, std::shared_ptr<AnyType>>> m_ObjectDetails;
+    std::map<utility::string_t, std::shared_ptr<AnyType>> m_ObjectDetails;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
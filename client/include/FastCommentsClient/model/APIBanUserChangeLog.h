@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APIBanUserChangeLog_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APIBanUserChangeLog_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -81,17 +84,20 @@ public:
 
 
 protected:
-    utility::string_t m_CreatedBannedUserId;
-    bool m_CreatedBannedUserIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_CreatedBannedUserId,
+        FieldBit_UpdatedBannedUserId,
+        FieldBit_DeletedBannedUsers,
+        FieldBit_ChangedValuesBefore,
+        FieldBitCount
+    };
 
+    utility::string_t m_CreatedBannedUserId;
     utility::string_t m_UpdatedBannedUserId;
-    bool m_UpdatedBannedUserIdIsSet;
-
     std::vector<std::shared_ptr<APIBannedUser>> m_DeletedBannedUsers;
-    bool m_DeletedBannedUsersIsSet;
-
     std::shared_ptr<APIBanUserChangedValues> m_ChangedValuesBefore;
-    bool m_ChangedValuesBeforeIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
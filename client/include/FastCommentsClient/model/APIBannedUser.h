@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APIBannedUser_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APIBannedUser_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -121,39 +124,38 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UserId,
+        FieldBit_Email,
+        FieldBit_Username,
+        FieldBit_IpHash,
+        FieldBit_CreatedAt,
+        FieldBit_BannedByUserId,
+        FieldBit_BannedCommentText,
+        FieldBit_BanType,
+        FieldBit_BannedUntil,
+        FieldBit_HasEmailWildcard,
+        FieldBit_BanReason,
+        FieldBitCount
+    };
 
+    bool m_HasEmailWildcard;
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    boost::optional<utility::string_t> m_Email;
-
-    boost::optional<utility::string_t> m_Username;
-
-    boost::optional<utility::string_t> m_IpHash;
-
+    utility::string_t m_UserId;
+    utility::string_t m_Email;
+    utility::string_t m_Username;
+    utility::string_t m_IpHash;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_BannedByUserId;
-    bool m_BannedByUserIdIsSet;
-
     utility::string_t m_BannedCommentText;
-    bool m_BannedCommentTextIsSet;
-
     utility::string_t m_BanType;
-    bool m_BanTypeIsSet;
-
-    boost::optional<utility::datetime> m_BannedUntil;
-
-    bool m_HasEmailWildcard;
-    bool m_HasEmailWildcardIsSet;
-
+    utility::datetime m_BannedUntil;
     utility::string_t m_BanReason;
-    bool m_BanReasonIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
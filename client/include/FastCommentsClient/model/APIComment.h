@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APIComment_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APIComment_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -52,7 +52,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -329,138 +332,118 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_AiDeterminedSpam,
+        FieldBit_AnonUserId,
+        FieldBit_Approved,
+        FieldBit_AvatarSrc,
+        FieldBit_Badges,
+        FieldBit_Comment,
+        FieldBit_CommentHTML,
+        FieldBit_CommenterEmail,
+        FieldBit_CommenterLink,
+        FieldBit_CommenterName,
+        FieldBit_date,
+        FieldBit_DisplayLabel,
+        FieldBit_Domain,
+        FieldBit_ExternalId,
+        FieldBit_ExternalParentId,
+        FieldBit_ExpireAt,
+        FieldBit_FeedbackIds,
+        FieldBit_FlagCount,
+        FieldBit_FromProductId,
+        FieldBit_HasCode,
+        FieldBit_HasImages,
+        FieldBit_HasLinks,
+        FieldBit_HashTags,
+        FieldBit_IsByAdmin,
+        FieldBit_IsByModerator,
+        FieldBit_IsDeleted,
+        FieldBit_IsDeletedUser,
+        FieldBit_IsPinned,
+        FieldBit_IsLocked,
+        FieldBit_IsSpam,
+        FieldBit_LocalDateHours,
+        FieldBit_LocalDateString,
+        FieldBit_Locale,
+        FieldBit_Mentions,
+        FieldBit_Meta,
+        FieldBit_ModerationGroupIds,
+        FieldBit_NotificationSentForParent,
+        FieldBit_NotificationSentForParentTenant,
+        FieldBit_PageTitle,
+        FieldBit_ParentId,
+        FieldBit_Rating,
+        FieldBit_Reviewed,
+        FieldBit_TenantId,
+        FieldBit_Url,
+        FieldBit_UrlId,
+        FieldBit_UrlIdRaw,
+        FieldBit_UserId,
+        FieldBit_Verified,
+        FieldBit_VerifiedDate,
+        FieldBit_Votes,
+        FieldBit_VotesDown,
+        FieldBit_VotesUp,
+        FieldBitCount
+    };
 
     bool m_AiDeterminedSpam;
-    bool m_AiDeterminedSpamIsSet;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
     bool m_Approved;
-    bool m_ApprovedIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
-    boost::optional<std::vector<std::shared_ptr<CommentUserBadgeInfo>>> m_Badges;
-
-    utility::string_t m_Comment;
-    bool m_CommentIsSet;
-
-    utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
-    boost::optional<utility::string_t> m_CommenterEmail;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<double> m_date;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
-    boost::optional<utility::string_t> m_Domain;
-
-    utility::string_t m_ExternalId;
-    bool m_ExternalIdIsSet;
-
-    boost::optional<utility::string_t> m_ExternalParentId;
-
-    boost::optional<utility::datetime> m_ExpireAt;
-
-    std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
-
-    boost::optional<int32_t> m_FlagCount;
-
-    int32_t m_FromProductId;
-    bool m_FromProductIdIsSet;
-
     bool m_HasCode;
-    bool m_HasCodeIsSet;
-
     bool m_HasImages;
-    bool m_HasImagesIsSet;
-
     bool m_HasLinks;
-    bool m_HasLinksIsSet;
-
-    std::vector<std::shared_ptr<CommentUserHashTagInfo>> m_HashTags;
-    bool m_HashTagsIsSet;
-
     bool m_IsByAdmin;
-    bool m_IsByAdminIsSet;
-
     bool m_IsByModerator;
-    bool m_IsByModeratorIsSet;
-
     bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
-
     bool m_IsDeletedUser;
-    bool m_IsDeletedUserIsSet;
-
-    boost::optional<bool> m_IsPinned;
-
-    boost::optional<bool> m_IsLocked;
-
+    bool m_IsPinned;
+    bool m_IsLocked;
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
-    boost::optional<int32_t> m_LocalDateHours;
-
-    boost::optional<utility::string_t> m_LocalDateString;
-
-    boost::optional<utility::string_t> m_Locale;
-
-    std::vector<std::shared_ptr<CommentUserMentionInfo>> m_Mentions;
-    bool m_MentionsIsSet;
-
-    boost::optional<std::shared_ptr<APICommentBase_meta>> m_Meta;
-
-    boost::optional<std::vector<utility::string_t>> m_ModerationGroupIds;
-
     bool m_NotificationSentForParent;
-    bool m_NotificationSentForParentIsSet;
-
     bool m_NotificationSentForParentTenant;
-    bool m_NotificationSentForParentTenantIsSet;
-
-    boost::optional<utility::string_t> m_PageTitle;
-
-    boost::optional<utility::string_t> m_ParentId;
-
-    boost::optional<double> m_Rating;
-
     bool m_Reviewed;
-    bool m_ReviewedIsSet;
-
-    utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
-    utility::string_t m_Url;
-    bool m_UrlIsSet;
-
-    utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
-    utility::string_t m_UrlIdRaw;
-    bool m_UrlIdRawIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    boost::optional<utility::datetime> m_VerifiedDate;
-
-    boost::optional<int32_t> m_Votes;
-
-    boost::optional<int32_t> m_VotesDown;
-
-    boost::optional<int32_t> m_VotesUp;
+    int32_t m_FlagCount;
+    int32_t m_FromProductId;
+    int32_t m_LocalDateHours;
+    int32_t m_Votes;
+    int32_t m_VotesDown;
+    int32_t m_VotesUp;
+    utility::string_t m_Id;
+    utility::string_t m_AnonUserId;
+    InternedString m_AvatarSrc;
+    std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
+    utility::string_t m_Comment;
+    utility::string_t m_CommentHTML;
+    utility::string_t m_CommenterEmail;
+    utility::string_t m_CommenterLink;
+    InternedString m_CommenterName;
+    double m_date;
+    utility::string_t m_DisplayLabel;
+    utility::string_t m_Domain;
+    utility::string_t m_ExternalId;
+    utility::string_t m_ExternalParentId;
+    utility::datetime m_ExpireAt;
+    std::vector<utility::string_t> m_FeedbackIds;
+    std::vector<std::shared_ptr<CommentUserHashTagInfo>> m_HashTags;
+    utility::string_t m_LocalDateString;
+    utility::string_t m_Locale;
+    std::vector<std::shared_ptr<CommentUserMentionInfo>> m_Mentions;
+    std::shared_ptr<APICommentBase_meta> m_Meta;
+    std::vector<utility::string_t> m_ModerationGroupIds;
+    InternedString m_PageTitle;
+    utility::string_t m_ParentId;
+    double m_Rating;
+    InternedString m_TenantId;
+    InternedString m_Url;
+    InternedString m_UrlId;
+    InternedString m_UrlIdRaw;
+    utility::string_t m_UserId;
+    utility::datetime m_VerifiedDate;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APICommentBase_meta_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APICommentBase_meta_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -84,14 +87,19 @@ public:
     void addAdditionalProperty(const utility::string_t& key, const web::json::value& value);
 
 protected:
-    utility::string_t m_WpUserId;
-    bool m_WpUserIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_WpUserId,
+        FieldBit_WpPostId,
+        FieldBit_AdditionalProperties,
+        FieldBitCount
+    };
 
+    utility::string_t m_WpUserId;
     utility::string_t m_WpPostId;
-    bool m_WpPostIdIsSet;
-
     std::map<utility::string_t, web::json::value> m_AdditionalProperties;
-    bool m_AdditionalPropertiesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
+
 };
 
 
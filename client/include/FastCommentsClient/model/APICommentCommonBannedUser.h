@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APICommentCommonBannedUser_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APICommentCommonBannedUser_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -96,25 +99,28 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    utility::string_t m_BanType;
-    bool m_BanTypeIsSet;
-
-    boost::optional<utility::string_t> m_Email;
-
-    boost::optional<utility::string_t> m_IpHash;
-
-    boost::optional<utility::datetime> m_BannedUntil;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_UserId,
+        FieldBit_BanType,
+        FieldBit_Email,
+        FieldBit_IpHash,
+        FieldBit_BannedUntil,
+        FieldBit_HasEmailWildcard,
+        FieldBit_BanReason,
+        FieldBitCount
+    };
 
     bool m_HasEmailWildcard;
-    bool m_HasEmailWildcardIsSet;
-
+    utility::string_t m__id;
+    utility::string_t m_UserId;
+    utility::string_t m_BanType;
+    utility::string_t m_Email;
+    utility::string_t m_IpHash;
+    utility::datetime m_BannedUntil;
     utility::string_t m_BanReason;
-    bool m_BanReasonIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APICreateUserBadgeResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,14 +79,18 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_UserBadge,
+        FieldBit_Notes,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     std::shared_ptr<UserBadge> m_UserBadge;
-    bool m_UserBadgeIsSet;
-
     std::vector<utility::string_t> m_Notes;
-    bool m_NotesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APIDomainConfiguration_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -137,44 +140,42 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Domain,
+        FieldBit_EmailFromName,
+        FieldBit_EmailFromEmail,
+        FieldBit_EmailHeaders,
+        FieldBit_WpSyncToken,
+        FieldBit_WpSynced,
+        FieldBit_WpURL,
+        FieldBit_CreatedAt,
+        FieldBit_AutoAddedDate,
+        FieldBit_SiteType,
+        FieldBit_LogoSrc,
+        FieldBit_LogoSrc100px,
+        FieldBit_FooterUnsubscribeURL,
+        FieldBit_DisableUnsubscribeLinks,
+        FieldBitCount
+    };
 
+    bool m_WpSynced;
+    bool m_DisableUnsubscribeLinks;
+    utility::string_t m_Id;
     utility::string_t m_Domain;
-    bool m_DomainIsSet;
-
-    boost::optional<utility::string_t> m_EmailFromName;
-
-    boost::optional<utility::string_t> m_EmailFromEmail;
-
+    utility::string_t m_EmailFromName;
+    utility::string_t m_EmailFromEmail;
     std::map<utility::string_t, utility::string_t> m_EmailHeaders;
-    bool m_EmailHeadersIsSet;
-
-    boost::optional<utility::string_t> m_WpSyncToken;
-
-    bool m_WpSynced;
-    bool m_WpSyncedIsSet;
-
-    boost::optional<utility::string_t> m_WpURL;
-
+    utility::string_t m_WpSyncToken;
+    utility::string_t m_WpURL;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::datetime m_AutoAddedDate;
-    bool m_AutoAddedDateIsSet;
-
     std::shared_ptr<ImportedSiteType> m_SiteType;
-    bool m_SiteTypeIsSet;
-
-    boost::optional<utility::string_t> m_LogoSrc;
-
-    boost::optional<utility::string_t> m_LogoSrc100px;
-
+    utility::string_t m_LogoSrc;
+    utility::string_t m_LogoSrc100px;
     utility::string_t m_FooterUnsubscribeURL;
-    bool m_FooterUnsubscribeURLIsSet;
-
-    bool m_DisableUnsubscribeLinks;
-    bool m_DisableUnsubscribeLinksIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APIModerateUserBanPreferences_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APIModerateUserBanPreferences_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,17 +79,20 @@ public:
 
 
 protected:
-    bool m_ShouldBanEmail;
-    bool m_ShouldBanEmailIsSet;
+    enum FieldBit
+    {
+        FieldBit_ShouldBanEmail,
+        FieldBit_ShouldBanByIP,
+        FieldBit_LastBanType,
+        FieldBit_LastBanDuration,
+        FieldBitCount
+    };
 
+    bool m_ShouldBanEmail;
     bool m_ShouldBanByIP;
-    bool m_ShouldBanByIPIsSet;
-
     utility::string_t m_LastBanType;
-    bool m_LastBanTypeIsSet;
-
     utility::string_t m_LastBanDuration;
-    bool m_LastBanDurationIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
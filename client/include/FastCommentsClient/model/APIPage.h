@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APIPage_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APIPage_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -102,32 +105,30 @@ public:
 
 
 protected:
-    bool m_IsClosed;
-    bool m_IsClosedIsSet;
+    enum FieldBit
+    {
+        FieldBit_IsClosed,
+        FieldBit_AccessibleByGroupIds,
+        FieldBit_RootCommentCount,
+        FieldBit_CommentCount,
+        FieldBit_CreatedAt,
+        FieldBit_Title,
+        FieldBit_Url,
+        FieldBit_UrlId,
+        FieldBit_Id,
+        FieldBitCount
+    };
 
+    bool m_IsClosed;
     std::vector<utility::string_t> m_AccessibleByGroupIds;
-    bool m_AccessibleByGroupIdsIsSet;
-
     int64_t m_RootCommentCount;
-    bool m_RootCommentCountIsSet;
-
     int64_t m_CommentCount;
-    bool m_CommentCountIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_Title;
-    bool m_TitleIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_Id;
-    bool m_IdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APISSOUser_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APISSOUser_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -157,65 +160,52 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
-
-    utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
-    utility::string_t m_WebsiteUrl;
-    bool m_WebsiteUrlIsSet;
-
-    utility::string_t m_Email;
-    bool m_EmailIsSet;
-
-    int64_t m_SignUpDate;
-    bool m_SignUpDateIsSet;
-
-    utility::string_t m_CreatedFromUrlId;
-    bool m_CreatedFromUrlIdIsSet;
-
-    int32_t m_LoginCount;
-    bool m_LoginCountIsSet;
-
-    utility::string_t m_AvatarSrc;
-    bool m_AvatarSrcIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Username,
+        FieldBit_WebsiteUrl,
+        FieldBit_Email,
+        FieldBit_SignUpDate,
+        FieldBit_CreatedFromUrlId,
+        FieldBit_LoginCount,
+        FieldBit_AvatarSrc,
+        FieldBit_OptedInNotifications,
+        FieldBit_OptedInSubscriptionNotifications,
+        FieldBit_DisplayLabel,
+        FieldBit_DisplayName,
+        FieldBit_IsAccountOwner,
+        FieldBit_IsAdminAdmin,
+        FieldBit_IsCommentModeratorAdmin,
+        FieldBit_IsProfileActivityPrivate,
+        FieldBit_IsProfileCommentsPrivate,
+        FieldBit_IsProfileDMDisabled,
+        FieldBit_HasBlockedUsers,
+        FieldBit_GroupIds,
+        FieldBitCount
+    };
 
     bool m_OptedInNotifications;
-    bool m_OptedInNotificationsIsSet;
-
     bool m_OptedInSubscriptionNotifications;
-    bool m_OptedInSubscriptionNotificationsIsSet;
-
-    utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
-
-    utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
     bool m_IsAccountOwner;
-    bool m_IsAccountOwnerIsSet;
-
     bool m_IsAdminAdmin;
-    bool m_IsAdminAdminIsSet;
-
     bool m_IsCommentModeratorAdmin;
-    bool m_IsCommentModeratorAdminIsSet;
-
     bool m_IsProfileActivityPrivate;
-    bool m_IsProfileActivityPrivateIsSet;
-
     bool m_IsProfileCommentsPrivate;
-    bool m_IsProfileCommentsPrivateIsSet;
-
     bool m_IsProfileDMDisabled;
-    bool m_IsProfileDMDisabledIsSet;
-
     bool m_HasBlockedUsers;
-    bool m_HasBlockedUsersIsSet;
-
+    int32_t m_LoginCount;
+    utility::string_t m_Id;
+    utility::string_t m_Username;
+    utility::string_t m_WebsiteUrl;
+    utility::string_t m_Email;
+    int64_t m_SignUpDate;
+    utility::string_t m_CreatedFromUrlId;
+    utility::string_t m_AvatarSrc;
+    utility::string_t m_DisplayLabel;
+    utility::string_t m_DisplayName;
     std::vector<utility::string_t> m_GroupIds;
-    bool m_GroupIdsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
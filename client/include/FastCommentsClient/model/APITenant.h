@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APITenant_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APITenant_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -205,88 +208,68 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Name,
+        FieldBit_Email,
+        FieldBit_SignUpDate,
+        FieldBit_PackageId,
+        FieldBit_PaymentFrequency,
+        FieldBit_BillingInfoValid,
+        FieldBit_BillingHandledExternally,
+        FieldBit_CreatedBy,
+        FieldBit_IsSetup,
+        FieldBit_DomainConfiguration,
+        FieldBit_BillingInfo,
+        FieldBit_StripeCustomerId,
+        FieldBit_StripeSubscriptionId,
+        FieldBit_StripePlanId,
+        FieldBit_EnableProfanityFilter,
+        FieldBit_EnableSpamFilter,
+        FieldBit_LastBillingIssueReminderDate,
+        FieldBit_RemoveUnverifiedComments,
+        FieldBit_UnverifiedCommentsTTLms,
+        FieldBit_CommentsRequireApproval,
+        FieldBit_AutoApproveCommentOnVerification,
+        FieldBit_SendProfaneToSpam,
+        FieldBit_HasFlexPricing,
+        FieldBit_HasAuditing,
+        FieldBit_FlexLastBilledAmount,
+        FieldBit_DeAnonIpAddr,
+        FieldBit_Meta,
+        FieldBitCount
+    };
 
+    bool m_BillingInfoValid;
+    bool m_BillingHandledExternally;
+    bool m_IsSetup;
+    bool m_EnableProfanityFilter;
+    bool m_EnableSpamFilter;
+    bool m_RemoveUnverifiedComments;
+    bool m_CommentsRequireApproval;
+    bool m_AutoApproveCommentOnVerification;
+    bool m_SendProfaneToSpam;
+    bool m_HasFlexPricing;
+    bool m_HasAuditing;
+    utility::string_t m_Id;
     utility::string_t m_Name;
-    bool m_NameIsSet;
-
     utility::string_t m_Email;
-    bool m_EmailIsSet;
-
     double m_SignUpDate;
-    bool m_SignUpDateIsSet;
-
     utility::string_t m_PackageId;
-    bool m_PackageIdIsSet;
-
     double m_PaymentFrequency;
-    bool m_PaymentFrequencyIsSet;
-
-    bool m_BillingInfoValid;
-    bool m_BillingInfoValidIsSet;
-
-    bool m_BillingHandledExternally;
-    bool m_BillingHandledExternallyIsSet;
-
     utility::string_t m_CreatedBy;
-    bool m_CreatedByIsSet;
-
-    bool m_IsSetup;
-    bool m_IsSetupIsSet;
-
     std::vector<std::shared_ptr<APIDomainConfiguration>> m_DomainConfiguration;
-    bool m_DomainConfigurationIsSet;
-
     std::shared_ptr<BillingInfo> m_BillingInfo;
-    bool m_BillingInfoIsSet;
-
     utility::string_t m_StripeCustomerId;
-    bool m_StripeCustomerIdIsSet;
-
     utility::string_t m_StripeSubscriptionId;
-    bool m_StripeSubscriptionIdIsSet;
-
     utility::string_t m_StripePlanId;
-    bool m_StripePlanIdIsSet;
-
-    bool m_EnableProfanityFilter;
-    bool m_EnableProfanityFilterIsSet;
-
-    bool m_EnableSpamFilter;
-    bool m_EnableSpamFilterIsSet;
-
     utility::datetime m_LastBillingIssueReminderDate;
-    bool m_LastBillingIssueReminderDateIsSet;
-
-    bool m_RemoveUnverifiedComments;
-    bool m_RemoveUnverifiedCommentsIsSet;
-
-    boost::optional<double> m_UnverifiedCommentsTTLms;
-
-    bool m_CommentsRequireApproval;
-    bool m_CommentsRequireApprovalIsSet;
-
-    bool m_AutoApproveCommentOnVerification;
-    bool m_AutoApproveCommentOnVerificationIsSet;
-
-    bool m_SendProfaneToSpam;
-    bool m_SendProfaneToSpamIsSet;
-
-    bool m_HasFlexPricing;
-    bool m_HasFlexPricingIsSet;
-
-    bool m_HasAuditing;
-    bool m_HasAuditingIsSet;
-
+    double m_UnverifiedCommentsTTLms;
     double m_FlexLastBilledAmount;
-    bool m_FlexLastBilledAmountIsSet;
-
     double m_DeAnonIpAddr;
-    bool m_DeAnonIpAddrIsSet;
-
     std::map<utility::string_t, utility::string_t> m_Meta;
-    bool m_MetaIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
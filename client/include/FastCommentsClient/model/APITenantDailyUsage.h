@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APITenantDailyUsage_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APITenantDailyUsage_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -151,62 +154,50 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_TenantId,
+        FieldBit_YearNumber,
+        FieldBit_MonthNumber,
+        FieldBit_DayNumber,
+        FieldBit_CommentFetchCount,
+        FieldBit_CommentCreateCount,
+        FieldBit_ConversationCreateCount,
+        FieldBit_VoteCount,
+        FieldBit_AccountCreatedCount,
+        FieldBit_UserMentionSearch,
+        FieldBit_HashTagSearch,
+        FieldBit_GifSearchTrending,
+        FieldBit_GifSearch,
+        FieldBit_ApiCreditsUsed,
+        FieldBit_CreatedAt,
+        FieldBit_Billed,
+        FieldBit_Ignored,
+        FieldBit_ApiErrorCount,
+        FieldBitCount
+    };
 
+    bool m_Billed;
+    bool m_Ignored;
+    utility::string_t m_Id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     double m_YearNumber;
-    bool m_YearNumberIsSet;
-
     double m_MonthNumber;
-    bool m_MonthNumberIsSet;
-
     double m_DayNumber;
-    bool m_DayNumberIsSet;
-
     double m_CommentFetchCount;
-    bool m_CommentFetchCountIsSet;
-
     double m_CommentCreateCount;
-    bool m_CommentCreateCountIsSet;
-
     double m_ConversationCreateCount;
-    bool m_ConversationCreateCountIsSet;
-
     double m_VoteCount;
-    bool m_VoteCountIsSet;
-
     double m_AccountCreatedCount;
-    bool m_AccountCreatedCountIsSet;
-
     double m_UserMentionSearch;
-    bool m_UserMentionSearchIsSet;
-
     double m_HashTagSearch;
-    bool m_HashTagSearchIsSet;
-
     double m_GifSearchTrending;
-    bool m_GifSearchTrendingIsSet;
-
     double m_GifSearch;
-    bool m_GifSearchIsSet;
-
     double m_ApiCreditsUsed;
-    bool m_ApiCreditsUsedIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    bool m_Billed;
-    bool m_BilledIsSet;
-
-    bool m_Ignored;
-    bool m_IgnoredIsSet;
-
     double m_ApiErrorCount;
-    bool m_ApiErrorCountIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
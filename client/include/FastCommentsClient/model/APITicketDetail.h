@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APITicketDetail_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APITicketDetail_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -124,41 +127,38 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_UrlId,
+        FieldBit_UserId,
+        FieldBit_ManagedByTenantId,
+        FieldBit_AssignedUserIds,
+        FieldBit_Subject,
+        FieldBit_CreatedAt,
+        FieldBit_State,
+        FieldBit_FileCount,
+        FieldBit_Files,
+        FieldBit_ReopenedAt,
+        FieldBit_ResolvedAt,
+        FieldBit_AckAt,
+        FieldBitCount
+    };
 
+    int32_t m_State;
+    int32_t m_FileCount;
+    utility::string_t m__id;
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::string_t m_ManagedByTenantId;
-    bool m_ManagedByTenantIdIsSet;
-
     std::vector<utility::string_t> m_AssignedUserIds;
-    bool m_AssignedUserIdsIsSet;
-
     utility::string_t m_Subject;
-    bool m_SubjectIsSet;
-
     utility::string_t m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    int32_t m_State;
-    bool m_StateIsSet;
-
-    int32_t m_FileCount;
-    bool m_FileCountIsSet;
-
     std::vector<std::shared_ptr<APITicketFile>> m_Files;
-    bool m_FilesIsSet;
-
-    boost::optional<utility::string_t> m_ReopenedAt;
-
-    boost::optional<utility::string_t> m_ResolvedAt;
-
-    boost::optional<utility::string_t> m_AckAt;
+    utility::string_t m_ReopenedAt;
+    utility::string_t m_ResolvedAt;
+    utility::string_t m_AckAt;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_APITicketFile_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_APITicketFile_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -106,35 +109,32 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_S3Key,
+        FieldBit_OriginalFileName,
+        FieldBit_SizeBytes,
+        FieldBit_ContentType,
+        FieldBit_UploadedByUserId,
+        FieldBit_UploadedAt,
+        FieldBit_Url,
+        FieldBit_ExpiresAt,
+        FieldBit_Expired,
+        FieldBitCount
+    };
 
+    bool m_Expired;
+    int32_t m_SizeBytes;
+    utility::string_t m_Id;
     utility::string_t m_S3Key;
-    bool m_S3KeyIsSet;
-
     utility::string_t m_OriginalFileName;
-    bool m_OriginalFileNameIsSet;
-
-    int32_t m_SizeBytes;
-    bool m_SizeBytesIsSet;
-
     utility::string_t m_ContentType;
-    bool m_ContentTypeIsSet;
-
     utility::string_t m_UploadedByUserId;
-    bool m_UploadedByUserIdIsSet;
-
     utility::string_t m_UploadedAt;
-    bool m_UploadedAtIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
-
     utility::string_t m_ExpiresAt;
-    bool m_ExpiresAtIsSet;
-
-    bool m_Expired;
-    bool m_ExpiredIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
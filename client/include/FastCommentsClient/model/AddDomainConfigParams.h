@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_AddDomainConfigParams_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AddDomainConfigParams_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -95,26 +98,26 @@ public:
 
 
 protected:
-    utility::string_t m_Domain;
-    bool m_DomainIsSet;
+    enum FieldBit
+    {
+        FieldBit_Domain,
+        FieldBit_EmailFromName,
+        FieldBit_EmailFromEmail,
+        FieldBit_LogoSrc,
+        FieldBit_LogoSrc100px,
+        FieldBit_FooterUnsubscribeURL,
+        FieldBit_EmailHeaders,
+        FieldBitCount
+    };
 
+    utility::string_t m_Domain;
     utility::string_t m_EmailFromName;
-    bool m_EmailFromNameIsSet;
-
     utility::string_t m_EmailFromEmail;
-    bool m_EmailFromEmailIsSet;
-
     utility::string_t m_LogoSrc;
-    bool m_LogoSrcIsSet;
-
     utility::string_t m_LogoSrc100px;
-    bool m_LogoSrc100pxIsSet;
-
     utility::string_t m_FooterUnsubscribeURL;
-    bool m_FooterUnsubscribeURLIsSet;
-
     std::map<utility::string_t, utility::string_t> m_EmailHeaders;
-    bool m_EmailHeadersIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_AdjustVotesResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AdjustVotesResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -66,11 +69,16 @@ public:
 
 
 protected:
-    utility::string_t m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_NewCommentVotes,
+        FieldBitCount
+    };
 
     int32_t m_NewCommentVotes;
-    bool m_NewCommentVotesIsSet;
+    utility::string_t m_Status;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
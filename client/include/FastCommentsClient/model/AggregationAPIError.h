@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationAPIError_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -79,17 +82,20 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_Reason,
+        FieldBit_Code,
+        FieldBit_ValidResourceNames,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     utility::string_t m_Reason;
-    bool m_ReasonIsSet;
-
     utility::string_t m_Code;
-    bool m_CodeIsSet;
-
     std::vector<utility::string_t> m_ValidResourceNames;
-    bool m_ValidResourceNamesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationItem_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationItem_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -66,8 +69,14 @@ public:
 
 
 protected:
+    enum FieldBit
+    {
+        FieldBit_Groups,
+        FieldBitCount
+    };
+
     std::map<utility::string_t, utility::string_t> m_Groups;
-    bool m_GroupsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
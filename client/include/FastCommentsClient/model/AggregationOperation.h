@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationOperation_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -87,17 +90,20 @@ public:
 
 
 protected:
-    utility::string_t m_Field;
-    bool m_FieldIsSet;
+    enum FieldBit
+    {
+        FieldBit_Field,
+        FieldBit_Op,
+        FieldBit_Alias,
+        FieldBit_ExpandArray,
+        FieldBitCount
+    };
 
+    bool m_ExpandArray;
+    utility::string_t m_Field;
     std::shared_ptr<AggregationOpType> m_Op;
-    bool m_OpIsSet;
-
     utility::string_t m_Alias;
-    bool m_AliasIsSet;
-
-    bool m_ExpandArray;
-    bool m_ExpandArrayIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
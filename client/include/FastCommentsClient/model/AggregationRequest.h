@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationRequest_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationRequest_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -54,7 +54,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -91,20 +94,22 @@ public:
 
 
 protected:
-    std::vector<std::shared_ptr<QueryPredicate>> m_Query;
-    bool m_QueryIsSet;
+    enum FieldBit
+    {
+        FieldBit_Query,
+        FieldBit_ResourceName,
+        FieldBit_GroupBy,
+        FieldBit_Operations,
+        FieldBit_Sort,
+        FieldBitCount
+    };
 
+    std::vector<std::shared_ptr<QueryPredicate>> m_Query;
     utility::string_t m_ResourceName;
-    bool m_ResourceNameIsSet;
-
     std::vector<utility::string_t> m_GroupBy;
-    bool m_GroupByIsSet;
-
     std::vector<std::shared_ptr<AggregationOperation>> m_Operations;
-    bool m_OperationsIsSet;
-
     std::shared_ptr<AggregationRequest_sort> m_Sort;
-    bool m_SortIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
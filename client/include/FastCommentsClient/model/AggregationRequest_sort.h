@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationRequest_sort_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,11 +79,16 @@ public:
 
 
 protected:
-    DirEnum m_Dir;
-    bool m_DirIsSet;
+    enum FieldBit
+    {
+        FieldBit_Dir,
+        FieldBit_Field,
+        FieldBitCount
+    };
 
+    DirEnum m_Dir;
     utility::string_t m_Field;
-    bool m_FieldIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -53,7 +53,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -80,14 +83,18 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_Data,
+        FieldBit_Stats,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     std::vector<std::shared_ptr<AggregationItem>> m_Data;
-    bool m_DataIsSet;
-
     std::shared_ptr<AggregationResponse_stats> m_Stats;
-    bool m_StatsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationResponse_stats_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationResponse_stats_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -43,7 +43,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -65,11 +68,16 @@ public:
 
 
 protected:
-    int64_t m_TimeMS;
-    bool m_TimeMSIsSet;
+    enum FieldBit
+    {
+        FieldBit_TimeMS,
+        FieldBit_Scanned,
+        FieldBitCount
+    };
 
+    int64_t m_TimeMS;
     int64_t m_Scanned;
-    bool m_ScannedIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationValue_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_AggregationValue_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -88,20 +91,22 @@ public:
 
 
 protected:
-    std::map<utility::string_t, utility::string_t> m_Groups;
-    bool m_GroupsIsSet;
+    enum FieldBit
+    {
+        FieldBit_Groups,
+        FieldBit_StringValue,
+        FieldBit_NumericValue,
+        FieldBit_DistinctCount,
+        FieldBit_DistinctCounts,
+        FieldBitCount
+    };
 
+    std::map<utility::string_t, utility::string_t> m_Groups;
     utility::string_t m_StringValue;
-    bool m_StringValueIsSet;
-
     double m_NumericValue;
-    bool m_NumericValueIsSet;
-
     int64_t m_DistinctCount;
-    bool m_DistinctCountIsSet;
-
     std::map<utility::string_t, double> m_DistinctCounts;
-    bool m_DistinctCountsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
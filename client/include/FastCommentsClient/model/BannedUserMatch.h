@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_BannedUserMatch_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -68,10 +71,16 @@ public:
 
 
 protected:
-    std::shared_ptr<BannedUserMatchType> m_MatchedOn;
-    bool m_MatchedOnIsSet;
+    enum FieldBit
+    {
+        FieldBit_MatchedOn,
+        FieldBit_MatchedOnValue,
+        FieldBitCount
+    };
 
-    boost::optional<std::shared_ptr<BannedUserMatch_matchedOnValue>> m_MatchedOnValue;
+    std::shared_ptr<BannedUserMatchType> m_MatchedOn;
+    std::shared_ptr<BannedUserMatch_matchedOnValue> m_MatchedOnValue;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_BillingInfo_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_BillingInfo_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -102,28 +105,28 @@ public:
 
 
 protected:
-    utility::string_t m_Name;
-    bool m_NameIsSet;
+    enum FieldBit
+    {
+        FieldBit_Name,
+        FieldBit_Address,
+        FieldBit_City,
+        FieldBit_State,
+        FieldBit_Zip,
+        FieldBit_Country,
+        FieldBit_Currency,
+        FieldBit_Email,
+        FieldBitCount
+    };
 
+    utility::string_t m_Name;
     utility::string_t m_Address;
-    bool m_AddressIsSet;
-
     utility::string_t m_City;
-    bool m_CityIsSet;
-
     utility::string_t m_State;
-    bool m_StateIsSet;
-
     utility::string_t m_Zip;
-    bool m_ZipIsSet;
-
     utility::string_t m_Country;
-    bool m_CountryIsSet;
-
-    boost::optional<utility::string_t> m_Currency;
-
+    utility::string_t m_Currency;
     utility::string_t m_Email;
-    bool m_EmailIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
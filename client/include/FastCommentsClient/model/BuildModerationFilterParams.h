@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_BuildModerationFilterParams_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_BuildModerationFilterParams_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -99,23 +102,25 @@ public:
     void addAdditionalProperty(const utility::string_t& key, const web::json::value& value);
 
 protected:
-    utility::string_t m_UserId;
-    bool m_UserIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_UserId,
+        FieldBit_TenantId,
+        FieldBit_Filters,
+        FieldBit_SearchFilters,
+        FieldBit_TextSearch,
+        FieldBit_AdditionalProperties,
+        FieldBitCount
+    };
 
+    utility::string_t m_UserId;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_Filters;
-    bool m_FiltersIsSet;
-
     utility::string_t m_SearchFilters;
-    bool m_SearchFiltersIsSet;
-
     utility::string_t m_TextSearch;
-    bool m_TextSearchIsSet;
-
     std::map<utility::string_t, web::json::value> m_AdditionalProperties;
-    bool m_AdditionalPropertiesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
+
 };
 
 
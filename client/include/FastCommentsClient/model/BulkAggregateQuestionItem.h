@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_BulkAggregateQuestionItem_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -89,23 +92,24 @@ public:
 
 
 protected:
-    utility::string_t m_AggId;
-    bool m_AggIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_AggId,
+        FieldBit_QuestionId,
+        FieldBit_QuestionIds,
+        FieldBit_UrlId,
+        FieldBit_TimeBucket,
+        FieldBit_StartDate,
+        FieldBitCount
+    };
 
+    utility::string_t m_AggId;
     utility::string_t m_QuestionId;
-    bool m_QuestionIdIsSet;
-
     std::vector<utility::string_t> m_QuestionIds;
-    bool m_QuestionIdsIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     std::shared_ptr<AggregateTimeBucket> m_TimeBucket;
-    bool m_TimeBucketIsSet;
-
     utility::datetime m_StartDate;
-    bool m_StartDateIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_BulkCreateHashTagsBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_BulkCreateHashTagsBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -69,11 +72,16 @@ public:
 
 
 protected:
-    utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_TenantId,
+        FieldBit_Tags,
+        FieldBitCount
+    };
 
+    utility::string_t m_TenantId;
     std::vector<std::shared_ptr<BulkCreateHashTagsBody_tags_inner>> m_Tags;
-    bool m_TagsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
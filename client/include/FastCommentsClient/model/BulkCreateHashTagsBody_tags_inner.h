@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_BulkCreateHashTagsBody_tags_inner_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_BulkCreateHashTagsBody_tags_inner_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -66,11 +69,16 @@ public:
 
 
 protected:
-    utility::string_t m_Url;
-    bool m_UrlIsSet;
+    enum FieldBit
+    {
+        FieldBit_Url,
+        FieldBit_Tag,
+        FieldBitCount
+    };
 
+    utility::string_t m_Url;
     utility::string_t m_Tag;
-    bool m_TagIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
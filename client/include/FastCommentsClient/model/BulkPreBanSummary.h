@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_BulkPreBanSummary_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_BulkPreBanSummary_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -87,23 +90,24 @@ public:
 
 
 protected:
-    utility::string_t m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_TotalRelatedCommentCount,
+        FieldBit_EmailDomains,
+        FieldBit_Emails,
+        FieldBit_UserIds,
+        FieldBit_IpHashes,
+        FieldBitCount
+    };
 
     int32_t m_TotalRelatedCommentCount;
-    bool m_TotalRelatedCommentCountIsSet;
-
+    utility::string_t m_Status;
     std::vector<utility::string_t> m_EmailDomains;
-    bool m_EmailDomainsIsSet;
-
     std::vector<utility::string_t> m_Emails;
-    bool m_EmailsIsSet;
-
     std::vector<utility::string_t> m_UserIds;
-    bool m_UserIdsIsSet;
-
     std::vector<utility::string_t> m_IpHashes;
-    bool m_IpHashesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
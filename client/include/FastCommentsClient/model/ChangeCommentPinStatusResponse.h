@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ChangeCommentPinStatusResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -73,11 +76,16 @@ public:
 
 
 protected:
-    std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> m_CommentPositions;
-    bool m_CommentPositionsIsSet;
+    enum FieldBit
+    {
+        FieldBit_CommentPositions,
+        FieldBit_Status,
+        FieldBitCount
+    };
 
+    std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> m_CommentPositions;
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CommentData_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CommentData_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -52,7 +52,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -197,78 +200,64 @@ public:
 
 
 protected:
-    int64_t m_date;
-    bool m_dateIsSet;
-
-    utility::string_t m_LocalDateString;
-    bool m_LocalDateStringIsSet;
+    enum FieldBit
+    {
+        FieldBit_date,
+        FieldBit_LocalDateString,
+        FieldBit_LocalDateHours,
+        FieldBit_CommenterName,
+        FieldBit_CommenterEmail,
+        FieldBit_CommenterLink,
+        FieldBit_Comment,
+        FieldBit_ProductId,
+        FieldBit_UserId,
+        FieldBit_AvatarSrc,
+        FieldBit_ParentId,
+        FieldBit_Mentions,
+        FieldBit_HashTags,
+        FieldBit_PageTitle,
+        FieldBit_IsFromMyAccountPage,
+        FieldBit_Url,
+        FieldBit_UrlId,
+        FieldBit_Meta,
+        FieldBit_ModerationGroupIds,
+        FieldBit_Rating,
+        FieldBit_FromOfflineRestore,
+        FieldBit_AutoplayDelayMS,
+        FieldBit_FeedbackIds,
+        FieldBit_QuestionValues,
+        FieldBit_Tos,
+        FieldBit_BotId,
+        FieldBitCount
+    };
 
+    bool m_IsFromMyAccountPage;
+    bool m_FromOfflineRestore;
+    bool m_Tos;
     int32_t m_LocalDateHours;
-    bool m_LocalDateHoursIsSet;
-
+    int32_t m_ProductId;
+    int64_t m_date;
+    utility::string_t m_LocalDateString;
     utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterEmail;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
+    utility::string_t m_CommenterEmail;
+    utility::string_t m_CommenterLink;
     utility::string_t m_Comment;
-    bool m_CommentIsSet;
-
-    int32_t m_ProductId;
-    bool m_ProductIdIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
-    boost::optional<utility::string_t> m_ParentId;
-
+    utility::string_t m_UserId;
+    utility::string_t m_AvatarSrc;
+    utility::string_t m_ParentId;
     std::vector<std::shared_ptr<CommentUserMentionInfo>> m_Mentions;
-    bool m_MentionsIsSet;
-
     std::vector<std::shared_ptr<CommentUserHashTagInfo>> m_HashTags;
-    bool m_HashTagsIsSet;
-
     utility::string_t m_PageTitle;
-    bool m_PageTitleIsSet;
-
-    bool m_IsFromMyAccountPage;
-    bool m_IsFromMyAccountPageIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     std::shared_ptr<Object> m_Meta;
-    bool m_MetaIsSet;
-
     std::vector<utility::string_t> m_ModerationGroupIds;
-    bool m_ModerationGroupIdsIsSet;
-
     double m_Rating;
-    bool m_RatingIsSet;
-
-    bool m_FromOfflineRestore;
-    bool m_FromOfflineRestoreIsSet;
-
     int64_t m_AutoplayDelayMS;
-    bool m_AutoplayDelayMSIsSet;
-
     std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
-
     std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> m_QuestionValues;
-    bool m_QuestionValuesIsSet;
-
-    bool m_Tos;
-    bool m_TosIsSet;
-
     utility::string_t m_BotId;
-    bool m_BotIdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CommentLogData_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -305,136 +308,106 @@ public:
 
 
 protected:
-    bool m_ClearContent;
-    bool m_ClearContentIsSet;
+    enum FieldBit
+    {
+        FieldBit_ClearContent,
+        FieldBit_IsDeletedUser,
+        FieldBit_Phrase,
+        FieldBit_BadWord,
+        FieldBit_Word,
+        FieldBit_Locale,
+        FieldBit_TenantBadgeId,
+        FieldBit_BadgeId,
+        FieldBit_WasLoggedIn,
+        FieldBit_FoundUser,
+        FieldBit_Verified,
+        FieldBit_Engine,
+        FieldBit_EngineResponse,
+        FieldBit_EngineTokens,
+        FieldBit_TrustFactor,
+        FieldBit_Source,
+        FieldBit_Rule,
+        FieldBit_UserId,
+        FieldBit_Subscribers,
+        FieldBit_NotificationCount,
+        FieldBit_VotesBefore,
+        FieldBit_VotesUpBefore,
+        FieldBit_VotesDownBefore,
+        FieldBit_VotesAfter,
+        FieldBit_VotesUpAfter,
+        FieldBit_VotesDownAfter,
+        FieldBit_RepeatAction,
+        FieldBit_Reason,
+        FieldBit_OtherData,
+        FieldBit_SpamBefore,
+        FieldBit_SpamAfter,
+        FieldBit_PermanentFlag,
+        FieldBit_ApprovedBefore,
+        FieldBit_ApprovedAfter,
+        FieldBit_ReviewedBefore,
+        FieldBit_ReviewedAfter,
+        FieldBit_TextBefore,
+        FieldBit_TextAfter,
+        FieldBit_ExpireBefore,
+        FieldBit_ExpireAfter,
+        FieldBit_FlagCountBefore,
+        FieldBit_TrustFactorBefore,
+        FieldBit_TrustFactorAfter,
+        FieldBit_ReferencedCommentId,
+        FieldBit_InvalidLocale,
+        FieldBit_DetectedLocale,
+        FieldBit_DetectedLanguage,
+        FieldBitCount
+    };
 
+    bool m_ClearContent;
     bool m_IsDeletedUser;
-    bool m_IsDeletedUserIsSet;
-
+    bool m_WasLoggedIn;
+    bool m_FoundUser;
+    bool m_Verified;
+    bool m_SpamBefore;
+    bool m_SpamAfter;
+    bool m_ApprovedBefore;
+    bool m_ApprovedAfter;
+    bool m_ReviewedBefore;
+    bool m_ReviewedAfter;
+    PermanentFlagEnum m_PermanentFlag;
     utility::string_t m_Phrase;
-    bool m_PhraseIsSet;
-
     utility::string_t m_BadWord;
-    bool m_BadWordIsSet;
-
     utility::string_t m_Word;
-    bool m_WordIsSet;
-
     utility::string_t m_Locale;
-    bool m_LocaleIsSet;
-
     utility::string_t m_TenantBadgeId;
-    bool m_TenantBadgeIdIsSet;
-
     utility::string_t m_BadgeId;
-    bool m_BadgeIdIsSet;
-
-    bool m_WasLoggedIn;
-    bool m_WasLoggedInIsSet;
-
-    bool m_FoundUser;
-    bool m_FoundUserIsSet;
-
-    bool m_Verified;
-    bool m_VerifiedIsSet;
-
     utility::string_t m_Engine;
-    bool m_EngineIsSet;
-
     utility::string_t m_EngineResponse;
-    bool m_EngineResponseIsSet;
-
     double m_EngineTokens;
-    bool m_EngineTokensIsSet;
-
     double m_TrustFactor;
-    bool m_TrustFactorIsSet;
-
     utility::string_t m_Source;
-    bool m_SourceIsSet;
-
     std::shared_ptr<SpamRule> m_Rule;
-    bool m_RuleIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     double m_Subscribers;
-    bool m_SubscribersIsSet;
-
     double m_NotificationCount;
-    bool m_NotificationCountIsSet;
-
-    boost::optional<double> m_VotesBefore;
-
-    boost::optional<double> m_VotesUpBefore;
-
-    boost::optional<double> m_VotesDownBefore;
-
-    boost::optional<double> m_VotesAfter;
-
-    boost::optional<double> m_VotesUpAfter;
-
-    boost::optional<double> m_VotesDownAfter;
-
+    double m_VotesBefore;
+    double m_VotesUpBefore;
+    double m_VotesDownBefore;
+    double m_VotesAfter;
+    double m_VotesUpAfter;
+    double m_VotesDownAfter;
     std::shared_ptr<RepeatCommentHandlingAction> m_RepeatAction;
-    bool m_RepeatActionIsSet;
-
     std::shared_ptr<RepeatCommentCheckIgnoredReason> m_Reason;
-    bool m_ReasonIsSet;
-
-    boost::optional<std::shared_ptr<AnyType>> m_OtherData;
-
-    bool m_SpamBefore;
-    bool m_SpamBeforeIsSet;
-
-    bool m_SpamAfter;
-    bool m_SpamAfterIsSet;
-
-    PermanentFlagEnum m_PermanentFlag;
-    bool m_PermanentFlagIsSet;
-
-    bool m_ApprovedBefore;
-    bool m_ApprovedBeforeIsSet;
-
-    bool m_ApprovedAfter;
-    bool m_ApprovedAfterIsSet;
-
-    bool m_ReviewedBefore;
-    bool m_ReviewedBeforeIsSet;
-
-    bool m_ReviewedAfter;
-    bool m_ReviewedAfterIsSet;
-
+    std::shared_ptr<AnyType> m_OtherData;
     utility::string_t m_TextBefore;
-    bool m_TextBeforeIsSet;
-
     utility::string_t m_TextAfter;
-    bool m_TextAfterIsSet;
-
-    boost::optional<utility::datetime> m_ExpireBefore;
-
-    boost::optional<utility::datetime> m_ExpireAfter;
-
-    boost::optional<double> m_FlagCountBefore;
-
+    utility::datetime m_ExpireBefore;
+    utility::datetime m_ExpireAfter;
+    double m_FlagCountBefore;
     double m_TrustFactorBefore;
-    bool m_TrustFactorBeforeIsSet;
-
     double m_TrustFactorAfter;
-    bool m_TrustFactorAfterIsSet;
-
     utility::string_t m_ReferencedCommentId;
-    bool m_ReferencedCommentIdIsSet;
-
     utility::string_t m_InvalidLocale;
-    bool m_InvalidLocaleIsSet;
-
     utility::string_t m_DetectedLocale;
-    bool m_DetectedLocaleIsSet;
-
     utility::string_t m_DetectedLanguage;
-    bool m_DetectedLanguageIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
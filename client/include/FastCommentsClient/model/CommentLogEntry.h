@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CommentLogEntry_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -75,14 +78,18 @@ public:
 
 
 protected:
-    utility::datetime m_d;
-    bool m_dIsSet;
+    enum FieldBit
+    {
+        FieldBit_d,
+        FieldBit_t,
+        FieldBit_Da,
+        FieldBitCount
+    };
 
+    utility::datetime m_d;
     std::shared_ptr<CommentLogType> m_t;
-    bool m_tIsSet;
-
     std::shared_ptr<CommentLogData> m_Da;
-    bool m_DaIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
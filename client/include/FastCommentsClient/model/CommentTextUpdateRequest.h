@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CommentTextUpdateRequest_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CommentTextUpdateRequest_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,14 +79,18 @@ public:
 
 
 protected:
-    utility::string_t m_Comment;
-    bool m_CommentIsSet;
+    enum FieldBit
+    {
+        FieldBit_Comment,
+        FieldBit_Mentions,
+        FieldBit_HashTags,
+        FieldBitCount
+    };
 
+    utility::string_t m_Comment;
     std::vector<std::shared_ptr<CommentUserMentionInfo>> m_Mentions;
-    bool m_MentionsIsSet;
-
     std::vector<std::shared_ptr<CommentUserHashTagInfo>> m_HashTags;
-    bool m_HashTagsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CommentUserBadgeInfo_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CommentUserBadgeInfo_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -101,26 +104,30 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Type,
+        FieldBit_Description,
+        FieldBit_DisplayLabel,
+        FieldBit_DisplaySrc,
+        FieldBit_BackgroundColor,
+        FieldBit_BorderColor,
+        FieldBit_TextColor,
+        FieldBit_CssClass,
+        FieldBitCount
+    };
 
     int32_t m_Type;
-    bool m_TypeIsSet;
-
+    utility::string_t m_Id;
     utility::string_t m_Description;
-    bool m_DescriptionIsSet;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
-    boost::optional<utility::string_t> m_DisplaySrc;
-
-    boost::optional<utility::string_t> m_BackgroundColor;
-
-    boost::optional<utility::string_t> m_BorderColor;
-
-    boost::optional<utility::string_t> m_TextColor;
-
-    boost::optional<utility::string_t> m_CssClass;
+    utility::string_t m_DisplayLabel;
+    utility::string_t m_DisplaySrc;
+    utility::string_t m_BackgroundColor;
+    utility::string_t m_BorderColor;
+    utility::string_t m_TextColor;
+    utility::string_t m_CssClass;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
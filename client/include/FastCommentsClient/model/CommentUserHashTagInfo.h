@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CommentUserHashTagInfo_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CommentUserHashTagInfo_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,16 +79,20 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
-
-    utility::string_t m_Tag;
-    bool m_TagIsSet;
-
-    boost::optional<utility::string_t> m_Url;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Tag,
+        FieldBit_Url,
+        FieldBit_Retain,
+        FieldBitCount
+    };
 
     bool m_Retain;
-    bool m_RetainIsSet;
+    utility::string_t m_Id;
+    utility::string_t m_Tag;
+    utility::string_t m_Url;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CommentUserMentionInfo_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -91,20 +94,22 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Tag,
+        FieldBit_RawTag,
+        FieldBit_Type,
+        FieldBit_Sent,
+        FieldBitCount
+    };
 
+    bool m_Sent;
+    TypeEnum m_Type;
+    utility::string_t m_Id;
     utility::string_t m_Tag;
-    bool m_TagIsSet;
-
     utility::string_t m_RawTag;
-    bool m_RawTagIsSet;
-
-    TypeEnum m_Type;
-    bool m_TypeIsSet;
-
-    bool m_Sent;
-    bool m_SentIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
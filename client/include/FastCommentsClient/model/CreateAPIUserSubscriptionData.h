@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CreateAPIUserSubscriptionData_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CreateAPIUserSubscriptionData_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -86,23 +89,24 @@ public:
 
 
 protected:
-    double m_NotificationFrequency;
-    bool m_NotificationFrequencyIsSet;
+    enum FieldBit
+    {
+        FieldBit_NotificationFrequency,
+        FieldBit_PageTitle,
+        FieldBit_Url,
+        FieldBit_UrlId,
+        FieldBit_AnonUserId,
+        FieldBit_UserId,
+        FieldBitCount
+    };
 
+    double m_NotificationFrequency;
     utility::string_t m_PageTitle;
-    bool m_PageTitleIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_AnonUserId;
-    bool m_AnonUserIdIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
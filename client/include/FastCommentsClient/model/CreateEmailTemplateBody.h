@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CreateEmailTemplateBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CreateEmailTemplateBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -94,23 +97,24 @@ public:
 
 
 protected:
-    utility::string_t m_EmailTemplateId;
-    bool m_EmailTemplateIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_EmailTemplateId,
+        FieldBit_DisplayName,
+        FieldBit_Ejs,
+        FieldBit_Domain,
+        FieldBit_TranslationOverridesByLocale,
+        FieldBit_TestData,
+        FieldBitCount
+    };
 
+    utility::string_t m_EmailTemplateId;
     utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
     utility::string_t m_Ejs;
-    bool m_EjsIsSet;
-
     utility::string_t m_Domain;
-    bool m_DomainIsSet;
-
     std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> m_TranslationOverridesByLocale;
-    bool m_TranslationOverridesByLocaleIsSet;
-
     std::map<utility::string_t, std::shared_ptr<AnyType>> m_TestData;
-    bool m_TestDataIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
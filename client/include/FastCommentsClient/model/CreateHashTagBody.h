@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CreateHashTagBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CreateHashTagBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -71,14 +74,18 @@ public:
 
 
 protected:
-    utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_TenantId,
+        FieldBit_Tag,
+        FieldBit_Url,
+        FieldBitCount
+    };
 
+    utility::string_t m_TenantId;
     utility::string_t m_Tag;
-    bool m_TagIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CreateModeratorBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CreateModeratorBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -95,20 +98,23 @@ public:
     void addAdditionalProperty(const utility::string_t& key, const web::json::value& value);
 
 protected:
-    utility::string_t m_Name;
-    bool m_NameIsSet;
+    enum FieldBit
+    {
+        FieldBit_Name,
+        FieldBit_Email,
+        FieldBit_UserId,
+        FieldBit_ModerationGroupIds,
+        FieldBit_AdditionalProperties,
+        FieldBitCount
+    };
 
+    utility::string_t m_Name;
     utility::string_t m_Email;
-    bool m_EmailIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     std::vector<utility::string_t> m_ModerationGroupIds;
-    bool m_ModerationGroupIdsIsSet;
-
     std::map<utility::string_t, web::json::value> m_AdditionalProperties;
-    bool m_AdditionalPropertiesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
+
 };
 
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CreateQuestionConfigBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CreateQuestionConfigBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -147,50 +150,43 @@ public:
     void addAdditionalProperty(const utility::string_t& key, const web::json::value& value);
 
 protected:
-    utility::string_t m_Name;
-    bool m_NameIsSet;
+    enum FieldBit
+    {
+        FieldBit_Name,
+        FieldBit_Question,
+        FieldBit_HelpText,
+        FieldBit_Type,
+        FieldBit_NumStars,
+        FieldBit_Min,
+        FieldBit_Max,
+        FieldBit_DefaultValue,
+        FieldBit_LabelNegative,
+        FieldBit_LabelPositive,
+        FieldBit_CustomOptions,
+        FieldBit_SubQuestionIds,
+        FieldBit_AlwaysShowSubQuestions,
+        FieldBit_ReportingOrder,
+        FieldBit_AdditionalProperties,
+        FieldBitCount
+    };
 
+    bool m_AlwaysShowSubQuestions;
+    utility::string_t m_Name;
     utility::string_t m_Question;
-    bool m_QuestionIsSet;
-
     utility::string_t m_HelpText;
-    bool m_HelpTextIsSet;
-
     utility::string_t m_Type;
-    bool m_TypeIsSet;
-
     double m_NumStars;
-    bool m_NumStarsIsSet;
-
     double m_Min;
-    bool m_MinIsSet;
-
     double m_Max;
-    bool m_MaxIsSet;
-
     double m_DefaultValue;
-    bool m_DefaultValueIsSet;
-
     utility::string_t m_LabelNegative;
-    bool m_LabelNegativeIsSet;
-
     utility::string_t m_LabelPositive;
-    bool m_LabelPositiveIsSet;
-
     std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> m_CustomOptions;
-    bool m_CustomOptionsIsSet;
-
     std::vector<utility::string_t> m_SubQuestionIds;
-    bool m_SubQuestionIdsIsSet;
-
-    bool m_AlwaysShowSubQuestions;
-    bool m_AlwaysShowSubQuestionsIsSet;
-
     double m_ReportingOrder;
-    bool m_ReportingOrderIsSet;
-
     std::map<utility::string_t, web::json::value> m_AdditionalProperties;
-    bool m_AdditionalPropertiesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
+
 };
 
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CreateTicketBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CreateTicketBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -61,8 +64,14 @@ public:
 
 
 protected:
+    enum FieldBit
+    {
+        FieldBit_Subject,
+        FieldBitCount
+    };
+
     utility::string_t m_Subject;
-    bool m_SubjectIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CustomConfigParameters_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -66,7 +66,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -521,251 +524,188 @@ public:
 
 
 protected:
-    bool m_AbsoluteAndRelativeDates;
-    bool m_AbsoluteAndRelativeDatesIsSet;
+    enum FieldBit
+    {
+        FieldBit_AbsoluteAndRelativeDates,
+        FieldBit_AbsoluteDates,
+        FieldBit_AllowAnon,
+        FieldBit_AllowAnonFlag,
+        FieldBit_AllowAnonVotes,
+        FieldBit_AllowedLanguages,
+        FieldBit_CollapseReplies,
+        FieldBit_CommentCountFormat,
+        FieldBit_CommentHTMLRenderingMode,
+        FieldBit_CommentThreadDeleteMode,
+        FieldBit_CommenterNameFormat,
+        FieldBit_CountAboveToggle,
+        FieldBit_CustomCSS,
+        FieldBit_DefaultAvatarSrc,
+        FieldBit_DefaultSortDirection,
+        FieldBit_DefaultUsername,
+        FieldBit_DisableAutoAdminMigration,
+        FieldBit_DisableAutoHashTagCreation,
+        FieldBit_DisableBlocking,
+        FieldBit_DisableCommenterCommentDelete,
+        FieldBit_DisableCommenterCommentEdit,
+        FieldBit_DisableEmailInputs,
+        FieldBit_DisableLiveCommenting,
+        FieldBit_DisableNotificationBell,
+        FieldBit_DisableProfileComments,
+        FieldBit_DisableProfileDirectMessages,
+        FieldBit_DisableProfiles,
+        FieldBit_DisableSuccessMessage,
+        FieldBit_DisableToolbar,
+        FieldBit_DisableUnverifiedLabel,
+        FieldBit_DisableVoting,
+        FieldBit_EnableCommenterLinks,
+        FieldBit_EnableSearch,
+        FieldBit_EnableSpoilers,
+        FieldBit_EnableThirdPartyCookieBypass,
+        FieldBit_EnableViewCounts,
+        FieldBit_EnableVoteList,
+        FieldBit_EnableWYSIWYG,
+        FieldBit_GifRating,
+        FieldBit_HasDarkBackground,
+        FieldBit_HeaderHTML,
+        FieldBit_HideAvatars,
+        FieldBit_HideCommentsUnderCountTextFormat,
+        FieldBit_ImageContentProfanityLevel,
+        FieldBit_InputAfterComments,
+        FieldBit_LimitCommentsByGroups,
+        FieldBit_Locale,
+        FieldBit_MaxCommentCharacterLength,
+        FieldBit_MaxCommentCreatedCountPUPM,
+        FieldBit_NoCustomConfig,
+        FieldBit_MentionAutoCompleteMode,
+        FieldBit_NoImageUploads,
+        FieldBit_AllowEmbeds,
+        FieldBit_AllowedEmbedDomains,
+        FieldBit_NoStyles,
+        FieldBit_PageSize,
+        FieldBit_Readonly,
+        FieldBit_NoNewRootComments,
+        FieldBit_RequireSSO,
+        FieldBit_EnableFChat,
+        FieldBit_EnableResizeHandle,
+        FieldBit_RestrictedLinkDomains,
+        FieldBit_ShowBadgesInTopBar,
+        FieldBit_ShowCommentSaveSuccess,
+        FieldBit_ShowLiveRightAway,
+        FieldBit_ShowQuestion,
+        FieldBit_SpamRules,
+        FieldBit_SsoSecLvl,
+        FieldBit_Translations,
+        FieldBit_UseShowCommentsToggle,
+        FieldBit_UseSingleLineCommentInput,
+        FieldBit_VoteStyle,
+        FieldBit_WidgetQuestionId,
+        FieldBit_WidgetQuestionResultsStyle,
+        FieldBit_WidgetQuestionShowBreakdown,
+        FieldBit_WidgetQuestionStyle,
+        FieldBit_WidgetQuestionWhenToSave,
+        FieldBit_WidgetQuestionsRequired,
+        FieldBit_WidgetSubQuestionVisibility,
+        FieldBit_Wrap,
+        FieldBit_UsersListLocation,
+        FieldBit_UsersListIncludeOffline,
+        FieldBit_TicketBaseUrl,
+        FieldBit_TicketKBSearchEndpoint,
+        FieldBit_TicketFileUploadsEnabled,
+        FieldBit_TicketMaxFileSize,
+        FieldBit_TicketAutoAssignUserIds,
+        FieldBit_Tos,
+        FieldBitCount
+    };
 
+    bool m_AbsoluteAndRelativeDates;
     bool m_AbsoluteDates;
-    bool m_AbsoluteDatesIsSet;
-
     bool m_AllowAnon;
-    bool m_AllowAnonIsSet;
-
     bool m_AllowAnonFlag;
-    bool m_AllowAnonFlagIsSet;
-
     bool m_AllowAnonVotes;
-    bool m_AllowAnonVotesIsSet;
-
-    boost::optional<std::vector<utility::string_t>> m_AllowedLanguages;
-
     bool m_CollapseReplies;
-    bool m_CollapseRepliesIsSet;
-
-    boost::optional<utility::string_t> m_CommentCountFormat;
-
-    std::shared_ptr<CommentHTMLRenderingMode> m_CommentHTMLRenderingMode;
-    bool m_CommentHTMLRenderingModeIsSet;
-
-    boost::optional<std::shared_ptr<CommentThreadDeletionMode>> m_CommentThreadDeleteMode;
-
-    boost::optional<std::shared_ptr<CommenterNameFormats>> m_CommenterNameFormat;
-
-    int32_t m_CountAboveToggle;
-    bool m_CountAboveToggleIsSet;
-
-    boost::optional<utility::string_t> m_CustomCSS;
-
-    boost::optional<utility::string_t> m_DefaultAvatarSrc;
-
-    boost::optional<std::shared_ptr<SortDirections>> m_DefaultSortDirection;
-
-    boost::optional<utility::string_t> m_DefaultUsername;
-
     bool m_DisableAutoAdminMigration;
-    bool m_DisableAutoAdminMigrationIsSet;
-
     bool m_DisableAutoHashTagCreation;
-    bool m_DisableAutoHashTagCreationIsSet;
-
     bool m_DisableBlocking;
-    bool m_DisableBlockingIsSet;
-
     bool m_DisableCommenterCommentDelete;
-    bool m_DisableCommenterCommentDeleteIsSet;
-
     bool m_DisableCommenterCommentEdit;
-    bool m_DisableCommenterCommentEditIsSet;
-
     bool m_DisableEmailInputs;
-    bool m_DisableEmailInputsIsSet;
-
     bool m_DisableLiveCommenting;
-    bool m_DisableLiveCommentingIsSet;
-
     bool m_DisableNotificationBell;
-    bool m_DisableNotificationBellIsSet;
-
     bool m_DisableProfileComments;
-    bool m_DisableProfileCommentsIsSet;
-
     bool m_DisableProfileDirectMessages;
-    bool m_DisableProfileDirectMessagesIsSet;
-
     bool m_DisableProfiles;
-    bool m_DisableProfilesIsSet;
-
     bool m_DisableSuccessMessage;
-    bool m_DisableSuccessMessageIsSet;
-
     bool m_DisableToolbar;
-    bool m_DisableToolbarIsSet;
-
     bool m_DisableUnverifiedLabel;
-    bool m_DisableUnverifiedLabelIsSet;
-
     bool m_DisableVoting;
-    bool m_DisableVotingIsSet;
-
     bool m_EnableCommenterLinks;
-    bool m_EnableCommenterLinksIsSet;
-
     bool m_EnableSearch;
-    bool m_EnableSearchIsSet;
-
     bool m_EnableSpoilers;
-    bool m_EnableSpoilersIsSet;
-
     bool m_EnableThirdPartyCookieBypass;
-    bool m_EnableThirdPartyCookieBypassIsSet;
-
     bool m_EnableViewCounts;
-    bool m_EnableViewCountsIsSet;
-
     bool m_EnableVoteList;
-    bool m_EnableVoteListIsSet;
-
     bool m_EnableWYSIWYG;
-    bool m_EnableWYSIWYGIsSet;
-
-    std::shared_ptr<GifRating> m_GifRating;
-    bool m_GifRatingIsSet;
-
     bool m_HasDarkBackground;
-    bool m_HasDarkBackgroundIsSet;
-
-    boost::optional<utility::string_t> m_HeaderHTML;
-
     bool m_HideAvatars;
-    bool m_HideAvatarsIsSet;
-
-    boost::optional<utility::string_t> m_HideCommentsUnderCountTextFormat;
-
-    std::shared_ptr<ImageContentProfanityLevel> m_ImageContentProfanityLevel;
-    bool m_ImageContentProfanityLevelIsSet;
-
     bool m_InputAfterComments;
-    bool m_InputAfterCommentsIsSet;
-
     bool m_LimitCommentsByGroups;
-    bool m_LimitCommentsByGroupsIsSet;
-
-    boost::optional<utility::string_t> m_Locale;
-
-    boost::optional<int32_t> m_MaxCommentCharacterLength;
-
-    boost::optional<int32_t> m_MaxCommentCreatedCountPUPM;
-
     bool m_NoCustomConfig;
-    bool m_NoCustomConfigIsSet;
-
-    boost::optional<std::shared_ptr<MentionAutoCompleteMode>> m_MentionAutoCompleteMode;
-
     bool m_NoImageUploads;
-    bool m_NoImageUploadsIsSet;
-
     bool m_AllowEmbeds;
-    bool m_AllowEmbedsIsSet;
-
-    boost::optional<std::vector<utility::string_t>> m_AllowedEmbedDomains;
-
     bool m_NoStyles;
-    bool m_NoStylesIsSet;
-
-    boost::optional<int32_t> m_PageSize;
-
     bool m_Readonly;
-    bool m_ReadonlyIsSet;
-
     bool m_NoNewRootComments;
-    bool m_NoNewRootCommentsIsSet;
-
     bool m_RequireSSO;
-    bool m_RequireSSOIsSet;
-
     bool m_EnableFChat;
-    bool m_EnableFChatIsSet;
-
     bool m_EnableResizeHandle;
-    bool m_EnableResizeHandleIsSet;
-
-    boost::optional<std::vector<utility::string_t>> m_RestrictedLinkDomains;
-
     bool m_ShowBadgesInTopBar;
-    bool m_ShowBadgesInTopBarIsSet;
-
     bool m_ShowCommentSaveSuccess;
-    bool m_ShowCommentSaveSuccessIsSet;
-
     bool m_ShowLiveRightAway;
-    bool m_ShowLiveRightAwayIsSet;
-
     bool m_ShowQuestion;
-    bool m_ShowQuestionIsSet;
-
-    std::vector<std::shared_ptr<SpamRule>> m_SpamRules;
-    bool m_SpamRulesIsSet;
-
-    std::shared_ptr<SSOSecurityLevel> m_SsoSecLvl;
-    bool m_SsoSecLvlIsSet;
-
-    boost::optional<std::map<utility::string_t, utility::string_t>> m_Translations;
-
     bool m_UseShowCommentsToggle;
-    bool m_UseShowCommentsToggleIsSet;
-
     bool m_UseSingleLineCommentInput;
-    bool m_UseSingleLineCommentInputIsSet;
-
+    bool m_WidgetQuestionShowBreakdown;
+    bool m_Wrap;
+    bool m_UsersListIncludeOffline;
+    bool m_TicketFileUploadsEnabled;
+    int32_t m_CountAboveToggle;
+    int32_t m_MaxCommentCharacterLength;
+    int32_t m_MaxCommentCreatedCountPUPM;
+    int32_t m_PageSize;
+    int32_t m_TicketMaxFileSize;
+    std::vector<utility::string_t> m_AllowedLanguages;
+    utility::string_t m_CommentCountFormat;
+    std::shared_ptr<CommentHTMLRenderingMode> m_CommentHTMLRenderingMode;
+    std::shared_ptr<CommentThreadDeletionMode> m_CommentThreadDeleteMode;
+    std::shared_ptr<CommenterNameFormats> m_CommenterNameFormat;
+    utility::string_t m_CustomCSS;
+    utility::string_t m_DefaultAvatarSrc;
+    std::shared_ptr<SortDirections> m_DefaultSortDirection;
+    utility::string_t m_DefaultUsername;
+    std::shared_ptr<GifRating> m_GifRating;
+    utility::string_t m_HeaderHTML;
+    utility::string_t m_HideCommentsUnderCountTextFormat;
+    std::shared_ptr<ImageContentProfanityLevel> m_ImageContentProfanityLevel;
+    utility::string_t m_Locale;
+    std::shared_ptr<MentionAutoCompleteMode> m_MentionAutoCompleteMode;
+    std::vector<utility::string_t> m_AllowedEmbedDomains;
+    std::vector<utility::string_t> m_RestrictedLinkDomains;
+    std::vector<std::shared_ptr<SpamRule>> m_SpamRules;
+    std::shared_ptr<SSOSecurityLevel> m_SsoSecLvl;
+    std::map<utility::string_t, utility::string_t> m_Translations;
     std::shared_ptr<VoteStyle> m_VoteStyle;
-    bool m_VoteStyleIsSet;
-
     utility::string_t m_WidgetQuestionId;
-    bool m_WidgetQuestionIdIsSet;
-
     std::shared_ptr<CommentQuestionResultsRenderingType> m_WidgetQuestionResultsStyle;
-    bool m_WidgetQuestionResultsStyleIsSet;
-
-    bool m_WidgetQuestionShowBreakdown;
-    bool m_WidgetQuestionShowBreakdownIsSet;
-
     std::shared_ptr<QuestionRenderingType> m_WidgetQuestionStyle;
-    bool m_WidgetQuestionStyleIsSet;
-
     std::shared_ptr<QuestionWhenSave> m_WidgetQuestionWhenToSave;
-    bool m_WidgetQuestionWhenToSaveIsSet;
-
     std::shared_ptr<CommentQuestionsRequired> m_WidgetQuestionsRequired;
-    bool m_WidgetQuestionsRequiredIsSet;
-
     std::shared_ptr<QuestionSubQuestionVisibility> m_WidgetSubQuestionVisibility;
-    bool m_WidgetSubQuestionVisibilityIsSet;
-
-    bool m_Wrap;
-    bool m_WrapIsSet;
-
     std::shared_ptr<UsersListLocation> m_UsersListLocation;
-    bool m_UsersListLocationIsSet;
-
-    bool m_UsersListIncludeOffline;
-    bool m_UsersListIncludeOfflineIsSet;
-
     utility::string_t m_TicketBaseUrl;
-    bool m_TicketBaseUrlIsSet;
-
     utility::string_t m_TicketKBSearchEndpoint;
-    bool m_TicketKBSearchEndpointIsSet;
-
-    bool m_TicketFileUploadsEnabled;
-    bool m_TicketFileUploadsEnabledIsSet;
-
-    int32_t m_TicketMaxFileSize;
-    bool m_TicketMaxFileSizeIsSet;
-
     std::vector<utility::string_t> m_TicketAutoAssignUserIds;
-    bool m_TicketAutoAssignUserIdsIsSet;
-
     std::shared_ptr<TOSConfig> m_Tos;
-    bool m_TosIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_CustomEmailTemplate_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_CustomEmailTemplate_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -116,34 +119,34 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_EmailTemplateId,
+        FieldBit_DisplayName,
+        FieldBit_CreatedAt,
+        FieldBit_UpdatedAt,
+        FieldBit_UpdatedByUserId,
+        FieldBit_Domain,
+        FieldBit_Ejs,
+        FieldBit_TranslationOverridesByLocale,
+        FieldBit_TestData,
+        FieldBitCount
+    };
 
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_EmailTemplateId;
-    bool m_EmailTemplateIdIsSet;
-
     utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    boost::optional<utility::datetime> m_UpdatedAt;
-
-    boost::optional<utility::string_t> m_UpdatedByUserId;
-
-    boost::optional<utility::string_t> m_Domain;
-
+    utility::datetime m_UpdatedAt;
+    utility::string_t m_UpdatedByUserId;
+    utility::string_t m_Domain;
     utility::string_t m_Ejs;
-    bool m_EjsIsSet;
-
     std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> m_TranslationOverridesByLocale;
-    bool m_TranslationOverridesByLocaleIsSet;
-
-    boost::optional<std::shared_ptr<AnyType>> m_TestData;
+    std::shared_ptr<AnyType> m_TestData;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
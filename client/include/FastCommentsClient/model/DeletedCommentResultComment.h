@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_DeletedCommentResultComment_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_DeletedCommentResultComment_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,16 +79,20 @@ public:
 
 
 protected:
-    bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
+    enum FieldBit
+    {
+        FieldBit_IsDeleted,
+        FieldBit_CommentHTML,
+        FieldBit_CommenterName,
+        FieldBit_UserId,
+        FieldBitCount
+    };
 
+    bool m_IsDeleted;
     utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
     utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
+    utility::string_t m_UserId;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_EmailTemplateDefinition_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_EmailTemplateDefinition_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -84,17 +87,20 @@ public:
 
 
 protected:
-    utility::string_t m_EmailTemplateId;
-    bool m_EmailTemplateIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_EmailTemplateId,
+        FieldBit_DefaultTestData,
+        FieldBit_DefaultTranslationsByLocale,
+        FieldBit_DefaultEJS,
+        FieldBitCount
+    };
 
+    utility::string_t m_EmailTemplateId;
     std::map<utility::string_t, std::shared_ptr<AnyType>> m_DefaultTestData;
-    bool m_DefaultTestDataIsSet;
-
     std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> m_DefaultTranslationsByLocale;
-    bool m_DefaultTranslationsByLocaleIsSet;
-
     utility::string_t m_DefaultEJS;
-    bool m_DefaultEJSIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_EmailTemplateRenderErrorResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_EmailTemplateRenderErrorResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -91,26 +94,26 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_TenantId,
+        FieldBit_CustomTemplateId,
+        FieldBit_Error,
+        FieldBit_Count,
+        FieldBit_CreatedAt,
+        FieldBit_LastOccurredAt,
+        FieldBitCount
+    };
 
+    utility::string_t m_Id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_CustomTemplateId;
-    bool m_CustomTemplateIdIsSet;
-
     utility::string_t m_Error;
-    bool m_ErrorIsSet;
-
     double m_Count;
-    bool m_CountIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::datetime m_LastOccurredAt;
-    bool m_LastOccurredAtIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_EventLogEntry_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_EventLogEntry_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -86,23 +89,24 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_CreatedAt,
+        FieldBit_TenantId,
+        FieldBit_UrlId,
+        FieldBit_BroadcastId,
+        FieldBit_Data,
+        FieldBitCount
+    };
 
+    utility::string_t m__id;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_BroadcastId;
-    bool m_BroadcastIdIsSet;
-
     utility::string_t m_Data;
-    bool m_DataIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
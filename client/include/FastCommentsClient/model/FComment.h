@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_FComment_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FComment_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -54,7 +54,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -431,191 +434,158 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
-    utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
-    utility::string_t m_UrlIdRaw;
-    bool m_UrlIdRawIsSet;
-
-    utility::string_t m_Url;
-    bool m_UrlIsSet;
-
-    boost::optional<utility::string_t> m_PageTitle;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
-    boost::optional<utility::string_t> m_CommenterEmail;
-
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
-    utility::string_t m_Comment;
-    bool m_CommentIsSet;
-
-    utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
-    boost::optional<utility::string_t> m_ParentId;
-
-    boost::optional<utility::datetime> m_date;
-
-    boost::optional<utility::string_t> m_LocalDateString;
-
-    boost::optional<int32_t> m_LocalDateHours;
-
-    boost::optional<int32_t> m_Votes;
-
-    boost::optional<int32_t> m_VotesUp;
-
-    boost::optional<int32_t> m_VotesDown;
-
-    boost::optional<utility::datetime> m_ExpireAt;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UrlId,
+        FieldBit_UrlIdRaw,
+        FieldBit_Url,
+        FieldBit_PageTitle,
+        FieldBit_UserId,
+        FieldBit_AnonUserId,
+        FieldBit_CommenterEmail,
+        FieldBit_CommenterName,
+        FieldBit_CommenterLink,
+        FieldBit_Comment,
+        FieldBit_CommentHTML,
+        FieldBit_ParentId,
+        FieldBit_date,
+        FieldBit_LocalDateString,
+        FieldBit_LocalDateHours,
+        FieldBit_Votes,
+        FieldBit_VotesUp,
+        FieldBit_VotesDown,
+        FieldBit_ExpireAt,
+        FieldBit_Verified,
+        FieldBit_VerifiedDate,
+        FieldBit_VerificationId,
+        FieldBit_NotificationSentForParent,
+        FieldBit_NotificationSentForParentTenant,
+        FieldBit_Reviewed,
+        FieldBit_Imported,
+        FieldBit_ExternalId,
+        FieldBit_ExternalParentId,
+        FieldBit_AvatarSrc,
+        FieldBit_IsSpam,
+        FieldBit_PermNotSpam,
+        FieldBit_AiDeterminedSpam,
+        FieldBit_HasImages,
+        FieldBit_PageNumber,
+        FieldBit_PageNumberOF,
+        FieldBit_PageNumberNF,
+        FieldBit_HasLinks,
+        FieldBit_HasCode,
+        FieldBit_Approved,
+        FieldBit_Locale,
+        FieldBit_IsDeleted,
+        FieldBit_IsDeletedUser,
+        FieldBit_IsBannedUser,
+        FieldBit_IsByAdmin,
+        FieldBit_IsByModerator,
+        FieldBit_IsPinned,
+        FieldBit_IsLocked,
+        FieldBit_FlagCount,
+        FieldBit_Rating,
+        FieldBit_DisplayLabel,
+        FieldBit_FromProductId,
+        FieldBit_Meta,
+        FieldBit_IpHash,
+        FieldBit_Mentions,
+        FieldBit_HashTags,
+        FieldBit_Badges,
+        FieldBit_Domain,
+        FieldBit_VeteranBadgeProcessed,
+        FieldBit_ModerationGroupIds,
+        FieldBit_DidProcessBadges,
+        FieldBit_FromOfflineRestore,
+        FieldBit_AutoplayJobId,
+        FieldBit_AutoplayDelayMS,
+        FieldBit_FeedbackIds,
+        FieldBit_Logs,
+        FieldBit_GroupIds,
+        FieldBit_ViewCount,
+        FieldBit_RequiresVerification,
+        FieldBit_EditKey,
+        FieldBit_TosAcceptedAt,
+        FieldBit_BotId,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    boost::optional<utility::datetime> m_VerifiedDate;
-
-    boost::optional<utility::string_t> m_VerificationId;
-
     bool m_NotificationSentForParent;
-    bool m_NotificationSentForParentIsSet;
-
     bool m_NotificationSentForParentTenant;
-    bool m_NotificationSentForParentTenantIsSet;
-
     bool m_Reviewed;
-    bool m_ReviewedIsSet;
-
     bool m_Imported;
-    bool m_ImportedIsSet;
-
-    utility::string_t m_ExternalId;
-    bool m_ExternalIdIsSet;
-
-    boost::optional<utility::string_t> m_ExternalParentId;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
     bool m_PermNotSpam;
-    bool m_PermNotSpamIsSet;
-
     bool m_AiDeterminedSpam;
-    bool m_AiDeterminedSpamIsSet;
-
     bool m_HasImages;
-    bool m_HasImagesIsSet;
-
-    boost::optional<int32_t> m_PageNumber;
-
-    boost::optional<int32_t> m_PageNumberOF;
-
-    boost::optional<int32_t> m_PageNumberNF;
-
     bool m_HasLinks;
-    bool m_HasLinksIsSet;
-
     bool m_HasCode;
-    bool m_HasCodeIsSet;
-
     bool m_Approved;
-    bool m_ApprovedIsSet;
-
-    boost::optional<utility::string_t> m_Locale;
-
     bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
-
     bool m_IsDeletedUser;
-    bool m_IsDeletedUserIsSet;
-
     bool m_IsBannedUser;
-    bool m_IsBannedUserIsSet;
-
     bool m_IsByAdmin;
-    bool m_IsByAdminIsSet;
-
     bool m_IsByModerator;
-    bool m_IsByModeratorIsSet;
-
-    boost::optional<bool> m_IsPinned;
-
-    boost::optional<bool> m_IsLocked;
-
-    boost::optional<int32_t> m_FlagCount;
-
-    boost::optional<double> m_Rating;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
+    bool m_IsPinned;
+    bool m_IsLocked;
+    bool m_DidProcessBadges;
+    bool m_FromOfflineRestore;
+    bool m_RequiresVerification;
+    int32_t m_LocalDateHours;
+    int32_t m_Votes;
+    int32_t m_VotesUp;
+    int32_t m_VotesDown;
+    int32_t m_PageNumber;
+    int32_t m_PageNumberOF;
+    int32_t m_PageNumberNF;
+    int32_t m_FlagCount;
     int32_t m_FromProductId;
-    bool m_FromProductIdIsSet;
-
-    boost::optional<std::shared_ptr<FComment_meta>> m_Meta;
-
+    utility::string_t m__id;
+    InternedString m_TenantId;
+    InternedString m_UrlId;
+    InternedString m_UrlIdRaw;
+    InternedString m_Url;
+    InternedString m_PageTitle;
+    utility::string_t m_UserId;
+    utility::string_t m_AnonUserId;
+    utility::string_t m_CommenterEmail;
+    InternedString m_CommenterName;
+    utility::string_t m_CommenterLink;
+    utility::string_t m_Comment;
+    utility::string_t m_CommentHTML;
+    utility::string_t m_ParentId;
+    utility::datetime m_date;
+    utility::string_t m_LocalDateString;
+    utility::datetime m_ExpireAt;
+    utility::datetime m_VerifiedDate;
+    utility::string_t m_VerificationId;
+    utility::string_t m_ExternalId;
+    utility::string_t m_ExternalParentId;
+    InternedString m_AvatarSrc;
+    utility::string_t m_Locale;
+    double m_Rating;
+    utility::string_t m_DisplayLabel;
+    std::shared_ptr<FComment_meta> m_Meta;
     utility::string_t m_IpHash;
-    bool m_IpHashIsSet;
-
     std::vector<std::shared_ptr<CommentUserMentionInfo>> m_Mentions;
-    bool m_MentionsIsSet;
-
     std::vector<std::shared_ptr<CommentUserHashTagInfo>> m_HashTags;
-    bool m_HashTagsIsSet;
-
-    boost::optional<std::vector<std::shared_ptr<CommentUserBadgeInfo>>> m_Badges;
-
-    boost::optional<utility::string_t> m_Domain;
-
+    std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
+    utility::string_t m_Domain;
     utility::string_t m_VeteranBadgeProcessed;
-    bool m_VeteranBadgeProcessedIsSet;
-
-    boost::optional<std::vector<utility::string_t>> m_ModerationGroupIds;
-
-    bool m_DidProcessBadges;
-    bool m_DidProcessBadgesIsSet;
-
-    bool m_FromOfflineRestore;
-    bool m_FromOfflineRestoreIsSet;
-
+    std::vector<utility::string_t> m_ModerationGroupIds;
     utility::string_t m_AutoplayJobId;
-    bool m_AutoplayJobIdIsSet;
-
     int64_t m_AutoplayDelayMS;
-    bool m_AutoplayDelayMSIsSet;
-
     std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
-
-    boost::optional<std::vector<std::shared_ptr<CommentLogEntry>>> m_Logs;
-
-    boost::optional<std::vector<utility::string_t>> m_GroupIds;
-
-    boost::optional<int64_t> m_ViewCount;
-
-    bool m_RequiresVerification;
-    bool m_RequiresVerificationIsSet;
-
+    std::vector<std::shared_ptr<CommentLogEntry>> m_Logs;
+    std::vector<utility::string_t> m_GroupIds;
+    int64_t m_ViewCount;
     utility::string_t m_EditKey;
-    bool m_EditKeyIsSet;
-
     utility::datetime m_TosAcceptedAt;
-    bool m_TosAcceptedAtIsSet;
-
     utility::string_t m_BotId;
-    bool m_BotIdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPost_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPost_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -145,50 +148,44 @@ public:
 
 
 protected:
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_Title,
+        FieldBit_FromUserId,
+        FieldBit_FromUserDisplayName,
+        FieldBit_FromUserAvatar,
+        FieldBit_FromIpHash,
+        FieldBit_Tags,
+        FieldBit_Weight,
+        FieldBit_Meta,
+        FieldBit_ContentHTML,
+        FieldBit_Media,
+        FieldBit_Links,
+        FieldBit_CreatedAt,
+        FieldBit_Reacts,
+        FieldBit_CommentCount,
+        FieldBitCount
+    };
+
+    int32_t m_CommentCount;
     utility::string_t m__id;
-    bool m__idIsSet;
-
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_Title;
-    bool m_TitleIsSet;
-
     utility::string_t m_FromUserId;
-    bool m_FromUserIdIsSet;
-
-    boost::optional<utility::string_t> m_FromUserDisplayName;
-
-    boost::optional<utility::string_t> m_FromUserAvatar;
-
+    utility::string_t m_FromUserDisplayName;
+    utility::string_t m_FromUserAvatar;
     utility::string_t m_FromIpHash;
-    bool m_FromIpHashIsSet;
-
     std::vector<utility::string_t> m_Tags;
-    bool m_TagsIsSet;
-
     double m_Weight;
-    bool m_WeightIsSet;
-
     std::map<utility::string_t, utility::string_t> m_Meta;
-    bool m_MetaIsSet;
-
     utility::string_t m_ContentHTML;
-    bool m_ContentHTMLIsSet;
-
     std::vector<std::shared_ptr<FeedPostMediaItem>> m_Media;
-    bool m_MediaIsSet;
-
     std::vector<std::shared_ptr<FeedPostLink>> m_Links;
-    bool m_LinksIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     std::map<utility::string_t, int32_t> m_Reacts;
-    bool m_ReactsIsSet;
-
-    boost::optional<int32_t> m_CommentCount;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPostLink_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPostLink_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,17 +79,20 @@ public:
 
 
 protected:
-    utility::string_t m_Text;
-    bool m_TextIsSet;
+    enum FieldBit
+    {
+        FieldBit_Text,
+        FieldBit_Title,
+        FieldBit_Description,
+        FieldBit_Url,
+        FieldBitCount
+    };
 
+    utility::string_t m_Text;
     utility::string_t m_Title;
-    bool m_TitleIsSet;
-
     utility::string_t m_Description;
-    bool m_DescriptionIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPostMediaItem_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPostMediaItem_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -74,14 +77,18 @@ public:
 
 
 protected:
-    utility::string_t m_Title;
-    bool m_TitleIsSet;
+    enum FieldBit
+    {
+        FieldBit_Title,
+        FieldBit_LinkUrl,
+        FieldBit_Sizes,
+        FieldBitCount
+    };
 
+    utility::string_t m_Title;
     utility::string_t m_LinkUrl;
-    bool m_LinkUrlIsSet;
-
     std::vector<std::shared_ptr<FeedPostMediaItemAsset>> m_Sizes;
-    bool m_SizesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPostMediaItemAsset_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FeedPostMediaItemAsset_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -71,14 +74,18 @@ public:
 
 
 protected:
-    int32_t m_w;
-    bool m_wIsSet;
+    enum FieldBit
+    {
+        FieldBit_w,
+        FieldBit_h,
+        FieldBit_Src,
+        FieldBitCount
+    };
 
+    int32_t m_w;
     int32_t m_h;
-    bool m_hIsSet;
-
     utility::string_t m_Src;
-    bool m_SrcIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
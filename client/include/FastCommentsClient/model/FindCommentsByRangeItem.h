@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_FindCommentsByRangeItem_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FindCommentsByRangeItem_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -69,10 +72,16 @@ public:
 
 
 protected:
-    boost::optional<std::shared_ptr<FComment>> m_Comment;
-
+    enum FieldBit
+    {
+        FieldBit_Comment,
+        FieldBit_Result,
+        FieldBitCount
+    };
+
+    std::shared_ptr<FComment> m_Comment;
     std::shared_ptr<QuestionResult> m_Result;
-    bool m_ResultIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
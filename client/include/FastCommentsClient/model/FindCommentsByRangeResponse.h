@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_FindCommentsByRangeResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FindCommentsByRangeResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -69,11 +72,16 @@ public:
 
 
 protected:
-    std::vector<std::shared_ptr<FindCommentsByRangeItem>> m_Results;
-    bool m_ResultsIsSet;
+    enum FieldBit
+    {
+        FieldBit_Results,
+        FieldBit_CreatedAt,
+        FieldBitCount
+    };
 
+    std::vector<std::shared_ptr<FindCommentsByRangeItem>> m_Results;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_FlagCommentResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -83,20 +86,22 @@ public:
 
 
 protected:
-    int32_t m_StatusCode;
-    bool m_StatusCodeIsSet;
+    enum FieldBit
+    {
+        FieldBit_StatusCode,
+        FieldBit_Status,
+        FieldBit_Code,
+        FieldBit_Reason,
+        FieldBit_WasUnapproved,
+        FieldBitCount
+    };
 
+    bool m_WasUnapproved;
+    int32_t m_StatusCode;
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
-
     utility::string_t m_Code;
-    bool m_CodeIsSet;
-
     utility::string_t m_Reason;
-    bool m_ReasonIsSet;
-
-    bool m_WasUnapproved;
-    bool m_WasUnapprovedIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
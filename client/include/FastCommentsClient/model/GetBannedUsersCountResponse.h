@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_GetBannedUsersCountResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetBannedUsersCountResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -66,11 +69,16 @@ public:
 
 
 protected:
-    double m_TotalCount;
-    bool m_TotalCountIsSet;
+    enum FieldBit
+    {
+        FieldBit_TotalCount,
+        FieldBit_Status,
+        FieldBitCount
+    };
 
+    double m_TotalCount;
     utility::string_t m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
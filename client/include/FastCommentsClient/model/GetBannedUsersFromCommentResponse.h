@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetBannedUsersFromCommentResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -85,14 +88,18 @@ public:
 
 
 protected:
-    std::vector<std::shared_ptr<APIBannedUserWithMultiMatchInfo>> m_BannedUsers;
-    bool m_BannedUsersIsSet;
+    enum FieldBit
+    {
+        FieldBit_BannedUsers,
+        FieldBit_Code,
+        FieldBit_Status,
+        FieldBitCount
+    };
 
     CodeEnum m_Code;
-    bool m_CodeIsSet;
-
+    std::vector<std::shared_ptr<APIBannedUserWithMultiMatchInfo>> m_BannedUsers;
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_GetCommentBanStatusResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetCommentBanStatusResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -71,12 +74,18 @@ public:
 
 
 protected:
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_EmailDomain,
+        FieldBit_CanIPBan,
+        FieldBitCount
+    };
+
+    bool m_CanIPBan;
     utility::string_t m_Status;
-    bool m_StatusIsSet;
-
-    boost::optional<utility::string_t> m_EmailDomain;
-
-    boost::optional<bool> m_CanIPBan;
+    utility::string_t m_EmailDomain;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
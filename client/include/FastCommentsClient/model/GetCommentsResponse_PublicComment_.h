@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_GetCommentsResponse_PublicComment__H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetCommentsResponse_PublicComment__H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -53,7 +53,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -188,75 +191,60 @@ public:
 
 
 protected:
-    int32_t m_StatusCode;
-    bool m_StatusCodeIsSet;
-
-    utility::string_t m_Status;
-    bool m_StatusIsSet;
-
-    utility::string_t m_Code;
-    bool m_CodeIsSet;
-
-    utility::string_t m_Reason;
-    bool m_ReasonIsSet;
-
-    utility::string_t m_TranslatedWarning;
-    bool m_TranslatedWarningIsSet;
-
-    std::vector<std::shared_ptr<PublicComment>> m_Comments;
-    bool m_CommentsIsSet;
-
-    boost::optional<std::shared_ptr<UserSessionInfo>> m_User;
-
-    utility::string_t m_UrlIdClean;
-    bool m_UrlIdCleanIsSet;
-
-    boost::optional<int64_t> m_LastGenDate;
+    enum FieldBit
+    {
+        FieldBit_StatusCode,
+        FieldBit_Status,
+        FieldBit_Code,
+        FieldBit_Reason,
+        FieldBit_TranslatedWarning,
+        FieldBit_Comments,
+        FieldBit_User,
+        FieldBit_UrlIdClean,
+        FieldBit_LastGenDate,
+        FieldBit_IncludesPastPages,
+        FieldBit_IsDemo,
+        FieldBit_CommentCount,
+        FieldBit_IsSiteAdmin,
+        FieldBit_HasBillingIssue,
+        FieldBit_ModuleData,
+        FieldBit_PageNumber,
+        FieldBit_IsWhiteLabeled,
+        FieldBit_IsProd,
+        FieldBit_IsCrawler,
+        FieldBit_NotificationCount,
+        FieldBit_HasMore,
+        FieldBit_IsClosed,
+        FieldBit_PresencePollState,
+        FieldBit_CustomConfig,
+        FieldBitCount
+    };
 
     bool m_IncludesPastPages;
-    bool m_IncludesPastPagesIsSet;
-
     bool m_IsDemo;
-    bool m_IsDemoIsSet;
-
-    int32_t m_CommentCount;
-    bool m_CommentCountIsSet;
-
     bool m_IsSiteAdmin;
-    bool m_IsSiteAdminIsSet;
-
     bool m_HasBillingIssue;
-    bool m_HasBillingIssueIsSet;
-
-    std::map<utility::string_t, std::shared_ptr<AnyType>> m_ModuleData;
-    bool m_ModuleDataIsSet;
-
-    int32_t m_PageNumber;
-    bool m_PageNumberIsSet;
-
     bool m_IsWhiteLabeled;
-    bool m_IsWhiteLabeledIsSet;
-
     bool m_IsProd;
-    bool m_IsProdIsSet;
-
     bool m_IsCrawler;
-    bool m_IsCrawlerIsSet;
-
-    int32_t m_NotificationCount;
-    bool m_NotificationCountIsSet;
-
     bool m_HasMore;
-    bool m_HasMoreIsSet;
-
     bool m_IsClosed;
-    bool m_IsClosedIsSet;
-
+    int32_t m_StatusCode;
+    int32_t m_CommentCount;
+    int32_t m_PageNumber;
+    int32_t m_NotificationCount;
     int32_t m_PresencePollState;
-    bool m_PresencePollStateIsSet;
-
+    utility::string_t m_Status;
+    utility::string_t m_Code;
+    utility::string_t m_Reason;
+    utility::string_t m_TranslatedWarning;
+    std::vector<std::shared_ptr<PublicComment>> m_Comments;
+    std::shared_ptr<UserSessionInfo> m_User;
+    utility::string_t m_UrlIdClean;
+    int64_t m_LastGenDate;
+    std::map<utility::string_t, std::shared_ptr<AnyType>> m_ModuleData;
     std::shared_ptr<CustomConfigParameters> m_CustomConfig;
-    bool m_CustomConfigIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_GetDomainConfigResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetDomainConfigResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -79,15 +82,20 @@ public:
 
 
 protected:
-    boost::optional<std::shared_ptr<Object>> m_Configuration;
-
-    boost::optional<std::shared_ptr<Object>> m_Status;
-
+    enum FieldBit
+    {
+        FieldBit_Configuration,
+        FieldBit_Status,
+        FieldBit_Reason,
+        FieldBit_Code,
+        FieldBitCount
+    };
+
+    std::shared_ptr<Object> m_Configuration;
+    std::shared_ptr<Object> m_Status;
     utility::string_t m_Reason;
-    bool m_ReasonIsSet;
-
     utility::string_t m_Code;
-    bool m_CodeIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
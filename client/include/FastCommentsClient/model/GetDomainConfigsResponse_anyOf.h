@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_GetDomainConfigsResponse_anyOf_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetDomainConfigsResponse_anyOf_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -66,9 +69,16 @@ public:
 
 
 protected:
-    boost::optional<std::shared_ptr<AnyType>> m_Configurations;
-
-    boost::optional<std::shared_ptr<AnyType>> m_Status;
+    enum FieldBit
+    {
+        FieldBit_Configurations,
+        FieldBit_Status,
+        FieldBitCount
+    };
+
+    std::shared_ptr<AnyType> m_Configurations;
+    std::shared_ptr<AnyType> m_Status;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetGifsTrendingResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -77,14 +80,18 @@ public:
 
 
 protected:
-    std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> m_Images;
-    bool m_ImagesIsSet;
+    enum FieldBit
+    {
+        FieldBit_Images,
+        FieldBit_Status,
+        FieldBit_Code,
+        FieldBitCount
+    };
 
+    std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> m_Images;
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
-
     utility::string_t m_Code;
-    bool m_CodeIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetMyNotificationsResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -90,20 +93,22 @@ public:
 
 
 protected:
-    std::map<utility::string_t, utility::string_t> m_Translations;
-    bool m_TranslationsIsSet;
+    enum FieldBit
+    {
+        FieldBit_Translations,
+        FieldBit_IsSubscribed,
+        FieldBit_HasMore,
+        FieldBit_Notifications,
+        FieldBit_Status,
+        FieldBitCount
+    };
 
     bool m_IsSubscribed;
-    bool m_IsSubscribedIsSet;
-
     bool m_HasMore;
-    bool m_HasMoreIsSet;
-
+    std::map<utility::string_t, utility::string_t> m_Translations;
     std::vector<std::shared_ptr<RenderableUserNotification>> m_Notifications;
-    bool m_NotificationsIsSet;
-
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetPublicPagesResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,13 +79,18 @@ public:
 
 
 protected:
-    boost::optional<utility::string_t> m_NextCursor;
-
+    enum FieldBit
+    {
+        FieldBit_NextCursor,
+        FieldBit_Pages,
+        FieldBit_Status,
+        FieldBitCount
+    };
+
+    utility::string_t m_NextCursor;
     std::vector<std::shared_ptr<PublicPage>> m_Pages;
-    bool m_PagesIsSet;
-
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_GetUserInternalProfileResponse_profile_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetUserInternalProfileResponse_profile_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -141,49 +144,46 @@ public:
 
 
 protected:
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::datetime> m_FirstCommentDate;
+    enum FieldBit
+    {
+        FieldBit_CommenterName,
+        FieldBit_FirstCommentDate,
+        FieldBit_IpHash,
+        FieldBit_CountryFlag,
+        FieldBit_CountryCode,
+        FieldBit_WebsiteUrl,
+        FieldBit_Bio,
+        FieldBit_Karma,
+        FieldBit_Locale,
+        FieldBit_Verified,
+        FieldBit_AvatarSrc,
+        FieldBit_DisplayName,
+        FieldBit_Username,
+        FieldBit_CommenterEmail,
+        FieldBit_Email,
+        FieldBit_AnonUserId,
+        FieldBit_UserId,
+        FieldBitCount
+    };
 
+    bool m_Verified;
+    utility::string_t m_CommenterName;
+    utility::datetime m_FirstCommentDate;
     utility::string_t m_IpHash;
-    bool m_IpHashIsSet;
-
     utility::string_t m_CountryFlag;
-    bool m_CountryFlagIsSet;
-
     utility::string_t m_CountryCode;
-    bool m_CountryCodeIsSet;
-
-    boost::optional<utility::string_t> m_WebsiteUrl;
-
+    utility::string_t m_WebsiteUrl;
     utility::string_t m_Bio;
-    bool m_BioIsSet;
-
     double m_Karma;
-    bool m_KarmaIsSet;
-
     utility::string_t m_Locale;
-    bool m_LocaleIsSet;
-
-    bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
+    utility::string_t m_AvatarSrc;
     utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
     utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterEmail;
-
-    boost::optional<utility::string_t> m_Email;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
-    boost::optional<utility::string_t> m_UserId;
+    utility::string_t m_CommenterEmail;
+    utility::string_t m_Email;
+    utility::string_t m_AnonUserId;
+    utility::string_t m_UserId;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetV1PageLikes_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -83,20 +86,22 @@ public:
 
 
 protected:
-    utility::string_t m_UrlIdWS;
-    bool m_UrlIdWSIsSet;
+    enum FieldBit
+    {
+        FieldBit_UrlIdWS,
+        FieldBit_DidLike,
+        FieldBit_CommentCount,
+        FieldBit_LikeCount,
+        FieldBit_Status,
+        FieldBitCount
+    };
 
     bool m_DidLike;
-    bool m_DidLikeIsSet;
-
     int32_t m_CommentCount;
-    bool m_CommentCountIsSet;
-
     int32_t m_LikeCount;
-    bool m_LikeCountIsSet;
-
+    utility::string_t m_UrlIdWS;
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetV2PageReacts_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -78,14 +81,18 @@ public:
 
 
 protected:
-    std::vector<utility::string_t> m_ReactedIds;
-    bool m_ReactedIdsIsSet;
+    enum FieldBit
+    {
+        FieldBit_ReactedIds,
+        FieldBit_Counts,
+        FieldBit_Status,
+        FieldBitCount
+    };
 
+    std::vector<utility::string_t> m_ReactedIds;
     std::map<utility::string_t, double> m_Counts;
-    bool m_CountsIsSet;
-
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
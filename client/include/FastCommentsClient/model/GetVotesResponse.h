@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_GetVotesResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -80,17 +83,20 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_AppliedAuthorizedVotes,
+        FieldBit_AppliedAnonymousVotes,
+        FieldBit_PendingVotes,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     std::vector<std::shared_ptr<PublicVote>> m_AppliedAuthorizedVotes;
-    bool m_AppliedAuthorizedVotesIsSet;
-
     std::vector<std::shared_ptr<PublicVote>> m_AppliedAnonymousVotes;
-    bool m_AppliedAnonymousVotesIsSet;
-
     std::vector<std::shared_ptr<PublicVote>> m_PendingVotes;
-    bool m_PendingVotesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_HeaderAccountNotification_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_HeaderAccountNotification_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -116,30 +119,32 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_Title,
+        FieldBit_Message,
+        FieldBit_MessagesByLocale,
+        FieldBit_Dates,
+        FieldBit_Severity,
+        FieldBit_LinkUrl,
+        FieldBit_LinkText,
+        FieldBit_CreatedAt,
+        FieldBit_Type,
+        FieldBitCount
+    };
 
+    utility::string_t m__id;
     utility::string_t m_Title;
-    bool m_TitleIsSet;
-
     utility::string_t m_Message;
-    bool m_MessageIsSet;
-
-    boost::optional<std::map<utility::string_t, utility::string_t>> m_MessagesByLocale;
-
-    boost::optional<std::map<utility::string_t, utility::string_t>> m_Dates;
-
+    std::map<utility::string_t, utility::string_t> m_MessagesByLocale;
+    std::map<utility::string_t, utility::string_t> m_Dates;
     utility::string_t m_Severity;
-    bool m_SeverityIsSet;
-
-    boost::optional<utility::string_t> m_LinkUrl;
-
-    boost::optional<utility::string_t> m_LinkText;
-
+    utility::string_t m_LinkUrl;
+    utility::string_t m_LinkText;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    boost::optional<utility::string_t> m_Type;
+    utility::string_t m_Type;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_HeaderState_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -52,7 +52,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -94,23 +97,24 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_NotificationType,
+        FieldBit_UserId,
+        FieldBit_UserIdWS,
+        FieldBit_NotificationCounts,
+        FieldBit_AccountNotifications,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     std::shared_ptr<Object> m_NotificationType;
-    bool m_NotificationTypeIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::string_t m_UserIdWS;
-    bool m_UserIdWSIsSet;
-
     std::vector<std::shared_ptr<NotificationAndCount>> m_NotificationCounts;
-    bool m_NotificationCountsIsSet;
-
     std::vector<std::shared_ptr<HeaderAccountNotification>> m_AccountNotifications;
-    bool m_AccountNotificationsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_LiveEvent_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -61,7 +61,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -158,56 +161,46 @@ public:
 
 
 protected:
-    std::shared_ptr<LiveEventType> m_Type;
-    bool m_TypeIsSet;
+    enum FieldBit
+    {
+        FieldBit_Type,
+        FieldBit_Timestamp,
+        FieldBit_Ts,
+        FieldBit_BroadcastId,
+        FieldBit_UserId,
+        FieldBit_Badges,
+        FieldBit_Notification,
+        FieldBit_Vote,
+        FieldBit_Comment,
+        FieldBit_FeedPost,
+        FieldBit_ExtraInfo,
+        FieldBit_Config,
+        FieldBit_IsClosed,
+        FieldBit_Uj,
+        FieldBit_Ul,
+        FieldBit_Sc,
+        FieldBit_Changes,
+        FieldBitCount
+    };
 
+    bool m_IsClosed;
+    int32_t m_Sc;
+    std::shared_ptr<LiveEventType> m_Type;
     int64_t m_Timestamp;
-    bool m_TimestampIsSet;
-
     int64_t m_Ts;
-    bool m_TsIsSet;
-
     utility::string_t m_BroadcastId;
-    bool m_BroadcastIdIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
-    bool m_BadgesIsSet;
-
     std::shared_ptr<UserNotification> m_Notification;
-    bool m_NotificationIsSet;
-
     std::shared_ptr<PubSubVote> m_Vote;
-    bool m_VoteIsSet;
-
     std::shared_ptr<PubSubComment> m_Comment;
-    bool m_CommentIsSet;
-
     std::shared_ptr<FeedPost> m_FeedPost;
-    bool m_FeedPostIsSet;
-
     std::shared_ptr<LiveEvent_extraInfo> m_ExtraInfo;
-    bool m_ExtraInfoIsSet;
-
     std::shared_ptr<Object> m_Config;
-    bool m_ConfigIsSet;
-
-    bool m_IsClosed;
-    bool m_IsClosedIsSet;
-
     std::vector<utility::string_t> m_Uj;
-    bool m_UjIsSet;
-
     std::vector<utility::string_t> m_Ul;
-    bool m_UlIsSet;
-
-    int32_t m_Sc;
-    bool m_ScIsSet;
-
     std::map<utility::string_t, int32_t> m_Changes;
-    bool m_ChangesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
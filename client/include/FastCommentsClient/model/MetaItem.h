@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_MetaItem_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_MetaItem_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -67,11 +70,16 @@ public:
 
 
 protected:
-    utility::string_t m_Name;
-    bool m_NameIsSet;
+    enum FieldBit
+    {
+        FieldBit_Name,
+        FieldBit_Values,
+        FieldBitCount
+    };
 
+    utility::string_t m_Name;
     std::vector<utility::string_t> m_Values;
-    bool m_ValuesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
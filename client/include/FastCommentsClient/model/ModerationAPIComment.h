@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationAPIComment_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationAPIComment_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -269,113 +272,96 @@ public:
 
 
 protected:
-    bool m_IsLocalDeleted;
-    bool m_IsLocalDeletedIsSet;
-
-    double m_ReplyCount;
-    bool m_ReplyCountIsSet;
-
-    std::vector<utility::string_t> m_FeedbackResults;
-    bool m_FeedbackResultsIsSet;
+    enum FieldBit
+    {
+        FieldBit_IsLocalDeleted,
+        FieldBit_ReplyCount,
+        FieldBit_FeedbackResults,
+        FieldBit_IsVotedUp,
+        FieldBit_IsVotedDown,
+        FieldBit_MyVoteId,
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UrlId,
+        FieldBit_Url,
+        FieldBit_PageTitle,
+        FieldBit_UserId,
+        FieldBit_AnonUserId,
+        FieldBit_CommenterName,
+        FieldBit_CommenterLink,
+        FieldBit_CommentHTML,
+        FieldBit_ParentId,
+        FieldBit_date,
+        FieldBit_LocalDateString,
+        FieldBit_Votes,
+        FieldBit_VotesUp,
+        FieldBit_VotesDown,
+        FieldBit_ExpireAt,
+        FieldBit_Reviewed,
+        FieldBit_AvatarSrc,
+        FieldBit_IsSpam,
+        FieldBit_PermNotSpam,
+        FieldBit_HasLinks,
+        FieldBit_HasCode,
+        FieldBit_Approved,
+        FieldBit_Locale,
+        FieldBit_IsBannedUser,
+        FieldBit_IsByAdmin,
+        FieldBit_IsByModerator,
+        FieldBit_IsPinned,
+        FieldBit_IsLocked,
+        FieldBit_FlagCount,
+        FieldBit_DisplayLabel,
+        FieldBit_Badges,
+        FieldBit_Verified,
+        FieldBit_FeedbackIds,
+        FieldBit_IsDeleted,
+        FieldBitCount
+    };
 
+    bool m_IsLocalDeleted;
     bool m_IsVotedUp;
-    bool m_IsVotedUpIsSet;
-
     bool m_IsVotedDown;
-    bool m_IsVotedDownIsSet;
-
-    utility::string_t m_MyVoteId;
-    bool m_MyVoteIdIsSet;
-
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
-    utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
-    utility::string_t m_Url;
-    bool m_UrlIsSet;
-
-    boost::optional<utility::string_t> m_PageTitle;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
-    utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
-    boost::optional<utility::string_t> m_ParentId;
-
-    boost::optional<utility::datetime> m_date;
-
-    boost::optional<utility::string_t> m_LocalDateString;
-
-    boost::optional<double> m_Votes;
-
-    boost::optional<double> m_VotesUp;
-
-    boost::optional<double> m_VotesDown;
-
-    boost::optional<utility::datetime> m_ExpireAt;
-
     bool m_Reviewed;
-    bool m_ReviewedIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
     bool m_PermNotSpam;
-    bool m_PermNotSpamIsSet;
-
     bool m_HasLinks;
-    bool m_HasLinksIsSet;
-
     bool m_HasCode;
-    bool m_HasCodeIsSet;
-
     bool m_Approved;
-    bool m_ApprovedIsSet;
-
-    boost::optional<utility::string_t> m_Locale;
-
     bool m_IsBannedUser;
-    bool m_IsBannedUserIsSet;
-
     bool m_IsByAdmin;
-    bool m_IsByAdminIsSet;
-
     bool m_IsByModerator;
-    bool m_IsByModeratorIsSet;
-
-    boost::optional<bool> m_IsPinned;
-
-    boost::optional<bool> m_IsLocked;
-
-    boost::optional<double> m_FlagCount;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
-    boost::optional<std::vector<std::shared_ptr<CommentUserBadgeInfo>>> m_Badges;
-
+    bool m_IsPinned;
+    bool m_IsLocked;
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
-
     bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
+    double m_ReplyCount;
+    std::vector<utility::string_t> m_FeedbackResults;
+    utility::string_t m_MyVoteId;
+    utility::string_t m__id;
+    InternedString m_TenantId;
+    InternedString m_UrlId;
+    InternedString m_Url;
+    InternedString m_PageTitle;
+    utility::string_t m_UserId;
+    utility::string_t m_AnonUserId;
+    InternedString m_CommenterName;
+    utility::string_t m_CommenterLink;
+    utility::string_t m_CommentHTML;
+    utility::string_t m_ParentId;
+    utility::datetime m_date;
+    utility::string_t m_LocalDateString;
+    double m_Votes;
+    double m_VotesUp;
+    double m_VotesDown;
+    utility::datetime m_ExpireAt;
+    InternedString m_AvatarSrc;
+    utility::string_t m_Locale;
+    double m_FlagCount;
+    utility::string_t m_DisplayLabel;
+    std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
+    std::vector<utility::string_t> m_FeedbackIds;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
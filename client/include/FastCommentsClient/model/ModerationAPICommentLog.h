@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationAPICommentLog_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationAPICommentLog_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,17 +79,20 @@ public:
 
 
 protected:
-    utility::datetime m_date;
-    bool m_dateIsSet;
+    enum FieldBit
+    {
+        FieldBit_date,
+        FieldBit_Username,
+        FieldBit_ActionName,
+        FieldBit_MessageHTML,
+        FieldBitCount
+    };
 
+    utility::datetime m_date;
     utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
     utility::string_t m_ActionName;
-    bool m_ActionNameIsSet;
-
     utility::string_t m_MessageHTML;
-    bool m_MessageHTMLIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
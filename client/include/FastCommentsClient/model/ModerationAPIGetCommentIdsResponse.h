@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationAPIGetCommentIdsResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -74,14 +77,18 @@ public:
 
 
 protected:
-    std::vector<utility::string_t> m_Ids;
-    bool m_IdsIsSet;
+    enum FieldBit
+    {
+        FieldBit_Ids,
+        FieldBit_HasMore,
+        FieldBit_Status,
+        FieldBitCount
+    };
 
     bool m_HasMore;
-    bool m_HasMoreIsSet;
-
+    std::vector<utility::string_t> m_Ids;
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationAPIGetCommentsResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -51,7 +51,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -83,17 +86,20 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_Translations,
+        FieldBit_Comments,
+        FieldBit_ModerationFilter,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     std::shared_ptr<Object> m_Translations;
-    bool m_TranslationsIsSet;
-
     std::vector<std::shared_ptr<ModerationAPIComment>> m_Comments;
-    bool m_CommentsIsSet;
-
     std::shared_ptr<ModerationFilter> m_ModerationFilter;
-    bool m_ModerationFilterIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
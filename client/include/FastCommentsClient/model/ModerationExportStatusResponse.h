@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationExportStatusResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationExportStatusResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,17 +79,20 @@ public:
 
 
 protected:
-    utility::string_t m_Status;
-    bool m_StatusIsSet;
-
-    utility::string_t m_JobStatus;
-    bool m_JobStatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_JobStatus,
+        FieldBit_RecordCount,
+        FieldBit_DownloadUrl,
+        FieldBitCount
+    };
 
     int32_t m_RecordCount;
-    bool m_RecordCountIsSet;
-
+    utility::string_t m_Status;
+    utility::string_t m_JobStatus;
     utility::string_t m_DownloadUrl;
-    bool m_DownloadUrlIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
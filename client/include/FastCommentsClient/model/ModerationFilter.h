@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationFilter_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationFilter_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -123,41 +126,36 @@ public:
 
 
 protected:
-    bool m_Reviewed;
-    bool m_ReviewedIsSet;
+    enum FieldBit
+    {
+        FieldBit_Reviewed,
+        FieldBit_Approved,
+        FieldBit_IsSpam,
+        FieldBit_IsBannedUser,
+        FieldBit_IsLocked,
+        FieldBit_FlagCountGt,
+        FieldBit_UserId,
+        FieldBit_UrlId,
+        FieldBit_Domain,
+        FieldBit_ModerationGroupIds,
+        FieldBit_CommentTextSearch,
+        FieldBit_ExactCommentText,
+        FieldBitCount
+    };
 
+    bool m_Reviewed;
     bool m_Approved;
-    bool m_ApprovedIsSet;
-
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
     bool m_IsBannedUser;
-    bool m_IsBannedUserIsSet;
-
     bool m_IsLocked;
-    bool m_IsLockedIsSet;
-
     double m_FlagCountGt;
-    bool m_FlagCountGtIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_Domain;
-    bool m_DomainIsSet;
-
     std::vector<utility::string_t> m_ModerationGroupIds;
-    bool m_ModerationGroupIdsIsSet;
-
     std::vector<utility::string_t> m_CommentTextSearch;
-    bool m_CommentTextSearchIsSet;
-
     utility::string_t m_ExactCommentText;
-    bool m_ExactCommentTextIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
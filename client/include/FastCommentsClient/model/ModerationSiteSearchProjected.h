@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationSiteSearchProjected_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationSiteSearchProjected_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -66,10 +69,16 @@ public:
 
 
 protected:
-    utility::string_t m_Domain;
-    bool m_DomainIsSet;
+    enum FieldBit
+    {
+        FieldBit_Domain,
+        FieldBit_LogoSrc100px,
+        FieldBitCount
+    };
 
-    boost::optional<utility::string_t> m_LogoSrc100px;
+    utility::string_t m_Domain;
+    utility::string_t m_LogoSrc100px;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
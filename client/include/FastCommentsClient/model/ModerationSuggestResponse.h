@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationSuggestResponse_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationSuggestResponse_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -81,17 +84,20 @@ public:
 
 
 protected:
-    utility::string_t m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_Pages,
+        FieldBit_Users,
+        FieldBit_Code,
+        FieldBitCount
+    };
 
+    utility::string_t m_Status;
     std::vector<std::shared_ptr<ModerationPageSearchProjected>> m_Pages;
-    bool m_PagesIsSet;
-
     std::vector<std::shared_ptr<ModerationUserSearchProjected>> m_Users;
-    bool m_UsersIsSet;
-
     utility::string_t m_Code;
-    bool m_CodeIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationUserSearchProjected_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ModerationUserSearchProjected_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,15 +79,20 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_Username,
+        FieldBit_DisplayName,
+        FieldBit_AvatarSrc,
+        FieldBitCount
+    };
 
+    utility::string_t m__id;
     utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
-    boost::optional<utility::string_t> m_DisplayName;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
+    utility::string_t m_DisplayName;
+    utility::string_t m_AvatarSrc;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_Moderator_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_Moderator_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -152,57 +155,50 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
-    boost::optional<utility::string_t> m_Name;
-
-    boost::optional<utility::string_t> m_UserId;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_Name,
+        FieldBit_UserId,
+        FieldBit_AcceptedInvite,
+        FieldBit_Email,
+        FieldBit_MarkReviewedCount,
+        FieldBit_DeletedCount,
+        FieldBit_MarkedSpamCount,
+        FieldBit_MarkedNotSpamCount,
+        FieldBit_ApprovedCount,
+        FieldBit_UnApprovedCount,
+        FieldBit_EditedCount,
+        FieldBit_BannedCount,
+        FieldBit_UnFlaggedCount,
+        FieldBit_VerificationId,
+        FieldBit_CreatedAt,
+        FieldBit_ModerationGroupIds,
+        FieldBit_IsEmailSuppressed,
+        FieldBitCount
+    };
 
     bool m_AcceptedInvite;
-    bool m_AcceptedInviteIsSet;
-
-    boost::optional<utility::string_t> m_Email;
-
+    bool m_IsEmailSuppressed;
+    utility::string_t m__id;
+    utility::string_t m_TenantId;
+    utility::string_t m_Name;
+    utility::string_t m_UserId;
+    utility::string_t m_Email;
     double m_MarkReviewedCount;
-    bool m_MarkReviewedCountIsSet;
-
     double m_DeletedCount;
-    bool m_DeletedCountIsSet;
-
     double m_MarkedSpamCount;
-    bool m_MarkedSpamCountIsSet;
-
     double m_MarkedNotSpamCount;
-    bool m_MarkedNotSpamCountIsSet;
-
     double m_ApprovedCount;
-    bool m_ApprovedCountIsSet;
-
     double m_UnApprovedCount;
-    bool m_UnApprovedCountIsSet;
-
     double m_EditedCount;
-    bool m_EditedCountIsSet;
-
     double m_BannedCount;
-    bool m_BannedCountIsSet;
-
     double m_UnFlaggedCount;
-    bool m_UnFlaggedCountIsSet;
-
-    boost::optional<utility::string_t> m_VerificationId;
-
+    utility::string_t m_VerificationId;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    boost::optional<std::vector<utility::string_t>> m_ModerationGroupIds;
-
-    bool m_IsEmailSuppressed;
-    bool m_IsEmailSuppressedIsSet;
+    std::vector<utility::string_t> m_ModerationGroupIds;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PageUserEntry_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PageUserEntry_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -76,17 +79,20 @@ public:
 
 
 protected:
-    bool m_IsPrivate;
-    bool m_IsPrivateIsSet;
+    enum FieldBit
+    {
+        FieldBit_IsPrivate,
+        FieldBit_AvatarSrc,
+        FieldBit_DisplayName,
+        FieldBit_Id,
+        FieldBitCount
+    };
 
+    bool m_IsPrivate;
     utility::string_t m_AvatarSrc;
-    bool m_AvatarSrcIsSet;
-
     utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
     utility::string_t m_Id;
-    bool m_IdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
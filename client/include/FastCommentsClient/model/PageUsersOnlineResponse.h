@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PageUsersOnlineResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -49,7 +49,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -91,21 +94,24 @@ public:
 
 
 protected:
-    boost::optional<utility::string_t> m_NextAfterUserId;
-
-    boost::optional<utility::string_t> m_NextAfterName;
-
+    enum FieldBit
+    {
+        FieldBit_NextAfterUserId,
+        FieldBit_NextAfterName,
+        FieldBit_TotalCount,
+        FieldBit_AnonCount,
+        FieldBit_Users,
+        FieldBit_Status,
+        FieldBitCount
+    };
+
+    utility::string_t m_NextAfterUserId;
+    utility::string_t m_NextAfterName;
     double m_TotalCount;
-    bool m_TotalCountIsSet;
-
     double m_AnonCount;
-    bool m_AnonCountIsSet;
-
     std::vector<std::shared_ptr<PageUserEntry>> m_Users;
-    bool m_UsersIsSet;
-
     std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
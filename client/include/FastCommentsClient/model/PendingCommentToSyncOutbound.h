@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PendingCommentToSyncOutbound_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PendingCommentToSyncOutbound_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -124,43 +127,38 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_CommentId,
+        FieldBit_Comment,
+        FieldBit_ExternalId,
+        FieldBit_CreatedAt,
+        FieldBit_TenantId,
+        FieldBit_AttemptCount,
+        FieldBit_NextAttemptAt,
+        FieldBit_EventType,
+        FieldBit_Type,
+        FieldBit_Domain,
+        FieldBit_LastError,
+        FieldBit_WebhookId,
+        FieldBitCount
+    };
 
+    utility::string_t m__id;
     utility::string_t m_CommentId;
-    bool m_CommentIdIsSet;
-
     std::shared_ptr<FComment> m_Comment;
-    bool m_CommentIsSet;
-
-    boost::optional<utility::string_t> m_ExternalId;
-
+    utility::string_t m_ExternalId;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     double m_AttemptCount;
-    bool m_AttemptCountIsSet;
-
     utility::datetime m_NextAttemptAt;
-    bool m_NextAttemptAtIsSet;
-
     double m_EventType;
-    bool m_EventTypeIsSet;
-
     double m_Type;
-    bool m_TypeIsSet;
-
     utility::string_t m_Domain;
-    bool m_DomainIsSet;
-
     std::shared_ptr<Object> m_LastError;
-    bool m_LastErrorIsSet;
-
     utility::string_t m_WebhookId;
-    bool m_WebhookIdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
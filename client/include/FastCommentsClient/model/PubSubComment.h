@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PubSubComment_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PubSubComment_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -274,114 +277,98 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
-    utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
-    utility::string_t m_Comment;
-    bool m_CommentIsSet;
-
-    boost::optional<utility::string_t> m_ParentId;
-
-    boost::optional<int32_t> m_Votes;
-
-    boost::optional<int32_t> m_VotesUp;
-
-    boost::optional<int32_t> m_VotesDown;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UserId,
+        FieldBit_UrlId,
+        FieldBit_CommenterName,
+        FieldBit_CommenterLink,
+        FieldBit_CommentHTML,
+        FieldBit_Comment,
+        FieldBit_ParentId,
+        FieldBit_Votes,
+        FieldBit_VotesUp,
+        FieldBit_VotesDown,
+        FieldBit_Verified,
+        FieldBit_AvatarSrc,
+        FieldBit_HasImages,
+        FieldBit_HasLinks,
+        FieldBit_IsByAdmin,
+        FieldBit_IsByModerator,
+        FieldBit_IsPinned,
+        FieldBit_IsLocked,
+        FieldBit_DisplayLabel,
+        FieldBit_Rating,
+        FieldBit_Badges,
+        FieldBit_ViewCount,
+        FieldBit_IsDeleted,
+        FieldBit_IsDeletedUser,
+        FieldBit_IsSpam,
+        FieldBit_AnonUserId,
+        FieldBit_FeedbackIds,
+        FieldBit_FlagCount,
+        FieldBit_Domain,
+        FieldBit_Url,
+        FieldBit_PageTitle,
+        FieldBit_ExpireAt,
+        FieldBit_Reviewed,
+        FieldBit_HasCode,
+        FieldBit_Approved,
+        FieldBit_Locale,
+        FieldBit_IsBannedUser,
+        FieldBit_GroupIds,
+        FieldBit_IsLive,
+        FieldBit_Hidden,
+        FieldBit_date,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
     bool m_HasImages;
-    bool m_HasImagesIsSet;
-
     bool m_HasLinks;
-    bool m_HasLinksIsSet;
-
     bool m_IsByAdmin;
-    bool m_IsByAdminIsSet;
-
     bool m_IsByModerator;
-    bool m_IsByModeratorIsSet;
-
-    boost::optional<bool> m_IsPinned;
-
-    boost::optional<bool> m_IsLocked;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
-    boost::optional<double> m_Rating;
-
-    boost::optional<std::vector<std::shared_ptr<CommentUserBadgeInfo>>> m_Badges;
-
-    boost::optional<int64_t> m_ViewCount;
-
+    bool m_IsPinned;
+    bool m_IsLocked;
     bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
-
     bool m_IsDeletedUser;
-    bool m_IsDeletedUserIsSet;
-
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
-    std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
-
-    boost::optional<int32_t> m_FlagCount;
-
-    boost::optional<utility::string_t> m_Domain;
-
-    utility::string_t m_Url;
-    bool m_UrlIsSet;
-
-    boost::optional<utility::string_t> m_PageTitle;
-
-    boost::optional<utility::datetime> m_ExpireAt;
-
     bool m_Reviewed;
-    bool m_ReviewedIsSet;
-
     bool m_HasCode;
-    bool m_HasCodeIsSet;
-
     bool m_Approved;
-    bool m_ApprovedIsSet;
-
-    boost::optional<utility::string_t> m_Locale;
-
     bool m_IsBannedUser;
-    bool m_IsBannedUserIsSet;
-
-    boost::optional<std::vector<utility::string_t>> m_GroupIds;
-
     bool m_IsLive;
-    bool m_IsLiveIsSet;
-
     bool m_Hidden;
-    bool m_HiddenIsSet;
-
+    int32_t m_Votes;
+    int32_t m_VotesUp;
+    int32_t m_VotesDown;
+    int32_t m_FlagCount;
+    utility::string_t m__id;
+    InternedString m_TenantId;
+    utility::string_t m_UserId;
+    InternedString m_UrlId;
+    InternedString m_CommenterName;
+    utility::string_t m_CommenterLink;
+    utility::string_t m_CommentHTML;
+    utility::string_t m_Comment;
+    utility::string_t m_ParentId;
+    InternedString m_AvatarSrc;
+    utility::string_t m_DisplayLabel;
+    double m_Rating;
+    std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
+    int64_t m_ViewCount;
+    utility::string_t m_AnonUserId;
+    std::vector<utility::string_t> m_FeedbackIds;
+    utility::string_t m_Domain;
+    InternedString m_Url;
+    InternedString m_PageTitle;
+    utility::datetime m_ExpireAt;
+    utility::string_t m_Locale;
+    std::vector<utility::string_t> m_GroupIds;
     utility::string_t m_date;
-    bool m_dateIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
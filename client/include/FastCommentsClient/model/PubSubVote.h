@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PubSubVote_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PubSubVote_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -101,30 +104,30 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UrlId,
+        FieldBit_UrlIdRaw,
+        FieldBit_CommentId,
+        FieldBit_UserId,
+        FieldBit_Direction,
+        FieldBit_CreatedAt,
+        FieldBit_VerificationId,
+        FieldBitCount
+    };
 
+    int32_t m_Direction;
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_UrlIdRaw;
-    bool m_UrlIdRawIsSet;
-
     utility::string_t m_CommentId;
-    bool m_CommentIdIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    int32_t m_Direction;
-    bool m_DirectionIsSet;
-
+    utility::string_t m_UserId;
     int64_t m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    boost::optional<utility::string_t> m_VerificationId;
+    utility::string_t m_VerificationId;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
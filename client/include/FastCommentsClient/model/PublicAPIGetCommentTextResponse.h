@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PublicAPIGetCommentTextResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -73,14 +76,18 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_CommentText,
+        FieldBit_SanitizedCommentText,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     utility::string_t m_CommentText;
-    bool m_CommentTextIsSet;
-
     utility::string_t m_SanitizedCommentText;
-    bool m_SanitizedCommentTextIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
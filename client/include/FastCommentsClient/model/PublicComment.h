@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PublicComment_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PublicComment_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -264,107 +267,90 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
-    utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
-    boost::optional<utility::string_t> m_ParentId;
-
-    boost::optional<utility::datetime> m_date;
-
-    boost::optional<int32_t> m_Votes;
-
-    boost::optional<int32_t> m_VotesUp;
-
-    boost::optional<int32_t> m_VotesDown;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_UserId,
+        FieldBit_CommenterName,
+        FieldBit_CommenterLink,
+        FieldBit_CommentHTML,
+        FieldBit_ParentId,
+        FieldBit_date,
+        FieldBit_Votes,
+        FieldBit_VotesUp,
+        FieldBit_VotesDown,
+        FieldBit_Verified,
+        FieldBit_AvatarSrc,
+        FieldBit_HasImages,
+        FieldBit_IsByAdmin,
+        FieldBit_IsByModerator,
+        FieldBit_IsPinned,
+        FieldBit_IsLocked,
+        FieldBit_DisplayLabel,
+        FieldBit_Rating,
+        FieldBit_Badges,
+        FieldBit_ViewCount,
+        FieldBit_IsDeleted,
+        FieldBit_IsDeletedUser,
+        FieldBit_IsSpam,
+        FieldBit_AnonUserId,
+        FieldBit_FeedbackIds,
+        FieldBit_RequiresVerification,
+        FieldBit_EditKey,
+        FieldBit_Approved,
+        FieldBit_IsUnread,
+        FieldBit_MyVoteId,
+        FieldBit_IsVotedDown,
+        FieldBit_IsVotedUp,
+        FieldBit_HasChildren,
+        FieldBit_NestedChildrenCount,
+        FieldBit_ChildCount,
+        FieldBit_Children,
+        FieldBit_IsFlagged,
+        FieldBit_IsBlocked,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
     bool m_HasImages;
-    bool m_HasImagesIsSet;
-
     bool m_IsByAdmin;
-    bool m_IsByAdminIsSet;
-
     bool m_IsByModerator;
-    bool m_IsByModeratorIsSet;
-
-    boost::optional<bool> m_IsPinned;
-
-    boost::optional<bool> m_IsLocked;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
-    boost::optional<double> m_Rating;
-
-    boost::optional<std::vector<std::shared_ptr<CommentUserBadgeInfo>>> m_Badges;
-
-    boost::optional<int64_t> m_ViewCount;
-
+    bool m_IsPinned;
+    bool m_IsLocked;
     bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
-
     bool m_IsDeletedUser;
-    bool m_IsDeletedUserIsSet;
-
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
-    std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
-
     bool m_RequiresVerification;
-    bool m_RequiresVerificationIsSet;
-
-    utility::string_t m_EditKey;
-    bool m_EditKeyIsSet;
-
     bool m_Approved;
-    bool m_ApprovedIsSet;
-
     bool m_IsUnread;
-    bool m_IsUnreadIsSet;
-
-    utility::string_t m_MyVoteId;
-    bool m_MyVoteIdIsSet;
-
     bool m_IsVotedDown;
-    bool m_IsVotedDownIsSet;
-
     bool m_IsVotedUp;
-    bool m_IsVotedUpIsSet;
-
     bool m_HasChildren;
-    bool m_HasChildrenIsSet;
-
+    bool m_IsFlagged;
+    bool m_IsBlocked;
+    int32_t m_Votes;
+    int32_t m_VotesUp;
+    int32_t m_VotesDown;
     int32_t m_NestedChildrenCount;
-    bool m_NestedChildrenCountIsSet;
-
     int32_t m_ChildCount;
-    bool m_ChildCountIsSet;
-
+    utility::string_t m__id;
+    utility::string_t m_UserId;
+    InternedString m_CommenterName;
+    utility::string_t m_CommenterLink;
+    utility::string_t m_CommentHTML;
+    utility::string_t m_ParentId;
+    utility::datetime m_date;
+    InternedString m_AvatarSrc;
+    utility::string_t m_DisplayLabel;
+    double m_Rating;
+    std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
+    int64_t m_ViewCount;
+    utility::string_t m_AnonUserId;
+    std::vector<utility::string_t> m_FeedbackIds;
+    utility::string_t m_EditKey;
+    utility::string_t m_MyVoteId;
     std::vector<std::shared_ptr<PublicComment>> m_Children;
-    bool m_ChildrenIsSet;
-
-    bool m_IsFlagged;
-    bool m_IsFlaggedIsSet;
-
-    bool m_IsBlocked;
-    bool m_IsBlockedIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
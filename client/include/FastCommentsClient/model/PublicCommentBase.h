@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PublicCommentBase_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PublicCommentBase_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -204,77 +207,70 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
-    utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
-    boost::optional<utility::string_t> m_ParentId;
-
-    boost::optional<utility::datetime> m_date;
-
-    boost::optional<int32_t> m_Votes;
-
-    boost::optional<int32_t> m_VotesUp;
-
-    boost::optional<int32_t> m_VotesDown;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_UserId,
+        FieldBit_CommenterName,
+        FieldBit_CommenterLink,
+        FieldBit_CommentHTML,
+        FieldBit_ParentId,
+        FieldBit_date,
+        FieldBit_Votes,
+        FieldBit_VotesUp,
+        FieldBit_VotesDown,
+        FieldBit_Verified,
+        FieldBit_AvatarSrc,
+        FieldBit_HasImages,
+        FieldBit_IsByAdmin,
+        FieldBit_IsByModerator,
+        FieldBit_IsPinned,
+        FieldBit_IsLocked,
+        FieldBit_DisplayLabel,
+        FieldBit_Rating,
+        FieldBit_Badges,
+        FieldBit_ViewCount,
+        FieldBit_IsDeleted,
+        FieldBit_IsDeletedUser,
+        FieldBit_IsSpam,
+        FieldBit_AnonUserId,
+        FieldBit_FeedbackIds,
+        FieldBit_RequiresVerification,
+        FieldBit_EditKey,
+        FieldBit_Approved,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
     bool m_HasImages;
-    bool m_HasImagesIsSet;
-
     bool m_IsByAdmin;
-    bool m_IsByAdminIsSet;
-
     bool m_IsByModerator;
-    bool m_IsByModeratorIsSet;
-
-    boost::optional<bool> m_IsPinned;
-
-    boost::optional<bool> m_IsLocked;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
-    boost::optional<double> m_Rating;
-
-    boost::optional<std::vector<std::shared_ptr<CommentUserBadgeInfo>>> m_Badges;
-
-    boost::optional<int64_t> m_ViewCount;
-
+    bool m_IsPinned;
+    bool m_IsLocked;
     bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
-
     bool m_IsDeletedUser;
-    bool m_IsDeletedUserIsSet;
-
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
-    std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
-
     bool m_RequiresVerification;
-    bool m_RequiresVerificationIsSet;
-
-    utility::string_t m_EditKey;
-    bool m_EditKeyIsSet;
-
     bool m_Approved;
-    bool m_ApprovedIsSet;
+    int32_t m_Votes;
+    int32_t m_VotesUp;
+    int32_t m_VotesDown;
+    utility::string_t m__id;
+    utility::string_t m_UserId;
+    InternedString m_CommenterName;
+    utility::string_t m_CommenterLink;
+    utility::string_t m_CommentHTML;
+    utility::string_t m_ParentId;
+    utility::datetime m_date;
+    InternedString m_AvatarSrc;
+    utility::string_t m_DisplayLabel;
+    double m_Rating;
+    std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
+    int64_t m_ViewCount;
+    utility::string_t m_AnonUserId;
+    std::vector<utility::string_t> m_FeedbackIds;
+    utility::string_t m_EditKey;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
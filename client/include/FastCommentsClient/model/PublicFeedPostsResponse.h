@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PublicFeedPostsResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -52,7 +52,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -99,25 +102,26 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_FeedPosts,
+        FieldBit_User,
+        FieldBit_UrlIdWS,
+        FieldBit_UserIdWS,
+        FieldBit_TenantIdWS,
+        FieldBit_MyReacts,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     std::vector<std::shared_ptr<FeedPost>> m_FeedPosts;
-    bool m_FeedPostsIsSet;
-
-    boost::optional<std::shared_ptr<UserSessionInfo>> m_User;
-
+    std::shared_ptr<UserSessionInfo> m_User;
     utility::string_t m_UrlIdWS;
-    bool m_UrlIdWSIsSet;
-
     utility::string_t m_UserIdWS;
-    bool m_UserIdWSIsSet;
-
     utility::string_t m_TenantIdWS;
-    bool m_TenantIdWSIsSet;
-
     std::map<utility::string_t, std::map<utility::string_t, bool>> m_MyReacts;
-    bool m_MyReactsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
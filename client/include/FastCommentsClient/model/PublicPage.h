@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PublicPage_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PublicPage_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -81,20 +84,22 @@ public:
 
 
 protected:
-    int64_t m_UpdatedAt;
-    bool m_UpdatedAtIsSet;
+    enum FieldBit
+    {
+        FieldBit_UpdatedAt,
+        FieldBit_CommentCount,
+        FieldBit_Title,
+        FieldBit_Url,
+        FieldBit_UrlId,
+        FieldBitCount
+    };
 
     int32_t m_CommentCount;
-    bool m_CommentCountIsSet;
-
+    int64_t m_UpdatedAt;
     utility::string_t m_Title;
-    bool m_TitleIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_PublicVote_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_PublicVote_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -86,23 +89,24 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_UrlId,
+        FieldBit_CommentId,
+        FieldBit_UserId,
+        FieldBit_Direction,
+        FieldBit_CreatedAt,
+        FieldBitCount
+    };
 
+    utility::string_t m_Id;
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_CommentId;
-    bool m_CommentIdIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::string_t m_Direction;
-    bool m_DirectionIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
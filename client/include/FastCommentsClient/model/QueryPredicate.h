@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_QueryPredicate_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -85,14 +88,18 @@ public:
 
 
 protected:
-    utility::string_t m_Key;
-    bool m_KeyIsSet;
-
-    std::shared_ptr<QueryPredicate_value> m_Value;
-    bool m_ValueIsSet;
+    enum FieldBit
+    {
+        FieldBit_Key,
+        FieldBit_Value,
+        FieldBit_r_operator,
+        FieldBitCount
+    };
 
     R_operatorEnum m_r_operator;
-    bool m_r_operatorIsSet;
+    utility::string_t m_Key;
+    std::shared_ptr<QueryPredicate_value> m_Value;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
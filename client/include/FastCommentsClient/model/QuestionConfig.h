@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionConfig_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionConfig_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -164,68 +167,54 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_Name,
+        FieldBit_Question,
+        FieldBit_SummaryLabel,
+        FieldBit_HelpText,
+        FieldBit_CreatedAt,
+        FieldBit_CreatedBy,
+        FieldBit_UsedCount,
+        FieldBit_LastUsed,
+        FieldBit_Type,
+        FieldBit_NumStars,
+        FieldBit_Min,
+        FieldBit_Max,
+        FieldBit_DefaultValue,
+        FieldBit_LabelNegative,
+        FieldBit_LabelPositive,
+        FieldBit_CustomOptions,
+        FieldBit_SubQuestionIds,
+        FieldBit_AlwaysShowSubQuestions,
+        FieldBit_ReportingOrder,
+        FieldBitCount
+    };
 
+    bool m_AlwaysShowSubQuestions;
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_Name;
-    bool m_NameIsSet;
-
     utility::string_t m_Question;
-    bool m_QuestionIsSet;
-
     utility::string_t m_SummaryLabel;
-    bool m_SummaryLabelIsSet;
-
     utility::string_t m_HelpText;
-    bool m_HelpTextIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_CreatedBy;
-    bool m_CreatedByIsSet;
-
     double m_UsedCount;
-    bool m_UsedCountIsSet;
-
     utility::datetime m_LastUsed;
-    bool m_LastUsedIsSet;
-
     utility::string_t m_Type;
-    bool m_TypeIsSet;
-
     double m_NumStars;
-    bool m_NumStarsIsSet;
-
     double m_Min;
-    bool m_MinIsSet;
-
     double m_Max;
-    bool m_MaxIsSet;
-
     double m_DefaultValue;
-    bool m_DefaultValueIsSet;
-
     utility::string_t m_LabelNegative;
-    bool m_LabelNegativeIsSet;
-
     utility::string_t m_LabelPositive;
-    bool m_LabelPositiveIsSet;
-
     std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> m_CustomOptions;
-    bool m_CustomOptionsIsSet;
-
     std::vector<utility::string_t> m_SubQuestionIds;
-    bool m_SubQuestionIdsIsSet;
-
-    bool m_AlwaysShowSubQuestions;
-    bool m_AlwaysShowSubQuestionsIsSet;
-
     double m_ReportingOrder;
-    bool m_ReportingOrderIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionDatum_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionDatum_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -69,11 +72,16 @@ public:
 
 
 protected:
-    std::map<utility::string_t, double> m_v;
-    bool m_vIsSet;
+    enum FieldBit
+    {
+        FieldBit_v,
+        FieldBit_Total,
+        FieldBitCount
+    };
 
+    std::map<utility::string_t, double> m_v;
     int64_t m_Total;
-    bool m_TotalIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
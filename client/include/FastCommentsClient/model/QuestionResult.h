@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionResult_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionResult_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -114,36 +117,34 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UrlId,
+        FieldBit_AnonUserId,
+        FieldBit_UserId,
+        FieldBit_CreatedAt,
+        FieldBit_Value,
+        FieldBit_CommentId,
+        FieldBit_QuestionId,
+        FieldBit_Meta,
+        FieldBit_IpHash,
+        FieldBitCount
+    };
 
+    int32_t m_Value;
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_AnonUserId;
-    bool m_AnonUserIdIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    int32_t m_Value;
-    bool m_ValueIsSet;
-
-    boost::optional<utility::string_t> m_CommentId;
-
+    utility::string_t m_CommentId;
     utility::string_t m_QuestionId;
-    bool m_QuestionIdIsSet;
-
-    boost::optional<std::vector<std::shared_ptr<MetaItem>>> m_Meta;
-
+    std::vector<std::shared_ptr<MetaItem>> m_Meta;
     utility::string_t m_IpHash;
-    bool m_IpHashIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionResultAggregationOverall_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_QuestionResultAggregationOverall_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -95,23 +98,24 @@ public:
 
 
 protected:
-    std::map<utility::string_t, std::shared_ptr<QuestionDatum>> m_DataByDateBucket;
-    bool m_DataByDateBucketIsSet;
+    enum FieldBit
+    {
+        FieldBit_DataByDateBucket,
+        FieldBit_DataByUrlId,
+        FieldBit_CountsByValue,
+        FieldBit_Total,
+        FieldBit_Average,
+        FieldBit_CreatedAt,
+        FieldBitCount
+    };
 
+    std::map<utility::string_t, std::shared_ptr<QuestionDatum>> m_DataByDateBucket;
     std::map<utility::string_t, std::shared_ptr<QuestionDatum>> m_DataByUrlId;
-    bool m_DataByUrlIdIsSet;
-
     std::map<utility::string_t, int32_t> m_CountsByValue;
-    bool m_CountsByValueIsSet;
-
     int64_t m_Total;
-    bool m_TotalIsSet;
-
     double m_Average;
-    bool m_AverageIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
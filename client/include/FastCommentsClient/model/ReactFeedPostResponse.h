@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ReactFeedPostResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -73,14 +76,18 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
-
-    utility::string_t m_ReactType;
-    bool m_ReactTypeIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_ReactType,
+        FieldBit_IsUndo,
+        FieldBitCount
+    };
 
     bool m_IsUndo;
-    bool m_IsUndoIsSet;
+    std::shared_ptr<APIStatus> m_Status;
+    utility::string_t m_ReactType;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
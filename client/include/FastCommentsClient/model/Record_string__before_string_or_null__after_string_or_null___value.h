@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_Record_string__before_string_or_null__after_string_or_null___value_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_Record_string__before_string_or_null__after_string_or_null___value_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -66,9 +69,16 @@ public:
 
 
 protected:
-    boost::optional<utility::string_t> m_After;
-
-    boost::optional<utility::string_t> m_Before;
+    enum FieldBit
+    {
+        FieldBit_After,
+        FieldBit_Before,
+        FieldBitCount
+    };
+
+    utility::string_t m_After;
+    utility::string_t m_Before;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_RenderableUserNotification_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -165,63 +168,54 @@ public:
 
 
 protected:
-    utility::string_t m_ConversationId;
-    bool m_ConversationIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_ConversationId,
+        FieldBit_ContextHTML,
+        FieldBit_FromUserNames,
+        FieldBit_FromUserIds,
+        FieldBit_RelatedIds,
+        FieldBit_Count,
+        FieldBit_OptedOut,
+        FieldBit_FromUserAvatarSrc,
+        FieldBit_FromUserId,
+        FieldBit_FromUserName,
+        FieldBit_FromCommentId,
+        FieldBit_Type,
+        FieldBit_CreatedAt,
+        FieldBit_Sent,
+        FieldBit_Viewed,
+        FieldBit_RelatedObjectId,
+        FieldBit_RelatedObjectType,
+        FieldBit_PageTitle,
+        FieldBit_Url,
+        FieldBit_UrlId,
+        FieldBit__id,
+        FieldBitCount
+    };
 
+    bool m_OptedOut;
+    utility::string_t m_ConversationId;
     utility::string_t m_ContextHTML;
-    bool m_ContextHTMLIsSet;
-
     std::vector<utility::string_t> m_FromUserNames;
-    bool m_FromUserNamesIsSet;
-
     std::vector<utility::string_t> m_FromUserIds;
-    bool m_FromUserIdsIsSet;
-
     std::vector<utility::string_t> m_RelatedIds;
-    bool m_RelatedIdsIsSet;
-
     int64_t m_Count;
-    bool m_CountIsSet;
-
-    bool m_OptedOut;
-    bool m_OptedOutIsSet;
-
-    boost::optional<utility::string_t> m_FromUserAvatarSrc;
-
-    boost::optional<utility::string_t> m_FromUserId;
-
-    boost::optional<utility::string_t> m_FromUserName;
-
-    boost::optional<utility::string_t> m_FromCommentId;
-
+    utility::string_t m_FromUserAvatarSrc;
+    utility::string_t m_FromUserId;
+    utility::string_t m_FromUserName;
+    utility::string_t m_FromCommentId;
     std::shared_ptr<NotificationType> m_Type;
-    bool m_TypeIsSet;
-
     utility::string_t m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_Sent;
-    bool m_SentIsSet;
-
     utility::string_t m_Viewed;
-    bool m_ViewedIsSet;
-
     utility::string_t m_RelatedObjectId;
-    bool m_RelatedObjectIdIsSet;
-
     std::shared_ptr<NotificationObjectType> m_RelatedObjectType;
-    bool m_RelatedObjectTypeIsSet;
-
-    boost::optional<utility::string_t> m_PageTitle;
-
+    utility::string_t m_PageTitle;
     utility::string_t m_Url;
-    bool m_UrlIsSet;
-
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m__id;
-    bool m__idIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ReplaceTenantPackageBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ReplaceTenantPackageBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -212,98 +215,74 @@ public:
 
 
 protected:
-    utility::string_t m_Name;
-    bool m_NameIsSet;
+    enum FieldBit
+    {
+        FieldBit_Name,
+        FieldBit_MonthlyCostUSD,
+        FieldBit_YearlyCostUSD,
+        FieldBit_MaxMonthlyPageLoads,
+        FieldBit_MaxMonthlyAPICredits,
+        FieldBit_MaxMonthlyComments,
+        FieldBit_MaxConcurrentUsers,
+        FieldBit_MaxTenantUsers,
+        FieldBit_MaxSSOUsers,
+        FieldBit_MaxModerators,
+        FieldBit_MaxDomains,
+        FieldBit_MaxCustomCollectionSize,
+        FieldBit_HasDebranding,
+        FieldBit_ForWhoText,
+        FieldBit_FeatureTaglines,
+        FieldBit_HasFlexPricing,
+        FieldBit_FlexPageLoadCostCents,
+        FieldBit_FlexPageLoadUnit,
+        FieldBit_FlexCommentCostCents,
+        FieldBit_FlexCommentUnit,
+        FieldBit_FlexSSOUserCostCents,
+        FieldBit_FlexSSOUserUnit,
+        FieldBit_FlexAPICreditCostCents,
+        FieldBit_FlexAPICreditUnit,
+        FieldBit_FlexModeratorCostCents,
+        FieldBit_FlexModeratorUnit,
+        FieldBit_FlexAdminCostCents,
+        FieldBit_FlexAdminUnit,
+        FieldBit_FlexDomainCostCents,
+        FieldBit_FlexDomainUnit,
+        FieldBit_FlexMinimumCostCents,
+        FieldBitCount
+    };
 
+    bool m_HasDebranding;
+    bool m_HasFlexPricing;
+    utility::string_t m_Name;
     double m_MonthlyCostUSD;
-    bool m_MonthlyCostUSDIsSet;
-
     double m_YearlyCostUSD;
-    bool m_YearlyCostUSDIsSet;
-
     double m_MaxMonthlyPageLoads;
-    bool m_MaxMonthlyPageLoadsIsSet;
-
     double m_MaxMonthlyAPICredits;
-    bool m_MaxMonthlyAPICreditsIsSet;
-
     double m_MaxMonthlyComments;
-    bool m_MaxMonthlyCommentsIsSet;
-
     double m_MaxConcurrentUsers;
-    bool m_MaxConcurrentUsersIsSet;
-
     double m_MaxTenantUsers;
-    bool m_MaxTenantUsersIsSet;
-
     double m_MaxSSOUsers;
-    bool m_MaxSSOUsersIsSet;
-
     double m_MaxModerators;
-    bool m_MaxModeratorsIsSet;
-
     double m_MaxDomains;
-    bool m_MaxDomainsIsSet;
-
     double m_MaxCustomCollectionSize;
-    bool m_MaxCustomCollectionSizeIsSet;
-
-    bool m_HasDebranding;
-    bool m_HasDebrandingIsSet;
-
     utility::string_t m_ForWhoText;
-    bool m_ForWhoTextIsSet;
-
     std::vector<utility::string_t> m_FeatureTaglines;
-    bool m_FeatureTaglinesIsSet;
-
-    bool m_HasFlexPricing;
-    bool m_HasFlexPricingIsSet;
-
     double m_FlexPageLoadCostCents;
-    bool m_FlexPageLoadCostCentsIsSet;
-
     double m_FlexPageLoadUnit;
-    bool m_FlexPageLoadUnitIsSet;
-
     double m_FlexCommentCostCents;
-    bool m_FlexCommentCostCentsIsSet;
-
     double m_FlexCommentUnit;
-    bool m_FlexCommentUnitIsSet;
-
     double m_FlexSSOUserCostCents;
-    bool m_FlexSSOUserCostCentsIsSet;
-
     double m_FlexSSOUserUnit;
-    bool m_FlexSSOUserUnitIsSet;
-
     double m_FlexAPICreditCostCents;
-    bool m_FlexAPICreditCostCentsIsSet;
-
     double m_FlexAPICreditUnit;
-    bool m_FlexAPICreditUnitIsSet;
-
     double m_FlexModeratorCostCents;
-    bool m_FlexModeratorCostCentsIsSet;
-
     double m_FlexModeratorUnit;
-    bool m_FlexModeratorUnitIsSet;
-
     double m_FlexAdminCostCents;
-    bool m_FlexAdminCostCentsIsSet;
-
     double m_FlexAdminUnit;
-    bool m_FlexAdminUnitIsSet;
-
     double m_FlexDomainCostCents;
-    bool m_FlexDomainCostCentsIsSet;
-
     double m_FlexDomainUnit;
-    bool m_FlexDomainUnitIsSet;
-
     double m_FlexMinimumCostCents;
-    bool m_FlexMinimumCostCentsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
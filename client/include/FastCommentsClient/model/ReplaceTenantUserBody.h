@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_ReplaceTenantUserBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_ReplaceTenantUserBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -197,89 +200,68 @@ public:
 
 
 protected:
-    utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
-    utility::string_t m_Email;
-    bool m_EmailIsSet;
-
-    utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
-    utility::string_t m_WebsiteUrl;
-    bool m_WebsiteUrlIsSet;
-
-    double m_SignUpDate;
-    bool m_SignUpDateIsSet;
-
-    utility::string_t m_Locale;
-    bool m_LocaleIsSet;
+    enum FieldBit
+    {
+        FieldBit_Username,
+        FieldBit_Email,
+        FieldBit_DisplayName,
+        FieldBit_WebsiteUrl,
+        FieldBit_SignUpDate,
+        FieldBit_Locale,
+        FieldBit_Verified,
+        FieldBit_LoginCount,
+        FieldBit_OptedInNotifications,
+        FieldBit_OptedInTenantNotifications,
+        FieldBit_HideAccountCode,
+        FieldBit_AvatarSrc,
+        FieldBit_IsHelpRequestAdmin,
+        FieldBit_IsAccountOwner,
+        FieldBit_IsAdminAdmin,
+        FieldBit_IsBillingAdmin,
+        FieldBit_IsAnalyticsAdmin,
+        FieldBit_IsCustomizationAdmin,
+        FieldBit_IsManageDataAdmin,
+        FieldBit_IsCommentModeratorAdmin,
+        FieldBit_IsAPIAdmin,
+        FieldBit_ModeratorIds,
+        FieldBit_DigestEmailFrequency,
+        FieldBit_DisplayLabel,
+        FieldBit_CreatedFromUrlId,
+        FieldBit_CreatedFromTenantId,
+        FieldBit_LastLoginDate,
+        FieldBit_Karma,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    double m_LoginCount;
-    bool m_LoginCountIsSet;
-
     bool m_OptedInNotifications;
-    bool m_OptedInNotificationsIsSet;
-
     bool m_OptedInTenantNotifications;
-    bool m_OptedInTenantNotificationsIsSet;
-
     bool m_HideAccountCode;
-    bool m_HideAccountCodeIsSet;
-
-    utility::string_t m_AvatarSrc;
-    bool m_AvatarSrcIsSet;
-
     bool m_IsHelpRequestAdmin;
-    bool m_IsHelpRequestAdminIsSet;
-
     bool m_IsAccountOwner;
-    bool m_IsAccountOwnerIsSet;
-
     bool m_IsAdminAdmin;
-    bool m_IsAdminAdminIsSet;
-
     bool m_IsBillingAdmin;
-    bool m_IsBillingAdminIsSet;
-
     bool m_IsAnalyticsAdmin;
-    bool m_IsAnalyticsAdminIsSet;
-
     bool m_IsCustomizationAdmin;
-    bool m_IsCustomizationAdminIsSet;
-
     bool m_IsManageDataAdmin;
-    bool m_IsManageDataAdminIsSet;
-
     bool m_IsCommentModeratorAdmin;
-    bool m_IsCommentModeratorAdminIsSet;
-
     bool m_IsAPIAdmin;
-    bool m_IsAPIAdminIsSet;
-
+    utility::string_t m_Username;
+    utility::string_t m_Email;
+    utility::string_t m_DisplayName;
+    utility::string_t m_WebsiteUrl;
+    double m_SignUpDate;
+    utility::string_t m_Locale;
+    double m_LoginCount;
+    utility::string_t m_AvatarSrc;
     std::vector<utility::string_t> m_ModeratorIds;
-    bool m_ModeratorIdsIsSet;
-
     double m_DigestEmailFrequency;
-    bool m_DigestEmailFrequencyIsSet;
-
     utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
-
     utility::string_t m_CreatedFromUrlId;
-    bool m_CreatedFromUrlIdIsSet;
-
     utility::string_t m_CreatedFromTenantId;
-    bool m_CreatedFromTenantIdIsSet;
-
     double m_LastLoginDate;
-    bool m_LastLoginDateIsSet;
-
     double m_Karma;
-    bool m_KarmaIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_SaveCommentsBulkResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -56,7 +56,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -126,37 +129,34 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_Comment,
+        FieldBit_User,
+        FieldBit_ModuleData,
+        FieldBit_Reason,
+        FieldBit_Code,
+        FieldBit_SecondaryCode,
+        FieldBit_BannedUntil,
+        FieldBit_MaxCharacterLength,
+        FieldBit_TranslatedError,
+        FieldBit_CustomConfig,
+        FieldBitCount
+    };
 
+    int32_t m_MaxCharacterLength;
+    std::shared_ptr<APIStatus> m_Status;
     std::shared_ptr<APIComment> m_Comment;
-    bool m_CommentIsSet;
-
-    boost::optional<std::shared_ptr<UserSessionInfo>> m_User;
-
+    std::shared_ptr<UserSessionInfo> m_User;
     std::map<utility::string_t, std::shared_ptr<Object>> m_ModuleData;
-    bool m_ModuleDataIsSet;
-
     utility::string_t m_Reason;
-    bool m_ReasonIsSet;
-
     utility::string_t m_Code;
-    bool m_CodeIsSet;
-
     utility::string_t m_SecondaryCode;
-    bool m_SecondaryCodeIsSet;
-
     int64_t m_BannedUntil;
-    bool m_BannedUntilIsSet;
-
-    int32_t m_MaxCharacterLength;
-    bool m_MaxCharacterLengthIsSet;
-
     utility::string_t m_TranslatedError;
-    bool m_TranslatedErrorIsSet;
-
     std::shared_ptr<CustomConfigParameters> m_CustomConfig;
-    bool m_CustomConfigIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
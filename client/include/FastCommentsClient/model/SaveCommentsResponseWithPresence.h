@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_SaveCommentsResponseWithPresence_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -52,7 +52,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -92,19 +95,22 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_Comment,
+        FieldBit_User,
+        FieldBit_ModuleData,
+        FieldBit_UserIdWS,
+        FieldBitCount
+    };
 
+    std::shared_ptr<APIStatus> m_Status;
     std::shared_ptr<PublicComment> m_Comment;
-    bool m_CommentIsSet;
-
-    boost::optional<std::shared_ptr<UserSessionInfo>> m_User;
-
+    std::shared_ptr<UserSessionInfo> m_User;
     std::map<utility::string_t, std::shared_ptr<Object>> m_ModuleData;
-    bool m_ModuleDataIsSet;
-
     utility::string_t m_UserIdWS;
-    bool m_UserIdWSIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
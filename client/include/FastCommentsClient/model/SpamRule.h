@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_SpamRule_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -79,11 +82,16 @@ public:
 
 
 protected:
-    std::vector<ActionsEnum> m_Actions;
-    bool m_ActionsIsSet;
+    enum FieldBit
+    {
+        FieldBit_Actions,
+        FieldBit_CommentContains,
+        FieldBitCount
+    };
 
+    std::vector<ActionsEnum> m_Actions;
     utility::string_t m_CommentContains;
-    bool m_CommentContainsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_TOSConfig_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_TOSConfig_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -75,14 +78,18 @@ public:
 
 
 protected:
-    bool m_Enabled;
-    bool m_EnabledIsSet;
+    enum FieldBit
+    {
+        FieldBit_Enabled,
+        FieldBit_TextByLocale,
+        FieldBit_LastUpdated,
+        FieldBitCount
+    };
 
+    bool m_Enabled;
     std::map<utility::string_t, utility::string_t> m_TextByLocale;
-    bool m_TextByLocaleIsSet;
-
     utility::datetime m_LastUpdated;
-    bool m_LastUpdatedIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
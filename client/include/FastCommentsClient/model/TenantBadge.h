@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_TenantBadge_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_TenantBadge_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -161,60 +164,54 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_CreatedByUserId,
+        FieldBit_CreatedAt,
+        FieldBit_Enabled,
+        FieldBit_UrlId,
+        FieldBit_Type,
+        FieldBit_Threshold,
+        FieldBit_Uses,
+        FieldBit_Name,
+        FieldBit_Description,
+        FieldBit_DisplayLabel,
+        FieldBit_DisplaySrc,
+        FieldBit_BackgroundColor,
+        FieldBit_BorderColor,
+        FieldBit_TextColor,
+        FieldBit_CssClass,
+        FieldBit_VeteranUserThresholdMillis,
+        FieldBit_IsAwaitingReprocess,
+        FieldBit_IsAwaitingDeletion,
+        FieldBit_ReplacesBadgeId,
+        FieldBitCount
+    };
 
+    bool m_Enabled;
+    bool m_IsAwaitingReprocess;
+    bool m_IsAwaitingDeletion;
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_CreatedByUserId;
-    bool m_CreatedByUserIdIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    bool m_Enabled;
-    bool m_EnabledIsSet;
-
-    boost::optional<utility::string_t> m_UrlId;
-
+    utility::string_t m_UrlId;
     double m_Type;
-    bool m_TypeIsSet;
-
     double m_Threshold;
-    bool m_ThresholdIsSet;
-
     double m_Uses;
-    bool m_UsesIsSet;
-
     utility::string_t m_Name;
-    bool m_NameIsSet;
-
     utility::string_t m_Description;
-    bool m_DescriptionIsSet;
-
     utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
-
-    boost::optional<utility::string_t> m_DisplaySrc;
-
-    boost::optional<utility::string_t> m_BackgroundColor;
-
-    boost::optional<utility::string_t> m_BorderColor;
-
-    boost::optional<utility::string_t> m_TextColor;
-
-    boost::optional<utility::string_t> m_CssClass;
-
-    boost::optional<double> m_VeteranUserThresholdMillis;
-
-    bool m_IsAwaitingReprocess;
-    bool m_IsAwaitingReprocessIsSet;
-
-    bool m_IsAwaitingDeletion;
-    bool m_IsAwaitingDeletionIsSet;
-
-    boost::optional<utility::string_t> m_ReplacesBadgeId;
+    utility::string_t m_DisplaySrc;
+    utility::string_t m_BackgroundColor;
+    utility::string_t m_BorderColor;
+    utility::string_t m_TextColor;
+    utility::string_t m_CssClass;
+    double m_VeteranUserThresholdMillis;
+    utility::string_t m_ReplacesBadgeId;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
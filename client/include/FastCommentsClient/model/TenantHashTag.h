@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_TenantHashTag_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_TenantHashTag_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -81,20 +84,22 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_CreatedAt,
+        FieldBit_TenantId,
+        FieldBit_Tag,
+        FieldBit_Url,
+        FieldBitCount
+    };
 
+    utility::string_t m__id;
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_Tag;
-    bool m_TagIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_TenantPackage_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_TenantPackage_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -362,184 +365,134 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_Name,
+        FieldBit_TenantId,
+        FieldBit_CreatedAt,
+        FieldBit_TemplateId,
+        FieldBit_MonthlyCostUSD,
+        FieldBit_YearlyCostUSD,
+        FieldBit_MonthlyStripePlanId,
+        FieldBit_YearlyStripePlanId,
+        FieldBit_MaxMonthlyPageLoads,
+        FieldBit_MaxMonthlyAPICredits,
+        FieldBit_MaxMonthlySmallWidgetsCredits,
+        FieldBit_MaxMonthlyComments,
+        FieldBit_MaxConcurrentUsers,
+        FieldBit_MaxTenantUsers,
+        FieldBit_MaxSSOUsers,
+        FieldBit_MaxModerators,
+        FieldBit_MaxDomains,
+        FieldBit_MaxWhiteLabeledTenants,
+        FieldBit_MaxMonthlyEventLogRequests,
+        FieldBit_MaxCustomCollectionSize,
+        FieldBit_HasWhiteLabeling,
+        FieldBit_HasDebranding,
+        FieldBit_HasLLMSpamDetection,
+        FieldBit_ForWhoText,
+        FieldBit_FeatureTaglines,
+        FieldBit_HasAuditing,
+        FieldBit_HasFlexPricing,
+        FieldBit_EnableSAML,
+        FieldBit_EnableCanvasLTI,
+        FieldBit_FlexPageLoadCostCents,
+        FieldBit_FlexPageLoadUnit,
+        FieldBit_FlexCommentCostCents,
+        FieldBit_FlexCommentUnit,
+        FieldBit_FlexSSOUserCostCents,
+        FieldBit_FlexSSOUserUnit,
+        FieldBit_FlexAPICreditCostCents,
+        FieldBit_FlexAPICreditUnit,
+        FieldBit_FlexSmallWidgetsCreditCostCents,
+        FieldBit_FlexSmallWidgetsCreditUnit,
+        FieldBit_FlexModeratorCostCents,
+        FieldBit_FlexModeratorUnit,
+        FieldBit_FlexAdminCostCents,
+        FieldBit_FlexAdminUnit,
+        FieldBit_FlexDomainCostCents,
+        FieldBit_FlexDomainUnit,
+        FieldBit_FlexChatGPTCostCents,
+        FieldBit_FlexChatGPTUnit,
+        FieldBit_FlexLLMCostCents,
+        FieldBit_FlexLLMUnit,
+        FieldBit_FlexMinimumCostCents,
+        FieldBit_FlexManagedTenantCostCents,
+        FieldBit_FlexSSOAdminCostCents,
+        FieldBit_FlexSSOAdminUnit,
+        FieldBit_FlexSSOModeratorCostCents,
+        FieldBit_FlexSSOModeratorUnit,
+        FieldBit_IsSSOBillingMonthlyActiveUsers,
+        FieldBit_HasAIAgents,
+        FieldBit_MaxAIAgents,
+        FieldBit_AiAgentDailyBudgetCents,
+        FieldBit_AiAgentMonthlyBudgetCents,
+        FieldBitCount
+    };
 
+    bool m_HasWhiteLabeling;
+    bool m_HasDebranding;
+    bool m_HasLLMSpamDetection;
+    bool m_HasAuditing;
+    bool m_HasFlexPricing;
+    bool m_EnableSAML;
+    bool m_EnableCanvasLTI;
+    bool m_IsSSOBillingMonthlyActiveUsers;
+    bool m_HasAIAgents;
+    utility::string_t m__id;
     utility::string_t m_Name;
-    bool m_NameIsSet;
-
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     utility::string_t m_TemplateId;
-    bool m_TemplateIdIsSet;
-
-    boost::optional<double> m_MonthlyCostUSD;
-
-    boost::optional<double> m_YearlyCostUSD;
-
-    boost::optional<utility::string_t> m_MonthlyStripePlanId;
-
-    boost::optional<utility::string_t> m_YearlyStripePlanId;
-
+    double m_MonthlyCostUSD;
+    double m_YearlyCostUSD;
+    utility::string_t m_MonthlyStripePlanId;
+    utility::string_t m_YearlyStripePlanId;
     double m_MaxMonthlyPageLoads;
-    bool m_MaxMonthlyPageLoadsIsSet;
-
     double m_MaxMonthlyAPICredits;
-    bool m_MaxMonthlyAPICreditsIsSet;
-
     double m_MaxMonthlySmallWidgetsCredits;
-    bool m_MaxMonthlySmallWidgetsCreditsIsSet;
-
     double m_MaxMonthlyComments;
-    bool m_MaxMonthlyCommentsIsSet;
-
     double m_MaxConcurrentUsers;
-    bool m_MaxConcurrentUsersIsSet;
-
     double m_MaxTenantUsers;
-    bool m_MaxTenantUsersIsSet;
-
     double m_MaxSSOUsers;
-    bool m_MaxSSOUsersIsSet;
-
     double m_MaxModerators;
-    bool m_MaxModeratorsIsSet;
-
     double m_MaxDomains;
-    bool m_MaxDomainsIsSet;
-
     double m_MaxWhiteLabeledTenants;
-    bool m_MaxWhiteLabeledTenantsIsSet;
-
     double m_MaxMonthlyEventLogRequests;
-    bool m_MaxMonthlyEventLogRequestsIsSet;
-
     double m_MaxCustomCollectionSize;
-    bool m_MaxCustomCollectionSizeIsSet;
-
-    bool m_HasWhiteLabeling;
-    bool m_HasWhiteLabelingIsSet;
-
-    bool m_HasDebranding;
-    bool m_HasDebrandingIsSet;
-
-    bool m_HasLLMSpamDetection;
-    bool m_HasLLMSpamDetectionIsSet;
-
     utility::string_t m_ForWhoText;
-    bool m_ForWhoTextIsSet;
-
     std::vector<utility::string_t> m_FeatureTaglines;
-    bool m_FeatureTaglinesIsSet;
-
-    bool m_HasAuditing;
-    bool m_HasAuditingIsSet;
-
-    bool m_HasFlexPricing;
-    bool m_HasFlexPricingIsSet;
-
-    bool m_EnableSAML;
-    bool m_EnableSAMLIsSet;
-
-    bool m_EnableCanvasLTI;
-    bool m_EnableCanvasLTIIsSet;
-
     double m_FlexPageLoadCostCents;
-    bool m_FlexPageLoadCostCentsIsSet;
-
     double m_FlexPageLoadUnit;
-    bool m_FlexPageLoadUnitIsSet;
-
     double m_FlexCommentCostCents;
-    bool m_FlexCommentCostCentsIsSet;
-
     double m_FlexCommentUnit;
-    bool m_FlexCommentUnitIsSet;
-
     double m_FlexSSOUserCostCents;
-    bool m_FlexSSOUserCostCentsIsSet;
-
     double m_FlexSSOUserUnit;
-    bool m_FlexSSOUserUnitIsSet;
-
     double m_FlexAPICreditCostCents;
-    bool m_FlexAPICreditCostCentsIsSet;
-
     double m_FlexAPICreditUnit;
-    bool m_FlexAPICreditUnitIsSet;
-
     double m_FlexSmallWidgetsCreditCostCents;
-    bool m_FlexSmallWidgetsCreditCostCentsIsSet;
-
     double m_FlexSmallWidgetsCreditUnit;
-    bool m_FlexSmallWidgetsCreditUnitIsSet;
-
     double m_FlexModeratorCostCents;
-    bool m_FlexModeratorCostCentsIsSet;
-
     double m_FlexModeratorUnit;
-    bool m_FlexModeratorUnitIsSet;
-
     double m_FlexAdminCostCents;
-    bool m_FlexAdminCostCentsIsSet;
-
     double m_FlexAdminUnit;
-    bool m_FlexAdminUnitIsSet;
-
     double m_FlexDomainCostCents;
-    bool m_FlexDomainCostCentsIsSet;
-
     double m_FlexDomainUnit;
-    bool m_FlexDomainUnitIsSet;
-
     double m_FlexChatGPTCostCents;
-    bool m_FlexChatGPTCostCentsIsSet;
-
     double m_FlexChatGPTUnit;
-    bool m_FlexChatGPTUnitIsSet;
-
     double m_FlexLLMCostCents;
-    bool m_FlexLLMCostCentsIsSet;
-
     double m_FlexLLMUnit;
-    bool m_FlexLLMUnitIsSet;
-
     double m_FlexMinimumCostCents;
-    bool m_FlexMinimumCostCentsIsSet;
-
     double m_FlexManagedTenantCostCents;
-    bool m_FlexManagedTenantCostCentsIsSet;
-
     double m_FlexSSOAdminCostCents;
-    bool m_FlexSSOAdminCostCentsIsSet;
-
     double m_FlexSSOAdminUnit;
-    bool m_FlexSSOAdminUnitIsSet;
-
     double m_FlexSSOModeratorCostCents;
-    bool m_FlexSSOModeratorCostCentsIsSet;
-
     double m_FlexSSOModeratorUnit;
-    bool m_FlexSSOModeratorUnitIsSet;
-
-    bool m_IsSSOBillingMonthlyActiveUsers;
-    bool m_IsSSOBillingMonthlyActiveUsersIsSet;
-
-    bool m_HasAIAgents;
-    bool m_HasAIAgentsIsSet;
-
     double m_MaxAIAgents;
-    bool m_MaxAIAgentsIsSet;
-
     double m_AiAgentDailyBudgetCents;
-    bool m_AiAgentDailyBudgetCentsIsSet;
-
     double m_AiAgentMonthlyBudgetCents;
-    bool m_AiAgentMonthlyBudgetCentsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
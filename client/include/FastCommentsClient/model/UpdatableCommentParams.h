@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UpdatableCommentParams_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UpdatableCommentParams_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -46,7 +46,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -253,101 +256,90 @@ public:
 
 
 protected:
-    utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
-    utility::string_t m_UrlIdRaw;
-    bool m_UrlIdRawIsSet;
-
-    utility::string_t m_Url;
-    bool m_UrlIsSet;
-
-    boost::optional<utility::string_t> m_PageTitle;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    boost::optional<utility::string_t> m_CommenterEmail;
-
-    utility::string_t m_CommenterName;
-    bool m_CommenterNameIsSet;
-
-    boost::optional<utility::string_t> m_CommenterLink;
-
-    utility::string_t m_Comment;
-    bool m_CommentIsSet;
-
-    utility::string_t m_CommentHTML;
-    bool m_CommentHTMLIsSet;
-
-    boost::optional<utility::string_t> m_ParentId;
-
-    boost::optional<double> m_date;
-
-    boost::optional<utility::string_t> m_LocalDateString;
-
-    boost::optional<int32_t> m_LocalDateHours;
-
-    boost::optional<int32_t> m_Votes;
-
-    boost::optional<int32_t> m_VotesUp;
-
-    boost::optional<int32_t> m_VotesDown;
-
-    boost::optional<utility::datetime> m_ExpireAt;
+    enum FieldBit
+    {
+        FieldBit_UrlId,
+        FieldBit_UrlIdRaw,
+        FieldBit_Url,
+        FieldBit_PageTitle,
+        FieldBit_UserId,
+        FieldBit_CommenterEmail,
+        FieldBit_CommenterName,
+        FieldBit_CommenterLink,
+        FieldBit_Comment,
+        FieldBit_CommentHTML,
+        FieldBit_ParentId,
+        FieldBit_date,
+        FieldBit_LocalDateString,
+        FieldBit_LocalDateHours,
+        FieldBit_Votes,
+        FieldBit_VotesUp,
+        FieldBit_VotesDown,
+        FieldBit_ExpireAt,
+        FieldBit_Verified,
+        FieldBit_VerifiedDate,
+        FieldBit_NotificationSentForParent,
+        FieldBit_NotificationSentForParentTenant,
+        FieldBit_Reviewed,
+        FieldBit_ExternalId,
+        FieldBit_ExternalParentId,
+        FieldBit_AvatarSrc,
+        FieldBit_IsSpam,
+        FieldBit_Approved,
+        FieldBit_IsDeleted,
+        FieldBit_IsDeletedUser,
+        FieldBit_IsByAdmin,
+        FieldBit_IsByModerator,
+        FieldBit_IsPinned,
+        FieldBit_IsLocked,
+        FieldBit_FlagCount,
+        FieldBit_DisplayLabel,
+        FieldBit_Meta,
+        FieldBit_ModerationGroupIds,
+        FieldBit_FeedbackIds,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    boost::optional<utility::datetime> m_VerifiedDate;
-
     bool m_NotificationSentForParent;
-    bool m_NotificationSentForParentIsSet;
-
     bool m_NotificationSentForParentTenant;
-    bool m_NotificationSentForParentTenantIsSet;
-
     bool m_Reviewed;
-    bool m_ReviewedIsSet;
-
-    utility::string_t m_ExternalId;
-    bool m_ExternalIdIsSet;
-
-    boost::optional<utility::string_t> m_ExternalParentId;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
     bool m_IsSpam;
-    bool m_IsSpamIsSet;
-
     bool m_Approved;
-    bool m_ApprovedIsSet;
-
     bool m_IsDeleted;
-    bool m_IsDeletedIsSet;
-
     bool m_IsDeletedUser;
-    bool m_IsDeletedUserIsSet;
-
     bool m_IsByAdmin;
-    bool m_IsByAdminIsSet;
-
     bool m_IsByModerator;
-    bool m_IsByModeratorIsSet;
-
-    boost::optional<bool> m_IsPinned;
-
-    boost::optional<bool> m_IsLocked;
-
-    boost::optional<int32_t> m_FlagCount;
-
-    boost::optional<utility::string_t> m_DisplayLabel;
-
-    boost::optional<std::shared_ptr<APICommentBase_meta>> m_Meta;
-
-    boost::optional<std::vector<utility::string_t>> m_ModerationGroupIds;
-
+    bool m_IsPinned;
+    bool m_IsLocked;
+    int32_t m_LocalDateHours;
+    int32_t m_Votes;
+    int32_t m_VotesUp;
+    int32_t m_VotesDown;
+    int32_t m_FlagCount;
+    utility::string_t m_UrlId;
+    utility::string_t m_UrlIdRaw;
+    utility::string_t m_Url;
+    utility::string_t m_PageTitle;
+    utility::string_t m_UserId;
+    utility::string_t m_CommenterEmail;
+    utility::string_t m_CommenterName;
+    utility::string_t m_CommenterLink;
+    utility::string_t m_Comment;
+    utility::string_t m_CommentHTML;
+    utility::string_t m_ParentId;
+    double m_date;
+    utility::string_t m_LocalDateString;
+    utility::datetime m_ExpireAt;
+    utility::datetime m_VerifiedDate;
+    utility::string_t m_ExternalId;
+    utility::string_t m_ExternalParentId;
+    utility::string_t m_AvatarSrc;
+    utility::string_t m_DisplayLabel;
+    std::shared_ptr<APICommentBase_meta> m_Meta;
+    std::vector<utility::string_t> m_ModerationGroupIds;
     std::vector<utility::string_t> m_FeedbackIds;
-    bool m_FeedbackIdsIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateAPISSOUserData_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateAPISSOUserData_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -157,65 +160,52 @@ public:
 
 
 protected:
-    std::vector<utility::string_t> m_GroupIds;
-    bool m_GroupIdsIsSet;
+    enum FieldBit
+    {
+        FieldBit_GroupIds,
+        FieldBit_HasBlockedUsers,
+        FieldBit_IsProfileDMDisabled,
+        FieldBit_IsProfileCommentsPrivate,
+        FieldBit_IsProfileActivityPrivate,
+        FieldBit_IsCommentModeratorAdmin,
+        FieldBit_IsAdminAdmin,
+        FieldBit_IsAccountOwner,
+        FieldBit_DisplayName,
+        FieldBit_DisplayLabel,
+        FieldBit_OptedInSubscriptionNotifications,
+        FieldBit_OptedInNotifications,
+        FieldBit_AvatarSrc,
+        FieldBit_LoginCount,
+        FieldBit_CreatedFromUrlId,
+        FieldBit_SignUpDate,
+        FieldBit_Email,
+        FieldBit_WebsiteUrl,
+        FieldBit_Username,
+        FieldBit_Id,
+        FieldBitCount
+    };
 
     bool m_HasBlockedUsers;
-    bool m_HasBlockedUsersIsSet;
-
     bool m_IsProfileDMDisabled;
-    bool m_IsProfileDMDisabledIsSet;
-
     bool m_IsProfileCommentsPrivate;
-    bool m_IsProfileCommentsPrivateIsSet;
-
     bool m_IsProfileActivityPrivate;
-    bool m_IsProfileActivityPrivateIsSet;
-
     bool m_IsCommentModeratorAdmin;
-    bool m_IsCommentModeratorAdminIsSet;
-
     bool m_IsAdminAdmin;
-    bool m_IsAdminAdminIsSet;
-
     bool m_IsAccountOwner;
-    bool m_IsAccountOwnerIsSet;
-
-    utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
-    utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
-
     bool m_OptedInSubscriptionNotifications;
-    bool m_OptedInSubscriptionNotificationsIsSet;
-
     bool m_OptedInNotifications;
-    bool m_OptedInNotificationsIsSet;
-
-    utility::string_t m_AvatarSrc;
-    bool m_AvatarSrcIsSet;
-
     int32_t m_LoginCount;
-    bool m_LoginCountIsSet;
-
+    std::vector<utility::string_t> m_GroupIds;
+    utility::string_t m_DisplayName;
+    utility::string_t m_DisplayLabel;
+    utility::string_t m_AvatarSrc;
     utility::string_t m_CreatedFromUrlId;
-    bool m_CreatedFromUrlIdIsSet;
-
     int64_t m_SignUpDate;
-    bool m_SignUpDateIsSet;
-
     utility::string_t m_Email;
-    bool m_EmailIsSet;
-
     utility::string_t m_WebsiteUrl;
-    bool m_WebsiteUrlIsSet;
-
     utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
     utility::string_t m_Id;
-    bool m_IdIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
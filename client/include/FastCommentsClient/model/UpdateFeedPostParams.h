@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateFeedPostParams_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateFeedPostParams_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -95,23 +98,24 @@ public:
 
 
 protected:
-    utility::string_t m_Title;
-    bool m_TitleIsSet;
+    enum FieldBit
+    {
+        FieldBit_Title,
+        FieldBit_ContentHTML,
+        FieldBit_Media,
+        FieldBit_Links,
+        FieldBit_Tags,
+        FieldBit_Meta,
+        FieldBitCount
+    };
 
+    utility::string_t m_Title;
     utility::string_t m_ContentHTML;
-    bool m_ContentHTMLIsSet;
-
     std::vector<std::shared_ptr<FeedPostMediaItem>> m_Media;
-    bool m_MediaIsSet;
-
     std::vector<std::shared_ptr<FeedPostLink>> m_Links;
-    bool m_LinksIsSet;
-
     std::vector<utility::string_t> m_Tags;
-    bool m_TagsIsSet;
-
     std::map<utility::string_t, utility::string_t> m_Meta;
-    bool m_MetaIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
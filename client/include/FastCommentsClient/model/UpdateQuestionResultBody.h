@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateQuestionResultBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateQuestionResultBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -50,7 +50,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -112,28 +115,29 @@ public:
     void addAdditionalProperty(const utility::string_t& key, const web::json::value& value);
 
 protected:
-    utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_UrlId,
+        FieldBit_AnonUserId,
+        FieldBit_UserId,
+        FieldBit_Value,
+        FieldBit_CommentId,
+        FieldBit_QuestionId,
+        FieldBit_Meta,
+        FieldBit_AdditionalProperties,
+        FieldBitCount
+    };
 
+    utility::string_t m_UrlId;
     utility::string_t m_AnonUserId;
-    bool m_AnonUserIdIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     double m_Value;
-    bool m_ValueIsSet;
-
     utility::string_t m_CommentId;
-    bool m_CommentIdIsSet;
-
     utility::string_t m_QuestionId;
-    bool m_QuestionIdIsSet;
-
-    boost::optional<std::vector<std::shared_ptr<MetaItem>>> m_Meta;
-
+    std::vector<std::shared_ptr<MetaItem>> m_Meta;
     std::map<utility::string_t, web::json::value> m_AdditionalProperties;
-    bool m_AdditionalPropertiesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
+
 };
 
 
@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateTenantUserBody_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateTenantUserBody_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -177,77 +180,60 @@ public:
 
 
 protected:
-    utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
-    utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
-    utility::string_t m_WebsiteUrl;
-    bool m_WebsiteUrlIsSet;
-
-    utility::string_t m_Email;
-    bool m_EmailIsSet;
-
-    double m_SignUpDate;
-    bool m_SignUpDateIsSet;
+    enum FieldBit
+    {
+        FieldBit_Username,
+        FieldBit_DisplayName,
+        FieldBit_WebsiteUrl,
+        FieldBit_Email,
+        FieldBit_SignUpDate,
+        FieldBit_Verified,
+        FieldBit_LoginCount,
+        FieldBit_OptedInNotifications,
+        FieldBit_OptedInTenantNotifications,
+        FieldBit_HideAccountCode,
+        FieldBit_AvatarSrc,
+        FieldBit_IsHelpRequestAdmin,
+        FieldBit_IsAccountOwner,
+        FieldBit_IsAdminAdmin,
+        FieldBit_IsBillingAdmin,
+        FieldBit_IsAnalyticsAdmin,
+        FieldBit_IsCustomizationAdmin,
+        FieldBit_IsManageDataAdmin,
+        FieldBit_IsCommentModeratorAdmin,
+        FieldBit_IsAPIAdmin,
+        FieldBit_ModeratorIds,
+        FieldBit_Locale,
+        FieldBit_DigestEmailFrequency,
+        FieldBit_DisplayLabel,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    double m_LoginCount;
-    bool m_LoginCountIsSet;
-
     bool m_OptedInNotifications;
-    bool m_OptedInNotificationsIsSet;
-
     bool m_OptedInTenantNotifications;
-    bool m_OptedInTenantNotificationsIsSet;
-
     bool m_HideAccountCode;
-    bool m_HideAccountCodeIsSet;
-
-    utility::string_t m_AvatarSrc;
-    bool m_AvatarSrcIsSet;
-
     bool m_IsHelpRequestAdmin;
-    bool m_IsHelpRequestAdminIsSet;
-
     bool m_IsAccountOwner;
-    bool m_IsAccountOwnerIsSet;
-
     bool m_IsAdminAdmin;
-    bool m_IsAdminAdminIsSet;
-
     bool m_IsBillingAdmin;
-    bool m_IsBillingAdminIsSet;
-
     bool m_IsAnalyticsAdmin;
-    bool m_IsAnalyticsAdminIsSet;
-
     bool m_IsCustomizationAdmin;
-    bool m_IsCustomizationAdminIsSet;
-
     bool m_IsManageDataAdmin;
-    bool m_IsManageDataAdminIsSet;
-
     bool m_IsCommentModeratorAdmin;
-    bool m_IsCommentModeratorAdminIsSet;
-
     bool m_IsAPIAdmin;
-    bool m_IsAPIAdminIsSet;
-
+    utility::string_t m_Username;
+    utility::string_t m_DisplayName;
+    utility::string_t m_WebsiteUrl;
+    utility::string_t m_Email;
+    double m_SignUpDate;
+    double m_LoginCount;
+    utility::string_t m_AvatarSrc;
     std::vector<utility::string_t> m_ModeratorIds;
-    bool m_ModeratorIdsIsSet;
-
     utility::string_t m_Locale;
-    bool m_LocaleIsSet;
-
     double m_DigestEmailFrequency;
-    bool m_DigestEmailFrequencyIsSet;
-
     utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
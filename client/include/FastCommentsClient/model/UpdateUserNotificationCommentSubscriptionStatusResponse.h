@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UpdateUserNotificationCommentSubscriptionStatusResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -89,17 +92,20 @@ public:
 
 
 protected:
-    std::shared_ptr<APIStatus> m_Status;
-    bool m_StatusIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_MatchedCount,
+        FieldBit_ModifiedCount,
+        FieldBit_Note,
+        FieldBitCount
+    };
 
+    NoteEnum m_Note;
+    std::shared_ptr<APIStatus> m_Status;
     int64_t m_MatchedCount;
-    bool m_MatchedCountIsSet;
-
     int64_t m_ModifiedCount;
-    bool m_ModifiedCountIsSet;
-
-    NoteEnum m_Note;
-    bool m_NoteIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
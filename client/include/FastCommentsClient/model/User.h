@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_User_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -360,178 +363,132 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
-
-    boost::optional<utility::string_t> m_TenantId;
-
-    utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
-    utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
-    boost::optional<utility::string_t> m_WebsiteUrl;
-
-    boost::optional<utility::string_t> m_Email;
-
-    utility::string_t m_PendingEmail;
-    bool m_PendingEmailIsSet;
-
-    utility::string_t m_BackupEmail;
-    bool m_BackupEmailIsSet;
-
-    utility::string_t m_PendingBackupEmail;
-    bool m_PendingBackupEmailIsSet;
-
-    int64_t m_SignUpDate;
-    bool m_SignUpDateIsSet;
-
-    boost::optional<utility::string_t> m_CreatedFromUrlId;
-
-    boost::optional<utility::string_t> m_CreatedFromTenantId;
-
-    utility::string_t m_CreatedFromIpHashed;
-    bool m_CreatedFromIpHashedIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_Username,
+        FieldBit_DisplayName,
+        FieldBit_WebsiteUrl,
+        FieldBit_Email,
+        FieldBit_PendingEmail,
+        FieldBit_BackupEmail,
+        FieldBit_PendingBackupEmail,
+        FieldBit_SignUpDate,
+        FieldBit_CreatedFromUrlId,
+        FieldBit_CreatedFromTenantId,
+        FieldBit_CreatedFromIpHashed,
+        FieldBit_Verified,
+        FieldBit_LoginId,
+        FieldBit_LoginIdDate,
+        FieldBit_LoginCount,
+        FieldBit_OptedInNotifications,
+        FieldBit_OptedInTenantNotifications,
+        FieldBit_HideAccountCode,
+        FieldBit_AvatarSrc,
+        FieldBit_IsFastCommentsHelpRequestAdmin,
+        FieldBit_IsHelpRequestAdmin,
+        FieldBit_IsAccountOwner,
+        FieldBit_IsAdminAdmin,
+        FieldBit_IsBillingAdmin,
+        FieldBit_IsAnalyticsAdmin,
+        FieldBit_IsCustomizationAdmin,
+        FieldBit_IsManageDataAdmin,
+        FieldBit_IsCommentModeratorAdmin,
+        FieldBit_IsAPIAdmin,
+        FieldBit_IsSiteAdmin,
+        FieldBit_ModeratorIds,
+        FieldBit_IsImpersonator,
+        FieldBit_IsCouponManager,
+        FieldBit_Locale,
+        FieldBit_DigestEmailFrequency,
+        FieldBit_NotificationFrequency,
+        FieldBit_AdminNotificationFrequency,
+        FieldBit_AgentApprovalNotificationFrequency,
+        FieldBit_LastTenantNotificationSentDate,
+        FieldBit_LastReplyNotificationSentDate,
+        FieldBit_IgnoredAddToMySiteMessages,
+        FieldBit_LastLoginDate,
+        FieldBit_DisplayLabel,
+        FieldBit_IsProfileActivityPrivate,
+        FieldBit_IsProfileCommentsPrivate,
+        FieldBit_IsProfileDMDisabled,
+        FieldBit_ProfileCommentApprovalMode,
+        FieldBit_Karma,
+        FieldBit_PasswordHash,
+        FieldBit_AverageTicketAckTimeMS,
+        FieldBit_HasBlockedUsers,
+        FieldBit_Bio,
+        FieldBit_HeaderBackgroundSrc,
+        FieldBit_CountryCode,
+        FieldBit_CountryFlag,
+        FieldBit_SocialLinks,
+        FieldBit_HasTwoFactor,
+        FieldBit_IsEmailSuppressed,
+        FieldBitCount
+    };
 
     bool m_Verified;
-    bool m_VerifiedIsSet;
-
-    utility::string_t m_LoginId;
-    bool m_LoginIdIsSet;
-
-    int64_t m_LoginIdDate;
-    bool m_LoginIdDateIsSet;
-
-    int32_t m_LoginCount;
-    bool m_LoginCountIsSet;
-
     bool m_OptedInNotifications;
-    bool m_OptedInNotificationsIsSet;
-
     bool m_OptedInTenantNotifications;
-    bool m_OptedInTenantNotificationsIsSet;
-
     bool m_HideAccountCode;
-    bool m_HideAccountCodeIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
     bool m_IsFastCommentsHelpRequestAdmin;
-    bool m_IsFastCommentsHelpRequestAdminIsSet;
-
     bool m_IsHelpRequestAdmin;
-    bool m_IsHelpRequestAdminIsSet;
-
     bool m_IsAccountOwner;
-    bool m_IsAccountOwnerIsSet;
-
     bool m_IsAdminAdmin;
-    bool m_IsAdminAdminIsSet;
-
     bool m_IsBillingAdmin;
-    bool m_IsBillingAdminIsSet;
-
     bool m_IsAnalyticsAdmin;
-    bool m_IsAnalyticsAdminIsSet;
-
     bool m_IsCustomizationAdmin;
-    bool m_IsCustomizationAdminIsSet;
-
     bool m_IsManageDataAdmin;
-    bool m_IsManageDataAdminIsSet;
-
     bool m_IsCommentModeratorAdmin;
-    bool m_IsCommentModeratorAdminIsSet;
-
     bool m_IsAPIAdmin;
-    bool m_IsAPIAdminIsSet;
-
     bool m_IsSiteAdmin;
-    bool m_IsSiteAdminIsSet;
-
-    std::vector<utility::string_t> m_ModeratorIds;
-    bool m_ModeratorIdsIsSet;
-
     bool m_IsImpersonator;
-    bool m_IsImpersonatorIsSet;
-
     bool m_IsCouponManager;
-    bool m_IsCouponManagerIsSet;
-
+    bool m_IgnoredAddToMySiteMessages;
+    bool m_IsProfileActivityPrivate;
+    bool m_IsProfileCommentsPrivate;
+    bool m_IsProfileDMDisabled;
+    bool m_HasBlockedUsers;
+    bool m_HasTwoFactor;
+    bool m_IsEmailSuppressed;
+    int32_t m_LoginCount;
+    utility::string_t m__id;
+    utility::string_t m_TenantId;
+    utility::string_t m_Username;
+    utility::string_t m_DisplayName;
+    utility::string_t m_WebsiteUrl;
+    utility::string_t m_Email;
+    utility::string_t m_PendingEmail;
+    utility::string_t m_BackupEmail;
+    utility::string_t m_PendingBackupEmail;
+    int64_t m_SignUpDate;
+    utility::string_t m_CreatedFromUrlId;
+    utility::string_t m_CreatedFromTenantId;
+    utility::string_t m_CreatedFromIpHashed;
+    utility::string_t m_LoginId;
+    int64_t m_LoginIdDate;
+    utility::string_t m_AvatarSrc;
+    std::vector<utility::string_t> m_ModeratorIds;
     utility::string_t m_Locale;
-    bool m_LocaleIsSet;
-
     std::shared_ptr<DigestEmailFrequency> m_DigestEmailFrequency;
-    bool m_DigestEmailFrequencyIsSet;
-
     double m_NotificationFrequency;
-    bool m_NotificationFrequencyIsSet;
-
     double m_AdminNotificationFrequency;
-    bool m_AdminNotificationFrequencyIsSet;
-
     std::shared_ptr<ImportedAgentApprovalNotificationFrequency> m_AgentApprovalNotificationFrequency;
-    bool m_AgentApprovalNotificationFrequencyIsSet;
-
     utility::datetime m_LastTenantNotificationSentDate;
-    bool m_LastTenantNotificationSentDateIsSet;
-
     utility::datetime m_LastReplyNotificationSentDate;
-    bool m_LastReplyNotificationSentDateIsSet;
-
-    bool m_IgnoredAddToMySiteMessages;
-    bool m_IgnoredAddToMySiteMessagesIsSet;
-
     utility::datetime m_LastLoginDate;
-    bool m_LastLoginDateIsSet;
-
     utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
-
-    bool m_IsProfileActivityPrivate;
-    bool m_IsProfileActivityPrivateIsSet;
-
-    bool m_IsProfileCommentsPrivate;
-    bool m_IsProfileCommentsPrivateIsSet;
-
-    bool m_IsProfileDMDisabled;
-    bool m_IsProfileDMDisabledIsSet;
-
     double m_ProfileCommentApprovalMode;
-    bool m_ProfileCommentApprovalModeIsSet;
-
     double m_Karma;
-    bool m_KarmaIsSet;
-
     utility::string_t m_PasswordHash;
-    bool m_PasswordHashIsSet;
-
-    boost::optional<double> m_AverageTicketAckTimeMS;
-
-    bool m_HasBlockedUsers;
-    bool m_HasBlockedUsersIsSet;
-
+    double m_AverageTicketAckTimeMS;
     utility::string_t m_Bio;
-    bool m_BioIsSet;
-
     utility::string_t m_HeaderBackgroundSrc;
-    bool m_HeaderBackgroundSrcIsSet;
-
     utility::string_t m_CountryCode;
-    bool m_CountryCodeIsSet;
-
     utility::string_t m_CountryFlag;
-    bool m_CountryFlagIsSet;
-
     std::vector<utility::string_t> m_SocialLinks;
-    bool m_SocialLinksIsSet;
-
-    bool m_HasTwoFactor;
-    bool m_HasTwoFactorIsSet;
-
-    bool m_IsEmailSuppressed;
-    bool m_IsEmailSuppressedIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
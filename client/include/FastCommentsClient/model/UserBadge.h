@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UserBadge_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UserBadge_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -44,7 +44,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -151,56 +154,50 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_UserId,
+        FieldBit_BadgeId,
+        FieldBit_FromTenantId,
+        FieldBit_CreatedAt,
+        FieldBit_Type,
+        FieldBit_Threshold,
+        FieldBit_Description,
+        FieldBit_DisplayLabel,
+        FieldBit_DisplaySrc,
+        FieldBit_BackgroundColor,
+        FieldBit_BorderColor,
+        FieldBit_TextColor,
+        FieldBit_CssClass,
+        FieldBit_VeteranUserThresholdMillis,
+        FieldBit_DisplayedOnComments,
+        FieldBit_ReceivedAt,
+        FieldBit_Order,
+        FieldBit_UrlId,
+        FieldBitCount
+    };
 
+    bool m_DisplayedOnComments;
+    int32_t m_Type;
+    int32_t m_Order;
+    utility::string_t m__id;
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::string_t m_BadgeId;
-    bool m_BadgeIdIsSet;
-
     utility::string_t m_FromTenantId;
-    bool m_FromTenantIdIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
-    int32_t m_Type;
-    bool m_TypeIsSet;
-
     int64_t m_Threshold;
-    bool m_ThresholdIsSet;
-
     utility::string_t m_Description;
-    bool m_DescriptionIsSet;
-
     utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
-
-    boost::optional<utility::string_t> m_DisplaySrc;
-
-    boost::optional<utility::string_t> m_BackgroundColor;
-
-    boost::optional<utility::string_t> m_BorderColor;
-
-    boost::optional<utility::string_t> m_TextColor;
-
-    boost::optional<utility::string_t> m_CssClass;
-
+    utility::string_t m_DisplaySrc;
+    utility::string_t m_BackgroundColor;
+    utility::string_t m_BorderColor;
+    utility::string_t m_TextColor;
+    utility::string_t m_CssClass;
     int64_t m_VeteranUserThresholdMillis;
-    bool m_VeteranUserThresholdMillisIsSet;
-
-    bool m_DisplayedOnComments;
-    bool m_DisplayedOnCommentsIsSet;
-
     utility::datetime m_ReceivedAt;
-    bool m_ReceivedAtIsSet;
-
-    int32_t m_Order;
-    bool m_OrderIsSet;
-
-    boost::optional<utility::string_t> m_UrlId;
+    utility::string_t m_UrlId;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
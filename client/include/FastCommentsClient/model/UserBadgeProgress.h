@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UserBadgeProgress_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UserBadgeProgress_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -105,32 +108,30 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UserId,
+        FieldBit_FirstCommentId,
+        FieldBit_FirstCommentDate,
+        FieldBit_AutoTrustFactor,
+        FieldBit_ManualTrustFactor,
+        FieldBit_Progress,
+        FieldBit_TosAcceptedAt,
+        FieldBitCount
+    };
 
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
     utility::string_t m_UserId;
-    bool m_UserIdIsSet;
-
     utility::string_t m_FirstCommentId;
-    bool m_FirstCommentIdIsSet;
-
     utility::datetime m_FirstCommentDate;
-    bool m_FirstCommentDateIsSet;
-
     double m_AutoTrustFactor;
-    bool m_AutoTrustFactorIsSet;
-
     double m_ManualTrustFactor;
-    bool m_ManualTrustFactorIsSet;
-
     std::map<utility::string_t, double> m_Progress;
-    bool m_ProgressIsSet;
-
     utility::datetime m_TosAcceptedAt;
-    bool m_TosAcceptedAtIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
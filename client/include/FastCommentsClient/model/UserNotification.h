@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UserNotification_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -180,69 +183,60 @@ public:
 
 
 protected:
-    utility::string_t m__id;
-    bool m__idIsSet;
+    enum FieldBit
+    {
+        FieldBit__id,
+        FieldBit_TenantId,
+        FieldBit_UserId,
+        FieldBit_AnonUserId,
+        FieldBit_UrlId,
+        FieldBit_Url,
+        FieldBit_PageTitle,
+        FieldBit_RelatedObjectType,
+        FieldBit_RelatedObjectId,
+        FieldBit_Viewed,
+        FieldBit_IsUnreadMessage,
+        FieldBit_Sent,
+        FieldBit_CreatedAt,
+        FieldBit_Type,
+        FieldBit_FromCommentId,
+        FieldBit_FromVoteId,
+        FieldBit_FromUserName,
+        FieldBit_FromUserId,
+        FieldBit_FromUserAvatarSrc,
+        FieldBit_OptedOut,
+        FieldBit_Count,
+        FieldBit_RelatedIds,
+        FieldBit_FromUserIds,
+        FieldBit_FromUserNames,
+        FieldBitCount
+    };
 
+    bool m_Viewed;
+    bool m_IsUnreadMessage;
+    bool m_Sent;
+    bool m_OptedOut;
+    utility::string_t m__id;
     utility::string_t m_TenantId;
-    bool m_TenantIdIsSet;
-
-    boost::optional<utility::string_t> m_UserId;
-
-    boost::optional<utility::string_t> m_AnonUserId;
-
+    utility::string_t m_UserId;
+    utility::string_t m_AnonUserId;
     utility::string_t m_UrlId;
-    bool m_UrlIdIsSet;
-
     utility::string_t m_Url;
-    bool m_UrlIsSet;
-
-    boost::optional<utility::string_t> m_PageTitle;
-
+    utility::string_t m_PageTitle;
     std::shared_ptr<NotificationObjectType> m_RelatedObjectType;
-    bool m_RelatedObjectTypeIsSet;
-
     utility::string_t m_RelatedObjectId;
-    bool m_RelatedObjectIdIsSet;
-
-    bool m_Viewed;
-    bool m_ViewedIsSet;
-
-    bool m_IsUnreadMessage;
-    bool m_IsUnreadMessageIsSet;
-
-    bool m_Sent;
-    bool m_SentIsSet;
-
     utility::datetime m_CreatedAt;
-    bool m_CreatedAtIsSet;
-
     std::shared_ptr<NotificationType> m_Type;
-    bool m_TypeIsSet;
-
-    boost::optional<utility::string_t> m_FromCommentId;
-
-    boost::optional<utility::string_t> m_FromVoteId;
-
-    boost::optional<utility::string_t> m_FromUserName;
-
-    boost::optional<utility::string_t> m_FromUserId;
-
-    boost::optional<utility::string_t> m_FromUserAvatarSrc;
-
-    bool m_OptedOut;
-    bool m_OptedOutIsSet;
-
+    utility::string_t m_FromCommentId;
+    utility::string_t m_FromVoteId;
+    utility::string_t m_FromUserName;
+    utility::string_t m_FromUserId;
+    utility::string_t m_FromUserAvatarSrc;
     int64_t m_Count;
-    bool m_CountIsSet;
-
     std::vector<utility::string_t> m_RelatedIds;
-    bool m_RelatedIdsIsSet;
-
     std::vector<utility::string_t> m_FromUserIds;
-    bool m_FromUserIdsIsSet;
-
     std::vector<utility::string_t> m_FromUserNames;
-    bool m_FromUserNamesIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
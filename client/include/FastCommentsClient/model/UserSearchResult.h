@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UserSearchResult_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -91,19 +94,22 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Name,
+        FieldBit_DisplayName,
+        FieldBit_AvatarSrc,
+        FieldBit_Type,
+        FieldBitCount
+    };
 
+    TypeEnum m_Type;
+    utility::string_t m_Id;
     utility::string_t m_Name;
-    bool m_NameIsSet;
-
     utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
-    TypeEnum m_Type;
-    bool m_TypeIsSet;
+    utility::string_t m_AvatarSrc;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
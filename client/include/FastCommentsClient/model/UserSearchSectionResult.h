@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UserSearchSectionResult_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -48,7 +48,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -70,11 +73,16 @@ public:
 
 
 protected:
-    std::shared_ptr<UserSearchSection> m_Section;
-    bool m_SectionIsSet;
+    enum FieldBit
+    {
+        FieldBit_Section,
+        FieldBit_Users,
+        FieldBitCount
+    };
 
+    std::shared_ptr<UserSearchSection> m_Section;
     std::vector<std::shared_ptr<UserSearchResult>> m_Users;
-    bool m_UsersIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
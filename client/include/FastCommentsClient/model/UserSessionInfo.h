@@ -18,7 +18,7 @@
 #ifndef ORG_OPENAPITOOLS_CLIENT_MODEL_UserSessionInfo_H_
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_UserSessionInfo_H_
 
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -129,44 +132,40 @@ public:
 
 
 protected:
-    utility::string_t m_Id;
-    bool m_IdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Id,
+        FieldBit_Authorized,
+        FieldBit_AvatarSrc,
+        FieldBit_Badges,
+        FieldBit_DisplayLabel,
+        FieldBit_DisplayName,
+        FieldBit_Email,
+        FieldBit_GroupIds,
+        FieldBit_HasBlockedUsers,
+        FieldBit_IsAnonSession,
+        FieldBit_NeedsTOS,
+        FieldBit_SessionId,
+        FieldBit_Username,
+        FieldBit_WebsiteUrl,
+        FieldBitCount
+    };
 
     bool m_Authorized;
-    bool m_AuthorizedIsSet;
-
-    boost::optional<utility::string_t> m_AvatarSrc;
-
+    bool m_HasBlockedUsers;
+    bool m_IsAnonSession;
+    bool m_NeedsTOS;
+    utility::string_t m_Id;
+    utility::string_t m_AvatarSrc;
     std::vector<std::shared_ptr<CommentUserBadgeInfo>> m_Badges;
-    bool m_BadgesIsSet;
-
     utility::string_t m_DisplayLabel;
-    bool m_DisplayLabelIsSet;
-
     utility::string_t m_DisplayName;
-    bool m_DisplayNameIsSet;
-
-    boost::optional<utility::string_t> m_Email;
-
+    utility::string_t m_Email;
     std::vector<utility::string_t> m_GroupIds;
-    bool m_GroupIdsIsSet;
-
-    bool m_HasBlockedUsers;
-    bool m_HasBlockedUsersIsSet;
-
-    bool m_IsAnonSession;
-    bool m_IsAnonSessionIsSet;
-
-    bool m_NeedsTOS;
-    bool m_NeedsTOSIsSet;
-
-    boost::optional<utility::string_t> m_SessionId;
-
+    utility::string_t m_SessionId;
     utility::string_t m_Username;
-    bool m_UsernameIsSet;
-
     utility::string_t m_WebsiteUrl;
-    bool m_WebsiteUrlIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
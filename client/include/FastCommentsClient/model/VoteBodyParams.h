@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_VoteBodyParams_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -45,7 +45,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -86,14 +89,20 @@ public:
 
 
 protected:
-    boost::optional<utility::string_t> m_CommenterEmail;
-
-    boost::optional<utility::string_t> m_CommenterName;
+    enum FieldBit
+    {
+        FieldBit_CommenterEmail,
+        FieldBit_CommenterName,
+        FieldBit_VoteDir,
+        FieldBit_Url,
+        FieldBitCount
+    };
 
     VoteDirEnum m_VoteDir;
-    bool m_VoteDirIsSet;
-
-    boost::optional<utility::string_t> m_Url;
+    utility::string_t m_CommenterEmail;
+    utility::string_t m_CommenterName;
+    utility::string_t m_Url;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
@@ -19,7 +19,7 @@
 #define ORG_OPENAPITOOLS_CLIENT_MODEL_VoteResponse_H_
 
 #include <stdexcept>
-#include <boost/optional.hpp>
+#include <bitset>
 
 #include "FastCommentsClient/ModelBase.h"
 
@@ -47,7 +47,10 @@ public:
     void validate() override;
 
     web::json::value toJson() const override;
+    void writeJson(JsonWriter& writer) const override;
     bool fromJson(const web::json::value& json) override;
+    void writeBinary(BinaryWriter& writer) const override;
+    bool readBinary(BinaryReader& reader) override;
 
     void toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) const override;
     bool fromMultiPart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& namePrefix) override;
@@ -94,20 +97,22 @@ public:
 
 
 protected:
-    StatusEnum m_Status;
-    bool m_StatusIsSet;
-
-    utility::string_t m_VoteId;
-    bool m_VoteIdIsSet;
+    enum FieldBit
+    {
+        FieldBit_Status,
+        FieldBit_VoteId,
+        FieldBit_IsVerified,
+        FieldBit_User,
+        FieldBit_EditKey,
+        FieldBitCount
+    };
 
     bool m_IsVerified;
-    bool m_IsVerifiedIsSet;
-
+    StatusEnum m_Status;
+    utility::string_t m_VoteId;
     std::shared_ptr<VoteResponseUser> m_User;
-    bool m_UserIsSet;
-
     utility::string_t m_EditKey;
-    bool m_EditKeyIsSet;
+    std::bitset<FieldBitCount> m_FieldsSet;
 
 };
 
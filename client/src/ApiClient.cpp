@@ -13,16 +13,17 @@
 #include "FastCommentsClient/MultipartFormData.h"
 #include "FastCommentsClient/ModelBase.h"
 
+#include <charconv>
 #include <sstream>
-#include <limits>
-#include <iomanip>
 
+// Plain decimal notation, as query strings expect, with the shortest digits that
+// round-trip.
 template <typename T>
 utility::string_t toString(const T value)
 {
-  utility::ostringstream_t out;
-  out << std::setprecision(std::numeric_limits<T>::digits10) << std::fixed << value;
-  return out.str();
+  char buf[400];
+  auto result = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::fixed);
+  return utility::string_t(buf, result.ptr);
 }
 
 namespace org {
@@ -64,15 +65,11 @@ utility::string_t ApiClient::parameterToString(utility::string_t value)
 }
 utility::string_t ApiClient::parameterToString(int64_t value)
 {
-    std::stringstream valueAsStringStream;
-    valueAsStringStream << value;
-    return utility::conversions::to_string_t(valueAsStringStream.str());
+    return ModelBase::toString(value);
 }
 utility::string_t ApiClient::parameterToString(int32_t value)
 {
-    std::stringstream valueAsStringStream;
-    valueAsStringStream << value;
-    return utility::conversions::to_string_t(valueAsStringStream.str());
+    return ModelBase::toString(value);
 }
 
 utility::string_t ApiClient::parameterToString(float value)
@@ -87,7 +84,7 @@ utility::string_t ApiClient::parameterToString(double value)
 
 utility::string_t ApiClient::parameterToString(const utility::datetime &value)
 {
-    return utility::conversions::to_string_t(value.to_string(utility::datetime::ISO_8601));
+    return ModelBase::formatDateTime(value);
 }
 
 utility::string_t ApiClient::parameterToString(const ModelBase& value)
@@ -97,9 +94,7 @@ utility::string_t ApiClient::parameterToString(const ModelBase& value)
 
 utility::string_t ApiClient::parameterToString(bool value)
 {
-    std::stringstream valueAsStringStream;
-    valueAsStringStream << std::boolalpha << value;
-    return utility::conversions::to_string_t(valueAsStringStream.str());
+    return utility::conversions::to_string_t(value ? "true" : "false");
 }
 
 pplx::task<web::http::http_response> ApiClient::callApi(
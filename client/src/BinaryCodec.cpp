@@ -0,0 +1,315 @@
+/*
+ * BinaryCodec.cpp
+ *
+ * Compact tagged binary encoding of models; see BinaryCodec.h for the format.
+ */
+
+#include "FastCommentsClient/BinaryCodec.h"
+
+#include <cpprest/asyncrt_utils.h>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace model {
+
+namespace
+{
+const uint32_t kNullBlock = 0xFFFFFFFFu;
+}
+
+BinaryWriter::BinaryWriter()
+{
+    m_Buffer.reserve(256);
+}
+
+void BinaryWriter::fieldHeader( uint32_t tag, BinaryWireType wireType )
+{
+    writeFixed32(tag);
+    writeByte(static_cast<uint8_t>(wireType));
+}
+
+void BinaryWriter::writeByte( uint8_t val )
+{
+    m_Buffer.push_back(static_cast<char>(val));
+}
+
+void BinaryWriter::writeVarint( uint64_t val )
+{
+    while(val >= 0x80)
+    {
+        m_Buffer.push_back(static_cast<char>((val & 0x7f) | 0x80));
+        val >>= 7;
+    }
+    m_Buffer.push_back(static_cast<char>(val));
+}
+
+void BinaryWriter::writeSignedVarint( int64_t val )
+{
+    writeVarint((static_cast<uint64_t>(val) << 1) ^ static_cast<uint64_t>(val >> 63));
+}
+
+void BinaryWriter::writeFixed32( uint32_t val )
+{
+    char bytes[4];
+    for(int i = 0; i < 4; ++i)
+    {
+        bytes[i] = static_cast<char>(val >> (8 * i));
+    }
+    m_Buffer.append(bytes, 4);
+}
+
+void BinaryWriter::writeFixed64( uint64_t val )
+{
+    char bytes[8];
+    for(int i = 0; i < 8; ++i)
+    {
+        bytes[i] = static_cast<char>(val >> (8 * i));
+    }
+    m_Buffer.append(bytes, 8);
+}
+
+void BinaryWriter::writeString( const utility::string_t& val )
+{
+#ifdef _UTF16_STRINGS
+    const std::string utf8 = utility::conversions::to_utf8string(val);
+    writeVarint(utf8.size());
+    writeBytes(utf8.data(), utf8.size());
+#else
+    writeVarint(val.size());
+    writeBytes(val.data(), val.size());
+#endif
+}
+
+void BinaryWriter::writeBytes( const char* data, size_t length )
+{
+    m_Buffer.append(data, length);
+}
+
+size_t BinaryWriter::beginBlock()
+{
+    const size_t position = m_Buffer.size();
+    m_Buffer.append(4, '\0');
+    return position;
+}
+
+void BinaryWriter::endBlock( size_t position )
+{
+    const uint32_t length = static_cast<uint32_t>(m_Buffer.size() - position - 4);
+    for(int i = 0; i < 4; ++i)
+    {
+        m_Buffer[position + i] = static_cast<char>(length >> (8 * i));
+    }
+}
+
+void BinaryWriter::nullBlock()
+{
+    writeFixed32(kNullBlock);
+}
+
+const std::string& BinaryWriter::data() const
+{
+    return m_Buffer;
+}
+
+std::string BinaryWriter::release()
+{
+    std::string out;
+    out.swap(m_Buffer);
+    return out;
+}
+
+BinaryReader::BinaryReader()
+    : m_Pos(nullptr)
+    , m_End(nullptr)
+    , m_Ok(true)
+{
+}
+
+BinaryReader::BinaryReader( const char* data, size_t size )
+    : m_Pos(data)
+    , m_End(data + size)
+    , m_Ok(true)
+{
+}
+
+bool BinaryReader::nextField( BinaryField& field )
+{
+    if(!m_Ok || m_Pos == m_End)
+    {
+        return false;
+    }
+    uint8_t wireType = 0;
+    if(!readFixed32(field.tag) || !readByte(wireType) || wireType > static_cast<uint8_t>(BinaryWireType::Named))
+    {
+        return fail();
+    }
+    field.wireType = static_cast<BinaryWireType>(wireType);
+    return true;
+}
+
+bool BinaryReader::skip( const BinaryField& field )
+{
+    uint64_t varint = 0;
+    uint32_t fixed32 = 0;
+    uint64_t fixed64 = 0;
+    BinaryReader block;
+    bool isNull = false;
+    utility::string_t text;
+    switch(field.wireType)
+    {
+    case BinaryWireType::Varint:
+        return readVarint(varint);
+    case BinaryWireType::Fixed32:
+        return readFixed32(fixed32);
+    case BinaryWireType::Fixed64:
+        return readFixed64(fixed64);
+    case BinaryWireType::String:
+        if(!readVarint(varint) || varint > static_cast<uint64_t>(m_End - m_Pos))
+        {
+            return fail();
+        }
+        m_Pos += varint;
+        return true;
+    case BinaryWireType::Block:
+        return readBlock(block, isNull);
+    case BinaryWireType::Named:
+        return readString(text) && readString(text);
+    }
+    return fail();
+}
+
+bool BinaryReader::readByte( uint8_t& val )
+{
+    if(m_Pos == m_End)
+    {
+        return fail();
+    }
+    val = static_cast<uint8_t>(*m_Pos++);
+    return true;
+}
+
+bool BinaryReader::readVarint( uint64_t& val )
+{
+    val = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        if(m_Pos == m_End)
+        {
+            return fail();
+        }
+        const uint8_t byte = static_cast<uint8_t>(*m_Pos++);
+        val |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return fail();
+}
+
+bool BinaryReader::readSignedVarint( int64_t& val )
+{
+    uint64_t raw = 0;
+    if(!readVarint(raw))
+    {
+        return false;
+    }
+    val = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+    return true;
+}
+
+bool BinaryReader::readFixed32( uint32_t& val )
+{
+    if(m_End - m_Pos < 4)
+    {
+        return fail();
+    }
+    val = 0;
+    for(int i = 0; i < 4; ++i)
+    {
+        val |= static_cast<uint32_t>(static_cast<uint8_t>(m_Pos[i])) << (8 * i);
+    }
+    m_Pos += 4;
+    return true;
+}
+
+bool BinaryReader::readFixed64( uint64_t& val )
+{
+    if(m_End - m_Pos < 8)
+    {
+        return fail();
+    }
+    val = 0;
+    for(int i = 0; i < 8; ++i)
+    {
+        val |= static_cast<uint64_t>(static_cast<uint8_t>(m_Pos[i])) << (8 * i);
+    }
+    m_Pos += 8;
+    return true;
+}
+
+bool BinaryReader::readString( utility::string_t& val )
+{
+    uint64_t length = 0;
+    if(!readVarint(length) || length > static_cast<uint64_t>(m_End - m_Pos))
+    {
+        return fail();
+    }
+#ifdef _UTF16_STRINGS
+    val = utility::conversions::to_string_t(std::string(m_Pos, static_cast<size_t>(length)));
+#else
+    val.assign(m_Pos, static_cast<size_t>(length));
+#endif
+    m_Pos += length;
+    return true;
+}
+
+bool BinaryReader::readBlock( BinaryReader& block, bool& isNull )
+{
+    uint32_t length = 0;
+    if(!readFixed32(length))
+    {
+        return false;
+    }
+    isNull = length == kNullBlock;
+    if(isNull)
+    {
+        block = BinaryReader();
+        return true;
+    }
+    if(length > static_cast<uint64_t>(m_End - m_Pos))
+    {
+        return fail();
+    }
+    block = BinaryReader(m_Pos, length);
+    m_Pos += length;
+    return true;
+}
+
+bool BinaryReader::ok() const
+{
+    return m_Ok;
+}
+
+bool BinaryReader::atEnd() const
+{
+    return m_Pos == m_End;
+}
+
+size_t BinaryReader::remaining() const
+{
+    return static_cast<size_t>(m_End - m_Pos);
+}
+
+bool BinaryReader::fail()
+{
+    m_Ok = false;
+    m_Pos = m_End;
+    return false;
+}
+
+}
+}
+}
+}
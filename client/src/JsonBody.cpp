@@ -27,6 +27,13 @@ JsonBody::~JsonBody()
 
 void JsonBody::writeTo( std::ostream& target )
 {
+    if(m_Writer)
+    {
+        JsonWriter writer(target);
+        m_Writer(writer);
+        writer.flush();
+        return;
+    }
     m_Json.serialize(target);
 }
 
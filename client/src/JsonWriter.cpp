@@ -0,0 +1,262 @@
+/*
+ * JsonWriter.cpp
+ *
+ * Streams JSON text into a buffer without building a web::json::value tree.
+ */
+
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/ModelBase.h"
+
+#include <charconv>
+#include <cmath>
+#include <string>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace model {
+
+JsonWriter::JsonWriter()
+    : m_Sink(nullptr)
+    , m_FlushThreshold(0)
+    , m_NeedComma(false)
+    , m_AfterKey(false)
+{
+}
+
+JsonWriter::JsonWriter( std::ostream& sink, size_t flushThreshold )
+    : m_Sink(&sink)
+    , m_FlushThreshold(flushThreshold)
+    , m_NeedComma(false)
+    , m_AfterKey(false)
+{
+    m_Buffer.reserve(flushThreshold < 4096 ? flushThreshold : 4096);
+}
+
+JsonWriter::~JsonWriter()
+{
+    flush();
+}
+
+void JsonWriter::beginObject()
+{
+    beforeValue();
+    m_Buffer.push_back('{');
+    m_NeedComma = false;
+}
+
+void JsonWriter::endObject()
+{
+    m_Buffer.push_back('}');
+    m_NeedComma = true;
+    maybeFlush();
+}
+
+void JsonWriter::beginArray()
+{
+    beforeValue();
+    m_Buffer.push_back('[');
+    m_NeedComma = false;
+}
+
+void JsonWriter::endArray()
+{
+    m_Buffer.push_back(']');
+    m_NeedComma = true;
+    maybeFlush();
+}
+
+void JsonWriter::key( const utility::char_t* name )
+{
+#ifdef _UTF16_STRINGS
+    key(utility::string_t(name));
+#else
+    beforeKey();
+    writeString(name, std::char_traits<char>::length(name));
+    m_Buffer.push_back(':');
+#endif
+}
+
+void JsonWriter::key( const utility::string_t& name )
+{
+    beforeKey();
+    writeString(name);
+    m_Buffer.push_back(':');
+}
+
+void JsonWriter::null()
+{
+    beforeValue();
+    m_Buffer.append("null", 4);
+}
+
+void JsonWriter::value( bool val )
+{
+    beforeValue();
+    if(val)
+    {
+        m_Buffer.append("true", 4);
+    }
+    else
+    {
+        m_Buffer.append("false", 5);
+    }
+}
+
+void JsonWriter::value( int32_t val )
+{
+    value(static_cast<int64_t>(val));
+}
+
+void JsonWriter::value( int64_t val )
+{
+    beforeValue();
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), val);
+    m_Buffer.append(digits, result.ptr - digits);
+}
+
+void JsonWriter::value( float val )
+{
+    value(static_cast<double>(val));
+}
+
+void JsonWriter::value( double val )
+{
+    if(!std::isfinite(val))
+    {
+        // JSON has no representation for NaN or infinity.
+        null();
+        return;
+    }
+    beforeValue();
+    char digits[32];
+    auto result = std::to_chars(digits, digits + sizeof(digits), val);
+    m_Buffer.append(digits, result.ptr - digits);
+}
+
+void JsonWriter::value( const utility::char_t* val )
+{
+    value(utility::string_t(val));
+}
+
+void JsonWriter::value( const utility::string_t& val )
+{
+    beforeValue();
+    writeString(val);
+    maybeFlush();
+}
+
+void JsonWriter::value( const utility::datetime& val )
+{
+    value(ModelBase::formatDateTime(val));
+}
+
+void JsonWriter::value( const web::json::value& val )
+{
+    beforeValue();
+    m_Buffer.append(utility::conversions::to_utf8string(val.serialize()));
+    maybeFlush();
+}
+
+void JsonWriter::endLine()
+{
+    m_Buffer.push_back('\n');
+    m_NeedComma = false;
+    m_AfterKey = false;
+    maybeFlush();
+}
+
+const std::string& JsonWriter::str() const
+{
+    return m_Buffer;
+}
+
+void JsonWriter::flush()
+{
+    if(m_Sink != nullptr && !m_Buffer.empty())
+    {
+        m_Sink->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+        m_Buffer.clear();
+    }
+}
+
+void JsonWriter::beforeKey()
+{
+    if(m_NeedComma)
+    {
+        m_Buffer.push_back(',');
+    }
+    m_AfterKey = true;
+}
+
+void JsonWriter::beforeValue()
+{
+    if(m_AfterKey)
+    {
+        m_AfterKey = false;
+    }
+    else if(m_NeedComma)
+    {
+        m_Buffer.push_back(',');
+    }
+    m_NeedComma = true;
+}
+
+void JsonWriter::writeString( const char* data, size_t length )
+{
+    static const char hex[] = "0123456789abcdef";
+    m_Buffer.push_back('"');
+    size_t runStart = 0;
+    for(size_t i = 0; i < length; ++i)
+    {
+        const unsigned char c = static_cast<unsigned char>(data[i]);
+        if(c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+        m_Buffer.append(data + runStart, i - runStart);
+        runStart = i + 1;
+        m_Buffer.push_back('\\');
+        switch(c)
+        {
+        case '"': m_Buffer.push_back('"'); break;
+        case '\\': m_Buffer.push_back('\\'); break;
+        case '\b': m_Buffer.push_back('b'); break;
+        case '\f': m_Buffer.push_back('f'); break;
+        case '\n': m_Buffer.push_back('n'); break;
+        case '\r': m_Buffer.push_back('r'); break;
+        case '\t': m_Buffer.push_back('t'); break;
+        default:
+            m_Buffer.append("u00", 3);
+            m_Buffer.push_back(hex[c >> 4]);
+            m_Buffer.push_back(hex[c & 0xf]);
+            break;
+        }
+    }
+    m_Buffer.append(data + runStart, length - runStart);
+    m_Buffer.push_back('"');
+}
+
+void JsonWriter::writeString( const utility::string_t& val )
+{
+#ifdef _UTF16_STRINGS
+    const std::string utf8 = utility::conversions::to_utf8string(val);
+    writeString(utf8.data(), utf8.size());
+#else
+    writeString(val.data(), val.size());
+#endif
+}
+
+void JsonWriter::maybeFlush()
+{
+    if(m_Sink != nullptr && m_Buffer.size() >= m_FlushThreshold)
+    {
+        flush();
+    }
+}
+
+}
+}
+}
+}
@@ -11,11 +11,150 @@
 
 #include "FastCommentsClient/ModelBase.h"
 
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
 namespace org {
 namespace openapitools {
 namespace client {
 namespace model {
 
+namespace
+{
+// std::to_chars/from_chars only handle char; numbers and ISO-8601 dates are ASCII,
+// so wide strings are narrowed and widened a character at a time.
+template<typename T>
+utility::string_t formatNumber( T val )
+{
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), val);
+    return utility::string_t(buf, result.ptr);
+}
+
+template<typename T>
+bool parseNumber( const utility::string_t& val, T& outVal )
+{
+    size_t begin = 0;
+    size_t end = val.size();
+    while(begin < end && val[begin] == ' ')
+    {
+        ++begin;
+    }
+    while(end > begin && val[end - 1] == ' ')
+    {
+        --end;
+    }
+    if(begin + 1 < end && val[begin] == '+')
+    {
+        ++begin;
+    }
+    char narrow[64];
+    const char* first = nullptr;
+    if(std::is_same<utility::char_t, char>::value)
+    {
+        first = reinterpret_cast<const char*>(val.data()) + begin;
+    }
+    else
+    {
+        if(end - begin > sizeof(narrow))
+        {
+            return false;
+        }
+        for(size_t i = begin; i < end; ++i)
+        {
+            narrow[i - begin] = static_cast<char>(val[i]);
+        }
+        first = narrow;
+    }
+    const char* last = first + (end - begin);
+    T parsed{};
+    auto result = std::from_chars(first, last, parsed);
+    if(result.ec != std::errc() || result.ptr != last)
+    {
+        return false;
+    }
+    outVal = parsed;
+    return true;
+}
+
+// utility::datetime counts 100ns ticks since 1601-01-01T00:00:00Z.
+const int64_t kTicksPerSecond = 10000000;
+const int64_t kSecondsFrom1601To1970 = 11644473600LL;
+
+// Days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant's days_from_civil).
+int64_t daysFromCivil( int64_t y, unsigned m, unsigned d )
+{
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+void civilFromDays( int64_t z, int64_t& y, unsigned& m, unsigned& d )
+{
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = static_cast<int64_t>(yoe) + era * 400 + (m <= 2);
+}
+
+unsigned daysInMonth( int64_t y, unsigned m )
+{
+    static const unsigned days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    const bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return m == 2 && leap ? 29 : days[m - 1];
+}
+
+// Reads exactly `count` digits at `pos`.
+bool readDigits( const utility::string_t& val, size_t& pos, size_t count, unsigned& outVal )
+{
+    if(pos + count > val.size())
+    {
+        return false;
+    }
+    unsigned result = 0;
+    for(size_t end = pos + count; pos < end; ++pos)
+    {
+        const utility::char_t c = val[pos];
+        if(c < '0' || c > '9')
+        {
+            return false;
+        }
+        result = result * 10 + static_cast<unsigned>(c - '0');
+    }
+    outVal = result;
+    return true;
+}
+
+bool readChar( const utility::string_t& val, size_t& pos, utility::char_t expected )
+{
+    if(pos < val.size() && val[pos] == expected)
+    {
+        ++pos;
+        return true;
+    }
+    return false;
+}
+
+void writeDigits( char*& out, unsigned val, int count )
+{
+    for(int i = count - 1; i >= 0; --i)
+    {
+        out[i] = static_cast<char>('0' + val % 10);
+        val /= 10;
+    }
+    out += count;
+}
+}
+
 ModelBase::ModelBase(): m_IsSet(false)
 {
 }
@@ -26,45 +165,159 @@ bool ModelBase::isSet() const
 {
     return m_IsSet;
 }
+bool ModelBase::parseDateTime( const utility::string_t& val, utility::datetime& outVal )
+{
+    size_t pos = 0;
+    unsigned year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    if(!readDigits(val, pos, 4, year) || !readChar(val, pos, '-') || !readDigits(val, pos, 2, month)
+        || !readChar(val, pos, '-') || !readDigits(val, pos, 2, day)
+        || month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month))
+    {
+        return false;
+    }
+    int64_t fraction = 0;
+    int64_t offset = 0;
+    if(readChar(val, pos, 'T') || readChar(val, pos, 't') || readChar(val, pos, ' '))
+    {
+        if(!readDigits(val, pos, 2, hour) || !readChar(val, pos, ':') || !readDigits(val, pos, 2, minute)
+            || hour > 23 || minute > 59)
+        {
+            return false;
+        }
+        if(readChar(val, pos, ':'))
+        {
+            // 60 is a leap second; the tick count has no room for it, so it folds into 59.
+            if(!readDigits(val, pos, 2, second) || second > 60)
+            {
+                return false;
+            }
+            second = second == 60 ? 59 : second;
+            if(readChar(val, pos, '.') || readChar(val, pos, ','))
+            {
+                int64_t scale = kTicksPerSecond;
+                size_t digits = 0;
+                for(; pos < val.size() && val[pos] >= '0' && val[pos] <= '9'; ++pos, ++digits)
+                {
+                    if(scale > 1)
+                    {
+                        scale /= 10;
+                        fraction += (val[pos] - '0') * scale;
+                    }
+                }
+                if(digits == 0)
+                {
+                    return false;
+                }
+            }
+        }
+        const bool utc = readChar(val, pos, 'Z') || readChar(val, pos, 'z');
+        if(!utc && pos < val.size() && (val[pos] == '+' || val[pos] == '-'))
+        {
+            const int64_t sign = val[pos++] == '+' ? 1 : -1;
+            unsigned offsetHours = 0, offsetMinutes = 0;
+            if(!readDigits(val, pos, 2, offsetHours))
+            {
+                return false;
+            }
+            readChar(val, pos, ':');
+            if(pos < val.size() && !readDigits(val, pos, 2, offsetMinutes))
+            {
+                return false;
+            }
+            if(offsetHours > 23 || offsetMinutes > 59)
+            {
+                return false;
+            }
+            offset = sign * (offsetHours * 3600 + offsetMinutes * 60);
+        }
+    }
+    if(pos != val.size())
+    {
+        return false;
+    }
+    const int64_t seconds = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset
+        + kSecondsFrom1601To1970;
+    if(seconds < 0)
+    {
+        return false;
+    }
+    outVal = utility::datetime() + static_cast<utility::datetime::interval_type>(seconds * kTicksPerSecond + fraction);
+    return true;
+}
+utility::string_t ModelBase::formatDateTime( const utility::datetime& val )
+{
+    const int64_t ticks = static_cast<int64_t>(val.to_interval());
+    const int64_t seconds = ticks / kTicksPerSecond - kSecondsFrom1601To1970;
+    int64_t fraction = ticks % kTicksPerSecond;
+    int64_t days = seconds / 86400;
+    int64_t secondOfDay = seconds % 86400;
+    if(secondOfDay < 0)
+    {
+        secondOfDay += 86400;
+        --days;
+    }
+    int64_t year = 0;
+    unsigned month = 0, day = 0;
+    civilFromDays(days, year, month, day);
+
+    char buf[32];
+    char* out = buf;
+    writeDigits(out, static_cast<unsigned>(year), 4);
+    *out++ = '-';
+    writeDigits(out, month, 2);
+    *out++ = '-';
+    writeDigits(out, day, 2);
+    *out++ = 'T';
+    writeDigits(out, static_cast<unsigned>(secondOfDay / 3600), 2);
+    *out++ = ':';
+    writeDigits(out, static_cast<unsigned>(secondOfDay / 60 % 60), 2);
+    *out++ = ':';
+    writeDigits(out, static_cast<unsigned>(secondOfDay % 60), 2);
+    if(fraction != 0)
+    {
+        int digits = 7;
+        while(fraction % 10 == 0)
+        {
+            fraction /= 10;
+            --digits;
+        }
+        *out++ = '.';
+        writeDigits(out, static_cast<unsigned>(fraction), digits);
+    }
+    *out++ = 'Z';
+    return utility::string_t(buf, out);
+}
 utility::string_t ModelBase::toString( const bool val )
 {
-    utility::stringstream_t ss;
-    ss << val;
-    return utility::string_t(ss.str());
+    return utility::string_t(1, val ? '1' : '0');
 }
 utility::string_t ModelBase::toString( const float val )
 {
-    utility::stringstream_t ss;
-    ss << val;
-    return utility::string_t(ss.str());
+    return formatNumber(val);
 }
 utility::string_t ModelBase::toString( const double val )
 {
-    utility::stringstream_t ss;
-    ss << val;
-    return utility::string_t(ss.str());
+    return formatNumber(val);
 }
 utility::string_t ModelBase::toString( const int32_t val )
 {
-    utility::stringstream_t ss;
-    ss << val;
-    return utility::string_t(ss.str());
+    return formatNumber(val);
 }
 utility::string_t ModelBase::toString( const int64_t val )
 {
-    utility::stringstream_t ss;
-    ss << val;
-    return utility::string_t(ss.str());
+    return formatNumber(val);
 }
 utility::string_t ModelBase::toString (const utility::string_t &val )
 {
-    utility::stringstream_t ss;
-    ss << val;
-    return utility::string_t(ss.str());
+    return val;
+}
+utility::string_t ModelBase::toString( const InternedString &val )
+{
+    return val.str();
 }
 utility::string_t ModelBase::toString( const utility::datetime &val )
 {
-    return val.to_string(utility::datetime::ISO_8601);
+    return formatDateTime(val);
 }
 utility::string_t ModelBase::toString( const web::json::value &val )
 {
@@ -103,9 +356,13 @@ web::json::value ModelBase::toJson( const utility::string_t& value )
 {
     return web::json::value::string(value);
 }
+web::json::value ModelBase::toJson( const InternedString& value )
+{
+    return web::json::value::string(value.str());
+}
 web::json::value ModelBase::toJson( const utility::datetime& value )
 {
-    return web::json::value::string(value.to_string(utility::datetime::ISO_8601));
+    return web::json::value::string(formatDateTime(value));
 }
 web::json::value ModelBase::toJson( const web::json::value& value )
 {
@@ -132,85 +389,325 @@ web::json::value ModelBase::toJson( const std::shared_ptr<utility::datetime>& va
     }
     return retVal;
 }
-bool ModelBase::fromString( const utility::string_t& val, bool &outVal )
+void ModelBase::writeJson( JsonWriter& writer ) const
 {
-    utility::stringstream_t ss(val);
-    bool success = true;
-    try
+    writer.value(toJson());
+}
+void ModelBase::writeJson( JsonWriter& writer, bool value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, float value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, double value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, int32_t value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, int64_t value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, const utility::string_t& value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, const InternedString& value )
+{
+    writer.value(value.str());
+}
+void ModelBase::writeJson( JsonWriter& writer, const utility::datetime& value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, const web::json::value& value )
+{
+    writer.value(value);
+}
+void ModelBase::writeJson( JsonWriter& writer, const std::shared_ptr<HttpContent>& content )
+{
+    writer.value(toJson(content));
+}
+void ModelBase::writeJson( JsonWriter& writer, const std::shared_ptr<utility::datetime>& val )
+{
+    if(val != nullptr)
     {
-        ss >> outVal;
+        writer.value(*val);
     }
-    catch (...)
+    else
     {
-        success = false;
+        writer.null();
     }
-    return success;
 }
-bool ModelBase::fromString( const utility::string_t& val, float &outVal )
+void ModelBase::writeBinary( BinaryWriter& writer ) const
 {
-    utility::stringstream_t ss(val);
-    bool success = true;
-    try
-    {
-        ss >> outVal;
-    }
-    catch (...)
+    writeBinary(writer, 0, toJson());
+}
+bool ModelBase::readBinary( BinaryReader& reader )
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        int64_t intVal = 0;
-        success = ModelBase::fromString(val, intVal);
-        if(success)
+        if(field.tag == 0 && field.wireType == BinaryWireType::String)
         {
-            outVal = static_cast<float>(intVal);
+            web::json::value json;
+            ok &= readBinaryValue(reader, json) && fromJson(json);
+            continue;
         }
+        reader.skip(field);
     }
-    return success;
+    return ok && reader.ok();
 }
-bool ModelBase::fromString( const utility::string_t& val, double &outVal )
+std::string ModelBase::toBinary() const
 {
-    utility::stringstream_t ss(val);
-    bool success = true;
-    try
+    BinaryWriter writer;
+    writer.writeByte(kBinaryMagic);
+    writer.writeByte(kBinaryFormatVersion);
+    writeBinary(writer);
+    return writer.release();
+}
+bool ModelBase::fromBinary( const std::string& data )
+{
+    return fromBinary(data.data(), data.size());
+}
+bool ModelBase::fromBinary( const char* data, size_t size )
+{
+    BinaryReader reader(data, size);
+    uint8_t magic = 0;
+    uint8_t version = 0;
+    if(!reader.readByte(magic) || !reader.readByte(version) || magic != kBinaryMagic || version != kBinaryFormatVersion)
     {
-        ss >> outVal;
+        return false;
     }
-    catch (...)
+    return readBinary(reader);
+}
+BinaryWireType ModelBase::binaryWireType( bool )
+{
+    return BinaryWireType::Varint;
+}
+BinaryWireType ModelBase::binaryWireType( float )
+{
+    return BinaryWireType::Fixed32;
+}
+BinaryWireType ModelBase::binaryWireType( double )
+{
+    return BinaryWireType::Fixed64;
+}
+BinaryWireType ModelBase::binaryWireType( int32_t )
+{
+    return BinaryWireType::Varint;
+}
+BinaryWireType ModelBase::binaryWireType( int64_t )
+{
+    return BinaryWireType::Varint;
+}
+BinaryWireType ModelBase::binaryWireType( const utility::string_t& )
+{
+    return BinaryWireType::String;
+}
+BinaryWireType ModelBase::binaryWireType( const InternedString& )
+{
+    return BinaryWireType::String;
+}
+BinaryWireType ModelBase::binaryWireType( const utility::datetime& )
+{
+    return BinaryWireType::Varint;
+}
+BinaryWireType ModelBase::binaryWireType( const web::json::value& )
+{
+    return BinaryWireType::String;
+}
+BinaryWireType ModelBase::binaryWireType( const std::shared_ptr<HttpContent>& )
+{
+    return BinaryWireType::String;
+}
+BinaryWireType ModelBase::binaryWireType( const std::shared_ptr<utility::datetime>& )
+{
+    return BinaryWireType::Varint;
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, bool value )
+{
+    writer.writeVarint(value ? 1 : 0);
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, float value )
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writer.writeFixed32(bits);
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, double value )
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writer.writeFixed64(bits);
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, int32_t value )
+{
+    writer.writeSignedVarint(value);
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, int64_t value )
+{
+    writer.writeSignedVarint(value);
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const utility::string_t& value )
+{
+    writer.writeString(value);
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const InternedString& value )
+{
+    writer.writeString(value.str());
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const utility::datetime& value )
+{
+    writer.writeVarint(value.to_interval());
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const web::json::value& value )
+{
+    writer.writeString(value.serialize());
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const std::shared_ptr<HttpContent>& value )
+{
+    writer.writeString(toJson(value).serialize());
+}
+void ModelBase::writeBinaryValue( BinaryWriter& writer, const std::shared_ptr<utility::datetime>& value )
+{
+    writer.writeVarint(value != nullptr ? value->to_interval() : 0);
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, bool& value )
+{
+    uint64_t raw = 0;
+    if(!reader.readVarint(raw))
     {
-        int64_t intVal = 0;
-        success = ModelBase::fromString(val, intVal);
-        if(success)
-        {
-            outVal = static_cast<double>(intVal);
-        }
+        return false;
     }
-    return success;
+    value = raw != 0;
+    return true;
 }
-bool ModelBase::fromString( const utility::string_t& val, int32_t &outVal )
+bool ModelBase::readBinaryValue( BinaryReader& reader, float& value )
 {
-    utility::stringstream_t ss(val);
-    bool success = true;
-    try
+    uint32_t bits = 0;
+    if(!reader.readFixed32(bits))
     {
-        ss >> outVal;
+        return false;
     }
-    catch (...)
+    std::memcpy(&value, &bits, sizeof(bits));
+    return true;
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, double& value )
+{
+    uint64_t bits = 0;
+    if(!reader.readFixed64(bits))
     {
-        success = false;
+        return false;
     }
-    return success;
+    std::memcpy(&value, &bits, sizeof(bits));
+    return true;
 }
-bool ModelBase::fromString( const utility::string_t& val, int64_t &outVal )
+bool ModelBase::readBinaryValue( BinaryReader& reader, int32_t& value )
 {
-    utility::stringstream_t ss(val);
-    bool success = true;
+    int64_t raw = 0;
+    if(!reader.readSignedVarint(raw))
+    {
+        return false;
+    }
+    value = static_cast<int32_t>(raw);
+    return true;
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, int64_t& value )
+{
+    return reader.readSignedVarint(value);
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, utility::string_t& value )
+{
+    return reader.readString(value);
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, InternedString& value )
+{
+    utility::string_t text;
+    if(!reader.readString(text))
+    {
+        return false;
+    }
+    value = StringInternTable::current().intern(text);
+    return true;
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, utility::datetime& value )
+{
+    uint64_t interval = 0;
+    if(!reader.readVarint(interval))
+    {
+        return false;
+    }
+    value = utility::datetime() + interval;
+    return true;
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, web::json::value& value )
+{
+    utility::string_t text;
+    if(!reader.readString(text))
+    {
+        return false;
+    }
     try
     {
-        ss >> outVal;
+        value = web::json::value::parse(text);
     }
     catch (...)
     {
-        success = false;
+        return false;
     }
-    return success;
+    return true;
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, std::shared_ptr<HttpContent>& value )
+{
+    web::json::value json;
+    return readBinaryValue(reader, json) && fromJson(json, value);
+}
+bool ModelBase::readBinaryValue( BinaryReader& reader, std::shared_ptr<utility::datetime>& value )
+{
+    uint64_t interval = 0;
+    if(!reader.readVarint(interval))
+    {
+        return false;
+    }
+    value = std::make_shared<utility::datetime>(utility::datetime() + interval);
+    return true;
+}
+bool ModelBase::fromString( const utility::string_t& val, bool &outVal )
+{
+    if(val == utility::conversions::to_string_t("true") || val == utility::conversions::to_string_t("1"))
+    {
+        outVal = true;
+        return true;
+    }
+    if(val == utility::conversions::to_string_t("false") || val == utility::conversions::to_string_t("0"))
+    {
+        outVal = false;
+        return true;
+    }
+    return false;
+}
+bool ModelBase::fromString( const utility::string_t& val, float &outVal )
+{
+    return parseNumber(val, outVal);
+}
+bool ModelBase::fromString( const utility::string_t& val, double &outVal )
+{
+    return parseNumber(val, outVal);
+}
+bool ModelBase::fromString( const utility::string_t& val, int32_t &outVal )
+{
+    return parseNumber(val, outVal);
+}
+bool ModelBase::fromString( const utility::string_t& val, int64_t &outVal )
+{
+    return parseNumber(val, outVal);
 }
 bool ModelBase::fromString( const utility::string_t& val, utility::string_t &outVal )
 {
@@ -228,17 +725,7 @@ bool ModelBase::fromString( const utility::string_t& val, utility::string_t &out
 }
 bool ModelBase::fromString( const utility::string_t& val, utility::datetime &outVal )
 {
-    bool success = true;
-    auto dt = utility::datetime::from_string(val, utility::datetime::ISO_8601);
-    if( dt.is_initialized() )
-    {
-        outVal = dt;
-    }
-    else
-    {
-        success = false;
-    }
-    return success;
+    return parseDateTime(val, outVal);
 }
 bool ModelBase::fromString( const utility::string_t& val, web::json::value &outVal )
 {
@@ -305,10 +792,20 @@ bool ModelBase::fromJson( const web::json::value& val, utility::string_t & outVa
     outVal = val.is_string() ? val.as_string() : utility::conversions::to_string_t("");
     return val.is_string();
 }
+bool ModelBase::fromJson( const web::json::value& val, InternedString & outVal )
+{
+    // Looked up in place, so a repeated value costs no allocation.
+    outVal = val.is_string() ? StringInternTable::current().intern(val.as_string()) : InternedString();
+    return val.is_string();
+}
 bool ModelBase::fromJson( const web::json::value& val, utility::datetime & outVal )
 {
-    outVal = val.is_null() ? utility::datetime::from_string(utility::conversions::to_string_t("NULL"), utility::datetime::ISO_8601) : utility::datetime::from_string(val.as_string(), utility::datetime::ISO_8601);
-    return outVal.is_initialized();
+    if(!val.is_string() || !parseDateTime(val.as_string(), outVal))
+    {
+        outVal = utility::datetime();
+        return false;
+    }
+    return true;
 }
 bool ModelBase::fromJson( const web::json::value& val, web::json::value & outVal )
 {
@@ -429,13 +926,17 @@ std::shared_ptr<HttpContent> ModelBase::toHttpContent( const utility::string_t&
     content->setData( std::shared_ptr<std::istream>( new std::stringstream( utility::conversions::to_utf8string(value) ) ) );
     return content;
 }
+std::shared_ptr<HttpContent> ModelBase::toHttpContent( const utility::string_t& name, const InternedString& value, const utility::string_t& contentType)
+{
+    return toHttpContent(name, value.str(), contentType);
+}
 std::shared_ptr<HttpContent> ModelBase::toHttpContent( const utility::string_t& name, const utility::datetime& value, const utility::string_t& contentType )
 {
     std::shared_ptr<HttpContent> content( new HttpContent );
     content->setName( name );
     content->setContentDisposition( utility::conversions::to_string_t("form-data") );
     content->setContentType( contentType );
-    content->setData( std::shared_ptr<std::istream>( new std::stringstream( utility::conversions::to_utf8string(value.to_string(utility::datetime::ISO_8601) ) ) ) );
+    content->setData( std::shared_ptr<std::istream>( new std::stringstream( utility::conversions::to_utf8string(formatDateTime(value) ) ) ) );
     return content;
 }
 std::shared_ptr<HttpContent> ModelBase::toHttpContent( const utility::string_t& name, const web::json::value& value, const utility::string_t& contentType )
@@ -523,8 +1024,7 @@ bool ModelBase::fromHttpContent(std::shared_ptr<HttpContent> val, utility::datet
     utility::string_t str;
     if( val == nullptr ) return  false;
     ModelBase::fromHttpContent(val, str);
-    outVal =  utility::datetime::from_string(str, utility::datetime::ISO_8601);
-    return true;
+    return parseDateTime(str, outVal);
 }
 bool  ModelBase::fromHttpContent(std::shared_ptr<HttpContent> val, web::json::value & outVal )
 {
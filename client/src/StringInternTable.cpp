@@ -0,0 +1,183 @@
+/*
+ * StringInternTable.cpp
+ *
+ * Shared storage for string values that repeat across the models of a response.
+ */
+
+#include "FastCommentsClient/StringInternTable.h"
+
+#include <functional>
+#include <utility>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace model {
+
+namespace
+{
+const utility::string_t& emptyString()
+{
+    static const utility::string_t empty;
+    return empty;
+}
+
+thread_local StringInternTable* t_CurrentTable = nullptr;
+
+// Each stripe prunes itself whenever it has grown this much since the last
+// prune, so models that were decoded and dropped don't keep their strings alive.
+const size_t kMinPruneSize = 64;
+}
+
+InternedString::InternedString()
+{
+}
+
+InternedString::InternedString( const utility::string_t& value )
+{
+    if(!value.empty())
+    {
+        m_Value = std::make_shared<const utility::string_t>(value);
+    }
+}
+
+InternedString::InternedString( utility::string_t&& value )
+{
+    if(!value.empty())
+    {
+        m_Value = std::make_shared<const utility::string_t>(std::move(value));
+    }
+}
+
+InternedString::InternedString( std::shared_ptr<const utility::string_t> value )
+    : m_Value(std::move(value))
+{
+}
+
+const utility::string_t& InternedString::str() const
+{
+    return m_Value != nullptr ? *m_Value : emptyString();
+}
+
+InternedString::operator const utility::string_t&() const
+{
+    return str();
+}
+
+bool InternedString::empty() const
+{
+    return m_Value == nullptr || m_Value->empty();
+}
+
+bool InternedString::sharesStorageWith( const InternedString& other ) const
+{
+    return m_Value != nullptr && m_Value == other.m_Value;
+}
+
+bool operator==( const InternedString& a, const InternedString& b )
+{
+    return a.sharesStorageWith(b) || a.str() == b.str();
+}
+
+bool operator!=( const InternedString& a, const InternedString& b )
+{
+    return !(a == b);
+}
+
+StringInternTable::Stripe::Stripe()
+    : pruneAt(kMinPruneSize)
+{
+}
+
+StringInternTable::StringInternTable()
+{
+}
+
+InternedString StringInternTable::intern( const utility::string_t& value )
+{
+    if(value.empty())
+    {
+        return InternedString();
+    }
+    const std::basic_string_view<utility::char_t> key(value);
+    Stripe& stripe = m_Stripes[std::hash<std::basic_string_view<utility::char_t>>()(key) % kStripes];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    auto it = stripe.entries.find(key);
+    if(it != stripe.entries.end())
+    {
+        return InternedString(it->second);
+    }
+    if(stripe.entries.size() >= stripe.pruneAt)
+    {
+        pruneLocked(stripe);
+    }
+    auto stored = std::make_shared<const utility::string_t>(value);
+    stripe.entries.emplace(std::basic_string_view<utility::char_t>(*stored), stored);
+    return InternedString(stored);
+}
+
+void StringInternTable::prune()
+{
+    for(auto& stripe : m_Stripes)
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        pruneLocked(stripe);
+    }
+}
+
+void StringInternTable::pruneLocked( Stripe& stripe )
+{
+    for(auto entry = stripe.entries.begin(); entry != stripe.entries.end();)
+    {
+        entry = entry->second.use_count() == 1 ? stripe.entries.erase(entry) : std::next(entry);
+    }
+    stripe.pruneAt = stripe.entries.size() * 2 > kMinPruneSize ? stripe.entries.size() * 2 : kMinPruneSize;
+}
+
+void StringInternTable::clear()
+{
+    for(auto& stripe : m_Stripes)
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        stripe.entries.clear();
+        stripe.pruneAt = kMinPruneSize;
+    }
+}
+
+size_t StringInternTable::size() const
+{
+    size_t size = 0;
+    for(const auto& stripe : m_Stripes)
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        size += stripe.entries.size();
+    }
+    return size;
+}
+
+StringInternTable& StringInternTable::current()
+{
+    return t_CurrentTable != nullptr ? *t_CurrentTable : shared();
+}
+
+StringInternTable& StringInternTable::shared()
+{
+    static StringInternTable table;
+    return table;
+}
+
+StringInternTable::Scope::Scope( StringInternTable& table )
+    : m_Previous(t_CurrentTable)
+{
+    t_CurrentTable = &table;
+}
+
+StringInternTable::Scope::~Scope()
+{
+    t_CurrentTable = m_Previous;
+}
+
+}
+}
+}
+}
@@ -20,22 +20,6 @@ namespace model {
 
 APIAuditLog::APIAuditLog()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_Username = utility::conversions::to_string_t("");
-    m_UsernameIsSet = false;
-    m_ResourceName = utility::conversions::to_string_t("");
-    m_ResourceNameIsSet = false;
-    m_CrudTypeIsSet = false;
-    m_FromIsSet = false;
-    m_When = utility::datetime();
-    m_WhenIsSet = false;
-    m_Description = utility::conversions::to_string_t("");
-    m_DescriptionIsSet = false;
-    m_ServerStartDate = utility::datetime();
-    m_ServerStartDateIsSet = false;
 }
 
 APIAuditLog::~APIAuditLog()
@@ -50,212 +34,535 @@ void APIAuditLog::validate()
 web::json::value APIAuditLog::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_ResourceNameIsSet)
+    if(m_FieldsSet.test(FieldBit_ResourceName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("resourceName"))] = ModelBase::toJson(m_ResourceName);
     }
-    if(m_CrudTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_CrudType))
     {
         
         utility::string_t refVal = fromCrudTypeEnum(m_CrudType);
         val[utility::conversions::to_string_t(_XPLATSTR("crudType"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_FromIsSet)
+    if(m_FieldsSet.test(FieldBit_From))
     {
         
         utility::string_t refVal = fromFromEnum(m_From);
         val[utility::conversions::to_string_t(_XPLATSTR("from"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_Url.has_value())
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_Ip.has_value())
+    if(m_FieldsSet.test(FieldBit_Ip))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("ip"))] = ModelBase::toJson(m_Ip.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("ip"))] = ModelBase::toJson(m_Ip);
     }
-    if(m_WhenIsSet)
+    if(m_FieldsSet.test(FieldBit_When))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("when"))] = ModelBase::toJson(m_When);
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("description"))] = ModelBase::toJson(m_Description);
     }
-    if(m_ServerStartDateIsSet)
+    if(m_FieldsSet.test(FieldBit_ServerStartDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("serverStartDate"))] = ModelBase::toJson(m_ServerStartDate);
     }
-    if(m_ObjectDetails.has_value())
+    if(m_FieldsSet.test(FieldBit_ObjectDetails))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("objectDetails"))] = ModelBase::toJson(m_ObjectDetails.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("objectDetails"))] = ModelBase::toJson(m_ObjectDetails);
     }
 
     return val;
 }
 
+void APIAuditLog::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_ResourceName))
+    {
+        
+        writer.key(_XPLATSTR("resourceName"));
+        ModelBase::writeJson(writer, m_ResourceName);
+    }
+    if(m_FieldsSet.test(FieldBit_CrudType))
+    {
+        
+        utility::string_t refVal = fromCrudTypeEnum(m_CrudType);
+        writer.key(_XPLATSTR("crudType"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_From))
+    {
+        
+        utility::string_t refVal = fromFromEnum(m_From);
+        writer.key(_XPLATSTR("from"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_Ip))
+    {
+        
+        writer.key(_XPLATSTR("ip"));
+        ModelBase::writeJson(writer, m_Ip);
+    }
+    if(m_FieldsSet.test(FieldBit_When))
+    {
+        
+        writer.key(_XPLATSTR("when"));
+        ModelBase::writeJson(writer, m_When);
+    }
+    if(m_FieldsSet.test(FieldBit_Description))
+    {
+        
+        writer.key(_XPLATSTR("description"));
+        ModelBase::writeJson(writer, m_Description);
+    }
+    if(m_FieldsSet.test(FieldBit_ServerStartDate))
+    {
+        
+        writer.key(_XPLATSTR("serverStartDate"));
+        ModelBase::writeJson(writer, m_ServerStartDate);
+    }
+    if(m_FieldsSet.test(FieldBit_ObjectDetails))
+    {
+        
+        writer.key(_XPLATSTR("objectDetails"));
+        ModelBase::writeJson(writer, m_ObjectDetails);
+    }
+
+    writer.endObject();
+}
+
 bool APIAuditLog::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("resourceName")):
+            if(field.first == _XPLATSTR("resourceName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setResourceName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setResourceName);
+                    setResourceName(refVal_setResourceName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("crudType")):
+            if(field.first == _XPLATSTR("crudType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCrudType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCrudType);
+                    setCrudType(toCrudTypeEnum(refVal_setCrudType));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("from")):
+            if(field.first == _XPLATSTR("from"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFrom;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFrom);
+                    setFrom(toFromEnum(refVal_setFrom));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ip")):
+            if(field.first == _XPLATSTR("ip"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setIp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIp);
+                    setIp(refVal_setIp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("when")):
+            if(field.first == _XPLATSTR("when"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setWhen;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWhen);
+                    setWhen(refVal_setWhen);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            if(field.first == _XPLATSTR("description"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDescription;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
+                    setDescription(refVal_setDescription);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("serverStartDate")):
+            if(field.first == _XPLATSTR("serverStartDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setServerStartDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setServerStartDate);
+                    setServerStartDate(refVal_setServerStartDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("objectDetails")):
+            if(field.first == _XPLATSTR("objectDetails"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setObjectDetails;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setObjectDetails);
+                    setObjectDetails(refVal_setObjectDetails);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    return ok;
+}
+
+void APIAuditLog::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("resourceName"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("resourceName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setResourceName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setResourceName);
-            setResourceName(refVal_setResourceName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("crudType"))))
+    if(m_FieldsSet.test(FieldBit_Username))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("crudType")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCrudType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCrudType);
-            
-            setCrudType(toCrudTypeEnum(refVal_setCrudType));
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("from"))))
+    if(m_FieldsSet.test(FieldBit_ResourceName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("from")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFrom;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFrom);
-            
-            setFrom(toFromEnum(refVal_setFrom));
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("resourceName")), m_ResourceName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_CrudType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        utility::string_t refVal = fromCrudTypeEnum(m_CrudType);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("crudType")), refVal);
+        
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ip"))))
+    if(m_FieldsSet.test(FieldBit_From))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ip")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setIp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIp);
-            setIp(refVal_setIp);
-            
-        }
+        
+        utility::string_t refVal = fromFromEnum(m_From);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("from")), refVal);
+        
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("when"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("when")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setWhen;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWhen);
-            setWhen(refVal_setWhen);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("description"))))
+    if(m_FieldsSet.test(FieldBit_Ip))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("description")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDescription;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
-            setDescription(refVal_setDescription);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ip")), m_Ip);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("serverStartDate"))))
+    if(m_FieldsSet.test(FieldBit_When))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("serverStartDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setServerStartDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setServerStartDate);
-            setServerStartDate(refVal_setServerStartDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("when")), m_When);
+    }
+    if(m_FieldsSet.test(FieldBit_Description))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("description")), m_Description);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("objectDetails"))))
+    if(m_FieldsSet.test(FieldBit_ServerStartDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("objectDetails")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("serverStartDate")), m_ServerStartDate);
+    }
+    if(m_FieldsSet.test(FieldBit_ObjectDetails))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("objectDetails")), m_ObjectDetails);
+    }
+}
+
+bool APIAuditLog::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setObjectDetails;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setObjectDetails);
-            setObjectDetails(refVal_setObjectDetails);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("resourceName")):
+            {
+                utility::string_t refVal_setResourceName;
+                if(!ModelBase::readBinary(reader, field, refVal_setResourceName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setResourceName(refVal_setResourceName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("crudType")):
+            {
+                utility::string_t refVal_setCrudType;
+                if(!ModelBase::readBinary(reader, field, refVal_setCrudType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCrudType(toCrudTypeEnum(refVal_setCrudType));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("from")):
+            {
+                utility::string_t refVal_setFrom;
+                if(!ModelBase::readBinary(reader, field, refVal_setFrom))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFrom(toFromEnum(refVal_setFrom));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ip")):
+            {
+                utility::string_t refVal_setIp;
+                if(!ModelBase::readBinary(reader, field, refVal_setIp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIp(refVal_setIp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("when")):
+            {
+                utility::datetime refVal_setWhen;
+                if(!ModelBase::readBinary(reader, field, refVal_setWhen))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWhen(refVal_setWhen);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            {
+                utility::string_t refVal_setDescription;
+                if(!ModelBase::readBinary(reader, field, refVal_setDescription))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDescription(refVal_setDescription);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("serverStartDate")):
+            {
+                utility::datetime refVal_setServerStartDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setServerStartDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setServerStartDate(refVal_setServerStartDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("objectDetails")):
+            {
+                std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setObjectDetails;
+                if(!ModelBase::readBinary(reader, field, refVal_setObjectDetails))
+                {
+                    ok = false;
+                    continue;
+                }
+                setObjectDetails(refVal_setObjectDetails);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIAuditLog::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -265,53 +572,53 @@ void APIAuditLog::toMultipart(std::shared_ptr<MultipartFormData> multipart, cons
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_ResourceNameIsSet)
+    if(m_FieldsSet.test(FieldBit_ResourceName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("resourceName")), m_ResourceName));
     }
-    if(m_CrudTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_CrudType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("crudType")), fromCrudTypeEnum(m_CrudType)));
     }
-    if(m_FromIsSet)
+    if(m_FieldsSet.test(FieldBit_From))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("from")), fromFromEnum(m_From)));
     }
-    if(m_Url.has_value())
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_Ip.has_value())
+    if(m_FieldsSet.test(FieldBit_Ip))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ip")), m_Ip.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ip")), m_Ip));
     }
-    if(m_WhenIsSet)
+    if(m_FieldsSet.test(FieldBit_When))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("when")), m_When));
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("description")), m_Description));
     }
-    if(m_ServerStartDateIsSet)
+    if(m_FieldsSet.test(FieldBit_ServerStartDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("serverStartDate")), m_ServerStartDate));
     }
-    if(m_ObjectDetails.has_value())
+    if(m_FieldsSet.test(FieldBit_ObjectDetails))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("objectDetails")), m_ObjectDetails.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("objectDetails")), m_ObjectDetails));
     }
 }
 
@@ -487,17 +794,17 @@ utility::string_t APIAuditLog::getId() const
 void APIAuditLog::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool APIAuditLog::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void APIAuditLog::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t APIAuditLog::getUserId() const
 {
@@ -508,17 +815,17 @@ utility::string_t APIAuditLog::getUserId() const
 void APIAuditLog::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool APIAuditLog::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void APIAuditLog::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t APIAuditLog::getUsername() const
 {
@@ -529,17 +836,17 @@ utility::string_t APIAuditLog::getUsername() const
 void APIAuditLog::setUsername(const utility::string_t& value)
 {
     m_Username = value;
-    m_UsernameIsSet = true;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool APIAuditLog::usernameIsSet() const
 {
-    return m_UsernameIsSet;
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void APIAuditLog::unsetUsername()
 {
-    m_UsernameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t APIAuditLog::getResourceName() const
 {
@@ -550,17 +857,17 @@ utility::string_t APIAuditLog::getResourceName() const
 void APIAuditLog::setResourceName(const utility::string_t& value)
 {
     m_ResourceName = value;
-    m_ResourceNameIsSet = true;
+    m_FieldsSet.set(FieldBit_ResourceName);
 }
 
 bool APIAuditLog::resourceNameIsSet() const
 {
-    return m_ResourceNameIsSet;
+    return m_FieldsSet.test(FieldBit_ResourceName);
 }
 
 void APIAuditLog::unsetResourceName()
 {
-    m_ResourceNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_ResourceName);
 }
 APIAuditLog::CrudTypeEnum APIAuditLog::getCrudType() const
 {
@@ -571,17 +878,17 @@ APIAuditLog::CrudTypeEnum APIAuditLog::getCrudType() const
 void APIAuditLog::setCrudType(const CrudTypeEnum value)
 {
     m_CrudType = value;
-    m_CrudTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_CrudType);
 }
 
 bool APIAuditLog::crudTypeIsSet() const
 {
-    return m_CrudTypeIsSet;
+    return m_FieldsSet.test(FieldBit_CrudType);
 }
 
 void APIAuditLog::unsetCrudType()
 {
-    m_CrudTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_CrudType);
 }
 APIAuditLog::FromEnum APIAuditLog::getFrom() const
 {
@@ -592,57 +899,59 @@ APIAuditLog::FromEnum APIAuditLog::getFrom() const
 void APIAuditLog::setFrom(const FromEnum value)
 {
     m_From = value;
-    m_FromIsSet = true;
+    m_FieldsSet.set(FieldBit_From);
 }
 
 bool APIAuditLog::fromIsSet() const
 {
-    return m_FromIsSet;
+    return m_FieldsSet.test(FieldBit_From);
 }
 
 void APIAuditLog::unsetFrom()
 {
-    m_FromIsSet = false;
+    m_FieldsSet.reset(FieldBit_From);
 }
 utility::string_t APIAuditLog::getUrl() const
 {
-    return m_Url.get();
+    return m_Url;
 }
 
 
 void APIAuditLog::setUrl(const utility::string_t& value)
 {
     m_Url = value;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool APIAuditLog::urlIsSet() const
 {
-    return m_Url.has_value();
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void APIAuditLog::unsetUrl()
 {
-    m_Url.reset();
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t APIAuditLog::getIp() const
 {
-    return m_Ip.get();
+    return m_Ip;
 }
 
 
 void APIAuditLog::setIp(const utility::string_t& value)
 {
     m_Ip = value;
+    m_FieldsSet.set(FieldBit_Ip);
 }
 
 bool APIAuditLog::ipIsSet() const
 {
-    return m_Ip.has_value();
+    return m_FieldsSet.test(FieldBit_Ip);
 }
 
 void APIAuditLog::unsetIp()
 {
-    m_Ip.reset();
+    m_FieldsSet.reset(FieldBit_Ip);
 }
 utility::datetime APIAuditLog::getWhen() const
 {
@@ -653,17 +962,17 @@ utility::datetime APIAuditLog::getWhen() const
 void APIAuditLog::setWhen(const utility::datetime& value)
 {
     m_When = value;
-    m_WhenIsSet = true;
+    m_FieldsSet.set(FieldBit_When);
 }
 
 bool APIAuditLog::whenIsSet() const
 {
-    return m_WhenIsSet;
+    return m_FieldsSet.test(FieldBit_When);
 }
 
 void APIAuditLog::unsetWhen()
 {
-    m_WhenIsSet = false;
+    m_FieldsSet.reset(FieldBit_When);
 }
 utility::string_t APIAuditLog::getDescription() const
 {
@@ -674,17 +983,17 @@ utility::string_t APIAuditLog::getDescription() const
 void APIAuditLog::setDescription(const utility::string_t& value)
 {
     m_Description = value;
-    m_DescriptionIsSet = true;
+    m_FieldsSet.set(FieldBit_Description);
 }
 
 bool APIAuditLog::descriptionIsSet() const
 {
-    return m_DescriptionIsSet;
+    return m_FieldsSet.test(FieldBit_Description);
 }
 
 void APIAuditLog::unsetDescription()
 {
-    m_DescriptionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Description);
 }
 utility::datetime APIAuditLog::getServerStartDate() const
 {
@@ -695,37 +1004,38 @@ utility::datetime APIAuditLog::getServerStartDate() const
 void APIAuditLog::setServerStartDate(const utility::datetime& value)
 {
     m_ServerStartDate = value;
-    m_ServerStartDateIsSet = true;
+    m_FieldsSet.set(FieldBit_ServerStartDate);
 }
 
 bool APIAuditLog::serverStartDateIsSet() const
 {
-    return m_ServerStartDateIsSet;
+    return m_FieldsSet.test(FieldBit_ServerStartDate);
 }
 
 void APIAuditLog::unsetServerStartDate()
 {
-    m_ServerStartDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_ServerStartDate);
 }
 std::map<utility::string_t, std::shared_ptr<AnyType>> APIAuditLog::getObjectDetails() const
 {
-    return m_ObjectDetails.get();
+    return m_ObjectDetails;
 }
 
 
 void APIAuditLog::setObjectDetails(const std::map<utility::string_t, std::shared_ptr<AnyType>>& value)
 {
     m_ObjectDetails = value;
+    m_FieldsSet.set(FieldBit_ObjectDetails);
 }
 
 bool APIAuditLog::objectDetailsIsSet() const
 {
-    return m_ObjectDetails.has_value();
+    return m_FieldsSet.test(FieldBit_ObjectDetails);
 }
 
 void APIAuditLog::unsetObjectDetails()
 {
-    m_ObjectDetails.reset();
+    m_FieldsSet.reset(FieldBit_ObjectDetails);
 }
 
 }
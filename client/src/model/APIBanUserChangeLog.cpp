@@ -20,12 +20,6 @@ namespace model {
 
 APIBanUserChangeLog::APIBanUserChangeLog()
 {
-    m_CreatedBannedUserId = utility::conversions::to_string_t("");
-    m_CreatedBannedUserIdIsSet = false;
-    m_UpdatedBannedUserId = utility::conversions::to_string_t("");
-    m_UpdatedBannedUserIdIsSet = false;
-    m_DeletedBannedUsersIsSet = false;
-    m_ChangedValuesBeforeIsSet = false;
 }
 
 APIBanUserChangeLog::~APIBanUserChangeLog()
@@ -40,22 +34,22 @@ void APIBanUserChangeLog::validate()
 web::json::value APIBanUserChangeLog::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CreatedBannedUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedBannedUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdBannedUserId"))] = ModelBase::toJson(m_CreatedBannedUserId);
     }
-    if(m_UpdatedBannedUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UpdatedBannedUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("updatedBannedUserId"))] = ModelBase::toJson(m_UpdatedBannedUserId);
     }
-    if(m_DeletedBannedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_DeletedBannedUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("deletedBannedUsers"))] = ModelBase::toJson(m_DeletedBannedUsers);
     }
-    if(m_ChangedValuesBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_ChangedValuesBefore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("changedValuesBefore"))] = ModelBase::toJson(m_ChangedValuesBefore);
@@ -64,54 +58,187 @@ web::json::value APIBanUserChangeLog::toJson() const
     return val;
 }
 
+void APIBanUserChangeLog::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CreatedBannedUserId))
+    {
+        
+        writer.key(_XPLATSTR("createdBannedUserId"));
+        ModelBase::writeJson(writer, m_CreatedBannedUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UpdatedBannedUserId))
+    {
+        
+        writer.key(_XPLATSTR("updatedBannedUserId"));
+        ModelBase::writeJson(writer, m_UpdatedBannedUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_DeletedBannedUsers))
+    {
+        
+        writer.key(_XPLATSTR("deletedBannedUsers"));
+        ModelBase::writeJson(writer, m_DeletedBannedUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_ChangedValuesBefore))
+    {
+        
+        writer.key(_XPLATSTR("changedValuesBefore"));
+        ModelBase::writeJson(writer, m_ChangedValuesBefore);
+    }
+
+    writer.endObject();
+}
+
 bool APIBanUserChangeLog::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdBannedUserId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdBannedUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedBannedUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedBannedUserId);
-            setCreatedBannedUserId(refVal_setCreatedBannedUserId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("updatedBannedUserId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("updatedBannedUserId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUpdatedBannedUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUpdatedBannedUserId);
-            setUpdatedBannedUserId(refVal_setUpdatedBannedUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("createdBannedUserId")):
+            if(field.first == _XPLATSTR("createdBannedUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedBannedUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedBannedUserId);
+                    setCreatedBannedUserId(refVal_setCreatedBannedUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("updatedBannedUserId")):
+            if(field.first == _XPLATSTR("updatedBannedUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUpdatedBannedUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUpdatedBannedUserId);
+                    setUpdatedBannedUserId(refVal_setUpdatedBannedUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("deletedBannedUsers")):
+            if(field.first == _XPLATSTR("deletedBannedUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APIBannedUser>> refVal_setDeletedBannedUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDeletedBannedUsers);
+                    setDeletedBannedUsers(refVal_setDeletedBannedUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("changedValuesBefore")):
+            if(field.first == _XPLATSTR("changedValuesBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIBanUserChangedValues> refVal_setChangedValuesBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setChangedValuesBefore);
+                    setChangedValuesBefore(refVal_setChangedValuesBefore);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("deletedBannedUsers"))))
+    return ok;
+}
+
+void APIBanUserChangeLog::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CreatedBannedUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("deletedBannedUsers")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<APIBannedUser>> refVal_setDeletedBannedUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDeletedBannedUsers);
-            setDeletedBannedUsers(refVal_setDeletedBannedUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdBannedUserId")), m_CreatedBannedUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("changedValuesBefore"))))
+    if(m_FieldsSet.test(FieldBit_UpdatedBannedUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("changedValuesBefore")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("updatedBannedUserId")), m_UpdatedBannedUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_DeletedBannedUsers))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("deletedBannedUsers")), m_DeletedBannedUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_ChangedValuesBefore))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("changedValuesBefore")), m_ChangedValuesBefore);
+    }
+}
+
+bool APIBanUserChangeLog::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIBanUserChangedValues> refVal_setChangedValuesBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setChangedValuesBefore);
-            setChangedValuesBefore(refVal_setChangedValuesBefore);
-            
+        case ModelBase::fieldHash(_XPLATSTR("createdBannedUserId")):
+            {
+                utility::string_t refVal_setCreatedBannedUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedBannedUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedBannedUserId(refVal_setCreatedBannedUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("updatedBannedUserId")):
+            {
+                utility::string_t refVal_setUpdatedBannedUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUpdatedBannedUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUpdatedBannedUserId(refVal_setUpdatedBannedUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("deletedBannedUsers")):
+            {
+                std::vector<std::shared_ptr<APIBannedUser>> refVal_setDeletedBannedUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setDeletedBannedUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDeletedBannedUsers(refVal_setDeletedBannedUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("changedValuesBefore")):
+            {
+                std::shared_ptr<APIBanUserChangedValues> refVal_setChangedValuesBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setChangedValuesBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setChangedValuesBefore(refVal_setChangedValuesBefore);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIBanUserChangeLog::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -121,19 +248,19 @@ void APIBanUserChangeLog::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CreatedBannedUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedBannedUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdBannedUserId")), m_CreatedBannedUserId));
     }
-    if(m_UpdatedBannedUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UpdatedBannedUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("updatedBannedUserId")), m_UpdatedBannedUserId));
     }
-    if(m_DeletedBannedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_DeletedBannedUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("deletedBannedUsers")), m_DeletedBannedUsers));
     }
-    if(m_ChangedValuesBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_ChangedValuesBefore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("changedValuesBefore")), m_ChangedValuesBefore));
     }
@@ -185,17 +312,17 @@ utility::string_t APIBanUserChangeLog::getCreatedBannedUserId() const
 void APIBanUserChangeLog::setCreatedBannedUserId(const utility::string_t& value)
 {
     m_CreatedBannedUserId = value;
-    m_CreatedBannedUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedBannedUserId);
 }
 
 bool APIBanUserChangeLog::createdBannedUserIdIsSet() const
 {
-    return m_CreatedBannedUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedBannedUserId);
 }
 
 void APIBanUserChangeLog::unsetCreatedBannedUserId()
 {
-    m_CreatedBannedUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedBannedUserId);
 }
 utility::string_t APIBanUserChangeLog::getUpdatedBannedUserId() const
 {
@@ -206,17 +333,17 @@ utility::string_t APIBanUserChangeLog::getUpdatedBannedUserId() const
 void APIBanUserChangeLog::setUpdatedBannedUserId(const utility::string_t& value)
 {
     m_UpdatedBannedUserId = value;
-    m_UpdatedBannedUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UpdatedBannedUserId);
 }
 
 bool APIBanUserChangeLog::updatedBannedUserIdIsSet() const
 {
-    return m_UpdatedBannedUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UpdatedBannedUserId);
 }
 
 void APIBanUserChangeLog::unsetUpdatedBannedUserId()
 {
-    m_UpdatedBannedUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UpdatedBannedUserId);
 }
 std::vector<std::shared_ptr<APIBannedUser>> APIBanUserChangeLog::getDeletedBannedUsers() const
 {
@@ -227,17 +354,17 @@ std::vector<std::shared_ptr<APIBannedUser>> APIBanUserChangeLog::getDeletedBanne
 void APIBanUserChangeLog::setDeletedBannedUsers(const std::vector<std::shared_ptr<APIBannedUser>>& value)
 {
     m_DeletedBannedUsers = value;
-    m_DeletedBannedUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_DeletedBannedUsers);
 }
 
 bool APIBanUserChangeLog::deletedBannedUsersIsSet() const
 {
-    return m_DeletedBannedUsersIsSet;
+    return m_FieldsSet.test(FieldBit_DeletedBannedUsers);
 }
 
 void APIBanUserChangeLog::unsetDeletedBannedUsers()
 {
-    m_DeletedBannedUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_DeletedBannedUsers);
 }
 std::shared_ptr<APIBanUserChangedValues> APIBanUserChangeLog::getChangedValuesBefore() const
 {
@@ -248,17 +375,17 @@ std::shared_ptr<APIBanUserChangedValues> APIBanUserChangeLog::getChangedValuesBe
 void APIBanUserChangeLog::setChangedValuesBefore(const std::shared_ptr<APIBanUserChangedValues>& value)
 {
     m_ChangedValuesBefore = value;
-    m_ChangedValuesBeforeIsSet = true;
+    m_FieldsSet.set(FieldBit_ChangedValuesBefore);
 }
 
 bool APIBanUserChangeLog::changedValuesBeforeIsSet() const
 {
-    return m_ChangedValuesBeforeIsSet;
+    return m_FieldsSet.test(FieldBit_ChangedValuesBefore);
 }
 
 void APIBanUserChangeLog::unsetChangedValuesBefore()
 {
-    m_ChangedValuesBeforeIsSet = false;
+    m_FieldsSet.reset(FieldBit_ChangedValuesBefore);
 }
 
 }
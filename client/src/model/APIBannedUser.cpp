@@ -20,22 +20,7 @@ namespace model {
 
 APIBannedUser::APIBannedUser()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_BannedByUserId = utility::conversions::to_string_t("");
-    m_BannedByUserIdIsSet = false;
-    m_BannedCommentText = utility::conversions::to_string_t("");
-    m_BannedCommentTextIsSet = false;
-    m_BanType = utility::conversions::to_string_t("");
-    m_BanTypeIsSet = false;
     m_HasEmailWildcard = false;
-    m_HasEmailWildcardIsSet = false;
-    m_BanReason = utility::conversions::to_string_t("");
-    m_BanReasonIsSet = false;
 }
 
 APIBannedUser::~APIBannedUser()
@@ -50,67 +35,67 @@ void APIBannedUser::validate()
 web::json::value APIBannedUser::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_Username.has_value())
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_IpHash.has_value())
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("ipHash"))] = ModelBase::toJson(m_IpHash.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("ipHash"))] = ModelBase::toJson(m_IpHash);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_BannedByUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedByUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bannedByUserId"))] = ModelBase::toJson(m_BannedByUserId);
     }
-    if(m_BannedCommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedCommentText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bannedCommentText"))] = ModelBase::toJson(m_BannedCommentText);
     }
-    if(m_BanTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_BanType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("banType"))] = ModelBase::toJson(m_BanType);
     }
-    if(m_BannedUntil.has_value())
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))] = ModelBase::toJson(m_BannedUntil.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))] = ModelBase::toJson(m_BannedUntil);
     }
-    if(m_HasEmailWildcardIsSet)
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard"))] = ModelBase::toJson(m_HasEmailWildcard);
     }
-    if(m_BanReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_BanReason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("banReason"))] = ModelBase::toJson(m_BanReason);
@@ -119,153 +104,493 @@ web::json::value APIBannedUser::toJson() const
     return val;
 }
 
+void APIBannedUser::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHash))
+    {
+        
+        writer.key(_XPLATSTR("ipHash"));
+        ModelBase::writeJson(writer, m_IpHash);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedByUserId))
+    {
+        
+        writer.key(_XPLATSTR("bannedByUserId"));
+        ModelBase::writeJson(writer, m_BannedByUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedCommentText))
+    {
+        
+        writer.key(_XPLATSTR("bannedCommentText"));
+        ModelBase::writeJson(writer, m_BannedCommentText);
+    }
+    if(m_FieldsSet.test(FieldBit_BanType))
+    {
+        
+        writer.key(_XPLATSTR("banType"));
+        ModelBase::writeJson(writer, m_BanType);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
+    {
+        
+        writer.key(_XPLATSTR("bannedUntil"));
+        ModelBase::writeJson(writer, m_BannedUntil);
+    }
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
+    {
+        
+        writer.key(_XPLATSTR("hasEmailWildcard"));
+        ModelBase::writeJson(writer, m_HasEmailWildcard);
+    }
+    if(m_FieldsSet.test(FieldBit_BanReason))
+    {
+        
+        writer.key(_XPLATSTR("banReason"));
+        ModelBase::writeJson(writer, m_BanReason);
+    }
+
+    writer.endObject();
+}
+
 bool APIBannedUser::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            if(field.first == _XPLATSTR("ipHash"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setIpHash;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
+                    setIpHash(refVal_setIpHash);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bannedByUserId")):
+            if(field.first == _XPLATSTR("bannedByUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBannedByUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedByUserId);
+                    setBannedByUserId(refVal_setBannedByUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bannedCommentText")):
+            if(field.first == _XPLATSTR("bannedCommentText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBannedCommentText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedCommentText);
+                    setBannedCommentText(refVal_setBannedCommentText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("banType")):
+            if(field.first == _XPLATSTR("banType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBanType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBanType);
+                    setBanType(refVal_setBanType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            if(field.first == _XPLATSTR("bannedUntil"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setBannedUntil;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
+                    setBannedUntil(refVal_setBannedUntil);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasEmailWildcard")):
+            if(field.first == _XPLATSTR("hasEmailWildcard"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasEmailWildcard;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasEmailWildcard);
+                    setHasEmailWildcard(refVal_setHasEmailWildcard);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("banReason")):
+            if(field.first == _XPLATSTR("banReason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBanReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBanReason);
+                    setBanReason(refVal_setBanReason);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    return ok;
+}
+
+void APIBannedUser::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ipHash"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ipHash")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setIpHash;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
-            setIpHash(refVal_setIpHash);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_Username))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedByUserId"))))
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedByUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBannedByUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedByUserId);
-            setBannedByUserId(refVal_setBannedByUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ipHash")), m_IpHash);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedCommentText"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedCommentText")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBannedCommentText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedCommentText);
-            setBannedCommentText(refVal_setBannedCommentText);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("banType"))))
+    if(m_FieldsSet.test(FieldBit_BannedByUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("banType")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBanType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBanType);
-            setBanType(refVal_setBanType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedByUserId")), m_BannedByUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))))
+    if(m_FieldsSet.test(FieldBit_BannedCommentText))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedUntil")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setBannedUntil;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
-            setBannedUntil(refVal_setBannedUntil);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedCommentText")), m_BannedCommentText);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard"))))
+    if(m_FieldsSet.test(FieldBit_BanType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasEmailWildcard;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasEmailWildcard);
-            setHasEmailWildcard(refVal_setHasEmailWildcard);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("banType")), m_BanType);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedUntil")), m_BannedUntil);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("banReason"))))
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("banReason")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasEmailWildcard")), m_HasEmailWildcard);
+    }
+    if(m_FieldsSet.test(FieldBit_BanReason))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("banReason")), m_BanReason);
+    }
+}
+
+bool APIBannedUser::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setBanReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBanReason);
-            setBanReason(refVal_setBanReason);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            {
+                utility::string_t refVal_setIpHash;
+                if(!ModelBase::readBinary(reader, field, refVal_setIpHash))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIpHash(refVal_setIpHash);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bannedByUserId")):
+            {
+                utility::string_t refVal_setBannedByUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedByUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedByUserId(refVal_setBannedByUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bannedCommentText")):
+            {
+                utility::string_t refVal_setBannedCommentText;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedCommentText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedCommentText(refVal_setBannedCommentText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("banType")):
+            {
+                utility::string_t refVal_setBanType;
+                if(!ModelBase::readBinary(reader, field, refVal_setBanType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBanType(refVal_setBanType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            {
+                utility::datetime refVal_setBannedUntil;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedUntil))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedUntil(refVal_setBannedUntil);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasEmailWildcard")):
+            {
+                bool refVal_setHasEmailWildcard;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasEmailWildcard))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasEmailWildcard(refVal_setHasEmailWildcard);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("banReason")):
+            {
+                utility::string_t refVal_setBanReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setBanReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBanReason(refVal_setBanReason);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIBannedUser::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -275,55 +600,55 @@ void APIBannedUser::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_Username.has_value())
+    if(m_FieldsSet.test(FieldBit_Username))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_IpHash.has_value())
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHash")), m_IpHash.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHash")), m_IpHash));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_BannedByUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedByUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedByUserId")), m_BannedByUserId));
     }
-    if(m_BannedCommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedCommentText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedCommentText")), m_BannedCommentText));
     }
-    if(m_BanTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_BanType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("banType")), m_BanType));
     }
-    if(m_BannedUntil.has_value())
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedUntil")), m_BannedUntil.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedUntil")), m_BannedUntil));
     }
-    if(m_HasEmailWildcardIsSet)
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard")), m_HasEmailWildcard));
     }
-    if(m_BanReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_BanReason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("banReason")), m_BanReason));
     }
@@ -429,17 +754,17 @@ utility::string_t APIBannedUser::getId() const
 void APIBannedUser::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool APIBannedUser::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void APIBannedUser::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t APIBannedUser::getTenantId() const
 {
@@ -450,97 +775,101 @@ utility::string_t APIBannedUser::getTenantId() const
 void APIBannedUser::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool APIBannedUser::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void APIBannedUser::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t APIBannedUser::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void APIBannedUser::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool APIBannedUser::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void APIBannedUser::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t APIBannedUser::getEmail() const
 {
-    return m_Email.get();
+    return m_Email;
 }
 
 
 void APIBannedUser::setEmail(const utility::string_t& value)
 {
     m_Email = value;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool APIBannedUser::emailIsSet() const
 {
-    return m_Email.has_value();
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void APIBannedUser::unsetEmail()
 {
-    m_Email.reset();
+    m_FieldsSet.reset(FieldBit_Email);
 }
 utility::string_t APIBannedUser::getUsername() const
 {
-    return m_Username.get();
+    return m_Username;
 }
 
 
 void APIBannedUser::setUsername(const utility::string_t& value)
 {
     m_Username = value;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool APIBannedUser::usernameIsSet() const
 {
-    return m_Username.has_value();
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void APIBannedUser::unsetUsername()
 {
-    m_Username.reset();
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t APIBannedUser::getIpHash() const
 {
-    return m_IpHash.get();
+    return m_IpHash;
 }
 
 
 void APIBannedUser::setIpHash(const utility::string_t& value)
 {
     m_IpHash = value;
+    m_FieldsSet.set(FieldBit_IpHash);
 }
 
 bool APIBannedUser::ipHashIsSet() const
 {
-    return m_IpHash.has_value();
+    return m_FieldsSet.test(FieldBit_IpHash);
 }
 
 void APIBannedUser::unsetIpHash()
 {
-    m_IpHash.reset();
+    m_FieldsSet.reset(FieldBit_IpHash);
 }
 utility::datetime APIBannedUser::getCreatedAt() const
 {
@@ -551,17 +880,17 @@ utility::datetime APIBannedUser::getCreatedAt() const
 void APIBannedUser::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool APIBannedUser::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void APIBannedUser::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t APIBannedUser::getBannedByUserId() const
 {
@@ -572,17 +901,17 @@ utility::string_t APIBannedUser::getBannedByUserId() const
 void APIBannedUser::setBannedByUserId(const utility::string_t& value)
 {
     m_BannedByUserId = value;
-    m_BannedByUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BannedByUserId);
 }
 
 bool APIBannedUser::bannedByUserIdIsSet() const
 {
-    return m_BannedByUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_BannedByUserId);
 }
 
 void APIBannedUser::unsetBannedByUserId()
 {
-    m_BannedByUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BannedByUserId);
 }
 utility::string_t APIBannedUser::getBannedCommentText() const
 {
@@ -593,17 +922,17 @@ utility::string_t APIBannedUser::getBannedCommentText() const
 void APIBannedUser::setBannedCommentText(const utility::string_t& value)
 {
     m_BannedCommentText = value;
-    m_BannedCommentTextIsSet = true;
+    m_FieldsSet.set(FieldBit_BannedCommentText);
 }
 
 bool APIBannedUser::bannedCommentTextIsSet() const
 {
-    return m_BannedCommentTextIsSet;
+    return m_FieldsSet.test(FieldBit_BannedCommentText);
 }
 
 void APIBannedUser::unsetBannedCommentText()
 {
-    m_BannedCommentTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_BannedCommentText);
 }
 utility::string_t APIBannedUser::getBanType() const
 {
@@ -614,37 +943,38 @@ utility::string_t APIBannedUser::getBanType() const
 void APIBannedUser::setBanType(const utility::string_t& value)
 {
     m_BanType = value;
-    m_BanTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_BanType);
 }
 
 bool APIBannedUser::banTypeIsSet() const
 {
-    return m_BanTypeIsSet;
+    return m_FieldsSet.test(FieldBit_BanType);
 }
 
 void APIBannedUser::unsetBanType()
 {
-    m_BanTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_BanType);
 }
 utility::datetime APIBannedUser::getBannedUntil() const
 {
-    return m_BannedUntil.get();
+    return m_BannedUntil;
 }
 
 
 void APIBannedUser::setBannedUntil(const utility::datetime& value)
 {
     m_BannedUntil = value;
+    m_FieldsSet.set(FieldBit_BannedUntil);
 }
 
 bool APIBannedUser::bannedUntilIsSet() const
 {
-    return m_BannedUntil.has_value();
+    return m_FieldsSet.test(FieldBit_BannedUntil);
 }
 
 void APIBannedUser::unsetBannedUntil()
 {
-    m_BannedUntil.reset();
+    m_FieldsSet.reset(FieldBit_BannedUntil);
 }
 bool APIBannedUser::isHasEmailWildcard() const
 {
@@ -654,17 +984,17 @@ bool APIBannedUser::isHasEmailWildcard() const
 void APIBannedUser::setHasEmailWildcard(bool value)
 {
     m_HasEmailWildcard = value;
-    m_HasEmailWildcardIsSet = true;
+    m_FieldsSet.set(FieldBit_HasEmailWildcard);
 }
 
 bool APIBannedUser::hasEmailWildcardIsSet() const
 {
-    return m_HasEmailWildcardIsSet;
+    return m_FieldsSet.test(FieldBit_HasEmailWildcard);
 }
 
 void APIBannedUser::unsetHasEmailWildcard()
 {
-    m_HasEmailWildcardIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasEmailWildcard);
 }
 utility::string_t APIBannedUser::getBanReason() const
 {
@@ -675,17 +1005,17 @@ utility::string_t APIBannedUser::getBanReason() const
 void APIBannedUser::setBanReason(const utility::string_t& value)
 {
     m_BanReason = value;
-    m_BanReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_BanReason);
 }
 
 bool APIBannedUser::banReasonIsSet() const
 {
-    return m_BanReasonIsSet;
+    return m_FieldsSet.test(FieldBit_BanReason);
 }
 
 void APIBannedUser::unsetBanReason()
 {
-    m_BanReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_BanReason);
 }
 
 }
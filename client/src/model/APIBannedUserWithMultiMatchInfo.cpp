@@ -20,15 +20,7 @@ namespace model {
 
 APIBannedUserWithMultiMatchInfo::APIBannedUserWithMultiMatchInfo()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_BanType = utility::conversions::to_string_t("");
-    m_BanTypeIsSet = false;
     m_HasEmailWildcard = false;
-    m_HasEmailWildcardIsSet = false;
-    m_BanReason = utility::conversions::to_string_t("");
-    m_BanReasonIsSet = false;
-    m_MatchesIsSet = false;
 }
 
 APIBannedUserWithMultiMatchInfo::~APIBannedUserWithMultiMatchInfo()
@@ -43,47 +35,47 @@ void APIBannedUserWithMultiMatchInfo::validate()
 web::json::value APIBannedUserWithMultiMatchInfo::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_BanTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_BanType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("banType"))] = ModelBase::toJson(m_BanType);
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_IpHash.has_value())
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("ipHash"))] = ModelBase::toJson(m_IpHash.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("ipHash"))] = ModelBase::toJson(m_IpHash);
     }
-    if(m_BannedUntil.has_value())
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))] = ModelBase::toJson(m_BannedUntil.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))] = ModelBase::toJson(m_BannedUntil);
     }
-    if(m_HasEmailWildcardIsSet)
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard"))] = ModelBase::toJson(m_HasEmailWildcard);
     }
-    if(m_BanReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_BanReason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("banReason"))] = ModelBase::toJson(m_BanReason);
     }
-    if(m_MatchesIsSet)
+    if(m_FieldsSet.test(FieldBit_Matches))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("matches"))] = ModelBase::toJson(m_Matches);
@@ -92,109 +84,357 @@ web::json::value APIBannedUserWithMultiMatchInfo::toJson() const
     return val;
 }
 
+void APIBannedUserWithMultiMatchInfo::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_BanType))
+    {
+        
+        writer.key(_XPLATSTR("banType"));
+        ModelBase::writeJson(writer, m_BanType);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHash))
+    {
+        
+        writer.key(_XPLATSTR("ipHash"));
+        ModelBase::writeJson(writer, m_IpHash);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
+    {
+        
+        writer.key(_XPLATSTR("bannedUntil"));
+        ModelBase::writeJson(writer, m_BannedUntil);
+    }
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
+    {
+        
+        writer.key(_XPLATSTR("hasEmailWildcard"));
+        ModelBase::writeJson(writer, m_HasEmailWildcard);
+    }
+    if(m_FieldsSet.test(FieldBit_BanReason))
+    {
+        
+        writer.key(_XPLATSTR("banReason"));
+        ModelBase::writeJson(writer, m_BanReason);
+    }
+    if(m_FieldsSet.test(FieldBit_Matches))
+    {
+        
+        writer.key(_XPLATSTR("matches"));
+        ModelBase::writeJson(writer, m_Matches);
+    }
+
+    writer.endObject();
+}
+
 bool APIBannedUserWithMultiMatchInfo::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("banType")):
+            if(field.first == _XPLATSTR("banType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBanType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBanType);
+                    setBanType(refVal_setBanType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            if(field.first == _XPLATSTR("ipHash"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setIpHash;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
+                    setIpHash(refVal_setIpHash);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            if(field.first == _XPLATSTR("bannedUntil"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setBannedUntil;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
+                    setBannedUntil(refVal_setBannedUntil);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasEmailWildcard")):
+            if(field.first == _XPLATSTR("hasEmailWildcard"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasEmailWildcard;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasEmailWildcard);
+                    setHasEmailWildcard(refVal_setHasEmailWildcard);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("banReason")):
+            if(field.first == _XPLATSTR("banReason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBanReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBanReason);
+                    setBanReason(refVal_setBanReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("matches")):
+            if(field.first == _XPLATSTR("matches"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<BannedUserMatch>> refVal_setMatches;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMatches);
+                    setMatches(refVal_setMatches);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("banType"))))
+    return ok;
+}
+
+void APIBannedUserWithMultiMatchInfo::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("banType")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBanType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBanType);
-            setBanType(refVal_setBanType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ipHash"))))
+    if(m_FieldsSet.test(FieldBit_BanType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ipHash")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setIpHash;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
-            setIpHash(refVal_setIpHash);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("banType")), m_BanType);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedUntil")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setBannedUntil;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
-            setBannedUntil(refVal_setBannedUntil);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard"))))
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasEmailWildcard;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasEmailWildcard);
-            setHasEmailWildcard(refVal_setHasEmailWildcard);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ipHash")), m_IpHash);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("banReason"))))
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("banReason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBanReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBanReason);
-            setBanReason(refVal_setBanReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedUntil")), m_BannedUntil);
+    }
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasEmailWildcard")), m_HasEmailWildcard);
+    }
+    if(m_FieldsSet.test(FieldBit_BanReason))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("banReason")), m_BanReason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("matches"))))
+    if(m_FieldsSet.test(FieldBit_Matches))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("matches")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("matches")), m_Matches);
+    }
+}
+
+bool APIBannedUserWithMultiMatchInfo::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<BannedUserMatch>> refVal_setMatches;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMatches);
-            setMatches(refVal_setMatches);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("banType")):
+            {
+                utility::string_t refVal_setBanType;
+                if(!ModelBase::readBinary(reader, field, refVal_setBanType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBanType(refVal_setBanType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            {
+                utility::string_t refVal_setIpHash;
+                if(!ModelBase::readBinary(reader, field, refVal_setIpHash))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIpHash(refVal_setIpHash);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            {
+                utility::datetime refVal_setBannedUntil;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedUntil))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedUntil(refVal_setBannedUntil);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasEmailWildcard")):
+            {
+                bool refVal_setHasEmailWildcard;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasEmailWildcard))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasEmailWildcard(refVal_setHasEmailWildcard);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("banReason")):
+            {
+                utility::string_t refVal_setBanReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setBanReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBanReason(refVal_setBanReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("matches")):
+            {
+                std::vector<std::shared_ptr<BannedUserMatch>> refVal_setMatches;
+                if(!ModelBase::readBinary(reader, field, refVal_setMatches))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMatches(refVal_setMatches);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIBannedUserWithMultiMatchInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -204,39 +444,39 @@ void APIBannedUserWithMultiMatchInfo::toMultipart(std::shared_ptr<MultipartFormD
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_BanTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_BanType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("banType")), m_BanType));
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_IpHash.has_value())
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHash")), m_IpHash.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHash")), m_IpHash));
     }
-    if(m_BannedUntil.has_value())
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedUntil")), m_BannedUntil.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedUntil")), m_BannedUntil));
     }
-    if(m_HasEmailWildcardIsSet)
+    if(m_FieldsSet.test(FieldBit_HasEmailWildcard))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasEmailWildcard")), m_HasEmailWildcard));
     }
-    if(m_BanReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_BanReason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("banReason")), m_BanReason));
     }
-    if(m_MatchesIsSet)
+    if(m_FieldsSet.test(FieldBit_Matches))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("matches")), m_Matches));
     }
@@ -318,37 +558,38 @@ utility::string_t APIBannedUserWithMultiMatchInfo::getId() const
 void APIBannedUserWithMultiMatchInfo::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool APIBannedUserWithMultiMatchInfo::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void APIBannedUserWithMultiMatchInfo::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t APIBannedUserWithMultiMatchInfo::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void APIBannedUserWithMultiMatchInfo::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool APIBannedUserWithMultiMatchInfo::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t APIBannedUserWithMultiMatchInfo::getBanType() const
 {
@@ -359,77 +600,80 @@ utility::string_t APIBannedUserWithMultiMatchInfo::getBanType() const
 void APIBannedUserWithMultiMatchInfo::setBanType(const utility::string_t& value)
 {
     m_BanType = value;
-    m_BanTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_BanType);
 }
 
 bool APIBannedUserWithMultiMatchInfo::banTypeIsSet() const
 {
-    return m_BanTypeIsSet;
+    return m_FieldsSet.test(FieldBit_BanType);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetBanType()
 {
-    m_BanTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_BanType);
 }
 utility::string_t APIBannedUserWithMultiMatchInfo::getEmail() const
 {
-    return m_Email.get();
+    return m_Email;
 }
 
 
 void APIBannedUserWithMultiMatchInfo::setEmail(const utility::string_t& value)
 {
     m_Email = value;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool APIBannedUserWithMultiMatchInfo::emailIsSet() const
 {
-    return m_Email.has_value();
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetEmail()
 {
-    m_Email.reset();
+    m_FieldsSet.reset(FieldBit_Email);
 }
 utility::string_t APIBannedUserWithMultiMatchInfo::getIpHash() const
 {
-    return m_IpHash.get();
+    return m_IpHash;
 }
 
 
 void APIBannedUserWithMultiMatchInfo::setIpHash(const utility::string_t& value)
 {
     m_IpHash = value;
+    m_FieldsSet.set(FieldBit_IpHash);
 }
 
 bool APIBannedUserWithMultiMatchInfo::ipHashIsSet() const
 {
-    return m_IpHash.has_value();
+    return m_FieldsSet.test(FieldBit_IpHash);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetIpHash()
 {
-    m_IpHash.reset();
+    m_FieldsSet.reset(FieldBit_IpHash);
 }
 utility::datetime APIBannedUserWithMultiMatchInfo::getBannedUntil() const
 {
-    return m_BannedUntil.get();
+    return m_BannedUntil;
 }
 
 
 void APIBannedUserWithMultiMatchInfo::setBannedUntil(const utility::datetime& value)
 {
     m_BannedUntil = value;
+    m_FieldsSet.set(FieldBit_BannedUntil);
 }
 
 bool APIBannedUserWithMultiMatchInfo::bannedUntilIsSet() const
 {
-    return m_BannedUntil.has_value();
+    return m_FieldsSet.test(FieldBit_BannedUntil);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetBannedUntil()
 {
-    m_BannedUntil.reset();
+    m_FieldsSet.reset(FieldBit_BannedUntil);
 }
 bool APIBannedUserWithMultiMatchInfo::isHasEmailWildcard() const
 {
@@ -439,17 +683,17 @@ bool APIBannedUserWithMultiMatchInfo::isHasEmailWildcard() const
 void APIBannedUserWithMultiMatchInfo::setHasEmailWildcard(bool value)
 {
     m_HasEmailWildcard = value;
-    m_HasEmailWildcardIsSet = true;
+    m_FieldsSet.set(FieldBit_HasEmailWildcard);
 }
 
 bool APIBannedUserWithMultiMatchInfo::hasEmailWildcardIsSet() const
 {
-    return m_HasEmailWildcardIsSet;
+    return m_FieldsSet.test(FieldBit_HasEmailWildcard);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetHasEmailWildcard()
 {
-    m_HasEmailWildcardIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasEmailWildcard);
 }
 utility::string_t APIBannedUserWithMultiMatchInfo::getBanReason() const
 {
@@ -460,17 +704,17 @@ utility::string_t APIBannedUserWithMultiMatchInfo::getBanReason() const
 void APIBannedUserWithMultiMatchInfo::setBanReason(const utility::string_t& value)
 {
     m_BanReason = value;
-    m_BanReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_BanReason);
 }
 
 bool APIBannedUserWithMultiMatchInfo::banReasonIsSet() const
 {
-    return m_BanReasonIsSet;
+    return m_FieldsSet.test(FieldBit_BanReason);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetBanReason()
 {
-    m_BanReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_BanReason);
 }
 std::vector<std::shared_ptr<BannedUserMatch>> APIBannedUserWithMultiMatchInfo::getMatches() const
 {
@@ -481,17 +725,17 @@ std::vector<std::shared_ptr<BannedUserMatch>> APIBannedUserWithMultiMatchInfo::g
 void APIBannedUserWithMultiMatchInfo::setMatches(const std::vector<std::shared_ptr<BannedUserMatch>>& value)
 {
     m_Matches = value;
-    m_MatchesIsSet = true;
+    m_FieldsSet.set(FieldBit_Matches);
 }
 
 bool APIBannedUserWithMultiMatchInfo::matchesIsSet() const
 {
-    return m_MatchesIsSet;
+    return m_FieldsSet.test(FieldBit_Matches);
 }
 
 void APIBannedUserWithMultiMatchInfo::unsetMatches()
 {
-    m_MatchesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Matches);
 }
 
 }
@@ -20,57 +20,30 @@ namespace model {
 
 APIComment::APIComment()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
     m_AiDeterminedSpam = false;
-    m_AiDeterminedSpamIsSet = false;
     m_Approved = false;
-    m_ApprovedIsSet = false;
-    m_Comment = utility::conversions::to_string_t("");
-    m_CommentIsSet = false;
-    m_CommentHTML = utility::conversions::to_string_t("");
-    m_CommentHTMLIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_ExternalId = utility::conversions::to_string_t("");
-    m_ExternalIdIsSet = false;
-    m_FeedbackIdsIsSet = false;
     m_FromProductId = 0;
-    m_FromProductIdIsSet = false;
     m_HasCode = false;
-    m_HasCodeIsSet = false;
     m_HasImages = false;
-    m_HasImagesIsSet = false;
     m_HasLinks = false;
-    m_HasLinksIsSet = false;
-    m_HashTagsIsSet = false;
     m_IsByAdmin = false;
-    m_IsByAdminIsSet = false;
     m_IsByModerator = false;
-    m_IsByModeratorIsSet = false;
     m_IsDeleted = false;
-    m_IsDeletedIsSet = false;
     m_IsDeletedUser = false;
-    m_IsDeletedUserIsSet = false;
     m_IsSpam = false;
-    m_IsSpamIsSet = false;
-    m_MentionsIsSet = false;
     m_NotificationSentForParent = false;
-    m_NotificationSentForParentIsSet = false;
     m_NotificationSentForParentTenant = false;
-    m_NotificationSentForParentTenantIsSet = false;
     m_Reviewed = false;
-    m_ReviewedIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_UrlIdRaw = utility::conversions::to_string_t("");
-    m_UrlIdRawIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
+    m_date = 0.0;
+    m_FlagCount = 0;
+    m_IsPinned = false;
+    m_IsLocked = false;
+    m_LocalDateHours = 0;
+    m_Rating = 0.0;
+    m_Votes = 0;
+    m_VotesDown = 0;
+    m_VotesUp = 0;
 }
 
 APIComment::~APIComment()
@@ -85,862 +58,2108 @@ void APIComment::validate()
 web::json::value APIComment::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_AiDeterminedSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam"))] = ModelBase::toJson(m_AiDeterminedSpam);
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approved"))] = ModelBase::toJson(m_Approved);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentHTML"))] = ModelBase::toJson(m_CommentHTML);
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail);
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_ExternalIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("externalId"))] = ModelBase::toJson(m_ExternalId);
     }
-    if(m_ExternalParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("externalParentId"))] = ModelBase::toJson(m_ExternalParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("externalParentId"))] = ModelBase::toJson(m_ExternalParentId);
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt);
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))] = ModelBase::toJson(m_FeedbackIds);
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount);
     }
-    if(m_FromProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromProductId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromProductId"))] = ModelBase::toJson(m_FromProductId);
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasCode"))] = ModelBase::toJson(m_HasCode);
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasImages"))] = ModelBase::toJson(m_HasImages);
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasLinks"))] = ModelBase::toJson(m_HasLinks);
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTags"))] = ModelBase::toJson(m_HashTags);
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))] = ModelBase::toJson(m_IsByAdmin);
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByModerator"))] = ModelBase::toJson(m_IsByModerator);
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeleted"))] = ModelBase::toJson(m_IsDeleted);
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))] = ModelBase::toJson(m_IsDeletedUser);
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned);
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked);
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSpam"))] = ModelBase::toJson(m_IsSpam);
     }
-    if(m_LocalDateHours.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("localDateHours"))] = ModelBase::toJson(m_LocalDateHours.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("localDateHours"))] = ModelBase::toJson(m_LocalDateHours);
     }
-    if(m_LocalDateString.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString);
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("mentions"))] = ModelBase::toJson(m_Mentions);
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
-    if(m_ModerationGroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds);
     }
-    if(m_NotificationSentForParentIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent"))] = ModelBase::toJson(m_NotificationSentForParent);
     }
-    if(m_NotificationSentForParentTenantIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant"))] = ModelBase::toJson(m_NotificationSentForParentTenant);
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId);
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating);
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewed"))] = ModelBase::toJson(m_Reviewed);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_UrlIdRawIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdRaw"))] = ModelBase::toJson(m_UrlIdRaw);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_VerifiedDate.has_value())
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("verifiedDate"))] = ModelBase::toJson(m_VerifiedDate.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("verifiedDate"))] = ModelBase::toJson(m_VerifiedDate);
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes);
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown);
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp);
     }
 
     return val;
 }
 
+void APIComment::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
+    {
+        
+        writer.key(_XPLATSTR("aiDeterminedSpam"));
+        ModelBase::writeJson(writer, m_AiDeterminedSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Approved))
+    {
+        
+        writer.key(_XPLATSTR("approved"));
+        ModelBase::writeJson(writer, m_Approved);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
+    {
+        
+        writer.key(_XPLATSTR("commentHTML"));
+        ModelBase::writeJson(writer, m_CommentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
+    {
+        
+        writer.key(_XPLATSTR("commenterEmail"));
+        ModelBase::writeJson(writer, m_CommenterEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
+    {
+        
+        writer.key(_XPLATSTR("commenterLink"));
+        ModelBase::writeJson(writer, m_CommenterLink);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_ExternalId))
+    {
+        
+        writer.key(_XPLATSTR("externalId"));
+        ModelBase::writeJson(writer, m_ExternalId);
+    }
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
+    {
+        
+        writer.key(_XPLATSTR("externalParentId"));
+        ModelBase::writeJson(writer, m_ExternalParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
+    {
+        
+        writer.key(_XPLATSTR("expireAt"));
+        ModelBase::writeJson(writer, m_ExpireAt);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        writer.key(_XPLATSTR("feedbackIds"));
+        ModelBase::writeJson(writer, m_FeedbackIds);
+    }
+    if(m_FieldsSet.test(FieldBit_FlagCount))
+    {
+        
+        writer.key(_XPLATSTR("flagCount"));
+        ModelBase::writeJson(writer, m_FlagCount);
+    }
+    if(m_FieldsSet.test(FieldBit_FromProductId))
+    {
+        
+        writer.key(_XPLATSTR("fromProductId"));
+        ModelBase::writeJson(writer, m_FromProductId);
+    }
+    if(m_FieldsSet.test(FieldBit_HasCode))
+    {
+        
+        writer.key(_XPLATSTR("hasCode"));
+        ModelBase::writeJson(writer, m_HasCode);
+    }
+    if(m_FieldsSet.test(FieldBit_HasImages))
+    {
+        
+        writer.key(_XPLATSTR("hasImages"));
+        ModelBase::writeJson(writer, m_HasImages);
+    }
+    if(m_FieldsSet.test(FieldBit_HasLinks))
+    {
+        
+        writer.key(_XPLATSTR("hasLinks"));
+        ModelBase::writeJson(writer, m_HasLinks);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTags))
+    {
+        
+        writer.key(_XPLATSTR("hashTags"));
+        ModelBase::writeJson(writer, m_HashTags);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isByAdmin"));
+        ModelBase::writeJson(writer, m_IsByAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
+    {
+        
+        writer.key(_XPLATSTR("isByModerator"));
+        ModelBase::writeJson(writer, m_IsByModerator);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
+    {
+        
+        writer.key(_XPLATSTR("isDeleted"));
+        ModelBase::writeJson(writer, m_IsDeleted);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
+    {
+        
+        writer.key(_XPLATSTR("isDeletedUser"));
+        ModelBase::writeJson(writer, m_IsDeletedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_IsPinned))
+    {
+        
+        writer.key(_XPLATSTR("isPinned"));
+        ModelBase::writeJson(writer, m_IsPinned);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLocked))
+    {
+        
+        writer.key(_XPLATSTR("isLocked"));
+        ModelBase::writeJson(writer, m_IsLocked);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSpam))
+    {
+        
+        writer.key(_XPLATSTR("isSpam"));
+        ModelBase::writeJson(writer, m_IsSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
+    {
+        
+        writer.key(_XPLATSTR("localDateHours"));
+        ModelBase::writeJson(writer, m_LocalDateHours);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
+    {
+        
+        writer.key(_XPLATSTR("localDateString"));
+        ModelBase::writeJson(writer, m_LocalDateString);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_Mentions))
+    {
+        
+        writer.key(_XPLATSTR("mentions"));
+        ModelBase::writeJson(writer, m_Mentions);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("moderationGroupIds"));
+        ModelBase::writeJson(writer, m_ModerationGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
+    {
+        
+        writer.key(_XPLATSTR("notificationSentForParent"));
+        ModelBase::writeJson(writer, m_NotificationSentForParent);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
+    {
+        
+        writer.key(_XPLATSTR("notificationSentForParentTenant"));
+        ModelBase::writeJson(writer, m_NotificationSentForParentTenant);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_ParentId))
+    {
+        
+        writer.key(_XPLATSTR("parentId"));
+        ModelBase::writeJson(writer, m_ParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Rating))
+    {
+        
+        writer.key(_XPLATSTR("rating"));
+        ModelBase::writeJson(writer, m_Rating);
+    }
+    if(m_FieldsSet.test(FieldBit_Reviewed))
+    {
+        
+        writer.key(_XPLATSTR("reviewed"));
+        ModelBase::writeJson(writer, m_Reviewed);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
+    {
+        
+        writer.key(_XPLATSTR("urlIdRaw"));
+        ModelBase::writeJson(writer, m_UrlIdRaw);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
+    {
+        
+        writer.key(_XPLATSTR("verifiedDate"));
+        ModelBase::writeJson(writer, m_VerifiedDate);
+    }
+    if(m_FieldsSet.test(FieldBit_Votes))
+    {
+        
+        writer.key(_XPLATSTR("votes"));
+        ModelBase::writeJson(writer, m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        writer.key(_XPLATSTR("votesDown"));
+        ModelBase::writeJson(writer, m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        writer.key(_XPLATSTR("votesUp"));
+        ModelBase::writeJson(writer, m_VotesUp);
+    }
+
+    writer.endObject();
+}
+
 bool APIComment::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setAiDeterminedSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAiDeterminedSpam);
-            setAiDeterminedSpam(refVal_setAiDeterminedSpam);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("aiDeterminedSpam")):
+            if(field.first == _XPLATSTR("aiDeterminedSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAiDeterminedSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAiDeterminedSpam);
+                    setAiDeterminedSpam(refVal_setAiDeterminedSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            if(field.first == _XPLATSTR("approved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
+                    setApproved(refVal_setApproved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_AvatarSrc);
+                    m_FieldsSet.set(FieldBit_AvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            if(field.first == _XPLATSTR("commentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
+                    setCommentHTML(refVal_setCommentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            if(field.first == _XPLATSTR("commenterEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
+                    setCommenterEmail(refVal_setCommenterEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            if(field.first == _XPLATSTR("commenterLink"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterLink;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
+                    setCommenterLink(refVal_setCommenterLink);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_CommenterName);
+                    m_FieldsSet.set(FieldBit_CommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("externalId")):
+            if(field.first == _XPLATSTR("externalId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setExternalId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExternalId);
+                    setExternalId(refVal_setExternalId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("externalParentId")):
+            if(field.first == _XPLATSTR("externalParentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setExternalParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExternalParentId);
+                    setExternalParentId(refVal_setExternalParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            if(field.first == _XPLATSTR("expireAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setExpireAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
+                    setExpireAt(refVal_setExpireAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            if(field.first == _XPLATSTR("feedbackIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
+                    setFeedbackIds(refVal_setFeedbackIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            if(field.first == _XPLATSTR("flagCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setFlagCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
+                    setFlagCount(refVal_setFlagCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromProductId")):
+            if(field.first == _XPLATSTR("fromProductId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setFromProductId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromProductId);
+                    setFromProductId(refVal_setFromProductId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            if(field.first == _XPLATSTR("hasCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
+                    setHasCode(refVal_setHasCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            if(field.first == _XPLATSTR("hasImages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasImages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
+                    setHasImages(refVal_setHasImages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            if(field.first == _XPLATSTR("hasLinks"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
+                    setHasLinks(refVal_setHasLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            if(field.first == _XPLATSTR("hashTags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
+                    setHashTags(refVal_setHashTags);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            if(field.first == _XPLATSTR("isByAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
+                    setIsByAdmin(refVal_setIsByAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            if(field.first == _XPLATSTR("isByModerator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByModerator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
+                    setIsByModerator(refVal_setIsByModerator);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            if(field.first == _XPLATSTR("isDeleted"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeleted;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
+                    setIsDeleted(refVal_setIsDeleted);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            if(field.first == _XPLATSTR("isDeletedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeletedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
+                    setIsDeletedUser(refVal_setIsDeletedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            if(field.first == _XPLATSTR("isPinned"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsPinned;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
+                    setIsPinned(refVal_setIsPinned);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            if(field.first == _XPLATSTR("isLocked"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLocked;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
+                    setIsLocked(refVal_setIsLocked);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            if(field.first == _XPLATSTR("isSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
+                    setIsSpam(refVal_setIsSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            if(field.first == _XPLATSTR("localDateHours"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setLocalDateHours;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
+                    setLocalDateHours(refVal_setLocalDateHours);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            if(field.first == _XPLATSTR("localDateString"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocalDateString;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
+                    setLocalDateString(refVal_setLocalDateString);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            if(field.first == _XPLATSTR("mentions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
+                    setMentions(refVal_setMentions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APICommentBase_meta> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            if(field.first == _XPLATSTR("moderationGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModerationGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
+                    setModerationGroupIds(refVal_setModerationGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParent")):
+            if(field.first == _XPLATSTR("notificationSentForParent"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNotificationSentForParent;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParent);
+                    setNotificationSentForParent(refVal_setNotificationSentForParent);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParentTenant")):
+            if(field.first == _XPLATSTR("notificationSentForParentTenant"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNotificationSentForParentTenant;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParentTenant);
+                    setNotificationSentForParentTenant(refVal_setNotificationSentForParentTenant);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_PageTitle);
+                    m_FieldsSet.set(FieldBit_PageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            if(field.first == _XPLATSTR("parentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
+                    setParentId(refVal_setParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            if(field.first == _XPLATSTR("rating"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setRating;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
+                    setRating(refVal_setRating);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            if(field.first == _XPLATSTR("reviewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
+                    setReviewed(refVal_setReviewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_TenantId);
+                    m_FieldsSet.set(FieldBit_TenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_Url);
+                    m_FieldsSet.set(FieldBit_Url);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_UrlId);
+                    m_FieldsSet.set(FieldBit_UrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdRaw")):
+            if(field.first == _XPLATSTR("urlIdRaw"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_UrlIdRaw);
+                    m_FieldsSet.set(FieldBit_UrlIdRaw);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verifiedDate")):
+            if(field.first == _XPLATSTR("verifiedDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setVerifiedDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerifiedDate);
+                    setVerifiedDate(refVal_setVerifiedDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            if(field.first == _XPLATSTR("votes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
+                    setVotes(refVal_setVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            if(field.first == _XPLATSTR("votesDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
+                    setVotesDown(refVal_setVotesDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            if(field.first == _XPLATSTR("votesUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
+                    setVotesUp(refVal_setVotesUp);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    return ok;
+}
+
+void APIComment::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approved"))))
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approved")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
-            setApproved(refVal_setApproved);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("aiDeterminedSpam")), m_AiDeterminedSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approved")), m_Approved);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentHTML"))))
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentHTML")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
-            setCommentHTML(refVal_setCommentHTML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
-            setCommenterEmail(refVal_setCommenterEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterLink"))))
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterLink")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterLink;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
-            setCommenterLink(refVal_setCommenterLink);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentHTML")), m_CommentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterEmail")), m_CommenterEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterLink")), m_CommenterLink);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("externalId"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("externalId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setExternalId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExternalId);
-            setExternalId(refVal_setExternalId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("externalParentId"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("externalParentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setExternalParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExternalParentId);
-            setExternalParentId(refVal_setExternalParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expireAt"))))
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expireAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setExpireAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
-            setExpireAt(refVal_setExpireAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("externalId")), m_ExternalId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))))
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
-            setFeedbackIds(refVal_setFeedbackIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("externalParentId")), m_ExternalParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flagCount"))))
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flagCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setFlagCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
-            setFlagCount(refVal_setFlagCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expireAt")), m_ExpireAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromProductId"))))
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromProductId")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setFromProductId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromProductId);
-            setFromProductId(refVal_setFromProductId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackIds")), m_FeedbackIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasCode"))))
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasCode")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
-            setHasCode(refVal_setHasCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flagCount")), m_FlagCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasImages"))))
+    if(m_FieldsSet.test(FieldBit_FromProductId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasImages")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasImages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
-            setHasImages(refVal_setHasImages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromProductId")), m_FromProductId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasLinks"))))
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasLinks")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
-            setHasLinks(refVal_setHasLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasCode")), m_HasCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTags"))))
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTags")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
-            setHashTags(refVal_setHashTags);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasImages")), m_HasImages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))))
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
-            setIsByAdmin(refVal_setIsByAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasLinks")), m_HasLinks);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByModerator"))))
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByModerator")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByModerator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
-            setIsByModerator(refVal_setIsByModerator);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTags")), m_HashTags);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeleted"))))
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeleted")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeleted;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
-            setIsDeleted(refVal_setIsDeleted);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByAdmin")), m_IsByAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))))
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeletedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
-            setIsDeletedUser(refVal_setIsDeletedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByModerator")), m_IsByModerator);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isPinned"))))
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isPinned")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsPinned;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
-            setIsPinned(refVal_setIsPinned);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeleted")), m_IsDeleted);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLocked"))))
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLocked")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLocked;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
-            setIsLocked(refVal_setIsLocked);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeletedUser")), m_IsDeletedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSpam"))))
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
-            setIsSpam(refVal_setIsSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isPinned")), m_IsPinned);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateHours"))))
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateHours")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setLocalDateHours;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
-            setLocalDateHours(refVal_setLocalDateHours);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLocked")), m_IsLocked);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateString"))))
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateString")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocalDateString;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
-            setLocalDateString(refVal_setLocalDateString);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSpam")), m_IsSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateHours")), m_LocalDateHours);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("mentions"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("mentions")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
-            setMentions(refVal_setMentions);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateString")), m_LocalDateString);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APICommentBase_meta> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))))
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModerationGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
-            setModerationGroupIds(refVal_setModerationGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("mentions")), m_Mentions);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent"))))
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNotificationSentForParent;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParent);
-            setNotificationSentForParent(refVal_setNotificationSentForParent);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant"))))
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNotificationSentForParentTenant;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParentTenant);
-            setNotificationSentForParentTenant(refVal_setNotificationSentForParentTenant);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationSentForParent")), m_NotificationSentForParent);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("parentId"))))
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("parentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
-            setParentId(refVal_setParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationSentForParentTenant")), m_NotificationSentForParentTenant);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rating"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rating")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setRating;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
-            setRating(refVal_setRating);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewed"))))
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
-            setReviewed(refVal_setReviewed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("parentId")), m_ParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rating")), m_Rating);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewed")), m_Reviewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdRaw"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdRaw")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdRaw;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdRaw);
-            setUrlIdRaw(refVal_setUrlIdRaw);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdRaw")), m_UrlIdRaw);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verifiedDate"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verifiedDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setVerifiedDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerifiedDate);
-            setVerifiedDate(refVal_setVerifiedDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votes"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votes")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
-            setVotes(refVal_setVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDown"))))
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDown")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
-            setVotesDown(refVal_setVotesDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verifiedDate")), m_VerifiedDate);
+    }
+    if(m_FieldsSet.test(FieldBit_Votes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votes")), m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDown")), m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUp")), m_VotesUp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUp"))))
+}
+
+bool APIComment::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUp")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            int32_t refVal_setVotesUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
-            setVotesUp(refVal_setVotesUp);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("aiDeterminedSpam")):
+            {
+                bool refVal_setAiDeterminedSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setAiDeterminedSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAiDeterminedSpam(refVal_setAiDeterminedSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            {
+                bool refVal_setApproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setApproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApproved(refVal_setApproved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_AvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_AvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                utility::string_t refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            {
+                utility::string_t refVal_setCommentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentHTML(refVal_setCommentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            {
+                utility::string_t refVal_setCommenterEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterEmail(refVal_setCommenterEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            {
+                utility::string_t refVal_setCommenterLink;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterLink))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterLink(refVal_setCommenterLink);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_CommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_CommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                double refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("externalId")):
+            {
+                utility::string_t refVal_setExternalId;
+                if(!ModelBase::readBinary(reader, field, refVal_setExternalId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExternalId(refVal_setExternalId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("externalParentId")):
+            {
+                utility::string_t refVal_setExternalParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setExternalParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExternalParentId(refVal_setExternalParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            {
+                utility::datetime refVal_setExpireAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpireAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpireAt(refVal_setExpireAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackIds(refVal_setFeedbackIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            {
+                int32_t refVal_setFlagCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlagCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlagCount(refVal_setFlagCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromProductId")):
+            {
+                int32_t refVal_setFromProductId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromProductId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromProductId(refVal_setFromProductId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            {
+                bool refVal_setHasCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasCode(refVal_setHasCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            {
+                bool refVal_setHasImages;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasImages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasImages(refVal_setHasImages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            {
+                bool refVal_setHasLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasLinks(refVal_setHasLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            {
+                std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTags(refVal_setHashTags);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            {
+                bool refVal_setIsByAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByAdmin(refVal_setIsByAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            {
+                bool refVal_setIsByModerator;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByModerator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByModerator(refVal_setIsByModerator);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            {
+                bool refVal_setIsDeleted;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeleted))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeleted(refVal_setIsDeleted);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            {
+                bool refVal_setIsDeletedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeletedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeletedUser(refVal_setIsDeletedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            {
+                bool refVal_setIsPinned;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsPinned))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsPinned(refVal_setIsPinned);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            {
+                bool refVal_setIsLocked;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLocked))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLocked(refVal_setIsLocked);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            {
+                bool refVal_setIsSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSpam(refVal_setIsSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            {
+                int32_t refVal_setLocalDateHours;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateHours))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateHours(refVal_setLocalDateHours);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            {
+                utility::string_t refVal_setLocalDateString;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateString))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateString(refVal_setLocalDateString);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            {
+                std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                if(!ModelBase::readBinary(reader, field, refVal_setMentions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMentions(refVal_setMentions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::shared_ptr<APICommentBase_meta> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setModerationGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationGroupIds(refVal_setModerationGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParent")):
+            {
+                bool refVal_setNotificationSentForParent;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationSentForParent))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationSentForParent(refVal_setNotificationSentForParent);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParentTenant")):
+            {
+                bool refVal_setNotificationSentForParentTenant;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationSentForParentTenant))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationSentForParentTenant(refVal_setNotificationSentForParentTenant);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_PageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_PageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            {
+                utility::string_t refVal_setParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setParentId(refVal_setParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            {
+                double refVal_setRating;
+                if(!ModelBase::readBinary(reader, field, refVal_setRating))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRating(refVal_setRating);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            {
+                bool refVal_setReviewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewed(refVal_setReviewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_TenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_TenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_Url))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_Url);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_UrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_UrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdRaw")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_UrlIdRaw))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_UrlIdRaw);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verifiedDate")):
+            {
+                utility::datetime refVal_setVerifiedDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerifiedDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerifiedDate(refVal_setVerifiedDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            {
+                int32_t refVal_setVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotes(refVal_setVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            {
+                int32_t refVal_setVotesDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDown(refVal_setVotesDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            {
+                int32_t refVal_setVotesUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUp(refVal_setVotesUp);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -950,217 +2169,217 @@ void APIComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_AiDeterminedSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam")), m_AiDeterminedSpam));
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approved")), m_Approved));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentHTML")), m_CommentHTML));
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail));
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_ExternalIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalId")), m_ExternalId));
     }
-    if(m_ExternalParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalParentId")), m_ExternalParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalParentId")), m_ExternalParentId));
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt));
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackIds")), m_FeedbackIds));
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount));
     }
-    if(m_FromProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromProductId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromProductId")), m_FromProductId));
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasCode")), m_HasCode));
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasImages")), m_HasImages));
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasLinks")), m_HasLinks));
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTags")), m_HashTags));
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByAdmin")), m_IsByAdmin));
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByModerator")), m_IsByModerator));
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeleted")), m_IsDeleted));
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")), m_IsDeletedUser));
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned));
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked));
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSpam")), m_IsSpam));
     }
-    if(m_LocalDateHours.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateHours")), m_LocalDateHours.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateHours")), m_LocalDateHours));
     }
-    if(m_LocalDateString.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString));
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("mentions")), m_Mentions));
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
-    if(m_ModerationGroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds));
     }
-    if(m_NotificationSentForParentIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent")), m_NotificationSentForParent));
     }
-    if(m_NotificationSentForParentTenantIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant")), m_NotificationSentForParentTenant));
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId));
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating));
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewed")), m_Reviewed));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_UrlIdRawIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdRaw")), m_UrlIdRaw));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_VerifiedDate.has_value())
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verifiedDate")), m_VerifiedDate.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verifiedDate")), m_VerifiedDate));
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes));
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown));
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp));
     }
 }
 
@@ -1504,17 +2723,17 @@ utility::string_t APIComment::getId() const
 void APIComment::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool APIComment::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void APIComment::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 bool APIComment::isAiDeterminedSpam() const
 {
@@ -1524,37 +2743,38 @@ bool APIComment::isAiDeterminedSpam() const
 void APIComment::setAiDeterminedSpam(bool value)
 {
     m_AiDeterminedSpam = value;
-    m_AiDeterminedSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_AiDeterminedSpam);
 }
 
 bool APIComment::aiDeterminedSpamIsSet() const
 {
-    return m_AiDeterminedSpamIsSet;
+    return m_FieldsSet.test(FieldBit_AiDeterminedSpam);
 }
 
 void APIComment::unsetAiDeterminedSpam()
 {
-    m_AiDeterminedSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_AiDeterminedSpam);
 }
 utility::string_t APIComment::getAnonUserId() const
 {
-    return m_AnonUserId.get();
+    return m_AnonUserId;
 }
 
 
 void APIComment::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool APIComment::anonUserIdIsSet() const
 {
-    return m_AnonUserId.has_value();
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void APIComment::unsetAnonUserId()
 {
-    m_AnonUserId.reset();
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 bool APIComment::isApproved() const
 {
@@ -1564,57 +2784,59 @@ bool APIComment::isApproved() const
 void APIComment::setApproved(bool value)
 {
     m_Approved = value;
-    m_ApprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_Approved);
 }
 
 bool APIComment::approvedIsSet() const
 {
-    return m_ApprovedIsSet;
+    return m_FieldsSet.test(FieldBit_Approved);
 }
 
 void APIComment::unsetApproved()
 {
-    m_ApprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Approved);
 }
 utility::string_t APIComment::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void APIComment::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool APIComment::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void APIComment::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> APIComment::getBadges() const
 {
-    return m_Badges.get();
+    return m_Badges;
 }
 
 
 void APIComment::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool APIComment::badgesIsSet() const
 {
-    return m_Badges.has_value();
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void APIComment::unsetBadges()
 {
-    m_Badges.reset();
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 utility::string_t APIComment::getComment() const
 {
@@ -1625,17 +2847,17 @@ utility::string_t APIComment::getComment() const
 void APIComment::setComment(const utility::string_t& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool APIComment::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void APIComment::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 utility::string_t APIComment::getCommentHTML() const
 {
@@ -1646,57 +2868,59 @@ utility::string_t APIComment::getCommentHTML() const
 void APIComment::setCommentHTML(const utility::string_t& value)
 {
     m_CommentHTML = value;
-    m_CommentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentHTML);
 }
 
 bool APIComment::commentHTMLIsSet() const
 {
-    return m_CommentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_CommentHTML);
 }
 
 void APIComment::unsetCommentHTML()
 {
-    m_CommentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentHTML);
 }
 utility::string_t APIComment::getCommenterEmail() const
 {
-    return m_CommenterEmail.get();
+    return m_CommenterEmail;
 }
 
 
 void APIComment::setCommenterEmail(const utility::string_t& value)
 {
     m_CommenterEmail = value;
+    m_FieldsSet.set(FieldBit_CommenterEmail);
 }
 
 bool APIComment::commenterEmailIsSet() const
 {
-    return m_CommenterEmail.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterEmail);
 }
 
 void APIComment::unsetCommenterEmail()
 {
-    m_CommenterEmail.reset();
+    m_FieldsSet.reset(FieldBit_CommenterEmail);
 }
 utility::string_t APIComment::getCommenterLink() const
 {
-    return m_CommenterLink.get();
+    return m_CommenterLink;
 }
 
 
 void APIComment::setCommenterLink(const utility::string_t& value)
 {
     m_CommenterLink = value;
+    m_FieldsSet.set(FieldBit_CommenterLink);
 }
 
 bool APIComment::commenterLinkIsSet() const
 {
-    return m_CommenterLink.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterLink);
 }
 
 void APIComment::unsetCommenterLink()
 {
-    m_CommenterLink.reset();
+    m_FieldsSet.reset(FieldBit_CommenterLink);
 }
 utility::string_t APIComment::getCommenterName() const
 {
@@ -1707,76 +2931,79 @@ utility::string_t APIComment::getCommenterName() const
 void APIComment::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool APIComment::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void APIComment::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 double APIComment::getDate() const
 {
-    return m_date.get();
+    return m_date;
 }
 
 void APIComment::setDate(double value)
 {
     m_date = value;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool APIComment::dateIsSet() const
 {
-    return m_date.has_value();
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void APIComment::unsetdate()
 {
-    m_date.reset();
+    m_FieldsSet.reset(FieldBit_date);
 }
 utility::string_t APIComment::getDisplayLabel() const
 {
-    return m_DisplayLabel.get();
+    return m_DisplayLabel;
 }
 
 
 void APIComment::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool APIComment::displayLabelIsSet() const
 {
-    return m_DisplayLabel.has_value();
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void APIComment::unsetDisplayLabel()
 {
-    m_DisplayLabel.reset();
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 utility::string_t APIComment::getDomain() const
 {
-    return m_Domain.get();
+    return m_Domain;
 }
 
 
 void APIComment::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool APIComment::domainIsSet() const
 {
-    return m_Domain.has_value();
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void APIComment::unsetDomain()
 {
-    m_Domain.reset();
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t APIComment::getExternalId() const
 {
@@ -1787,57 +3014,59 @@ utility::string_t APIComment::getExternalId() const
 void APIComment::setExternalId(const utility::string_t& value)
 {
     m_ExternalId = value;
-    m_ExternalIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ExternalId);
 }
 
 bool APIComment::externalIdIsSet() const
 {
-    return m_ExternalIdIsSet;
+    return m_FieldsSet.test(FieldBit_ExternalId);
 }
 
 void APIComment::unsetExternalId()
 {
-    m_ExternalIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ExternalId);
 }
 utility::string_t APIComment::getExternalParentId() const
 {
-    return m_ExternalParentId.get();
+    return m_ExternalParentId;
 }
 
 
 void APIComment::setExternalParentId(const utility::string_t& value)
 {
     m_ExternalParentId = value;
+    m_FieldsSet.set(FieldBit_ExternalParentId);
 }
 
 bool APIComment::externalParentIdIsSet() const
 {
-    return m_ExternalParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ExternalParentId);
 }
 
 void APIComment::unsetExternalParentId()
 {
-    m_ExternalParentId.reset();
+    m_FieldsSet.reset(FieldBit_ExternalParentId);
 }
 utility::datetime APIComment::getExpireAt() const
 {
-    return m_ExpireAt.get();
+    return m_ExpireAt;
 }
 
 
 void APIComment::setExpireAt(const utility::datetime& value)
 {
     m_ExpireAt = value;
+    m_FieldsSet.set(FieldBit_ExpireAt);
 }
 
 bool APIComment::expireAtIsSet() const
 {
-    return m_ExpireAt.has_value();
+    return m_FieldsSet.test(FieldBit_ExpireAt);
 }
 
 void APIComment::unsetExpireAt()
 {
-    m_ExpireAt.reset();
+    m_FieldsSet.reset(FieldBit_ExpireAt);
 }
 std::vector<utility::string_t> APIComment::getFeedbackIds() const
 {
@@ -1848,36 +3077,37 @@ std::vector<utility::string_t> APIComment::getFeedbackIds() const
 void APIComment::setFeedbackIds(const std::vector<utility::string_t>& value)
 {
     m_FeedbackIds = value;
-    m_FeedbackIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackIds);
 }
 
 bool APIComment::feedbackIdsIsSet() const
 {
-    return m_FeedbackIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackIds);
 }
 
 void APIComment::unsetFeedbackIds()
 {
-    m_FeedbackIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackIds);
 }
 int32_t APIComment::getFlagCount() const
 {
-    return m_FlagCount.get();
+    return m_FlagCount;
 }
 
 void APIComment::setFlagCount(int32_t value)
 {
     m_FlagCount = value;
+    m_FieldsSet.set(FieldBit_FlagCount);
 }
 
 bool APIComment::flagCountIsSet() const
 {
-    return m_FlagCount.has_value();
+    return m_FieldsSet.test(FieldBit_FlagCount);
 }
 
 void APIComment::unsetFlagCount()
 {
-    m_FlagCount.reset();
+    m_FieldsSet.reset(FieldBit_FlagCount);
 }
 int32_t APIComment::getFromProductId() const
 {
@@ -1887,17 +3117,17 @@ int32_t APIComment::getFromProductId() const
 void APIComment::setFromProductId(int32_t value)
 {
     m_FromProductId = value;
-    m_FromProductIdIsSet = true;
+    m_FieldsSet.set(FieldBit_FromProductId);
 }
 
 bool APIComment::fromProductIdIsSet() const
 {
-    return m_FromProductIdIsSet;
+    return m_FieldsSet.test(FieldBit_FromProductId);
 }
 
 void APIComment::unsetFromProductId()
 {
-    m_FromProductIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromProductId);
 }
 bool APIComment::isHasCode() const
 {
@@ -1907,17 +3137,17 @@ bool APIComment::isHasCode() const
 void APIComment::setHasCode(bool value)
 {
     m_HasCode = value;
-    m_HasCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_HasCode);
 }
 
 bool APIComment::hasCodeIsSet() const
 {
-    return m_HasCodeIsSet;
+    return m_FieldsSet.test(FieldBit_HasCode);
 }
 
 void APIComment::unsetHasCode()
 {
-    m_HasCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasCode);
 }
 bool APIComment::isHasImages() const
 {
@@ -1927,17 +3157,17 @@ bool APIComment::isHasImages() const
 void APIComment::setHasImages(bool value)
 {
     m_HasImages = value;
-    m_HasImagesIsSet = true;
+    m_FieldsSet.set(FieldBit_HasImages);
 }
 
 bool APIComment::hasImagesIsSet() const
 {
-    return m_HasImagesIsSet;
+    return m_FieldsSet.test(FieldBit_HasImages);
 }
 
 void APIComment::unsetHasImages()
 {
-    m_HasImagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasImages);
 }
 bool APIComment::isHasLinks() const
 {
@@ -1947,17 +3177,17 @@ bool APIComment::isHasLinks() const
 void APIComment::setHasLinks(bool value)
 {
     m_HasLinks = value;
-    m_HasLinksIsSet = true;
+    m_FieldsSet.set(FieldBit_HasLinks);
 }
 
 bool APIComment::hasLinksIsSet() const
 {
-    return m_HasLinksIsSet;
+    return m_FieldsSet.test(FieldBit_HasLinks);
 }
 
 void APIComment::unsetHasLinks()
 {
-    m_HasLinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasLinks);
 }
 std::vector<std::shared_ptr<CommentUserHashTagInfo>> APIComment::getHashTags() const
 {
@@ -1968,17 +3198,17 @@ std::vector<std::shared_ptr<CommentUserHashTagInfo>> APIComment::getHashTags() c
 void APIComment::setHashTags(const std::vector<std::shared_ptr<CommentUserHashTagInfo>>& value)
 {
     m_HashTags = value;
-    m_HashTagsIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTags);
 }
 
 bool APIComment::hashTagsIsSet() const
 {
-    return m_HashTagsIsSet;
+    return m_FieldsSet.test(FieldBit_HashTags);
 }
 
 void APIComment::unsetHashTags()
 {
-    m_HashTagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTags);
 }
 bool APIComment::isIsByAdmin() const
 {
@@ -1988,17 +3218,17 @@ bool APIComment::isIsByAdmin() const
 void APIComment::setIsByAdmin(bool value)
 {
     m_IsByAdmin = value;
-    m_IsByAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByAdmin);
 }
 
 bool APIComment::isByAdminIsSet() const
 {
-    return m_IsByAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsByAdmin);
 }
 
 void APIComment::unsetIsByAdmin()
 {
-    m_IsByAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByAdmin);
 }
 bool APIComment::isIsByModerator() const
 {
@@ -2008,17 +3238,17 @@ bool APIComment::isIsByModerator() const
 void APIComment::setIsByModerator(bool value)
 {
     m_IsByModerator = value;
-    m_IsByModeratorIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByModerator);
 }
 
 bool APIComment::isByModeratorIsSet() const
 {
-    return m_IsByModeratorIsSet;
+    return m_FieldsSet.test(FieldBit_IsByModerator);
 }
 
 void APIComment::unsetIsByModerator()
 {
-    m_IsByModeratorIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByModerator);
 }
 bool APIComment::isIsDeleted() const
 {
@@ -2028,17 +3258,17 @@ bool APIComment::isIsDeleted() const
 void APIComment::setIsDeleted(bool value)
 {
     m_IsDeleted = value;
-    m_IsDeletedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeleted);
 }
 
 bool APIComment::isDeletedIsSet() const
 {
-    return m_IsDeletedIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeleted);
 }
 
 void APIComment::unsetIsDeleted()
 {
-    m_IsDeletedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeleted);
 }
 bool APIComment::isIsDeletedUser() const
 {
@@ -2048,55 +3278,57 @@ bool APIComment::isIsDeletedUser() const
 void APIComment::setIsDeletedUser(bool value)
 {
     m_IsDeletedUser = value;
-    m_IsDeletedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeletedUser);
 }
 
 bool APIComment::isDeletedUserIsSet() const
 {
-    return m_IsDeletedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeletedUser);
 }
 
 void APIComment::unsetIsDeletedUser()
 {
-    m_IsDeletedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeletedUser);
 }
 bool APIComment::isIsPinned() const
 {
-    return m_IsPinned.get();
+    return m_IsPinned;
 }
 
 void APIComment::setIsPinned(bool value)
 {
     m_IsPinned = value;
+    m_FieldsSet.set(FieldBit_IsPinned);
 }
 
 bool APIComment::isPinnedIsSet() const
 {
-    return m_IsPinned.has_value();
+    return m_FieldsSet.test(FieldBit_IsPinned);
 }
 
 void APIComment::unsetIsPinned()
 {
-    m_IsPinned.reset();
+    m_FieldsSet.reset(FieldBit_IsPinned);
 }
 bool APIComment::isIsLocked() const
 {
-    return m_IsLocked.get();
+    return m_IsLocked;
 }
 
 void APIComment::setIsLocked(bool value)
 {
     m_IsLocked = value;
+    m_FieldsSet.set(FieldBit_IsLocked);
 }
 
 bool APIComment::isLockedIsSet() const
 {
-    return m_IsLocked.has_value();
+    return m_FieldsSet.test(FieldBit_IsLocked);
 }
 
 void APIComment::unsetIsLocked()
 {
-    m_IsLocked.reset();
+    m_FieldsSet.reset(FieldBit_IsLocked);
 }
 bool APIComment::isIsSpam() const
 {
@@ -2106,76 +3338,79 @@ bool APIComment::isIsSpam() const
 void APIComment::setIsSpam(bool value)
 {
     m_IsSpam = value;
-    m_IsSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSpam);
 }
 
 bool APIComment::isSpamIsSet() const
 {
-    return m_IsSpamIsSet;
+    return m_FieldsSet.test(FieldBit_IsSpam);
 }
 
 void APIComment::unsetIsSpam()
 {
-    m_IsSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSpam);
 }
 int32_t APIComment::getLocalDateHours() const
 {
-    return m_LocalDateHours.get();
+    return m_LocalDateHours;
 }
 
 void APIComment::setLocalDateHours(int32_t value)
 {
     m_LocalDateHours = value;
+    m_FieldsSet.set(FieldBit_LocalDateHours);
 }
 
 bool APIComment::localDateHoursIsSet() const
 {
-    return m_LocalDateHours.has_value();
+    return m_FieldsSet.test(FieldBit_LocalDateHours);
 }
 
 void APIComment::unsetLocalDateHours()
 {
-    m_LocalDateHours.reset();
+    m_FieldsSet.reset(FieldBit_LocalDateHours);
 }
 utility::string_t APIComment::getLocalDateString() const
 {
-    return m_LocalDateString.get();
+    return m_LocalDateString;
 }
 
 
 void APIComment::setLocalDateString(const utility::string_t& value)
 {
     m_LocalDateString = value;
+    m_FieldsSet.set(FieldBit_LocalDateString);
 }
 
 bool APIComment::localDateStringIsSet() const
 {
-    return m_LocalDateString.has_value();
+    return m_FieldsSet.test(FieldBit_LocalDateString);
 }
 
 void APIComment::unsetLocalDateString()
 {
-    m_LocalDateString.reset();
+    m_FieldsSet.reset(FieldBit_LocalDateString);
 }
 utility::string_t APIComment::getLocale() const
 {
-    return m_Locale.get();
+    return m_Locale;
 }
 
 
 void APIComment::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool APIComment::localeIsSet() const
 {
-    return m_Locale.has_value();
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void APIComment::unsetLocale()
 {
-    m_Locale.reset();
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 std::vector<std::shared_ptr<CommentUserMentionInfo>> APIComment::getMentions() const
 {
@@ -2186,57 +3421,59 @@ std::vector<std::shared_ptr<CommentUserMentionInfo>> APIComment::getMentions() c
 void APIComment::setMentions(const std::vector<std::shared_ptr<CommentUserMentionInfo>>& value)
 {
     m_Mentions = value;
-    m_MentionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Mentions);
 }
 
 bool APIComment::mentionsIsSet() const
 {
-    return m_MentionsIsSet;
+    return m_FieldsSet.test(FieldBit_Mentions);
 }
 
 void APIComment::unsetMentions()
 {
-    m_MentionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Mentions);
 }
 std::shared_ptr<APICommentBase_meta> APIComment::getMeta() const
 {
-    return m_Meta.get();
+    return m_Meta;
 }
 
 
 void APIComment::setMeta(const std::shared_ptr<APICommentBase_meta>& value)
 {
     m_Meta = value;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool APIComment::metaIsSet() const
 {
-    return m_Meta.has_value();
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void APIComment::unsetMeta()
 {
-    m_Meta.reset();
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 std::vector<utility::string_t> APIComment::getModerationGroupIds() const
 {
-    return m_ModerationGroupIds.get();
+    return m_ModerationGroupIds;
 }
 
 
 void APIComment::setModerationGroupIds(const std::vector<utility::string_t>& value)
 {
     m_ModerationGroupIds = value;
+    m_FieldsSet.set(FieldBit_ModerationGroupIds);
 }
 
 bool APIComment::moderationGroupIdsIsSet() const
 {
-    return m_ModerationGroupIds.has_value();
+    return m_FieldsSet.test(FieldBit_ModerationGroupIds);
 }
 
 void APIComment::unsetModerationGroupIds()
 {
-    m_ModerationGroupIds.reset();
+    m_FieldsSet.reset(FieldBit_ModerationGroupIds);
 }
 bool APIComment::isNotificationSentForParent() const
 {
@@ -2246,17 +3483,17 @@ bool APIComment::isNotificationSentForParent() const
 void APIComment::setNotificationSentForParent(bool value)
 {
     m_NotificationSentForParent = value;
-    m_NotificationSentForParentIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationSentForParent);
 }
 
 bool APIComment::notificationSentForParentIsSet() const
 {
-    return m_NotificationSentForParentIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationSentForParent);
 }
 
 void APIComment::unsetNotificationSentForParent()
 {
-    m_NotificationSentForParentIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationSentForParent);
 }
 bool APIComment::isNotificationSentForParentTenant() const
 {
@@ -2266,76 +3503,79 @@ bool APIComment::isNotificationSentForParentTenant() const
 void APIComment::setNotificationSentForParentTenant(bool value)
 {
     m_NotificationSentForParentTenant = value;
-    m_NotificationSentForParentTenantIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationSentForParentTenant);
 }
 
 bool APIComment::notificationSentForParentTenantIsSet() const
 {
-    return m_NotificationSentForParentTenantIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationSentForParentTenant);
 }
 
 void APIComment::unsetNotificationSentForParentTenant()
 {
-    m_NotificationSentForParentTenantIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationSentForParentTenant);
 }
 utility::string_t APIComment::getPageTitle() const
 {
-    return m_PageTitle.get();
+    return m_PageTitle;
 }
 
 
 void APIComment::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool APIComment::pageTitleIsSet() const
 {
-    return m_PageTitle.has_value();
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void APIComment::unsetPageTitle()
 {
-    m_PageTitle.reset();
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 utility::string_t APIComment::getParentId() const
 {
-    return m_ParentId.get();
+    return m_ParentId;
 }
 
 
 void APIComment::setParentId(const utility::string_t& value)
 {
     m_ParentId = value;
+    m_FieldsSet.set(FieldBit_ParentId);
 }
 
 bool APIComment::parentIdIsSet() const
 {
-    return m_ParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ParentId);
 }
 
 void APIComment::unsetParentId()
 {
-    m_ParentId.reset();
+    m_FieldsSet.reset(FieldBit_ParentId);
 }
 double APIComment::getRating() const
 {
-    return m_Rating.get();
+    return m_Rating;
 }
 
 void APIComment::setRating(double value)
 {
     m_Rating = value;
+    m_FieldsSet.set(FieldBit_Rating);
 }
 
 bool APIComment::ratingIsSet() const
 {
-    return m_Rating.has_value();
+    return m_FieldsSet.test(FieldBit_Rating);
 }
 
 void APIComment::unsetRating()
 {
-    m_Rating.reset();
+    m_FieldsSet.reset(FieldBit_Rating);
 }
 bool APIComment::isReviewed() const
 {
@@ -2345,17 +3585,17 @@ bool APIComment::isReviewed() const
 void APIComment::setReviewed(bool value)
 {
     m_Reviewed = value;
-    m_ReviewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Reviewed);
 }
 
 bool APIComment::reviewedIsSet() const
 {
-    return m_ReviewedIsSet;
+    return m_FieldsSet.test(FieldBit_Reviewed);
 }
 
 void APIComment::unsetReviewed()
 {
-    m_ReviewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reviewed);
 }
 utility::string_t APIComment::getTenantId() const
 {
@@ -2366,17 +3606,17 @@ utility::string_t APIComment::getTenantId() const
 void APIComment::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool APIComment::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void APIComment::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t APIComment::getUrl() const
 {
@@ -2387,17 +3627,17 @@ utility::string_t APIComment::getUrl() const
 void APIComment::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool APIComment::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void APIComment::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t APIComment::getUrlId() const
 {
@@ -2408,17 +3648,17 @@ utility::string_t APIComment::getUrlId() const
 void APIComment::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool APIComment::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void APIComment::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t APIComment::getUrlIdRaw() const
 {
@@ -2429,37 +3669,38 @@ utility::string_t APIComment::getUrlIdRaw() const
 void APIComment::setUrlIdRaw(const utility::string_t& value)
 {
     m_UrlIdRaw = value;
-    m_UrlIdRawIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdRaw);
 }
 
 bool APIComment::urlIdRawIsSet() const
 {
-    return m_UrlIdRawIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdRaw);
 }
 
 void APIComment::unsetUrlIdRaw()
 {
-    m_UrlIdRawIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdRaw);
 }
 utility::string_t APIComment::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void APIComment::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool APIComment::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void APIComment::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 bool APIComment::isVerified() const
 {
@@ -2469,94 +3710,98 @@ bool APIComment::isVerified() const
 void APIComment::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool APIComment::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void APIComment::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 utility::datetime APIComment::getVerifiedDate() const
 {
-    return m_VerifiedDate.get();
+    return m_VerifiedDate;
 }
 
 
 void APIComment::setVerifiedDate(const utility::datetime& value)
 {
     m_VerifiedDate = value;
+    m_FieldsSet.set(FieldBit_VerifiedDate);
 }
 
 bool APIComment::verifiedDateIsSet() const
 {
-    return m_VerifiedDate.has_value();
+    return m_FieldsSet.test(FieldBit_VerifiedDate);
 }
 
 void APIComment::unsetVerifiedDate()
 {
-    m_VerifiedDate.reset();
+    m_FieldsSet.reset(FieldBit_VerifiedDate);
 }
 int32_t APIComment::getVotes() const
 {
-    return m_Votes.get();
+    return m_Votes;
 }
 
 void APIComment::setVotes(int32_t value)
 {
     m_Votes = value;
+    m_FieldsSet.set(FieldBit_Votes);
 }
 
 bool APIComment::votesIsSet() const
 {
-    return m_Votes.has_value();
+    return m_FieldsSet.test(FieldBit_Votes);
 }
 
 void APIComment::unsetVotes()
 {
-    m_Votes.reset();
+    m_FieldsSet.reset(FieldBit_Votes);
 }
 int32_t APIComment::getVotesDown() const
 {
-    return m_VotesDown.get();
+    return m_VotesDown;
 }
 
 void APIComment::setVotesDown(int32_t value)
 {
     m_VotesDown = value;
+    m_FieldsSet.set(FieldBit_VotesDown);
 }
 
 bool APIComment::votesDownIsSet() const
 {
-    return m_VotesDown.has_value();
+    return m_FieldsSet.test(FieldBit_VotesDown);
 }
 
 void APIComment::unsetVotesDown()
 {
-    m_VotesDown.reset();
+    m_FieldsSet.reset(FieldBit_VotesDown);
 }
 int32_t APIComment::getVotesUp() const
 {
-    return m_VotesUp.get();
+    return m_VotesUp;
 }
 
 void APIComment::setVotesUp(int32_t value)
 {
     m_VotesUp = value;
+    m_FieldsSet.set(FieldBit_VotesUp);
 }
 
 bool APIComment::votesUpIsSet() const
 {
-    return m_VotesUp.has_value();
+    return m_FieldsSet.test(FieldBit_VotesUp);
 }
 
 void APIComment::unsetVotesUp()
 {
-    m_VotesUp.reset();
+    m_FieldsSet.reset(FieldBit_VotesUp);
 }
 
 }
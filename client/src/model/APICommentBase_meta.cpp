@@ -20,11 +20,6 @@ namespace model {
 
 APICommentBase_meta::APICommentBase_meta()
 {
-    m_WpUserId = utility::conversions::to_string_t("");
-    m_WpUserIdIsSet = false;
-    m_WpPostId = utility::conversions::to_string_t("");
-    m_WpPostIdIsSet = false;
-    m_AdditionalPropertiesIsSet = false;
 }
 
 APICommentBase_meta::~APICommentBase_meta()
@@ -39,18 +34,18 @@ void APICommentBase_meta::validate()
 web::json::value APICommentBase_meta::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_WpUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wpUserId"))] = ModelBase::toJson(m_WpUserId);
     }
-    if(m_WpPostIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpPostId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wpPostId"))] = ModelBase::toJson(m_WpPostId);
     }
     // Serialize additional properties
-    if(m_AdditionalPropertiesIsSet)
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
         for(const auto& item : m_AdditionalProperties)
         {
@@ -61,45 +56,159 @@ web::json::value APICommentBase_meta::toJson() const
     return val;
 }
 
+void APICommentBase_meta::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_WpUserId))
+    {
+        
+        writer.key(_XPLATSTR("wpUserId"));
+        ModelBase::writeJson(writer, m_WpUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_WpPostId))
+    {
+        
+        writer.key(_XPLATSTR("wpPostId"));
+        ModelBase::writeJson(writer, m_WpPostId);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
+        {
+            writer.key(item.first);
+            writer.value(item.second);
+        }
+    }
+
+    writer.endObject();
+}
+
 bool APICommentBase_meta::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpUserId"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpUserId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setWpUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpUserId);
-            setWpUserId(refVal_setWpUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("wpUserId")):
+            if(field.first == _XPLATSTR("wpUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWpUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpUserId);
+                    setWpUserId(refVal_setWpUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wpPostId")):
+            if(field.first == _XPLATSTR("wpPostId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWpPostId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpPostId);
+                    setWpPostId(refVal_setWpPostId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        // This is an additional property
+        m_AdditionalProperties[field.first] = fieldValue;
+        m_FieldsSet.set(FieldBit_AdditionalProperties);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpPostId"))))
+    return ok;
+}
+
+void APICommentBase_meta::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_WpUserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpUserId")), m_WpUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_WpPostId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpPostId")), m_WpPostId);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpPostId")));
-        if(!fieldValue.is_null())
+        for(const auto& item : m_AdditionalProperties)
         {
-            utility::string_t refVal_setWpPostId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpPostId);
-            setWpPostId(refVal_setWpPostId);
-            
+            writer.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);
+            writer.writeString(item.first);
+            writer.writeString(item.second.serialize());
         }
     }
-    // Capture additional properties (keys not defined in the schema)
-    if(val.is_object())
+}
+
+bool APICommentBase_meta::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        for(const auto& item : val.as_object())
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("wpUserId")):
+            {
+                utility::string_t refVal_setWpUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpUserId(refVal_setWpUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wpPostId")):
+            {
+                utility::string_t refVal_setWpPostId;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpPostId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpPostId(refVal_setWpPostId);
+            }
+            continue;
+        default:
+            break;
+        }
+        if(field.wireType == BinaryWireType::Named)
         {
-            // Skip known properties
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("wpUserId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("wpPostId"))) continue;
-            // This is an additional property
-            m_AdditionalProperties[item.first] = item.second;
-            m_AdditionalPropertiesIsSet = true;
+            utility::string_t key;
+            utility::string_t text;
+            if(reader.readString(key) && reader.readString(text))
+            {
+                try
+                {
+                    m_AdditionalProperties[key] = web::json::value::parse(text);
+                }
+                catch(const web::json::json_exception&)
+                {
+                    return false;
+                }
+                m_FieldsSet.set(FieldBit_AdditionalProperties);
+            }
+            continue;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APICommentBase_meta::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -109,11 +218,11 @@ void APICommentBase_meta::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_WpUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpUserId")), m_WpUserId));
     }
-    if(m_WpPostIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpPostId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpPostId")), m_WpPostId));
     }
@@ -153,17 +262,17 @@ utility::string_t APICommentBase_meta::getWpUserId() const
 void APICommentBase_meta::setWpUserId(const utility::string_t& value)
 {
     m_WpUserId = value;
-    m_WpUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_WpUserId);
 }
 
 bool APICommentBase_meta::wpUserIdIsSet() const
 {
-    return m_WpUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_WpUserId);
 }
 
 void APICommentBase_meta::unsetWpUserId()
 {
-    m_WpUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_WpUserId);
 }
 utility::string_t APICommentBase_meta::getWpPostId() const
 {
@@ -174,17 +283,17 @@ utility::string_t APICommentBase_meta::getWpPostId() const
 void APICommentBase_meta::setWpPostId(const utility::string_t& value)
 {
     m_WpPostId = value;
-    m_WpPostIdIsSet = true;
+    m_FieldsSet.set(FieldBit_WpPostId);
 }
 
 bool APICommentBase_meta::wpPostIdIsSet() const
 {
-    return m_WpPostIdIsSet;
+    return m_FieldsSet.test(FieldBit_WpPostId);
 }
 
 void APICommentBase_meta::unsetWpPostId()
 {
-    m_WpPostIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_WpPostId);
 }
 
 
@@ -196,24 +305,24 @@ std::map<utility::string_t, web::json::value> APICommentBase_meta::getAdditional
 void APICommentBase_meta::setAdditionalProperties(const std::map<utility::string_t, web::json::value>& value)
 {
     m_AdditionalProperties = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 void APICommentBase_meta::addAdditionalProperty(const utility::string_t& key, const web::json::value& value)
 {
     m_AdditionalProperties[key] = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 bool APICommentBase_meta::additionalPropertiesIsSet() const
 {
-    return m_AdditionalPropertiesIsSet;
+    return m_FieldsSet.test(FieldBit_AdditionalProperties);
 }
 
 void APICommentBase_meta::unsetAdditionalProperties()
 {
     m_AdditionalProperties.clear();
-    m_AdditionalPropertiesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdditionalProperties);
 }
 }
 }
@@ -20,9 +20,6 @@ namespace model {
 
 APICreateUserBadgeResponse::APICreateUserBadgeResponse()
 {
-    m_StatusIsSet = false;
-    m_UserBadgeIsSet = false;
-    m_NotesIsSet = false;
 }
 
 APICreateUserBadgeResponse::~APICreateUserBadgeResponse()
@@ -37,17 +34,17 @@ void APICreateUserBadgeResponse::validate()
 web::json::value APICreateUserBadgeResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_UserBadgeIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadge))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userBadge"))] = ModelBase::toJson(m_UserBadge);
     }
-    if(m_NotesIsSet)
+    if(m_FieldsSet.test(FieldBit_Notes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notes"))] = ModelBase::toJson(m_Notes);
@@ -56,43 +53,153 @@ web::json::value APICreateUserBadgeResponse::toJson() const
     return val;
 }
 
+void APICreateUserBadgeResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadge))
+    {
+        
+        writer.key(_XPLATSTR("userBadge"));
+        ModelBase::writeJson(writer, m_UserBadge);
+    }
+    if(m_FieldsSet.test(FieldBit_Notes))
+    {
+        
+        writer.key(_XPLATSTR("notes"));
+        ModelBase::writeJson(writer, m_Notes);
+    }
+
+    writer.endObject();
+}
+
 bool APICreateUserBadgeResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userBadge"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userBadge")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<UserBadge> refVal_setUserBadge;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadge);
-            setUserBadge(refVal_setUserBadge);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userBadge")):
+            if(field.first == _XPLATSTR("userBadge"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserBadge> refVal_setUserBadge;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadge);
+                    setUserBadge(refVal_setUserBadge);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notes")):
+            if(field.first == _XPLATSTR("notes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setNotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotes);
+                    setNotes(refVal_setNotes);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notes"))))
+    return ok;
+}
+
+void APICreateUserBadgeResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadge))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userBadge")), m_UserBadge);
+    }
+    if(m_FieldsSet.test(FieldBit_Notes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notes")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notes")), m_Notes);
+    }
+}
+
+bool APICreateUserBadgeResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<utility::string_t> refVal_setNotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotes);
-            setNotes(refVal_setNotes);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userBadge")):
+            {
+                std::shared_ptr<UserBadge> refVal_setUserBadge;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserBadge))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserBadge(refVal_setUserBadge);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notes")):
+            {
+                std::vector<utility::string_t> refVal_setNotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotes(refVal_setNotes);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APICreateUserBadgeResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -102,15 +209,15 @@ void APICreateUserBadgeResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_UserBadgeIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadge))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userBadge")), m_UserBadge));
     }
-    if(m_NotesIsSet)
+    if(m_FieldsSet.test(FieldBit_Notes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notes")), m_Notes));
     }
@@ -156,17 +263,17 @@ std::shared_ptr<APIStatus> APICreateUserBadgeResponse::getStatus() const
 void APICreateUserBadgeResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APICreateUserBadgeResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APICreateUserBadgeResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<UserBadge> APICreateUserBadgeResponse::getUserBadge() const
 {
@@ -177,17 +284,17 @@ std::shared_ptr<UserBadge> APICreateUserBadgeResponse::getUserBadge() const
 void APICreateUserBadgeResponse::setUserBadge(const std::shared_ptr<UserBadge>& value)
 {
     m_UserBadge = value;
-    m_UserBadgeIsSet = true;
+    m_FieldsSet.set(FieldBit_UserBadge);
 }
 
 bool APICreateUserBadgeResponse::userBadgeIsSet() const
 {
-    return m_UserBadgeIsSet;
+    return m_FieldsSet.test(FieldBit_UserBadge);
 }
 
 void APICreateUserBadgeResponse::unsetUserBadge()
 {
-    m_UserBadgeIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserBadge);
 }
 std::vector<utility::string_t> APICreateUserBadgeResponse::getNotes() const
 {
@@ -198,17 +305,17 @@ std::vector<utility::string_t> APICreateUserBadgeResponse::getNotes() const
 void APICreateUserBadgeResponse::setNotes(const std::vector<utility::string_t>& value)
 {
     m_Notes = value;
-    m_NotesIsSet = true;
+    m_FieldsSet.set(FieldBit_Notes);
 }
 
 bool APICreateUserBadgeResponse::notesIsSet() const
 {
-    return m_NotesIsSet;
+    return m_FieldsSet.test(FieldBit_Notes);
 }
 
 void APICreateUserBadgeResponse::unsetNotes()
 {
-    m_NotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Notes);
 }
 
 }
@@ -20,22 +20,8 @@ namespace model {
 
 APIDomainConfiguration::APIDomainConfiguration()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
-    m_Domain = utility::conversions::to_string_t("");
-    m_DomainIsSet = false;
-    m_EmailHeadersIsSet = false;
     m_WpSynced = false;
-    m_WpSyncedIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_AutoAddedDate = utility::datetime();
-    m_AutoAddedDateIsSet = false;
-    m_SiteTypeIsSet = false;
-    m_FooterUnsubscribeURL = utility::conversions::to_string_t("");
-    m_FooterUnsubscribeURLIsSet = false;
     m_DisableUnsubscribeLinks = false;
-    m_DisableUnsubscribeLinksIsSet = false;
 }
 
 APIDomainConfiguration::~APIDomainConfiguration()
@@ -50,77 +36,77 @@ void APIDomainConfiguration::validate()
 web::json::value APIDomainConfiguration::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_EmailFromName.has_value())
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("emailFromName"))] = ModelBase::toJson(m_EmailFromName.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("emailFromName"))] = ModelBase::toJson(m_EmailFromName);
     }
-    if(m_EmailFromEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("emailFromEmail"))] = ModelBase::toJson(m_EmailFromEmail.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("emailFromEmail"))] = ModelBase::toJson(m_EmailFromEmail);
     }
-    if(m_EmailHeadersIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailHeaders"))] = ModelBase::toJson(m_EmailHeaders);
     }
-    if(m_WpSyncToken.has_value())
+    if(m_FieldsSet.test(FieldBit_WpSyncToken))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("wpSyncToken"))] = ModelBase::toJson(m_WpSyncToken.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("wpSyncToken"))] = ModelBase::toJson(m_WpSyncToken);
     }
-    if(m_WpSyncedIsSet)
+    if(m_FieldsSet.test(FieldBit_WpSynced))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wpSynced"))] = ModelBase::toJson(m_WpSynced);
     }
-    if(m_WpURL.has_value())
+    if(m_FieldsSet.test(FieldBit_WpURL))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("wpURL"))] = ModelBase::toJson(m_WpURL.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("wpURL"))] = ModelBase::toJson(m_WpURL);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_AutoAddedDateIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoAddedDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoAddedDate"))] = ModelBase::toJson(m_AutoAddedDate);
     }
-    if(m_SiteTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_SiteType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("siteType"))] = ModelBase::toJson(m_SiteType);
     }
-    if(m_LogoSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("logoSrc"))] = ModelBase::toJson(m_LogoSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("logoSrc"))] = ModelBase::toJson(m_LogoSrc);
     }
-    if(m_LogoSrc100px.has_value())
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))] = ModelBase::toJson(m_LogoSrc100px.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))] = ModelBase::toJson(m_LogoSrc100px);
     }
-    if(m_FooterUnsubscribeURLIsSet)
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL"))] = ModelBase::toJson(m_FooterUnsubscribeURL);
     }
-    if(m_DisableUnsubscribeLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableUnsubscribeLinks))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableUnsubscribeLinks"))] = ModelBase::toJson(m_DisableUnsubscribeLinks);
@@ -129,175 +115,561 @@ web::json::value APIDomainConfiguration::toJson() const
     return val;
 }
 
+void APIDomainConfiguration::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
+    {
+        
+        writer.key(_XPLATSTR("emailFromName"));
+        ModelBase::writeJson(writer, m_EmailFromName);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
+    {
+        
+        writer.key(_XPLATSTR("emailFromEmail"));
+        ModelBase::writeJson(writer, m_EmailFromEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
+    {
+        
+        writer.key(_XPLATSTR("emailHeaders"));
+        ModelBase::writeJson(writer, m_EmailHeaders);
+    }
+    if(m_FieldsSet.test(FieldBit_WpSyncToken))
+    {
+        
+        writer.key(_XPLATSTR("wpSyncToken"));
+        ModelBase::writeJson(writer, m_WpSyncToken);
+    }
+    if(m_FieldsSet.test(FieldBit_WpSynced))
+    {
+        
+        writer.key(_XPLATSTR("wpSynced"));
+        ModelBase::writeJson(writer, m_WpSynced);
+    }
+    if(m_FieldsSet.test(FieldBit_WpURL))
+    {
+        
+        writer.key(_XPLATSTR("wpURL"));
+        ModelBase::writeJson(writer, m_WpURL);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoAddedDate))
+    {
+        
+        writer.key(_XPLATSTR("autoAddedDate"));
+        ModelBase::writeJson(writer, m_AutoAddedDate);
+    }
+    if(m_FieldsSet.test(FieldBit_SiteType))
+    {
+        
+        writer.key(_XPLATSTR("siteType"));
+        ModelBase::writeJson(writer, m_SiteType);
+    }
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
+    {
+        
+        writer.key(_XPLATSTR("logoSrc"));
+        ModelBase::writeJson(writer, m_LogoSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
+    {
+        
+        writer.key(_XPLATSTR("logoSrc100px"));
+        ModelBase::writeJson(writer, m_LogoSrc100px);
+    }
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
+    {
+        
+        writer.key(_XPLATSTR("footerUnsubscribeURL"));
+        ModelBase::writeJson(writer, m_FooterUnsubscribeURL);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableUnsubscribeLinks))
+    {
+        
+        writer.key(_XPLATSTR("disableUnsubscribeLinks"));
+        ModelBase::writeJson(writer, m_DisableUnsubscribeLinks);
+    }
+
+    writer.endObject();
+}
+
 bool APIDomainConfiguration::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromName")):
+            if(field.first == _XPLATSTR("emailFromName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailFromName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromName);
+                    setEmailFromName(refVal_setEmailFromName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromEmail")):
+            if(field.first == _XPLATSTR("emailFromEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailFromEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromEmail);
+                    setEmailFromEmail(refVal_setEmailFromEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailHeaders")):
+            if(field.first == _XPLATSTR("emailHeaders"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setEmailHeaders;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailHeaders);
+                    setEmailHeaders(refVal_setEmailHeaders);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wpSyncToken")):
+            if(field.first == _XPLATSTR("wpSyncToken"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWpSyncToken;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpSyncToken);
+                    setWpSyncToken(refVal_setWpSyncToken);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wpSynced")):
+            if(field.first == _XPLATSTR("wpSynced"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setWpSynced;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpSynced);
+                    setWpSynced(refVal_setWpSynced);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wpURL")):
+            if(field.first == _XPLATSTR("wpURL"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWpURL;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpURL);
+                    setWpURL(refVal_setWpURL);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoAddedDate")):
+            if(field.first == _XPLATSTR("autoAddedDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setAutoAddedDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoAddedDate);
+                    setAutoAddedDate(refVal_setAutoAddedDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("siteType")):
+            if(field.first == _XPLATSTR("siteType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<ImportedSiteType> refVal_setSiteType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSiteType);
+                    setSiteType(refVal_setSiteType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc")):
+            if(field.first == _XPLATSTR("logoSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLogoSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc);
+                    setLogoSrc(refVal_setLogoSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc100px")):
+            if(field.first == _XPLATSTR("logoSrc100px"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLogoSrc100px;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc100px);
+                    setLogoSrc100px(refVal_setLogoSrc100px);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("footerUnsubscribeURL")):
+            if(field.first == _XPLATSTR("footerUnsubscribeURL"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFooterUnsubscribeURL;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFooterUnsubscribeURL);
+                    setFooterUnsubscribeURL(refVal_setFooterUnsubscribeURL);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableUnsubscribeLinks")):
+            if(field.first == _XPLATSTR("disableUnsubscribeLinks"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableUnsubscribeLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableUnsubscribeLinks);
+                    setDisableUnsubscribeLinks(refVal_setDisableUnsubscribeLinks);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailFromName"))))
+    return ok;
+}
+
+void APIDomainConfiguration::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailFromName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmailFromName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromName);
-            setEmailFromName(refVal_setEmailFromName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailFromEmail"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailFromEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmailFromEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromEmail);
-            setEmailFromEmail(refVal_setEmailFromEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailHeaders"))))
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailHeaders")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setEmailHeaders;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailHeaders);
-            setEmailHeaders(refVal_setEmailHeaders);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailFromName")), m_EmailFromName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpSyncToken"))))
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpSyncToken")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWpSyncToken;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpSyncToken);
-            setWpSyncToken(refVal_setWpSyncToken);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailFromEmail")), m_EmailFromEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpSynced"))))
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpSynced")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setWpSynced;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpSynced);
-            setWpSynced(refVal_setWpSynced);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailHeaders")), m_EmailHeaders);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpURL"))))
+    if(m_FieldsSet.test(FieldBit_WpSyncToken))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpURL")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWpURL;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpURL);
-            setWpURL(refVal_setWpURL);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpSyncToken")), m_WpSyncToken);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_WpSynced))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpSynced")), m_WpSynced);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoAddedDate"))))
+    if(m_FieldsSet.test(FieldBit_WpURL))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoAddedDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setAutoAddedDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoAddedDate);
-            setAutoAddedDate(refVal_setAutoAddedDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpURL")), m_WpURL);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("siteType"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("siteType")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<ImportedSiteType> refVal_setSiteType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSiteType);
-            setSiteType(refVal_setSiteType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("logoSrc"))))
+    if(m_FieldsSet.test(FieldBit_AutoAddedDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("logoSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLogoSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc);
-            setLogoSrc(refVal_setLogoSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoAddedDate")), m_AutoAddedDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))))
+    if(m_FieldsSet.test(FieldBit_SiteType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLogoSrc100px;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc100px);
-            setLogoSrc100px(refVal_setLogoSrc100px);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("siteType")), m_SiteType);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL"))))
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFooterUnsubscribeURL;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFooterUnsubscribeURL);
-            setFooterUnsubscribeURL(refVal_setFooterUnsubscribeURL);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("logoSrc")), m_LogoSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("logoSrc100px")), m_LogoSrc100px);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableUnsubscribeLinks"))))
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableUnsubscribeLinks")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("footerUnsubscribeURL")), m_FooterUnsubscribeURL);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableUnsubscribeLinks))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableUnsubscribeLinks")), m_DisableUnsubscribeLinks);
+    }
+}
+
+bool APIDomainConfiguration::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setDisableUnsubscribeLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableUnsubscribeLinks);
-            setDisableUnsubscribeLinks(refVal_setDisableUnsubscribeLinks);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromName")):
+            {
+                utility::string_t refVal_setEmailFromName;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailFromName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailFromName(refVal_setEmailFromName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromEmail")):
+            {
+                utility::string_t refVal_setEmailFromEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailFromEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailFromEmail(refVal_setEmailFromEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailHeaders")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setEmailHeaders;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailHeaders))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailHeaders(refVal_setEmailHeaders);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wpSyncToken")):
+            {
+                utility::string_t refVal_setWpSyncToken;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpSyncToken))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpSyncToken(refVal_setWpSyncToken);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wpSynced")):
+            {
+                bool refVal_setWpSynced;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpSynced))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpSynced(refVal_setWpSynced);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wpURL")):
+            {
+                utility::string_t refVal_setWpURL;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpURL))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpURL(refVal_setWpURL);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoAddedDate")):
+            {
+                utility::datetime refVal_setAutoAddedDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoAddedDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoAddedDate(refVal_setAutoAddedDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("siteType")):
+            {
+                std::shared_ptr<ImportedSiteType> refVal_setSiteType;
+                if(!ModelBase::readBinary(reader, field, refVal_setSiteType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSiteType(refVal_setSiteType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc")):
+            {
+                utility::string_t refVal_setLogoSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setLogoSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLogoSrc(refVal_setLogoSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc100px")):
+            {
+                utility::string_t refVal_setLogoSrc100px;
+                if(!ModelBase::readBinary(reader, field, refVal_setLogoSrc100px))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLogoSrc100px(refVal_setLogoSrc100px);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("footerUnsubscribeURL")):
+            {
+                utility::string_t refVal_setFooterUnsubscribeURL;
+                if(!ModelBase::readBinary(reader, field, refVal_setFooterUnsubscribeURL))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFooterUnsubscribeURL(refVal_setFooterUnsubscribeURL);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableUnsubscribeLinks")):
+            {
+                bool refVal_setDisableUnsubscribeLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableUnsubscribeLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableUnsubscribeLinks(refVal_setDisableUnsubscribeLinks);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIDomainConfiguration::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -307,63 +679,63 @@ void APIDomainConfiguration::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_EmailFromName.has_value())
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailFromName")), m_EmailFromName.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailFromName")), m_EmailFromName));
     }
-    if(m_EmailFromEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailFromEmail")), m_EmailFromEmail.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailFromEmail")), m_EmailFromEmail));
     }
-    if(m_EmailHeadersIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailHeaders")), m_EmailHeaders));
     }
-    if(m_WpSyncToken.has_value())
+    if(m_FieldsSet.test(FieldBit_WpSyncToken))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpSyncToken")), m_WpSyncToken.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpSyncToken")), m_WpSyncToken));
     }
-    if(m_WpSyncedIsSet)
+    if(m_FieldsSet.test(FieldBit_WpSynced))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpSynced")), m_WpSynced));
     }
-    if(m_WpURL.has_value())
+    if(m_FieldsSet.test(FieldBit_WpURL))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpURL")), m_WpURL.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpURL")), m_WpURL));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_AutoAddedDateIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoAddedDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoAddedDate")), m_AutoAddedDate));
     }
-    if(m_SiteTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_SiteType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("siteType")), m_SiteType));
     }
-    if(m_LogoSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc")), m_LogoSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc")), m_LogoSrc));
     }
-    if(m_LogoSrc100px.has_value())
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")), m_LogoSrc100px.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")), m_LogoSrc100px));
     }
-    if(m_FooterUnsubscribeURLIsSet)
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL")), m_FooterUnsubscribeURL));
     }
-    if(m_DisableUnsubscribeLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableUnsubscribeLinks))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableUnsubscribeLinks")), m_DisableUnsubscribeLinks));
     }
@@ -481,17 +853,17 @@ utility::string_t APIDomainConfiguration::getId() const
 void APIDomainConfiguration::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool APIDomainConfiguration::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void APIDomainConfiguration::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 utility::string_t APIDomainConfiguration::getDomain() const
 {
@@ -502,57 +874,59 @@ utility::string_t APIDomainConfiguration::getDomain() const
 void APIDomainConfiguration::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
-    m_DomainIsSet = true;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool APIDomainConfiguration::domainIsSet() const
 {
-    return m_DomainIsSet;
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void APIDomainConfiguration::unsetDomain()
 {
-    m_DomainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t APIDomainConfiguration::getEmailFromName() const
 {
-    return m_EmailFromName.get();
+    return m_EmailFromName;
 }
 
 
 void APIDomainConfiguration::setEmailFromName(const utility::string_t& value)
 {
     m_EmailFromName = value;
+    m_FieldsSet.set(FieldBit_EmailFromName);
 }
 
 bool APIDomainConfiguration::emailFromNameIsSet() const
 {
-    return m_EmailFromName.has_value();
+    return m_FieldsSet.test(FieldBit_EmailFromName);
 }
 
 void APIDomainConfiguration::unsetEmailFromName()
 {
-    m_EmailFromName.reset();
+    m_FieldsSet.reset(FieldBit_EmailFromName);
 }
 utility::string_t APIDomainConfiguration::getEmailFromEmail() const
 {
-    return m_EmailFromEmail.get();
+    return m_EmailFromEmail;
 }
 
 
 void APIDomainConfiguration::setEmailFromEmail(const utility::string_t& value)
 {
     m_EmailFromEmail = value;
+    m_FieldsSet.set(FieldBit_EmailFromEmail);
 }
 
 bool APIDomainConfiguration::emailFromEmailIsSet() const
 {
-    return m_EmailFromEmail.has_value();
+    return m_FieldsSet.test(FieldBit_EmailFromEmail);
 }
 
 void APIDomainConfiguration::unsetEmailFromEmail()
 {
-    m_EmailFromEmail.reset();
+    m_FieldsSet.reset(FieldBit_EmailFromEmail);
 }
 std::map<utility::string_t, utility::string_t> APIDomainConfiguration::getEmailHeaders() const
 {
@@ -563,37 +937,38 @@ std::map<utility::string_t, utility::string_t> APIDomainConfiguration::getEmailH
 void APIDomainConfiguration::setEmailHeaders(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_EmailHeaders = value;
-    m_EmailHeadersIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailHeaders);
 }
 
 bool APIDomainConfiguration::emailHeadersIsSet() const
 {
-    return m_EmailHeadersIsSet;
+    return m_FieldsSet.test(FieldBit_EmailHeaders);
 }
 
 void APIDomainConfiguration::unsetEmailHeaders()
 {
-    m_EmailHeadersIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailHeaders);
 }
 utility::string_t APIDomainConfiguration::getWpSyncToken() const
 {
-    return m_WpSyncToken.get();
+    return m_WpSyncToken;
 }
 
 
 void APIDomainConfiguration::setWpSyncToken(const utility::string_t& value)
 {
     m_WpSyncToken = value;
+    m_FieldsSet.set(FieldBit_WpSyncToken);
 }
 
 bool APIDomainConfiguration::wpSyncTokenIsSet() const
 {
-    return m_WpSyncToken.has_value();
+    return m_FieldsSet.test(FieldBit_WpSyncToken);
 }
 
 void APIDomainConfiguration::unsetWpSyncToken()
 {
-    m_WpSyncToken.reset();
+    m_FieldsSet.reset(FieldBit_WpSyncToken);
 }
 bool APIDomainConfiguration::isWpSynced() const
 {
@@ -603,37 +978,38 @@ bool APIDomainConfiguration::isWpSynced() const
 void APIDomainConfiguration::setWpSynced(bool value)
 {
     m_WpSynced = value;
-    m_WpSyncedIsSet = true;
+    m_FieldsSet.set(FieldBit_WpSynced);
 }
 
 bool APIDomainConfiguration::wpSyncedIsSet() const
 {
-    return m_WpSyncedIsSet;
+    return m_FieldsSet.test(FieldBit_WpSynced);
 }
 
 void APIDomainConfiguration::unsetWpSynced()
 {
-    m_WpSyncedIsSet = false;
+    m_FieldsSet.reset(FieldBit_WpSynced);
 }
 utility::string_t APIDomainConfiguration::getWpURL() const
 {
-    return m_WpURL.get();
+    return m_WpURL;
 }
 
 
 void APIDomainConfiguration::setWpURL(const utility::string_t& value)
 {
     m_WpURL = value;
+    m_FieldsSet.set(FieldBit_WpURL);
 }
 
 bool APIDomainConfiguration::wpURLIsSet() const
 {
-    return m_WpURL.has_value();
+    return m_FieldsSet.test(FieldBit_WpURL);
 }
 
 void APIDomainConfiguration::unsetWpURL()
 {
-    m_WpURL.reset();
+    m_FieldsSet.reset(FieldBit_WpURL);
 }
 utility::datetime APIDomainConfiguration::getCreatedAt() const
 {
@@ -644,17 +1020,17 @@ utility::datetime APIDomainConfiguration::getCreatedAt() const
 void APIDomainConfiguration::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool APIDomainConfiguration::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void APIDomainConfiguration::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::datetime APIDomainConfiguration::getAutoAddedDate() const
 {
@@ -665,17 +1041,17 @@ utility::datetime APIDomainConfiguration::getAutoAddedDate() const
 void APIDomainConfiguration::setAutoAddedDate(const utility::datetime& value)
 {
     m_AutoAddedDate = value;
-    m_AutoAddedDateIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoAddedDate);
 }
 
 bool APIDomainConfiguration::autoAddedDateIsSet() const
 {
-    return m_AutoAddedDateIsSet;
+    return m_FieldsSet.test(FieldBit_AutoAddedDate);
 }
 
 void APIDomainConfiguration::unsetAutoAddedDate()
 {
-    m_AutoAddedDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoAddedDate);
 }
 std::shared_ptr<ImportedSiteType> APIDomainConfiguration::getSiteType() const
 {
@@ -686,57 +1062,59 @@ std::shared_ptr<ImportedSiteType> APIDomainConfiguration::getSiteType() const
 void APIDomainConfiguration::setSiteType(const std::shared_ptr<ImportedSiteType>& value)
 {
     m_SiteType = value;
-    m_SiteTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_SiteType);
 }
 
 bool APIDomainConfiguration::siteTypeIsSet() const
 {
-    return m_SiteTypeIsSet;
+    return m_FieldsSet.test(FieldBit_SiteType);
 }
 
 void APIDomainConfiguration::unsetSiteType()
 {
-    m_SiteTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_SiteType);
 }
 utility::string_t APIDomainConfiguration::getLogoSrc() const
 {
-    return m_LogoSrc.get();
+    return m_LogoSrc;
 }
 
 
 void APIDomainConfiguration::setLogoSrc(const utility::string_t& value)
 {
     m_LogoSrc = value;
+    m_FieldsSet.set(FieldBit_LogoSrc);
 }
 
 bool APIDomainConfiguration::logoSrcIsSet() const
 {
-    return m_LogoSrc.has_value();
+    return m_FieldsSet.test(FieldBit_LogoSrc);
 }
 
 void APIDomainConfiguration::unsetLogoSrc()
 {
-    m_LogoSrc.reset();
+    m_FieldsSet.reset(FieldBit_LogoSrc);
 }
 utility::string_t APIDomainConfiguration::getLogoSrc100px() const
 {
-    return m_LogoSrc100px.get();
+    return m_LogoSrc100px;
 }
 
 
 void APIDomainConfiguration::setLogoSrc100px(const utility::string_t& value)
 {
     m_LogoSrc100px = value;
+    m_FieldsSet.set(FieldBit_LogoSrc100px);
 }
 
 bool APIDomainConfiguration::logoSrc100pxIsSet() const
 {
-    return m_LogoSrc100px.has_value();
+    return m_FieldsSet.test(FieldBit_LogoSrc100px);
 }
 
 void APIDomainConfiguration::unsetLogoSrc100px()
 {
-    m_LogoSrc100px.reset();
+    m_FieldsSet.reset(FieldBit_LogoSrc100px);
 }
 utility::string_t APIDomainConfiguration::getFooterUnsubscribeURL() const
 {
@@ -747,17 +1125,17 @@ utility::string_t APIDomainConfiguration::getFooterUnsubscribeURL() const
 void APIDomainConfiguration::setFooterUnsubscribeURL(const utility::string_t& value)
 {
     m_FooterUnsubscribeURL = value;
-    m_FooterUnsubscribeURLIsSet = true;
+    m_FieldsSet.set(FieldBit_FooterUnsubscribeURL);
 }
 
 bool APIDomainConfiguration::footerUnsubscribeURLIsSet() const
 {
-    return m_FooterUnsubscribeURLIsSet;
+    return m_FieldsSet.test(FieldBit_FooterUnsubscribeURL);
 }
 
 void APIDomainConfiguration::unsetFooterUnsubscribeURL()
 {
-    m_FooterUnsubscribeURLIsSet = false;
+    m_FieldsSet.reset(FieldBit_FooterUnsubscribeURL);
 }
 bool APIDomainConfiguration::isDisableUnsubscribeLinks() const
 {
@@ -767,17 +1145,17 @@ bool APIDomainConfiguration::isDisableUnsubscribeLinks() const
 void APIDomainConfiguration::setDisableUnsubscribeLinks(bool value)
 {
     m_DisableUnsubscribeLinks = value;
-    m_DisableUnsubscribeLinksIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableUnsubscribeLinks);
 }
 
 bool APIDomainConfiguration::disableUnsubscribeLinksIsSet() const
 {
-    return m_DisableUnsubscribeLinksIsSet;
+    return m_FieldsSet.test(FieldBit_DisableUnsubscribeLinks);
 }
 
 void APIDomainConfiguration::unsetDisableUnsubscribeLinks()
 {
-    m_DisableUnsubscribeLinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableUnsubscribeLinks);
 }
 
 }
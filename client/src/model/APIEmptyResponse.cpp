@@ -20,7 +20,6 @@ namespace model {
 
 APIEmptyResponse::APIEmptyResponse()
 {
-    m_StatusIsSet = false;
 }
 
 APIEmptyResponse::~APIEmptyResponse()
@@ -35,7 +34,7 @@ void APIEmptyResponse::validate()
 web::json::value APIEmptyResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -44,23 +43,87 @@ web::json::value APIEmptyResponse::toJson() const
     return val;
 }
 
+void APIEmptyResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool APIEmptyResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void APIEmptyResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool APIEmptyResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void APIEmptyResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void APIEmptyResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -102,17 +165,17 @@ std::shared_ptr<APIStatus> APIEmptyResponse::getStatus() const
 void APIEmptyResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIEmptyResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIEmptyResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
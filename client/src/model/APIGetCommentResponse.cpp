@@ -20,8 +20,6 @@ namespace model {
 
 APIGetCommentResponse::APIGetCommentResponse()
 {
-    m_StatusIsSet = false;
-    m_CommentIsSet = false;
 }
 
 APIGetCommentResponse::~APIGetCommentResponse()
@@ -36,12 +34,12 @@ void APIGetCommentResponse::validate()
 web::json::value APIGetCommentResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
@@ -50,32 +48,119 @@ web::json::value APIGetCommentResponse::toJson() const
     return val;
 }
 
+void APIGetCommentResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+
+    writer.endObject();
+}
+
 bool APIGetCommentResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIComment> refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    return ok;
+}
+
+void APIGetCommentResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
+    }
+}
+
+bool APIGetCommentResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIComment> refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                std::shared_ptr<APIComment> refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIGetCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void APIGetCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> APIGetCommentResponse::getStatus() const
 void APIGetCommentResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIGetCommentResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIGetCommentResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APIComment> APIGetCommentResponse::getComment() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIComment> APIGetCommentResponse::getComment() const
 void APIGetCommentResponse::setComment(const std::shared_ptr<APIComment>& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool APIGetCommentResponse::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void APIGetCommentResponse::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 
 }
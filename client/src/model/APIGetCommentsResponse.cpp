@@ -20,8 +20,6 @@ namespace model {
 
 APIGetCommentsResponse::APIGetCommentsResponse()
 {
-    m_StatusIsSet = false;
-    m_CommentsIsSet = false;
 }
 
 APIGetCommentsResponse::~APIGetCommentsResponse()
@@ -36,12 +34,12 @@ void APIGetCommentsResponse::validate()
 web::json::value APIGetCommentsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comments"))] = ModelBase::toJson(m_Comments);
@@ -50,32 +48,119 @@ web::json::value APIGetCommentsResponse::toJson() const
     return val;
 }
 
+void APIGetCommentsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Comments))
+    {
+        
+        writer.key(_XPLATSTR("comments"));
+        ModelBase::writeJson(writer, m_Comments);
+    }
+
+    writer.endObject();
+}
+
 bool APIGetCommentsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            if(field.first == _XPLATSTR("comments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APIComment>> refVal_setComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
+                    setComments(refVal_setComments);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comments"))))
+    return ok;
+}
+
+void APIGetCommentsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comments")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Comments))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comments")), m_Comments);
+    }
+}
+
+bool APIGetCommentsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<APIComment>> refVal_setComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
-            setComments(refVal_setComments);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            {
+                std::vector<std::shared_ptr<APIComment>> refVal_setComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComments(refVal_setComments);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIGetCommentsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void APIGetCommentsResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comments")), m_Comments));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> APIGetCommentsResponse::getStatus() const
 void APIGetCommentsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIGetCommentsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIGetCommentsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<APIComment>> APIGetCommentsResponse::getComments() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<APIComment>> APIGetCommentsResponse::getComments() c
 void APIGetCommentsResponse::setComments(const std::vector<std::shared_ptr<APIComment>>& value)
 {
     m_Comments = value;
-    m_CommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_Comments);
 }
 
 bool APIGetCommentsResponse::commentsIsSet() const
 {
-    return m_CommentsIsSet;
+    return m_FieldsSet.test(FieldBit_Comments);
 }
 
 void APIGetCommentsResponse::unsetComments()
 {
-    m_CommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comments);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 APIGetUserBadgeProgressListResponse::APIGetUserBadgeProgressListResponse()
 {
-    m_StatusIsSet = false;
-    m_UserBadgeProgressesIsSet = false;
 }
 
 APIGetUserBadgeProgressListResponse::~APIGetUserBadgeProgressListResponse()
@@ -36,12 +34,12 @@ void APIGetUserBadgeProgressListResponse::validate()
 web::json::value APIGetUserBadgeProgressListResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_UserBadgeProgressesIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgresses))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userBadgeProgresses"))] = ModelBase::toJson(m_UserBadgeProgresses);
@@ -50,32 +48,119 @@ web::json::value APIGetUserBadgeProgressListResponse::toJson() const
     return val;
 }
 
+void APIGetUserBadgeProgressListResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgresses))
+    {
+        
+        writer.key(_XPLATSTR("userBadgeProgresses"));
+        ModelBase::writeJson(writer, m_UserBadgeProgresses);
+    }
+
+    writer.endObject();
+}
+
 bool APIGetUserBadgeProgressListResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userBadgeProgresses")):
+            if(field.first == _XPLATSTR("userBadgeProgresses"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<UserBadgeProgress>> refVal_setUserBadgeProgresses;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadgeProgresses);
+                    setUserBadgeProgresses(refVal_setUserBadgeProgresses);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userBadgeProgresses"))))
+    return ok;
+}
+
+void APIGetUserBadgeProgressListResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userBadgeProgresses")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgresses))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userBadgeProgresses")), m_UserBadgeProgresses);
+    }
+}
+
+bool APIGetUserBadgeProgressListResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<UserBadgeProgress>> refVal_setUserBadgeProgresses;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadgeProgresses);
-            setUserBadgeProgresses(refVal_setUserBadgeProgresses);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userBadgeProgresses")):
+            {
+                std::vector<std::shared_ptr<UserBadgeProgress>> refVal_setUserBadgeProgresses;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserBadgeProgresses))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserBadgeProgresses(refVal_setUserBadgeProgresses);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIGetUserBadgeProgressListResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void APIGetUserBadgeProgressListResponse::toMultipart(std::shared_ptr<MultipartF
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_UserBadgeProgressesIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgresses))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userBadgeProgresses")), m_UserBadgeProgresses));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> APIGetUserBadgeProgressListResponse::getStatus() cons
 void APIGetUserBadgeProgressListResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIGetUserBadgeProgressListResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIGetUserBadgeProgressListResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<UserBadgeProgress>> APIGetUserBadgeProgressListResponse::getUserBadgeProgresses() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<UserBadgeProgress>> APIGetUserBadgeProgressListRespo
 void APIGetUserBadgeProgressListResponse::setUserBadgeProgresses(const std::vector<std::shared_ptr<UserBadgeProgress>>& value)
 {
     m_UserBadgeProgresses = value;
-    m_UserBadgeProgressesIsSet = true;
+    m_FieldsSet.set(FieldBit_UserBadgeProgresses);
 }
 
 bool APIGetUserBadgeProgressListResponse::userBadgeProgressesIsSet() const
 {
-    return m_UserBadgeProgressesIsSet;
+    return m_FieldsSet.test(FieldBit_UserBadgeProgresses);
 }
 
 void APIGetUserBadgeProgressListResponse::unsetUserBadgeProgresses()
 {
-    m_UserBadgeProgressesIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserBadgeProgresses);
 }
 
 }
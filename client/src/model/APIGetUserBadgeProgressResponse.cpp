@@ -20,8 +20,6 @@ namespace model {
 
 APIGetUserBadgeProgressResponse::APIGetUserBadgeProgressResponse()
 {
-    m_StatusIsSet = false;
-    m_UserBadgeProgressIsSet = false;
 }
 
 APIGetUserBadgeProgressResponse::~APIGetUserBadgeProgressResponse()
@@ -36,12 +34,12 @@ void APIGetUserBadgeProgressResponse::validate()
 web::json::value APIGetUserBadgeProgressResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_UserBadgeProgressIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgress))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userBadgeProgress"))] = ModelBase::toJson(m_UserBadgeProgress);
@@ -50,32 +48,119 @@ web::json::value APIGetUserBadgeProgressResponse::toJson() const
     return val;
 }
 
+void APIGetUserBadgeProgressResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgress))
+    {
+        
+        writer.key(_XPLATSTR("userBadgeProgress"));
+        ModelBase::writeJson(writer, m_UserBadgeProgress);
+    }
+
+    writer.endObject();
+}
+
 bool APIGetUserBadgeProgressResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userBadgeProgress")):
+            if(field.first == _XPLATSTR("userBadgeProgress"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserBadgeProgress> refVal_setUserBadgeProgress;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadgeProgress);
+                    setUserBadgeProgress(refVal_setUserBadgeProgress);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userBadgeProgress"))))
+    return ok;
+}
+
+void APIGetUserBadgeProgressResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userBadgeProgress")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgress))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userBadgeProgress")), m_UserBadgeProgress);
+    }
+}
+
+bool APIGetUserBadgeProgressResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<UserBadgeProgress> refVal_setUserBadgeProgress;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadgeProgress);
-            setUserBadgeProgress(refVal_setUserBadgeProgress);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userBadgeProgress")):
+            {
+                std::shared_ptr<UserBadgeProgress> refVal_setUserBadgeProgress;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserBadgeProgress))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserBadgeProgress(refVal_setUserBadgeProgress);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIGetUserBadgeProgressResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void APIGetUserBadgeProgressResponse::toMultipart(std::shared_ptr<MultipartFormD
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_UserBadgeProgressIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadgeProgress))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userBadgeProgress")), m_UserBadgeProgress));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> APIGetUserBadgeProgressResponse::getStatus() const
 void APIGetUserBadgeProgressResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIGetUserBadgeProgressResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIGetUserBadgeProgressResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<UserBadgeProgress> APIGetUserBadgeProgressResponse::getUserBadgeProgress() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<UserBadgeProgress> APIGetUserBadgeProgressResponse::getUserBadge
 void APIGetUserBadgeProgressResponse::setUserBadgeProgress(const std::shared_ptr<UserBadgeProgress>& value)
 {
     m_UserBadgeProgress = value;
-    m_UserBadgeProgressIsSet = true;
+    m_FieldsSet.set(FieldBit_UserBadgeProgress);
 }
 
 bool APIGetUserBadgeProgressResponse::userBadgeProgressIsSet() const
 {
-    return m_UserBadgeProgressIsSet;
+    return m_FieldsSet.test(FieldBit_UserBadgeProgress);
 }
 
 void APIGetUserBadgeProgressResponse::unsetUserBadgeProgress()
 {
-    m_UserBadgeProgressIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserBadgeProgress);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 APIGetUserBadgeResponse::APIGetUserBadgeResponse()
 {
-    m_StatusIsSet = false;
-    m_UserBadgeIsSet = false;
 }
 
 APIGetUserBadgeResponse::~APIGetUserBadgeResponse()
@@ -36,12 +34,12 @@ void APIGetUserBadgeResponse::validate()
 web::json::value APIGetUserBadgeResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_UserBadgeIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadge))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userBadge"))] = ModelBase::toJson(m_UserBadge);
@@ -50,32 +48,119 @@ web::json::value APIGetUserBadgeResponse::toJson() const
     return val;
 }
 
+void APIGetUserBadgeResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadge))
+    {
+        
+        writer.key(_XPLATSTR("userBadge"));
+        ModelBase::writeJson(writer, m_UserBadge);
+    }
+
+    writer.endObject();
+}
+
 bool APIGetUserBadgeResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userBadge")):
+            if(field.first == _XPLATSTR("userBadge"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserBadge> refVal_setUserBadge;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadge);
+                    setUserBadge(refVal_setUserBadge);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userBadge"))))
+    return ok;
+}
+
+void APIGetUserBadgeResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userBadge")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadge))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userBadge")), m_UserBadge);
+    }
+}
+
+bool APIGetUserBadgeResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<UserBadge> refVal_setUserBadge;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadge);
-            setUserBadge(refVal_setUserBadge);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userBadge")):
+            {
+                std::shared_ptr<UserBadge> refVal_setUserBadge;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserBadge))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserBadge(refVal_setUserBadge);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIGetUserBadgeResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void APIGetUserBadgeResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_UserBadgeIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadge))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userBadge")), m_UserBadge));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> APIGetUserBadgeResponse::getStatus() const
 void APIGetUserBadgeResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIGetUserBadgeResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIGetUserBadgeResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<UserBadge> APIGetUserBadgeResponse::getUserBadge() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<UserBadge> APIGetUserBadgeResponse::getUserBadge() const
 void APIGetUserBadgeResponse::setUserBadge(const std::shared_ptr<UserBadge>& value)
 {
     m_UserBadge = value;
-    m_UserBadgeIsSet = true;
+    m_FieldsSet.set(FieldBit_UserBadge);
 }
 
 bool APIGetUserBadgeResponse::userBadgeIsSet() const
 {
-    return m_UserBadgeIsSet;
+    return m_FieldsSet.test(FieldBit_UserBadge);
 }
 
 void APIGetUserBadgeResponse::unsetUserBadge()
 {
-    m_UserBadgeIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserBadge);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 APIGetUserBadgesResponse::APIGetUserBadgesResponse()
 {
-    m_StatusIsSet = false;
-    m_UserBadgesIsSet = false;
 }
 
 APIGetUserBadgesResponse::~APIGetUserBadgesResponse()
@@ -36,12 +34,12 @@ void APIGetUserBadgesResponse::validate()
 web::json::value APIGetUserBadgesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_UserBadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadges))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userBadges"))] = ModelBase::toJson(m_UserBadges);
@@ -50,32 +48,119 @@ web::json::value APIGetUserBadgesResponse::toJson() const
     return val;
 }
 
+void APIGetUserBadgesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadges))
+    {
+        
+        writer.key(_XPLATSTR("userBadges"));
+        ModelBase::writeJson(writer, m_UserBadges);
+    }
+
+    writer.endObject();
+}
+
 bool APIGetUserBadgesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userBadges")):
+            if(field.first == _XPLATSTR("userBadges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<UserBadge>> refVal_setUserBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadges);
+                    setUserBadges(refVal_setUserBadges);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userBadges"))))
+    return ok;
+}
+
+void APIGetUserBadgesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userBadges")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserBadges))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userBadges")), m_UserBadges);
+    }
+}
+
+bool APIGetUserBadgesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<UserBadge>> refVal_setUserBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserBadges);
-            setUserBadges(refVal_setUserBadges);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userBadges")):
+            {
+                std::vector<std::shared_ptr<UserBadge>> refVal_setUserBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserBadges(refVal_setUserBadges);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIGetUserBadgesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void APIGetUserBadgesResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_UserBadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_UserBadges))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userBadges")), m_UserBadges));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> APIGetUserBadgesResponse::getStatus() const
 void APIGetUserBadgesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIGetUserBadgesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIGetUserBadgesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<UserBadge>> APIGetUserBadgesResponse::getUserBadges() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<UserBadge>> APIGetUserBadgesResponse::getUserBadges(
 void APIGetUserBadgesResponse::setUserBadges(const std::vector<std::shared_ptr<UserBadge>>& value)
 {
     m_UserBadges = value;
-    m_UserBadgesIsSet = true;
+    m_FieldsSet.set(FieldBit_UserBadges);
 }
 
 bool APIGetUserBadgesResponse::userBadgesIsSet() const
 {
-    return m_UserBadgesIsSet;
+    return m_FieldsSet.test(FieldBit_UserBadges);
 }
 
 void APIGetUserBadgesResponse::unsetUserBadges()
 {
-    m_UserBadgesIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserBadges);
 }
 
 }
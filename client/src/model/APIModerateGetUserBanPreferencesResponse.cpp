@@ -20,7 +20,6 @@ namespace model {
 
 APIModerateGetUserBanPreferencesResponse::APIModerateGetUserBanPreferencesResponse()
 {
-    m_StatusIsSet = false;
 }
 
 APIModerateGetUserBanPreferencesResponse::~APIModerateGetUserBanPreferencesResponse()
@@ -35,12 +34,12 @@ void APIModerateGetUserBanPreferencesResponse::validate()
 web::json::value APIModerateGetUserBanPreferencesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_Preferences.has_value())
+    if(m_FieldsSet.test(FieldBit_Preferences))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("preferences"))] = ModelBase::toJson(m_Preferences.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("preferences"))] = ModelBase::toJson(m_Preferences);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -49,32 +48,119 @@ web::json::value APIModerateGetUserBanPreferencesResponse::toJson() const
     return val;
 }
 
+void APIModerateGetUserBanPreferencesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Preferences))
+    {
+        
+        writer.key(_XPLATSTR("preferences"));
+        ModelBase::writeJson(writer, m_Preferences);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool APIModerateGetUserBanPreferencesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("preferences"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("preferences")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIModerateUserBanPreferences> refVal_setPreferences;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPreferences);
-            setPreferences(refVal_setPreferences);
-            
+        case ModelBase::fieldHash(_XPLATSTR("preferences")):
+            if(field.first == _XPLATSTR("preferences"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIModerateUserBanPreferences> refVal_setPreferences;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPreferences);
+                    setPreferences(refVal_setPreferences);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void APIModerateGetUserBanPreferencesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Preferences))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("preferences")), m_Preferences);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool APIModerateGetUserBanPreferencesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("preferences")):
+            {
+                std::shared_ptr<APIModerateUserBanPreferences> refVal_setPreferences;
+                if(!ModelBase::readBinary(reader, field, refVal_setPreferences))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPreferences(refVal_setPreferences);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIModerateGetUserBanPreferencesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -84,11 +170,11 @@ void APIModerateGetUserBanPreferencesResponse::toMultipart(std::shared_ptr<Multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_Preferences.has_value())
+    if(m_FieldsSet.test(FieldBit_Preferences))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("preferences")), m_Preferences.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("preferences")), m_Preferences));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -121,23 +207,24 @@ bool APIModerateGetUserBanPreferencesResponse::fromMultiPart(std::shared_ptr<Mul
 
 std::shared_ptr<APIModerateUserBanPreferences> APIModerateGetUserBanPreferencesResponse::getPreferences() const
 {
-    return m_Preferences.get();
+    return m_Preferences;
 }
 
 
 void APIModerateGetUserBanPreferencesResponse::setPreferences(const std::shared_ptr<APIModerateUserBanPreferences>& value)
 {
     m_Preferences = value;
+    m_FieldsSet.set(FieldBit_Preferences);
 }
 
 bool APIModerateGetUserBanPreferencesResponse::preferencesIsSet() const
 {
-    return m_Preferences.has_value();
+    return m_FieldsSet.test(FieldBit_Preferences);
 }
 
 void APIModerateGetUserBanPreferencesResponse::unsetPreferences()
 {
-    m_Preferences.reset();
+    m_FieldsSet.reset(FieldBit_Preferences);
 }
 std::shared_ptr<APIStatus> APIModerateGetUserBanPreferencesResponse::getStatus() const
 {
@@ -148,17 +235,17 @@ std::shared_ptr<APIStatus> APIModerateGetUserBanPreferencesResponse::getStatus()
 void APIModerateGetUserBanPreferencesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APIModerateGetUserBanPreferencesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APIModerateGetUserBanPreferencesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -21,13 +21,7 @@ namespace model {
 APIModerateUserBanPreferences::APIModerateUserBanPreferences()
 {
     m_ShouldBanEmail = false;
-    m_ShouldBanEmailIsSet = false;
     m_ShouldBanByIP = false;
-    m_ShouldBanByIPIsSet = false;
-    m_LastBanType = utility::conversions::to_string_t("");
-    m_LastBanTypeIsSet = false;
-    m_LastBanDuration = utility::conversions::to_string_t("");
-    m_LastBanDurationIsSet = false;
 }
 
 APIModerateUserBanPreferences::~APIModerateUserBanPreferences()
@@ -42,22 +36,22 @@ void APIModerateUserBanPreferences::validate()
 web::json::value APIModerateUserBanPreferences::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ShouldBanEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_ShouldBanEmail))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("shouldBanEmail"))] = ModelBase::toJson(m_ShouldBanEmail);
     }
-    if(m_ShouldBanByIPIsSet)
+    if(m_FieldsSet.test(FieldBit_ShouldBanByIP))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("shouldBanByIP"))] = ModelBase::toJson(m_ShouldBanByIP);
     }
-    if(m_LastBanTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_LastBanType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastBanType"))] = ModelBase::toJson(m_LastBanType);
     }
-    if(m_LastBanDurationIsSet)
+    if(m_FieldsSet.test(FieldBit_LastBanDuration))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastBanDuration"))] = ModelBase::toJson(m_LastBanDuration);
@@ -66,54 +60,187 @@ web::json::value APIModerateUserBanPreferences::toJson() const
     return val;
 }
 
+void APIModerateUserBanPreferences::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ShouldBanEmail))
+    {
+        
+        writer.key(_XPLATSTR("shouldBanEmail"));
+        ModelBase::writeJson(writer, m_ShouldBanEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_ShouldBanByIP))
+    {
+        
+        writer.key(_XPLATSTR("shouldBanByIP"));
+        ModelBase::writeJson(writer, m_ShouldBanByIP);
+    }
+    if(m_FieldsSet.test(FieldBit_LastBanType))
+    {
+        
+        writer.key(_XPLATSTR("lastBanType"));
+        ModelBase::writeJson(writer, m_LastBanType);
+    }
+    if(m_FieldsSet.test(FieldBit_LastBanDuration))
+    {
+        
+        writer.key(_XPLATSTR("lastBanDuration"));
+        ModelBase::writeJson(writer, m_LastBanDuration);
+    }
+
+    writer.endObject();
+}
+
 bool APIModerateUserBanPreferences::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("shouldBanEmail"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("shouldBanEmail")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setShouldBanEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setShouldBanEmail);
-            setShouldBanEmail(refVal_setShouldBanEmail);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("shouldBanByIP"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("shouldBanByIP")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setShouldBanByIP;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setShouldBanByIP);
-            setShouldBanByIP(refVal_setShouldBanByIP);
-            
+        case ModelBase::fieldHash(_XPLATSTR("shouldBanEmail")):
+            if(field.first == _XPLATSTR("shouldBanEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setShouldBanEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setShouldBanEmail);
+                    setShouldBanEmail(refVal_setShouldBanEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("shouldBanByIP")):
+            if(field.first == _XPLATSTR("shouldBanByIP"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setShouldBanByIP;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setShouldBanByIP);
+                    setShouldBanByIP(refVal_setShouldBanByIP);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastBanType")):
+            if(field.first == _XPLATSTR("lastBanType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLastBanType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastBanType);
+                    setLastBanType(refVal_setLastBanType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastBanDuration")):
+            if(field.first == _XPLATSTR("lastBanDuration"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLastBanDuration;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastBanDuration);
+                    setLastBanDuration(refVal_setLastBanDuration);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastBanType"))))
+    return ok;
+}
+
+void APIModerateUserBanPreferences::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ShouldBanEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastBanType")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLastBanType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastBanType);
-            setLastBanType(refVal_setLastBanType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("shouldBanEmail")), m_ShouldBanEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastBanDuration"))))
+    if(m_FieldsSet.test(FieldBit_ShouldBanByIP))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastBanDuration")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("shouldBanByIP")), m_ShouldBanByIP);
+    }
+    if(m_FieldsSet.test(FieldBit_LastBanType))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastBanType")), m_LastBanType);
+    }
+    if(m_FieldsSet.test(FieldBit_LastBanDuration))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastBanDuration")), m_LastBanDuration);
+    }
+}
+
+bool APIModerateUserBanPreferences::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setLastBanDuration;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastBanDuration);
-            setLastBanDuration(refVal_setLastBanDuration);
-            
+        case ModelBase::fieldHash(_XPLATSTR("shouldBanEmail")):
+            {
+                bool refVal_setShouldBanEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setShouldBanEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setShouldBanEmail(refVal_setShouldBanEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("shouldBanByIP")):
+            {
+                bool refVal_setShouldBanByIP;
+                if(!ModelBase::readBinary(reader, field, refVal_setShouldBanByIP))
+                {
+                    ok = false;
+                    continue;
+                }
+                setShouldBanByIP(refVal_setShouldBanByIP);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastBanType")):
+            {
+                utility::string_t refVal_setLastBanType;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastBanType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastBanType(refVal_setLastBanType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastBanDuration")):
+            {
+                utility::string_t refVal_setLastBanDuration;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastBanDuration))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastBanDuration(refVal_setLastBanDuration);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIModerateUserBanPreferences::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -123,19 +250,19 @@ void APIModerateUserBanPreferences::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ShouldBanEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_ShouldBanEmail))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("shouldBanEmail")), m_ShouldBanEmail));
     }
-    if(m_ShouldBanByIPIsSet)
+    if(m_FieldsSet.test(FieldBit_ShouldBanByIP))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("shouldBanByIP")), m_ShouldBanByIP));
     }
-    if(m_LastBanTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_LastBanType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastBanType")), m_LastBanType));
     }
-    if(m_LastBanDurationIsSet)
+    if(m_FieldsSet.test(FieldBit_LastBanDuration))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastBanDuration")), m_LastBanDuration));
     }
@@ -186,17 +313,17 @@ bool APIModerateUserBanPreferences::isShouldBanEmail() const
 void APIModerateUserBanPreferences::setShouldBanEmail(bool value)
 {
     m_ShouldBanEmail = value;
-    m_ShouldBanEmailIsSet = true;
+    m_FieldsSet.set(FieldBit_ShouldBanEmail);
 }
 
 bool APIModerateUserBanPreferences::shouldBanEmailIsSet() const
 {
-    return m_ShouldBanEmailIsSet;
+    return m_FieldsSet.test(FieldBit_ShouldBanEmail);
 }
 
 void APIModerateUserBanPreferences::unsetShouldBanEmail()
 {
-    m_ShouldBanEmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_ShouldBanEmail);
 }
 bool APIModerateUserBanPreferences::isShouldBanByIP() const
 {
@@ -206,17 +333,17 @@ bool APIModerateUserBanPreferences::isShouldBanByIP() const
 void APIModerateUserBanPreferences::setShouldBanByIP(bool value)
 {
     m_ShouldBanByIP = value;
-    m_ShouldBanByIPIsSet = true;
+    m_FieldsSet.set(FieldBit_ShouldBanByIP);
 }
 
 bool APIModerateUserBanPreferences::shouldBanByIPIsSet() const
 {
-    return m_ShouldBanByIPIsSet;
+    return m_FieldsSet.test(FieldBit_ShouldBanByIP);
 }
 
 void APIModerateUserBanPreferences::unsetShouldBanByIP()
 {
-    m_ShouldBanByIPIsSet = false;
+    m_FieldsSet.reset(FieldBit_ShouldBanByIP);
 }
 utility::string_t APIModerateUserBanPreferences::getLastBanType() const
 {
@@ -227,17 +354,17 @@ utility::string_t APIModerateUserBanPreferences::getLastBanType() const
 void APIModerateUserBanPreferences::setLastBanType(const utility::string_t& value)
 {
     m_LastBanType = value;
-    m_LastBanTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_LastBanType);
 }
 
 bool APIModerateUserBanPreferences::lastBanTypeIsSet() const
 {
-    return m_LastBanTypeIsSet;
+    return m_FieldsSet.test(FieldBit_LastBanType);
 }
 
 void APIModerateUserBanPreferences::unsetLastBanType()
 {
-    m_LastBanTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastBanType);
 }
 utility::string_t APIModerateUserBanPreferences::getLastBanDuration() const
 {
@@ -248,17 +375,17 @@ utility::string_t APIModerateUserBanPreferences::getLastBanDuration() const
 void APIModerateUserBanPreferences::setLastBanDuration(const utility::string_t& value)
 {
     m_LastBanDuration = value;
-    m_LastBanDurationIsSet = true;
+    m_FieldsSet.set(FieldBit_LastBanDuration);
 }
 
 bool APIModerateUserBanPreferences::lastBanDurationIsSet() const
 {
-    return m_LastBanDurationIsSet;
+    return m_FieldsSet.test(FieldBit_LastBanDuration);
 }
 
 void APIModerateUserBanPreferences::unsetLastBanDuration()
 {
-    m_LastBanDurationIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastBanDuration);
 }
 
 }
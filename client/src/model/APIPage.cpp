@@ -21,22 +21,8 @@ namespace model {
 APIPage::APIPage()
 {
     m_IsClosed = false;
-    m_IsClosedIsSet = false;
-    m_AccessibleByGroupIdsIsSet = false;
     m_RootCommentCount = 0L;
-    m_RootCommentCountIsSet = false;
     m_CommentCount = 0L;
-    m_CommentCountIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
 }
 
 APIPage::~APIPage()
@@ -51,47 +37,47 @@ void APIPage::validate()
 web::json::value APIPage::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isClosed"))] = ModelBase::toJson(m_IsClosed);
     }
-    if(m_AccessibleByGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds"))] = ModelBase::toJson(m_AccessibleByGroupIds);
     }
-    if(m_RootCommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("rootCommentCount"))] = ModelBase::toJson(m_RootCommentCount);
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentCount"))] = ModelBase::toJson(m_CommentCount);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
@@ -100,109 +86,357 @@ web::json::value APIPage::toJson() const
     return val;
 }
 
+void APIPage::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_IsClosed))
+    {
+        
+        writer.key(_XPLATSTR("isClosed"));
+        ModelBase::writeJson(writer, m_IsClosed);
+    }
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("accessibleByGroupIds"));
+        ModelBase::writeJson(writer, m_AccessibleByGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
+    {
+        
+        writer.key(_XPLATSTR("rootCommentCount"));
+        ModelBase::writeJson(writer, m_RootCommentCount);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        writer.key(_XPLATSTR("commentCount"));
+        ModelBase::writeJson(writer, m_CommentCount);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+
+    writer.endObject();
+}
+
 bool APIPage::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isClosed"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isClosed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsClosed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
-            setIsClosed(refVal_setIsClosed);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAccessibleByGroupIds);
-            setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            if(field.first == _XPLATSTR("isClosed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsClosed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
+                    setIsClosed(refVal_setIsClosed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")):
+            if(field.first == _XPLATSTR("accessibleByGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAccessibleByGroupIds);
+                    setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rootCommentCount")):
+            if(field.first == _XPLATSTR("rootCommentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setRootCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRootCommentCount);
+                    setRootCommentCount(refVal_setRootCommentCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            if(field.first == _XPLATSTR("commentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
+                    setCommentCount(refVal_setCommentCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rootCommentCount"))))
+    return ok;
+}
+
+void APIPage::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rootCommentCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setRootCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRootCommentCount);
-            setRootCommentCount(refVal_setRootCommentCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isClosed")), m_IsClosed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCount"))))
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
-            setCommentCount(refVal_setCommentCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")), m_AccessibleByGroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rootCommentCount")), m_RootCommentCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCount")), m_CommentCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_Title))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
+    }
+}
+
+bool APIPage::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            {
+                bool refVal_setIsClosed;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsClosed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsClosed(refVal_setIsClosed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setAccessibleByGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rootCommentCount")):
+            {
+                int64_t refVal_setRootCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setRootCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRootCommentCount(refVal_setRootCommentCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            {
+                int64_t refVal_setCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCount(refVal_setCommentCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIPage::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -212,39 +446,39 @@ void APIPage::toMultipart(std::shared_ptr<MultipartFormData> multipart, const ut
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isClosed")), m_IsClosed));
     }
-    if(m_AccessibleByGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds")), m_AccessibleByGroupIds));
     }
-    if(m_RootCommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rootCommentCount")), m_RootCommentCount));
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCount")), m_CommentCount));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
@@ -325,17 +559,17 @@ bool APIPage::isIsClosed() const
 void APIPage::setIsClosed(bool value)
 {
     m_IsClosed = value;
-    m_IsClosedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsClosed);
 }
 
 bool APIPage::isClosedIsSet() const
 {
-    return m_IsClosedIsSet;
+    return m_FieldsSet.test(FieldBit_IsClosed);
 }
 
 void APIPage::unsetIsClosed()
 {
-    m_IsClosedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsClosed);
 }
 std::vector<utility::string_t> APIPage::getAccessibleByGroupIds() const
 {
@@ -346,17 +580,17 @@ std::vector<utility::string_t> APIPage::getAccessibleByGroupIds() const
 void APIPage::setAccessibleByGroupIds(const std::vector<utility::string_t>& value)
 {
     m_AccessibleByGroupIds = value;
-    m_AccessibleByGroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_AccessibleByGroupIds);
 }
 
 bool APIPage::accessibleByGroupIdsIsSet() const
 {
-    return m_AccessibleByGroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_AccessibleByGroupIds);
 }
 
 void APIPage::unsetAccessibleByGroupIds()
 {
-    m_AccessibleByGroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AccessibleByGroupIds);
 }
 int64_t APIPage::getRootCommentCount() const
 {
@@ -366,17 +600,17 @@ int64_t APIPage::getRootCommentCount() const
 void APIPage::setRootCommentCount(int64_t value)
 {
     m_RootCommentCount = value;
-    m_RootCommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_RootCommentCount);
 }
 
 bool APIPage::rootCommentCountIsSet() const
 {
-    return m_RootCommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_RootCommentCount);
 }
 
 void APIPage::unsetRootCommentCount()
 {
-    m_RootCommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_RootCommentCount);
 }
 int64_t APIPage::getCommentCount() const
 {
@@ -386,17 +620,17 @@ int64_t APIPage::getCommentCount() const
 void APIPage::setCommentCount(int64_t value)
 {
     m_CommentCount = value;
-    m_CommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentCount);
 }
 
 bool APIPage::commentCountIsSet() const
 {
-    return m_CommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_CommentCount);
 }
 
 void APIPage::unsetCommentCount()
 {
-    m_CommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentCount);
 }
 utility::datetime APIPage::getCreatedAt() const
 {
@@ -407,17 +641,17 @@ utility::datetime APIPage::getCreatedAt() const
 void APIPage::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool APIPage::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void APIPage::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t APIPage::getTitle() const
 {
@@ -428,17 +662,17 @@ utility::string_t APIPage::getTitle() const
 void APIPage::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool APIPage::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void APIPage::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t APIPage::getUrl() const
 {
@@ -449,17 +683,17 @@ utility::string_t APIPage::getUrl() const
 void APIPage::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool APIPage::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void APIPage::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t APIPage::getUrlId() const
 {
@@ -470,17 +704,17 @@ utility::string_t APIPage::getUrlId() const
 void APIPage::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool APIPage::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void APIPage::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t APIPage::getId() const
 {
@@ -491,17 +725,17 @@ utility::string_t APIPage::getId() const
 void APIPage::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool APIPage::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void APIPage::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 
 }
@@ -20,9 +20,6 @@ namespace model {
 
 APISaveCommentResponse::APISaveCommentResponse()
 {
-    m_StatusIsSet = false;
-    m_CommentIsSet = false;
-    m_ModuleDataIsSet = false;
 }
 
 APISaveCommentResponse::~APISaveCommentResponse()
@@ -37,22 +34,22 @@ void APISaveCommentResponse::validate()
 web::json::value APISaveCommentResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User);
     }
-    if(m_ModuleDataIsSet)
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moduleData"))] = ModelBase::toJson(m_ModuleData);
@@ -61,54 +58,187 @@ web::json::value APISaveCommentResponse::toJson() const
     return val;
 }
 
+void APISaveCommentResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        writer.key(_XPLATSTR("user"));
+        ModelBase::writeJson(writer, m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_ModuleData))
+    {
+        
+        writer.key(_XPLATSTR("moduleData"));
+        ModelBase::writeJson(writer, m_ModuleData);
+    }
+
+    writer.endObject();
+}
+
 bool APISaveCommentResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIComment> refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIComment> refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            if(field.first == _XPLATSTR("user"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserSessionInfo> refVal_setUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
+                    setUser(refVal_setUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moduleData")):
+            if(field.first == _XPLATSTR("moduleData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setModuleData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModuleData);
+                    setModuleData(refVal_setModuleData);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("user"))))
+    return ok;
+}
+
+void APISaveCommentResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("user")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<UserSessionInfo> refVal_setUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
-            setUser(refVal_setUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moduleData"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moduleData")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("user")), m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_ModuleData))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moduleData")), m_ModuleData);
+    }
+}
+
+bool APISaveCommentResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setModuleData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModuleData);
-            setModuleData(refVal_setModuleData);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                std::shared_ptr<APIComment> refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            {
+                std::shared_ptr<UserSessionInfo> refVal_setUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUser(refVal_setUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moduleData")):
+            {
+                std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setModuleData;
+                if(!ModelBase::readBinary(reader, field, refVal_setModuleData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModuleData(refVal_setModuleData);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APISaveCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -118,19 +248,19 @@ void APISaveCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User));
     }
-    if(m_ModuleDataIsSet)
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moduleData")), m_ModuleData));
     }
@@ -182,17 +312,17 @@ std::shared_ptr<APIStatus> APISaveCommentResponse::getStatus() const
 void APISaveCommentResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool APISaveCommentResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void APISaveCommentResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APIComment> APISaveCommentResponse::getComment() const
 {
@@ -203,37 +333,38 @@ std::shared_ptr<APIComment> APISaveCommentResponse::getComment() const
 void APISaveCommentResponse::setComment(const std::shared_ptr<APIComment>& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool APISaveCommentResponse::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void APISaveCommentResponse::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 std::shared_ptr<UserSessionInfo> APISaveCommentResponse::getUser() const
 {
-    return m_User.get();
+    return m_User;
 }
 
 
 void APISaveCommentResponse::setUser(const std::shared_ptr<UserSessionInfo>& value)
 {
     m_User = value;
+    m_FieldsSet.set(FieldBit_User);
 }
 
 bool APISaveCommentResponse::userIsSet() const
 {
-    return m_User.has_value();
+    return m_FieldsSet.test(FieldBit_User);
 }
 
 void APISaveCommentResponse::unsetUser()
 {
-    m_User.reset();
+    m_FieldsSet.reset(FieldBit_User);
 }
 std::map<utility::string_t, std::shared_ptr<AnyType>> APISaveCommentResponse::getModuleData() const
 {
@@ -244,17 +375,17 @@ std::map<utility::string_t, std::shared_ptr<AnyType>> APISaveCommentResponse::ge
 void APISaveCommentResponse::setModuleData(const std::map<utility::string_t, std::shared_ptr<AnyType>>& value)
 {
     m_ModuleData = value;
-    m_ModuleDataIsSet = true;
+    m_FieldsSet.set(FieldBit_ModuleData);
 }
 
 bool APISaveCommentResponse::moduleDataIsSet() const
 {
-    return m_ModuleDataIsSet;
+    return m_FieldsSet.test(FieldBit_ModuleData);
 }
 
 void APISaveCommentResponse::unsetModuleData()
 {
-    m_ModuleDataIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModuleData);
 }
 
 }
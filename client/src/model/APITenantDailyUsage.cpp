@@ -20,44 +20,22 @@ namespace model {
 
 APITenantDailyUsage::APITenantDailyUsage()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
     m_YearNumber = 0.0;
-    m_YearNumberIsSet = false;
     m_MonthNumber = 0.0;
-    m_MonthNumberIsSet = false;
     m_DayNumber = 0.0;
-    m_DayNumberIsSet = false;
     m_CommentFetchCount = 0.0;
-    m_CommentFetchCountIsSet = false;
     m_CommentCreateCount = 0.0;
-    m_CommentCreateCountIsSet = false;
     m_ConversationCreateCount = 0.0;
-    m_ConversationCreateCountIsSet = false;
     m_VoteCount = 0.0;
-    m_VoteCountIsSet = false;
     m_AccountCreatedCount = 0.0;
-    m_AccountCreatedCountIsSet = false;
     m_UserMentionSearch = 0.0;
-    m_UserMentionSearchIsSet = false;
     m_HashTagSearch = 0.0;
-    m_HashTagSearchIsSet = false;
     m_GifSearchTrending = 0.0;
-    m_GifSearchTrendingIsSet = false;
     m_GifSearch = 0.0;
-    m_GifSearchIsSet = false;
     m_ApiCreditsUsed = 0.0;
-    m_ApiCreditsUsedIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
     m_Billed = false;
-    m_BilledIsSet = false;
     m_Ignored = false;
-    m_IgnoredIsSet = false;
     m_ApiErrorCount = 0.0;
-    m_ApiErrorCountIsSet = false;
 }
 
 APITenantDailyUsage::~APITenantDailyUsage()
@@ -72,97 +50,97 @@ void APITenantDailyUsage::validate()
 web::json::value APITenantDailyUsage::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_YearNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_YearNumber))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("yearNumber"))] = ModelBase::toJson(m_YearNumber);
     }
-    if(m_MonthNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_MonthNumber))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("monthNumber"))] = ModelBase::toJson(m_MonthNumber);
     }
-    if(m_DayNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_DayNumber))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("dayNumber"))] = ModelBase::toJson(m_DayNumber);
     }
-    if(m_CommentFetchCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentFetchCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentFetchCount"))] = ModelBase::toJson(m_CommentFetchCount);
     }
-    if(m_CommentCreateCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCreateCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentCreateCount"))] = ModelBase::toJson(m_CommentCreateCount);
     }
-    if(m_ConversationCreateCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ConversationCreateCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("conversationCreateCount"))] = ModelBase::toJson(m_ConversationCreateCount);
     }
-    if(m_VoteCountIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("voteCount"))] = ModelBase::toJson(m_VoteCount);
     }
-    if(m_AccountCreatedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_AccountCreatedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("accountCreatedCount"))] = ModelBase::toJson(m_AccountCreatedCount);
     }
-    if(m_UserMentionSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_UserMentionSearch))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userMentionSearch"))] = ModelBase::toJson(m_UserMentionSearch);
     }
-    if(m_HashTagSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTagSearch))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTagSearch"))] = ModelBase::toJson(m_HashTagSearch);
     }
-    if(m_GifSearchTrendingIsSet)
+    if(m_FieldsSet.test(FieldBit_GifSearchTrending))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("gifSearchTrending"))] = ModelBase::toJson(m_GifSearchTrending);
     }
-    if(m_GifSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_GifSearch))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("gifSearch"))] = ModelBase::toJson(m_GifSearch);
     }
-    if(m_ApiCreditsUsedIsSet)
+    if(m_FieldsSet.test(FieldBit_ApiCreditsUsed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("apiCreditsUsed"))] = ModelBase::toJson(m_ApiCreditsUsed);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_BilledIsSet)
+    if(m_FieldsSet.test(FieldBit_Billed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("billed"))] = ModelBase::toJson(m_Billed);
     }
-    if(m_IgnoredIsSet)
+    if(m_FieldsSet.test(FieldBit_Ignored))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ignored"))] = ModelBase::toJson(m_Ignored);
     }
-    if(m_ApiErrorCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ApiErrorCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("apiErrorCount"))] = ModelBase::toJson(m_ApiErrorCount);
@@ -171,219 +149,697 @@ web::json::value APITenantDailyUsage::toJson() const
     return val;
 }
 
+void APITenantDailyUsage::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_YearNumber))
+    {
+        
+        writer.key(_XPLATSTR("yearNumber"));
+        ModelBase::writeJson(writer, m_YearNumber);
+    }
+    if(m_FieldsSet.test(FieldBit_MonthNumber))
+    {
+        
+        writer.key(_XPLATSTR("monthNumber"));
+        ModelBase::writeJson(writer, m_MonthNumber);
+    }
+    if(m_FieldsSet.test(FieldBit_DayNumber))
+    {
+        
+        writer.key(_XPLATSTR("dayNumber"));
+        ModelBase::writeJson(writer, m_DayNumber);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentFetchCount))
+    {
+        
+        writer.key(_XPLATSTR("commentFetchCount"));
+        ModelBase::writeJson(writer, m_CommentFetchCount);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCreateCount))
+    {
+        
+        writer.key(_XPLATSTR("commentCreateCount"));
+        ModelBase::writeJson(writer, m_CommentCreateCount);
+    }
+    if(m_FieldsSet.test(FieldBit_ConversationCreateCount))
+    {
+        
+        writer.key(_XPLATSTR("conversationCreateCount"));
+        ModelBase::writeJson(writer, m_ConversationCreateCount);
+    }
+    if(m_FieldsSet.test(FieldBit_VoteCount))
+    {
+        
+        writer.key(_XPLATSTR("voteCount"));
+        ModelBase::writeJson(writer, m_VoteCount);
+    }
+    if(m_FieldsSet.test(FieldBit_AccountCreatedCount))
+    {
+        
+        writer.key(_XPLATSTR("accountCreatedCount"));
+        ModelBase::writeJson(writer, m_AccountCreatedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_UserMentionSearch))
+    {
+        
+        writer.key(_XPLATSTR("userMentionSearch"));
+        ModelBase::writeJson(writer, m_UserMentionSearch);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTagSearch))
+    {
+        
+        writer.key(_XPLATSTR("hashTagSearch"));
+        ModelBase::writeJson(writer, m_HashTagSearch);
+    }
+    if(m_FieldsSet.test(FieldBit_GifSearchTrending))
+    {
+        
+        writer.key(_XPLATSTR("gifSearchTrending"));
+        ModelBase::writeJson(writer, m_GifSearchTrending);
+    }
+    if(m_FieldsSet.test(FieldBit_GifSearch))
+    {
+        
+        writer.key(_XPLATSTR("gifSearch"));
+        ModelBase::writeJson(writer, m_GifSearch);
+    }
+    if(m_FieldsSet.test(FieldBit_ApiCreditsUsed))
+    {
+        
+        writer.key(_XPLATSTR("apiCreditsUsed"));
+        ModelBase::writeJson(writer, m_ApiCreditsUsed);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Billed))
+    {
+        
+        writer.key(_XPLATSTR("billed"));
+        ModelBase::writeJson(writer, m_Billed);
+    }
+    if(m_FieldsSet.test(FieldBit_Ignored))
+    {
+        
+        writer.key(_XPLATSTR("ignored"));
+        ModelBase::writeJson(writer, m_Ignored);
+    }
+    if(m_FieldsSet.test(FieldBit_ApiErrorCount))
+    {
+        
+        writer.key(_XPLATSTR("apiErrorCount"));
+        ModelBase::writeJson(writer, m_ApiErrorCount);
+    }
+
+    writer.endObject();
+}
+
 bool APITenantDailyUsage::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("yearNumber")):
+            if(field.first == _XPLATSTR("yearNumber"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setYearNumber;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setYearNumber);
+                    setYearNumber(refVal_setYearNumber);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("monthNumber")):
+            if(field.first == _XPLATSTR("monthNumber"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMonthNumber;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMonthNumber);
+                    setMonthNumber(refVal_setMonthNumber);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("dayNumber")):
+            if(field.first == _XPLATSTR("dayNumber"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setDayNumber;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDayNumber);
+                    setDayNumber(refVal_setDayNumber);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentFetchCount")):
+            if(field.first == _XPLATSTR("commentFetchCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setCommentFetchCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentFetchCount);
+                    setCommentFetchCount(refVal_setCommentFetchCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCreateCount")):
+            if(field.first == _XPLATSTR("commentCreateCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setCommentCreateCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCreateCount);
+                    setCommentCreateCount(refVal_setCommentCreateCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("conversationCreateCount")):
+            if(field.first == _XPLATSTR("conversationCreateCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setConversationCreateCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConversationCreateCount);
+                    setConversationCreateCount(refVal_setConversationCreateCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("voteCount")):
+            if(field.first == _XPLATSTR("voteCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVoteCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVoteCount);
+                    setVoteCount(refVal_setVoteCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("accountCreatedCount")):
+            if(field.first == _XPLATSTR("accountCreatedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAccountCreatedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAccountCreatedCount);
+                    setAccountCreatedCount(refVal_setAccountCreatedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userMentionSearch")):
+            if(field.first == _XPLATSTR("userMentionSearch"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setUserMentionSearch;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserMentionSearch);
+                    setUserMentionSearch(refVal_setUserMentionSearch);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTagSearch")):
+            if(field.first == _XPLATSTR("hashTagSearch"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setHashTagSearch;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTagSearch);
+                    setHashTagSearch(refVal_setHashTagSearch);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("gifSearchTrending")):
+            if(field.first == _XPLATSTR("gifSearchTrending"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setGifSearchTrending;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGifSearchTrending);
+                    setGifSearchTrending(refVal_setGifSearchTrending);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("gifSearch")):
+            if(field.first == _XPLATSTR("gifSearch"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setGifSearch;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGifSearch);
+                    setGifSearch(refVal_setGifSearch);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("apiCreditsUsed")):
+            if(field.first == _XPLATSTR("apiCreditsUsed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setApiCreditsUsed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApiCreditsUsed);
+                    setApiCreditsUsed(refVal_setApiCreditsUsed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("billed")):
+            if(field.first == _XPLATSTR("billed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setBilled;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBilled);
+                    setBilled(refVal_setBilled);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ignored")):
+            if(field.first == _XPLATSTR("ignored"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIgnored;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIgnored);
+                    setIgnored(refVal_setIgnored);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("apiErrorCount")):
+            if(field.first == _XPLATSTR("apiErrorCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setApiErrorCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApiErrorCount);
+                    setApiErrorCount(refVal_setApiErrorCount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("yearNumber"))))
+    return ok;
+}
+
+void APITenantDailyUsage::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("yearNumber")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setYearNumber;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setYearNumber);
-            setYearNumber(refVal_setYearNumber);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("monthNumber"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("monthNumber")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMonthNumber;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMonthNumber);
-            setMonthNumber(refVal_setMonthNumber);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("dayNumber"))))
+    if(m_FieldsSet.test(FieldBit_YearNumber))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("dayNumber")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setDayNumber;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDayNumber);
-            setDayNumber(refVal_setDayNumber);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("yearNumber")), m_YearNumber);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentFetchCount"))))
+    if(m_FieldsSet.test(FieldBit_MonthNumber))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentFetchCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setCommentFetchCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentFetchCount);
-            setCommentFetchCount(refVal_setCommentFetchCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("monthNumber")), m_MonthNumber);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCreateCount"))))
+    if(m_FieldsSet.test(FieldBit_DayNumber))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCreateCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setCommentCreateCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCreateCount);
-            setCommentCreateCount(refVal_setCommentCreateCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("dayNumber")), m_DayNumber);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("conversationCreateCount"))))
+    if(m_FieldsSet.test(FieldBit_CommentFetchCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("conversationCreateCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setConversationCreateCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConversationCreateCount);
-            setConversationCreateCount(refVal_setConversationCreateCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentFetchCount")), m_CommentFetchCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("voteCount"))))
+    if(m_FieldsSet.test(FieldBit_CommentCreateCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("voteCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVoteCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVoteCount);
-            setVoteCount(refVal_setVoteCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCreateCount")), m_CommentCreateCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("accountCreatedCount"))))
+    if(m_FieldsSet.test(FieldBit_ConversationCreateCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("accountCreatedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAccountCreatedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAccountCreatedCount);
-            setAccountCreatedCount(refVal_setAccountCreatedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("conversationCreateCount")), m_ConversationCreateCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userMentionSearch"))))
+    if(m_FieldsSet.test(FieldBit_VoteCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userMentionSearch")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setUserMentionSearch;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserMentionSearch);
-            setUserMentionSearch(refVal_setUserMentionSearch);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("voteCount")), m_VoteCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTagSearch"))))
+    if(m_FieldsSet.test(FieldBit_AccountCreatedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTagSearch")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setHashTagSearch;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTagSearch);
-            setHashTagSearch(refVal_setHashTagSearch);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("accountCreatedCount")), m_AccountCreatedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("gifSearchTrending"))))
+    if(m_FieldsSet.test(FieldBit_UserMentionSearch))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("gifSearchTrending")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setGifSearchTrending;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGifSearchTrending);
-            setGifSearchTrending(refVal_setGifSearchTrending);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userMentionSearch")), m_UserMentionSearch);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("gifSearch"))))
+    if(m_FieldsSet.test(FieldBit_HashTagSearch))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("gifSearch")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setGifSearch;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGifSearch);
-            setGifSearch(refVal_setGifSearch);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTagSearch")), m_HashTagSearch);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("apiCreditsUsed"))))
+    if(m_FieldsSet.test(FieldBit_GifSearchTrending))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("apiCreditsUsed")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setApiCreditsUsed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApiCreditsUsed);
-            setApiCreditsUsed(refVal_setApiCreditsUsed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("gifSearchTrending")), m_GifSearchTrending);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_GifSearch))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("gifSearch")), m_GifSearch);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("billed"))))
+    if(m_FieldsSet.test(FieldBit_ApiCreditsUsed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("billed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setBilled;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBilled);
-            setBilled(refVal_setBilled);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("apiCreditsUsed")), m_ApiCreditsUsed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ignored"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ignored")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIgnored;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIgnored);
-            setIgnored(refVal_setIgnored);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Billed))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("billed")), m_Billed);
+    }
+    if(m_FieldsSet.test(FieldBit_Ignored))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ignored")), m_Ignored);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("apiErrorCount"))))
+    if(m_FieldsSet.test(FieldBit_ApiErrorCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("apiErrorCount")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("apiErrorCount")), m_ApiErrorCount);
+    }
+}
+
+bool APITenantDailyUsage::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            double refVal_setApiErrorCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApiErrorCount);
-            setApiErrorCount(refVal_setApiErrorCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("yearNumber")):
+            {
+                double refVal_setYearNumber;
+                if(!ModelBase::readBinary(reader, field, refVal_setYearNumber))
+                {
+                    ok = false;
+                    continue;
+                }
+                setYearNumber(refVal_setYearNumber);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("monthNumber")):
+            {
+                double refVal_setMonthNumber;
+                if(!ModelBase::readBinary(reader, field, refVal_setMonthNumber))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMonthNumber(refVal_setMonthNumber);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("dayNumber")):
+            {
+                double refVal_setDayNumber;
+                if(!ModelBase::readBinary(reader, field, refVal_setDayNumber))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDayNumber(refVal_setDayNumber);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentFetchCount")):
+            {
+                double refVal_setCommentFetchCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentFetchCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentFetchCount(refVal_setCommentFetchCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCreateCount")):
+            {
+                double refVal_setCommentCreateCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCreateCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCreateCount(refVal_setCommentCreateCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("conversationCreateCount")):
+            {
+                double refVal_setConversationCreateCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setConversationCreateCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConversationCreateCount(refVal_setConversationCreateCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("voteCount")):
+            {
+                double refVal_setVoteCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setVoteCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVoteCount(refVal_setVoteCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("accountCreatedCount")):
+            {
+                double refVal_setAccountCreatedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setAccountCreatedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAccountCreatedCount(refVal_setAccountCreatedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userMentionSearch")):
+            {
+                double refVal_setUserMentionSearch;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserMentionSearch))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserMentionSearch(refVal_setUserMentionSearch);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTagSearch")):
+            {
+                double refVal_setHashTagSearch;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTagSearch))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTagSearch(refVal_setHashTagSearch);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("gifSearchTrending")):
+            {
+                double refVal_setGifSearchTrending;
+                if(!ModelBase::readBinary(reader, field, refVal_setGifSearchTrending))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGifSearchTrending(refVal_setGifSearchTrending);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("gifSearch")):
+            {
+                double refVal_setGifSearch;
+                if(!ModelBase::readBinary(reader, field, refVal_setGifSearch))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGifSearch(refVal_setGifSearch);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("apiCreditsUsed")):
+            {
+                double refVal_setApiCreditsUsed;
+                if(!ModelBase::readBinary(reader, field, refVal_setApiCreditsUsed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApiCreditsUsed(refVal_setApiCreditsUsed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("billed")):
+            {
+                bool refVal_setBilled;
+                if(!ModelBase::readBinary(reader, field, refVal_setBilled))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBilled(refVal_setBilled);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ignored")):
+            {
+                bool refVal_setIgnored;
+                if(!ModelBase::readBinary(reader, field, refVal_setIgnored))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIgnored(refVal_setIgnored);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("apiErrorCount")):
+            {
+                double refVal_setApiErrorCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setApiErrorCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApiErrorCount(refVal_setApiErrorCount);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APITenantDailyUsage::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -393,79 +849,79 @@ void APITenantDailyUsage::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_YearNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_YearNumber))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearNumber")), m_YearNumber));
     }
-    if(m_MonthNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_MonthNumber))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthNumber")), m_MonthNumber));
     }
-    if(m_DayNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_DayNumber))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("dayNumber")), m_DayNumber));
     }
-    if(m_CommentFetchCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentFetchCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentFetchCount")), m_CommentFetchCount));
     }
-    if(m_CommentCreateCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCreateCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCreateCount")), m_CommentCreateCount));
     }
-    if(m_ConversationCreateCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ConversationCreateCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("conversationCreateCount")), m_ConversationCreateCount));
     }
-    if(m_VoteCountIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("voteCount")), m_VoteCount));
     }
-    if(m_AccountCreatedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_AccountCreatedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("accountCreatedCount")), m_AccountCreatedCount));
     }
-    if(m_UserMentionSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_UserMentionSearch))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userMentionSearch")), m_UserMentionSearch));
     }
-    if(m_HashTagSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTagSearch))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTagSearch")), m_HashTagSearch));
     }
-    if(m_GifSearchTrendingIsSet)
+    if(m_FieldsSet.test(FieldBit_GifSearchTrending))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("gifSearchTrending")), m_GifSearchTrending));
     }
-    if(m_GifSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_GifSearch))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("gifSearch")), m_GifSearch));
     }
-    if(m_ApiCreditsUsedIsSet)
+    if(m_FieldsSet.test(FieldBit_ApiCreditsUsed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("apiCreditsUsed")), m_ApiCreditsUsed));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_BilledIsSet)
+    if(m_FieldsSet.test(FieldBit_Billed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("billed")), m_Billed));
     }
-    if(m_IgnoredIsSet)
+    if(m_FieldsSet.test(FieldBit_Ignored))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ignored")), m_Ignored));
     }
-    if(m_ApiErrorCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ApiErrorCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("apiErrorCount")), m_ApiErrorCount));
     }
@@ -607,17 +1063,17 @@ utility::string_t APITenantDailyUsage::getId() const
 void APITenantDailyUsage::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool APITenantDailyUsage::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void APITenantDailyUsage::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 utility::string_t APITenantDailyUsage::getTenantId() const
 {
@@ -628,17 +1084,17 @@ utility::string_t APITenantDailyUsage::getTenantId() const
 void APITenantDailyUsage::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool APITenantDailyUsage::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void APITenantDailyUsage::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 double APITenantDailyUsage::getYearNumber() const
 {
@@ -648,17 +1104,17 @@ double APITenantDailyUsage::getYearNumber() const
 void APITenantDailyUsage::setYearNumber(double value)
 {
     m_YearNumber = value;
-    m_YearNumberIsSet = true;
+    m_FieldsSet.set(FieldBit_YearNumber);
 }
 
 bool APITenantDailyUsage::yearNumberIsSet() const
 {
-    return m_YearNumberIsSet;
+    return m_FieldsSet.test(FieldBit_YearNumber);
 }
 
 void APITenantDailyUsage::unsetYearNumber()
 {
-    m_YearNumberIsSet = false;
+    m_FieldsSet.reset(FieldBit_YearNumber);
 }
 double APITenantDailyUsage::getMonthNumber() const
 {
@@ -668,17 +1124,17 @@ double APITenantDailyUsage::getMonthNumber() const
 void APITenantDailyUsage::setMonthNumber(double value)
 {
     m_MonthNumber = value;
-    m_MonthNumberIsSet = true;
+    m_FieldsSet.set(FieldBit_MonthNumber);
 }
 
 bool APITenantDailyUsage::monthNumberIsSet() const
 {
-    return m_MonthNumberIsSet;
+    return m_FieldsSet.test(FieldBit_MonthNumber);
 }
 
 void APITenantDailyUsage::unsetMonthNumber()
 {
-    m_MonthNumberIsSet = false;
+    m_FieldsSet.reset(FieldBit_MonthNumber);
 }
 double APITenantDailyUsage::getDayNumber() const
 {
@@ -688,17 +1144,17 @@ double APITenantDailyUsage::getDayNumber() const
 void APITenantDailyUsage::setDayNumber(double value)
 {
     m_DayNumber = value;
-    m_DayNumberIsSet = true;
+    m_FieldsSet.set(FieldBit_DayNumber);
 }
 
 bool APITenantDailyUsage::dayNumberIsSet() const
 {
-    return m_DayNumberIsSet;
+    return m_FieldsSet.test(FieldBit_DayNumber);
 }
 
 void APITenantDailyUsage::unsetDayNumber()
 {
-    m_DayNumberIsSet = false;
+    m_FieldsSet.reset(FieldBit_DayNumber);
 }
 double APITenantDailyUsage::getCommentFetchCount() const
 {
@@ -708,17 +1164,17 @@ double APITenantDailyUsage::getCommentFetchCount() const
 void APITenantDailyUsage::setCommentFetchCount(double value)
 {
     m_CommentFetchCount = value;
-    m_CommentFetchCountIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentFetchCount);
 }
 
 bool APITenantDailyUsage::commentFetchCountIsSet() const
 {
-    return m_CommentFetchCountIsSet;
+    return m_FieldsSet.test(FieldBit_CommentFetchCount);
 }
 
 void APITenantDailyUsage::unsetCommentFetchCount()
 {
-    m_CommentFetchCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentFetchCount);
 }
 double APITenantDailyUsage::getCommentCreateCount() const
 {
@@ -728,17 +1184,17 @@ double APITenantDailyUsage::getCommentCreateCount() const
 void APITenantDailyUsage::setCommentCreateCount(double value)
 {
     m_CommentCreateCount = value;
-    m_CommentCreateCountIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentCreateCount);
 }
 
 bool APITenantDailyUsage::commentCreateCountIsSet() const
 {
-    return m_CommentCreateCountIsSet;
+    return m_FieldsSet.test(FieldBit_CommentCreateCount);
 }
 
 void APITenantDailyUsage::unsetCommentCreateCount()
 {
-    m_CommentCreateCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentCreateCount);
 }
 double APITenantDailyUsage::getConversationCreateCount() const
 {
@@ -748,17 +1204,17 @@ double APITenantDailyUsage::getConversationCreateCount() const
 void APITenantDailyUsage::setConversationCreateCount(double value)
 {
     m_ConversationCreateCount = value;
-    m_ConversationCreateCountIsSet = true;
+    m_FieldsSet.set(FieldBit_ConversationCreateCount);
 }
 
 bool APITenantDailyUsage::conversationCreateCountIsSet() const
 {
-    return m_ConversationCreateCountIsSet;
+    return m_FieldsSet.test(FieldBit_ConversationCreateCount);
 }
 
 void APITenantDailyUsage::unsetConversationCreateCount()
 {
-    m_ConversationCreateCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_ConversationCreateCount);
 }
 double APITenantDailyUsage::getVoteCount() const
 {
@@ -768,17 +1224,17 @@ double APITenantDailyUsage::getVoteCount() const
 void APITenantDailyUsage::setVoteCount(double value)
 {
     m_VoteCount = value;
-    m_VoteCountIsSet = true;
+    m_FieldsSet.set(FieldBit_VoteCount);
 }
 
 bool APITenantDailyUsage::voteCountIsSet() const
 {
-    return m_VoteCountIsSet;
+    return m_FieldsSet.test(FieldBit_VoteCount);
 }
 
 void APITenantDailyUsage::unsetVoteCount()
 {
-    m_VoteCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_VoteCount);
 }
 double APITenantDailyUsage::getAccountCreatedCount() const
 {
@@ -788,17 +1244,17 @@ double APITenantDailyUsage::getAccountCreatedCount() const
 void APITenantDailyUsage::setAccountCreatedCount(double value)
 {
     m_AccountCreatedCount = value;
-    m_AccountCreatedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_AccountCreatedCount);
 }
 
 bool APITenantDailyUsage::accountCreatedCountIsSet() const
 {
-    return m_AccountCreatedCountIsSet;
+    return m_FieldsSet.test(FieldBit_AccountCreatedCount);
 }
 
 void APITenantDailyUsage::unsetAccountCreatedCount()
 {
-    m_AccountCreatedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_AccountCreatedCount);
 }
 double APITenantDailyUsage::getUserMentionSearch() const
 {
@@ -808,17 +1264,17 @@ double APITenantDailyUsage::getUserMentionSearch() const
 void APITenantDailyUsage::setUserMentionSearch(double value)
 {
     m_UserMentionSearch = value;
-    m_UserMentionSearchIsSet = true;
+    m_FieldsSet.set(FieldBit_UserMentionSearch);
 }
 
 bool APITenantDailyUsage::userMentionSearchIsSet() const
 {
-    return m_UserMentionSearchIsSet;
+    return m_FieldsSet.test(FieldBit_UserMentionSearch);
 }
 
 void APITenantDailyUsage::unsetUserMentionSearch()
 {
-    m_UserMentionSearchIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserMentionSearch);
 }
 double APITenantDailyUsage::getHashTagSearch() const
 {
@@ -828,17 +1284,17 @@ double APITenantDailyUsage::getHashTagSearch() const
 void APITenantDailyUsage::setHashTagSearch(double value)
 {
     m_HashTagSearch = value;
-    m_HashTagSearchIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTagSearch);
 }
 
 bool APITenantDailyUsage::hashTagSearchIsSet() const
 {
-    return m_HashTagSearchIsSet;
+    return m_FieldsSet.test(FieldBit_HashTagSearch);
 }
 
 void APITenantDailyUsage::unsetHashTagSearch()
 {
-    m_HashTagSearchIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTagSearch);
 }
 double APITenantDailyUsage::getGifSearchTrending() const
 {
@@ -848,17 +1304,17 @@ double APITenantDailyUsage::getGifSearchTrending() const
 void APITenantDailyUsage::setGifSearchTrending(double value)
 {
     m_GifSearchTrending = value;
-    m_GifSearchTrendingIsSet = true;
+    m_FieldsSet.set(FieldBit_GifSearchTrending);
 }
 
 bool APITenantDailyUsage::gifSearchTrendingIsSet() const
 {
-    return m_GifSearchTrendingIsSet;
+    return m_FieldsSet.test(FieldBit_GifSearchTrending);
 }
 
 void APITenantDailyUsage::unsetGifSearchTrending()
 {
-    m_GifSearchTrendingIsSet = false;
+    m_FieldsSet.reset(FieldBit_GifSearchTrending);
 }
 double APITenantDailyUsage::getGifSearch() const
 {
@@ -868,17 +1324,17 @@ double APITenantDailyUsage::getGifSearch() const
 void APITenantDailyUsage::setGifSearch(double value)
 {
     m_GifSearch = value;
-    m_GifSearchIsSet = true;
+    m_FieldsSet.set(FieldBit_GifSearch);
 }
 
 bool APITenantDailyUsage::gifSearchIsSet() const
 {
-    return m_GifSearchIsSet;
+    return m_FieldsSet.test(FieldBit_GifSearch);
 }
 
 void APITenantDailyUsage::unsetGifSearch()
 {
-    m_GifSearchIsSet = false;
+    m_FieldsSet.reset(FieldBit_GifSearch);
 }
 double APITenantDailyUsage::getApiCreditsUsed() const
 {
@@ -888,17 +1344,17 @@ double APITenantDailyUsage::getApiCreditsUsed() const
 void APITenantDailyUsage::setApiCreditsUsed(double value)
 {
     m_ApiCreditsUsed = value;
-    m_ApiCreditsUsedIsSet = true;
+    m_FieldsSet.set(FieldBit_ApiCreditsUsed);
 }
 
 bool APITenantDailyUsage::apiCreditsUsedIsSet() const
 {
-    return m_ApiCreditsUsedIsSet;
+    return m_FieldsSet.test(FieldBit_ApiCreditsUsed);
 }
 
 void APITenantDailyUsage::unsetApiCreditsUsed()
 {
-    m_ApiCreditsUsedIsSet = false;
+    m_FieldsSet.reset(FieldBit_ApiCreditsUsed);
 }
 utility::datetime APITenantDailyUsage::getCreatedAt() const
 {
@@ -909,17 +1365,17 @@ utility::datetime APITenantDailyUsage::getCreatedAt() const
 void APITenantDailyUsage::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool APITenantDailyUsage::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void APITenantDailyUsage::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 bool APITenantDailyUsage::isBilled() const
 {
@@ -929,17 +1385,17 @@ bool APITenantDailyUsage::isBilled() const
 void APITenantDailyUsage::setBilled(bool value)
 {
     m_Billed = value;
-    m_BilledIsSet = true;
+    m_FieldsSet.set(FieldBit_Billed);
 }
 
 bool APITenantDailyUsage::billedIsSet() const
 {
-    return m_BilledIsSet;
+    return m_FieldsSet.test(FieldBit_Billed);
 }
 
 void APITenantDailyUsage::unsetBilled()
 {
-    m_BilledIsSet = false;
+    m_FieldsSet.reset(FieldBit_Billed);
 }
 bool APITenantDailyUsage::isIgnored() const
 {
@@ -949,17 +1405,17 @@ bool APITenantDailyUsage::isIgnored() const
 void APITenantDailyUsage::setIgnored(bool value)
 {
     m_Ignored = value;
-    m_IgnoredIsSet = true;
+    m_FieldsSet.set(FieldBit_Ignored);
 }
 
 bool APITenantDailyUsage::ignoredIsSet() const
 {
-    return m_IgnoredIsSet;
+    return m_FieldsSet.test(FieldBit_Ignored);
 }
 
 void APITenantDailyUsage::unsetIgnored()
 {
-    m_IgnoredIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ignored);
 }
 double APITenantDailyUsage::getApiErrorCount() const
 {
@@ -969,17 +1425,17 @@ double APITenantDailyUsage::getApiErrorCount() const
 void APITenantDailyUsage::setApiErrorCount(double value)
 {
     m_ApiErrorCount = value;
-    m_ApiErrorCountIsSet = true;
+    m_FieldsSet.set(FieldBit_ApiErrorCount);
 }
 
 bool APITenantDailyUsage::apiErrorCountIsSet() const
 {
-    return m_ApiErrorCountIsSet;
+    return m_FieldsSet.test(FieldBit_ApiErrorCount);
 }
 
 void APITenantDailyUsage::unsetApiErrorCount()
 {
-    m_ApiErrorCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_ApiErrorCount);
 }
 
 }
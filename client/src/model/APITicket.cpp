@@ -20,23 +20,8 @@ namespace model {
 
 APITicket::APITicket()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_ManagedByTenantId = utility::conversions::to_string_t("");
-    m_ManagedByTenantIdIsSet = false;
-    m_AssignedUserIdsIsSet = false;
-    m_Subject = utility::conversions::to_string_t("");
-    m_SubjectIsSet = false;
-    m_CreatedAt = utility::conversions::to_string_t("");
-    m_CreatedAtIsSet = false;
     m_State = 0;
-    m_StateIsSet = false;
     m_FileCount = 0;
-    m_FileCountIsSet = false;
 }
 
 APITicket::~APITicket()
@@ -51,47 +36,47 @@ void APITicket::validate()
 web::json::value APITicket::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_ManagedByTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("managedByTenantId"))] = ModelBase::toJson(m_ManagedByTenantId);
     }
-    if(m_AssignedUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("assignedUserIds"))] = ModelBase::toJson(m_AssignedUserIds);
     }
-    if(m_SubjectIsSet)
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("subject"))] = ModelBase::toJson(m_Subject);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("state"))] = ModelBase::toJson(m_State);
     }
-    if(m_FileCountIsSet)
+    if(m_FieldsSet.test(FieldBit_FileCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fileCount"))] = ModelBase::toJson(m_FileCount);
@@ -100,109 +85,357 @@ web::json::value APITicket::toJson() const
     return val;
 }
 
+void APITicket::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
+    {
+        
+        writer.key(_XPLATSTR("managedByTenantId"));
+        ModelBase::writeJson(writer, m_ManagedByTenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
+    {
+        
+        writer.key(_XPLATSTR("assignedUserIds"));
+        ModelBase::writeJson(writer, m_AssignedUserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Subject))
+    {
+        
+        writer.key(_XPLATSTR("subject"));
+        ModelBase::writeJson(writer, m_Subject);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_State))
+    {
+        
+        writer.key(_XPLATSTR("state"));
+        ModelBase::writeJson(writer, m_State);
+    }
+    if(m_FieldsSet.test(FieldBit_FileCount))
+    {
+        
+        writer.key(_XPLATSTR("fileCount"));
+        ModelBase::writeJson(writer, m_FileCount);
+    }
+
+    writer.endObject();
+}
+
 bool APITicket::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("managedByTenantId")):
+            if(field.first == _XPLATSTR("managedByTenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setManagedByTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setManagedByTenantId);
+                    setManagedByTenantId(refVal_setManagedByTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("assignedUserIds")):
+            if(field.first == _XPLATSTR("assignedUserIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setAssignedUserIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAssignedUserIds);
+                    setAssignedUserIds(refVal_setAssignedUserIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("subject")):
+            if(field.first == _XPLATSTR("subject"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSubject;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSubject);
+                    setSubject(refVal_setSubject);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            if(field.first == _XPLATSTR("state"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setState;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setState);
+                    setState(refVal_setState);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fileCount")):
+            if(field.first == _XPLATSTR("fileCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setFileCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFileCount);
+                    setFileCount(refVal_setFileCount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    return ok;
+}
+
+void APITicket::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("managedByTenantId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("managedByTenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setManagedByTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setManagedByTenantId);
-            setManagedByTenantId(refVal_setManagedByTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("assignedUserIds"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("assignedUserIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setAssignedUserIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAssignedUserIds);
-            setAssignedUserIds(refVal_setAssignedUserIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("subject"))))
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("subject")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSubject;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSubject);
-            setSubject(refVal_setSubject);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("managedByTenantId")), m_ManagedByTenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("assignedUserIds")), m_AssignedUserIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("state"))))
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("state")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setState;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setState);
-            setState(refVal_setState);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("subject")), m_Subject);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_State))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("state")), m_State);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fileCount"))))
+    if(m_FieldsSet.test(FieldBit_FileCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fileCount")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fileCount")), m_FileCount);
+    }
+}
+
+bool APITicket::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int32_t refVal_setFileCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFileCount);
-            setFileCount(refVal_setFileCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("managedByTenantId")):
+            {
+                utility::string_t refVal_setManagedByTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setManagedByTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setManagedByTenantId(refVal_setManagedByTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("assignedUserIds")):
+            {
+                std::vector<utility::string_t> refVal_setAssignedUserIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setAssignedUserIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAssignedUserIds(refVal_setAssignedUserIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("subject")):
+            {
+                utility::string_t refVal_setSubject;
+                if(!ModelBase::readBinary(reader, field, refVal_setSubject))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSubject(refVal_setSubject);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::string_t refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            {
+                int32_t refVal_setState;
+                if(!ModelBase::readBinary(reader, field, refVal_setState))
+                {
+                    ok = false;
+                    continue;
+                }
+                setState(refVal_setState);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fileCount")):
+            {
+                int32_t refVal_setFileCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setFileCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFileCount(refVal_setFileCount);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APITicket::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -212,39 +445,39 @@ void APITicket::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_ManagedByTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("managedByTenantId")), m_ManagedByTenantId));
     }
-    if(m_AssignedUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("assignedUserIds")), m_AssignedUserIds));
     }
-    if(m_SubjectIsSet)
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("subject")), m_Subject));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("state")), m_State));
     }
-    if(m_FileCountIsSet)
+    if(m_FieldsSet.test(FieldBit_FileCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fileCount")), m_FileCount));
     }
@@ -326,17 +559,17 @@ utility::string_t APITicket::getId() const
 void APITicket::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool APITicket::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void APITicket::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t APITicket::getUrlId() const
 {
@@ -347,17 +580,17 @@ utility::string_t APITicket::getUrlId() const
 void APITicket::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool APITicket::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void APITicket::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t APITicket::getUserId() const
 {
@@ -368,17 +601,17 @@ utility::string_t APITicket::getUserId() const
 void APITicket::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool APITicket::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void APITicket::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t APITicket::getManagedByTenantId() const
 {
@@ -389,17 +622,17 @@ utility::string_t APITicket::getManagedByTenantId() const
 void APITicket::setManagedByTenantId(const utility::string_t& value)
 {
     m_ManagedByTenantId = value;
-    m_ManagedByTenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ManagedByTenantId);
 }
 
 bool APITicket::managedByTenantIdIsSet() const
 {
-    return m_ManagedByTenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_ManagedByTenantId);
 }
 
 void APITicket::unsetManagedByTenantId()
 {
-    m_ManagedByTenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ManagedByTenantId);
 }
 std::vector<utility::string_t> APITicket::getAssignedUserIds() const
 {
@@ -410,17 +643,17 @@ std::vector<utility::string_t> APITicket::getAssignedUserIds() const
 void APITicket::setAssignedUserIds(const std::vector<utility::string_t>& value)
 {
     m_AssignedUserIds = value;
-    m_AssignedUserIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_AssignedUserIds);
 }
 
 bool APITicket::assignedUserIdsIsSet() const
 {
-    return m_AssignedUserIdsIsSet;
+    return m_FieldsSet.test(FieldBit_AssignedUserIds);
 }
 
 void APITicket::unsetAssignedUserIds()
 {
-    m_AssignedUserIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AssignedUserIds);
 }
 utility::string_t APITicket::getSubject() const
 {
@@ -431,17 +664,17 @@ utility::string_t APITicket::getSubject() const
 void APITicket::setSubject(const utility::string_t& value)
 {
     m_Subject = value;
-    m_SubjectIsSet = true;
+    m_FieldsSet.set(FieldBit_Subject);
 }
 
 bool APITicket::subjectIsSet() const
 {
-    return m_SubjectIsSet;
+    return m_FieldsSet.test(FieldBit_Subject);
 }
 
 void APITicket::unsetSubject()
 {
-    m_SubjectIsSet = false;
+    m_FieldsSet.reset(FieldBit_Subject);
 }
 utility::string_t APITicket::getCreatedAt() const
 {
@@ -452,17 +685,17 @@ utility::string_t APITicket::getCreatedAt() const
 void APITicket::setCreatedAt(const utility::string_t& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool APITicket::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void APITicket::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 int32_t APITicket::getState() const
 {
@@ -472,17 +705,17 @@ int32_t APITicket::getState() const
 void APITicket::setState(int32_t value)
 {
     m_State = value;
-    m_StateIsSet = true;
+    m_FieldsSet.set(FieldBit_State);
 }
 
 bool APITicket::stateIsSet() const
 {
-    return m_StateIsSet;
+    return m_FieldsSet.test(FieldBit_State);
 }
 
 void APITicket::unsetState()
 {
-    m_StateIsSet = false;
+    m_FieldsSet.reset(FieldBit_State);
 }
 int32_t APITicket::getFileCount() const
 {
@@ -492,17 +725,17 @@ int32_t APITicket::getFileCount() const
 void APITicket::setFileCount(int32_t value)
 {
     m_FileCount = value;
-    m_FileCountIsSet = true;
+    m_FieldsSet.set(FieldBit_FileCount);
 }
 
 bool APITicket::fileCountIsSet() const
 {
-    return m_FileCountIsSet;
+    return m_FieldsSet.test(FieldBit_FileCount);
 }
 
 void APITicket::unsetFileCount()
 {
-    m_FileCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_FileCount);
 }
 
 }
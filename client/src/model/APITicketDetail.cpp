@@ -20,24 +20,8 @@ namespace model {
 
 APITicketDetail::APITicketDetail()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_ManagedByTenantId = utility::conversions::to_string_t("");
-    m_ManagedByTenantIdIsSet = false;
-    m_AssignedUserIdsIsSet = false;
-    m_Subject = utility::conversions::to_string_t("");
-    m_SubjectIsSet = false;
-    m_CreatedAt = utility::conversions::to_string_t("");
-    m_CreatedAtIsSet = false;
     m_State = 0;
-    m_StateIsSet = false;
     m_FileCount = 0;
-    m_FileCountIsSet = false;
-    m_FilesIsSet = false;
 }
 
 APITicketDetail::~APITicketDetail()
@@ -52,222 +36,562 @@ void APITicketDetail::validate()
 web::json::value APITicketDetail::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_ManagedByTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("managedByTenantId"))] = ModelBase::toJson(m_ManagedByTenantId);
     }
-    if(m_AssignedUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("assignedUserIds"))] = ModelBase::toJson(m_AssignedUserIds);
     }
-    if(m_SubjectIsSet)
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("subject"))] = ModelBase::toJson(m_Subject);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("state"))] = ModelBase::toJson(m_State);
     }
-    if(m_FileCountIsSet)
+    if(m_FieldsSet.test(FieldBit_FileCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fileCount"))] = ModelBase::toJson(m_FileCount);
     }
-    if(m_FilesIsSet)
+    if(m_FieldsSet.test(FieldBit_Files))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("files"))] = ModelBase::toJson(m_Files);
     }
-    if(m_ReopenedAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ReopenedAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("reopenedAt"))] = ModelBase::toJson(m_ReopenedAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("reopenedAt"))] = ModelBase::toJson(m_ReopenedAt);
     }
-    if(m_ResolvedAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ResolvedAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("resolvedAt"))] = ModelBase::toJson(m_ResolvedAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("resolvedAt"))] = ModelBase::toJson(m_ResolvedAt);
     }
-    if(m_AckAt.has_value())
+    if(m_FieldsSet.test(FieldBit_AckAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("ackAt"))] = ModelBase::toJson(m_AckAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("ackAt"))] = ModelBase::toJson(m_AckAt);
     }
 
     return val;
 }
 
+void APITicketDetail::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
+    {
+        
+        writer.key(_XPLATSTR("managedByTenantId"));
+        ModelBase::writeJson(writer, m_ManagedByTenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
+    {
+        
+        writer.key(_XPLATSTR("assignedUserIds"));
+        ModelBase::writeJson(writer, m_AssignedUserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Subject))
+    {
+        
+        writer.key(_XPLATSTR("subject"));
+        ModelBase::writeJson(writer, m_Subject);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_State))
+    {
+        
+        writer.key(_XPLATSTR("state"));
+        ModelBase::writeJson(writer, m_State);
+    }
+    if(m_FieldsSet.test(FieldBit_FileCount))
+    {
+        
+        writer.key(_XPLATSTR("fileCount"));
+        ModelBase::writeJson(writer, m_FileCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Files))
+    {
+        
+        writer.key(_XPLATSTR("files"));
+        ModelBase::writeJson(writer, m_Files);
+    }
+    if(m_FieldsSet.test(FieldBit_ReopenedAt))
+    {
+        
+        writer.key(_XPLATSTR("reopenedAt"));
+        ModelBase::writeJson(writer, m_ReopenedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_ResolvedAt))
+    {
+        
+        writer.key(_XPLATSTR("resolvedAt"));
+        ModelBase::writeJson(writer, m_ResolvedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_AckAt))
+    {
+        
+        writer.key(_XPLATSTR("ackAt"));
+        ModelBase::writeJson(writer, m_AckAt);
+    }
+
+    writer.endObject();
+}
+
 bool APITicketDetail::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("managedByTenantId")):
+            if(field.first == _XPLATSTR("managedByTenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setManagedByTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setManagedByTenantId);
+                    setManagedByTenantId(refVal_setManagedByTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("assignedUserIds")):
+            if(field.first == _XPLATSTR("assignedUserIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setAssignedUserIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAssignedUserIds);
+                    setAssignedUserIds(refVal_setAssignedUserIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("subject")):
+            if(field.first == _XPLATSTR("subject"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSubject;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSubject);
+                    setSubject(refVal_setSubject);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            if(field.first == _XPLATSTR("state"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setState;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setState);
+                    setState(refVal_setState);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fileCount")):
+            if(field.first == _XPLATSTR("fileCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setFileCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFileCount);
+                    setFileCount(refVal_setFileCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("files")):
+            if(field.first == _XPLATSTR("files"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APITicketFile>> refVal_setFiles;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFiles);
+                    setFiles(refVal_setFiles);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reopenedAt")):
+            if(field.first == _XPLATSTR("reopenedAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReopenedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReopenedAt);
+                    setReopenedAt(refVal_setReopenedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("resolvedAt")):
+            if(field.first == _XPLATSTR("resolvedAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setResolvedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setResolvedAt);
+                    setResolvedAt(refVal_setResolvedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ackAt")):
+            if(field.first == _XPLATSTR("ackAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAckAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAckAt);
+                    setAckAt(refVal_setAckAt);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    return ok;
+}
+
+void APITicketDetail::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("managedByTenantId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("managedByTenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setManagedByTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setManagedByTenantId);
-            setManagedByTenantId(refVal_setManagedByTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("assignedUserIds"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("assignedUserIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setAssignedUserIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAssignedUserIds);
-            setAssignedUserIds(refVal_setAssignedUserIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("subject"))))
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("subject")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSubject;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSubject);
-            setSubject(refVal_setSubject);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("managedByTenantId")), m_ManagedByTenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("assignedUserIds")), m_AssignedUserIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("state"))))
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("state")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setState;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setState);
-            setState(refVal_setState);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("subject")), m_Subject);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fileCount"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fileCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setFileCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFileCount);
-            setFileCount(refVal_setFileCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("files"))))
+    if(m_FieldsSet.test(FieldBit_State))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("files")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<APITicketFile>> refVal_setFiles;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFiles);
-            setFiles(refVal_setFiles);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("state")), m_State);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reopenedAt"))))
+    if(m_FieldsSet.test(FieldBit_FileCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reopenedAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReopenedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReopenedAt);
-            setReopenedAt(refVal_setReopenedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fileCount")), m_FileCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("resolvedAt"))))
+    if(m_FieldsSet.test(FieldBit_Files))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("resolvedAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setResolvedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setResolvedAt);
-            setResolvedAt(refVal_setResolvedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("files")), m_Files);
+    }
+    if(m_FieldsSet.test(FieldBit_ReopenedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reopenedAt")), m_ReopenedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ackAt"))))
+    if(m_FieldsSet.test(FieldBit_ResolvedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ackAt")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("resolvedAt")), m_ResolvedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_AckAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ackAt")), m_AckAt);
+    }
+}
+
+bool APITicketDetail::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setAckAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAckAt);
-            setAckAt(refVal_setAckAt);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("managedByTenantId")):
+            {
+                utility::string_t refVal_setManagedByTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setManagedByTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setManagedByTenantId(refVal_setManagedByTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("assignedUserIds")):
+            {
+                std::vector<utility::string_t> refVal_setAssignedUserIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setAssignedUserIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAssignedUserIds(refVal_setAssignedUserIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("subject")):
+            {
+                utility::string_t refVal_setSubject;
+                if(!ModelBase::readBinary(reader, field, refVal_setSubject))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSubject(refVal_setSubject);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::string_t refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            {
+                int32_t refVal_setState;
+                if(!ModelBase::readBinary(reader, field, refVal_setState))
+                {
+                    ok = false;
+                    continue;
+                }
+                setState(refVal_setState);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fileCount")):
+            {
+                int32_t refVal_setFileCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setFileCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFileCount(refVal_setFileCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("files")):
+            {
+                std::vector<std::shared_ptr<APITicketFile>> refVal_setFiles;
+                if(!ModelBase::readBinary(reader, field, refVal_setFiles))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFiles(refVal_setFiles);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reopenedAt")):
+            {
+                utility::string_t refVal_setReopenedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setReopenedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReopenedAt(refVal_setReopenedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("resolvedAt")):
+            {
+                utility::string_t refVal_setResolvedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setResolvedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setResolvedAt(refVal_setResolvedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ackAt")):
+            {
+                utility::string_t refVal_setAckAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setAckAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAckAt(refVal_setAckAt);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APITicketDetail::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -277,57 +601,57 @@ void APITicketDetail::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_ManagedByTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("managedByTenantId")), m_ManagedByTenantId));
     }
-    if(m_AssignedUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AssignedUserIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("assignedUserIds")), m_AssignedUserIds));
     }
-    if(m_SubjectIsSet)
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("subject")), m_Subject));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("state")), m_State));
     }
-    if(m_FileCountIsSet)
+    if(m_FieldsSet.test(FieldBit_FileCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fileCount")), m_FileCount));
     }
-    if(m_FilesIsSet)
+    if(m_FieldsSet.test(FieldBit_Files))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("files")), m_Files));
     }
-    if(m_ReopenedAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ReopenedAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reopenedAt")), m_ReopenedAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reopenedAt")), m_ReopenedAt));
     }
-    if(m_ResolvedAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ResolvedAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("resolvedAt")), m_ResolvedAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("resolvedAt")), m_ResolvedAt));
     }
-    if(m_AckAt.has_value())
+    if(m_FieldsSet.test(FieldBit_AckAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ackAt")), m_AckAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ackAt")), m_AckAt));
     }
 }
 
@@ -431,17 +755,17 @@ utility::string_t APITicketDetail::getId() const
 void APITicketDetail::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool APITicketDetail::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void APITicketDetail::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t APITicketDetail::getUrlId() const
 {
@@ -452,17 +776,17 @@ utility::string_t APITicketDetail::getUrlId() const
 void APITicketDetail::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool APITicketDetail::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void APITicketDetail::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t APITicketDetail::getUserId() const
 {
@@ -473,17 +797,17 @@ utility::string_t APITicketDetail::getUserId() const
 void APITicketDetail::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool APITicketDetail::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void APITicketDetail::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t APITicketDetail::getManagedByTenantId() const
 {
@@ -494,17 +818,17 @@ utility::string_t APITicketDetail::getManagedByTenantId() const
 void APITicketDetail::setManagedByTenantId(const utility::string_t& value)
 {
     m_ManagedByTenantId = value;
-    m_ManagedByTenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ManagedByTenantId);
 }
 
 bool APITicketDetail::managedByTenantIdIsSet() const
 {
-    return m_ManagedByTenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_ManagedByTenantId);
 }
 
 void APITicketDetail::unsetManagedByTenantId()
 {
-    m_ManagedByTenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ManagedByTenantId);
 }
 std::vector<utility::string_t> APITicketDetail::getAssignedUserIds() const
 {
@@ -515,17 +839,17 @@ std::vector<utility::string_t> APITicketDetail::getAssignedUserIds() const
 void APITicketDetail::setAssignedUserIds(const std::vector<utility::string_t>& value)
 {
     m_AssignedUserIds = value;
-    m_AssignedUserIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_AssignedUserIds);
 }
 
 bool APITicketDetail::assignedUserIdsIsSet() const
 {
-    return m_AssignedUserIdsIsSet;
+    return m_FieldsSet.test(FieldBit_AssignedUserIds);
 }
 
 void APITicketDetail::unsetAssignedUserIds()
 {
-    m_AssignedUserIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AssignedUserIds);
 }
 utility::string_t APITicketDetail::getSubject() const
 {
@@ -536,17 +860,17 @@ utility::string_t APITicketDetail::getSubject() const
 void APITicketDetail::setSubject(const utility::string_t& value)
 {
     m_Subject = value;
-    m_SubjectIsSet = true;
+    m_FieldsSet.set(FieldBit_Subject);
 }
 
 bool APITicketDetail::subjectIsSet() const
 {
-    return m_SubjectIsSet;
+    return m_FieldsSet.test(FieldBit_Subject);
 }
 
 void APITicketDetail::unsetSubject()
 {
-    m_SubjectIsSet = false;
+    m_FieldsSet.reset(FieldBit_Subject);
 }
 utility::string_t APITicketDetail::getCreatedAt() const
 {
@@ -557,17 +881,17 @@ utility::string_t APITicketDetail::getCreatedAt() const
 void APITicketDetail::setCreatedAt(const utility::string_t& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool APITicketDetail::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void APITicketDetail::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 int32_t APITicketDetail::getState() const
 {
@@ -577,17 +901,17 @@ int32_t APITicketDetail::getState() const
 void APITicketDetail::setState(int32_t value)
 {
     m_State = value;
-    m_StateIsSet = true;
+    m_FieldsSet.set(FieldBit_State);
 }
 
 bool APITicketDetail::stateIsSet() const
 {
-    return m_StateIsSet;
+    return m_FieldsSet.test(FieldBit_State);
 }
 
 void APITicketDetail::unsetState()
 {
-    m_StateIsSet = false;
+    m_FieldsSet.reset(FieldBit_State);
 }
 int32_t APITicketDetail::getFileCount() const
 {
@@ -597,17 +921,17 @@ int32_t APITicketDetail::getFileCount() const
 void APITicketDetail::setFileCount(int32_t value)
 {
     m_FileCount = value;
-    m_FileCountIsSet = true;
+    m_FieldsSet.set(FieldBit_FileCount);
 }
 
 bool APITicketDetail::fileCountIsSet() const
 {
-    return m_FileCountIsSet;
+    return m_FieldsSet.test(FieldBit_FileCount);
 }
 
 void APITicketDetail::unsetFileCount()
 {
-    m_FileCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_FileCount);
 }
 std::vector<std::shared_ptr<APITicketFile>> APITicketDetail::getFiles() const
 {
@@ -618,77 +942,80 @@ std::vector<std::shared_ptr<APITicketFile>> APITicketDetail::getFiles() const
 void APITicketDetail::setFiles(const std::vector<std::shared_ptr<APITicketFile>>& value)
 {
     m_Files = value;
-    m_FilesIsSet = true;
+    m_FieldsSet.set(FieldBit_Files);
 }
 
 bool APITicketDetail::filesIsSet() const
 {
-    return m_FilesIsSet;
+    return m_FieldsSet.test(FieldBit_Files);
 }
 
 void APITicketDetail::unsetFiles()
 {
-    m_FilesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Files);
 }
 utility::string_t APITicketDetail::getReopenedAt() const
 {
-    return m_ReopenedAt.get();
+    return m_ReopenedAt;
 }
 
 
 void APITicketDetail::setReopenedAt(const utility::string_t& value)
 {
     m_ReopenedAt = value;
+    m_FieldsSet.set(FieldBit_ReopenedAt);
 }
 
 bool APITicketDetail::reopenedAtIsSet() const
 {
-    return m_ReopenedAt.has_value();
+    return m_FieldsSet.test(FieldBit_ReopenedAt);
 }
 
 void APITicketDetail::unsetReopenedAt()
 {
-    m_ReopenedAt.reset();
+    m_FieldsSet.reset(FieldBit_ReopenedAt);
 }
 utility::string_t APITicketDetail::getResolvedAt() const
 {
-    return m_ResolvedAt.get();
+    return m_ResolvedAt;
 }
 
 
 void APITicketDetail::setResolvedAt(const utility::string_t& value)
 {
     m_ResolvedAt = value;
+    m_FieldsSet.set(FieldBit_ResolvedAt);
 }
 
 bool APITicketDetail::resolvedAtIsSet() const
 {
-    return m_ResolvedAt.has_value();
+    return m_FieldsSet.test(FieldBit_ResolvedAt);
 }
 
 void APITicketDetail::unsetResolvedAt()
 {
-    m_ResolvedAt.reset();
+    m_FieldsSet.reset(FieldBit_ResolvedAt);
 }
 utility::string_t APITicketDetail::getAckAt() const
 {
-    return m_AckAt.get();
+    return m_AckAt;
 }
 
 
 void APITicketDetail::setAckAt(const utility::string_t& value)
 {
     m_AckAt = value;
+    m_FieldsSet.set(FieldBit_AckAt);
 }
 
 bool APITicketDetail::ackAtIsSet() const
 {
-    return m_AckAt.has_value();
+    return m_FieldsSet.test(FieldBit_AckAt);
 }
 
 void APITicketDetail::unsetAckAt()
 {
-    m_AckAt.reset();
+    m_FieldsSet.reset(FieldBit_AckAt);
 }
 
 }
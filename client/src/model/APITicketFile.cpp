@@ -20,26 +20,8 @@ namespace model {
 
 APITicketFile::APITicketFile()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
-    m_S3Key = utility::conversions::to_string_t("");
-    m_S3KeyIsSet = false;
-    m_OriginalFileName = utility::conversions::to_string_t("");
-    m_OriginalFileNameIsSet = false;
     m_SizeBytes = 0;
-    m_SizeBytesIsSet = false;
-    m_ContentType = utility::conversions::to_string_t("");
-    m_ContentTypeIsSet = false;
-    m_UploadedByUserId = utility::conversions::to_string_t("");
-    m_UploadedByUserIdIsSet = false;
-    m_UploadedAt = utility::conversions::to_string_t("");
-    m_UploadedAtIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_ExpiresAt = utility::conversions::to_string_t("");
-    m_ExpiresAtIsSet = false;
     m_Expired = false;
-    m_ExpiredIsSet = false;
 }
 
 APITicketFile::~APITicketFile()
@@ -54,52 +36,52 @@ void APITicketFile::validate()
 web::json::value APITicketFile::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_S3KeyIsSet)
+    if(m_FieldsSet.test(FieldBit_S3Key))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("s3Key"))] = ModelBase::toJson(m_S3Key);
     }
-    if(m_OriginalFileNameIsSet)
+    if(m_FieldsSet.test(FieldBit_OriginalFileName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("originalFileName"))] = ModelBase::toJson(m_OriginalFileName);
     }
-    if(m_SizeBytesIsSet)
+    if(m_FieldsSet.test(FieldBit_SizeBytes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sizeBytes"))] = ModelBase::toJson(m_SizeBytes);
     }
-    if(m_ContentTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("contentType"))] = ModelBase::toJson(m_ContentType);
     }
-    if(m_UploadedByUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UploadedByUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("uploadedByUserId"))] = ModelBase::toJson(m_UploadedByUserId);
     }
-    if(m_UploadedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_UploadedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("uploadedAt"))] = ModelBase::toJson(m_UploadedAt);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_ExpiresAtIsSet)
+    if(m_FieldsSet.test(FieldBit_ExpiresAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("expiresAt"))] = ModelBase::toJson(m_ExpiresAt);
     }
-    if(m_ExpiredIsSet)
+    if(m_FieldsSet.test(FieldBit_Expired))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("expired"))] = ModelBase::toJson(m_Expired);
@@ -108,120 +90,391 @@ web::json::value APITicketFile::toJson() const
     return val;
 }
 
+void APITicketFile::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_S3Key))
+    {
+        
+        writer.key(_XPLATSTR("s3Key"));
+        ModelBase::writeJson(writer, m_S3Key);
+    }
+    if(m_FieldsSet.test(FieldBit_OriginalFileName))
+    {
+        
+        writer.key(_XPLATSTR("originalFileName"));
+        ModelBase::writeJson(writer, m_OriginalFileName);
+    }
+    if(m_FieldsSet.test(FieldBit_SizeBytes))
+    {
+        
+        writer.key(_XPLATSTR("sizeBytes"));
+        ModelBase::writeJson(writer, m_SizeBytes);
+    }
+    if(m_FieldsSet.test(FieldBit_ContentType))
+    {
+        
+        writer.key(_XPLATSTR("contentType"));
+        ModelBase::writeJson(writer, m_ContentType);
+    }
+    if(m_FieldsSet.test(FieldBit_UploadedByUserId))
+    {
+        
+        writer.key(_XPLATSTR("uploadedByUserId"));
+        ModelBase::writeJson(writer, m_UploadedByUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UploadedAt))
+    {
+        
+        writer.key(_XPLATSTR("uploadedAt"));
+        ModelBase::writeJson(writer, m_UploadedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpiresAt))
+    {
+        
+        writer.key(_XPLATSTR("expiresAt"));
+        ModelBase::writeJson(writer, m_ExpiresAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Expired))
+    {
+        
+        writer.key(_XPLATSTR("expired"));
+        ModelBase::writeJson(writer, m_Expired);
+    }
+
+    writer.endObject();
+}
+
 bool APITicketFile::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("s3Key"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("s3Key")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setS3Key;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setS3Key);
-            setS3Key(refVal_setS3Key);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("s3Key")):
+            if(field.first == _XPLATSTR("s3Key"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setS3Key;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setS3Key);
+                    setS3Key(refVal_setS3Key);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("originalFileName")):
+            if(field.first == _XPLATSTR("originalFileName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setOriginalFileName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOriginalFileName);
+                    setOriginalFileName(refVal_setOriginalFileName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sizeBytes")):
+            if(field.first == _XPLATSTR("sizeBytes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setSizeBytes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSizeBytes);
+                    setSizeBytes(refVal_setSizeBytes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("contentType")):
+            if(field.first == _XPLATSTR("contentType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setContentType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setContentType);
+                    setContentType(refVal_setContentType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("uploadedByUserId")):
+            if(field.first == _XPLATSTR("uploadedByUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUploadedByUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUploadedByUserId);
+                    setUploadedByUserId(refVal_setUploadedByUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("uploadedAt")):
+            if(field.first == _XPLATSTR("uploadedAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUploadedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUploadedAt);
+                    setUploadedAt(refVal_setUploadedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expiresAt")):
+            if(field.first == _XPLATSTR("expiresAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setExpiresAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpiresAt);
+                    setExpiresAt(refVal_setExpiresAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expired")):
+            if(field.first == _XPLATSTR("expired"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setExpired;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpired);
+                    setExpired(refVal_setExpired);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("originalFileName"))))
+    return ok;
+}
+
+void APITicketFile::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("originalFileName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setOriginalFileName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOriginalFileName);
-            setOriginalFileName(refVal_setOriginalFileName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sizeBytes"))))
+    if(m_FieldsSet.test(FieldBit_S3Key))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sizeBytes")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setSizeBytes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSizeBytes);
-            setSizeBytes(refVal_setSizeBytes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("s3Key")), m_S3Key);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("contentType"))))
+    if(m_FieldsSet.test(FieldBit_OriginalFileName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("contentType")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setContentType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setContentType);
-            setContentType(refVal_setContentType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("originalFileName")), m_OriginalFileName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("uploadedByUserId"))))
+    if(m_FieldsSet.test(FieldBit_SizeBytes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("uploadedByUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUploadedByUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUploadedByUserId);
-            setUploadedByUserId(refVal_setUploadedByUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sizeBytes")), m_SizeBytes);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("uploadedAt"))))
+    if(m_FieldsSet.test(FieldBit_ContentType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("uploadedAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUploadedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUploadedAt);
-            setUploadedAt(refVal_setUploadedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("contentType")), m_ContentType);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_UploadedByUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("uploadedByUserId")), m_UploadedByUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expiresAt"))))
+    if(m_FieldsSet.test(FieldBit_UploadedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expiresAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setExpiresAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpiresAt);
-            setExpiresAt(refVal_setExpiresAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("uploadedAt")), m_UploadedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpiresAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expiresAt")), m_ExpiresAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expired"))))
+    if(m_FieldsSet.test(FieldBit_Expired))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expired")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expired")), m_Expired);
+    }
+}
+
+bool APITicketFile::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setExpired;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpired);
-            setExpired(refVal_setExpired);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("s3Key")):
+            {
+                utility::string_t refVal_setS3Key;
+                if(!ModelBase::readBinary(reader, field, refVal_setS3Key))
+                {
+                    ok = false;
+                    continue;
+                }
+                setS3Key(refVal_setS3Key);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("originalFileName")):
+            {
+                utility::string_t refVal_setOriginalFileName;
+                if(!ModelBase::readBinary(reader, field, refVal_setOriginalFileName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOriginalFileName(refVal_setOriginalFileName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sizeBytes")):
+            {
+                int32_t refVal_setSizeBytes;
+                if(!ModelBase::readBinary(reader, field, refVal_setSizeBytes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSizeBytes(refVal_setSizeBytes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("contentType")):
+            {
+                utility::string_t refVal_setContentType;
+                if(!ModelBase::readBinary(reader, field, refVal_setContentType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setContentType(refVal_setContentType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("uploadedByUserId")):
+            {
+                utility::string_t refVal_setUploadedByUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUploadedByUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUploadedByUserId(refVal_setUploadedByUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("uploadedAt")):
+            {
+                utility::string_t refVal_setUploadedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setUploadedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUploadedAt(refVal_setUploadedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expiresAt")):
+            {
+                utility::string_t refVal_setExpiresAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpiresAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpiresAt(refVal_setExpiresAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expired")):
+            {
+                bool refVal_setExpired;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpired))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpired(refVal_setExpired);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APITicketFile::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -231,43 +484,43 @@ void APITicketFile::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_S3KeyIsSet)
+    if(m_FieldsSet.test(FieldBit_S3Key))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("s3Key")), m_S3Key));
     }
-    if(m_OriginalFileNameIsSet)
+    if(m_FieldsSet.test(FieldBit_OriginalFileName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("originalFileName")), m_OriginalFileName));
     }
-    if(m_SizeBytesIsSet)
+    if(m_FieldsSet.test(FieldBit_SizeBytes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sizeBytes")), m_SizeBytes));
     }
-    if(m_ContentTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("contentType")), m_ContentType));
     }
-    if(m_UploadedByUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UploadedByUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("uploadedByUserId")), m_UploadedByUserId));
     }
-    if(m_UploadedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_UploadedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("uploadedAt")), m_UploadedAt));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_ExpiresAtIsSet)
+    if(m_FieldsSet.test(FieldBit_ExpiresAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expiresAt")), m_ExpiresAt));
     }
-    if(m_ExpiredIsSet)
+    if(m_FieldsSet.test(FieldBit_Expired))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expired")), m_Expired));
     }
@@ -355,17 +608,17 @@ utility::string_t APITicketFile::getId() const
 void APITicketFile::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool APITicketFile::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void APITicketFile::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 utility::string_t APITicketFile::getS3Key() const
 {
@@ -376,17 +629,17 @@ utility::string_t APITicketFile::getS3Key() const
 void APITicketFile::setS3Key(const utility::string_t& value)
 {
     m_S3Key = value;
-    m_S3KeyIsSet = true;
+    m_FieldsSet.set(FieldBit_S3Key);
 }
 
 bool APITicketFile::s3KeyIsSet() const
 {
-    return m_S3KeyIsSet;
+    return m_FieldsSet.test(FieldBit_S3Key);
 }
 
 void APITicketFile::unsetS3Key()
 {
-    m_S3KeyIsSet = false;
+    m_FieldsSet.reset(FieldBit_S3Key);
 }
 utility::string_t APITicketFile::getOriginalFileName() const
 {
@@ -397,17 +650,17 @@ utility::string_t APITicketFile::getOriginalFileName() const
 void APITicketFile::setOriginalFileName(const utility::string_t& value)
 {
     m_OriginalFileName = value;
-    m_OriginalFileNameIsSet = true;
+    m_FieldsSet.set(FieldBit_OriginalFileName);
 }
 
 bool APITicketFile::originalFileNameIsSet() const
 {
-    return m_OriginalFileNameIsSet;
+    return m_FieldsSet.test(FieldBit_OriginalFileName);
 }
 
 void APITicketFile::unsetOriginalFileName()
 {
-    m_OriginalFileNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_OriginalFileName);
 }
 int32_t APITicketFile::getSizeBytes() const
 {
@@ -417,17 +670,17 @@ int32_t APITicketFile::getSizeBytes() const
 void APITicketFile::setSizeBytes(int32_t value)
 {
     m_SizeBytes = value;
-    m_SizeBytesIsSet = true;
+    m_FieldsSet.set(FieldBit_SizeBytes);
 }
 
 bool APITicketFile::sizeBytesIsSet() const
 {
-    return m_SizeBytesIsSet;
+    return m_FieldsSet.test(FieldBit_SizeBytes);
 }
 
 void APITicketFile::unsetSizeBytes()
 {
-    m_SizeBytesIsSet = false;
+    m_FieldsSet.reset(FieldBit_SizeBytes);
 }
 utility::string_t APITicketFile::getContentType() const
 {
@@ -438,17 +691,17 @@ utility::string_t APITicketFile::getContentType() const
 void APITicketFile::setContentType(const utility::string_t& value)
 {
     m_ContentType = value;
-    m_ContentTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_ContentType);
 }
 
 bool APITicketFile::contentTypeIsSet() const
 {
-    return m_ContentTypeIsSet;
+    return m_FieldsSet.test(FieldBit_ContentType);
 }
 
 void APITicketFile::unsetContentType()
 {
-    m_ContentTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_ContentType);
 }
 utility::string_t APITicketFile::getUploadedByUserId() const
 {
@@ -459,17 +712,17 @@ utility::string_t APITicketFile::getUploadedByUserId() const
 void APITicketFile::setUploadedByUserId(const utility::string_t& value)
 {
     m_UploadedByUserId = value;
-    m_UploadedByUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UploadedByUserId);
 }
 
 bool APITicketFile::uploadedByUserIdIsSet() const
 {
-    return m_UploadedByUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UploadedByUserId);
 }
 
 void APITicketFile::unsetUploadedByUserId()
 {
-    m_UploadedByUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UploadedByUserId);
 }
 utility::string_t APITicketFile::getUploadedAt() const
 {
@@ -480,17 +733,17 @@ utility::string_t APITicketFile::getUploadedAt() const
 void APITicketFile::setUploadedAt(const utility::string_t& value)
 {
     m_UploadedAt = value;
-    m_UploadedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_UploadedAt);
 }
 
 bool APITicketFile::uploadedAtIsSet() const
 {
-    return m_UploadedAtIsSet;
+    return m_FieldsSet.test(FieldBit_UploadedAt);
 }
 
 void APITicketFile::unsetUploadedAt()
 {
-    m_UploadedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_UploadedAt);
 }
 utility::string_t APITicketFile::getUrl() const
 {
@@ -501,17 +754,17 @@ utility::string_t APITicketFile::getUrl() const
 void APITicketFile::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool APITicketFile::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void APITicketFile::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t APITicketFile::getExpiresAt() const
 {
@@ -522,17 +775,17 @@ utility::string_t APITicketFile::getExpiresAt() const
 void APITicketFile::setExpiresAt(const utility::string_t& value)
 {
     m_ExpiresAt = value;
-    m_ExpiresAtIsSet = true;
+    m_FieldsSet.set(FieldBit_ExpiresAt);
 }
 
 bool APITicketFile::expiresAtIsSet() const
 {
-    return m_ExpiresAtIsSet;
+    return m_FieldsSet.test(FieldBit_ExpiresAt);
 }
 
 void APITicketFile::unsetExpiresAt()
 {
-    m_ExpiresAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_ExpiresAt);
 }
 bool APITicketFile::isExpired() const
 {
@@ -542,17 +795,17 @@ bool APITicketFile::isExpired() const
 void APITicketFile::setExpired(bool value)
 {
     m_Expired = value;
-    m_ExpiredIsSet = true;
+    m_FieldsSet.set(FieldBit_Expired);
 }
 
 bool APITicketFile::expiredIsSet() const
 {
-    return m_ExpiredIsSet;
+    return m_FieldsSet.test(FieldBit_Expired);
 }
 
 void APITicketFile::unsetExpired()
 {
-    m_ExpiredIsSet = false;
+    m_FieldsSet.reset(FieldBit_Expired);
 }
 
 }
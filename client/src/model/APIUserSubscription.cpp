@@ -21,21 +21,6 @@ namespace model {
 APIUserSubscription::APIUserSubscription()
 {
     m_NotificationFrequency = 0.0;
-    m_NotificationFrequencyIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_PageTitle = utility::conversions::to_string_t("");
-    m_PageTitleIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_AnonUserId = utility::conversions::to_string_t("");
-    m_AnonUserIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
 }
 
 APIUserSubscription::~APIUserSubscription()
@@ -50,42 +35,42 @@ void APIUserSubscription::validate()
 web::json::value APIUserSubscription::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))] = ModelBase::toJson(m_NotificationFrequency);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
@@ -94,98 +79,323 @@ web::json::value APIUserSubscription::toJson() const
     return val;
 }
 
+void APIUserSubscription::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
+    {
+        
+        writer.key(_XPLATSTR("notificationFrequency"));
+        ModelBase::writeJson(writer, m_NotificationFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+
+    writer.endObject();
+}
+
 bool APIUserSubscription::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setNotificationFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
-            setNotificationFrequency(refVal_setNotificationFrequency);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            if(field.first == _XPLATSTR("notificationFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNotificationFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
+                    setNotificationFrequency(refVal_setNotificationFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPageTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
+                    setPageTitle(refVal_setPageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    return ok;
+}
+
+void APIUserSubscription::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationFrequency")), m_NotificationFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
+    }
+}
+
+bool APIUserSubscription::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            {
+                double refVal_setNotificationFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationFrequency(refVal_setNotificationFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                utility::string_t refVal_setPageTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageTitle(refVal_setPageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void APIUserSubscription::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -195,35 +405,35 @@ void APIUserSubscription::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")), m_NotificationFrequency));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
@@ -298,17 +508,17 @@ double APIUserSubscription::getNotificationFrequency() const
 void APIUserSubscription::setNotificationFrequency(double value)
 {
     m_NotificationFrequency = value;
-    m_NotificationFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationFrequency);
 }
 
 bool APIUserSubscription::notificationFrequencyIsSet() const
 {
-    return m_NotificationFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationFrequency);
 }
 
 void APIUserSubscription::unsetNotificationFrequency()
 {
-    m_NotificationFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationFrequency);
 }
 utility::datetime APIUserSubscription::getCreatedAt() const
 {
@@ -319,17 +529,17 @@ utility::datetime APIUserSubscription::getCreatedAt() const
 void APIUserSubscription::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool APIUserSubscription::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void APIUserSubscription::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t APIUserSubscription::getPageTitle() const
 {
@@ -340,17 +550,17 @@ utility::string_t APIUserSubscription::getPageTitle() const
 void APIUserSubscription::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
-    m_PageTitleIsSet = true;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool APIUserSubscription::pageTitleIsSet() const
 {
-    return m_PageTitleIsSet;
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void APIUserSubscription::unsetPageTitle()
 {
-    m_PageTitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 utility::string_t APIUserSubscription::getUrl() const
 {
@@ -361,17 +571,17 @@ utility::string_t APIUserSubscription::getUrl() const
 void APIUserSubscription::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool APIUserSubscription::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void APIUserSubscription::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t APIUserSubscription::getUrlId() const
 {
@@ -382,17 +592,17 @@ utility::string_t APIUserSubscription::getUrlId() const
 void APIUserSubscription::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool APIUserSubscription::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void APIUserSubscription::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t APIUserSubscription::getAnonUserId() const
 {
@@ -403,17 +613,17 @@ utility::string_t APIUserSubscription::getAnonUserId() const
 void APIUserSubscription::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
-    m_AnonUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool APIUserSubscription::anonUserIdIsSet() const
 {
-    return m_AnonUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void APIUserSubscription::unsetAnonUserId()
 {
-    m_AnonUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t APIUserSubscription::getUserId() const
 {
@@ -424,17 +634,17 @@ utility::string_t APIUserSubscription::getUserId() const
 void APIUserSubscription::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool APIUserSubscription::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void APIUserSubscription::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t APIUserSubscription::getId() const
 {
@@ -445,17 +655,17 @@ utility::string_t APIUserSubscription::getId() const
 void APIUserSubscription::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool APIUserSubscription::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void APIUserSubscription::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 
 }
@@ -20,10 +20,6 @@ namespace model {
 
 AddDomainConfigResponse::AddDomainConfigResponse()
 {
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
 }
 
 AddDomainConfigResponse::~AddDomainConfigResponse()
@@ -38,78 +34,211 @@ void AddDomainConfigResponse::validate()
 web::json::value AddDomainConfigResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_Configuration.has_value())
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("configuration"))] = ModelBase::toJson(m_Configuration.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("configuration"))] = ModelBase::toJson(m_Configuration);
     }
 
     return val;
 }
 
+void AddDomainConfigResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Configuration))
+    {
+        
+        writer.key(_XPLATSTR("configuration"));
+        ModelBase::writeJson(writer, m_Configuration);
+    }
+
+    writer.endObject();
+}
+
 bool AddDomainConfigResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("configuration")):
+            if(field.first == _XPLATSTR("configuration"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setConfiguration;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConfiguration);
+                    setConfiguration(refVal_setConfiguration);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void AddDomainConfigResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<Object> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("configuration"))))
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("configuration")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Configuration))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("configuration")), m_Configuration);
+    }
+}
+
+bool AddDomainConfigResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<Object> refVal_setConfiguration;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConfiguration);
-            setConfiguration(refVal_setConfiguration);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<Object> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("configuration")):
+            {
+                std::shared_ptr<Object> refVal_setConfiguration;
+                if(!ModelBase::readBinary(reader, field, refVal_setConfiguration))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConfiguration(refVal_setConfiguration);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AddDomainConfigResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -119,21 +248,21 @@ void AddDomainConfigResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_Configuration.has_value())
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configuration")), m_Configuration.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configuration")), m_Configuration));
     }
 }
 
@@ -183,17 +312,17 @@ utility::string_t AddDomainConfigResponse::getReason() const
 void AddDomainConfigResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool AddDomainConfigResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void AddDomainConfigResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t AddDomainConfigResponse::getCode() const
 {
@@ -204,57 +333,59 @@ utility::string_t AddDomainConfigResponse::getCode() const
 void AddDomainConfigResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool AddDomainConfigResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void AddDomainConfigResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 std::shared_ptr<Object> AddDomainConfigResponse::getStatus() const
 {
-    return m_Status.get();
+    return m_Status;
 }
 
 
 void AddDomainConfigResponse::setStatus(const std::shared_ptr<Object>& value)
 {
     m_Status = value;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AddDomainConfigResponse::statusIsSet() const
 {
-    return m_Status.has_value();
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AddDomainConfigResponse::unsetStatus()
 {
-    m_Status.reset();
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<Object> AddDomainConfigResponse::getConfiguration() const
 {
-    return m_Configuration.get();
+    return m_Configuration;
 }
 
 
 void AddDomainConfigResponse::setConfiguration(const std::shared_ptr<Object>& value)
 {
     m_Configuration = value;
+    m_FieldsSet.set(FieldBit_Configuration);
 }
 
 bool AddDomainConfigResponse::configurationIsSet() const
 {
-    return m_Configuration.has_value();
+    return m_FieldsSet.test(FieldBit_Configuration);
 }
 
 void AddDomainConfigResponse::unsetConfiguration()
 {
-    m_Configuration.reset();
+    m_FieldsSet.reset(FieldBit_Configuration);
 }
 
 }
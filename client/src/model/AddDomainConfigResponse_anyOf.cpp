@@ -34,46 +34,133 @@ void AddDomainConfigResponse_anyOf::validate()
 web::json::value AddDomainConfigResponse_anyOf::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_Configuration.has_value())
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("configuration"))] = ModelBase::toJson(m_Configuration.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("configuration"))] = ModelBase::toJson(m_Configuration);
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
 
     return val;
 }
 
+void AddDomainConfigResponse_anyOf::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Configuration))
+    {
+        
+        writer.key(_XPLATSTR("configuration"));
+        ModelBase::writeJson(writer, m_Configuration);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool AddDomainConfigResponse_anyOf::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("configuration"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("configuration")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<AnyType> refVal_setConfiguration;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConfiguration);
-            setConfiguration(refVal_setConfiguration);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configuration")):
+            if(field.first == _XPLATSTR("configuration"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AnyType> refVal_setConfiguration;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConfiguration);
+                    setConfiguration(refVal_setConfiguration);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AnyType> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void AddDomainConfigResponse_anyOf::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("configuration")), m_Configuration);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool AddDomainConfigResponse_anyOf::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<AnyType> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configuration")):
+            {
+                std::shared_ptr<AnyType> refVal_setConfiguration;
+                if(!ModelBase::readBinary(reader, field, refVal_setConfiguration))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConfiguration(refVal_setConfiguration);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<AnyType> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AddDomainConfigResponse_anyOf::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -83,13 +170,13 @@ void AddDomainConfigResponse_anyOf::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_Configuration.has_value())
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configuration")), m_Configuration.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configuration")), m_Configuration));
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
 }
 
@@ -120,43 +207,45 @@ bool AddDomainConfigResponse_anyOf::fromMultiPart(std::shared_ptr<MultipartFormD
 
 std::shared_ptr<AnyType> AddDomainConfigResponse_anyOf::getConfiguration() const
 {
-    return m_Configuration.get();
+    return m_Configuration;
 }
 
 
 void AddDomainConfigResponse_anyOf::setConfiguration(const std::shared_ptr<AnyType>& value)
 {
     m_Configuration = value;
+    m_FieldsSet.set(FieldBit_Configuration);
 }
 
 bool AddDomainConfigResponse_anyOf::configurationIsSet() const
 {
-    return m_Configuration.has_value();
+    return m_FieldsSet.test(FieldBit_Configuration);
 }
 
 void AddDomainConfigResponse_anyOf::unsetConfiguration()
 {
-    m_Configuration.reset();
+    m_FieldsSet.reset(FieldBit_Configuration);
 }
 std::shared_ptr<AnyType> AddDomainConfigResponse_anyOf::getStatus() const
 {
-    return m_Status.get();
+    return m_Status;
 }
 
 
 void AddDomainConfigResponse_anyOf::setStatus(const std::shared_ptr<AnyType>& value)
 {
     m_Status = value;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AddDomainConfigResponse_anyOf::statusIsSet() const
 {
-    return m_Status.has_value();
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AddDomainConfigResponse_anyOf::unsetStatus()
 {
-    m_Status.reset();
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,13 +20,6 @@ namespace model {
 
 AddPageAPIResponse::AddPageAPIResponse()
 {
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_PageIsSet = false;
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
 }
 
 AddPageAPIResponse::~AddPageAPIResponse()
@@ -41,22 +34,22 @@ void AddPageAPIResponse::validate()
 web::json::value AddPageAPIResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_PageIsSet)
+    if(m_FieldsSet.test(FieldBit_Page))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("page"))] = ModelBase::toJson(m_Page);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -65,54 +58,187 @@ web::json::value AddPageAPIResponse::toJson() const
     return val;
 }
 
+void AddPageAPIResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Page))
+    {
+        
+        writer.key(_XPLATSTR("page"));
+        ModelBase::writeJson(writer, m_Page);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool AddPageAPIResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("page")):
+            if(field.first == _XPLATSTR("page"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIPage> refVal_setPage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPage);
+                    setPage(refVal_setPage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("page"))))
+    return ok;
+}
+
+void AddPageAPIResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("page")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIPage> refVal_setPage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPage);
-            setPage(refVal_setPage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Page))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("page")), m_Page);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool AddPageAPIResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("page")):
+            {
+                std::shared_ptr<APIPage> refVal_setPage;
+                if(!ModelBase::readBinary(reader, field, refVal_setPage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPage(refVal_setPage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AddPageAPIResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -122,19 +248,19 @@ void AddPageAPIResponse::toMultipart(std::shared_ptr<MultipartFormData> multipar
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_PageIsSet)
+    if(m_FieldsSet.test(FieldBit_Page))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("page")), m_Page));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -186,17 +312,17 @@ utility::string_t AddPageAPIResponse::getReason() const
 void AddPageAPIResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool AddPageAPIResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void AddPageAPIResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t AddPageAPIResponse::getCode() const
 {
@@ -207,17 +333,17 @@ utility::string_t AddPageAPIResponse::getCode() const
 void AddPageAPIResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool AddPageAPIResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void AddPageAPIResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 std::shared_ptr<APIPage> AddPageAPIResponse::getPage() const
 {
@@ -228,17 +354,17 @@ std::shared_ptr<APIPage> AddPageAPIResponse::getPage() const
 void AddPageAPIResponse::setPage(const std::shared_ptr<APIPage>& value)
 {
     m_Page = value;
-    m_PageIsSet = true;
+    m_FieldsSet.set(FieldBit_Page);
 }
 
 bool AddPageAPIResponse::pageIsSet() const
 {
-    return m_PageIsSet;
+    return m_FieldsSet.test(FieldBit_Page);
 }
 
 void AddPageAPIResponse::unsetPage()
 {
-    m_PageIsSet = false;
+    m_FieldsSet.reset(FieldBit_Page);
 }
 utility::string_t AddPageAPIResponse::getStatus() const
 {
@@ -249,17 +375,17 @@ utility::string_t AddPageAPIResponse::getStatus() const
 void AddPageAPIResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AddPageAPIResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AddPageAPIResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,13 +20,6 @@ namespace model {
 
 AddSSOUserAPIResponse::AddSSOUserAPIResponse()
 {
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_UserIsSet = false;
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
 }
 
 AddSSOUserAPIResponse::~AddSSOUserAPIResponse()
@@ -41,22 +34,22 @@ void AddSSOUserAPIResponse::validate()
 web::json::value AddSSOUserAPIResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_UserIsSet)
+    if(m_FieldsSet.test(FieldBit_User))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -65,54 +58,187 @@ web::json::value AddSSOUserAPIResponse::toJson() const
     return val;
 }
 
+void AddSSOUserAPIResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        writer.key(_XPLATSTR("user"));
+        ModelBase::writeJson(writer, m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool AddSSOUserAPIResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            if(field.first == _XPLATSTR("user"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APISSOUser> refVal_setUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
+                    setUser(refVal_setUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("user"))))
+    return ok;
+}
+
+void AddSSOUserAPIResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("user")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APISSOUser> refVal_setUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
-            setUser(refVal_setUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("user")), m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool AddSSOUserAPIResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            {
+                std::shared_ptr<APISSOUser> refVal_setUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUser(refVal_setUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AddSSOUserAPIResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -122,19 +248,19 @@ void AddSSOUserAPIResponse::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_UserIsSet)
+    if(m_FieldsSet.test(FieldBit_User))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -186,17 +312,17 @@ utility::string_t AddSSOUserAPIResponse::getReason() const
 void AddSSOUserAPIResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool AddSSOUserAPIResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void AddSSOUserAPIResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t AddSSOUserAPIResponse::getCode() const
 {
@@ -207,17 +333,17 @@ utility::string_t AddSSOUserAPIResponse::getCode() const
 void AddSSOUserAPIResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool AddSSOUserAPIResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void AddSSOUserAPIResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 std::shared_ptr<APISSOUser> AddSSOUserAPIResponse::getUser() const
 {
@@ -228,17 +354,17 @@ std::shared_ptr<APISSOUser> AddSSOUserAPIResponse::getUser() const
 void AddSSOUserAPIResponse::setUser(const std::shared_ptr<APISSOUser>& value)
 {
     m_User = value;
-    m_UserIsSet = true;
+    m_FieldsSet.set(FieldBit_User);
 }
 
 bool AddSSOUserAPIResponse::userIsSet() const
 {
-    return m_UserIsSet;
+    return m_FieldsSet.test(FieldBit_User);
 }
 
 void AddSSOUserAPIResponse::unsetUser()
 {
-    m_UserIsSet = false;
+    m_FieldsSet.reset(FieldBit_User);
 }
 utility::string_t AddSSOUserAPIResponse::getStatus() const
 {
@@ -249,17 +375,17 @@ utility::string_t AddSSOUserAPIResponse::getStatus() const
 void AddSSOUserAPIResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AddSSOUserAPIResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AddSSOUserAPIResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
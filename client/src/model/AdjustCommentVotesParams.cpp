@@ -21,7 +21,6 @@ namespace model {
 AdjustCommentVotesParams::AdjustCommentVotesParams()
 {
     m_AdjustVoteAmount = 0.0;
-    m_AdjustVoteAmountIsSet = false;
 }
 
 AdjustCommentVotesParams::~AdjustCommentVotesParams()
@@ -36,7 +35,7 @@ void AdjustCommentVotesParams::validate()
 web::json::value AdjustCommentVotesParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_AdjustVoteAmountIsSet)
+    if(m_FieldsSet.test(FieldBit_AdjustVoteAmount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("adjustVoteAmount"))] = ModelBase::toJson(m_AdjustVoteAmount);
@@ -45,23 +44,87 @@ web::json::value AdjustCommentVotesParams::toJson() const
     return val;
 }
 
+void AdjustCommentVotesParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_AdjustVoteAmount))
+    {
+        
+        writer.key(_XPLATSTR("adjustVoteAmount"));
+        ModelBase::writeJson(writer, m_AdjustVoteAmount);
+    }
+
+    writer.endObject();
+}
+
 bool AdjustCommentVotesParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("adjustVoteAmount"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("adjustVoteAmount")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setAdjustVoteAmount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAdjustVoteAmount);
-            setAdjustVoteAmount(refVal_setAdjustVoteAmount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("adjustVoteAmount")):
+            if(field.first == _XPLATSTR("adjustVoteAmount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAdjustVoteAmount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAdjustVoteAmount);
+                    setAdjustVoteAmount(refVal_setAdjustVoteAmount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void AdjustCommentVotesParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_AdjustVoteAmount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("adjustVoteAmount")), m_AdjustVoteAmount);
+    }
+}
+
+bool AdjustCommentVotesParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("adjustVoteAmount")):
+            {
+                double refVal_setAdjustVoteAmount;
+                if(!ModelBase::readBinary(reader, field, refVal_setAdjustVoteAmount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAdjustVoteAmount(refVal_setAdjustVoteAmount);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void AdjustCommentVotesParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -69,7 +132,7 @@ void AdjustCommentVotesParams::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_AdjustVoteAmountIsSet)
+    if(m_FieldsSet.test(FieldBit_AdjustVoteAmount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("adjustVoteAmount")), m_AdjustVoteAmount));
     }
@@ -102,17 +165,17 @@ double AdjustCommentVotesParams::getAdjustVoteAmount() const
 void AdjustCommentVotesParams::setAdjustVoteAmount(double value)
 {
     m_AdjustVoteAmount = value;
-    m_AdjustVoteAmountIsSet = true;
+    m_FieldsSet.set(FieldBit_AdjustVoteAmount);
 }
 
 bool AdjustCommentVotesParams::adjustVoteAmountIsSet() const
 {
-    return m_AdjustVoteAmountIsSet;
+    return m_FieldsSet.test(FieldBit_AdjustVoteAmount);
 }
 
 void AdjustCommentVotesParams::unsetAdjustVoteAmount()
 {
-    m_AdjustVoteAmountIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdjustVoteAmount);
 }
 
 }
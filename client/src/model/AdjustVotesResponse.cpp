@@ -20,10 +20,7 @@ namespace model {
 
 AdjustVotesResponse::AdjustVotesResponse()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
     m_NewCommentVotes = 0;
-    m_NewCommentVotesIsSet = false;
 }
 
 AdjustVotesResponse::~AdjustVotesResponse()
@@ -38,12 +35,12 @@ void AdjustVotesResponse::validate()
 web::json::value AdjustVotesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_NewCommentVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_NewCommentVotes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("newCommentVotes"))] = ModelBase::toJson(m_NewCommentVotes);
@@ -52,32 +49,119 @@ web::json::value AdjustVotesResponse::toJson() const
     return val;
 }
 
+void AdjustVotesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_NewCommentVotes))
+    {
+        
+        writer.key(_XPLATSTR("newCommentVotes"));
+        ModelBase::writeJson(writer, m_NewCommentVotes);
+    }
+
+    writer.endObject();
+}
+
 bool AdjustVotesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("newCommentVotes")):
+            if(field.first == _XPLATSTR("newCommentVotes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setNewCommentVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNewCommentVotes);
+                    setNewCommentVotes(refVal_setNewCommentVotes);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("newCommentVotes"))))
+    return ok;
+}
+
+void AdjustVotesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("newCommentVotes")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_NewCommentVotes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("newCommentVotes")), m_NewCommentVotes);
+    }
+}
+
+bool AdjustVotesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int32_t refVal_setNewCommentVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNewCommentVotes);
-            setNewCommentVotes(refVal_setNewCommentVotes);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("newCommentVotes")):
+            {
+                int32_t refVal_setNewCommentVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setNewCommentVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNewCommentVotes(refVal_setNewCommentVotes);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AdjustVotesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -87,11 +171,11 @@ void AdjustVotesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_NewCommentVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_NewCommentVotes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("newCommentVotes")), m_NewCommentVotes));
     }
@@ -131,17 +215,17 @@ utility::string_t AdjustVotesResponse::getStatus() const
 void AdjustVotesResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AdjustVotesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AdjustVotesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 int32_t AdjustVotesResponse::getNewCommentVotes() const
 {
@@ -151,17 +235,17 @@ int32_t AdjustVotesResponse::getNewCommentVotes() const
 void AdjustVotesResponse::setNewCommentVotes(int32_t value)
 {
     m_NewCommentVotes = value;
-    m_NewCommentVotesIsSet = true;
+    m_FieldsSet.set(FieldBit_NewCommentVotes);
 }
 
 bool AdjustVotesResponse::newCommentVotesIsSet() const
 {
-    return m_NewCommentVotesIsSet;
+    return m_FieldsSet.test(FieldBit_NewCommentVotes);
 }
 
 void AdjustVotesResponse::unsetNewCommentVotes()
 {
-    m_NewCommentVotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_NewCommentVotes);
 }
 
 }
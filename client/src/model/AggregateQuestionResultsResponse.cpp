@@ -20,8 +20,6 @@ namespace model {
 
 AggregateQuestionResultsResponse::AggregateQuestionResultsResponse()
 {
-    m_StatusIsSet = false;
-    m_DataIsSet = false;
 }
 
 AggregateQuestionResultsResponse::~AggregateQuestionResultsResponse()
@@ -36,12 +34,12 @@ void AggregateQuestionResultsResponse::validate()
 web::json::value AggregateQuestionResultsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_DataIsSet)
+    if(m_FieldsSet.test(FieldBit_Data))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("data"))] = ModelBase::toJson(m_Data);
@@ -50,32 +48,119 @@ web::json::value AggregateQuestionResultsResponse::toJson() const
     return val;
 }
 
+void AggregateQuestionResultsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Data))
+    {
+        
+        writer.key(_XPLATSTR("data"));
+        ModelBase::writeJson(writer, m_Data);
+    }
+
+    writer.endObject();
+}
+
 bool AggregateQuestionResultsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("data")):
+            if(field.first == _XPLATSTR("data"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QuestionResultAggregationOverall> refVal_setData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setData);
+                    setData(refVal_setData);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("data"))))
+    return ok;
+}
+
+void AggregateQuestionResultsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("data")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Data))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("data")), m_Data);
+    }
+}
+
+bool AggregateQuestionResultsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<QuestionResultAggregationOverall> refVal_setData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setData);
-            setData(refVal_setData);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("data")):
+            {
+                std::shared_ptr<QuestionResultAggregationOverall> refVal_setData;
+                if(!ModelBase::readBinary(reader, field, refVal_setData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setData(refVal_setData);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregateQuestionResultsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void AggregateQuestionResultsResponse::toMultipart(std::shared_ptr<MultipartForm
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_DataIsSet)
+    if(m_FieldsSet.test(FieldBit_Data))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("data")), m_Data));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> AggregateQuestionResultsResponse::getStatus() const
 void AggregateQuestionResultsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AggregateQuestionResultsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AggregateQuestionResultsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<QuestionResultAggregationOverall> AggregateQuestionResultsResponse::getData() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<QuestionResultAggregationOverall> AggregateQuestionResultsRespon
 void AggregateQuestionResultsResponse::setData(const std::shared_ptr<QuestionResultAggregationOverall>& value)
 {
     m_Data = value;
-    m_DataIsSet = true;
+    m_FieldsSet.set(FieldBit_Data);
 }
 
 bool AggregateQuestionResultsResponse::dataIsSet() const
 {
-    return m_DataIsSet;
+    return m_FieldsSet.test(FieldBit_Data);
 }
 
 void AggregateQuestionResultsResponse::unsetData()
 {
-    m_DataIsSet = false;
+    m_FieldsSet.reset(FieldBit_Data);
 }
 
 }
@@ -20,14 +20,6 @@ namespace model {
 
 AggregateResponse::AggregateResponse()
 {
-    m_StatusIsSet = false;
-    m_DataIsSet = false;
-    m_StatsIsSet = false;
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_ValidResourceNamesIsSet = false;
 }
 
 AggregateResponse::~AggregateResponse()
@@ -42,32 +34,32 @@ void AggregateResponse::validate()
 web::json::value AggregateResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_DataIsSet)
+    if(m_FieldsSet.test(FieldBit_Data))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("data"))] = ModelBase::toJson(m_Data);
     }
-    if(m_StatsIsSet)
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("stats"))] = ModelBase::toJson(m_Stats);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_ValidResourceNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_ValidResourceNames))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("validResourceNames"))] = ModelBase::toJson(m_ValidResourceNames);
@@ -76,76 +68,255 @@ web::json::value AggregateResponse::toJson() const
     return val;
 }
 
+void AggregateResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Data))
+    {
+        
+        writer.key(_XPLATSTR("data"));
+        ModelBase::writeJson(writer, m_Data);
+    }
+    if(m_FieldsSet.test(FieldBit_Stats))
+    {
+        
+        writer.key(_XPLATSTR("stats"));
+        ModelBase::writeJson(writer, m_Stats);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_ValidResourceNames))
+    {
+        
+        writer.key(_XPLATSTR("validResourceNames"));
+        ModelBase::writeJson(writer, m_ValidResourceNames);
+    }
+
+    writer.endObject();
+}
+
 bool AggregateResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("data"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("data")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<AggregationItem>> refVal_setData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setData);
-            setData(refVal_setData);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("data")):
+            if(field.first == _XPLATSTR("data"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<AggregationItem>> refVal_setData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setData);
+                    setData(refVal_setData);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("stats")):
+            if(field.first == _XPLATSTR("stats"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AggregationResponse_stats> refVal_setStats;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStats);
+                    setStats(refVal_setStats);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("validResourceNames")):
+            if(field.first == _XPLATSTR("validResourceNames"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setValidResourceNames;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setValidResourceNames);
+                    setValidResourceNames(refVal_setValidResourceNames);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("stats"))))
+    return ok;
+}
+
+void AggregateResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("stats")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<AggregationResponse_stats> refVal_setStats;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStats);
-            setStats(refVal_setStats);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(m_FieldsSet.test(FieldBit_Data))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("data")), m_Data);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("stats")), m_Stats);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("validResourceNames"))))
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("validResourceNames")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_ValidResourceNames))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("validResourceNames")), m_ValidResourceNames);
+    }
+}
+
+bool AggregateResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<utility::string_t> refVal_setValidResourceNames;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setValidResourceNames);
-            setValidResourceNames(refVal_setValidResourceNames);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("data")):
+            {
+                std::vector<std::shared_ptr<AggregationItem>> refVal_setData;
+                if(!ModelBase::readBinary(reader, field, refVal_setData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setData(refVal_setData);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("stats")):
+            {
+                std::shared_ptr<AggregationResponse_stats> refVal_setStats;
+                if(!ModelBase::readBinary(reader, field, refVal_setStats))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStats(refVal_setStats);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("validResourceNames")):
+            {
+                std::vector<utility::string_t> refVal_setValidResourceNames;
+                if(!ModelBase::readBinary(reader, field, refVal_setValidResourceNames))
+                {
+                    ok = false;
+                    continue;
+                }
+                setValidResourceNames(refVal_setValidResourceNames);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregateResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -155,27 +326,27 @@ void AggregateResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_DataIsSet)
+    if(m_FieldsSet.test(FieldBit_Data))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("data")), m_Data));
     }
-    if(m_StatsIsSet)
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("stats")), m_Stats));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_ValidResourceNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_ValidResourceNames))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("validResourceNames")), m_ValidResourceNames));
     }
@@ -239,17 +410,17 @@ std::shared_ptr<APIStatus> AggregateResponse::getStatus() const
 void AggregateResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AggregateResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AggregateResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<AggregationItem>> AggregateResponse::getData() const
 {
@@ -260,17 +431,17 @@ std::vector<std::shared_ptr<AggregationItem>> AggregateResponse::getData() const
 void AggregateResponse::setData(const std::vector<std::shared_ptr<AggregationItem>>& value)
 {
     m_Data = value;
-    m_DataIsSet = true;
+    m_FieldsSet.set(FieldBit_Data);
 }
 
 bool AggregateResponse::dataIsSet() const
 {
-    return m_DataIsSet;
+    return m_FieldsSet.test(FieldBit_Data);
 }
 
 void AggregateResponse::unsetData()
 {
-    m_DataIsSet = false;
+    m_FieldsSet.reset(FieldBit_Data);
 }
 std::shared_ptr<AggregationResponse_stats> AggregateResponse::getStats() const
 {
@@ -281,17 +452,17 @@ std::shared_ptr<AggregationResponse_stats> AggregateResponse::getStats() const
 void AggregateResponse::setStats(const std::shared_ptr<AggregationResponse_stats>& value)
 {
     m_Stats = value;
-    m_StatsIsSet = true;
+    m_FieldsSet.set(FieldBit_Stats);
 }
 
 bool AggregateResponse::statsIsSet() const
 {
-    return m_StatsIsSet;
+    return m_FieldsSet.test(FieldBit_Stats);
 }
 
 void AggregateResponse::unsetStats()
 {
-    m_StatsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Stats);
 }
 utility::string_t AggregateResponse::getReason() const
 {
@@ -302,17 +473,17 @@ utility::string_t AggregateResponse::getReason() const
 void AggregateResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool AggregateResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void AggregateResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t AggregateResponse::getCode() const
 {
@@ -323,17 +494,17 @@ utility::string_t AggregateResponse::getCode() const
 void AggregateResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool AggregateResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void AggregateResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 std::vector<utility::string_t> AggregateResponse::getValidResourceNames() const
 {
@@ -344,17 +515,17 @@ std::vector<utility::string_t> AggregateResponse::getValidResourceNames() const
 void AggregateResponse::setValidResourceNames(const std::vector<utility::string_t>& value)
 {
     m_ValidResourceNames = value;
-    m_ValidResourceNamesIsSet = true;
+    m_FieldsSet.set(FieldBit_ValidResourceNames);
 }
 
 bool AggregateResponse::validResourceNamesIsSet() const
 {
-    return m_ValidResourceNamesIsSet;
+    return m_FieldsSet.test(FieldBit_ValidResourceNames);
 }
 
 void AggregateResponse::unsetValidResourceNames()
 {
-    m_ValidResourceNamesIsSet = false;
+    m_FieldsSet.reset(FieldBit_ValidResourceNames);
 }
 
 }
@@ -20,7 +20,6 @@ namespace model {
 
 AggregationItem::AggregationItem()
 {
-    m_GroupsIsSet = false;
 }
 
 AggregationItem::~AggregationItem()
@@ -35,7 +34,7 @@ void AggregationItem::validate()
 web::json::value AggregationItem::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_GroupsIsSet)
+    if(m_FieldsSet.test(FieldBit_Groups))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("groups"))] = ModelBase::toJson(m_Groups);
@@ -44,23 +43,87 @@ web::json::value AggregationItem::toJson() const
     return val;
 }
 
+void AggregationItem::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Groups))
+    {
+        
+        writer.key(_XPLATSTR("groups"));
+        ModelBase::writeJson(writer, m_Groups);
+    }
+
+    writer.endObject();
+}
+
 bool AggregationItem::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("groups"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("groups")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, utility::string_t> refVal_setGroups;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGroups);
-            setGroups(refVal_setGroups);
-            
+        case ModelBase::fieldHash(_XPLATSTR("groups")):
+            if(field.first == _XPLATSTR("groups"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setGroups;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGroups);
+                    setGroups(refVal_setGroups);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void AggregationItem::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Groups))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("groups")), m_Groups);
+    }
+}
+
+bool AggregationItem::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("groups")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setGroups;
+                if(!ModelBase::readBinary(reader, field, refVal_setGroups))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGroups(refVal_setGroups);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void AggregationItem::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void AggregationItem::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_GroupsIsSet)
+    if(m_FieldsSet.test(FieldBit_Groups))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groups")), m_Groups));
     }
@@ -102,17 +165,17 @@ std::map<utility::string_t, utility::string_t> AggregationItem::getGroups() cons
 void AggregationItem::setGroups(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Groups = value;
-    m_GroupsIsSet = true;
+    m_FieldsSet.set(FieldBit_Groups);
 }
 
 bool AggregationItem::groupsIsSet() const
 {
-    return m_GroupsIsSet;
+    return m_FieldsSet.test(FieldBit_Groups);
 }
 
 void AggregationItem::unsetGroups()
 {
-    m_GroupsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Groups);
 }
 
 }
@@ -20,13 +20,7 @@ namespace model {
 
 AggregationOperation::AggregationOperation()
 {
-    m_Field = utility::conversions::to_string_t("");
-    m_FieldIsSet = false;
-    m_OpIsSet = false;
-    m_Alias = utility::conversions::to_string_t("");
-    m_AliasIsSet = false;
     m_ExpandArray = false;
-    m_ExpandArrayIsSet = false;
 }
 
 AggregationOperation::~AggregationOperation()
@@ -41,22 +35,22 @@ void AggregationOperation::validate()
 web::json::value AggregationOperation::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_FieldIsSet)
+    if(m_FieldsSet.test(FieldBit_Field))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("field"))] = ModelBase::toJson(m_Field);
     }
-    if(m_OpIsSet)
+    if(m_FieldsSet.test(FieldBit_Op))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("op"))] = ModelBase::toJson(m_Op);
     }
-    if(m_AliasIsSet)
+    if(m_FieldsSet.test(FieldBit_Alias))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("alias"))] = ModelBase::toJson(m_Alias);
     }
-    if(m_ExpandArrayIsSet)
+    if(m_FieldsSet.test(FieldBit_ExpandArray))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("expandArray"))] = ModelBase::toJson(m_ExpandArray);
@@ -65,54 +59,187 @@ web::json::value AggregationOperation::toJson() const
     return val;
 }
 
+void AggregationOperation::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Field))
+    {
+        
+        writer.key(_XPLATSTR("field"));
+        ModelBase::writeJson(writer, m_Field);
+    }
+    if(m_FieldsSet.test(FieldBit_Op))
+    {
+        
+        writer.key(_XPLATSTR("op"));
+        ModelBase::writeJson(writer, m_Op);
+    }
+    if(m_FieldsSet.test(FieldBit_Alias))
+    {
+        
+        writer.key(_XPLATSTR("alias"));
+        ModelBase::writeJson(writer, m_Alias);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpandArray))
+    {
+        
+        writer.key(_XPLATSTR("expandArray"));
+        ModelBase::writeJson(writer, m_ExpandArray);
+    }
+
+    writer.endObject();
+}
+
 bool AggregationOperation::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("field"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("field")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setField;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setField);
-            setField(refVal_setField);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("op"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("op")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<AggregationOpType> refVal_setOp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOp);
-            setOp(refVal_setOp);
-            
+        case ModelBase::fieldHash(_XPLATSTR("field")):
+            if(field.first == _XPLATSTR("field"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setField;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setField);
+                    setField(refVal_setField);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("op")):
+            if(field.first == _XPLATSTR("op"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AggregationOpType> refVal_setOp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOp);
+                    setOp(refVal_setOp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("alias")):
+            if(field.first == _XPLATSTR("alias"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAlias;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAlias);
+                    setAlias(refVal_setAlias);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expandArray")):
+            if(field.first == _XPLATSTR("expandArray"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setExpandArray;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpandArray);
+                    setExpandArray(refVal_setExpandArray);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("alias"))))
+    return ok;
+}
+
+void AggregationOperation::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("alias")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAlias;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAlias);
-            setAlias(refVal_setAlias);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("field")), m_Field);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expandArray"))))
+    if(m_FieldsSet.test(FieldBit_Op))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expandArray")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("op")), m_Op);
+    }
+    if(m_FieldsSet.test(FieldBit_Alias))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("alias")), m_Alias);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpandArray))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expandArray")), m_ExpandArray);
+    }
+}
+
+bool AggregationOperation::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setExpandArray;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpandArray);
-            setExpandArray(refVal_setExpandArray);
-            
+        case ModelBase::fieldHash(_XPLATSTR("field")):
+            {
+                utility::string_t refVal_setField;
+                if(!ModelBase::readBinary(reader, field, refVal_setField))
+                {
+                    ok = false;
+                    continue;
+                }
+                setField(refVal_setField);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("op")):
+            {
+                std::shared_ptr<AggregationOpType> refVal_setOp;
+                if(!ModelBase::readBinary(reader, field, refVal_setOp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOp(refVal_setOp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("alias")):
+            {
+                utility::string_t refVal_setAlias;
+                if(!ModelBase::readBinary(reader, field, refVal_setAlias))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAlias(refVal_setAlias);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expandArray")):
+            {
+                bool refVal_setExpandArray;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpandArray))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpandArray(refVal_setExpandArray);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregationOperation::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -122,19 +249,19 @@ void AggregationOperation::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_FieldIsSet)
+    if(m_FieldsSet.test(FieldBit_Field))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("field")), m_Field));
     }
-    if(m_OpIsSet)
+    if(m_FieldsSet.test(FieldBit_Op))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("op")), m_Op));
     }
-    if(m_AliasIsSet)
+    if(m_FieldsSet.test(FieldBit_Alias))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("alias")), m_Alias));
     }
-    if(m_ExpandArrayIsSet)
+    if(m_FieldsSet.test(FieldBit_ExpandArray))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expandArray")), m_ExpandArray));
     }
@@ -186,17 +313,17 @@ utility::string_t AggregationOperation::getField() const
 void AggregationOperation::setField(const utility::string_t& value)
 {
     m_Field = value;
-    m_FieldIsSet = true;
+    m_FieldsSet.set(FieldBit_Field);
 }
 
 bool AggregationOperation::fieldIsSet() const
 {
-    return m_FieldIsSet;
+    return m_FieldsSet.test(FieldBit_Field);
 }
 
 void AggregationOperation::unsetField()
 {
-    m_FieldIsSet = false;
+    m_FieldsSet.reset(FieldBit_Field);
 }
 std::shared_ptr<AggregationOpType> AggregationOperation::getOp() const
 {
@@ -207,17 +334,17 @@ std::shared_ptr<AggregationOpType> AggregationOperation::getOp() const
 void AggregationOperation::setOp(const std::shared_ptr<AggregationOpType>& value)
 {
     m_Op = value;
-    m_OpIsSet = true;
+    m_FieldsSet.set(FieldBit_Op);
 }
 
 bool AggregationOperation::opIsSet() const
 {
-    return m_OpIsSet;
+    return m_FieldsSet.test(FieldBit_Op);
 }
 
 void AggregationOperation::unsetOp()
 {
-    m_OpIsSet = false;
+    m_FieldsSet.reset(FieldBit_Op);
 }
 utility::string_t AggregationOperation::getAlias() const
 {
@@ -228,17 +355,17 @@ utility::string_t AggregationOperation::getAlias() const
 void AggregationOperation::setAlias(const utility::string_t& value)
 {
     m_Alias = value;
-    m_AliasIsSet = true;
+    m_FieldsSet.set(FieldBit_Alias);
 }
 
 bool AggregationOperation::aliasIsSet() const
 {
-    return m_AliasIsSet;
+    return m_FieldsSet.test(FieldBit_Alias);
 }
 
 void AggregationOperation::unsetAlias()
 {
-    m_AliasIsSet = false;
+    m_FieldsSet.reset(FieldBit_Alias);
 }
 bool AggregationOperation::isExpandArray() const
 {
@@ -248,17 +375,17 @@ bool AggregationOperation::isExpandArray() const
 void AggregationOperation::setExpandArray(bool value)
 {
     m_ExpandArray = value;
-    m_ExpandArrayIsSet = true;
+    m_FieldsSet.set(FieldBit_ExpandArray);
 }
 
 bool AggregationOperation::expandArrayIsSet() const
 {
-    return m_ExpandArrayIsSet;
+    return m_FieldsSet.test(FieldBit_ExpandArray);
 }
 
 void AggregationOperation::unsetExpandArray()
 {
-    m_ExpandArrayIsSet = false;
+    m_FieldsSet.reset(FieldBit_ExpandArray);
 }
 
 }
@@ -20,12 +20,6 @@ namespace model {
 
 AggregationRequest::AggregationRequest()
 {
-    m_QueryIsSet = false;
-    m_ResourceName = utility::conversions::to_string_t("");
-    m_ResourceNameIsSet = false;
-    m_GroupByIsSet = false;
-    m_OperationsIsSet = false;
-    m_SortIsSet = false;
 }
 
 AggregationRequest::~AggregationRequest()
@@ -40,27 +34,27 @@ void AggregationRequest::validate()
 web::json::value AggregationRequest::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_QueryIsSet)
+    if(m_FieldsSet.test(FieldBit_Query))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("query"))] = ModelBase::toJson(m_Query);
     }
-    if(m_ResourceNameIsSet)
+    if(m_FieldsSet.test(FieldBit_ResourceName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("resourceName"))] = ModelBase::toJson(m_ResourceName);
     }
-    if(m_GroupByIsSet)
+    if(m_FieldsSet.test(FieldBit_GroupBy))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("groupBy"))] = ModelBase::toJson(m_GroupBy);
     }
-    if(m_OperationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Operations))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("operations"))] = ModelBase::toJson(m_Operations);
     }
-    if(m_SortIsSet)
+    if(m_FieldsSet.test(FieldBit_Sort))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sort"))] = ModelBase::toJson(m_Sort);
@@ -69,65 +63,221 @@ web::json::value AggregationRequest::toJson() const
     return val;
 }
 
+void AggregationRequest::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Query))
+    {
+        
+        writer.key(_XPLATSTR("query"));
+        ModelBase::writeJson(writer, m_Query);
+    }
+    if(m_FieldsSet.test(FieldBit_ResourceName))
+    {
+        
+        writer.key(_XPLATSTR("resourceName"));
+        ModelBase::writeJson(writer, m_ResourceName);
+    }
+    if(m_FieldsSet.test(FieldBit_GroupBy))
+    {
+        
+        writer.key(_XPLATSTR("groupBy"));
+        ModelBase::writeJson(writer, m_GroupBy);
+    }
+    if(m_FieldsSet.test(FieldBit_Operations))
+    {
+        
+        writer.key(_XPLATSTR("operations"));
+        ModelBase::writeJson(writer, m_Operations);
+    }
+    if(m_FieldsSet.test(FieldBit_Sort))
+    {
+        
+        writer.key(_XPLATSTR("sort"));
+        ModelBase::writeJson(writer, m_Sort);
+    }
+
+    writer.endObject();
+}
+
 bool AggregationRequest::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("query"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("query")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<QueryPredicate>> refVal_setQuery;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuery);
-            setQuery(refVal_setQuery);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("resourceName"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("resourceName")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setResourceName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setResourceName);
-            setResourceName(refVal_setResourceName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("query")):
+            if(field.first == _XPLATSTR("query"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<QueryPredicate>> refVal_setQuery;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuery);
+                    setQuery(refVal_setQuery);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("resourceName")):
+            if(field.first == _XPLATSTR("resourceName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setResourceName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setResourceName);
+                    setResourceName(refVal_setResourceName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("groupBy")):
+            if(field.first == _XPLATSTR("groupBy"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setGroupBy;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGroupBy);
+                    setGroupBy(refVal_setGroupBy);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("operations")):
+            if(field.first == _XPLATSTR("operations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<AggregationOperation>> refVal_setOperations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOperations);
+                    setOperations(refVal_setOperations);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sort")):
+            if(field.first == _XPLATSTR("sort"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AggregationRequest_sort> refVal_setSort;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSort);
+                    setSort(refVal_setSort);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("groupBy"))))
+    return ok;
+}
+
+void AggregationRequest::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Query))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("groupBy")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setGroupBy;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGroupBy);
-            setGroupBy(refVal_setGroupBy);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("query")), m_Query);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("operations"))))
+    if(m_FieldsSet.test(FieldBit_ResourceName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("operations")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<AggregationOperation>> refVal_setOperations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOperations);
-            setOperations(refVal_setOperations);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("resourceName")), m_ResourceName);
+    }
+    if(m_FieldsSet.test(FieldBit_GroupBy))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("groupBy")), m_GroupBy);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sort"))))
+    if(m_FieldsSet.test(FieldBit_Operations))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sort")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("operations")), m_Operations);
+    }
+    if(m_FieldsSet.test(FieldBit_Sort))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sort")), m_Sort);
+    }
+}
+
+bool AggregationRequest::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<AggregationRequest_sort> refVal_setSort;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSort);
-            setSort(refVal_setSort);
-            
+        case ModelBase::fieldHash(_XPLATSTR("query")):
+            {
+                std::vector<std::shared_ptr<QueryPredicate>> refVal_setQuery;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuery))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuery(refVal_setQuery);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("resourceName")):
+            {
+                utility::string_t refVal_setResourceName;
+                if(!ModelBase::readBinary(reader, field, refVal_setResourceName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setResourceName(refVal_setResourceName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("groupBy")):
+            {
+                std::vector<utility::string_t> refVal_setGroupBy;
+                if(!ModelBase::readBinary(reader, field, refVal_setGroupBy))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGroupBy(refVal_setGroupBy);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("operations")):
+            {
+                std::vector<std::shared_ptr<AggregationOperation>> refVal_setOperations;
+                if(!ModelBase::readBinary(reader, field, refVal_setOperations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOperations(refVal_setOperations);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sort")):
+            {
+                std::shared_ptr<AggregationRequest_sort> refVal_setSort;
+                if(!ModelBase::readBinary(reader, field, refVal_setSort))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSort(refVal_setSort);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregationRequest::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -137,23 +287,23 @@ void AggregationRequest::toMultipart(std::shared_ptr<MultipartFormData> multipar
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_QueryIsSet)
+    if(m_FieldsSet.test(FieldBit_Query))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("query")), m_Query));
     }
-    if(m_ResourceNameIsSet)
+    if(m_FieldsSet.test(FieldBit_ResourceName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("resourceName")), m_ResourceName));
     }
-    if(m_GroupByIsSet)
+    if(m_FieldsSet.test(FieldBit_GroupBy))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groupBy")), m_GroupBy));
     }
-    if(m_OperationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Operations))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("operations")), m_Operations));
     }
-    if(m_SortIsSet)
+    if(m_FieldsSet.test(FieldBit_Sort))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sort")), m_Sort));
     }
@@ -211,17 +361,17 @@ std::vector<std::shared_ptr<QueryPredicate>> AggregationRequest::getQuery() cons
 void AggregationRequest::setQuery(const std::vector<std::shared_ptr<QueryPredicate>>& value)
 {
     m_Query = value;
-    m_QueryIsSet = true;
+    m_FieldsSet.set(FieldBit_Query);
 }
 
 bool AggregationRequest::queryIsSet() const
 {
-    return m_QueryIsSet;
+    return m_FieldsSet.test(FieldBit_Query);
 }
 
 void AggregationRequest::unsetQuery()
 {
-    m_QueryIsSet = false;
+    m_FieldsSet.reset(FieldBit_Query);
 }
 utility::string_t AggregationRequest::getResourceName() const
 {
@@ -232,17 +382,17 @@ utility::string_t AggregationRequest::getResourceName() const
 void AggregationRequest::setResourceName(const utility::string_t& value)
 {
     m_ResourceName = value;
-    m_ResourceNameIsSet = true;
+    m_FieldsSet.set(FieldBit_ResourceName);
 }
 
 bool AggregationRequest::resourceNameIsSet() const
 {
-    return m_ResourceNameIsSet;
+    return m_FieldsSet.test(FieldBit_ResourceName);
 }
 
 void AggregationRequest::unsetResourceName()
 {
-    m_ResourceNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_ResourceName);
 }
 std::vector<utility::string_t> AggregationRequest::getGroupBy() const
 {
@@ -253,17 +403,17 @@ std::vector<utility::string_t> AggregationRequest::getGroupBy() const
 void AggregationRequest::setGroupBy(const std::vector<utility::string_t>& value)
 {
     m_GroupBy = value;
-    m_GroupByIsSet = true;
+    m_FieldsSet.set(FieldBit_GroupBy);
 }
 
 bool AggregationRequest::groupByIsSet() const
 {
-    return m_GroupByIsSet;
+    return m_FieldsSet.test(FieldBit_GroupBy);
 }
 
 void AggregationRequest::unsetGroupBy()
 {
-    m_GroupByIsSet = false;
+    m_FieldsSet.reset(FieldBit_GroupBy);
 }
 std::vector<std::shared_ptr<AggregationOperation>> AggregationRequest::getOperations() const
 {
@@ -274,17 +424,17 @@ std::vector<std::shared_ptr<AggregationOperation>> AggregationRequest::getOperat
 void AggregationRequest::setOperations(const std::vector<std::shared_ptr<AggregationOperation>>& value)
 {
     m_Operations = value;
-    m_OperationsIsSet = true;
+    m_FieldsSet.set(FieldBit_Operations);
 }
 
 bool AggregationRequest::operationsIsSet() const
 {
-    return m_OperationsIsSet;
+    return m_FieldsSet.test(FieldBit_Operations);
 }
 
 void AggregationRequest::unsetOperations()
 {
-    m_OperationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Operations);
 }
 std::shared_ptr<AggregationRequest_sort> AggregationRequest::getSort() const
 {
@@ -295,17 +445,17 @@ std::shared_ptr<AggregationRequest_sort> AggregationRequest::getSort() const
 void AggregationRequest::setSort(const std::shared_ptr<AggregationRequest_sort>& value)
 {
     m_Sort = value;
-    m_SortIsSet = true;
+    m_FieldsSet.set(FieldBit_Sort);
 }
 
 bool AggregationRequest::sortIsSet() const
 {
-    return m_SortIsSet;
+    return m_FieldsSet.test(FieldBit_Sort);
 }
 
 void AggregationRequest::unsetSort()
 {
-    m_SortIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sort);
 }
 
 }
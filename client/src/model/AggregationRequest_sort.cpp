@@ -20,9 +20,6 @@ namespace model {
 
 AggregationRequest_sort::AggregationRequest_sort()
 {
-    m_DirIsSet = false;
-    m_Field = utility::conversions::to_string_t("");
-    m_FieldIsSet = false;
 }
 
 AggregationRequest_sort::~AggregationRequest_sort()
@@ -37,14 +34,14 @@ void AggregationRequest_sort::validate()
 web::json::value AggregationRequest_sort::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_DirIsSet)
+    if(m_FieldsSet.test(FieldBit_Dir))
     {
         
         utility::string_t refVal = fromDirEnum(m_Dir);
         val[utility::conversions::to_string_t(_XPLATSTR("dir"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_FieldIsSet)
+    if(m_FieldsSet.test(FieldBit_Field))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("field"))] = ModelBase::toJson(m_Field);
@@ -53,33 +50,123 @@ web::json::value AggregationRequest_sort::toJson() const
     return val;
 }
 
+void AggregationRequest_sort::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Dir))
+    {
+        
+        utility::string_t refVal = fromDirEnum(m_Dir);
+        writer.key(_XPLATSTR("dir"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Field))
+    {
+        
+        writer.key(_XPLATSTR("field"));
+        ModelBase::writeJson(writer, m_Field);
+    }
+
+    writer.endObject();
+}
+
 bool AggregationRequest_sort::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("dir"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("dir")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setDir;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDir);
-            
-            setDir(toDirEnum(refVal_setDir));
-            
+        case ModelBase::fieldHash(_XPLATSTR("dir")):
+            if(field.first == _XPLATSTR("dir"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDir;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDir);
+                    setDir(toDirEnum(refVal_setDir));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("field")):
+            if(field.first == _XPLATSTR("field"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setField;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setField);
+                    setField(refVal_setField);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("field"))))
+    return ok;
+}
+
+void AggregationRequest_sort::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Dir))
+    {
+        
+        utility::string_t refVal = fromDirEnum(m_Dir);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("dir")), refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("field")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("field")), m_Field);
+    }
+}
+
+bool AggregationRequest_sort::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setField;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setField);
-            setField(refVal_setField);
-            
+        case ModelBase::fieldHash(_XPLATSTR("dir")):
+            {
+                utility::string_t refVal_setDir;
+                if(!ModelBase::readBinary(reader, field, refVal_setDir))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDir(toDirEnum(refVal_setDir));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("field")):
+            {
+                utility::string_t refVal_setField;
+                if(!ModelBase::readBinary(reader, field, refVal_setField))
+                {
+                    ok = false;
+                    continue;
+                }
+                setField(refVal_setField);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregationRequest_sort::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -89,11 +176,11 @@ void AggregationRequest_sort::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_DirIsSet)
+    if(m_FieldsSet.test(FieldBit_Dir))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("dir")), fromDirEnum(m_Dir)));
     }
-    if(m_FieldIsSet)
+    if(m_FieldsSet.test(FieldBit_Field))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("field")), m_Field));
     }
@@ -160,17 +247,17 @@ AggregationRequest_sort::DirEnum AggregationRequest_sort::getDir() const
 void AggregationRequest_sort::setDir(const DirEnum value)
 {
     m_Dir = value;
-    m_DirIsSet = true;
+    m_FieldsSet.set(FieldBit_Dir);
 }
 
 bool AggregationRequest_sort::dirIsSet() const
 {
-    return m_DirIsSet;
+    return m_FieldsSet.test(FieldBit_Dir);
 }
 
 void AggregationRequest_sort::unsetDir()
 {
-    m_DirIsSet = false;
+    m_FieldsSet.reset(FieldBit_Dir);
 }
 utility::string_t AggregationRequest_sort::getField() const
 {
@@ -181,17 +268,17 @@ utility::string_t AggregationRequest_sort::getField() const
 void AggregationRequest_sort::setField(const utility::string_t& value)
 {
     m_Field = value;
-    m_FieldIsSet = true;
+    m_FieldsSet.set(FieldBit_Field);
 }
 
 bool AggregationRequest_sort::fieldIsSet() const
 {
-    return m_FieldIsSet;
+    return m_FieldsSet.test(FieldBit_Field);
 }
 
 void AggregationRequest_sort::unsetField()
 {
-    m_FieldIsSet = false;
+    m_FieldsSet.reset(FieldBit_Field);
 }
 
 }
@@ -20,9 +20,6 @@ namespace model {
 
 AggregationResponse::AggregationResponse()
 {
-    m_StatusIsSet = false;
-    m_DataIsSet = false;
-    m_StatsIsSet = false;
 }
 
 AggregationResponse::~AggregationResponse()
@@ -37,17 +34,17 @@ void AggregationResponse::validate()
 web::json::value AggregationResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_DataIsSet)
+    if(m_FieldsSet.test(FieldBit_Data))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("data"))] = ModelBase::toJson(m_Data);
     }
-    if(m_StatsIsSet)
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("stats"))] = ModelBase::toJson(m_Stats);
@@ -56,43 +53,153 @@ web::json::value AggregationResponse::toJson() const
     return val;
 }
 
+void AggregationResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Data))
+    {
+        
+        writer.key(_XPLATSTR("data"));
+        ModelBase::writeJson(writer, m_Data);
+    }
+    if(m_FieldsSet.test(FieldBit_Stats))
+    {
+        
+        writer.key(_XPLATSTR("stats"));
+        ModelBase::writeJson(writer, m_Stats);
+    }
+
+    writer.endObject();
+}
+
 bool AggregationResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("data"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("data")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<AggregationItem>> refVal_setData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setData);
-            setData(refVal_setData);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("data")):
+            if(field.first == _XPLATSTR("data"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<AggregationItem>> refVal_setData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setData);
+                    setData(refVal_setData);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("stats")):
+            if(field.first == _XPLATSTR("stats"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AggregationResponse_stats> refVal_setStats;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStats);
+                    setStats(refVal_setStats);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("stats"))))
+    return ok;
+}
+
+void AggregationResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Data))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("data")), m_Data);
+    }
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("stats")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("stats")), m_Stats);
+    }
+}
+
+bool AggregationResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<AggregationResponse_stats> refVal_setStats;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStats);
-            setStats(refVal_setStats);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("data")):
+            {
+                std::vector<std::shared_ptr<AggregationItem>> refVal_setData;
+                if(!ModelBase::readBinary(reader, field, refVal_setData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setData(refVal_setData);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("stats")):
+            {
+                std::shared_ptr<AggregationResponse_stats> refVal_setStats;
+                if(!ModelBase::readBinary(reader, field, refVal_setStats))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStats(refVal_setStats);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregationResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -102,15 +209,15 @@ void AggregationResponse::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_DataIsSet)
+    if(m_FieldsSet.test(FieldBit_Data))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("data")), m_Data));
     }
-    if(m_StatsIsSet)
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("stats")), m_Stats));
     }
@@ -156,17 +263,17 @@ std::shared_ptr<APIStatus> AggregationResponse::getStatus() const
 void AggregationResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AggregationResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AggregationResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<AggregationItem>> AggregationResponse::getData() const
 {
@@ -177,17 +284,17 @@ std::vector<std::shared_ptr<AggregationItem>> AggregationResponse::getData() con
 void AggregationResponse::setData(const std::vector<std::shared_ptr<AggregationItem>>& value)
 {
     m_Data = value;
-    m_DataIsSet = true;
+    m_FieldsSet.set(FieldBit_Data);
 }
 
 bool AggregationResponse::dataIsSet() const
 {
-    return m_DataIsSet;
+    return m_FieldsSet.test(FieldBit_Data);
 }
 
 void AggregationResponse::unsetData()
 {
-    m_DataIsSet = false;
+    m_FieldsSet.reset(FieldBit_Data);
 }
 std::shared_ptr<AggregationResponse_stats> AggregationResponse::getStats() const
 {
@@ -198,17 +305,17 @@ std::shared_ptr<AggregationResponse_stats> AggregationResponse::getStats() const
 void AggregationResponse::setStats(const std::shared_ptr<AggregationResponse_stats>& value)
 {
     m_Stats = value;
-    m_StatsIsSet = true;
+    m_FieldsSet.set(FieldBit_Stats);
 }
 
 bool AggregationResponse::statsIsSet() const
 {
-    return m_StatsIsSet;
+    return m_FieldsSet.test(FieldBit_Stats);
 }
 
 void AggregationResponse::unsetStats()
 {
-    m_StatsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Stats);
 }
 
 }
@@ -21,9 +21,7 @@ namespace model {
 AggregationResponse_stats::AggregationResponse_stats()
 {
     m_TimeMS = 0L;
-    m_TimeMSIsSet = false;
     m_Scanned = 0L;
-    m_ScannedIsSet = false;
 }
 
 AggregationResponse_stats::~AggregationResponse_stats()
@@ -38,12 +36,12 @@ void AggregationResponse_stats::validate()
 web::json::value AggregationResponse_stats::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TimeMSIsSet)
+    if(m_FieldsSet.test(FieldBit_TimeMS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("timeMS"))] = ModelBase::toJson(m_TimeMS);
     }
-    if(m_ScannedIsSet)
+    if(m_FieldsSet.test(FieldBit_Scanned))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("scanned"))] = ModelBase::toJson(m_Scanned);
@@ -52,32 +50,119 @@ web::json::value AggregationResponse_stats::toJson() const
     return val;
 }
 
+void AggregationResponse_stats::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_TimeMS))
+    {
+        
+        writer.key(_XPLATSTR("timeMS"));
+        ModelBase::writeJson(writer, m_TimeMS);
+    }
+    if(m_FieldsSet.test(FieldBit_Scanned))
+    {
+        
+        writer.key(_XPLATSTR("scanned"));
+        ModelBase::writeJson(writer, m_Scanned);
+    }
+
+    writer.endObject();
+}
+
 bool AggregationResponse_stats::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("timeMS"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("timeMS")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int64_t refVal_setTimeMS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTimeMS);
-            setTimeMS(refVal_setTimeMS);
-            
+        case ModelBase::fieldHash(_XPLATSTR("timeMS")):
+            if(field.first == _XPLATSTR("timeMS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setTimeMS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTimeMS);
+                    setTimeMS(refVal_setTimeMS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("scanned")):
+            if(field.first == _XPLATSTR("scanned"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setScanned;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setScanned);
+                    setScanned(refVal_setScanned);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("scanned"))))
+    return ok;
+}
+
+void AggregationResponse_stats::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_TimeMS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("scanned")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("timeMS")), m_TimeMS);
+    }
+    if(m_FieldsSet.test(FieldBit_Scanned))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("scanned")), m_Scanned);
+    }
+}
+
+bool AggregationResponse_stats::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int64_t refVal_setScanned;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setScanned);
-            setScanned(refVal_setScanned);
-            
+        case ModelBase::fieldHash(_XPLATSTR("timeMS")):
+            {
+                int64_t refVal_setTimeMS;
+                if(!ModelBase::readBinary(reader, field, refVal_setTimeMS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTimeMS(refVal_setTimeMS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("scanned")):
+            {
+                int64_t refVal_setScanned;
+                if(!ModelBase::readBinary(reader, field, refVal_setScanned))
+                {
+                    ok = false;
+                    continue;
+                }
+                setScanned(refVal_setScanned);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregationResponse_stats::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -87,11 +172,11 @@ void AggregationResponse_stats::toMultipart(std::shared_ptr<MultipartFormData> m
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TimeMSIsSet)
+    if(m_FieldsSet.test(FieldBit_TimeMS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("timeMS")), m_TimeMS));
     }
-    if(m_ScannedIsSet)
+    if(m_FieldsSet.test(FieldBit_Scanned))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("scanned")), m_Scanned));
     }
@@ -130,17 +215,17 @@ int64_t AggregationResponse_stats::getTimeMS() const
 void AggregationResponse_stats::setTimeMS(int64_t value)
 {
     m_TimeMS = value;
-    m_TimeMSIsSet = true;
+    m_FieldsSet.set(FieldBit_TimeMS);
 }
 
 bool AggregationResponse_stats::timeMSIsSet() const
 {
-    return m_TimeMSIsSet;
+    return m_FieldsSet.test(FieldBit_TimeMS);
 }
 
 void AggregationResponse_stats::unsetTimeMS()
 {
-    m_TimeMSIsSet = false;
+    m_FieldsSet.reset(FieldBit_TimeMS);
 }
 int64_t AggregationResponse_stats::getScanned() const
 {
@@ -150,17 +235,17 @@ int64_t AggregationResponse_stats::getScanned() const
 void AggregationResponse_stats::setScanned(int64_t value)
 {
     m_Scanned = value;
-    m_ScannedIsSet = true;
+    m_FieldsSet.set(FieldBit_Scanned);
 }
 
 bool AggregationResponse_stats::scannedIsSet() const
 {
-    return m_ScannedIsSet;
+    return m_FieldsSet.test(FieldBit_Scanned);
 }
 
 void AggregationResponse_stats::unsetScanned()
 {
-    m_ScannedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Scanned);
 }
 
 }
@@ -20,14 +20,8 @@ namespace model {
 
 AggregationValue::AggregationValue()
 {
-    m_GroupsIsSet = false;
-    m_StringValue = utility::conversions::to_string_t("");
-    m_StringValueIsSet = false;
     m_NumericValue = 0.0;
-    m_NumericValueIsSet = false;
     m_DistinctCount = 0L;
-    m_DistinctCountIsSet = false;
-    m_DistinctCountsIsSet = false;
 }
 
 AggregationValue::~AggregationValue()
@@ -42,27 +36,27 @@ void AggregationValue::validate()
 web::json::value AggregationValue::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_GroupsIsSet)
+    if(m_FieldsSet.test(FieldBit_Groups))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("groups"))] = ModelBase::toJson(m_Groups);
     }
-    if(m_StringValueIsSet)
+    if(m_FieldsSet.test(FieldBit_StringValue))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("stringValue"))] = ModelBase::toJson(m_StringValue);
     }
-    if(m_NumericValueIsSet)
+    if(m_FieldsSet.test(FieldBit_NumericValue))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("numericValue"))] = ModelBase::toJson(m_NumericValue);
     }
-    if(m_DistinctCountIsSet)
+    if(m_FieldsSet.test(FieldBit_DistinctCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("distinctCount"))] = ModelBase::toJson(m_DistinctCount);
     }
-    if(m_DistinctCountsIsSet)
+    if(m_FieldsSet.test(FieldBit_DistinctCounts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("distinctCounts"))] = ModelBase::toJson(m_DistinctCounts);
@@ -71,65 +65,221 @@ web::json::value AggregationValue::toJson() const
     return val;
 }
 
+void AggregationValue::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Groups))
+    {
+        
+        writer.key(_XPLATSTR("groups"));
+        ModelBase::writeJson(writer, m_Groups);
+    }
+    if(m_FieldsSet.test(FieldBit_StringValue))
+    {
+        
+        writer.key(_XPLATSTR("stringValue"));
+        ModelBase::writeJson(writer, m_StringValue);
+    }
+    if(m_FieldsSet.test(FieldBit_NumericValue))
+    {
+        
+        writer.key(_XPLATSTR("numericValue"));
+        ModelBase::writeJson(writer, m_NumericValue);
+    }
+    if(m_FieldsSet.test(FieldBit_DistinctCount))
+    {
+        
+        writer.key(_XPLATSTR("distinctCount"));
+        ModelBase::writeJson(writer, m_DistinctCount);
+    }
+    if(m_FieldsSet.test(FieldBit_DistinctCounts))
+    {
+        
+        writer.key(_XPLATSTR("distinctCounts"));
+        ModelBase::writeJson(writer, m_DistinctCounts);
+    }
+
+    writer.endObject();
+}
+
 bool AggregationValue::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("groups"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("groups")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setGroups;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGroups);
-            setGroups(refVal_setGroups);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("stringValue"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("stringValue")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setStringValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStringValue);
-            setStringValue(refVal_setStringValue);
-            
+        case ModelBase::fieldHash(_XPLATSTR("groups")):
+            if(field.first == _XPLATSTR("groups"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setGroups;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGroups);
+                    setGroups(refVal_setGroups);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("stringValue")):
+            if(field.first == _XPLATSTR("stringValue"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStringValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStringValue);
+                    setStringValue(refVal_setStringValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("numericValue")):
+            if(field.first == _XPLATSTR("numericValue"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNumericValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNumericValue);
+                    setNumericValue(refVal_setNumericValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("distinctCount")):
+            if(field.first == _XPLATSTR("distinctCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setDistinctCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDistinctCount);
+                    setDistinctCount(refVal_setDistinctCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("distinctCounts")):
+            if(field.first == _XPLATSTR("distinctCounts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, double> refVal_setDistinctCounts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDistinctCounts);
+                    setDistinctCounts(refVal_setDistinctCounts);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("numericValue"))))
+    return ok;
+}
+
+void AggregationValue::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Groups))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("numericValue")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setNumericValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNumericValue);
-            setNumericValue(refVal_setNumericValue);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("groups")), m_Groups);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("distinctCount"))))
+    if(m_FieldsSet.test(FieldBit_StringValue))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("distinctCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setDistinctCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDistinctCount);
-            setDistinctCount(refVal_setDistinctCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("stringValue")), m_StringValue);
+    }
+    if(m_FieldsSet.test(FieldBit_NumericValue))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("numericValue")), m_NumericValue);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("distinctCounts"))))
+    if(m_FieldsSet.test(FieldBit_DistinctCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("distinctCounts")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("distinctCount")), m_DistinctCount);
+    }
+    if(m_FieldsSet.test(FieldBit_DistinctCounts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("distinctCounts")), m_DistinctCounts);
+    }
+}
+
+bool AggregationValue::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, double> refVal_setDistinctCounts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDistinctCounts);
-            setDistinctCounts(refVal_setDistinctCounts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("groups")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setGroups;
+                if(!ModelBase::readBinary(reader, field, refVal_setGroups))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGroups(refVal_setGroups);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("stringValue")):
+            {
+                utility::string_t refVal_setStringValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setStringValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStringValue(refVal_setStringValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("numericValue")):
+            {
+                double refVal_setNumericValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setNumericValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNumericValue(refVal_setNumericValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("distinctCount")):
+            {
+                int64_t refVal_setDistinctCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setDistinctCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDistinctCount(refVal_setDistinctCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("distinctCounts")):
+            {
+                std::map<utility::string_t, double> refVal_setDistinctCounts;
+                if(!ModelBase::readBinary(reader, field, refVal_setDistinctCounts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDistinctCounts(refVal_setDistinctCounts);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AggregationValue::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -139,23 +289,23 @@ void AggregationValue::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_GroupsIsSet)
+    if(m_FieldsSet.test(FieldBit_Groups))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groups")), m_Groups));
     }
-    if(m_StringValueIsSet)
+    if(m_FieldsSet.test(FieldBit_StringValue))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("stringValue")), m_StringValue));
     }
-    if(m_NumericValueIsSet)
+    if(m_FieldsSet.test(FieldBit_NumericValue))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("numericValue")), m_NumericValue));
     }
-    if(m_DistinctCountIsSet)
+    if(m_FieldsSet.test(FieldBit_DistinctCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("distinctCount")), m_DistinctCount));
     }
-    if(m_DistinctCountsIsSet)
+    if(m_FieldsSet.test(FieldBit_DistinctCounts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("distinctCounts")), m_DistinctCounts));
     }
@@ -213,17 +363,17 @@ std::map<utility::string_t, utility::string_t> AggregationValue::getGroups() con
 void AggregationValue::setGroups(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Groups = value;
-    m_GroupsIsSet = true;
+    m_FieldsSet.set(FieldBit_Groups);
 }
 
 bool AggregationValue::groupsIsSet() const
 {
-    return m_GroupsIsSet;
+    return m_FieldsSet.test(FieldBit_Groups);
 }
 
 void AggregationValue::unsetGroups()
 {
-    m_GroupsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Groups);
 }
 utility::string_t AggregationValue::getStringValue() const
 {
@@ -234,17 +384,17 @@ utility::string_t AggregationValue::getStringValue() const
 void AggregationValue::setStringValue(const utility::string_t& value)
 {
     m_StringValue = value;
-    m_StringValueIsSet = true;
+    m_FieldsSet.set(FieldBit_StringValue);
 }
 
 bool AggregationValue::stringValueIsSet() const
 {
-    return m_StringValueIsSet;
+    return m_FieldsSet.test(FieldBit_StringValue);
 }
 
 void AggregationValue::unsetStringValue()
 {
-    m_StringValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_StringValue);
 }
 double AggregationValue::getNumericValue() const
 {
@@ -254,17 +404,17 @@ double AggregationValue::getNumericValue() const
 void AggregationValue::setNumericValue(double value)
 {
     m_NumericValue = value;
-    m_NumericValueIsSet = true;
+    m_FieldsSet.set(FieldBit_NumericValue);
 }
 
 bool AggregationValue::numericValueIsSet() const
 {
-    return m_NumericValueIsSet;
+    return m_FieldsSet.test(FieldBit_NumericValue);
 }
 
 void AggregationValue::unsetNumericValue()
 {
-    m_NumericValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_NumericValue);
 }
 int64_t AggregationValue::getDistinctCount() const
 {
@@ -274,17 +424,17 @@ int64_t AggregationValue::getDistinctCount() const
 void AggregationValue::setDistinctCount(int64_t value)
 {
     m_DistinctCount = value;
-    m_DistinctCountIsSet = true;
+    m_FieldsSet.set(FieldBit_DistinctCount);
 }
 
 bool AggregationValue::distinctCountIsSet() const
 {
-    return m_DistinctCountIsSet;
+    return m_FieldsSet.test(FieldBit_DistinctCount);
 }
 
 void AggregationValue::unsetDistinctCount()
 {
-    m_DistinctCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_DistinctCount);
 }
 std::map<utility::string_t, double> AggregationValue::getDistinctCounts() const
 {
@@ -294,17 +444,17 @@ std::map<utility::string_t, double> AggregationValue::getDistinctCounts() const
 void AggregationValue::setDistinctCounts(std::map<utility::string_t, double> value)
 {
     m_DistinctCounts = value;
-    m_DistinctCountsIsSet = true;
+    m_FieldsSet.set(FieldBit_DistinctCounts);
 }
 
 bool AggregationValue::distinctCountsIsSet() const
 {
-    return m_DistinctCountsIsSet;
+    return m_FieldsSet.test(FieldBit_DistinctCounts);
 }
 
 void AggregationValue::unsetDistinctCounts()
 {
-    m_DistinctCountsIsSet = false;
+    m_FieldsSet.reset(FieldBit_DistinctCounts);
 }
 
 }
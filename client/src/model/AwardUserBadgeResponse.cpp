@@ -20,9 +20,6 @@ namespace model {
 
 AwardUserBadgeResponse::AwardUserBadgeResponse()
 {
-    m_NotesIsSet = false;
-    m_BadgesIsSet = false;
-    m_StatusIsSet = false;
 }
 
 AwardUserBadgeResponse::~AwardUserBadgeResponse()
@@ -37,17 +34,17 @@ void AwardUserBadgeResponse::validate()
 web::json::value AwardUserBadgeResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NotesIsSet)
+    if(m_FieldsSet.test(FieldBit_Notes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notes"))] = ModelBase::toJson(m_Notes);
     }
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -56,43 +53,153 @@ web::json::value AwardUserBadgeResponse::toJson() const
     return val;
 }
 
+void AwardUserBadgeResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Notes))
+    {
+        
+        writer.key(_XPLATSTR("notes"));
+        ModelBase::writeJson(writer, m_Notes);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool AwardUserBadgeResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notes"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notes")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setNotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotes);
-            setNotes(refVal_setNotes);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
+        case ModelBase::fieldHash(_XPLATSTR("notes")):
+            if(field.first == _XPLATSTR("notes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setNotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotes);
+                    setNotes(refVal_setNotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void AwardUserBadgeResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Notes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notes")), m_Notes);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool AwardUserBadgeResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("notes")):
+            {
+                std::vector<utility::string_t> refVal_setNotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotes(refVal_setNotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void AwardUserBadgeResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -102,15 +209,15 @@ void AwardUserBadgeResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NotesIsSet)
+    if(m_FieldsSet.test(FieldBit_Notes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notes")), m_Notes));
     }
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -156,17 +263,17 @@ std::vector<utility::string_t> AwardUserBadgeResponse::getNotes() const
 void AwardUserBadgeResponse::setNotes(const std::vector<utility::string_t>& value)
 {
     m_Notes = value;
-    m_NotesIsSet = true;
+    m_FieldsSet.set(FieldBit_Notes);
 }
 
 bool AwardUserBadgeResponse::notesIsSet() const
 {
-    return m_NotesIsSet;
+    return m_FieldsSet.test(FieldBit_Notes);
 }
 
 void AwardUserBadgeResponse::unsetNotes()
 {
-    m_NotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Notes);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> AwardUserBadgeResponse::getBadges() const
 {
@@ -177,17 +284,17 @@ std::vector<std::shared_ptr<CommentUserBadgeInfo>> AwardUserBadgeResponse::getBa
 void AwardUserBadgeResponse::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
-    m_BadgesIsSet = true;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool AwardUserBadgeResponse::badgesIsSet() const
 {
-    return m_BadgesIsSet;
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void AwardUserBadgeResponse::unsetBadges()
 {
-    m_BadgesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 std::shared_ptr<APIStatus> AwardUserBadgeResponse::getStatus() const
 {
@@ -198,17 +305,17 @@ std::shared_ptr<APIStatus> AwardUserBadgeResponse::getStatus() const
 void AwardUserBadgeResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool AwardUserBadgeResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void AwardUserBadgeResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
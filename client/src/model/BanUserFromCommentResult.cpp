@@ -20,13 +20,6 @@ namespace model {
 
 BanUserFromCommentResult::BanUserFromCommentResult()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
-    m_ChangelogIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
 }
 
 BanUserFromCommentResult::~BanUserFromCommentResult()
@@ -41,22 +34,22 @@ void BanUserFromCommentResult::validate()
 web::json::value BanUserFromCommentResult::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ChangelogIsSet)
+    if(m_FieldsSet.test(FieldBit_Changelog))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("changelog"))] = ModelBase::toJson(m_Changelog);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
@@ -65,54 +58,187 @@ web::json::value BanUserFromCommentResult::toJson() const
     return val;
 }
 
+void BanUserFromCommentResult::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Changelog))
+    {
+        
+        writer.key(_XPLATSTR("changelog"));
+        ModelBase::writeJson(writer, m_Changelog);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+
+    writer.endObject();
+}
+
 bool BanUserFromCommentResult::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("changelog"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("changelog")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIBanUserChangeLog> refVal_setChangelog;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setChangelog);
-            setChangelog(refVal_setChangelog);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("changelog")):
+            if(field.first == _XPLATSTR("changelog"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIBanUserChangeLog> refVal_setChangelog;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setChangelog);
+                    setChangelog(refVal_setChangelog);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    return ok;
+}
+
+void BanUserFromCommentResult::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(m_FieldsSet.test(FieldBit_Changelog))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("changelog")), m_Changelog);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
+    }
+}
+
+bool BanUserFromCommentResult::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("changelog")):
+            {
+                std::shared_ptr<APIBanUserChangeLog> refVal_setChangelog;
+                if(!ModelBase::readBinary(reader, field, refVal_setChangelog))
+                {
+                    ok = false;
+                    continue;
+                }
+                setChangelog(refVal_setChangelog);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BanUserFromCommentResult::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -122,19 +248,19 @@ void BanUserFromCommentResult::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ChangelogIsSet)
+    if(m_FieldsSet.test(FieldBit_Changelog))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("changelog")), m_Changelog));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
@@ -186,17 +312,17 @@ utility::string_t BanUserFromCommentResult::getStatus() const
 void BanUserFromCommentResult::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool BanUserFromCommentResult::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void BanUserFromCommentResult::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APIBanUserChangeLog> BanUserFromCommentResult::getChangelog() const
 {
@@ -207,17 +333,17 @@ std::shared_ptr<APIBanUserChangeLog> BanUserFromCommentResult::getChangelog() co
 void BanUserFromCommentResult::setChangelog(const std::shared_ptr<APIBanUserChangeLog>& value)
 {
     m_Changelog = value;
-    m_ChangelogIsSet = true;
+    m_FieldsSet.set(FieldBit_Changelog);
 }
 
 bool BanUserFromCommentResult::changelogIsSet() const
 {
-    return m_ChangelogIsSet;
+    return m_FieldsSet.test(FieldBit_Changelog);
 }
 
 void BanUserFromCommentResult::unsetChangelog()
 {
-    m_ChangelogIsSet = false;
+    m_FieldsSet.reset(FieldBit_Changelog);
 }
 utility::string_t BanUserFromCommentResult::getCode() const
 {
@@ -228,17 +354,17 @@ utility::string_t BanUserFromCommentResult::getCode() const
 void BanUserFromCommentResult::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool BanUserFromCommentResult::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void BanUserFromCommentResult::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 utility::string_t BanUserFromCommentResult::getReason() const
 {
@@ -249,17 +375,17 @@ utility::string_t BanUserFromCommentResult::getReason() const
 void BanUserFromCommentResult::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool BanUserFromCommentResult::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void BanUserFromCommentResult::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 
 }
@@ -20,7 +20,6 @@ namespace model {
 
 BanUserUndoParams::BanUserUndoParams()
 {
-    m_ChangelogIsSet = false;
 }
 
 BanUserUndoParams::~BanUserUndoParams()
@@ -35,7 +34,7 @@ void BanUserUndoParams::validate()
 web::json::value BanUserUndoParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ChangelogIsSet)
+    if(m_FieldsSet.test(FieldBit_Changelog))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("changelog"))] = ModelBase::toJson(m_Changelog);
@@ -44,23 +43,87 @@ web::json::value BanUserUndoParams::toJson() const
     return val;
 }
 
+void BanUserUndoParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Changelog))
+    {
+        
+        writer.key(_XPLATSTR("changelog"));
+        ModelBase::writeJson(writer, m_Changelog);
+    }
+
+    writer.endObject();
+}
+
 bool BanUserUndoParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("changelog"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("changelog")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIBanUserChangeLog> refVal_setChangelog;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setChangelog);
-            setChangelog(refVal_setChangelog);
-            
+        case ModelBase::fieldHash(_XPLATSTR("changelog")):
+            if(field.first == _XPLATSTR("changelog"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIBanUserChangeLog> refVal_setChangelog;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setChangelog);
+                    setChangelog(refVal_setChangelog);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void BanUserUndoParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Changelog))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("changelog")), m_Changelog);
+    }
+}
+
+bool BanUserUndoParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("changelog")):
+            {
+                std::shared_ptr<APIBanUserChangeLog> refVal_setChangelog;
+                if(!ModelBase::readBinary(reader, field, refVal_setChangelog))
+                {
+                    ok = false;
+                    continue;
+                }
+                setChangelog(refVal_setChangelog);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void BanUserUndoParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void BanUserUndoParams::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ChangelogIsSet)
+    if(m_FieldsSet.test(FieldBit_Changelog))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("changelog")), m_Changelog));
     }
@@ -102,17 +165,17 @@ std::shared_ptr<APIBanUserChangeLog> BanUserUndoParams::getChangelog() const
 void BanUserUndoParams::setChangelog(const std::shared_ptr<APIBanUserChangeLog>& value)
 {
     m_Changelog = value;
-    m_ChangelogIsSet = true;
+    m_FieldsSet.set(FieldBit_Changelog);
 }
 
 bool BanUserUndoParams::changelogIsSet() const
 {
-    return m_ChangelogIsSet;
+    return m_FieldsSet.test(FieldBit_Changelog);
 }
 
 void BanUserUndoParams::unsetChangelog()
 {
-    m_ChangelogIsSet = false;
+    m_FieldsSet.reset(FieldBit_Changelog);
 }
 
 }
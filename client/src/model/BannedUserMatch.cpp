@@ -20,7 +20,6 @@ namespace model {
 
 BannedUserMatch::BannedUserMatch()
 {
-    m_MatchedOnIsSet = false;
 }
 
 BannedUserMatch::~BannedUserMatch()
@@ -35,46 +34,133 @@ void BannedUserMatch::validate()
 web::json::value BannedUserMatch::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_MatchedOnIsSet)
+    if(m_FieldsSet.test(FieldBit_MatchedOn))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("matchedOn"))] = ModelBase::toJson(m_MatchedOn);
     }
-    if(m_MatchedOnValue.has_value())
+    if(m_FieldsSet.test(FieldBit_MatchedOnValue))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("matchedOnValue"))] = ModelBase::toJson(m_MatchedOnValue.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("matchedOnValue"))] = ModelBase::toJson(m_MatchedOnValue);
     }
 
     return val;
 }
 
+void BannedUserMatch::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_MatchedOn))
+    {
+        
+        writer.key(_XPLATSTR("matchedOn"));
+        ModelBase::writeJson(writer, m_MatchedOn);
+    }
+    if(m_FieldsSet.test(FieldBit_MatchedOnValue))
+    {
+        
+        writer.key(_XPLATSTR("matchedOnValue"));
+        ModelBase::writeJson(writer, m_MatchedOnValue);
+    }
+
+    writer.endObject();
+}
+
 bool BannedUserMatch::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("matchedOn"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("matchedOn")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<BannedUserMatchType> refVal_setMatchedOn;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedOn);
-            setMatchedOn(refVal_setMatchedOn);
-            
+        case ModelBase::fieldHash(_XPLATSTR("matchedOn")):
+            if(field.first == _XPLATSTR("matchedOn"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<BannedUserMatchType> refVal_setMatchedOn;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedOn);
+                    setMatchedOn(refVal_setMatchedOn);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("matchedOnValue")):
+            if(field.first == _XPLATSTR("matchedOnValue"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<BannedUserMatch_matchedOnValue> refVal_setMatchedOnValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedOnValue);
+                    setMatchedOnValue(refVal_setMatchedOnValue);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("matchedOnValue"))))
+    return ok;
+}
+
+void BannedUserMatch::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_MatchedOn))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("matchedOnValue")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("matchedOn")), m_MatchedOn);
+    }
+    if(m_FieldsSet.test(FieldBit_MatchedOnValue))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("matchedOnValue")), m_MatchedOnValue);
+    }
+}
+
+bool BannedUserMatch::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<BannedUserMatch_matchedOnValue> refVal_setMatchedOnValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedOnValue);
-            setMatchedOnValue(refVal_setMatchedOnValue);
-            
+        case ModelBase::fieldHash(_XPLATSTR("matchedOn")):
+            {
+                std::shared_ptr<BannedUserMatchType> refVal_setMatchedOn;
+                if(!ModelBase::readBinary(reader, field, refVal_setMatchedOn))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMatchedOn(refVal_setMatchedOn);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("matchedOnValue")):
+            {
+                std::shared_ptr<BannedUserMatch_matchedOnValue> refVal_setMatchedOnValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setMatchedOnValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMatchedOnValue(refVal_setMatchedOnValue);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BannedUserMatch::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -84,13 +170,13 @@ void BannedUserMatch::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_MatchedOnIsSet)
+    if(m_FieldsSet.test(FieldBit_MatchedOn))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("matchedOn")), m_MatchedOn));
     }
-    if(m_MatchedOnValue.has_value())
+    if(m_FieldsSet.test(FieldBit_MatchedOnValue))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("matchedOnValue")), m_MatchedOnValue.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("matchedOnValue")), m_MatchedOnValue));
     }
 }
 
@@ -128,37 +214,38 @@ std::shared_ptr<BannedUserMatchType> BannedUserMatch::getMatchedOn() const
 void BannedUserMatch::setMatchedOn(const std::shared_ptr<BannedUserMatchType>& value)
 {
     m_MatchedOn = value;
-    m_MatchedOnIsSet = true;
+    m_FieldsSet.set(FieldBit_MatchedOn);
 }
 
 bool BannedUserMatch::matchedOnIsSet() const
 {
-    return m_MatchedOnIsSet;
+    return m_FieldsSet.test(FieldBit_MatchedOn);
 }
 
 void BannedUserMatch::unsetMatchedOn()
 {
-    m_MatchedOnIsSet = false;
+    m_FieldsSet.reset(FieldBit_MatchedOn);
 }
 std::shared_ptr<BannedUserMatch_matchedOnValue> BannedUserMatch::getMatchedOnValue() const
 {
-    return m_MatchedOnValue.get();
+    return m_MatchedOnValue;
 }
 
 
 void BannedUserMatch::setMatchedOnValue(const std::shared_ptr<BannedUserMatch_matchedOnValue>& value)
 {
     m_MatchedOnValue = value;
+    m_FieldsSet.set(FieldBit_MatchedOnValue);
 }
 
 bool BannedUserMatch::matchedOnValueIsSet() const
 {
-    return m_MatchedOnValue.has_value();
+    return m_FieldsSet.test(FieldBit_MatchedOnValue);
 }
 
 void BannedUserMatch::unsetMatchedOnValue()
 {
-    m_MatchedOnValue.reset();
+    m_FieldsSet.reset(FieldBit_MatchedOnValue);
 }
 
 }
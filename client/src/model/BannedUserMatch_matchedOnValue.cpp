@@ -38,6 +38,13 @@ web::json::value BannedUserMatch_matchedOnValue::toJson() const
     return val;
 }
 
+void BannedUserMatch_matchedOnValue::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+
+    writer.endObject();
+}
+
 bool BannedUserMatch_matchedOnValue::fromJson(const web::json::value& val)
 {
     bool ok = true;
@@ -20,20 +20,6 @@ namespace model {
 
 BillingInfo::BillingInfo()
 {
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_Address = utility::conversions::to_string_t("");
-    m_AddressIsSet = false;
-    m_City = utility::conversions::to_string_t("");
-    m_CityIsSet = false;
-    m_State = utility::conversions::to_string_t("");
-    m_StateIsSet = false;
-    m_Zip = utility::conversions::to_string_t("");
-    m_ZipIsSet = false;
-    m_Country = utility::conversions::to_string_t("");
-    m_CountryIsSet = false;
-    m_Email = utility::conversions::to_string_t("");
-    m_EmailIsSet = false;
 }
 
 BillingInfo::~BillingInfo()
@@ -48,42 +34,42 @@ void BillingInfo::validate()
 web::json::value BillingInfo::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_AddressIsSet)
+    if(m_FieldsSet.test(FieldBit_Address))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("address"))] = ModelBase::toJson(m_Address);
     }
-    if(m_CityIsSet)
+    if(m_FieldsSet.test(FieldBit_City))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("city"))] = ModelBase::toJson(m_City);
     }
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("state"))] = ModelBase::toJson(m_State);
     }
-    if(m_ZipIsSet)
+    if(m_FieldsSet.test(FieldBit_Zip))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("zip"))] = ModelBase::toJson(m_Zip);
     }
-    if(m_CountryIsSet)
+    if(m_FieldsSet.test(FieldBit_Country))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("country"))] = ModelBase::toJson(m_Country);
     }
-    if(m_Currency.has_value())
+    if(m_FieldsSet.test(FieldBit_Currency))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("currency"))] = ModelBase::toJson(m_Currency.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("currency"))] = ModelBase::toJson(m_Currency);
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
@@ -92,98 +78,323 @@ web::json::value BillingInfo::toJson() const
     return val;
 }
 
+void BillingInfo::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Address))
+    {
+        
+        writer.key(_XPLATSTR("address"));
+        ModelBase::writeJson(writer, m_Address);
+    }
+    if(m_FieldsSet.test(FieldBit_City))
+    {
+        
+        writer.key(_XPLATSTR("city"));
+        ModelBase::writeJson(writer, m_City);
+    }
+    if(m_FieldsSet.test(FieldBit_State))
+    {
+        
+        writer.key(_XPLATSTR("state"));
+        ModelBase::writeJson(writer, m_State);
+    }
+    if(m_FieldsSet.test(FieldBit_Zip))
+    {
+        
+        writer.key(_XPLATSTR("zip"));
+        ModelBase::writeJson(writer, m_Zip);
+    }
+    if(m_FieldsSet.test(FieldBit_Country))
+    {
+        
+        writer.key(_XPLATSTR("country"));
+        ModelBase::writeJson(writer, m_Country);
+    }
+    if(m_FieldsSet.test(FieldBit_Currency))
+    {
+        
+        writer.key(_XPLATSTR("currency"));
+        ModelBase::writeJson(writer, m_Currency);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+
+    writer.endObject();
+}
+
 bool BillingInfo::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("address"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("address")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setAddress;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAddress);
-            setAddress(refVal_setAddress);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("address")):
+            if(field.first == _XPLATSTR("address"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAddress;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAddress);
+                    setAddress(refVal_setAddress);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("city")):
+            if(field.first == _XPLATSTR("city"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCity;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCity);
+                    setCity(refVal_setCity);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            if(field.first == _XPLATSTR("state"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setState;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setState);
+                    setState(refVal_setState);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("zip")):
+            if(field.first == _XPLATSTR("zip"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setZip;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setZip);
+                    setZip(refVal_setZip);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("country")):
+            if(field.first == _XPLATSTR("country"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCountry;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCountry);
+                    setCountry(refVal_setCountry);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("currency")):
+            if(field.first == _XPLATSTR("currency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCurrency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCurrency);
+                    setCurrency(refVal_setCurrency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("city"))))
+    return ok;
+}
+
+void BillingInfo::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("city")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCity;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCity);
-            setCity(refVal_setCity);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("state"))))
+    if(m_FieldsSet.test(FieldBit_Address))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("state")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setState;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setState);
-            setState(refVal_setState);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("address")), m_Address);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("zip"))))
+    if(m_FieldsSet.test(FieldBit_City))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("zip")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setZip;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setZip);
-            setZip(refVal_setZip);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("city")), m_City);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("country"))))
+    if(m_FieldsSet.test(FieldBit_State))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("country")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCountry;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCountry);
-            setCountry(refVal_setCountry);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("state")), m_State);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("currency"))))
+    if(m_FieldsSet.test(FieldBit_Zip))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("currency")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCurrency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCurrency);
-            setCurrency(refVal_setCurrency);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("zip")), m_Zip);
+    }
+    if(m_FieldsSet.test(FieldBit_Country))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("country")), m_Country);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_Currency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("currency")), m_Currency);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
+    }
+}
+
+bool BillingInfo::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("address")):
+            {
+                utility::string_t refVal_setAddress;
+                if(!ModelBase::readBinary(reader, field, refVal_setAddress))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAddress(refVal_setAddress);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("city")):
+            {
+                utility::string_t refVal_setCity;
+                if(!ModelBase::readBinary(reader, field, refVal_setCity))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCity(refVal_setCity);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            {
+                utility::string_t refVal_setState;
+                if(!ModelBase::readBinary(reader, field, refVal_setState))
+                {
+                    ok = false;
+                    continue;
+                }
+                setState(refVal_setState);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("zip")):
+            {
+                utility::string_t refVal_setZip;
+                if(!ModelBase::readBinary(reader, field, refVal_setZip))
+                {
+                    ok = false;
+                    continue;
+                }
+                setZip(refVal_setZip);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("country")):
+            {
+                utility::string_t refVal_setCountry;
+                if(!ModelBase::readBinary(reader, field, refVal_setCountry))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCountry(refVal_setCountry);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("currency")):
+            {
+                utility::string_t refVal_setCurrency;
+                if(!ModelBase::readBinary(reader, field, refVal_setCurrency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCurrency(refVal_setCurrency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BillingInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -193,35 +404,35 @@ void BillingInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, cons
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_AddressIsSet)
+    if(m_FieldsSet.test(FieldBit_Address))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("address")), m_Address));
     }
-    if(m_CityIsSet)
+    if(m_FieldsSet.test(FieldBit_City))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("city")), m_City));
     }
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("state")), m_State));
     }
-    if(m_ZipIsSet)
+    if(m_FieldsSet.test(FieldBit_Zip))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("zip")), m_Zip));
     }
-    if(m_CountryIsSet)
+    if(m_FieldsSet.test(FieldBit_Country))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("country")), m_Country));
     }
-    if(m_Currency.has_value())
+    if(m_FieldsSet.test(FieldBit_Currency))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("currency")), m_Currency.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("currency")), m_Currency));
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
@@ -297,17 +508,17 @@ utility::string_t BillingInfo::getName() const
 void BillingInfo::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool BillingInfo::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void BillingInfo::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t BillingInfo::getAddress() const
 {
@@ -318,17 +529,17 @@ utility::string_t BillingInfo::getAddress() const
 void BillingInfo::setAddress(const utility::string_t& value)
 {
     m_Address = value;
-    m_AddressIsSet = true;
+    m_FieldsSet.set(FieldBit_Address);
 }
 
 bool BillingInfo::addressIsSet() const
 {
-    return m_AddressIsSet;
+    return m_FieldsSet.test(FieldBit_Address);
 }
 
 void BillingInfo::unsetAddress()
 {
-    m_AddressIsSet = false;
+    m_FieldsSet.reset(FieldBit_Address);
 }
 utility::string_t BillingInfo::getCity() const
 {
@@ -339,17 +550,17 @@ utility::string_t BillingInfo::getCity() const
 void BillingInfo::setCity(const utility::string_t& value)
 {
     m_City = value;
-    m_CityIsSet = true;
+    m_FieldsSet.set(FieldBit_City);
 }
 
 bool BillingInfo::cityIsSet() const
 {
-    return m_CityIsSet;
+    return m_FieldsSet.test(FieldBit_City);
 }
 
 void BillingInfo::unsetCity()
 {
-    m_CityIsSet = false;
+    m_FieldsSet.reset(FieldBit_City);
 }
 utility::string_t BillingInfo::getState() const
 {
@@ -360,17 +571,17 @@ utility::string_t BillingInfo::getState() const
 void BillingInfo::setState(const utility::string_t& value)
 {
     m_State = value;
-    m_StateIsSet = true;
+    m_FieldsSet.set(FieldBit_State);
 }
 
 bool BillingInfo::stateIsSet() const
 {
-    return m_StateIsSet;
+    return m_FieldsSet.test(FieldBit_State);
 }
 
 void BillingInfo::unsetState()
 {
-    m_StateIsSet = false;
+    m_FieldsSet.reset(FieldBit_State);
 }
 utility::string_t BillingInfo::getZip() const
 {
@@ -381,17 +592,17 @@ utility::string_t BillingInfo::getZip() const
 void BillingInfo::setZip(const utility::string_t& value)
 {
     m_Zip = value;
-    m_ZipIsSet = true;
+    m_FieldsSet.set(FieldBit_Zip);
 }
 
 bool BillingInfo::zipIsSet() const
 {
-    return m_ZipIsSet;
+    return m_FieldsSet.test(FieldBit_Zip);
 }
 
 void BillingInfo::unsetZip()
 {
-    m_ZipIsSet = false;
+    m_FieldsSet.reset(FieldBit_Zip);
 }
 utility::string_t BillingInfo::getCountry() const
 {
@@ -402,37 +613,38 @@ utility::string_t BillingInfo::getCountry() const
 void BillingInfo::setCountry(const utility::string_t& value)
 {
     m_Country = value;
-    m_CountryIsSet = true;
+    m_FieldsSet.set(FieldBit_Country);
 }
 
 bool BillingInfo::countryIsSet() const
 {
-    return m_CountryIsSet;
+    return m_FieldsSet.test(FieldBit_Country);
 }
 
 void BillingInfo::unsetCountry()
 {
-    m_CountryIsSet = false;
+    m_FieldsSet.reset(FieldBit_Country);
 }
 utility::string_t BillingInfo::getCurrency() const
 {
-    return m_Currency.get();
+    return m_Currency;
 }
 
 
 void BillingInfo::setCurrency(const utility::string_t& value)
 {
     m_Currency = value;
+    m_FieldsSet.set(FieldBit_Currency);
 }
 
 bool BillingInfo::currencyIsSet() const
 {
-    return m_Currency.has_value();
+    return m_FieldsSet.test(FieldBit_Currency);
 }
 
 void BillingInfo::unsetCurrency()
 {
-    m_Currency.reset();
+    m_FieldsSet.reset(FieldBit_Currency);
 }
 utility::string_t BillingInfo::getEmail() const
 {
@@ -443,17 +655,17 @@ utility::string_t BillingInfo::getEmail() const
 void BillingInfo::setEmail(const utility::string_t& value)
 {
     m_Email = value;
-    m_EmailIsSet = true;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool BillingInfo::emailIsSet() const
 {
-    return m_EmailIsSet;
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void BillingInfo::unsetEmail()
 {
-    m_EmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_Email);
 }
 
 }
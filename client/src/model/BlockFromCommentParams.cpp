@@ -20,7 +20,6 @@ namespace model {
 
 BlockFromCommentParams::BlockFromCommentParams()
 {
-    m_CommentIdsToCheckIsSet = false;
 }
 
 BlockFromCommentParams::~BlockFromCommentParams()
@@ -35,7 +34,7 @@ void BlockFromCommentParams::validate()
 web::json::value BlockFromCommentParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentIdsToCheckIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck"))] = ModelBase::toJson(m_CommentIdsToCheck);
@@ -44,23 +43,87 @@ web::json::value BlockFromCommentParams::toJson() const
     return val;
 }
 
+void BlockFromCommentParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
+    {
+        
+        writer.key(_XPLATSTR("commentIdsToCheck"));
+        ModelBase::writeJson(writer, m_CommentIdsToCheck);
+    }
+
+    writer.endObject();
+}
+
 bool BlockFromCommentParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setCommentIdsToCheck;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIdsToCheck);
-            setCommentIdsToCheck(refVal_setCommentIdsToCheck);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commentIdsToCheck")):
+            if(field.first == _XPLATSTR("commentIdsToCheck"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setCommentIdsToCheck;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIdsToCheck);
+                    setCommentIdsToCheck(refVal_setCommentIdsToCheck);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void BlockFromCommentParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentIdsToCheck")), m_CommentIdsToCheck);
+    }
+}
+
+bool BlockFromCommentParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("commentIdsToCheck")):
+            {
+                std::vector<utility::string_t> refVal_setCommentIdsToCheck;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentIdsToCheck))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentIdsToCheck(refVal_setCommentIdsToCheck);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void BlockFromCommentParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void BlockFromCommentParams::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentIdsToCheckIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck")), m_CommentIdsToCheck));
     }
@@ -102,17 +165,17 @@ std::vector<utility::string_t> BlockFromCommentParams::getCommentIdsToCheck() co
 void BlockFromCommentParams::setCommentIdsToCheck(const std::vector<utility::string_t>& value)
 {
     m_CommentIdsToCheck = value;
-    m_CommentIdsToCheckIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentIdsToCheck);
 }
 
 bool BlockFromCommentParams::commentIdsToCheckIsSet() const
 {
-    return m_CommentIdsToCheckIsSet;
+    return m_FieldsSet.test(FieldBit_CommentIdsToCheck);
 }
 
 void BlockFromCommentParams::unsetCommentIdsToCheck()
 {
-    m_CommentIdsToCheckIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentIdsToCheck);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 BlockSuccess::BlockSuccess()
 {
-    m_StatusIsSet = false;
-    m_CommentStatusesIsSet = false;
 }
 
 BlockSuccess::~BlockSuccess()
@@ -36,12 +34,12 @@ void BlockSuccess::validate()
 web::json::value BlockSuccess::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CommentStatusesIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentStatuses))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentStatuses"))] = ModelBase::toJson(m_CommentStatuses);
@@ -50,32 +48,119 @@ web::json::value BlockSuccess::toJson() const
     return val;
 }
 
+void BlockSuccess::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentStatuses))
+    {
+        
+        writer.key(_XPLATSTR("commentStatuses"));
+        ModelBase::writeJson(writer, m_CommentStatuses);
+    }
+
+    writer.endObject();
+}
+
 bool BlockSuccess::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentStatuses")):
+            if(field.first == _XPLATSTR("commentStatuses"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, bool> refVal_setCommentStatuses;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentStatuses);
+                    setCommentStatuses(refVal_setCommentStatuses);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentStatuses"))))
+    return ok;
+}
+
+void BlockSuccess::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentStatuses")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentStatuses))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentStatuses")), m_CommentStatuses);
+    }
+}
+
+bool BlockSuccess::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, bool> refVal_setCommentStatuses;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentStatuses);
-            setCommentStatuses(refVal_setCommentStatuses);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentStatuses")):
+            {
+                std::map<utility::string_t, bool> refVal_setCommentStatuses;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentStatuses))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentStatuses(refVal_setCommentStatuses);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BlockSuccess::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void BlockSuccess::toMultipart(std::shared_ptr<MultipartFormData> multipart, con
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CommentStatusesIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentStatuses))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentStatuses")), m_CommentStatuses));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> BlockSuccess::getStatus() const
 void BlockSuccess::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool BlockSuccess::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void BlockSuccess::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::map<utility::string_t, bool> BlockSuccess::getCommentStatuses() const
 {
@@ -149,17 +234,17 @@ std::map<utility::string_t, bool> BlockSuccess::getCommentStatuses() const
 void BlockSuccess::setCommentStatuses(std::map<utility::string_t, bool> value)
 {
     m_CommentStatuses = value;
-    m_CommentStatusesIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentStatuses);
 }
 
 bool BlockSuccess::commentStatusesIsSet() const
 {
-    return m_CommentStatusesIsSet;
+    return m_FieldsSet.test(FieldBit_CommentStatuses);
 }
 
 void BlockSuccess::unsetCommentStatuses()
 {
-    m_CommentStatusesIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentStatuses);
 }
 
 }
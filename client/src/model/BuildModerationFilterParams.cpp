@@ -20,17 +20,6 @@ namespace model {
 
 BuildModerationFilterParams::BuildModerationFilterParams()
 {
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_Filters = utility::conversions::to_string_t("");
-    m_FiltersIsSet = false;
-    m_SearchFilters = utility::conversions::to_string_t("");
-    m_SearchFiltersIsSet = false;
-    m_TextSearch = utility::conversions::to_string_t("");
-    m_TextSearchIsSet = false;
-    m_AdditionalPropertiesIsSet = false;
 }
 
 BuildModerationFilterParams::~BuildModerationFilterParams()
@@ -45,33 +34,33 @@ void BuildModerationFilterParams::validate()
 web::json::value BuildModerationFilterParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_FiltersIsSet)
+    if(m_FieldsSet.test(FieldBit_Filters))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("filters"))] = ModelBase::toJson(m_Filters);
     }
-    if(m_SearchFiltersIsSet)
+    if(m_FieldsSet.test(FieldBit_SearchFilters))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("searchFilters"))] = ModelBase::toJson(m_SearchFilters);
     }
-    if(m_TextSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_TextSearch))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("textSearch"))] = ModelBase::toJson(m_TextSearch);
     }
     // Serialize additional properties
-    if(m_AdditionalPropertiesIsSet)
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
         for(const auto& item : m_AdditionalProperties)
         {
@@ -82,81 +71,261 @@ web::json::value BuildModerationFilterParams::toJson() const
     return val;
 }
 
-bool BuildModerationFilterParams::fromJson(const web::json::value& val)
+void BuildModerationFilterParams::writeJson(JsonWriter& writer) const
 {
-    bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
-        }
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Filters))
+    {
+        
+        writer.key(_XPLATSTR("filters"));
+        ModelBase::writeJson(writer, m_Filters);
+    }
+    if(m_FieldsSet.test(FieldBit_SearchFilters))
+    {
+        
+        writer.key(_XPLATSTR("searchFilters"));
+        ModelBase::writeJson(writer, m_SearchFilters);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("filters"))))
+    if(m_FieldsSet.test(FieldBit_TextSearch))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("filters")));
-        if(!fieldValue.is_null())
+        
+        writer.key(_XPLATSTR("textSearch"));
+        ModelBase::writeJson(writer, m_TextSearch);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            utility::string_t refVal_setFilters;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFilters);
-            setFilters(refVal_setFilters);
-            
+            writer.key(item.first);
+            writer.value(item.second);
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("searchFilters"))))
+
+    writer.endObject();
+}
+
+bool BuildModerationFilterParams::fromJson(const web::json::value& val)
+{
+    bool ok = true;
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("searchFilters")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setSearchFilters;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSearchFilters);
-            setSearchFilters(refVal_setSearchFilters);
-            
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("filters")):
+            if(field.first == _XPLATSTR("filters"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFilters;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFilters);
+                    setFilters(refVal_setFilters);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("searchFilters")):
+            if(field.first == _XPLATSTR("searchFilters"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSearchFilters;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSearchFilters);
+                    setSearchFilters(refVal_setSearchFilters);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("textSearch")):
+            if(field.first == _XPLATSTR("textSearch"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTextSearch;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTextSearch);
+                    setTextSearch(refVal_setTextSearch);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        // This is an additional property
+        m_AdditionalProperties[field.first] = fieldValue;
+        m_FieldsSet.set(FieldBit_AdditionalProperties);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("textSearch"))))
+    return ok;
+}
+
+void BuildModerationFilterParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Filters))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("textSearch")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("filters")), m_Filters);
+    }
+    if(m_FieldsSet.test(FieldBit_SearchFilters))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("searchFilters")), m_SearchFilters);
+    }
+    if(m_FieldsSet.test(FieldBit_TextSearch))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("textSearch")), m_TextSearch);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            utility::string_t refVal_setTextSearch;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTextSearch);
-            setTextSearch(refVal_setTextSearch);
-            
+            writer.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);
+            writer.writeString(item.first);
+            writer.writeString(item.second.serialize());
         }
     }
-    // Capture additional properties (keys not defined in the schema)
-    if(val.is_object())
+}
+
+bool BuildModerationFilterParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        for(const auto& item : val.as_object())
+        switch(field.tag)
         {
-            // Skip known properties
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("userId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("tenantId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("filters"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("searchFilters"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("textSearch"))) continue;
-            // This is an additional property
-            m_AdditionalProperties[item.first] = item.second;
-            m_AdditionalPropertiesIsSet = true;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("filters")):
+            {
+                utility::string_t refVal_setFilters;
+                if(!ModelBase::readBinary(reader, field, refVal_setFilters))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFilters(refVal_setFilters);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("searchFilters")):
+            {
+                utility::string_t refVal_setSearchFilters;
+                if(!ModelBase::readBinary(reader, field, refVal_setSearchFilters))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSearchFilters(refVal_setSearchFilters);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("textSearch")):
+            {
+                utility::string_t refVal_setTextSearch;
+                if(!ModelBase::readBinary(reader, field, refVal_setTextSearch))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTextSearch(refVal_setTextSearch);
+            }
+            continue;
+        default:
+            break;
         }
+        if(field.wireType == BinaryWireType::Named)
+        {
+            utility::string_t key;
+            utility::string_t text;
+            if(reader.readString(key) && reader.readString(text))
+            {
+                try
+                {
+                    m_AdditionalProperties[key] = web::json::value::parse(text);
+                }
+                catch(const web::json::json_exception&)
+                {
+                    return false;
+                }
+                m_FieldsSet.set(FieldBit_AdditionalProperties);
+            }
+            continue;
+        }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BuildModerationFilterParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -166,23 +335,23 @@ void BuildModerationFilterParams::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_FiltersIsSet)
+    if(m_FieldsSet.test(FieldBit_Filters))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("filters")), m_Filters));
     }
-    if(m_SearchFiltersIsSet)
+    if(m_FieldsSet.test(FieldBit_SearchFilters))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("searchFilters")), m_SearchFilters));
     }
-    if(m_TextSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_TextSearch))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textSearch")), m_TextSearch));
     }
@@ -240,17 +409,17 @@ utility::string_t BuildModerationFilterParams::getUserId() const
 void BuildModerationFilterParams::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool BuildModerationFilterParams::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void BuildModerationFilterParams::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t BuildModerationFilterParams::getTenantId() const
 {
@@ -261,17 +430,17 @@ utility::string_t BuildModerationFilterParams::getTenantId() const
 void BuildModerationFilterParams::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool BuildModerationFilterParams::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void BuildModerationFilterParams::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t BuildModerationFilterParams::getFilters() const
 {
@@ -282,17 +451,17 @@ utility::string_t BuildModerationFilterParams::getFilters() const
 void BuildModerationFilterParams::setFilters(const utility::string_t& value)
 {
     m_Filters = value;
-    m_FiltersIsSet = true;
+    m_FieldsSet.set(FieldBit_Filters);
 }
 
 bool BuildModerationFilterParams::filtersIsSet() const
 {
-    return m_FiltersIsSet;
+    return m_FieldsSet.test(FieldBit_Filters);
 }
 
 void BuildModerationFilterParams::unsetFilters()
 {
-    m_FiltersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Filters);
 }
 utility::string_t BuildModerationFilterParams::getSearchFilters() const
 {
@@ -303,17 +472,17 @@ utility::string_t BuildModerationFilterParams::getSearchFilters() const
 void BuildModerationFilterParams::setSearchFilters(const utility::string_t& value)
 {
     m_SearchFilters = value;
-    m_SearchFiltersIsSet = true;
+    m_FieldsSet.set(FieldBit_SearchFilters);
 }
 
 bool BuildModerationFilterParams::searchFiltersIsSet() const
 {
-    return m_SearchFiltersIsSet;
+    return m_FieldsSet.test(FieldBit_SearchFilters);
 }
 
 void BuildModerationFilterParams::unsetSearchFilters()
 {
-    m_SearchFiltersIsSet = false;
+    m_FieldsSet.reset(FieldBit_SearchFilters);
 }
 utility::string_t BuildModerationFilterParams::getTextSearch() const
 {
@@ -324,17 +493,17 @@ utility::string_t BuildModerationFilterParams::getTextSearch() const
 void BuildModerationFilterParams::setTextSearch(const utility::string_t& value)
 {
     m_TextSearch = value;
-    m_TextSearchIsSet = true;
+    m_FieldsSet.set(FieldBit_TextSearch);
 }
 
 bool BuildModerationFilterParams::textSearchIsSet() const
 {
-    return m_TextSearchIsSet;
+    return m_FieldsSet.test(FieldBit_TextSearch);
 }
 
 void BuildModerationFilterParams::unsetTextSearch()
 {
-    m_TextSearchIsSet = false;
+    m_FieldsSet.reset(FieldBit_TextSearch);
 }
 
 
@@ -346,24 +515,24 @@ std::map<utility::string_t, web::json::value> BuildModerationFilterParams::getAd
 void BuildModerationFilterParams::setAdditionalProperties(const std::map<utility::string_t, web::json::value>& value)
 {
     m_AdditionalProperties = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 void BuildModerationFilterParams::addAdditionalProperty(const utility::string_t& key, const web::json::value& value)
 {
     m_AdditionalProperties[key] = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 bool BuildModerationFilterParams::additionalPropertiesIsSet() const
 {
-    return m_AdditionalPropertiesIsSet;
+    return m_FieldsSet.test(FieldBit_AdditionalProperties);
 }
 
 void BuildModerationFilterParams::unsetAdditionalProperties()
 {
     m_AdditionalProperties.clear();
-    m_AdditionalPropertiesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdditionalProperties);
 }
 }
 }
@@ -20,9 +20,6 @@ namespace model {
 
 BuildModerationFilterResponse::BuildModerationFilterResponse()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
-    m_ModerationFilterIsSet = false;
 }
 
 BuildModerationFilterResponse::~BuildModerationFilterResponse()
@@ -37,12 +34,12 @@ void BuildModerationFilterResponse::validate()
 web::json::value BuildModerationFilterResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ModerationFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderationFilter"))] = ModelBase::toJson(m_ModerationFilter);
@@ -51,32 +48,119 @@ web::json::value BuildModerationFilterResponse::toJson() const
     return val;
 }
 
+void BuildModerationFilterResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
+    {
+        
+        writer.key(_XPLATSTR("moderationFilter"));
+        ModelBase::writeJson(writer, m_ModerationFilter);
+    }
+
+    writer.endObject();
+}
+
 bool BuildModerationFilterResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationFilter")):
+            if(field.first == _XPLATSTR("moderationFilter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<ModerationFilter> refVal_setModerationFilter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationFilter);
+                    setModerationFilter(refVal_setModerationFilter);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationFilter"))))
+    return ok;
+}
+
+void BuildModerationFilterResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationFilter")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationFilter")), m_ModerationFilter);
+    }
+}
+
+bool BuildModerationFilterResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<ModerationFilter> refVal_setModerationFilter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationFilter);
-            setModerationFilter(refVal_setModerationFilter);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationFilter")):
+            {
+                std::shared_ptr<ModerationFilter> refVal_setModerationFilter;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationFilter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationFilter(refVal_setModerationFilter);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BuildModerationFilterResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void BuildModerationFilterResponse::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ModerationFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationFilter")), m_ModerationFilter));
     }
@@ -130,17 +214,17 @@ utility::string_t BuildModerationFilterResponse::getStatus() const
 void BuildModerationFilterResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool BuildModerationFilterResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void BuildModerationFilterResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<ModerationFilter> BuildModerationFilterResponse::getModerationFilter() const
 {
@@ -151,17 +235,17 @@ std::shared_ptr<ModerationFilter> BuildModerationFilterResponse::getModerationFi
 void BuildModerationFilterResponse::setModerationFilter(const std::shared_ptr<ModerationFilter>& value)
 {
     m_ModerationFilter = value;
-    m_ModerationFilterIsSet = true;
+    m_FieldsSet.set(FieldBit_ModerationFilter);
 }
 
 bool BuildModerationFilterResponse::moderationFilterIsSet() const
 {
-    return m_ModerationFilterIsSet;
+    return m_FieldsSet.test(FieldBit_ModerationFilter);
 }
 
 void BuildModerationFilterResponse::unsetModerationFilter()
 {
-    m_ModerationFilterIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModerationFilter);
 }
 
 }
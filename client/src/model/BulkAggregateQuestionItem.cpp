@@ -20,16 +20,6 @@ namespace model {
 
 BulkAggregateQuestionItem::BulkAggregateQuestionItem()
 {
-    m_AggId = utility::conversions::to_string_t("");
-    m_AggIdIsSet = false;
-    m_QuestionId = utility::conversions::to_string_t("");
-    m_QuestionIdIsSet = false;
-    m_QuestionIdsIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_TimeBucketIsSet = false;
-    m_StartDate = utility::datetime();
-    m_StartDateIsSet = false;
 }
 
 BulkAggregateQuestionItem::~BulkAggregateQuestionItem()
@@ -44,32 +34,32 @@ void BulkAggregateQuestionItem::validate()
 web::json::value BulkAggregateQuestionItem::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_AggIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AggId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("aggId"))] = ModelBase::toJson(m_AggId);
     }
-    if(m_QuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionId"))] = ModelBase::toJson(m_QuestionId);
     }
-    if(m_QuestionIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionIds"))] = ModelBase::toJson(m_QuestionIds);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_TimeBucketIsSet)
+    if(m_FieldsSet.test(FieldBit_TimeBucket))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("timeBucket"))] = ModelBase::toJson(m_TimeBucket);
     }
-    if(m_StartDateIsSet)
+    if(m_FieldsSet.test(FieldBit_StartDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("startDate"))] = ModelBase::toJson(m_StartDate);
@@ -78,76 +68,255 @@ web::json::value BulkAggregateQuestionItem::toJson() const
     return val;
 }
 
+void BulkAggregateQuestionItem::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_AggId))
+    {
+        
+        writer.key(_XPLATSTR("aggId"));
+        ModelBase::writeJson(writer, m_AggId);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionId))
+    {
+        
+        writer.key(_XPLATSTR("questionId"));
+        ModelBase::writeJson(writer, m_QuestionId);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionIds))
+    {
+        
+        writer.key(_XPLATSTR("questionIds"));
+        ModelBase::writeJson(writer, m_QuestionIds);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_TimeBucket))
+    {
+        
+        writer.key(_XPLATSTR("timeBucket"));
+        ModelBase::writeJson(writer, m_TimeBucket);
+    }
+    if(m_FieldsSet.test(FieldBit_StartDate))
+    {
+        
+        writer.key(_XPLATSTR("startDate"));
+        ModelBase::writeJson(writer, m_StartDate);
+    }
+
+    writer.endObject();
+}
+
 bool BulkAggregateQuestionItem::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("aggId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("aggId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAggId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAggId);
-            setAggId(refVal_setAggId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setQuestionId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionId);
-            setQuestionId(refVal_setQuestionId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("aggId")):
+            if(field.first == _XPLATSTR("aggId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAggId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAggId);
+                    setAggId(refVal_setAggId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionId")):
+            if(field.first == _XPLATSTR("questionId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setQuestionId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionId);
+                    setQuestionId(refVal_setQuestionId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionIds")):
+            if(field.first == _XPLATSTR("questionIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setQuestionIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionIds);
+                    setQuestionIds(refVal_setQuestionIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("timeBucket")):
+            if(field.first == _XPLATSTR("timeBucket"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AggregateTimeBucket> refVal_setTimeBucket;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTimeBucket);
+                    setTimeBucket(refVal_setTimeBucket);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("startDate")):
+            if(field.first == _XPLATSTR("startDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setStartDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStartDate);
+                    setStartDate(refVal_setStartDate);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionIds"))))
+    return ok;
+}
+
+void BulkAggregateQuestionItem::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_AggId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setQuestionIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionIds);
-            setQuestionIds(refVal_setQuestionIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("aggId")), m_AggId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionId")), m_QuestionId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("timeBucket"))))
+    if(m_FieldsSet.test(FieldBit_QuestionIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("timeBucket")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<AggregateTimeBucket> refVal_setTimeBucket;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTimeBucket);
-            setTimeBucket(refVal_setTimeBucket);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionIds")), m_QuestionIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("startDate"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("startDate")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_TimeBucket))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("timeBucket")), m_TimeBucket);
+    }
+    if(m_FieldsSet.test(FieldBit_StartDate))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("startDate")), m_StartDate);
+    }
+}
+
+bool BulkAggregateQuestionItem::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::datetime refVal_setStartDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStartDate);
-            setStartDate(refVal_setStartDate);
-            
+        case ModelBase::fieldHash(_XPLATSTR("aggId")):
+            {
+                utility::string_t refVal_setAggId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAggId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAggId(refVal_setAggId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionId")):
+            {
+                utility::string_t refVal_setQuestionId;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionId(refVal_setQuestionId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionIds")):
+            {
+                std::vector<utility::string_t> refVal_setQuestionIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionIds(refVal_setQuestionIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("timeBucket")):
+            {
+                std::shared_ptr<AggregateTimeBucket> refVal_setTimeBucket;
+                if(!ModelBase::readBinary(reader, field, refVal_setTimeBucket))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTimeBucket(refVal_setTimeBucket);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("startDate")):
+            {
+                utility::datetime refVal_setStartDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setStartDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStartDate(refVal_setStartDate);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BulkAggregateQuestionItem::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -157,27 +326,27 @@ void BulkAggregateQuestionItem::toMultipart(std::shared_ptr<MultipartFormData> m
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_AggIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AggId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("aggId")), m_AggId));
     }
-    if(m_QuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionId")), m_QuestionId));
     }
-    if(m_QuestionIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionIds")), m_QuestionIds));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_TimeBucketIsSet)
+    if(m_FieldsSet.test(FieldBit_TimeBucket))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("timeBucket")), m_TimeBucket));
     }
-    if(m_StartDateIsSet)
+    if(m_FieldsSet.test(FieldBit_StartDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("startDate")), m_StartDate));
     }
@@ -241,17 +410,17 @@ utility::string_t BulkAggregateQuestionItem::getAggId() const
 void BulkAggregateQuestionItem::setAggId(const utility::string_t& value)
 {
     m_AggId = value;
-    m_AggIdIsSet = true;
+    m_FieldsSet.set(FieldBit_AggId);
 }
 
 bool BulkAggregateQuestionItem::aggIdIsSet() const
 {
-    return m_AggIdIsSet;
+    return m_FieldsSet.test(FieldBit_AggId);
 }
 
 void BulkAggregateQuestionItem::unsetAggId()
 {
-    m_AggIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_AggId);
 }
 utility::string_t BulkAggregateQuestionItem::getQuestionId() const
 {
@@ -262,17 +431,17 @@ utility::string_t BulkAggregateQuestionItem::getQuestionId() const
 void BulkAggregateQuestionItem::setQuestionId(const utility::string_t& value)
 {
     m_QuestionId = value;
-    m_QuestionIdIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionId);
 }
 
 bool BulkAggregateQuestionItem::questionIdIsSet() const
 {
-    return m_QuestionIdIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionId);
 }
 
 void BulkAggregateQuestionItem::unsetQuestionId()
 {
-    m_QuestionIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionId);
 }
 std::vector<utility::string_t> BulkAggregateQuestionItem::getQuestionIds() const
 {
@@ -283,17 +452,17 @@ std::vector<utility::string_t> BulkAggregateQuestionItem::getQuestionIds() const
 void BulkAggregateQuestionItem::setQuestionIds(const std::vector<utility::string_t>& value)
 {
     m_QuestionIds = value;
-    m_QuestionIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionIds);
 }
 
 bool BulkAggregateQuestionItem::questionIdsIsSet() const
 {
-    return m_QuestionIdsIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionIds);
 }
 
 void BulkAggregateQuestionItem::unsetQuestionIds()
 {
-    m_QuestionIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionIds);
 }
 utility::string_t BulkAggregateQuestionItem::getUrlId() const
 {
@@ -304,17 +473,17 @@ utility::string_t BulkAggregateQuestionItem::getUrlId() const
 void BulkAggregateQuestionItem::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool BulkAggregateQuestionItem::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void BulkAggregateQuestionItem::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 std::shared_ptr<AggregateTimeBucket> BulkAggregateQuestionItem::getTimeBucket() const
 {
@@ -325,17 +494,17 @@ std::shared_ptr<AggregateTimeBucket> BulkAggregateQuestionItem::getTimeBucket()
 void BulkAggregateQuestionItem::setTimeBucket(const std::shared_ptr<AggregateTimeBucket>& value)
 {
     m_TimeBucket = value;
-    m_TimeBucketIsSet = true;
+    m_FieldsSet.set(FieldBit_TimeBucket);
 }
 
 bool BulkAggregateQuestionItem::timeBucketIsSet() const
 {
-    return m_TimeBucketIsSet;
+    return m_FieldsSet.test(FieldBit_TimeBucket);
 }
 
 void BulkAggregateQuestionItem::unsetTimeBucket()
 {
-    m_TimeBucketIsSet = false;
+    m_FieldsSet.reset(FieldBit_TimeBucket);
 }
 utility::datetime BulkAggregateQuestionItem::getStartDate() const
 {
@@ -346,17 +515,17 @@ utility::datetime BulkAggregateQuestionItem::getStartDate() const
 void BulkAggregateQuestionItem::setStartDate(const utility::datetime& value)
 {
     m_StartDate = value;
-    m_StartDateIsSet = true;
+    m_FieldsSet.set(FieldBit_StartDate);
 }
 
 bool BulkAggregateQuestionItem::startDateIsSet() const
 {
-    return m_StartDateIsSet;
+    return m_FieldsSet.test(FieldBit_StartDate);
 }
 
 void BulkAggregateQuestionItem::unsetStartDate()
 {
-    m_StartDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_StartDate);
 }
 
 }
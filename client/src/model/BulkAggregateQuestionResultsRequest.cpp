@@ -20,7 +20,6 @@ namespace model {
 
 BulkAggregateQuestionResultsRequest::BulkAggregateQuestionResultsRequest()
 {
-    m_AggregationsIsSet = false;
 }
 
 BulkAggregateQuestionResultsRequest::~BulkAggregateQuestionResultsRequest()
@@ -35,7 +34,7 @@ void BulkAggregateQuestionResultsRequest::validate()
 web::json::value BulkAggregateQuestionResultsRequest::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_AggregationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Aggregations))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("aggregations"))] = ModelBase::toJson(m_Aggregations);
@@ -44,23 +43,87 @@ web::json::value BulkAggregateQuestionResultsRequest::toJson() const
     return val;
 }
 
+void BulkAggregateQuestionResultsRequest::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Aggregations))
+    {
+        
+        writer.key(_XPLATSTR("aggregations"));
+        ModelBase::writeJson(writer, m_Aggregations);
+    }
+
+    writer.endObject();
+}
+
 bool BulkAggregateQuestionResultsRequest::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("aggregations"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("aggregations")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<BulkAggregateQuestionItem>> refVal_setAggregations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAggregations);
-            setAggregations(refVal_setAggregations);
-            
+        case ModelBase::fieldHash(_XPLATSTR("aggregations")):
+            if(field.first == _XPLATSTR("aggregations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<BulkAggregateQuestionItem>> refVal_setAggregations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAggregations);
+                    setAggregations(refVal_setAggregations);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void BulkAggregateQuestionResultsRequest::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Aggregations))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("aggregations")), m_Aggregations);
+    }
+}
+
+bool BulkAggregateQuestionResultsRequest::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("aggregations")):
+            {
+                std::vector<std::shared_ptr<BulkAggregateQuestionItem>> refVal_setAggregations;
+                if(!ModelBase::readBinary(reader, field, refVal_setAggregations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAggregations(refVal_setAggregations);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void BulkAggregateQuestionResultsRequest::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void BulkAggregateQuestionResultsRequest::toMultipart(std::shared_ptr<MultipartF
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_AggregationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Aggregations))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("aggregations")), m_Aggregations));
     }
@@ -102,17 +165,17 @@ std::vector<std::shared_ptr<BulkAggregateQuestionItem>> BulkAggregateQuestionRes
 void BulkAggregateQuestionResultsRequest::setAggregations(const std::vector<std::shared_ptr<BulkAggregateQuestionItem>>& value)
 {
     m_Aggregations = value;
-    m_AggregationsIsSet = true;
+    m_FieldsSet.set(FieldBit_Aggregations);
 }
 
 bool BulkAggregateQuestionResultsRequest::aggregationsIsSet() const
 {
-    return m_AggregationsIsSet;
+    return m_FieldsSet.test(FieldBit_Aggregations);
 }
 
 void BulkAggregateQuestionResultsRequest::unsetAggregations()
 {
-    m_AggregationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Aggregations);
 }
 
 }
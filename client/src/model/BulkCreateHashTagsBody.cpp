@@ -20,9 +20,6 @@ namespace model {
 
 BulkCreateHashTagsBody::BulkCreateHashTagsBody()
 {
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_TagsIsSet = false;
 }
 
 BulkCreateHashTagsBody::~BulkCreateHashTagsBody()
@@ -37,12 +34,12 @@ void BulkCreateHashTagsBody::validate()
 web::json::value BulkCreateHashTagsBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tags"))] = ModelBase::toJson(m_Tags);
@@ -51,32 +48,119 @@ web::json::value BulkCreateHashTagsBody::toJson() const
     return val;
 }
 
+void BulkCreateHashTagsBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Tags))
+    {
+        
+        writer.key(_XPLATSTR("tags"));
+        ModelBase::writeJson(writer, m_Tags);
+    }
+
+    writer.endObject();
+}
+
 bool BulkCreateHashTagsBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            if(field.first == _XPLATSTR("tags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<BulkCreateHashTagsBody_tags_inner>> refVal_setTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
+                    setTags(refVal_setTags);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tags"))))
+    return ok;
+}
+
+void BulkCreateHashTagsBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tags")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Tags))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tags")), m_Tags);
+    }
+}
+
+bool BulkCreateHashTagsBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<BulkCreateHashTagsBody_tags_inner>> refVal_setTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
-            setTags(refVal_setTags);
-            
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            {
+                std::vector<std::shared_ptr<BulkCreateHashTagsBody_tags_inner>> refVal_setTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTags(refVal_setTags);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BulkCreateHashTagsBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void BulkCreateHashTagsBody::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tags")), m_Tags));
     }
@@ -130,17 +214,17 @@ utility::string_t BulkCreateHashTagsBody::getTenantId() const
 void BulkCreateHashTagsBody::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool BulkCreateHashTagsBody::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void BulkCreateHashTagsBody::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 std::vector<std::shared_ptr<BulkCreateHashTagsBody_tags_inner>> BulkCreateHashTagsBody::getTags() const
 {
@@ -151,17 +235,17 @@ std::vector<std::shared_ptr<BulkCreateHashTagsBody_tags_inner>> BulkCreateHashTa
 void BulkCreateHashTagsBody::setTags(const std::vector<std::shared_ptr<BulkCreateHashTagsBody_tags_inner>>& value)
 {
     m_Tags = value;
-    m_TagsIsSet = true;
+    m_FieldsSet.set(FieldBit_Tags);
 }
 
 bool BulkCreateHashTagsBody::tagsIsSet() const
 {
-    return m_TagsIsSet;
+    return m_FieldsSet.test(FieldBit_Tags);
 }
 
 void BulkCreateHashTagsBody::unsetTags()
 {
-    m_TagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tags);
 }
 
 }
@@ -20,10 +20,6 @@ namespace model {
 
 BulkCreateHashTagsBody_tags_inner::BulkCreateHashTagsBody_tags_inner()
 {
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_Tag = utility::conversions::to_string_t("");
-    m_TagIsSet = false;
 }
 
 BulkCreateHashTagsBody_tags_inner::~BulkCreateHashTagsBody_tags_inner()
@@ -38,12 +34,12 @@ void BulkCreateHashTagsBody_tags_inner::validate()
 web::json::value BulkCreateHashTagsBody_tags_inner::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_TagIsSet)
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tag"))] = ModelBase::toJson(m_Tag);
@@ -52,32 +48,119 @@ web::json::value BulkCreateHashTagsBody_tags_inner::toJson() const
     return val;
 }
 
+void BulkCreateHashTagsBody_tags_inner::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_Tag))
+    {
+        
+        writer.key(_XPLATSTR("tag"));
+        ModelBase::writeJson(writer, m_Tag);
+    }
+
+    writer.endObject();
+}
+
 bool BulkCreateHashTagsBody_tags_inner::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tag")):
+            if(field.first == _XPLATSTR("tag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTag);
+                    setTag(refVal_setTag);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tag"))))
+    return ok;
+}
+
+void BulkCreateHashTagsBody_tags_inner::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tag")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_Tag))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tag")), m_Tag);
+    }
+}
+
+bool BulkCreateHashTagsBody_tags_inner::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setTag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTag);
-            setTag(refVal_setTag);
-            
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tag")):
+            {
+                utility::string_t refVal_setTag;
+                if(!ModelBase::readBinary(reader, field, refVal_setTag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTag(refVal_setTag);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BulkCreateHashTagsBody_tags_inner::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -87,11 +170,11 @@ void BulkCreateHashTagsBody_tags_inner::toMultipart(std::shared_ptr<MultipartFor
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_TagIsSet)
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tag")), m_Tag));
     }
@@ -131,17 +214,17 @@ utility::string_t BulkCreateHashTagsBody_tags_inner::getUrl() const
 void BulkCreateHashTagsBody_tags_inner::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool BulkCreateHashTagsBody_tags_inner::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void BulkCreateHashTagsBody_tags_inner::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t BulkCreateHashTagsBody_tags_inner::getTag() const
 {
@@ -152,17 +235,17 @@ utility::string_t BulkCreateHashTagsBody_tags_inner::getTag() const
 void BulkCreateHashTagsBody_tags_inner::setTag(const utility::string_t& value)
 {
     m_Tag = value;
-    m_TagIsSet = true;
+    m_FieldsSet.set(FieldBit_Tag);
 }
 
 bool BulkCreateHashTagsBody_tags_inner::tagIsSet() const
 {
-    return m_TagIsSet;
+    return m_FieldsSet.test(FieldBit_Tag);
 }
 
 void BulkCreateHashTagsBody_tags_inner::unsetTag()
 {
-    m_TagIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tag);
 }
 
 }
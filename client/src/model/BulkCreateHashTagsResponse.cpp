@@ -20,8 +20,6 @@ namespace model {
 
 BulkCreateHashTagsResponse::BulkCreateHashTagsResponse()
 {
-    m_StatusIsSet = false;
-    m_ResultsIsSet = false;
 }
 
 BulkCreateHashTagsResponse::~BulkCreateHashTagsResponse()
@@ -36,12 +34,12 @@ void BulkCreateHashTagsResponse::validate()
 web::json::value BulkCreateHashTagsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_Results))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("results"))] = ModelBase::toJson(m_Results);
@@ -50,32 +48,119 @@ web::json::value BulkCreateHashTagsResponse::toJson() const
     return val;
 }
 
+void BulkCreateHashTagsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Results))
+    {
+        
+        writer.key(_XPLATSTR("results"));
+        ModelBase::writeJson(writer, m_Results);
+    }
+
+    writer.endObject();
+}
+
 bool BulkCreateHashTagsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("results")):
+            if(field.first == _XPLATSTR("results"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<BulkCreateHashTagsResponse_results_inner>> refVal_setResults;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setResults);
+                    setResults(refVal_setResults);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("results"))))
+    return ok;
+}
+
+void BulkCreateHashTagsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("results")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Results))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("results")), m_Results);
+    }
+}
+
+bool BulkCreateHashTagsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<BulkCreateHashTagsResponse_results_inner>> refVal_setResults;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setResults);
-            setResults(refVal_setResults);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("results")):
+            {
+                std::vector<std::shared_ptr<BulkCreateHashTagsResponse_results_inner>> refVal_setResults;
+                if(!ModelBase::readBinary(reader, field, refVal_setResults))
+                {
+                    ok = false;
+                    continue;
+                }
+                setResults(refVal_setResults);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BulkCreateHashTagsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void BulkCreateHashTagsResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_Results))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("results")), m_Results));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> BulkCreateHashTagsResponse::getStatus() const
 void BulkCreateHashTagsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool BulkCreateHashTagsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void BulkCreateHashTagsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<BulkCreateHashTagsResponse_results_inner>> BulkCreateHashTagsResponse::getResults() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<BulkCreateHashTagsResponse_results_inner>> BulkCreat
 void BulkCreateHashTagsResponse::setResults(const std::vector<std::shared_ptr<BulkCreateHashTagsResponse_results_inner>>& value)
 {
     m_Results = value;
-    m_ResultsIsSet = true;
+    m_FieldsSet.set(FieldBit_Results);
 }
 
 bool BulkCreateHashTagsResponse::resultsIsSet() const
 {
-    return m_ResultsIsSet;
+    return m_FieldsSet.test(FieldBit_Results);
 }
 
 void BulkCreateHashTagsResponse::unsetResults()
 {
-    m_ResultsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Results);
 }
 
 }
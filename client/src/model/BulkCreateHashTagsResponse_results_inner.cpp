@@ -20,21 +20,8 @@ namespace model {
 
 BulkCreateHashTagsResponse_results_inner::BulkCreateHashTagsResponse_results_inner()
 {
-    m_StatusIsSet = false;
-    m_HashTagIsSet = false;
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_SecondaryCode = utility::conversions::to_string_t("");
-    m_SecondaryCodeIsSet = false;
     m_BannedUntil = 0L;
-    m_BannedUntilIsSet = false;
     m_MaxCharacterLength = 0;
-    m_MaxCharacterLengthIsSet = false;
-    m_TranslatedError = utility::conversions::to_string_t("");
-    m_TranslatedErrorIsSet = false;
-    m_CustomConfigIsSet = false;
 }
 
 BulkCreateHashTagsResponse_results_inner::~BulkCreateHashTagsResponse_results_inner()
@@ -49,47 +36,47 @@ void BulkCreateHashTagsResponse_results_inner::validate()
 web::json::value BulkCreateHashTagsResponse_results_inner::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_HashTagIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTag"))] = ModelBase::toJson(m_HashTag);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_SecondaryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("secondaryCode"))] = ModelBase::toJson(m_SecondaryCode);
     }
-    if(m_BannedUntilIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))] = ModelBase::toJson(m_BannedUntil);
     }
-    if(m_MaxCharacterLengthIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength"))] = ModelBase::toJson(m_MaxCharacterLength);
     }
-    if(m_TranslatedErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translatedError"))] = ModelBase::toJson(m_TranslatedError);
     }
-    if(m_CustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("customConfig"))] = ModelBase::toJson(m_CustomConfig);
@@ -98,109 +85,357 @@ web::json::value BulkCreateHashTagsResponse_results_inner::toJson() const
     return val;
 }
 
+void BulkCreateHashTagsResponse_results_inner::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTag))
+    {
+        
+        writer.key(_XPLATSTR("hashTag"));
+        ModelBase::writeJson(writer, m_HashTag);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
+    {
+        
+        writer.key(_XPLATSTR("secondaryCode"));
+        ModelBase::writeJson(writer, m_SecondaryCode);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
+    {
+        
+        writer.key(_XPLATSTR("bannedUntil"));
+        ModelBase::writeJson(writer, m_BannedUntil);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
+    {
+        
+        writer.key(_XPLATSTR("maxCharacterLength"));
+        ModelBase::writeJson(writer, m_MaxCharacterLength);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
+    {
+        
+        writer.key(_XPLATSTR("translatedError"));
+        ModelBase::writeJson(writer, m_TranslatedError);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
+    {
+        
+        writer.key(_XPLATSTR("customConfig"));
+        ModelBase::writeJson(writer, m_CustomConfig);
+    }
+
+    writer.endObject();
+}
+
 bool BulkCreateHashTagsResponse_results_inner::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTag"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTag")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<TenantHashTag> refVal_setHashTag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTag);
-            setHashTag(refVal_setHashTag);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTag")):
+            if(field.first == _XPLATSTR("hashTag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<TenantHashTag> refVal_setHashTag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTag);
+                    setHashTag(refVal_setHashTag);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("secondaryCode")):
+            if(field.first == _XPLATSTR("secondaryCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSecondaryCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSecondaryCode);
+                    setSecondaryCode(refVal_setSecondaryCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            if(field.first == _XPLATSTR("bannedUntil"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setBannedUntil;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
+                    setBannedUntil(refVal_setBannedUntil);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxCharacterLength")):
+            if(field.first == _XPLATSTR("maxCharacterLength"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setMaxCharacterLength;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCharacterLength);
+                    setMaxCharacterLength(refVal_setMaxCharacterLength);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translatedError")):
+            if(field.first == _XPLATSTR("translatedError"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTranslatedError;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslatedError);
+                    setTranslatedError(refVal_setTranslatedError);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("customConfig")):
+            if(field.first == _XPLATSTR("customConfig"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCustomConfig);
+                    setCustomConfig(refVal_setCustomConfig);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    return ok;
+}
+
+void BulkCreateHashTagsResponse_results_inner::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    if(m_FieldsSet.test(FieldBit_HashTag))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTag")), m_HashTag);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("secondaryCode"))))
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("secondaryCode")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSecondaryCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSecondaryCode);
-            setSecondaryCode(refVal_setSecondaryCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))))
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedUntil")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setBannedUntil;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
-            setBannedUntil(refVal_setBannedUntil);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength"))))
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setMaxCharacterLength;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCharacterLength);
-            setMaxCharacterLength(refVal_setMaxCharacterLength);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("secondaryCode")), m_SecondaryCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translatedError"))))
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translatedError")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTranslatedError;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslatedError);
-            setTranslatedError(refVal_setTranslatedError);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedUntil")), m_BannedUntil);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxCharacterLength")), m_MaxCharacterLength);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translatedError")), m_TranslatedError);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("customConfig"))))
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("customConfig")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("customConfig")), m_CustomConfig);
+    }
+}
+
+bool BulkCreateHashTagsResponse_results_inner::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCustomConfig);
-            setCustomConfig(refVal_setCustomConfig);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTag")):
+            {
+                std::shared_ptr<TenantHashTag> refVal_setHashTag;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTag(refVal_setHashTag);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("secondaryCode")):
+            {
+                utility::string_t refVal_setSecondaryCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setSecondaryCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSecondaryCode(refVal_setSecondaryCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            {
+                int64_t refVal_setBannedUntil;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedUntil))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedUntil(refVal_setBannedUntil);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxCharacterLength")):
+            {
+                int32_t refVal_setMaxCharacterLength;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxCharacterLength))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxCharacterLength(refVal_setMaxCharacterLength);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translatedError")):
+            {
+                utility::string_t refVal_setTranslatedError;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslatedError))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslatedError(refVal_setTranslatedError);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("customConfig")):
+            {
+                std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
+                if(!ModelBase::readBinary(reader, field, refVal_setCustomConfig))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCustomConfig(refVal_setCustomConfig);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BulkCreateHashTagsResponse_results_inner::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -210,39 +445,39 @@ void BulkCreateHashTagsResponse_results_inner::toMultipart(std::shared_ptr<Multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_HashTagIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTag")), m_HashTag));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_SecondaryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("secondaryCode")), m_SecondaryCode));
     }
-    if(m_BannedUntilIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedUntil")), m_BannedUntil));
     }
-    if(m_MaxCharacterLengthIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength")), m_MaxCharacterLength));
     }
-    if(m_TranslatedErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translatedError")), m_TranslatedError));
     }
-    if(m_CustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customConfig")), m_CustomConfig));
     }
@@ -324,17 +559,17 @@ std::shared_ptr<APIStatus> BulkCreateHashTagsResponse_results_inner::getStatus()
 void BulkCreateHashTagsResponse_results_inner::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<TenantHashTag> BulkCreateHashTagsResponse_results_inner::getHashTag() const
 {
@@ -345,17 +580,17 @@ std::shared_ptr<TenantHashTag> BulkCreateHashTagsResponse_results_inner::getHash
 void BulkCreateHashTagsResponse_results_inner::setHashTag(const std::shared_ptr<TenantHashTag>& value)
 {
     m_HashTag = value;
-    m_HashTagIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTag);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::hashTagIsSet() const
 {
-    return m_HashTagIsSet;
+    return m_FieldsSet.test(FieldBit_HashTag);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetHashTag()
 {
-    m_HashTagIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTag);
 }
 utility::string_t BulkCreateHashTagsResponse_results_inner::getReason() const
 {
@@ -366,17 +601,17 @@ utility::string_t BulkCreateHashTagsResponse_results_inner::getReason() const
 void BulkCreateHashTagsResponse_results_inner::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t BulkCreateHashTagsResponse_results_inner::getCode() const
 {
@@ -387,17 +622,17 @@ utility::string_t BulkCreateHashTagsResponse_results_inner::getCode() const
 void BulkCreateHashTagsResponse_results_inner::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 utility::string_t BulkCreateHashTagsResponse_results_inner::getSecondaryCode() const
 {
@@ -408,17 +643,17 @@ utility::string_t BulkCreateHashTagsResponse_results_inner::getSecondaryCode() c
 void BulkCreateHashTagsResponse_results_inner::setSecondaryCode(const utility::string_t& value)
 {
     m_SecondaryCode = value;
-    m_SecondaryCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_SecondaryCode);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::secondaryCodeIsSet() const
 {
-    return m_SecondaryCodeIsSet;
+    return m_FieldsSet.test(FieldBit_SecondaryCode);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetSecondaryCode()
 {
-    m_SecondaryCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_SecondaryCode);
 }
 int64_t BulkCreateHashTagsResponse_results_inner::getBannedUntil() const
 {
@@ -428,17 +663,17 @@ int64_t BulkCreateHashTagsResponse_results_inner::getBannedUntil() const
 void BulkCreateHashTagsResponse_results_inner::setBannedUntil(int64_t value)
 {
     m_BannedUntil = value;
-    m_BannedUntilIsSet = true;
+    m_FieldsSet.set(FieldBit_BannedUntil);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::bannedUntilIsSet() const
 {
-    return m_BannedUntilIsSet;
+    return m_FieldsSet.test(FieldBit_BannedUntil);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetBannedUntil()
 {
-    m_BannedUntilIsSet = false;
+    m_FieldsSet.reset(FieldBit_BannedUntil);
 }
 int32_t BulkCreateHashTagsResponse_results_inner::getMaxCharacterLength() const
 {
@@ -448,17 +683,17 @@ int32_t BulkCreateHashTagsResponse_results_inner::getMaxCharacterLength() const
 void BulkCreateHashTagsResponse_results_inner::setMaxCharacterLength(int32_t value)
 {
     m_MaxCharacterLength = value;
-    m_MaxCharacterLengthIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxCharacterLength);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::maxCharacterLengthIsSet() const
 {
-    return m_MaxCharacterLengthIsSet;
+    return m_FieldsSet.test(FieldBit_MaxCharacterLength);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetMaxCharacterLength()
 {
-    m_MaxCharacterLengthIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxCharacterLength);
 }
 utility::string_t BulkCreateHashTagsResponse_results_inner::getTranslatedError() const
 {
@@ -469,17 +704,17 @@ utility::string_t BulkCreateHashTagsResponse_results_inner::getTranslatedError()
 void BulkCreateHashTagsResponse_results_inner::setTranslatedError(const utility::string_t& value)
 {
     m_TranslatedError = value;
-    m_TranslatedErrorIsSet = true;
+    m_FieldsSet.set(FieldBit_TranslatedError);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::translatedErrorIsSet() const
 {
-    return m_TranslatedErrorIsSet;
+    return m_FieldsSet.test(FieldBit_TranslatedError);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetTranslatedError()
 {
-    m_TranslatedErrorIsSet = false;
+    m_FieldsSet.reset(FieldBit_TranslatedError);
 }
 std::shared_ptr<CustomConfigParameters> BulkCreateHashTagsResponse_results_inner::getCustomConfig() const
 {
@@ -490,17 +725,17 @@ std::shared_ptr<CustomConfigParameters> BulkCreateHashTagsResponse_results_inner
 void BulkCreateHashTagsResponse_results_inner::setCustomConfig(const std::shared_ptr<CustomConfigParameters>& value)
 {
     m_CustomConfig = value;
-    m_CustomConfigIsSet = true;
+    m_FieldsSet.set(FieldBit_CustomConfig);
 }
 
 bool BulkCreateHashTagsResponse_results_inner::customConfigIsSet() const
 {
-    return m_CustomConfigIsSet;
+    return m_FieldsSet.test(FieldBit_CustomConfig);
 }
 
 void BulkCreateHashTagsResponse_results_inner::unsetCustomConfig()
 {
-    m_CustomConfigIsSet = false;
+    m_FieldsSet.reset(FieldBit_CustomConfig);
 }
 
 }
@@ -20,7 +20,6 @@ namespace model {
 
 BulkPreBanParams::BulkPreBanParams()
 {
-    m_CommentIdsIsSet = false;
 }
 
 BulkPreBanParams::~BulkPreBanParams()
@@ -35,7 +34,7 @@ void BulkPreBanParams::validate()
 web::json::value BulkPreBanParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentIds"))] = ModelBase::toJson(m_CommentIds);
@@ -44,23 +43,87 @@ web::json::value BulkPreBanParams::toJson() const
     return val;
 }
 
+void BulkPreBanParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommentIds))
+    {
+        
+        writer.key(_XPLATSTR("commentIds"));
+        ModelBase::writeJson(writer, m_CommentIds);
+    }
+
+    writer.endObject();
+}
+
 bool BulkPreBanParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentIds"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentIds")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setCommentIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIds);
-            setCommentIds(refVal_setCommentIds);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commentIds")):
+            if(field.first == _XPLATSTR("commentIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setCommentIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIds);
+                    setCommentIds(refVal_setCommentIds);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void BulkPreBanParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommentIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentIds")), m_CommentIds);
+    }
+}
+
+bool BulkPreBanParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("commentIds")):
+            {
+                std::vector<utility::string_t> refVal_setCommentIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentIds(refVal_setCommentIds);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void BulkPreBanParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void BulkPreBanParams::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentIds")), m_CommentIds));
     }
@@ -102,17 +165,17 @@ std::vector<utility::string_t> BulkPreBanParams::getCommentIds() const
 void BulkPreBanParams::setCommentIds(const std::vector<utility::string_t>& value)
 {
     m_CommentIds = value;
-    m_CommentIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentIds);
 }
 
 bool BulkPreBanParams::commentIdsIsSet() const
 {
-    return m_CommentIdsIsSet;
+    return m_FieldsSet.test(FieldBit_CommentIds);
 }
 
 void BulkPreBanParams::unsetCommentIds()
 {
-    m_CommentIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentIds);
 }
 
 }
@@ -20,14 +20,7 @@ namespace model {
 
 BulkPreBanSummary::BulkPreBanSummary()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
     m_TotalRelatedCommentCount = 0;
-    m_TotalRelatedCommentCountIsSet = false;
-    m_EmailDomainsIsSet = false;
-    m_EmailsIsSet = false;
-    m_UserIdsIsSet = false;
-    m_IpHashesIsSet = false;
 }
 
 BulkPreBanSummary::~BulkPreBanSummary()
@@ -42,32 +35,32 @@ void BulkPreBanSummary::validate()
 web::json::value BulkPreBanSummary::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TotalRelatedCommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_TotalRelatedCommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("totalRelatedCommentCount"))] = ModelBase::toJson(m_TotalRelatedCommentCount);
     }
-    if(m_EmailDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailDomains))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailDomains"))] = ModelBase::toJson(m_EmailDomains);
     }
-    if(m_EmailsIsSet)
+    if(m_FieldsSet.test(FieldBit_Emails))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emails"))] = ModelBase::toJson(m_Emails);
     }
-    if(m_UserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userIds"))] = ModelBase::toJson(m_UserIds);
     }
-    if(m_IpHashesIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHashes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ipHashes"))] = ModelBase::toJson(m_IpHashes);
@@ -76,76 +69,255 @@ web::json::value BulkPreBanSummary::toJson() const
     return val;
 }
 
+void BulkPreBanSummary::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TotalRelatedCommentCount))
+    {
+        
+        writer.key(_XPLATSTR("totalRelatedCommentCount"));
+        ModelBase::writeJson(writer, m_TotalRelatedCommentCount);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailDomains))
+    {
+        
+        writer.key(_XPLATSTR("emailDomains"));
+        ModelBase::writeJson(writer, m_EmailDomains);
+    }
+    if(m_FieldsSet.test(FieldBit_Emails))
+    {
+        
+        writer.key(_XPLATSTR("emails"));
+        ModelBase::writeJson(writer, m_Emails);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIds))
+    {
+        
+        writer.key(_XPLATSTR("userIds"));
+        ModelBase::writeJson(writer, m_UserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHashes))
+    {
+        
+        writer.key(_XPLATSTR("ipHashes"));
+        ModelBase::writeJson(writer, m_IpHashes);
+    }
+
+    writer.endObject();
+}
+
 bool BulkPreBanSummary::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("totalRelatedCommentCount"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("totalRelatedCommentCount")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int32_t refVal_setTotalRelatedCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTotalRelatedCommentCount);
-            setTotalRelatedCommentCount(refVal_setTotalRelatedCommentCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("totalRelatedCommentCount")):
+            if(field.first == _XPLATSTR("totalRelatedCommentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setTotalRelatedCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTotalRelatedCommentCount);
+                    setTotalRelatedCommentCount(refVal_setTotalRelatedCommentCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailDomains")):
+            if(field.first == _XPLATSTR("emailDomains"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setEmailDomains;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailDomains);
+                    setEmailDomains(refVal_setEmailDomains);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emails")):
+            if(field.first == _XPLATSTR("emails"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setEmails;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmails);
+                    setEmails(refVal_setEmails);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userIds")):
+            if(field.first == _XPLATSTR("userIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setUserIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserIds);
+                    setUserIds(refVal_setUserIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ipHashes")):
+            if(field.first == _XPLATSTR("ipHashes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setIpHashes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIpHashes);
+                    setIpHashes(refVal_setIpHashes);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailDomains"))))
+    return ok;
+}
+
+void BulkPreBanSummary::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailDomains")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setEmailDomains;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailDomains);
-            setEmailDomains(refVal_setEmailDomains);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emails"))))
+    if(m_FieldsSet.test(FieldBit_TotalRelatedCommentCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emails")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setEmails;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmails);
-            setEmails(refVal_setEmails);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("totalRelatedCommentCount")), m_TotalRelatedCommentCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userIds"))))
+    if(m_FieldsSet.test(FieldBit_EmailDomains))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setUserIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserIds);
-            setUserIds(refVal_setUserIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailDomains")), m_EmailDomains);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ipHashes"))))
+    if(m_FieldsSet.test(FieldBit_Emails))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ipHashes")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emails")), m_Emails);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userIds")), m_UserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHashes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ipHashes")), m_IpHashes);
+    }
+}
+
+bool BulkPreBanSummary::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<utility::string_t> refVal_setIpHashes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIpHashes);
-            setIpHashes(refVal_setIpHashes);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("totalRelatedCommentCount")):
+            {
+                int32_t refVal_setTotalRelatedCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setTotalRelatedCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTotalRelatedCommentCount(refVal_setTotalRelatedCommentCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailDomains")):
+            {
+                std::vector<utility::string_t> refVal_setEmailDomains;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailDomains))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailDomains(refVal_setEmailDomains);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emails")):
+            {
+                std::vector<utility::string_t> refVal_setEmails;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmails))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmails(refVal_setEmails);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userIds")):
+            {
+                std::vector<utility::string_t> refVal_setUserIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserIds(refVal_setUserIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ipHashes")):
+            {
+                std::vector<utility::string_t> refVal_setIpHashes;
+                if(!ModelBase::readBinary(reader, field, refVal_setIpHashes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIpHashes(refVal_setIpHashes);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void BulkPreBanSummary::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -155,27 +327,27 @@ void BulkPreBanSummary::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TotalRelatedCommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_TotalRelatedCommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("totalRelatedCommentCount")), m_TotalRelatedCommentCount));
     }
-    if(m_EmailDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailDomains))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailDomains")), m_EmailDomains));
     }
-    if(m_EmailsIsSet)
+    if(m_FieldsSet.test(FieldBit_Emails))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emails")), m_Emails));
     }
-    if(m_UserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userIds")), m_UserIds));
     }
-    if(m_IpHashesIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHashes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHashes")), m_IpHashes));
     }
@@ -239,17 +411,17 @@ utility::string_t BulkPreBanSummary::getStatus() const
 void BulkPreBanSummary::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool BulkPreBanSummary::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void BulkPreBanSummary::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 int32_t BulkPreBanSummary::getTotalRelatedCommentCount() const
 {
@@ -259,17 +431,17 @@ int32_t BulkPreBanSummary::getTotalRelatedCommentCount() const
 void BulkPreBanSummary::setTotalRelatedCommentCount(int32_t value)
 {
     m_TotalRelatedCommentCount = value;
-    m_TotalRelatedCommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_TotalRelatedCommentCount);
 }
 
 bool BulkPreBanSummary::totalRelatedCommentCountIsSet() const
 {
-    return m_TotalRelatedCommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_TotalRelatedCommentCount);
 }
 
 void BulkPreBanSummary::unsetTotalRelatedCommentCount()
 {
-    m_TotalRelatedCommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_TotalRelatedCommentCount);
 }
 std::vector<utility::string_t> BulkPreBanSummary::getEmailDomains() const
 {
@@ -280,17 +452,17 @@ std::vector<utility::string_t> BulkPreBanSummary::getEmailDomains() const
 void BulkPreBanSummary::setEmailDomains(const std::vector<utility::string_t>& value)
 {
     m_EmailDomains = value;
-    m_EmailDomainsIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailDomains);
 }
 
 bool BulkPreBanSummary::emailDomainsIsSet() const
 {
-    return m_EmailDomainsIsSet;
+    return m_FieldsSet.test(FieldBit_EmailDomains);
 }
 
 void BulkPreBanSummary::unsetEmailDomains()
 {
-    m_EmailDomainsIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailDomains);
 }
 std::vector<utility::string_t> BulkPreBanSummary::getEmails() const
 {
@@ -301,17 +473,17 @@ std::vector<utility::string_t> BulkPreBanSummary::getEmails() const
 void BulkPreBanSummary::setEmails(const std::vector<utility::string_t>& value)
 {
     m_Emails = value;
-    m_EmailsIsSet = true;
+    m_FieldsSet.set(FieldBit_Emails);
 }
 
 bool BulkPreBanSummary::emailsIsSet() const
 {
-    return m_EmailsIsSet;
+    return m_FieldsSet.test(FieldBit_Emails);
 }
 
 void BulkPreBanSummary::unsetEmails()
 {
-    m_EmailsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Emails);
 }
 std::vector<utility::string_t> BulkPreBanSummary::getUserIds() const
 {
@@ -322,17 +494,17 @@ std::vector<utility::string_t> BulkPreBanSummary::getUserIds() const
 void BulkPreBanSummary::setUserIds(const std::vector<utility::string_t>& value)
 {
     m_UserIds = value;
-    m_UserIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_UserIds);
 }
 
 bool BulkPreBanSummary::userIdsIsSet() const
 {
-    return m_UserIdsIsSet;
+    return m_FieldsSet.test(FieldBit_UserIds);
 }
 
 void BulkPreBanSummary::unsetUserIds()
 {
-    m_UserIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserIds);
 }
 std::vector<utility::string_t> BulkPreBanSummary::getIpHashes() const
 {
@@ -343,17 +515,17 @@ std::vector<utility::string_t> BulkPreBanSummary::getIpHashes() const
 void BulkPreBanSummary::setIpHashes(const std::vector<utility::string_t>& value)
 {
     m_IpHashes = value;
-    m_IpHashesIsSet = true;
+    m_FieldsSet.set(FieldBit_IpHashes);
 }
 
 bool BulkPreBanSummary::ipHashesIsSet() const
 {
-    return m_IpHashesIsSet;
+    return m_FieldsSet.test(FieldBit_IpHashes);
 }
 
 void BulkPreBanSummary::unsetIpHashes()
 {
-    m_IpHashesIsSet = false;
+    m_FieldsSet.reset(FieldBit_IpHashes);
 }
 
 }
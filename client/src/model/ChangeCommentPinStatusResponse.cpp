@@ -20,8 +20,6 @@ namespace model {
 
 ChangeCommentPinStatusResponse::ChangeCommentPinStatusResponse()
 {
-    m_CommentPositionsIsSet = false;
-    m_StatusIsSet = false;
 }
 
 ChangeCommentPinStatusResponse::~ChangeCommentPinStatusResponse()
@@ -36,12 +34,12 @@ void ChangeCommentPinStatusResponse::validate()
 web::json::value ChangeCommentPinStatusResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentPositionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentPositions"))] = ModelBase::toJson(m_CommentPositions);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value ChangeCommentPinStatusResponse::toJson() const
     return val;
 }
 
+void ChangeCommentPinStatusResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
+    {
+        
+        writer.key(_XPLATSTR("commentPositions"));
+        ModelBase::writeJson(writer, m_CommentPositions);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool ChangeCommentPinStatusResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentPositions"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentPositions")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> refVal_setCommentPositions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentPositions);
-            setCommentPositions(refVal_setCommentPositions);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commentPositions")):
+            if(field.first == _XPLATSTR("commentPositions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> refVal_setCommentPositions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentPositions);
+                    setCommentPositions(refVal_setCommentPositions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void ChangeCommentPinStatusResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentPositions")), m_CommentPositions);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool ChangeCommentPinStatusResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commentPositions")):
+            {
+                std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> refVal_setCommentPositions;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentPositions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentPositions(refVal_setCommentPositions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ChangeCommentPinStatusResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void ChangeCommentPinStatusResponse::toMultipart(std::shared_ptr<MultipartFormDa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentPositionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentPositions")), m_CommentPositions));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null
 void ChangeCommentPinStatusResponse::setCommentPositions(const std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>>& value)
 {
     m_CommentPositions = value;
-    m_CommentPositionsIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentPositions);
 }
 
 bool ChangeCommentPinStatusResponse::commentPositionsIsSet() const
 {
-    return m_CommentPositionsIsSet;
+    return m_FieldsSet.test(FieldBit_CommentPositions);
 }
 
 void ChangeCommentPinStatusResponse::unsetCommentPositions()
 {
-    m_CommentPositionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentPositions);
 }
 std::shared_ptr<APIStatus> ChangeCommentPinStatusResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> ChangeCommentPinStatusResponse::getStatus() const
 void ChangeCommentPinStatusResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ChangeCommentPinStatusResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ChangeCommentPinStatusResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -21,7 +21,6 @@ namespace model {
 ChangeTicketStateBody::ChangeTicketStateBody()
 {
     m_State = 0;
-    m_StateIsSet = false;
 }
 
 ChangeTicketStateBody::~ChangeTicketStateBody()
@@ -36,7 +35,7 @@ void ChangeTicketStateBody::validate()
 web::json::value ChangeTicketStateBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("state"))] = ModelBase::toJson(m_State);
@@ -45,23 +44,87 @@ web::json::value ChangeTicketStateBody::toJson() const
     return val;
 }
 
+void ChangeTicketStateBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_State))
+    {
+        
+        writer.key(_XPLATSTR("state"));
+        ModelBase::writeJson(writer, m_State);
+    }
+
+    writer.endObject();
+}
+
 bool ChangeTicketStateBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("state"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("state")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int32_t refVal_setState;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setState);
-            setState(refVal_setState);
-            
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            if(field.first == _XPLATSTR("state"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setState;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setState);
+                    setState(refVal_setState);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void ChangeTicketStateBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_State))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("state")), m_State);
+    }
+}
+
+bool ChangeTicketStateBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("state")):
+            {
+                int32_t refVal_setState;
+                if(!ModelBase::readBinary(reader, field, refVal_setState))
+                {
+                    ok = false;
+                    continue;
+                }
+                setState(refVal_setState);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void ChangeTicketStateBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -69,7 +132,7 @@ void ChangeTicketStateBody::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StateIsSet)
+    if(m_FieldsSet.test(FieldBit_State))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("state")), m_State));
     }
@@ -102,17 +165,17 @@ int32_t ChangeTicketStateBody::getState() const
 void ChangeTicketStateBody::setState(int32_t value)
 {
     m_State = value;
-    m_StateIsSet = true;
+    m_FieldsSet.set(FieldBit_State);
 }
 
 bool ChangeTicketStateBody::stateIsSet() const
 {
-    return m_StateIsSet;
+    return m_FieldsSet.test(FieldBit_State);
 }
 
 void ChangeTicketStateBody::unsetState()
 {
-    m_StateIsSet = false;
+    m_FieldsSet.reset(FieldBit_State);
 }
 
 }
@@ -21,41 +21,13 @@ namespace model {
 CommentData::CommentData()
 {
     m_date = 0L;
-    m_dateIsSet = false;
-    m_LocalDateString = utility::conversions::to_string_t("");
-    m_LocalDateStringIsSet = false;
     m_LocalDateHours = 0;
-    m_LocalDateHoursIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_Comment = utility::conversions::to_string_t("");
-    m_CommentIsSet = false;
     m_ProductId = 0;
-    m_ProductIdIsSet = false;
-    m_MentionsIsSet = false;
-    m_HashTagsIsSet = false;
-    m_PageTitle = utility::conversions::to_string_t("");
-    m_PageTitleIsSet = false;
     m_IsFromMyAccountPage = false;
-    m_IsFromMyAccountPageIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_MetaIsSet = false;
-    m_ModerationGroupIdsIsSet = false;
     m_Rating = 0.0;
-    m_RatingIsSet = false;
     m_FromOfflineRestore = false;
-    m_FromOfflineRestoreIsSet = false;
     m_AutoplayDelayMS = 0L;
-    m_AutoplayDelayMSIsSet = false;
-    m_FeedbackIdsIsSet = false;
-    m_QuestionValuesIsSet = false;
     m_Tos = false;
-    m_TosIsSet = false;
-    m_BotId = utility::conversions::to_string_t("");
-    m_BotIdIsSet = false;
 }
 
 CommentData::~CommentData()
@@ -70,132 +42,132 @@ void CommentData::validate()
 web::json::value CommentData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
     }
-    if(m_LocalDateStringIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString);
     }
-    if(m_LocalDateHoursIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("localDateHours"))] = ModelBase::toJson(m_LocalDateHours);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail);
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_ProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ProductId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("productId"))] = ModelBase::toJson(m_ProductId);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId);
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("mentions"))] = ModelBase::toJson(m_Mentions);
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTags"))] = ModelBase::toJson(m_HashTags);
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_IsFromMyAccountPageIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage"))] = ModelBase::toJson(m_IsFromMyAccountPage);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds);
     }
-    if(m_RatingIsSet)
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating);
     }
-    if(m_FromOfflineRestoreIsSet)
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore"))] = ModelBase::toJson(m_FromOfflineRestore);
     }
-    if(m_AutoplayDelayMSIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS"))] = ModelBase::toJson(m_AutoplayDelayMS);
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))] = ModelBase::toJson(m_FeedbackIds);
     }
-    if(m_QuestionValuesIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionValues"))] = ModelBase::toJson(m_QuestionValues);
     }
-    if(m_TosIsSet)
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tos"))] = ModelBase::toJson(m_Tos);
     }
-    if(m_BotIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BotId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("botId"))] = ModelBase::toJson(m_BotId);
@@ -204,296 +176,935 @@ web::json::value CommentData::toJson() const
     return val;
 }
 
+void CommentData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
+    {
+        
+        writer.key(_XPLATSTR("localDateString"));
+        ModelBase::writeJson(writer, m_LocalDateString);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
+    {
+        
+        writer.key(_XPLATSTR("localDateHours"));
+        ModelBase::writeJson(writer, m_LocalDateHours);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
+    {
+        
+        writer.key(_XPLATSTR("commenterEmail"));
+        ModelBase::writeJson(writer, m_CommenterEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
+    {
+        
+        writer.key(_XPLATSTR("commenterLink"));
+        ModelBase::writeJson(writer, m_CommenterLink);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_ProductId))
+    {
+        
+        writer.key(_XPLATSTR("productId"));
+        ModelBase::writeJson(writer, m_ProductId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_ParentId))
+    {
+        
+        writer.key(_XPLATSTR("parentId"));
+        ModelBase::writeJson(writer, m_ParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Mentions))
+    {
+        
+        writer.key(_XPLATSTR("mentions"));
+        ModelBase::writeJson(writer, m_Mentions);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTags))
+    {
+        
+        writer.key(_XPLATSTR("hashTags"));
+        ModelBase::writeJson(writer, m_HashTags);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
+    {
+        
+        writer.key(_XPLATSTR("isFromMyAccountPage"));
+        ModelBase::writeJson(writer, m_IsFromMyAccountPage);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("moderationGroupIds"));
+        ModelBase::writeJson(writer, m_ModerationGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Rating))
+    {
+        
+        writer.key(_XPLATSTR("rating"));
+        ModelBase::writeJson(writer, m_Rating);
+    }
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
+    {
+        
+        writer.key(_XPLATSTR("fromOfflineRestore"));
+        ModelBase::writeJson(writer, m_FromOfflineRestore);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
+    {
+        
+        writer.key(_XPLATSTR("autoplayDelayMS"));
+        ModelBase::writeJson(writer, m_AutoplayDelayMS);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        writer.key(_XPLATSTR("feedbackIds"));
+        ModelBase::writeJson(writer, m_FeedbackIds);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
+    {
+        
+        writer.key(_XPLATSTR("questionValues"));
+        ModelBase::writeJson(writer, m_QuestionValues);
+    }
+    if(m_FieldsSet.test(FieldBit_Tos))
+    {
+        
+        writer.key(_XPLATSTR("tos"));
+        ModelBase::writeJson(writer, m_Tos);
+    }
+    if(m_FieldsSet.test(FieldBit_BotId))
+    {
+        
+        writer.key(_XPLATSTR("botId"));
+        ModelBase::writeJson(writer, m_BotId);
+    }
+
+    writer.endObject();
+}
+
 bool CommentData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateString"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateString")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setLocalDateString;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
-            setLocalDateString(refVal_setLocalDateString);
-            
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            if(field.first == _XPLATSTR("localDateString"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocalDateString;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
+                    setLocalDateString(refVal_setLocalDateString);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            if(field.first == _XPLATSTR("localDateHours"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setLocalDateHours;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
+                    setLocalDateHours(refVal_setLocalDateHours);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
+                    setCommenterName(refVal_setCommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            if(field.first == _XPLATSTR("commenterEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
+                    setCommenterEmail(refVal_setCommenterEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            if(field.first == _XPLATSTR("commenterLink"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterLink;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
+                    setCommenterLink(refVal_setCommenterLink);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("productId")):
+            if(field.first == _XPLATSTR("productId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setProductId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setProductId);
+                    setProductId(refVal_setProductId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            if(field.first == _XPLATSTR("parentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
+                    setParentId(refVal_setParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            if(field.first == _XPLATSTR("mentions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
+                    setMentions(refVal_setMentions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            if(field.first == _XPLATSTR("hashTags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
+                    setHashTags(refVal_setHashTags);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPageTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
+                    setPageTitle(refVal_setPageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isFromMyAccountPage")):
+            if(field.first == _XPLATSTR("isFromMyAccountPage"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsFromMyAccountPage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsFromMyAccountPage);
+                    setIsFromMyAccountPage(refVal_setIsFromMyAccountPage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            if(field.first == _XPLATSTR("moderationGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModerationGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
+                    setModerationGroupIds(refVal_setModerationGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            if(field.first == _XPLATSTR("rating"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setRating;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
+                    setRating(refVal_setRating);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")):
+            if(field.first == _XPLATSTR("fromOfflineRestore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setFromOfflineRestore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromOfflineRestore);
+                    setFromOfflineRestore(refVal_setFromOfflineRestore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")):
+            if(field.first == _XPLATSTR("autoplayDelayMS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setAutoplayDelayMS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayDelayMS);
+                    setAutoplayDelayMS(refVal_setAutoplayDelayMS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            if(field.first == _XPLATSTR("feedbackIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
+                    setFeedbackIds(refVal_setFeedbackIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionValues")):
+            if(field.first == _XPLATSTR("questionValues"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> refVal_setQuestionValues;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionValues);
+                    setQuestionValues(refVal_setQuestionValues);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tos")):
+            if(field.first == _XPLATSTR("tos"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setTos;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTos);
+                    setTos(refVal_setTos);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("botId")):
+            if(field.first == _XPLATSTR("botId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBotId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBotId);
+                    setBotId(refVal_setBotId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateHours"))))
+    return ok;
+}
+
+void CommentData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateHours")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setLocalDateHours;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
-            setLocalDateHours(refVal_setLocalDateHours);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateString")), m_LocalDateString);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
-            setCommenterEmail(refVal_setCommenterEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateHours")), m_LocalDateHours);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterLink"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterLink")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterLink;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
-            setCommenterLink(refVal_setCommenterLink);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterEmail")), m_CommenterEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("productId"))))
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("productId")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setProductId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setProductId);
-            setProductId(refVal_setProductId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterLink")), m_CommenterLink);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_ProductId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("productId")), m_ProductId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("parentId"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("parentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
-            setParentId(refVal_setParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("mentions"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("mentions")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
-            setMentions(refVal_setMentions);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTags"))))
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTags")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
-            setHashTags(refVal_setHashTags);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("parentId")), m_ParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("mentions")), m_Mentions);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage"))))
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsFromMyAccountPage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsFromMyAccountPage);
-            setIsFromMyAccountPage(refVal_setIsFromMyAccountPage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTags")), m_HashTags);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isFromMyAccountPage")), m_IsFromMyAccountPage);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<Object> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModerationGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
-            setModerationGroupIds(refVal_setModerationGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rating"))))
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rating")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setRating;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
-            setRating(refVal_setRating);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore"))))
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setFromOfflineRestore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromOfflineRestore);
-            setFromOfflineRestore(refVal_setFromOfflineRestore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS"))))
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setAutoplayDelayMS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayDelayMS);
-            setAutoplayDelayMS(refVal_setAutoplayDelayMS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rating")), m_Rating);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))))
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
-            setFeedbackIds(refVal_setFeedbackIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")), m_FromOfflineRestore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionValues"))))
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionValues")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> refVal_setQuestionValues;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionValues);
-            setQuestionValues(refVal_setQuestionValues);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")), m_AutoplayDelayMS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tos"))))
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tos")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setTos;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTos);
-            setTos(refVal_setTos);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackIds")), m_FeedbackIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("botId"))))
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("botId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionValues")), m_QuestionValues);
+    }
+    if(m_FieldsSet.test(FieldBit_Tos))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tos")), m_Tos);
+    }
+    if(m_FieldsSet.test(FieldBit_BotId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("botId")), m_BotId);
+    }
+}
+
+bool CommentData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setBotId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBotId);
-            setBotId(refVal_setBotId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                int64_t refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            {
+                utility::string_t refVal_setLocalDateString;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateString))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateString(refVal_setLocalDateString);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            {
+                int32_t refVal_setLocalDateHours;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateHours))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateHours(refVal_setLocalDateHours);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                utility::string_t refVal_setCommenterName;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterName(refVal_setCommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            {
+                utility::string_t refVal_setCommenterEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterEmail(refVal_setCommenterEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            {
+                utility::string_t refVal_setCommenterLink;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterLink))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterLink(refVal_setCommenterLink);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                utility::string_t refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("productId")):
+            {
+                int32_t refVal_setProductId;
+                if(!ModelBase::readBinary(reader, field, refVal_setProductId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setProductId(refVal_setProductId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            {
+                utility::string_t refVal_setParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setParentId(refVal_setParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            {
+                std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                if(!ModelBase::readBinary(reader, field, refVal_setMentions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMentions(refVal_setMentions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            {
+                std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTags(refVal_setHashTags);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                utility::string_t refVal_setPageTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageTitle(refVal_setPageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isFromMyAccountPage")):
+            {
+                bool refVal_setIsFromMyAccountPage;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsFromMyAccountPage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsFromMyAccountPage(refVal_setIsFromMyAccountPage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::shared_ptr<Object> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setModerationGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationGroupIds(refVal_setModerationGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            {
+                double refVal_setRating;
+                if(!ModelBase::readBinary(reader, field, refVal_setRating))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRating(refVal_setRating);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")):
+            {
+                bool refVal_setFromOfflineRestore;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromOfflineRestore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromOfflineRestore(refVal_setFromOfflineRestore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")):
+            {
+                int64_t refVal_setAutoplayDelayMS;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoplayDelayMS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoplayDelayMS(refVal_setAutoplayDelayMS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackIds(refVal_setFeedbackIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionValues")):
+            {
+                std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> refVal_setQuestionValues;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionValues))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionValues(refVal_setQuestionValues);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tos")):
+            {
+                bool refVal_setTos;
+                if(!ModelBase::readBinary(reader, field, refVal_setTos))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTos(refVal_setTos);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("botId")):
+            {
+                utility::string_t refVal_setBotId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBotId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBotId(refVal_setBotId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CommentData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -503,107 +1114,107 @@ void CommentData::toMultipart(std::shared_ptr<MultipartFormData> multipart, cons
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
-    if(m_LocalDateStringIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString));
     }
-    if(m_LocalDateHoursIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateHours")), m_LocalDateHours));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail));
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_ProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ProductId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("productId")), m_ProductId));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId));
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("mentions")), m_Mentions));
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTags")), m_HashTags));
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_IsFromMyAccountPageIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage")), m_IsFromMyAccountPage));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds));
     }
-    if(m_RatingIsSet)
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating));
     }
-    if(m_FromOfflineRestoreIsSet)
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore")), m_FromOfflineRestore));
     }
-    if(m_AutoplayDelayMSIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS")), m_AutoplayDelayMS));
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackIds")), m_FeedbackIds));
     }
-    if(m_QuestionValuesIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionValues")), m_QuestionValues));
     }
-    if(m_TosIsSet)
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tos")), m_Tos));
     }
-    if(m_BotIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BotId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("botId")), m_BotId));
     }
@@ -786,17 +1397,17 @@ int64_t CommentData::getDate() const
 void CommentData::setDate(int64_t value)
 {
     m_date = value;
-    m_dateIsSet = true;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool CommentData::dateIsSet() const
 {
-    return m_dateIsSet;
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void CommentData::unsetdate()
 {
-    m_dateIsSet = false;
+    m_FieldsSet.reset(FieldBit_date);
 }
 utility::string_t CommentData::getLocalDateString() const
 {
@@ -807,17 +1418,17 @@ utility::string_t CommentData::getLocalDateString() const
 void CommentData::setLocalDateString(const utility::string_t& value)
 {
     m_LocalDateString = value;
-    m_LocalDateStringIsSet = true;
+    m_FieldsSet.set(FieldBit_LocalDateString);
 }
 
 bool CommentData::localDateStringIsSet() const
 {
-    return m_LocalDateStringIsSet;
+    return m_FieldsSet.test(FieldBit_LocalDateString);
 }
 
 void CommentData::unsetLocalDateString()
 {
-    m_LocalDateStringIsSet = false;
+    m_FieldsSet.reset(FieldBit_LocalDateString);
 }
 int32_t CommentData::getLocalDateHours() const
 {
@@ -827,17 +1438,17 @@ int32_t CommentData::getLocalDateHours() const
 void CommentData::setLocalDateHours(int32_t value)
 {
     m_LocalDateHours = value;
-    m_LocalDateHoursIsSet = true;
+    m_FieldsSet.set(FieldBit_LocalDateHours);
 }
 
 bool CommentData::localDateHoursIsSet() const
 {
-    return m_LocalDateHoursIsSet;
+    return m_FieldsSet.test(FieldBit_LocalDateHours);
 }
 
 void CommentData::unsetLocalDateHours()
 {
-    m_LocalDateHoursIsSet = false;
+    m_FieldsSet.reset(FieldBit_LocalDateHours);
 }
 utility::string_t CommentData::getCommenterName() const
 {
@@ -848,57 +1459,59 @@ utility::string_t CommentData::getCommenterName() const
 void CommentData::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool CommentData::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void CommentData::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::string_t CommentData::getCommenterEmail() const
 {
-    return m_CommenterEmail.get();
+    return m_CommenterEmail;
 }
 
 
 void CommentData::setCommenterEmail(const utility::string_t& value)
 {
     m_CommenterEmail = value;
+    m_FieldsSet.set(FieldBit_CommenterEmail);
 }
 
 bool CommentData::commenterEmailIsSet() const
 {
-    return m_CommenterEmail.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterEmail);
 }
 
 void CommentData::unsetCommenterEmail()
 {
-    m_CommenterEmail.reset();
+    m_FieldsSet.reset(FieldBit_CommenterEmail);
 }
 utility::string_t CommentData::getCommenterLink() const
 {
-    return m_CommenterLink.get();
+    return m_CommenterLink;
 }
 
 
 void CommentData::setCommenterLink(const utility::string_t& value)
 {
     m_CommenterLink = value;
+    m_FieldsSet.set(FieldBit_CommenterLink);
 }
 
 bool CommentData::commenterLinkIsSet() const
 {
-    return m_CommenterLink.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterLink);
 }
 
 void CommentData::unsetCommenterLink()
 {
-    m_CommenterLink.reset();
+    m_FieldsSet.reset(FieldBit_CommenterLink);
 }
 utility::string_t CommentData::getComment() const
 {
@@ -909,17 +1522,17 @@ utility::string_t CommentData::getComment() const
 void CommentData::setComment(const utility::string_t& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool CommentData::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void CommentData::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 int32_t CommentData::getProductId() const
 {
@@ -929,77 +1542,80 @@ int32_t CommentData::getProductId() const
 void CommentData::setProductId(int32_t value)
 {
     m_ProductId = value;
-    m_ProductIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ProductId);
 }
 
 bool CommentData::productIdIsSet() const
 {
-    return m_ProductIdIsSet;
+    return m_FieldsSet.test(FieldBit_ProductId);
 }
 
 void CommentData::unsetProductId()
 {
-    m_ProductIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ProductId);
 }
 utility::string_t CommentData::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void CommentData::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool CommentData::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void CommentData::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t CommentData::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void CommentData::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool CommentData::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void CommentData::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 utility::string_t CommentData::getParentId() const
 {
-    return m_ParentId.get();
+    return m_ParentId;
 }
 
 
 void CommentData::setParentId(const utility::string_t& value)
 {
     m_ParentId = value;
+    m_FieldsSet.set(FieldBit_ParentId);
 }
 
 bool CommentData::parentIdIsSet() const
 {
-    return m_ParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ParentId);
 }
 
 void CommentData::unsetParentId()
 {
-    m_ParentId.reset();
+    m_FieldsSet.reset(FieldBit_ParentId);
 }
 std::vector<std::shared_ptr<CommentUserMentionInfo>> CommentData::getMentions() const
 {
@@ -1010,17 +1626,17 @@ std::vector<std::shared_ptr<CommentUserMentionInfo>> CommentData::getMentions()
 void CommentData::setMentions(const std::vector<std::shared_ptr<CommentUserMentionInfo>>& value)
 {
     m_Mentions = value;
-    m_MentionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Mentions);
 }
 
 bool CommentData::mentionsIsSet() const
 {
-    return m_MentionsIsSet;
+    return m_FieldsSet.test(FieldBit_Mentions);
 }
 
 void CommentData::unsetMentions()
 {
-    m_MentionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Mentions);
 }
 std::vector<std::shared_ptr<CommentUserHashTagInfo>> CommentData::getHashTags() const
 {
@@ -1031,17 +1647,17 @@ std::vector<std::shared_ptr<CommentUserHashTagInfo>> CommentData::getHashTags()
 void CommentData::setHashTags(const std::vector<std::shared_ptr<CommentUserHashTagInfo>>& value)
 {
     m_HashTags = value;
-    m_HashTagsIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTags);
 }
 
 bool CommentData::hashTagsIsSet() const
 {
-    return m_HashTagsIsSet;
+    return m_FieldsSet.test(FieldBit_HashTags);
 }
 
 void CommentData::unsetHashTags()
 {
-    m_HashTagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTags);
 }
 utility::string_t CommentData::getPageTitle() const
 {
@@ -1052,17 +1668,17 @@ utility::string_t CommentData::getPageTitle() const
 void CommentData::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
-    m_PageTitleIsSet = true;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool CommentData::pageTitleIsSet() const
 {
-    return m_PageTitleIsSet;
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void CommentData::unsetPageTitle()
 {
-    m_PageTitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 bool CommentData::isIsFromMyAccountPage() const
 {
@@ -1072,17 +1688,17 @@ bool CommentData::isIsFromMyAccountPage() const
 void CommentData::setIsFromMyAccountPage(bool value)
 {
     m_IsFromMyAccountPage = value;
-    m_IsFromMyAccountPageIsSet = true;
+    m_FieldsSet.set(FieldBit_IsFromMyAccountPage);
 }
 
 bool CommentData::isFromMyAccountPageIsSet() const
 {
-    return m_IsFromMyAccountPageIsSet;
+    return m_FieldsSet.test(FieldBit_IsFromMyAccountPage);
 }
 
 void CommentData::unsetIsFromMyAccountPage()
 {
-    m_IsFromMyAccountPageIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsFromMyAccountPage);
 }
 utility::string_t CommentData::getUrl() const
 {
@@ -1093,17 +1709,17 @@ utility::string_t CommentData::getUrl() const
 void CommentData::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool CommentData::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void CommentData::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t CommentData::getUrlId() const
 {
@@ -1114,17 +1730,17 @@ utility::string_t CommentData::getUrlId() const
 void CommentData::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool CommentData::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void CommentData::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 std::shared_ptr<Object> CommentData::getMeta() const
 {
@@ -1135,17 +1751,17 @@ std::shared_ptr<Object> CommentData::getMeta() const
 void CommentData::setMeta(const std::shared_ptr<Object>& value)
 {
     m_Meta = value;
-    m_MetaIsSet = true;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool CommentData::metaIsSet() const
 {
-    return m_MetaIsSet;
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void CommentData::unsetMeta()
 {
-    m_MetaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 std::vector<utility::string_t> CommentData::getModerationGroupIds() const
 {
@@ -1156,17 +1772,17 @@ std::vector<utility::string_t> CommentData::getModerationGroupIds() const
 void CommentData::setModerationGroupIds(const std::vector<utility::string_t>& value)
 {
     m_ModerationGroupIds = value;
-    m_ModerationGroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ModerationGroupIds);
 }
 
 bool CommentData::moderationGroupIdsIsSet() const
 {
-    return m_ModerationGroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ModerationGroupIds);
 }
 
 void CommentData::unsetModerationGroupIds()
 {
-    m_ModerationGroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModerationGroupIds);
 }
 double CommentData::getRating() const
 {
@@ -1176,17 +1792,17 @@ double CommentData::getRating() const
 void CommentData::setRating(double value)
 {
     m_Rating = value;
-    m_RatingIsSet = true;
+    m_FieldsSet.set(FieldBit_Rating);
 }
 
 bool CommentData::ratingIsSet() const
 {
-    return m_RatingIsSet;
+    return m_FieldsSet.test(FieldBit_Rating);
 }
 
 void CommentData::unsetRating()
 {
-    m_RatingIsSet = false;
+    m_FieldsSet.reset(FieldBit_Rating);
 }
 bool CommentData::isFromOfflineRestore() const
 {
@@ -1196,17 +1812,17 @@ bool CommentData::isFromOfflineRestore() const
 void CommentData::setFromOfflineRestore(bool value)
 {
     m_FromOfflineRestore = value;
-    m_FromOfflineRestoreIsSet = true;
+    m_FieldsSet.set(FieldBit_FromOfflineRestore);
 }
 
 bool CommentData::fromOfflineRestoreIsSet() const
 {
-    return m_FromOfflineRestoreIsSet;
+    return m_FieldsSet.test(FieldBit_FromOfflineRestore);
 }
 
 void CommentData::unsetFromOfflineRestore()
 {
-    m_FromOfflineRestoreIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromOfflineRestore);
 }
 int64_t CommentData::getAutoplayDelayMS() const
 {
@@ -1216,17 +1832,17 @@ int64_t CommentData::getAutoplayDelayMS() const
 void CommentData::setAutoplayDelayMS(int64_t value)
 {
     m_AutoplayDelayMS = value;
-    m_AutoplayDelayMSIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoplayDelayMS);
 }
 
 bool CommentData::autoplayDelayMSIsSet() const
 {
-    return m_AutoplayDelayMSIsSet;
+    return m_FieldsSet.test(FieldBit_AutoplayDelayMS);
 }
 
 void CommentData::unsetAutoplayDelayMS()
 {
-    m_AutoplayDelayMSIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoplayDelayMS);
 }
 std::vector<utility::string_t> CommentData::getFeedbackIds() const
 {
@@ -1237,17 +1853,17 @@ std::vector<utility::string_t> CommentData::getFeedbackIds() const
 void CommentData::setFeedbackIds(const std::vector<utility::string_t>& value)
 {
     m_FeedbackIds = value;
-    m_FeedbackIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackIds);
 }
 
 bool CommentData::feedbackIdsIsSet() const
 {
-    return m_FeedbackIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackIds);
 }
 
 void CommentData::unsetFeedbackIds()
 {
-    m_FeedbackIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackIds);
 }
 std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> CommentData::getQuestionValues() const
 {
@@ -1258,17 +1874,17 @@ std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner
 void CommentData::setQuestionValues(const std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>>& value)
 {
     m_QuestionValues = value;
-    m_QuestionValuesIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionValues);
 }
 
 bool CommentData::questionValuesIsSet() const
 {
-    return m_QuestionValuesIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionValues);
 }
 
 void CommentData::unsetQuestionValues()
 {
-    m_QuestionValuesIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionValues);
 }
 bool CommentData::isTos() const
 {
@@ -1278,17 +1894,17 @@ bool CommentData::isTos() const
 void CommentData::setTos(bool value)
 {
     m_Tos = value;
-    m_TosIsSet = true;
+    m_FieldsSet.set(FieldBit_Tos);
 }
 
 bool CommentData::tosIsSet() const
 {
-    return m_TosIsSet;
+    return m_FieldsSet.test(FieldBit_Tos);
 }
 
 void CommentData::unsetTos()
 {
-    m_TosIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tos);
 }
 utility::string_t CommentData::getBotId() const
 {
@@ -1299,17 +1915,17 @@ utility::string_t CommentData::getBotId() const
 void CommentData::setBotId(const utility::string_t& value)
 {
     m_BotId = value;
-    m_BotIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BotId);
 }
 
 bool CommentData::botIdIsSet() const
 {
-    return m_BotIdIsSet;
+    return m_FieldsSet.test(FieldBit_BotId);
 }
 
 void CommentData::unsetBotId()
 {
-    m_BotIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BotId);
 }
 
 }
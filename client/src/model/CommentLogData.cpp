@@ -21,75 +21,29 @@ namespace model {
 CommentLogData::CommentLogData()
 {
     m_ClearContent = false;
-    m_ClearContentIsSet = false;
     m_IsDeletedUser = false;
-    m_IsDeletedUserIsSet = false;
-    m_Phrase = utility::conversions::to_string_t("");
-    m_PhraseIsSet = false;
-    m_BadWord = utility::conversions::to_string_t("");
-    m_BadWordIsSet = false;
-    m_Word = utility::conversions::to_string_t("");
-    m_WordIsSet = false;
-    m_Locale = utility::conversions::to_string_t("");
-    m_LocaleIsSet = false;
-    m_TenantBadgeId = utility::conversions::to_string_t("");
-    m_TenantBadgeIdIsSet = false;
-    m_BadgeId = utility::conversions::to_string_t("");
-    m_BadgeIdIsSet = false;
     m_WasLoggedIn = false;
-    m_WasLoggedInIsSet = false;
     m_FoundUser = false;
-    m_FoundUserIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
-    m_Engine = utility::conversions::to_string_t("");
-    m_EngineIsSet = false;
-    m_EngineResponse = utility::conversions::to_string_t("");
-    m_EngineResponseIsSet = false;
     m_EngineTokens = 0.0;
-    m_EngineTokensIsSet = false;
     m_TrustFactor = 0.0;
-    m_TrustFactorIsSet = false;
-    m_Source = utility::conversions::to_string_t("");
-    m_SourceIsSet = false;
-    m_RuleIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
     m_Subscribers = 0.0;
-    m_SubscribersIsSet = false;
     m_NotificationCount = 0.0;
-    m_NotificationCountIsSet = false;
-    m_RepeatActionIsSet = false;
-    m_ReasonIsSet = false;
     m_SpamBefore = false;
-    m_SpamBeforeIsSet = false;
     m_SpamAfter = false;
-    m_SpamAfterIsSet = false;
-    m_PermanentFlagIsSet = false;
     m_ApprovedBefore = false;
-    m_ApprovedBeforeIsSet = false;
     m_ApprovedAfter = false;
-    m_ApprovedAfterIsSet = false;
     m_ReviewedBefore = false;
-    m_ReviewedBeforeIsSet = false;
     m_ReviewedAfter = false;
-    m_ReviewedAfterIsSet = false;
-    m_TextBefore = utility::conversions::to_string_t("");
-    m_TextBeforeIsSet = false;
-    m_TextAfter = utility::conversions::to_string_t("");
-    m_TextAfterIsSet = false;
     m_TrustFactorBefore = 0.0;
-    m_TrustFactorBeforeIsSet = false;
     m_TrustFactorAfter = 0.0;
-    m_TrustFactorAfterIsSet = false;
-    m_ReferencedCommentId = utility::conversions::to_string_t("");
-    m_ReferencedCommentIdIsSet = false;
-    m_InvalidLocale = utility::conversions::to_string_t("");
-    m_InvalidLocaleIsSet = false;
-    m_DetectedLocale = utility::conversions::to_string_t("");
-    m_DetectedLocaleIsSet = false;
-    m_DetectedLanguage = utility::conversions::to_string_t("");
-    m_DetectedLanguageIsSet = false;
+    m_VotesBefore = 0.0;
+    m_VotesUpBefore = 0.0;
+    m_VotesDownBefore = 0.0;
+    m_VotesAfter = 0.0;
+    m_VotesUpAfter = 0.0;
+    m_VotesDownAfter = 0.0;
+    m_FlagCountBefore = 0.0;
 }
 
 CommentLogData::~CommentLogData()
@@ -104,239 +58,239 @@ void CommentLogData::validate()
 web::json::value CommentLogData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ClearContentIsSet)
+    if(m_FieldsSet.test(FieldBit_ClearContent))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("clearContent"))] = ModelBase::toJson(m_ClearContent);
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))] = ModelBase::toJson(m_IsDeletedUser);
     }
-    if(m_PhraseIsSet)
+    if(m_FieldsSet.test(FieldBit_Phrase))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("phrase"))] = ModelBase::toJson(m_Phrase);
     }
-    if(m_BadWordIsSet)
+    if(m_FieldsSet.test(FieldBit_BadWord))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badWord"))] = ModelBase::toJson(m_BadWord);
     }
-    if(m_WordIsSet)
+    if(m_FieldsSet.test(FieldBit_Word))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("word"))] = ModelBase::toJson(m_Word);
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_TenantBadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantBadgeId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantBadgeId"))] = ModelBase::toJson(m_TenantBadgeId);
     }
-    if(m_BadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badgeId"))] = ModelBase::toJson(m_BadgeId);
     }
-    if(m_WasLoggedInIsSet)
+    if(m_FieldsSet.test(FieldBit_WasLoggedIn))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wasLoggedIn"))] = ModelBase::toJson(m_WasLoggedIn);
     }
-    if(m_FoundUserIsSet)
+    if(m_FieldsSet.test(FieldBit_FoundUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("foundUser"))] = ModelBase::toJson(m_FoundUser);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_EngineIsSet)
+    if(m_FieldsSet.test(FieldBit_Engine))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("engine"))] = ModelBase::toJson(m_Engine);
     }
-    if(m_EngineResponseIsSet)
+    if(m_FieldsSet.test(FieldBit_EngineResponse))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("engineResponse"))] = ModelBase::toJson(m_EngineResponse);
     }
-    if(m_EngineTokensIsSet)
+    if(m_FieldsSet.test(FieldBit_EngineTokens))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("engineTokens"))] = ModelBase::toJson(m_EngineTokens);
     }
-    if(m_TrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_TrustFactor))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("trustFactor"))] = ModelBase::toJson(m_TrustFactor);
     }
-    if(m_SourceIsSet)
+    if(m_FieldsSet.test(FieldBit_Source))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("source"))] = ModelBase::toJson(m_Source);
     }
-    if(m_RuleIsSet)
+    if(m_FieldsSet.test(FieldBit_Rule))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("rule"))] = ModelBase::toJson(m_Rule);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_SubscribersIsSet)
+    if(m_FieldsSet.test(FieldBit_Subscribers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("subscribers"))] = ModelBase::toJson(m_Subscribers);
     }
-    if(m_NotificationCountIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationCount"))] = ModelBase::toJson(m_NotificationCount);
     }
-    if(m_VotesBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesBefore))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesBefore"))] = ModelBase::toJson(m_VotesBefore.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesBefore"))] = ModelBase::toJson(m_VotesBefore);
     }
-    if(m_VotesUpBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUpBefore))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesUpBefore"))] = ModelBase::toJson(m_VotesUpBefore.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesUpBefore"))] = ModelBase::toJson(m_VotesUpBefore);
     }
-    if(m_VotesDownBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDownBefore))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesDownBefore"))] = ModelBase::toJson(m_VotesDownBefore.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesDownBefore"))] = ModelBase::toJson(m_VotesDownBefore);
     }
-    if(m_VotesAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesAfter))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesAfter"))] = ModelBase::toJson(m_VotesAfter.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesAfter"))] = ModelBase::toJson(m_VotesAfter);
     }
-    if(m_VotesUpAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUpAfter))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesUpAfter"))] = ModelBase::toJson(m_VotesUpAfter.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesUpAfter"))] = ModelBase::toJson(m_VotesUpAfter);
     }
-    if(m_VotesDownAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDownAfter))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesDownAfter"))] = ModelBase::toJson(m_VotesDownAfter.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesDownAfter"))] = ModelBase::toJson(m_VotesDownAfter);
     }
-    if(m_RepeatActionIsSet)
+    if(m_FieldsSet.test(FieldBit_RepeatAction))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("repeatAction"))] = ModelBase::toJson(m_RepeatAction);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_OtherData.has_value())
+    if(m_FieldsSet.test(FieldBit_OtherData))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("otherData"))] = ModelBase::toJson(m_OtherData.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("otherData"))] = ModelBase::toJson(m_OtherData);
     }
-    if(m_SpamBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_SpamBefore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("spamBefore"))] = ModelBase::toJson(m_SpamBefore);
     }
-    if(m_SpamAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_SpamAfter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("spamAfter"))] = ModelBase::toJson(m_SpamAfter);
     }
-    if(m_PermanentFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_PermanentFlag))
     {
         
         utility::string_t refVal = fromPermanentFlagEnum(m_PermanentFlag);
         val[utility::conversions::to_string_t(_XPLATSTR("permanentFlag"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_ApprovedBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_ApprovedBefore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approvedBefore"))] = ModelBase::toJson(m_ApprovedBefore);
     }
-    if(m_ApprovedAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_ApprovedAfter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approvedAfter"))] = ModelBase::toJson(m_ApprovedAfter);
     }
-    if(m_ReviewedBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_ReviewedBefore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewedBefore"))] = ModelBase::toJson(m_ReviewedBefore);
     }
-    if(m_ReviewedAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_ReviewedAfter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewedAfter"))] = ModelBase::toJson(m_ReviewedAfter);
     }
-    if(m_TextBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_TextBefore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("textBefore"))] = ModelBase::toJson(m_TextBefore);
     }
-    if(m_TextAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_TextAfter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("textAfter"))] = ModelBase::toJson(m_TextAfter);
     }
-    if(m_ExpireBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireBefore))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("expireBefore"))] = ModelBase::toJson(m_ExpireBefore.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("expireBefore"))] = ModelBase::toJson(m_ExpireBefore);
     }
-    if(m_ExpireAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAfter))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("expireAfter"))] = ModelBase::toJson(m_ExpireAfter.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("expireAfter"))] = ModelBase::toJson(m_ExpireAfter);
     }
-    if(m_FlagCountBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCountBefore))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("flagCountBefore"))] = ModelBase::toJson(m_FlagCountBefore.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("flagCountBefore"))] = ModelBase::toJson(m_FlagCountBefore);
     }
-    if(m_TrustFactorBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_TrustFactorBefore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("trustFactorBefore"))] = ModelBase::toJson(m_TrustFactorBefore);
     }
-    if(m_TrustFactorAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_TrustFactorAfter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("trustFactorAfter"))] = ModelBase::toJson(m_TrustFactorAfter);
     }
-    if(m_ReferencedCommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ReferencedCommentId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("referencedCommentId"))] = ModelBase::toJson(m_ReferencedCommentId);
     }
-    if(m_InvalidLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_InvalidLocale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("invalidLocale"))] = ModelBase::toJson(m_InvalidLocale);
     }
-    if(m_DetectedLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_DetectedLocale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("detectedLocale"))] = ModelBase::toJson(m_DetectedLocale);
     }
-    if(m_DetectedLanguageIsSet)
+    if(m_FieldsSet.test(FieldBit_DetectedLanguage))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("detectedLanguage"))] = ModelBase::toJson(m_DetectedLanguage);
@@ -345,528 +299,1653 @@ web::json::value CommentLogData::toJson() const
     return val;
 }
 
+void CommentLogData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ClearContent))
+    {
+        
+        writer.key(_XPLATSTR("clearContent"));
+        ModelBase::writeJson(writer, m_ClearContent);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
+    {
+        
+        writer.key(_XPLATSTR("isDeletedUser"));
+        ModelBase::writeJson(writer, m_IsDeletedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_Phrase))
+    {
+        
+        writer.key(_XPLATSTR("phrase"));
+        ModelBase::writeJson(writer, m_Phrase);
+    }
+    if(m_FieldsSet.test(FieldBit_BadWord))
+    {
+        
+        writer.key(_XPLATSTR("badWord"));
+        ModelBase::writeJson(writer, m_BadWord);
+    }
+    if(m_FieldsSet.test(FieldBit_Word))
+    {
+        
+        writer.key(_XPLATSTR("word"));
+        ModelBase::writeJson(writer, m_Word);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantBadgeId))
+    {
+        
+        writer.key(_XPLATSTR("tenantBadgeId"));
+        ModelBase::writeJson(writer, m_TenantBadgeId);
+    }
+    if(m_FieldsSet.test(FieldBit_BadgeId))
+    {
+        
+        writer.key(_XPLATSTR("badgeId"));
+        ModelBase::writeJson(writer, m_BadgeId);
+    }
+    if(m_FieldsSet.test(FieldBit_WasLoggedIn))
+    {
+        
+        writer.key(_XPLATSTR("wasLoggedIn"));
+        ModelBase::writeJson(writer, m_WasLoggedIn);
+    }
+    if(m_FieldsSet.test(FieldBit_FoundUser))
+    {
+        
+        writer.key(_XPLATSTR("foundUser"));
+        ModelBase::writeJson(writer, m_FoundUser);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_Engine))
+    {
+        
+        writer.key(_XPLATSTR("engine"));
+        ModelBase::writeJson(writer, m_Engine);
+    }
+    if(m_FieldsSet.test(FieldBit_EngineResponse))
+    {
+        
+        writer.key(_XPLATSTR("engineResponse"));
+        ModelBase::writeJson(writer, m_EngineResponse);
+    }
+    if(m_FieldsSet.test(FieldBit_EngineTokens))
+    {
+        
+        writer.key(_XPLATSTR("engineTokens"));
+        ModelBase::writeJson(writer, m_EngineTokens);
+    }
+    if(m_FieldsSet.test(FieldBit_TrustFactor))
+    {
+        
+        writer.key(_XPLATSTR("trustFactor"));
+        ModelBase::writeJson(writer, m_TrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_Source))
+    {
+        
+        writer.key(_XPLATSTR("source"));
+        ModelBase::writeJson(writer, m_Source);
+    }
+    if(m_FieldsSet.test(FieldBit_Rule))
+    {
+        
+        writer.key(_XPLATSTR("rule"));
+        ModelBase::writeJson(writer, m_Rule);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Subscribers))
+    {
+        
+        writer.key(_XPLATSTR("subscribers"));
+        ModelBase::writeJson(writer, m_Subscribers);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
+    {
+        
+        writer.key(_XPLATSTR("notificationCount"));
+        ModelBase::writeJson(writer, m_NotificationCount);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesBefore))
+    {
+        
+        writer.key(_XPLATSTR("votesBefore"));
+        ModelBase::writeJson(writer, m_VotesBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUpBefore))
+    {
+        
+        writer.key(_XPLATSTR("votesUpBefore"));
+        ModelBase::writeJson(writer, m_VotesUpBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDownBefore))
+    {
+        
+        writer.key(_XPLATSTR("votesDownBefore"));
+        ModelBase::writeJson(writer, m_VotesDownBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesAfter))
+    {
+        
+        writer.key(_XPLATSTR("votesAfter"));
+        ModelBase::writeJson(writer, m_VotesAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUpAfter))
+    {
+        
+        writer.key(_XPLATSTR("votesUpAfter"));
+        ModelBase::writeJson(writer, m_VotesUpAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDownAfter))
+    {
+        
+        writer.key(_XPLATSTR("votesDownAfter"));
+        ModelBase::writeJson(writer, m_VotesDownAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_RepeatAction))
+    {
+        
+        writer.key(_XPLATSTR("repeatAction"));
+        ModelBase::writeJson(writer, m_RepeatAction);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_OtherData))
+    {
+        
+        writer.key(_XPLATSTR("otherData"));
+        ModelBase::writeJson(writer, m_OtherData);
+    }
+    if(m_FieldsSet.test(FieldBit_SpamBefore))
+    {
+        
+        writer.key(_XPLATSTR("spamBefore"));
+        ModelBase::writeJson(writer, m_SpamBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_SpamAfter))
+    {
+        
+        writer.key(_XPLATSTR("spamAfter"));
+        ModelBase::writeJson(writer, m_SpamAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_PermanentFlag))
+    {
+        
+        utility::string_t refVal = fromPermanentFlagEnum(m_PermanentFlag);
+        writer.key(_XPLATSTR("permanentFlag"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_ApprovedBefore))
+    {
+        
+        writer.key(_XPLATSTR("approvedBefore"));
+        ModelBase::writeJson(writer, m_ApprovedBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_ApprovedAfter))
+    {
+        
+        writer.key(_XPLATSTR("approvedAfter"));
+        ModelBase::writeJson(writer, m_ApprovedAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_ReviewedBefore))
+    {
+        
+        writer.key(_XPLATSTR("reviewedBefore"));
+        ModelBase::writeJson(writer, m_ReviewedBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_ReviewedAfter))
+    {
+        
+        writer.key(_XPLATSTR("reviewedAfter"));
+        ModelBase::writeJson(writer, m_ReviewedAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_TextBefore))
+    {
+        
+        writer.key(_XPLATSTR("textBefore"));
+        ModelBase::writeJson(writer, m_TextBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_TextAfter))
+    {
+        
+        writer.key(_XPLATSTR("textAfter"));
+        ModelBase::writeJson(writer, m_TextAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpireBefore))
+    {
+        
+        writer.key(_XPLATSTR("expireBefore"));
+        ModelBase::writeJson(writer, m_ExpireBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpireAfter))
+    {
+        
+        writer.key(_XPLATSTR("expireAfter"));
+        ModelBase::writeJson(writer, m_ExpireAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_FlagCountBefore))
+    {
+        
+        writer.key(_XPLATSTR("flagCountBefore"));
+        ModelBase::writeJson(writer, m_FlagCountBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_TrustFactorBefore))
+    {
+        
+        writer.key(_XPLATSTR("trustFactorBefore"));
+        ModelBase::writeJson(writer, m_TrustFactorBefore);
+    }
+    if(m_FieldsSet.test(FieldBit_TrustFactorAfter))
+    {
+        
+        writer.key(_XPLATSTR("trustFactorAfter"));
+        ModelBase::writeJson(writer, m_TrustFactorAfter);
+    }
+    if(m_FieldsSet.test(FieldBit_ReferencedCommentId))
+    {
+        
+        writer.key(_XPLATSTR("referencedCommentId"));
+        ModelBase::writeJson(writer, m_ReferencedCommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_InvalidLocale))
+    {
+        
+        writer.key(_XPLATSTR("invalidLocale"));
+        ModelBase::writeJson(writer, m_InvalidLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_DetectedLocale))
+    {
+        
+        writer.key(_XPLATSTR("detectedLocale"));
+        ModelBase::writeJson(writer, m_DetectedLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_DetectedLanguage))
+    {
+        
+        writer.key(_XPLATSTR("detectedLanguage"));
+        ModelBase::writeJson(writer, m_DetectedLanguage);
+    }
+
+    writer.endObject();
+}
+
 bool CommentLogData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("clearContent"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("clearContent")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setClearContent;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setClearContent);
-            setClearContent(refVal_setClearContent);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setIsDeletedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
-            setIsDeletedUser(refVal_setIsDeletedUser);
-            
+        case ModelBase::fieldHash(_XPLATSTR("clearContent")):
+            if(field.first == _XPLATSTR("clearContent"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setClearContent;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setClearContent);
+                    setClearContent(refVal_setClearContent);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            if(field.first == _XPLATSTR("isDeletedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeletedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
+                    setIsDeletedUser(refVal_setIsDeletedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("phrase")):
+            if(field.first == _XPLATSTR("phrase"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPhrase;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPhrase);
+                    setPhrase(refVal_setPhrase);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badWord")):
+            if(field.first == _XPLATSTR("badWord"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBadWord;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadWord);
+                    setBadWord(refVal_setBadWord);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("word")):
+            if(field.first == _XPLATSTR("word"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWord;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWord);
+                    setWord(refVal_setWord);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantBadgeId")):
+            if(field.first == _XPLATSTR("tenantBadgeId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantBadgeId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantBadgeId);
+                    setTenantBadgeId(refVal_setTenantBadgeId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badgeId")):
+            if(field.first == _XPLATSTR("badgeId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBadgeId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadgeId);
+                    setBadgeId(refVal_setBadgeId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wasLoggedIn")):
+            if(field.first == _XPLATSTR("wasLoggedIn"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setWasLoggedIn;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWasLoggedIn);
+                    setWasLoggedIn(refVal_setWasLoggedIn);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("foundUser")):
+            if(field.first == _XPLATSTR("foundUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setFoundUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFoundUser);
+                    setFoundUser(refVal_setFoundUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("engine")):
+            if(field.first == _XPLATSTR("engine"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEngine;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEngine);
+                    setEngine(refVal_setEngine);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("engineResponse")):
+            if(field.first == _XPLATSTR("engineResponse"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEngineResponse;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEngineResponse);
+                    setEngineResponse(refVal_setEngineResponse);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("engineTokens")):
+            if(field.first == _XPLATSTR("engineTokens"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setEngineTokens;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEngineTokens);
+                    setEngineTokens(refVal_setEngineTokens);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("trustFactor")):
+            if(field.first == _XPLATSTR("trustFactor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setTrustFactor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTrustFactor);
+                    setTrustFactor(refVal_setTrustFactor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("source")):
+            if(field.first == _XPLATSTR("source"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSource;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSource);
+                    setSource(refVal_setSource);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rule")):
+            if(field.first == _XPLATSTR("rule"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<SpamRule> refVal_setRule;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRule);
+                    setRule(refVal_setRule);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("subscribers")):
+            if(field.first == _XPLATSTR("subscribers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setSubscribers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSubscribers);
+                    setSubscribers(refVal_setSubscribers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationCount")):
+            if(field.first == _XPLATSTR("notificationCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNotificationCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationCount);
+                    setNotificationCount(refVal_setNotificationCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesBefore")):
+            if(field.first == _XPLATSTR("votesBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesBefore);
+                    setVotesBefore(refVal_setVotesBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUpBefore")):
+            if(field.first == _XPLATSTR("votesUpBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesUpBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUpBefore);
+                    setVotesUpBefore(refVal_setVotesUpBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDownBefore")):
+            if(field.first == _XPLATSTR("votesDownBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesDownBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDownBefore);
+                    setVotesDownBefore(refVal_setVotesDownBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesAfter")):
+            if(field.first == _XPLATSTR("votesAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesAfter);
+                    setVotesAfter(refVal_setVotesAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUpAfter")):
+            if(field.first == _XPLATSTR("votesUpAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesUpAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUpAfter);
+                    setVotesUpAfter(refVal_setVotesUpAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDownAfter")):
+            if(field.first == _XPLATSTR("votesDownAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesDownAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDownAfter);
+                    setVotesDownAfter(refVal_setVotesDownAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("repeatAction")):
+            if(field.first == _XPLATSTR("repeatAction"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<RepeatCommentHandlingAction> refVal_setRepeatAction;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRepeatAction);
+                    setRepeatAction(refVal_setRepeatAction);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<RepeatCommentCheckIgnoredReason> refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("otherData")):
+            if(field.first == _XPLATSTR("otherData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AnyType> refVal_setOtherData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOtherData);
+                    setOtherData(refVal_setOtherData);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("spamBefore")):
+            if(field.first == _XPLATSTR("spamBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setSpamBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSpamBefore);
+                    setSpamBefore(refVal_setSpamBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("spamAfter")):
+            if(field.first == _XPLATSTR("spamAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setSpamAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSpamAfter);
+                    setSpamAfter(refVal_setSpamAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("permanentFlag")):
+            if(field.first == _XPLATSTR("permanentFlag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPermanentFlag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPermanentFlag);
+                    setPermanentFlag(toPermanentFlagEnum(refVal_setPermanentFlag));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approvedBefore")):
+            if(field.first == _XPLATSTR("approvedBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApprovedBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApprovedBefore);
+                    setApprovedBefore(refVal_setApprovedBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approvedAfter")):
+            if(field.first == _XPLATSTR("approvedAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApprovedAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApprovedAfter);
+                    setApprovedAfter(refVal_setApprovedAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reviewedBefore")):
+            if(field.first == _XPLATSTR("reviewedBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewedBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewedBefore);
+                    setReviewedBefore(refVal_setReviewedBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reviewedAfter")):
+            if(field.first == _XPLATSTR("reviewedAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewedAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewedAfter);
+                    setReviewedAfter(refVal_setReviewedAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("textBefore")):
+            if(field.first == _XPLATSTR("textBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTextBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTextBefore);
+                    setTextBefore(refVal_setTextBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("textAfter")):
+            if(field.first == _XPLATSTR("textAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTextAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTextAfter);
+                    setTextAfter(refVal_setTextAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expireBefore")):
+            if(field.first == _XPLATSTR("expireBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setExpireBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpireBefore);
+                    setExpireBefore(refVal_setExpireBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expireAfter")):
+            if(field.first == _XPLATSTR("expireAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setExpireAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAfter);
+                    setExpireAfter(refVal_setExpireAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flagCountBefore")):
+            if(field.first == _XPLATSTR("flagCountBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlagCountBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCountBefore);
+                    setFlagCountBefore(refVal_setFlagCountBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("trustFactorBefore")):
+            if(field.first == _XPLATSTR("trustFactorBefore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setTrustFactorBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTrustFactorBefore);
+                    setTrustFactorBefore(refVal_setTrustFactorBefore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("trustFactorAfter")):
+            if(field.first == _XPLATSTR("trustFactorAfter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setTrustFactorAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTrustFactorAfter);
+                    setTrustFactorAfter(refVal_setTrustFactorAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("referencedCommentId")):
+            if(field.first == _XPLATSTR("referencedCommentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReferencedCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReferencedCommentId);
+                    setReferencedCommentId(refVal_setReferencedCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("invalidLocale")):
+            if(field.first == _XPLATSTR("invalidLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setInvalidLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setInvalidLocale);
+                    setInvalidLocale(refVal_setInvalidLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("detectedLocale")):
+            if(field.first == _XPLATSTR("detectedLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDetectedLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDetectedLocale);
+                    setDetectedLocale(refVal_setDetectedLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("detectedLanguage")):
+            if(field.first == _XPLATSTR("detectedLanguage"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDetectedLanguage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDetectedLanguage);
+                    setDetectedLanguage(refVal_setDetectedLanguage);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("phrase"))))
+    return ok;
+}
+
+void CommentLogData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ClearContent))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("phrase")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPhrase;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPhrase);
-            setPhrase(refVal_setPhrase);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("clearContent")), m_ClearContent);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badWord"))))
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badWord")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBadWord;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadWord);
-            setBadWord(refVal_setBadWord);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeletedUser")), m_IsDeletedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("word"))))
+    if(m_FieldsSet.test(FieldBit_Phrase))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("word")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWord;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWord);
-            setWord(refVal_setWord);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("phrase")), m_Phrase);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_BadWord))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badWord")), m_BadWord);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantBadgeId"))))
+    if(m_FieldsSet.test(FieldBit_Word))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantBadgeId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTenantBadgeId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantBadgeId);
-            setTenantBadgeId(refVal_setTenantBadgeId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("word")), m_Word);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badgeId"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badgeId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBadgeId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadgeId);
-            setBadgeId(refVal_setBadgeId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wasLoggedIn"))))
+    if(m_FieldsSet.test(FieldBit_TenantBadgeId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wasLoggedIn")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setWasLoggedIn;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWasLoggedIn);
-            setWasLoggedIn(refVal_setWasLoggedIn);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantBadgeId")), m_TenantBadgeId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("foundUser"))))
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("foundUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setFoundUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFoundUser);
-            setFoundUser(refVal_setFoundUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badgeId")), m_BadgeId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_WasLoggedIn))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wasLoggedIn")), m_WasLoggedIn);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("engine"))))
+    if(m_FieldsSet.test(FieldBit_FoundUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("engine")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEngine;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEngine);
-            setEngine(refVal_setEngine);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("foundUser")), m_FoundUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("engineResponse"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("engineResponse")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEngineResponse;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEngineResponse);
-            setEngineResponse(refVal_setEngineResponse);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("engineTokens"))))
+    if(m_FieldsSet.test(FieldBit_Engine))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("engineTokens")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setEngineTokens;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEngineTokens);
-            setEngineTokens(refVal_setEngineTokens);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("engine")), m_Engine);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("trustFactor"))))
+    if(m_FieldsSet.test(FieldBit_EngineResponse))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("trustFactor")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setTrustFactor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTrustFactor);
-            setTrustFactor(refVal_setTrustFactor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("engineResponse")), m_EngineResponse);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("source"))))
+    if(m_FieldsSet.test(FieldBit_EngineTokens))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("source")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSource;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSource);
-            setSource(refVal_setSource);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("engineTokens")), m_EngineTokens);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rule"))))
+    if(m_FieldsSet.test(FieldBit_TrustFactor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rule")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<SpamRule> refVal_setRule;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRule);
-            setRule(refVal_setRule);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("trustFactor")), m_TrustFactor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_Source))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("source")), m_Source);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("subscribers"))))
+    if(m_FieldsSet.test(FieldBit_Rule))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("subscribers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setSubscribers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSubscribers);
-            setSubscribers(refVal_setSubscribers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rule")), m_Rule);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationCount"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setNotificationCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationCount);
-            setNotificationCount(refVal_setNotificationCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesBefore"))))
+    if(m_FieldsSet.test(FieldBit_Subscribers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesBefore")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesBefore);
-            setVotesBefore(refVal_setVotesBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("subscribers")), m_Subscribers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUpBefore"))))
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUpBefore")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesUpBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUpBefore);
-            setVotesUpBefore(refVal_setVotesUpBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationCount")), m_NotificationCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDownBefore"))))
+    if(m_FieldsSet.test(FieldBit_VotesBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDownBefore")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesDownBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDownBefore);
-            setVotesDownBefore(refVal_setVotesDownBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesBefore")), m_VotesBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesAfter"))))
+    if(m_FieldsSet.test(FieldBit_VotesUpBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesAfter")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesAfter);
-            setVotesAfter(refVal_setVotesAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUpBefore")), m_VotesUpBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUpAfter"))))
+    if(m_FieldsSet.test(FieldBit_VotesDownBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUpAfter")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesUpAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUpAfter);
-            setVotesUpAfter(refVal_setVotesUpAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDownBefore")), m_VotesDownBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDownAfter"))))
+    if(m_FieldsSet.test(FieldBit_VotesAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDownAfter")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesDownAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDownAfter);
-            setVotesDownAfter(refVal_setVotesDownAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesAfter")), m_VotesAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("repeatAction"))))
+    if(m_FieldsSet.test(FieldBit_VotesUpAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("repeatAction")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<RepeatCommentHandlingAction> refVal_setRepeatAction;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRepeatAction);
-            setRepeatAction(refVal_setRepeatAction);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUpAfter")), m_VotesUpAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(m_FieldsSet.test(FieldBit_VotesDownAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<RepeatCommentCheckIgnoredReason> refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDownAfter")), m_VotesDownAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("otherData"))))
+    if(m_FieldsSet.test(FieldBit_RepeatAction))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("otherData")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<AnyType> refVal_setOtherData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOtherData);
-            setOtherData(refVal_setOtherData);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("repeatAction")), m_RepeatAction);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("spamBefore"))))
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("spamBefore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setSpamBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSpamBefore);
-            setSpamBefore(refVal_setSpamBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("spamAfter"))))
+    if(m_FieldsSet.test(FieldBit_OtherData))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("spamAfter")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setSpamAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSpamAfter);
-            setSpamAfter(refVal_setSpamAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("otherData")), m_OtherData);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("permanentFlag"))))
+    if(m_FieldsSet.test(FieldBit_SpamBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("permanentFlag")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPermanentFlag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPermanentFlag);
-            
-            setPermanentFlag(toPermanentFlagEnum(refVal_setPermanentFlag));
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("spamBefore")), m_SpamBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approvedBefore"))))
+    if(m_FieldsSet.test(FieldBit_SpamAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approvedBefore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApprovedBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApprovedBefore);
-            setApprovedBefore(refVal_setApprovedBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("spamAfter")), m_SpamAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approvedAfter"))))
+    if(m_FieldsSet.test(FieldBit_PermanentFlag))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approvedAfter")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApprovedAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApprovedAfter);
-            setApprovedAfter(refVal_setApprovedAfter);
-            
-        }
+        
+        utility::string_t refVal = fromPermanentFlagEnum(m_PermanentFlag);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("permanentFlag")), refVal);
+        
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewedBefore"))))
+    if(m_FieldsSet.test(FieldBit_ApprovedBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewedBefore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewedBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewedBefore);
-            setReviewedBefore(refVal_setReviewedBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approvedBefore")), m_ApprovedBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewedAfter"))))
+    if(m_FieldsSet.test(FieldBit_ApprovedAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewedAfter")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewedAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewedAfter);
-            setReviewedAfter(refVal_setReviewedAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approvedAfter")), m_ApprovedAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("textBefore"))))
+    if(m_FieldsSet.test(FieldBit_ReviewedBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("textBefore")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTextBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTextBefore);
-            setTextBefore(refVal_setTextBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewedBefore")), m_ReviewedBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("textAfter"))))
+    if(m_FieldsSet.test(FieldBit_ReviewedAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("textAfter")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTextAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTextAfter);
-            setTextAfter(refVal_setTextAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewedAfter")), m_ReviewedAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expireBefore"))))
+    if(m_FieldsSet.test(FieldBit_TextBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expireBefore")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setExpireBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpireBefore);
-            setExpireBefore(refVal_setExpireBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("textBefore")), m_TextBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expireAfter"))))
+    if(m_FieldsSet.test(FieldBit_TextAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expireAfter")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setExpireAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAfter);
-            setExpireAfter(refVal_setExpireAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("textAfter")), m_TextAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flagCountBefore"))))
+    if(m_FieldsSet.test(FieldBit_ExpireBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flagCountBefore")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlagCountBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCountBefore);
-            setFlagCountBefore(refVal_setFlagCountBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expireBefore")), m_ExpireBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("trustFactorBefore"))))
+    if(m_FieldsSet.test(FieldBit_ExpireAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("trustFactorBefore")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setTrustFactorBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTrustFactorBefore);
-            setTrustFactorBefore(refVal_setTrustFactorBefore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expireAfter")), m_ExpireAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("trustFactorAfter"))))
+    if(m_FieldsSet.test(FieldBit_FlagCountBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("trustFactorAfter")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setTrustFactorAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTrustFactorAfter);
-            setTrustFactorAfter(refVal_setTrustFactorAfter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flagCountBefore")), m_FlagCountBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("referencedCommentId"))))
+    if(m_FieldsSet.test(FieldBit_TrustFactorBefore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("referencedCommentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReferencedCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReferencedCommentId);
-            setReferencedCommentId(refVal_setReferencedCommentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("trustFactorBefore")), m_TrustFactorBefore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("invalidLocale"))))
+    if(m_FieldsSet.test(FieldBit_TrustFactorAfter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("invalidLocale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setInvalidLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setInvalidLocale);
-            setInvalidLocale(refVal_setInvalidLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("trustFactorAfter")), m_TrustFactorAfter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("detectedLocale"))))
+    if(m_FieldsSet.test(FieldBit_ReferencedCommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("detectedLocale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDetectedLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDetectedLocale);
-            setDetectedLocale(refVal_setDetectedLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("referencedCommentId")), m_ReferencedCommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_InvalidLocale))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("invalidLocale")), m_InvalidLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_DetectedLocale))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("detectedLocale")), m_DetectedLocale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("detectedLanguage"))))
+    if(m_FieldsSet.test(FieldBit_DetectedLanguage))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("detectedLanguage")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("detectedLanguage")), m_DetectedLanguage);
+    }
+}
+
+bool CommentLogData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setDetectedLanguage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDetectedLanguage);
-            setDetectedLanguage(refVal_setDetectedLanguage);
-            
+        case ModelBase::fieldHash(_XPLATSTR("clearContent")):
+            {
+                bool refVal_setClearContent;
+                if(!ModelBase::readBinary(reader, field, refVal_setClearContent))
+                {
+                    ok = false;
+                    continue;
+                }
+                setClearContent(refVal_setClearContent);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            {
+                bool refVal_setIsDeletedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeletedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeletedUser(refVal_setIsDeletedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("phrase")):
+            {
+                utility::string_t refVal_setPhrase;
+                if(!ModelBase::readBinary(reader, field, refVal_setPhrase))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPhrase(refVal_setPhrase);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badWord")):
+            {
+                utility::string_t refVal_setBadWord;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadWord))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadWord(refVal_setBadWord);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("word")):
+            {
+                utility::string_t refVal_setWord;
+                if(!ModelBase::readBinary(reader, field, refVal_setWord))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWord(refVal_setWord);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantBadgeId")):
+            {
+                utility::string_t refVal_setTenantBadgeId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantBadgeId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantBadgeId(refVal_setTenantBadgeId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badgeId")):
+            {
+                utility::string_t refVal_setBadgeId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadgeId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadgeId(refVal_setBadgeId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wasLoggedIn")):
+            {
+                bool refVal_setWasLoggedIn;
+                if(!ModelBase::readBinary(reader, field, refVal_setWasLoggedIn))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWasLoggedIn(refVal_setWasLoggedIn);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("foundUser")):
+            {
+                bool refVal_setFoundUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setFoundUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFoundUser(refVal_setFoundUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("engine")):
+            {
+                utility::string_t refVal_setEngine;
+                if(!ModelBase::readBinary(reader, field, refVal_setEngine))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEngine(refVal_setEngine);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("engineResponse")):
+            {
+                utility::string_t refVal_setEngineResponse;
+                if(!ModelBase::readBinary(reader, field, refVal_setEngineResponse))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEngineResponse(refVal_setEngineResponse);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("engineTokens")):
+            {
+                double refVal_setEngineTokens;
+                if(!ModelBase::readBinary(reader, field, refVal_setEngineTokens))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEngineTokens(refVal_setEngineTokens);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("trustFactor")):
+            {
+                double refVal_setTrustFactor;
+                if(!ModelBase::readBinary(reader, field, refVal_setTrustFactor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTrustFactor(refVal_setTrustFactor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("source")):
+            {
+                utility::string_t refVal_setSource;
+                if(!ModelBase::readBinary(reader, field, refVal_setSource))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSource(refVal_setSource);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rule")):
+            {
+                std::shared_ptr<SpamRule> refVal_setRule;
+                if(!ModelBase::readBinary(reader, field, refVal_setRule))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRule(refVal_setRule);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("subscribers")):
+            {
+                double refVal_setSubscribers;
+                if(!ModelBase::readBinary(reader, field, refVal_setSubscribers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSubscribers(refVal_setSubscribers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationCount")):
+            {
+                double refVal_setNotificationCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationCount(refVal_setNotificationCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesBefore")):
+            {
+                double refVal_setVotesBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesBefore(refVal_setVotesBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUpBefore")):
+            {
+                double refVal_setVotesUpBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUpBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUpBefore(refVal_setVotesUpBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDownBefore")):
+            {
+                double refVal_setVotesDownBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDownBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDownBefore(refVal_setVotesDownBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesAfter")):
+            {
+                double refVal_setVotesAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesAfter(refVal_setVotesAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUpAfter")):
+            {
+                double refVal_setVotesUpAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUpAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUpAfter(refVal_setVotesUpAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDownAfter")):
+            {
+                double refVal_setVotesDownAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDownAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDownAfter(refVal_setVotesDownAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("repeatAction")):
+            {
+                std::shared_ptr<RepeatCommentHandlingAction> refVal_setRepeatAction;
+                if(!ModelBase::readBinary(reader, field, refVal_setRepeatAction))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRepeatAction(refVal_setRepeatAction);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                std::shared_ptr<RepeatCommentCheckIgnoredReason> refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("otherData")):
+            {
+                std::shared_ptr<AnyType> refVal_setOtherData;
+                if(!ModelBase::readBinary(reader, field, refVal_setOtherData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOtherData(refVal_setOtherData);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("spamBefore")):
+            {
+                bool refVal_setSpamBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setSpamBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSpamBefore(refVal_setSpamBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("spamAfter")):
+            {
+                bool refVal_setSpamAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setSpamAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSpamAfter(refVal_setSpamAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("permanentFlag")):
+            {
+                utility::string_t refVal_setPermanentFlag;
+                if(!ModelBase::readBinary(reader, field, refVal_setPermanentFlag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPermanentFlag(toPermanentFlagEnum(refVal_setPermanentFlag));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approvedBefore")):
+            {
+                bool refVal_setApprovedBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setApprovedBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApprovedBefore(refVal_setApprovedBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approvedAfter")):
+            {
+                bool refVal_setApprovedAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setApprovedAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApprovedAfter(refVal_setApprovedAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reviewedBefore")):
+            {
+                bool refVal_setReviewedBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewedBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewedBefore(refVal_setReviewedBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reviewedAfter")):
+            {
+                bool refVal_setReviewedAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewedAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewedAfter(refVal_setReviewedAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("textBefore")):
+            {
+                utility::string_t refVal_setTextBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setTextBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTextBefore(refVal_setTextBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("textAfter")):
+            {
+                utility::string_t refVal_setTextAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setTextAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTextAfter(refVal_setTextAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expireBefore")):
+            {
+                utility::datetime refVal_setExpireBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpireBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpireBefore(refVal_setExpireBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expireAfter")):
+            {
+                utility::datetime refVal_setExpireAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpireAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpireAfter(refVal_setExpireAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flagCountBefore")):
+            {
+                double refVal_setFlagCountBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlagCountBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlagCountBefore(refVal_setFlagCountBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("trustFactorBefore")):
+            {
+                double refVal_setTrustFactorBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setTrustFactorBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTrustFactorBefore(refVal_setTrustFactorBefore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("trustFactorAfter")):
+            {
+                double refVal_setTrustFactorAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setTrustFactorAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTrustFactorAfter(refVal_setTrustFactorAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("referencedCommentId")):
+            {
+                utility::string_t refVal_setReferencedCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setReferencedCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReferencedCommentId(refVal_setReferencedCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("invalidLocale")):
+            {
+                utility::string_t refVal_setInvalidLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setInvalidLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setInvalidLocale(refVal_setInvalidLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("detectedLocale")):
+            {
+                utility::string_t refVal_setDetectedLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setDetectedLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDetectedLocale(refVal_setDetectedLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("detectedLanguage")):
+            {
+                utility::string_t refVal_setDetectedLanguage;
+                if(!ModelBase::readBinary(reader, field, refVal_setDetectedLanguage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDetectedLanguage(refVal_setDetectedLanguage);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CommentLogData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -876,191 +1955,191 @@ void CommentLogData::toMultipart(std::shared_ptr<MultipartFormData> multipart, c
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ClearContentIsSet)
+    if(m_FieldsSet.test(FieldBit_ClearContent))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("clearContent")), m_ClearContent));
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")), m_IsDeletedUser));
     }
-    if(m_PhraseIsSet)
+    if(m_FieldsSet.test(FieldBit_Phrase))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("phrase")), m_Phrase));
     }
-    if(m_BadWordIsSet)
+    if(m_FieldsSet.test(FieldBit_BadWord))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badWord")), m_BadWord));
     }
-    if(m_WordIsSet)
+    if(m_FieldsSet.test(FieldBit_Word))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("word")), m_Word));
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_TenantBadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantBadgeId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantBadgeId")), m_TenantBadgeId));
     }
-    if(m_BadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badgeId")), m_BadgeId));
     }
-    if(m_WasLoggedInIsSet)
+    if(m_FieldsSet.test(FieldBit_WasLoggedIn))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wasLoggedIn")), m_WasLoggedIn));
     }
-    if(m_FoundUserIsSet)
+    if(m_FieldsSet.test(FieldBit_FoundUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("foundUser")), m_FoundUser));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_EngineIsSet)
+    if(m_FieldsSet.test(FieldBit_Engine))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("engine")), m_Engine));
     }
-    if(m_EngineResponseIsSet)
+    if(m_FieldsSet.test(FieldBit_EngineResponse))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("engineResponse")), m_EngineResponse));
     }
-    if(m_EngineTokensIsSet)
+    if(m_FieldsSet.test(FieldBit_EngineTokens))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("engineTokens")), m_EngineTokens));
     }
-    if(m_TrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_TrustFactor))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("trustFactor")), m_TrustFactor));
     }
-    if(m_SourceIsSet)
+    if(m_FieldsSet.test(FieldBit_Source))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("source")), m_Source));
     }
-    if(m_RuleIsSet)
+    if(m_FieldsSet.test(FieldBit_Rule))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rule")), m_Rule));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_SubscribersIsSet)
+    if(m_FieldsSet.test(FieldBit_Subscribers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("subscribers")), m_Subscribers));
     }
-    if(m_NotificationCountIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationCount")), m_NotificationCount));
     }
-    if(m_VotesBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesBefore))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesBefore")), m_VotesBefore.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesBefore")), m_VotesBefore));
     }
-    if(m_VotesUpBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUpBefore))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUpBefore")), m_VotesUpBefore.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUpBefore")), m_VotesUpBefore));
     }
-    if(m_VotesDownBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDownBefore))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDownBefore")), m_VotesDownBefore.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDownBefore")), m_VotesDownBefore));
     }
-    if(m_VotesAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesAfter))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesAfter")), m_VotesAfter.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesAfter")), m_VotesAfter));
     }
-    if(m_VotesUpAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUpAfter))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUpAfter")), m_VotesUpAfter.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUpAfter")), m_VotesUpAfter));
     }
-    if(m_VotesDownAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDownAfter))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDownAfter")), m_VotesDownAfter.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDownAfter")), m_VotesDownAfter));
     }
-    if(m_RepeatActionIsSet)
+    if(m_FieldsSet.test(FieldBit_RepeatAction))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("repeatAction")), m_RepeatAction));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_OtherData.has_value())
+    if(m_FieldsSet.test(FieldBit_OtherData))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("otherData")), m_OtherData.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("otherData")), m_OtherData));
     }
-    if(m_SpamBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_SpamBefore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("spamBefore")), m_SpamBefore));
     }
-    if(m_SpamAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_SpamAfter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("spamAfter")), m_SpamAfter));
     }
-    if(m_PermanentFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_PermanentFlag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("permanentFlag")), fromPermanentFlagEnum(m_PermanentFlag)));
     }
-    if(m_ApprovedBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_ApprovedBefore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approvedBefore")), m_ApprovedBefore));
     }
-    if(m_ApprovedAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_ApprovedAfter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approvedAfter")), m_ApprovedAfter));
     }
-    if(m_ReviewedBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_ReviewedBefore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewedBefore")), m_ReviewedBefore));
     }
-    if(m_ReviewedAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_ReviewedAfter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewedAfter")), m_ReviewedAfter));
     }
-    if(m_TextBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_TextBefore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textBefore")), m_TextBefore));
     }
-    if(m_TextAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_TextAfter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textAfter")), m_TextAfter));
     }
-    if(m_ExpireBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireBefore))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireBefore")), m_ExpireBefore.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireBefore")), m_ExpireBefore));
     }
-    if(m_ExpireAfter.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAfter))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAfter")), m_ExpireAfter.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAfter")), m_ExpireAfter));
     }
-    if(m_FlagCountBefore.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCountBefore))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCountBefore")), m_FlagCountBefore.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCountBefore")), m_FlagCountBefore));
     }
-    if(m_TrustFactorBeforeIsSet)
+    if(m_FieldsSet.test(FieldBit_TrustFactorBefore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("trustFactorBefore")), m_TrustFactorBefore));
     }
-    if(m_TrustFactorAfterIsSet)
+    if(m_FieldsSet.test(FieldBit_TrustFactorAfter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("trustFactorAfter")), m_TrustFactorAfter));
     }
-    if(m_ReferencedCommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ReferencedCommentId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("referencedCommentId")), m_ReferencedCommentId));
     }
-    if(m_InvalidLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_InvalidLocale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("invalidLocale")), m_InvalidLocale));
     }
-    if(m_DetectedLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_DetectedLocale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("detectedLocale")), m_DetectedLocale));
     }
-    if(m_DetectedLanguageIsSet)
+    if(m_FieldsSet.test(FieldBit_DetectedLanguage))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("detectedLanguage")), m_DetectedLanguage));
     }
@@ -1390,17 +2469,17 @@ bool CommentLogData::isClearContent() const
 void CommentLogData::setClearContent(bool value)
 {
     m_ClearContent = value;
-    m_ClearContentIsSet = true;
+    m_FieldsSet.set(FieldBit_ClearContent);
 }
 
 bool CommentLogData::clearContentIsSet() const
 {
-    return m_ClearContentIsSet;
+    return m_FieldsSet.test(FieldBit_ClearContent);
 }
 
 void CommentLogData::unsetClearContent()
 {
-    m_ClearContentIsSet = false;
+    m_FieldsSet.reset(FieldBit_ClearContent);
 }
 bool CommentLogData::isIsDeletedUser() const
 {
@@ -1410,17 +2489,17 @@ bool CommentLogData::isIsDeletedUser() const
 void CommentLogData::setIsDeletedUser(bool value)
 {
     m_IsDeletedUser = value;
-    m_IsDeletedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeletedUser);
 }
 
 bool CommentLogData::isDeletedUserIsSet() const
 {
-    return m_IsDeletedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeletedUser);
 }
 
 void CommentLogData::unsetIsDeletedUser()
 {
-    m_IsDeletedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeletedUser);
 }
 utility::string_t CommentLogData::getPhrase() const
 {
@@ -1431,17 +2510,17 @@ utility::string_t CommentLogData::getPhrase() const
 void CommentLogData::setPhrase(const utility::string_t& value)
 {
     m_Phrase = value;
-    m_PhraseIsSet = true;
+    m_FieldsSet.set(FieldBit_Phrase);
 }
 
 bool CommentLogData::phraseIsSet() const
 {
-    return m_PhraseIsSet;
+    return m_FieldsSet.test(FieldBit_Phrase);
 }
 
 void CommentLogData::unsetPhrase()
 {
-    m_PhraseIsSet = false;
+    m_FieldsSet.reset(FieldBit_Phrase);
 }
 utility::string_t CommentLogData::getBadWord() const
 {
@@ -1452,17 +2531,17 @@ utility::string_t CommentLogData::getBadWord() const
 void CommentLogData::setBadWord(const utility::string_t& value)
 {
     m_BadWord = value;
-    m_BadWordIsSet = true;
+    m_FieldsSet.set(FieldBit_BadWord);
 }
 
 bool CommentLogData::badWordIsSet() const
 {
-    return m_BadWordIsSet;
+    return m_FieldsSet.test(FieldBit_BadWord);
 }
 
 void CommentLogData::unsetBadWord()
 {
-    m_BadWordIsSet = false;
+    m_FieldsSet.reset(FieldBit_BadWord);
 }
 utility::string_t CommentLogData::getWord() const
 {
@@ -1473,17 +2552,17 @@ utility::string_t CommentLogData::getWord() const
 void CommentLogData::setWord(const utility::string_t& value)
 {
     m_Word = value;
-    m_WordIsSet = true;
+    m_FieldsSet.set(FieldBit_Word);
 }
 
 bool CommentLogData::wordIsSet() const
 {
-    return m_WordIsSet;
+    return m_FieldsSet.test(FieldBit_Word);
 }
 
 void CommentLogData::unsetWord()
 {
-    m_WordIsSet = false;
+    m_FieldsSet.reset(FieldBit_Word);
 }
 utility::string_t CommentLogData::getLocale() const
 {
@@ -1494,17 +2573,17 @@ utility::string_t CommentLogData::getLocale() const
 void CommentLogData::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
-    m_LocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool CommentLogData::localeIsSet() const
 {
-    return m_LocaleIsSet;
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void CommentLogData::unsetLocale()
 {
-    m_LocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 utility::string_t CommentLogData::getTenantBadgeId() const
 {
@@ -1515,17 +2594,17 @@ utility::string_t CommentLogData::getTenantBadgeId() const
 void CommentLogData::setTenantBadgeId(const utility::string_t& value)
 {
     m_TenantBadgeId = value;
-    m_TenantBadgeIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantBadgeId);
 }
 
 bool CommentLogData::tenantBadgeIdIsSet() const
 {
-    return m_TenantBadgeIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantBadgeId);
 }
 
 void CommentLogData::unsetTenantBadgeId()
 {
-    m_TenantBadgeIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantBadgeId);
 }
 utility::string_t CommentLogData::getBadgeId() const
 {
@@ -1536,17 +2615,17 @@ utility::string_t CommentLogData::getBadgeId() const
 void CommentLogData::setBadgeId(const utility::string_t& value)
 {
     m_BadgeId = value;
-    m_BadgeIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BadgeId);
 }
 
 bool CommentLogData::badgeIdIsSet() const
 {
-    return m_BadgeIdIsSet;
+    return m_FieldsSet.test(FieldBit_BadgeId);
 }
 
 void CommentLogData::unsetBadgeId()
 {
-    m_BadgeIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BadgeId);
 }
 bool CommentLogData::isWasLoggedIn() const
 {
@@ -1556,17 +2635,17 @@ bool CommentLogData::isWasLoggedIn() const
 void CommentLogData::setWasLoggedIn(bool value)
 {
     m_WasLoggedIn = value;
-    m_WasLoggedInIsSet = true;
+    m_FieldsSet.set(FieldBit_WasLoggedIn);
 }
 
 bool CommentLogData::wasLoggedInIsSet() const
 {
-    return m_WasLoggedInIsSet;
+    return m_FieldsSet.test(FieldBit_WasLoggedIn);
 }
 
 void CommentLogData::unsetWasLoggedIn()
 {
-    m_WasLoggedInIsSet = false;
+    m_FieldsSet.reset(FieldBit_WasLoggedIn);
 }
 bool CommentLogData::isFoundUser() const
 {
@@ -1576,17 +2655,17 @@ bool CommentLogData::isFoundUser() const
 void CommentLogData::setFoundUser(bool value)
 {
     m_FoundUser = value;
-    m_FoundUserIsSet = true;
+    m_FieldsSet.set(FieldBit_FoundUser);
 }
 
 bool CommentLogData::foundUserIsSet() const
 {
-    return m_FoundUserIsSet;
+    return m_FieldsSet.test(FieldBit_FoundUser);
 }
 
 void CommentLogData::unsetFoundUser()
 {
-    m_FoundUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_FoundUser);
 }
 bool CommentLogData::isVerified() const
 {
@@ -1596,17 +2675,17 @@ bool CommentLogData::isVerified() const
 void CommentLogData::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool CommentLogData::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void CommentLogData::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 utility::string_t CommentLogData::getEngine() const
 {
@@ -1617,17 +2696,17 @@ utility::string_t CommentLogData::getEngine() const
 void CommentLogData::setEngine(const utility::string_t& value)
 {
     m_Engine = value;
-    m_EngineIsSet = true;
+    m_FieldsSet.set(FieldBit_Engine);
 }
 
 bool CommentLogData::engineIsSet() const
 {
-    return m_EngineIsSet;
+    return m_FieldsSet.test(FieldBit_Engine);
 }
 
 void CommentLogData::unsetEngine()
 {
-    m_EngineIsSet = false;
+    m_FieldsSet.reset(FieldBit_Engine);
 }
 utility::string_t CommentLogData::getEngineResponse() const
 {
@@ -1638,17 +2717,17 @@ utility::string_t CommentLogData::getEngineResponse() const
 void CommentLogData::setEngineResponse(const utility::string_t& value)
 {
     m_EngineResponse = value;
-    m_EngineResponseIsSet = true;
+    m_FieldsSet.set(FieldBit_EngineResponse);
 }
 
 bool CommentLogData::engineResponseIsSet() const
 {
-    return m_EngineResponseIsSet;
+    return m_FieldsSet.test(FieldBit_EngineResponse);
 }
 
 void CommentLogData::unsetEngineResponse()
 {
-    m_EngineResponseIsSet = false;
+    m_FieldsSet.reset(FieldBit_EngineResponse);
 }
 double CommentLogData::getEngineTokens() const
 {
@@ -1658,17 +2737,17 @@ double CommentLogData::getEngineTokens() const
 void CommentLogData::setEngineTokens(double value)
 {
     m_EngineTokens = value;
-    m_EngineTokensIsSet = true;
+    m_FieldsSet.set(FieldBit_EngineTokens);
 }
 
 bool CommentLogData::engineTokensIsSet() const
 {
-    return m_EngineTokensIsSet;
+    return m_FieldsSet.test(FieldBit_EngineTokens);
 }
 
 void CommentLogData::unsetEngineTokens()
 {
-    m_EngineTokensIsSet = false;
+    m_FieldsSet.reset(FieldBit_EngineTokens);
 }
 double CommentLogData::getTrustFactor() const
 {
@@ -1678,17 +2757,17 @@ double CommentLogData::getTrustFactor() const
 void CommentLogData::setTrustFactor(double value)
 {
     m_TrustFactor = value;
-    m_TrustFactorIsSet = true;
+    m_FieldsSet.set(FieldBit_TrustFactor);
 }
 
 bool CommentLogData::trustFactorIsSet() const
 {
-    return m_TrustFactorIsSet;
+    return m_FieldsSet.test(FieldBit_TrustFactor);
 }
 
 void CommentLogData::unsetTrustFactor()
 {
-    m_TrustFactorIsSet = false;
+    m_FieldsSet.reset(FieldBit_TrustFactor);
 }
 utility::string_t CommentLogData::getSource() const
 {
@@ -1699,17 +2778,17 @@ utility::string_t CommentLogData::getSource() const
 void CommentLogData::setSource(const utility::string_t& value)
 {
     m_Source = value;
-    m_SourceIsSet = true;
+    m_FieldsSet.set(FieldBit_Source);
 }
 
 bool CommentLogData::sourceIsSet() const
 {
-    return m_SourceIsSet;
+    return m_FieldsSet.test(FieldBit_Source);
 }
 
 void CommentLogData::unsetSource()
 {
-    m_SourceIsSet = false;
+    m_FieldsSet.reset(FieldBit_Source);
 }
 std::shared_ptr<SpamRule> CommentLogData::getRule() const
 {
@@ -1720,17 +2799,17 @@ std::shared_ptr<SpamRule> CommentLogData::getRule() const
 void CommentLogData::setRule(const std::shared_ptr<SpamRule>& value)
 {
     m_Rule = value;
-    m_RuleIsSet = true;
+    m_FieldsSet.set(FieldBit_Rule);
 }
 
 bool CommentLogData::ruleIsSet() const
 {
-    return m_RuleIsSet;
+    return m_FieldsSet.test(FieldBit_Rule);
 }
 
 void CommentLogData::unsetRule()
 {
-    m_RuleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Rule);
 }
 utility::string_t CommentLogData::getUserId() const
 {
@@ -1741,17 +2820,17 @@ utility::string_t CommentLogData::getUserId() const
 void CommentLogData::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool CommentLogData::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void CommentLogData::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 double CommentLogData::getSubscribers() const
 {
@@ -1761,17 +2840,17 @@ double CommentLogData::getSubscribers() const
 void CommentLogData::setSubscribers(double value)
 {
     m_Subscribers = value;
-    m_SubscribersIsSet = true;
+    m_FieldsSet.set(FieldBit_Subscribers);
 }
 
 bool CommentLogData::subscribersIsSet() const
 {
-    return m_SubscribersIsSet;
+    return m_FieldsSet.test(FieldBit_Subscribers);
 }
 
 void CommentLogData::unsetSubscribers()
 {
-    m_SubscribersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Subscribers);
 }
 double CommentLogData::getNotificationCount() const
 {
@@ -1781,131 +2860,137 @@ double CommentLogData::getNotificationCount() const
 void CommentLogData::setNotificationCount(double value)
 {
     m_NotificationCount = value;
-    m_NotificationCountIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationCount);
 }
 
 bool CommentLogData::notificationCountIsSet() const
 {
-    return m_NotificationCountIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationCount);
 }
 
 void CommentLogData::unsetNotificationCount()
 {
-    m_NotificationCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationCount);
 }
 double CommentLogData::getVotesBefore() const
 {
-    return m_VotesBefore.get();
+    return m_VotesBefore;
 }
 
 void CommentLogData::setVotesBefore(double value)
 {
     m_VotesBefore = value;
+    m_FieldsSet.set(FieldBit_VotesBefore);
 }
 
 bool CommentLogData::votesBeforeIsSet() const
 {
-    return m_VotesBefore.has_value();
+    return m_FieldsSet.test(FieldBit_VotesBefore);
 }
 
 void CommentLogData::unsetVotesBefore()
 {
-    m_VotesBefore.reset();
+    m_FieldsSet.reset(FieldBit_VotesBefore);
 }
 double CommentLogData::getVotesUpBefore() const
 {
-    return m_VotesUpBefore.get();
+    return m_VotesUpBefore;
 }
 
 void CommentLogData::setVotesUpBefore(double value)
 {
     m_VotesUpBefore = value;
+    m_FieldsSet.set(FieldBit_VotesUpBefore);
 }
 
 bool CommentLogData::votesUpBeforeIsSet() const
 {
-    return m_VotesUpBefore.has_value();
+    return m_FieldsSet.test(FieldBit_VotesUpBefore);
 }
 
 void CommentLogData::unsetVotesUpBefore()
 {
-    m_VotesUpBefore.reset();
+    m_FieldsSet.reset(FieldBit_VotesUpBefore);
 }
 double CommentLogData::getVotesDownBefore() const
 {
-    return m_VotesDownBefore.get();
+    return m_VotesDownBefore;
 }
 
 void CommentLogData::setVotesDownBefore(double value)
 {
     m_VotesDownBefore = value;
+    m_FieldsSet.set(FieldBit_VotesDownBefore);
 }
 
 bool CommentLogData::votesDownBeforeIsSet() const
 {
-    return m_VotesDownBefore.has_value();
+    return m_FieldsSet.test(FieldBit_VotesDownBefore);
 }
 
 void CommentLogData::unsetVotesDownBefore()
 {
-    m_VotesDownBefore.reset();
+    m_FieldsSet.reset(FieldBit_VotesDownBefore);
 }
 double CommentLogData::getVotesAfter() const
 {
-    return m_VotesAfter.get();
+    return m_VotesAfter;
 }
 
 void CommentLogData::setVotesAfter(double value)
 {
     m_VotesAfter = value;
+    m_FieldsSet.set(FieldBit_VotesAfter);
 }
 
 bool CommentLogData::votesAfterIsSet() const
 {
-    return m_VotesAfter.has_value();
+    return m_FieldsSet.test(FieldBit_VotesAfter);
 }
 
 void CommentLogData::unsetVotesAfter()
 {
-    m_VotesAfter.reset();
+    m_FieldsSet.reset(FieldBit_VotesAfter);
 }
 double CommentLogData::getVotesUpAfter() const
 {
-    return m_VotesUpAfter.get();
+    return m_VotesUpAfter;
 }
 
 void CommentLogData::setVotesUpAfter(double value)
 {
     m_VotesUpAfter = value;
+    m_FieldsSet.set(FieldBit_VotesUpAfter);
 }
 
 bool CommentLogData::votesUpAfterIsSet() const
 {
-    return m_VotesUpAfter.has_value();
+    return m_FieldsSet.test(FieldBit_VotesUpAfter);
 }
 
 void CommentLogData::unsetVotesUpAfter()
 {
-    m_VotesUpAfter.reset();
+    m_FieldsSet.reset(FieldBit_VotesUpAfter);
 }
 double CommentLogData::getVotesDownAfter() const
 {
-    return m_VotesDownAfter.get();
+    return m_VotesDownAfter;
 }
 
 void CommentLogData::setVotesDownAfter(double value)
 {
     m_VotesDownAfter = value;
+    m_FieldsSet.set(FieldBit_VotesDownAfter);
 }
 
 bool CommentLogData::votesDownAfterIsSet() const
 {
-    return m_VotesDownAfter.has_value();
+    return m_FieldsSet.test(FieldBit_VotesDownAfter);
 }
 
 void CommentLogData::unsetVotesDownAfter()
 {
-    m_VotesDownAfter.reset();
+    m_FieldsSet.reset(FieldBit_VotesDownAfter);
 }
 std::shared_ptr<RepeatCommentHandlingAction> CommentLogData::getRepeatAction() const
 {
@@ -1916,17 +3001,17 @@ std::shared_ptr<RepeatCommentHandlingAction> CommentLogData::getRepeatAction() c
 void CommentLogData::setRepeatAction(const std::shared_ptr<RepeatCommentHandlingAction>& value)
 {
     m_RepeatAction = value;
-    m_RepeatActionIsSet = true;
+    m_FieldsSet.set(FieldBit_RepeatAction);
 }
 
 bool CommentLogData::repeatActionIsSet() const
 {
-    return m_RepeatActionIsSet;
+    return m_FieldsSet.test(FieldBit_RepeatAction);
 }
 
 void CommentLogData::unsetRepeatAction()
 {
-    m_RepeatActionIsSet = false;
+    m_FieldsSet.reset(FieldBit_RepeatAction);
 }
 std::shared_ptr<RepeatCommentCheckIgnoredReason> CommentLogData::getReason() const
 {
@@ -1937,37 +3022,38 @@ std::shared_ptr<RepeatCommentCheckIgnoredReason> CommentLogData::getReason() con
 void CommentLogData::setReason(const std::shared_ptr<RepeatCommentCheckIgnoredReason>& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool CommentLogData::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void CommentLogData::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 std::shared_ptr<AnyType> CommentLogData::getOtherData() const
 {
-    return m_OtherData.get();
+    return m_OtherData;
 }
 
 
 void CommentLogData::setOtherData(const std::shared_ptr<AnyType>& value)
 {
     m_OtherData = value;
+    m_FieldsSet.set(FieldBit_OtherData);
 }
 
 bool CommentLogData::otherDataIsSet() const
 {
-    return m_OtherData.has_value();
+    return m_FieldsSet.test(FieldBit_OtherData);
 }
 
 void CommentLogData::unsetOtherData()
 {
-    m_OtherData.reset();
+    m_FieldsSet.reset(FieldBit_OtherData);
 }
 bool CommentLogData::isSpamBefore() const
 {
@@ -1977,17 +3063,17 @@ bool CommentLogData::isSpamBefore() const
 void CommentLogData::setSpamBefore(bool value)
 {
     m_SpamBefore = value;
-    m_SpamBeforeIsSet = true;
+    m_FieldsSet.set(FieldBit_SpamBefore);
 }
 
 bool CommentLogData::spamBeforeIsSet() const
 {
-    return m_SpamBeforeIsSet;
+    return m_FieldsSet.test(FieldBit_SpamBefore);
 }
 
 void CommentLogData::unsetSpamBefore()
 {
-    m_SpamBeforeIsSet = false;
+    m_FieldsSet.reset(FieldBit_SpamBefore);
 }
 bool CommentLogData::isSpamAfter() const
 {
@@ -1997,17 +3083,17 @@ bool CommentLogData::isSpamAfter() const
 void CommentLogData::setSpamAfter(bool value)
 {
     m_SpamAfter = value;
-    m_SpamAfterIsSet = true;
+    m_FieldsSet.set(FieldBit_SpamAfter);
 }
 
 bool CommentLogData::spamAfterIsSet() const
 {
-    return m_SpamAfterIsSet;
+    return m_FieldsSet.test(FieldBit_SpamAfter);
 }
 
 void CommentLogData::unsetSpamAfter()
 {
-    m_SpamAfterIsSet = false;
+    m_FieldsSet.reset(FieldBit_SpamAfter);
 }
 CommentLogData::PermanentFlagEnum CommentLogData::getPermanentFlag() const
 {
@@ -2018,17 +3104,17 @@ CommentLogData::PermanentFlagEnum CommentLogData::getPermanentFlag() const
 void CommentLogData::setPermanentFlag(const PermanentFlagEnum value)
 {
     m_PermanentFlag = value;
-    m_PermanentFlagIsSet = true;
+    m_FieldsSet.set(FieldBit_PermanentFlag);
 }
 
 bool CommentLogData::permanentFlagIsSet() const
 {
-    return m_PermanentFlagIsSet;
+    return m_FieldsSet.test(FieldBit_PermanentFlag);
 }
 
 void CommentLogData::unsetPermanentFlag()
 {
-    m_PermanentFlagIsSet = false;
+    m_FieldsSet.reset(FieldBit_PermanentFlag);
 }
 bool CommentLogData::isApprovedBefore() const
 {
@@ -2038,17 +3124,17 @@ bool CommentLogData::isApprovedBefore() const
 void CommentLogData::setApprovedBefore(bool value)
 {
     m_ApprovedBefore = value;
-    m_ApprovedBeforeIsSet = true;
+    m_FieldsSet.set(FieldBit_ApprovedBefore);
 }
 
 bool CommentLogData::approvedBeforeIsSet() const
 {
-    return m_ApprovedBeforeIsSet;
+    return m_FieldsSet.test(FieldBit_ApprovedBefore);
 }
 
 void CommentLogData::unsetApprovedBefore()
 {
-    m_ApprovedBeforeIsSet = false;
+    m_FieldsSet.reset(FieldBit_ApprovedBefore);
 }
 bool CommentLogData::isApprovedAfter() const
 {
@@ -2058,17 +3144,17 @@ bool CommentLogData::isApprovedAfter() const
 void CommentLogData::setApprovedAfter(bool value)
 {
     m_ApprovedAfter = value;
-    m_ApprovedAfterIsSet = true;
+    m_FieldsSet.set(FieldBit_ApprovedAfter);
 }
 
 bool CommentLogData::approvedAfterIsSet() const
 {
-    return m_ApprovedAfterIsSet;
+    return m_FieldsSet.test(FieldBit_ApprovedAfter);
 }
 
 void CommentLogData::unsetApprovedAfter()
 {
-    m_ApprovedAfterIsSet = false;
+    m_FieldsSet.reset(FieldBit_ApprovedAfter);
 }
 bool CommentLogData::isReviewedBefore() const
 {
@@ -2078,17 +3164,17 @@ bool CommentLogData::isReviewedBefore() const
 void CommentLogData::setReviewedBefore(bool value)
 {
     m_ReviewedBefore = value;
-    m_ReviewedBeforeIsSet = true;
+    m_FieldsSet.set(FieldBit_ReviewedBefore);
 }
 
 bool CommentLogData::reviewedBeforeIsSet() const
 {
-    return m_ReviewedBeforeIsSet;
+    return m_FieldsSet.test(FieldBit_ReviewedBefore);
 }
 
 void CommentLogData::unsetReviewedBefore()
 {
-    m_ReviewedBeforeIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReviewedBefore);
 }
 bool CommentLogData::isReviewedAfter() const
 {
@@ -2098,17 +3184,17 @@ bool CommentLogData::isReviewedAfter() const
 void CommentLogData::setReviewedAfter(bool value)
 {
     m_ReviewedAfter = value;
-    m_ReviewedAfterIsSet = true;
+    m_FieldsSet.set(FieldBit_ReviewedAfter);
 }
 
 bool CommentLogData::reviewedAfterIsSet() const
 {
-    return m_ReviewedAfterIsSet;
+    return m_FieldsSet.test(FieldBit_ReviewedAfter);
 }
 
 void CommentLogData::unsetReviewedAfter()
 {
-    m_ReviewedAfterIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReviewedAfter);
 }
 utility::string_t CommentLogData::getTextBefore() const
 {
@@ -2119,17 +3205,17 @@ utility::string_t CommentLogData::getTextBefore() const
 void CommentLogData::setTextBefore(const utility::string_t& value)
 {
     m_TextBefore = value;
-    m_TextBeforeIsSet = true;
+    m_FieldsSet.set(FieldBit_TextBefore);
 }
 
 bool CommentLogData::textBeforeIsSet() const
 {
-    return m_TextBeforeIsSet;
+    return m_FieldsSet.test(FieldBit_TextBefore);
 }
 
 void CommentLogData::unsetTextBefore()
 {
-    m_TextBeforeIsSet = false;
+    m_FieldsSet.reset(FieldBit_TextBefore);
 }
 utility::string_t CommentLogData::getTextAfter() const
 {
@@ -2140,76 +3226,79 @@ utility::string_t CommentLogData::getTextAfter() const
 void CommentLogData::setTextAfter(const utility::string_t& value)
 {
     m_TextAfter = value;
-    m_TextAfterIsSet = true;
+    m_FieldsSet.set(FieldBit_TextAfter);
 }
 
 bool CommentLogData::textAfterIsSet() const
 {
-    return m_TextAfterIsSet;
+    return m_FieldsSet.test(FieldBit_TextAfter);
 }
 
 void CommentLogData::unsetTextAfter()
 {
-    m_TextAfterIsSet = false;
+    m_FieldsSet.reset(FieldBit_TextAfter);
 }
 utility::datetime CommentLogData::getExpireBefore() const
 {
-    return m_ExpireBefore.get();
+    return m_ExpireBefore;
 }
 
 
 void CommentLogData::setExpireBefore(const utility::datetime& value)
 {
     m_ExpireBefore = value;
+    m_FieldsSet.set(FieldBit_ExpireBefore);
 }
 
 bool CommentLogData::expireBeforeIsSet() const
 {
-    return m_ExpireBefore.has_value();
+    return m_FieldsSet.test(FieldBit_ExpireBefore);
 }
 
 void CommentLogData::unsetExpireBefore()
 {
-    m_ExpireBefore.reset();
+    m_FieldsSet.reset(FieldBit_ExpireBefore);
 }
 utility::datetime CommentLogData::getExpireAfter() const
 {
-    return m_ExpireAfter.get();
+    return m_ExpireAfter;
 }
 
 
 void CommentLogData::setExpireAfter(const utility::datetime& value)
 {
     m_ExpireAfter = value;
+    m_FieldsSet.set(FieldBit_ExpireAfter);
 }
 
 bool CommentLogData::expireAfterIsSet() const
 {
-    return m_ExpireAfter.has_value();
+    return m_FieldsSet.test(FieldBit_ExpireAfter);
 }
 
 void CommentLogData::unsetExpireAfter()
 {
-    m_ExpireAfter.reset();
+    m_FieldsSet.reset(FieldBit_ExpireAfter);
 }
 double CommentLogData::getFlagCountBefore() const
 {
-    return m_FlagCountBefore.get();
+    return m_FlagCountBefore;
 }
 
 void CommentLogData::setFlagCountBefore(double value)
 {
     m_FlagCountBefore = value;
+    m_FieldsSet.set(FieldBit_FlagCountBefore);
 }
 
 bool CommentLogData::flagCountBeforeIsSet() const
 {
-    return m_FlagCountBefore.has_value();
+    return m_FieldsSet.test(FieldBit_FlagCountBefore);
 }
 
 void CommentLogData::unsetFlagCountBefore()
 {
-    m_FlagCountBefore.reset();
+    m_FieldsSet.reset(FieldBit_FlagCountBefore);
 }
 double CommentLogData::getTrustFactorBefore() const
 {
@@ -2219,17 +3308,17 @@ double CommentLogData::getTrustFactorBefore() const
 void CommentLogData::setTrustFactorBefore(double value)
 {
     m_TrustFactorBefore = value;
-    m_TrustFactorBeforeIsSet = true;
+    m_FieldsSet.set(FieldBit_TrustFactorBefore);
 }
 
 bool CommentLogData::trustFactorBeforeIsSet() const
 {
-    return m_TrustFactorBeforeIsSet;
+    return m_FieldsSet.test(FieldBit_TrustFactorBefore);
 }
 
 void CommentLogData::unsetTrustFactorBefore()
 {
-    m_TrustFactorBeforeIsSet = false;
+    m_FieldsSet.reset(FieldBit_TrustFactorBefore);
 }
 double CommentLogData::getTrustFactorAfter() const
 {
@@ -2239,17 +3328,17 @@ double CommentLogData::getTrustFactorAfter() const
 void CommentLogData::setTrustFactorAfter(double value)
 {
     m_TrustFactorAfter = value;
-    m_TrustFactorAfterIsSet = true;
+    m_FieldsSet.set(FieldBit_TrustFactorAfter);
 }
 
 bool CommentLogData::trustFactorAfterIsSet() const
 {
-    return m_TrustFactorAfterIsSet;
+    return m_FieldsSet.test(FieldBit_TrustFactorAfter);
 }
 
 void CommentLogData::unsetTrustFactorAfter()
 {
-    m_TrustFactorAfterIsSet = false;
+    m_FieldsSet.reset(FieldBit_TrustFactorAfter);
 }
 utility::string_t CommentLogData::getReferencedCommentId() const
 {
@@ -2260,17 +3349,17 @@ utility::string_t CommentLogData::getReferencedCommentId() const
 void CommentLogData::setReferencedCommentId(const utility::string_t& value)
 {
     m_ReferencedCommentId = value;
-    m_ReferencedCommentIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ReferencedCommentId);
 }
 
 bool CommentLogData::referencedCommentIdIsSet() const
 {
-    return m_ReferencedCommentIdIsSet;
+    return m_FieldsSet.test(FieldBit_ReferencedCommentId);
 }
 
 void CommentLogData::unsetReferencedCommentId()
 {
-    m_ReferencedCommentIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReferencedCommentId);
 }
 utility::string_t CommentLogData::getInvalidLocale() const
 {
@@ -2281,17 +3370,17 @@ utility::string_t CommentLogData::getInvalidLocale() const
 void CommentLogData::setInvalidLocale(const utility::string_t& value)
 {
     m_InvalidLocale = value;
-    m_InvalidLocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_InvalidLocale);
 }
 
 bool CommentLogData::invalidLocaleIsSet() const
 {
-    return m_InvalidLocaleIsSet;
+    return m_FieldsSet.test(FieldBit_InvalidLocale);
 }
 
 void CommentLogData::unsetInvalidLocale()
 {
-    m_InvalidLocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_InvalidLocale);
 }
 utility::string_t CommentLogData::getDetectedLocale() const
 {
@@ -2302,17 +3391,17 @@ utility::string_t CommentLogData::getDetectedLocale() const
 void CommentLogData::setDetectedLocale(const utility::string_t& value)
 {
     m_DetectedLocale = value;
-    m_DetectedLocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_DetectedLocale);
 }
 
 bool CommentLogData::detectedLocaleIsSet() const
 {
-    return m_DetectedLocaleIsSet;
+    return m_FieldsSet.test(FieldBit_DetectedLocale);
 }
 
 void CommentLogData::unsetDetectedLocale()
 {
-    m_DetectedLocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_DetectedLocale);
 }
 utility::string_t CommentLogData::getDetectedLanguage() const
 {
@@ -2323,17 +3412,17 @@ utility::string_t CommentLogData::getDetectedLanguage() const
 void CommentLogData::setDetectedLanguage(const utility::string_t& value)
 {
     m_DetectedLanguage = value;
-    m_DetectedLanguageIsSet = true;
+    m_FieldsSet.set(FieldBit_DetectedLanguage);
 }
 
 bool CommentLogData::detectedLanguageIsSet() const
 {
-    return m_DetectedLanguageIsSet;
+    return m_FieldsSet.test(FieldBit_DetectedLanguage);
 }
 
 void CommentLogData::unsetDetectedLanguage()
 {
-    m_DetectedLanguageIsSet = false;
+    m_FieldsSet.reset(FieldBit_DetectedLanguage);
 }
 
 }
@@ -20,10 +20,6 @@ namespace model {
 
 CommentLogEntry::CommentLogEntry()
 {
-    m_d = utility::datetime();
-    m_dIsSet = false;
-    m_tIsSet = false;
-    m_DaIsSet = false;
 }
 
 CommentLogEntry::~CommentLogEntry()
@@ -38,17 +34,17 @@ void CommentLogEntry::validate()
 web::json::value CommentLogEntry::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_dIsSet)
+    if(m_FieldsSet.test(FieldBit_d))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("d"))] = ModelBase::toJson(m_d);
     }
-    if(m_tIsSet)
+    if(m_FieldsSet.test(FieldBit_t))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("t"))] = ModelBase::toJson(m_t);
     }
-    if(m_DaIsSet)
+    if(m_FieldsSet.test(FieldBit_Da))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("da"))] = ModelBase::toJson(m_Da);
@@ -57,43 +53,153 @@ web::json::value CommentLogEntry::toJson() const
     return val;
 }
 
+void CommentLogEntry::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_d))
+    {
+        
+        writer.key(_XPLATSTR("d"));
+        ModelBase::writeJson(writer, m_d);
+    }
+    if(m_FieldsSet.test(FieldBit_t))
+    {
+        
+        writer.key(_XPLATSTR("t"));
+        ModelBase::writeJson(writer, m_t);
+    }
+    if(m_FieldsSet.test(FieldBit_Da))
+    {
+        
+        writer.key(_XPLATSTR("da"));
+        ModelBase::writeJson(writer, m_Da);
+    }
+
+    writer.endObject();
+}
+
 bool CommentLogEntry::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("d"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("d")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setD;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setD);
-            setD(refVal_setD);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("t"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("t")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<CommentLogType> refVal_setT;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setT);
-            setT(refVal_setT);
-            
+        case ModelBase::fieldHash(_XPLATSTR("d")):
+            if(field.first == _XPLATSTR("d"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setD;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setD);
+                    setD(refVal_setD);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("t")):
+            if(field.first == _XPLATSTR("t"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CommentLogType> refVal_setT;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setT);
+                    setT(refVal_setT);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("da")):
+            if(field.first == _XPLATSTR("da"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CommentLogData> refVal_setDa;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDa);
+                    setDa(refVal_setDa);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("da"))))
+    return ok;
+}
+
+void CommentLogEntry::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_d))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("d")), m_d);
+    }
+    if(m_FieldsSet.test(FieldBit_t))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("t")), m_t);
+    }
+    if(m_FieldsSet.test(FieldBit_Da))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("da")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("da")), m_Da);
+    }
+}
+
+bool CommentLogEntry::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<CommentLogData> refVal_setDa;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDa);
-            setDa(refVal_setDa);
-            
+        case ModelBase::fieldHash(_XPLATSTR("d")):
+            {
+                utility::datetime refVal_setD;
+                if(!ModelBase::readBinary(reader, field, refVal_setD))
+                {
+                    ok = false;
+                    continue;
+                }
+                setD(refVal_setD);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("t")):
+            {
+                std::shared_ptr<CommentLogType> refVal_setT;
+                if(!ModelBase::readBinary(reader, field, refVal_setT))
+                {
+                    ok = false;
+                    continue;
+                }
+                setT(refVal_setT);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("da")):
+            {
+                std::shared_ptr<CommentLogData> refVal_setDa;
+                if(!ModelBase::readBinary(reader, field, refVal_setDa))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDa(refVal_setDa);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CommentLogEntry::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -103,15 +209,15 @@ void CommentLogEntry::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_dIsSet)
+    if(m_FieldsSet.test(FieldBit_d))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("d")), m_d));
     }
-    if(m_tIsSet)
+    if(m_FieldsSet.test(FieldBit_t))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("t")), m_t));
     }
-    if(m_DaIsSet)
+    if(m_FieldsSet.test(FieldBit_Da))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("da")), m_Da));
     }
@@ -157,17 +263,17 @@ utility::datetime CommentLogEntry::getD() const
 void CommentLogEntry::setD(const utility::datetime& value)
 {
     m_d = value;
-    m_dIsSet = true;
+    m_FieldsSet.set(FieldBit_d);
 }
 
 bool CommentLogEntry::DIsSet() const
 {
-    return m_dIsSet;
+    return m_FieldsSet.test(FieldBit_d);
 }
 
 void CommentLogEntry::unsetd()
 {
-    m_dIsSet = false;
+    m_FieldsSet.reset(FieldBit_d);
 }
 std::shared_ptr<CommentLogType> CommentLogEntry::getT() const
 {
@@ -178,17 +284,17 @@ std::shared_ptr<CommentLogType> CommentLogEntry::getT() const
 void CommentLogEntry::setT(const std::shared_ptr<CommentLogType>& value)
 {
     m_t = value;
-    m_tIsSet = true;
+    m_FieldsSet.set(FieldBit_t);
 }
 
 bool CommentLogEntry::TIsSet() const
 {
-    return m_tIsSet;
+    return m_FieldsSet.test(FieldBit_t);
 }
 
 void CommentLogEntry::unsett()
 {
-    m_tIsSet = false;
+    m_FieldsSet.reset(FieldBit_t);
 }
 std::shared_ptr<CommentLogData> CommentLogEntry::getDa() const
 {
@@ -199,17 +305,17 @@ std::shared_ptr<CommentLogData> CommentLogEntry::getDa() const
 void CommentLogEntry::setDa(const std::shared_ptr<CommentLogData>& value)
 {
     m_Da = value;
-    m_DaIsSet = true;
+    m_FieldsSet.set(FieldBit_Da);
 }
 
 bool CommentLogEntry::daIsSet() const
 {
-    return m_DaIsSet;
+    return m_FieldsSet.test(FieldBit_Da);
 }
 
 void CommentLogEntry::unsetDa()
 {
-    m_DaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Da);
 }
 
 }
@@ -20,10 +20,6 @@ namespace model {
 
 CommentTextUpdateRequest::CommentTextUpdateRequest()
 {
-    m_Comment = utility::conversions::to_string_t("");
-    m_CommentIsSet = false;
-    m_MentionsIsSet = false;
-    m_HashTagsIsSet = false;
 }
 
 CommentTextUpdateRequest::~CommentTextUpdateRequest()
@@ -38,17 +34,17 @@ void CommentTextUpdateRequest::validate()
 web::json::value CommentTextUpdateRequest::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("mentions"))] = ModelBase::toJson(m_Mentions);
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTags"))] = ModelBase::toJson(m_HashTags);
@@ -57,43 +53,153 @@ web::json::value CommentTextUpdateRequest::toJson() const
     return val;
 }
 
+void CommentTextUpdateRequest::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_Mentions))
+    {
+        
+        writer.key(_XPLATSTR("mentions"));
+        ModelBase::writeJson(writer, m_Mentions);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTags))
+    {
+        
+        writer.key(_XPLATSTR("hashTags"));
+        ModelBase::writeJson(writer, m_HashTags);
+    }
+
+    writer.endObject();
+}
+
 bool CommentTextUpdateRequest::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("mentions"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("mentions")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
-            setMentions(refVal_setMentions);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            if(field.first == _XPLATSTR("mentions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
+                    setMentions(refVal_setMentions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            if(field.first == _XPLATSTR("hashTags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
+                    setHashTags(refVal_setHashTags);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTags"))))
+    return ok;
+}
+
+void CommentTextUpdateRequest::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_Mentions))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("mentions")), m_Mentions);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTags")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTags")), m_HashTags);
+    }
+}
+
+bool CommentTextUpdateRequest::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
-            setHashTags(refVal_setHashTags);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                utility::string_t refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            {
+                std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                if(!ModelBase::readBinary(reader, field, refVal_setMentions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMentions(refVal_setMentions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            {
+                std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTags(refVal_setHashTags);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CommentTextUpdateRequest::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -103,15 +209,15 @@ void CommentTextUpdateRequest::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("mentions")), m_Mentions));
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTags")), m_HashTags));
     }
@@ -157,17 +263,17 @@ utility::string_t CommentTextUpdateRequest::getComment() const
 void CommentTextUpdateRequest::setComment(const utility::string_t& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool CommentTextUpdateRequest::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void CommentTextUpdateRequest::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 std::vector<std::shared_ptr<CommentUserMentionInfo>> CommentTextUpdateRequest::getMentions() const
 {
@@ -178,17 +284,17 @@ std::vector<std::shared_ptr<CommentUserMentionInfo>> CommentTextUpdateRequest::g
 void CommentTextUpdateRequest::setMentions(const std::vector<std::shared_ptr<CommentUserMentionInfo>>& value)
 {
     m_Mentions = value;
-    m_MentionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Mentions);
 }
 
 bool CommentTextUpdateRequest::mentionsIsSet() const
 {
-    return m_MentionsIsSet;
+    return m_FieldsSet.test(FieldBit_Mentions);
 }
 
 void CommentTextUpdateRequest::unsetMentions()
 {
-    m_MentionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Mentions);
 }
 std::vector<std::shared_ptr<CommentUserHashTagInfo>> CommentTextUpdateRequest::getHashTags() const
 {
@@ -199,17 +305,17 @@ std::vector<std::shared_ptr<CommentUserHashTagInfo>> CommentTextUpdateRequest::g
 void CommentTextUpdateRequest::setHashTags(const std::vector<std::shared_ptr<CommentUserHashTagInfo>>& value)
 {
     m_HashTags = value;
-    m_HashTagsIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTags);
 }
 
 bool CommentTextUpdateRequest::hashTagsIsSet() const
 {
-    return m_HashTagsIsSet;
+    return m_FieldsSet.test(FieldBit_HashTags);
 }
 
 void CommentTextUpdateRequest::unsetHashTags()
 {
-    m_HashTagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTags);
 }
 
 }
@@ -20,12 +20,7 @@ namespace model {
 
 CommentUserBadgeInfo::CommentUserBadgeInfo()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
     m_Type = 0;
-    m_TypeIsSet = false;
-    m_Description = utility::conversions::to_string_t("");
-    m_DescriptionIsSet = false;
 }
 
 CommentUserBadgeInfo::~CommentUserBadgeInfo()
@@ -40,158 +35,406 @@ void CommentUserBadgeInfo::validate()
 web::json::value CommentUserBadgeInfo::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("description"))] = ModelBase::toJson(m_Description);
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_DisplaySrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displaySrc"))] = ModelBase::toJson(m_DisplaySrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displaySrc"))] = ModelBase::toJson(m_DisplaySrc);
     }
-    if(m_BackgroundColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))] = ModelBase::toJson(m_BackgroundColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))] = ModelBase::toJson(m_BackgroundColor);
     }
-    if(m_BorderColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("borderColor"))] = ModelBase::toJson(m_BorderColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("borderColor"))] = ModelBase::toJson(m_BorderColor);
     }
-    if(m_TextColor.has_value())
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("textColor"))] = ModelBase::toJson(m_TextColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("textColor"))] = ModelBase::toJson(m_TextColor);
     }
-    if(m_CssClass.has_value())
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("cssClass"))] = ModelBase::toJson(m_CssClass.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("cssClass"))] = ModelBase::toJson(m_CssClass);
     }
 
     return val;
 }
 
+void CommentUserBadgeInfo::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Description))
+    {
+        
+        writer.key(_XPLATSTR("description"));
+        ModelBase::writeJson(writer, m_Description);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
+    {
+        
+        writer.key(_XPLATSTR("displaySrc"));
+        ModelBase::writeJson(writer, m_DisplaySrc);
+    }
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
+    {
+        
+        writer.key(_XPLATSTR("backgroundColor"));
+        ModelBase::writeJson(writer, m_BackgroundColor);
+    }
+    if(m_FieldsSet.test(FieldBit_BorderColor))
+    {
+        
+        writer.key(_XPLATSTR("borderColor"));
+        ModelBase::writeJson(writer, m_BorderColor);
+    }
+    if(m_FieldsSet.test(FieldBit_TextColor))
+    {
+        
+        writer.key(_XPLATSTR("textColor"));
+        ModelBase::writeJson(writer, m_TextColor);
+    }
+    if(m_FieldsSet.test(FieldBit_CssClass))
+    {
+        
+        writer.key(_XPLATSTR("cssClass"));
+        ModelBase::writeJson(writer, m_CssClass);
+    }
+
+    writer.endObject();
+}
+
 bool CommentUserBadgeInfo::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int32_t refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            if(field.first == _XPLATSTR("description"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDescription;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
+                    setDescription(refVal_setDescription);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displaySrc")):
+            if(field.first == _XPLATSTR("displaySrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplaySrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplaySrc);
+                    setDisplaySrc(refVal_setDisplaySrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("backgroundColor")):
+            if(field.first == _XPLATSTR("backgroundColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBackgroundColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBackgroundColor);
+                    setBackgroundColor(refVal_setBackgroundColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("borderColor")):
+            if(field.first == _XPLATSTR("borderColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBorderColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBorderColor);
+                    setBorderColor(refVal_setBorderColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("textColor")):
+            if(field.first == _XPLATSTR("textColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTextColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTextColor);
+                    setTextColor(refVal_setTextColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("cssClass")):
+            if(field.first == _XPLATSTR("cssClass"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCssClass;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCssClass);
+                    setCssClass(refVal_setCssClass);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("description"))))
+    return ok;
+}
+
+void CommentUserBadgeInfo::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("description")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDescription;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
-            setDescription(refVal_setDescription);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displaySrc"))))
+    if(m_FieldsSet.test(FieldBit_Description))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displaySrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplaySrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplaySrc);
-            setDisplaySrc(refVal_setDisplaySrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("description")), m_Description);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("backgroundColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBackgroundColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBackgroundColor);
-            setBackgroundColor(refVal_setBackgroundColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("borderColor"))))
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("borderColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBorderColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBorderColor);
-            setBorderColor(refVal_setBorderColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displaySrc")), m_DisplaySrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("textColor"))))
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("textColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTextColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTextColor);
-            setTextColor(refVal_setTextColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("backgroundColor")), m_BackgroundColor);
+    }
+    if(m_FieldsSet.test(FieldBit_BorderColor))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("borderColor")), m_BorderColor);
+    }
+    if(m_FieldsSet.test(FieldBit_TextColor))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("textColor")), m_TextColor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("cssClass"))))
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("cssClass")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("cssClass")), m_CssClass);
+    }
+}
+
+bool CommentUserBadgeInfo::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setCssClass;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCssClass);
-            setCssClass(refVal_setCssClass);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                int32_t refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            {
+                utility::string_t refVal_setDescription;
+                if(!ModelBase::readBinary(reader, field, refVal_setDescription))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDescription(refVal_setDescription);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displaySrc")):
+            {
+                utility::string_t refVal_setDisplaySrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplaySrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplaySrc(refVal_setDisplaySrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("backgroundColor")):
+            {
+                utility::string_t refVal_setBackgroundColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setBackgroundColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBackgroundColor(refVal_setBackgroundColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("borderColor")):
+            {
+                utility::string_t refVal_setBorderColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setBorderColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBorderColor(refVal_setBorderColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("textColor")):
+            {
+                utility::string_t refVal_setTextColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setTextColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTextColor(refVal_setTextColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("cssClass")):
+            {
+                utility::string_t refVal_setCssClass;
+                if(!ModelBase::readBinary(reader, field, refVal_setCssClass))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCssClass(refVal_setCssClass);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CommentUserBadgeInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -201,41 +444,41 @@ void CommentUserBadgeInfo::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("description")), m_Description));
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_DisplaySrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displaySrc")), m_DisplaySrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displaySrc")), m_DisplaySrc));
     }
-    if(m_BackgroundColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("backgroundColor")), m_BackgroundColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("backgroundColor")), m_BackgroundColor));
     }
-    if(m_BorderColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("borderColor")), m_BorderColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("borderColor")), m_BorderColor));
     }
-    if(m_TextColor.has_value())
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textColor")), m_TextColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textColor")), m_TextColor));
     }
-    if(m_CssClass.has_value())
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("cssClass")), m_CssClass.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("cssClass")), m_CssClass));
     }
 }
 
@@ -315,17 +558,17 @@ utility::string_t CommentUserBadgeInfo::getId() const
 void CommentUserBadgeInfo::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool CommentUserBadgeInfo::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void CommentUserBadgeInfo::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 int32_t CommentUserBadgeInfo::getType() const
 {
@@ -335,17 +578,17 @@ int32_t CommentUserBadgeInfo::getType() const
 void CommentUserBadgeInfo::setType(int32_t value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool CommentUserBadgeInfo::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void CommentUserBadgeInfo::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 utility::string_t CommentUserBadgeInfo::getDescription() const
 {
@@ -356,137 +599,143 @@ utility::string_t CommentUserBadgeInfo::getDescription() const
 void CommentUserBadgeInfo::setDescription(const utility::string_t& value)
 {
     m_Description = value;
-    m_DescriptionIsSet = true;
+    m_FieldsSet.set(FieldBit_Description);
 }
 
 bool CommentUserBadgeInfo::descriptionIsSet() const
 {
-    return m_DescriptionIsSet;
+    return m_FieldsSet.test(FieldBit_Description);
 }
 
 void CommentUserBadgeInfo::unsetDescription()
 {
-    m_DescriptionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Description);
 }
 utility::string_t CommentUserBadgeInfo::getDisplayLabel() const
 {
-    return m_DisplayLabel.get();
+    return m_DisplayLabel;
 }
 
 
 void CommentUserBadgeInfo::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool CommentUserBadgeInfo::displayLabelIsSet() const
 {
-    return m_DisplayLabel.has_value();
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void CommentUserBadgeInfo::unsetDisplayLabel()
 {
-    m_DisplayLabel.reset();
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 utility::string_t CommentUserBadgeInfo::getDisplaySrc() const
 {
-    return m_DisplaySrc.get();
+    return m_DisplaySrc;
 }
 
 
 void CommentUserBadgeInfo::setDisplaySrc(const utility::string_t& value)
 {
     m_DisplaySrc = value;
+    m_FieldsSet.set(FieldBit_DisplaySrc);
 }
 
 bool CommentUserBadgeInfo::displaySrcIsSet() const
 {
-    return m_DisplaySrc.has_value();
+    return m_FieldsSet.test(FieldBit_DisplaySrc);
 }
 
 void CommentUserBadgeInfo::unsetDisplaySrc()
 {
-    m_DisplaySrc.reset();
+    m_FieldsSet.reset(FieldBit_DisplaySrc);
 }
 utility::string_t CommentUserBadgeInfo::getBackgroundColor() const
 {
-    return m_BackgroundColor.get();
+    return m_BackgroundColor;
 }
 
 
 void CommentUserBadgeInfo::setBackgroundColor(const utility::string_t& value)
 {
     m_BackgroundColor = value;
+    m_FieldsSet.set(FieldBit_BackgroundColor);
 }
 
 bool CommentUserBadgeInfo::backgroundColorIsSet() const
 {
-    return m_BackgroundColor.has_value();
+    return m_FieldsSet.test(FieldBit_BackgroundColor);
 }
 
 void CommentUserBadgeInfo::unsetBackgroundColor()
 {
-    m_BackgroundColor.reset();
+    m_FieldsSet.reset(FieldBit_BackgroundColor);
 }
 utility::string_t CommentUserBadgeInfo::getBorderColor() const
 {
-    return m_BorderColor.get();
+    return m_BorderColor;
 }
 
 
 void CommentUserBadgeInfo::setBorderColor(const utility::string_t& value)
 {
     m_BorderColor = value;
+    m_FieldsSet.set(FieldBit_BorderColor);
 }
 
 bool CommentUserBadgeInfo::borderColorIsSet() const
 {
-    return m_BorderColor.has_value();
+    return m_FieldsSet.test(FieldBit_BorderColor);
 }
 
 void CommentUserBadgeInfo::unsetBorderColor()
 {
-    m_BorderColor.reset();
+    m_FieldsSet.reset(FieldBit_BorderColor);
 }
 utility::string_t CommentUserBadgeInfo::getTextColor() const
 {
-    return m_TextColor.get();
+    return m_TextColor;
 }
 
 
 void CommentUserBadgeInfo::setTextColor(const utility::string_t& value)
 {
     m_TextColor = value;
+    m_FieldsSet.set(FieldBit_TextColor);
 }
 
 bool CommentUserBadgeInfo::textColorIsSet() const
 {
-    return m_TextColor.has_value();
+    return m_FieldsSet.test(FieldBit_TextColor);
 }
 
 void CommentUserBadgeInfo::unsetTextColor()
 {
-    m_TextColor.reset();
+    m_FieldsSet.reset(FieldBit_TextColor);
 }
 utility::string_t CommentUserBadgeInfo::getCssClass() const
 {
-    return m_CssClass.get();
+    return m_CssClass;
 }
 
 
 void CommentUserBadgeInfo::setCssClass(const utility::string_t& value)
 {
     m_CssClass = value;
+    m_FieldsSet.set(FieldBit_CssClass);
 }
 
 bool CommentUserBadgeInfo::cssClassIsSet() const
 {
-    return m_CssClass.has_value();
+    return m_FieldsSet.test(FieldBit_CssClass);
 }
 
 void CommentUserBadgeInfo::unsetCssClass()
 {
-    m_CssClass.reset();
+    m_FieldsSet.reset(FieldBit_CssClass);
 }
 
 }
@@ -20,12 +20,7 @@ namespace model {
 
 CommentUserHashTagInfo::CommentUserHashTagInfo()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
-    m_Tag = utility::conversions::to_string_t("");
-    m_TagIsSet = false;
     m_Retain = false;
-    m_RetainIsSet = false;
 }
 
 CommentUserHashTagInfo::~CommentUserHashTagInfo()
@@ -40,22 +35,22 @@ void CommentUserHashTagInfo::validate()
 web::json::value CommentUserHashTagInfo::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_TagIsSet)
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tag"))] = ModelBase::toJson(m_Tag);
     }
-    if(m_Url.has_value())
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_RetainIsSet)
+    if(m_FieldsSet.test(FieldBit_Retain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("retain"))] = ModelBase::toJson(m_Retain);
@@ -64,54 +59,187 @@ web::json::value CommentUserHashTagInfo::toJson() const
     return val;
 }
 
+void CommentUserHashTagInfo::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_Tag))
+    {
+        
+        writer.key(_XPLATSTR("tag"));
+        ModelBase::writeJson(writer, m_Tag);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_Retain))
+    {
+        
+        writer.key(_XPLATSTR("retain"));
+        ModelBase::writeJson(writer, m_Retain);
+    }
+
+    writer.endObject();
+}
+
 bool CommentUserHashTagInfo::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tag"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tag")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTag);
-            setTag(refVal_setTag);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tag")):
+            if(field.first == _XPLATSTR("tag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTag);
+                    setTag(refVal_setTag);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("retain")):
+            if(field.first == _XPLATSTR("retain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setRetain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRetain);
+                    setRetain(refVal_setRetain);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    return ok;
+}
+
+void CommentUserHashTagInfo::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("retain"))))
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("retain")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tag")), m_Tag);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_Retain))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("retain")), m_Retain);
+    }
+}
+
+bool CommentUserHashTagInfo::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setRetain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRetain);
-            setRetain(refVal_setRetain);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tag")):
+            {
+                utility::string_t refVal_setTag;
+                if(!ModelBase::readBinary(reader, field, refVal_setTag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTag(refVal_setTag);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("retain")):
+            {
+                bool refVal_setRetain;
+                if(!ModelBase::readBinary(reader, field, refVal_setRetain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRetain(refVal_setRetain);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CommentUserHashTagInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -121,19 +249,19 @@ void CommentUserHashTagInfo::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_TagIsSet)
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tag")), m_Tag));
     }
-    if(m_Url.has_value())
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_RetainIsSet)
+    if(m_FieldsSet.test(FieldBit_Retain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("retain")), m_Retain));
     }
@@ -185,17 +313,17 @@ utility::string_t CommentUserHashTagInfo::getId() const
 void CommentUserHashTagInfo::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool CommentUserHashTagInfo::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void CommentUserHashTagInfo::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 utility::string_t CommentUserHashTagInfo::getTag() const
 {
@@ -206,37 +334,38 @@ utility::string_t CommentUserHashTagInfo::getTag() const
 void CommentUserHashTagInfo::setTag(const utility::string_t& value)
 {
     m_Tag = value;
-    m_TagIsSet = true;
+    m_FieldsSet.set(FieldBit_Tag);
 }
 
 bool CommentUserHashTagInfo::tagIsSet() const
 {
-    return m_TagIsSet;
+    return m_FieldsSet.test(FieldBit_Tag);
 }
 
 void CommentUserHashTagInfo::unsetTag()
 {
-    m_TagIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tag);
 }
 utility::string_t CommentUserHashTagInfo::getUrl() const
 {
-    return m_Url.get();
+    return m_Url;
 }
 
 
 void CommentUserHashTagInfo::setUrl(const utility::string_t& value)
 {
     m_Url = value;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool CommentUserHashTagInfo::urlIsSet() const
 {
-    return m_Url.has_value();
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void CommentUserHashTagInfo::unsetUrl()
 {
-    m_Url.reset();
+    m_FieldsSet.reset(FieldBit_Url);
 }
 bool CommentUserHashTagInfo::isRetain() const
 {
@@ -246,17 +375,17 @@ bool CommentUserHashTagInfo::isRetain() const
 void CommentUserHashTagInfo::setRetain(bool value)
 {
     m_Retain = value;
-    m_RetainIsSet = true;
+    m_FieldsSet.set(FieldBit_Retain);
 }
 
 bool CommentUserHashTagInfo::retainIsSet() const
 {
-    return m_RetainIsSet;
+    return m_FieldsSet.test(FieldBit_Retain);
 }
 
 void CommentUserHashTagInfo::unsetRetain()
 {
-    m_RetainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Retain);
 }
 
 }
@@ -20,15 +20,7 @@ namespace model {
 
 CommentUserMentionInfo::CommentUserMentionInfo()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
-    m_Tag = utility::conversions::to_string_t("");
-    m_TagIsSet = false;
-    m_RawTag = utility::conversions::to_string_t("");
-    m_RawTagIsSet = false;
-    m_TypeIsSet = false;
     m_Sent = false;
-    m_SentIsSet = false;
 }
 
 CommentUserMentionInfo::~CommentUserMentionInfo()
@@ -43,29 +35,29 @@ void CommentUserMentionInfo::validate()
 web::json::value CommentUserMentionInfo::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_TagIsSet)
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tag"))] = ModelBase::toJson(m_Tag);
     }
-    if(m_RawTagIsSet)
+    if(m_FieldsSet.test(FieldBit_RawTag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("rawTag"))] = ModelBase::toJson(m_RawTag);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         utility::string_t refVal = fromTypeEnum(m_Type);
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_SentIsSet)
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sent"))] = ModelBase::toJson(m_Sent);
@@ -74,66 +66,225 @@ web::json::value CommentUserMentionInfo::toJson() const
     return val;
 }
 
+void CommentUserMentionInfo::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_Tag))
+    {
+        
+        writer.key(_XPLATSTR("tag"));
+        ModelBase::writeJson(writer, m_Tag);
+    }
+    if(m_FieldsSet.test(FieldBit_RawTag))
+    {
+        
+        writer.key(_XPLATSTR("rawTag"));
+        ModelBase::writeJson(writer, m_RawTag);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        utility::string_t refVal = fromTypeEnum(m_Type);
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Sent))
+    {
+        
+        writer.key(_XPLATSTR("sent"));
+        ModelBase::writeJson(writer, m_Sent);
+    }
+
+    writer.endObject();
+}
+
 bool CommentUserMentionInfo::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tag"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tag")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTag);
-            setTag(refVal_setTag);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tag")):
+            if(field.first == _XPLATSTR("tag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTag);
+                    setTag(refVal_setTag);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rawTag")):
+            if(field.first == _XPLATSTR("rawTag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setRawTag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRawTag);
+                    setRawTag(refVal_setRawTag);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(toTypeEnum(refVal_setType));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sent")):
+            if(field.first == _XPLATSTR("sent"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setSent;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSent);
+                    setSent(refVal_setSent);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rawTag"))))
+    return ok;
+}
+
+void CommentUserMentionInfo::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rawTag")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setRawTag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRawTag);
-            setRawTag(refVal_setRawTag);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            
-            setType(toTypeEnum(refVal_setType));
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tag")), m_Tag);
+    }
+    if(m_FieldsSet.test(FieldBit_RawTag))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rawTag")), m_RawTag);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        utility::string_t refVal = fromTypeEnum(m_Type);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Sent))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sent")), m_Sent);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sent"))))
+}
+
+bool CommentUserMentionInfo::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sent")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            bool refVal_setSent;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSent);
-            setSent(refVal_setSent);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tag")):
+            {
+                utility::string_t refVal_setTag;
+                if(!ModelBase::readBinary(reader, field, refVal_setTag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTag(refVal_setTag);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rawTag")):
+            {
+                utility::string_t refVal_setRawTag;
+                if(!ModelBase::readBinary(reader, field, refVal_setRawTag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRawTag(refVal_setRawTag);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                utility::string_t refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(toTypeEnum(refVal_setType));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sent")):
+            {
+                bool refVal_setSent;
+                if(!ModelBase::readBinary(reader, field, refVal_setSent))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSent(refVal_setSent);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CommentUserMentionInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -143,23 +294,23 @@ void CommentUserMentionInfo::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_TagIsSet)
+    if(m_FieldsSet.test(FieldBit_Tag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tag")), m_Tag));
     }
-    if(m_RawTagIsSet)
+    if(m_FieldsSet.test(FieldBit_RawTag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rawTag")), m_RawTag));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), fromTypeEnum(m_Type)));
     }
-    if(m_SentIsSet)
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sent")), m_Sent));
     }
@@ -244,17 +395,17 @@ utility::string_t CommentUserMentionInfo::getId() const
 void CommentUserMentionInfo::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool CommentUserMentionInfo::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void CommentUserMentionInfo::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 utility::string_t CommentUserMentionInfo::getTag() const
 {
@@ -265,17 +416,17 @@ utility::string_t CommentUserMentionInfo::getTag() const
 void CommentUserMentionInfo::setTag(const utility::string_t& value)
 {
     m_Tag = value;
-    m_TagIsSet = true;
+    m_FieldsSet.set(FieldBit_Tag);
 }
 
 bool CommentUserMentionInfo::tagIsSet() const
 {
-    return m_TagIsSet;
+    return m_FieldsSet.test(FieldBit_Tag);
 }
 
 void CommentUserMentionInfo::unsetTag()
 {
-    m_TagIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tag);
 }
 utility::string_t CommentUserMentionInfo::getRawTag() const
 {
@@ -286,17 +437,17 @@ utility::string_t CommentUserMentionInfo::getRawTag() const
 void CommentUserMentionInfo::setRawTag(const utility::string_t& value)
 {
     m_RawTag = value;
-    m_RawTagIsSet = true;
+    m_FieldsSet.set(FieldBit_RawTag);
 }
 
 bool CommentUserMentionInfo::rawTagIsSet() const
 {
-    return m_RawTagIsSet;
+    return m_FieldsSet.test(FieldBit_RawTag);
 }
 
 void CommentUserMentionInfo::unsetRawTag()
 {
-    m_RawTagIsSet = false;
+    m_FieldsSet.reset(FieldBit_RawTag);
 }
 CommentUserMentionInfo::TypeEnum CommentUserMentionInfo::getType() const
 {
@@ -307,17 +458,17 @@ CommentUserMentionInfo::TypeEnum CommentUserMentionInfo::getType() const
 void CommentUserMentionInfo::setType(const TypeEnum value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool CommentUserMentionInfo::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void CommentUserMentionInfo::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 bool CommentUserMentionInfo::isSent() const
 {
@@ -327,17 +478,17 @@ bool CommentUserMentionInfo::isSent() const
 void CommentUserMentionInfo::setSent(bool value)
 {
     m_Sent = value;
-    m_SentIsSet = true;
+    m_FieldsSet.set(FieldBit_Sent);
 }
 
 bool CommentUserMentionInfo::sentIsSet() const
 {
-    return m_SentIsSet;
+    return m_FieldsSet.test(FieldBit_Sent);
 }
 
 void CommentUserMentionInfo::unsetSent()
 {
-    m_SentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sent);
 }
 
 }
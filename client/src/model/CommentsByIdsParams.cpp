@@ -20,7 +20,6 @@ namespace model {
 
 CommentsByIdsParams::CommentsByIdsParams()
 {
-    m_IdsIsSet = false;
 }
 
 CommentsByIdsParams::~CommentsByIdsParams()
@@ -35,7 +34,7 @@ void CommentsByIdsParams::validate()
 web::json::value CommentsByIdsParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ids))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ids"))] = ModelBase::toJson(m_Ids);
@@ -44,23 +43,87 @@ web::json::value CommentsByIdsParams::toJson() const
     return val;
 }
 
+void CommentsByIdsParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Ids))
+    {
+        
+        writer.key(_XPLATSTR("ids"));
+        ModelBase::writeJson(writer, m_Ids);
+    }
+
+    writer.endObject();
+}
+
 bool CommentsByIdsParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ids"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ids")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIds);
-            setIds(refVal_setIds);
-            
+        case ModelBase::fieldHash(_XPLATSTR("ids")):
+            if(field.first == _XPLATSTR("ids"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIds);
+                    setIds(refVal_setIds);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void CommentsByIdsParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Ids))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ids")), m_Ids);
+    }
+}
+
+bool CommentsByIdsParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("ids")):
+            {
+                std::vector<utility::string_t> refVal_setIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIds(refVal_setIds);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void CommentsByIdsParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void CommentsByIdsParams::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ids))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ids")), m_Ids));
     }
@@ -102,17 +165,17 @@ std::vector<utility::string_t> CommentsByIdsParams::getIds() const
 void CommentsByIdsParams::setIds(const std::vector<utility::string_t>& value)
 {
     m_Ids = value;
-    m_IdsIsSet = true;
+    m_FieldsSet.set(FieldBit_Ids);
 }
 
 bool CommentsByIdsParams::idsIsSet() const
 {
-    return m_IdsIsSet;
+    return m_FieldsSet.test(FieldBit_Ids);
 }
 
 void CommentsByIdsParams::unsetIds()
 {
-    m_IdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ids);
 }
 
 }
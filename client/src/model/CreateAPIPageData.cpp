@@ -20,17 +20,8 @@ namespace model {
 
 CreateAPIPageData::CreateAPIPageData()
 {
-    m_AccessibleByGroupIdsIsSet = false;
     m_RootCommentCount = 0L;
-    m_RootCommentCountIsSet = false;
     m_CommentCount = 0L;
-    m_CommentCountIsSet = false;
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
 }
 
 CreateAPIPageData::~CreateAPIPageData()
@@ -45,32 +36,32 @@ void CreateAPIPageData::validate()
 web::json::value CreateAPIPageData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_AccessibleByGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds"))] = ModelBase::toJson(m_AccessibleByGroupIds);
     }
-    if(m_RootCommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("rootCommentCount"))] = ModelBase::toJson(m_RootCommentCount);
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentCount"))] = ModelBase::toJson(m_CommentCount);
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
@@ -79,76 +70,255 @@ web::json::value CreateAPIPageData::toJson() const
     return val;
 }
 
+void CreateAPIPageData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("accessibleByGroupIds"));
+        ModelBase::writeJson(writer, m_AccessibleByGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
+    {
+        
+        writer.key(_XPLATSTR("rootCommentCount"));
+        ModelBase::writeJson(writer, m_RootCommentCount);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        writer.key(_XPLATSTR("commentCount"));
+        ModelBase::writeJson(writer, m_CommentCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+
+    writer.endObject();
+}
+
 bool CreateAPIPageData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAccessibleByGroupIds);
-            setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rootCommentCount"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rootCommentCount")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int64_t refVal_setRootCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRootCommentCount);
-            setRootCommentCount(refVal_setRootCommentCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")):
+            if(field.first == _XPLATSTR("accessibleByGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAccessibleByGroupIds);
+                    setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rootCommentCount")):
+            if(field.first == _XPLATSTR("rootCommentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setRootCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRootCommentCount);
+                    setRootCommentCount(refVal_setRootCommentCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            if(field.first == _XPLATSTR("commentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
+                    setCommentCount(refVal_setCommentCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCount"))))
+    return ok;
+}
+
+void CreateAPIPageData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
-            setCommentCount(refVal_setCommentCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")), m_AccessibleByGroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rootCommentCount")), m_RootCommentCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCount")), m_CommentCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_Title))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
+    }
+}
+
+bool CreateAPIPageData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setAccessibleByGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rootCommentCount")):
+            {
+                int64_t refVal_setRootCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setRootCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRootCommentCount(refVal_setRootCommentCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            {
+                int64_t refVal_setCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCount(refVal_setCommentCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateAPIPageData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -158,27 +328,27 @@ void CreateAPIPageData::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_AccessibleByGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds")), m_AccessibleByGroupIds));
     }
-    if(m_RootCommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_RootCommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rootCommentCount")), m_RootCommentCount));
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCount")), m_CommentCount));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
@@ -242,17 +412,17 @@ std::vector<utility::string_t> CreateAPIPageData::getAccessibleByGroupIds() cons
 void CreateAPIPageData::setAccessibleByGroupIds(const std::vector<utility::string_t>& value)
 {
     m_AccessibleByGroupIds = value;
-    m_AccessibleByGroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_AccessibleByGroupIds);
 }
 
 bool CreateAPIPageData::accessibleByGroupIdsIsSet() const
 {
-    return m_AccessibleByGroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_AccessibleByGroupIds);
 }
 
 void CreateAPIPageData::unsetAccessibleByGroupIds()
 {
-    m_AccessibleByGroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AccessibleByGroupIds);
 }
 int64_t CreateAPIPageData::getRootCommentCount() const
 {
@@ -262,17 +432,17 @@ int64_t CreateAPIPageData::getRootCommentCount() const
 void CreateAPIPageData::setRootCommentCount(int64_t value)
 {
     m_RootCommentCount = value;
-    m_RootCommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_RootCommentCount);
 }
 
 bool CreateAPIPageData::rootCommentCountIsSet() const
 {
-    return m_RootCommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_RootCommentCount);
 }
 
 void CreateAPIPageData::unsetRootCommentCount()
 {
-    m_RootCommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_RootCommentCount);
 }
 int64_t CreateAPIPageData::getCommentCount() const
 {
@@ -282,17 +452,17 @@ int64_t CreateAPIPageData::getCommentCount() const
 void CreateAPIPageData::setCommentCount(int64_t value)
 {
     m_CommentCount = value;
-    m_CommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentCount);
 }
 
 bool CreateAPIPageData::commentCountIsSet() const
 {
-    return m_CommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_CommentCount);
 }
 
 void CreateAPIPageData::unsetCommentCount()
 {
-    m_CommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentCount);
 }
 utility::string_t CreateAPIPageData::getTitle() const
 {
@@ -303,17 +473,17 @@ utility::string_t CreateAPIPageData::getTitle() const
 void CreateAPIPageData::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool CreateAPIPageData::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void CreateAPIPageData::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t CreateAPIPageData::getUrl() const
 {
@@ -324,17 +494,17 @@ utility::string_t CreateAPIPageData::getUrl() const
 void CreateAPIPageData::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool CreateAPIPageData::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void CreateAPIPageData::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t CreateAPIPageData::getUrlId() const
 {
@@ -345,17 +515,17 @@ utility::string_t CreateAPIPageData::getUrlId() const
 void CreateAPIPageData::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool CreateAPIPageData::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void CreateAPIPageData::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 
 }
@@ -20,45 +20,17 @@ namespace model {
 
 CreateAPISSOUserData::CreateAPISSOUserData()
 {
-    m_GroupIdsIsSet = false;
     m_HasBlockedUsers = false;
-    m_HasBlockedUsersIsSet = false;
     m_IsProfileDMDisabled = false;
-    m_IsProfileDMDisabledIsSet = false;
     m_IsProfileCommentsPrivate = false;
-    m_IsProfileCommentsPrivateIsSet = false;
     m_IsProfileActivityPrivate = false;
-    m_IsProfileActivityPrivateIsSet = false;
     m_IsCommentModeratorAdmin = false;
-    m_IsCommentModeratorAdminIsSet = false;
     m_IsAdminAdmin = false;
-    m_IsAdminAdminIsSet = false;
     m_IsAccountOwner = false;
-    m_IsAccountOwnerIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_DisplayLabel = utility::conversions::to_string_t("");
-    m_DisplayLabelIsSet = false;
     m_OptedInSubscriptionNotifications = false;
-    m_OptedInSubscriptionNotificationsIsSet = false;
     m_OptedInNotifications = false;
-    m_OptedInNotificationsIsSet = false;
-    m_AvatarSrc = utility::conversions::to_string_t("");
-    m_AvatarSrcIsSet = false;
     m_LoginCount = 0;
-    m_LoginCountIsSet = false;
-    m_CreatedFromUrlId = utility::conversions::to_string_t("");
-    m_CreatedFromUrlIdIsSet = false;
     m_SignUpDate = 0L;
-    m_SignUpDateIsSet = false;
-    m_Email = utility::conversions::to_string_t("");
-    m_EmailIsSet = false;
-    m_WebsiteUrl = utility::conversions::to_string_t("");
-    m_WebsiteUrlIsSet = false;
-    m_Username = utility::conversions::to_string_t("");
-    m_UsernameIsSet = false;
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
 }
 
 CreateAPISSOUserData::~CreateAPISSOUserData()
@@ -73,102 +45,102 @@ void CreateAPISSOUserData::validate()
 web::json::value CreateAPISSOUserData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_GroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("groupIds"))] = ModelBase::toJson(m_GroupIds);
     }
-    if(m_HasBlockedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers"))] = ModelBase::toJson(m_HasBlockedUsers);
     }
-    if(m_IsProfileDMDisabledIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled"))] = ModelBase::toJson(m_IsProfileDMDisabled);
     }
-    if(m_IsProfileCommentsPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate"))] = ModelBase::toJson(m_IsProfileCommentsPrivate);
     }
-    if(m_IsProfileActivityPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate"))] = ModelBase::toJson(m_IsProfileActivityPrivate);
     }
-    if(m_IsCommentModeratorAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin"))] = ModelBase::toJson(m_IsCommentModeratorAdmin);
     }
-    if(m_IsAdminAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin"))] = ModelBase::toJson(m_IsAdminAdmin);
     }
-    if(m_IsAccountOwnerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAccountOwner"))] = ModelBase::toJson(m_IsAccountOwner);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_OptedInSubscriptionNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInSubscriptionNotifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedInSubscriptionNotifications"))] = ModelBase::toJson(m_OptedInSubscriptionNotifications);
     }
-    if(m_OptedInNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedInNotifications"))] = ModelBase::toJson(m_OptedInNotifications);
     }
-    if(m_AvatarSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_LoginCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("loginCount"))] = ModelBase::toJson(m_LoginCount);
     }
-    if(m_CreatedFromUrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId"))] = ModelBase::toJson(m_CreatedFromUrlId);
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("signUpDate"))] = ModelBase::toJson(m_SignUpDate);
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_WebsiteUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))] = ModelBase::toJson(m_WebsiteUrl);
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
@@ -177,230 +149,731 @@ web::json::value CreateAPISSOUserData::toJson() const
     return val;
 }
 
+void CreateAPISSOUserData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_GroupIds))
+    {
+        
+        writer.key(_XPLATSTR("groupIds"));
+        ModelBase::writeJson(writer, m_GroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
+    {
+        
+        writer.key(_XPLATSTR("hasBlockedUsers"));
+        ModelBase::writeJson(writer, m_HasBlockedUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
+    {
+        
+        writer.key(_XPLATSTR("isProfileDMDisabled"));
+        ModelBase::writeJson(writer, m_IsProfileDMDisabled);
+    }
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
+    {
+        
+        writer.key(_XPLATSTR("isProfileCommentsPrivate"));
+        ModelBase::writeJson(writer, m_IsProfileCommentsPrivate);
+    }
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
+    {
+        
+        writer.key(_XPLATSTR("isProfileActivityPrivate"));
+        ModelBase::writeJson(writer, m_IsProfileActivityPrivate);
+    }
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isCommentModeratorAdmin"));
+        ModelBase::writeJson(writer, m_IsCommentModeratorAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isAdminAdmin"));
+        ModelBase::writeJson(writer, m_IsAdminAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
+    {
+        
+        writer.key(_XPLATSTR("isAccountOwner"));
+        ModelBase::writeJson(writer, m_IsAccountOwner);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedInSubscriptionNotifications))
+    {
+        
+        writer.key(_XPLATSTR("optedInSubscriptionNotifications"));
+        ModelBase::writeJson(writer, m_OptedInSubscriptionNotifications);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
+    {
+        
+        writer.key(_XPLATSTR("optedInNotifications"));
+        ModelBase::writeJson(writer, m_OptedInNotifications);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_LoginCount))
+    {
+        
+        writer.key(_XPLATSTR("loginCount"));
+        ModelBase::writeJson(writer, m_LoginCount);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
+    {
+        
+        writer.key(_XPLATSTR("createdFromUrlId"));
+        ModelBase::writeJson(writer, m_CreatedFromUrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
+    {
+        
+        writer.key(_XPLATSTR("signUpDate"));
+        ModelBase::writeJson(writer, m_SignUpDate);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
+    {
+        
+        writer.key(_XPLATSTR("websiteUrl"));
+        ModelBase::writeJson(writer, m_WebsiteUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+
+    writer.endObject();
+}
+
 bool CreateAPISSOUserData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("groupIds"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("groupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
-            setGroupIds(refVal_setGroupIds);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setHasBlockedUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasBlockedUsers);
-            setHasBlockedUsers(refVal_setHasBlockedUsers);
-            
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            if(field.first == _XPLATSTR("groupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
+                    setGroupIds(refVal_setGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")):
+            if(field.first == _XPLATSTR("hasBlockedUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasBlockedUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasBlockedUsers);
+                    setHasBlockedUsers(refVal_setHasBlockedUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileDMDisabled")):
+            if(field.first == _XPLATSTR("isProfileDMDisabled"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsProfileDMDisabled;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileDMDisabled);
+                    setIsProfileDMDisabled(refVal_setIsProfileDMDisabled);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileCommentsPrivate")):
+            if(field.first == _XPLATSTR("isProfileCommentsPrivate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsProfileCommentsPrivate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileCommentsPrivate);
+                    setIsProfileCommentsPrivate(refVal_setIsProfileCommentsPrivate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileActivityPrivate")):
+            if(field.first == _XPLATSTR("isProfileActivityPrivate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsProfileActivityPrivate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileActivityPrivate);
+                    setIsProfileActivityPrivate(refVal_setIsProfileActivityPrivate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")):
+            if(field.first == _XPLATSTR("isCommentModeratorAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsCommentModeratorAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsCommentModeratorAdmin);
+                    setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")):
+            if(field.first == _XPLATSTR("isAdminAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAdminAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAdminAdmin);
+                    setIsAdminAdmin(refVal_setIsAdminAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAccountOwner")):
+            if(field.first == _XPLATSTR("isAccountOwner"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAccountOwner;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAccountOwner);
+                    setIsAccountOwner(refVal_setIsAccountOwner);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedInSubscriptionNotifications")):
+            if(field.first == _XPLATSTR("optedInSubscriptionNotifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedInSubscriptionNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInSubscriptionNotifications);
+                    setOptedInSubscriptionNotifications(refVal_setOptedInSubscriptionNotifications);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedInNotifications")):
+            if(field.first == _XPLATSTR("optedInNotifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedInNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInNotifications);
+                    setOptedInNotifications(refVal_setOptedInNotifications);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("loginCount")):
+            if(field.first == _XPLATSTR("loginCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setLoginCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLoginCount);
+                    setLoginCount(refVal_setLoginCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")):
+            if(field.first == _XPLATSTR("createdFromUrlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedFromUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromUrlId);
+                    setCreatedFromUrlId(refVal_setCreatedFromUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            if(field.first == _XPLATSTR("signUpDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setSignUpDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
+                    setSignUpDate(refVal_setSignUpDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            if(field.first == _XPLATSTR("websiteUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWebsiteUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
+                    setWebsiteUrl(refVal_setWebsiteUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled"))))
+    return ok;
+}
+
+void CreateAPISSOUserData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsProfileDMDisabled;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileDMDisabled);
-            setIsProfileDMDisabled(refVal_setIsProfileDMDisabled);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("groupIds")), m_GroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate"))))
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsProfileCommentsPrivate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileCommentsPrivate);
-            setIsProfileCommentsPrivate(refVal_setIsProfileCommentsPrivate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")), m_HasBlockedUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate"))))
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsProfileActivityPrivate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileActivityPrivate);
-            setIsProfileActivityPrivate(refVal_setIsProfileActivityPrivate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isProfileDMDisabled")), m_IsProfileDMDisabled);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsCommentModeratorAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsCommentModeratorAdmin);
-            setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isProfileCommentsPrivate")), m_IsProfileCommentsPrivate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAdminAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAdminAdmin);
-            setIsAdminAdmin(refVal_setIsAdminAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isProfileActivityPrivate")), m_IsProfileActivityPrivate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAccountOwner"))))
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAccountOwner")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAccountOwner;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAccountOwner);
-            setIsAccountOwner(refVal_setIsAccountOwner);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")), m_IsCommentModeratorAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")), m_IsAdminAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAccountOwner")), m_IsAccountOwner);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedInSubscriptionNotifications"))))
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedInSubscriptionNotifications")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedInSubscriptionNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInSubscriptionNotifications);
-            setOptedInSubscriptionNotifications(refVal_setOptedInSubscriptionNotifications);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedInNotifications"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedInNotifications")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedInNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInNotifications);
-            setOptedInNotifications(refVal_setOptedInNotifications);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_OptedInSubscriptionNotifications))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedInSubscriptionNotifications")), m_OptedInSubscriptionNotifications);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("loginCount"))))
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("loginCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setLoginCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLoginCount);
-            setLoginCount(refVal_setLoginCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedInNotifications")), m_OptedInNotifications);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedFromUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromUrlId);
-            setCreatedFromUrlId(refVal_setCreatedFromUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("signUpDate"))))
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("signUpDate")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setSignUpDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
-            setSignUpDate(refVal_setSignUpDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("loginCount")), m_LoginCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")), m_CreatedFromUrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))))
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("websiteUrl")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWebsiteUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
-            setWebsiteUrl(refVal_setWebsiteUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("signUpDate")), m_SignUpDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("websiteUrl")), m_WebsiteUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
+    }
+}
+
+bool CreateAPISSOUserData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            {
+                std::vector<utility::string_t> refVal_setGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGroupIds(refVal_setGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")):
+            {
+                bool refVal_setHasBlockedUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasBlockedUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasBlockedUsers(refVal_setHasBlockedUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileDMDisabled")):
+            {
+                bool refVal_setIsProfileDMDisabled;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsProfileDMDisabled))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsProfileDMDisabled(refVal_setIsProfileDMDisabled);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileCommentsPrivate")):
+            {
+                bool refVal_setIsProfileCommentsPrivate;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsProfileCommentsPrivate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsProfileCommentsPrivate(refVal_setIsProfileCommentsPrivate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileActivityPrivate")):
+            {
+                bool refVal_setIsProfileActivityPrivate;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsProfileActivityPrivate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsProfileActivityPrivate(refVal_setIsProfileActivityPrivate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")):
+            {
+                bool refVal_setIsCommentModeratorAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsCommentModeratorAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")):
+            {
+                bool refVal_setIsAdminAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAdminAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAdminAdmin(refVal_setIsAdminAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAccountOwner")):
+            {
+                bool refVal_setIsAccountOwner;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAccountOwner))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAccountOwner(refVal_setIsAccountOwner);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedInSubscriptionNotifications")):
+            {
+                bool refVal_setOptedInSubscriptionNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedInSubscriptionNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedInSubscriptionNotifications(refVal_setOptedInSubscriptionNotifications);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedInNotifications")):
+            {
+                bool refVal_setOptedInNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedInNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedInNotifications(refVal_setOptedInNotifications);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("loginCount")):
+            {
+                int32_t refVal_setLoginCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setLoginCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLoginCount(refVal_setLoginCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")):
+            {
+                utility::string_t refVal_setCreatedFromUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedFromUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedFromUrlId(refVal_setCreatedFromUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            {
+                int64_t refVal_setSignUpDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setSignUpDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSignUpDate(refVal_setSignUpDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            {
+                utility::string_t refVal_setWebsiteUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setWebsiteUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWebsiteUrl(refVal_setWebsiteUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateAPISSOUserData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -410,83 +883,83 @@ void CreateAPISSOUserData::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_GroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groupIds")), m_GroupIds));
     }
-    if(m_HasBlockedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers")), m_HasBlockedUsers));
     }
-    if(m_IsProfileDMDisabledIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled")), m_IsProfileDMDisabled));
     }
-    if(m_IsProfileCommentsPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate")), m_IsProfileCommentsPrivate));
     }
-    if(m_IsProfileActivityPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate")), m_IsProfileActivityPrivate));
     }
-    if(m_IsCommentModeratorAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin")), m_IsCommentModeratorAdmin));
     }
-    if(m_IsAdminAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin")), m_IsAdminAdmin));
     }
-    if(m_IsAccountOwnerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAccountOwner")), m_IsAccountOwner));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_OptedInSubscriptionNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInSubscriptionNotifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedInSubscriptionNotifications")), m_OptedInSubscriptionNotifications));
     }
-    if(m_OptedInNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedInNotifications")), m_OptedInNotifications));
     }
-    if(m_AvatarSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_LoginCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("loginCount")), m_LoginCount));
     }
-    if(m_CreatedFromUrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId")), m_CreatedFromUrlId));
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("signUpDate")), m_SignUpDate));
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_WebsiteUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("websiteUrl")), m_WebsiteUrl));
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
@@ -634,17 +1107,17 @@ std::vector<utility::string_t> CreateAPISSOUserData::getGroupIds() const
 void CreateAPISSOUserData::setGroupIds(const std::vector<utility::string_t>& value)
 {
     m_GroupIds = value;
-    m_GroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_GroupIds);
 }
 
 bool CreateAPISSOUserData::groupIdsIsSet() const
 {
-    return m_GroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_GroupIds);
 }
 
 void CreateAPISSOUserData::unsetGroupIds()
 {
-    m_GroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_GroupIds);
 }
 bool CreateAPISSOUserData::isHasBlockedUsers() const
 {
@@ -654,17 +1127,17 @@ bool CreateAPISSOUserData::isHasBlockedUsers() const
 void CreateAPISSOUserData::setHasBlockedUsers(bool value)
 {
     m_HasBlockedUsers = value;
-    m_HasBlockedUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_HasBlockedUsers);
 }
 
 bool CreateAPISSOUserData::hasBlockedUsersIsSet() const
 {
-    return m_HasBlockedUsersIsSet;
+    return m_FieldsSet.test(FieldBit_HasBlockedUsers);
 }
 
 void CreateAPISSOUserData::unsetHasBlockedUsers()
 {
-    m_HasBlockedUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasBlockedUsers);
 }
 bool CreateAPISSOUserData::isIsProfileDMDisabled() const
 {
@@ -674,17 +1147,17 @@ bool CreateAPISSOUserData::isIsProfileDMDisabled() const
 void CreateAPISSOUserData::setIsProfileDMDisabled(bool value)
 {
     m_IsProfileDMDisabled = value;
-    m_IsProfileDMDisabledIsSet = true;
+    m_FieldsSet.set(FieldBit_IsProfileDMDisabled);
 }
 
 bool CreateAPISSOUserData::isProfileDMDisabledIsSet() const
 {
-    return m_IsProfileDMDisabledIsSet;
+    return m_FieldsSet.test(FieldBit_IsProfileDMDisabled);
 }
 
 void CreateAPISSOUserData::unsetIsProfileDMDisabled()
 {
-    m_IsProfileDMDisabledIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsProfileDMDisabled);
 }
 bool CreateAPISSOUserData::isIsProfileCommentsPrivate() const
 {
@@ -694,17 +1167,17 @@ bool CreateAPISSOUserData::isIsProfileCommentsPrivate() const
 void CreateAPISSOUserData::setIsProfileCommentsPrivate(bool value)
 {
     m_IsProfileCommentsPrivate = value;
-    m_IsProfileCommentsPrivateIsSet = true;
+    m_FieldsSet.set(FieldBit_IsProfileCommentsPrivate);
 }
 
 bool CreateAPISSOUserData::isProfileCommentsPrivateIsSet() const
 {
-    return m_IsProfileCommentsPrivateIsSet;
+    return m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate);
 }
 
 void CreateAPISSOUserData::unsetIsProfileCommentsPrivate()
 {
-    m_IsProfileCommentsPrivateIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsProfileCommentsPrivate);
 }
 bool CreateAPISSOUserData::isIsProfileActivityPrivate() const
 {
@@ -714,17 +1187,17 @@ bool CreateAPISSOUserData::isIsProfileActivityPrivate() const
 void CreateAPISSOUserData::setIsProfileActivityPrivate(bool value)
 {
     m_IsProfileActivityPrivate = value;
-    m_IsProfileActivityPrivateIsSet = true;
+    m_FieldsSet.set(FieldBit_IsProfileActivityPrivate);
 }
 
 bool CreateAPISSOUserData::isProfileActivityPrivateIsSet() const
 {
-    return m_IsProfileActivityPrivateIsSet;
+    return m_FieldsSet.test(FieldBit_IsProfileActivityPrivate);
 }
 
 void CreateAPISSOUserData::unsetIsProfileActivityPrivate()
 {
-    m_IsProfileActivityPrivateIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsProfileActivityPrivate);
 }
 bool CreateAPISSOUserData::isIsCommentModeratorAdmin() const
 {
@@ -734,17 +1207,17 @@ bool CreateAPISSOUserData::isIsCommentModeratorAdmin() const
 void CreateAPISSOUserData::setIsCommentModeratorAdmin(bool value)
 {
     m_IsCommentModeratorAdmin = value;
-    m_IsCommentModeratorAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsCommentModeratorAdmin);
 }
 
 bool CreateAPISSOUserData::isCommentModeratorAdminIsSet() const
 {
-    return m_IsCommentModeratorAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin);
 }
 
 void CreateAPISSOUserData::unsetIsCommentModeratorAdmin()
 {
-    m_IsCommentModeratorAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsCommentModeratorAdmin);
 }
 bool CreateAPISSOUserData::isIsAdminAdmin() const
 {
@@ -754,17 +1227,17 @@ bool CreateAPISSOUserData::isIsAdminAdmin() const
 void CreateAPISSOUserData::setIsAdminAdmin(bool value)
 {
     m_IsAdminAdmin = value;
-    m_IsAdminAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAdminAdmin);
 }
 
 bool CreateAPISSOUserData::isAdminAdminIsSet() const
 {
-    return m_IsAdminAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsAdminAdmin);
 }
 
 void CreateAPISSOUserData::unsetIsAdminAdmin()
 {
-    m_IsAdminAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAdminAdmin);
 }
 bool CreateAPISSOUserData::isIsAccountOwner() const
 {
@@ -774,17 +1247,17 @@ bool CreateAPISSOUserData::isIsAccountOwner() const
 void CreateAPISSOUserData::setIsAccountOwner(bool value)
 {
     m_IsAccountOwner = value;
-    m_IsAccountOwnerIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAccountOwner);
 }
 
 bool CreateAPISSOUserData::isAccountOwnerIsSet() const
 {
-    return m_IsAccountOwnerIsSet;
+    return m_FieldsSet.test(FieldBit_IsAccountOwner);
 }
 
 void CreateAPISSOUserData::unsetIsAccountOwner()
 {
-    m_IsAccountOwnerIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAccountOwner);
 }
 utility::string_t CreateAPISSOUserData::getDisplayName() const
 {
@@ -795,17 +1268,17 @@ utility::string_t CreateAPISSOUserData::getDisplayName() const
 void CreateAPISSOUserData::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool CreateAPISSOUserData::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void CreateAPISSOUserData::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::string_t CreateAPISSOUserData::getDisplayLabel() const
 {
@@ -816,17 +1289,17 @@ utility::string_t CreateAPISSOUserData::getDisplayLabel() const
 void CreateAPISSOUserData::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
-    m_DisplayLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool CreateAPISSOUserData::displayLabelIsSet() const
 {
-    return m_DisplayLabelIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void CreateAPISSOUserData::unsetDisplayLabel()
 {
-    m_DisplayLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 bool CreateAPISSOUserData::isOptedInSubscriptionNotifications() const
 {
@@ -836,17 +1309,17 @@ bool CreateAPISSOUserData::isOptedInSubscriptionNotifications() const
 void CreateAPISSOUserData::setOptedInSubscriptionNotifications(bool value)
 {
     m_OptedInSubscriptionNotifications = value;
-    m_OptedInSubscriptionNotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedInSubscriptionNotifications);
 }
 
 bool CreateAPISSOUserData::optedInSubscriptionNotificationsIsSet() const
 {
-    return m_OptedInSubscriptionNotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_OptedInSubscriptionNotifications);
 }
 
 void CreateAPISSOUserData::unsetOptedInSubscriptionNotifications()
 {
-    m_OptedInSubscriptionNotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedInSubscriptionNotifications);
 }
 bool CreateAPISSOUserData::isOptedInNotifications() const
 {
@@ -856,17 +1329,17 @@ bool CreateAPISSOUserData::isOptedInNotifications() const
 void CreateAPISSOUserData::setOptedInNotifications(bool value)
 {
     m_OptedInNotifications = value;
-    m_OptedInNotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedInNotifications);
 }
 
 bool CreateAPISSOUserData::optedInNotificationsIsSet() const
 {
-    return m_OptedInNotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_OptedInNotifications);
 }
 
 void CreateAPISSOUserData::unsetOptedInNotifications()
 {
-    m_OptedInNotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedInNotifications);
 }
 utility::string_t CreateAPISSOUserData::getAvatarSrc() const
 {
@@ -877,17 +1350,17 @@ utility::string_t CreateAPISSOUserData::getAvatarSrc() const
 void CreateAPISSOUserData::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
-    m_AvatarSrcIsSet = true;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool CreateAPISSOUserData::avatarSrcIsSet() const
 {
-    return m_AvatarSrcIsSet;
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void CreateAPISSOUserData::unsetAvatarSrc()
 {
-    m_AvatarSrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 int32_t CreateAPISSOUserData::getLoginCount() const
 {
@@ -897,17 +1370,17 @@ int32_t CreateAPISSOUserData::getLoginCount() const
 void CreateAPISSOUserData::setLoginCount(int32_t value)
 {
     m_LoginCount = value;
-    m_LoginCountIsSet = true;
+    m_FieldsSet.set(FieldBit_LoginCount);
 }
 
 bool CreateAPISSOUserData::loginCountIsSet() const
 {
-    return m_LoginCountIsSet;
+    return m_FieldsSet.test(FieldBit_LoginCount);
 }
 
 void CreateAPISSOUserData::unsetLoginCount()
 {
-    m_LoginCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_LoginCount);
 }
 utility::string_t CreateAPISSOUserData::getCreatedFromUrlId() const
 {
@@ -918,17 +1391,17 @@ utility::string_t CreateAPISSOUserData::getCreatedFromUrlId() const
 void CreateAPISSOUserData::setCreatedFromUrlId(const utility::string_t& value)
 {
     m_CreatedFromUrlId = value;
-    m_CreatedFromUrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedFromUrlId);
 }
 
 bool CreateAPISSOUserData::createdFromUrlIdIsSet() const
 {
-    return m_CreatedFromUrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedFromUrlId);
 }
 
 void CreateAPISSOUserData::unsetCreatedFromUrlId()
 {
-    m_CreatedFromUrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedFromUrlId);
 }
 int64_t CreateAPISSOUserData::getSignUpDate() const
 {
@@ -938,17 +1411,17 @@ int64_t CreateAPISSOUserData::getSignUpDate() const
 void CreateAPISSOUserData::setSignUpDate(int64_t value)
 {
     m_SignUpDate = value;
-    m_SignUpDateIsSet = true;
+    m_FieldsSet.set(FieldBit_SignUpDate);
 }
 
 bool CreateAPISSOUserData::signUpDateIsSet() const
 {
-    return m_SignUpDateIsSet;
+    return m_FieldsSet.test(FieldBit_SignUpDate);
 }
 
 void CreateAPISSOUserData::unsetSignUpDate()
 {
-    m_SignUpDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_SignUpDate);
 }
 utility::string_t CreateAPISSOUserData::getEmail() const
 {
@@ -959,17 +1432,17 @@ utility::string_t CreateAPISSOUserData::getEmail() const
 void CreateAPISSOUserData::setEmail(const utility::string_t& value)
 {
     m_Email = value;
-    m_EmailIsSet = true;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool CreateAPISSOUserData::emailIsSet() const
 {
-    return m_EmailIsSet;
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void CreateAPISSOUserData::unsetEmail()
 {
-    m_EmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_Email);
 }
 utility::string_t CreateAPISSOUserData::getWebsiteUrl() const
 {
@@ -980,17 +1453,17 @@ utility::string_t CreateAPISSOUserData::getWebsiteUrl() const
 void CreateAPISSOUserData::setWebsiteUrl(const utility::string_t& value)
 {
     m_WebsiteUrl = value;
-    m_WebsiteUrlIsSet = true;
+    m_FieldsSet.set(FieldBit_WebsiteUrl);
 }
 
 bool CreateAPISSOUserData::websiteUrlIsSet() const
 {
-    return m_WebsiteUrlIsSet;
+    return m_FieldsSet.test(FieldBit_WebsiteUrl);
 }
 
 void CreateAPISSOUserData::unsetWebsiteUrl()
 {
-    m_WebsiteUrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_WebsiteUrl);
 }
 utility::string_t CreateAPISSOUserData::getUsername() const
 {
@@ -1001,17 +1474,17 @@ utility::string_t CreateAPISSOUserData::getUsername() const
 void CreateAPISSOUserData::setUsername(const utility::string_t& value)
 {
     m_Username = value;
-    m_UsernameIsSet = true;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool CreateAPISSOUserData::usernameIsSet() const
 {
-    return m_UsernameIsSet;
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void CreateAPISSOUserData::unsetUsername()
 {
-    m_UsernameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t CreateAPISSOUserData::getId() const
 {
@@ -1022,17 +1495,17 @@ utility::string_t CreateAPISSOUserData::getId() const
 void CreateAPISSOUserData::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool CreateAPISSOUserData::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void CreateAPISSOUserData::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 
 }
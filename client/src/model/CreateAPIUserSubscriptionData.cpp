@@ -21,17 +21,6 @@ namespace model {
 CreateAPIUserSubscriptionData::CreateAPIUserSubscriptionData()
 {
     m_NotificationFrequency = 0.0;
-    m_NotificationFrequencyIsSet = false;
-    m_PageTitle = utility::conversions::to_string_t("");
-    m_PageTitleIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_AnonUserId = utility::conversions::to_string_t("");
-    m_AnonUserIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
 }
 
 CreateAPIUserSubscriptionData::~CreateAPIUserSubscriptionData()
@@ -46,32 +35,32 @@ void CreateAPIUserSubscriptionData::validate()
 web::json::value CreateAPIUserSubscriptionData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))] = ModelBase::toJson(m_NotificationFrequency);
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
@@ -80,76 +69,255 @@ web::json::value CreateAPIUserSubscriptionData::toJson() const
     return val;
 }
 
+void CreateAPIUserSubscriptionData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
+    {
+        
+        writer.key(_XPLATSTR("notificationFrequency"));
+        ModelBase::writeJson(writer, m_NotificationFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+
+    writer.endObject();
+}
+
 bool CreateAPIUserSubscriptionData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setNotificationFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
-            setNotificationFrequency(refVal_setNotificationFrequency);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            if(field.first == _XPLATSTR("notificationFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNotificationFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
+                    setNotificationFrequency(refVal_setNotificationFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPageTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
+                    setPageTitle(refVal_setPageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    return ok;
+}
+
+void CreateAPIUserSubscriptionData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationFrequency")), m_NotificationFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+}
+
+bool CreateAPIUserSubscriptionData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            {
+                double refVal_setNotificationFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationFrequency(refVal_setNotificationFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                utility::string_t refVal_setPageTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageTitle(refVal_setPageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateAPIUserSubscriptionData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -159,27 +327,27 @@ void CreateAPIUserSubscriptionData::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")), m_NotificationFrequency));
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
@@ -242,17 +410,17 @@ double CreateAPIUserSubscriptionData::getNotificationFrequency() const
 void CreateAPIUserSubscriptionData::setNotificationFrequency(double value)
 {
     m_NotificationFrequency = value;
-    m_NotificationFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationFrequency);
 }
 
 bool CreateAPIUserSubscriptionData::notificationFrequencyIsSet() const
 {
-    return m_NotificationFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationFrequency);
 }
 
 void CreateAPIUserSubscriptionData::unsetNotificationFrequency()
 {
-    m_NotificationFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationFrequency);
 }
 utility::string_t CreateAPIUserSubscriptionData::getPageTitle() const
 {
@@ -263,17 +431,17 @@ utility::string_t CreateAPIUserSubscriptionData::getPageTitle() const
 void CreateAPIUserSubscriptionData::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
-    m_PageTitleIsSet = true;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool CreateAPIUserSubscriptionData::pageTitleIsSet() const
 {
-    return m_PageTitleIsSet;
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void CreateAPIUserSubscriptionData::unsetPageTitle()
 {
-    m_PageTitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 utility::string_t CreateAPIUserSubscriptionData::getUrl() const
 {
@@ -284,17 +452,17 @@ utility::string_t CreateAPIUserSubscriptionData::getUrl() const
 void CreateAPIUserSubscriptionData::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool CreateAPIUserSubscriptionData::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void CreateAPIUserSubscriptionData::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t CreateAPIUserSubscriptionData::getUrlId() const
 {
@@ -305,17 +473,17 @@ utility::string_t CreateAPIUserSubscriptionData::getUrlId() const
 void CreateAPIUserSubscriptionData::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool CreateAPIUserSubscriptionData::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void CreateAPIUserSubscriptionData::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t CreateAPIUserSubscriptionData::getAnonUserId() const
 {
@@ -326,17 +494,17 @@ utility::string_t CreateAPIUserSubscriptionData::getAnonUserId() const
 void CreateAPIUserSubscriptionData::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
-    m_AnonUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool CreateAPIUserSubscriptionData::anonUserIdIsSet() const
 {
-    return m_AnonUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void CreateAPIUserSubscriptionData::unsetAnonUserId()
 {
-    m_AnonUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t CreateAPIUserSubscriptionData::getUserId() const
 {
@@ -347,17 +515,17 @@ utility::string_t CreateAPIUserSubscriptionData::getUserId() const
 void CreateAPIUserSubscriptionData::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool CreateAPIUserSubscriptionData::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void CreateAPIUserSubscriptionData::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 
 }
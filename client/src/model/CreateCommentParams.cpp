@@ -21,61 +21,20 @@ namespace model {
 CreateCommentParams::CreateCommentParams()
 {
     m_date = 0L;
-    m_dateIsSet = false;
-    m_LocalDateString = utility::conversions::to_string_t("");
-    m_LocalDateStringIsSet = false;
     m_LocalDateHours = 0;
-    m_LocalDateHoursIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_Comment = utility::conversions::to_string_t("");
-    m_CommentIsSet = false;
     m_ProductId = 0;
-    m_ProductIdIsSet = false;
-    m_MentionsIsSet = false;
-    m_HashTagsIsSet = false;
-    m_PageTitle = utility::conversions::to_string_t("");
-    m_PageTitleIsSet = false;
     m_IsFromMyAccountPage = false;
-    m_IsFromMyAccountPageIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_MetaIsSet = false;
-    m_ModerationGroupIdsIsSet = false;
     m_Rating = 0.0;
-    m_RatingIsSet = false;
     m_FromOfflineRestore = false;
-    m_FromOfflineRestoreIsSet = false;
     m_AutoplayDelayMS = 0L;
-    m_AutoplayDelayMSIsSet = false;
-    m_FeedbackIdsIsSet = false;
-    m_QuestionValuesIsSet = false;
     m_Tos = false;
-    m_TosIsSet = false;
-    m_BotId = utility::conversions::to_string_t("");
-    m_BotIdIsSet = false;
     m_Approved = false;
-    m_ApprovedIsSet = false;
-    m_Domain = utility::conversions::to_string_t("");
-    m_DomainIsSet = false;
-    m_Ip = utility::conversions::to_string_t("");
-    m_IpIsSet = false;
     m_IsPinned = false;
-    m_IsPinnedIsSet = false;
-    m_Locale = utility::conversions::to_string_t("");
-    m_LocaleIsSet = false;
     m_Reviewed = false;
-    m_ReviewedIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
     m_Votes = 0;
-    m_VotesIsSet = false;
     m_VotesDown = 0;
-    m_VotesDownIsSet = false;
     m_VotesUp = 0;
-    m_VotesUpIsSet = false;
 }
 
 CreateCommentParams::~CreateCommentParams()
@@ -90,182 +49,182 @@ void CreateCommentParams::validate()
 web::json::value CreateCommentParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
     }
-    if(m_LocalDateStringIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString);
     }
-    if(m_LocalDateHoursIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("localDateHours"))] = ModelBase::toJson(m_LocalDateHours);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail);
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_ProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ProductId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("productId"))] = ModelBase::toJson(m_ProductId);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId);
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("mentions"))] = ModelBase::toJson(m_Mentions);
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTags"))] = ModelBase::toJson(m_HashTags);
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_IsFromMyAccountPageIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage"))] = ModelBase::toJson(m_IsFromMyAccountPage);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds);
     }
-    if(m_RatingIsSet)
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating);
     }
-    if(m_FromOfflineRestoreIsSet)
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore"))] = ModelBase::toJson(m_FromOfflineRestore);
     }
-    if(m_AutoplayDelayMSIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS"))] = ModelBase::toJson(m_AutoplayDelayMS);
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))] = ModelBase::toJson(m_FeedbackIds);
     }
-    if(m_QuestionValuesIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionValues"))] = ModelBase::toJson(m_QuestionValues);
     }
-    if(m_TosIsSet)
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tos"))] = ModelBase::toJson(m_Tos);
     }
-    if(m_BotIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BotId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("botId"))] = ModelBase::toJson(m_BotId);
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approved"))] = ModelBase::toJson(m_Approved);
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_IpIsSet)
+    if(m_FieldsSet.test(FieldBit_Ip))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ip"))] = ModelBase::toJson(m_Ip);
     }
-    if(m_IsPinnedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned);
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewed"))] = ModelBase::toJson(m_Reviewed);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_VotesIsSet)
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes);
     }
-    if(m_VotesDownIsSet)
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown);
     }
-    if(m_VotesUpIsSet)
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp);
@@ -274,406 +233,1275 @@ web::json::value CreateCommentParams::toJson() const
     return val;
 }
 
+void CreateCommentParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
+    {
+        
+        writer.key(_XPLATSTR("localDateString"));
+        ModelBase::writeJson(writer, m_LocalDateString);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
+    {
+        
+        writer.key(_XPLATSTR("localDateHours"));
+        ModelBase::writeJson(writer, m_LocalDateHours);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
+    {
+        
+        writer.key(_XPLATSTR("commenterEmail"));
+        ModelBase::writeJson(writer, m_CommenterEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
+    {
+        
+        writer.key(_XPLATSTR("commenterLink"));
+        ModelBase::writeJson(writer, m_CommenterLink);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_ProductId))
+    {
+        
+        writer.key(_XPLATSTR("productId"));
+        ModelBase::writeJson(writer, m_ProductId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_ParentId))
+    {
+        
+        writer.key(_XPLATSTR("parentId"));
+        ModelBase::writeJson(writer, m_ParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Mentions))
+    {
+        
+        writer.key(_XPLATSTR("mentions"));
+        ModelBase::writeJson(writer, m_Mentions);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTags))
+    {
+        
+        writer.key(_XPLATSTR("hashTags"));
+        ModelBase::writeJson(writer, m_HashTags);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
+    {
+        
+        writer.key(_XPLATSTR("isFromMyAccountPage"));
+        ModelBase::writeJson(writer, m_IsFromMyAccountPage);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("moderationGroupIds"));
+        ModelBase::writeJson(writer, m_ModerationGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Rating))
+    {
+        
+        writer.key(_XPLATSTR("rating"));
+        ModelBase::writeJson(writer, m_Rating);
+    }
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
+    {
+        
+        writer.key(_XPLATSTR("fromOfflineRestore"));
+        ModelBase::writeJson(writer, m_FromOfflineRestore);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
+    {
+        
+        writer.key(_XPLATSTR("autoplayDelayMS"));
+        ModelBase::writeJson(writer, m_AutoplayDelayMS);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        writer.key(_XPLATSTR("feedbackIds"));
+        ModelBase::writeJson(writer, m_FeedbackIds);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
+    {
+        
+        writer.key(_XPLATSTR("questionValues"));
+        ModelBase::writeJson(writer, m_QuestionValues);
+    }
+    if(m_FieldsSet.test(FieldBit_Tos))
+    {
+        
+        writer.key(_XPLATSTR("tos"));
+        ModelBase::writeJson(writer, m_Tos);
+    }
+    if(m_FieldsSet.test(FieldBit_BotId))
+    {
+        
+        writer.key(_XPLATSTR("botId"));
+        ModelBase::writeJson(writer, m_BotId);
+    }
+    if(m_FieldsSet.test(FieldBit_Approved))
+    {
+        
+        writer.key(_XPLATSTR("approved"));
+        ModelBase::writeJson(writer, m_Approved);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_Ip))
+    {
+        
+        writer.key(_XPLATSTR("ip"));
+        ModelBase::writeJson(writer, m_Ip);
+    }
+    if(m_FieldsSet.test(FieldBit_IsPinned))
+    {
+        
+        writer.key(_XPLATSTR("isPinned"));
+        ModelBase::writeJson(writer, m_IsPinned);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_Reviewed))
+    {
+        
+        writer.key(_XPLATSTR("reviewed"));
+        ModelBase::writeJson(writer, m_Reviewed);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_Votes))
+    {
+        
+        writer.key(_XPLATSTR("votes"));
+        ModelBase::writeJson(writer, m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        writer.key(_XPLATSTR("votesDown"));
+        ModelBase::writeJson(writer, m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        writer.key(_XPLATSTR("votesUp"));
+        ModelBase::writeJson(writer, m_VotesUp);
+    }
+
+    writer.endObject();
+}
+
 bool CreateCommentParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateString"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateString")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setLocalDateString;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
-            setLocalDateString(refVal_setLocalDateString);
-            
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            if(field.first == _XPLATSTR("localDateString"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocalDateString;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
+                    setLocalDateString(refVal_setLocalDateString);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            if(field.first == _XPLATSTR("localDateHours"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setLocalDateHours;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
+                    setLocalDateHours(refVal_setLocalDateHours);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
+                    setCommenterName(refVal_setCommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            if(field.first == _XPLATSTR("commenterEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
+                    setCommenterEmail(refVal_setCommenterEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            if(field.first == _XPLATSTR("commenterLink"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterLink;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
+                    setCommenterLink(refVal_setCommenterLink);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("productId")):
+            if(field.first == _XPLATSTR("productId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setProductId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setProductId);
+                    setProductId(refVal_setProductId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            if(field.first == _XPLATSTR("parentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
+                    setParentId(refVal_setParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            if(field.first == _XPLATSTR("mentions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
+                    setMentions(refVal_setMentions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            if(field.first == _XPLATSTR("hashTags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
+                    setHashTags(refVal_setHashTags);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPageTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
+                    setPageTitle(refVal_setPageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isFromMyAccountPage")):
+            if(field.first == _XPLATSTR("isFromMyAccountPage"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsFromMyAccountPage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsFromMyAccountPage);
+                    setIsFromMyAccountPage(refVal_setIsFromMyAccountPage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            if(field.first == _XPLATSTR("moderationGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModerationGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
+                    setModerationGroupIds(refVal_setModerationGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            if(field.first == _XPLATSTR("rating"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setRating;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
+                    setRating(refVal_setRating);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")):
+            if(field.first == _XPLATSTR("fromOfflineRestore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setFromOfflineRestore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromOfflineRestore);
+                    setFromOfflineRestore(refVal_setFromOfflineRestore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")):
+            if(field.first == _XPLATSTR("autoplayDelayMS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setAutoplayDelayMS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayDelayMS);
+                    setAutoplayDelayMS(refVal_setAutoplayDelayMS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            if(field.first == _XPLATSTR("feedbackIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
+                    setFeedbackIds(refVal_setFeedbackIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionValues")):
+            if(field.first == _XPLATSTR("questionValues"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> refVal_setQuestionValues;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionValues);
+                    setQuestionValues(refVal_setQuestionValues);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tos")):
+            if(field.first == _XPLATSTR("tos"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setTos;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTos);
+                    setTos(refVal_setTos);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("botId")):
+            if(field.first == _XPLATSTR("botId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBotId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBotId);
+                    setBotId(refVal_setBotId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            if(field.first == _XPLATSTR("approved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
+                    setApproved(refVal_setApproved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ip")):
+            if(field.first == _XPLATSTR("ip"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setIp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIp);
+                    setIp(refVal_setIp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            if(field.first == _XPLATSTR("isPinned"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsPinned;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
+                    setIsPinned(refVal_setIsPinned);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            if(field.first == _XPLATSTR("reviewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
+                    setReviewed(refVal_setReviewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            if(field.first == _XPLATSTR("votes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
+                    setVotes(refVal_setVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            if(field.first == _XPLATSTR("votesDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
+                    setVotesDown(refVal_setVotesDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            if(field.first == _XPLATSTR("votesUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
+                    setVotesUp(refVal_setVotesUp);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateHours"))))
+    return ok;
+}
+
+void CreateCommentParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateHours")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setLocalDateHours;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
-            setLocalDateHours(refVal_setLocalDateHours);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateString")), m_LocalDateString);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
-            setCommenterEmail(refVal_setCommenterEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateHours")), m_LocalDateHours);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterLink"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterLink")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterLink;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
-            setCommenterLink(refVal_setCommenterLink);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterEmail")), m_CommenterEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("productId"))))
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("productId")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setProductId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setProductId);
-            setProductId(refVal_setProductId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterLink")), m_CommenterLink);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_ProductId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("productId")), m_ProductId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("parentId"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("parentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
-            setParentId(refVal_setParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("mentions"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("mentions")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
-            setMentions(refVal_setMentions);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTags"))))
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTags")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
-            setHashTags(refVal_setHashTags);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("parentId")), m_ParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("mentions")), m_Mentions);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage"))))
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsFromMyAccountPage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsFromMyAccountPage);
-            setIsFromMyAccountPage(refVal_setIsFromMyAccountPage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTags")), m_HashTags);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isFromMyAccountPage")), m_IsFromMyAccountPage);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<Object> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModerationGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
-            setModerationGroupIds(refVal_setModerationGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rating"))))
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rating")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setRating;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
-            setRating(refVal_setRating);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore"))))
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setFromOfflineRestore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromOfflineRestore);
-            setFromOfflineRestore(refVal_setFromOfflineRestore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS"))))
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setAutoplayDelayMS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayDelayMS);
-            setAutoplayDelayMS(refVal_setAutoplayDelayMS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rating")), m_Rating);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))))
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
-            setFeedbackIds(refVal_setFeedbackIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")), m_FromOfflineRestore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionValues"))))
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionValues")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> refVal_setQuestionValues;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionValues);
-            setQuestionValues(refVal_setQuestionValues);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")), m_AutoplayDelayMS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tos"))))
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tos")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setTos;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTos);
-            setTos(refVal_setTos);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackIds")), m_FeedbackIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("botId"))))
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("botId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBotId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBotId);
-            setBotId(refVal_setBotId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionValues")), m_QuestionValues);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approved"))))
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approved")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
-            setApproved(refVal_setApproved);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tos")), m_Tos);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_BotId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("botId")), m_BotId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ip"))))
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ip")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setIp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIp);
-            setIp(refVal_setIp);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approved")), m_Approved);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isPinned"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isPinned")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsPinned;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
-            setIsPinned(refVal_setIsPinned);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_Ip))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ip")), m_Ip);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewed"))))
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
-            setReviewed(refVal_setReviewed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isPinned")), m_IsPinned);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votes"))))
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votes")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
-            setVotes(refVal_setVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewed")), m_Reviewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDown"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDown")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
-            setVotesDown(refVal_setVotesDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUp"))))
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUp")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votes")), m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDown")), m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUp")), m_VotesUp);
+    }
+}
+
+bool CreateCommentParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int32_t refVal_setVotesUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
-            setVotesUp(refVal_setVotesUp);
-            
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                int64_t refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            {
+                utility::string_t refVal_setLocalDateString;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateString))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateString(refVal_setLocalDateString);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            {
+                int32_t refVal_setLocalDateHours;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateHours))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateHours(refVal_setLocalDateHours);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                utility::string_t refVal_setCommenterName;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterName(refVal_setCommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            {
+                utility::string_t refVal_setCommenterEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterEmail(refVal_setCommenterEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            {
+                utility::string_t refVal_setCommenterLink;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterLink))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterLink(refVal_setCommenterLink);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                utility::string_t refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("productId")):
+            {
+                int32_t refVal_setProductId;
+                if(!ModelBase::readBinary(reader, field, refVal_setProductId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setProductId(refVal_setProductId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            {
+                utility::string_t refVal_setParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setParentId(refVal_setParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            {
+                std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                if(!ModelBase::readBinary(reader, field, refVal_setMentions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMentions(refVal_setMentions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            {
+                std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTags(refVal_setHashTags);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                utility::string_t refVal_setPageTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageTitle(refVal_setPageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isFromMyAccountPage")):
+            {
+                bool refVal_setIsFromMyAccountPage;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsFromMyAccountPage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsFromMyAccountPage(refVal_setIsFromMyAccountPage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::shared_ptr<Object> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setModerationGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationGroupIds(refVal_setModerationGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            {
+                double refVal_setRating;
+                if(!ModelBase::readBinary(reader, field, refVal_setRating))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRating(refVal_setRating);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")):
+            {
+                bool refVal_setFromOfflineRestore;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromOfflineRestore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromOfflineRestore(refVal_setFromOfflineRestore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")):
+            {
+                int64_t refVal_setAutoplayDelayMS;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoplayDelayMS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoplayDelayMS(refVal_setAutoplayDelayMS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackIds(refVal_setFeedbackIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionValues")):
+            {
+                std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> refVal_setQuestionValues;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionValues))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionValues(refVal_setQuestionValues);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tos")):
+            {
+                bool refVal_setTos;
+                if(!ModelBase::readBinary(reader, field, refVal_setTos))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTos(refVal_setTos);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("botId")):
+            {
+                utility::string_t refVal_setBotId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBotId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBotId(refVal_setBotId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            {
+                bool refVal_setApproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setApproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApproved(refVal_setApproved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ip")):
+            {
+                utility::string_t refVal_setIp;
+                if(!ModelBase::readBinary(reader, field, refVal_setIp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIp(refVal_setIp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            {
+                bool refVal_setIsPinned;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsPinned))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsPinned(refVal_setIsPinned);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            {
+                bool refVal_setReviewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewed(refVal_setReviewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            {
+                int32_t refVal_setVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotes(refVal_setVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            {
+                int32_t refVal_setVotesDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDown(refVal_setVotesDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            {
+                int32_t refVal_setVotesUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUp(refVal_setVotesUp);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateCommentParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -683,147 +1511,147 @@ void CreateCommentParams::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
-    if(m_LocalDateStringIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString));
     }
-    if(m_LocalDateHoursIsSet)
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateHours")), m_LocalDateHours));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail));
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_ProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ProductId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("productId")), m_ProductId));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId));
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("mentions")), m_Mentions));
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTags")), m_HashTags));
     }
-    if(m_PageTitleIsSet)
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_IsFromMyAccountPageIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFromMyAccountPage))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isFromMyAccountPage")), m_IsFromMyAccountPage));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds));
     }
-    if(m_RatingIsSet)
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating));
     }
-    if(m_FromOfflineRestoreIsSet)
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore")), m_FromOfflineRestore));
     }
-    if(m_AutoplayDelayMSIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS")), m_AutoplayDelayMS));
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackIds")), m_FeedbackIds));
     }
-    if(m_QuestionValuesIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionValues))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionValues")), m_QuestionValues));
     }
-    if(m_TosIsSet)
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tos")), m_Tos));
     }
-    if(m_BotIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BotId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("botId")), m_BotId));
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approved")), m_Approved));
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_IpIsSet)
+    if(m_FieldsSet.test(FieldBit_Ip))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ip")), m_Ip));
     }
-    if(m_IsPinnedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned));
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewed")), m_Reviewed));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_VotesIsSet)
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes));
     }
-    if(m_VotesDownIsSet)
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown));
     }
-    if(m_VotesUpIsSet)
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp));
     }
@@ -1066,17 +1894,17 @@ int64_t CreateCommentParams::getDate() const
 void CreateCommentParams::setDate(int64_t value)
 {
     m_date = value;
-    m_dateIsSet = true;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool CreateCommentParams::dateIsSet() const
 {
-    return m_dateIsSet;
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void CreateCommentParams::unsetdate()
 {
-    m_dateIsSet = false;
+    m_FieldsSet.reset(FieldBit_date);
 }
 utility::string_t CreateCommentParams::getLocalDateString() const
 {
@@ -1087,17 +1915,17 @@ utility::string_t CreateCommentParams::getLocalDateString() const
 void CreateCommentParams::setLocalDateString(const utility::string_t& value)
 {
     m_LocalDateString = value;
-    m_LocalDateStringIsSet = true;
+    m_FieldsSet.set(FieldBit_LocalDateString);
 }
 
 bool CreateCommentParams::localDateStringIsSet() const
 {
-    return m_LocalDateStringIsSet;
+    return m_FieldsSet.test(FieldBit_LocalDateString);
 }
 
 void CreateCommentParams::unsetLocalDateString()
 {
-    m_LocalDateStringIsSet = false;
+    m_FieldsSet.reset(FieldBit_LocalDateString);
 }
 int32_t CreateCommentParams::getLocalDateHours() const
 {
@@ -1107,17 +1935,17 @@ int32_t CreateCommentParams::getLocalDateHours() const
 void CreateCommentParams::setLocalDateHours(int32_t value)
 {
     m_LocalDateHours = value;
-    m_LocalDateHoursIsSet = true;
+    m_FieldsSet.set(FieldBit_LocalDateHours);
 }
 
 bool CreateCommentParams::localDateHoursIsSet() const
 {
-    return m_LocalDateHoursIsSet;
+    return m_FieldsSet.test(FieldBit_LocalDateHours);
 }
 
 void CreateCommentParams::unsetLocalDateHours()
 {
-    m_LocalDateHoursIsSet = false;
+    m_FieldsSet.reset(FieldBit_LocalDateHours);
 }
 utility::string_t CreateCommentParams::getCommenterName() const
 {
@@ -1128,57 +1956,59 @@ utility::string_t CreateCommentParams::getCommenterName() const
 void CreateCommentParams::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool CreateCommentParams::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void CreateCommentParams::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::string_t CreateCommentParams::getCommenterEmail() const
 {
-    return m_CommenterEmail.get();
+    return m_CommenterEmail;
 }
 
 
 void CreateCommentParams::setCommenterEmail(const utility::string_t& value)
 {
     m_CommenterEmail = value;
+    m_FieldsSet.set(FieldBit_CommenterEmail);
 }
 
 bool CreateCommentParams::commenterEmailIsSet() const
 {
-    return m_CommenterEmail.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterEmail);
 }
 
 void CreateCommentParams::unsetCommenterEmail()
 {
-    m_CommenterEmail.reset();
+    m_FieldsSet.reset(FieldBit_CommenterEmail);
 }
 utility::string_t CreateCommentParams::getCommenterLink() const
 {
-    return m_CommenterLink.get();
+    return m_CommenterLink;
 }
 
 
 void CreateCommentParams::setCommenterLink(const utility::string_t& value)
 {
     m_CommenterLink = value;
+    m_FieldsSet.set(FieldBit_CommenterLink);
 }
 
 bool CreateCommentParams::commenterLinkIsSet() const
 {
-    return m_CommenterLink.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterLink);
 }
 
 void CreateCommentParams::unsetCommenterLink()
 {
-    m_CommenterLink.reset();
+    m_FieldsSet.reset(FieldBit_CommenterLink);
 }
 utility::string_t CreateCommentParams::getComment() const
 {
@@ -1189,17 +2019,17 @@ utility::string_t CreateCommentParams::getComment() const
 void CreateCommentParams::setComment(const utility::string_t& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool CreateCommentParams::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void CreateCommentParams::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 int32_t CreateCommentParams::getProductId() const
 {
@@ -1209,77 +2039,80 @@ int32_t CreateCommentParams::getProductId() const
 void CreateCommentParams::setProductId(int32_t value)
 {
     m_ProductId = value;
-    m_ProductIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ProductId);
 }
 
 bool CreateCommentParams::productIdIsSet() const
 {
-    return m_ProductIdIsSet;
+    return m_FieldsSet.test(FieldBit_ProductId);
 }
 
 void CreateCommentParams::unsetProductId()
 {
-    m_ProductIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ProductId);
 }
 utility::string_t CreateCommentParams::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void CreateCommentParams::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool CreateCommentParams::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void CreateCommentParams::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t CreateCommentParams::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void CreateCommentParams::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool CreateCommentParams::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void CreateCommentParams::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 utility::string_t CreateCommentParams::getParentId() const
 {
-    return m_ParentId.get();
+    return m_ParentId;
 }
 
 
 void CreateCommentParams::setParentId(const utility::string_t& value)
 {
     m_ParentId = value;
+    m_FieldsSet.set(FieldBit_ParentId);
 }
 
 bool CreateCommentParams::parentIdIsSet() const
 {
-    return m_ParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ParentId);
 }
 
 void CreateCommentParams::unsetParentId()
 {
-    m_ParentId.reset();
+    m_FieldsSet.reset(FieldBit_ParentId);
 }
 std::vector<std::shared_ptr<CommentUserMentionInfo>> CreateCommentParams::getMentions() const
 {
@@ -1290,17 +2123,17 @@ std::vector<std::shared_ptr<CommentUserMentionInfo>> CreateCommentParams::getMen
 void CreateCommentParams::setMentions(const std::vector<std::shared_ptr<CommentUserMentionInfo>>& value)
 {
     m_Mentions = value;
-    m_MentionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Mentions);
 }
 
 bool CreateCommentParams::mentionsIsSet() const
 {
-    return m_MentionsIsSet;
+    return m_FieldsSet.test(FieldBit_Mentions);
 }
 
 void CreateCommentParams::unsetMentions()
 {
-    m_MentionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Mentions);
 }
 std::vector<std::shared_ptr<CommentUserHashTagInfo>> CreateCommentParams::getHashTags() const
 {
@@ -1311,17 +2144,17 @@ std::vector<std::shared_ptr<CommentUserHashTagInfo>> CreateCommentParams::getHas
 void CreateCommentParams::setHashTags(const std::vector<std::shared_ptr<CommentUserHashTagInfo>>& value)
 {
     m_HashTags = value;
-    m_HashTagsIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTags);
 }
 
 bool CreateCommentParams::hashTagsIsSet() const
 {
-    return m_HashTagsIsSet;
+    return m_FieldsSet.test(FieldBit_HashTags);
 }
 
 void CreateCommentParams::unsetHashTags()
 {
-    m_HashTagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTags);
 }
 utility::string_t CreateCommentParams::getPageTitle() const
 {
@@ -1332,17 +2165,17 @@ utility::string_t CreateCommentParams::getPageTitle() const
 void CreateCommentParams::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
-    m_PageTitleIsSet = true;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool CreateCommentParams::pageTitleIsSet() const
 {
-    return m_PageTitleIsSet;
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void CreateCommentParams::unsetPageTitle()
 {
-    m_PageTitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 bool CreateCommentParams::isIsFromMyAccountPage() const
 {
@@ -1352,17 +2185,17 @@ bool CreateCommentParams::isIsFromMyAccountPage() const
 void CreateCommentParams::setIsFromMyAccountPage(bool value)
 {
     m_IsFromMyAccountPage = value;
-    m_IsFromMyAccountPageIsSet = true;
+    m_FieldsSet.set(FieldBit_IsFromMyAccountPage);
 }
 
 bool CreateCommentParams::isFromMyAccountPageIsSet() const
 {
-    return m_IsFromMyAccountPageIsSet;
+    return m_FieldsSet.test(FieldBit_IsFromMyAccountPage);
 }
 
 void CreateCommentParams::unsetIsFromMyAccountPage()
 {
-    m_IsFromMyAccountPageIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsFromMyAccountPage);
 }
 utility::string_t CreateCommentParams::getUrl() const
 {
@@ -1373,17 +2206,17 @@ utility::string_t CreateCommentParams::getUrl() const
 void CreateCommentParams::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool CreateCommentParams::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void CreateCommentParams::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t CreateCommentParams::getUrlId() const
 {
@@ -1394,17 +2227,17 @@ utility::string_t CreateCommentParams::getUrlId() const
 void CreateCommentParams::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool CreateCommentParams::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void CreateCommentParams::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 std::shared_ptr<Object> CreateCommentParams::getMeta() const
 {
@@ -1415,17 +2248,17 @@ std::shared_ptr<Object> CreateCommentParams::getMeta() const
 void CreateCommentParams::setMeta(const std::shared_ptr<Object>& value)
 {
     m_Meta = value;
-    m_MetaIsSet = true;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool CreateCommentParams::metaIsSet() const
 {
-    return m_MetaIsSet;
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void CreateCommentParams::unsetMeta()
 {
-    m_MetaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 std::vector<utility::string_t> CreateCommentParams::getModerationGroupIds() const
 {
@@ -1436,17 +2269,17 @@ std::vector<utility::string_t> CreateCommentParams::getModerationGroupIds() cons
 void CreateCommentParams::setModerationGroupIds(const std::vector<utility::string_t>& value)
 {
     m_ModerationGroupIds = value;
-    m_ModerationGroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ModerationGroupIds);
 }
 
 bool CreateCommentParams::moderationGroupIdsIsSet() const
 {
-    return m_ModerationGroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ModerationGroupIds);
 }
 
 void CreateCommentParams::unsetModerationGroupIds()
 {
-    m_ModerationGroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModerationGroupIds);
 }
 double CreateCommentParams::getRating() const
 {
@@ -1456,17 +2289,17 @@ double CreateCommentParams::getRating() const
 void CreateCommentParams::setRating(double value)
 {
     m_Rating = value;
-    m_RatingIsSet = true;
+    m_FieldsSet.set(FieldBit_Rating);
 }
 
 bool CreateCommentParams::ratingIsSet() const
 {
-    return m_RatingIsSet;
+    return m_FieldsSet.test(FieldBit_Rating);
 }
 
 void CreateCommentParams::unsetRating()
 {
-    m_RatingIsSet = false;
+    m_FieldsSet.reset(FieldBit_Rating);
 }
 bool CreateCommentParams::isFromOfflineRestore() const
 {
@@ -1476,17 +2309,17 @@ bool CreateCommentParams::isFromOfflineRestore() const
 void CreateCommentParams::setFromOfflineRestore(bool value)
 {
     m_FromOfflineRestore = value;
-    m_FromOfflineRestoreIsSet = true;
+    m_FieldsSet.set(FieldBit_FromOfflineRestore);
 }
 
 bool CreateCommentParams::fromOfflineRestoreIsSet() const
 {
-    return m_FromOfflineRestoreIsSet;
+    return m_FieldsSet.test(FieldBit_FromOfflineRestore);
 }
 
 void CreateCommentParams::unsetFromOfflineRestore()
 {
-    m_FromOfflineRestoreIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromOfflineRestore);
 }
 int64_t CreateCommentParams::getAutoplayDelayMS() const
 {
@@ -1496,17 +2329,17 @@ int64_t CreateCommentParams::getAutoplayDelayMS() const
 void CreateCommentParams::setAutoplayDelayMS(int64_t value)
 {
     m_AutoplayDelayMS = value;
-    m_AutoplayDelayMSIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoplayDelayMS);
 }
 
 bool CreateCommentParams::autoplayDelayMSIsSet() const
 {
-    return m_AutoplayDelayMSIsSet;
+    return m_FieldsSet.test(FieldBit_AutoplayDelayMS);
 }
 
 void CreateCommentParams::unsetAutoplayDelayMS()
 {
-    m_AutoplayDelayMSIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoplayDelayMS);
 }
 std::vector<utility::string_t> CreateCommentParams::getFeedbackIds() const
 {
@@ -1517,17 +2350,17 @@ std::vector<utility::string_t> CreateCommentParams::getFeedbackIds() const
 void CreateCommentParams::setFeedbackIds(const std::vector<utility::string_t>& value)
 {
     m_FeedbackIds = value;
-    m_FeedbackIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackIds);
 }
 
 bool CreateCommentParams::feedbackIdsIsSet() const
 {
-    return m_FeedbackIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackIds);
 }
 
 void CreateCommentParams::unsetFeedbackIds()
 {
-    m_FeedbackIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackIds);
 }
 std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>> CreateCommentParams::getQuestionValues() const
 {
@@ -1538,17 +2371,17 @@ std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner
 void CreateCommentParams::setQuestionValues(const std::map<utility::string_t, std::shared_ptr<GifSearchResponse_images_inner_inner>>& value)
 {
     m_QuestionValues = value;
-    m_QuestionValuesIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionValues);
 }
 
 bool CreateCommentParams::questionValuesIsSet() const
 {
-    return m_QuestionValuesIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionValues);
 }
 
 void CreateCommentParams::unsetQuestionValues()
 {
-    m_QuestionValuesIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionValues);
 }
 bool CreateCommentParams::isTos() const
 {
@@ -1558,17 +2391,17 @@ bool CreateCommentParams::isTos() const
 void CreateCommentParams::setTos(bool value)
 {
     m_Tos = value;
-    m_TosIsSet = true;
+    m_FieldsSet.set(FieldBit_Tos);
 }
 
 bool CreateCommentParams::tosIsSet() const
 {
-    return m_TosIsSet;
+    return m_FieldsSet.test(FieldBit_Tos);
 }
 
 void CreateCommentParams::unsetTos()
 {
-    m_TosIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tos);
 }
 utility::string_t CreateCommentParams::getBotId() const
 {
@@ -1579,17 +2412,17 @@ utility::string_t CreateCommentParams::getBotId() const
 void CreateCommentParams::setBotId(const utility::string_t& value)
 {
     m_BotId = value;
-    m_BotIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BotId);
 }
 
 bool CreateCommentParams::botIdIsSet() const
 {
-    return m_BotIdIsSet;
+    return m_FieldsSet.test(FieldBit_BotId);
 }
 
 void CreateCommentParams::unsetBotId()
 {
-    m_BotIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BotId);
 }
 bool CreateCommentParams::isApproved() const
 {
@@ -1599,17 +2432,17 @@ bool CreateCommentParams::isApproved() const
 void CreateCommentParams::setApproved(bool value)
 {
     m_Approved = value;
-    m_ApprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_Approved);
 }
 
 bool CreateCommentParams::approvedIsSet() const
 {
-    return m_ApprovedIsSet;
+    return m_FieldsSet.test(FieldBit_Approved);
 }
 
 void CreateCommentParams::unsetApproved()
 {
-    m_ApprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Approved);
 }
 utility::string_t CreateCommentParams::getDomain() const
 {
@@ -1620,17 +2453,17 @@ utility::string_t CreateCommentParams::getDomain() const
 void CreateCommentParams::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
-    m_DomainIsSet = true;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool CreateCommentParams::domainIsSet() const
 {
-    return m_DomainIsSet;
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void CreateCommentParams::unsetDomain()
 {
-    m_DomainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t CreateCommentParams::getIp() const
 {
@@ -1641,17 +2474,17 @@ utility::string_t CreateCommentParams::getIp() const
 void CreateCommentParams::setIp(const utility::string_t& value)
 {
     m_Ip = value;
-    m_IpIsSet = true;
+    m_FieldsSet.set(FieldBit_Ip);
 }
 
 bool CreateCommentParams::ipIsSet() const
 {
-    return m_IpIsSet;
+    return m_FieldsSet.test(FieldBit_Ip);
 }
 
 void CreateCommentParams::unsetIp()
 {
-    m_IpIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ip);
 }
 bool CreateCommentParams::isIsPinned() const
 {
@@ -1661,17 +2494,17 @@ bool CreateCommentParams::isIsPinned() const
 void CreateCommentParams::setIsPinned(bool value)
 {
     m_IsPinned = value;
-    m_IsPinnedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsPinned);
 }
 
 bool CreateCommentParams::isPinnedIsSet() const
 {
-    return m_IsPinnedIsSet;
+    return m_FieldsSet.test(FieldBit_IsPinned);
 }
 
 void CreateCommentParams::unsetIsPinned()
 {
-    m_IsPinnedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsPinned);
 }
 utility::string_t CreateCommentParams::getLocale() const
 {
@@ -1682,17 +2515,17 @@ utility::string_t CreateCommentParams::getLocale() const
 void CreateCommentParams::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
-    m_LocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool CreateCommentParams::localeIsSet() const
 {
-    return m_LocaleIsSet;
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void CreateCommentParams::unsetLocale()
 {
-    m_LocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 bool CreateCommentParams::isReviewed() const
 {
@@ -1702,17 +2535,17 @@ bool CreateCommentParams::isReviewed() const
 void CreateCommentParams::setReviewed(bool value)
 {
     m_Reviewed = value;
-    m_ReviewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Reviewed);
 }
 
 bool CreateCommentParams::reviewedIsSet() const
 {
-    return m_ReviewedIsSet;
+    return m_FieldsSet.test(FieldBit_Reviewed);
 }
 
 void CreateCommentParams::unsetReviewed()
 {
-    m_ReviewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reviewed);
 }
 bool CreateCommentParams::isVerified() const
 {
@@ -1722,17 +2555,17 @@ bool CreateCommentParams::isVerified() const
 void CreateCommentParams::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool CreateCommentParams::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void CreateCommentParams::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 int32_t CreateCommentParams::getVotes() const
 {
@@ -1742,17 +2575,17 @@ int32_t CreateCommentParams::getVotes() const
 void CreateCommentParams::setVotes(int32_t value)
 {
     m_Votes = value;
-    m_VotesIsSet = true;
+    m_FieldsSet.set(FieldBit_Votes);
 }
 
 bool CreateCommentParams::votesIsSet() const
 {
-    return m_VotesIsSet;
+    return m_FieldsSet.test(FieldBit_Votes);
 }
 
 void CreateCommentParams::unsetVotes()
 {
-    m_VotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Votes);
 }
 int32_t CreateCommentParams::getVotesDown() const
 {
@@ -1762,17 +2595,17 @@ int32_t CreateCommentParams::getVotesDown() const
 void CreateCommentParams::setVotesDown(int32_t value)
 {
     m_VotesDown = value;
-    m_VotesDownIsSet = true;
+    m_FieldsSet.set(FieldBit_VotesDown);
 }
 
 bool CreateCommentParams::votesDownIsSet() const
 {
-    return m_VotesDownIsSet;
+    return m_FieldsSet.test(FieldBit_VotesDown);
 }
 
 void CreateCommentParams::unsetVotesDown()
 {
-    m_VotesDownIsSet = false;
+    m_FieldsSet.reset(FieldBit_VotesDown);
 }
 int32_t CreateCommentParams::getVotesUp() const
 {
@@ -1782,17 +2615,17 @@ int32_t CreateCommentParams::getVotesUp() const
 void CreateCommentParams::setVotesUp(int32_t value)
 {
     m_VotesUp = value;
-    m_VotesUpIsSet = true;
+    m_FieldsSet.set(FieldBit_VotesUp);
 }
 
 bool CreateCommentParams::votesUpIsSet() const
 {
-    return m_VotesUpIsSet;
+    return m_FieldsSet.test(FieldBit_VotesUp);
 }
 
 void CreateCommentParams::unsetVotesUp()
 {
-    m_VotesUpIsSet = false;
+    m_FieldsSet.reset(FieldBit_VotesUp);
 }
 
 }
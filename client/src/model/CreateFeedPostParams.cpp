@@ -20,18 +20,6 @@ namespace model {
 
 CreateFeedPostParams::CreateFeedPostParams()
 {
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_ContentHTML = utility::conversions::to_string_t("");
-    m_ContentHTMLIsSet = false;
-    m_MediaIsSet = false;
-    m_LinksIsSet = false;
-    m_FromUserId = utility::conversions::to_string_t("");
-    m_FromUserIdIsSet = false;
-    m_FromUserDisplayName = utility::conversions::to_string_t("");
-    m_FromUserDisplayNameIsSet = false;
-    m_TagsIsSet = false;
-    m_MetaIsSet = false;
 }
 
 CreateFeedPostParams::~CreateFeedPostParams()
@@ -46,42 +34,42 @@ void CreateFeedPostParams::validate()
 web::json::value CreateFeedPostParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_ContentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("contentHTML"))] = ModelBase::toJson(m_ContentHTML);
     }
-    if(m_MediaIsSet)
+    if(m_FieldsSet.test(FieldBit_Media))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("media"))] = ModelBase::toJson(m_Media);
     }
-    if(m_LinksIsSet)
+    if(m_FieldsSet.test(FieldBit_Links))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("links"))] = ModelBase::toJson(m_Links);
     }
-    if(m_FromUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromUserId"))] = ModelBase::toJson(m_FromUserId);
     }
-    if(m_FromUserDisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName"))] = ModelBase::toJson(m_FromUserDisplayName);
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tags"))] = ModelBase::toJson(m_Tags);
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
@@ -90,98 +78,323 @@ web::json::value CreateFeedPostParams::toJson() const
     return val;
 }
 
+void CreateFeedPostParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
+    {
+        
+        writer.key(_XPLATSTR("contentHTML"));
+        ModelBase::writeJson(writer, m_ContentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_Media))
+    {
+        
+        writer.key(_XPLATSTR("media"));
+        ModelBase::writeJson(writer, m_Media);
+    }
+    if(m_FieldsSet.test(FieldBit_Links))
+    {
+        
+        writer.key(_XPLATSTR("links"));
+        ModelBase::writeJson(writer, m_Links);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserId))
+    {
+        
+        writer.key(_XPLATSTR("fromUserId"));
+        ModelBase::writeJson(writer, m_FromUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
+    {
+        
+        writer.key(_XPLATSTR("fromUserDisplayName"));
+        ModelBase::writeJson(writer, m_FromUserDisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_Tags))
+    {
+        
+        writer.key(_XPLATSTR("tags"));
+        ModelBase::writeJson(writer, m_Tags);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+
+    writer.endObject();
+}
+
 bool CreateFeedPostParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("contentHTML"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("contentHTML")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setContentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setContentHTML);
-            setContentHTML(refVal_setContentHTML);
-            
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("contentHTML")):
+            if(field.first == _XPLATSTR("contentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setContentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setContentHTML);
+                    setContentHTML(refVal_setContentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("media")):
+            if(field.first == _XPLATSTR("media"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMedia);
+                    setMedia(refVal_setMedia);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("links")):
+            if(field.first == _XPLATSTR("links"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLinks);
+                    setLinks(refVal_setLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            if(field.first == _XPLATSTR("fromUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
+                    setFromUserId(refVal_setFromUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserDisplayName")):
+            if(field.first == _XPLATSTR("fromUserDisplayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserDisplayName);
+                    setFromUserDisplayName(refVal_setFromUserDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            if(field.first == _XPLATSTR("tags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
+                    setTags(refVal_setTags);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("media"))))
+    return ok;
+}
+
+void CreateFeedPostParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Title))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("media")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMedia);
-            setMedia(refVal_setMedia);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("links"))))
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("links")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLinks);
-            setLinks(refVal_setLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("contentHTML")), m_ContentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserId"))))
+    if(m_FieldsSet.test(FieldBit_Media))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
-            setFromUserId(refVal_setFromUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("media")), m_Media);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName"))))
+    if(m_FieldsSet.test(FieldBit_Links))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserDisplayName);
-            setFromUserDisplayName(refVal_setFromUserDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("links")), m_Links);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tags"))))
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tags")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
-            setTags(refVal_setTags);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserId")), m_FromUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserDisplayName")), m_FromUserDisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tags")), m_Tags);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
+    }
+}
+
+bool CreateFeedPostParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, utility::string_t> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("contentHTML")):
+            {
+                utility::string_t refVal_setContentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setContentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setContentHTML(refVal_setContentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("media")):
+            {
+                std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
+                if(!ModelBase::readBinary(reader, field, refVal_setMedia))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMedia(refVal_setMedia);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("links")):
+            {
+                std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLinks(refVal_setLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            {
+                utility::string_t refVal_setFromUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserId(refVal_setFromUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserDisplayName")):
+            {
+                utility::string_t refVal_setFromUserDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserDisplayName(refVal_setFromUserDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            {
+                std::vector<utility::string_t> refVal_setTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTags(refVal_setTags);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateFeedPostParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -191,35 +404,35 @@ void CreateFeedPostParams::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_ContentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("contentHTML")), m_ContentHTML));
     }
-    if(m_MediaIsSet)
+    if(m_FieldsSet.test(FieldBit_Media))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("media")), m_Media));
     }
-    if(m_LinksIsSet)
+    if(m_FieldsSet.test(FieldBit_Links))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("links")), m_Links));
     }
-    if(m_FromUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserId")), m_FromUserId));
     }
-    if(m_FromUserDisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName")), m_FromUserDisplayName));
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tags")), m_Tags));
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
@@ -295,17 +508,17 @@ utility::string_t CreateFeedPostParams::getTitle() const
 void CreateFeedPostParams::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool CreateFeedPostParams::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void CreateFeedPostParams::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t CreateFeedPostParams::getContentHTML() const
 {
@@ -316,17 +529,17 @@ utility::string_t CreateFeedPostParams::getContentHTML() const
 void CreateFeedPostParams::setContentHTML(const utility::string_t& value)
 {
     m_ContentHTML = value;
-    m_ContentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_ContentHTML);
 }
 
 bool CreateFeedPostParams::contentHTMLIsSet() const
 {
-    return m_ContentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_ContentHTML);
 }
 
 void CreateFeedPostParams::unsetContentHTML()
 {
-    m_ContentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_ContentHTML);
 }
 std::vector<std::shared_ptr<FeedPostMediaItem>> CreateFeedPostParams::getMedia() const
 {
@@ -337,17 +550,17 @@ std::vector<std::shared_ptr<FeedPostMediaItem>> CreateFeedPostParams::getMedia()
 void CreateFeedPostParams::setMedia(const std::vector<std::shared_ptr<FeedPostMediaItem>>& value)
 {
     m_Media = value;
-    m_MediaIsSet = true;
+    m_FieldsSet.set(FieldBit_Media);
 }
 
 bool CreateFeedPostParams::mediaIsSet() const
 {
-    return m_MediaIsSet;
+    return m_FieldsSet.test(FieldBit_Media);
 }
 
 void CreateFeedPostParams::unsetMedia()
 {
-    m_MediaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Media);
 }
 std::vector<std::shared_ptr<FeedPostLink>> CreateFeedPostParams::getLinks() const
 {
@@ -358,17 +571,17 @@ std::vector<std::shared_ptr<FeedPostLink>> CreateFeedPostParams::getLinks() cons
 void CreateFeedPostParams::setLinks(const std::vector<std::shared_ptr<FeedPostLink>>& value)
 {
     m_Links = value;
-    m_LinksIsSet = true;
+    m_FieldsSet.set(FieldBit_Links);
 }
 
 bool CreateFeedPostParams::linksIsSet() const
 {
-    return m_LinksIsSet;
+    return m_FieldsSet.test(FieldBit_Links);
 }
 
 void CreateFeedPostParams::unsetLinks()
 {
-    m_LinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_Links);
 }
 utility::string_t CreateFeedPostParams::getFromUserId() const
 {
@@ -379,17 +592,17 @@ utility::string_t CreateFeedPostParams::getFromUserId() const
 void CreateFeedPostParams::setFromUserId(const utility::string_t& value)
 {
     m_FromUserId = value;
-    m_FromUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_FromUserId);
 }
 
 bool CreateFeedPostParams::fromUserIdIsSet() const
 {
-    return m_FromUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_FromUserId);
 }
 
 void CreateFeedPostParams::unsetFromUserId()
 {
-    m_FromUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromUserId);
 }
 utility::string_t CreateFeedPostParams::getFromUserDisplayName() const
 {
@@ -400,17 +613,17 @@ utility::string_t CreateFeedPostParams::getFromUserDisplayName() const
 void CreateFeedPostParams::setFromUserDisplayName(const utility::string_t& value)
 {
     m_FromUserDisplayName = value;
-    m_FromUserDisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_FromUserDisplayName);
 }
 
 bool CreateFeedPostParams::fromUserDisplayNameIsSet() const
 {
-    return m_FromUserDisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_FromUserDisplayName);
 }
 
 void CreateFeedPostParams::unsetFromUserDisplayName()
 {
-    m_FromUserDisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromUserDisplayName);
 }
 std::vector<utility::string_t> CreateFeedPostParams::getTags() const
 {
@@ -421,17 +634,17 @@ std::vector<utility::string_t> CreateFeedPostParams::getTags() const
 void CreateFeedPostParams::setTags(const std::vector<utility::string_t>& value)
 {
     m_Tags = value;
-    m_TagsIsSet = true;
+    m_FieldsSet.set(FieldBit_Tags);
 }
 
 bool CreateFeedPostParams::tagsIsSet() const
 {
-    return m_TagsIsSet;
+    return m_FieldsSet.test(FieldBit_Tags);
 }
 
 void CreateFeedPostParams::unsetTags()
 {
-    m_TagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tags);
 }
 std::map<utility::string_t, utility::string_t> CreateFeedPostParams::getMeta() const
 {
@@ -442,17 +655,17 @@ std::map<utility::string_t, utility::string_t> CreateFeedPostParams::getMeta() c
 void CreateFeedPostParams::setMeta(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Meta = value;
-    m_MetaIsSet = true;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool CreateFeedPostParams::metaIsSet() const
 {
-    return m_MetaIsSet;
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void CreateFeedPostParams::unsetMeta()
 {
-    m_MetaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 CreateFeedPostResponse::CreateFeedPostResponse()
 {
-    m_StatusIsSet = false;
-    m_FeedPostIsSet = false;
 }
 
 CreateFeedPostResponse::~CreateFeedPostResponse()
@@ -36,12 +34,12 @@ void CreateFeedPostResponse::validate()
 web::json::value CreateFeedPostResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_FeedPostIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPost))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedPost"))] = ModelBase::toJson(m_FeedPost);
@@ -50,32 +48,119 @@ web::json::value CreateFeedPostResponse::toJson() const
     return val;
 }
 
+void CreateFeedPostResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPost))
+    {
+        
+        writer.key(_XPLATSTR("feedPost"));
+        ModelBase::writeJson(writer, m_FeedPost);
+    }
+
+    writer.endObject();
+}
+
 bool CreateFeedPostResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedPost")):
+            if(field.first == _XPLATSTR("feedPost"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<FeedPost> refVal_setFeedPost;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPost);
+                    setFeedPost(refVal_setFeedPost);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedPost"))))
+    return ok;
+}
+
+void CreateFeedPostResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedPost")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPost))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedPost")), m_FeedPost);
+    }
+}
+
+bool CreateFeedPostResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<FeedPost> refVal_setFeedPost;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPost);
-            setFeedPost(refVal_setFeedPost);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedPost")):
+            {
+                std::shared_ptr<FeedPost> refVal_setFeedPost;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedPost))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedPost(refVal_setFeedPost);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateFeedPostResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void CreateFeedPostResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_FeedPostIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPost))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedPost")), m_FeedPost));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> CreateFeedPostResponse::getStatus() const
 void CreateFeedPostResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool CreateFeedPostResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void CreateFeedPostResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<FeedPost> CreateFeedPostResponse::getFeedPost() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<FeedPost> CreateFeedPostResponse::getFeedPost() const
 void CreateFeedPostResponse::setFeedPost(const std::shared_ptr<FeedPost>& value)
 {
     m_FeedPost = value;
-    m_FeedPostIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedPost);
 }
 
 bool CreateFeedPostResponse::feedPostIsSet() const
 {
-    return m_FeedPostIsSet;
+    return m_FieldsSet.test(FieldBit_FeedPost);
 }
 
 void CreateFeedPostResponse::unsetFeedPost()
 {
-    m_FeedPostIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedPost);
 }
 
 }
@@ -20,14 +20,6 @@ namespace model {
 
 CreateModeratorBody::CreateModeratorBody()
 {
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_Email = utility::conversions::to_string_t("");
-    m_EmailIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_ModerationGroupIdsIsSet = false;
-    m_AdditionalPropertiesIsSet = false;
 }
 
 CreateModeratorBody::~CreateModeratorBody()
@@ -42,28 +34,28 @@ void CreateModeratorBody::validate()
 web::json::value CreateModeratorBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds);
     }
     // Serialize additional properties
-    if(m_AdditionalPropertiesIsSet)
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
         for(const auto& item : m_AdditionalProperties)
         {
@@ -74,69 +66,227 @@ web::json::value CreateModeratorBody::toJson() const
     return val;
 }
 
-bool CreateModeratorBody::fromJson(const web::json::value& val)
+void CreateModeratorBody::writeJson(JsonWriter& writer) const
 {
-    bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("moderationGroupIds"));
+        ModelBase::writeJson(writer, m_ModerationGroupIds);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
+            writer.key(item.first);
+            writer.value(item.second);
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+
+    writer.endObject();
+}
+
+bool CreateModeratorBody::fromJson(const web::json::value& val)
+{
+    bool ok = true;
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            if(field.first == _XPLATSTR("moderationGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModerationGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
+                    setModerationGroupIds(refVal_setModerationGroupIds);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        // This is an additional property
+        m_AdditionalProperties[field.first] = fieldValue;
+        m_FieldsSet.set(FieldBit_AdditionalProperties);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))))
+    return ok;
+}
+
+void CreateModeratorBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            std::vector<utility::string_t> refVal_setModerationGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
-            setModerationGroupIds(refVal_setModerationGroupIds);
-            
+            writer.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);
+            writer.writeString(item.first);
+            writer.writeString(item.second.serialize());
         }
     }
-    // Capture additional properties (keys not defined in the schema)
-    if(val.is_object())
+}
+
+bool CreateModeratorBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        for(const auto& item : val.as_object())
+        switch(field.tag)
         {
-            // Skip known properties
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("name"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("email"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("userId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))) continue;
-            // This is an additional property
-            m_AdditionalProperties[item.first] = item.second;
-            m_AdditionalPropertiesIsSet = true;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setModerationGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationGroupIds(refVal_setModerationGroupIds);
+            }
+            continue;
+        default:
+            break;
         }
+        if(field.wireType == BinaryWireType::Named)
+        {
+            utility::string_t key;
+            utility::string_t text;
+            if(reader.readString(key) && reader.readString(text))
+            {
+                try
+                {
+                    m_AdditionalProperties[key] = web::json::value::parse(text);
+                }
+                catch(const web::json::json_exception&)
+                {
+                    return false;
+                }
+                m_FieldsSet.set(FieldBit_AdditionalProperties);
+            }
+            continue;
+        }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateModeratorBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -146,19 +296,19 @@ void CreateModeratorBody::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds));
     }
@@ -210,17 +360,17 @@ utility::string_t CreateModeratorBody::getName() const
 void CreateModeratorBody::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool CreateModeratorBody::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void CreateModeratorBody::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t CreateModeratorBody::getEmail() const
 {
@@ -231,17 +381,17 @@ utility::string_t CreateModeratorBody::getEmail() const
 void CreateModeratorBody::setEmail(const utility::string_t& value)
 {
     m_Email = value;
-    m_EmailIsSet = true;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool CreateModeratorBody::emailIsSet() const
 {
-    return m_EmailIsSet;
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void CreateModeratorBody::unsetEmail()
 {
-    m_EmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_Email);
 }
 utility::string_t CreateModeratorBody::getUserId() const
 {
@@ -252,17 +402,17 @@ utility::string_t CreateModeratorBody::getUserId() const
 void CreateModeratorBody::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool CreateModeratorBody::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void CreateModeratorBody::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 std::vector<utility::string_t> CreateModeratorBody::getModerationGroupIds() const
 {
@@ -273,17 +423,17 @@ std::vector<utility::string_t> CreateModeratorBody::getModerationGroupIds() cons
 void CreateModeratorBody::setModerationGroupIds(const std::vector<utility::string_t>& value)
 {
     m_ModerationGroupIds = value;
-    m_ModerationGroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ModerationGroupIds);
 }
 
 bool CreateModeratorBody::moderationGroupIdsIsSet() const
 {
-    return m_ModerationGroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ModerationGroupIds);
 }
 
 void CreateModeratorBody::unsetModerationGroupIds()
 {
-    m_ModerationGroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModerationGroupIds);
 }
 
 
@@ -295,24 +445,24 @@ std::map<utility::string_t, web::json::value> CreateModeratorBody::getAdditional
 void CreateModeratorBody::setAdditionalProperties(const std::map<utility::string_t, web::json::value>& value)
 {
     m_AdditionalProperties = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 void CreateModeratorBody::addAdditionalProperty(const utility::string_t& key, const web::json::value& value)
 {
     m_AdditionalProperties[key] = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 bool CreateModeratorBody::additionalPropertiesIsSet() const
 {
-    return m_AdditionalPropertiesIsSet;
+    return m_FieldsSet.test(FieldBit_AdditionalProperties);
 }
 
 void CreateModeratorBody::unsetAdditionalProperties()
 {
     m_AdditionalProperties.clear();
-    m_AdditionalPropertiesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdditionalProperties);
 }
 }
 }
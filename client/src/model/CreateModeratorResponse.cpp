@@ -20,8 +20,6 @@ namespace model {
 
 CreateModeratorResponse::CreateModeratorResponse()
 {
-    m_StatusIsSet = false;
-    m_ModeratorIsSet = false;
 }
 
 CreateModeratorResponse::~CreateModeratorResponse()
@@ -36,12 +34,12 @@ void CreateModeratorResponse::validate()
 web::json::value CreateModeratorResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_Moderator))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderator"))] = ModelBase::toJson(m_Moderator);
@@ -50,32 +48,119 @@ web::json::value CreateModeratorResponse::toJson() const
     return val;
 }
 
+void CreateModeratorResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Moderator))
+    {
+        
+        writer.key(_XPLATSTR("moderator"));
+        ModelBase::writeJson(writer, m_Moderator);
+    }
+
+    writer.endObject();
+}
+
 bool CreateModeratorResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderator")):
+            if(field.first == _XPLATSTR("moderator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Moderator> refVal_setModerator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerator);
+                    setModerator(refVal_setModerator);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderator"))))
+    return ok;
+}
+
+void CreateModeratorResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderator")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Moderator))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderator")), m_Moderator);
+    }
+}
+
+bool CreateModeratorResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<Moderator> refVal_setModerator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerator);
-            setModerator(refVal_setModerator);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderator")):
+            {
+                std::shared_ptr<Moderator> refVal_setModerator;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerator(refVal_setModerator);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateModeratorResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void CreateModeratorResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_Moderator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderator")), m_Moderator));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> CreateModeratorResponse::getStatus() const
 void CreateModeratorResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool CreateModeratorResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void CreateModeratorResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<Moderator> CreateModeratorResponse::getModerator() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<Moderator> CreateModeratorResponse::getModerator() const
 void CreateModeratorResponse::setModerator(const std::shared_ptr<Moderator>& value)
 {
     m_Moderator = value;
-    m_ModeratorIsSet = true;
+    m_FieldsSet.set(FieldBit_Moderator);
 }
 
 bool CreateModeratorResponse::moderatorIsSet() const
 {
-    return m_ModeratorIsSet;
+    return m_FieldsSet.test(FieldBit_Moderator);
 }
 
 void CreateModeratorResponse::unsetModerator()
 {
-    m_ModeratorIsSet = false;
+    m_FieldsSet.reset(FieldBit_Moderator);
 }
 
 }
@@ -20,19 +20,7 @@ namespace model {
 
 CreateQuestionResultBody::CreateQuestionResultBody()
 {
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
     m_Value = 0.0;
-    m_ValueIsSet = false;
-    m_QuestionId = utility::conversions::to_string_t("");
-    m_QuestionIdIsSet = false;
-    m_AnonUserId = utility::conversions::to_string_t("");
-    m_AnonUserIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_CommentId = utility::conversions::to_string_t("");
-    m_CommentIdIsSet = false;
-    m_AdditionalPropertiesIsSet = false;
 }
 
 CreateQuestionResultBody::~CreateQuestionResultBody()
@@ -47,43 +35,43 @@ void CreateQuestionResultBody::validate()
 web::json::value CreateQuestionResultBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_ValueIsSet)
+    if(m_FieldsSet.test(FieldBit_Value))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("value"))] = ModelBase::toJson(m_Value);
     }
-    if(m_QuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionId"))] = ModelBase::toJson(m_QuestionId);
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_CommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentId"))] = ModelBase::toJson(m_CommentId);
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
     // Serialize additional properties
-    if(m_AdditionalPropertiesIsSet)
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
         for(const auto& item : m_AdditionalProperties)
         {
@@ -94,105 +82,329 @@ web::json::value CreateQuestionResultBody::toJson() const
     return val;
 }
 
-bool CreateQuestionResultBody::fromJson(const web::json::value& val)
+void CreateQuestionResultBody::writeJson(JsonWriter& writer) const
 {
-    bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("value"))))
+    if(m_FieldsSet.test(FieldBit_Value))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("value")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setValue);
-            setValue(refVal_setValue);
-            
-        }
+        
+        writer.key(_XPLATSTR("value"));
+        ModelBase::writeJson(writer, m_Value);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionId"))))
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setQuestionId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionId);
-            setQuestionId(refVal_setQuestionId);
-            
-        }
+        
+        writer.key(_XPLATSTR("questionId"));
+        ModelBase::writeJson(writer, m_QuestionId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        
+        writer.key(_XPLATSTR("commentId"));
+        ModelBase::writeJson(writer, m_CommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+            writer.key(item.first);
+            writer.value(item.second);
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentId"))))
+
+    writer.endObject();
+}
+
+bool CreateQuestionResultBody::fromJson(const web::json::value& val)
+{
+    bool ok = true;
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
-            setCommentId(refVal_setCommentId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("value")):
+            if(field.first == _XPLATSTR("value"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setValue);
+                    setValue(refVal_setValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionId")):
+            if(field.first == _XPLATSTR("questionId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setQuestionId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionId);
+                    setQuestionId(refVal_setQuestionId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            if(field.first == _XPLATSTR("commentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
+                    setCommentId(refVal_setCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<MetaItem>> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        // This is an additional property
+        m_AdditionalProperties[field.first] = fieldValue;
+        m_FieldsSet.set(FieldBit_AdditionalProperties);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    return ok;
+}
+
+void CreateQuestionResultBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Value))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("value")), m_Value);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionId")), m_QuestionId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentId")), m_CommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            std::vector<std::shared_ptr<MetaItem>> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
+            writer.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);
+            writer.writeString(item.first);
+            writer.writeString(item.second.serialize());
         }
     }
-    // Capture additional properties (keys not defined in the schema)
-    if(val.is_object())
+}
+
+bool CreateQuestionResultBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        for(const auto& item : val.as_object())
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("value")):
+            {
+                double refVal_setValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setValue(refVal_setValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionId")):
+            {
+                utility::string_t refVal_setQuestionId;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionId(refVal_setQuestionId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            {
+                utility::string_t refVal_setCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentId(refVal_setCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::vector<std::shared_ptr<MetaItem>> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        default:
+            break;
+        }
+        if(field.wireType == BinaryWireType::Named)
         {
-            // Skip known properties
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("urlId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("value"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("questionId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("anonUserId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("userId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("commentId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("meta"))) continue;
-            // This is an additional property
-            m_AdditionalProperties[item.first] = item.second;
-            m_AdditionalPropertiesIsSet = true;
+            utility::string_t key;
+            utility::string_t text;
+            if(reader.readString(key) && reader.readString(text))
+            {
+                try
+                {
+                    m_AdditionalProperties[key] = web::json::value::parse(text);
+                }
+                catch(const web::json::json_exception&)
+                {
+                    return false;
+                }
+                m_FieldsSet.set(FieldBit_AdditionalProperties);
+            }
+            continue;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateQuestionResultBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -202,33 +414,33 @@ void CreateQuestionResultBody::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_ValueIsSet)
+    if(m_FieldsSet.test(FieldBit_Value))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("value")), m_Value));
     }
-    if(m_QuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionId")), m_QuestionId));
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_CommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentId")), m_CommentId));
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
 }
 
@@ -296,17 +508,17 @@ utility::string_t CreateQuestionResultBody::getUrlId() const
 void CreateQuestionResultBody::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool CreateQuestionResultBody::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void CreateQuestionResultBody::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 double CreateQuestionResultBody::getValue() const
 {
@@ -316,17 +528,17 @@ double CreateQuestionResultBody::getValue() const
 void CreateQuestionResultBody::setValue(double value)
 {
     m_Value = value;
-    m_ValueIsSet = true;
+    m_FieldsSet.set(FieldBit_Value);
 }
 
 bool CreateQuestionResultBody::valueIsSet() const
 {
-    return m_ValueIsSet;
+    return m_FieldsSet.test(FieldBit_Value);
 }
 
 void CreateQuestionResultBody::unsetValue()
 {
-    m_ValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_Value);
 }
 utility::string_t CreateQuestionResultBody::getQuestionId() const
 {
@@ -337,17 +549,17 @@ utility::string_t CreateQuestionResultBody::getQuestionId() const
 void CreateQuestionResultBody::setQuestionId(const utility::string_t& value)
 {
     m_QuestionId = value;
-    m_QuestionIdIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionId);
 }
 
 bool CreateQuestionResultBody::questionIdIsSet() const
 {
-    return m_QuestionIdIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionId);
 }
 
 void CreateQuestionResultBody::unsetQuestionId()
 {
-    m_QuestionIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionId);
 }
 utility::string_t CreateQuestionResultBody::getAnonUserId() const
 {
@@ -358,17 +570,17 @@ utility::string_t CreateQuestionResultBody::getAnonUserId() const
 void CreateQuestionResultBody::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
-    m_AnonUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool CreateQuestionResultBody::anonUserIdIsSet() const
 {
-    return m_AnonUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void CreateQuestionResultBody::unsetAnonUserId()
 {
-    m_AnonUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t CreateQuestionResultBody::getUserId() const
 {
@@ -379,17 +591,17 @@ utility::string_t CreateQuestionResultBody::getUserId() const
 void CreateQuestionResultBody::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool CreateQuestionResultBody::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void CreateQuestionResultBody::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t CreateQuestionResultBody::getCommentId() const
 {
@@ -400,37 +612,38 @@ utility::string_t CreateQuestionResultBody::getCommentId() const
 void CreateQuestionResultBody::setCommentId(const utility::string_t& value)
 {
     m_CommentId = value;
-    m_CommentIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentId);
 }
 
 bool CreateQuestionResultBody::commentIdIsSet() const
 {
-    return m_CommentIdIsSet;
+    return m_FieldsSet.test(FieldBit_CommentId);
 }
 
 void CreateQuestionResultBody::unsetCommentId()
 {
-    m_CommentIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentId);
 }
 std::vector<std::shared_ptr<MetaItem>> CreateQuestionResultBody::getMeta() const
 {
-    return m_Meta.get();
+    return m_Meta;
 }
 
 
 void CreateQuestionResultBody::setMeta(const std::vector<std::shared_ptr<MetaItem>>& value)
 {
     m_Meta = value;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool CreateQuestionResultBody::metaIsSet() const
 {
-    return m_Meta.has_value();
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void CreateQuestionResultBody::unsetMeta()
 {
-    m_Meta.reset();
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 
 
@@ -442,24 +655,24 @@ std::map<utility::string_t, web::json::value> CreateQuestionResultBody::getAddit
 void CreateQuestionResultBody::setAdditionalProperties(const std::map<utility::string_t, web::json::value>& value)
 {
     m_AdditionalProperties = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 void CreateQuestionResultBody::addAdditionalProperty(const utility::string_t& key, const web::json::value& value)
 {
     m_AdditionalProperties[key] = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 bool CreateQuestionResultBody::additionalPropertiesIsSet() const
 {
-    return m_AdditionalPropertiesIsSet;
+    return m_FieldsSet.test(FieldBit_AdditionalProperties);
 }
 
 void CreateQuestionResultBody::unsetAdditionalProperties()
 {
     m_AdditionalProperties.clear();
-    m_AdditionalPropertiesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdditionalProperties);
 }
 }
 }
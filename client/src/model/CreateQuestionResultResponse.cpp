@@ -20,8 +20,6 @@ namespace model {
 
 CreateQuestionResultResponse::CreateQuestionResultResponse()
 {
-    m_StatusIsSet = false;
-    m_QuestionResultIsSet = false;
 }
 
 CreateQuestionResultResponse::~CreateQuestionResultResponse()
@@ -36,12 +34,12 @@ void CreateQuestionResultResponse::validate()
 web::json::value CreateQuestionResultResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_QuestionResultIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionResult))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionResult"))] = ModelBase::toJson(m_QuestionResult);
@@ -50,32 +48,119 @@ web::json::value CreateQuestionResultResponse::toJson() const
     return val;
 }
 
+void CreateQuestionResultResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionResult))
+    {
+        
+        writer.key(_XPLATSTR("questionResult"));
+        ModelBase::writeJson(writer, m_QuestionResult);
+    }
+
+    writer.endObject();
+}
+
 bool CreateQuestionResultResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionResult")):
+            if(field.first == _XPLATSTR("questionResult"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QuestionResult> refVal_setQuestionResult;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionResult);
+                    setQuestionResult(refVal_setQuestionResult);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionResult"))))
+    return ok;
+}
+
+void CreateQuestionResultResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionResult")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionResult))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionResult")), m_QuestionResult);
+    }
+}
+
+bool CreateQuestionResultResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<QuestionResult> refVal_setQuestionResult;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionResult);
-            setQuestionResult(refVal_setQuestionResult);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionResult")):
+            {
+                std::shared_ptr<QuestionResult> refVal_setQuestionResult;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionResult))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionResult(refVal_setQuestionResult);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateQuestionResultResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void CreateQuestionResultResponse::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_QuestionResultIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionResult))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionResult")), m_QuestionResult));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> CreateQuestionResultResponse::getStatus() const
 void CreateQuestionResultResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool CreateQuestionResultResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void CreateQuestionResultResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<QuestionResult> CreateQuestionResultResponse::getQuestionResult() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<QuestionResult> CreateQuestionResultResponse::getQuestionResult(
 void CreateQuestionResultResponse::setQuestionResult(const std::shared_ptr<QuestionResult>& value)
 {
     m_QuestionResult = value;
-    m_QuestionResultIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionResult);
 }
 
 bool CreateQuestionResultResponse::questionResultIsSet() const
 {
-    return m_QuestionResultIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionResult);
 }
 
 void CreateQuestionResultResponse::unsetQuestionResult()
 {
-    m_QuestionResultIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionResult);
 }
 
 }
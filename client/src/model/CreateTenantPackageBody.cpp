@@ -20,95 +20,50 @@ namespace model {
 
 CreateTenantPackageBody::CreateTenantPackageBody()
 {
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
     m_MaxMonthlyPageLoads = 0.0;
-    m_MaxMonthlyPageLoadsIsSet = false;
     m_MaxMonthlyAPICredits = 0.0;
-    m_MaxMonthlyAPICreditsIsSet = false;
     m_MaxMonthlySmallWidgetsCredits = 0.0;
-    m_MaxMonthlySmallWidgetsCreditsIsSet = false;
     m_MaxMonthlyComments = 0.0;
-    m_MaxMonthlyCommentsIsSet = false;
     m_MaxConcurrentUsers = 0.0;
-    m_MaxConcurrentUsersIsSet = false;
     m_MaxTenantUsers = 0.0;
-    m_MaxTenantUsersIsSet = false;
     m_MaxSSOUsers = 0.0;
-    m_MaxSSOUsersIsSet = false;
     m_MaxModerators = 0.0;
-    m_MaxModeratorsIsSet = false;
     m_MaxDomains = 0.0;
-    m_MaxDomainsIsSet = false;
     m_MaxWhiteLabeledTenants = 0.0;
-    m_MaxWhiteLabeledTenantsIsSet = false;
     m_MaxMonthlyEventLogRequests = 0.0;
-    m_MaxMonthlyEventLogRequestsIsSet = false;
     m_MaxCustomCollectionSize = 0.0;
-    m_MaxCustomCollectionSizeIsSet = false;
     m_HasWhiteLabeling = false;
-    m_HasWhiteLabelingIsSet = false;
     m_HasDebranding = false;
-    m_HasDebrandingIsSet = false;
     m_HasLLMSpamDetection = false;
-    m_HasLLMSpamDetectionIsSet = false;
-    m_ForWhoText = utility::conversions::to_string_t("");
-    m_ForWhoTextIsSet = false;
-    m_FeatureTaglinesIsSet = false;
     m_HasAuditing = false;
-    m_HasAuditingIsSet = false;
     m_HasFlexPricing = false;
-    m_HasFlexPricingIsSet = false;
     m_EnableSAML = false;
-    m_EnableSAMLIsSet = false;
     m_FlexPageLoadCostCents = 0.0;
-    m_FlexPageLoadCostCentsIsSet = false;
     m_FlexPageLoadUnit = 0.0;
-    m_FlexPageLoadUnitIsSet = false;
     m_FlexCommentCostCents = 0.0;
-    m_FlexCommentCostCentsIsSet = false;
     m_FlexCommentUnit = 0.0;
-    m_FlexCommentUnitIsSet = false;
     m_FlexSSOUserCostCents = 0.0;
-    m_FlexSSOUserCostCentsIsSet = false;
     m_FlexSSOUserUnit = 0.0;
-    m_FlexSSOUserUnitIsSet = false;
     m_FlexAPICreditCostCents = 0.0;
-    m_FlexAPICreditCostCentsIsSet = false;
     m_FlexAPICreditUnit = 0.0;
-    m_FlexAPICreditUnitIsSet = false;
     m_FlexSmallWidgetsCreditCostCents = 0.0;
-    m_FlexSmallWidgetsCreditCostCentsIsSet = false;
     m_FlexSmallWidgetsCreditUnit = 0.0;
-    m_FlexSmallWidgetsCreditUnitIsSet = false;
     m_FlexModeratorCostCents = 0.0;
-    m_FlexModeratorCostCentsIsSet = false;
     m_FlexModeratorUnit = 0.0;
-    m_FlexModeratorUnitIsSet = false;
     m_FlexAdminCostCents = 0.0;
-    m_FlexAdminCostCentsIsSet = false;
     m_FlexAdminUnit = 0.0;
-    m_FlexAdminUnitIsSet = false;
     m_FlexDomainCostCents = 0.0;
-    m_FlexDomainCostCentsIsSet = false;
     m_FlexDomainUnit = 0.0;
-    m_FlexDomainUnitIsSet = false;
     m_FlexLLMCostCents = 0.0;
-    m_FlexLLMCostCentsIsSet = false;
     m_FlexLLMUnit = 0.0;
-    m_FlexLLMUnitIsSet = false;
     m_FlexMinimumCostCents = 0.0;
-    m_FlexMinimumCostCentsIsSet = false;
     m_FlexManagedTenantCostCents = 0.0;
-    m_FlexManagedTenantCostCentsIsSet = false;
     m_FlexSSOAdminCostCents = 0.0;
-    m_FlexSSOAdminCostCentsIsSet = false;
     m_FlexSSOAdminUnit = 0.0;
-    m_FlexSSOAdminUnitIsSet = false;
     m_FlexSSOModeratorCostCents = 0.0;
-    m_FlexSSOModeratorCostCentsIsSet = false;
     m_FlexSSOModeratorUnit = 0.0;
-    m_FlexSSOModeratorUnitIsSet = false;
+    m_MonthlyCostUSD = 0.0;
+    m_YearlyCostUSD = 0.0;
 }
 
 CreateTenantPackageBody::~CreateTenantPackageBody()
@@ -123,247 +78,247 @@ void CreateTenantPackageBody::validate()
 web::json::value CreateTenantPackageBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_MonthlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))] = ModelBase::toJson(m_MonthlyCostUSD.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))] = ModelBase::toJson(m_MonthlyCostUSD);
     }
-    if(m_YearlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))] = ModelBase::toJson(m_YearlyCostUSD.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))] = ModelBase::toJson(m_YearlyCostUSD);
     }
-    if(m_MonthlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId"))] = ModelBase::toJson(m_MonthlyStripePlanId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId"))] = ModelBase::toJson(m_MonthlyStripePlanId);
     }
-    if(m_YearlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId"))] = ModelBase::toJson(m_YearlyStripePlanId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId"))] = ModelBase::toJson(m_YearlyStripePlanId);
     }
-    if(m_MaxMonthlyPageLoadsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads"))] = ModelBase::toJson(m_MaxMonthlyPageLoads);
     }
-    if(m_MaxMonthlyAPICreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits"))] = ModelBase::toJson(m_MaxMonthlyAPICredits);
     }
-    if(m_MaxMonthlySmallWidgetsCreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits"))] = ModelBase::toJson(m_MaxMonthlySmallWidgetsCredits);
     }
-    if(m_MaxMonthlyCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments"))] = ModelBase::toJson(m_MaxMonthlyComments);
     }
-    if(m_MaxConcurrentUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers"))] = ModelBase::toJson(m_MaxConcurrentUsers);
     }
-    if(m_MaxTenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers"))] = ModelBase::toJson(m_MaxTenantUsers);
     }
-    if(m_MaxSSOUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers"))] = ModelBase::toJson(m_MaxSSOUsers);
     }
-    if(m_MaxModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxModerators"))] = ModelBase::toJson(m_MaxModerators);
     }
-    if(m_MaxDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxDomains"))] = ModelBase::toJson(m_MaxDomains);
     }
-    if(m_MaxWhiteLabeledTenantsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants"))] = ModelBase::toJson(m_MaxWhiteLabeledTenants);
     }
-    if(m_MaxMonthlyEventLogRequestsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests"))] = ModelBase::toJson(m_MaxMonthlyEventLogRequests);
     }
-    if(m_MaxCustomCollectionSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize"))] = ModelBase::toJson(m_MaxCustomCollectionSize);
     }
-    if(m_HasWhiteLabelingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling"))] = ModelBase::toJson(m_HasWhiteLabeling);
     }
-    if(m_HasDebrandingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasDebranding"))] = ModelBase::toJson(m_HasDebranding);
     }
-    if(m_HasLLMSpamDetectionIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection"))] = ModelBase::toJson(m_HasLLMSpamDetection);
     }
-    if(m_ForWhoTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("forWhoText"))] = ModelBase::toJson(m_ForWhoText);
     }
-    if(m_FeatureTaglinesIsSet)
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("featureTaglines"))] = ModelBase::toJson(m_FeatureTaglines);
     }
-    if(m_HasAuditingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasAuditing"))] = ModelBase::toJson(m_HasAuditing);
     }
-    if(m_HasFlexPricingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing"))] = ModelBase::toJson(m_HasFlexPricing);
     }
-    if(m_EnableSAMLIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableSAML"))] = ModelBase::toJson(m_EnableSAML);
     }
-    if(m_FlexPageLoadCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents"))] = ModelBase::toJson(m_FlexPageLoadCostCents);
     }
-    if(m_FlexPageLoadUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit"))] = ModelBase::toJson(m_FlexPageLoadUnit);
     }
-    if(m_FlexCommentCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents"))] = ModelBase::toJson(m_FlexCommentCostCents);
     }
-    if(m_FlexCommentUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit"))] = ModelBase::toJson(m_FlexCommentUnit);
     }
-    if(m_FlexSSOUserCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents"))] = ModelBase::toJson(m_FlexSSOUserCostCents);
     }
-    if(m_FlexSSOUserUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit"))] = ModelBase::toJson(m_FlexSSOUserUnit);
     }
-    if(m_FlexAPICreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents"))] = ModelBase::toJson(m_FlexAPICreditCostCents);
     }
-    if(m_FlexAPICreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit"))] = ModelBase::toJson(m_FlexAPICreditUnit);
     }
-    if(m_FlexSmallWidgetsCreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents"))] = ModelBase::toJson(m_FlexSmallWidgetsCreditCostCents);
     }
-    if(m_FlexSmallWidgetsCreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit"))] = ModelBase::toJson(m_FlexSmallWidgetsCreditUnit);
     }
-    if(m_FlexModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents"))] = ModelBase::toJson(m_FlexModeratorCostCents);
     }
-    if(m_FlexModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit"))] = ModelBase::toJson(m_FlexModeratorUnit);
     }
-    if(m_FlexAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents"))] = ModelBase::toJson(m_FlexAdminCostCents);
     }
-    if(m_FlexAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit"))] = ModelBase::toJson(m_FlexAdminUnit);
     }
-    if(m_FlexDomainCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents"))] = ModelBase::toJson(m_FlexDomainCostCents);
     }
-    if(m_FlexDomainUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit"))] = ModelBase::toJson(m_FlexDomainUnit);
     }
-    if(m_FlexLLMCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents"))] = ModelBase::toJson(m_FlexLLMCostCents);
     }
-    if(m_FlexLLMUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit"))] = ModelBase::toJson(m_FlexLLMUnit);
     }
-    if(m_FlexMinimumCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents"))] = ModelBase::toJson(m_FlexMinimumCostCents);
     }
-    if(m_FlexManagedTenantCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents"))] = ModelBase::toJson(m_FlexManagedTenantCostCents);
     }
-    if(m_FlexSSOAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents"))] = ModelBase::toJson(m_FlexSSOAdminCostCents);
     }
-    if(m_FlexSSOAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit"))] = ModelBase::toJson(m_FlexSSOAdminUnit);
     }
-    if(m_FlexSSOModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents"))] = ModelBase::toJson(m_FlexSSOModeratorCostCents);
     }
-    if(m_FlexSSOModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit"))] = ModelBase::toJson(m_FlexSSOModeratorUnit);
@@ -372,549 +327,1717 @@ web::json::value CreateTenantPackageBody::toJson() const
     return val;
 }
 
+void CreateTenantPackageBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
+    {
+        
+        writer.key(_XPLATSTR("monthlyCostUSD"));
+        ModelBase::writeJson(writer, m_MonthlyCostUSD);
+    }
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
+    {
+        
+        writer.key(_XPLATSTR("yearlyCostUSD"));
+        ModelBase::writeJson(writer, m_YearlyCostUSD);
+    }
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
+    {
+        
+        writer.key(_XPLATSTR("monthlyStripePlanId"));
+        ModelBase::writeJson(writer, m_MonthlyStripePlanId);
+    }
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
+    {
+        
+        writer.key(_XPLATSTR("yearlyStripePlanId"));
+        ModelBase::writeJson(writer, m_YearlyStripePlanId);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyPageLoads"));
+        ModelBase::writeJson(writer, m_MaxMonthlyPageLoads);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyAPICredits"));
+        ModelBase::writeJson(writer, m_MaxMonthlyAPICredits);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlySmallWidgetsCredits"));
+        ModelBase::writeJson(writer, m_MaxMonthlySmallWidgetsCredits);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyComments"));
+        ModelBase::writeJson(writer, m_MaxMonthlyComments);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxConcurrentUsers"));
+        ModelBase::writeJson(writer, m_MaxConcurrentUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxTenantUsers"));
+        ModelBase::writeJson(writer, m_MaxTenantUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxSSOUsers"));
+        ModelBase::writeJson(writer, m_MaxSSOUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
+    {
+        
+        writer.key(_XPLATSTR("maxModerators"));
+        ModelBase::writeJson(writer, m_MaxModerators);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
+    {
+        
+        writer.key(_XPLATSTR("maxDomains"));
+        ModelBase::writeJson(writer, m_MaxDomains);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
+    {
+        
+        writer.key(_XPLATSTR("maxWhiteLabeledTenants"));
+        ModelBase::writeJson(writer, m_MaxWhiteLabeledTenants);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyEventLogRequests"));
+        ModelBase::writeJson(writer, m_MaxMonthlyEventLogRequests);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
+    {
+        
+        writer.key(_XPLATSTR("maxCustomCollectionSize"));
+        ModelBase::writeJson(writer, m_MaxCustomCollectionSize);
+    }
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
+    {
+        
+        writer.key(_XPLATSTR("hasWhiteLabeling"));
+        ModelBase::writeJson(writer, m_HasWhiteLabeling);
+    }
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
+    {
+        
+        writer.key(_XPLATSTR("hasDebranding"));
+        ModelBase::writeJson(writer, m_HasDebranding);
+    }
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
+    {
+        
+        writer.key(_XPLATSTR("hasLLMSpamDetection"));
+        ModelBase::writeJson(writer, m_HasLLMSpamDetection);
+    }
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
+    {
+        
+        writer.key(_XPLATSTR("forWhoText"));
+        ModelBase::writeJson(writer, m_ForWhoText);
+    }
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
+    {
+        
+        writer.key(_XPLATSTR("featureTaglines"));
+        ModelBase::writeJson(writer, m_FeatureTaglines);
+    }
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
+    {
+        
+        writer.key(_XPLATSTR("hasAuditing"));
+        ModelBase::writeJson(writer, m_HasAuditing);
+    }
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
+    {
+        
+        writer.key(_XPLATSTR("hasFlexPricing"));
+        ModelBase::writeJson(writer, m_HasFlexPricing);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
+    {
+        
+        writer.key(_XPLATSTR("enableSAML"));
+        ModelBase::writeJson(writer, m_EnableSAML);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexPageLoadCostCents"));
+        ModelBase::writeJson(writer, m_FlexPageLoadCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexPageLoadUnit"));
+        ModelBase::writeJson(writer, m_FlexPageLoadUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexCommentCostCents"));
+        ModelBase::writeJson(writer, m_FlexCommentCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexCommentUnit"));
+        ModelBase::writeJson(writer, m_FlexCommentUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOUserCostCents"));
+        ModelBase::writeJson(writer, m_FlexSSOUserCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOUserUnit"));
+        ModelBase::writeJson(writer, m_FlexSSOUserUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexAPICreditCostCents"));
+        ModelBase::writeJson(writer, m_FlexAPICreditCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexAPICreditUnit"));
+        ModelBase::writeJson(writer, m_FlexAPICreditUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSmallWidgetsCreditCostCents"));
+        ModelBase::writeJson(writer, m_FlexSmallWidgetsCreditCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSmallWidgetsCreditUnit"));
+        ModelBase::writeJson(writer, m_FlexSmallWidgetsCreditUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexModeratorCostCents"));
+        ModelBase::writeJson(writer, m_FlexModeratorCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexModeratorUnit"));
+        ModelBase::writeJson(writer, m_FlexModeratorUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexAdminCostCents"));
+        ModelBase::writeJson(writer, m_FlexAdminCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexAdminUnit"));
+        ModelBase::writeJson(writer, m_FlexAdminUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexDomainCostCents"));
+        ModelBase::writeJson(writer, m_FlexDomainCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexDomainUnit"));
+        ModelBase::writeJson(writer, m_FlexDomainUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexLLMCostCents"));
+        ModelBase::writeJson(writer, m_FlexLLMCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexLLMUnit"));
+        ModelBase::writeJson(writer, m_FlexLLMUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexMinimumCostCents"));
+        ModelBase::writeJson(writer, m_FlexMinimumCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexManagedTenantCostCents"));
+        ModelBase::writeJson(writer, m_FlexManagedTenantCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOAdminCostCents"));
+        ModelBase::writeJson(writer, m_FlexSSOAdminCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOAdminUnit"));
+        ModelBase::writeJson(writer, m_FlexSSOAdminUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOModeratorCostCents"));
+        ModelBase::writeJson(writer, m_FlexSSOModeratorCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOModeratorUnit"));
+        ModelBase::writeJson(writer, m_FlexSSOModeratorUnit);
+    }
+
+    writer.endObject();
+}
+
 bool CreateTenantPackageBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setMonthlyCostUSD;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyCostUSD);
-            setMonthlyCostUSD(refVal_setMonthlyCostUSD);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")):
+            if(field.first == _XPLATSTR("monthlyCostUSD"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMonthlyCostUSD;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyCostUSD);
+                    setMonthlyCostUSD(refVal_setMonthlyCostUSD);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")):
+            if(field.first == _XPLATSTR("yearlyCostUSD"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setYearlyCostUSD;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyCostUSD);
+                    setYearlyCostUSD(refVal_setYearlyCostUSD);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyStripePlanId")):
+            if(field.first == _XPLATSTR("monthlyStripePlanId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setMonthlyStripePlanId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyStripePlanId);
+                    setMonthlyStripePlanId(refVal_setMonthlyStripePlanId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyStripePlanId")):
+            if(field.first == _XPLATSTR("yearlyStripePlanId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setYearlyStripePlanId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyStripePlanId);
+                    setYearlyStripePlanId(refVal_setYearlyStripePlanId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")):
+            if(field.first == _XPLATSTR("maxMonthlyPageLoads"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyPageLoads;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyPageLoads);
+                    setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")):
+            if(field.first == _XPLATSTR("maxMonthlyAPICredits"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyAPICredits;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyAPICredits);
+                    setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlySmallWidgetsCredits")):
+            if(field.first == _XPLATSTR("maxMonthlySmallWidgetsCredits"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlySmallWidgetsCredits;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlySmallWidgetsCredits);
+                    setMaxMonthlySmallWidgetsCredits(refVal_setMaxMonthlySmallWidgetsCredits);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")):
+            if(field.first == _XPLATSTR("maxMonthlyComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyComments);
+                    setMaxMonthlyComments(refVal_setMaxMonthlyComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")):
+            if(field.first == _XPLATSTR("maxConcurrentUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxConcurrentUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxConcurrentUsers);
+                    setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")):
+            if(field.first == _XPLATSTR("maxTenantUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxTenantUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxTenantUsers);
+                    setMaxTenantUsers(refVal_setMaxTenantUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")):
+            if(field.first == _XPLATSTR("maxSSOUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxSSOUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxSSOUsers);
+                    setMaxSSOUsers(refVal_setMaxSSOUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxModerators")):
+            if(field.first == _XPLATSTR("maxModerators"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxModerators;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxModerators);
+                    setMaxModerators(refVal_setMaxModerators);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxDomains")):
+            if(field.first == _XPLATSTR("maxDomains"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxDomains;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxDomains);
+                    setMaxDomains(refVal_setMaxDomains);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxWhiteLabeledTenants")):
+            if(field.first == _XPLATSTR("maxWhiteLabeledTenants"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxWhiteLabeledTenants;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxWhiteLabeledTenants);
+                    setMaxWhiteLabeledTenants(refVal_setMaxWhiteLabeledTenants);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyEventLogRequests")):
+            if(field.first == _XPLATSTR("maxMonthlyEventLogRequests"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyEventLogRequests;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyEventLogRequests);
+                    setMaxMonthlyEventLogRequests(refVal_setMaxMonthlyEventLogRequests);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")):
+            if(field.first == _XPLATSTR("maxCustomCollectionSize"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxCustomCollectionSize;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCustomCollectionSize);
+                    setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")):
+            if(field.first == _XPLATSTR("hasWhiteLabeling"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasWhiteLabeling;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasWhiteLabeling);
+                    setHasWhiteLabeling(refVal_setHasWhiteLabeling);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasDebranding")):
+            if(field.first == _XPLATSTR("hasDebranding"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasDebranding;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasDebranding);
+                    setHasDebranding(refVal_setHasDebranding);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasLLMSpamDetection")):
+            if(field.first == _XPLATSTR("hasLLMSpamDetection"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasLLMSpamDetection;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasLLMSpamDetection);
+                    setHasLLMSpamDetection(refVal_setHasLLMSpamDetection);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("forWhoText")):
+            if(field.first == _XPLATSTR("forWhoText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setForWhoText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setForWhoText);
+                    setForWhoText(refVal_setForWhoText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("featureTaglines")):
+            if(field.first == _XPLATSTR("featureTaglines"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeatureTaglines;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeatureTaglines);
+                    setFeatureTaglines(refVal_setFeatureTaglines);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasAuditing")):
+            if(field.first == _XPLATSTR("hasAuditing"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasAuditing;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasAuditing);
+                    setHasAuditing(refVal_setHasAuditing);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")):
+            if(field.first == _XPLATSTR("hasFlexPricing"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasFlexPricing;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasFlexPricing);
+                    setHasFlexPricing(refVal_setHasFlexPricing);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableSAML")):
+            if(field.first == _XPLATSTR("enableSAML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableSAML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSAML);
+                    setEnableSAML(refVal_setEnableSAML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")):
+            if(field.first == _XPLATSTR("flexPageLoadCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexPageLoadCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadCostCents);
+                    setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")):
+            if(field.first == _XPLATSTR("flexPageLoadUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexPageLoadUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadUnit);
+                    setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")):
+            if(field.first == _XPLATSTR("flexCommentCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexCommentCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentCostCents);
+                    setFlexCommentCostCents(refVal_setFlexCommentCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")):
+            if(field.first == _XPLATSTR("flexCommentUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexCommentUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentUnit);
+                    setFlexCommentUnit(refVal_setFlexCommentUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")):
+            if(field.first == _XPLATSTR("flexSSOUserCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOUserCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserCostCents);
+                    setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")):
+            if(field.first == _XPLATSTR("flexSSOUserUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOUserUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserUnit);
+                    setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")):
+            if(field.first == _XPLATSTR("flexAPICreditCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAPICreditCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditCostCents);
+                    setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")):
+            if(field.first == _XPLATSTR("flexAPICreditUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAPICreditUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditUnit);
+                    setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditCostCents")):
+            if(field.first == _XPLATSTR("flexSmallWidgetsCreditCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSmallWidgetsCreditCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditCostCents);
+                    setFlexSmallWidgetsCreditCostCents(refVal_setFlexSmallWidgetsCreditCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditUnit")):
+            if(field.first == _XPLATSTR("flexSmallWidgetsCreditUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSmallWidgetsCreditUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditUnit);
+                    setFlexSmallWidgetsCreditUnit(refVal_setFlexSmallWidgetsCreditUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")):
+            if(field.first == _XPLATSTR("flexModeratorCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexModeratorCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorCostCents);
+                    setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")):
+            if(field.first == _XPLATSTR("flexModeratorUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexModeratorUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorUnit);
+                    setFlexModeratorUnit(refVal_setFlexModeratorUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")):
+            if(field.first == _XPLATSTR("flexAdminCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAdminCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminCostCents);
+                    setFlexAdminCostCents(refVal_setFlexAdminCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")):
+            if(field.first == _XPLATSTR("flexAdminUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAdminUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminUnit);
+                    setFlexAdminUnit(refVal_setFlexAdminUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")):
+            if(field.first == _XPLATSTR("flexDomainCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexDomainCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainCostCents);
+                    setFlexDomainCostCents(refVal_setFlexDomainCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")):
+            if(field.first == _XPLATSTR("flexDomainUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexDomainUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainUnit);
+                    setFlexDomainUnit(refVal_setFlexDomainUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMCostCents")):
+            if(field.first == _XPLATSTR("flexLLMCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexLLMCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMCostCents);
+                    setFlexLLMCostCents(refVal_setFlexLLMCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMUnit")):
+            if(field.first == _XPLATSTR("flexLLMUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexLLMUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMUnit);
+                    setFlexLLMUnit(refVal_setFlexLLMUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")):
+            if(field.first == _XPLATSTR("flexMinimumCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexMinimumCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexMinimumCostCents);
+                    setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexManagedTenantCostCents")):
+            if(field.first == _XPLATSTR("flexManagedTenantCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexManagedTenantCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexManagedTenantCostCents);
+                    setFlexManagedTenantCostCents(refVal_setFlexManagedTenantCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminCostCents")):
+            if(field.first == _XPLATSTR("flexSSOAdminCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOAdminCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminCostCents);
+                    setFlexSSOAdminCostCents(refVal_setFlexSSOAdminCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminUnit")):
+            if(field.first == _XPLATSTR("flexSSOAdminUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOAdminUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminUnit);
+                    setFlexSSOAdminUnit(refVal_setFlexSSOAdminUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorCostCents")):
+            if(field.first == _XPLATSTR("flexSSOModeratorCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOModeratorCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorCostCents);
+                    setFlexSSOModeratorCostCents(refVal_setFlexSSOModeratorCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorUnit")):
+            if(field.first == _XPLATSTR("flexSSOModeratorUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOModeratorUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorUnit);
+                    setFlexSSOModeratorUnit(refVal_setFlexSSOModeratorUnit);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))))
+    return ok;
+}
+
+void CreateTenantPackageBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setYearlyCostUSD;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyCostUSD);
-            setYearlyCostUSD(refVal_setYearlyCostUSD);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId"))))
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setMonthlyStripePlanId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyStripePlanId);
-            setMonthlyStripePlanId(refVal_setMonthlyStripePlanId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId"))))
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setYearlyStripePlanId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyStripePlanId);
-            setYearlyStripePlanId(refVal_setYearlyStripePlanId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads"))))
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyPageLoads;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyPageLoads);
-            setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("monthlyStripePlanId")), m_MonthlyStripePlanId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits"))))
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyAPICredits;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyAPICredits);
-            setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("yearlyStripePlanId")), m_YearlyStripePlanId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlySmallWidgetsCredits;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlySmallWidgetsCredits);
-            setMaxMonthlySmallWidgetsCredits(refVal_setMaxMonthlySmallWidgetsCredits);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")), m_MaxMonthlyPageLoads);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyComments);
-            setMaxMonthlyComments(refVal_setMaxMonthlyComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")), m_MaxMonthlyAPICredits);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxConcurrentUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxConcurrentUsers);
-            setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlySmallWidgetsCredits")), m_MaxMonthlySmallWidgetsCredits);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxTenantUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxTenantUsers);
-            setMaxTenantUsers(refVal_setMaxTenantUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")), m_MaxMonthlyComments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxSSOUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxSSOUsers);
-            setMaxSSOUsers(refVal_setMaxSSOUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")), m_MaxConcurrentUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxModerators"))))
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxModerators")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxModerators;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxModerators);
-            setMaxModerators(refVal_setMaxModerators);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")), m_MaxTenantUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxDomains"))))
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxDomains")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxDomains;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxDomains);
-            setMaxDomains(refVal_setMaxDomains);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")), m_MaxSSOUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants"))))
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxWhiteLabeledTenants;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxWhiteLabeledTenants);
-            setMaxWhiteLabeledTenants(refVal_setMaxWhiteLabeledTenants);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxModerators")), m_MaxModerators);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests"))))
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyEventLogRequests;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyEventLogRequests);
-            setMaxMonthlyEventLogRequests(refVal_setMaxMonthlyEventLogRequests);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxDomains")), m_MaxDomains);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize"))))
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxCustomCollectionSize;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCustomCollectionSize);
-            setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxWhiteLabeledTenants")), m_MaxWhiteLabeledTenants);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasWhiteLabeling;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasWhiteLabeling);
-            setHasWhiteLabeling(refVal_setHasWhiteLabeling);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyEventLogRequests")), m_MaxMonthlyEventLogRequests);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasDebranding"))))
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasDebranding")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasDebranding;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasDebranding);
-            setHasDebranding(refVal_setHasDebranding);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")), m_MaxCustomCollectionSize);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection"))))
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasLLMSpamDetection;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasLLMSpamDetection);
-            setHasLLMSpamDetection(refVal_setHasLLMSpamDetection);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")), m_HasWhiteLabeling);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("forWhoText"))))
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("forWhoText")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setForWhoText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setForWhoText);
-            setForWhoText(refVal_setForWhoText);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasDebranding")), m_HasDebranding);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("featureTaglines"))))
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("featureTaglines")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeatureTaglines;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeatureTaglines);
-            setFeatureTaglines(refVal_setFeatureTaglines);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasLLMSpamDetection")), m_HasLLMSpamDetection);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasAuditing"))))
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasAuditing")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasAuditing;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasAuditing);
-            setHasAuditing(refVal_setHasAuditing);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("forWhoText")), m_ForWhoText);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing"))))
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasFlexPricing;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasFlexPricing);
-            setHasFlexPricing(refVal_setHasFlexPricing);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("featureTaglines")), m_FeatureTaglines);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableSAML"))))
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableSAML")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableSAML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSAML);
-            setEnableSAML(refVal_setEnableSAML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasAuditing")), m_HasAuditing);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents"))))
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexPageLoadCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadCostCents);
-            setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")), m_HasFlexPricing);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit"))))
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexPageLoadUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadUnit);
-            setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableSAML")), m_EnableSAML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexCommentCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentCostCents);
-            setFlexCommentCostCents(refVal_setFlexCommentCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")), m_FlexPageLoadCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexCommentUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentUnit);
-            setFlexCommentUnit(refVal_setFlexCommentUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")), m_FlexPageLoadUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOUserCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserCostCents);
-            setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")), m_FlexCommentCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOUserUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserUnit);
-            setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")), m_FlexCommentUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAPICreditCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditCostCents);
-            setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")), m_FlexSSOUserCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAPICreditUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditUnit);
-            setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")), m_FlexSSOUserUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSmallWidgetsCreditCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditCostCents);
-            setFlexSmallWidgetsCreditCostCents(refVal_setFlexSmallWidgetsCreditCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")), m_FlexAPICreditCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSmallWidgetsCreditUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditUnit);
-            setFlexSmallWidgetsCreditUnit(refVal_setFlexSmallWidgetsCreditUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")), m_FlexAPICreditUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexModeratorCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorCostCents);
-            setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditCostCents")), m_FlexSmallWidgetsCreditCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexModeratorUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorUnit);
-            setFlexModeratorUnit(refVal_setFlexModeratorUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditUnit")), m_FlexSmallWidgetsCreditUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAdminCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminCostCents);
-            setFlexAdminCostCents(refVal_setFlexAdminCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")), m_FlexModeratorCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAdminUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminUnit);
-            setFlexAdminUnit(refVal_setFlexAdminUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")), m_FlexModeratorUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexDomainCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainCostCents);
-            setFlexDomainCostCents(refVal_setFlexDomainCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")), m_FlexAdminCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexDomainUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainUnit);
-            setFlexDomainUnit(refVal_setFlexDomainUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")), m_FlexAdminUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexLLMCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMCostCents);
-            setFlexLLMCostCents(refVal_setFlexLLMCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")), m_FlexDomainCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexLLMUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMUnit);
-            setFlexLLMUnit(refVal_setFlexLLMUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")), m_FlexDomainUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexMinimumCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexMinimumCostCents);
-            setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexLLMCostCents")), m_FlexLLMCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexManagedTenantCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexManagedTenantCostCents);
-            setFlexManagedTenantCostCents(refVal_setFlexManagedTenantCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexLLMUnit")), m_FlexLLMUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOAdminCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminCostCents);
-            setFlexSSOAdminCostCents(refVal_setFlexSSOAdminCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")), m_FlexMinimumCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOAdminUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminUnit);
-            setFlexSSOAdminUnit(refVal_setFlexSSOAdminUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexManagedTenantCostCents")), m_FlexManagedTenantCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOModeratorCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorCostCents);
-            setFlexSSOModeratorCostCents(refVal_setFlexSSOModeratorCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOAdminCostCents")), m_FlexSSOAdminCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOAdminUnit")), m_FlexSSOAdminUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorCostCents")), m_FlexSSOModeratorCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorUnit")), m_FlexSSOModeratorUnit);
+    }
+}
+
+bool CreateTenantPackageBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            double refVal_setFlexSSOModeratorUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorUnit);
-            setFlexSSOModeratorUnit(refVal_setFlexSSOModeratorUnit);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")):
+            {
+                double refVal_setMonthlyCostUSD;
+                if(!ModelBase::readBinary(reader, field, refVal_setMonthlyCostUSD))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMonthlyCostUSD(refVal_setMonthlyCostUSD);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")):
+            {
+                double refVal_setYearlyCostUSD;
+                if(!ModelBase::readBinary(reader, field, refVal_setYearlyCostUSD))
+                {
+                    ok = false;
+                    continue;
+                }
+                setYearlyCostUSD(refVal_setYearlyCostUSD);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyStripePlanId")):
+            {
+                utility::string_t refVal_setMonthlyStripePlanId;
+                if(!ModelBase::readBinary(reader, field, refVal_setMonthlyStripePlanId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMonthlyStripePlanId(refVal_setMonthlyStripePlanId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyStripePlanId")):
+            {
+                utility::string_t refVal_setYearlyStripePlanId;
+                if(!ModelBase::readBinary(reader, field, refVal_setYearlyStripePlanId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setYearlyStripePlanId(refVal_setYearlyStripePlanId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")):
+            {
+                double refVal_setMaxMonthlyPageLoads;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyPageLoads))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")):
+            {
+                double refVal_setMaxMonthlyAPICredits;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyAPICredits))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlySmallWidgetsCredits")):
+            {
+                double refVal_setMaxMonthlySmallWidgetsCredits;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlySmallWidgetsCredits))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlySmallWidgetsCredits(refVal_setMaxMonthlySmallWidgetsCredits);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")):
+            {
+                double refVal_setMaxMonthlyComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyComments(refVal_setMaxMonthlyComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")):
+            {
+                double refVal_setMaxConcurrentUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxConcurrentUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")):
+            {
+                double refVal_setMaxTenantUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxTenantUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxTenantUsers(refVal_setMaxTenantUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")):
+            {
+                double refVal_setMaxSSOUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxSSOUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxSSOUsers(refVal_setMaxSSOUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxModerators")):
+            {
+                double refVal_setMaxModerators;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxModerators))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxModerators(refVal_setMaxModerators);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxDomains")):
+            {
+                double refVal_setMaxDomains;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxDomains))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxDomains(refVal_setMaxDomains);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxWhiteLabeledTenants")):
+            {
+                double refVal_setMaxWhiteLabeledTenants;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxWhiteLabeledTenants))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxWhiteLabeledTenants(refVal_setMaxWhiteLabeledTenants);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyEventLogRequests")):
+            {
+                double refVal_setMaxMonthlyEventLogRequests;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyEventLogRequests))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyEventLogRequests(refVal_setMaxMonthlyEventLogRequests);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")):
+            {
+                double refVal_setMaxCustomCollectionSize;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxCustomCollectionSize))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")):
+            {
+                bool refVal_setHasWhiteLabeling;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasWhiteLabeling))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasWhiteLabeling(refVal_setHasWhiteLabeling);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasDebranding")):
+            {
+                bool refVal_setHasDebranding;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasDebranding))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasDebranding(refVal_setHasDebranding);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasLLMSpamDetection")):
+            {
+                bool refVal_setHasLLMSpamDetection;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasLLMSpamDetection))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasLLMSpamDetection(refVal_setHasLLMSpamDetection);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("forWhoText")):
+            {
+                utility::string_t refVal_setForWhoText;
+                if(!ModelBase::readBinary(reader, field, refVal_setForWhoText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setForWhoText(refVal_setForWhoText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("featureTaglines")):
+            {
+                std::vector<utility::string_t> refVal_setFeatureTaglines;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeatureTaglines))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeatureTaglines(refVal_setFeatureTaglines);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasAuditing")):
+            {
+                bool refVal_setHasAuditing;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasAuditing))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasAuditing(refVal_setHasAuditing);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")):
+            {
+                bool refVal_setHasFlexPricing;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasFlexPricing))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasFlexPricing(refVal_setHasFlexPricing);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableSAML")):
+            {
+                bool refVal_setEnableSAML;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableSAML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableSAML(refVal_setEnableSAML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")):
+            {
+                double refVal_setFlexPageLoadCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexPageLoadCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")):
+            {
+                double refVal_setFlexPageLoadUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexPageLoadUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")):
+            {
+                double refVal_setFlexCommentCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexCommentCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexCommentCostCents(refVal_setFlexCommentCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")):
+            {
+                double refVal_setFlexCommentUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexCommentUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexCommentUnit(refVal_setFlexCommentUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")):
+            {
+                double refVal_setFlexSSOUserCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOUserCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")):
+            {
+                double refVal_setFlexSSOUserUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOUserUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")):
+            {
+                double refVal_setFlexAPICreditCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAPICreditCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")):
+            {
+                double refVal_setFlexAPICreditUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAPICreditUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditCostCents")):
+            {
+                double refVal_setFlexSmallWidgetsCreditCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSmallWidgetsCreditCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSmallWidgetsCreditCostCents(refVal_setFlexSmallWidgetsCreditCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditUnit")):
+            {
+                double refVal_setFlexSmallWidgetsCreditUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSmallWidgetsCreditUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSmallWidgetsCreditUnit(refVal_setFlexSmallWidgetsCreditUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")):
+            {
+                double refVal_setFlexModeratorCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexModeratorCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")):
+            {
+                double refVal_setFlexModeratorUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexModeratorUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexModeratorUnit(refVal_setFlexModeratorUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")):
+            {
+                double refVal_setFlexAdminCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAdminCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAdminCostCents(refVal_setFlexAdminCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")):
+            {
+                double refVal_setFlexAdminUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAdminUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAdminUnit(refVal_setFlexAdminUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")):
+            {
+                double refVal_setFlexDomainCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexDomainCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexDomainCostCents(refVal_setFlexDomainCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")):
+            {
+                double refVal_setFlexDomainUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexDomainUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexDomainUnit(refVal_setFlexDomainUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMCostCents")):
+            {
+                double refVal_setFlexLLMCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexLLMCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexLLMCostCents(refVal_setFlexLLMCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMUnit")):
+            {
+                double refVal_setFlexLLMUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexLLMUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexLLMUnit(refVal_setFlexLLMUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")):
+            {
+                double refVal_setFlexMinimumCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexMinimumCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexManagedTenantCostCents")):
+            {
+                double refVal_setFlexManagedTenantCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexManagedTenantCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexManagedTenantCostCents(refVal_setFlexManagedTenantCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminCostCents")):
+            {
+                double refVal_setFlexSSOAdminCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOAdminCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOAdminCostCents(refVal_setFlexSSOAdminCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminUnit")):
+            {
+                double refVal_setFlexSSOAdminUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOAdminUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOAdminUnit(refVal_setFlexSSOAdminUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorCostCents")):
+            {
+                double refVal_setFlexSSOModeratorCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOModeratorCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOModeratorCostCents(refVal_setFlexSSOModeratorCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorUnit")):
+            {
+                double refVal_setFlexSSOModeratorUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOModeratorUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOModeratorUnit(refVal_setFlexSSOModeratorUnit);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateTenantPackageBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -924,199 +2047,199 @@ void CreateTenantPackageBody::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_MonthlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD));
     }
-    if(m_YearlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD));
     }
-    if(m_MonthlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId")), m_MonthlyStripePlanId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId")), m_MonthlyStripePlanId));
     }
-    if(m_YearlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId")), m_YearlyStripePlanId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId")), m_YearlyStripePlanId));
     }
-    if(m_MaxMonthlyPageLoadsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads")), m_MaxMonthlyPageLoads));
     }
-    if(m_MaxMonthlyAPICreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits")), m_MaxMonthlyAPICredits));
     }
-    if(m_MaxMonthlySmallWidgetsCreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits")), m_MaxMonthlySmallWidgetsCredits));
     }
-    if(m_MaxMonthlyCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments")), m_MaxMonthlyComments));
     }
-    if(m_MaxConcurrentUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers")), m_MaxConcurrentUsers));
     }
-    if(m_MaxTenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers")), m_MaxTenantUsers));
     }
-    if(m_MaxSSOUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers")), m_MaxSSOUsers));
     }
-    if(m_MaxModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxModerators")), m_MaxModerators));
     }
-    if(m_MaxDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxDomains")), m_MaxDomains));
     }
-    if(m_MaxWhiteLabeledTenantsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants")), m_MaxWhiteLabeledTenants));
     }
-    if(m_MaxMonthlyEventLogRequestsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests")), m_MaxMonthlyEventLogRequests));
     }
-    if(m_MaxCustomCollectionSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize")), m_MaxCustomCollectionSize));
     }
-    if(m_HasWhiteLabelingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling")), m_HasWhiteLabeling));
     }
-    if(m_HasDebrandingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasDebranding")), m_HasDebranding));
     }
-    if(m_HasLLMSpamDetectionIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection")), m_HasLLMSpamDetection));
     }
-    if(m_ForWhoTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("forWhoText")), m_ForWhoText));
     }
-    if(m_FeatureTaglinesIsSet)
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("featureTaglines")), m_FeatureTaglines));
     }
-    if(m_HasAuditingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasAuditing")), m_HasAuditing));
     }
-    if(m_HasFlexPricingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing")), m_HasFlexPricing));
     }
-    if(m_EnableSAMLIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableSAML")), m_EnableSAML));
     }
-    if(m_FlexPageLoadCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents")), m_FlexPageLoadCostCents));
     }
-    if(m_FlexPageLoadUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit")), m_FlexPageLoadUnit));
     }
-    if(m_FlexCommentCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents")), m_FlexCommentCostCents));
     }
-    if(m_FlexCommentUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit")), m_FlexCommentUnit));
     }
-    if(m_FlexSSOUserCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents")), m_FlexSSOUserCostCents));
     }
-    if(m_FlexSSOUserUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit")), m_FlexSSOUserUnit));
     }
-    if(m_FlexAPICreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents")), m_FlexAPICreditCostCents));
     }
-    if(m_FlexAPICreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit")), m_FlexAPICreditUnit));
     }
-    if(m_FlexSmallWidgetsCreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents")), m_FlexSmallWidgetsCreditCostCents));
     }
-    if(m_FlexSmallWidgetsCreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit")), m_FlexSmallWidgetsCreditUnit));
     }
-    if(m_FlexModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents")), m_FlexModeratorCostCents));
     }
-    if(m_FlexModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit")), m_FlexModeratorUnit));
     }
-    if(m_FlexAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents")), m_FlexAdminCostCents));
     }
-    if(m_FlexAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit")), m_FlexAdminUnit));
     }
-    if(m_FlexDomainCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents")), m_FlexDomainCostCents));
     }
-    if(m_FlexDomainUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit")), m_FlexDomainUnit));
     }
-    if(m_FlexLLMCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents")), m_FlexLLMCostCents));
     }
-    if(m_FlexLLMUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit")), m_FlexLLMUnit));
     }
-    if(m_FlexMinimumCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents")), m_FlexMinimumCostCents));
     }
-    if(m_FlexManagedTenantCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents")), m_FlexManagedTenantCostCents));
     }
-    if(m_FlexSSOAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents")), m_FlexSSOAdminCostCents));
     }
-    if(m_FlexSSOAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit")), m_FlexSSOAdminUnit));
     }
-    if(m_FlexSSOModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents")), m_FlexSSOModeratorCostCents));
     }
-    if(m_FlexSSOModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit")), m_FlexSSOModeratorUnit));
     }
@@ -1438,95 +2561,99 @@ utility::string_t CreateTenantPackageBody::getName() const
 void CreateTenantPackageBody::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool CreateTenantPackageBody::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void CreateTenantPackageBody::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 double CreateTenantPackageBody::getMonthlyCostUSD() const
 {
-    return m_MonthlyCostUSD.get();
+    return m_MonthlyCostUSD;
 }
 
 void CreateTenantPackageBody::setMonthlyCostUSD(double value)
 {
     m_MonthlyCostUSD = value;
+    m_FieldsSet.set(FieldBit_MonthlyCostUSD);
 }
 
 bool CreateTenantPackageBody::monthlyCostUSDIsSet() const
 {
-    return m_MonthlyCostUSD.has_value();
+    return m_FieldsSet.test(FieldBit_MonthlyCostUSD);
 }
 
 void CreateTenantPackageBody::unsetMonthlyCostUSD()
 {
-    m_MonthlyCostUSD.reset();
+    m_FieldsSet.reset(FieldBit_MonthlyCostUSD);
 }
 double CreateTenantPackageBody::getYearlyCostUSD() const
 {
-    return m_YearlyCostUSD.get();
+    return m_YearlyCostUSD;
 }
 
 void CreateTenantPackageBody::setYearlyCostUSD(double value)
 {
     m_YearlyCostUSD = value;
+    m_FieldsSet.set(FieldBit_YearlyCostUSD);
 }
 
 bool CreateTenantPackageBody::yearlyCostUSDIsSet() const
 {
-    return m_YearlyCostUSD.has_value();
+    return m_FieldsSet.test(FieldBit_YearlyCostUSD);
 }
 
 void CreateTenantPackageBody::unsetYearlyCostUSD()
 {
-    m_YearlyCostUSD.reset();
+    m_FieldsSet.reset(FieldBit_YearlyCostUSD);
 }
 utility::string_t CreateTenantPackageBody::getMonthlyStripePlanId() const
 {
-    return m_MonthlyStripePlanId.get();
+    return m_MonthlyStripePlanId;
 }
 
 
 void CreateTenantPackageBody::setMonthlyStripePlanId(const utility::string_t& value)
 {
     m_MonthlyStripePlanId = value;
+    m_FieldsSet.set(FieldBit_MonthlyStripePlanId);
 }
 
 bool CreateTenantPackageBody::monthlyStripePlanIdIsSet() const
 {
-    return m_MonthlyStripePlanId.has_value();
+    return m_FieldsSet.test(FieldBit_MonthlyStripePlanId);
 }
 
 void CreateTenantPackageBody::unsetMonthlyStripePlanId()
 {
-    m_MonthlyStripePlanId.reset();
+    m_FieldsSet.reset(FieldBit_MonthlyStripePlanId);
 }
 utility::string_t CreateTenantPackageBody::getYearlyStripePlanId() const
 {
-    return m_YearlyStripePlanId.get();
+    return m_YearlyStripePlanId;
 }
 
 
 void CreateTenantPackageBody::setYearlyStripePlanId(const utility::string_t& value)
 {
     m_YearlyStripePlanId = value;
+    m_FieldsSet.set(FieldBit_YearlyStripePlanId);
 }
 
 bool CreateTenantPackageBody::yearlyStripePlanIdIsSet() const
 {
-    return m_YearlyStripePlanId.has_value();
+    return m_FieldsSet.test(FieldBit_YearlyStripePlanId);
 }
 
 void CreateTenantPackageBody::unsetYearlyStripePlanId()
 {
-    m_YearlyStripePlanId.reset();
+    m_FieldsSet.reset(FieldBit_YearlyStripePlanId);
 }
 double CreateTenantPackageBody::getMaxMonthlyPageLoads() const
 {
@@ -1536,17 +2663,17 @@ double CreateTenantPackageBody::getMaxMonthlyPageLoads() const
 void CreateTenantPackageBody::setMaxMonthlyPageLoads(double value)
 {
     m_MaxMonthlyPageLoads = value;
-    m_MaxMonthlyPageLoadsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyPageLoads);
 }
 
 bool CreateTenantPackageBody::maxMonthlyPageLoadsIsSet() const
 {
-    return m_MaxMonthlyPageLoadsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads);
 }
 
 void CreateTenantPackageBody::unsetMaxMonthlyPageLoads()
 {
-    m_MaxMonthlyPageLoadsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyPageLoads);
 }
 double CreateTenantPackageBody::getMaxMonthlyAPICredits() const
 {
@@ -1556,17 +2683,17 @@ double CreateTenantPackageBody::getMaxMonthlyAPICredits() const
 void CreateTenantPackageBody::setMaxMonthlyAPICredits(double value)
 {
     m_MaxMonthlyAPICredits = value;
-    m_MaxMonthlyAPICreditsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyAPICredits);
 }
 
 bool CreateTenantPackageBody::maxMonthlyAPICreditsIsSet() const
 {
-    return m_MaxMonthlyAPICreditsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits);
 }
 
 void CreateTenantPackageBody::unsetMaxMonthlyAPICredits()
 {
-    m_MaxMonthlyAPICreditsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyAPICredits);
 }
 double CreateTenantPackageBody::getMaxMonthlySmallWidgetsCredits() const
 {
@@ -1576,17 +2703,17 @@ double CreateTenantPackageBody::getMaxMonthlySmallWidgetsCredits() const
 void CreateTenantPackageBody::setMaxMonthlySmallWidgetsCredits(double value)
 {
     m_MaxMonthlySmallWidgetsCredits = value;
-    m_MaxMonthlySmallWidgetsCreditsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlySmallWidgetsCredits);
 }
 
 bool CreateTenantPackageBody::maxMonthlySmallWidgetsCreditsIsSet() const
 {
-    return m_MaxMonthlySmallWidgetsCreditsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits);
 }
 
 void CreateTenantPackageBody::unsetMaxMonthlySmallWidgetsCredits()
 {
-    m_MaxMonthlySmallWidgetsCreditsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlySmallWidgetsCredits);
 }
 double CreateTenantPackageBody::getMaxMonthlyComments() const
 {
@@ -1596,17 +2723,17 @@ double CreateTenantPackageBody::getMaxMonthlyComments() const
 void CreateTenantPackageBody::setMaxMonthlyComments(double value)
 {
     m_MaxMonthlyComments = value;
-    m_MaxMonthlyCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyComments);
 }
 
 bool CreateTenantPackageBody::maxMonthlyCommentsIsSet() const
 {
-    return m_MaxMonthlyCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyComments);
 }
 
 void CreateTenantPackageBody::unsetMaxMonthlyComments()
 {
-    m_MaxMonthlyCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyComments);
 }
 double CreateTenantPackageBody::getMaxConcurrentUsers() const
 {
@@ -1616,17 +2743,17 @@ double CreateTenantPackageBody::getMaxConcurrentUsers() const
 void CreateTenantPackageBody::setMaxConcurrentUsers(double value)
 {
     m_MaxConcurrentUsers = value;
-    m_MaxConcurrentUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxConcurrentUsers);
 }
 
 bool CreateTenantPackageBody::maxConcurrentUsersIsSet() const
 {
-    return m_MaxConcurrentUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxConcurrentUsers);
 }
 
 void CreateTenantPackageBody::unsetMaxConcurrentUsers()
 {
-    m_MaxConcurrentUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxConcurrentUsers);
 }
 double CreateTenantPackageBody::getMaxTenantUsers() const
 {
@@ -1636,17 +2763,17 @@ double CreateTenantPackageBody::getMaxTenantUsers() const
 void CreateTenantPackageBody::setMaxTenantUsers(double value)
 {
     m_MaxTenantUsers = value;
-    m_MaxTenantUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxTenantUsers);
 }
 
 bool CreateTenantPackageBody::maxTenantUsersIsSet() const
 {
-    return m_MaxTenantUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxTenantUsers);
 }
 
 void CreateTenantPackageBody::unsetMaxTenantUsers()
 {
-    m_MaxTenantUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxTenantUsers);
 }
 double CreateTenantPackageBody::getMaxSSOUsers() const
 {
@@ -1656,17 +2783,17 @@ double CreateTenantPackageBody::getMaxSSOUsers() const
 void CreateTenantPackageBody::setMaxSSOUsers(double value)
 {
     m_MaxSSOUsers = value;
-    m_MaxSSOUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxSSOUsers);
 }
 
 bool CreateTenantPackageBody::maxSSOUsersIsSet() const
 {
-    return m_MaxSSOUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxSSOUsers);
 }
 
 void CreateTenantPackageBody::unsetMaxSSOUsers()
 {
-    m_MaxSSOUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxSSOUsers);
 }
 double CreateTenantPackageBody::getMaxModerators() const
 {
@@ -1676,17 +2803,17 @@ double CreateTenantPackageBody::getMaxModerators() const
 void CreateTenantPackageBody::setMaxModerators(double value)
 {
     m_MaxModerators = value;
-    m_MaxModeratorsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxModerators);
 }
 
 bool CreateTenantPackageBody::maxModeratorsIsSet() const
 {
-    return m_MaxModeratorsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxModerators);
 }
 
 void CreateTenantPackageBody::unsetMaxModerators()
 {
-    m_MaxModeratorsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxModerators);
 }
 double CreateTenantPackageBody::getMaxDomains() const
 {
@@ -1696,17 +2823,17 @@ double CreateTenantPackageBody::getMaxDomains() const
 void CreateTenantPackageBody::setMaxDomains(double value)
 {
     m_MaxDomains = value;
-    m_MaxDomainsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxDomains);
 }
 
 bool CreateTenantPackageBody::maxDomainsIsSet() const
 {
-    return m_MaxDomainsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxDomains);
 }
 
 void CreateTenantPackageBody::unsetMaxDomains()
 {
-    m_MaxDomainsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxDomains);
 }
 double CreateTenantPackageBody::getMaxWhiteLabeledTenants() const
 {
@@ -1716,17 +2843,17 @@ double CreateTenantPackageBody::getMaxWhiteLabeledTenants() const
 void CreateTenantPackageBody::setMaxWhiteLabeledTenants(double value)
 {
     m_MaxWhiteLabeledTenants = value;
-    m_MaxWhiteLabeledTenantsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxWhiteLabeledTenants);
 }
 
 bool CreateTenantPackageBody::maxWhiteLabeledTenantsIsSet() const
 {
-    return m_MaxWhiteLabeledTenantsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants);
 }
 
 void CreateTenantPackageBody::unsetMaxWhiteLabeledTenants()
 {
-    m_MaxWhiteLabeledTenantsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxWhiteLabeledTenants);
 }
 double CreateTenantPackageBody::getMaxMonthlyEventLogRequests() const
 {
@@ -1736,17 +2863,17 @@ double CreateTenantPackageBody::getMaxMonthlyEventLogRequests() const
 void CreateTenantPackageBody::setMaxMonthlyEventLogRequests(double value)
 {
     m_MaxMonthlyEventLogRequests = value;
-    m_MaxMonthlyEventLogRequestsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyEventLogRequests);
 }
 
 bool CreateTenantPackageBody::maxMonthlyEventLogRequestsIsSet() const
 {
-    return m_MaxMonthlyEventLogRequestsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests);
 }
 
 void CreateTenantPackageBody::unsetMaxMonthlyEventLogRequests()
 {
-    m_MaxMonthlyEventLogRequestsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyEventLogRequests);
 }
 double CreateTenantPackageBody::getMaxCustomCollectionSize() const
 {
@@ -1756,17 +2883,17 @@ double CreateTenantPackageBody::getMaxCustomCollectionSize() const
 void CreateTenantPackageBody::setMaxCustomCollectionSize(double value)
 {
     m_MaxCustomCollectionSize = value;
-    m_MaxCustomCollectionSizeIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxCustomCollectionSize);
 }
 
 bool CreateTenantPackageBody::maxCustomCollectionSizeIsSet() const
 {
-    return m_MaxCustomCollectionSizeIsSet;
+    return m_FieldsSet.test(FieldBit_MaxCustomCollectionSize);
 }
 
 void CreateTenantPackageBody::unsetMaxCustomCollectionSize()
 {
-    m_MaxCustomCollectionSizeIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxCustomCollectionSize);
 }
 bool CreateTenantPackageBody::isHasWhiteLabeling() const
 {
@@ -1776,17 +2903,17 @@ bool CreateTenantPackageBody::isHasWhiteLabeling() const
 void CreateTenantPackageBody::setHasWhiteLabeling(bool value)
 {
     m_HasWhiteLabeling = value;
-    m_HasWhiteLabelingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasWhiteLabeling);
 }
 
 bool CreateTenantPackageBody::hasWhiteLabelingIsSet() const
 {
-    return m_HasWhiteLabelingIsSet;
+    return m_FieldsSet.test(FieldBit_HasWhiteLabeling);
 }
 
 void CreateTenantPackageBody::unsetHasWhiteLabeling()
 {
-    m_HasWhiteLabelingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasWhiteLabeling);
 }
 bool CreateTenantPackageBody::isHasDebranding() const
 {
@@ -1796,17 +2923,17 @@ bool CreateTenantPackageBody::isHasDebranding() const
 void CreateTenantPackageBody::setHasDebranding(bool value)
 {
     m_HasDebranding = value;
-    m_HasDebrandingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasDebranding);
 }
 
 bool CreateTenantPackageBody::hasDebrandingIsSet() const
 {
-    return m_HasDebrandingIsSet;
+    return m_FieldsSet.test(FieldBit_HasDebranding);
 }
 
 void CreateTenantPackageBody::unsetHasDebranding()
 {
-    m_HasDebrandingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasDebranding);
 }
 bool CreateTenantPackageBody::isHasLLMSpamDetection() const
 {
@@ -1816,17 +2943,17 @@ bool CreateTenantPackageBody::isHasLLMSpamDetection() const
 void CreateTenantPackageBody::setHasLLMSpamDetection(bool value)
 {
     m_HasLLMSpamDetection = value;
-    m_HasLLMSpamDetectionIsSet = true;
+    m_FieldsSet.set(FieldBit_HasLLMSpamDetection);
 }
 
 bool CreateTenantPackageBody::hasLLMSpamDetectionIsSet() const
 {
-    return m_HasLLMSpamDetectionIsSet;
+    return m_FieldsSet.test(FieldBit_HasLLMSpamDetection);
 }
 
 void CreateTenantPackageBody::unsetHasLLMSpamDetection()
 {
-    m_HasLLMSpamDetectionIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasLLMSpamDetection);
 }
 utility::string_t CreateTenantPackageBody::getForWhoText() const
 {
@@ -1837,17 +2964,17 @@ utility::string_t CreateTenantPackageBody::getForWhoText() const
 void CreateTenantPackageBody::setForWhoText(const utility::string_t& value)
 {
     m_ForWhoText = value;
-    m_ForWhoTextIsSet = true;
+    m_FieldsSet.set(FieldBit_ForWhoText);
 }
 
 bool CreateTenantPackageBody::forWhoTextIsSet() const
 {
-    return m_ForWhoTextIsSet;
+    return m_FieldsSet.test(FieldBit_ForWhoText);
 }
 
 void CreateTenantPackageBody::unsetForWhoText()
 {
-    m_ForWhoTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_ForWhoText);
 }
 std::vector<utility::string_t> CreateTenantPackageBody::getFeatureTaglines() const
 {
@@ -1858,17 +2985,17 @@ std::vector<utility::string_t> CreateTenantPackageBody::getFeatureTaglines() con
 void CreateTenantPackageBody::setFeatureTaglines(const std::vector<utility::string_t>& value)
 {
     m_FeatureTaglines = value;
-    m_FeatureTaglinesIsSet = true;
+    m_FieldsSet.set(FieldBit_FeatureTaglines);
 }
 
 bool CreateTenantPackageBody::featureTaglinesIsSet() const
 {
-    return m_FeatureTaglinesIsSet;
+    return m_FieldsSet.test(FieldBit_FeatureTaglines);
 }
 
 void CreateTenantPackageBody::unsetFeatureTaglines()
 {
-    m_FeatureTaglinesIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeatureTaglines);
 }
 bool CreateTenantPackageBody::isHasAuditing() const
 {
@@ -1878,17 +3005,17 @@ bool CreateTenantPackageBody::isHasAuditing() const
 void CreateTenantPackageBody::setHasAuditing(bool value)
 {
     m_HasAuditing = value;
-    m_HasAuditingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasAuditing);
 }
 
 bool CreateTenantPackageBody::hasAuditingIsSet() const
 {
-    return m_HasAuditingIsSet;
+    return m_FieldsSet.test(FieldBit_HasAuditing);
 }
 
 void CreateTenantPackageBody::unsetHasAuditing()
 {
-    m_HasAuditingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasAuditing);
 }
 bool CreateTenantPackageBody::isHasFlexPricing() const
 {
@@ -1898,17 +3025,17 @@ bool CreateTenantPackageBody::isHasFlexPricing() const
 void CreateTenantPackageBody::setHasFlexPricing(bool value)
 {
     m_HasFlexPricing = value;
-    m_HasFlexPricingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasFlexPricing);
 }
 
 bool CreateTenantPackageBody::hasFlexPricingIsSet() const
 {
-    return m_HasFlexPricingIsSet;
+    return m_FieldsSet.test(FieldBit_HasFlexPricing);
 }
 
 void CreateTenantPackageBody::unsetHasFlexPricing()
 {
-    m_HasFlexPricingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasFlexPricing);
 }
 bool CreateTenantPackageBody::isEnableSAML() const
 {
@@ -1918,17 +3045,17 @@ bool CreateTenantPackageBody::isEnableSAML() const
 void CreateTenantPackageBody::setEnableSAML(bool value)
 {
     m_EnableSAML = value;
-    m_EnableSAMLIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableSAML);
 }
 
 bool CreateTenantPackageBody::enableSAMLIsSet() const
 {
-    return m_EnableSAMLIsSet;
+    return m_FieldsSet.test(FieldBit_EnableSAML);
 }
 
 void CreateTenantPackageBody::unsetEnableSAML()
 {
-    m_EnableSAMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableSAML);
 }
 double CreateTenantPackageBody::getFlexPageLoadCostCents() const
 {
@@ -1938,17 +3065,17 @@ double CreateTenantPackageBody::getFlexPageLoadCostCents() const
 void CreateTenantPackageBody::setFlexPageLoadCostCents(double value)
 {
     m_FlexPageLoadCostCents = value;
-    m_FlexPageLoadCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexPageLoadCostCents);
 }
 
 bool CreateTenantPackageBody::flexPageLoadCostCentsIsSet() const
 {
-    return m_FlexPageLoadCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexPageLoadCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexPageLoadCostCents()
 {
-    m_FlexPageLoadCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexPageLoadCostCents);
 }
 double CreateTenantPackageBody::getFlexPageLoadUnit() const
 {
@@ -1958,17 +3085,17 @@ double CreateTenantPackageBody::getFlexPageLoadUnit() const
 void CreateTenantPackageBody::setFlexPageLoadUnit(double value)
 {
     m_FlexPageLoadUnit = value;
-    m_FlexPageLoadUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexPageLoadUnit);
 }
 
 bool CreateTenantPackageBody::flexPageLoadUnitIsSet() const
 {
-    return m_FlexPageLoadUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexPageLoadUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexPageLoadUnit()
 {
-    m_FlexPageLoadUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexPageLoadUnit);
 }
 double CreateTenantPackageBody::getFlexCommentCostCents() const
 {
@@ -1978,17 +3105,17 @@ double CreateTenantPackageBody::getFlexCommentCostCents() const
 void CreateTenantPackageBody::setFlexCommentCostCents(double value)
 {
     m_FlexCommentCostCents = value;
-    m_FlexCommentCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexCommentCostCents);
 }
 
 bool CreateTenantPackageBody::flexCommentCostCentsIsSet() const
 {
-    return m_FlexCommentCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexCommentCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexCommentCostCents()
 {
-    m_FlexCommentCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexCommentCostCents);
 }
 double CreateTenantPackageBody::getFlexCommentUnit() const
 {
@@ -1998,17 +3125,17 @@ double CreateTenantPackageBody::getFlexCommentUnit() const
 void CreateTenantPackageBody::setFlexCommentUnit(double value)
 {
     m_FlexCommentUnit = value;
-    m_FlexCommentUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexCommentUnit);
 }
 
 bool CreateTenantPackageBody::flexCommentUnitIsSet() const
 {
-    return m_FlexCommentUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexCommentUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexCommentUnit()
 {
-    m_FlexCommentUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexCommentUnit);
 }
 double CreateTenantPackageBody::getFlexSSOUserCostCents() const
 {
@@ -2018,17 +3145,17 @@ double CreateTenantPackageBody::getFlexSSOUserCostCents() const
 void CreateTenantPackageBody::setFlexSSOUserCostCents(double value)
 {
     m_FlexSSOUserCostCents = value;
-    m_FlexSSOUserCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOUserCostCents);
 }
 
 bool CreateTenantPackageBody::flexSSOUserCostCentsIsSet() const
 {
-    return m_FlexSSOUserCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOUserCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexSSOUserCostCents()
 {
-    m_FlexSSOUserCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOUserCostCents);
 }
 double CreateTenantPackageBody::getFlexSSOUserUnit() const
 {
@@ -2038,17 +3165,17 @@ double CreateTenantPackageBody::getFlexSSOUserUnit() const
 void CreateTenantPackageBody::setFlexSSOUserUnit(double value)
 {
     m_FlexSSOUserUnit = value;
-    m_FlexSSOUserUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOUserUnit);
 }
 
 bool CreateTenantPackageBody::flexSSOUserUnitIsSet() const
 {
-    return m_FlexSSOUserUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOUserUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexSSOUserUnit()
 {
-    m_FlexSSOUserUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOUserUnit);
 }
 double CreateTenantPackageBody::getFlexAPICreditCostCents() const
 {
@@ -2058,17 +3185,17 @@ double CreateTenantPackageBody::getFlexAPICreditCostCents() const
 void CreateTenantPackageBody::setFlexAPICreditCostCents(double value)
 {
     m_FlexAPICreditCostCents = value;
-    m_FlexAPICreditCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAPICreditCostCents);
 }
 
 bool CreateTenantPackageBody::flexAPICreditCostCentsIsSet() const
 {
-    return m_FlexAPICreditCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAPICreditCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexAPICreditCostCents()
 {
-    m_FlexAPICreditCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAPICreditCostCents);
 }
 double CreateTenantPackageBody::getFlexAPICreditUnit() const
 {
@@ -2078,17 +3205,17 @@ double CreateTenantPackageBody::getFlexAPICreditUnit() const
 void CreateTenantPackageBody::setFlexAPICreditUnit(double value)
 {
     m_FlexAPICreditUnit = value;
-    m_FlexAPICreditUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAPICreditUnit);
 }
 
 bool CreateTenantPackageBody::flexAPICreditUnitIsSet() const
 {
-    return m_FlexAPICreditUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAPICreditUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexAPICreditUnit()
 {
-    m_FlexAPICreditUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAPICreditUnit);
 }
 double CreateTenantPackageBody::getFlexSmallWidgetsCreditCostCents() const
 {
@@ -2098,17 +3225,17 @@ double CreateTenantPackageBody::getFlexSmallWidgetsCreditCostCents() const
 void CreateTenantPackageBody::setFlexSmallWidgetsCreditCostCents(double value)
 {
     m_FlexSmallWidgetsCreditCostCents = value;
-    m_FlexSmallWidgetsCreditCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSmallWidgetsCreditCostCents);
 }
 
 bool CreateTenantPackageBody::flexSmallWidgetsCreditCostCentsIsSet() const
 {
-    return m_FlexSmallWidgetsCreditCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexSmallWidgetsCreditCostCents()
 {
-    m_FlexSmallWidgetsCreditCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSmallWidgetsCreditCostCents);
 }
 double CreateTenantPackageBody::getFlexSmallWidgetsCreditUnit() const
 {
@@ -2118,17 +3245,17 @@ double CreateTenantPackageBody::getFlexSmallWidgetsCreditUnit() const
 void CreateTenantPackageBody::setFlexSmallWidgetsCreditUnit(double value)
 {
     m_FlexSmallWidgetsCreditUnit = value;
-    m_FlexSmallWidgetsCreditUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSmallWidgetsCreditUnit);
 }
 
 bool CreateTenantPackageBody::flexSmallWidgetsCreditUnitIsSet() const
 {
-    return m_FlexSmallWidgetsCreditUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexSmallWidgetsCreditUnit()
 {
-    m_FlexSmallWidgetsCreditUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSmallWidgetsCreditUnit);
 }
 double CreateTenantPackageBody::getFlexModeratorCostCents() const
 {
@@ -2138,17 +3265,17 @@ double CreateTenantPackageBody::getFlexModeratorCostCents() const
 void CreateTenantPackageBody::setFlexModeratorCostCents(double value)
 {
     m_FlexModeratorCostCents = value;
-    m_FlexModeratorCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexModeratorCostCents);
 }
 
 bool CreateTenantPackageBody::flexModeratorCostCentsIsSet() const
 {
-    return m_FlexModeratorCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexModeratorCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexModeratorCostCents()
 {
-    m_FlexModeratorCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexModeratorCostCents);
 }
 double CreateTenantPackageBody::getFlexModeratorUnit() const
 {
@@ -2158,17 +3285,17 @@ double CreateTenantPackageBody::getFlexModeratorUnit() const
 void CreateTenantPackageBody::setFlexModeratorUnit(double value)
 {
     m_FlexModeratorUnit = value;
-    m_FlexModeratorUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexModeratorUnit);
 }
 
 bool CreateTenantPackageBody::flexModeratorUnitIsSet() const
 {
-    return m_FlexModeratorUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexModeratorUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexModeratorUnit()
 {
-    m_FlexModeratorUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexModeratorUnit);
 }
 double CreateTenantPackageBody::getFlexAdminCostCents() const
 {
@@ -2178,17 +3305,17 @@ double CreateTenantPackageBody::getFlexAdminCostCents() const
 void CreateTenantPackageBody::setFlexAdminCostCents(double value)
 {
     m_FlexAdminCostCents = value;
-    m_FlexAdminCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAdminCostCents);
 }
 
 bool CreateTenantPackageBody::flexAdminCostCentsIsSet() const
 {
-    return m_FlexAdminCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAdminCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexAdminCostCents()
 {
-    m_FlexAdminCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAdminCostCents);
 }
 double CreateTenantPackageBody::getFlexAdminUnit() const
 {
@@ -2198,17 +3325,17 @@ double CreateTenantPackageBody::getFlexAdminUnit() const
 void CreateTenantPackageBody::setFlexAdminUnit(double value)
 {
     m_FlexAdminUnit = value;
-    m_FlexAdminUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAdminUnit);
 }
 
 bool CreateTenantPackageBody::flexAdminUnitIsSet() const
 {
-    return m_FlexAdminUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAdminUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexAdminUnit()
 {
-    m_FlexAdminUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAdminUnit);
 }
 double CreateTenantPackageBody::getFlexDomainCostCents() const
 {
@@ -2218,17 +3345,17 @@ double CreateTenantPackageBody::getFlexDomainCostCents() const
 void CreateTenantPackageBody::setFlexDomainCostCents(double value)
 {
     m_FlexDomainCostCents = value;
-    m_FlexDomainCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexDomainCostCents);
 }
 
 bool CreateTenantPackageBody::flexDomainCostCentsIsSet() const
 {
-    return m_FlexDomainCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexDomainCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexDomainCostCents()
 {
-    m_FlexDomainCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexDomainCostCents);
 }
 double CreateTenantPackageBody::getFlexDomainUnit() const
 {
@@ -2238,17 +3365,17 @@ double CreateTenantPackageBody::getFlexDomainUnit() const
 void CreateTenantPackageBody::setFlexDomainUnit(double value)
 {
     m_FlexDomainUnit = value;
-    m_FlexDomainUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexDomainUnit);
 }
 
 bool CreateTenantPackageBody::flexDomainUnitIsSet() const
 {
-    return m_FlexDomainUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexDomainUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexDomainUnit()
 {
-    m_FlexDomainUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexDomainUnit);
 }
 double CreateTenantPackageBody::getFlexLLMCostCents() const
 {
@@ -2258,17 +3385,17 @@ double CreateTenantPackageBody::getFlexLLMCostCents() const
 void CreateTenantPackageBody::setFlexLLMCostCents(double value)
 {
     m_FlexLLMCostCents = value;
-    m_FlexLLMCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexLLMCostCents);
 }
 
 bool CreateTenantPackageBody::flexLLMCostCentsIsSet() const
 {
-    return m_FlexLLMCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexLLMCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexLLMCostCents()
 {
-    m_FlexLLMCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexLLMCostCents);
 }
 double CreateTenantPackageBody::getFlexLLMUnit() const
 {
@@ -2278,17 +3405,17 @@ double CreateTenantPackageBody::getFlexLLMUnit() const
 void CreateTenantPackageBody::setFlexLLMUnit(double value)
 {
     m_FlexLLMUnit = value;
-    m_FlexLLMUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexLLMUnit);
 }
 
 bool CreateTenantPackageBody::flexLLMUnitIsSet() const
 {
-    return m_FlexLLMUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexLLMUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexLLMUnit()
 {
-    m_FlexLLMUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexLLMUnit);
 }
 double CreateTenantPackageBody::getFlexMinimumCostCents() const
 {
@@ -2298,17 +3425,17 @@ double CreateTenantPackageBody::getFlexMinimumCostCents() const
 void CreateTenantPackageBody::setFlexMinimumCostCents(double value)
 {
     m_FlexMinimumCostCents = value;
-    m_FlexMinimumCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexMinimumCostCents);
 }
 
 bool CreateTenantPackageBody::flexMinimumCostCentsIsSet() const
 {
-    return m_FlexMinimumCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexMinimumCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexMinimumCostCents()
 {
-    m_FlexMinimumCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexMinimumCostCents);
 }
 double CreateTenantPackageBody::getFlexManagedTenantCostCents() const
 {
@@ -2318,17 +3445,17 @@ double CreateTenantPackageBody::getFlexManagedTenantCostCents() const
 void CreateTenantPackageBody::setFlexManagedTenantCostCents(double value)
 {
     m_FlexManagedTenantCostCents = value;
-    m_FlexManagedTenantCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexManagedTenantCostCents);
 }
 
 bool CreateTenantPackageBody::flexManagedTenantCostCentsIsSet() const
 {
-    return m_FlexManagedTenantCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexManagedTenantCostCents()
 {
-    m_FlexManagedTenantCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexManagedTenantCostCents);
 }
 double CreateTenantPackageBody::getFlexSSOAdminCostCents() const
 {
@@ -2338,17 +3465,17 @@ double CreateTenantPackageBody::getFlexSSOAdminCostCents() const
 void CreateTenantPackageBody::setFlexSSOAdminCostCents(double value)
 {
     m_FlexSSOAdminCostCents = value;
-    m_FlexSSOAdminCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOAdminCostCents);
 }
 
 bool CreateTenantPackageBody::flexSSOAdminCostCentsIsSet() const
 {
-    return m_FlexSSOAdminCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexSSOAdminCostCents()
 {
-    m_FlexSSOAdminCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOAdminCostCents);
 }
 double CreateTenantPackageBody::getFlexSSOAdminUnit() const
 {
@@ -2358,17 +3485,17 @@ double CreateTenantPackageBody::getFlexSSOAdminUnit() const
 void CreateTenantPackageBody::setFlexSSOAdminUnit(double value)
 {
     m_FlexSSOAdminUnit = value;
-    m_FlexSSOAdminUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOAdminUnit);
 }
 
 bool CreateTenantPackageBody::flexSSOAdminUnitIsSet() const
 {
-    return m_FlexSSOAdminUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOAdminUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexSSOAdminUnit()
 {
-    m_FlexSSOAdminUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOAdminUnit);
 }
 double CreateTenantPackageBody::getFlexSSOModeratorCostCents() const
 {
@@ -2378,17 +3505,17 @@ double CreateTenantPackageBody::getFlexSSOModeratorCostCents() const
 void CreateTenantPackageBody::setFlexSSOModeratorCostCents(double value)
 {
     m_FlexSSOModeratorCostCents = value;
-    m_FlexSSOModeratorCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOModeratorCostCents);
 }
 
 bool CreateTenantPackageBody::flexSSOModeratorCostCentsIsSet() const
 {
-    return m_FlexSSOModeratorCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents);
 }
 
 void CreateTenantPackageBody::unsetFlexSSOModeratorCostCents()
 {
-    m_FlexSSOModeratorCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOModeratorCostCents);
 }
 double CreateTenantPackageBody::getFlexSSOModeratorUnit() const
 {
@@ -2398,17 +3525,17 @@ double CreateTenantPackageBody::getFlexSSOModeratorUnit() const
 void CreateTenantPackageBody::setFlexSSOModeratorUnit(double value)
 {
     m_FlexSSOModeratorUnit = value;
-    m_FlexSSOModeratorUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOModeratorUnit);
 }
 
 bool CreateTenantPackageBody::flexSSOModeratorUnitIsSet() const
 {
-    return m_FlexSSOModeratorUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit);
 }
 
 void CreateTenantPackageBody::unsetFlexSSOModeratorUnit()
 {
-    m_FlexSSOModeratorUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOModeratorUnit);
 }
 
 }
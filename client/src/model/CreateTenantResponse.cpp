@@ -20,8 +20,6 @@ namespace model {
 
 CreateTenantResponse::CreateTenantResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantIsSet = false;
 }
 
 CreateTenantResponse::~CreateTenantResponse()
@@ -36,12 +34,12 @@ void CreateTenantResponse::validate()
 web::json::value CreateTenantResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantIsSet)
+    if(m_FieldsSet.test(FieldBit_Tenant))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenant"))] = ModelBase::toJson(m_Tenant);
@@ -50,32 +48,119 @@ web::json::value CreateTenantResponse::toJson() const
     return val;
 }
 
+void CreateTenantResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tenant))
+    {
+        
+        writer.key(_XPLATSTR("tenant"));
+        ModelBase::writeJson(writer, m_Tenant);
+    }
+
+    writer.endObject();
+}
+
 bool CreateTenantResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenant")):
+            if(field.first == _XPLATSTR("tenant"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APITenant> refVal_setTenant;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenant);
+                    setTenant(refVal_setTenant);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenant"))))
+    return ok;
+}
+
+void CreateTenantResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenant")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tenant))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenant")), m_Tenant);
+    }
+}
+
+bool CreateTenantResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APITenant> refVal_setTenant;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenant);
-            setTenant(refVal_setTenant);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenant")):
+            {
+                std::shared_ptr<APITenant> refVal_setTenant;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenant))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenant(refVal_setTenant);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateTenantResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void CreateTenantResponse::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantIsSet)
+    if(m_FieldsSet.test(FieldBit_Tenant))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenant")), m_Tenant));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> CreateTenantResponse::getStatus() const
 void CreateTenantResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool CreateTenantResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void CreateTenantResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APITenant> CreateTenantResponse::getTenant() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APITenant> CreateTenantResponse::getTenant() const
 void CreateTenantResponse::setTenant(const std::shared_ptr<APITenant>& value)
 {
     m_Tenant = value;
-    m_TenantIsSet = true;
+    m_FieldsSet.set(FieldBit_Tenant);
 }
 
 bool CreateTenantResponse::tenantIsSet() const
 {
-    return m_TenantIsSet;
+    return m_FieldsSet.test(FieldBit_Tenant);
 }
 
 void CreateTenantResponse::unsetTenant()
 {
-    m_TenantIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tenant);
 }
 
 }
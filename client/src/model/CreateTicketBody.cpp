@@ -20,8 +20,6 @@ namespace model {
 
 CreateTicketBody::CreateTicketBody()
 {
-    m_Subject = utility::conversions::to_string_t("");
-    m_SubjectIsSet = false;
 }
 
 CreateTicketBody::~CreateTicketBody()
@@ -36,7 +34,7 @@ void CreateTicketBody::validate()
 web::json::value CreateTicketBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_SubjectIsSet)
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("subject"))] = ModelBase::toJson(m_Subject);
@@ -45,23 +43,87 @@ web::json::value CreateTicketBody::toJson() const
     return val;
 }
 
+void CreateTicketBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Subject))
+    {
+        
+        writer.key(_XPLATSTR("subject"));
+        ModelBase::writeJson(writer, m_Subject);
+    }
+
+    writer.endObject();
+}
+
 bool CreateTicketBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("subject"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("subject")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setSubject;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSubject);
-            setSubject(refVal_setSubject);
-            
+        case ModelBase::fieldHash(_XPLATSTR("subject")):
+            if(field.first == _XPLATSTR("subject"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSubject;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSubject);
+                    setSubject(refVal_setSubject);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void CreateTicketBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Subject))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("subject")), m_Subject);
+    }
+}
+
+bool CreateTicketBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("subject")):
+            {
+                utility::string_t refVal_setSubject;
+                if(!ModelBase::readBinary(reader, field, refVal_setSubject))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSubject(refVal_setSubject);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void CreateTicketBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -69,7 +131,7 @@ void CreateTicketBody::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_SubjectIsSet)
+    if(m_FieldsSet.test(FieldBit_Subject))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("subject")), m_Subject));
     }
@@ -103,17 +165,17 @@ utility::string_t CreateTicketBody::getSubject() const
 void CreateTicketBody::setSubject(const utility::string_t& value)
 {
     m_Subject = value;
-    m_SubjectIsSet = true;
+    m_FieldsSet.set(FieldBit_Subject);
 }
 
 bool CreateTicketBody::subjectIsSet() const
 {
-    return m_SubjectIsSet;
+    return m_FieldsSet.test(FieldBit_Subject);
 }
 
 void CreateTicketBody::unsetSubject()
 {
-    m_SubjectIsSet = false;
+    m_FieldsSet.reset(FieldBit_Subject);
 }
 
 }
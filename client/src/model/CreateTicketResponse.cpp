@@ -20,8 +20,6 @@ namespace model {
 
 CreateTicketResponse::CreateTicketResponse()
 {
-    m_StatusIsSet = false;
-    m_TicketIsSet = false;
 }
 
 CreateTicketResponse::~CreateTicketResponse()
@@ -36,12 +34,12 @@ void CreateTicketResponse::validate()
 web::json::value CreateTicketResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TicketIsSet)
+    if(m_FieldsSet.test(FieldBit_Ticket))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ticket"))] = ModelBase::toJson(m_Ticket);
@@ -50,32 +48,119 @@ web::json::value CreateTicketResponse::toJson() const
     return val;
 }
 
+void CreateTicketResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Ticket))
+    {
+        
+        writer.key(_XPLATSTR("ticket"));
+        ModelBase::writeJson(writer, m_Ticket);
+    }
+
+    writer.endObject();
+}
+
 bool CreateTicketResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ticket")):
+            if(field.first == _XPLATSTR("ticket"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APITicket> refVal_setTicket;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTicket);
+                    setTicket(refVal_setTicket);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ticket"))))
+    return ok;
+}
+
+void CreateTicketResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ticket")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Ticket))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ticket")), m_Ticket);
+    }
+}
+
+bool CreateTicketResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APITicket> refVal_setTicket;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTicket);
-            setTicket(refVal_setTicket);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ticket")):
+            {
+                std::shared_ptr<APITicket> refVal_setTicket;
+                if(!ModelBase::readBinary(reader, field, refVal_setTicket))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTicket(refVal_setTicket);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateTicketResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void CreateTicketResponse::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TicketIsSet)
+    if(m_FieldsSet.test(FieldBit_Ticket))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ticket")), m_Ticket));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> CreateTicketResponse::getStatus() const
 void CreateTicketResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool CreateTicketResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void CreateTicketResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APITicket> CreateTicketResponse::getTicket() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APITicket> CreateTicketResponse::getTicket() const
 void CreateTicketResponse::setTicket(const std::shared_ptr<APITicket>& value)
 {
     m_Ticket = value;
-    m_TicketIsSet = true;
+    m_FieldsSet.set(FieldBit_Ticket);
 }
 
 bool CreateTicketResponse::ticketIsSet() const
 {
-    return m_TicketIsSet;
+    return m_FieldsSet.test(FieldBit_Ticket);
 }
 
 void CreateTicketResponse::unsetTicket()
 {
-    m_TicketIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ticket);
 }
 
 }
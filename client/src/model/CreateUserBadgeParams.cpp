@@ -20,12 +20,7 @@ namespace model {
 
 CreateUserBadgeParams::CreateUserBadgeParams()
 {
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_BadgeId = utility::conversions::to_string_t("");
-    m_BadgeIdIsSet = false;
     m_DisplayedOnComments = false;
-    m_DisplayedOnCommentsIsSet = false;
 }
 
 CreateUserBadgeParams::~CreateUserBadgeParams()
@@ -40,17 +35,17 @@ void CreateUserBadgeParams::validate()
 web::json::value CreateUserBadgeParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_BadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badgeId"))] = ModelBase::toJson(m_BadgeId);
     }
-    if(m_DisplayedOnCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayedOnComments"))] = ModelBase::toJson(m_DisplayedOnComments);
@@ -59,43 +54,153 @@ web::json::value CreateUserBadgeParams::toJson() const
     return val;
 }
 
+void CreateUserBadgeParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_BadgeId))
+    {
+        
+        writer.key(_XPLATSTR("badgeId"));
+        ModelBase::writeJson(writer, m_BadgeId);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
+    {
+        
+        writer.key(_XPLATSTR("displayedOnComments"));
+        ModelBase::writeJson(writer, m_DisplayedOnComments);
+    }
+
+    writer.endObject();
+}
+
 bool CreateUserBadgeParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badgeId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badgeId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setBadgeId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadgeId);
-            setBadgeId(refVal_setBadgeId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badgeId")):
+            if(field.first == _XPLATSTR("badgeId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBadgeId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadgeId);
+                    setBadgeId(refVal_setBadgeId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayedOnComments")):
+            if(field.first == _XPLATSTR("displayedOnComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisplayedOnComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayedOnComments);
+                    setDisplayedOnComments(refVal_setDisplayedOnComments);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayedOnComments"))))
+    return ok;
+}
+
+void CreateUserBadgeParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_BadgeId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badgeId")), m_BadgeId);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayedOnComments")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayedOnComments")), m_DisplayedOnComments);
+    }
+}
+
+bool CreateUserBadgeParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setDisplayedOnComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayedOnComments);
-            setDisplayedOnComments(refVal_setDisplayedOnComments);
-            
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badgeId")):
+            {
+                utility::string_t refVal_setBadgeId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadgeId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadgeId(refVal_setBadgeId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayedOnComments")):
+            {
+                bool refVal_setDisplayedOnComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayedOnComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayedOnComments(refVal_setDisplayedOnComments);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CreateUserBadgeParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -105,15 +210,15 @@ void CreateUserBadgeParams::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_BadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badgeId")), m_BadgeId));
     }
-    if(m_DisplayedOnCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayedOnComments")), m_DisplayedOnComments));
     }
@@ -159,17 +264,17 @@ utility::string_t CreateUserBadgeParams::getUserId() const
 void CreateUserBadgeParams::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool CreateUserBadgeParams::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void CreateUserBadgeParams::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t CreateUserBadgeParams::getBadgeId() const
 {
@@ -180,17 +285,17 @@ utility::string_t CreateUserBadgeParams::getBadgeId() const
 void CreateUserBadgeParams::setBadgeId(const utility::string_t& value)
 {
     m_BadgeId = value;
-    m_BadgeIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BadgeId);
 }
 
 bool CreateUserBadgeParams::badgeIdIsSet() const
 {
-    return m_BadgeIdIsSet;
+    return m_FieldsSet.test(FieldBit_BadgeId);
 }
 
 void CreateUserBadgeParams::unsetBadgeId()
 {
-    m_BadgeIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BadgeId);
 }
 bool CreateUserBadgeParams::isDisplayedOnComments() const
 {
@@ -200,17 +305,17 @@ bool CreateUserBadgeParams::isDisplayedOnComments() const
 void CreateUserBadgeParams::setDisplayedOnComments(bool value)
 {
     m_DisplayedOnComments = value;
-    m_DisplayedOnCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayedOnComments);
 }
 
 bool CreateUserBadgeParams::displayedOnCommentsIsSet() const
 {
-    return m_DisplayedOnCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayedOnComments);
 }
 
 void CreateUserBadgeParams::unsetDisplayedOnComments()
 {
-    m_DisplayedOnCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayedOnComments);
 }
 
 }
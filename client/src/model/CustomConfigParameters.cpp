@@ -21,131 +21,61 @@ namespace model {
 CustomConfigParameters::CustomConfigParameters()
 {
     m_AbsoluteAndRelativeDates = false;
-    m_AbsoluteAndRelativeDatesIsSet = false;
     m_AbsoluteDates = false;
-    m_AbsoluteDatesIsSet = false;
     m_AllowAnon = false;
-    m_AllowAnonIsSet = false;
     m_AllowAnonFlag = false;
-    m_AllowAnonFlagIsSet = false;
     m_AllowAnonVotes = false;
-    m_AllowAnonVotesIsSet = false;
     m_CollapseReplies = false;
-    m_CollapseRepliesIsSet = false;
-    m_CommentHTMLRenderingModeIsSet = false;
     m_CountAboveToggle = 0;
-    m_CountAboveToggleIsSet = false;
     m_DisableAutoAdminMigration = false;
-    m_DisableAutoAdminMigrationIsSet = false;
     m_DisableAutoHashTagCreation = false;
-    m_DisableAutoHashTagCreationIsSet = false;
     m_DisableBlocking = false;
-    m_DisableBlockingIsSet = false;
     m_DisableCommenterCommentDelete = false;
-    m_DisableCommenterCommentDeleteIsSet = false;
     m_DisableCommenterCommentEdit = false;
-    m_DisableCommenterCommentEditIsSet = false;
     m_DisableEmailInputs = false;
-    m_DisableEmailInputsIsSet = false;
     m_DisableLiveCommenting = false;
-    m_DisableLiveCommentingIsSet = false;
     m_DisableNotificationBell = false;
-    m_DisableNotificationBellIsSet = false;
     m_DisableProfileComments = false;
-    m_DisableProfileCommentsIsSet = false;
     m_DisableProfileDirectMessages = false;
-    m_DisableProfileDirectMessagesIsSet = false;
     m_DisableProfiles = false;
-    m_DisableProfilesIsSet = false;
     m_DisableSuccessMessage = false;
-    m_DisableSuccessMessageIsSet = false;
     m_DisableToolbar = false;
-    m_DisableToolbarIsSet = false;
     m_DisableUnverifiedLabel = false;
-    m_DisableUnverifiedLabelIsSet = false;
     m_DisableVoting = false;
-    m_DisableVotingIsSet = false;
     m_EnableCommenterLinks = false;
-    m_EnableCommenterLinksIsSet = false;
     m_EnableSearch = false;
-    m_EnableSearchIsSet = false;
     m_EnableSpoilers = false;
-    m_EnableSpoilersIsSet = false;
     m_EnableThirdPartyCookieBypass = false;
-    m_EnableThirdPartyCookieBypassIsSet = false;
     m_EnableViewCounts = false;
-    m_EnableViewCountsIsSet = false;
     m_EnableVoteList = false;
-    m_EnableVoteListIsSet = false;
     m_EnableWYSIWYG = false;
-    m_EnableWYSIWYGIsSet = false;
-    m_GifRatingIsSet = false;
     m_HasDarkBackground = false;
-    m_HasDarkBackgroundIsSet = false;
     m_HideAvatars = false;
-    m_HideAvatarsIsSet = false;
-    m_ImageContentProfanityLevelIsSet = false;
     m_InputAfterComments = false;
-    m_InputAfterCommentsIsSet = false;
     m_LimitCommentsByGroups = false;
-    m_LimitCommentsByGroupsIsSet = false;
     m_NoCustomConfig = false;
-    m_NoCustomConfigIsSet = false;
     m_NoImageUploads = false;
-    m_NoImageUploadsIsSet = false;
     m_AllowEmbeds = false;
-    m_AllowEmbedsIsSet = false;
     m_NoStyles = false;
-    m_NoStylesIsSet = false;
     m_Readonly = false;
-    m_ReadonlyIsSet = false;
     m_NoNewRootComments = false;
-    m_NoNewRootCommentsIsSet = false;
     m_RequireSSO = false;
-    m_RequireSSOIsSet = false;
     m_EnableFChat = false;
-    m_EnableFChatIsSet = false;
     m_EnableResizeHandle = false;
-    m_EnableResizeHandleIsSet = false;
     m_ShowBadgesInTopBar = false;
-    m_ShowBadgesInTopBarIsSet = false;
     m_ShowCommentSaveSuccess = false;
-    m_ShowCommentSaveSuccessIsSet = false;
     m_ShowLiveRightAway = false;
-    m_ShowLiveRightAwayIsSet = false;
     m_ShowQuestion = false;
-    m_ShowQuestionIsSet = false;
-    m_SpamRulesIsSet = false;
-    m_SsoSecLvlIsSet = false;
     m_UseShowCommentsToggle = false;
-    m_UseShowCommentsToggleIsSet = false;
     m_UseSingleLineCommentInput = false;
-    m_UseSingleLineCommentInputIsSet = false;
-    m_VoteStyleIsSet = false;
-    m_WidgetQuestionId = utility::conversions::to_string_t("");
-    m_WidgetQuestionIdIsSet = false;
-    m_WidgetQuestionResultsStyleIsSet = false;
     m_WidgetQuestionShowBreakdown = false;
-    m_WidgetQuestionShowBreakdownIsSet = false;
-    m_WidgetQuestionStyleIsSet = false;
-    m_WidgetQuestionWhenToSaveIsSet = false;
-    m_WidgetQuestionsRequiredIsSet = false;
-    m_WidgetSubQuestionVisibilityIsSet = false;
     m_Wrap = false;
-    m_WrapIsSet = false;
-    m_UsersListLocationIsSet = false;
     m_UsersListIncludeOffline = false;
-    m_UsersListIncludeOfflineIsSet = false;
-    m_TicketBaseUrl = utility::conversions::to_string_t("");
-    m_TicketBaseUrlIsSet = false;
-    m_TicketKBSearchEndpoint = utility::conversions::to_string_t("");
-    m_TicketKBSearchEndpointIsSet = false;
     m_TicketFileUploadsEnabled = false;
-    m_TicketFileUploadsEnabledIsSet = false;
     m_TicketMaxFileSize = 0;
-    m_TicketMaxFileSizeIsSet = false;
-    m_TicketAutoAssignUserIdsIsSet = false;
-    m_TosIsSet = false;
+    m_MaxCommentCharacterLength = 0;
+    m_MaxCommentCreatedCountPUPM = 0;
+    m_PageSize = 0;
 }
 
 CustomConfigParameters::~CustomConfigParameters()
@@ -160,442 +90,442 @@ void CustomConfigParameters::validate()
 web::json::value CustomConfigParameters::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_AbsoluteAndRelativeDatesIsSet)
+    if(m_FieldsSet.test(FieldBit_AbsoluteAndRelativeDates))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("absoluteAndRelativeDates"))] = ModelBase::toJson(m_AbsoluteAndRelativeDates);
     }
-    if(m_AbsoluteDatesIsSet)
+    if(m_FieldsSet.test(FieldBit_AbsoluteDates))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("absoluteDates"))] = ModelBase::toJson(m_AbsoluteDates);
     }
-    if(m_AllowAnonIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowAnon))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("allowAnon"))] = ModelBase::toJson(m_AllowAnon);
     }
-    if(m_AllowAnonFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowAnonFlag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("allowAnonFlag"))] = ModelBase::toJson(m_AllowAnonFlag);
     }
-    if(m_AllowAnonVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowAnonVotes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("allowAnonVotes"))] = ModelBase::toJson(m_AllowAnonVotes);
     }
-    if(m_AllowedLanguages.has_value())
+    if(m_FieldsSet.test(FieldBit_AllowedLanguages))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("allowedLanguages"))] = ModelBase::toJson(m_AllowedLanguages.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("allowedLanguages"))] = ModelBase::toJson(m_AllowedLanguages);
     }
-    if(m_CollapseRepliesIsSet)
+    if(m_FieldsSet.test(FieldBit_CollapseReplies))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("collapseReplies"))] = ModelBase::toJson(m_CollapseReplies);
     }
-    if(m_CommentCountFormat.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentCountFormat))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commentCountFormat"))] = ModelBase::toJson(m_CommentCountFormat.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commentCountFormat"))] = ModelBase::toJson(m_CommentCountFormat);
     }
-    if(m_CommentHTMLRenderingModeIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTMLRenderingMode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentHTMLRenderingMode"))] = ModelBase::toJson(m_CommentHTMLRenderingMode);
     }
-    if(m_CommentThreadDeleteMode.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentThreadDeleteMode))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commentThreadDeleteMode"))] = ModelBase::toJson(m_CommentThreadDeleteMode.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commentThreadDeleteMode"))] = ModelBase::toJson(m_CommentThreadDeleteMode);
     }
-    if(m_CommenterNameFormat.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterNameFormat))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterNameFormat"))] = ModelBase::toJson(m_CommenterNameFormat.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterNameFormat"))] = ModelBase::toJson(m_CommenterNameFormat);
     }
-    if(m_CountAboveToggleIsSet)
+    if(m_FieldsSet.test(FieldBit_CountAboveToggle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("countAboveToggle"))] = ModelBase::toJson(m_CountAboveToggle);
     }
-    if(m_CustomCSS.has_value())
+    if(m_FieldsSet.test(FieldBit_CustomCSS))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("customCSS"))] = ModelBase::toJson(m_CustomCSS.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("customCSS"))] = ModelBase::toJson(m_CustomCSS);
     }
-    if(m_DefaultAvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DefaultAvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("defaultAvatarSrc"))] = ModelBase::toJson(m_DefaultAvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("defaultAvatarSrc"))] = ModelBase::toJson(m_DefaultAvatarSrc);
     }
-    if(m_DefaultSortDirection.has_value())
+    if(m_FieldsSet.test(FieldBit_DefaultSortDirection))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("defaultSortDirection"))] = ModelBase::toJson(m_DefaultSortDirection.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("defaultSortDirection"))] = ModelBase::toJson(m_DefaultSortDirection);
     }
-    if(m_DefaultUsername.has_value())
+    if(m_FieldsSet.test(FieldBit_DefaultUsername))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("defaultUsername"))] = ModelBase::toJson(m_DefaultUsername.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("defaultUsername"))] = ModelBase::toJson(m_DefaultUsername);
     }
-    if(m_DisableAutoAdminMigrationIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableAutoAdminMigration))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableAutoAdminMigration"))] = ModelBase::toJson(m_DisableAutoAdminMigration);
     }
-    if(m_DisableAutoHashTagCreationIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableAutoHashTagCreation))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableAutoHashTagCreation"))] = ModelBase::toJson(m_DisableAutoHashTagCreation);
     }
-    if(m_DisableBlockingIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableBlocking))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableBlocking"))] = ModelBase::toJson(m_DisableBlocking);
     }
-    if(m_DisableCommenterCommentDeleteIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentDelete))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentDelete"))] = ModelBase::toJson(m_DisableCommenterCommentDelete);
     }
-    if(m_DisableCommenterCommentEditIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentEdit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentEdit"))] = ModelBase::toJson(m_DisableCommenterCommentEdit);
     }
-    if(m_DisableEmailInputsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableEmailInputs))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableEmailInputs"))] = ModelBase::toJson(m_DisableEmailInputs);
     }
-    if(m_DisableLiveCommentingIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableLiveCommenting))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableLiveCommenting"))] = ModelBase::toJson(m_DisableLiveCommenting);
     }
-    if(m_DisableNotificationBellIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableNotificationBell))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableNotificationBell"))] = ModelBase::toJson(m_DisableNotificationBell);
     }
-    if(m_DisableProfileCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableProfileComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableProfileComments"))] = ModelBase::toJson(m_DisableProfileComments);
     }
-    if(m_DisableProfileDirectMessagesIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableProfileDirectMessages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableProfileDirectMessages"))] = ModelBase::toJson(m_DisableProfileDirectMessages);
     }
-    if(m_DisableProfilesIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableProfiles))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableProfiles"))] = ModelBase::toJson(m_DisableProfiles);
     }
-    if(m_DisableSuccessMessageIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableSuccessMessage))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableSuccessMessage"))] = ModelBase::toJson(m_DisableSuccessMessage);
     }
-    if(m_DisableToolbarIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableToolbar))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableToolbar"))] = ModelBase::toJson(m_DisableToolbar);
     }
-    if(m_DisableUnverifiedLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableUnverifiedLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableUnverifiedLabel"))] = ModelBase::toJson(m_DisableUnverifiedLabel);
     }
-    if(m_DisableVotingIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableVoting))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("disableVoting"))] = ModelBase::toJson(m_DisableVoting);
     }
-    if(m_EnableCommenterLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableCommenterLinks))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableCommenterLinks"))] = ModelBase::toJson(m_EnableCommenterLinks);
     }
-    if(m_EnableSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSearch))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableSearch"))] = ModelBase::toJson(m_EnableSearch);
     }
-    if(m_EnableSpoilersIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSpoilers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableSpoilers"))] = ModelBase::toJson(m_EnableSpoilers);
     }
-    if(m_EnableThirdPartyCookieBypassIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableThirdPartyCookieBypass))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableThirdPartyCookieBypass"))] = ModelBase::toJson(m_EnableThirdPartyCookieBypass);
     }
-    if(m_EnableViewCountsIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableViewCounts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableViewCounts"))] = ModelBase::toJson(m_EnableViewCounts);
     }
-    if(m_EnableVoteListIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableVoteList))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableVoteList"))] = ModelBase::toJson(m_EnableVoteList);
     }
-    if(m_EnableWYSIWYGIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableWYSIWYG))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableWYSIWYG"))] = ModelBase::toJson(m_EnableWYSIWYG);
     }
-    if(m_GifRatingIsSet)
+    if(m_FieldsSet.test(FieldBit_GifRating))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("gifRating"))] = ModelBase::toJson(m_GifRating);
     }
-    if(m_HasDarkBackgroundIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDarkBackground))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasDarkBackground"))] = ModelBase::toJson(m_HasDarkBackground);
     }
-    if(m_HeaderHTML.has_value())
+    if(m_FieldsSet.test(FieldBit_HeaderHTML))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("headerHTML"))] = ModelBase::toJson(m_HeaderHTML.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("headerHTML"))] = ModelBase::toJson(m_HeaderHTML);
     }
-    if(m_HideAvatarsIsSet)
+    if(m_FieldsSet.test(FieldBit_HideAvatars))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hideAvatars"))] = ModelBase::toJson(m_HideAvatars);
     }
-    if(m_HideCommentsUnderCountTextFormat.has_value())
+    if(m_FieldsSet.test(FieldBit_HideCommentsUnderCountTextFormat))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("hideCommentsUnderCountTextFormat"))] = ModelBase::toJson(m_HideCommentsUnderCountTextFormat.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("hideCommentsUnderCountTextFormat"))] = ModelBase::toJson(m_HideCommentsUnderCountTextFormat);
     }
-    if(m_ImageContentProfanityLevelIsSet)
+    if(m_FieldsSet.test(FieldBit_ImageContentProfanityLevel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("imageContentProfanityLevel"))] = ModelBase::toJson(m_ImageContentProfanityLevel);
     }
-    if(m_InputAfterCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_InputAfterComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("inputAfterComments"))] = ModelBase::toJson(m_InputAfterComments);
     }
-    if(m_LimitCommentsByGroupsIsSet)
+    if(m_FieldsSet.test(FieldBit_LimitCommentsByGroups))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("limitCommentsByGroups"))] = ModelBase::toJson(m_LimitCommentsByGroups);
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_MaxCommentCharacterLength.has_value())
+    if(m_FieldsSet.test(FieldBit_MaxCommentCharacterLength))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("maxCommentCharacterLength"))] = ModelBase::toJson(m_MaxCommentCharacterLength.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("maxCommentCharacterLength"))] = ModelBase::toJson(m_MaxCommentCharacterLength);
     }
-    if(m_MaxCommentCreatedCountPUPM.has_value())
+    if(m_FieldsSet.test(FieldBit_MaxCommentCreatedCountPUPM))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("maxCommentCreatedCountPUPM"))] = ModelBase::toJson(m_MaxCommentCreatedCountPUPM.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("maxCommentCreatedCountPUPM"))] = ModelBase::toJson(m_MaxCommentCreatedCountPUPM);
     }
-    if(m_NoCustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_NoCustomConfig))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("noCustomConfig"))] = ModelBase::toJson(m_NoCustomConfig);
     }
-    if(m_MentionAutoCompleteMode.has_value())
+    if(m_FieldsSet.test(FieldBit_MentionAutoCompleteMode))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("mentionAutoCompleteMode"))] = ModelBase::toJson(m_MentionAutoCompleteMode.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("mentionAutoCompleteMode"))] = ModelBase::toJson(m_MentionAutoCompleteMode);
     }
-    if(m_NoImageUploadsIsSet)
+    if(m_FieldsSet.test(FieldBit_NoImageUploads))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("noImageUploads"))] = ModelBase::toJson(m_NoImageUploads);
     }
-    if(m_AllowEmbedsIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowEmbeds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("allowEmbeds"))] = ModelBase::toJson(m_AllowEmbeds);
     }
-    if(m_AllowedEmbedDomains.has_value())
+    if(m_FieldsSet.test(FieldBit_AllowedEmbedDomains))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("allowedEmbedDomains"))] = ModelBase::toJson(m_AllowedEmbedDomains.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("allowedEmbedDomains"))] = ModelBase::toJson(m_AllowedEmbedDomains);
     }
-    if(m_NoStylesIsSet)
+    if(m_FieldsSet.test(FieldBit_NoStyles))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("noStyles"))] = ModelBase::toJson(m_NoStyles);
     }
-    if(m_PageSize.has_value())
+    if(m_FieldsSet.test(FieldBit_PageSize))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageSize"))] = ModelBase::toJson(m_PageSize.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageSize"))] = ModelBase::toJson(m_PageSize);
     }
-    if(m_ReadonlyIsSet)
+    if(m_FieldsSet.test(FieldBit_Readonly))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("readonly"))] = ModelBase::toJson(m_Readonly);
     }
-    if(m_NoNewRootCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_NoNewRootComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("noNewRootComments"))] = ModelBase::toJson(m_NoNewRootComments);
     }
-    if(m_RequireSSOIsSet)
+    if(m_FieldsSet.test(FieldBit_RequireSSO))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("requireSSO"))] = ModelBase::toJson(m_RequireSSO);
     }
-    if(m_EnableFChatIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableFChat))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableFChat"))] = ModelBase::toJson(m_EnableFChat);
     }
-    if(m_EnableResizeHandleIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableResizeHandle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableResizeHandle"))] = ModelBase::toJson(m_EnableResizeHandle);
     }
-    if(m_RestrictedLinkDomains.has_value())
+    if(m_FieldsSet.test(FieldBit_RestrictedLinkDomains))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("restrictedLinkDomains"))] = ModelBase::toJson(m_RestrictedLinkDomains.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("restrictedLinkDomains"))] = ModelBase::toJson(m_RestrictedLinkDomains);
     }
-    if(m_ShowBadgesInTopBarIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowBadgesInTopBar))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("showBadgesInTopBar"))] = ModelBase::toJson(m_ShowBadgesInTopBar);
     }
-    if(m_ShowCommentSaveSuccessIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowCommentSaveSuccess))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("showCommentSaveSuccess"))] = ModelBase::toJson(m_ShowCommentSaveSuccess);
     }
-    if(m_ShowLiveRightAwayIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowLiveRightAway))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("showLiveRightAway"))] = ModelBase::toJson(m_ShowLiveRightAway);
     }
-    if(m_ShowQuestionIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowQuestion))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("showQuestion"))] = ModelBase::toJson(m_ShowQuestion);
     }
-    if(m_SpamRulesIsSet)
+    if(m_FieldsSet.test(FieldBit_SpamRules))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("spamRules"))] = ModelBase::toJson(m_SpamRules);
     }
-    if(m_SsoSecLvlIsSet)
+    if(m_FieldsSet.test(FieldBit_SsoSecLvl))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ssoSecLvl"))] = ModelBase::toJson(m_SsoSecLvl);
     }
-    if(m_Translations.has_value())
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("translations"))] = ModelBase::toJson(m_Translations.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("translations"))] = ModelBase::toJson(m_Translations);
     }
-    if(m_UseShowCommentsToggleIsSet)
+    if(m_FieldsSet.test(FieldBit_UseShowCommentsToggle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("useShowCommentsToggle"))] = ModelBase::toJson(m_UseShowCommentsToggle);
     }
-    if(m_UseSingleLineCommentInputIsSet)
+    if(m_FieldsSet.test(FieldBit_UseSingleLineCommentInput))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("useSingleLineCommentInput"))] = ModelBase::toJson(m_UseSingleLineCommentInput);
     }
-    if(m_VoteStyleIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteStyle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("voteStyle"))] = ModelBase::toJson(m_VoteStyle);
     }
-    if(m_WidgetQuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("widgetQuestionId"))] = ModelBase::toJson(m_WidgetQuestionId);
     }
-    if(m_WidgetQuestionResultsStyleIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionResultsStyle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("widgetQuestionResultsStyle"))] = ModelBase::toJson(m_WidgetQuestionResultsStyle);
     }
-    if(m_WidgetQuestionShowBreakdownIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionShowBreakdown))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("widgetQuestionShowBreakdown"))] = ModelBase::toJson(m_WidgetQuestionShowBreakdown);
     }
-    if(m_WidgetQuestionStyleIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionStyle))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("widgetQuestionStyle"))] = ModelBase::toJson(m_WidgetQuestionStyle);
     }
-    if(m_WidgetQuestionWhenToSaveIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionWhenToSave))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("widgetQuestionWhenToSave"))] = ModelBase::toJson(m_WidgetQuestionWhenToSave);
     }
-    if(m_WidgetQuestionsRequiredIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionsRequired))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("widgetQuestionsRequired"))] = ModelBase::toJson(m_WidgetQuestionsRequired);
     }
-    if(m_WidgetSubQuestionVisibilityIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetSubQuestionVisibility))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("widgetSubQuestionVisibility"))] = ModelBase::toJson(m_WidgetSubQuestionVisibility);
     }
-    if(m_WrapIsSet)
+    if(m_FieldsSet.test(FieldBit_Wrap))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wrap"))] = ModelBase::toJson(m_Wrap);
     }
-    if(m_UsersListLocationIsSet)
+    if(m_FieldsSet.test(FieldBit_UsersListLocation))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("usersListLocation"))] = ModelBase::toJson(m_UsersListLocation);
     }
-    if(m_UsersListIncludeOfflineIsSet)
+    if(m_FieldsSet.test(FieldBit_UsersListIncludeOffline))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("usersListIncludeOffline"))] = ModelBase::toJson(m_UsersListIncludeOffline);
     }
-    if(m_TicketBaseUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketBaseUrl))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ticketBaseUrl"))] = ModelBase::toJson(m_TicketBaseUrl);
     }
-    if(m_TicketKBSearchEndpointIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketKBSearchEndpoint))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ticketKBSearchEndpoint"))] = ModelBase::toJson(m_TicketKBSearchEndpoint);
     }
-    if(m_TicketFileUploadsEnabledIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketFileUploadsEnabled))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ticketFileUploadsEnabled"))] = ModelBase::toJson(m_TicketFileUploadsEnabled);
     }
-    if(m_TicketMaxFileSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketMaxFileSize))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ticketMaxFileSize"))] = ModelBase::toJson(m_TicketMaxFileSize);
     }
-    if(m_TicketAutoAssignUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketAutoAssignUserIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ticketAutoAssignUserIds"))] = ModelBase::toJson(m_TicketAutoAssignUserIds);
     }
-    if(m_TosIsSet)
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tos"))] = ModelBase::toJson(m_Tos);
@@ -604,978 +534,3043 @@ web::json::value CustomConfigParameters::toJson() const
     return val;
 }
 
+void CustomConfigParameters::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_AbsoluteAndRelativeDates))
+    {
+        
+        writer.key(_XPLATSTR("absoluteAndRelativeDates"));
+        ModelBase::writeJson(writer, m_AbsoluteAndRelativeDates);
+    }
+    if(m_FieldsSet.test(FieldBit_AbsoluteDates))
+    {
+        
+        writer.key(_XPLATSTR("absoluteDates"));
+        ModelBase::writeJson(writer, m_AbsoluteDates);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowAnon))
+    {
+        
+        writer.key(_XPLATSTR("allowAnon"));
+        ModelBase::writeJson(writer, m_AllowAnon);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowAnonFlag))
+    {
+        
+        writer.key(_XPLATSTR("allowAnonFlag"));
+        ModelBase::writeJson(writer, m_AllowAnonFlag);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowAnonVotes))
+    {
+        
+        writer.key(_XPLATSTR("allowAnonVotes"));
+        ModelBase::writeJson(writer, m_AllowAnonVotes);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowedLanguages))
+    {
+        
+        writer.key(_XPLATSTR("allowedLanguages"));
+        ModelBase::writeJson(writer, m_AllowedLanguages);
+    }
+    if(m_FieldsSet.test(FieldBit_CollapseReplies))
+    {
+        
+        writer.key(_XPLATSTR("collapseReplies"));
+        ModelBase::writeJson(writer, m_CollapseReplies);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCountFormat))
+    {
+        
+        writer.key(_XPLATSTR("commentCountFormat"));
+        ModelBase::writeJson(writer, m_CommentCountFormat);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentHTMLRenderingMode))
+    {
+        
+        writer.key(_XPLATSTR("commentHTMLRenderingMode"));
+        ModelBase::writeJson(writer, m_CommentHTMLRenderingMode);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentThreadDeleteMode))
+    {
+        
+        writer.key(_XPLATSTR("commentThreadDeleteMode"));
+        ModelBase::writeJson(writer, m_CommentThreadDeleteMode);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterNameFormat))
+    {
+        
+        writer.key(_XPLATSTR("commenterNameFormat"));
+        ModelBase::writeJson(writer, m_CommenterNameFormat);
+    }
+    if(m_FieldsSet.test(FieldBit_CountAboveToggle))
+    {
+        
+        writer.key(_XPLATSTR("countAboveToggle"));
+        ModelBase::writeJson(writer, m_CountAboveToggle);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomCSS))
+    {
+        
+        writer.key(_XPLATSTR("customCSS"));
+        ModelBase::writeJson(writer, m_CustomCSS);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultAvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("defaultAvatarSrc"));
+        ModelBase::writeJson(writer, m_DefaultAvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultSortDirection))
+    {
+        
+        writer.key(_XPLATSTR("defaultSortDirection"));
+        ModelBase::writeJson(writer, m_DefaultSortDirection);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultUsername))
+    {
+        
+        writer.key(_XPLATSTR("defaultUsername"));
+        ModelBase::writeJson(writer, m_DefaultUsername);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableAutoAdminMigration))
+    {
+        
+        writer.key(_XPLATSTR("disableAutoAdminMigration"));
+        ModelBase::writeJson(writer, m_DisableAutoAdminMigration);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableAutoHashTagCreation))
+    {
+        
+        writer.key(_XPLATSTR("disableAutoHashTagCreation"));
+        ModelBase::writeJson(writer, m_DisableAutoHashTagCreation);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableBlocking))
+    {
+        
+        writer.key(_XPLATSTR("disableBlocking"));
+        ModelBase::writeJson(writer, m_DisableBlocking);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentDelete))
+    {
+        
+        writer.key(_XPLATSTR("disableCommenterCommentDelete"));
+        ModelBase::writeJson(writer, m_DisableCommenterCommentDelete);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentEdit))
+    {
+        
+        writer.key(_XPLATSTR("disableCommenterCommentEdit"));
+        ModelBase::writeJson(writer, m_DisableCommenterCommentEdit);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableEmailInputs))
+    {
+        
+        writer.key(_XPLATSTR("disableEmailInputs"));
+        ModelBase::writeJson(writer, m_DisableEmailInputs);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableLiveCommenting))
+    {
+        
+        writer.key(_XPLATSTR("disableLiveCommenting"));
+        ModelBase::writeJson(writer, m_DisableLiveCommenting);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableNotificationBell))
+    {
+        
+        writer.key(_XPLATSTR("disableNotificationBell"));
+        ModelBase::writeJson(writer, m_DisableNotificationBell);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableProfileComments))
+    {
+        
+        writer.key(_XPLATSTR("disableProfileComments"));
+        ModelBase::writeJson(writer, m_DisableProfileComments);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableProfileDirectMessages))
+    {
+        
+        writer.key(_XPLATSTR("disableProfileDirectMessages"));
+        ModelBase::writeJson(writer, m_DisableProfileDirectMessages);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableProfiles))
+    {
+        
+        writer.key(_XPLATSTR("disableProfiles"));
+        ModelBase::writeJson(writer, m_DisableProfiles);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableSuccessMessage))
+    {
+        
+        writer.key(_XPLATSTR("disableSuccessMessage"));
+        ModelBase::writeJson(writer, m_DisableSuccessMessage);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableToolbar))
+    {
+        
+        writer.key(_XPLATSTR("disableToolbar"));
+        ModelBase::writeJson(writer, m_DisableToolbar);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableUnverifiedLabel))
+    {
+        
+        writer.key(_XPLATSTR("disableUnverifiedLabel"));
+        ModelBase::writeJson(writer, m_DisableUnverifiedLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_DisableVoting))
+    {
+        
+        writer.key(_XPLATSTR("disableVoting"));
+        ModelBase::writeJson(writer, m_DisableVoting);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableCommenterLinks))
+    {
+        
+        writer.key(_XPLATSTR("enableCommenterLinks"));
+        ModelBase::writeJson(writer, m_EnableCommenterLinks);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableSearch))
+    {
+        
+        writer.key(_XPLATSTR("enableSearch"));
+        ModelBase::writeJson(writer, m_EnableSearch);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableSpoilers))
+    {
+        
+        writer.key(_XPLATSTR("enableSpoilers"));
+        ModelBase::writeJson(writer, m_EnableSpoilers);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableThirdPartyCookieBypass))
+    {
+        
+        writer.key(_XPLATSTR("enableThirdPartyCookieBypass"));
+        ModelBase::writeJson(writer, m_EnableThirdPartyCookieBypass);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableViewCounts))
+    {
+        
+        writer.key(_XPLATSTR("enableViewCounts"));
+        ModelBase::writeJson(writer, m_EnableViewCounts);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableVoteList))
+    {
+        
+        writer.key(_XPLATSTR("enableVoteList"));
+        ModelBase::writeJson(writer, m_EnableVoteList);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableWYSIWYG))
+    {
+        
+        writer.key(_XPLATSTR("enableWYSIWYG"));
+        ModelBase::writeJson(writer, m_EnableWYSIWYG);
+    }
+    if(m_FieldsSet.test(FieldBit_GifRating))
+    {
+        
+        writer.key(_XPLATSTR("gifRating"));
+        ModelBase::writeJson(writer, m_GifRating);
+    }
+    if(m_FieldsSet.test(FieldBit_HasDarkBackground))
+    {
+        
+        writer.key(_XPLATSTR("hasDarkBackground"));
+        ModelBase::writeJson(writer, m_HasDarkBackground);
+    }
+    if(m_FieldsSet.test(FieldBit_HeaderHTML))
+    {
+        
+        writer.key(_XPLATSTR("headerHTML"));
+        ModelBase::writeJson(writer, m_HeaderHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_HideAvatars))
+    {
+        
+        writer.key(_XPLATSTR("hideAvatars"));
+        ModelBase::writeJson(writer, m_HideAvatars);
+    }
+    if(m_FieldsSet.test(FieldBit_HideCommentsUnderCountTextFormat))
+    {
+        
+        writer.key(_XPLATSTR("hideCommentsUnderCountTextFormat"));
+        ModelBase::writeJson(writer, m_HideCommentsUnderCountTextFormat);
+    }
+    if(m_FieldsSet.test(FieldBit_ImageContentProfanityLevel))
+    {
+        
+        writer.key(_XPLATSTR("imageContentProfanityLevel"));
+        ModelBase::writeJson(writer, m_ImageContentProfanityLevel);
+    }
+    if(m_FieldsSet.test(FieldBit_InputAfterComments))
+    {
+        
+        writer.key(_XPLATSTR("inputAfterComments"));
+        ModelBase::writeJson(writer, m_InputAfterComments);
+    }
+    if(m_FieldsSet.test(FieldBit_LimitCommentsByGroups))
+    {
+        
+        writer.key(_XPLATSTR("limitCommentsByGroups"));
+        ModelBase::writeJson(writer, m_LimitCommentsByGroups);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCommentCharacterLength))
+    {
+        
+        writer.key(_XPLATSTR("maxCommentCharacterLength"));
+        ModelBase::writeJson(writer, m_MaxCommentCharacterLength);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCommentCreatedCountPUPM))
+    {
+        
+        writer.key(_XPLATSTR("maxCommentCreatedCountPUPM"));
+        ModelBase::writeJson(writer, m_MaxCommentCreatedCountPUPM);
+    }
+    if(m_FieldsSet.test(FieldBit_NoCustomConfig))
+    {
+        
+        writer.key(_XPLATSTR("noCustomConfig"));
+        ModelBase::writeJson(writer, m_NoCustomConfig);
+    }
+    if(m_FieldsSet.test(FieldBit_MentionAutoCompleteMode))
+    {
+        
+        writer.key(_XPLATSTR("mentionAutoCompleteMode"));
+        ModelBase::writeJson(writer, m_MentionAutoCompleteMode);
+    }
+    if(m_FieldsSet.test(FieldBit_NoImageUploads))
+    {
+        
+        writer.key(_XPLATSTR("noImageUploads"));
+        ModelBase::writeJson(writer, m_NoImageUploads);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowEmbeds))
+    {
+        
+        writer.key(_XPLATSTR("allowEmbeds"));
+        ModelBase::writeJson(writer, m_AllowEmbeds);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowedEmbedDomains))
+    {
+        
+        writer.key(_XPLATSTR("allowedEmbedDomains"));
+        ModelBase::writeJson(writer, m_AllowedEmbedDomains);
+    }
+    if(m_FieldsSet.test(FieldBit_NoStyles))
+    {
+        
+        writer.key(_XPLATSTR("noStyles"));
+        ModelBase::writeJson(writer, m_NoStyles);
+    }
+    if(m_FieldsSet.test(FieldBit_PageSize))
+    {
+        
+        writer.key(_XPLATSTR("pageSize"));
+        ModelBase::writeJson(writer, m_PageSize);
+    }
+    if(m_FieldsSet.test(FieldBit_Readonly))
+    {
+        
+        writer.key(_XPLATSTR("readonly"));
+        ModelBase::writeJson(writer, m_Readonly);
+    }
+    if(m_FieldsSet.test(FieldBit_NoNewRootComments))
+    {
+        
+        writer.key(_XPLATSTR("noNewRootComments"));
+        ModelBase::writeJson(writer, m_NoNewRootComments);
+    }
+    if(m_FieldsSet.test(FieldBit_RequireSSO))
+    {
+        
+        writer.key(_XPLATSTR("requireSSO"));
+        ModelBase::writeJson(writer, m_RequireSSO);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableFChat))
+    {
+        
+        writer.key(_XPLATSTR("enableFChat"));
+        ModelBase::writeJson(writer, m_EnableFChat);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableResizeHandle))
+    {
+        
+        writer.key(_XPLATSTR("enableResizeHandle"));
+        ModelBase::writeJson(writer, m_EnableResizeHandle);
+    }
+    if(m_FieldsSet.test(FieldBit_RestrictedLinkDomains))
+    {
+        
+        writer.key(_XPLATSTR("restrictedLinkDomains"));
+        ModelBase::writeJson(writer, m_RestrictedLinkDomains);
+    }
+    if(m_FieldsSet.test(FieldBit_ShowBadgesInTopBar))
+    {
+        
+        writer.key(_XPLATSTR("showBadgesInTopBar"));
+        ModelBase::writeJson(writer, m_ShowBadgesInTopBar);
+    }
+    if(m_FieldsSet.test(FieldBit_ShowCommentSaveSuccess))
+    {
+        
+        writer.key(_XPLATSTR("showCommentSaveSuccess"));
+        ModelBase::writeJson(writer, m_ShowCommentSaveSuccess);
+    }
+    if(m_FieldsSet.test(FieldBit_ShowLiveRightAway))
+    {
+        
+        writer.key(_XPLATSTR("showLiveRightAway"));
+        ModelBase::writeJson(writer, m_ShowLiveRightAway);
+    }
+    if(m_FieldsSet.test(FieldBit_ShowQuestion))
+    {
+        
+        writer.key(_XPLATSTR("showQuestion"));
+        ModelBase::writeJson(writer, m_ShowQuestion);
+    }
+    if(m_FieldsSet.test(FieldBit_SpamRules))
+    {
+        
+        writer.key(_XPLATSTR("spamRules"));
+        ModelBase::writeJson(writer, m_SpamRules);
+    }
+    if(m_FieldsSet.test(FieldBit_SsoSecLvl))
+    {
+        
+        writer.key(_XPLATSTR("ssoSecLvl"));
+        ModelBase::writeJson(writer, m_SsoSecLvl);
+    }
+    if(m_FieldsSet.test(FieldBit_Translations))
+    {
+        
+        writer.key(_XPLATSTR("translations"));
+        ModelBase::writeJson(writer, m_Translations);
+    }
+    if(m_FieldsSet.test(FieldBit_UseShowCommentsToggle))
+    {
+        
+        writer.key(_XPLATSTR("useShowCommentsToggle"));
+        ModelBase::writeJson(writer, m_UseShowCommentsToggle);
+    }
+    if(m_FieldsSet.test(FieldBit_UseSingleLineCommentInput))
+    {
+        
+        writer.key(_XPLATSTR("useSingleLineCommentInput"));
+        ModelBase::writeJson(writer, m_UseSingleLineCommentInput);
+    }
+    if(m_FieldsSet.test(FieldBit_VoteStyle))
+    {
+        
+        writer.key(_XPLATSTR("voteStyle"));
+        ModelBase::writeJson(writer, m_VoteStyle);
+    }
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionId))
+    {
+        
+        writer.key(_XPLATSTR("widgetQuestionId"));
+        ModelBase::writeJson(writer, m_WidgetQuestionId);
+    }
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionResultsStyle))
+    {
+        
+        writer.key(_XPLATSTR("widgetQuestionResultsStyle"));
+        ModelBase::writeJson(writer, m_WidgetQuestionResultsStyle);
+    }
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionShowBreakdown))
+    {
+        
+        writer.key(_XPLATSTR("widgetQuestionShowBreakdown"));
+        ModelBase::writeJson(writer, m_WidgetQuestionShowBreakdown);
+    }
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionStyle))
+    {
+        
+        writer.key(_XPLATSTR("widgetQuestionStyle"));
+        ModelBase::writeJson(writer, m_WidgetQuestionStyle);
+    }
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionWhenToSave))
+    {
+        
+        writer.key(_XPLATSTR("widgetQuestionWhenToSave"));
+        ModelBase::writeJson(writer, m_WidgetQuestionWhenToSave);
+    }
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionsRequired))
+    {
+        
+        writer.key(_XPLATSTR("widgetQuestionsRequired"));
+        ModelBase::writeJson(writer, m_WidgetQuestionsRequired);
+    }
+    if(m_FieldsSet.test(FieldBit_WidgetSubQuestionVisibility))
+    {
+        
+        writer.key(_XPLATSTR("widgetSubQuestionVisibility"));
+        ModelBase::writeJson(writer, m_WidgetSubQuestionVisibility);
+    }
+    if(m_FieldsSet.test(FieldBit_Wrap))
+    {
+        
+        writer.key(_XPLATSTR("wrap"));
+        ModelBase::writeJson(writer, m_Wrap);
+    }
+    if(m_FieldsSet.test(FieldBit_UsersListLocation))
+    {
+        
+        writer.key(_XPLATSTR("usersListLocation"));
+        ModelBase::writeJson(writer, m_UsersListLocation);
+    }
+    if(m_FieldsSet.test(FieldBit_UsersListIncludeOffline))
+    {
+        
+        writer.key(_XPLATSTR("usersListIncludeOffline"));
+        ModelBase::writeJson(writer, m_UsersListIncludeOffline);
+    }
+    if(m_FieldsSet.test(FieldBit_TicketBaseUrl))
+    {
+        
+        writer.key(_XPLATSTR("ticketBaseUrl"));
+        ModelBase::writeJson(writer, m_TicketBaseUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_TicketKBSearchEndpoint))
+    {
+        
+        writer.key(_XPLATSTR("ticketKBSearchEndpoint"));
+        ModelBase::writeJson(writer, m_TicketKBSearchEndpoint);
+    }
+    if(m_FieldsSet.test(FieldBit_TicketFileUploadsEnabled))
+    {
+        
+        writer.key(_XPLATSTR("ticketFileUploadsEnabled"));
+        ModelBase::writeJson(writer, m_TicketFileUploadsEnabled);
+    }
+    if(m_FieldsSet.test(FieldBit_TicketMaxFileSize))
+    {
+        
+        writer.key(_XPLATSTR("ticketMaxFileSize"));
+        ModelBase::writeJson(writer, m_TicketMaxFileSize);
+    }
+    if(m_FieldsSet.test(FieldBit_TicketAutoAssignUserIds))
+    {
+        
+        writer.key(_XPLATSTR("ticketAutoAssignUserIds"));
+        ModelBase::writeJson(writer, m_TicketAutoAssignUserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Tos))
+    {
+        
+        writer.key(_XPLATSTR("tos"));
+        ModelBase::writeJson(writer, m_Tos);
+    }
+
+    writer.endObject();
+}
+
 bool CustomConfigParameters::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("absoluteAndRelativeDates"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("absoluteAndRelativeDates")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAbsoluteAndRelativeDates;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAbsoluteAndRelativeDates);
-            setAbsoluteAndRelativeDates(refVal_setAbsoluteAndRelativeDates);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("absoluteDates"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("absoluteDates")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setAbsoluteDates;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAbsoluteDates);
-            setAbsoluteDates(refVal_setAbsoluteDates);
-            
+        case ModelBase::fieldHash(_XPLATSTR("absoluteAndRelativeDates")):
+            if(field.first == _XPLATSTR("absoluteAndRelativeDates"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAbsoluteAndRelativeDates;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAbsoluteAndRelativeDates);
+                    setAbsoluteAndRelativeDates(refVal_setAbsoluteAndRelativeDates);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("absoluteDates")):
+            if(field.first == _XPLATSTR("absoluteDates"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAbsoluteDates;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAbsoluteDates);
+                    setAbsoluteDates(refVal_setAbsoluteDates);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("allowAnon")):
+            if(field.first == _XPLATSTR("allowAnon"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAllowAnon;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAllowAnon);
+                    setAllowAnon(refVal_setAllowAnon);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("allowAnonFlag")):
+            if(field.first == _XPLATSTR("allowAnonFlag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAllowAnonFlag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAllowAnonFlag);
+                    setAllowAnonFlag(refVal_setAllowAnonFlag);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("allowAnonVotes")):
+            if(field.first == _XPLATSTR("allowAnonVotes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAllowAnonVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAllowAnonVotes);
+                    setAllowAnonVotes(refVal_setAllowAnonVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("allowedLanguages")):
+            if(field.first == _XPLATSTR("allowedLanguages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setAllowedLanguages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAllowedLanguages);
+                    setAllowedLanguages(refVal_setAllowedLanguages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("collapseReplies")):
+            if(field.first == _XPLATSTR("collapseReplies"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setCollapseReplies;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCollapseReplies);
+                    setCollapseReplies(refVal_setCollapseReplies);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCountFormat")):
+            if(field.first == _XPLATSTR("commentCountFormat"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentCountFormat;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCountFormat);
+                    setCommentCountFormat(refVal_setCommentCountFormat);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTMLRenderingMode")):
+            if(field.first == _XPLATSTR("commentHTMLRenderingMode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CommentHTMLRenderingMode> refVal_setCommentHTMLRenderingMode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTMLRenderingMode);
+                    setCommentHTMLRenderingMode(refVal_setCommentHTMLRenderingMode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentThreadDeleteMode")):
+            if(field.first == _XPLATSTR("commentThreadDeleteMode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CommentThreadDeletionMode> refVal_setCommentThreadDeleteMode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentThreadDeleteMode);
+                    setCommentThreadDeleteMode(refVal_setCommentThreadDeleteMode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterNameFormat")):
+            if(field.first == _XPLATSTR("commenterNameFormat"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CommenterNameFormats> refVal_setCommenterNameFormat;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterNameFormat);
+                    setCommenterNameFormat(refVal_setCommenterNameFormat);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("countAboveToggle")):
+            if(field.first == _XPLATSTR("countAboveToggle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setCountAboveToggle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCountAboveToggle);
+                    setCountAboveToggle(refVal_setCountAboveToggle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("customCSS")):
+            if(field.first == _XPLATSTR("customCSS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCustomCSS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCustomCSS);
+                    setCustomCSS(refVal_setCustomCSS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultAvatarSrc")):
+            if(field.first == _XPLATSTR("defaultAvatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDefaultAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultAvatarSrc);
+                    setDefaultAvatarSrc(refVal_setDefaultAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultSortDirection")):
+            if(field.first == _XPLATSTR("defaultSortDirection"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<SortDirections> refVal_setDefaultSortDirection;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultSortDirection);
+                    setDefaultSortDirection(refVal_setDefaultSortDirection);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultUsername")):
+            if(field.first == _XPLATSTR("defaultUsername"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDefaultUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultUsername);
+                    setDefaultUsername(refVal_setDefaultUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableAutoAdminMigration")):
+            if(field.first == _XPLATSTR("disableAutoAdminMigration"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableAutoAdminMigration;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableAutoAdminMigration);
+                    setDisableAutoAdminMigration(refVal_setDisableAutoAdminMigration);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableAutoHashTagCreation")):
+            if(field.first == _XPLATSTR("disableAutoHashTagCreation"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableAutoHashTagCreation;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableAutoHashTagCreation);
+                    setDisableAutoHashTagCreation(refVal_setDisableAutoHashTagCreation);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableBlocking")):
+            if(field.first == _XPLATSTR("disableBlocking"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableBlocking;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableBlocking);
+                    setDisableBlocking(refVal_setDisableBlocking);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableCommenterCommentDelete")):
+            if(field.first == _XPLATSTR("disableCommenterCommentDelete"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableCommenterCommentDelete;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableCommenterCommentDelete);
+                    setDisableCommenterCommentDelete(refVal_setDisableCommenterCommentDelete);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableCommenterCommentEdit")):
+            if(field.first == _XPLATSTR("disableCommenterCommentEdit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableCommenterCommentEdit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableCommenterCommentEdit);
+                    setDisableCommenterCommentEdit(refVal_setDisableCommenterCommentEdit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableEmailInputs")):
+            if(field.first == _XPLATSTR("disableEmailInputs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableEmailInputs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableEmailInputs);
+                    setDisableEmailInputs(refVal_setDisableEmailInputs);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableLiveCommenting")):
+            if(field.first == _XPLATSTR("disableLiveCommenting"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableLiveCommenting;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableLiveCommenting);
+                    setDisableLiveCommenting(refVal_setDisableLiveCommenting);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableNotificationBell")):
+            if(field.first == _XPLATSTR("disableNotificationBell"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableNotificationBell;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableNotificationBell);
+                    setDisableNotificationBell(refVal_setDisableNotificationBell);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableProfileComments")):
+            if(field.first == _XPLATSTR("disableProfileComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableProfileComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableProfileComments);
+                    setDisableProfileComments(refVal_setDisableProfileComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableProfileDirectMessages")):
+            if(field.first == _XPLATSTR("disableProfileDirectMessages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableProfileDirectMessages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableProfileDirectMessages);
+                    setDisableProfileDirectMessages(refVal_setDisableProfileDirectMessages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableProfiles")):
+            if(field.first == _XPLATSTR("disableProfiles"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableProfiles;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableProfiles);
+                    setDisableProfiles(refVal_setDisableProfiles);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableSuccessMessage")):
+            if(field.first == _XPLATSTR("disableSuccessMessage"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableSuccessMessage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableSuccessMessage);
+                    setDisableSuccessMessage(refVal_setDisableSuccessMessage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableToolbar")):
+            if(field.first == _XPLATSTR("disableToolbar"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableToolbar;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableToolbar);
+                    setDisableToolbar(refVal_setDisableToolbar);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableUnverifiedLabel")):
+            if(field.first == _XPLATSTR("disableUnverifiedLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableUnverifiedLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableUnverifiedLabel);
+                    setDisableUnverifiedLabel(refVal_setDisableUnverifiedLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("disableVoting")):
+            if(field.first == _XPLATSTR("disableVoting"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisableVoting;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisableVoting);
+                    setDisableVoting(refVal_setDisableVoting);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableCommenterLinks")):
+            if(field.first == _XPLATSTR("enableCommenterLinks"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableCommenterLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableCommenterLinks);
+                    setEnableCommenterLinks(refVal_setEnableCommenterLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableSearch")):
+            if(field.first == _XPLATSTR("enableSearch"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableSearch;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSearch);
+                    setEnableSearch(refVal_setEnableSearch);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableSpoilers")):
+            if(field.first == _XPLATSTR("enableSpoilers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableSpoilers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSpoilers);
+                    setEnableSpoilers(refVal_setEnableSpoilers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableThirdPartyCookieBypass")):
+            if(field.first == _XPLATSTR("enableThirdPartyCookieBypass"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableThirdPartyCookieBypass;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableThirdPartyCookieBypass);
+                    setEnableThirdPartyCookieBypass(refVal_setEnableThirdPartyCookieBypass);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableViewCounts")):
+            if(field.first == _XPLATSTR("enableViewCounts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableViewCounts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableViewCounts);
+                    setEnableViewCounts(refVal_setEnableViewCounts);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableVoteList")):
+            if(field.first == _XPLATSTR("enableVoteList"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableVoteList;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableVoteList);
+                    setEnableVoteList(refVal_setEnableVoteList);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableWYSIWYG")):
+            if(field.first == _XPLATSTR("enableWYSIWYG"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableWYSIWYG;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableWYSIWYG);
+                    setEnableWYSIWYG(refVal_setEnableWYSIWYG);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("gifRating")):
+            if(field.first == _XPLATSTR("gifRating"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<GifRating> refVal_setGifRating;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGifRating);
+                    setGifRating(refVal_setGifRating);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasDarkBackground")):
+            if(field.first == _XPLATSTR("hasDarkBackground"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasDarkBackground;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasDarkBackground);
+                    setHasDarkBackground(refVal_setHasDarkBackground);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("headerHTML")):
+            if(field.first == _XPLATSTR("headerHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setHeaderHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHeaderHTML);
+                    setHeaderHTML(refVal_setHeaderHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hideAvatars")):
+            if(field.first == _XPLATSTR("hideAvatars"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHideAvatars;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHideAvatars);
+                    setHideAvatars(refVal_setHideAvatars);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hideCommentsUnderCountTextFormat")):
+            if(field.first == _XPLATSTR("hideCommentsUnderCountTextFormat"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setHideCommentsUnderCountTextFormat;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHideCommentsUnderCountTextFormat);
+                    setHideCommentsUnderCountTextFormat(refVal_setHideCommentsUnderCountTextFormat);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("imageContentProfanityLevel")):
+            if(field.first == _XPLATSTR("imageContentProfanityLevel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<ImageContentProfanityLevel> refVal_setImageContentProfanityLevel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setImageContentProfanityLevel);
+                    setImageContentProfanityLevel(refVal_setImageContentProfanityLevel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("inputAfterComments")):
+            if(field.first == _XPLATSTR("inputAfterComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setInputAfterComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setInputAfterComments);
+                    setInputAfterComments(refVal_setInputAfterComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("limitCommentsByGroups")):
+            if(field.first == _XPLATSTR("limitCommentsByGroups"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setLimitCommentsByGroups;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLimitCommentsByGroups);
+                    setLimitCommentsByGroups(refVal_setLimitCommentsByGroups);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxCommentCharacterLength")):
+            if(field.first == _XPLATSTR("maxCommentCharacterLength"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setMaxCommentCharacterLength;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCommentCharacterLength);
+                    setMaxCommentCharacterLength(refVal_setMaxCommentCharacterLength);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxCommentCreatedCountPUPM")):
+            if(field.first == _XPLATSTR("maxCommentCreatedCountPUPM"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setMaxCommentCreatedCountPUPM;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCommentCreatedCountPUPM);
+                    setMaxCommentCreatedCountPUPM(refVal_setMaxCommentCreatedCountPUPM);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("noCustomConfig")):
+            if(field.first == _XPLATSTR("noCustomConfig"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNoCustomConfig;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNoCustomConfig);
+                    setNoCustomConfig(refVal_setNoCustomConfig);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("mentionAutoCompleteMode")):
+            if(field.first == _XPLATSTR("mentionAutoCompleteMode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<MentionAutoCompleteMode> refVal_setMentionAutoCompleteMode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMentionAutoCompleteMode);
+                    setMentionAutoCompleteMode(refVal_setMentionAutoCompleteMode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("noImageUploads")):
+            if(field.first == _XPLATSTR("noImageUploads"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNoImageUploads;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNoImageUploads);
+                    setNoImageUploads(refVal_setNoImageUploads);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("allowEmbeds")):
+            if(field.first == _XPLATSTR("allowEmbeds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAllowEmbeds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAllowEmbeds);
+                    setAllowEmbeds(refVal_setAllowEmbeds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("allowedEmbedDomains")):
+            if(field.first == _XPLATSTR("allowedEmbedDomains"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setAllowedEmbedDomains;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAllowedEmbedDomains);
+                    setAllowedEmbedDomains(refVal_setAllowedEmbedDomains);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("noStyles")):
+            if(field.first == _XPLATSTR("noStyles"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNoStyles;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNoStyles);
+                    setNoStyles(refVal_setNoStyles);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageSize")):
+            if(field.first == _XPLATSTR("pageSize"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setPageSize;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageSize);
+                    setPageSize(refVal_setPageSize);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("readonly")):
+            if(field.first == _XPLATSTR("readonly"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReadonly;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReadonly);
+                    setReadonly(refVal_setReadonly);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("noNewRootComments")):
+            if(field.first == _XPLATSTR("noNewRootComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNoNewRootComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNoNewRootComments);
+                    setNoNewRootComments(refVal_setNoNewRootComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("requireSSO")):
+            if(field.first == _XPLATSTR("requireSSO"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setRequireSSO;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRequireSSO);
+                    setRequireSSO(refVal_setRequireSSO);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableFChat")):
+            if(field.first == _XPLATSTR("enableFChat"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableFChat;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableFChat);
+                    setEnableFChat(refVal_setEnableFChat);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableResizeHandle")):
+            if(field.first == _XPLATSTR("enableResizeHandle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableResizeHandle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableResizeHandle);
+                    setEnableResizeHandle(refVal_setEnableResizeHandle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("restrictedLinkDomains")):
+            if(field.first == _XPLATSTR("restrictedLinkDomains"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setRestrictedLinkDomains;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRestrictedLinkDomains);
+                    setRestrictedLinkDomains(refVal_setRestrictedLinkDomains);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("showBadgesInTopBar")):
+            if(field.first == _XPLATSTR("showBadgesInTopBar"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setShowBadgesInTopBar;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setShowBadgesInTopBar);
+                    setShowBadgesInTopBar(refVal_setShowBadgesInTopBar);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("showCommentSaveSuccess")):
+            if(field.first == _XPLATSTR("showCommentSaveSuccess"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setShowCommentSaveSuccess;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setShowCommentSaveSuccess);
+                    setShowCommentSaveSuccess(refVal_setShowCommentSaveSuccess);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("showLiveRightAway")):
+            if(field.first == _XPLATSTR("showLiveRightAway"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setShowLiveRightAway;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setShowLiveRightAway);
+                    setShowLiveRightAway(refVal_setShowLiveRightAway);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("showQuestion")):
+            if(field.first == _XPLATSTR("showQuestion"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setShowQuestion;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setShowQuestion);
+                    setShowQuestion(refVal_setShowQuestion);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("spamRules")):
+            if(field.first == _XPLATSTR("spamRules"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<SpamRule>> refVal_setSpamRules;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSpamRules);
+                    setSpamRules(refVal_setSpamRules);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ssoSecLvl")):
+            if(field.first == _XPLATSTR("ssoSecLvl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<SSOSecurityLevel> refVal_setSsoSecLvl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSsoSecLvl);
+                    setSsoSecLvl(refVal_setSsoSecLvl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            if(field.first == _XPLATSTR("translations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setTranslations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
+                    setTranslations(refVal_setTranslations);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("useShowCommentsToggle")):
+            if(field.first == _XPLATSTR("useShowCommentsToggle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setUseShowCommentsToggle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUseShowCommentsToggle);
+                    setUseShowCommentsToggle(refVal_setUseShowCommentsToggle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("useSingleLineCommentInput")):
+            if(field.first == _XPLATSTR("useSingleLineCommentInput"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setUseSingleLineCommentInput;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUseSingleLineCommentInput);
+                    setUseSingleLineCommentInput(refVal_setUseSingleLineCommentInput);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("voteStyle")):
+            if(field.first == _XPLATSTR("voteStyle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<VoteStyle> refVal_setVoteStyle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVoteStyle);
+                    setVoteStyle(refVal_setVoteStyle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionId")):
+            if(field.first == _XPLATSTR("widgetQuestionId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWidgetQuestionId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionId);
+                    setWidgetQuestionId(refVal_setWidgetQuestionId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionResultsStyle")):
+            if(field.first == _XPLATSTR("widgetQuestionResultsStyle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CommentQuestionResultsRenderingType> refVal_setWidgetQuestionResultsStyle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionResultsStyle);
+                    setWidgetQuestionResultsStyle(refVal_setWidgetQuestionResultsStyle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionShowBreakdown")):
+            if(field.first == _XPLATSTR("widgetQuestionShowBreakdown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setWidgetQuestionShowBreakdown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionShowBreakdown);
+                    setWidgetQuestionShowBreakdown(refVal_setWidgetQuestionShowBreakdown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionStyle")):
+            if(field.first == _XPLATSTR("widgetQuestionStyle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QuestionRenderingType> refVal_setWidgetQuestionStyle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionStyle);
+                    setWidgetQuestionStyle(refVal_setWidgetQuestionStyle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionWhenToSave")):
+            if(field.first == _XPLATSTR("widgetQuestionWhenToSave"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QuestionWhenSave> refVal_setWidgetQuestionWhenToSave;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionWhenToSave);
+                    setWidgetQuestionWhenToSave(refVal_setWidgetQuestionWhenToSave);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionsRequired")):
+            if(field.first == _XPLATSTR("widgetQuestionsRequired"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CommentQuestionsRequired> refVal_setWidgetQuestionsRequired;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionsRequired);
+                    setWidgetQuestionsRequired(refVal_setWidgetQuestionsRequired);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("widgetSubQuestionVisibility")):
+            if(field.first == _XPLATSTR("widgetSubQuestionVisibility"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QuestionSubQuestionVisibility> refVal_setWidgetSubQuestionVisibility;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetSubQuestionVisibility);
+                    setWidgetSubQuestionVisibility(refVal_setWidgetSubQuestionVisibility);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wrap")):
+            if(field.first == _XPLATSTR("wrap"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setWrap;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWrap);
+                    setWrap(refVal_setWrap);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("usersListLocation")):
+            if(field.first == _XPLATSTR("usersListLocation"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UsersListLocation> refVal_setUsersListLocation;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsersListLocation);
+                    setUsersListLocation(refVal_setUsersListLocation);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("usersListIncludeOffline")):
+            if(field.first == _XPLATSTR("usersListIncludeOffline"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setUsersListIncludeOffline;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsersListIncludeOffline);
+                    setUsersListIncludeOffline(refVal_setUsersListIncludeOffline);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ticketBaseUrl")):
+            if(field.first == _XPLATSTR("ticketBaseUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTicketBaseUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTicketBaseUrl);
+                    setTicketBaseUrl(refVal_setTicketBaseUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ticketKBSearchEndpoint")):
+            if(field.first == _XPLATSTR("ticketKBSearchEndpoint"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTicketKBSearchEndpoint;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTicketKBSearchEndpoint);
+                    setTicketKBSearchEndpoint(refVal_setTicketKBSearchEndpoint);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ticketFileUploadsEnabled")):
+            if(field.first == _XPLATSTR("ticketFileUploadsEnabled"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setTicketFileUploadsEnabled;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTicketFileUploadsEnabled);
+                    setTicketFileUploadsEnabled(refVal_setTicketFileUploadsEnabled);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ticketMaxFileSize")):
+            if(field.first == _XPLATSTR("ticketMaxFileSize"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setTicketMaxFileSize;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTicketMaxFileSize);
+                    setTicketMaxFileSize(refVal_setTicketMaxFileSize);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ticketAutoAssignUserIds")):
+            if(field.first == _XPLATSTR("ticketAutoAssignUserIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setTicketAutoAssignUserIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTicketAutoAssignUserIds);
+                    setTicketAutoAssignUserIds(refVal_setTicketAutoAssignUserIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tos")):
+            if(field.first == _XPLATSTR("tos"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<TOSConfig> refVal_setTos;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTos);
+                    setTos(refVal_setTos);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("allowAnon"))))
+    return ok;
+}
+
+void CustomConfigParameters::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_AbsoluteAndRelativeDates))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("allowAnon")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAllowAnon;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAllowAnon);
-            setAllowAnon(refVal_setAllowAnon);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("absoluteAndRelativeDates")), m_AbsoluteAndRelativeDates);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("allowAnonFlag"))))
+    if(m_FieldsSet.test(FieldBit_AbsoluteDates))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("allowAnonFlag")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAllowAnonFlag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAllowAnonFlag);
-            setAllowAnonFlag(refVal_setAllowAnonFlag);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("absoluteDates")), m_AbsoluteDates);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowAnon))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("allowAnon")), m_AllowAnon);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowAnonFlag))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("allowAnonFlag")), m_AllowAnonFlag);
+    }
+    if(m_FieldsSet.test(FieldBit_AllowAnonVotes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("allowAnonVotes")), m_AllowAnonVotes);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("allowAnonVotes"))))
+    if(m_FieldsSet.test(FieldBit_AllowedLanguages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("allowAnonVotes")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAllowAnonVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAllowAnonVotes);
-            setAllowAnonVotes(refVal_setAllowAnonVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("allowedLanguages")), m_AllowedLanguages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("allowedLanguages"))))
+    if(m_FieldsSet.test(FieldBit_CollapseReplies))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("allowedLanguages")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setAllowedLanguages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAllowedLanguages);
-            setAllowedLanguages(refVal_setAllowedLanguages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("collapseReplies")), m_CollapseReplies);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("collapseReplies"))))
+    if(m_FieldsSet.test(FieldBit_CommentCountFormat))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("collapseReplies")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setCollapseReplies;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCollapseReplies);
-            setCollapseReplies(refVal_setCollapseReplies);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCountFormat")), m_CommentCountFormat);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCountFormat"))))
+    if(m_FieldsSet.test(FieldBit_CommentHTMLRenderingMode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCountFormat")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentCountFormat;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCountFormat);
-            setCommentCountFormat(refVal_setCommentCountFormat);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentHTMLRenderingMode")), m_CommentHTMLRenderingMode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentHTMLRenderingMode"))))
+    if(m_FieldsSet.test(FieldBit_CommentThreadDeleteMode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentHTMLRenderingMode")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<CommentHTMLRenderingMode> refVal_setCommentHTMLRenderingMode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTMLRenderingMode);
-            setCommentHTMLRenderingMode(refVal_setCommentHTMLRenderingMode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentThreadDeleteMode")), m_CommentThreadDeleteMode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentThreadDeleteMode"))))
+    if(m_FieldsSet.test(FieldBit_CommenterNameFormat))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentThreadDeleteMode")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<CommentThreadDeletionMode> refVal_setCommentThreadDeleteMode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentThreadDeleteMode);
-            setCommentThreadDeleteMode(refVal_setCommentThreadDeleteMode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterNameFormat")), m_CommenterNameFormat);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterNameFormat"))))
+    if(m_FieldsSet.test(FieldBit_CountAboveToggle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterNameFormat")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<CommenterNameFormats> refVal_setCommenterNameFormat;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterNameFormat);
-            setCommenterNameFormat(refVal_setCommenterNameFormat);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("countAboveToggle")), m_CountAboveToggle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("countAboveToggle"))))
+    if(m_FieldsSet.test(FieldBit_CustomCSS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("countAboveToggle")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setCountAboveToggle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCountAboveToggle);
-            setCountAboveToggle(refVal_setCountAboveToggle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("customCSS")), m_CustomCSS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("customCSS"))))
+    if(m_FieldsSet.test(FieldBit_DefaultAvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("customCSS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCustomCSS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCustomCSS);
-            setCustomCSS(refVal_setCustomCSS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultAvatarSrc")), m_DefaultAvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultAvatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_DefaultSortDirection))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultAvatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDefaultAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultAvatarSrc);
-            setDefaultAvatarSrc(refVal_setDefaultAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultSortDirection")), m_DefaultSortDirection);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultSortDirection"))))
+    if(m_FieldsSet.test(FieldBit_DefaultUsername))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultSortDirection")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<SortDirections> refVal_setDefaultSortDirection;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultSortDirection);
-            setDefaultSortDirection(refVal_setDefaultSortDirection);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultUsername")), m_DefaultUsername);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultUsername"))))
+    if(m_FieldsSet.test(FieldBit_DisableAutoAdminMigration))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultUsername")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDefaultUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultUsername);
-            setDefaultUsername(refVal_setDefaultUsername);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableAutoAdminMigration")), m_DisableAutoAdminMigration);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableAutoAdminMigration"))))
+    if(m_FieldsSet.test(FieldBit_DisableAutoHashTagCreation))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableAutoAdminMigration")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableAutoAdminMigration;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableAutoAdminMigration);
-            setDisableAutoAdminMigration(refVal_setDisableAutoAdminMigration);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableAutoHashTagCreation")), m_DisableAutoHashTagCreation);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableAutoHashTagCreation"))))
+    if(m_FieldsSet.test(FieldBit_DisableBlocking))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableAutoHashTagCreation")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableAutoHashTagCreation;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableAutoHashTagCreation);
-            setDisableAutoHashTagCreation(refVal_setDisableAutoHashTagCreation);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableBlocking")), m_DisableBlocking);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableBlocking"))))
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentDelete))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableBlocking")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableBlocking;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableBlocking);
-            setDisableBlocking(refVal_setDisableBlocking);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableCommenterCommentDelete")), m_DisableCommenterCommentDelete);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentDelete"))))
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentEdit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentDelete")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableCommenterCommentDelete;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableCommenterCommentDelete);
-            setDisableCommenterCommentDelete(refVal_setDisableCommenterCommentDelete);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableCommenterCommentEdit")), m_DisableCommenterCommentEdit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentEdit"))))
+    if(m_FieldsSet.test(FieldBit_DisableEmailInputs))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentEdit")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableCommenterCommentEdit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableCommenterCommentEdit);
-            setDisableCommenterCommentEdit(refVal_setDisableCommenterCommentEdit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableEmailInputs")), m_DisableEmailInputs);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableEmailInputs"))))
+    if(m_FieldsSet.test(FieldBit_DisableLiveCommenting))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableEmailInputs")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableEmailInputs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableEmailInputs);
-            setDisableEmailInputs(refVal_setDisableEmailInputs);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableLiveCommenting")), m_DisableLiveCommenting);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableLiveCommenting"))))
+    if(m_FieldsSet.test(FieldBit_DisableNotificationBell))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableLiveCommenting")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableLiveCommenting;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableLiveCommenting);
-            setDisableLiveCommenting(refVal_setDisableLiveCommenting);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableNotificationBell")), m_DisableNotificationBell);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableNotificationBell"))))
+    if(m_FieldsSet.test(FieldBit_DisableProfileComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableNotificationBell")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableNotificationBell;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableNotificationBell);
-            setDisableNotificationBell(refVal_setDisableNotificationBell);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableProfileComments")), m_DisableProfileComments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableProfileComments"))))
+    if(m_FieldsSet.test(FieldBit_DisableProfileDirectMessages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableProfileComments")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableProfileComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableProfileComments);
-            setDisableProfileComments(refVal_setDisableProfileComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableProfileDirectMessages")), m_DisableProfileDirectMessages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableProfileDirectMessages"))))
+    if(m_FieldsSet.test(FieldBit_DisableProfiles))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableProfileDirectMessages")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableProfileDirectMessages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableProfileDirectMessages);
-            setDisableProfileDirectMessages(refVal_setDisableProfileDirectMessages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableProfiles")), m_DisableProfiles);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableProfiles"))))
+    if(m_FieldsSet.test(FieldBit_DisableSuccessMessage))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableProfiles")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableProfiles;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableProfiles);
-            setDisableProfiles(refVal_setDisableProfiles);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableSuccessMessage")), m_DisableSuccessMessage);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableSuccessMessage"))))
+    if(m_FieldsSet.test(FieldBit_DisableToolbar))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableSuccessMessage")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableSuccessMessage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableSuccessMessage);
-            setDisableSuccessMessage(refVal_setDisableSuccessMessage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableToolbar")), m_DisableToolbar);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableToolbar"))))
+    if(m_FieldsSet.test(FieldBit_DisableUnverifiedLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableToolbar")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableToolbar;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableToolbar);
-            setDisableToolbar(refVal_setDisableToolbar);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableUnverifiedLabel")), m_DisableUnverifiedLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableUnverifiedLabel"))))
+    if(m_FieldsSet.test(FieldBit_DisableVoting))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableUnverifiedLabel")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableUnverifiedLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableUnverifiedLabel);
-            setDisableUnverifiedLabel(refVal_setDisableUnverifiedLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("disableVoting")), m_DisableVoting);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("disableVoting"))))
+    if(m_FieldsSet.test(FieldBit_EnableCommenterLinks))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("disableVoting")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisableVoting;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisableVoting);
-            setDisableVoting(refVal_setDisableVoting);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableCommenterLinks")), m_EnableCommenterLinks);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableCommenterLinks"))))
+    if(m_FieldsSet.test(FieldBit_EnableSearch))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableCommenterLinks")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableCommenterLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableCommenterLinks);
-            setEnableCommenterLinks(refVal_setEnableCommenterLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableSearch")), m_EnableSearch);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableSearch"))))
+    if(m_FieldsSet.test(FieldBit_EnableSpoilers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableSearch")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableSearch;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSearch);
-            setEnableSearch(refVal_setEnableSearch);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableSpoilers")), m_EnableSpoilers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableSpoilers"))))
+    if(m_FieldsSet.test(FieldBit_EnableThirdPartyCookieBypass))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableSpoilers")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableSpoilers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSpoilers);
-            setEnableSpoilers(refVal_setEnableSpoilers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableThirdPartyCookieBypass")), m_EnableThirdPartyCookieBypass);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableThirdPartyCookieBypass"))))
+    if(m_FieldsSet.test(FieldBit_EnableViewCounts))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableThirdPartyCookieBypass")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableThirdPartyCookieBypass;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableThirdPartyCookieBypass);
-            setEnableThirdPartyCookieBypass(refVal_setEnableThirdPartyCookieBypass);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableViewCounts")), m_EnableViewCounts);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableViewCounts"))))
+    if(m_FieldsSet.test(FieldBit_EnableVoteList))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableViewCounts")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableViewCounts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableViewCounts);
-            setEnableViewCounts(refVal_setEnableViewCounts);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableVoteList")), m_EnableVoteList);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableVoteList"))))
+    if(m_FieldsSet.test(FieldBit_EnableWYSIWYG))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableVoteList")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableVoteList;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableVoteList);
-            setEnableVoteList(refVal_setEnableVoteList);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableWYSIWYG")), m_EnableWYSIWYG);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableWYSIWYG"))))
+    if(m_FieldsSet.test(FieldBit_GifRating))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableWYSIWYG")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableWYSIWYG;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableWYSIWYG);
-            setEnableWYSIWYG(refVal_setEnableWYSIWYG);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("gifRating")), m_GifRating);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("gifRating"))))
+    if(m_FieldsSet.test(FieldBit_HasDarkBackground))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("gifRating")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<GifRating> refVal_setGifRating;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGifRating);
-            setGifRating(refVal_setGifRating);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasDarkBackground")), m_HasDarkBackground);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasDarkBackground"))))
+    if(m_FieldsSet.test(FieldBit_HeaderHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasDarkBackground")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasDarkBackground;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasDarkBackground);
-            setHasDarkBackground(refVal_setHasDarkBackground);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("headerHTML")), m_HeaderHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("headerHTML"))))
+    if(m_FieldsSet.test(FieldBit_HideAvatars))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("headerHTML")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setHeaderHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHeaderHTML);
-            setHeaderHTML(refVal_setHeaderHTML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hideAvatars")), m_HideAvatars);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hideAvatars"))))
+    if(m_FieldsSet.test(FieldBit_HideCommentsUnderCountTextFormat))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hideAvatars")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHideAvatars;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHideAvatars);
-            setHideAvatars(refVal_setHideAvatars);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hideCommentsUnderCountTextFormat")), m_HideCommentsUnderCountTextFormat);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hideCommentsUnderCountTextFormat"))))
+    if(m_FieldsSet.test(FieldBit_ImageContentProfanityLevel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hideCommentsUnderCountTextFormat")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setHideCommentsUnderCountTextFormat;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHideCommentsUnderCountTextFormat);
-            setHideCommentsUnderCountTextFormat(refVal_setHideCommentsUnderCountTextFormat);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("imageContentProfanityLevel")), m_ImageContentProfanityLevel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("imageContentProfanityLevel"))))
+    if(m_FieldsSet.test(FieldBit_InputAfterComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("imageContentProfanityLevel")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<ImageContentProfanityLevel> refVal_setImageContentProfanityLevel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setImageContentProfanityLevel);
-            setImageContentProfanityLevel(refVal_setImageContentProfanityLevel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("inputAfterComments")), m_InputAfterComments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("inputAfterComments"))))
+    if(m_FieldsSet.test(FieldBit_LimitCommentsByGroups))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("inputAfterComments")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setInputAfterComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setInputAfterComments);
-            setInputAfterComments(refVal_setInputAfterComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("limitCommentsByGroups")), m_LimitCommentsByGroups);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("limitCommentsByGroups"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("limitCommentsByGroups")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setLimitCommentsByGroups;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLimitCommentsByGroups);
-            setLimitCommentsByGroups(refVal_setLimitCommentsByGroups);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_MaxCommentCharacterLength))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxCommentCharacterLength")), m_MaxCommentCharacterLength);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxCommentCharacterLength"))))
+    if(m_FieldsSet.test(FieldBit_MaxCommentCreatedCountPUPM))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxCommentCharacterLength")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setMaxCommentCharacterLength;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCommentCharacterLength);
-            setMaxCommentCharacterLength(refVal_setMaxCommentCharacterLength);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxCommentCreatedCountPUPM")), m_MaxCommentCreatedCountPUPM);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxCommentCreatedCountPUPM"))))
+    if(m_FieldsSet.test(FieldBit_NoCustomConfig))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxCommentCreatedCountPUPM")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setMaxCommentCreatedCountPUPM;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCommentCreatedCountPUPM);
-            setMaxCommentCreatedCountPUPM(refVal_setMaxCommentCreatedCountPUPM);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("noCustomConfig")), m_NoCustomConfig);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("noCustomConfig"))))
+    if(m_FieldsSet.test(FieldBit_MentionAutoCompleteMode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("noCustomConfig")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNoCustomConfig;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNoCustomConfig);
-            setNoCustomConfig(refVal_setNoCustomConfig);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("mentionAutoCompleteMode")), m_MentionAutoCompleteMode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("mentionAutoCompleteMode"))))
+    if(m_FieldsSet.test(FieldBit_NoImageUploads))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("mentionAutoCompleteMode")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<MentionAutoCompleteMode> refVal_setMentionAutoCompleteMode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMentionAutoCompleteMode);
-            setMentionAutoCompleteMode(refVal_setMentionAutoCompleteMode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("noImageUploads")), m_NoImageUploads);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("noImageUploads"))))
+    if(m_FieldsSet.test(FieldBit_AllowEmbeds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("noImageUploads")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNoImageUploads;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNoImageUploads);
-            setNoImageUploads(refVal_setNoImageUploads);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("allowEmbeds")), m_AllowEmbeds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("allowEmbeds"))))
+    if(m_FieldsSet.test(FieldBit_AllowedEmbedDomains))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("allowEmbeds")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAllowEmbeds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAllowEmbeds);
-            setAllowEmbeds(refVal_setAllowEmbeds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("allowedEmbedDomains")), m_AllowedEmbedDomains);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("allowedEmbedDomains"))))
+    if(m_FieldsSet.test(FieldBit_NoStyles))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("allowedEmbedDomains")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setAllowedEmbedDomains;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAllowedEmbedDomains);
-            setAllowedEmbedDomains(refVal_setAllowedEmbedDomains);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("noStyles")), m_NoStyles);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("noStyles"))))
+    if(m_FieldsSet.test(FieldBit_PageSize))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("noStyles")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNoStyles;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNoStyles);
-            setNoStyles(refVal_setNoStyles);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageSize")), m_PageSize);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageSize"))))
+    if(m_FieldsSet.test(FieldBit_Readonly))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageSize")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setPageSize;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageSize);
-            setPageSize(refVal_setPageSize);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("readonly")), m_Readonly);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("readonly"))))
+    if(m_FieldsSet.test(FieldBit_NoNewRootComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("readonly")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReadonly;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReadonly);
-            setReadonly(refVal_setReadonly);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("noNewRootComments")), m_NoNewRootComments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("noNewRootComments"))))
+    if(m_FieldsSet.test(FieldBit_RequireSSO))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("noNewRootComments")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNoNewRootComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNoNewRootComments);
-            setNoNewRootComments(refVal_setNoNewRootComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("requireSSO")), m_RequireSSO);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("requireSSO"))))
+    if(m_FieldsSet.test(FieldBit_EnableFChat))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("requireSSO")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setRequireSSO;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRequireSSO);
-            setRequireSSO(refVal_setRequireSSO);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableFChat")), m_EnableFChat);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableFChat"))))
+    if(m_FieldsSet.test(FieldBit_EnableResizeHandle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableFChat")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableFChat;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableFChat);
-            setEnableFChat(refVal_setEnableFChat);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableResizeHandle")), m_EnableResizeHandle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableResizeHandle"))))
+    if(m_FieldsSet.test(FieldBit_RestrictedLinkDomains))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableResizeHandle")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableResizeHandle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableResizeHandle);
-            setEnableResizeHandle(refVal_setEnableResizeHandle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("restrictedLinkDomains")), m_RestrictedLinkDomains);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("restrictedLinkDomains"))))
+    if(m_FieldsSet.test(FieldBit_ShowBadgesInTopBar))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("restrictedLinkDomains")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setRestrictedLinkDomains;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRestrictedLinkDomains);
-            setRestrictedLinkDomains(refVal_setRestrictedLinkDomains);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("showBadgesInTopBar")), m_ShowBadgesInTopBar);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("showBadgesInTopBar"))))
+    if(m_FieldsSet.test(FieldBit_ShowCommentSaveSuccess))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("showBadgesInTopBar")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setShowBadgesInTopBar;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setShowBadgesInTopBar);
-            setShowBadgesInTopBar(refVal_setShowBadgesInTopBar);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("showCommentSaveSuccess")), m_ShowCommentSaveSuccess);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("showCommentSaveSuccess"))))
+    if(m_FieldsSet.test(FieldBit_ShowLiveRightAway))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("showCommentSaveSuccess")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setShowCommentSaveSuccess;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setShowCommentSaveSuccess);
-            setShowCommentSaveSuccess(refVal_setShowCommentSaveSuccess);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("showLiveRightAway")), m_ShowLiveRightAway);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("showLiveRightAway"))))
+    if(m_FieldsSet.test(FieldBit_ShowQuestion))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("showLiveRightAway")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setShowLiveRightAway;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setShowLiveRightAway);
-            setShowLiveRightAway(refVal_setShowLiveRightAway);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("showQuestion")), m_ShowQuestion);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("showQuestion"))))
+    if(m_FieldsSet.test(FieldBit_SpamRules))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("showQuestion")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setShowQuestion;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setShowQuestion);
-            setShowQuestion(refVal_setShowQuestion);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("spamRules")), m_SpamRules);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("spamRules"))))
+    if(m_FieldsSet.test(FieldBit_SsoSecLvl))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("spamRules")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<SpamRule>> refVal_setSpamRules;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSpamRules);
-            setSpamRules(refVal_setSpamRules);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ssoSecLvl")), m_SsoSecLvl);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ssoSecLvl"))))
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ssoSecLvl")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<SSOSecurityLevel> refVal_setSsoSecLvl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSsoSecLvl);
-            setSsoSecLvl(refVal_setSsoSecLvl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translations")), m_Translations);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translations"))))
+    if(m_FieldsSet.test(FieldBit_UseShowCommentsToggle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translations")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setTranslations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
-            setTranslations(refVal_setTranslations);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("useShowCommentsToggle")), m_UseShowCommentsToggle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("useShowCommentsToggle"))))
+    if(m_FieldsSet.test(FieldBit_UseSingleLineCommentInput))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("useShowCommentsToggle")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setUseShowCommentsToggle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUseShowCommentsToggle);
-            setUseShowCommentsToggle(refVal_setUseShowCommentsToggle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("useSingleLineCommentInput")), m_UseSingleLineCommentInput);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("useSingleLineCommentInput"))))
+    if(m_FieldsSet.test(FieldBit_VoteStyle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("useSingleLineCommentInput")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setUseSingleLineCommentInput;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUseSingleLineCommentInput);
-            setUseSingleLineCommentInput(refVal_setUseSingleLineCommentInput);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("voteStyle")), m_VoteStyle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("voteStyle"))))
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("voteStyle")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<VoteStyle> refVal_setVoteStyle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVoteStyle);
-            setVoteStyle(refVal_setVoteStyle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("widgetQuestionId")), m_WidgetQuestionId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionId"))))
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionResultsStyle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWidgetQuestionId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionId);
-            setWidgetQuestionId(refVal_setWidgetQuestionId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("widgetQuestionResultsStyle")), m_WidgetQuestionResultsStyle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionResultsStyle"))))
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionShowBreakdown))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionResultsStyle")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<CommentQuestionResultsRenderingType> refVal_setWidgetQuestionResultsStyle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionResultsStyle);
-            setWidgetQuestionResultsStyle(refVal_setWidgetQuestionResultsStyle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("widgetQuestionShowBreakdown")), m_WidgetQuestionShowBreakdown);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionShowBreakdown"))))
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionStyle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionShowBreakdown")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setWidgetQuestionShowBreakdown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionShowBreakdown);
-            setWidgetQuestionShowBreakdown(refVal_setWidgetQuestionShowBreakdown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("widgetQuestionStyle")), m_WidgetQuestionStyle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionStyle"))))
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionWhenToSave))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionStyle")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<QuestionRenderingType> refVal_setWidgetQuestionStyle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionStyle);
-            setWidgetQuestionStyle(refVal_setWidgetQuestionStyle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("widgetQuestionWhenToSave")), m_WidgetQuestionWhenToSave);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionWhenToSave"))))
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionsRequired))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionWhenToSave")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<QuestionWhenSave> refVal_setWidgetQuestionWhenToSave;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionWhenToSave);
-            setWidgetQuestionWhenToSave(refVal_setWidgetQuestionWhenToSave);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("widgetQuestionsRequired")), m_WidgetQuestionsRequired);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionsRequired"))))
+    if(m_FieldsSet.test(FieldBit_WidgetSubQuestionVisibility))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("widgetQuestionsRequired")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<CommentQuestionsRequired> refVal_setWidgetQuestionsRequired;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetQuestionsRequired);
-            setWidgetQuestionsRequired(refVal_setWidgetQuestionsRequired);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("widgetSubQuestionVisibility")), m_WidgetSubQuestionVisibility);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("widgetSubQuestionVisibility"))))
+    if(m_FieldsSet.test(FieldBit_Wrap))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("widgetSubQuestionVisibility")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<QuestionSubQuestionVisibility> refVal_setWidgetSubQuestionVisibility;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWidgetSubQuestionVisibility);
-            setWidgetSubQuestionVisibility(refVal_setWidgetSubQuestionVisibility);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wrap")), m_Wrap);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wrap"))))
+    if(m_FieldsSet.test(FieldBit_UsersListLocation))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wrap")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setWrap;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWrap);
-            setWrap(refVal_setWrap);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("usersListLocation")), m_UsersListLocation);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("usersListLocation"))))
+    if(m_FieldsSet.test(FieldBit_UsersListIncludeOffline))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("usersListLocation")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<UsersListLocation> refVal_setUsersListLocation;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsersListLocation);
-            setUsersListLocation(refVal_setUsersListLocation);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("usersListIncludeOffline")), m_UsersListIncludeOffline);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("usersListIncludeOffline"))))
+    if(m_FieldsSet.test(FieldBit_TicketBaseUrl))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("usersListIncludeOffline")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setUsersListIncludeOffline;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsersListIncludeOffline);
-            setUsersListIncludeOffline(refVal_setUsersListIncludeOffline);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ticketBaseUrl")), m_TicketBaseUrl);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ticketBaseUrl"))))
+    if(m_FieldsSet.test(FieldBit_TicketKBSearchEndpoint))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ticketBaseUrl")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTicketBaseUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTicketBaseUrl);
-            setTicketBaseUrl(refVal_setTicketBaseUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ticketKBSearchEndpoint")), m_TicketKBSearchEndpoint);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ticketKBSearchEndpoint"))))
+    if(m_FieldsSet.test(FieldBit_TicketFileUploadsEnabled))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ticketKBSearchEndpoint")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTicketKBSearchEndpoint;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTicketKBSearchEndpoint);
-            setTicketKBSearchEndpoint(refVal_setTicketKBSearchEndpoint);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ticketFileUploadsEnabled")), m_TicketFileUploadsEnabled);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ticketFileUploadsEnabled"))))
+    if(m_FieldsSet.test(FieldBit_TicketMaxFileSize))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ticketFileUploadsEnabled")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setTicketFileUploadsEnabled;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTicketFileUploadsEnabled);
-            setTicketFileUploadsEnabled(refVal_setTicketFileUploadsEnabled);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ticketMaxFileSize")), m_TicketMaxFileSize);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ticketMaxFileSize"))))
+    if(m_FieldsSet.test(FieldBit_TicketAutoAssignUserIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ticketMaxFileSize")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setTicketMaxFileSize;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTicketMaxFileSize);
-            setTicketMaxFileSize(refVal_setTicketMaxFileSize);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ticketAutoAssignUserIds")), m_TicketAutoAssignUserIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ticketAutoAssignUserIds"))))
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ticketAutoAssignUserIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setTicketAutoAssignUserIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTicketAutoAssignUserIds);
-            setTicketAutoAssignUserIds(refVal_setTicketAutoAssignUserIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tos")), m_Tos);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tos"))))
+}
+
+bool CustomConfigParameters::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tos")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            std::shared_ptr<TOSConfig> refVal_setTos;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTos);
-            setTos(refVal_setTos);
-            
+        case ModelBase::fieldHash(_XPLATSTR("absoluteAndRelativeDates")):
+            {
+                bool refVal_setAbsoluteAndRelativeDates;
+                if(!ModelBase::readBinary(reader, field, refVal_setAbsoluteAndRelativeDates))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAbsoluteAndRelativeDates(refVal_setAbsoluteAndRelativeDates);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("absoluteDates")):
+            {
+                bool refVal_setAbsoluteDates;
+                if(!ModelBase::readBinary(reader, field, refVal_setAbsoluteDates))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAbsoluteDates(refVal_setAbsoluteDates);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("allowAnon")):
+            {
+                bool refVal_setAllowAnon;
+                if(!ModelBase::readBinary(reader, field, refVal_setAllowAnon))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAllowAnon(refVal_setAllowAnon);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("allowAnonFlag")):
+            {
+                bool refVal_setAllowAnonFlag;
+                if(!ModelBase::readBinary(reader, field, refVal_setAllowAnonFlag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAllowAnonFlag(refVal_setAllowAnonFlag);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("allowAnonVotes")):
+            {
+                bool refVal_setAllowAnonVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setAllowAnonVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAllowAnonVotes(refVal_setAllowAnonVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("allowedLanguages")):
+            {
+                std::vector<utility::string_t> refVal_setAllowedLanguages;
+                if(!ModelBase::readBinary(reader, field, refVal_setAllowedLanguages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAllowedLanguages(refVal_setAllowedLanguages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("collapseReplies")):
+            {
+                bool refVal_setCollapseReplies;
+                if(!ModelBase::readBinary(reader, field, refVal_setCollapseReplies))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCollapseReplies(refVal_setCollapseReplies);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCountFormat")):
+            {
+                utility::string_t refVal_setCommentCountFormat;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCountFormat))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCountFormat(refVal_setCommentCountFormat);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTMLRenderingMode")):
+            {
+                std::shared_ptr<CommentHTMLRenderingMode> refVal_setCommentHTMLRenderingMode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentHTMLRenderingMode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentHTMLRenderingMode(refVal_setCommentHTMLRenderingMode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentThreadDeleteMode")):
+            {
+                std::shared_ptr<CommentThreadDeletionMode> refVal_setCommentThreadDeleteMode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentThreadDeleteMode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentThreadDeleteMode(refVal_setCommentThreadDeleteMode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterNameFormat")):
+            {
+                std::shared_ptr<CommenterNameFormats> refVal_setCommenterNameFormat;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterNameFormat))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterNameFormat(refVal_setCommenterNameFormat);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("countAboveToggle")):
+            {
+                int32_t refVal_setCountAboveToggle;
+                if(!ModelBase::readBinary(reader, field, refVal_setCountAboveToggle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCountAboveToggle(refVal_setCountAboveToggle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("customCSS")):
+            {
+                utility::string_t refVal_setCustomCSS;
+                if(!ModelBase::readBinary(reader, field, refVal_setCustomCSS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCustomCSS(refVal_setCustomCSS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultAvatarSrc")):
+            {
+                utility::string_t refVal_setDefaultAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultAvatarSrc(refVal_setDefaultAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultSortDirection")):
+            {
+                std::shared_ptr<SortDirections> refVal_setDefaultSortDirection;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultSortDirection))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultSortDirection(refVal_setDefaultSortDirection);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultUsername")):
+            {
+                utility::string_t refVal_setDefaultUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultUsername(refVal_setDefaultUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableAutoAdminMigration")):
+            {
+                bool refVal_setDisableAutoAdminMigration;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableAutoAdminMigration))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableAutoAdminMigration(refVal_setDisableAutoAdminMigration);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableAutoHashTagCreation")):
+            {
+                bool refVal_setDisableAutoHashTagCreation;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableAutoHashTagCreation))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableAutoHashTagCreation(refVal_setDisableAutoHashTagCreation);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableBlocking")):
+            {
+                bool refVal_setDisableBlocking;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableBlocking))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableBlocking(refVal_setDisableBlocking);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableCommenterCommentDelete")):
+            {
+                bool refVal_setDisableCommenterCommentDelete;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableCommenterCommentDelete))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableCommenterCommentDelete(refVal_setDisableCommenterCommentDelete);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableCommenterCommentEdit")):
+            {
+                bool refVal_setDisableCommenterCommentEdit;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableCommenterCommentEdit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableCommenterCommentEdit(refVal_setDisableCommenterCommentEdit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableEmailInputs")):
+            {
+                bool refVal_setDisableEmailInputs;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableEmailInputs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableEmailInputs(refVal_setDisableEmailInputs);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableLiveCommenting")):
+            {
+                bool refVal_setDisableLiveCommenting;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableLiveCommenting))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableLiveCommenting(refVal_setDisableLiveCommenting);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableNotificationBell")):
+            {
+                bool refVal_setDisableNotificationBell;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableNotificationBell))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableNotificationBell(refVal_setDisableNotificationBell);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableProfileComments")):
+            {
+                bool refVal_setDisableProfileComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableProfileComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableProfileComments(refVal_setDisableProfileComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableProfileDirectMessages")):
+            {
+                bool refVal_setDisableProfileDirectMessages;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableProfileDirectMessages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableProfileDirectMessages(refVal_setDisableProfileDirectMessages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableProfiles")):
+            {
+                bool refVal_setDisableProfiles;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableProfiles))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableProfiles(refVal_setDisableProfiles);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableSuccessMessage")):
+            {
+                bool refVal_setDisableSuccessMessage;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableSuccessMessage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableSuccessMessage(refVal_setDisableSuccessMessage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableToolbar")):
+            {
+                bool refVal_setDisableToolbar;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableToolbar))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableToolbar(refVal_setDisableToolbar);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableUnverifiedLabel")):
+            {
+                bool refVal_setDisableUnverifiedLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableUnverifiedLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableUnverifiedLabel(refVal_setDisableUnverifiedLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("disableVoting")):
+            {
+                bool refVal_setDisableVoting;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisableVoting))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisableVoting(refVal_setDisableVoting);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableCommenterLinks")):
+            {
+                bool refVal_setEnableCommenterLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableCommenterLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableCommenterLinks(refVal_setEnableCommenterLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableSearch")):
+            {
+                bool refVal_setEnableSearch;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableSearch))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableSearch(refVal_setEnableSearch);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableSpoilers")):
+            {
+                bool refVal_setEnableSpoilers;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableSpoilers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableSpoilers(refVal_setEnableSpoilers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableThirdPartyCookieBypass")):
+            {
+                bool refVal_setEnableThirdPartyCookieBypass;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableThirdPartyCookieBypass))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableThirdPartyCookieBypass(refVal_setEnableThirdPartyCookieBypass);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableViewCounts")):
+            {
+                bool refVal_setEnableViewCounts;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableViewCounts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableViewCounts(refVal_setEnableViewCounts);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableVoteList")):
+            {
+                bool refVal_setEnableVoteList;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableVoteList))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableVoteList(refVal_setEnableVoteList);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableWYSIWYG")):
+            {
+                bool refVal_setEnableWYSIWYG;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableWYSIWYG))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableWYSIWYG(refVal_setEnableWYSIWYG);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("gifRating")):
+            {
+                std::shared_ptr<GifRating> refVal_setGifRating;
+                if(!ModelBase::readBinary(reader, field, refVal_setGifRating))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGifRating(refVal_setGifRating);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasDarkBackground")):
+            {
+                bool refVal_setHasDarkBackground;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasDarkBackground))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasDarkBackground(refVal_setHasDarkBackground);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("headerHTML")):
+            {
+                utility::string_t refVal_setHeaderHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setHeaderHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHeaderHTML(refVal_setHeaderHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hideAvatars")):
+            {
+                bool refVal_setHideAvatars;
+                if(!ModelBase::readBinary(reader, field, refVal_setHideAvatars))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHideAvatars(refVal_setHideAvatars);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hideCommentsUnderCountTextFormat")):
+            {
+                utility::string_t refVal_setHideCommentsUnderCountTextFormat;
+                if(!ModelBase::readBinary(reader, field, refVal_setHideCommentsUnderCountTextFormat))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHideCommentsUnderCountTextFormat(refVal_setHideCommentsUnderCountTextFormat);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("imageContentProfanityLevel")):
+            {
+                std::shared_ptr<ImageContentProfanityLevel> refVal_setImageContentProfanityLevel;
+                if(!ModelBase::readBinary(reader, field, refVal_setImageContentProfanityLevel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setImageContentProfanityLevel(refVal_setImageContentProfanityLevel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("inputAfterComments")):
+            {
+                bool refVal_setInputAfterComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setInputAfterComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setInputAfterComments(refVal_setInputAfterComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("limitCommentsByGroups")):
+            {
+                bool refVal_setLimitCommentsByGroups;
+                if(!ModelBase::readBinary(reader, field, refVal_setLimitCommentsByGroups))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLimitCommentsByGroups(refVal_setLimitCommentsByGroups);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxCommentCharacterLength")):
+            {
+                int32_t refVal_setMaxCommentCharacterLength;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxCommentCharacterLength))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxCommentCharacterLength(refVal_setMaxCommentCharacterLength);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxCommentCreatedCountPUPM")):
+            {
+                int32_t refVal_setMaxCommentCreatedCountPUPM;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxCommentCreatedCountPUPM))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxCommentCreatedCountPUPM(refVal_setMaxCommentCreatedCountPUPM);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("noCustomConfig")):
+            {
+                bool refVal_setNoCustomConfig;
+                if(!ModelBase::readBinary(reader, field, refVal_setNoCustomConfig))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNoCustomConfig(refVal_setNoCustomConfig);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("mentionAutoCompleteMode")):
+            {
+                std::shared_ptr<MentionAutoCompleteMode> refVal_setMentionAutoCompleteMode;
+                if(!ModelBase::readBinary(reader, field, refVal_setMentionAutoCompleteMode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMentionAutoCompleteMode(refVal_setMentionAutoCompleteMode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("noImageUploads")):
+            {
+                bool refVal_setNoImageUploads;
+                if(!ModelBase::readBinary(reader, field, refVal_setNoImageUploads))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNoImageUploads(refVal_setNoImageUploads);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("allowEmbeds")):
+            {
+                bool refVal_setAllowEmbeds;
+                if(!ModelBase::readBinary(reader, field, refVal_setAllowEmbeds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAllowEmbeds(refVal_setAllowEmbeds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("allowedEmbedDomains")):
+            {
+                std::vector<utility::string_t> refVal_setAllowedEmbedDomains;
+                if(!ModelBase::readBinary(reader, field, refVal_setAllowedEmbedDomains))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAllowedEmbedDomains(refVal_setAllowedEmbedDomains);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("noStyles")):
+            {
+                bool refVal_setNoStyles;
+                if(!ModelBase::readBinary(reader, field, refVal_setNoStyles))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNoStyles(refVal_setNoStyles);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageSize")):
+            {
+                int32_t refVal_setPageSize;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageSize))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageSize(refVal_setPageSize);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("readonly")):
+            {
+                bool refVal_setReadonly;
+                if(!ModelBase::readBinary(reader, field, refVal_setReadonly))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReadonly(refVal_setReadonly);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("noNewRootComments")):
+            {
+                bool refVal_setNoNewRootComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setNoNewRootComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNoNewRootComments(refVal_setNoNewRootComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("requireSSO")):
+            {
+                bool refVal_setRequireSSO;
+                if(!ModelBase::readBinary(reader, field, refVal_setRequireSSO))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRequireSSO(refVal_setRequireSSO);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableFChat")):
+            {
+                bool refVal_setEnableFChat;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableFChat))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableFChat(refVal_setEnableFChat);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableResizeHandle")):
+            {
+                bool refVal_setEnableResizeHandle;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableResizeHandle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableResizeHandle(refVal_setEnableResizeHandle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("restrictedLinkDomains")):
+            {
+                std::vector<utility::string_t> refVal_setRestrictedLinkDomains;
+                if(!ModelBase::readBinary(reader, field, refVal_setRestrictedLinkDomains))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRestrictedLinkDomains(refVal_setRestrictedLinkDomains);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("showBadgesInTopBar")):
+            {
+                bool refVal_setShowBadgesInTopBar;
+                if(!ModelBase::readBinary(reader, field, refVal_setShowBadgesInTopBar))
+                {
+                    ok = false;
+                    continue;
+                }
+                setShowBadgesInTopBar(refVal_setShowBadgesInTopBar);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("showCommentSaveSuccess")):
+            {
+                bool refVal_setShowCommentSaveSuccess;
+                if(!ModelBase::readBinary(reader, field, refVal_setShowCommentSaveSuccess))
+                {
+                    ok = false;
+                    continue;
+                }
+                setShowCommentSaveSuccess(refVal_setShowCommentSaveSuccess);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("showLiveRightAway")):
+            {
+                bool refVal_setShowLiveRightAway;
+                if(!ModelBase::readBinary(reader, field, refVal_setShowLiveRightAway))
+                {
+                    ok = false;
+                    continue;
+                }
+                setShowLiveRightAway(refVal_setShowLiveRightAway);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("showQuestion")):
+            {
+                bool refVal_setShowQuestion;
+                if(!ModelBase::readBinary(reader, field, refVal_setShowQuestion))
+                {
+                    ok = false;
+                    continue;
+                }
+                setShowQuestion(refVal_setShowQuestion);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("spamRules")):
+            {
+                std::vector<std::shared_ptr<SpamRule>> refVal_setSpamRules;
+                if(!ModelBase::readBinary(reader, field, refVal_setSpamRules))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSpamRules(refVal_setSpamRules);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ssoSecLvl")):
+            {
+                std::shared_ptr<SSOSecurityLevel> refVal_setSsoSecLvl;
+                if(!ModelBase::readBinary(reader, field, refVal_setSsoSecLvl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSsoSecLvl(refVal_setSsoSecLvl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setTranslations;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslations(refVal_setTranslations);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("useShowCommentsToggle")):
+            {
+                bool refVal_setUseShowCommentsToggle;
+                if(!ModelBase::readBinary(reader, field, refVal_setUseShowCommentsToggle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUseShowCommentsToggle(refVal_setUseShowCommentsToggle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("useSingleLineCommentInput")):
+            {
+                bool refVal_setUseSingleLineCommentInput;
+                if(!ModelBase::readBinary(reader, field, refVal_setUseSingleLineCommentInput))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUseSingleLineCommentInput(refVal_setUseSingleLineCommentInput);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("voteStyle")):
+            {
+                std::shared_ptr<VoteStyle> refVal_setVoteStyle;
+                if(!ModelBase::readBinary(reader, field, refVal_setVoteStyle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVoteStyle(refVal_setVoteStyle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionId")):
+            {
+                utility::string_t refVal_setWidgetQuestionId;
+                if(!ModelBase::readBinary(reader, field, refVal_setWidgetQuestionId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWidgetQuestionId(refVal_setWidgetQuestionId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionResultsStyle")):
+            {
+                std::shared_ptr<CommentQuestionResultsRenderingType> refVal_setWidgetQuestionResultsStyle;
+                if(!ModelBase::readBinary(reader, field, refVal_setWidgetQuestionResultsStyle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWidgetQuestionResultsStyle(refVal_setWidgetQuestionResultsStyle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionShowBreakdown")):
+            {
+                bool refVal_setWidgetQuestionShowBreakdown;
+                if(!ModelBase::readBinary(reader, field, refVal_setWidgetQuestionShowBreakdown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWidgetQuestionShowBreakdown(refVal_setWidgetQuestionShowBreakdown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionStyle")):
+            {
+                std::shared_ptr<QuestionRenderingType> refVal_setWidgetQuestionStyle;
+                if(!ModelBase::readBinary(reader, field, refVal_setWidgetQuestionStyle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWidgetQuestionStyle(refVal_setWidgetQuestionStyle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionWhenToSave")):
+            {
+                std::shared_ptr<QuestionWhenSave> refVal_setWidgetQuestionWhenToSave;
+                if(!ModelBase::readBinary(reader, field, refVal_setWidgetQuestionWhenToSave))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWidgetQuestionWhenToSave(refVal_setWidgetQuestionWhenToSave);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("widgetQuestionsRequired")):
+            {
+                std::shared_ptr<CommentQuestionsRequired> refVal_setWidgetQuestionsRequired;
+                if(!ModelBase::readBinary(reader, field, refVal_setWidgetQuestionsRequired))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWidgetQuestionsRequired(refVal_setWidgetQuestionsRequired);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("widgetSubQuestionVisibility")):
+            {
+                std::shared_ptr<QuestionSubQuestionVisibility> refVal_setWidgetSubQuestionVisibility;
+                if(!ModelBase::readBinary(reader, field, refVal_setWidgetSubQuestionVisibility))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWidgetSubQuestionVisibility(refVal_setWidgetSubQuestionVisibility);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wrap")):
+            {
+                bool refVal_setWrap;
+                if(!ModelBase::readBinary(reader, field, refVal_setWrap))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWrap(refVal_setWrap);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("usersListLocation")):
+            {
+                std::shared_ptr<UsersListLocation> refVal_setUsersListLocation;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsersListLocation))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsersListLocation(refVal_setUsersListLocation);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("usersListIncludeOffline")):
+            {
+                bool refVal_setUsersListIncludeOffline;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsersListIncludeOffline))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsersListIncludeOffline(refVal_setUsersListIncludeOffline);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ticketBaseUrl")):
+            {
+                utility::string_t refVal_setTicketBaseUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setTicketBaseUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTicketBaseUrl(refVal_setTicketBaseUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ticketKBSearchEndpoint")):
+            {
+                utility::string_t refVal_setTicketKBSearchEndpoint;
+                if(!ModelBase::readBinary(reader, field, refVal_setTicketKBSearchEndpoint))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTicketKBSearchEndpoint(refVal_setTicketKBSearchEndpoint);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ticketFileUploadsEnabled")):
+            {
+                bool refVal_setTicketFileUploadsEnabled;
+                if(!ModelBase::readBinary(reader, field, refVal_setTicketFileUploadsEnabled))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTicketFileUploadsEnabled(refVal_setTicketFileUploadsEnabled);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ticketMaxFileSize")):
+            {
+                int32_t refVal_setTicketMaxFileSize;
+                if(!ModelBase::readBinary(reader, field, refVal_setTicketMaxFileSize))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTicketMaxFileSize(refVal_setTicketMaxFileSize);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ticketAutoAssignUserIds")):
+            {
+                std::vector<utility::string_t> refVal_setTicketAutoAssignUserIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setTicketAutoAssignUserIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTicketAutoAssignUserIds(refVal_setTicketAutoAssignUserIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tos")):
+            {
+                std::shared_ptr<TOSConfig> refVal_setTos;
+                if(!ModelBase::readBinary(reader, field, refVal_setTos))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTos(refVal_setTos);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CustomConfigParameters::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -1585,355 +3580,355 @@ void CustomConfigParameters::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_AbsoluteAndRelativeDatesIsSet)
+    if(m_FieldsSet.test(FieldBit_AbsoluteAndRelativeDates))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("absoluteAndRelativeDates")), m_AbsoluteAndRelativeDates));
     }
-    if(m_AbsoluteDatesIsSet)
+    if(m_FieldsSet.test(FieldBit_AbsoluteDates))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("absoluteDates")), m_AbsoluteDates));
     }
-    if(m_AllowAnonIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowAnon))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowAnon")), m_AllowAnon));
     }
-    if(m_AllowAnonFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowAnonFlag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowAnonFlag")), m_AllowAnonFlag));
     }
-    if(m_AllowAnonVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowAnonVotes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowAnonVotes")), m_AllowAnonVotes));
     }
-    if(m_AllowedLanguages.has_value())
+    if(m_FieldsSet.test(FieldBit_AllowedLanguages))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowedLanguages")), m_AllowedLanguages.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowedLanguages")), m_AllowedLanguages));
     }
-    if(m_CollapseRepliesIsSet)
+    if(m_FieldsSet.test(FieldBit_CollapseReplies))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("collapseReplies")), m_CollapseReplies));
     }
-    if(m_CommentCountFormat.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentCountFormat))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCountFormat")), m_CommentCountFormat.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCountFormat")), m_CommentCountFormat));
     }
-    if(m_CommentHTMLRenderingModeIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTMLRenderingMode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentHTMLRenderingMode")), m_CommentHTMLRenderingMode));
     }
-    if(m_CommentThreadDeleteMode.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentThreadDeleteMode))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentThreadDeleteMode")), m_CommentThreadDeleteMode.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentThreadDeleteMode")), m_CommentThreadDeleteMode));
     }
-    if(m_CommenterNameFormat.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterNameFormat))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterNameFormat")), m_CommenterNameFormat.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterNameFormat")), m_CommenterNameFormat));
     }
-    if(m_CountAboveToggleIsSet)
+    if(m_FieldsSet.test(FieldBit_CountAboveToggle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("countAboveToggle")), m_CountAboveToggle));
     }
-    if(m_CustomCSS.has_value())
+    if(m_FieldsSet.test(FieldBit_CustomCSS))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customCSS")), m_CustomCSS.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customCSS")), m_CustomCSS));
     }
-    if(m_DefaultAvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DefaultAvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultAvatarSrc")), m_DefaultAvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultAvatarSrc")), m_DefaultAvatarSrc));
     }
-    if(m_DefaultSortDirection.has_value())
+    if(m_FieldsSet.test(FieldBit_DefaultSortDirection))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultSortDirection")), m_DefaultSortDirection.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultSortDirection")), m_DefaultSortDirection));
     }
-    if(m_DefaultUsername.has_value())
+    if(m_FieldsSet.test(FieldBit_DefaultUsername))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultUsername")), m_DefaultUsername.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultUsername")), m_DefaultUsername));
     }
-    if(m_DisableAutoAdminMigrationIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableAutoAdminMigration))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableAutoAdminMigration")), m_DisableAutoAdminMigration));
     }
-    if(m_DisableAutoHashTagCreationIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableAutoHashTagCreation))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableAutoHashTagCreation")), m_DisableAutoHashTagCreation));
     }
-    if(m_DisableBlockingIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableBlocking))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableBlocking")), m_DisableBlocking));
     }
-    if(m_DisableCommenterCommentDeleteIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentDelete))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentDelete")), m_DisableCommenterCommentDelete));
     }
-    if(m_DisableCommenterCommentEditIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableCommenterCommentEdit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableCommenterCommentEdit")), m_DisableCommenterCommentEdit));
     }
-    if(m_DisableEmailInputsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableEmailInputs))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableEmailInputs")), m_DisableEmailInputs));
     }
-    if(m_DisableLiveCommentingIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableLiveCommenting))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableLiveCommenting")), m_DisableLiveCommenting));
     }
-    if(m_DisableNotificationBellIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableNotificationBell))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableNotificationBell")), m_DisableNotificationBell));
     }
-    if(m_DisableProfileCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableProfileComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableProfileComments")), m_DisableProfileComments));
     }
-    if(m_DisableProfileDirectMessagesIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableProfileDirectMessages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableProfileDirectMessages")), m_DisableProfileDirectMessages));
     }
-    if(m_DisableProfilesIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableProfiles))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableProfiles")), m_DisableProfiles));
     }
-    if(m_DisableSuccessMessageIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableSuccessMessage))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableSuccessMessage")), m_DisableSuccessMessage));
     }
-    if(m_DisableToolbarIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableToolbar))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableToolbar")), m_DisableToolbar));
     }
-    if(m_DisableUnverifiedLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableUnverifiedLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableUnverifiedLabel")), m_DisableUnverifiedLabel));
     }
-    if(m_DisableVotingIsSet)
+    if(m_FieldsSet.test(FieldBit_DisableVoting))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("disableVoting")), m_DisableVoting));
     }
-    if(m_EnableCommenterLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableCommenterLinks))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableCommenterLinks")), m_EnableCommenterLinks));
     }
-    if(m_EnableSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSearch))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableSearch")), m_EnableSearch));
     }
-    if(m_EnableSpoilersIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSpoilers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableSpoilers")), m_EnableSpoilers));
     }
-    if(m_EnableThirdPartyCookieBypassIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableThirdPartyCookieBypass))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableThirdPartyCookieBypass")), m_EnableThirdPartyCookieBypass));
     }
-    if(m_EnableViewCountsIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableViewCounts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableViewCounts")), m_EnableViewCounts));
     }
-    if(m_EnableVoteListIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableVoteList))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableVoteList")), m_EnableVoteList));
     }
-    if(m_EnableWYSIWYGIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableWYSIWYG))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableWYSIWYG")), m_EnableWYSIWYG));
     }
-    if(m_GifRatingIsSet)
+    if(m_FieldsSet.test(FieldBit_GifRating))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("gifRating")), m_GifRating));
     }
-    if(m_HasDarkBackgroundIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDarkBackground))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasDarkBackground")), m_HasDarkBackground));
     }
-    if(m_HeaderHTML.has_value())
+    if(m_FieldsSet.test(FieldBit_HeaderHTML))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("headerHTML")), m_HeaderHTML.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("headerHTML")), m_HeaderHTML));
     }
-    if(m_HideAvatarsIsSet)
+    if(m_FieldsSet.test(FieldBit_HideAvatars))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hideAvatars")), m_HideAvatars));
     }
-    if(m_HideCommentsUnderCountTextFormat.has_value())
+    if(m_FieldsSet.test(FieldBit_HideCommentsUnderCountTextFormat))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hideCommentsUnderCountTextFormat")), m_HideCommentsUnderCountTextFormat.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hideCommentsUnderCountTextFormat")), m_HideCommentsUnderCountTextFormat));
     }
-    if(m_ImageContentProfanityLevelIsSet)
+    if(m_FieldsSet.test(FieldBit_ImageContentProfanityLevel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("imageContentProfanityLevel")), m_ImageContentProfanityLevel));
     }
-    if(m_InputAfterCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_InputAfterComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("inputAfterComments")), m_InputAfterComments));
     }
-    if(m_LimitCommentsByGroupsIsSet)
+    if(m_FieldsSet.test(FieldBit_LimitCommentsByGroups))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("limitCommentsByGroups")), m_LimitCommentsByGroups));
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_MaxCommentCharacterLength.has_value())
+    if(m_FieldsSet.test(FieldBit_MaxCommentCharacterLength))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCommentCharacterLength")), m_MaxCommentCharacterLength.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCommentCharacterLength")), m_MaxCommentCharacterLength));
     }
-    if(m_MaxCommentCreatedCountPUPM.has_value())
+    if(m_FieldsSet.test(FieldBit_MaxCommentCreatedCountPUPM))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCommentCreatedCountPUPM")), m_MaxCommentCreatedCountPUPM.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCommentCreatedCountPUPM")), m_MaxCommentCreatedCountPUPM));
     }
-    if(m_NoCustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_NoCustomConfig))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("noCustomConfig")), m_NoCustomConfig));
     }
-    if(m_MentionAutoCompleteMode.has_value())
+    if(m_FieldsSet.test(FieldBit_MentionAutoCompleteMode))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("mentionAutoCompleteMode")), m_MentionAutoCompleteMode.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("mentionAutoCompleteMode")), m_MentionAutoCompleteMode));
     }
-    if(m_NoImageUploadsIsSet)
+    if(m_FieldsSet.test(FieldBit_NoImageUploads))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("noImageUploads")), m_NoImageUploads));
     }
-    if(m_AllowEmbedsIsSet)
+    if(m_FieldsSet.test(FieldBit_AllowEmbeds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowEmbeds")), m_AllowEmbeds));
     }
-    if(m_AllowedEmbedDomains.has_value())
+    if(m_FieldsSet.test(FieldBit_AllowedEmbedDomains))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowedEmbedDomains")), m_AllowedEmbedDomains.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("allowedEmbedDomains")), m_AllowedEmbedDomains));
     }
-    if(m_NoStylesIsSet)
+    if(m_FieldsSet.test(FieldBit_NoStyles))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("noStyles")), m_NoStyles));
     }
-    if(m_PageSize.has_value())
+    if(m_FieldsSet.test(FieldBit_PageSize))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageSize")), m_PageSize.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageSize")), m_PageSize));
     }
-    if(m_ReadonlyIsSet)
+    if(m_FieldsSet.test(FieldBit_Readonly))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("readonly")), m_Readonly));
     }
-    if(m_NoNewRootCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_NoNewRootComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("noNewRootComments")), m_NoNewRootComments));
     }
-    if(m_RequireSSOIsSet)
+    if(m_FieldsSet.test(FieldBit_RequireSSO))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("requireSSO")), m_RequireSSO));
     }
-    if(m_EnableFChatIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableFChat))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableFChat")), m_EnableFChat));
     }
-    if(m_EnableResizeHandleIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableResizeHandle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableResizeHandle")), m_EnableResizeHandle));
     }
-    if(m_RestrictedLinkDomains.has_value())
+    if(m_FieldsSet.test(FieldBit_RestrictedLinkDomains))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("restrictedLinkDomains")), m_RestrictedLinkDomains.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("restrictedLinkDomains")), m_RestrictedLinkDomains));
     }
-    if(m_ShowBadgesInTopBarIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowBadgesInTopBar))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("showBadgesInTopBar")), m_ShowBadgesInTopBar));
     }
-    if(m_ShowCommentSaveSuccessIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowCommentSaveSuccess))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("showCommentSaveSuccess")), m_ShowCommentSaveSuccess));
     }
-    if(m_ShowLiveRightAwayIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowLiveRightAway))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("showLiveRightAway")), m_ShowLiveRightAway));
     }
-    if(m_ShowQuestionIsSet)
+    if(m_FieldsSet.test(FieldBit_ShowQuestion))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("showQuestion")), m_ShowQuestion));
     }
-    if(m_SpamRulesIsSet)
+    if(m_FieldsSet.test(FieldBit_SpamRules))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("spamRules")), m_SpamRules));
     }
-    if(m_SsoSecLvlIsSet)
+    if(m_FieldsSet.test(FieldBit_SsoSecLvl))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ssoSecLvl")), m_SsoSecLvl));
     }
-    if(m_Translations.has_value())
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translations")), m_Translations.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translations")), m_Translations));
     }
-    if(m_UseShowCommentsToggleIsSet)
+    if(m_FieldsSet.test(FieldBit_UseShowCommentsToggle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("useShowCommentsToggle")), m_UseShowCommentsToggle));
     }
-    if(m_UseSingleLineCommentInputIsSet)
+    if(m_FieldsSet.test(FieldBit_UseSingleLineCommentInput))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("useSingleLineCommentInput")), m_UseSingleLineCommentInput));
     }
-    if(m_VoteStyleIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteStyle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("voteStyle")), m_VoteStyle));
     }
-    if(m_WidgetQuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("widgetQuestionId")), m_WidgetQuestionId));
     }
-    if(m_WidgetQuestionResultsStyleIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionResultsStyle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("widgetQuestionResultsStyle")), m_WidgetQuestionResultsStyle));
     }
-    if(m_WidgetQuestionShowBreakdownIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionShowBreakdown))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("widgetQuestionShowBreakdown")), m_WidgetQuestionShowBreakdown));
     }
-    if(m_WidgetQuestionStyleIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionStyle))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("widgetQuestionStyle")), m_WidgetQuestionStyle));
     }
-    if(m_WidgetQuestionWhenToSaveIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionWhenToSave))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("widgetQuestionWhenToSave")), m_WidgetQuestionWhenToSave));
     }
-    if(m_WidgetQuestionsRequiredIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetQuestionsRequired))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("widgetQuestionsRequired")), m_WidgetQuestionsRequired));
     }
-    if(m_WidgetSubQuestionVisibilityIsSet)
+    if(m_FieldsSet.test(FieldBit_WidgetSubQuestionVisibility))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("widgetSubQuestionVisibility")), m_WidgetSubQuestionVisibility));
     }
-    if(m_WrapIsSet)
+    if(m_FieldsSet.test(FieldBit_Wrap))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wrap")), m_Wrap));
     }
-    if(m_UsersListLocationIsSet)
+    if(m_FieldsSet.test(FieldBit_UsersListLocation))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("usersListLocation")), m_UsersListLocation));
     }
-    if(m_UsersListIncludeOfflineIsSet)
+    if(m_FieldsSet.test(FieldBit_UsersListIncludeOffline))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("usersListIncludeOffline")), m_UsersListIncludeOffline));
     }
-    if(m_TicketBaseUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketBaseUrl))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ticketBaseUrl")), m_TicketBaseUrl));
     }
-    if(m_TicketKBSearchEndpointIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketKBSearchEndpoint))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ticketKBSearchEndpoint")), m_TicketKBSearchEndpoint));
     }
-    if(m_TicketFileUploadsEnabledIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketFileUploadsEnabled))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ticketFileUploadsEnabled")), m_TicketFileUploadsEnabled));
     }
-    if(m_TicketMaxFileSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketMaxFileSize))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ticketMaxFileSize")), m_TicketMaxFileSize));
     }
-    if(m_TicketAutoAssignUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_TicketAutoAssignUserIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ticketAutoAssignUserIds")), m_TicketAutoAssignUserIds));
     }
-    if(m_TosIsSet)
+    if(m_FieldsSet.test(FieldBit_Tos))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tos")), m_Tos));
     }
@@ -2488,17 +4483,17 @@ bool CustomConfigParameters::isAbsoluteAndRelativeDates() const
 void CustomConfigParameters::setAbsoluteAndRelativeDates(bool value)
 {
     m_AbsoluteAndRelativeDates = value;
-    m_AbsoluteAndRelativeDatesIsSet = true;
+    m_FieldsSet.set(FieldBit_AbsoluteAndRelativeDates);
 }
 
 bool CustomConfigParameters::absoluteAndRelativeDatesIsSet() const
 {
-    return m_AbsoluteAndRelativeDatesIsSet;
+    return m_FieldsSet.test(FieldBit_AbsoluteAndRelativeDates);
 }
 
 void CustomConfigParameters::unsetAbsoluteAndRelativeDates()
 {
-    m_AbsoluteAndRelativeDatesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AbsoluteAndRelativeDates);
 }
 bool CustomConfigParameters::isAbsoluteDates() const
 {
@@ -2508,17 +4503,17 @@ bool CustomConfigParameters::isAbsoluteDates() const
 void CustomConfigParameters::setAbsoluteDates(bool value)
 {
     m_AbsoluteDates = value;
-    m_AbsoluteDatesIsSet = true;
+    m_FieldsSet.set(FieldBit_AbsoluteDates);
 }
 
 bool CustomConfigParameters::absoluteDatesIsSet() const
 {
-    return m_AbsoluteDatesIsSet;
+    return m_FieldsSet.test(FieldBit_AbsoluteDates);
 }
 
 void CustomConfigParameters::unsetAbsoluteDates()
 {
-    m_AbsoluteDatesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AbsoluteDates);
 }
 bool CustomConfigParameters::isAllowAnon() const
 {
@@ -2528,17 +4523,17 @@ bool CustomConfigParameters::isAllowAnon() const
 void CustomConfigParameters::setAllowAnon(bool value)
 {
     m_AllowAnon = value;
-    m_AllowAnonIsSet = true;
+    m_FieldsSet.set(FieldBit_AllowAnon);
 }
 
 bool CustomConfigParameters::allowAnonIsSet() const
 {
-    return m_AllowAnonIsSet;
+    return m_FieldsSet.test(FieldBit_AllowAnon);
 }
 
 void CustomConfigParameters::unsetAllowAnon()
 {
-    m_AllowAnonIsSet = false;
+    m_FieldsSet.reset(FieldBit_AllowAnon);
 }
 bool CustomConfigParameters::isAllowAnonFlag() const
 {
@@ -2548,17 +4543,17 @@ bool CustomConfigParameters::isAllowAnonFlag() const
 void CustomConfigParameters::setAllowAnonFlag(bool value)
 {
     m_AllowAnonFlag = value;
-    m_AllowAnonFlagIsSet = true;
+    m_FieldsSet.set(FieldBit_AllowAnonFlag);
 }
 
 bool CustomConfigParameters::allowAnonFlagIsSet() const
 {
-    return m_AllowAnonFlagIsSet;
+    return m_FieldsSet.test(FieldBit_AllowAnonFlag);
 }
 
 void CustomConfigParameters::unsetAllowAnonFlag()
 {
-    m_AllowAnonFlagIsSet = false;
+    m_FieldsSet.reset(FieldBit_AllowAnonFlag);
 }
 bool CustomConfigParameters::isAllowAnonVotes() const
 {
@@ -2568,37 +4563,38 @@ bool CustomConfigParameters::isAllowAnonVotes() const
 void CustomConfigParameters::setAllowAnonVotes(bool value)
 {
     m_AllowAnonVotes = value;
-    m_AllowAnonVotesIsSet = true;
+    m_FieldsSet.set(FieldBit_AllowAnonVotes);
 }
 
 bool CustomConfigParameters::allowAnonVotesIsSet() const
 {
-    return m_AllowAnonVotesIsSet;
+    return m_FieldsSet.test(FieldBit_AllowAnonVotes);
 }
 
 void CustomConfigParameters::unsetAllowAnonVotes()
 {
-    m_AllowAnonVotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AllowAnonVotes);
 }
 std::vector<utility::string_t> CustomConfigParameters::getAllowedLanguages() const
 {
-    return m_AllowedLanguages.get();
+    return m_AllowedLanguages;
 }
 
 
 void CustomConfigParameters::setAllowedLanguages(const std::vector<utility::string_t>& value)
 {
     m_AllowedLanguages = value;
+    m_FieldsSet.set(FieldBit_AllowedLanguages);
 }
 
 bool CustomConfigParameters::allowedLanguagesIsSet() const
 {
-    return m_AllowedLanguages.has_value();
+    return m_FieldsSet.test(FieldBit_AllowedLanguages);
 }
 
 void CustomConfigParameters::unsetAllowedLanguages()
 {
-    m_AllowedLanguages.reset();
+    m_FieldsSet.reset(FieldBit_AllowedLanguages);
 }
 bool CustomConfigParameters::isCollapseReplies() const
 {
@@ -2608,37 +4604,38 @@ bool CustomConfigParameters::isCollapseReplies() const
 void CustomConfigParameters::setCollapseReplies(bool value)
 {
     m_CollapseReplies = value;
-    m_CollapseRepliesIsSet = true;
+    m_FieldsSet.set(FieldBit_CollapseReplies);
 }
 
 bool CustomConfigParameters::collapseRepliesIsSet() const
 {
-    return m_CollapseRepliesIsSet;
+    return m_FieldsSet.test(FieldBit_CollapseReplies);
 }
 
 void CustomConfigParameters::unsetCollapseReplies()
 {
-    m_CollapseRepliesIsSet = false;
+    m_FieldsSet.reset(FieldBit_CollapseReplies);
 }
 utility::string_t CustomConfigParameters::getCommentCountFormat() const
 {
-    return m_CommentCountFormat.get();
+    return m_CommentCountFormat;
 }
 
 
 void CustomConfigParameters::setCommentCountFormat(const utility::string_t& value)
 {
     m_CommentCountFormat = value;
+    m_FieldsSet.set(FieldBit_CommentCountFormat);
 }
 
 bool CustomConfigParameters::commentCountFormatIsSet() const
 {
-    return m_CommentCountFormat.has_value();
+    return m_FieldsSet.test(FieldBit_CommentCountFormat);
 }
 
 void CustomConfigParameters::unsetCommentCountFormat()
 {
-    m_CommentCountFormat.reset();
+    m_FieldsSet.reset(FieldBit_CommentCountFormat);
 }
 std::shared_ptr<CommentHTMLRenderingMode> CustomConfigParameters::getCommentHTMLRenderingMode() const
 {
@@ -2649,57 +4646,59 @@ std::shared_ptr<CommentHTMLRenderingMode> CustomConfigParameters::getCommentHTML
 void CustomConfigParameters::setCommentHTMLRenderingMode(const std::shared_ptr<CommentHTMLRenderingMode>& value)
 {
     m_CommentHTMLRenderingMode = value;
-    m_CommentHTMLRenderingModeIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentHTMLRenderingMode);
 }
 
 bool CustomConfigParameters::commentHTMLRenderingModeIsSet() const
 {
-    return m_CommentHTMLRenderingModeIsSet;
+    return m_FieldsSet.test(FieldBit_CommentHTMLRenderingMode);
 }
 
 void CustomConfigParameters::unsetCommentHTMLRenderingMode()
 {
-    m_CommentHTMLRenderingModeIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentHTMLRenderingMode);
 }
 std::shared_ptr<CommentThreadDeletionMode> CustomConfigParameters::getCommentThreadDeleteMode() const
 {
-    return m_CommentThreadDeleteMode.get();
+    return m_CommentThreadDeleteMode;
 }
 
 
 void CustomConfigParameters::setCommentThreadDeleteMode(const std::shared_ptr<CommentThreadDeletionMode>& value)
 {
     m_CommentThreadDeleteMode = value;
+    m_FieldsSet.set(FieldBit_CommentThreadDeleteMode);
 }
 
 bool CustomConfigParameters::commentThreadDeleteModeIsSet() const
 {
-    return m_CommentThreadDeleteMode.has_value();
+    return m_FieldsSet.test(FieldBit_CommentThreadDeleteMode);
 }
 
 void CustomConfigParameters::unsetCommentThreadDeleteMode()
 {
-    m_CommentThreadDeleteMode.reset();
+    m_FieldsSet.reset(FieldBit_CommentThreadDeleteMode);
 }
 std::shared_ptr<CommenterNameFormats> CustomConfigParameters::getCommenterNameFormat() const
 {
-    return m_CommenterNameFormat.get();
+    return m_CommenterNameFormat;
 }
 
 
 void CustomConfigParameters::setCommenterNameFormat(const std::shared_ptr<CommenterNameFormats>& value)
 {
     m_CommenterNameFormat = value;
+    m_FieldsSet.set(FieldBit_CommenterNameFormat);
 }
 
 bool CustomConfigParameters::commenterNameFormatIsSet() const
 {
-    return m_CommenterNameFormat.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterNameFormat);
 }
 
 void CustomConfigParameters::unsetCommenterNameFormat()
 {
-    m_CommenterNameFormat.reset();
+    m_FieldsSet.reset(FieldBit_CommenterNameFormat);
 }
 int32_t CustomConfigParameters::getCountAboveToggle() const
 {
@@ -2709,97 +4708,101 @@ int32_t CustomConfigParameters::getCountAboveToggle() const
 void CustomConfigParameters::setCountAboveToggle(int32_t value)
 {
     m_CountAboveToggle = value;
-    m_CountAboveToggleIsSet = true;
+    m_FieldsSet.set(FieldBit_CountAboveToggle);
 }
 
 bool CustomConfigParameters::countAboveToggleIsSet() const
 {
-    return m_CountAboveToggleIsSet;
+    return m_FieldsSet.test(FieldBit_CountAboveToggle);
 }
 
 void CustomConfigParameters::unsetCountAboveToggle()
 {
-    m_CountAboveToggleIsSet = false;
+    m_FieldsSet.reset(FieldBit_CountAboveToggle);
 }
 utility::string_t CustomConfigParameters::getCustomCSS() const
 {
-    return m_CustomCSS.get();
+    return m_CustomCSS;
 }
 
 
 void CustomConfigParameters::setCustomCSS(const utility::string_t& value)
 {
     m_CustomCSS = value;
+    m_FieldsSet.set(FieldBit_CustomCSS);
 }
 
 bool CustomConfigParameters::customCSSIsSet() const
 {
-    return m_CustomCSS.has_value();
+    return m_FieldsSet.test(FieldBit_CustomCSS);
 }
 
 void CustomConfigParameters::unsetCustomCSS()
 {
-    m_CustomCSS.reset();
+    m_FieldsSet.reset(FieldBit_CustomCSS);
 }
 utility::string_t CustomConfigParameters::getDefaultAvatarSrc() const
 {
-    return m_DefaultAvatarSrc.get();
+    return m_DefaultAvatarSrc;
 }
 
 
 void CustomConfigParameters::setDefaultAvatarSrc(const utility::string_t& value)
 {
     m_DefaultAvatarSrc = value;
+    m_FieldsSet.set(FieldBit_DefaultAvatarSrc);
 }
 
 bool CustomConfigParameters::defaultAvatarSrcIsSet() const
 {
-    return m_DefaultAvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_DefaultAvatarSrc);
 }
 
 void CustomConfigParameters::unsetDefaultAvatarSrc()
 {
-    m_DefaultAvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_DefaultAvatarSrc);
 }
 std::shared_ptr<SortDirections> CustomConfigParameters::getDefaultSortDirection() const
 {
-    return m_DefaultSortDirection.get();
+    return m_DefaultSortDirection;
 }
 
 
 void CustomConfigParameters::setDefaultSortDirection(const std::shared_ptr<SortDirections>& value)
 {
     m_DefaultSortDirection = value;
+    m_FieldsSet.set(FieldBit_DefaultSortDirection);
 }
 
 bool CustomConfigParameters::defaultSortDirectionIsSet() const
 {
-    return m_DefaultSortDirection.has_value();
+    return m_FieldsSet.test(FieldBit_DefaultSortDirection);
 }
 
 void CustomConfigParameters::unsetDefaultSortDirection()
 {
-    m_DefaultSortDirection.reset();
+    m_FieldsSet.reset(FieldBit_DefaultSortDirection);
 }
 utility::string_t CustomConfigParameters::getDefaultUsername() const
 {
-    return m_DefaultUsername.get();
+    return m_DefaultUsername;
 }
 
 
 void CustomConfigParameters::setDefaultUsername(const utility::string_t& value)
 {
     m_DefaultUsername = value;
+    m_FieldsSet.set(FieldBit_DefaultUsername);
 }
 
 bool CustomConfigParameters::defaultUsernameIsSet() const
 {
-    return m_DefaultUsername.has_value();
+    return m_FieldsSet.test(FieldBit_DefaultUsername);
 }
 
 void CustomConfigParameters::unsetDefaultUsername()
 {
-    m_DefaultUsername.reset();
+    m_FieldsSet.reset(FieldBit_DefaultUsername);
 }
 bool CustomConfigParameters::isDisableAutoAdminMigration() const
 {
@@ -2809,17 +4812,17 @@ bool CustomConfigParameters::isDisableAutoAdminMigration() const
 void CustomConfigParameters::setDisableAutoAdminMigration(bool value)
 {
     m_DisableAutoAdminMigration = value;
-    m_DisableAutoAdminMigrationIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableAutoAdminMigration);
 }
 
 bool CustomConfigParameters::disableAutoAdminMigrationIsSet() const
 {
-    return m_DisableAutoAdminMigrationIsSet;
+    return m_FieldsSet.test(FieldBit_DisableAutoAdminMigration);
 }
 
 void CustomConfigParameters::unsetDisableAutoAdminMigration()
 {
-    m_DisableAutoAdminMigrationIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableAutoAdminMigration);
 }
 bool CustomConfigParameters::isDisableAutoHashTagCreation() const
 {
@@ -2829,17 +4832,17 @@ bool CustomConfigParameters::isDisableAutoHashTagCreation() const
 void CustomConfigParameters::setDisableAutoHashTagCreation(bool value)
 {
     m_DisableAutoHashTagCreation = value;
-    m_DisableAutoHashTagCreationIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableAutoHashTagCreation);
 }
 
 bool CustomConfigParameters::disableAutoHashTagCreationIsSet() const
 {
-    return m_DisableAutoHashTagCreationIsSet;
+    return m_FieldsSet.test(FieldBit_DisableAutoHashTagCreation);
 }
 
 void CustomConfigParameters::unsetDisableAutoHashTagCreation()
 {
-    m_DisableAutoHashTagCreationIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableAutoHashTagCreation);
 }
 bool CustomConfigParameters::isDisableBlocking() const
 {
@@ -2849,17 +4852,17 @@ bool CustomConfigParameters::isDisableBlocking() const
 void CustomConfigParameters::setDisableBlocking(bool value)
 {
     m_DisableBlocking = value;
-    m_DisableBlockingIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableBlocking);
 }
 
 bool CustomConfigParameters::disableBlockingIsSet() const
 {
-    return m_DisableBlockingIsSet;
+    return m_FieldsSet.test(FieldBit_DisableBlocking);
 }
 
 void CustomConfigParameters::unsetDisableBlocking()
 {
-    m_DisableBlockingIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableBlocking);
 }
 bool CustomConfigParameters::isDisableCommenterCommentDelete() const
 {
@@ -2869,17 +4872,17 @@ bool CustomConfigParameters::isDisableCommenterCommentDelete() const
 void CustomConfigParameters::setDisableCommenterCommentDelete(bool value)
 {
     m_DisableCommenterCommentDelete = value;
-    m_DisableCommenterCommentDeleteIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableCommenterCommentDelete);
 }
 
 bool CustomConfigParameters::disableCommenterCommentDeleteIsSet() const
 {
-    return m_DisableCommenterCommentDeleteIsSet;
+    return m_FieldsSet.test(FieldBit_DisableCommenterCommentDelete);
 }
 
 void CustomConfigParameters::unsetDisableCommenterCommentDelete()
 {
-    m_DisableCommenterCommentDeleteIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableCommenterCommentDelete);
 }
 bool CustomConfigParameters::isDisableCommenterCommentEdit() const
 {
@@ -2889,17 +4892,17 @@ bool CustomConfigParameters::isDisableCommenterCommentEdit() const
 void CustomConfigParameters::setDisableCommenterCommentEdit(bool value)
 {
     m_DisableCommenterCommentEdit = value;
-    m_DisableCommenterCommentEditIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableCommenterCommentEdit);
 }
 
 bool CustomConfigParameters::disableCommenterCommentEditIsSet() const
 {
-    return m_DisableCommenterCommentEditIsSet;
+    return m_FieldsSet.test(FieldBit_DisableCommenterCommentEdit);
 }
 
 void CustomConfigParameters::unsetDisableCommenterCommentEdit()
 {
-    m_DisableCommenterCommentEditIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableCommenterCommentEdit);
 }
 bool CustomConfigParameters::isDisableEmailInputs() const
 {
@@ -2909,17 +4912,17 @@ bool CustomConfigParameters::isDisableEmailInputs() const
 void CustomConfigParameters::setDisableEmailInputs(bool value)
 {
     m_DisableEmailInputs = value;
-    m_DisableEmailInputsIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableEmailInputs);
 }
 
 bool CustomConfigParameters::disableEmailInputsIsSet() const
 {
-    return m_DisableEmailInputsIsSet;
+    return m_FieldsSet.test(FieldBit_DisableEmailInputs);
 }
 
 void CustomConfigParameters::unsetDisableEmailInputs()
 {
-    m_DisableEmailInputsIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableEmailInputs);
 }
 bool CustomConfigParameters::isDisableLiveCommenting() const
 {
@@ -2929,17 +4932,17 @@ bool CustomConfigParameters::isDisableLiveCommenting() const
 void CustomConfigParameters::setDisableLiveCommenting(bool value)
 {
     m_DisableLiveCommenting = value;
-    m_DisableLiveCommentingIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableLiveCommenting);
 }
 
 bool CustomConfigParameters::disableLiveCommentingIsSet() const
 {
-    return m_DisableLiveCommentingIsSet;
+    return m_FieldsSet.test(FieldBit_DisableLiveCommenting);
 }
 
 void CustomConfigParameters::unsetDisableLiveCommenting()
 {
-    m_DisableLiveCommentingIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableLiveCommenting);
 }
 bool CustomConfigParameters::isDisableNotificationBell() const
 {
@@ -2949,17 +4952,17 @@ bool CustomConfigParameters::isDisableNotificationBell() const
 void CustomConfigParameters::setDisableNotificationBell(bool value)
 {
     m_DisableNotificationBell = value;
-    m_DisableNotificationBellIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableNotificationBell);
 }
 
 bool CustomConfigParameters::disableNotificationBellIsSet() const
 {
-    return m_DisableNotificationBellIsSet;
+    return m_FieldsSet.test(FieldBit_DisableNotificationBell);
 }
 
 void CustomConfigParameters::unsetDisableNotificationBell()
 {
-    m_DisableNotificationBellIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableNotificationBell);
 }
 bool CustomConfigParameters::isDisableProfileComments() const
 {
@@ -2969,17 +4972,17 @@ bool CustomConfigParameters::isDisableProfileComments() const
 void CustomConfigParameters::setDisableProfileComments(bool value)
 {
     m_DisableProfileComments = value;
-    m_DisableProfileCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableProfileComments);
 }
 
 bool CustomConfigParameters::disableProfileCommentsIsSet() const
 {
-    return m_DisableProfileCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_DisableProfileComments);
 }
 
 void CustomConfigParameters::unsetDisableProfileComments()
 {
-    m_DisableProfileCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableProfileComments);
 }
 bool CustomConfigParameters::isDisableProfileDirectMessages() const
 {
@@ -2989,17 +4992,17 @@ bool CustomConfigParameters::isDisableProfileDirectMessages() const
 void CustomConfigParameters::setDisableProfileDirectMessages(bool value)
 {
     m_DisableProfileDirectMessages = value;
-    m_DisableProfileDirectMessagesIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableProfileDirectMessages);
 }
 
 bool CustomConfigParameters::disableProfileDirectMessagesIsSet() const
 {
-    return m_DisableProfileDirectMessagesIsSet;
+    return m_FieldsSet.test(FieldBit_DisableProfileDirectMessages);
 }
 
 void CustomConfigParameters::unsetDisableProfileDirectMessages()
 {
-    m_DisableProfileDirectMessagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableProfileDirectMessages);
 }
 bool CustomConfigParameters::isDisableProfiles() const
 {
@@ -3009,17 +5012,17 @@ bool CustomConfigParameters::isDisableProfiles() const
 void CustomConfigParameters::setDisableProfiles(bool value)
 {
     m_DisableProfiles = value;
-    m_DisableProfilesIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableProfiles);
 }
 
 bool CustomConfigParameters::disableProfilesIsSet() const
 {
-    return m_DisableProfilesIsSet;
+    return m_FieldsSet.test(FieldBit_DisableProfiles);
 }
 
 void CustomConfigParameters::unsetDisableProfiles()
 {
-    m_DisableProfilesIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableProfiles);
 }
 bool CustomConfigParameters::isDisableSuccessMessage() const
 {
@@ -3029,17 +5032,17 @@ bool CustomConfigParameters::isDisableSuccessMessage() const
 void CustomConfigParameters::setDisableSuccessMessage(bool value)
 {
     m_DisableSuccessMessage = value;
-    m_DisableSuccessMessageIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableSuccessMessage);
 }
 
 bool CustomConfigParameters::disableSuccessMessageIsSet() const
 {
-    return m_DisableSuccessMessageIsSet;
+    return m_FieldsSet.test(FieldBit_DisableSuccessMessage);
 }
 
 void CustomConfigParameters::unsetDisableSuccessMessage()
 {
-    m_DisableSuccessMessageIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableSuccessMessage);
 }
 bool CustomConfigParameters::isDisableToolbar() const
 {
@@ -3049,17 +5052,17 @@ bool CustomConfigParameters::isDisableToolbar() const
 void CustomConfigParameters::setDisableToolbar(bool value)
 {
     m_DisableToolbar = value;
-    m_DisableToolbarIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableToolbar);
 }
 
 bool CustomConfigParameters::disableToolbarIsSet() const
 {
-    return m_DisableToolbarIsSet;
+    return m_FieldsSet.test(FieldBit_DisableToolbar);
 }
 
 void CustomConfigParameters::unsetDisableToolbar()
 {
-    m_DisableToolbarIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableToolbar);
 }
 bool CustomConfigParameters::isDisableUnverifiedLabel() const
 {
@@ -3069,17 +5072,17 @@ bool CustomConfigParameters::isDisableUnverifiedLabel() const
 void CustomConfigParameters::setDisableUnverifiedLabel(bool value)
 {
     m_DisableUnverifiedLabel = value;
-    m_DisableUnverifiedLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableUnverifiedLabel);
 }
 
 bool CustomConfigParameters::disableUnverifiedLabelIsSet() const
 {
-    return m_DisableUnverifiedLabelIsSet;
+    return m_FieldsSet.test(FieldBit_DisableUnverifiedLabel);
 }
 
 void CustomConfigParameters::unsetDisableUnverifiedLabel()
 {
-    m_DisableUnverifiedLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableUnverifiedLabel);
 }
 bool CustomConfigParameters::isDisableVoting() const
 {
@@ -3089,17 +5092,17 @@ bool CustomConfigParameters::isDisableVoting() const
 void CustomConfigParameters::setDisableVoting(bool value)
 {
     m_DisableVoting = value;
-    m_DisableVotingIsSet = true;
+    m_FieldsSet.set(FieldBit_DisableVoting);
 }
 
 bool CustomConfigParameters::disableVotingIsSet() const
 {
-    return m_DisableVotingIsSet;
+    return m_FieldsSet.test(FieldBit_DisableVoting);
 }
 
 void CustomConfigParameters::unsetDisableVoting()
 {
-    m_DisableVotingIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisableVoting);
 }
 bool CustomConfigParameters::isEnableCommenterLinks() const
 {
@@ -3109,17 +5112,17 @@ bool CustomConfigParameters::isEnableCommenterLinks() const
 void CustomConfigParameters::setEnableCommenterLinks(bool value)
 {
     m_EnableCommenterLinks = value;
-    m_EnableCommenterLinksIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableCommenterLinks);
 }
 
 bool CustomConfigParameters::enableCommenterLinksIsSet() const
 {
-    return m_EnableCommenterLinksIsSet;
+    return m_FieldsSet.test(FieldBit_EnableCommenterLinks);
 }
 
 void CustomConfigParameters::unsetEnableCommenterLinks()
 {
-    m_EnableCommenterLinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableCommenterLinks);
 }
 bool CustomConfigParameters::isEnableSearch() const
 {
@@ -3129,17 +5132,17 @@ bool CustomConfigParameters::isEnableSearch() const
 void CustomConfigParameters::setEnableSearch(bool value)
 {
     m_EnableSearch = value;
-    m_EnableSearchIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableSearch);
 }
 
 bool CustomConfigParameters::enableSearchIsSet() const
 {
-    return m_EnableSearchIsSet;
+    return m_FieldsSet.test(FieldBit_EnableSearch);
 }
 
 void CustomConfigParameters::unsetEnableSearch()
 {
-    m_EnableSearchIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableSearch);
 }
 bool CustomConfigParameters::isEnableSpoilers() const
 {
@@ -3149,17 +5152,17 @@ bool CustomConfigParameters::isEnableSpoilers() const
 void CustomConfigParameters::setEnableSpoilers(bool value)
 {
     m_EnableSpoilers = value;
-    m_EnableSpoilersIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableSpoilers);
 }
 
 bool CustomConfigParameters::enableSpoilersIsSet() const
 {
-    return m_EnableSpoilersIsSet;
+    return m_FieldsSet.test(FieldBit_EnableSpoilers);
 }
 
 void CustomConfigParameters::unsetEnableSpoilers()
 {
-    m_EnableSpoilersIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableSpoilers);
 }
 bool CustomConfigParameters::isEnableThirdPartyCookieBypass() const
 {
@@ -3169,17 +5172,17 @@ bool CustomConfigParameters::isEnableThirdPartyCookieBypass() const
 void CustomConfigParameters::setEnableThirdPartyCookieBypass(bool value)
 {
     m_EnableThirdPartyCookieBypass = value;
-    m_EnableThirdPartyCookieBypassIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableThirdPartyCookieBypass);
 }
 
 bool CustomConfigParameters::enableThirdPartyCookieBypassIsSet() const
 {
-    return m_EnableThirdPartyCookieBypassIsSet;
+    return m_FieldsSet.test(FieldBit_EnableThirdPartyCookieBypass);
 }
 
 void CustomConfigParameters::unsetEnableThirdPartyCookieBypass()
 {
-    m_EnableThirdPartyCookieBypassIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableThirdPartyCookieBypass);
 }
 bool CustomConfigParameters::isEnableViewCounts() const
 {
@@ -3189,17 +5192,17 @@ bool CustomConfigParameters::isEnableViewCounts() const
 void CustomConfigParameters::setEnableViewCounts(bool value)
 {
     m_EnableViewCounts = value;
-    m_EnableViewCountsIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableViewCounts);
 }
 
 bool CustomConfigParameters::enableViewCountsIsSet() const
 {
-    return m_EnableViewCountsIsSet;
+    return m_FieldsSet.test(FieldBit_EnableViewCounts);
 }
 
 void CustomConfigParameters::unsetEnableViewCounts()
 {
-    m_EnableViewCountsIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableViewCounts);
 }
 bool CustomConfigParameters::isEnableVoteList() const
 {
@@ -3209,17 +5212,17 @@ bool CustomConfigParameters::isEnableVoteList() const
 void CustomConfigParameters::setEnableVoteList(bool value)
 {
     m_EnableVoteList = value;
-    m_EnableVoteListIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableVoteList);
 }
 
 bool CustomConfigParameters::enableVoteListIsSet() const
 {
-    return m_EnableVoteListIsSet;
+    return m_FieldsSet.test(FieldBit_EnableVoteList);
 }
 
 void CustomConfigParameters::unsetEnableVoteList()
 {
-    m_EnableVoteListIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableVoteList);
 }
 bool CustomConfigParameters::isEnableWYSIWYG() const
 {
@@ -3229,17 +5232,17 @@ bool CustomConfigParameters::isEnableWYSIWYG() const
 void CustomConfigParameters::setEnableWYSIWYG(bool value)
 {
     m_EnableWYSIWYG = value;
-    m_EnableWYSIWYGIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableWYSIWYG);
 }
 
 bool CustomConfigParameters::enableWYSIWYGIsSet() const
 {
-    return m_EnableWYSIWYGIsSet;
+    return m_FieldsSet.test(FieldBit_EnableWYSIWYG);
 }
 
 void CustomConfigParameters::unsetEnableWYSIWYG()
 {
-    m_EnableWYSIWYGIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableWYSIWYG);
 }
 std::shared_ptr<GifRating> CustomConfigParameters::getGifRating() const
 {
@@ -3250,17 +5253,17 @@ std::shared_ptr<GifRating> CustomConfigParameters::getGifRating() const
 void CustomConfigParameters::setGifRating(const std::shared_ptr<GifRating>& value)
 {
     m_GifRating = value;
-    m_GifRatingIsSet = true;
+    m_FieldsSet.set(FieldBit_GifRating);
 }
 
 bool CustomConfigParameters::gifRatingIsSet() const
 {
-    return m_GifRatingIsSet;
+    return m_FieldsSet.test(FieldBit_GifRating);
 }
 
 void CustomConfigParameters::unsetGifRating()
 {
-    m_GifRatingIsSet = false;
+    m_FieldsSet.reset(FieldBit_GifRating);
 }
 bool CustomConfigParameters::isHasDarkBackground() const
 {
@@ -3270,37 +5273,38 @@ bool CustomConfigParameters::isHasDarkBackground() const
 void CustomConfigParameters::setHasDarkBackground(bool value)
 {
     m_HasDarkBackground = value;
-    m_HasDarkBackgroundIsSet = true;
+    m_FieldsSet.set(FieldBit_HasDarkBackground);
 }
 
 bool CustomConfigParameters::hasDarkBackgroundIsSet() const
 {
-    return m_HasDarkBackgroundIsSet;
+    return m_FieldsSet.test(FieldBit_HasDarkBackground);
 }
 
 void CustomConfigParameters::unsetHasDarkBackground()
 {
-    m_HasDarkBackgroundIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasDarkBackground);
 }
 utility::string_t CustomConfigParameters::getHeaderHTML() const
 {
-    return m_HeaderHTML.get();
+    return m_HeaderHTML;
 }
 
 
 void CustomConfigParameters::setHeaderHTML(const utility::string_t& value)
 {
     m_HeaderHTML = value;
+    m_FieldsSet.set(FieldBit_HeaderHTML);
 }
 
 bool CustomConfigParameters::headerHTMLIsSet() const
 {
-    return m_HeaderHTML.has_value();
+    return m_FieldsSet.test(FieldBit_HeaderHTML);
 }
 
 void CustomConfigParameters::unsetHeaderHTML()
 {
-    m_HeaderHTML.reset();
+    m_FieldsSet.reset(FieldBit_HeaderHTML);
 }
 bool CustomConfigParameters::isHideAvatars() const
 {
@@ -3310,37 +5314,38 @@ bool CustomConfigParameters::isHideAvatars() const
 void CustomConfigParameters::setHideAvatars(bool value)
 {
     m_HideAvatars = value;
-    m_HideAvatarsIsSet = true;
+    m_FieldsSet.set(FieldBit_HideAvatars);
 }
 
 bool CustomConfigParameters::hideAvatarsIsSet() const
 {
-    return m_HideAvatarsIsSet;
+    return m_FieldsSet.test(FieldBit_HideAvatars);
 }
 
 void CustomConfigParameters::unsetHideAvatars()
 {
-    m_HideAvatarsIsSet = false;
+    m_FieldsSet.reset(FieldBit_HideAvatars);
 }
 utility::string_t CustomConfigParameters::getHideCommentsUnderCountTextFormat() const
 {
-    return m_HideCommentsUnderCountTextFormat.get();
+    return m_HideCommentsUnderCountTextFormat;
 }
 
 
 void CustomConfigParameters::setHideCommentsUnderCountTextFormat(const utility::string_t& value)
 {
     m_HideCommentsUnderCountTextFormat = value;
+    m_FieldsSet.set(FieldBit_HideCommentsUnderCountTextFormat);
 }
 
 bool CustomConfigParameters::hideCommentsUnderCountTextFormatIsSet() const
 {
-    return m_HideCommentsUnderCountTextFormat.has_value();
+    return m_FieldsSet.test(FieldBit_HideCommentsUnderCountTextFormat);
 }
 
 void CustomConfigParameters::unsetHideCommentsUnderCountTextFormat()
 {
-    m_HideCommentsUnderCountTextFormat.reset();
+    m_FieldsSet.reset(FieldBit_HideCommentsUnderCountTextFormat);
 }
 std::shared_ptr<ImageContentProfanityLevel> CustomConfigParameters::getImageContentProfanityLevel() const
 {
@@ -3351,17 +5356,17 @@ std::shared_ptr<ImageContentProfanityLevel> CustomConfigParameters::getImageCont
 void CustomConfigParameters::setImageContentProfanityLevel(const std::shared_ptr<ImageContentProfanityLevel>& value)
 {
     m_ImageContentProfanityLevel = value;
-    m_ImageContentProfanityLevelIsSet = true;
+    m_FieldsSet.set(FieldBit_ImageContentProfanityLevel);
 }
 
 bool CustomConfigParameters::imageContentProfanityLevelIsSet() const
 {
-    return m_ImageContentProfanityLevelIsSet;
+    return m_FieldsSet.test(FieldBit_ImageContentProfanityLevel);
 }
 
 void CustomConfigParameters::unsetImageContentProfanityLevel()
 {
-    m_ImageContentProfanityLevelIsSet = false;
+    m_FieldsSet.reset(FieldBit_ImageContentProfanityLevel);
 }
 bool CustomConfigParameters::isInputAfterComments() const
 {
@@ -3371,17 +5376,17 @@ bool CustomConfigParameters::isInputAfterComments() const
 void CustomConfigParameters::setInputAfterComments(bool value)
 {
     m_InputAfterComments = value;
-    m_InputAfterCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_InputAfterComments);
 }
 
 bool CustomConfigParameters::inputAfterCommentsIsSet() const
 {
-    return m_InputAfterCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_InputAfterComments);
 }
 
 void CustomConfigParameters::unsetInputAfterComments()
 {
-    m_InputAfterCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_InputAfterComments);
 }
 bool CustomConfigParameters::isLimitCommentsByGroups() const
 {
@@ -3391,75 +5396,78 @@ bool CustomConfigParameters::isLimitCommentsByGroups() const
 void CustomConfigParameters::setLimitCommentsByGroups(bool value)
 {
     m_LimitCommentsByGroups = value;
-    m_LimitCommentsByGroupsIsSet = true;
+    m_FieldsSet.set(FieldBit_LimitCommentsByGroups);
 }
 
 bool CustomConfigParameters::limitCommentsByGroupsIsSet() const
 {
-    return m_LimitCommentsByGroupsIsSet;
+    return m_FieldsSet.test(FieldBit_LimitCommentsByGroups);
 }
 
 void CustomConfigParameters::unsetLimitCommentsByGroups()
 {
-    m_LimitCommentsByGroupsIsSet = false;
+    m_FieldsSet.reset(FieldBit_LimitCommentsByGroups);
 }
 utility::string_t CustomConfigParameters::getLocale() const
 {
-    return m_Locale.get();
+    return m_Locale;
 }
 
 
 void CustomConfigParameters::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool CustomConfigParameters::localeIsSet() const
 {
-    return m_Locale.has_value();
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void CustomConfigParameters::unsetLocale()
 {
-    m_Locale.reset();
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 int32_t CustomConfigParameters::getMaxCommentCharacterLength() const
 {
-    return m_MaxCommentCharacterLength.get();
+    return m_MaxCommentCharacterLength;
 }
 
 void CustomConfigParameters::setMaxCommentCharacterLength(int32_t value)
 {
     m_MaxCommentCharacterLength = value;
+    m_FieldsSet.set(FieldBit_MaxCommentCharacterLength);
 }
 
 bool CustomConfigParameters::maxCommentCharacterLengthIsSet() const
 {
-    return m_MaxCommentCharacterLength.has_value();
+    return m_FieldsSet.test(FieldBit_MaxCommentCharacterLength);
 }
 
 void CustomConfigParameters::unsetMaxCommentCharacterLength()
 {
-    m_MaxCommentCharacterLength.reset();
+    m_FieldsSet.reset(FieldBit_MaxCommentCharacterLength);
 }
 int32_t CustomConfigParameters::getMaxCommentCreatedCountPUPM() const
 {
-    return m_MaxCommentCreatedCountPUPM.get();
+    return m_MaxCommentCreatedCountPUPM;
 }
 
 void CustomConfigParameters::setMaxCommentCreatedCountPUPM(int32_t value)
 {
     m_MaxCommentCreatedCountPUPM = value;
+    m_FieldsSet.set(FieldBit_MaxCommentCreatedCountPUPM);
 }
 
 bool CustomConfigParameters::maxCommentCreatedCountPUPMIsSet() const
 {
-    return m_MaxCommentCreatedCountPUPM.has_value();
+    return m_FieldsSet.test(FieldBit_MaxCommentCreatedCountPUPM);
 }
 
 void CustomConfigParameters::unsetMaxCommentCreatedCountPUPM()
 {
-    m_MaxCommentCreatedCountPUPM.reset();
+    m_FieldsSet.reset(FieldBit_MaxCommentCreatedCountPUPM);
 }
 bool CustomConfigParameters::isNoCustomConfig() const
 {
@@ -3469,37 +5477,38 @@ bool CustomConfigParameters::isNoCustomConfig() const
 void CustomConfigParameters::setNoCustomConfig(bool value)
 {
     m_NoCustomConfig = value;
-    m_NoCustomConfigIsSet = true;
+    m_FieldsSet.set(FieldBit_NoCustomConfig);
 }
 
 bool CustomConfigParameters::noCustomConfigIsSet() const
 {
-    return m_NoCustomConfigIsSet;
+    return m_FieldsSet.test(FieldBit_NoCustomConfig);
 }
 
 void CustomConfigParameters::unsetNoCustomConfig()
 {
-    m_NoCustomConfigIsSet = false;
+    m_FieldsSet.reset(FieldBit_NoCustomConfig);
 }
 std::shared_ptr<MentionAutoCompleteMode> CustomConfigParameters::getMentionAutoCompleteMode() const
 {
-    return m_MentionAutoCompleteMode.get();
+    return m_MentionAutoCompleteMode;
 }
 
 
 void CustomConfigParameters::setMentionAutoCompleteMode(const std::shared_ptr<MentionAutoCompleteMode>& value)
 {
     m_MentionAutoCompleteMode = value;
+    m_FieldsSet.set(FieldBit_MentionAutoCompleteMode);
 }
 
 bool CustomConfigParameters::mentionAutoCompleteModeIsSet() const
 {
-    return m_MentionAutoCompleteMode.has_value();
+    return m_FieldsSet.test(FieldBit_MentionAutoCompleteMode);
 }
 
 void CustomConfigParameters::unsetMentionAutoCompleteMode()
 {
-    m_MentionAutoCompleteMode.reset();
+    m_FieldsSet.reset(FieldBit_MentionAutoCompleteMode);
 }
 bool CustomConfigParameters::isNoImageUploads() const
 {
@@ -3509,17 +5518,17 @@ bool CustomConfigParameters::isNoImageUploads() const
 void CustomConfigParameters::setNoImageUploads(bool value)
 {
     m_NoImageUploads = value;
-    m_NoImageUploadsIsSet = true;
+    m_FieldsSet.set(FieldBit_NoImageUploads);
 }
 
 bool CustomConfigParameters::noImageUploadsIsSet() const
 {
-    return m_NoImageUploadsIsSet;
+    return m_FieldsSet.test(FieldBit_NoImageUploads);
 }
 
 void CustomConfigParameters::unsetNoImageUploads()
 {
-    m_NoImageUploadsIsSet = false;
+    m_FieldsSet.reset(FieldBit_NoImageUploads);
 }
 bool CustomConfigParameters::isAllowEmbeds() const
 {
@@ -3529,37 +5538,38 @@ bool CustomConfigParameters::isAllowEmbeds() const
 void CustomConfigParameters::setAllowEmbeds(bool value)
 {
     m_AllowEmbeds = value;
-    m_AllowEmbedsIsSet = true;
+    m_FieldsSet.set(FieldBit_AllowEmbeds);
 }
 
 bool CustomConfigParameters::allowEmbedsIsSet() const
 {
-    return m_AllowEmbedsIsSet;
+    return m_FieldsSet.test(FieldBit_AllowEmbeds);
 }
 
 void CustomConfigParameters::unsetAllowEmbeds()
 {
-    m_AllowEmbedsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AllowEmbeds);
 }
 std::vector<utility::string_t> CustomConfigParameters::getAllowedEmbedDomains() const
 {
-    return m_AllowedEmbedDomains.get();
+    return m_AllowedEmbedDomains;
 }
 
 
 void CustomConfigParameters::setAllowedEmbedDomains(const std::vector<utility::string_t>& value)
 {
     m_AllowedEmbedDomains = value;
+    m_FieldsSet.set(FieldBit_AllowedEmbedDomains);
 }
 
 bool CustomConfigParameters::allowedEmbedDomainsIsSet() const
 {
-    return m_AllowedEmbedDomains.has_value();
+    return m_FieldsSet.test(FieldBit_AllowedEmbedDomains);
 }
 
 void CustomConfigParameters::unsetAllowedEmbedDomains()
 {
-    m_AllowedEmbedDomains.reset();
+    m_FieldsSet.reset(FieldBit_AllowedEmbedDomains);
 }
 bool CustomConfigParameters::isNoStyles() const
 {
@@ -3569,36 +5579,37 @@ bool CustomConfigParameters::isNoStyles() const
 void CustomConfigParameters::setNoStyles(bool value)
 {
     m_NoStyles = value;
-    m_NoStylesIsSet = true;
+    m_FieldsSet.set(FieldBit_NoStyles);
 }
 
 bool CustomConfigParameters::noStylesIsSet() const
 {
-    return m_NoStylesIsSet;
+    return m_FieldsSet.test(FieldBit_NoStyles);
 }
 
 void CustomConfigParameters::unsetNoStyles()
 {
-    m_NoStylesIsSet = false;
+    m_FieldsSet.reset(FieldBit_NoStyles);
 }
 int32_t CustomConfigParameters::getPageSize() const
 {
-    return m_PageSize.get();
+    return m_PageSize;
 }
 
 void CustomConfigParameters::setPageSize(int32_t value)
 {
     m_PageSize = value;
+    m_FieldsSet.set(FieldBit_PageSize);
 }
 
 bool CustomConfigParameters::pageSizeIsSet() const
 {
-    return m_PageSize.has_value();
+    return m_FieldsSet.test(FieldBit_PageSize);
 }
 
 void CustomConfigParameters::unsetPageSize()
 {
-    m_PageSize.reset();
+    m_FieldsSet.reset(FieldBit_PageSize);
 }
 bool CustomConfigParameters::isReadonly() const
 {
@@ -3608,17 +5619,17 @@ bool CustomConfigParameters::isReadonly() const
 void CustomConfigParameters::setReadonly(bool value)
 {
     m_Readonly = value;
-    m_ReadonlyIsSet = true;
+    m_FieldsSet.set(FieldBit_Readonly);
 }
 
 bool CustomConfigParameters::readonlyIsSet() const
 {
-    return m_ReadonlyIsSet;
+    return m_FieldsSet.test(FieldBit_Readonly);
 }
 
 void CustomConfigParameters::unsetReadonly()
 {
-    m_ReadonlyIsSet = false;
+    m_FieldsSet.reset(FieldBit_Readonly);
 }
 bool CustomConfigParameters::isNoNewRootComments() const
 {
@@ -3628,17 +5639,17 @@ bool CustomConfigParameters::isNoNewRootComments() const
 void CustomConfigParameters::setNoNewRootComments(bool value)
 {
     m_NoNewRootComments = value;
-    m_NoNewRootCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_NoNewRootComments);
 }
 
 bool CustomConfigParameters::noNewRootCommentsIsSet() const
 {
-    return m_NoNewRootCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_NoNewRootComments);
 }
 
 void CustomConfigParameters::unsetNoNewRootComments()
 {
-    m_NoNewRootCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_NoNewRootComments);
 }
 bool CustomConfigParameters::isRequireSSO() const
 {
@@ -3648,17 +5659,17 @@ bool CustomConfigParameters::isRequireSSO() const
 void CustomConfigParameters::setRequireSSO(bool value)
 {
     m_RequireSSO = value;
-    m_RequireSSOIsSet = true;
+    m_FieldsSet.set(FieldBit_RequireSSO);
 }
 
 bool CustomConfigParameters::requireSSOIsSet() const
 {
-    return m_RequireSSOIsSet;
+    return m_FieldsSet.test(FieldBit_RequireSSO);
 }
 
 void CustomConfigParameters::unsetRequireSSO()
 {
-    m_RequireSSOIsSet = false;
+    m_FieldsSet.reset(FieldBit_RequireSSO);
 }
 bool CustomConfigParameters::isEnableFChat() const
 {
@@ -3668,17 +5679,17 @@ bool CustomConfigParameters::isEnableFChat() const
 void CustomConfigParameters::setEnableFChat(bool value)
 {
     m_EnableFChat = value;
-    m_EnableFChatIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableFChat);
 }
 
 bool CustomConfigParameters::enableFChatIsSet() const
 {
-    return m_EnableFChatIsSet;
+    return m_FieldsSet.test(FieldBit_EnableFChat);
 }
 
 void CustomConfigParameters::unsetEnableFChat()
 {
-    m_EnableFChatIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableFChat);
 }
 bool CustomConfigParameters::isEnableResizeHandle() const
 {
@@ -3688,37 +5699,38 @@ bool CustomConfigParameters::isEnableResizeHandle() const
 void CustomConfigParameters::setEnableResizeHandle(bool value)
 {
     m_EnableResizeHandle = value;
-    m_EnableResizeHandleIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableResizeHandle);
 }
 
 bool CustomConfigParameters::enableResizeHandleIsSet() const
 {
-    return m_EnableResizeHandleIsSet;
+    return m_FieldsSet.test(FieldBit_EnableResizeHandle);
 }
 
 void CustomConfigParameters::unsetEnableResizeHandle()
 {
-    m_EnableResizeHandleIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableResizeHandle);
 }
 std::vector<utility::string_t> CustomConfigParameters::getRestrictedLinkDomains() const
 {
-    return m_RestrictedLinkDomains.get();
+    return m_RestrictedLinkDomains;
 }
 
 
 void CustomConfigParameters::setRestrictedLinkDomains(const std::vector<utility::string_t>& value)
 {
     m_RestrictedLinkDomains = value;
+    m_FieldsSet.set(FieldBit_RestrictedLinkDomains);
 }
 
 bool CustomConfigParameters::restrictedLinkDomainsIsSet() const
 {
-    return m_RestrictedLinkDomains.has_value();
+    return m_FieldsSet.test(FieldBit_RestrictedLinkDomains);
 }
 
 void CustomConfigParameters::unsetRestrictedLinkDomains()
 {
-    m_RestrictedLinkDomains.reset();
+    m_FieldsSet.reset(FieldBit_RestrictedLinkDomains);
 }
 bool CustomConfigParameters::isShowBadgesInTopBar() const
 {
@@ -3728,17 +5740,17 @@ bool CustomConfigParameters::isShowBadgesInTopBar() const
 void CustomConfigParameters::setShowBadgesInTopBar(bool value)
 {
     m_ShowBadgesInTopBar = value;
-    m_ShowBadgesInTopBarIsSet = true;
+    m_FieldsSet.set(FieldBit_ShowBadgesInTopBar);
 }
 
 bool CustomConfigParameters::showBadgesInTopBarIsSet() const
 {
-    return m_ShowBadgesInTopBarIsSet;
+    return m_FieldsSet.test(FieldBit_ShowBadgesInTopBar);
 }
 
 void CustomConfigParameters::unsetShowBadgesInTopBar()
 {
-    m_ShowBadgesInTopBarIsSet = false;
+    m_FieldsSet.reset(FieldBit_ShowBadgesInTopBar);
 }
 bool CustomConfigParameters::isShowCommentSaveSuccess() const
 {
@@ -3748,17 +5760,17 @@ bool CustomConfigParameters::isShowCommentSaveSuccess() const
 void CustomConfigParameters::setShowCommentSaveSuccess(bool value)
 {
     m_ShowCommentSaveSuccess = value;
-    m_ShowCommentSaveSuccessIsSet = true;
+    m_FieldsSet.set(FieldBit_ShowCommentSaveSuccess);
 }
 
 bool CustomConfigParameters::showCommentSaveSuccessIsSet() const
 {
-    return m_ShowCommentSaveSuccessIsSet;
+    return m_FieldsSet.test(FieldBit_ShowCommentSaveSuccess);
 }
 
 void CustomConfigParameters::unsetShowCommentSaveSuccess()
 {
-    m_ShowCommentSaveSuccessIsSet = false;
+    m_FieldsSet.reset(FieldBit_ShowCommentSaveSuccess);
 }
 bool CustomConfigParameters::isShowLiveRightAway() const
 {
@@ -3768,17 +5780,17 @@ bool CustomConfigParameters::isShowLiveRightAway() const
 void CustomConfigParameters::setShowLiveRightAway(bool value)
 {
     m_ShowLiveRightAway = value;
-    m_ShowLiveRightAwayIsSet = true;
+    m_FieldsSet.set(FieldBit_ShowLiveRightAway);
 }
 
 bool CustomConfigParameters::showLiveRightAwayIsSet() const
 {
-    return m_ShowLiveRightAwayIsSet;
+    return m_FieldsSet.test(FieldBit_ShowLiveRightAway);
 }
 
 void CustomConfigParameters::unsetShowLiveRightAway()
 {
-    m_ShowLiveRightAwayIsSet = false;
+    m_FieldsSet.reset(FieldBit_ShowLiveRightAway);
 }
 bool CustomConfigParameters::isShowQuestion() const
 {
@@ -3788,17 +5800,17 @@ bool CustomConfigParameters::isShowQuestion() const
 void CustomConfigParameters::setShowQuestion(bool value)
 {
     m_ShowQuestion = value;
-    m_ShowQuestionIsSet = true;
+    m_FieldsSet.set(FieldBit_ShowQuestion);
 }
 
 bool CustomConfigParameters::showQuestionIsSet() const
 {
-    return m_ShowQuestionIsSet;
+    return m_FieldsSet.test(FieldBit_ShowQuestion);
 }
 
 void CustomConfigParameters::unsetShowQuestion()
 {
-    m_ShowQuestionIsSet = false;
+    m_FieldsSet.reset(FieldBit_ShowQuestion);
 }
 std::vector<std::shared_ptr<SpamRule>> CustomConfigParameters::getSpamRules() const
 {
@@ -3809,17 +5821,17 @@ std::vector<std::shared_ptr<SpamRule>> CustomConfigParameters::getSpamRules() co
 void CustomConfigParameters::setSpamRules(const std::vector<std::shared_ptr<SpamRule>>& value)
 {
     m_SpamRules = value;
-    m_SpamRulesIsSet = true;
+    m_FieldsSet.set(FieldBit_SpamRules);
 }
 
 bool CustomConfigParameters::spamRulesIsSet() const
 {
-    return m_SpamRulesIsSet;
+    return m_FieldsSet.test(FieldBit_SpamRules);
 }
 
 void CustomConfigParameters::unsetSpamRules()
 {
-    m_SpamRulesIsSet = false;
+    m_FieldsSet.reset(FieldBit_SpamRules);
 }
 std::shared_ptr<SSOSecurityLevel> CustomConfigParameters::getSsoSecLvl() const
 {
@@ -3830,37 +5842,38 @@ std::shared_ptr<SSOSecurityLevel> CustomConfigParameters::getSsoSecLvl() const
 void CustomConfigParameters::setSsoSecLvl(const std::shared_ptr<SSOSecurityLevel>& value)
 {
     m_SsoSecLvl = value;
-    m_SsoSecLvlIsSet = true;
+    m_FieldsSet.set(FieldBit_SsoSecLvl);
 }
 
 bool CustomConfigParameters::ssoSecLvlIsSet() const
 {
-    return m_SsoSecLvlIsSet;
+    return m_FieldsSet.test(FieldBit_SsoSecLvl);
 }
 
 void CustomConfigParameters::unsetSsoSecLvl()
 {
-    m_SsoSecLvlIsSet = false;
+    m_FieldsSet.reset(FieldBit_SsoSecLvl);
 }
 std::map<utility::string_t, utility::string_t> CustomConfigParameters::getTranslations() const
 {
-    return m_Translations.get();
+    return m_Translations;
 }
 
 
 void CustomConfigParameters::setTranslations(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Translations = value;
+    m_FieldsSet.set(FieldBit_Translations);
 }
 
 bool CustomConfigParameters::translationsIsSet() const
 {
-    return m_Translations.has_value();
+    return m_FieldsSet.test(FieldBit_Translations);
 }
 
 void CustomConfigParameters::unsetTranslations()
 {
-    m_Translations.reset();
+    m_FieldsSet.reset(FieldBit_Translations);
 }
 bool CustomConfigParameters::isUseShowCommentsToggle() const
 {
@@ -3870,17 +5883,17 @@ bool CustomConfigParameters::isUseShowCommentsToggle() const
 void CustomConfigParameters::setUseShowCommentsToggle(bool value)
 {
     m_UseShowCommentsToggle = value;
-    m_UseShowCommentsToggleIsSet = true;
+    m_FieldsSet.set(FieldBit_UseShowCommentsToggle);
 }
 
 bool CustomConfigParameters::useShowCommentsToggleIsSet() const
 {
-    return m_UseShowCommentsToggleIsSet;
+    return m_FieldsSet.test(FieldBit_UseShowCommentsToggle);
 }
 
 void CustomConfigParameters::unsetUseShowCommentsToggle()
 {
-    m_UseShowCommentsToggleIsSet = false;
+    m_FieldsSet.reset(FieldBit_UseShowCommentsToggle);
 }
 bool CustomConfigParameters::isUseSingleLineCommentInput() const
 {
@@ -3890,17 +5903,17 @@ bool CustomConfigParameters::isUseSingleLineCommentInput() const
 void CustomConfigParameters::setUseSingleLineCommentInput(bool value)
 {
     m_UseSingleLineCommentInput = value;
-    m_UseSingleLineCommentInputIsSet = true;
+    m_FieldsSet.set(FieldBit_UseSingleLineCommentInput);
 }
 
 bool CustomConfigParameters::useSingleLineCommentInputIsSet() const
 {
-    return m_UseSingleLineCommentInputIsSet;
+    return m_FieldsSet.test(FieldBit_UseSingleLineCommentInput);
 }
 
 void CustomConfigParameters::unsetUseSingleLineCommentInput()
 {
-    m_UseSingleLineCommentInputIsSet = false;
+    m_FieldsSet.reset(FieldBit_UseSingleLineCommentInput);
 }
 std::shared_ptr<VoteStyle> CustomConfigParameters::getVoteStyle() const
 {
@@ -3911,17 +5924,17 @@ std::shared_ptr<VoteStyle> CustomConfigParameters::getVoteStyle() const
 void CustomConfigParameters::setVoteStyle(const std::shared_ptr<VoteStyle>& value)
 {
     m_VoteStyle = value;
-    m_VoteStyleIsSet = true;
+    m_FieldsSet.set(FieldBit_VoteStyle);
 }
 
 bool CustomConfigParameters::voteStyleIsSet() const
 {
-    return m_VoteStyleIsSet;
+    return m_FieldsSet.test(FieldBit_VoteStyle);
 }
 
 void CustomConfigParameters::unsetVoteStyle()
 {
-    m_VoteStyleIsSet = false;
+    m_FieldsSet.reset(FieldBit_VoteStyle);
 }
 utility::string_t CustomConfigParameters::getWidgetQuestionId() const
 {
@@ -3932,17 +5945,17 @@ utility::string_t CustomConfigParameters::getWidgetQuestionId() const
 void CustomConfigParameters::setWidgetQuestionId(const utility::string_t& value)
 {
     m_WidgetQuestionId = value;
-    m_WidgetQuestionIdIsSet = true;
+    m_FieldsSet.set(FieldBit_WidgetQuestionId);
 }
 
 bool CustomConfigParameters::widgetQuestionIdIsSet() const
 {
-    return m_WidgetQuestionIdIsSet;
+    return m_FieldsSet.test(FieldBit_WidgetQuestionId);
 }
 
 void CustomConfigParameters::unsetWidgetQuestionId()
 {
-    m_WidgetQuestionIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_WidgetQuestionId);
 }
 std::shared_ptr<CommentQuestionResultsRenderingType> CustomConfigParameters::getWidgetQuestionResultsStyle() const
 {
@@ -3953,17 +5966,17 @@ std::shared_ptr<CommentQuestionResultsRenderingType> CustomConfigParameters::get
 void CustomConfigParameters::setWidgetQuestionResultsStyle(const std::shared_ptr<CommentQuestionResultsRenderingType>& value)
 {
     m_WidgetQuestionResultsStyle = value;
-    m_WidgetQuestionResultsStyleIsSet = true;
+    m_FieldsSet.set(FieldBit_WidgetQuestionResultsStyle);
 }
 
 bool CustomConfigParameters::widgetQuestionResultsStyleIsSet() const
 {
-    return m_WidgetQuestionResultsStyleIsSet;
+    return m_FieldsSet.test(FieldBit_WidgetQuestionResultsStyle);
 }
 
 void CustomConfigParameters::unsetWidgetQuestionResultsStyle()
 {
-    m_WidgetQuestionResultsStyleIsSet = false;
+    m_FieldsSet.reset(FieldBit_WidgetQuestionResultsStyle);
 }
 bool CustomConfigParameters::isWidgetQuestionShowBreakdown() const
 {
@@ -3973,17 +5986,17 @@ bool CustomConfigParameters::isWidgetQuestionShowBreakdown() const
 void CustomConfigParameters::setWidgetQuestionShowBreakdown(bool value)
 {
     m_WidgetQuestionShowBreakdown = value;
-    m_WidgetQuestionShowBreakdownIsSet = true;
+    m_FieldsSet.set(FieldBit_WidgetQuestionShowBreakdown);
 }
 
 bool CustomConfigParameters::widgetQuestionShowBreakdownIsSet() const
 {
-    return m_WidgetQuestionShowBreakdownIsSet;
+    return m_FieldsSet.test(FieldBit_WidgetQuestionShowBreakdown);
 }
 
 void CustomConfigParameters::unsetWidgetQuestionShowBreakdown()
 {
-    m_WidgetQuestionShowBreakdownIsSet = false;
+    m_FieldsSet.reset(FieldBit_WidgetQuestionShowBreakdown);
 }
 std::shared_ptr<QuestionRenderingType> CustomConfigParameters::getWidgetQuestionStyle() const
 {
@@ -3994,17 +6007,17 @@ std::shared_ptr<QuestionRenderingType> CustomConfigParameters::getWidgetQuestion
 void CustomConfigParameters::setWidgetQuestionStyle(const std::shared_ptr<QuestionRenderingType>& value)
 {
     m_WidgetQuestionStyle = value;
-    m_WidgetQuestionStyleIsSet = true;
+    m_FieldsSet.set(FieldBit_WidgetQuestionStyle);
 }
 
 bool CustomConfigParameters::widgetQuestionStyleIsSet() const
 {
-    return m_WidgetQuestionStyleIsSet;
+    return m_FieldsSet.test(FieldBit_WidgetQuestionStyle);
 }
 
 void CustomConfigParameters::unsetWidgetQuestionStyle()
 {
-    m_WidgetQuestionStyleIsSet = false;
+    m_FieldsSet.reset(FieldBit_WidgetQuestionStyle);
 }
 std::shared_ptr<QuestionWhenSave> CustomConfigParameters::getWidgetQuestionWhenToSave() const
 {
@@ -4015,17 +6028,17 @@ std::shared_ptr<QuestionWhenSave> CustomConfigParameters::getWidgetQuestionWhenT
 void CustomConfigParameters::setWidgetQuestionWhenToSave(const std::shared_ptr<QuestionWhenSave>& value)
 {
     m_WidgetQuestionWhenToSave = value;
-    m_WidgetQuestionWhenToSaveIsSet = true;
+    m_FieldsSet.set(FieldBit_WidgetQuestionWhenToSave);
 }
 
 bool CustomConfigParameters::widgetQuestionWhenToSaveIsSet() const
 {
-    return m_WidgetQuestionWhenToSaveIsSet;
+    return m_FieldsSet.test(FieldBit_WidgetQuestionWhenToSave);
 }
 
 void CustomConfigParameters::unsetWidgetQuestionWhenToSave()
 {
-    m_WidgetQuestionWhenToSaveIsSet = false;
+    m_FieldsSet.reset(FieldBit_WidgetQuestionWhenToSave);
 }
 std::shared_ptr<CommentQuestionsRequired> CustomConfigParameters::getWidgetQuestionsRequired() const
 {
@@ -4036,17 +6049,17 @@ std::shared_ptr<CommentQuestionsRequired> CustomConfigParameters::getWidgetQuest
 void CustomConfigParameters::setWidgetQuestionsRequired(const std::shared_ptr<CommentQuestionsRequired>& value)
 {
     m_WidgetQuestionsRequired = value;
-    m_WidgetQuestionsRequiredIsSet = true;
+    m_FieldsSet.set(FieldBit_WidgetQuestionsRequired);
 }
 
 bool CustomConfigParameters::widgetQuestionsRequiredIsSet() const
 {
-    return m_WidgetQuestionsRequiredIsSet;
+    return m_FieldsSet.test(FieldBit_WidgetQuestionsRequired);
 }
 
 void CustomConfigParameters::unsetWidgetQuestionsRequired()
 {
-    m_WidgetQuestionsRequiredIsSet = false;
+    m_FieldsSet.reset(FieldBit_WidgetQuestionsRequired);
 }
 std::shared_ptr<QuestionSubQuestionVisibility> CustomConfigParameters::getWidgetSubQuestionVisibility() const
 {
@@ -4057,17 +6070,17 @@ std::shared_ptr<QuestionSubQuestionVisibility> CustomConfigParameters::getWidget
 void CustomConfigParameters::setWidgetSubQuestionVisibility(const std::shared_ptr<QuestionSubQuestionVisibility>& value)
 {
     m_WidgetSubQuestionVisibility = value;
-    m_WidgetSubQuestionVisibilityIsSet = true;
+    m_FieldsSet.set(FieldBit_WidgetSubQuestionVisibility);
 }
 
 bool CustomConfigParameters::widgetSubQuestionVisibilityIsSet() const
 {
-    return m_WidgetSubQuestionVisibilityIsSet;
+    return m_FieldsSet.test(FieldBit_WidgetSubQuestionVisibility);
 }
 
 void CustomConfigParameters::unsetWidgetSubQuestionVisibility()
 {
-    m_WidgetSubQuestionVisibilityIsSet = false;
+    m_FieldsSet.reset(FieldBit_WidgetSubQuestionVisibility);
 }
 bool CustomConfigParameters::isWrap() const
 {
@@ -4077,17 +6090,17 @@ bool CustomConfigParameters::isWrap() const
 void CustomConfigParameters::setWrap(bool value)
 {
     m_Wrap = value;
-    m_WrapIsSet = true;
+    m_FieldsSet.set(FieldBit_Wrap);
 }
 
 bool CustomConfigParameters::wrapIsSet() const
 {
-    return m_WrapIsSet;
+    return m_FieldsSet.test(FieldBit_Wrap);
 }
 
 void CustomConfigParameters::unsetWrap()
 {
-    m_WrapIsSet = false;
+    m_FieldsSet.reset(FieldBit_Wrap);
 }
 std::shared_ptr<UsersListLocation> CustomConfigParameters::getUsersListLocation() const
 {
@@ -4098,17 +6111,17 @@ std::shared_ptr<UsersListLocation> CustomConfigParameters::getUsersListLocation(
 void CustomConfigParameters::setUsersListLocation(const std::shared_ptr<UsersListLocation>& value)
 {
     m_UsersListLocation = value;
-    m_UsersListLocationIsSet = true;
+    m_FieldsSet.set(FieldBit_UsersListLocation);
 }
 
 bool CustomConfigParameters::usersListLocationIsSet() const
 {
-    return m_UsersListLocationIsSet;
+    return m_FieldsSet.test(FieldBit_UsersListLocation);
 }
 
 void CustomConfigParameters::unsetUsersListLocation()
 {
-    m_UsersListLocationIsSet = false;
+    m_FieldsSet.reset(FieldBit_UsersListLocation);
 }
 bool CustomConfigParameters::isUsersListIncludeOffline() const
 {
@@ -4118,17 +6131,17 @@ bool CustomConfigParameters::isUsersListIncludeOffline() const
 void CustomConfigParameters::setUsersListIncludeOffline(bool value)
 {
     m_UsersListIncludeOffline = value;
-    m_UsersListIncludeOfflineIsSet = true;
+    m_FieldsSet.set(FieldBit_UsersListIncludeOffline);
 }
 
 bool CustomConfigParameters::usersListIncludeOfflineIsSet() const
 {
-    return m_UsersListIncludeOfflineIsSet;
+    return m_FieldsSet.test(FieldBit_UsersListIncludeOffline);
 }
 
 void CustomConfigParameters::unsetUsersListIncludeOffline()
 {
-    m_UsersListIncludeOfflineIsSet = false;
+    m_FieldsSet.reset(FieldBit_UsersListIncludeOffline);
 }
 utility::string_t CustomConfigParameters::getTicketBaseUrl() const
 {
@@ -4139,17 +6152,17 @@ utility::string_t CustomConfigParameters::getTicketBaseUrl() const
 void CustomConfigParameters::setTicketBaseUrl(const utility::string_t& value)
 {
     m_TicketBaseUrl = value;
-    m_TicketBaseUrlIsSet = true;
+    m_FieldsSet.set(FieldBit_TicketBaseUrl);
 }
 
 bool CustomConfigParameters::ticketBaseUrlIsSet() const
 {
-    return m_TicketBaseUrlIsSet;
+    return m_FieldsSet.test(FieldBit_TicketBaseUrl);
 }
 
 void CustomConfigParameters::unsetTicketBaseUrl()
 {
-    m_TicketBaseUrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_TicketBaseUrl);
 }
 utility::string_t CustomConfigParameters::getTicketKBSearchEndpoint() const
 {
@@ -4160,17 +6173,17 @@ utility::string_t CustomConfigParameters::getTicketKBSearchEndpoint() const
 void CustomConfigParameters::setTicketKBSearchEndpoint(const utility::string_t& value)
 {
     m_TicketKBSearchEndpoint = value;
-    m_TicketKBSearchEndpointIsSet = true;
+    m_FieldsSet.set(FieldBit_TicketKBSearchEndpoint);
 }
 
 bool CustomConfigParameters::ticketKBSearchEndpointIsSet() const
 {
-    return m_TicketKBSearchEndpointIsSet;
+    return m_FieldsSet.test(FieldBit_TicketKBSearchEndpoint);
 }
 
 void CustomConfigParameters::unsetTicketKBSearchEndpoint()
 {
-    m_TicketKBSearchEndpointIsSet = false;
+    m_FieldsSet.reset(FieldBit_TicketKBSearchEndpoint);
 }
 bool CustomConfigParameters::isTicketFileUploadsEnabled() const
 {
@@ -4180,17 +6193,17 @@ bool CustomConfigParameters::isTicketFileUploadsEnabled() const
 void CustomConfigParameters::setTicketFileUploadsEnabled(bool value)
 {
     m_TicketFileUploadsEnabled = value;
-    m_TicketFileUploadsEnabledIsSet = true;
+    m_FieldsSet.set(FieldBit_TicketFileUploadsEnabled);
 }
 
 bool CustomConfigParameters::ticketFileUploadsEnabledIsSet() const
 {
-    return m_TicketFileUploadsEnabledIsSet;
+    return m_FieldsSet.test(FieldBit_TicketFileUploadsEnabled);
 }
 
 void CustomConfigParameters::unsetTicketFileUploadsEnabled()
 {
-    m_TicketFileUploadsEnabledIsSet = false;
+    m_FieldsSet.reset(FieldBit_TicketFileUploadsEnabled);
 }
 int32_t CustomConfigParameters::getTicketMaxFileSize() const
 {
@@ -4200,17 +6213,17 @@ int32_t CustomConfigParameters::getTicketMaxFileSize() const
 void CustomConfigParameters::setTicketMaxFileSize(int32_t value)
 {
     m_TicketMaxFileSize = value;
-    m_TicketMaxFileSizeIsSet = true;
+    m_FieldsSet.set(FieldBit_TicketMaxFileSize);
 }
 
 bool CustomConfigParameters::ticketMaxFileSizeIsSet() const
 {
-    return m_TicketMaxFileSizeIsSet;
+    return m_FieldsSet.test(FieldBit_TicketMaxFileSize);
 }
 
 void CustomConfigParameters::unsetTicketMaxFileSize()
 {
-    m_TicketMaxFileSizeIsSet = false;
+    m_FieldsSet.reset(FieldBit_TicketMaxFileSize);
 }
 std::vector<utility::string_t> CustomConfigParameters::getTicketAutoAssignUserIds() const
 {
@@ -4221,17 +6234,17 @@ std::vector<utility::string_t> CustomConfigParameters::getTicketAutoAssignUserId
 void CustomConfigParameters::setTicketAutoAssignUserIds(const std::vector<utility::string_t>& value)
 {
     m_TicketAutoAssignUserIds = value;
-    m_TicketAutoAssignUserIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_TicketAutoAssignUserIds);
 }
 
 bool CustomConfigParameters::ticketAutoAssignUserIdsIsSet() const
 {
-    return m_TicketAutoAssignUserIdsIsSet;
+    return m_FieldsSet.test(FieldBit_TicketAutoAssignUserIds);
 }
 
 void CustomConfigParameters::unsetTicketAutoAssignUserIds()
 {
-    m_TicketAutoAssignUserIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_TicketAutoAssignUserIds);
 }
 std::shared_ptr<TOSConfig> CustomConfigParameters::getTos() const
 {
@@ -4242,17 +6255,17 @@ std::shared_ptr<TOSConfig> CustomConfigParameters::getTos() const
 void CustomConfigParameters::setTos(const std::shared_ptr<TOSConfig>& value)
 {
     m_Tos = value;
-    m_TosIsSet = true;
+    m_FieldsSet.set(FieldBit_Tos);
 }
 
 bool CustomConfigParameters::tosIsSet() const
 {
-    return m_TosIsSet;
+    return m_FieldsSet.test(FieldBit_Tos);
 }
 
 void CustomConfigParameters::unsetTos()
 {
-    m_TosIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tos);
 }
 
 }
@@ -20,19 +20,6 @@ namespace model {
 
 CustomEmailTemplate::CustomEmailTemplate()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_EmailTemplateId = utility::conversions::to_string_t("");
-    m_EmailTemplateIdIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_Ejs = utility::conversions::to_string_t("");
-    m_EjsIsSet = false;
-    m_TranslationOverridesByLocaleIsSet = false;
 }
 
 CustomEmailTemplate::~CustomEmailTemplate()
@@ -47,190 +34,484 @@ void CustomEmailTemplate::validate()
 web::json::value CustomEmailTemplate::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))] = ModelBase::toJson(m_EmailTemplateId);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_UpdatedAt.has_value())
+    if(m_FieldsSet.test(FieldBit_UpdatedAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("updatedAt"))] = ModelBase::toJson(m_UpdatedAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("updatedAt"))] = ModelBase::toJson(m_UpdatedAt);
     }
-    if(m_UpdatedByUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UpdatedByUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("updatedByUserId"))] = ModelBase::toJson(m_UpdatedByUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("updatedByUserId"))] = ModelBase::toJson(m_UpdatedByUserId);
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_EjsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ejs"))] = ModelBase::toJson(m_Ejs);
     }
-    if(m_TranslationOverridesByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale"))] = ModelBase::toJson(m_TranslationOverridesByLocale);
     }
-    if(m_TestData.has_value())
+    if(m_FieldsSet.test(FieldBit_TestData))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("testData"))] = ModelBase::toJson(m_TestData.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("testData"))] = ModelBase::toJson(m_TestData);
     }
 
     return val;
 }
 
+void CustomEmailTemplate::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
+    {
+        
+        writer.key(_XPLATSTR("emailTemplateId"));
+        ModelBase::writeJson(writer, m_EmailTemplateId);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_UpdatedAt))
+    {
+        
+        writer.key(_XPLATSTR("updatedAt"));
+        ModelBase::writeJson(writer, m_UpdatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_UpdatedByUserId))
+    {
+        
+        writer.key(_XPLATSTR("updatedByUserId"));
+        ModelBase::writeJson(writer, m_UpdatedByUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_Ejs))
+    {
+        
+        writer.key(_XPLATSTR("ejs"));
+        ModelBase::writeJson(writer, m_Ejs);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
+    {
+        
+        writer.key(_XPLATSTR("translationOverridesByLocale"));
+        ModelBase::writeJson(writer, m_TranslationOverridesByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_TestData))
+    {
+        
+        writer.key(_XPLATSTR("testData"));
+        ModelBase::writeJson(writer, m_TestData);
+    }
+
+    writer.endObject();
+}
+
 bool CustomEmailTemplate::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            if(field.first == _XPLATSTR("emailTemplateId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailTemplateId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
+                    setEmailTemplateId(refVal_setEmailTemplateId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("updatedAt")):
+            if(field.first == _XPLATSTR("updatedAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setUpdatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUpdatedAt);
+                    setUpdatedAt(refVal_setUpdatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("updatedByUserId")):
+            if(field.first == _XPLATSTR("updatedByUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUpdatedByUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUpdatedByUserId);
+                    setUpdatedByUserId(refVal_setUpdatedByUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ejs")):
+            if(field.first == _XPLATSTR("ejs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEjs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEjs);
+                    setEjs(refVal_setEjs);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")):
+            if(field.first == _XPLATSTR("translationOverridesByLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslationOverridesByLocale);
+                    setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("testData")):
+            if(field.first == _XPLATSTR("testData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AnyType> refVal_setTestData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTestData);
+                    setTestData(refVal_setTestData);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))))
+    return ok;
+}
+
+void CustomEmailTemplate::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmailTemplateId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
-            setEmailTemplateId(refVal_setEmailTemplateId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailTemplateId")), m_EmailTemplateId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("updatedAt"))))
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("updatedAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setUpdatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUpdatedAt);
-            setUpdatedAt(refVal_setUpdatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("updatedByUserId"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("updatedByUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUpdatedByUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUpdatedByUserId);
-            setUpdatedByUserId(refVal_setUpdatedByUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_UpdatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("updatedAt")), m_UpdatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ejs"))))
+    if(m_FieldsSet.test(FieldBit_UpdatedByUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ejs")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEjs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEjs);
-            setEjs(refVal_setEjs);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("updatedByUserId")), m_UpdatedByUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslationOverridesByLocale);
-            setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_Ejs))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ejs")), m_Ejs);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")), m_TranslationOverridesByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_TestData))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("testData")), m_TestData);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("testData"))))
+}
+
+bool CustomEmailTemplate::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("testData")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            std::shared_ptr<AnyType> refVal_setTestData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTestData);
-            setTestData(refVal_setTestData);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            {
+                utility::string_t refVal_setEmailTemplateId;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailTemplateId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailTemplateId(refVal_setEmailTemplateId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("updatedAt")):
+            {
+                utility::datetime refVal_setUpdatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setUpdatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUpdatedAt(refVal_setUpdatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("updatedByUserId")):
+            {
+                utility::string_t refVal_setUpdatedByUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUpdatedByUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUpdatedByUserId(refVal_setUpdatedByUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ejs")):
+            {
+                utility::string_t refVal_setEjs;
+                if(!ModelBase::readBinary(reader, field, refVal_setEjs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEjs(refVal_setEjs);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")):
+            {
+                std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslationOverridesByLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("testData")):
+            {
+                std::shared_ptr<AnyType> refVal_setTestData;
+                if(!ModelBase::readBinary(reader, field, refVal_setTestData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTestData(refVal_setTestData);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void CustomEmailTemplate::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -240,49 +521,49 @@ void CustomEmailTemplate::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")), m_EmailTemplateId));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_UpdatedAt.has_value())
+    if(m_FieldsSet.test(FieldBit_UpdatedAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("updatedAt")), m_UpdatedAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("updatedAt")), m_UpdatedAt));
     }
-    if(m_UpdatedByUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UpdatedByUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("updatedByUserId")), m_UpdatedByUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("updatedByUserId")), m_UpdatedByUserId));
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_EjsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ejs")), m_Ejs));
     }
-    if(m_TranslationOverridesByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale")), m_TranslationOverridesByLocale));
     }
-    if(m_TestData.has_value())
+    if(m_FieldsSet.test(FieldBit_TestData))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("testData")), m_TestData.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("testData")), m_TestData));
     }
 }
 
@@ -374,17 +655,17 @@ utility::string_t CustomEmailTemplate::getId() const
 void CustomEmailTemplate::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool CustomEmailTemplate::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void CustomEmailTemplate::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t CustomEmailTemplate::getTenantId() const
 {
@@ -395,17 +676,17 @@ utility::string_t CustomEmailTemplate::getTenantId() const
 void CustomEmailTemplate::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool CustomEmailTemplate::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void CustomEmailTemplate::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t CustomEmailTemplate::getEmailTemplateId() const
 {
@@ -416,17 +697,17 @@ utility::string_t CustomEmailTemplate::getEmailTemplateId() const
 void CustomEmailTemplate::setEmailTemplateId(const utility::string_t& value)
 {
     m_EmailTemplateId = value;
-    m_EmailTemplateIdIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailTemplateId);
 }
 
 bool CustomEmailTemplate::emailTemplateIdIsSet() const
 {
-    return m_EmailTemplateIdIsSet;
+    return m_FieldsSet.test(FieldBit_EmailTemplateId);
 }
 
 void CustomEmailTemplate::unsetEmailTemplateId()
 {
-    m_EmailTemplateIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailTemplateId);
 }
 utility::string_t CustomEmailTemplate::getDisplayName() const
 {
@@ -437,17 +718,17 @@ utility::string_t CustomEmailTemplate::getDisplayName() const
 void CustomEmailTemplate::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool CustomEmailTemplate::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void CustomEmailTemplate::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::datetime CustomEmailTemplate::getCreatedAt() const
 {
@@ -458,77 +739,80 @@ utility::datetime CustomEmailTemplate::getCreatedAt() const
 void CustomEmailTemplate::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool CustomEmailTemplate::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void CustomEmailTemplate::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::datetime CustomEmailTemplate::getUpdatedAt() const
 {
-    return m_UpdatedAt.get();
+    return m_UpdatedAt;
 }
 
 
 void CustomEmailTemplate::setUpdatedAt(const utility::datetime& value)
 {
     m_UpdatedAt = value;
+    m_FieldsSet.set(FieldBit_UpdatedAt);
 }
 
 bool CustomEmailTemplate::updatedAtIsSet() const
 {
-    return m_UpdatedAt.has_value();
+    return m_FieldsSet.test(FieldBit_UpdatedAt);
 }
 
 void CustomEmailTemplate::unsetUpdatedAt()
 {
-    m_UpdatedAt.reset();
+    m_FieldsSet.reset(FieldBit_UpdatedAt);
 }
 utility::string_t CustomEmailTemplate::getUpdatedByUserId() const
 {
-    return m_UpdatedByUserId.get();
+    return m_UpdatedByUserId;
 }
 
 
 void CustomEmailTemplate::setUpdatedByUserId(const utility::string_t& value)
 {
     m_UpdatedByUserId = value;
+    m_FieldsSet.set(FieldBit_UpdatedByUserId);
 }
 
 bool CustomEmailTemplate::updatedByUserIdIsSet() const
 {
-    return m_UpdatedByUserId.has_value();
+    return m_FieldsSet.test(FieldBit_UpdatedByUserId);
 }
 
 void CustomEmailTemplate::unsetUpdatedByUserId()
 {
-    m_UpdatedByUserId.reset();
+    m_FieldsSet.reset(FieldBit_UpdatedByUserId);
 }
 utility::string_t CustomEmailTemplate::getDomain() const
 {
-    return m_Domain.get();
+    return m_Domain;
 }
 
 
 void CustomEmailTemplate::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool CustomEmailTemplate::domainIsSet() const
 {
-    return m_Domain.has_value();
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void CustomEmailTemplate::unsetDomain()
 {
-    m_Domain.reset();
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t CustomEmailTemplate::getEjs() const
 {
@@ -539,17 +823,17 @@ utility::string_t CustomEmailTemplate::getEjs() const
 void CustomEmailTemplate::setEjs(const utility::string_t& value)
 {
     m_Ejs = value;
-    m_EjsIsSet = true;
+    m_FieldsSet.set(FieldBit_Ejs);
 }
 
 bool CustomEmailTemplate::ejsIsSet() const
 {
-    return m_EjsIsSet;
+    return m_FieldsSet.test(FieldBit_Ejs);
 }
 
 void CustomEmailTemplate::unsetEjs()
 {
-    m_EjsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ejs);
 }
 std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> CustomEmailTemplate::getTranslationOverridesByLocale() const
 {
@@ -560,37 +844,38 @@ std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> Cust
 void CustomEmailTemplate::setTranslationOverridesByLocale(const std::map<utility::string_t, std::map<utility::string_t, utility::string_t>>& value)
 {
     m_TranslationOverridesByLocale = value;
-    m_TranslationOverridesByLocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_TranslationOverridesByLocale);
 }
 
 bool CustomEmailTemplate::translationOverridesByLocaleIsSet() const
 {
-    return m_TranslationOverridesByLocaleIsSet;
+    return m_FieldsSet.test(FieldBit_TranslationOverridesByLocale);
 }
 
 void CustomEmailTemplate::unsetTranslationOverridesByLocale()
 {
-    m_TranslationOverridesByLocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_TranslationOverridesByLocale);
 }
 std::shared_ptr<AnyType> CustomEmailTemplate::getTestData() const
 {
-    return m_TestData.get();
+    return m_TestData;
 }
 
 
 void CustomEmailTemplate::setTestData(const std::shared_ptr<AnyType>& value)
 {
     m_TestData = value;
+    m_FieldsSet.set(FieldBit_TestData);
 }
 
 bool CustomEmailTemplate::testDataIsSet() const
 {
-    return m_TestData.has_value();
+    return m_FieldsSet.test(FieldBit_TestData);
 }
 
 void CustomEmailTemplate::unsetTestData()
 {
-    m_TestData.reset();
+    m_FieldsSet.reset(FieldBit_TestData);
 }
 
 }
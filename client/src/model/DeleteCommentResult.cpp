@@ -20,8 +20,6 @@ namespace model {
 
 DeleteCommentResult::DeleteCommentResult()
 {
-    m_ActionIsSet = false;
-    m_StatusIsSet = false;
 }
 
 DeleteCommentResult::~DeleteCommentResult()
@@ -36,12 +34,12 @@ void DeleteCommentResult::validate()
 web::json::value DeleteCommentResult::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ActionIsSet)
+    if(m_FieldsSet.test(FieldBit_Action))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("action"))] = ModelBase::toJson(m_Action);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value DeleteCommentResult::toJson() const
     return val;
 }
 
+void DeleteCommentResult::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Action))
+    {
+        
+        writer.key(_XPLATSTR("action"));
+        ModelBase::writeJson(writer, m_Action);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool DeleteCommentResult::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("action"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("action")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<DeleteCommentAction> refVal_setAction;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAction);
-            setAction(refVal_setAction);
-            
+        case ModelBase::fieldHash(_XPLATSTR("action")):
+            if(field.first == _XPLATSTR("action"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<DeleteCommentAction> refVal_setAction;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAction);
+                    setAction(refVal_setAction);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void DeleteCommentResult::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Action))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("action")), m_Action);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool DeleteCommentResult::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("action")):
+            {
+                std::shared_ptr<DeleteCommentAction> refVal_setAction;
+                if(!ModelBase::readBinary(reader, field, refVal_setAction))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAction(refVal_setAction);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void DeleteCommentResult::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void DeleteCommentResult::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ActionIsSet)
+    if(m_FieldsSet.test(FieldBit_Action))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("action")), m_Action));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<DeleteCommentAction> DeleteCommentResult::getAction() const
 void DeleteCommentResult::setAction(const std::shared_ptr<DeleteCommentAction>& value)
 {
     m_Action = value;
-    m_ActionIsSet = true;
+    m_FieldsSet.set(FieldBit_Action);
 }
 
 bool DeleteCommentResult::actionIsSet() const
 {
-    return m_ActionIsSet;
+    return m_FieldsSet.test(FieldBit_Action);
 }
 
 void DeleteCommentResult::unsetAction()
 {
-    m_ActionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Action);
 }
 std::shared_ptr<APIStatus> DeleteCommentResult::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> DeleteCommentResult::getStatus() const
 void DeleteCommentResult::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool DeleteCommentResult::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void DeleteCommentResult::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
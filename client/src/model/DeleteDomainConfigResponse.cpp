@@ -34,32 +34,96 @@ void DeleteDomainConfigResponse::validate()
 web::json::value DeleteDomainConfigResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
 
     return val;
 }
 
+void DeleteDomainConfigResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool DeleteDomainConfigResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<AnyType> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AnyType> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void DeleteDomainConfigResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool DeleteDomainConfigResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<AnyType> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void DeleteDomainConfigResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -67,9 +131,9 @@ void DeleteDomainConfigResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
 }
 
@@ -94,23 +158,24 @@ bool DeleteDomainConfigResponse::fromMultiPart(std::shared_ptr<MultipartFormData
 
 std::shared_ptr<AnyType> DeleteDomainConfigResponse::getStatus() const
 {
-    return m_Status.get();
+    return m_Status;
 }
 
 
 void DeleteDomainConfigResponse::setStatus(const std::shared_ptr<AnyType>& value)
 {
     m_Status = value;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool DeleteDomainConfigResponse::statusIsSet() const
 {
-    return m_Status.has_value();
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void DeleteDomainConfigResponse::unsetStatus()
 {
-    m_Status.reset();
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
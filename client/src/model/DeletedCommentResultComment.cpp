@@ -21,11 +21,6 @@ namespace model {
 DeletedCommentResultComment::DeletedCommentResultComment()
 {
     m_IsDeleted = false;
-    m_IsDeletedIsSet = false;
-    m_CommentHTML = utility::conversions::to_string_t("");
-    m_CommentHTMLIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
 }
 
 DeletedCommentResultComment::~DeletedCommentResultComment()
@@ -40,78 +35,211 @@ void DeletedCommentResultComment::validate()
 web::json::value DeletedCommentResultComment::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeleted"))] = ModelBase::toJson(m_IsDeleted);
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentHTML"))] = ModelBase::toJson(m_CommentHTML);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
 
     return val;
 }
 
+void DeletedCommentResultComment::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
+    {
+        
+        writer.key(_XPLATSTR("isDeleted"));
+        ModelBase::writeJson(writer, m_IsDeleted);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
+    {
+        
+        writer.key(_XPLATSTR("commentHTML"));
+        ModelBase::writeJson(writer, m_CommentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+
+    writer.endObject();
+}
+
 bool DeletedCommentResultComment::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeleted"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeleted")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeleted;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
-            setIsDeleted(refVal_setIsDeleted);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentHTML"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentHTML")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCommentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
-            setCommentHTML(refVal_setCommentHTML);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            if(field.first == _XPLATSTR("isDeleted"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeleted;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
+                    setIsDeleted(refVal_setIsDeleted);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            if(field.first == _XPLATSTR("commentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
+                    setCommentHTML(refVal_setCommentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
+                    setCommenterName(refVal_setCommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    return ok;
+}
+
+void DeletedCommentResultComment::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeleted")), m_IsDeleted);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentHTML")), m_CommentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+}
+
+bool DeletedCommentResultComment::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            {
+                bool refVal_setIsDeleted;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeleted))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeleted(refVal_setIsDeleted);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            {
+                utility::string_t refVal_setCommentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentHTML(refVal_setCommentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                utility::string_t refVal_setCommenterName;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterName(refVal_setCommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void DeletedCommentResultComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -121,21 +249,21 @@ void DeletedCommentResultComment::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeleted")), m_IsDeleted));
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentHTML")), m_CommentHTML));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
 }
 
@@ -184,17 +312,17 @@ bool DeletedCommentResultComment::isIsDeleted() const
 void DeletedCommentResultComment::setIsDeleted(bool value)
 {
     m_IsDeleted = value;
-    m_IsDeletedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeleted);
 }
 
 bool DeletedCommentResultComment::isDeletedIsSet() const
 {
-    return m_IsDeletedIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeleted);
 }
 
 void DeletedCommentResultComment::unsetIsDeleted()
 {
-    m_IsDeletedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeleted);
 }
 utility::string_t DeletedCommentResultComment::getCommentHTML() const
 {
@@ -205,17 +333,17 @@ utility::string_t DeletedCommentResultComment::getCommentHTML() const
 void DeletedCommentResultComment::setCommentHTML(const utility::string_t& value)
 {
     m_CommentHTML = value;
-    m_CommentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentHTML);
 }
 
 bool DeletedCommentResultComment::commentHTMLIsSet() const
 {
-    return m_CommentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_CommentHTML);
 }
 
 void DeletedCommentResultComment::unsetCommentHTML()
 {
-    m_CommentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentHTML);
 }
 utility::string_t DeletedCommentResultComment::getCommenterName() const
 {
@@ -226,37 +354,38 @@ utility::string_t DeletedCommentResultComment::getCommenterName() const
 void DeletedCommentResultComment::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool DeletedCommentResultComment::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void DeletedCommentResultComment::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::string_t DeletedCommentResultComment::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void DeletedCommentResultComment::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool DeletedCommentResultComment::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void DeletedCommentResultComment::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 
 }
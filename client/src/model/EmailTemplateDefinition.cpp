@@ -20,12 +20,6 @@ namespace model {
 
 EmailTemplateDefinition::EmailTemplateDefinition()
 {
-    m_EmailTemplateId = utility::conversions::to_string_t("");
-    m_EmailTemplateIdIsSet = false;
-    m_DefaultTestDataIsSet = false;
-    m_DefaultTranslationsByLocaleIsSet = false;
-    m_DefaultEJS = utility::conversions::to_string_t("");
-    m_DefaultEJSIsSet = false;
 }
 
 EmailTemplateDefinition::~EmailTemplateDefinition()
@@ -40,22 +34,22 @@ void EmailTemplateDefinition::validate()
 web::json::value EmailTemplateDefinition::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))] = ModelBase::toJson(m_EmailTemplateId);
     }
-    if(m_DefaultTestDataIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultTestData))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("defaultTestData"))] = ModelBase::toJson(m_DefaultTestData);
     }
-    if(m_DefaultTranslationsByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultTranslationsByLocale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("defaultTranslationsByLocale"))] = ModelBase::toJson(m_DefaultTranslationsByLocale);
     }
-    if(m_DefaultEJSIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultEJS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("defaultEJS"))] = ModelBase::toJson(m_DefaultEJS);
@@ -64,54 +58,187 @@ web::json::value EmailTemplateDefinition::toJson() const
     return val;
 }
 
+void EmailTemplateDefinition::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
+    {
+        
+        writer.key(_XPLATSTR("emailTemplateId"));
+        ModelBase::writeJson(writer, m_EmailTemplateId);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultTestData))
+    {
+        
+        writer.key(_XPLATSTR("defaultTestData"));
+        ModelBase::writeJson(writer, m_DefaultTestData);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultTranslationsByLocale))
+    {
+        
+        writer.key(_XPLATSTR("defaultTranslationsByLocale"));
+        ModelBase::writeJson(writer, m_DefaultTranslationsByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultEJS))
+    {
+        
+        writer.key(_XPLATSTR("defaultEJS"));
+        ModelBase::writeJson(writer, m_DefaultEJS);
+    }
+
+    writer.endObject();
+}
+
 bool EmailTemplateDefinition::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmailTemplateId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
-            setEmailTemplateId(refVal_setEmailTemplateId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultTestData"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultTestData")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setDefaultTestData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultTestData);
-            setDefaultTestData(refVal_setDefaultTestData);
-            
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            if(field.first == _XPLATSTR("emailTemplateId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailTemplateId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
+                    setEmailTemplateId(refVal_setEmailTemplateId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultTestData")):
+            if(field.first == _XPLATSTR("defaultTestData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setDefaultTestData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultTestData);
+                    setDefaultTestData(refVal_setDefaultTestData);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultTranslationsByLocale")):
+            if(field.first == _XPLATSTR("defaultTranslationsByLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setDefaultTranslationsByLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultTranslationsByLocale);
+                    setDefaultTranslationsByLocale(refVal_setDefaultTranslationsByLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultEJS")):
+            if(field.first == _XPLATSTR("defaultEJS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDefaultEJS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultEJS);
+                    setDefaultEJS(refVal_setDefaultEJS);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultTranslationsByLocale"))))
+    return ok;
+}
+
+void EmailTemplateDefinition::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultTranslationsByLocale")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setDefaultTranslationsByLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultTranslationsByLocale);
-            setDefaultTranslationsByLocale(refVal_setDefaultTranslationsByLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailTemplateId")), m_EmailTemplateId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultEJS"))))
+    if(m_FieldsSet.test(FieldBit_DefaultTestData))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultEJS")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultTestData")), m_DefaultTestData);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultTranslationsByLocale))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultTranslationsByLocale")), m_DefaultTranslationsByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultEJS))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultEJS")), m_DefaultEJS);
+    }
+}
+
+bool EmailTemplateDefinition::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setDefaultEJS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultEJS);
-            setDefaultEJS(refVal_setDefaultEJS);
-            
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            {
+                utility::string_t refVal_setEmailTemplateId;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailTemplateId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailTemplateId(refVal_setEmailTemplateId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultTestData")):
+            {
+                std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setDefaultTestData;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultTestData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultTestData(refVal_setDefaultTestData);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultTranslationsByLocale")):
+            {
+                std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setDefaultTranslationsByLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultTranslationsByLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultTranslationsByLocale(refVal_setDefaultTranslationsByLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultEJS")):
+            {
+                utility::string_t refVal_setDefaultEJS;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultEJS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultEJS(refVal_setDefaultEJS);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void EmailTemplateDefinition::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -121,19 +248,19 @@ void EmailTemplateDefinition::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")), m_EmailTemplateId));
     }
-    if(m_DefaultTestDataIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultTestData))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultTestData")), m_DefaultTestData));
     }
-    if(m_DefaultTranslationsByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultTranslationsByLocale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultTranslationsByLocale")), m_DefaultTranslationsByLocale));
     }
-    if(m_DefaultEJSIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultEJS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultEJS")), m_DefaultEJS));
     }
@@ -185,17 +312,17 @@ utility::string_t EmailTemplateDefinition::getEmailTemplateId() const
 void EmailTemplateDefinition::setEmailTemplateId(const utility::string_t& value)
 {
     m_EmailTemplateId = value;
-    m_EmailTemplateIdIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailTemplateId);
 }
 
 bool EmailTemplateDefinition::emailTemplateIdIsSet() const
 {
-    return m_EmailTemplateIdIsSet;
+    return m_FieldsSet.test(FieldBit_EmailTemplateId);
 }
 
 void EmailTemplateDefinition::unsetEmailTemplateId()
 {
-    m_EmailTemplateIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailTemplateId);
 }
 std::map<utility::string_t, std::shared_ptr<AnyType>> EmailTemplateDefinition::getDefaultTestData() const
 {
@@ -206,17 +333,17 @@ std::map<utility::string_t, std::shared_ptr<AnyType>> EmailTemplateDefinition::g
 void EmailTemplateDefinition::setDefaultTestData(const std::map<utility::string_t, std::shared_ptr<AnyType>>& value)
 {
     m_DefaultTestData = value;
-    m_DefaultTestDataIsSet = true;
+    m_FieldsSet.set(FieldBit_DefaultTestData);
 }
 
 bool EmailTemplateDefinition::defaultTestDataIsSet() const
 {
-    return m_DefaultTestDataIsSet;
+    return m_FieldsSet.test(FieldBit_DefaultTestData);
 }
 
 void EmailTemplateDefinition::unsetDefaultTestData()
 {
-    m_DefaultTestDataIsSet = false;
+    m_FieldsSet.reset(FieldBit_DefaultTestData);
 }
 std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> EmailTemplateDefinition::getDefaultTranslationsByLocale() const
 {
@@ -227,17 +354,17 @@ std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> Emai
 void EmailTemplateDefinition::setDefaultTranslationsByLocale(const std::map<utility::string_t, std::map<utility::string_t, utility::string_t>>& value)
 {
     m_DefaultTranslationsByLocale = value;
-    m_DefaultTranslationsByLocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_DefaultTranslationsByLocale);
 }
 
 bool EmailTemplateDefinition::defaultTranslationsByLocaleIsSet() const
 {
-    return m_DefaultTranslationsByLocaleIsSet;
+    return m_FieldsSet.test(FieldBit_DefaultTranslationsByLocale);
 }
 
 void EmailTemplateDefinition::unsetDefaultTranslationsByLocale()
 {
-    m_DefaultTranslationsByLocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_DefaultTranslationsByLocale);
 }
 utility::string_t EmailTemplateDefinition::getDefaultEJS() const
 {
@@ -248,17 +375,17 @@ utility::string_t EmailTemplateDefinition::getDefaultEJS() const
 void EmailTemplateDefinition::setDefaultEJS(const utility::string_t& value)
 {
     m_DefaultEJS = value;
-    m_DefaultEJSIsSet = true;
+    m_FieldsSet.set(FieldBit_DefaultEJS);
 }
 
 bool EmailTemplateDefinition::defaultEJSIsSet() const
 {
-    return m_DefaultEJSIsSet;
+    return m_FieldsSet.test(FieldBit_DefaultEJS);
 }
 
 void EmailTemplateDefinition::unsetDefaultEJS()
 {
-    m_DefaultEJSIsSet = false;
+    m_FieldsSet.reset(FieldBit_DefaultEJS);
 }
 
 }
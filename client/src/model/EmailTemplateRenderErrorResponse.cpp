@@ -20,20 +20,7 @@ namespace model {
 
 EmailTemplateRenderErrorResponse::EmailTemplateRenderErrorResponse()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_CustomTemplateId = utility::conversions::to_string_t("");
-    m_CustomTemplateIdIsSet = false;
-    m_Error = utility::conversions::to_string_t("");
-    m_ErrorIsSet = false;
     m_Count = 0.0;
-    m_CountIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_LastOccurredAt = utility::datetime();
-    m_LastOccurredAtIsSet = false;
 }
 
 EmailTemplateRenderErrorResponse::~EmailTemplateRenderErrorResponse()
@@ -48,37 +35,37 @@ void EmailTemplateRenderErrorResponse::validate()
 web::json::value EmailTemplateRenderErrorResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_CustomTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomTemplateId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("customTemplateId"))] = ModelBase::toJson(m_CustomTemplateId);
     }
-    if(m_ErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_Error))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("error"))] = ModelBase::toJson(m_Error);
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("count"))] = ModelBase::toJson(m_Count);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_LastOccurredAtIsSet)
+    if(m_FieldsSet.test(FieldBit_LastOccurredAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastOccurredAt"))] = ModelBase::toJson(m_LastOccurredAt);
@@ -87,87 +74,289 @@ web::json::value EmailTemplateRenderErrorResponse::toJson() const
     return val;
 }
 
+void EmailTemplateRenderErrorResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomTemplateId))
+    {
+        
+        writer.key(_XPLATSTR("customTemplateId"));
+        ModelBase::writeJson(writer, m_CustomTemplateId);
+    }
+    if(m_FieldsSet.test(FieldBit_Error))
+    {
+        
+        writer.key(_XPLATSTR("error"));
+        ModelBase::writeJson(writer, m_Error);
+    }
+    if(m_FieldsSet.test(FieldBit_Count))
+    {
+        
+        writer.key(_XPLATSTR("count"));
+        ModelBase::writeJson(writer, m_Count);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_LastOccurredAt))
+    {
+        
+        writer.key(_XPLATSTR("lastOccurredAt"));
+        ModelBase::writeJson(writer, m_LastOccurredAt);
+    }
+
+    writer.endObject();
+}
+
 bool EmailTemplateRenderErrorResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("customTemplateId")):
+            if(field.first == _XPLATSTR("customTemplateId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCustomTemplateId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCustomTemplateId);
+                    setCustomTemplateId(refVal_setCustomTemplateId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("error")):
+            if(field.first == _XPLATSTR("error"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setError;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setError);
+                    setError(refVal_setError);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            if(field.first == _XPLATSTR("count"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
+                    setCount(refVal_setCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastOccurredAt")):
+            if(field.first == _XPLATSTR("lastOccurredAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setLastOccurredAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastOccurredAt);
+                    setLastOccurredAt(refVal_setLastOccurredAt);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("customTemplateId"))))
+    return ok;
+}
+
+void EmailTemplateRenderErrorResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("customTemplateId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCustomTemplateId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCustomTemplateId);
-            setCustomTemplateId(refVal_setCustomTemplateId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("error"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("error")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setError;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setError);
-            setError(refVal_setError);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("count"))))
+    if(m_FieldsSet.test(FieldBit_CustomTemplateId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("count")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
-            setCount(refVal_setCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("customTemplateId")), m_CustomTemplateId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_Error))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("error")), m_Error);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastOccurredAt"))))
+    if(m_FieldsSet.test(FieldBit_Count))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastOccurredAt")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("count")), m_Count);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_LastOccurredAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastOccurredAt")), m_LastOccurredAt);
+    }
+}
+
+bool EmailTemplateRenderErrorResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::datetime refVal_setLastOccurredAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastOccurredAt);
-            setLastOccurredAt(refVal_setLastOccurredAt);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("customTemplateId")):
+            {
+                utility::string_t refVal_setCustomTemplateId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCustomTemplateId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCustomTemplateId(refVal_setCustomTemplateId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("error")):
+            {
+                utility::string_t refVal_setError;
+                if(!ModelBase::readBinary(reader, field, refVal_setError))
+                {
+                    ok = false;
+                    continue;
+                }
+                setError(refVal_setError);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            {
+                double refVal_setCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCount(refVal_setCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastOccurredAt")):
+            {
+                utility::datetime refVal_setLastOccurredAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastOccurredAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastOccurredAt(refVal_setLastOccurredAt);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void EmailTemplateRenderErrorResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -177,31 +366,31 @@ void EmailTemplateRenderErrorResponse::toMultipart(std::shared_ptr<MultipartForm
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_CustomTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomTemplateId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customTemplateId")), m_CustomTemplateId));
     }
-    if(m_ErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_Error))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("error")), m_Error));
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("count")), m_Count));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_LastOccurredAtIsSet)
+    if(m_FieldsSet.test(FieldBit_LastOccurredAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastOccurredAt")), m_LastOccurredAt));
     }
@@ -271,17 +460,17 @@ utility::string_t EmailTemplateRenderErrorResponse::getId() const
 void EmailTemplateRenderErrorResponse::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool EmailTemplateRenderErrorResponse::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void EmailTemplateRenderErrorResponse::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 utility::string_t EmailTemplateRenderErrorResponse::getTenantId() const
 {
@@ -292,17 +481,17 @@ utility::string_t EmailTemplateRenderErrorResponse::getTenantId() const
 void EmailTemplateRenderErrorResponse::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool EmailTemplateRenderErrorResponse::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void EmailTemplateRenderErrorResponse::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t EmailTemplateRenderErrorResponse::getCustomTemplateId() const
 {
@@ -313,17 +502,17 @@ utility::string_t EmailTemplateRenderErrorResponse::getCustomTemplateId() const
 void EmailTemplateRenderErrorResponse::setCustomTemplateId(const utility::string_t& value)
 {
     m_CustomTemplateId = value;
-    m_CustomTemplateIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CustomTemplateId);
 }
 
 bool EmailTemplateRenderErrorResponse::customTemplateIdIsSet() const
 {
-    return m_CustomTemplateIdIsSet;
+    return m_FieldsSet.test(FieldBit_CustomTemplateId);
 }
 
 void EmailTemplateRenderErrorResponse::unsetCustomTemplateId()
 {
-    m_CustomTemplateIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CustomTemplateId);
 }
 utility::string_t EmailTemplateRenderErrorResponse::getError() const
 {
@@ -334,17 +523,17 @@ utility::string_t EmailTemplateRenderErrorResponse::getError() const
 void EmailTemplateRenderErrorResponse::setError(const utility::string_t& value)
 {
     m_Error = value;
-    m_ErrorIsSet = true;
+    m_FieldsSet.set(FieldBit_Error);
 }
 
 bool EmailTemplateRenderErrorResponse::errorIsSet() const
 {
-    return m_ErrorIsSet;
+    return m_FieldsSet.test(FieldBit_Error);
 }
 
 void EmailTemplateRenderErrorResponse::unsetError()
 {
-    m_ErrorIsSet = false;
+    m_FieldsSet.reset(FieldBit_Error);
 }
 double EmailTemplateRenderErrorResponse::getCount() const
 {
@@ -354,17 +543,17 @@ double EmailTemplateRenderErrorResponse::getCount() const
 void EmailTemplateRenderErrorResponse::setCount(double value)
 {
     m_Count = value;
-    m_CountIsSet = true;
+    m_FieldsSet.set(FieldBit_Count);
 }
 
 bool EmailTemplateRenderErrorResponse::countIsSet() const
 {
-    return m_CountIsSet;
+    return m_FieldsSet.test(FieldBit_Count);
 }
 
 void EmailTemplateRenderErrorResponse::unsetCount()
 {
-    m_CountIsSet = false;
+    m_FieldsSet.reset(FieldBit_Count);
 }
 utility::datetime EmailTemplateRenderErrorResponse::getCreatedAt() const
 {
@@ -375,17 +564,17 @@ utility::datetime EmailTemplateRenderErrorResponse::getCreatedAt() const
 void EmailTemplateRenderErrorResponse::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool EmailTemplateRenderErrorResponse::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void EmailTemplateRenderErrorResponse::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::datetime EmailTemplateRenderErrorResponse::getLastOccurredAt() const
 {
@@ -396,17 +585,17 @@ utility::datetime EmailTemplateRenderErrorResponse::getLastOccurredAt() const
 void EmailTemplateRenderErrorResponse::setLastOccurredAt(const utility::datetime& value)
 {
     m_LastOccurredAt = value;
-    m_LastOccurredAtIsSet = true;
+    m_FieldsSet.set(FieldBit_LastOccurredAt);
 }
 
 bool EmailTemplateRenderErrorResponse::lastOccurredAtIsSet() const
 {
-    return m_LastOccurredAtIsSet;
+    return m_FieldsSet.test(FieldBit_LastOccurredAt);
 }
 
 void EmailTemplateRenderErrorResponse::unsetLastOccurredAt()
 {
-    m_LastOccurredAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastOccurredAt);
 }
 
 }
@@ -20,83 +20,40 @@ namespace model {
 
 FComment::FComment()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_UrlIdRaw = utility::conversions::to_string_t("");
-    m_UrlIdRawIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_Comment = utility::conversions::to_string_t("");
-    m_CommentIsSet = false;
-    m_CommentHTML = utility::conversions::to_string_t("");
-    m_CommentHTMLIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
     m_NotificationSentForParent = false;
-    m_NotificationSentForParentIsSet = false;
     m_NotificationSentForParentTenant = false;
-    m_NotificationSentForParentTenantIsSet = false;
     m_Reviewed = false;
-    m_ReviewedIsSet = false;
     m_Imported = false;
-    m_ImportedIsSet = false;
-    m_ExternalId = utility::conversions::to_string_t("");
-    m_ExternalIdIsSet = false;
     m_IsSpam = false;
-    m_IsSpamIsSet = false;
     m_PermNotSpam = false;
-    m_PermNotSpamIsSet = false;
     m_AiDeterminedSpam = false;
-    m_AiDeterminedSpamIsSet = false;
     m_HasImages = false;
-    m_HasImagesIsSet = false;
     m_HasLinks = false;
-    m_HasLinksIsSet = false;
     m_HasCode = false;
-    m_HasCodeIsSet = false;
     m_Approved = false;
-    m_ApprovedIsSet = false;
     m_IsDeleted = false;
-    m_IsDeletedIsSet = false;
     m_IsDeletedUser = false;
-    m_IsDeletedUserIsSet = false;
     m_IsBannedUser = false;
-    m_IsBannedUserIsSet = false;
     m_IsByAdmin = false;
-    m_IsByAdminIsSet = false;
     m_IsByModerator = false;
-    m_IsByModeratorIsSet = false;
     m_FromProductId = 0;
-    m_FromProductIdIsSet = false;
-    m_IpHash = utility::conversions::to_string_t("");
-    m_IpHashIsSet = false;
-    m_MentionsIsSet = false;
-    m_HashTagsIsSet = false;
-    m_VeteranBadgeProcessed = utility::conversions::to_string_t("");
-    m_VeteranBadgeProcessedIsSet = false;
     m_DidProcessBadges = false;
-    m_DidProcessBadgesIsSet = false;
     m_FromOfflineRestore = false;
-    m_FromOfflineRestoreIsSet = false;
-    m_AutoplayJobId = utility::conversions::to_string_t("");
-    m_AutoplayJobIdIsSet = false;
     m_AutoplayDelayMS = 0L;
-    m_AutoplayDelayMSIsSet = false;
-    m_FeedbackIdsIsSet = false;
     m_RequiresVerification = false;
-    m_RequiresVerificationIsSet = false;
-    m_EditKey = utility::conversions::to_string_t("");
-    m_EditKeyIsSet = false;
-    m_TosAcceptedAt = utility::datetime();
-    m_TosAcceptedAtIsSet = false;
-    m_BotId = utility::conversions::to_string_t("");
-    m_BotIdIsSet = false;
+    m_LocalDateHours = 0;
+    m_Votes = 0;
+    m_VotesUp = 0;
+    m_VotesDown = 0;
+    m_PageNumber = 0;
+    m_PageNumberOF = 0;
+    m_PageNumberNF = 0;
+    m_IsPinned = false;
+    m_IsLocked = false;
+    m_FlagCount = 0;
+    m_Rating = 0.0;
+    m_ViewCount = 0L;
 }
 
 FComment::~FComment()
@@ -111,367 +68,367 @@ void FComment::validate()
 web::json::value FComment::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_UrlIdRawIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdRaw"))] = ModelBase::toJson(m_UrlIdRaw);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentHTML"))] = ModelBase::toJson(m_CommentHTML);
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId);
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
     }
-    if(m_LocalDateString.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString);
     }
-    if(m_LocalDateHours.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("localDateHours"))] = ModelBase::toJson(m_LocalDateHours.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("localDateHours"))] = ModelBase::toJson(m_LocalDateHours);
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes);
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp);
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown);
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_VerifiedDate.has_value())
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("verifiedDate"))] = ModelBase::toJson(m_VerifiedDate.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("verifiedDate"))] = ModelBase::toJson(m_VerifiedDate);
     }
-    if(m_VerificationId.has_value())
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("verificationId"))] = ModelBase::toJson(m_VerificationId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("verificationId"))] = ModelBase::toJson(m_VerificationId);
     }
-    if(m_NotificationSentForParentIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent"))] = ModelBase::toJson(m_NotificationSentForParent);
     }
-    if(m_NotificationSentForParentTenantIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant"))] = ModelBase::toJson(m_NotificationSentForParentTenant);
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewed"))] = ModelBase::toJson(m_Reviewed);
     }
-    if(m_ImportedIsSet)
+    if(m_FieldsSet.test(FieldBit_Imported))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("imported"))] = ModelBase::toJson(m_Imported);
     }
-    if(m_ExternalIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("externalId"))] = ModelBase::toJson(m_ExternalId);
     }
-    if(m_ExternalParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("externalParentId"))] = ModelBase::toJson(m_ExternalParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("externalParentId"))] = ModelBase::toJson(m_ExternalParentId);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSpam"))] = ModelBase::toJson(m_IsSpam);
     }
-    if(m_PermNotSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("permNotSpam"))] = ModelBase::toJson(m_PermNotSpam);
     }
-    if(m_AiDeterminedSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam"))] = ModelBase::toJson(m_AiDeterminedSpam);
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasImages"))] = ModelBase::toJson(m_HasImages);
     }
-    if(m_PageNumber.has_value())
+    if(m_FieldsSet.test(FieldBit_PageNumber))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageNumber"))] = ModelBase::toJson(m_PageNumber.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageNumber"))] = ModelBase::toJson(m_PageNumber);
     }
-    if(m_PageNumberOF.has_value())
+    if(m_FieldsSet.test(FieldBit_PageNumberOF))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageNumberOF"))] = ModelBase::toJson(m_PageNumberOF.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageNumberOF"))] = ModelBase::toJson(m_PageNumberOF);
     }
-    if(m_PageNumberNF.has_value())
+    if(m_FieldsSet.test(FieldBit_PageNumberNF))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageNumberNF"))] = ModelBase::toJson(m_PageNumberNF.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageNumberNF"))] = ModelBase::toJson(m_PageNumberNF);
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasLinks"))] = ModelBase::toJson(m_HasLinks);
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasCode"))] = ModelBase::toJson(m_HasCode);
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approved"))] = ModelBase::toJson(m_Approved);
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeleted"))] = ModelBase::toJson(m_IsDeleted);
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))] = ModelBase::toJson(m_IsDeletedUser);
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))] = ModelBase::toJson(m_IsBannedUser);
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))] = ModelBase::toJson(m_IsByAdmin);
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByModerator"))] = ModelBase::toJson(m_IsByModerator);
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned);
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked);
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount);
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating);
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_FromProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromProductId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromProductId"))] = ModelBase::toJson(m_FromProductId);
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
-    if(m_IpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ipHash"))] = ModelBase::toJson(m_IpHash);
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("mentions"))] = ModelBase::toJson(m_Mentions);
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTags"))] = ModelBase::toJson(m_HashTags);
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_VeteranBadgeProcessedIsSet)
+    if(m_FieldsSet.test(FieldBit_VeteranBadgeProcessed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("veteranBadgeProcessed"))] = ModelBase::toJson(m_VeteranBadgeProcessed);
     }
-    if(m_ModerationGroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds);
     }
-    if(m_DidProcessBadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_DidProcessBadges))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("didProcessBadges"))] = ModelBase::toJson(m_DidProcessBadges);
     }
-    if(m_FromOfflineRestoreIsSet)
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore"))] = ModelBase::toJson(m_FromOfflineRestore);
     }
-    if(m_AutoplayJobIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayJobId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoplayJobId"))] = ModelBase::toJson(m_AutoplayJobId);
     }
-    if(m_AutoplayDelayMSIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS"))] = ModelBase::toJson(m_AutoplayDelayMS);
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))] = ModelBase::toJson(m_FeedbackIds);
     }
-    if(m_Logs.has_value())
+    if(m_FieldsSet.test(FieldBit_Logs))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("logs"))] = ModelBase::toJson(m_Logs.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("logs"))] = ModelBase::toJson(m_Logs);
     }
-    if(m_GroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("groupIds"))] = ModelBase::toJson(m_GroupIds.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("groupIds"))] = ModelBase::toJson(m_GroupIds);
     }
-    if(m_ViewCount.has_value())
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("viewCount"))] = ModelBase::toJson(m_ViewCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("viewCount"))] = ModelBase::toJson(m_ViewCount);
     }
-    if(m_RequiresVerificationIsSet)
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("requiresVerification"))] = ModelBase::toJson(m_RequiresVerification);
     }
-    if(m_EditKeyIsSet)
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("editKey"))] = ModelBase::toJson(m_EditKey);
     }
-    if(m_TosAcceptedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt"))] = ModelBase::toJson(m_TosAcceptedAt);
     }
-    if(m_BotIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BotId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("botId"))] = ModelBase::toJson(m_BotId);
@@ -480,813 +437,2519 @@ web::json::value FComment::toJson() const
     return val;
 }
 
+void FComment::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
+    {
+        
+        writer.key(_XPLATSTR("urlIdRaw"));
+        ModelBase::writeJson(writer, m_UrlIdRaw);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
+    {
+        
+        writer.key(_XPLATSTR("commenterEmail"));
+        ModelBase::writeJson(writer, m_CommenterEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
+    {
+        
+        writer.key(_XPLATSTR("commenterLink"));
+        ModelBase::writeJson(writer, m_CommenterLink);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
+    {
+        
+        writer.key(_XPLATSTR("commentHTML"));
+        ModelBase::writeJson(writer, m_CommentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_ParentId))
+    {
+        
+        writer.key(_XPLATSTR("parentId"));
+        ModelBase::writeJson(writer, m_ParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
+    {
+        
+        writer.key(_XPLATSTR("localDateString"));
+        ModelBase::writeJson(writer, m_LocalDateString);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
+    {
+        
+        writer.key(_XPLATSTR("localDateHours"));
+        ModelBase::writeJson(writer, m_LocalDateHours);
+    }
+    if(m_FieldsSet.test(FieldBit_Votes))
+    {
+        
+        writer.key(_XPLATSTR("votes"));
+        ModelBase::writeJson(writer, m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        writer.key(_XPLATSTR("votesUp"));
+        ModelBase::writeJson(writer, m_VotesUp);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        writer.key(_XPLATSTR("votesDown"));
+        ModelBase::writeJson(writer, m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
+    {
+        
+        writer.key(_XPLATSTR("expireAt"));
+        ModelBase::writeJson(writer, m_ExpireAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
+    {
+        
+        writer.key(_XPLATSTR("verifiedDate"));
+        ModelBase::writeJson(writer, m_VerifiedDate);
+    }
+    if(m_FieldsSet.test(FieldBit_VerificationId))
+    {
+        
+        writer.key(_XPLATSTR("verificationId"));
+        ModelBase::writeJson(writer, m_VerificationId);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
+    {
+        
+        writer.key(_XPLATSTR("notificationSentForParent"));
+        ModelBase::writeJson(writer, m_NotificationSentForParent);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
+    {
+        
+        writer.key(_XPLATSTR("notificationSentForParentTenant"));
+        ModelBase::writeJson(writer, m_NotificationSentForParentTenant);
+    }
+    if(m_FieldsSet.test(FieldBit_Reviewed))
+    {
+        
+        writer.key(_XPLATSTR("reviewed"));
+        ModelBase::writeJson(writer, m_Reviewed);
+    }
+    if(m_FieldsSet.test(FieldBit_Imported))
+    {
+        
+        writer.key(_XPLATSTR("imported"));
+        ModelBase::writeJson(writer, m_Imported);
+    }
+    if(m_FieldsSet.test(FieldBit_ExternalId))
+    {
+        
+        writer.key(_XPLATSTR("externalId"));
+        ModelBase::writeJson(writer, m_ExternalId);
+    }
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
+    {
+        
+        writer.key(_XPLATSTR("externalParentId"));
+        ModelBase::writeJson(writer, m_ExternalParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSpam))
+    {
+        
+        writer.key(_XPLATSTR("isSpam"));
+        ModelBase::writeJson(writer, m_IsSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
+    {
+        
+        writer.key(_XPLATSTR("permNotSpam"));
+        ModelBase::writeJson(writer, m_PermNotSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
+    {
+        
+        writer.key(_XPLATSTR("aiDeterminedSpam"));
+        ModelBase::writeJson(writer, m_AiDeterminedSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_HasImages))
+    {
+        
+        writer.key(_XPLATSTR("hasImages"));
+        ModelBase::writeJson(writer, m_HasImages);
+    }
+    if(m_FieldsSet.test(FieldBit_PageNumber))
+    {
+        
+        writer.key(_XPLATSTR("pageNumber"));
+        ModelBase::writeJson(writer, m_PageNumber);
+    }
+    if(m_FieldsSet.test(FieldBit_PageNumberOF))
+    {
+        
+        writer.key(_XPLATSTR("pageNumberOF"));
+        ModelBase::writeJson(writer, m_PageNumberOF);
+    }
+    if(m_FieldsSet.test(FieldBit_PageNumberNF))
+    {
+        
+        writer.key(_XPLATSTR("pageNumberNF"));
+        ModelBase::writeJson(writer, m_PageNumberNF);
+    }
+    if(m_FieldsSet.test(FieldBit_HasLinks))
+    {
+        
+        writer.key(_XPLATSTR("hasLinks"));
+        ModelBase::writeJson(writer, m_HasLinks);
+    }
+    if(m_FieldsSet.test(FieldBit_HasCode))
+    {
+        
+        writer.key(_XPLATSTR("hasCode"));
+        ModelBase::writeJson(writer, m_HasCode);
+    }
+    if(m_FieldsSet.test(FieldBit_Approved))
+    {
+        
+        writer.key(_XPLATSTR("approved"));
+        ModelBase::writeJson(writer, m_Approved);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
+    {
+        
+        writer.key(_XPLATSTR("isDeleted"));
+        ModelBase::writeJson(writer, m_IsDeleted);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
+    {
+        
+        writer.key(_XPLATSTR("isDeletedUser"));
+        ModelBase::writeJson(writer, m_IsDeletedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
+    {
+        
+        writer.key(_XPLATSTR("isBannedUser"));
+        ModelBase::writeJson(writer, m_IsBannedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isByAdmin"));
+        ModelBase::writeJson(writer, m_IsByAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
+    {
+        
+        writer.key(_XPLATSTR("isByModerator"));
+        ModelBase::writeJson(writer, m_IsByModerator);
+    }
+    if(m_FieldsSet.test(FieldBit_IsPinned))
+    {
+        
+        writer.key(_XPLATSTR("isPinned"));
+        ModelBase::writeJson(writer, m_IsPinned);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLocked))
+    {
+        
+        writer.key(_XPLATSTR("isLocked"));
+        ModelBase::writeJson(writer, m_IsLocked);
+    }
+    if(m_FieldsSet.test(FieldBit_FlagCount))
+    {
+        
+        writer.key(_XPLATSTR("flagCount"));
+        ModelBase::writeJson(writer, m_FlagCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Rating))
+    {
+        
+        writer.key(_XPLATSTR("rating"));
+        ModelBase::writeJson(writer, m_Rating);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_FromProductId))
+    {
+        
+        writer.key(_XPLATSTR("fromProductId"));
+        ModelBase::writeJson(writer, m_FromProductId);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHash))
+    {
+        
+        writer.key(_XPLATSTR("ipHash"));
+        ModelBase::writeJson(writer, m_IpHash);
+    }
+    if(m_FieldsSet.test(FieldBit_Mentions))
+    {
+        
+        writer.key(_XPLATSTR("mentions"));
+        ModelBase::writeJson(writer, m_Mentions);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTags))
+    {
+        
+        writer.key(_XPLATSTR("hashTags"));
+        ModelBase::writeJson(writer, m_HashTags);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_VeteranBadgeProcessed))
+    {
+        
+        writer.key(_XPLATSTR("veteranBadgeProcessed"));
+        ModelBase::writeJson(writer, m_VeteranBadgeProcessed);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("moderationGroupIds"));
+        ModelBase::writeJson(writer, m_ModerationGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_DidProcessBadges))
+    {
+        
+        writer.key(_XPLATSTR("didProcessBadges"));
+        ModelBase::writeJson(writer, m_DidProcessBadges);
+    }
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
+    {
+        
+        writer.key(_XPLATSTR("fromOfflineRestore"));
+        ModelBase::writeJson(writer, m_FromOfflineRestore);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoplayJobId))
+    {
+        
+        writer.key(_XPLATSTR("autoplayJobId"));
+        ModelBase::writeJson(writer, m_AutoplayJobId);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
+    {
+        
+        writer.key(_XPLATSTR("autoplayDelayMS"));
+        ModelBase::writeJson(writer, m_AutoplayDelayMS);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        writer.key(_XPLATSTR("feedbackIds"));
+        ModelBase::writeJson(writer, m_FeedbackIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Logs))
+    {
+        
+        writer.key(_XPLATSTR("logs"));
+        ModelBase::writeJson(writer, m_Logs);
+    }
+    if(m_FieldsSet.test(FieldBit_GroupIds))
+    {
+        
+        writer.key(_XPLATSTR("groupIds"));
+        ModelBase::writeJson(writer, m_GroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_ViewCount))
+    {
+        
+        writer.key(_XPLATSTR("viewCount"));
+        ModelBase::writeJson(writer, m_ViewCount);
+    }
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
+    {
+        
+        writer.key(_XPLATSTR("requiresVerification"));
+        ModelBase::writeJson(writer, m_RequiresVerification);
+    }
+    if(m_FieldsSet.test(FieldBit_EditKey))
+    {
+        
+        writer.key(_XPLATSTR("editKey"));
+        ModelBase::writeJson(writer, m_EditKey);
+    }
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
+    {
+        
+        writer.key(_XPLATSTR("tosAcceptedAt"));
+        ModelBase::writeJson(writer, m_TosAcceptedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_BotId))
+    {
+        
+        writer.key(_XPLATSTR("botId"));
+        ModelBase::writeJson(writer, m_BotId);
+    }
+
+    writer.endObject();
+}
+
 bool FComment::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_TenantId);
+                    m_FieldsSet.set(FieldBit_TenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_UrlId);
+                    m_FieldsSet.set(FieldBit_UrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdRaw")):
+            if(field.first == _XPLATSTR("urlIdRaw"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_UrlIdRaw);
+                    m_FieldsSet.set(FieldBit_UrlIdRaw);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_Url);
+                    m_FieldsSet.set(FieldBit_Url);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_PageTitle);
+                    m_FieldsSet.set(FieldBit_PageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            if(field.first == _XPLATSTR("commenterEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
+                    setCommenterEmail(refVal_setCommenterEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_CommenterName);
+                    m_FieldsSet.set(FieldBit_CommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            if(field.first == _XPLATSTR("commenterLink"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterLink;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
+                    setCommenterLink(refVal_setCommenterLink);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            if(field.first == _XPLATSTR("commentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
+                    setCommentHTML(refVal_setCommentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            if(field.first == _XPLATSTR("parentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
+                    setParentId(refVal_setParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            if(field.first == _XPLATSTR("localDateString"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocalDateString;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
+                    setLocalDateString(refVal_setLocalDateString);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            if(field.first == _XPLATSTR("localDateHours"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setLocalDateHours;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
+                    setLocalDateHours(refVal_setLocalDateHours);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            if(field.first == _XPLATSTR("votes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
+                    setVotes(refVal_setVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            if(field.first == _XPLATSTR("votesUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
+                    setVotesUp(refVal_setVotesUp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            if(field.first == _XPLATSTR("votesDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
+                    setVotesDown(refVal_setVotesDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            if(field.first == _XPLATSTR("expireAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setExpireAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
+                    setExpireAt(refVal_setExpireAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verifiedDate")):
+            if(field.first == _XPLATSTR("verifiedDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setVerifiedDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerifiedDate);
+                    setVerifiedDate(refVal_setVerifiedDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verificationId")):
+            if(field.first == _XPLATSTR("verificationId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setVerificationId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerificationId);
+                    setVerificationId(refVal_setVerificationId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParent")):
+            if(field.first == _XPLATSTR("notificationSentForParent"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNotificationSentForParent;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParent);
+                    setNotificationSentForParent(refVal_setNotificationSentForParent);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParentTenant")):
+            if(field.first == _XPLATSTR("notificationSentForParentTenant"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNotificationSentForParentTenant;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParentTenant);
+                    setNotificationSentForParentTenant(refVal_setNotificationSentForParentTenant);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            if(field.first == _XPLATSTR("reviewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
+                    setReviewed(refVal_setReviewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("imported")):
+            if(field.first == _XPLATSTR("imported"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setImported;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setImported);
+                    setImported(refVal_setImported);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("externalId")):
+            if(field.first == _XPLATSTR("externalId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setExternalId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExternalId);
+                    setExternalId(refVal_setExternalId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("externalParentId")):
+            if(field.first == _XPLATSTR("externalParentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setExternalParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExternalParentId);
+                    setExternalParentId(refVal_setExternalParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_AvatarSrc);
+                    m_FieldsSet.set(FieldBit_AvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            if(field.first == _XPLATSTR("isSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
+                    setIsSpam(refVal_setIsSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("permNotSpam")):
+            if(field.first == _XPLATSTR("permNotSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setPermNotSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPermNotSpam);
+                    setPermNotSpam(refVal_setPermNotSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("aiDeterminedSpam")):
+            if(field.first == _XPLATSTR("aiDeterminedSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAiDeterminedSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAiDeterminedSpam);
+                    setAiDeterminedSpam(refVal_setAiDeterminedSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            if(field.first == _XPLATSTR("hasImages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasImages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
+                    setHasImages(refVal_setHasImages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumber")):
+            if(field.first == _XPLATSTR("pageNumber"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setPageNumber;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumber);
+                    setPageNumber(refVal_setPageNumber);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumberOF")):
+            if(field.first == _XPLATSTR("pageNumberOF"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setPageNumberOF;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumberOF);
+                    setPageNumberOF(refVal_setPageNumberOF);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumberNF")):
+            if(field.first == _XPLATSTR("pageNumberNF"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setPageNumberNF;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumberNF);
+                    setPageNumberNF(refVal_setPageNumberNF);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            if(field.first == _XPLATSTR("hasLinks"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
+                    setHasLinks(refVal_setHasLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            if(field.first == _XPLATSTR("hasCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
+                    setHasCode(refVal_setHasCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            if(field.first == _XPLATSTR("approved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
+                    setApproved(refVal_setApproved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            if(field.first == _XPLATSTR("isDeleted"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeleted;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
+                    setIsDeleted(refVal_setIsDeleted);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            if(field.first == _XPLATSTR("isDeletedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeletedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
+                    setIsDeletedUser(refVal_setIsDeletedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            if(field.first == _XPLATSTR("isBannedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsBannedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
+                    setIsBannedUser(refVal_setIsBannedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            if(field.first == _XPLATSTR("isByAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
+                    setIsByAdmin(refVal_setIsByAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            if(field.first == _XPLATSTR("isByModerator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByModerator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
+                    setIsByModerator(refVal_setIsByModerator);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            if(field.first == _XPLATSTR("isPinned"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsPinned;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
+                    setIsPinned(refVal_setIsPinned);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            if(field.first == _XPLATSTR("isLocked"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLocked;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
+                    setIsLocked(refVal_setIsLocked);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            if(field.first == _XPLATSTR("flagCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setFlagCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
+                    setFlagCount(refVal_setFlagCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            if(field.first == _XPLATSTR("rating"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setRating;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
+                    setRating(refVal_setRating);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromProductId")):
+            if(field.first == _XPLATSTR("fromProductId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setFromProductId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromProductId);
+                    setFromProductId(refVal_setFromProductId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<FComment_meta> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            if(field.first == _XPLATSTR("ipHash"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setIpHash;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
+                    setIpHash(refVal_setIpHash);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            if(field.first == _XPLATSTR("mentions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
+                    setMentions(refVal_setMentions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            if(field.first == _XPLATSTR("hashTags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
+                    setHashTags(refVal_setHashTags);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("veteranBadgeProcessed")):
+            if(field.first == _XPLATSTR("veteranBadgeProcessed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setVeteranBadgeProcessed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVeteranBadgeProcessed);
+                    setVeteranBadgeProcessed(refVal_setVeteranBadgeProcessed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            if(field.first == _XPLATSTR("moderationGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModerationGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
+                    setModerationGroupIds(refVal_setModerationGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("didProcessBadges")):
+            if(field.first == _XPLATSTR("didProcessBadges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDidProcessBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDidProcessBadges);
+                    setDidProcessBadges(refVal_setDidProcessBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")):
+            if(field.first == _XPLATSTR("fromOfflineRestore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setFromOfflineRestore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromOfflineRestore);
+                    setFromOfflineRestore(refVal_setFromOfflineRestore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayJobId")):
+            if(field.first == _XPLATSTR("autoplayJobId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAutoplayJobId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayJobId);
+                    setAutoplayJobId(refVal_setAutoplayJobId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")):
+            if(field.first == _XPLATSTR("autoplayDelayMS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setAutoplayDelayMS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayDelayMS);
+                    setAutoplayDelayMS(refVal_setAutoplayDelayMS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            if(field.first == _XPLATSTR("feedbackIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
+                    setFeedbackIds(refVal_setFeedbackIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("logs")):
+            if(field.first == _XPLATSTR("logs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentLogEntry>> refVal_setLogs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLogs);
+                    setLogs(refVal_setLogs);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            if(field.first == _XPLATSTR("groupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
+                    setGroupIds(refVal_setGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("viewCount")):
+            if(field.first == _XPLATSTR("viewCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setViewCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setViewCount);
+                    setViewCount(refVal_setViewCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("requiresVerification")):
+            if(field.first == _XPLATSTR("requiresVerification"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setRequiresVerification;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRequiresVerification);
+                    setRequiresVerification(refVal_setRequiresVerification);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("editKey")):
+            if(field.first == _XPLATSTR("editKey"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEditKey;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEditKey);
+                    setEditKey(refVal_setEditKey);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tosAcceptedAt")):
+            if(field.first == _XPLATSTR("tosAcceptedAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setTosAcceptedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTosAcceptedAt);
+                    setTosAcceptedAt(refVal_setTosAcceptedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("botId")):
+            if(field.first == _XPLATSTR("botId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBotId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBotId);
+                    setBotId(refVal_setBotId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    return ok;
+}
+
+void FComment::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdRaw"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdRaw")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdRaw;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdRaw);
-            setUrlIdRaw(refVal_setUrlIdRaw);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdRaw")), m_UrlIdRaw);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
-            setCommenterEmail(refVal_setCommenterEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterLink"))))
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterLink")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterLink;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
-            setCommenterLink(refVal_setCommenterLink);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterEmail")), m_CommenterEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentHTML"))))
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentHTML")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
-            setCommentHTML(refVal_setCommentHTML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterLink")), m_CommenterLink);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("parentId"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("parentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
-            setParentId(refVal_setParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentHTML")), m_CommentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateString"))))
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateString")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocalDateString;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
-            setLocalDateString(refVal_setLocalDateString);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("parentId")), m_ParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateHours"))))
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateHours")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setLocalDateHours;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateHours);
-            setLocalDateHours(refVal_setLocalDateHours);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votes"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votes")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
-            setVotes(refVal_setVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateString")), m_LocalDateString);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUp"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUp")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
-            setVotesUp(refVal_setVotesUp);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateHours")), m_LocalDateHours);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDown"))))
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDown")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
-            setVotesDown(refVal_setVotesDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votes")), m_Votes);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expireAt"))))
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expireAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setExpireAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
-            setExpireAt(refVal_setExpireAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUp")), m_VotesUp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDown")), m_VotesDown);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verifiedDate"))))
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verifiedDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setVerifiedDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerifiedDate);
-            setVerifiedDate(refVal_setVerifiedDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expireAt")), m_ExpireAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verificationId"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verificationId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setVerificationId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerificationId);
-            setVerificationId(refVal_setVerificationId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent"))))
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNotificationSentForParent;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParent);
-            setNotificationSentForParent(refVal_setNotificationSentForParent);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verifiedDate")), m_VerifiedDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant"))))
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNotificationSentForParentTenant;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationSentForParentTenant);
-            setNotificationSentForParentTenant(refVal_setNotificationSentForParentTenant);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verificationId")), m_VerificationId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewed"))))
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
-            setReviewed(refVal_setReviewed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationSentForParent")), m_NotificationSentForParent);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("imported"))))
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("imported")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setImported;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setImported);
-            setImported(refVal_setImported);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationSentForParentTenant")), m_NotificationSentForParentTenant);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("externalId"))))
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("externalId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setExternalId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExternalId);
-            setExternalId(refVal_setExternalId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewed")), m_Reviewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("externalParentId"))))
+    if(m_FieldsSet.test(FieldBit_Imported))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("externalParentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setExternalParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExternalParentId);
-            setExternalParentId(refVal_setExternalParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("imported")), m_Imported);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("externalId")), m_ExternalId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSpam"))))
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
-            setIsSpam(refVal_setIsSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("externalParentId")), m_ExternalParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("permNotSpam"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("permNotSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setPermNotSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPermNotSpam);
-            setPermNotSpam(refVal_setPermNotSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam"))))
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAiDeterminedSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAiDeterminedSpam);
-            setAiDeterminedSpam(refVal_setAiDeterminedSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSpam")), m_IsSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasImages"))))
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasImages")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasImages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
-            setHasImages(refVal_setHasImages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("permNotSpam")), m_PermNotSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageNumber"))))
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageNumber")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setPageNumber;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumber);
-            setPageNumber(refVal_setPageNumber);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("aiDeterminedSpam")), m_AiDeterminedSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageNumberOF"))))
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageNumberOF")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setPageNumberOF;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumberOF);
-            setPageNumberOF(refVal_setPageNumberOF);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasImages")), m_HasImages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageNumberNF"))))
+    if(m_FieldsSet.test(FieldBit_PageNumber))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageNumberNF")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setPageNumberNF;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumberNF);
-            setPageNumberNF(refVal_setPageNumberNF);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageNumber")), m_PageNumber);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasLinks"))))
+    if(m_FieldsSet.test(FieldBit_PageNumberOF))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasLinks")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
-            setHasLinks(refVal_setHasLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageNumberOF")), m_PageNumberOF);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasCode"))))
+    if(m_FieldsSet.test(FieldBit_PageNumberNF))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasCode")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
-            setHasCode(refVal_setHasCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageNumberNF")), m_PageNumberNF);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approved"))))
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approved")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
-            setApproved(refVal_setApproved);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasLinks")), m_HasLinks);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasCode")), m_HasCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeleted"))))
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeleted")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeleted;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
-            setIsDeleted(refVal_setIsDeleted);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approved")), m_Approved);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeletedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
-            setIsDeletedUser(refVal_setIsDeletedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))))
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isBannedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsBannedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
-            setIsBannedUser(refVal_setIsBannedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeleted")), m_IsDeleted);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
-            setIsByAdmin(refVal_setIsByAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeletedUser")), m_IsDeletedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByModerator"))))
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByModerator")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByModerator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
-            setIsByModerator(refVal_setIsByModerator);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isBannedUser")), m_IsBannedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isPinned"))))
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isPinned")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsPinned;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
-            setIsPinned(refVal_setIsPinned);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByAdmin")), m_IsByAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLocked"))))
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLocked")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLocked;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
-            setIsLocked(refVal_setIsLocked);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByModerator")), m_IsByModerator);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flagCount"))))
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flagCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setFlagCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
-            setFlagCount(refVal_setFlagCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isPinned")), m_IsPinned);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rating"))))
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rating")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setRating;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
-            setRating(refVal_setRating);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLocked")), m_IsLocked);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flagCount")), m_FlagCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromProductId"))))
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromProductId")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setFromProductId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromProductId);
-            setFromProductId(refVal_setFromProductId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rating")), m_Rating);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<FComment_meta> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ipHash"))))
+    if(m_FieldsSet.test(FieldBit_FromProductId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ipHash")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setIpHash;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
-            setIpHash(refVal_setIpHash);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromProductId")), m_FromProductId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("mentions"))))
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("mentions")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMentions);
-            setMentions(refVal_setMentions);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTags"))))
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTags")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTags);
-            setHashTags(refVal_setHashTags);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ipHash")), m_IpHash);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("mentions")), m_Mentions);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTags")), m_HashTags);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("veteranBadgeProcessed"))))
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("veteranBadgeProcessed")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setVeteranBadgeProcessed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVeteranBadgeProcessed);
-            setVeteranBadgeProcessed(refVal_setVeteranBadgeProcessed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModerationGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
-            setModerationGroupIds(refVal_setModerationGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("didProcessBadges"))))
+    if(m_FieldsSet.test(FieldBit_VeteranBadgeProcessed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("didProcessBadges")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDidProcessBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDidProcessBadges);
-            setDidProcessBadges(refVal_setDidProcessBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("veteranBadgeProcessed")), m_VeteranBadgeProcessed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore"))))
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setFromOfflineRestore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromOfflineRestore);
-            setFromOfflineRestore(refVal_setFromOfflineRestore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoplayJobId"))))
+    if(m_FieldsSet.test(FieldBit_DidProcessBadges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoplayJobId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAutoplayJobId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayJobId);
-            setAutoplayJobId(refVal_setAutoplayJobId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("didProcessBadges")), m_DidProcessBadges);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS"))))
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setAutoplayDelayMS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoplayDelayMS);
-            setAutoplayDelayMS(refVal_setAutoplayDelayMS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")), m_FromOfflineRestore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))))
+    if(m_FieldsSet.test(FieldBit_AutoplayJobId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
-            setFeedbackIds(refVal_setFeedbackIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoplayJobId")), m_AutoplayJobId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("logs"))))
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("logs")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentLogEntry>> refVal_setLogs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLogs);
-            setLogs(refVal_setLogs);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")), m_AutoplayDelayMS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("groupIds"))))
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("groupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
-            setGroupIds(refVal_setGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackIds")), m_FeedbackIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("viewCount"))))
+    if(m_FieldsSet.test(FieldBit_Logs))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("viewCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setViewCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setViewCount);
-            setViewCount(refVal_setViewCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("logs")), m_Logs);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("requiresVerification"))))
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("requiresVerification")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setRequiresVerification;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRequiresVerification);
-            setRequiresVerification(refVal_setRequiresVerification);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("groupIds")), m_GroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("editKey"))))
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("editKey")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEditKey;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEditKey);
-            setEditKey(refVal_setEditKey);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("viewCount")), m_ViewCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt"))))
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setTosAcceptedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTosAcceptedAt);
-            setTosAcceptedAt(refVal_setTosAcceptedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("requiresVerification")), m_RequiresVerification);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("botId"))))
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("botId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("editKey")), m_EditKey);
+    }
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tosAcceptedAt")), m_TosAcceptedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_BotId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("botId")), m_BotId);
+    }
+}
+
+bool FComment::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setBotId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBotId);
-            setBotId(refVal_setBotId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_TenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_TenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_UrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_UrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdRaw")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_UrlIdRaw))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_UrlIdRaw);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_Url))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_Url);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_PageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_PageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            {
+                utility::string_t refVal_setCommenterEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterEmail(refVal_setCommenterEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_CommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_CommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            {
+                utility::string_t refVal_setCommenterLink;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterLink))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterLink(refVal_setCommenterLink);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                utility::string_t refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            {
+                utility::string_t refVal_setCommentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentHTML(refVal_setCommentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            {
+                utility::string_t refVal_setParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setParentId(refVal_setParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                utility::datetime refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            {
+                utility::string_t refVal_setLocalDateString;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateString))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateString(refVal_setLocalDateString);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateHours")):
+            {
+                int32_t refVal_setLocalDateHours;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateHours))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateHours(refVal_setLocalDateHours);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            {
+                int32_t refVal_setVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotes(refVal_setVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            {
+                int32_t refVal_setVotesUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUp(refVal_setVotesUp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            {
+                int32_t refVal_setVotesDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDown(refVal_setVotesDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            {
+                utility::datetime refVal_setExpireAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpireAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpireAt(refVal_setExpireAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verifiedDate")):
+            {
+                utility::datetime refVal_setVerifiedDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerifiedDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerifiedDate(refVal_setVerifiedDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verificationId")):
+            {
+                utility::string_t refVal_setVerificationId;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerificationId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerificationId(refVal_setVerificationId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParent")):
+            {
+                bool refVal_setNotificationSentForParent;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationSentForParent))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationSentForParent(refVal_setNotificationSentForParent);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationSentForParentTenant")):
+            {
+                bool refVal_setNotificationSentForParentTenant;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationSentForParentTenant))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationSentForParentTenant(refVal_setNotificationSentForParentTenant);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            {
+                bool refVal_setReviewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewed(refVal_setReviewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("imported")):
+            {
+                bool refVal_setImported;
+                if(!ModelBase::readBinary(reader, field, refVal_setImported))
+                {
+                    ok = false;
+                    continue;
+                }
+                setImported(refVal_setImported);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("externalId")):
+            {
+                utility::string_t refVal_setExternalId;
+                if(!ModelBase::readBinary(reader, field, refVal_setExternalId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExternalId(refVal_setExternalId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("externalParentId")):
+            {
+                utility::string_t refVal_setExternalParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setExternalParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExternalParentId(refVal_setExternalParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_AvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_AvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            {
+                bool refVal_setIsSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSpam(refVal_setIsSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("permNotSpam")):
+            {
+                bool refVal_setPermNotSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setPermNotSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPermNotSpam(refVal_setPermNotSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("aiDeterminedSpam")):
+            {
+                bool refVal_setAiDeterminedSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setAiDeterminedSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAiDeterminedSpam(refVal_setAiDeterminedSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            {
+                bool refVal_setHasImages;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasImages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasImages(refVal_setHasImages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumber")):
+            {
+                int32_t refVal_setPageNumber;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageNumber))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageNumber(refVal_setPageNumber);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumberOF")):
+            {
+                int32_t refVal_setPageNumberOF;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageNumberOF))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageNumberOF(refVal_setPageNumberOF);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumberNF")):
+            {
+                int32_t refVal_setPageNumberNF;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageNumberNF))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageNumberNF(refVal_setPageNumberNF);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            {
+                bool refVal_setHasLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasLinks(refVal_setHasLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            {
+                bool refVal_setHasCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasCode(refVal_setHasCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            {
+                bool refVal_setApproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setApproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApproved(refVal_setApproved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            {
+                bool refVal_setIsDeleted;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeleted))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeleted(refVal_setIsDeleted);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            {
+                bool refVal_setIsDeletedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeletedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeletedUser(refVal_setIsDeletedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            {
+                bool refVal_setIsBannedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsBannedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsBannedUser(refVal_setIsBannedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            {
+                bool refVal_setIsByAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByAdmin(refVal_setIsByAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            {
+                bool refVal_setIsByModerator;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByModerator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByModerator(refVal_setIsByModerator);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            {
+                bool refVal_setIsPinned;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsPinned))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsPinned(refVal_setIsPinned);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            {
+                bool refVal_setIsLocked;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLocked))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLocked(refVal_setIsLocked);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            {
+                int32_t refVal_setFlagCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlagCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlagCount(refVal_setFlagCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            {
+                double refVal_setRating;
+                if(!ModelBase::readBinary(reader, field, refVal_setRating))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRating(refVal_setRating);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromProductId")):
+            {
+                int32_t refVal_setFromProductId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromProductId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromProductId(refVal_setFromProductId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::shared_ptr<FComment_meta> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            {
+                utility::string_t refVal_setIpHash;
+                if(!ModelBase::readBinary(reader, field, refVal_setIpHash))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIpHash(refVal_setIpHash);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("mentions")):
+            {
+                std::vector<std::shared_ptr<CommentUserMentionInfo>> refVal_setMentions;
+                if(!ModelBase::readBinary(reader, field, refVal_setMentions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMentions(refVal_setMentions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTags")):
+            {
+                std::vector<std::shared_ptr<CommentUserHashTagInfo>> refVal_setHashTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTags(refVal_setHashTags);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("veteranBadgeProcessed")):
+            {
+                utility::string_t refVal_setVeteranBadgeProcessed;
+                if(!ModelBase::readBinary(reader, field, refVal_setVeteranBadgeProcessed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVeteranBadgeProcessed(refVal_setVeteranBadgeProcessed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setModerationGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationGroupIds(refVal_setModerationGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("didProcessBadges")):
+            {
+                bool refVal_setDidProcessBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setDidProcessBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDidProcessBadges(refVal_setDidProcessBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromOfflineRestore")):
+            {
+                bool refVal_setFromOfflineRestore;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromOfflineRestore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromOfflineRestore(refVal_setFromOfflineRestore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayJobId")):
+            {
+                utility::string_t refVal_setAutoplayJobId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoplayJobId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoplayJobId(refVal_setAutoplayJobId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoplayDelayMS")):
+            {
+                int64_t refVal_setAutoplayDelayMS;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoplayDelayMS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoplayDelayMS(refVal_setAutoplayDelayMS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackIds(refVal_setFeedbackIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("logs")):
+            {
+                std::vector<std::shared_ptr<CommentLogEntry>> refVal_setLogs;
+                if(!ModelBase::readBinary(reader, field, refVal_setLogs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLogs(refVal_setLogs);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            {
+                std::vector<utility::string_t> refVal_setGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGroupIds(refVal_setGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("viewCount")):
+            {
+                int64_t refVal_setViewCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setViewCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setViewCount(refVal_setViewCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("requiresVerification")):
+            {
+                bool refVal_setRequiresVerification;
+                if(!ModelBase::readBinary(reader, field, refVal_setRequiresVerification))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRequiresVerification(refVal_setRequiresVerification);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("editKey")):
+            {
+                utility::string_t refVal_setEditKey;
+                if(!ModelBase::readBinary(reader, field, refVal_setEditKey))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEditKey(refVal_setEditKey);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tosAcceptedAt")):
+            {
+                utility::datetime refVal_setTosAcceptedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setTosAcceptedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTosAcceptedAt(refVal_setTosAcceptedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("botId")):
+            {
+                utility::string_t refVal_setBotId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBotId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBotId(refVal_setBotId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -1296,295 +2959,295 @@ void FComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const u
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_UrlIdRawIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdRaw")), m_UrlIdRaw));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentHTML")), m_CommentHTML));
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId));
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
-    if(m_LocalDateString.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString));
     }
-    if(m_LocalDateHours.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateHours))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateHours")), m_LocalDateHours.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateHours")), m_LocalDateHours));
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes));
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp));
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown));
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_VerifiedDate.has_value())
+    if(m_FieldsSet.test(FieldBit_VerifiedDate))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verifiedDate")), m_VerifiedDate.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verifiedDate")), m_VerifiedDate));
     }
-    if(m_VerificationId.has_value())
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verificationId")), m_VerificationId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verificationId")), m_VerificationId));
     }
-    if(m_NotificationSentForParentIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParent))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationSentForParent")), m_NotificationSentForParent));
     }
-    if(m_NotificationSentForParentTenantIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationSentForParentTenant))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationSentForParentTenant")), m_NotificationSentForParentTenant));
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewed")), m_Reviewed));
     }
-    if(m_ImportedIsSet)
+    if(m_FieldsSet.test(FieldBit_Imported))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("imported")), m_Imported));
     }
-    if(m_ExternalIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalId")), m_ExternalId));
     }
-    if(m_ExternalParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ExternalParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalParentId")), m_ExternalParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalParentId")), m_ExternalParentId));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSpam")), m_IsSpam));
     }
-    if(m_PermNotSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("permNotSpam")), m_PermNotSpam));
     }
-    if(m_AiDeterminedSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_AiDeterminedSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("aiDeterminedSpam")), m_AiDeterminedSpam));
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasImages")), m_HasImages));
     }
-    if(m_PageNumber.has_value())
+    if(m_FieldsSet.test(FieldBit_PageNumber))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageNumber")), m_PageNumber.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageNumber")), m_PageNumber));
     }
-    if(m_PageNumberOF.has_value())
+    if(m_FieldsSet.test(FieldBit_PageNumberOF))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageNumberOF")), m_PageNumberOF.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageNumberOF")), m_PageNumberOF));
     }
-    if(m_PageNumberNF.has_value())
+    if(m_FieldsSet.test(FieldBit_PageNumberNF))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageNumberNF")), m_PageNumberNF.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageNumberNF")), m_PageNumberNF));
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasLinks")), m_HasLinks));
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasCode")), m_HasCode));
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approved")), m_Approved));
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeleted")), m_IsDeleted));
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")), m_IsDeletedUser));
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isBannedUser")), m_IsBannedUser));
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByAdmin")), m_IsByAdmin));
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByModerator")), m_IsByModerator));
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned));
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked));
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount));
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating));
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_FromProductIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromProductId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromProductId")), m_FromProductId));
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
-    if(m_IpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHash")), m_IpHash));
     }
-    if(m_MentionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Mentions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("mentions")), m_Mentions));
     }
-    if(m_HashTagsIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTags")), m_HashTags));
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_VeteranBadgeProcessedIsSet)
+    if(m_FieldsSet.test(FieldBit_VeteranBadgeProcessed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("veteranBadgeProcessed")), m_VeteranBadgeProcessed));
     }
-    if(m_ModerationGroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds));
     }
-    if(m_DidProcessBadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_DidProcessBadges))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("didProcessBadges")), m_DidProcessBadges));
     }
-    if(m_FromOfflineRestoreIsSet)
+    if(m_FieldsSet.test(FieldBit_FromOfflineRestore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromOfflineRestore")), m_FromOfflineRestore));
     }
-    if(m_AutoplayJobIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayJobId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoplayJobId")), m_AutoplayJobId));
     }
-    if(m_AutoplayDelayMSIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoplayDelayMS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoplayDelayMS")), m_AutoplayDelayMS));
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackIds")), m_FeedbackIds));
     }
-    if(m_Logs.has_value())
+    if(m_FieldsSet.test(FieldBit_Logs))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logs")), m_Logs.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logs")), m_Logs));
     }
-    if(m_GroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groupIds")), m_GroupIds.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groupIds")), m_GroupIds));
     }
-    if(m_ViewCount.has_value())
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewCount")), m_ViewCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewCount")), m_ViewCount));
     }
-    if(m_RequiresVerificationIsSet)
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("requiresVerification")), m_RequiresVerification));
     }
-    if(m_EditKeyIsSet)
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("editKey")), m_EditKey));
     }
-    if(m_TosAcceptedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt")), m_TosAcceptedAt));
     }
-    if(m_BotIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BotId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("botId")), m_BotId));
     }
@@ -2050,17 +3713,17 @@ utility::string_t FComment::getId() const
 void FComment::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool FComment::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void FComment::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t FComment::getTenantId() const
 {
@@ -2071,17 +3734,17 @@ utility::string_t FComment::getTenantId() const
 void FComment::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool FComment::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void FComment::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t FComment::getUrlId() const
 {
@@ -2092,17 +3755,17 @@ utility::string_t FComment::getUrlId() const
 void FComment::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool FComment::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void FComment::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t FComment::getUrlIdRaw() const
 {
@@ -2113,17 +3776,17 @@ utility::string_t FComment::getUrlIdRaw() const
 void FComment::setUrlIdRaw(const utility::string_t& value)
 {
     m_UrlIdRaw = value;
-    m_UrlIdRawIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdRaw);
 }
 
 bool FComment::urlIdRawIsSet() const
 {
-    return m_UrlIdRawIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdRaw);
 }
 
 void FComment::unsetUrlIdRaw()
 {
-    m_UrlIdRawIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdRaw);
 }
 utility::string_t FComment::getUrl() const
 {
@@ -2134,97 +3797,101 @@ utility::string_t FComment::getUrl() const
 void FComment::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool FComment::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void FComment::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t FComment::getPageTitle() const
 {
-    return m_PageTitle.get();
+    return m_PageTitle;
 }
 
 
 void FComment::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool FComment::pageTitleIsSet() const
 {
-    return m_PageTitle.has_value();
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void FComment::unsetPageTitle()
 {
-    m_PageTitle.reset();
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 utility::string_t FComment::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void FComment::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool FComment::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void FComment::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t FComment::getAnonUserId() const
 {
-    return m_AnonUserId.get();
+    return m_AnonUserId;
 }
 
 
 void FComment::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool FComment::anonUserIdIsSet() const
 {
-    return m_AnonUserId.has_value();
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void FComment::unsetAnonUserId()
 {
-    m_AnonUserId.reset();
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t FComment::getCommenterEmail() const
 {
-    return m_CommenterEmail.get();
+    return m_CommenterEmail;
 }
 
 
 void FComment::setCommenterEmail(const utility::string_t& value)
 {
     m_CommenterEmail = value;
+    m_FieldsSet.set(FieldBit_CommenterEmail);
 }
 
 bool FComment::commenterEmailIsSet() const
 {
-    return m_CommenterEmail.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterEmail);
 }
 
 void FComment::unsetCommenterEmail()
 {
-    m_CommenterEmail.reset();
+    m_FieldsSet.reset(FieldBit_CommenterEmail);
 }
 utility::string_t FComment::getCommenterName() const
 {
@@ -2235,37 +3902,38 @@ utility::string_t FComment::getCommenterName() const
 void FComment::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool FComment::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void FComment::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::string_t FComment::getCommenterLink() const
 {
-    return m_CommenterLink.get();
+    return m_CommenterLink;
 }
 
 
 void FComment::setCommenterLink(const utility::string_t& value)
 {
     m_CommenterLink = value;
+    m_FieldsSet.set(FieldBit_CommenterLink);
 }
 
 bool FComment::commenterLinkIsSet() const
 {
-    return m_CommenterLink.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterLink);
 }
 
 void FComment::unsetCommenterLink()
 {
-    m_CommenterLink.reset();
+    m_FieldsSet.reset(FieldBit_CommenterLink);
 }
 utility::string_t FComment::getComment() const
 {
@@ -2276,17 +3944,17 @@ utility::string_t FComment::getComment() const
 void FComment::setComment(const utility::string_t& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool FComment::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void FComment::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 utility::string_t FComment::getCommentHTML() const
 {
@@ -2297,173 +3965,181 @@ utility::string_t FComment::getCommentHTML() const
 void FComment::setCommentHTML(const utility::string_t& value)
 {
     m_CommentHTML = value;
-    m_CommentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentHTML);
 }
 
 bool FComment::commentHTMLIsSet() const
 {
-    return m_CommentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_CommentHTML);
 }
 
 void FComment::unsetCommentHTML()
 {
-    m_CommentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentHTML);
 }
 utility::string_t FComment::getParentId() const
 {
-    return m_ParentId.get();
+    return m_ParentId;
 }
 
 
 void FComment::setParentId(const utility::string_t& value)
 {
     m_ParentId = value;
+    m_FieldsSet.set(FieldBit_ParentId);
 }
 
 bool FComment::parentIdIsSet() const
 {
-    return m_ParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ParentId);
 }
 
 void FComment::unsetParentId()
 {
-    m_ParentId.reset();
+    m_FieldsSet.reset(FieldBit_ParentId);
 }
 utility::datetime FComment::getDate() const
 {
-    return m_date.get();
+    return m_date;
 }
 
 
 void FComment::setDate(const utility::datetime& value)
 {
     m_date = value;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool FComment::dateIsSet() const
 {
-    return m_date.has_value();
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void FComment::unsetdate()
 {
-    m_date.reset();
+    m_FieldsSet.reset(FieldBit_date);
 }
 utility::string_t FComment::getLocalDateString() const
 {
-    return m_LocalDateString.get();
+    return m_LocalDateString;
 }
 
 
 void FComment::setLocalDateString(const utility::string_t& value)
 {
     m_LocalDateString = value;
+    m_FieldsSet.set(FieldBit_LocalDateString);
 }
 
 bool FComment::localDateStringIsSet() const
 {
-    return m_LocalDateString.has_value();
+    return m_FieldsSet.test(FieldBit_LocalDateString);
 }
 
 void FComment::unsetLocalDateString()
 {
-    m_LocalDateString.reset();
+    m_FieldsSet.reset(FieldBit_LocalDateString);
 }
 int32_t FComment::getLocalDateHours() const
 {
-    return m_LocalDateHours.get();
+    return m_LocalDateHours;
 }
 
 void FComment::setLocalDateHours(int32_t value)
 {
     m_LocalDateHours = value;
+    m_FieldsSet.set(FieldBit_LocalDateHours);
 }
 
 bool FComment::localDateHoursIsSet() const
 {
-    return m_LocalDateHours.has_value();
+    return m_FieldsSet.test(FieldBit_LocalDateHours);
 }
 
 void FComment::unsetLocalDateHours()
 {
-    m_LocalDateHours.reset();
+    m_FieldsSet.reset(FieldBit_LocalDateHours);
 }
 int32_t FComment::getVotes() const
 {
-    return m_Votes.get();
+    return m_Votes;
 }
 
 void FComment::setVotes(int32_t value)
 {
     m_Votes = value;
+    m_FieldsSet.set(FieldBit_Votes);
 }
 
 bool FComment::votesIsSet() const
 {
-    return m_Votes.has_value();
+    return m_FieldsSet.test(FieldBit_Votes);
 }
 
 void FComment::unsetVotes()
 {
-    m_Votes.reset();
+    m_FieldsSet.reset(FieldBit_Votes);
 }
 int32_t FComment::getVotesUp() const
 {
-    return m_VotesUp.get();
+    return m_VotesUp;
 }
 
 void FComment::setVotesUp(int32_t value)
 {
     m_VotesUp = value;
+    m_FieldsSet.set(FieldBit_VotesUp);
 }
 
 bool FComment::votesUpIsSet() const
 {
-    return m_VotesUp.has_value();
+    return m_FieldsSet.test(FieldBit_VotesUp);
 }
 
 void FComment::unsetVotesUp()
 {
-    m_VotesUp.reset();
+    m_FieldsSet.reset(FieldBit_VotesUp);
 }
 int32_t FComment::getVotesDown() const
 {
-    return m_VotesDown.get();
+    return m_VotesDown;
 }
 
 void FComment::setVotesDown(int32_t value)
 {
     m_VotesDown = value;
+    m_FieldsSet.set(FieldBit_VotesDown);
 }
 
 bool FComment::votesDownIsSet() const
 {
-    return m_VotesDown.has_value();
+    return m_FieldsSet.test(FieldBit_VotesDown);
 }
 
 void FComment::unsetVotesDown()
 {
-    m_VotesDown.reset();
+    m_FieldsSet.reset(FieldBit_VotesDown);
 }
 utility::datetime FComment::getExpireAt() const
 {
-    return m_ExpireAt.get();
+    return m_ExpireAt;
 }
 
 
 void FComment::setExpireAt(const utility::datetime& value)
 {
     m_ExpireAt = value;
+    m_FieldsSet.set(FieldBit_ExpireAt);
 }
 
 bool FComment::expireAtIsSet() const
 {
-    return m_ExpireAt.has_value();
+    return m_FieldsSet.test(FieldBit_ExpireAt);
 }
 
 void FComment::unsetExpireAt()
 {
-    m_ExpireAt.reset();
+    m_FieldsSet.reset(FieldBit_ExpireAt);
 }
 bool FComment::isVerified() const
 {
@@ -2473,57 +4149,59 @@ bool FComment::isVerified() const
 void FComment::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool FComment::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void FComment::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 utility::datetime FComment::getVerifiedDate() const
 {
-    return m_VerifiedDate.get();
+    return m_VerifiedDate;
 }
 
 
 void FComment::setVerifiedDate(const utility::datetime& value)
 {
     m_VerifiedDate = value;
+    m_FieldsSet.set(FieldBit_VerifiedDate);
 }
 
 bool FComment::verifiedDateIsSet() const
 {
-    return m_VerifiedDate.has_value();
+    return m_FieldsSet.test(FieldBit_VerifiedDate);
 }
 
 void FComment::unsetVerifiedDate()
 {
-    m_VerifiedDate.reset();
+    m_FieldsSet.reset(FieldBit_VerifiedDate);
 }
 utility::string_t FComment::getVerificationId() const
 {
-    return m_VerificationId.get();
+    return m_VerificationId;
 }
 
 
 void FComment::setVerificationId(const utility::string_t& value)
 {
     m_VerificationId = value;
+    m_FieldsSet.set(FieldBit_VerificationId);
 }
 
 bool FComment::verificationIdIsSet() const
 {
-    return m_VerificationId.has_value();
+    return m_FieldsSet.test(FieldBit_VerificationId);
 }
 
 void FComment::unsetVerificationId()
 {
-    m_VerificationId.reset();
+    m_FieldsSet.reset(FieldBit_VerificationId);
 }
 bool FComment::isNotificationSentForParent() const
 {
@@ -2533,17 +4211,17 @@ bool FComment::isNotificationSentForParent() const
 void FComment::setNotificationSentForParent(bool value)
 {
     m_NotificationSentForParent = value;
-    m_NotificationSentForParentIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationSentForParent);
 }
 
 bool FComment::notificationSentForParentIsSet() const
 {
-    return m_NotificationSentForParentIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationSentForParent);
 }
 
 void FComment::unsetNotificationSentForParent()
 {
-    m_NotificationSentForParentIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationSentForParent);
 }
 bool FComment::isNotificationSentForParentTenant() const
 {
@@ -2553,17 +4231,17 @@ bool FComment::isNotificationSentForParentTenant() const
 void FComment::setNotificationSentForParentTenant(bool value)
 {
     m_NotificationSentForParentTenant = value;
-    m_NotificationSentForParentTenantIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationSentForParentTenant);
 }
 
 bool FComment::notificationSentForParentTenantIsSet() const
 {
-    return m_NotificationSentForParentTenantIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationSentForParentTenant);
 }
 
 void FComment::unsetNotificationSentForParentTenant()
 {
-    m_NotificationSentForParentTenantIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationSentForParentTenant);
 }
 bool FComment::isReviewed() const
 {
@@ -2573,17 +4251,17 @@ bool FComment::isReviewed() const
 void FComment::setReviewed(bool value)
 {
     m_Reviewed = value;
-    m_ReviewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Reviewed);
 }
 
 bool FComment::reviewedIsSet() const
 {
-    return m_ReviewedIsSet;
+    return m_FieldsSet.test(FieldBit_Reviewed);
 }
 
 void FComment::unsetReviewed()
 {
-    m_ReviewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reviewed);
 }
 bool FComment::isImported() const
 {
@@ -2593,17 +4271,17 @@ bool FComment::isImported() const
 void FComment::setImported(bool value)
 {
     m_Imported = value;
-    m_ImportedIsSet = true;
+    m_FieldsSet.set(FieldBit_Imported);
 }
 
 bool FComment::importedIsSet() const
 {
-    return m_ImportedIsSet;
+    return m_FieldsSet.test(FieldBit_Imported);
 }
 
 void FComment::unsetImported()
 {
-    m_ImportedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Imported);
 }
 utility::string_t FComment::getExternalId() const
 {
@@ -2614,57 +4292,59 @@ utility::string_t FComment::getExternalId() const
 void FComment::setExternalId(const utility::string_t& value)
 {
     m_ExternalId = value;
-    m_ExternalIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ExternalId);
 }
 
 bool FComment::externalIdIsSet() const
 {
-    return m_ExternalIdIsSet;
+    return m_FieldsSet.test(FieldBit_ExternalId);
 }
 
 void FComment::unsetExternalId()
 {
-    m_ExternalIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ExternalId);
 }
 utility::string_t FComment::getExternalParentId() const
 {
-    return m_ExternalParentId.get();
+    return m_ExternalParentId;
 }
 
 
 void FComment::setExternalParentId(const utility::string_t& value)
 {
     m_ExternalParentId = value;
+    m_FieldsSet.set(FieldBit_ExternalParentId);
 }
 
 bool FComment::externalParentIdIsSet() const
 {
-    return m_ExternalParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ExternalParentId);
 }
 
 void FComment::unsetExternalParentId()
 {
-    m_ExternalParentId.reset();
+    m_FieldsSet.reset(FieldBit_ExternalParentId);
 }
 utility::string_t FComment::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void FComment::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool FComment::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void FComment::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 bool FComment::isIsSpam() const
 {
@@ -2674,17 +4354,17 @@ bool FComment::isIsSpam() const
 void FComment::setIsSpam(bool value)
 {
     m_IsSpam = value;
-    m_IsSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSpam);
 }
 
 bool FComment::isSpamIsSet() const
 {
-    return m_IsSpamIsSet;
+    return m_FieldsSet.test(FieldBit_IsSpam);
 }
 
 void FComment::unsetIsSpam()
 {
-    m_IsSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSpam);
 }
 bool FComment::isPermNotSpam() const
 {
@@ -2694,17 +4374,17 @@ bool FComment::isPermNotSpam() const
 void FComment::setPermNotSpam(bool value)
 {
     m_PermNotSpam = value;
-    m_PermNotSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_PermNotSpam);
 }
 
 bool FComment::permNotSpamIsSet() const
 {
-    return m_PermNotSpamIsSet;
+    return m_FieldsSet.test(FieldBit_PermNotSpam);
 }
 
 void FComment::unsetPermNotSpam()
 {
-    m_PermNotSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_PermNotSpam);
 }
 bool FComment::isAiDeterminedSpam() const
 {
@@ -2714,17 +4394,17 @@ bool FComment::isAiDeterminedSpam() const
 void FComment::setAiDeterminedSpam(bool value)
 {
     m_AiDeterminedSpam = value;
-    m_AiDeterminedSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_AiDeterminedSpam);
 }
 
 bool FComment::aiDeterminedSpamIsSet() const
 {
-    return m_AiDeterminedSpamIsSet;
+    return m_FieldsSet.test(FieldBit_AiDeterminedSpam);
 }
 
 void FComment::unsetAiDeterminedSpam()
 {
-    m_AiDeterminedSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_AiDeterminedSpam);
 }
 bool FComment::isHasImages() const
 {
@@ -2734,74 +4414,77 @@ bool FComment::isHasImages() const
 void FComment::setHasImages(bool value)
 {
     m_HasImages = value;
-    m_HasImagesIsSet = true;
+    m_FieldsSet.set(FieldBit_HasImages);
 }
 
 bool FComment::hasImagesIsSet() const
 {
-    return m_HasImagesIsSet;
+    return m_FieldsSet.test(FieldBit_HasImages);
 }
 
 void FComment::unsetHasImages()
 {
-    m_HasImagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasImages);
 }
 int32_t FComment::getPageNumber() const
 {
-    return m_PageNumber.get();
+    return m_PageNumber;
 }
 
 void FComment::setPageNumber(int32_t value)
 {
     m_PageNumber = value;
+    m_FieldsSet.set(FieldBit_PageNumber);
 }
 
 bool FComment::pageNumberIsSet() const
 {
-    return m_PageNumber.has_value();
+    return m_FieldsSet.test(FieldBit_PageNumber);
 }
 
 void FComment::unsetPageNumber()
 {
-    m_PageNumber.reset();
+    m_FieldsSet.reset(FieldBit_PageNumber);
 }
 int32_t FComment::getPageNumberOF() const
 {
-    return m_PageNumberOF.get();
+    return m_PageNumberOF;
 }
 
 void FComment::setPageNumberOF(int32_t value)
 {
     m_PageNumberOF = value;
+    m_FieldsSet.set(FieldBit_PageNumberOF);
 }
 
 bool FComment::pageNumberOFIsSet() const
 {
-    return m_PageNumberOF.has_value();
+    return m_FieldsSet.test(FieldBit_PageNumberOF);
 }
 
 void FComment::unsetPageNumberOF()
 {
-    m_PageNumberOF.reset();
+    m_FieldsSet.reset(FieldBit_PageNumberOF);
 }
 int32_t FComment::getPageNumberNF() const
 {
-    return m_PageNumberNF.get();
+    return m_PageNumberNF;
 }
 
 void FComment::setPageNumberNF(int32_t value)
 {
     m_PageNumberNF = value;
+    m_FieldsSet.set(FieldBit_PageNumberNF);
 }
 
 bool FComment::pageNumberNFIsSet() const
 {
-    return m_PageNumberNF.has_value();
+    return m_FieldsSet.test(FieldBit_PageNumberNF);
 }
 
 void FComment::unsetPageNumberNF()
 {
-    m_PageNumberNF.reset();
+    m_FieldsSet.reset(FieldBit_PageNumberNF);
 }
 bool FComment::isHasLinks() const
 {
@@ -2811,17 +4494,17 @@ bool FComment::isHasLinks() const
 void FComment::setHasLinks(bool value)
 {
     m_HasLinks = value;
-    m_HasLinksIsSet = true;
+    m_FieldsSet.set(FieldBit_HasLinks);
 }
 
 bool FComment::hasLinksIsSet() const
 {
-    return m_HasLinksIsSet;
+    return m_FieldsSet.test(FieldBit_HasLinks);
 }
 
 void FComment::unsetHasLinks()
 {
-    m_HasLinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasLinks);
 }
 bool FComment::isHasCode() const
 {
@@ -2831,17 +4514,17 @@ bool FComment::isHasCode() const
 void FComment::setHasCode(bool value)
 {
     m_HasCode = value;
-    m_HasCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_HasCode);
 }
 
 bool FComment::hasCodeIsSet() const
 {
-    return m_HasCodeIsSet;
+    return m_FieldsSet.test(FieldBit_HasCode);
 }
 
 void FComment::unsetHasCode()
 {
-    m_HasCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasCode);
 }
 bool FComment::isApproved() const
 {
@@ -2851,37 +4534,38 @@ bool FComment::isApproved() const
 void FComment::setApproved(bool value)
 {
     m_Approved = value;
-    m_ApprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_Approved);
 }
 
 bool FComment::approvedIsSet() const
 {
-    return m_ApprovedIsSet;
+    return m_FieldsSet.test(FieldBit_Approved);
 }
 
 void FComment::unsetApproved()
 {
-    m_ApprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Approved);
 }
 utility::string_t FComment::getLocale() const
 {
-    return m_Locale.get();
+    return m_Locale;
 }
 
 
 void FComment::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool FComment::localeIsSet() const
 {
-    return m_Locale.has_value();
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void FComment::unsetLocale()
 {
-    m_Locale.reset();
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 bool FComment::isIsDeleted() const
 {
@@ -2891,17 +4575,17 @@ bool FComment::isIsDeleted() const
 void FComment::setIsDeleted(bool value)
 {
     m_IsDeleted = value;
-    m_IsDeletedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeleted);
 }
 
 bool FComment::isDeletedIsSet() const
 {
-    return m_IsDeletedIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeleted);
 }
 
 void FComment::unsetIsDeleted()
 {
-    m_IsDeletedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeleted);
 }
 bool FComment::isIsDeletedUser() const
 {
@@ -2911,17 +4595,17 @@ bool FComment::isIsDeletedUser() const
 void FComment::setIsDeletedUser(bool value)
 {
     m_IsDeletedUser = value;
-    m_IsDeletedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeletedUser);
 }
 
 bool FComment::isDeletedUserIsSet() const
 {
-    return m_IsDeletedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeletedUser);
 }
 
 void FComment::unsetIsDeletedUser()
 {
-    m_IsDeletedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeletedUser);
 }
 bool FComment::isIsBannedUser() const
 {
@@ -2931,17 +4615,17 @@ bool FComment::isIsBannedUser() const
 void FComment::setIsBannedUser(bool value)
 {
     m_IsBannedUser = value;
-    m_IsBannedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsBannedUser);
 }
 
 bool FComment::isBannedUserIsSet() const
 {
-    return m_IsBannedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsBannedUser);
 }
 
 void FComment::unsetIsBannedUser()
 {
-    m_IsBannedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsBannedUser);
 }
 bool FComment::isIsByAdmin() const
 {
@@ -2951,17 +4635,17 @@ bool FComment::isIsByAdmin() const
 void FComment::setIsByAdmin(bool value)
 {
     m_IsByAdmin = value;
-    m_IsByAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByAdmin);
 }
 
 bool FComment::isByAdminIsSet() const
 {
-    return m_IsByAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsByAdmin);
 }
 
 void FComment::unsetIsByAdmin()
 {
-    m_IsByAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByAdmin);
 }
 bool FComment::isIsByModerator() const
 {
@@ -2971,113 +4655,118 @@ bool FComment::isIsByModerator() const
 void FComment::setIsByModerator(bool value)
 {
     m_IsByModerator = value;
-    m_IsByModeratorIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByModerator);
 }
 
 bool FComment::isByModeratorIsSet() const
 {
-    return m_IsByModeratorIsSet;
+    return m_FieldsSet.test(FieldBit_IsByModerator);
 }
 
 void FComment::unsetIsByModerator()
 {
-    m_IsByModeratorIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByModerator);
 }
 bool FComment::isIsPinned() const
 {
-    return m_IsPinned.get();
+    return m_IsPinned;
 }
 
 void FComment::setIsPinned(bool value)
 {
     m_IsPinned = value;
+    m_FieldsSet.set(FieldBit_IsPinned);
 }
 
 bool FComment::isPinnedIsSet() const
 {
-    return m_IsPinned.has_value();
+    return m_FieldsSet.test(FieldBit_IsPinned);
 }
 
 void FComment::unsetIsPinned()
 {
-    m_IsPinned.reset();
+    m_FieldsSet.reset(FieldBit_IsPinned);
 }
 bool FComment::isIsLocked() const
 {
-    return m_IsLocked.get();
+    return m_IsLocked;
 }
 
 void FComment::setIsLocked(bool value)
 {
     m_IsLocked = value;
+    m_FieldsSet.set(FieldBit_IsLocked);
 }
 
 bool FComment::isLockedIsSet() const
 {
-    return m_IsLocked.has_value();
+    return m_FieldsSet.test(FieldBit_IsLocked);
 }
 
 void FComment::unsetIsLocked()
 {
-    m_IsLocked.reset();
+    m_FieldsSet.reset(FieldBit_IsLocked);
 }
 int32_t FComment::getFlagCount() const
 {
-    return m_FlagCount.get();
+    return m_FlagCount;
 }
 
 void FComment::setFlagCount(int32_t value)
 {
     m_FlagCount = value;
+    m_FieldsSet.set(FieldBit_FlagCount);
 }
 
 bool FComment::flagCountIsSet() const
 {
-    return m_FlagCount.has_value();
+    return m_FieldsSet.test(FieldBit_FlagCount);
 }
 
 void FComment::unsetFlagCount()
 {
-    m_FlagCount.reset();
+    m_FieldsSet.reset(FieldBit_FlagCount);
 }
 double FComment::getRating() const
 {
-    return m_Rating.get();
+    return m_Rating;
 }
 
 void FComment::setRating(double value)
 {
     m_Rating = value;
+    m_FieldsSet.set(FieldBit_Rating);
 }
 
 bool FComment::ratingIsSet() const
 {
-    return m_Rating.has_value();
+    return m_FieldsSet.test(FieldBit_Rating);
 }
 
 void FComment::unsetRating()
 {
-    m_Rating.reset();
+    m_FieldsSet.reset(FieldBit_Rating);
 }
 utility::string_t FComment::getDisplayLabel() const
 {
-    return m_DisplayLabel.get();
+    return m_DisplayLabel;
 }
 
 
 void FComment::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool FComment::displayLabelIsSet() const
 {
-    return m_DisplayLabel.has_value();
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void FComment::unsetDisplayLabel()
 {
-    m_DisplayLabel.reset();
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 int32_t FComment::getFromProductId() const
 {
@@ -3087,37 +4776,38 @@ int32_t FComment::getFromProductId() const
 void FComment::setFromProductId(int32_t value)
 {
     m_FromProductId = value;
-    m_FromProductIdIsSet = true;
+    m_FieldsSet.set(FieldBit_FromProductId);
 }
 
 bool FComment::fromProductIdIsSet() const
 {
-    return m_FromProductIdIsSet;
+    return m_FieldsSet.test(FieldBit_FromProductId);
 }
 
 void FComment::unsetFromProductId()
 {
-    m_FromProductIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromProductId);
 }
 std::shared_ptr<FComment_meta> FComment::getMeta() const
 {
-    return m_Meta.get();
+    return m_Meta;
 }
 
 
 void FComment::setMeta(const std::shared_ptr<FComment_meta>& value)
 {
     m_Meta = value;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool FComment::metaIsSet() const
 {
-    return m_Meta.has_value();
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void FComment::unsetMeta()
 {
-    m_Meta.reset();
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 utility::string_t FComment::getIpHash() const
 {
@@ -3128,17 +4818,17 @@ utility::string_t FComment::getIpHash() const
 void FComment::setIpHash(const utility::string_t& value)
 {
     m_IpHash = value;
-    m_IpHashIsSet = true;
+    m_FieldsSet.set(FieldBit_IpHash);
 }
 
 bool FComment::ipHashIsSet() const
 {
-    return m_IpHashIsSet;
+    return m_FieldsSet.test(FieldBit_IpHash);
 }
 
 void FComment::unsetIpHash()
 {
-    m_IpHashIsSet = false;
+    m_FieldsSet.reset(FieldBit_IpHash);
 }
 std::vector<std::shared_ptr<CommentUserMentionInfo>> FComment::getMentions() const
 {
@@ -3149,17 +4839,17 @@ std::vector<std::shared_ptr<CommentUserMentionInfo>> FComment::getMentions() con
 void FComment::setMentions(const std::vector<std::shared_ptr<CommentUserMentionInfo>>& value)
 {
     m_Mentions = value;
-    m_MentionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Mentions);
 }
 
 bool FComment::mentionsIsSet() const
 {
-    return m_MentionsIsSet;
+    return m_FieldsSet.test(FieldBit_Mentions);
 }
 
 void FComment::unsetMentions()
 {
-    m_MentionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Mentions);
 }
 std::vector<std::shared_ptr<CommentUserHashTagInfo>> FComment::getHashTags() const
 {
@@ -3170,57 +4860,59 @@ std::vector<std::shared_ptr<CommentUserHashTagInfo>> FComment::getHashTags() con
 void FComment::setHashTags(const std::vector<std::shared_ptr<CommentUserHashTagInfo>>& value)
 {
     m_HashTags = value;
-    m_HashTagsIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTags);
 }
 
 bool FComment::hashTagsIsSet() const
 {
-    return m_HashTagsIsSet;
+    return m_FieldsSet.test(FieldBit_HashTags);
 }
 
 void FComment::unsetHashTags()
 {
-    m_HashTagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTags);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> FComment::getBadges() const
 {
-    return m_Badges.get();
+    return m_Badges;
 }
 
 
 void FComment::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool FComment::badgesIsSet() const
 {
-    return m_Badges.has_value();
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void FComment::unsetBadges()
 {
-    m_Badges.reset();
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 utility::string_t FComment::getDomain() const
 {
-    return m_Domain.get();
+    return m_Domain;
 }
 
 
 void FComment::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool FComment::domainIsSet() const
 {
-    return m_Domain.has_value();
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void FComment::unsetDomain()
 {
-    m_Domain.reset();
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t FComment::getVeteranBadgeProcessed() const
 {
@@ -3231,37 +4923,38 @@ utility::string_t FComment::getVeteranBadgeProcessed() const
 void FComment::setVeteranBadgeProcessed(const utility::string_t& value)
 {
     m_VeteranBadgeProcessed = value;
-    m_VeteranBadgeProcessedIsSet = true;
+    m_FieldsSet.set(FieldBit_VeteranBadgeProcessed);
 }
 
 bool FComment::veteranBadgeProcessedIsSet() const
 {
-    return m_VeteranBadgeProcessedIsSet;
+    return m_FieldsSet.test(FieldBit_VeteranBadgeProcessed);
 }
 
 void FComment::unsetVeteranBadgeProcessed()
 {
-    m_VeteranBadgeProcessedIsSet = false;
+    m_FieldsSet.reset(FieldBit_VeteranBadgeProcessed);
 }
 std::vector<utility::string_t> FComment::getModerationGroupIds() const
 {
-    return m_ModerationGroupIds.get();
+    return m_ModerationGroupIds;
 }
 
 
 void FComment::setModerationGroupIds(const std::vector<utility::string_t>& value)
 {
     m_ModerationGroupIds = value;
+    m_FieldsSet.set(FieldBit_ModerationGroupIds);
 }
 
 bool FComment::moderationGroupIdsIsSet() const
 {
-    return m_ModerationGroupIds.has_value();
+    return m_FieldsSet.test(FieldBit_ModerationGroupIds);
 }
 
 void FComment::unsetModerationGroupIds()
 {
-    m_ModerationGroupIds.reset();
+    m_FieldsSet.reset(FieldBit_ModerationGroupIds);
 }
 bool FComment::isDidProcessBadges() const
 {
@@ -3271,17 +4964,17 @@ bool FComment::isDidProcessBadges() const
 void FComment::setDidProcessBadges(bool value)
 {
     m_DidProcessBadges = value;
-    m_DidProcessBadgesIsSet = true;
+    m_FieldsSet.set(FieldBit_DidProcessBadges);
 }
 
 bool FComment::didProcessBadgesIsSet() const
 {
-    return m_DidProcessBadgesIsSet;
+    return m_FieldsSet.test(FieldBit_DidProcessBadges);
 }
 
 void FComment::unsetDidProcessBadges()
 {
-    m_DidProcessBadgesIsSet = false;
+    m_FieldsSet.reset(FieldBit_DidProcessBadges);
 }
 bool FComment::isFromOfflineRestore() const
 {
@@ -3291,17 +4984,17 @@ bool FComment::isFromOfflineRestore() const
 void FComment::setFromOfflineRestore(bool value)
 {
     m_FromOfflineRestore = value;
-    m_FromOfflineRestoreIsSet = true;
+    m_FieldsSet.set(FieldBit_FromOfflineRestore);
 }
 
 bool FComment::fromOfflineRestoreIsSet() const
 {
-    return m_FromOfflineRestoreIsSet;
+    return m_FieldsSet.test(FieldBit_FromOfflineRestore);
 }
 
 void FComment::unsetFromOfflineRestore()
 {
-    m_FromOfflineRestoreIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromOfflineRestore);
 }
 utility::string_t FComment::getAutoplayJobId() const
 {
@@ -3312,17 +5005,17 @@ utility::string_t FComment::getAutoplayJobId() const
 void FComment::setAutoplayJobId(const utility::string_t& value)
 {
     m_AutoplayJobId = value;
-    m_AutoplayJobIdIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoplayJobId);
 }
 
 bool FComment::autoplayJobIdIsSet() const
 {
-    return m_AutoplayJobIdIsSet;
+    return m_FieldsSet.test(FieldBit_AutoplayJobId);
 }
 
 void FComment::unsetAutoplayJobId()
 {
-    m_AutoplayJobIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoplayJobId);
 }
 int64_t FComment::getAutoplayDelayMS() const
 {
@@ -3332,17 +5025,17 @@ int64_t FComment::getAutoplayDelayMS() const
 void FComment::setAutoplayDelayMS(int64_t value)
 {
     m_AutoplayDelayMS = value;
-    m_AutoplayDelayMSIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoplayDelayMS);
 }
 
 bool FComment::autoplayDelayMSIsSet() const
 {
-    return m_AutoplayDelayMSIsSet;
+    return m_FieldsSet.test(FieldBit_AutoplayDelayMS);
 }
 
 void FComment::unsetAutoplayDelayMS()
 {
-    m_AutoplayDelayMSIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoplayDelayMS);
 }
 std::vector<utility::string_t> FComment::getFeedbackIds() const
 {
@@ -3353,76 +5046,79 @@ std::vector<utility::string_t> FComment::getFeedbackIds() const
 void FComment::setFeedbackIds(const std::vector<utility::string_t>& value)
 {
     m_FeedbackIds = value;
-    m_FeedbackIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackIds);
 }
 
 bool FComment::feedbackIdsIsSet() const
 {
-    return m_FeedbackIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackIds);
 }
 
 void FComment::unsetFeedbackIds()
 {
-    m_FeedbackIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackIds);
 }
 std::vector<std::shared_ptr<CommentLogEntry>> FComment::getLogs() const
 {
-    return m_Logs.get();
+    return m_Logs;
 }
 
 
 void FComment::setLogs(const std::vector<std::shared_ptr<CommentLogEntry>>& value)
 {
     m_Logs = value;
+    m_FieldsSet.set(FieldBit_Logs);
 }
 
 bool FComment::logsIsSet() const
 {
-    return m_Logs.has_value();
+    return m_FieldsSet.test(FieldBit_Logs);
 }
 
 void FComment::unsetLogs()
 {
-    m_Logs.reset();
+    m_FieldsSet.reset(FieldBit_Logs);
 }
 std::vector<utility::string_t> FComment::getGroupIds() const
 {
-    return m_GroupIds.get();
+    return m_GroupIds;
 }
 
 
 void FComment::setGroupIds(const std::vector<utility::string_t>& value)
 {
     m_GroupIds = value;
+    m_FieldsSet.set(FieldBit_GroupIds);
 }
 
 bool FComment::groupIdsIsSet() const
 {
-    return m_GroupIds.has_value();
+    return m_FieldsSet.test(FieldBit_GroupIds);
 }
 
 void FComment::unsetGroupIds()
 {
-    m_GroupIds.reset();
+    m_FieldsSet.reset(FieldBit_GroupIds);
 }
 int64_t FComment::getViewCount() const
 {
-    return m_ViewCount.get();
+    return m_ViewCount;
 }
 
 void FComment::setViewCount(int64_t value)
 {
     m_ViewCount = value;
+    m_FieldsSet.set(FieldBit_ViewCount);
 }
 
 bool FComment::viewCountIsSet() const
 {
-    return m_ViewCount.has_value();
+    return m_FieldsSet.test(FieldBit_ViewCount);
 }
 
 void FComment::unsetViewCount()
 {
-    m_ViewCount.reset();
+    m_FieldsSet.reset(FieldBit_ViewCount);
 }
 bool FComment::isRequiresVerification() const
 {
@@ -3432,17 +5128,17 @@ bool FComment::isRequiresVerification() const
 void FComment::setRequiresVerification(bool value)
 {
     m_RequiresVerification = value;
-    m_RequiresVerificationIsSet = true;
+    m_FieldsSet.set(FieldBit_RequiresVerification);
 }
 
 bool FComment::requiresVerificationIsSet() const
 {
-    return m_RequiresVerificationIsSet;
+    return m_FieldsSet.test(FieldBit_RequiresVerification);
 }
 
 void FComment::unsetRequiresVerification()
 {
-    m_RequiresVerificationIsSet = false;
+    m_FieldsSet.reset(FieldBit_RequiresVerification);
 }
 utility::string_t FComment::getEditKey() const
 {
@@ -3453,17 +5149,17 @@ utility::string_t FComment::getEditKey() const
 void FComment::setEditKey(const utility::string_t& value)
 {
     m_EditKey = value;
-    m_EditKeyIsSet = true;
+    m_FieldsSet.set(FieldBit_EditKey);
 }
 
 bool FComment::editKeyIsSet() const
 {
-    return m_EditKeyIsSet;
+    return m_FieldsSet.test(FieldBit_EditKey);
 }
 
 void FComment::unsetEditKey()
 {
-    m_EditKeyIsSet = false;
+    m_FieldsSet.reset(FieldBit_EditKey);
 }
 utility::datetime FComment::getTosAcceptedAt() const
 {
@@ -3474,17 +5170,17 @@ utility::datetime FComment::getTosAcceptedAt() const
 void FComment::setTosAcceptedAt(const utility::datetime& value)
 {
     m_TosAcceptedAt = value;
-    m_TosAcceptedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_TosAcceptedAt);
 }
 
 bool FComment::tosAcceptedAtIsSet() const
 {
-    return m_TosAcceptedAtIsSet;
+    return m_FieldsSet.test(FieldBit_TosAcceptedAt);
 }
 
 void FComment::unsetTosAcceptedAt()
 {
-    m_TosAcceptedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_TosAcceptedAt);
 }
 utility::string_t FComment::getBotId() const
 {
@@ -3495,17 +5191,17 @@ utility::string_t FComment::getBotId() const
 void FComment::setBotId(const utility::string_t& value)
 {
     m_BotId = value;
-    m_BotIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BotId);
 }
 
 bool FComment::botIdIsSet() const
 {
-    return m_BotIdIsSet;
+    return m_FieldsSet.test(FieldBit_BotId);
 }
 
 void FComment::unsetBotId()
 {
-    m_BotIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BotId);
 }
 
 }
@@ -20,13 +20,6 @@ namespace model {
 
 FComment_meta::FComment_meta()
 {
-    m_WpId = utility::conversions::to_string_t("");
-    m_WpIdIsSet = false;
-    m_WpUserId = utility::conversions::to_string_t("");
-    m_WpUserIdIsSet = false;
-    m_WpPostId = utility::conversions::to_string_t("");
-    m_WpPostIdIsSet = false;
-    m_AdditionalPropertiesIsSet = false;
 }
 
 FComment_meta::~FComment_meta()
@@ -41,23 +34,23 @@ void FComment_meta::validate()
 web::json::value FComment_meta::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_WpIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wpId"))] = ModelBase::toJson(m_WpId);
     }
-    if(m_WpUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wpUserId"))] = ModelBase::toJson(m_WpUserId);
     }
-    if(m_WpPostIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpPostId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wpPostId"))] = ModelBase::toJson(m_WpPostId);
     }
     // Serialize additional properties
-    if(m_AdditionalPropertiesIsSet)
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
         for(const auto& item : m_AdditionalProperties)
         {
@@ -68,57 +61,193 @@ web::json::value FComment_meta::toJson() const
     return val;
 }
 
-bool FComment_meta::fromJson(const web::json::value& val)
+void FComment_meta::writeJson(JsonWriter& writer) const
 {
-    bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpId"))))
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_WpId))
+    {
+        
+        writer.key(_XPLATSTR("wpId"));
+        ModelBase::writeJson(writer, m_WpId);
+    }
+    if(m_FieldsSet.test(FieldBit_WpUserId))
+    {
+        
+        writer.key(_XPLATSTR("wpUserId"));
+        ModelBase::writeJson(writer, m_WpUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_WpPostId))
+    {
+        
+        writer.key(_XPLATSTR("wpPostId"));
+        ModelBase::writeJson(writer, m_WpPostId);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpId")));
-        if(!fieldValue.is_null())
+        for(const auto& item : m_AdditionalProperties)
         {
-            utility::string_t refVal_setWpId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpId);
-            setWpId(refVal_setWpId);
-            
+            writer.key(item.first);
+            writer.value(item.second);
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpUserId"))))
+
+    writer.endObject();
+}
+
+bool FComment_meta::fromJson(const web::json::value& val)
+{
+    bool ok = true;
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpUserId")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setWpUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpUserId);
-            setWpUserId(refVal_setWpUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("wpId")):
+            if(field.first == _XPLATSTR("wpId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWpId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpId);
+                    setWpId(refVal_setWpId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wpUserId")):
+            if(field.first == _XPLATSTR("wpUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWpUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpUserId);
+                    setWpUserId(refVal_setWpUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wpPostId")):
+            if(field.first == _XPLATSTR("wpPostId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWpPostId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWpPostId);
+                    setWpPostId(refVal_setWpPostId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        // This is an additional property
+        m_AdditionalProperties[field.first] = fieldValue;
+        m_FieldsSet.set(FieldBit_AdditionalProperties);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wpPostId"))))
+    return ok;
+}
+
+void FComment_meta::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_WpId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpId")), m_WpId);
+    }
+    if(m_FieldsSet.test(FieldBit_WpUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wpPostId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpUserId")), m_WpUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_WpPostId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wpPostId")), m_WpPostId);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            utility::string_t refVal_setWpPostId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWpPostId);
-            setWpPostId(refVal_setWpPostId);
-            
+            writer.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);
+            writer.writeString(item.first);
+            writer.writeString(item.second.serialize());
         }
     }
-    // Capture additional properties (keys not defined in the schema)
-    if(val.is_object())
+}
+
+bool FComment_meta::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        for(const auto& item : val.as_object())
+        switch(field.tag)
         {
-            // Skip known properties
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("wpId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("wpUserId"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("wpPostId"))) continue;
-            // This is an additional property
-            m_AdditionalProperties[item.first] = item.second;
-            m_AdditionalPropertiesIsSet = true;
+        case ModelBase::fieldHash(_XPLATSTR("wpId")):
+            {
+                utility::string_t refVal_setWpId;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpId(refVal_setWpId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wpUserId")):
+            {
+                utility::string_t refVal_setWpUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpUserId(refVal_setWpUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wpPostId")):
+            {
+                utility::string_t refVal_setWpPostId;
+                if(!ModelBase::readBinary(reader, field, refVal_setWpPostId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWpPostId(refVal_setWpPostId);
+            }
+            continue;
+        default:
+            break;
         }
+        if(field.wireType == BinaryWireType::Named)
+        {
+            utility::string_t key;
+            utility::string_t text;
+            if(reader.readString(key) && reader.readString(text))
+            {
+                try
+                {
+                    m_AdditionalProperties[key] = web::json::value::parse(text);
+                }
+                catch(const web::json::json_exception&)
+                {
+                    return false;
+                }
+                m_FieldsSet.set(FieldBit_AdditionalProperties);
+            }
+            continue;
+        }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FComment_meta::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -128,15 +257,15 @@ void FComment_meta::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_WpIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpId")), m_WpId));
     }
-    if(m_WpUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpUserId")), m_WpUserId));
     }
-    if(m_WpPostIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WpPostId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wpPostId")), m_WpPostId));
     }
@@ -182,17 +311,17 @@ utility::string_t FComment_meta::getWpId() const
 void FComment_meta::setWpId(const utility::string_t& value)
 {
     m_WpId = value;
-    m_WpIdIsSet = true;
+    m_FieldsSet.set(FieldBit_WpId);
 }
 
 bool FComment_meta::wpIdIsSet() const
 {
-    return m_WpIdIsSet;
+    return m_FieldsSet.test(FieldBit_WpId);
 }
 
 void FComment_meta::unsetWpId()
 {
-    m_WpIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_WpId);
 }
 utility::string_t FComment_meta::getWpUserId() const
 {
@@ -203,17 +332,17 @@ utility::string_t FComment_meta::getWpUserId() const
 void FComment_meta::setWpUserId(const utility::string_t& value)
 {
     m_WpUserId = value;
-    m_WpUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_WpUserId);
 }
 
 bool FComment_meta::wpUserIdIsSet() const
 {
-    return m_WpUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_WpUserId);
 }
 
 void FComment_meta::unsetWpUserId()
 {
-    m_WpUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_WpUserId);
 }
 utility::string_t FComment_meta::getWpPostId() const
 {
@@ -224,17 +353,17 @@ utility::string_t FComment_meta::getWpPostId() const
 void FComment_meta::setWpPostId(const utility::string_t& value)
 {
     m_WpPostId = value;
-    m_WpPostIdIsSet = true;
+    m_FieldsSet.set(FieldBit_WpPostId);
 }
 
 bool FComment_meta::wpPostIdIsSet() const
 {
-    return m_WpPostIdIsSet;
+    return m_FieldsSet.test(FieldBit_WpPostId);
 }
 
 void FComment_meta::unsetWpPostId()
 {
-    m_WpPostIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_WpPostId);
 }
 
 
@@ -246,24 +375,24 @@ std::map<utility::string_t, web::json::value> FComment_meta::getAdditionalProper
 void FComment_meta::setAdditionalProperties(const std::map<utility::string_t, web::json::value>& value)
 {
     m_AdditionalProperties = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 void FComment_meta::addAdditionalProperty(const utility::string_t& key, const web::json::value& value)
 {
     m_AdditionalProperties[key] = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 bool FComment_meta::additionalPropertiesIsSet() const
 {
-    return m_AdditionalPropertiesIsSet;
+    return m_FieldsSet.test(FieldBit_AdditionalProperties);
 }
 
 void FComment_meta::unsetAdditionalProperties()
 {
     m_AdditionalProperties.clear();
-    m_AdditionalPropertiesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdditionalProperties);
 }
 }
 }
@@ -20,27 +20,8 @@ namespace model {
 
 FeedPost::FeedPost()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_FromUserId = utility::conversions::to_string_t("");
-    m_FromUserIdIsSet = false;
-    m_FromIpHash = utility::conversions::to_string_t("");
-    m_FromIpHashIsSet = false;
-    m_TagsIsSet = false;
     m_Weight = 0.0;
-    m_WeightIsSet = false;
-    m_MetaIsSet = false;
-    m_ContentHTML = utility::conversions::to_string_t("");
-    m_ContentHTMLIsSet = false;
-    m_MediaIsSet = false;
-    m_LinksIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_ReactsIsSet = false;
+    m_CommentCount = 0;
 }
 
 FeedPost::~FeedPost()
@@ -55,270 +36,679 @@ void FeedPost::validate()
 web::json::value FeedPost::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_FromUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromUserId"))] = ModelBase::toJson(m_FromUserId);
     }
-    if(m_FromUserDisplayName.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName"))] = ModelBase::toJson(m_FromUserDisplayName.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName"))] = ModelBase::toJson(m_FromUserDisplayName);
     }
-    if(m_FromUserAvatar.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserAvatar))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserAvatar"))] = ModelBase::toJson(m_FromUserAvatar.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserAvatar"))] = ModelBase::toJson(m_FromUserAvatar);
     }
-    if(m_FromIpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_FromIpHash))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromIpHash"))] = ModelBase::toJson(m_FromIpHash);
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tags"))] = ModelBase::toJson(m_Tags);
     }
-    if(m_WeightIsSet)
+    if(m_FieldsSet.test(FieldBit_Weight))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("weight"))] = ModelBase::toJson(m_Weight);
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
-    if(m_ContentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("contentHTML"))] = ModelBase::toJson(m_ContentHTML);
     }
-    if(m_MediaIsSet)
+    if(m_FieldsSet.test(FieldBit_Media))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("media"))] = ModelBase::toJson(m_Media);
     }
-    if(m_LinksIsSet)
+    if(m_FieldsSet.test(FieldBit_Links))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("links"))] = ModelBase::toJson(m_Links);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_ReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_Reacts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reacts"))] = ModelBase::toJson(m_Reacts);
     }
-    if(m_CommentCount.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commentCount"))] = ModelBase::toJson(m_CommentCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commentCount"))] = ModelBase::toJson(m_CommentCount);
     }
 
     return val;
 }
 
+void FeedPost::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserId))
+    {
+        
+        writer.key(_XPLATSTR("fromUserId"));
+        ModelBase::writeJson(writer, m_FromUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
+    {
+        
+        writer.key(_XPLATSTR("fromUserDisplayName"));
+        ModelBase::writeJson(writer, m_FromUserDisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserAvatar))
+    {
+        
+        writer.key(_XPLATSTR("fromUserAvatar"));
+        ModelBase::writeJson(writer, m_FromUserAvatar);
+    }
+    if(m_FieldsSet.test(FieldBit_FromIpHash))
+    {
+        
+        writer.key(_XPLATSTR("fromIpHash"));
+        ModelBase::writeJson(writer, m_FromIpHash);
+    }
+    if(m_FieldsSet.test(FieldBit_Tags))
+    {
+        
+        writer.key(_XPLATSTR("tags"));
+        ModelBase::writeJson(writer, m_Tags);
+    }
+    if(m_FieldsSet.test(FieldBit_Weight))
+    {
+        
+        writer.key(_XPLATSTR("weight"));
+        ModelBase::writeJson(writer, m_Weight);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
+    {
+        
+        writer.key(_XPLATSTR("contentHTML"));
+        ModelBase::writeJson(writer, m_ContentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_Media))
+    {
+        
+        writer.key(_XPLATSTR("media"));
+        ModelBase::writeJson(writer, m_Media);
+    }
+    if(m_FieldsSet.test(FieldBit_Links))
+    {
+        
+        writer.key(_XPLATSTR("links"));
+        ModelBase::writeJson(writer, m_Links);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Reacts))
+    {
+        
+        writer.key(_XPLATSTR("reacts"));
+        ModelBase::writeJson(writer, m_Reacts);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        writer.key(_XPLATSTR("commentCount"));
+        ModelBase::writeJson(writer, m_CommentCount);
+    }
+
+    writer.endObject();
+}
+
 bool FeedPost::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            if(field.first == _XPLATSTR("fromUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
+                    setFromUserId(refVal_setFromUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserDisplayName")):
+            if(field.first == _XPLATSTR("fromUserDisplayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserDisplayName);
+                    setFromUserDisplayName(refVal_setFromUserDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserAvatar")):
+            if(field.first == _XPLATSTR("fromUserAvatar"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserAvatar;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserAvatar);
+                    setFromUserAvatar(refVal_setFromUserAvatar);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromIpHash")):
+            if(field.first == _XPLATSTR("fromIpHash"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromIpHash;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromIpHash);
+                    setFromIpHash(refVal_setFromIpHash);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            if(field.first == _XPLATSTR("tags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
+                    setTags(refVal_setTags);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("weight")):
+            if(field.first == _XPLATSTR("weight"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setWeight;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWeight);
+                    setWeight(refVal_setWeight);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("contentHTML")):
+            if(field.first == _XPLATSTR("contentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setContentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setContentHTML);
+                    setContentHTML(refVal_setContentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("media")):
+            if(field.first == _XPLATSTR("media"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMedia);
+                    setMedia(refVal_setMedia);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("links")):
+            if(field.first == _XPLATSTR("links"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLinks);
+                    setLinks(refVal_setLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reacts")):
+            if(field.first == _XPLATSTR("reacts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, int32_t> refVal_setReacts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReacts);
+                    setReacts(refVal_setReacts);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            if(field.first == _XPLATSTR("commentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
+                    setCommentCount(refVal_setCommentCount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    return ok;
+}
+
+void FeedPost::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
-            setFromUserId(refVal_setFromUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName"))))
+    if(m_FieldsSet.test(FieldBit_Title))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserDisplayName);
-            setFromUserDisplayName(refVal_setFromUserDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserAvatar"))))
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserAvatar")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserAvatar;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserAvatar);
-            setFromUserAvatar(refVal_setFromUserAvatar);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserId")), m_FromUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromIpHash"))))
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromIpHash")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromIpHash;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromIpHash);
-            setFromIpHash(refVal_setFromIpHash);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserDisplayName")), m_FromUserDisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tags"))))
+    if(m_FieldsSet.test(FieldBit_FromUserAvatar))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tags")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
-            setTags(refVal_setTags);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserAvatar")), m_FromUserAvatar);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("weight"))))
+    if(m_FieldsSet.test(FieldBit_FromIpHash))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("weight")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setWeight;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWeight);
-            setWeight(refVal_setWeight);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromIpHash")), m_FromIpHash);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tags")), m_Tags);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("contentHTML"))))
+    if(m_FieldsSet.test(FieldBit_Weight))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("contentHTML")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setContentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setContentHTML);
-            setContentHTML(refVal_setContentHTML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("weight")), m_Weight);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("media"))))
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("media")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMedia);
-            setMedia(refVal_setMedia);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("links"))))
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("links")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLinks);
-            setLinks(refVal_setLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("contentHTML")), m_ContentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_Media))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("media")), m_Media);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reacts"))))
+    if(m_FieldsSet.test(FieldBit_Links))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reacts")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, int32_t> refVal_setReacts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReacts);
-            setReacts(refVal_setReacts);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("links")), m_Links);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCount"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCount")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Reacts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reacts")), m_Reacts);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCount")), m_CommentCount);
+    }
+}
+
+bool FeedPost::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int32_t refVal_setCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
-            setCommentCount(refVal_setCommentCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            {
+                utility::string_t refVal_setFromUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserId(refVal_setFromUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserDisplayName")):
+            {
+                utility::string_t refVal_setFromUserDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserDisplayName(refVal_setFromUserDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserAvatar")):
+            {
+                utility::string_t refVal_setFromUserAvatar;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserAvatar))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserAvatar(refVal_setFromUserAvatar);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromIpHash")):
+            {
+                utility::string_t refVal_setFromIpHash;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromIpHash))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromIpHash(refVal_setFromIpHash);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            {
+                std::vector<utility::string_t> refVal_setTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTags(refVal_setTags);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("weight")):
+            {
+                double refVal_setWeight;
+                if(!ModelBase::readBinary(reader, field, refVal_setWeight))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWeight(refVal_setWeight);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("contentHTML")):
+            {
+                utility::string_t refVal_setContentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setContentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setContentHTML(refVal_setContentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("media")):
+            {
+                std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
+                if(!ModelBase::readBinary(reader, field, refVal_setMedia))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMedia(refVal_setMedia);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("links")):
+            {
+                std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLinks(refVal_setLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reacts")):
+            {
+                std::map<utility::string_t, int32_t> refVal_setReacts;
+                if(!ModelBase::readBinary(reader, field, refVal_setReacts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReacts(refVal_setReacts);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            {
+                int32_t refVal_setCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCount(refVal_setCommentCount);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FeedPost::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -328,69 +718,69 @@ void FeedPost::toMultipart(std::shared_ptr<MultipartFormData> multipart, const u
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_FromUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserId")), m_FromUserId));
     }
-    if(m_FromUserDisplayName.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserDisplayName))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName")), m_FromUserDisplayName.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserDisplayName")), m_FromUserDisplayName));
     }
-    if(m_FromUserAvatar.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserAvatar))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserAvatar")), m_FromUserAvatar.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserAvatar")), m_FromUserAvatar));
     }
-    if(m_FromIpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_FromIpHash))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromIpHash")), m_FromIpHash));
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tags")), m_Tags));
     }
-    if(m_WeightIsSet)
+    if(m_FieldsSet.test(FieldBit_Weight))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("weight")), m_Weight));
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
-    if(m_ContentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("contentHTML")), m_ContentHTML));
     }
-    if(m_MediaIsSet)
+    if(m_FieldsSet.test(FieldBit_Media))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("media")), m_Media));
     }
-    if(m_LinksIsSet)
+    if(m_FieldsSet.test(FieldBit_Links))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("links")), m_Links));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_ReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_Reacts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reacts")), m_Reacts));
     }
-    if(m_CommentCount.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCount")), m_CommentCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCount")), m_CommentCount));
     }
 }
 
@@ -512,17 +902,17 @@ utility::string_t FeedPost::getId() const
 void FeedPost::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool FeedPost::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void FeedPost::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t FeedPost::getTenantId() const
 {
@@ -533,17 +923,17 @@ utility::string_t FeedPost::getTenantId() const
 void FeedPost::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool FeedPost::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void FeedPost::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t FeedPost::getTitle() const
 {
@@ -554,17 +944,17 @@ utility::string_t FeedPost::getTitle() const
 void FeedPost::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool FeedPost::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void FeedPost::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t FeedPost::getFromUserId() const
 {
@@ -575,57 +965,59 @@ utility::string_t FeedPost::getFromUserId() const
 void FeedPost::setFromUserId(const utility::string_t& value)
 {
     m_FromUserId = value;
-    m_FromUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_FromUserId);
 }
 
 bool FeedPost::fromUserIdIsSet() const
 {
-    return m_FromUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_FromUserId);
 }
 
 void FeedPost::unsetFromUserId()
 {
-    m_FromUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromUserId);
 }
 utility::string_t FeedPost::getFromUserDisplayName() const
 {
-    return m_FromUserDisplayName.get();
+    return m_FromUserDisplayName;
 }
 
 
 void FeedPost::setFromUserDisplayName(const utility::string_t& value)
 {
     m_FromUserDisplayName = value;
+    m_FieldsSet.set(FieldBit_FromUserDisplayName);
 }
 
 bool FeedPost::fromUserDisplayNameIsSet() const
 {
-    return m_FromUserDisplayName.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserDisplayName);
 }
 
 void FeedPost::unsetFromUserDisplayName()
 {
-    m_FromUserDisplayName.reset();
+    m_FieldsSet.reset(FieldBit_FromUserDisplayName);
 }
 utility::string_t FeedPost::getFromUserAvatar() const
 {
-    return m_FromUserAvatar.get();
+    return m_FromUserAvatar;
 }
 
 
 void FeedPost::setFromUserAvatar(const utility::string_t& value)
 {
     m_FromUserAvatar = value;
+    m_FieldsSet.set(FieldBit_FromUserAvatar);
 }
 
 bool FeedPost::fromUserAvatarIsSet() const
 {
-    return m_FromUserAvatar.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserAvatar);
 }
 
 void FeedPost::unsetFromUserAvatar()
 {
-    m_FromUserAvatar.reset();
+    m_FieldsSet.reset(FieldBit_FromUserAvatar);
 }
 utility::string_t FeedPost::getFromIpHash() const
 {
@@ -636,17 +1028,17 @@ utility::string_t FeedPost::getFromIpHash() const
 void FeedPost::setFromIpHash(const utility::string_t& value)
 {
     m_FromIpHash = value;
-    m_FromIpHashIsSet = true;
+    m_FieldsSet.set(FieldBit_FromIpHash);
 }
 
 bool FeedPost::fromIpHashIsSet() const
 {
-    return m_FromIpHashIsSet;
+    return m_FieldsSet.test(FieldBit_FromIpHash);
 }
 
 void FeedPost::unsetFromIpHash()
 {
-    m_FromIpHashIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromIpHash);
 }
 std::vector<utility::string_t> FeedPost::getTags() const
 {
@@ -657,17 +1049,17 @@ std::vector<utility::string_t> FeedPost::getTags() const
 void FeedPost::setTags(const std::vector<utility::string_t>& value)
 {
     m_Tags = value;
-    m_TagsIsSet = true;
+    m_FieldsSet.set(FieldBit_Tags);
 }
 
 bool FeedPost::tagsIsSet() const
 {
-    return m_TagsIsSet;
+    return m_FieldsSet.test(FieldBit_Tags);
 }
 
 void FeedPost::unsetTags()
 {
-    m_TagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tags);
 }
 double FeedPost::getWeight() const
 {
@@ -677,17 +1069,17 @@ double FeedPost::getWeight() const
 void FeedPost::setWeight(double value)
 {
     m_Weight = value;
-    m_WeightIsSet = true;
+    m_FieldsSet.set(FieldBit_Weight);
 }
 
 bool FeedPost::weightIsSet() const
 {
-    return m_WeightIsSet;
+    return m_FieldsSet.test(FieldBit_Weight);
 }
 
 void FeedPost::unsetWeight()
 {
-    m_WeightIsSet = false;
+    m_FieldsSet.reset(FieldBit_Weight);
 }
 std::map<utility::string_t, utility::string_t> FeedPost::getMeta() const
 {
@@ -698,17 +1090,17 @@ std::map<utility::string_t, utility::string_t> FeedPost::getMeta() const
 void FeedPost::setMeta(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Meta = value;
-    m_MetaIsSet = true;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool FeedPost::metaIsSet() const
 {
-    return m_MetaIsSet;
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void FeedPost::unsetMeta()
 {
-    m_MetaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 utility::string_t FeedPost::getContentHTML() const
 {
@@ -719,17 +1111,17 @@ utility::string_t FeedPost::getContentHTML() const
 void FeedPost::setContentHTML(const utility::string_t& value)
 {
     m_ContentHTML = value;
-    m_ContentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_ContentHTML);
 }
 
 bool FeedPost::contentHTMLIsSet() const
 {
-    return m_ContentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_ContentHTML);
 }
 
 void FeedPost::unsetContentHTML()
 {
-    m_ContentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_ContentHTML);
 }
 std::vector<std::shared_ptr<FeedPostMediaItem>> FeedPost::getMedia() const
 {
@@ -740,17 +1132,17 @@ std::vector<std::shared_ptr<FeedPostMediaItem>> FeedPost::getMedia() const
 void FeedPost::setMedia(const std::vector<std::shared_ptr<FeedPostMediaItem>>& value)
 {
     m_Media = value;
-    m_MediaIsSet = true;
+    m_FieldsSet.set(FieldBit_Media);
 }
 
 bool FeedPost::mediaIsSet() const
 {
-    return m_MediaIsSet;
+    return m_FieldsSet.test(FieldBit_Media);
 }
 
 void FeedPost::unsetMedia()
 {
-    m_MediaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Media);
 }
 std::vector<std::shared_ptr<FeedPostLink>> FeedPost::getLinks() const
 {
@@ -761,17 +1153,17 @@ std::vector<std::shared_ptr<FeedPostLink>> FeedPost::getLinks() const
 void FeedPost::setLinks(const std::vector<std::shared_ptr<FeedPostLink>>& value)
 {
     m_Links = value;
-    m_LinksIsSet = true;
+    m_FieldsSet.set(FieldBit_Links);
 }
 
 bool FeedPost::linksIsSet() const
 {
-    return m_LinksIsSet;
+    return m_FieldsSet.test(FieldBit_Links);
 }
 
 void FeedPost::unsetLinks()
 {
-    m_LinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_Links);
 }
 utility::datetime FeedPost::getCreatedAt() const
 {
@@ -782,17 +1174,17 @@ utility::datetime FeedPost::getCreatedAt() const
 void FeedPost::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool FeedPost::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void FeedPost::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 std::map<utility::string_t, int32_t> FeedPost::getReacts() const
 {
@@ -802,36 +1194,37 @@ std::map<utility::string_t, int32_t> FeedPost::getReacts() const
 void FeedPost::setReacts(std::map<utility::string_t, int32_t> value)
 {
     m_Reacts = value;
-    m_ReactsIsSet = true;
+    m_FieldsSet.set(FieldBit_Reacts);
 }
 
 bool FeedPost::reactsIsSet() const
 {
-    return m_ReactsIsSet;
+    return m_FieldsSet.test(FieldBit_Reacts);
 }
 
 void FeedPost::unsetReacts()
 {
-    m_ReactsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reacts);
 }
 int32_t FeedPost::getCommentCount() const
 {
-    return m_CommentCount.get();
+    return m_CommentCount;
 }
 
 void FeedPost::setCommentCount(int32_t value)
 {
     m_CommentCount = value;
+    m_FieldsSet.set(FieldBit_CommentCount);
 }
 
 bool FeedPost::commentCountIsSet() const
 {
-    return m_CommentCount.has_value();
+    return m_FieldsSet.test(FieldBit_CommentCount);
 }
 
 void FeedPost::unsetCommentCount()
 {
-    m_CommentCount.reset();
+    m_FieldsSet.reset(FieldBit_CommentCount);
 }
 
 }
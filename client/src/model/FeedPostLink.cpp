@@ -20,14 +20,6 @@ namespace model {
 
 FeedPostLink::FeedPostLink()
 {
-    m_Text = utility::conversions::to_string_t("");
-    m_TextIsSet = false;
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_Description = utility::conversions::to_string_t("");
-    m_DescriptionIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
 }
 
 FeedPostLink::~FeedPostLink()
@@ -42,22 +34,22 @@ void FeedPostLink::validate()
 web::json::value FeedPostLink::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TextIsSet)
+    if(m_FieldsSet.test(FieldBit_Text))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("text"))] = ModelBase::toJson(m_Text);
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("description"))] = ModelBase::toJson(m_Description);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
@@ -66,54 +58,187 @@ web::json::value FeedPostLink::toJson() const
     return val;
 }
 
+void FeedPostLink::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Text))
+    {
+        
+        writer.key(_XPLATSTR("text"));
+        ModelBase::writeJson(writer, m_Text);
+    }
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Description))
+    {
+        
+        writer.key(_XPLATSTR("description"));
+        ModelBase::writeJson(writer, m_Description);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+
+    writer.endObject();
+}
+
 bool FeedPostLink::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("text"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("text")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setText);
-            setText(refVal_setText);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
+        case ModelBase::fieldHash(_XPLATSTR("text")):
+            if(field.first == _XPLATSTR("text"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setText);
+                    setText(refVal_setText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            if(field.first == _XPLATSTR("description"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDescription;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
+                    setDescription(refVal_setDescription);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("description"))))
+    return ok;
+}
+
+void FeedPostLink::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Text))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("description")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDescription;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
-            setDescription(refVal_setDescription);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("text")), m_Text);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_Title))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Description))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("description")), m_Description);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+}
+
+bool FeedPostLink::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
+        case ModelBase::fieldHash(_XPLATSTR("text")):
+            {
+                utility::string_t refVal_setText;
+                if(!ModelBase::readBinary(reader, field, refVal_setText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setText(refVal_setText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            {
+                utility::string_t refVal_setDescription;
+                if(!ModelBase::readBinary(reader, field, refVal_setDescription))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDescription(refVal_setDescription);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FeedPostLink::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -123,19 +248,19 @@ void FeedPostLink::toMultipart(std::shared_ptr<MultipartFormData> multipart, con
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TextIsSet)
+    if(m_FieldsSet.test(FieldBit_Text))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("text")), m_Text));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("description")), m_Description));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
@@ -187,17 +312,17 @@ utility::string_t FeedPostLink::getText() const
 void FeedPostLink::setText(const utility::string_t& value)
 {
     m_Text = value;
-    m_TextIsSet = true;
+    m_FieldsSet.set(FieldBit_Text);
 }
 
 bool FeedPostLink::textIsSet() const
 {
-    return m_TextIsSet;
+    return m_FieldsSet.test(FieldBit_Text);
 }
 
 void FeedPostLink::unsetText()
 {
-    m_TextIsSet = false;
+    m_FieldsSet.reset(FieldBit_Text);
 }
 utility::string_t FeedPostLink::getTitle() const
 {
@@ -208,17 +333,17 @@ utility::string_t FeedPostLink::getTitle() const
 void FeedPostLink::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool FeedPostLink::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void FeedPostLink::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t FeedPostLink::getDescription() const
 {
@@ -229,17 +354,17 @@ utility::string_t FeedPostLink::getDescription() const
 void FeedPostLink::setDescription(const utility::string_t& value)
 {
     m_Description = value;
-    m_DescriptionIsSet = true;
+    m_FieldsSet.set(FieldBit_Description);
 }
 
 bool FeedPostLink::descriptionIsSet() const
 {
-    return m_DescriptionIsSet;
+    return m_FieldsSet.test(FieldBit_Description);
 }
 
 void FeedPostLink::unsetDescription()
 {
-    m_DescriptionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Description);
 }
 utility::string_t FeedPostLink::getUrl() const
 {
@@ -250,17 +375,17 @@ utility::string_t FeedPostLink::getUrl() const
 void FeedPostLink::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool FeedPostLink::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void FeedPostLink::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 
 }
@@ -20,11 +20,6 @@ namespace model {
 
 FeedPostMediaItem::FeedPostMediaItem()
 {
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_LinkUrl = utility::conversions::to_string_t("");
-    m_LinkUrlIsSet = false;
-    m_SizesIsSet = false;
 }
 
 FeedPostMediaItem::~FeedPostMediaItem()
@@ -39,17 +34,17 @@ void FeedPostMediaItem::validate()
 web::json::value FeedPostMediaItem::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_LinkUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("linkUrl"))] = ModelBase::toJson(m_LinkUrl);
     }
-    if(m_SizesIsSet)
+    if(m_FieldsSet.test(FieldBit_Sizes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sizes"))] = ModelBase::toJson(m_Sizes);
@@ -58,43 +53,153 @@ web::json::value FeedPostMediaItem::toJson() const
     return val;
 }
 
+void FeedPostMediaItem::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
+    {
+        
+        writer.key(_XPLATSTR("linkUrl"));
+        ModelBase::writeJson(writer, m_LinkUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_Sizes))
+    {
+        
+        writer.key(_XPLATSTR("sizes"));
+        ModelBase::writeJson(writer, m_Sizes);
+    }
+
+    writer.endObject();
+}
+
 bool FeedPostMediaItem::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("linkUrl"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("linkUrl")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setLinkUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLinkUrl);
-            setLinkUrl(refVal_setLinkUrl);
-            
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("linkUrl")):
+            if(field.first == _XPLATSTR("linkUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLinkUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLinkUrl);
+                    setLinkUrl(refVal_setLinkUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sizes")):
+            if(field.first == _XPLATSTR("sizes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPostMediaItemAsset>> refVal_setSizes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSizes);
+                    setSizes(refVal_setSizes);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sizes"))))
+    return ok;
+}
+
+void FeedPostMediaItem::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("linkUrl")), m_LinkUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_Sizes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sizes")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sizes")), m_Sizes);
+    }
+}
+
+bool FeedPostMediaItem::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<FeedPostMediaItemAsset>> refVal_setSizes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSizes);
-            setSizes(refVal_setSizes);
-            
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("linkUrl")):
+            {
+                utility::string_t refVal_setLinkUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setLinkUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLinkUrl(refVal_setLinkUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sizes")):
+            {
+                std::vector<std::shared_ptr<FeedPostMediaItemAsset>> refVal_setSizes;
+                if(!ModelBase::readBinary(reader, field, refVal_setSizes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSizes(refVal_setSizes);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FeedPostMediaItem::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -104,15 +209,15 @@ void FeedPostMediaItem::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_LinkUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("linkUrl")), m_LinkUrl));
     }
-    if(m_SizesIsSet)
+    if(m_FieldsSet.test(FieldBit_Sizes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sizes")), m_Sizes));
     }
@@ -158,17 +263,17 @@ utility::string_t FeedPostMediaItem::getTitle() const
 void FeedPostMediaItem::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool FeedPostMediaItem::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void FeedPostMediaItem::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t FeedPostMediaItem::getLinkUrl() const
 {
@@ -179,17 +284,17 @@ utility::string_t FeedPostMediaItem::getLinkUrl() const
 void FeedPostMediaItem::setLinkUrl(const utility::string_t& value)
 {
     m_LinkUrl = value;
-    m_LinkUrlIsSet = true;
+    m_FieldsSet.set(FieldBit_LinkUrl);
 }
 
 bool FeedPostMediaItem::linkUrlIsSet() const
 {
-    return m_LinkUrlIsSet;
+    return m_FieldsSet.test(FieldBit_LinkUrl);
 }
 
 void FeedPostMediaItem::unsetLinkUrl()
 {
-    m_LinkUrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_LinkUrl);
 }
 std::vector<std::shared_ptr<FeedPostMediaItemAsset>> FeedPostMediaItem::getSizes() const
 {
@@ -200,17 +305,17 @@ std::vector<std::shared_ptr<FeedPostMediaItemAsset>> FeedPostMediaItem::getSizes
 void FeedPostMediaItem::setSizes(const std::vector<std::shared_ptr<FeedPostMediaItemAsset>>& value)
 {
     m_Sizes = value;
-    m_SizesIsSet = true;
+    m_FieldsSet.set(FieldBit_Sizes);
 }
 
 bool FeedPostMediaItem::sizesIsSet() const
 {
-    return m_SizesIsSet;
+    return m_FieldsSet.test(FieldBit_Sizes);
 }
 
 void FeedPostMediaItem::unsetSizes()
 {
-    m_SizesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sizes);
 }
 
 }
@@ -20,9 +20,7 @@ namespace model {
 
 FeedPostStats::FeedPostStats()
 {
-    m_ReactsIsSet = false;
     m_CommentCount = 0;
-    m_CommentCountIsSet = false;
 }
 
 FeedPostStats::~FeedPostStats()
@@ -37,12 +35,12 @@ void FeedPostStats::validate()
 web::json::value FeedPostStats::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_Reacts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reacts"))] = ModelBase::toJson(m_Reacts);
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentCount"))] = ModelBase::toJson(m_CommentCount);
@@ -51,32 +49,119 @@ web::json::value FeedPostStats::toJson() const
     return val;
 }
 
+void FeedPostStats::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Reacts))
+    {
+        
+        writer.key(_XPLATSTR("reacts"));
+        ModelBase::writeJson(writer, m_Reacts);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        writer.key(_XPLATSTR("commentCount"));
+        ModelBase::writeJson(writer, m_CommentCount);
+    }
+
+    writer.endObject();
+}
+
 bool FeedPostStats::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reacts"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reacts")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, int32_t> refVal_setReacts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReacts);
-            setReacts(refVal_setReacts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reacts")):
+            if(field.first == _XPLATSTR("reacts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, int32_t> refVal_setReacts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReacts);
+                    setReacts(refVal_setReacts);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            if(field.first == _XPLATSTR("commentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
+                    setCommentCount(refVal_setCommentCount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCount"))))
+    return ok;
+}
+
+void FeedPostStats::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Reacts))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCount")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reacts")), m_Reacts);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCount")), m_CommentCount);
+    }
+}
+
+bool FeedPostStats::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int32_t refVal_setCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
-            setCommentCount(refVal_setCommentCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reacts")):
+            {
+                std::map<utility::string_t, int32_t> refVal_setReacts;
+                if(!ModelBase::readBinary(reader, field, refVal_setReacts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReacts(refVal_setReacts);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            {
+                int32_t refVal_setCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCount(refVal_setCommentCount);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FeedPostStats::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +171,11 @@ void FeedPostStats::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_Reacts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reacts")), m_Reacts));
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCount")), m_CommentCount));
     }
@@ -129,17 +214,17 @@ std::map<utility::string_t, int32_t> FeedPostStats::getReacts() const
 void FeedPostStats::setReacts(std::map<utility::string_t, int32_t> value)
 {
     m_Reacts = value;
-    m_ReactsIsSet = true;
+    m_FieldsSet.set(FieldBit_Reacts);
 }
 
 bool FeedPostStats::reactsIsSet() const
 {
-    return m_ReactsIsSet;
+    return m_FieldsSet.test(FieldBit_Reacts);
 }
 
 void FeedPostStats::unsetReacts()
 {
-    m_ReactsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reacts);
 }
 int32_t FeedPostStats::getCommentCount() const
 {
@@ -149,17 +234,17 @@ int32_t FeedPostStats::getCommentCount() const
 void FeedPostStats::setCommentCount(int32_t value)
 {
     m_CommentCount = value;
-    m_CommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentCount);
 }
 
 bool FeedPostStats::commentCountIsSet() const
 {
-    return m_CommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_CommentCount);
 }
 
 void FeedPostStats::unsetCommentCount()
 {
-    m_CommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentCount);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 FeedPostsStatsResponse::FeedPostsStatsResponse()
 {
-    m_StatusIsSet = false;
-    m_StatsIsSet = false;
 }
 
 FeedPostsStatsResponse::~FeedPostsStatsResponse()
@@ -36,12 +34,12 @@ void FeedPostsStatsResponse::validate()
 web::json::value FeedPostsStatsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_StatsIsSet)
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("stats"))] = ModelBase::toJson(m_Stats);
@@ -50,32 +48,119 @@ web::json::value FeedPostsStatsResponse::toJson() const
     return val;
 }
 
+void FeedPostsStatsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Stats))
+    {
+        
+        writer.key(_XPLATSTR("stats"));
+        ModelBase::writeJson(writer, m_Stats);
+    }
+
+    writer.endObject();
+}
+
 bool FeedPostsStatsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("stats")):
+            if(field.first == _XPLATSTR("stats"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<FeedPostStats>> refVal_setStats;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStats);
+                    setStats(refVal_setStats);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("stats"))))
+    return ok;
+}
+
+void FeedPostsStatsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("stats")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Stats))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("stats")), m_Stats);
+    }
+}
+
+bool FeedPostsStatsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, std::shared_ptr<FeedPostStats>> refVal_setStats;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStats);
-            setStats(refVal_setStats);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("stats")):
+            {
+                std::map<utility::string_t, std::shared_ptr<FeedPostStats>> refVal_setStats;
+                if(!ModelBase::readBinary(reader, field, refVal_setStats))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStats(refVal_setStats);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FeedPostsStatsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void FeedPostsStatsResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_StatsIsSet)
+    if(m_FieldsSet.test(FieldBit_Stats))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("stats")), m_Stats));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> FeedPostsStatsResponse::getStatus() const
 void FeedPostsStatsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool FeedPostsStatsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void FeedPostsStatsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::map<utility::string_t, std::shared_ptr<FeedPostStats>> FeedPostsStatsResponse::getStats() const
 {
@@ -150,17 +235,17 @@ std::map<utility::string_t, std::shared_ptr<FeedPostStats>> FeedPostsStatsRespon
 void FeedPostsStatsResponse::setStats(const std::map<utility::string_t, std::shared_ptr<FeedPostStats>>& value)
 {
     m_Stats = value;
-    m_StatsIsSet = true;
+    m_FieldsSet.set(FieldBit_Stats);
 }
 
 bool FeedPostsStatsResponse::statsIsSet() const
 {
-    return m_StatsIsSet;
+    return m_FieldsSet.test(FieldBit_Stats);
 }
 
 void FeedPostsStatsResponse::unsetStats()
 {
-    m_StatsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Stats);
 }
 
 }
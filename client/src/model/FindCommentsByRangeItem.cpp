@@ -20,7 +20,6 @@ namespace model {
 
 FindCommentsByRangeItem::FindCommentsByRangeItem()
 {
-    m_ResultIsSet = false;
 }
 
 FindCommentsByRangeItem::~FindCommentsByRangeItem()
@@ -35,12 +34,12 @@ void FindCommentsByRangeItem::validate()
 web::json::value FindCommentsByRangeItem::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_Comment.has_value())
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_ResultIsSet)
+    if(m_FieldsSet.test(FieldBit_Result))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("result"))] = ModelBase::toJson(m_Result);
@@ -49,32 +48,119 @@ web::json::value FindCommentsByRangeItem::toJson() const
     return val;
 }
 
+void FindCommentsByRangeItem::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_Result))
+    {
+        
+        writer.key(_XPLATSTR("result"));
+        ModelBase::writeJson(writer, m_Result);
+    }
+
+    writer.endObject();
+}
+
 bool FindCommentsByRangeItem::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<FComment> refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<FComment> refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("result")):
+            if(field.first == _XPLATSTR("result"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QuestionResult> refVal_setResult;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setResult);
+                    setResult(refVal_setResult);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("result"))))
+    return ok;
+}
+
+void FindCommentsByRangeItem::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("result")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_Result))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("result")), m_Result);
+    }
+}
+
+bool FindCommentsByRangeItem::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<QuestionResult> refVal_setResult;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setResult);
-            setResult(refVal_setResult);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                std::shared_ptr<FComment> refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("result")):
+            {
+                std::shared_ptr<QuestionResult> refVal_setResult;
+                if(!ModelBase::readBinary(reader, field, refVal_setResult))
+                {
+                    ok = false;
+                    continue;
+                }
+                setResult(refVal_setResult);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FindCommentsByRangeItem::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -84,11 +170,11 @@ void FindCommentsByRangeItem::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_Comment.has_value())
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_ResultIsSet)
+    if(m_FieldsSet.test(FieldBit_Result))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("result")), m_Result));
     }
@@ -121,23 +207,24 @@ bool FindCommentsByRangeItem::fromMultiPart(std::shared_ptr<MultipartFormData> m
 
 std::shared_ptr<FComment> FindCommentsByRangeItem::getComment() const
 {
-    return m_Comment.get();
+    return m_Comment;
 }
 
 
 void FindCommentsByRangeItem::setComment(const std::shared_ptr<FComment>& value)
 {
     m_Comment = value;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool FindCommentsByRangeItem::commentIsSet() const
 {
-    return m_Comment.has_value();
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void FindCommentsByRangeItem::unsetComment()
 {
-    m_Comment.reset();
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 std::shared_ptr<QuestionResult> FindCommentsByRangeItem::getResult() const
 {
@@ -148,17 +235,17 @@ std::shared_ptr<QuestionResult> FindCommentsByRangeItem::getResult() const
 void FindCommentsByRangeItem::setResult(const std::shared_ptr<QuestionResult>& value)
 {
     m_Result = value;
-    m_ResultIsSet = true;
+    m_FieldsSet.set(FieldBit_Result);
 }
 
 bool FindCommentsByRangeItem::resultIsSet() const
 {
-    return m_ResultIsSet;
+    return m_FieldsSet.test(FieldBit_Result);
 }
 
 void FindCommentsByRangeItem::unsetResult()
 {
-    m_ResultIsSet = false;
+    m_FieldsSet.reset(FieldBit_Result);
 }
 
 }
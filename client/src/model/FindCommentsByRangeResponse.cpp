@@ -20,9 +20,6 @@ namespace model {
 
 FindCommentsByRangeResponse::FindCommentsByRangeResponse()
 {
-    m_ResultsIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
 }
 
 FindCommentsByRangeResponse::~FindCommentsByRangeResponse()
@@ -37,12 +34,12 @@ void FindCommentsByRangeResponse::validate()
 web::json::value FindCommentsByRangeResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_Results))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("results"))] = ModelBase::toJson(m_Results);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
@@ -51,32 +48,119 @@ web::json::value FindCommentsByRangeResponse::toJson() const
     return val;
 }
 
+void FindCommentsByRangeResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Results))
+    {
+        
+        writer.key(_XPLATSTR("results"));
+        ModelBase::writeJson(writer, m_Results);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+
+    writer.endObject();
+}
+
 bool FindCommentsByRangeResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("results"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("results")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<FindCommentsByRangeItem>> refVal_setResults;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setResults);
-            setResults(refVal_setResults);
-            
+        case ModelBase::fieldHash(_XPLATSTR("results")):
+            if(field.first == _XPLATSTR("results"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FindCommentsByRangeItem>> refVal_setResults;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setResults);
+                    setResults(refVal_setResults);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    return ok;
+}
+
+void FindCommentsByRangeResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Results))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("results")), m_Results);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
+    }
+}
+
+bool FindCommentsByRangeResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
+        case ModelBase::fieldHash(_XPLATSTR("results")):
+            {
+                std::vector<std::shared_ptr<FindCommentsByRangeItem>> refVal_setResults;
+                if(!ModelBase::readBinary(reader, field, refVal_setResults))
+                {
+                    ok = false;
+                    continue;
+                }
+                setResults(refVal_setResults);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FindCommentsByRangeResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void FindCommentsByRangeResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_Results))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("results")), m_Results));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
@@ -130,17 +214,17 @@ std::vector<std::shared_ptr<FindCommentsByRangeItem>> FindCommentsByRangeRespons
 void FindCommentsByRangeResponse::setResults(const std::vector<std::shared_ptr<FindCommentsByRangeItem>>& value)
 {
     m_Results = value;
-    m_ResultsIsSet = true;
+    m_FieldsSet.set(FieldBit_Results);
 }
 
 bool FindCommentsByRangeResponse::resultsIsSet() const
 {
-    return m_ResultsIsSet;
+    return m_FieldsSet.test(FieldBit_Results);
 }
 
 void FindCommentsByRangeResponse::unsetResults()
 {
-    m_ResultsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Results);
 }
 utility::datetime FindCommentsByRangeResponse::getCreatedAt() const
 {
@@ -151,17 +235,17 @@ utility::datetime FindCommentsByRangeResponse::getCreatedAt() const
 void FindCommentsByRangeResponse::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool FindCommentsByRangeResponse::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void FindCommentsByRangeResponse::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 
 }
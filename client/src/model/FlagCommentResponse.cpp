@@ -21,14 +21,7 @@ namespace model {
 FlagCommentResponse::FlagCommentResponse()
 {
     m_StatusCode = 0;
-    m_StatusCodeIsSet = false;
-    m_StatusIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
     m_WasUnapproved = false;
-    m_WasUnapprovedIsSet = false;
 }
 
 FlagCommentResponse::~FlagCommentResponse()
@@ -43,27 +36,27 @@ void FlagCommentResponse::validate()
 web::json::value FlagCommentResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_StatusCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("statusCode"))] = ModelBase::toJson(m_StatusCode);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_WasUnapprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_WasUnapproved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wasUnapproved"))] = ModelBase::toJson(m_WasUnapproved);
@@ -72,65 +65,221 @@ web::json::value FlagCommentResponse::toJson() const
     return val;
 }
 
+void FlagCommentResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_StatusCode))
+    {
+        
+        writer.key(_XPLATSTR("statusCode"));
+        ModelBase::writeJson(writer, m_StatusCode);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_WasUnapproved))
+    {
+        
+        writer.key(_XPLATSTR("wasUnapproved"));
+        ModelBase::writeJson(writer, m_WasUnapproved);
+    }
+
+    writer.endObject();
+}
+
 bool FlagCommentResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("statusCode"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("statusCode")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setStatusCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatusCode);
-            setStatusCode(refVal_setStatusCode);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("statusCode")):
+            if(field.first == _XPLATSTR("statusCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setStatusCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatusCode);
+                    setStatusCode(refVal_setStatusCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wasUnapproved")):
+            if(field.first == _XPLATSTR("wasUnapproved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setWasUnapproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWasUnapproved);
+                    setWasUnapproved(refVal_setWasUnapproved);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    return ok;
+}
+
+void FlagCommentResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_StatusCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("statusCode")), m_StatusCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wasUnapproved"))))
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wasUnapproved")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_WasUnapproved))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wasUnapproved")), m_WasUnapproved);
+    }
+}
+
+bool FlagCommentResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setWasUnapproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWasUnapproved);
-            setWasUnapproved(refVal_setWasUnapproved);
-            
+        case ModelBase::fieldHash(_XPLATSTR("statusCode")):
+            {
+                int32_t refVal_setStatusCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatusCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatusCode(refVal_setStatusCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wasUnapproved")):
+            {
+                bool refVal_setWasUnapproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setWasUnapproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWasUnapproved(refVal_setWasUnapproved);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void FlagCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -140,23 +289,23 @@ void FlagCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_StatusCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("statusCode")), m_StatusCode));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_WasUnapprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_WasUnapproved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wasUnapproved")), m_WasUnapproved));
     }
@@ -213,17 +362,17 @@ int32_t FlagCommentResponse::getStatusCode() const
 void FlagCommentResponse::setStatusCode(int32_t value)
 {
     m_StatusCode = value;
-    m_StatusCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_StatusCode);
 }
 
 bool FlagCommentResponse::statusCodeIsSet() const
 {
-    return m_StatusCodeIsSet;
+    return m_FieldsSet.test(FieldBit_StatusCode);
 }
 
 void FlagCommentResponse::unsetStatusCode()
 {
-    m_StatusCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_StatusCode);
 }
 std::shared_ptr<APIStatus> FlagCommentResponse::getStatus() const
 {
@@ -234,17 +383,17 @@ std::shared_ptr<APIStatus> FlagCommentResponse::getStatus() const
 void FlagCommentResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool FlagCommentResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void FlagCommentResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t FlagCommentResponse::getCode() const
 {
@@ -255,17 +404,17 @@ utility::string_t FlagCommentResponse::getCode() const
 void FlagCommentResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool FlagCommentResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void FlagCommentResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 utility::string_t FlagCommentResponse::getReason() const
 {
@@ -276,17 +425,17 @@ utility::string_t FlagCommentResponse::getReason() const
 void FlagCommentResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool FlagCommentResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void FlagCommentResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 bool FlagCommentResponse::isWasUnapproved() const
 {
@@ -296,17 +445,17 @@ bool FlagCommentResponse::isWasUnapproved() const
 void FlagCommentResponse::setWasUnapproved(bool value)
 {
     m_WasUnapproved = value;
-    m_WasUnapprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_WasUnapproved);
 }
 
 bool FlagCommentResponse::wasUnapprovedIsSet() const
 {
-    return m_WasUnapprovedIsSet;
+    return m_FieldsSet.test(FieldBit_WasUnapproved);
 }
 
 void FlagCommentResponse::unsetWasUnapproved()
 {
-    m_WasUnapprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_WasUnapproved);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetAuditLogsResponse::GetAuditLogsResponse()
 {
-    m_StatusIsSet = false;
-    m_AuditLogsIsSet = false;
 }
 
 GetAuditLogsResponse::~GetAuditLogsResponse()
@@ -36,12 +34,12 @@ void GetAuditLogsResponse::validate()
 web::json::value GetAuditLogsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_AuditLogsIsSet)
+    if(m_FieldsSet.test(FieldBit_AuditLogs))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("auditLogs"))] = ModelBase::toJson(m_AuditLogs);
@@ -50,32 +48,119 @@ web::json::value GetAuditLogsResponse::toJson() const
     return val;
 }
 
+void GetAuditLogsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_AuditLogs))
+    {
+        
+        writer.key(_XPLATSTR("auditLogs"));
+        ModelBase::writeJson(writer, m_AuditLogs);
+    }
+
+    writer.endObject();
+}
+
 bool GetAuditLogsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("auditLogs")):
+            if(field.first == _XPLATSTR("auditLogs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APIAuditLog>> refVal_setAuditLogs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAuditLogs);
+                    setAuditLogs(refVal_setAuditLogs);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("auditLogs"))))
+    return ok;
+}
+
+void GetAuditLogsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("auditLogs")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_AuditLogs))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("auditLogs")), m_AuditLogs);
+    }
+}
+
+bool GetAuditLogsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<APIAuditLog>> refVal_setAuditLogs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAuditLogs);
-            setAuditLogs(refVal_setAuditLogs);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("auditLogs")):
+            {
+                std::vector<std::shared_ptr<APIAuditLog>> refVal_setAuditLogs;
+                if(!ModelBase::readBinary(reader, field, refVal_setAuditLogs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAuditLogs(refVal_setAuditLogs);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetAuditLogsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetAuditLogsResponse::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_AuditLogsIsSet)
+    if(m_FieldsSet.test(FieldBit_AuditLogs))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("auditLogs")), m_AuditLogs));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetAuditLogsResponse::getStatus() const
 void GetAuditLogsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetAuditLogsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetAuditLogsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<APIAuditLog>> GetAuditLogsResponse::getAuditLogs() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<APIAuditLog>> GetAuditLogsResponse::getAuditLogs() c
 void GetAuditLogsResponse::setAuditLogs(const std::vector<std::shared_ptr<APIAuditLog>>& value)
 {
     m_AuditLogs = value;
-    m_AuditLogsIsSet = true;
+    m_FieldsSet.set(FieldBit_AuditLogs);
 }
 
 bool GetAuditLogsResponse::auditLogsIsSet() const
 {
-    return m_AuditLogsIsSet;
+    return m_FieldsSet.test(FieldBit_AuditLogs);
 }
 
 void GetAuditLogsResponse::unsetAuditLogs()
 {
-    m_AuditLogsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AuditLogs);
 }
 
 }
@@ -21,9 +21,6 @@ namespace model {
 GetBannedUsersCountResponse::GetBannedUsersCountResponse()
 {
     m_TotalCount = 0.0;
-    m_TotalCountIsSet = false;
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
 }
 
 GetBannedUsersCountResponse::~GetBannedUsersCountResponse()
@@ -38,12 +35,12 @@ void GetBannedUsersCountResponse::validate()
 web::json::value GetBannedUsersCountResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TotalCountIsSet)
+    if(m_FieldsSet.test(FieldBit_TotalCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("totalCount"))] = ModelBase::toJson(m_TotalCount);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -52,32 +49,119 @@ web::json::value GetBannedUsersCountResponse::toJson() const
     return val;
 }
 
+void GetBannedUsersCountResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_TotalCount))
+    {
+        
+        writer.key(_XPLATSTR("totalCount"));
+        ModelBase::writeJson(writer, m_TotalCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetBannedUsersCountResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("totalCount"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("totalCount")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setTotalCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTotalCount);
-            setTotalCount(refVal_setTotalCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("totalCount")):
+            if(field.first == _XPLATSTR("totalCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setTotalCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTotalCount);
+                    setTotalCount(refVal_setTotalCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetBannedUsersCountResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_TotalCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("totalCount")), m_TotalCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetBannedUsersCountResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("totalCount")):
+            {
+                double refVal_setTotalCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setTotalCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTotalCount(refVal_setTotalCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetBannedUsersCountResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -87,11 +171,11 @@ void GetBannedUsersCountResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TotalCountIsSet)
+    if(m_FieldsSet.test(FieldBit_TotalCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("totalCount")), m_TotalCount));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -130,17 +214,17 @@ double GetBannedUsersCountResponse::getTotalCount() const
 void GetBannedUsersCountResponse::setTotalCount(double value)
 {
     m_TotalCount = value;
-    m_TotalCountIsSet = true;
+    m_FieldsSet.set(FieldBit_TotalCount);
 }
 
 bool GetBannedUsersCountResponse::totalCountIsSet() const
 {
-    return m_TotalCountIsSet;
+    return m_FieldsSet.test(FieldBit_TotalCount);
 }
 
 void GetBannedUsersCountResponse::unsetTotalCount()
 {
-    m_TotalCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_TotalCount);
 }
 utility::string_t GetBannedUsersCountResponse::getStatus() const
 {
@@ -151,17 +235,17 @@ utility::string_t GetBannedUsersCountResponse::getStatus() const
 void GetBannedUsersCountResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetBannedUsersCountResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetBannedUsersCountResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,9 +20,6 @@ namespace model {
 
 GetBannedUsersFromCommentResponse::GetBannedUsersFromCommentResponse()
 {
-    m_BannedUsersIsSet = false;
-    m_CodeIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetBannedUsersFromCommentResponse::~GetBannedUsersFromCommentResponse()
@@ -37,19 +34,19 @@ void GetBannedUsersFromCommentResponse::validate()
 web::json::value GetBannedUsersFromCommentResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_BannedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bannedUsers"))] = ModelBase::toJson(m_BannedUsers);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         utility::string_t refVal = fromCodeEnum(m_Code);
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -58,44 +55,157 @@ web::json::value GetBannedUsersFromCommentResponse::toJson() const
     return val;
 }
 
+void GetBannedUsersFromCommentResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_BannedUsers))
+    {
+        
+        writer.key(_XPLATSTR("bannedUsers"));
+        ModelBase::writeJson(writer, m_BannedUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        utility::string_t refVal = fromCodeEnum(m_Code);
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetBannedUsersFromCommentResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedUsers"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedUsers")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<APIBannedUserWithMultiMatchInfo>> refVal_setBannedUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUsers);
-            setBannedUsers(refVal_setBannedUsers);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            
-            setCode(toCodeEnum(refVal_setCode));
-            
+        case ModelBase::fieldHash(_XPLATSTR("bannedUsers")):
+            if(field.first == _XPLATSTR("bannedUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APIBannedUserWithMultiMatchInfo>> refVal_setBannedUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUsers);
+                    setBannedUsers(refVal_setBannedUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(toCodeEnum(refVal_setCode));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetBannedUsersFromCommentResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_BannedUsers))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedUsers")), m_BannedUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        utility::string_t refVal = fromCodeEnum(m_Code);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetBannedUsersFromCommentResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("bannedUsers")):
+            {
+                std::vector<std::shared_ptr<APIBannedUserWithMultiMatchInfo>> refVal_setBannedUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedUsers(refVal_setBannedUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(toCodeEnum(refVal_setCode));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetBannedUsersFromCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -105,15 +215,15 @@ void GetBannedUsersFromCommentResponse::toMultipart(std::shared_ptr<MultipartFor
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_BannedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedUsers")), m_BannedUsers));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), fromCodeEnum(m_Code)));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -186,17 +296,17 @@ std::vector<std::shared_ptr<APIBannedUserWithMultiMatchInfo>> GetBannedUsersFrom
 void GetBannedUsersFromCommentResponse::setBannedUsers(const std::vector<std::shared_ptr<APIBannedUserWithMultiMatchInfo>>& value)
 {
     m_BannedUsers = value;
-    m_BannedUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_BannedUsers);
 }
 
 bool GetBannedUsersFromCommentResponse::bannedUsersIsSet() const
 {
-    return m_BannedUsersIsSet;
+    return m_FieldsSet.test(FieldBit_BannedUsers);
 }
 
 void GetBannedUsersFromCommentResponse::unsetBannedUsers()
 {
-    m_BannedUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_BannedUsers);
 }
 GetBannedUsersFromCommentResponse::CodeEnum GetBannedUsersFromCommentResponse::getCode() const
 {
@@ -207,17 +317,17 @@ GetBannedUsersFromCommentResponse::CodeEnum GetBannedUsersFromCommentResponse::g
 void GetBannedUsersFromCommentResponse::setCode(const CodeEnum value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool GetBannedUsersFromCommentResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void GetBannedUsersFromCommentResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 std::shared_ptr<APIStatus> GetBannedUsersFromCommentResponse::getStatus() const
 {
@@ -228,17 +338,17 @@ std::shared_ptr<APIStatus> GetBannedUsersFromCommentResponse::getStatus() const
 void GetBannedUsersFromCommentResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetBannedUsersFromCommentResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetBannedUsersFromCommentResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
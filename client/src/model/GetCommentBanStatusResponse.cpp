@@ -20,8 +20,7 @@ namespace model {
 
 GetCommentBanStatusResponse::GetCommentBanStatusResponse()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
+    m_CanIPBan = false;
 }
 
 GetCommentBanStatusResponse::~GetCommentBanStatusResponse()
@@ -36,62 +35,172 @@ void GetCommentBanStatusResponse::validate()
 web::json::value GetCommentBanStatusResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_EmailDomain.has_value())
+    if(m_FieldsSet.test(FieldBit_EmailDomain))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("emailDomain"))] = ModelBase::toJson(m_EmailDomain.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("emailDomain"))] = ModelBase::toJson(m_EmailDomain);
     }
-    if(m_CanIPBan.has_value())
+    if(m_FieldsSet.test(FieldBit_CanIPBan))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("canIPBan"))] = ModelBase::toJson(m_CanIPBan.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("canIPBan"))] = ModelBase::toJson(m_CanIPBan);
     }
 
     return val;
 }
 
+void GetCommentBanStatusResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailDomain))
+    {
+        
+        writer.key(_XPLATSTR("emailDomain"));
+        ModelBase::writeJson(writer, m_EmailDomain);
+    }
+    if(m_FieldsSet.test(FieldBit_CanIPBan))
+    {
+        
+        writer.key(_XPLATSTR("canIPBan"));
+        ModelBase::writeJson(writer, m_CanIPBan);
+    }
+
+    writer.endObject();
+}
+
 bool GetCommentBanStatusResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailDomain"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailDomain")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setEmailDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailDomain);
-            setEmailDomain(refVal_setEmailDomain);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailDomain")):
+            if(field.first == _XPLATSTR("emailDomain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailDomain);
+                    setEmailDomain(refVal_setEmailDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("canIPBan")):
+            if(field.first == _XPLATSTR("canIPBan"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setCanIPBan;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCanIPBan);
+                    setCanIPBan(refVal_setCanIPBan);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("canIPBan"))))
+    return ok;
+}
+
+void GetCommentBanStatusResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailDomain))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailDomain")), m_EmailDomain);
+    }
+    if(m_FieldsSet.test(FieldBit_CanIPBan))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("canIPBan")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("canIPBan")), m_CanIPBan);
+    }
+}
+
+bool GetCommentBanStatusResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setCanIPBan;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCanIPBan);
-            setCanIPBan(refVal_setCanIPBan);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailDomain")):
+            {
+                utility::string_t refVal_setEmailDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailDomain(refVal_setEmailDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("canIPBan")):
+            {
+                bool refVal_setCanIPBan;
+                if(!ModelBase::readBinary(reader, field, refVal_setCanIPBan))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCanIPBan(refVal_setCanIPBan);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetCommentBanStatusResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -101,17 +210,17 @@ void GetCommentBanStatusResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_EmailDomain.has_value())
+    if(m_FieldsSet.test(FieldBit_EmailDomain))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailDomain")), m_EmailDomain.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailDomain")), m_EmailDomain));
     }
-    if(m_CanIPBan.has_value())
+    if(m_FieldsSet.test(FieldBit_CanIPBan))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("canIPBan")), m_CanIPBan.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("canIPBan")), m_CanIPBan));
     }
 }
 
@@ -155,56 +264,58 @@ utility::string_t GetCommentBanStatusResponse::getStatus() const
 void GetCommentBanStatusResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetCommentBanStatusResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetCommentBanStatusResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t GetCommentBanStatusResponse::getEmailDomain() const
 {
-    return m_EmailDomain.get();
+    return m_EmailDomain;
 }
 
 
 void GetCommentBanStatusResponse::setEmailDomain(const utility::string_t& value)
 {
     m_EmailDomain = value;
+    m_FieldsSet.set(FieldBit_EmailDomain);
 }
 
 bool GetCommentBanStatusResponse::emailDomainIsSet() const
 {
-    return m_EmailDomain.has_value();
+    return m_FieldsSet.test(FieldBit_EmailDomain);
 }
 
 void GetCommentBanStatusResponse::unsetEmailDomain()
 {
-    m_EmailDomain.reset();
+    m_FieldsSet.reset(FieldBit_EmailDomain);
 }
 bool GetCommentBanStatusResponse::isCanIPBan() const
 {
-    return m_CanIPBan.get();
+    return m_CanIPBan;
 }
 
 void GetCommentBanStatusResponse::setCanIPBan(bool value)
 {
     m_CanIPBan = value;
+    m_FieldsSet.set(FieldBit_CanIPBan);
 }
 
 bool GetCommentBanStatusResponse::canIPBanIsSet() const
 {
-    return m_CanIPBan.has_value();
+    return m_FieldsSet.test(FieldBit_CanIPBan);
 }
 
 void GetCommentBanStatusResponse::unsetCanIPBan()
 {
-    m_CanIPBan.reset();
+    m_FieldsSet.reset(FieldBit_CanIPBan);
 }
 
 }
@@ -20,10 +20,7 @@ namespace model {
 
 GetCommentVoteUserNamesSuccessResponse::GetCommentVoteUserNamesSuccessResponse()
 {
-    m_StatusIsSet = false;
-    m_VoteUserNamesIsSet = false;
     m_HasMore = false;
-    m_HasMoreIsSet = false;
 }
 
 GetCommentVoteUserNamesSuccessResponse::~GetCommentVoteUserNamesSuccessResponse()
@@ -38,17 +35,17 @@ void GetCommentVoteUserNamesSuccessResponse::validate()
 web::json::value GetCommentVoteUserNamesSuccessResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_VoteUserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteUserNames))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("voteUserNames"))] = ModelBase::toJson(m_VoteUserNames);
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasMore"))] = ModelBase::toJson(m_HasMore);
@@ -57,43 +54,153 @@ web::json::value GetCommentVoteUserNamesSuccessResponse::toJson() const
     return val;
 }
 
+void GetCommentVoteUserNamesSuccessResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_VoteUserNames))
+    {
+        
+        writer.key(_XPLATSTR("voteUserNames"));
+        ModelBase::writeJson(writer, m_VoteUserNames);
+    }
+    if(m_FieldsSet.test(FieldBit_HasMore))
+    {
+        
+        writer.key(_XPLATSTR("hasMore"));
+        ModelBase::writeJson(writer, m_HasMore);
+    }
+
+    writer.endObject();
+}
+
 bool GetCommentVoteUserNamesSuccessResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("voteUserNames"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("voteUserNames")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setVoteUserNames;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVoteUserNames);
-            setVoteUserNames(refVal_setVoteUserNames);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("voteUserNames")):
+            if(field.first == _XPLATSTR("voteUserNames"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setVoteUserNames;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVoteUserNames);
+                    setVoteUserNames(refVal_setVoteUserNames);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            if(field.first == _XPLATSTR("hasMore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasMore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
+                    setHasMore(refVal_setHasMore);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasMore"))))
+    return ok;
+}
+
+void GetCommentVoteUserNamesSuccessResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_VoteUserNames))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("voteUserNames")), m_VoteUserNames);
+    }
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasMore")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasMore")), m_HasMore);
+    }
+}
+
+bool GetCommentVoteUserNamesSuccessResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setHasMore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
-            setHasMore(refVal_setHasMore);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("voteUserNames")):
+            {
+                std::vector<utility::string_t> refVal_setVoteUserNames;
+                if(!ModelBase::readBinary(reader, field, refVal_setVoteUserNames))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVoteUserNames(refVal_setVoteUserNames);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            {
+                bool refVal_setHasMore;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasMore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasMore(refVal_setHasMore);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetCommentVoteUserNamesSuccessResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -103,15 +210,15 @@ void GetCommentVoteUserNamesSuccessResponse::toMultipart(std::shared_ptr<Multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_VoteUserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteUserNames))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("voteUserNames")), m_VoteUserNames));
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasMore")), m_HasMore));
     }
@@ -157,17 +264,17 @@ std::shared_ptr<APIStatus> GetCommentVoteUserNamesSuccessResponse::getStatus() c
 void GetCommentVoteUserNamesSuccessResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetCommentVoteUserNamesSuccessResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetCommentVoteUserNamesSuccessResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<utility::string_t> GetCommentVoteUserNamesSuccessResponse::getVoteUserNames() const
 {
@@ -178,17 +285,17 @@ std::vector<utility::string_t> GetCommentVoteUserNamesSuccessResponse::getVoteUs
 void GetCommentVoteUserNamesSuccessResponse::setVoteUserNames(const std::vector<utility::string_t>& value)
 {
     m_VoteUserNames = value;
-    m_VoteUserNamesIsSet = true;
+    m_FieldsSet.set(FieldBit_VoteUserNames);
 }
 
 bool GetCommentVoteUserNamesSuccessResponse::voteUserNamesIsSet() const
 {
-    return m_VoteUserNamesIsSet;
+    return m_FieldsSet.test(FieldBit_VoteUserNames);
 }
 
 void GetCommentVoteUserNamesSuccessResponse::unsetVoteUserNames()
 {
-    m_VoteUserNamesIsSet = false;
+    m_FieldsSet.reset(FieldBit_VoteUserNames);
 }
 bool GetCommentVoteUserNamesSuccessResponse::isHasMore() const
 {
@@ -198,17 +305,17 @@ bool GetCommentVoteUserNamesSuccessResponse::isHasMore() const
 void GetCommentVoteUserNamesSuccessResponse::setHasMore(bool value)
 {
     m_HasMore = value;
-    m_HasMoreIsSet = true;
+    m_FieldsSet.set(FieldBit_HasMore);
 }
 
 bool GetCommentVoteUserNamesSuccessResponse::hasMoreIsSet() const
 {
-    return m_HasMoreIsSet;
+    return m_FieldsSet.test(FieldBit_HasMore);
 }
 
 void GetCommentVoteUserNamesSuccessResponse::unsetHasMore()
 {
-    m_HasMoreIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasMore);
 }
 
 }
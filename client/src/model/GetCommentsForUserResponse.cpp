@@ -20,7 +20,6 @@ namespace model {
 
 GetCommentsForUserResponse::GetCommentsForUserResponse()
 {
-    m_ModeratingTenantIdsIsSet = false;
 }
 
 GetCommentsForUserResponse::~GetCommentsForUserResponse()
@@ -35,7 +34,7 @@ void GetCommentsForUserResponse::validate()
 web::json::value GetCommentsForUserResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ModeratingTenantIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModeratingTenantIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderatingTenantIds"))] = ModelBase::toJson(m_ModeratingTenantIds);
@@ -44,23 +43,87 @@ web::json::value GetCommentsForUserResponse::toJson() const
     return val;
 }
 
+void GetCommentsForUserResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ModeratingTenantIds))
+    {
+        
+        writer.key(_XPLATSTR("moderatingTenantIds"));
+        ModelBase::writeJson(writer, m_ModeratingTenantIds);
+    }
+
+    writer.endObject();
+}
+
 bool GetCommentsForUserResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderatingTenantIds"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderatingTenantIds")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setModeratingTenantIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModeratingTenantIds);
-            setModeratingTenantIds(refVal_setModeratingTenantIds);
-            
+        case ModelBase::fieldHash(_XPLATSTR("moderatingTenantIds")):
+            if(field.first == _XPLATSTR("moderatingTenantIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModeratingTenantIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModeratingTenantIds);
+                    setModeratingTenantIds(refVal_setModeratingTenantIds);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void GetCommentsForUserResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ModeratingTenantIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderatingTenantIds")), m_ModeratingTenantIds);
+    }
+}
+
+bool GetCommentsForUserResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("moderatingTenantIds")):
+            {
+                std::vector<utility::string_t> refVal_setModeratingTenantIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModeratingTenantIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModeratingTenantIds(refVal_setModeratingTenantIds);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void GetCommentsForUserResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void GetCommentsForUserResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ModeratingTenantIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModeratingTenantIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderatingTenantIds")), m_ModeratingTenantIds));
     }
@@ -102,17 +165,17 @@ std::vector<utility::string_t> GetCommentsForUserResponse::getModeratingTenantId
 void GetCommentsForUserResponse::setModeratingTenantIds(const std::vector<utility::string_t>& value)
 {
     m_ModeratingTenantIds = value;
-    m_ModeratingTenantIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ModeratingTenantIds);
 }
 
 bool GetCommentsForUserResponse::moderatingTenantIdsIsSet() const
 {
-    return m_ModeratingTenantIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ModeratingTenantIds);
 }
 
 void GetCommentsForUserResponse::unsetModeratingTenantIds()
 {
-    m_ModeratingTenantIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModeratingTenantIds);
 }
 
 }
@@ -21,52 +21,20 @@ namespace model {
 GetCommentsResponseWithPresence_PublicComment_::GetCommentsResponseWithPresence_PublicComment_()
 {
     m_StatusCode = 0;
-    m_StatusCodeIsSet = false;
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_TranslatedWarning = utility::conversions::to_string_t("");
-    m_TranslatedWarningIsSet = false;
-    m_CommentsIsSet = false;
-    m_UrlIdClean = utility::conversions::to_string_t("");
-    m_UrlIdCleanIsSet = false;
     m_IncludesPastPages = false;
-    m_IncludesPastPagesIsSet = false;
     m_IsDemo = false;
-    m_IsDemoIsSet = false;
     m_CommentCount = 0;
-    m_CommentCountIsSet = false;
     m_IsSiteAdmin = false;
-    m_IsSiteAdminIsSet = false;
     m_HasBillingIssue = false;
-    m_HasBillingIssueIsSet = false;
-    m_ModuleDataIsSet = false;
     m_PageNumber = 0;
-    m_PageNumberIsSet = false;
     m_IsWhiteLabeled = false;
-    m_IsWhiteLabeledIsSet = false;
     m_IsProd = false;
-    m_IsProdIsSet = false;
     m_IsCrawler = false;
-    m_IsCrawlerIsSet = false;
     m_NotificationCount = 0;
-    m_NotificationCountIsSet = false;
     m_HasMore = false;
-    m_HasMoreIsSet = false;
     m_IsClosed = false;
-    m_IsClosedIsSet = false;
     m_PresencePollState = 0;
-    m_PresencePollStateIsSet = false;
-    m_CustomConfigIsSet = false;
-    m_UrlIdWS = utility::conversions::to_string_t("");
-    m_UrlIdWSIsSet = false;
-    m_UserIdWS = utility::conversions::to_string_t("");
-    m_UserIdWSIsSet = false;
-    m_TenantIdWS = utility::conversions::to_string_t("");
-    m_TenantIdWSIsSet = false;
+    m_LastGenDate = 0L;
 }
 
 GetCommentsResponseWithPresence_PublicComment_::~GetCommentsResponseWithPresence_PublicComment_()
@@ -81,137 +49,137 @@ void GetCommentsResponseWithPresence_PublicComment_::validate()
 web::json::value GetCommentsResponseWithPresence_PublicComment_::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_StatusCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("statusCode"))] = ModelBase::toJson(m_StatusCode);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_TranslatedWarningIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslatedWarning))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translatedWarning"))] = ModelBase::toJson(m_TranslatedWarning);
     }
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comments"))] = ModelBase::toJson(m_Comments);
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User);
     }
-    if(m_UrlIdCleanIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdClean))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdClean"))] = ModelBase::toJson(m_UrlIdClean);
     }
-    if(m_LastGenDate.has_value())
+    if(m_FieldsSet.test(FieldBit_LastGenDate))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("lastGenDate"))] = ModelBase::toJson(m_LastGenDate.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("lastGenDate"))] = ModelBase::toJson(m_LastGenDate);
     }
-    if(m_IncludesPastPagesIsSet)
+    if(m_FieldsSet.test(FieldBit_IncludesPastPages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("includesPastPages"))] = ModelBase::toJson(m_IncludesPastPages);
     }
-    if(m_IsDemoIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDemo))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDemo"))] = ModelBase::toJson(m_IsDemo);
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentCount"))] = ModelBase::toJson(m_CommentCount);
     }
-    if(m_IsSiteAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin"))] = ModelBase::toJson(m_IsSiteAdmin);
     }
-    if(m_HasBillingIssueIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBillingIssue))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasBillingIssue"))] = ModelBase::toJson(m_HasBillingIssue);
     }
-    if(m_ModuleDataIsSet)
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moduleData"))] = ModelBase::toJson(m_ModuleData);
     }
-    if(m_PageNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_PageNumber))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pageNumber"))] = ModelBase::toJson(m_PageNumber);
     }
-    if(m_IsWhiteLabeledIsSet)
+    if(m_FieldsSet.test(FieldBit_IsWhiteLabeled))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isWhiteLabeled"))] = ModelBase::toJson(m_IsWhiteLabeled);
     }
-    if(m_IsProdIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProd))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isProd"))] = ModelBase::toJson(m_IsProd);
     }
-    if(m_IsCrawlerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCrawler))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isCrawler"))] = ModelBase::toJson(m_IsCrawler);
     }
-    if(m_NotificationCountIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationCount"))] = ModelBase::toJson(m_NotificationCount);
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasMore"))] = ModelBase::toJson(m_HasMore);
     }
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isClosed"))] = ModelBase::toJson(m_IsClosed);
     }
-    if(m_PresencePollStateIsSet)
+    if(m_FieldsSet.test(FieldBit_PresencePollState))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("presencePollState"))] = ModelBase::toJson(m_PresencePollState);
     }
-    if(m_CustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("customConfig"))] = ModelBase::toJson(m_CustomConfig);
     }
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))] = ModelBase::toJson(m_UrlIdWS);
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userIdWS"))] = ModelBase::toJson(m_UserIdWS);
     }
-    if(m_TenantIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantIdWS"))] = ModelBase::toJson(m_TenantIdWS);
@@ -220,307 +188,969 @@ web::json::value GetCommentsResponseWithPresence_PublicComment_::toJson() const
     return val;
 }
 
+void GetCommentsResponseWithPresence_PublicComment_::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_StatusCode))
+    {
+        
+        writer.key(_XPLATSTR("statusCode"));
+        ModelBase::writeJson(writer, m_StatusCode);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslatedWarning))
+    {
+        
+        writer.key(_XPLATSTR("translatedWarning"));
+        ModelBase::writeJson(writer, m_TranslatedWarning);
+    }
+    if(m_FieldsSet.test(FieldBit_Comments))
+    {
+        
+        writer.key(_XPLATSTR("comments"));
+        ModelBase::writeJson(writer, m_Comments);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        writer.key(_XPLATSTR("user"));
+        ModelBase::writeJson(writer, m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlIdClean))
+    {
+        
+        writer.key(_XPLATSTR("urlIdClean"));
+        ModelBase::writeJson(writer, m_UrlIdClean);
+    }
+    if(m_FieldsSet.test(FieldBit_LastGenDate))
+    {
+        
+        writer.key(_XPLATSTR("lastGenDate"));
+        ModelBase::writeJson(writer, m_LastGenDate);
+    }
+    if(m_FieldsSet.test(FieldBit_IncludesPastPages))
+    {
+        
+        writer.key(_XPLATSTR("includesPastPages"));
+        ModelBase::writeJson(writer, m_IncludesPastPages);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDemo))
+    {
+        
+        writer.key(_XPLATSTR("isDemo"));
+        ModelBase::writeJson(writer, m_IsDemo);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        writer.key(_XPLATSTR("commentCount"));
+        ModelBase::writeJson(writer, m_CommentCount);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isSiteAdmin"));
+        ModelBase::writeJson(writer, m_IsSiteAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_HasBillingIssue))
+    {
+        
+        writer.key(_XPLATSTR("hasBillingIssue"));
+        ModelBase::writeJson(writer, m_HasBillingIssue);
+    }
+    if(m_FieldsSet.test(FieldBit_ModuleData))
+    {
+        
+        writer.key(_XPLATSTR("moduleData"));
+        ModelBase::writeJson(writer, m_ModuleData);
+    }
+    if(m_FieldsSet.test(FieldBit_PageNumber))
+    {
+        
+        writer.key(_XPLATSTR("pageNumber"));
+        ModelBase::writeJson(writer, m_PageNumber);
+    }
+    if(m_FieldsSet.test(FieldBit_IsWhiteLabeled))
+    {
+        
+        writer.key(_XPLATSTR("isWhiteLabeled"));
+        ModelBase::writeJson(writer, m_IsWhiteLabeled);
+    }
+    if(m_FieldsSet.test(FieldBit_IsProd))
+    {
+        
+        writer.key(_XPLATSTR("isProd"));
+        ModelBase::writeJson(writer, m_IsProd);
+    }
+    if(m_FieldsSet.test(FieldBit_IsCrawler))
+    {
+        
+        writer.key(_XPLATSTR("isCrawler"));
+        ModelBase::writeJson(writer, m_IsCrawler);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
+    {
+        
+        writer.key(_XPLATSTR("notificationCount"));
+        ModelBase::writeJson(writer, m_NotificationCount);
+    }
+    if(m_FieldsSet.test(FieldBit_HasMore))
+    {
+        
+        writer.key(_XPLATSTR("hasMore"));
+        ModelBase::writeJson(writer, m_HasMore);
+    }
+    if(m_FieldsSet.test(FieldBit_IsClosed))
+    {
+        
+        writer.key(_XPLATSTR("isClosed"));
+        ModelBase::writeJson(writer, m_IsClosed);
+    }
+    if(m_FieldsSet.test(FieldBit_PresencePollState))
+    {
+        
+        writer.key(_XPLATSTR("presencePollState"));
+        ModelBase::writeJson(writer, m_PresencePollState);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
+    {
+        
+        writer.key(_XPLATSTR("customConfig"));
+        ModelBase::writeJson(writer, m_CustomConfig);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
+    {
+        
+        writer.key(_XPLATSTR("urlIdWS"));
+        ModelBase::writeJson(writer, m_UrlIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
+    {
+        
+        writer.key(_XPLATSTR("userIdWS"));
+        ModelBase::writeJson(writer, m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
+    {
+        
+        writer.key(_XPLATSTR("tenantIdWS"));
+        ModelBase::writeJson(writer, m_TenantIdWS);
+    }
+
+    writer.endObject();
+}
+
 bool GetCommentsResponseWithPresence_PublicComment_::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("statusCode"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("statusCode")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setStatusCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatusCode);
-            setStatusCode(refVal_setStatusCode);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("statusCode")):
+            if(field.first == _XPLATSTR("statusCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setStatusCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatusCode);
+                    setStatusCode(refVal_setStatusCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translatedWarning")):
+            if(field.first == _XPLATSTR("translatedWarning"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTranslatedWarning;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslatedWarning);
+                    setTranslatedWarning(refVal_setTranslatedWarning);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            if(field.first == _XPLATSTR("comments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PublicComment>> refVal_setComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
+                    setComments(refVal_setComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            if(field.first == _XPLATSTR("user"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserSessionInfo> refVal_setUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
+                    setUser(refVal_setUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdClean")):
+            if(field.first == _XPLATSTR("urlIdClean"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlIdClean;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdClean);
+                    setUrlIdClean(refVal_setUrlIdClean);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastGenDate")):
+            if(field.first == _XPLATSTR("lastGenDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setLastGenDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastGenDate);
+                    setLastGenDate(refVal_setLastGenDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("includesPastPages")):
+            if(field.first == _XPLATSTR("includesPastPages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIncludesPastPages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIncludesPastPages);
+                    setIncludesPastPages(refVal_setIncludesPastPages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDemo")):
+            if(field.first == _XPLATSTR("isDemo"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDemo;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDemo);
+                    setIsDemo(refVal_setIsDemo);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            if(field.first == _XPLATSTR("commentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
+                    setCommentCount(refVal_setCommentCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSiteAdmin")):
+            if(field.first == _XPLATSTR("isSiteAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSiteAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSiteAdmin);
+                    setIsSiteAdmin(refVal_setIsSiteAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasBillingIssue")):
+            if(field.first == _XPLATSTR("hasBillingIssue"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasBillingIssue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasBillingIssue);
+                    setHasBillingIssue(refVal_setHasBillingIssue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moduleData")):
+            if(field.first == _XPLATSTR("moduleData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<Object>> refVal_setModuleData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModuleData);
+                    setModuleData(refVal_setModuleData);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumber")):
+            if(field.first == _XPLATSTR("pageNumber"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setPageNumber;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumber);
+                    setPageNumber(refVal_setPageNumber);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isWhiteLabeled")):
+            if(field.first == _XPLATSTR("isWhiteLabeled"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsWhiteLabeled;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsWhiteLabeled);
+                    setIsWhiteLabeled(refVal_setIsWhiteLabeled);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isProd")):
+            if(field.first == _XPLATSTR("isProd"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsProd;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsProd);
+                    setIsProd(refVal_setIsProd);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isCrawler")):
+            if(field.first == _XPLATSTR("isCrawler"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsCrawler;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsCrawler);
+                    setIsCrawler(refVal_setIsCrawler);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationCount")):
+            if(field.first == _XPLATSTR("notificationCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setNotificationCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationCount);
+                    setNotificationCount(refVal_setNotificationCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            if(field.first == _XPLATSTR("hasMore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasMore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
+                    setHasMore(refVal_setHasMore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            if(field.first == _XPLATSTR("isClosed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsClosed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
+                    setIsClosed(refVal_setIsClosed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("presencePollState")):
+            if(field.first == _XPLATSTR("presencePollState"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setPresencePollState;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPresencePollState);
+                    setPresencePollState(refVal_setPresencePollState);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("customConfig")):
+            if(field.first == _XPLATSTR("customConfig"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCustomConfig);
+                    setCustomConfig(refVal_setCustomConfig);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            if(field.first == _XPLATSTR("urlIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
+                    setUrlIdWS(refVal_setUrlIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            if(field.first == _XPLATSTR("userIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
+                    setUserIdWS(refVal_setUserIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantIdWS")):
+            if(field.first == _XPLATSTR("tenantIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantIdWS);
+                    setTenantIdWS(refVal_setTenantIdWS);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    return ok;
+}
+
+void GetCommentsResponseWithPresence_PublicComment_::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_StatusCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("statusCode")), m_StatusCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translatedWarning"))))
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translatedWarning")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTranslatedWarning;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslatedWarning);
-            setTranslatedWarning(refVal_setTranslatedWarning);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comments"))))
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comments")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<PublicComment>> refVal_setComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
-            setComments(refVal_setComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("user"))))
+    if(m_FieldsSet.test(FieldBit_TranslatedWarning))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("user")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<UserSessionInfo> refVal_setUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
-            setUser(refVal_setUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translatedWarning")), m_TranslatedWarning);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdClean"))))
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdClean")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdClean;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdClean);
-            setUrlIdClean(refVal_setUrlIdClean);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comments")), m_Comments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastGenDate"))))
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastGenDate")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setLastGenDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastGenDate);
-            setLastGenDate(refVal_setLastGenDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("user")), m_User);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("includesPastPages"))))
+    if(m_FieldsSet.test(FieldBit_UrlIdClean))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("includesPastPages")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIncludesPastPages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIncludesPastPages);
-            setIncludesPastPages(refVal_setIncludesPastPages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdClean")), m_UrlIdClean);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDemo"))))
+    if(m_FieldsSet.test(FieldBit_LastGenDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDemo")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDemo;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDemo);
-            setIsDemo(refVal_setIsDemo);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastGenDate")), m_LastGenDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCount"))))
+    if(m_FieldsSet.test(FieldBit_IncludesPastPages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
-            setCommentCount(refVal_setCommentCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("includesPastPages")), m_IncludesPastPages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsDemo))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSiteAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSiteAdmin);
-            setIsSiteAdmin(refVal_setIsSiteAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDemo")), m_IsDemo);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasBillingIssue"))))
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasBillingIssue")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasBillingIssue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasBillingIssue);
-            setHasBillingIssue(refVal_setHasBillingIssue);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCount")), m_CommentCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moduleData"))))
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moduleData")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::shared_ptr<Object>> refVal_setModuleData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModuleData);
-            setModuleData(refVal_setModuleData);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSiteAdmin")), m_IsSiteAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageNumber"))))
+    if(m_FieldsSet.test(FieldBit_HasBillingIssue))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageNumber")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setPageNumber;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageNumber);
-            setPageNumber(refVal_setPageNumber);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasBillingIssue")), m_HasBillingIssue);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isWhiteLabeled"))))
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isWhiteLabeled")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsWhiteLabeled;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsWhiteLabeled);
-            setIsWhiteLabeled(refVal_setIsWhiteLabeled);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moduleData")), m_ModuleData);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isProd"))))
+    if(m_FieldsSet.test(FieldBit_PageNumber))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isProd")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsProd;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsProd);
-            setIsProd(refVal_setIsProd);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageNumber")), m_PageNumber);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isCrawler"))))
+    if(m_FieldsSet.test(FieldBit_IsWhiteLabeled))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isCrawler")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsCrawler;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsCrawler);
-            setIsCrawler(refVal_setIsCrawler);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isWhiteLabeled")), m_IsWhiteLabeled);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationCount"))))
+    if(m_FieldsSet.test(FieldBit_IsProd))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setNotificationCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationCount);
-            setNotificationCount(refVal_setNotificationCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isProd")), m_IsProd);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasMore"))))
+    if(m_FieldsSet.test(FieldBit_IsCrawler))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasMore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasMore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
-            setHasMore(refVal_setHasMore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isCrawler")), m_IsCrawler);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isClosed"))))
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isClosed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsClosed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
-            setIsClosed(refVal_setIsClosed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationCount")), m_NotificationCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("presencePollState"))))
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("presencePollState")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setPresencePollState;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPresencePollState);
-            setPresencePollState(refVal_setPresencePollState);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasMore")), m_HasMore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("customConfig"))))
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("customConfig")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCustomConfig);
-            setCustomConfig(refVal_setCustomConfig);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isClosed")), m_IsClosed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))))
+    if(m_FieldsSet.test(FieldBit_PresencePollState))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
-            setUrlIdWS(refVal_setUrlIdWS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("presencePollState")), m_PresencePollState);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userIdWS"))))
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
-            setUserIdWS(refVal_setUserIdWS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("customConfig")), m_CustomConfig);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdWS")), m_UrlIdWS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantIdWS"))))
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantIdWS")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userIdWS")), m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantIdWS")), m_TenantIdWS);
+    }
+}
+
+bool GetCommentsResponseWithPresence_PublicComment_::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setTenantIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantIdWS);
-            setTenantIdWS(refVal_setTenantIdWS);
-            
+        case ModelBase::fieldHash(_XPLATSTR("statusCode")):
+            {
+                int32_t refVal_setStatusCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatusCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatusCode(refVal_setStatusCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translatedWarning")):
+            {
+                utility::string_t refVal_setTranslatedWarning;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslatedWarning))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslatedWarning(refVal_setTranslatedWarning);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            {
+                std::vector<std::shared_ptr<PublicComment>> refVal_setComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComments(refVal_setComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            {
+                std::shared_ptr<UserSessionInfo> refVal_setUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUser(refVal_setUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdClean")):
+            {
+                utility::string_t refVal_setUrlIdClean;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlIdClean))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlIdClean(refVal_setUrlIdClean);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastGenDate")):
+            {
+                int64_t refVal_setLastGenDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastGenDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastGenDate(refVal_setLastGenDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("includesPastPages")):
+            {
+                bool refVal_setIncludesPastPages;
+                if(!ModelBase::readBinary(reader, field, refVal_setIncludesPastPages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIncludesPastPages(refVal_setIncludesPastPages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDemo")):
+            {
+                bool refVal_setIsDemo;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDemo))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDemo(refVal_setIsDemo);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            {
+                int32_t refVal_setCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCount(refVal_setCommentCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSiteAdmin")):
+            {
+                bool refVal_setIsSiteAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSiteAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSiteAdmin(refVal_setIsSiteAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasBillingIssue")):
+            {
+                bool refVal_setHasBillingIssue;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasBillingIssue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasBillingIssue(refVal_setHasBillingIssue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moduleData")):
+            {
+                std::map<utility::string_t, std::shared_ptr<Object>> refVal_setModuleData;
+                if(!ModelBase::readBinary(reader, field, refVal_setModuleData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModuleData(refVal_setModuleData);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageNumber")):
+            {
+                int32_t refVal_setPageNumber;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageNumber))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageNumber(refVal_setPageNumber);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isWhiteLabeled")):
+            {
+                bool refVal_setIsWhiteLabeled;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsWhiteLabeled))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsWhiteLabeled(refVal_setIsWhiteLabeled);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isProd")):
+            {
+                bool refVal_setIsProd;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsProd))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsProd(refVal_setIsProd);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isCrawler")):
+            {
+                bool refVal_setIsCrawler;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsCrawler))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsCrawler(refVal_setIsCrawler);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationCount")):
+            {
+                int32_t refVal_setNotificationCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationCount(refVal_setNotificationCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            {
+                bool refVal_setHasMore;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasMore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasMore(refVal_setHasMore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            {
+                bool refVal_setIsClosed;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsClosed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsClosed(refVal_setIsClosed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("presencePollState")):
+            {
+                int32_t refVal_setPresencePollState;
+                if(!ModelBase::readBinary(reader, field, refVal_setPresencePollState))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPresencePollState(refVal_setPresencePollState);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("customConfig")):
+            {
+                std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
+                if(!ModelBase::readBinary(reader, field, refVal_setCustomConfig))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCustomConfig(refVal_setCustomConfig);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            {
+                utility::string_t refVal_setUrlIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlIdWS(refVal_setUrlIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            {
+                utility::string_t refVal_setUserIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserIdWS(refVal_setUserIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantIdWS")):
+            {
+                utility::string_t refVal_setTenantIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantIdWS(refVal_setTenantIdWS);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -530,111 +1160,111 @@ void GetCommentsResponseWithPresence_PublicComment_::toMultipart(std::shared_ptr
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_StatusCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("statusCode")), m_StatusCode));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_TranslatedWarningIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslatedWarning))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translatedWarning")), m_TranslatedWarning));
     }
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comments")), m_Comments));
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User));
     }
-    if(m_UrlIdCleanIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdClean))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdClean")), m_UrlIdClean));
     }
-    if(m_LastGenDate.has_value())
+    if(m_FieldsSet.test(FieldBit_LastGenDate))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastGenDate")), m_LastGenDate.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastGenDate")), m_LastGenDate));
     }
-    if(m_IncludesPastPagesIsSet)
+    if(m_FieldsSet.test(FieldBit_IncludesPastPages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("includesPastPages")), m_IncludesPastPages));
     }
-    if(m_IsDemoIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDemo))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDemo")), m_IsDemo));
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCount")), m_CommentCount));
     }
-    if(m_IsSiteAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin")), m_IsSiteAdmin));
     }
-    if(m_HasBillingIssueIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBillingIssue))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasBillingIssue")), m_HasBillingIssue));
     }
-    if(m_ModuleDataIsSet)
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moduleData")), m_ModuleData));
     }
-    if(m_PageNumberIsSet)
+    if(m_FieldsSet.test(FieldBit_PageNumber))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageNumber")), m_PageNumber));
     }
-    if(m_IsWhiteLabeledIsSet)
+    if(m_FieldsSet.test(FieldBit_IsWhiteLabeled))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isWhiteLabeled")), m_IsWhiteLabeled));
     }
-    if(m_IsProdIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProd))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isProd")), m_IsProd));
     }
-    if(m_IsCrawlerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCrawler))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isCrawler")), m_IsCrawler));
     }
-    if(m_NotificationCountIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationCount")), m_NotificationCount));
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasMore")), m_HasMore));
     }
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isClosed")), m_IsClosed));
     }
-    if(m_PresencePollStateIsSet)
+    if(m_FieldsSet.test(FieldBit_PresencePollState))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("presencePollState")), m_PresencePollState));
     }
-    if(m_CustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customConfig")), m_CustomConfig));
     }
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdWS")), m_UrlIdWS));
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userIdWS")), m_UserIdWS));
     }
-    if(m_TenantIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantIdWS")), m_TenantIdWS));
     }
@@ -823,17 +1453,17 @@ int32_t GetCommentsResponseWithPresence_PublicComment_::getStatusCode() const
 void GetCommentsResponseWithPresence_PublicComment_::setStatusCode(int32_t value)
 {
     m_StatusCode = value;
-    m_StatusCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_StatusCode);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::statusCodeIsSet() const
 {
-    return m_StatusCodeIsSet;
+    return m_FieldsSet.test(FieldBit_StatusCode);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetStatusCode()
 {
-    m_StatusCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_StatusCode);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getStatus() const
 {
@@ -844,17 +1474,17 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getStatus() co
 void GetCommentsResponseWithPresence_PublicComment_::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getCode() const
 {
@@ -865,17 +1495,17 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getCode() cons
 void GetCommentsResponseWithPresence_PublicComment_::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getReason() const
 {
@@ -886,17 +1516,17 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getReason() co
 void GetCommentsResponseWithPresence_PublicComment_::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getTranslatedWarning() const
 {
@@ -907,17 +1537,17 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getTranslatedW
 void GetCommentsResponseWithPresence_PublicComment_::setTranslatedWarning(const utility::string_t& value)
 {
     m_TranslatedWarning = value;
-    m_TranslatedWarningIsSet = true;
+    m_FieldsSet.set(FieldBit_TranslatedWarning);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::translatedWarningIsSet() const
 {
-    return m_TranslatedWarningIsSet;
+    return m_FieldsSet.test(FieldBit_TranslatedWarning);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetTranslatedWarning()
 {
-    m_TranslatedWarningIsSet = false;
+    m_FieldsSet.reset(FieldBit_TranslatedWarning);
 }
 std::vector<std::shared_ptr<PublicComment>> GetCommentsResponseWithPresence_PublicComment_::getComments() const
 {
@@ -928,37 +1558,38 @@ std::vector<std::shared_ptr<PublicComment>> GetCommentsResponseWithPresence_Publ
 void GetCommentsResponseWithPresence_PublicComment_::setComments(const std::vector<std::shared_ptr<PublicComment>>& value)
 {
     m_Comments = value;
-    m_CommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_Comments);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::commentsIsSet() const
 {
-    return m_CommentsIsSet;
+    return m_FieldsSet.test(FieldBit_Comments);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetComments()
 {
-    m_CommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comments);
 }
 std::shared_ptr<UserSessionInfo> GetCommentsResponseWithPresence_PublicComment_::getUser() const
 {
-    return m_User.get();
+    return m_User;
 }
 
 
 void GetCommentsResponseWithPresence_PublicComment_::setUser(const std::shared_ptr<UserSessionInfo>& value)
 {
     m_User = value;
+    m_FieldsSet.set(FieldBit_User);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::userIsSet() const
 {
-    return m_User.has_value();
+    return m_FieldsSet.test(FieldBit_User);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetUser()
 {
-    m_User.reset();
+    m_FieldsSet.reset(FieldBit_User);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getUrlIdClean() const
 {
@@ -969,36 +1600,37 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getUrlIdClean(
 void GetCommentsResponseWithPresence_PublicComment_::setUrlIdClean(const utility::string_t& value)
 {
     m_UrlIdClean = value;
-    m_UrlIdCleanIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdClean);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::urlIdCleanIsSet() const
 {
-    return m_UrlIdCleanIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdClean);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetUrlIdClean()
 {
-    m_UrlIdCleanIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdClean);
 }
 int64_t GetCommentsResponseWithPresence_PublicComment_::getLastGenDate() const
 {
-    return m_LastGenDate.get();
+    return m_LastGenDate;
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::setLastGenDate(int64_t value)
 {
     m_LastGenDate = value;
+    m_FieldsSet.set(FieldBit_LastGenDate);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::lastGenDateIsSet() const
 {
-    return m_LastGenDate.has_value();
+    return m_FieldsSet.test(FieldBit_LastGenDate);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetLastGenDate()
 {
-    m_LastGenDate.reset();
+    m_FieldsSet.reset(FieldBit_LastGenDate);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isIncludesPastPages() const
 {
@@ -1008,17 +1640,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isIncludesPastPages() const
 void GetCommentsResponseWithPresence_PublicComment_::setIncludesPastPages(bool value)
 {
     m_IncludesPastPages = value;
-    m_IncludesPastPagesIsSet = true;
+    m_FieldsSet.set(FieldBit_IncludesPastPages);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::includesPastPagesIsSet() const
 {
-    return m_IncludesPastPagesIsSet;
+    return m_FieldsSet.test(FieldBit_IncludesPastPages);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetIncludesPastPages()
 {
-    m_IncludesPastPagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_IncludesPastPages);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isIsDemo() const
 {
@@ -1028,17 +1660,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isIsDemo() const
 void GetCommentsResponseWithPresence_PublicComment_::setIsDemo(bool value)
 {
     m_IsDemo = value;
-    m_IsDemoIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDemo);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::isDemoIsSet() const
 {
-    return m_IsDemoIsSet;
+    return m_FieldsSet.test(FieldBit_IsDemo);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetIsDemo()
 {
-    m_IsDemoIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDemo);
 }
 int32_t GetCommentsResponseWithPresence_PublicComment_::getCommentCount() const
 {
@@ -1048,17 +1680,17 @@ int32_t GetCommentsResponseWithPresence_PublicComment_::getCommentCount() const
 void GetCommentsResponseWithPresence_PublicComment_::setCommentCount(int32_t value)
 {
     m_CommentCount = value;
-    m_CommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentCount);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::commentCountIsSet() const
 {
-    return m_CommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_CommentCount);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetCommentCount()
 {
-    m_CommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentCount);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isIsSiteAdmin() const
 {
@@ -1068,17 +1700,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isIsSiteAdmin() const
 void GetCommentsResponseWithPresence_PublicComment_::setIsSiteAdmin(bool value)
 {
     m_IsSiteAdmin = value;
-    m_IsSiteAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSiteAdmin);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::isSiteAdminIsSet() const
 {
-    return m_IsSiteAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsSiteAdmin);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetIsSiteAdmin()
 {
-    m_IsSiteAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSiteAdmin);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isHasBillingIssue() const
 {
@@ -1088,17 +1720,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isHasBillingIssue() const
 void GetCommentsResponseWithPresence_PublicComment_::setHasBillingIssue(bool value)
 {
     m_HasBillingIssue = value;
-    m_HasBillingIssueIsSet = true;
+    m_FieldsSet.set(FieldBit_HasBillingIssue);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::hasBillingIssueIsSet() const
 {
-    return m_HasBillingIssueIsSet;
+    return m_FieldsSet.test(FieldBit_HasBillingIssue);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetHasBillingIssue()
 {
-    m_HasBillingIssueIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasBillingIssue);
 }
 std::map<utility::string_t, std::shared_ptr<Object>> GetCommentsResponseWithPresence_PublicComment_::getModuleData() const
 {
@@ -1109,17 +1741,17 @@ std::map<utility::string_t, std::shared_ptr<Object>> GetCommentsResponseWithPres
 void GetCommentsResponseWithPresence_PublicComment_::setModuleData(const std::map<utility::string_t, std::shared_ptr<Object>>& value)
 {
     m_ModuleData = value;
-    m_ModuleDataIsSet = true;
+    m_FieldsSet.set(FieldBit_ModuleData);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::moduleDataIsSet() const
 {
-    return m_ModuleDataIsSet;
+    return m_FieldsSet.test(FieldBit_ModuleData);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetModuleData()
 {
-    m_ModuleDataIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModuleData);
 }
 int32_t GetCommentsResponseWithPresence_PublicComment_::getPageNumber() const
 {
@@ -1129,17 +1761,17 @@ int32_t GetCommentsResponseWithPresence_PublicComment_::getPageNumber() const
 void GetCommentsResponseWithPresence_PublicComment_::setPageNumber(int32_t value)
 {
     m_PageNumber = value;
-    m_PageNumberIsSet = true;
+    m_FieldsSet.set(FieldBit_PageNumber);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::pageNumberIsSet() const
 {
-    return m_PageNumberIsSet;
+    return m_FieldsSet.test(FieldBit_PageNumber);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetPageNumber()
 {
-    m_PageNumberIsSet = false;
+    m_FieldsSet.reset(FieldBit_PageNumber);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isIsWhiteLabeled() const
 {
@@ -1149,17 +1781,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isIsWhiteLabeled() const
 void GetCommentsResponseWithPresence_PublicComment_::setIsWhiteLabeled(bool value)
 {
     m_IsWhiteLabeled = value;
-    m_IsWhiteLabeledIsSet = true;
+    m_FieldsSet.set(FieldBit_IsWhiteLabeled);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::isWhiteLabeledIsSet() const
 {
-    return m_IsWhiteLabeledIsSet;
+    return m_FieldsSet.test(FieldBit_IsWhiteLabeled);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetIsWhiteLabeled()
 {
-    m_IsWhiteLabeledIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsWhiteLabeled);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isIsProd() const
 {
@@ -1169,17 +1801,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isIsProd() const
 void GetCommentsResponseWithPresence_PublicComment_::setIsProd(bool value)
 {
     m_IsProd = value;
-    m_IsProdIsSet = true;
+    m_FieldsSet.set(FieldBit_IsProd);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::isProdIsSet() const
 {
-    return m_IsProdIsSet;
+    return m_FieldsSet.test(FieldBit_IsProd);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetIsProd()
 {
-    m_IsProdIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsProd);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isIsCrawler() const
 {
@@ -1189,17 +1821,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isIsCrawler() const
 void GetCommentsResponseWithPresence_PublicComment_::setIsCrawler(bool value)
 {
     m_IsCrawler = value;
-    m_IsCrawlerIsSet = true;
+    m_FieldsSet.set(FieldBit_IsCrawler);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::isCrawlerIsSet() const
 {
-    return m_IsCrawlerIsSet;
+    return m_FieldsSet.test(FieldBit_IsCrawler);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetIsCrawler()
 {
-    m_IsCrawlerIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsCrawler);
 }
 int32_t GetCommentsResponseWithPresence_PublicComment_::getNotificationCount() const
 {
@@ -1209,17 +1841,17 @@ int32_t GetCommentsResponseWithPresence_PublicComment_::getNotificationCount() c
 void GetCommentsResponseWithPresence_PublicComment_::setNotificationCount(int32_t value)
 {
     m_NotificationCount = value;
-    m_NotificationCountIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationCount);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::notificationCountIsSet() const
 {
-    return m_NotificationCountIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationCount);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetNotificationCount()
 {
-    m_NotificationCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationCount);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isHasMore() const
 {
@@ -1229,17 +1861,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isHasMore() const
 void GetCommentsResponseWithPresence_PublicComment_::setHasMore(bool value)
 {
     m_HasMore = value;
-    m_HasMoreIsSet = true;
+    m_FieldsSet.set(FieldBit_HasMore);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::hasMoreIsSet() const
 {
-    return m_HasMoreIsSet;
+    return m_FieldsSet.test(FieldBit_HasMore);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetHasMore()
 {
-    m_HasMoreIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasMore);
 }
 bool GetCommentsResponseWithPresence_PublicComment_::isIsClosed() const
 {
@@ -1249,17 +1881,17 @@ bool GetCommentsResponseWithPresence_PublicComment_::isIsClosed() const
 void GetCommentsResponseWithPresence_PublicComment_::setIsClosed(bool value)
 {
     m_IsClosed = value;
-    m_IsClosedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsClosed);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::isClosedIsSet() const
 {
-    return m_IsClosedIsSet;
+    return m_FieldsSet.test(FieldBit_IsClosed);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetIsClosed()
 {
-    m_IsClosedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsClosed);
 }
 int32_t GetCommentsResponseWithPresence_PublicComment_::getPresencePollState() const
 {
@@ -1269,17 +1901,17 @@ int32_t GetCommentsResponseWithPresence_PublicComment_::getPresencePollState() c
 void GetCommentsResponseWithPresence_PublicComment_::setPresencePollState(int32_t value)
 {
     m_PresencePollState = value;
-    m_PresencePollStateIsSet = true;
+    m_FieldsSet.set(FieldBit_PresencePollState);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::presencePollStateIsSet() const
 {
-    return m_PresencePollStateIsSet;
+    return m_FieldsSet.test(FieldBit_PresencePollState);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetPresencePollState()
 {
-    m_PresencePollStateIsSet = false;
+    m_FieldsSet.reset(FieldBit_PresencePollState);
 }
 std::shared_ptr<CustomConfigParameters> GetCommentsResponseWithPresence_PublicComment_::getCustomConfig() const
 {
@@ -1290,17 +1922,17 @@ std::shared_ptr<CustomConfigParameters> GetCommentsResponseWithPresence_PublicCo
 void GetCommentsResponseWithPresence_PublicComment_::setCustomConfig(const std::shared_ptr<CustomConfigParameters>& value)
 {
     m_CustomConfig = value;
-    m_CustomConfigIsSet = true;
+    m_FieldsSet.set(FieldBit_CustomConfig);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::customConfigIsSet() const
 {
-    return m_CustomConfigIsSet;
+    return m_FieldsSet.test(FieldBit_CustomConfig);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetCustomConfig()
 {
-    m_CustomConfigIsSet = false;
+    m_FieldsSet.reset(FieldBit_CustomConfig);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getUrlIdWS() const
 {
@@ -1311,17 +1943,17 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getUrlIdWS() c
 void GetCommentsResponseWithPresence_PublicComment_::setUrlIdWS(const utility::string_t& value)
 {
     m_UrlIdWS = value;
-    m_UrlIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdWS);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::urlIdWSIsSet() const
 {
-    return m_UrlIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdWS);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetUrlIdWS()
 {
-    m_UrlIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdWS);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getUserIdWS() const
 {
@@ -1332,17 +1964,17 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getUserIdWS()
 void GetCommentsResponseWithPresence_PublicComment_::setUserIdWS(const utility::string_t& value)
 {
     m_UserIdWS = value;
-    m_UserIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UserIdWS);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::userIdWSIsSet() const
 {
-    return m_UserIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UserIdWS);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetUserIdWS()
 {
-    m_UserIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserIdWS);
 }
 utility::string_t GetCommentsResponseWithPresence_PublicComment_::getTenantIdWS() const
 {
@@ -1353,17 +1985,17 @@ utility::string_t GetCommentsResponseWithPresence_PublicComment_::getTenantIdWS(
 void GetCommentsResponseWithPresence_PublicComment_::setTenantIdWS(const utility::string_t& value)
 {
     m_TenantIdWS = value;
-    m_TenantIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantIdWS);
 }
 
 bool GetCommentsResponseWithPresence_PublicComment_::tenantIdWSIsSet() const
 {
-    return m_TenantIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_TenantIdWS);
 }
 
 void GetCommentsResponseWithPresence_PublicComment_::unsetTenantIdWS()
 {
-    m_TenantIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantIdWS);
 }
 
 }
@@ -20,10 +20,6 @@ namespace model {
 
 GetDomainConfigResponse::GetDomainConfigResponse()
 {
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
 }
 
 GetDomainConfigResponse::~GetDomainConfigResponse()
@@ -38,22 +34,22 @@ void GetDomainConfigResponse::validate()
 web::json::value GetDomainConfigResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_Configuration.has_value())
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("configuration"))] = ModelBase::toJson(m_Configuration.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("configuration"))] = ModelBase::toJson(m_Configuration);
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
@@ -62,54 +58,187 @@ web::json::value GetDomainConfigResponse::toJson() const
     return val;
 }
 
+void GetDomainConfigResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Configuration))
+    {
+        
+        writer.key(_XPLATSTR("configuration"));
+        ModelBase::writeJson(writer, m_Configuration);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+
+    writer.endObject();
+}
+
 bool GetDomainConfigResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("configuration"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("configuration")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<Object> refVal_setConfiguration;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConfiguration);
-            setConfiguration(refVal_setConfiguration);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<Object> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configuration")):
+            if(field.first == _XPLATSTR("configuration"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setConfiguration;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConfiguration);
+                    setConfiguration(refVal_setConfiguration);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    return ok;
+}
+
+void GetDomainConfigResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("configuration")), m_Configuration);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+}
+
+bool GetDomainConfigResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configuration")):
+            {
+                std::shared_ptr<Object> refVal_setConfiguration;
+                if(!ModelBase::readBinary(reader, field, refVal_setConfiguration))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConfiguration(refVal_setConfiguration);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<Object> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetDomainConfigResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -119,19 +248,19 @@ void GetDomainConfigResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_Configuration.has_value())
+    if(m_FieldsSet.test(FieldBit_Configuration))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configuration")), m_Configuration.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configuration")), m_Configuration));
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
@@ -176,43 +305,45 @@ bool GetDomainConfigResponse::fromMultiPart(std::shared_ptr<MultipartFormData> m
 
 std::shared_ptr<Object> GetDomainConfigResponse::getConfiguration() const
 {
-    return m_Configuration.get();
+    return m_Configuration;
 }
 
 
 void GetDomainConfigResponse::setConfiguration(const std::shared_ptr<Object>& value)
 {
     m_Configuration = value;
+    m_FieldsSet.set(FieldBit_Configuration);
 }
 
 bool GetDomainConfigResponse::configurationIsSet() const
 {
-    return m_Configuration.has_value();
+    return m_FieldsSet.test(FieldBit_Configuration);
 }
 
 void GetDomainConfigResponse::unsetConfiguration()
 {
-    m_Configuration.reset();
+    m_FieldsSet.reset(FieldBit_Configuration);
 }
 std::shared_ptr<Object> GetDomainConfigResponse::getStatus() const
 {
-    return m_Status.get();
+    return m_Status;
 }
 
 
 void GetDomainConfigResponse::setStatus(const std::shared_ptr<Object>& value)
 {
     m_Status = value;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetDomainConfigResponse::statusIsSet() const
 {
-    return m_Status.has_value();
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetDomainConfigResponse::unsetStatus()
 {
-    m_Status.reset();
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t GetDomainConfigResponse::getReason() const
 {
@@ -223,17 +354,17 @@ utility::string_t GetDomainConfigResponse::getReason() const
 void GetDomainConfigResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool GetDomainConfigResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void GetDomainConfigResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t GetDomainConfigResponse::getCode() const
 {
@@ -244,17 +375,17 @@ utility::string_t GetDomainConfigResponse::getCode() const
 void GetDomainConfigResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool GetDomainConfigResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void GetDomainConfigResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 
 }
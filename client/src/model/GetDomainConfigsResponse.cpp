@@ -20,10 +20,6 @@ namespace model {
 
 GetDomainConfigsResponse::GetDomainConfigsResponse()
 {
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
 }
 
 GetDomainConfigsResponse::~GetDomainConfigsResponse()
@@ -38,22 +34,22 @@ void GetDomainConfigsResponse::validate()
 web::json::value GetDomainConfigsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_Configurations.has_value())
+    if(m_FieldsSet.test(FieldBit_Configurations))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("configurations"))] = ModelBase::toJson(m_Configurations.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("configurations"))] = ModelBase::toJson(m_Configurations);
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
@@ -62,54 +58,187 @@ web::json::value GetDomainConfigsResponse::toJson() const
     return val;
 }
 
+void GetDomainConfigsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Configurations))
+    {
+        
+        writer.key(_XPLATSTR("configurations"));
+        ModelBase::writeJson(writer, m_Configurations);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+
+    writer.endObject();
+}
+
 bool GetDomainConfigsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("configurations"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("configurations")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<Object> refVal_setConfigurations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConfigurations);
-            setConfigurations(refVal_setConfigurations);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<Object> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configurations")):
+            if(field.first == _XPLATSTR("configurations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setConfigurations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConfigurations);
+                    setConfigurations(refVal_setConfigurations);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    return ok;
+}
+
+void GetDomainConfigsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Configurations))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("configurations")), m_Configurations);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+}
+
+bool GetDomainConfigsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configurations")):
+            {
+                std::shared_ptr<Object> refVal_setConfigurations;
+                if(!ModelBase::readBinary(reader, field, refVal_setConfigurations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConfigurations(refVal_setConfigurations);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<Object> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetDomainConfigsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -119,19 +248,19 @@ void GetDomainConfigsResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_Configurations.has_value())
+    if(m_FieldsSet.test(FieldBit_Configurations))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configurations")), m_Configurations.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configurations")), m_Configurations));
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
@@ -176,43 +305,45 @@ bool GetDomainConfigsResponse::fromMultiPart(std::shared_ptr<MultipartFormData>
 
 std::shared_ptr<Object> GetDomainConfigsResponse::getConfigurations() const
 {
-    return m_Configurations.get();
+    return m_Configurations;
 }
 
 
 void GetDomainConfigsResponse::setConfigurations(const std::shared_ptr<Object>& value)
 {
     m_Configurations = value;
+    m_FieldsSet.set(FieldBit_Configurations);
 }
 
 bool GetDomainConfigsResponse::configurationsIsSet() const
 {
-    return m_Configurations.has_value();
+    return m_FieldsSet.test(FieldBit_Configurations);
 }
 
 void GetDomainConfigsResponse::unsetConfigurations()
 {
-    m_Configurations.reset();
+    m_FieldsSet.reset(FieldBit_Configurations);
 }
 std::shared_ptr<Object> GetDomainConfigsResponse::getStatus() const
 {
-    return m_Status.get();
+    return m_Status;
 }
 
 
 void GetDomainConfigsResponse::setStatus(const std::shared_ptr<Object>& value)
 {
     m_Status = value;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetDomainConfigsResponse::statusIsSet() const
 {
-    return m_Status.has_value();
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetDomainConfigsResponse::unsetStatus()
 {
-    m_Status.reset();
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t GetDomainConfigsResponse::getReason() const
 {
@@ -223,17 +354,17 @@ utility::string_t GetDomainConfigsResponse::getReason() const
 void GetDomainConfigsResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool GetDomainConfigsResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void GetDomainConfigsResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t GetDomainConfigsResponse::getCode() const
 {
@@ -244,17 +375,17 @@ utility::string_t GetDomainConfigsResponse::getCode() const
 void GetDomainConfigsResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool GetDomainConfigsResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void GetDomainConfigsResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 
 }
@@ -34,46 +34,133 @@ void GetDomainConfigsResponse_anyOf::validate()
 web::json::value GetDomainConfigsResponse_anyOf::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_Configurations.has_value())
+    if(m_FieldsSet.test(FieldBit_Configurations))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("configurations"))] = ModelBase::toJson(m_Configurations.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("configurations"))] = ModelBase::toJson(m_Configurations);
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
 
     return val;
 }
 
+void GetDomainConfigsResponse_anyOf::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Configurations))
+    {
+        
+        writer.key(_XPLATSTR("configurations"));
+        ModelBase::writeJson(writer, m_Configurations);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetDomainConfigsResponse_anyOf::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("configurations"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("configurations")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<AnyType> refVal_setConfigurations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConfigurations);
-            setConfigurations(refVal_setConfigurations);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configurations")):
+            if(field.first == _XPLATSTR("configurations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AnyType> refVal_setConfigurations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConfigurations);
+                    setConfigurations(refVal_setConfigurations);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<AnyType> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetDomainConfigsResponse_anyOf::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Configurations))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("configurations")), m_Configurations);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetDomainConfigsResponse_anyOf::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<AnyType> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("configurations")):
+            {
+                std::shared_ptr<AnyType> refVal_setConfigurations;
+                if(!ModelBase::readBinary(reader, field, refVal_setConfigurations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConfigurations(refVal_setConfigurations);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<AnyType> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetDomainConfigsResponse_anyOf::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -83,13 +170,13 @@ void GetDomainConfigsResponse_anyOf::toMultipart(std::shared_ptr<MultipartFormDa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_Configurations.has_value())
+    if(m_FieldsSet.test(FieldBit_Configurations))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configurations")), m_Configurations.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("configurations")), m_Configurations));
     }
-    if(m_Status.has_value())
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
 }
 
@@ -120,43 +207,45 @@ bool GetDomainConfigsResponse_anyOf::fromMultiPart(std::shared_ptr<MultipartForm
 
 std::shared_ptr<AnyType> GetDomainConfigsResponse_anyOf::getConfigurations() const
 {
-    return m_Configurations.get();
+    return m_Configurations;
 }
 
 
 void GetDomainConfigsResponse_anyOf::setConfigurations(const std::shared_ptr<AnyType>& value)
 {
     m_Configurations = value;
+    m_FieldsSet.set(FieldBit_Configurations);
 }
 
 bool GetDomainConfigsResponse_anyOf::configurationsIsSet() const
 {
-    return m_Configurations.has_value();
+    return m_FieldsSet.test(FieldBit_Configurations);
 }
 
 void GetDomainConfigsResponse_anyOf::unsetConfigurations()
 {
-    m_Configurations.reset();
+    m_FieldsSet.reset(FieldBit_Configurations);
 }
 std::shared_ptr<AnyType> GetDomainConfigsResponse_anyOf::getStatus() const
 {
-    return m_Status.get();
+    return m_Status;
 }
 
 
 void GetDomainConfigsResponse_anyOf::setStatus(const std::shared_ptr<AnyType>& value)
 {
     m_Status = value;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetDomainConfigsResponse_anyOf::statusIsSet() const
 {
-    return m_Status.has_value();
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetDomainConfigsResponse_anyOf::unsetStatus()
 {
-    m_Status.reset();
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetEmailTemplateDefinitionsResponse::GetEmailTemplateDefinitionsResponse()
 {
-    m_StatusIsSet = false;
-    m_DefinitionsIsSet = false;
 }
 
 GetEmailTemplateDefinitionsResponse::~GetEmailTemplateDefinitionsResponse()
@@ -36,12 +34,12 @@ void GetEmailTemplateDefinitionsResponse::validate()
 web::json::value GetEmailTemplateDefinitionsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_DefinitionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Definitions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("definitions"))] = ModelBase::toJson(m_Definitions);
@@ -50,32 +48,119 @@ web::json::value GetEmailTemplateDefinitionsResponse::toJson() const
     return val;
 }
 
+void GetEmailTemplateDefinitionsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Definitions))
+    {
+        
+        writer.key(_XPLATSTR("definitions"));
+        ModelBase::writeJson(writer, m_Definitions);
+    }
+
+    writer.endObject();
+}
+
 bool GetEmailTemplateDefinitionsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("definitions")):
+            if(field.first == _XPLATSTR("definitions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<EmailTemplateDefinition>> refVal_setDefinitions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefinitions);
+                    setDefinitions(refVal_setDefinitions);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("definitions"))))
+    return ok;
+}
+
+void GetEmailTemplateDefinitionsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("definitions")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Definitions))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("definitions")), m_Definitions);
+    }
+}
+
+bool GetEmailTemplateDefinitionsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<EmailTemplateDefinition>> refVal_setDefinitions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefinitions);
-            setDefinitions(refVal_setDefinitions);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("definitions")):
+            {
+                std::vector<std::shared_ptr<EmailTemplateDefinition>> refVal_setDefinitions;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefinitions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefinitions(refVal_setDefinitions);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetEmailTemplateDefinitionsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetEmailTemplateDefinitionsResponse::toMultipart(std::shared_ptr<MultipartF
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_DefinitionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Definitions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("definitions")), m_Definitions));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetEmailTemplateDefinitionsResponse::getStatus() cons
 void GetEmailTemplateDefinitionsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetEmailTemplateDefinitionsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetEmailTemplateDefinitionsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<EmailTemplateDefinition>> GetEmailTemplateDefinitionsResponse::getDefinitions() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<EmailTemplateDefinition>> GetEmailTemplateDefinition
 void GetEmailTemplateDefinitionsResponse::setDefinitions(const std::vector<std::shared_ptr<EmailTemplateDefinition>>& value)
 {
     m_Definitions = value;
-    m_DefinitionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Definitions);
 }
 
 bool GetEmailTemplateDefinitionsResponse::definitionsIsSet() const
 {
-    return m_DefinitionsIsSet;
+    return m_FieldsSet.test(FieldBit_Definitions);
 }
 
 void GetEmailTemplateDefinitionsResponse::unsetDefinitions()
 {
-    m_DefinitionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Definitions);
 }
 
 }
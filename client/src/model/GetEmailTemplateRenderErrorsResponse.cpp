@@ -20,8 +20,6 @@ namespace model {
 
 GetEmailTemplateRenderErrorsResponse::GetEmailTemplateRenderErrorsResponse()
 {
-    m_StatusIsSet = false;
-    m_RenderErrorsIsSet = false;
 }
 
 GetEmailTemplateRenderErrorsResponse::~GetEmailTemplateRenderErrorsResponse()
@@ -36,12 +34,12 @@ void GetEmailTemplateRenderErrorsResponse::validate()
 web::json::value GetEmailTemplateRenderErrorsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_RenderErrorsIsSet)
+    if(m_FieldsSet.test(FieldBit_RenderErrors))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("renderErrors"))] = ModelBase::toJson(m_RenderErrors);
@@ -50,32 +48,119 @@ web::json::value GetEmailTemplateRenderErrorsResponse::toJson() const
     return val;
 }
 
+void GetEmailTemplateRenderErrorsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_RenderErrors))
+    {
+        
+        writer.key(_XPLATSTR("renderErrors"));
+        ModelBase::writeJson(writer, m_RenderErrors);
+    }
+
+    writer.endObject();
+}
+
 bool GetEmailTemplateRenderErrorsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("renderErrors")):
+            if(field.first == _XPLATSTR("renderErrors"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<EmailTemplateRenderErrorResponse>> refVal_setRenderErrors;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRenderErrors);
+                    setRenderErrors(refVal_setRenderErrors);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("renderErrors"))))
+    return ok;
+}
+
+void GetEmailTemplateRenderErrorsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("renderErrors")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_RenderErrors))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("renderErrors")), m_RenderErrors);
+    }
+}
+
+bool GetEmailTemplateRenderErrorsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<EmailTemplateRenderErrorResponse>> refVal_setRenderErrors;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRenderErrors);
-            setRenderErrors(refVal_setRenderErrors);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("renderErrors")):
+            {
+                std::vector<std::shared_ptr<EmailTemplateRenderErrorResponse>> refVal_setRenderErrors;
+                if(!ModelBase::readBinary(reader, field, refVal_setRenderErrors))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRenderErrors(refVal_setRenderErrors);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetEmailTemplateRenderErrorsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetEmailTemplateRenderErrorsResponse::toMultipart(std::shared_ptr<Multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_RenderErrorsIsSet)
+    if(m_FieldsSet.test(FieldBit_RenderErrors))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("renderErrors")), m_RenderErrors));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetEmailTemplateRenderErrorsResponse::getStatus() con
 void GetEmailTemplateRenderErrorsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetEmailTemplateRenderErrorsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetEmailTemplateRenderErrorsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<EmailTemplateRenderErrorResponse>> GetEmailTemplateRenderErrorsResponse::getRenderErrors() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<EmailTemplateRenderErrorResponse>> GetEmailTemplateR
 void GetEmailTemplateRenderErrorsResponse::setRenderErrors(const std::vector<std::shared_ptr<EmailTemplateRenderErrorResponse>>& value)
 {
     m_RenderErrors = value;
-    m_RenderErrorsIsSet = true;
+    m_FieldsSet.set(FieldBit_RenderErrors);
 }
 
 bool GetEmailTemplateRenderErrorsResponse::renderErrorsIsSet() const
 {
-    return m_RenderErrorsIsSet;
+    return m_FieldsSet.test(FieldBit_RenderErrors);
 }
 
 void GetEmailTemplateRenderErrorsResponse::unsetRenderErrors()
 {
-    m_RenderErrorsIsSet = false;
+    m_FieldsSet.reset(FieldBit_RenderErrors);
 }
 
 }
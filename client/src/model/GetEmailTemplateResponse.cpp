@@ -20,8 +20,6 @@ namespace model {
 
 GetEmailTemplateResponse::GetEmailTemplateResponse()
 {
-    m_StatusIsSet = false;
-    m_EmailTemplateIsSet = false;
 }
 
 GetEmailTemplateResponse::~GetEmailTemplateResponse()
@@ -36,12 +34,12 @@ void GetEmailTemplateResponse::validate()
 web::json::value GetEmailTemplateResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_EmailTemplateIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailTemplate"))] = ModelBase::toJson(m_EmailTemplate);
@@ -50,32 +48,119 @@ web::json::value GetEmailTemplateResponse::toJson() const
     return val;
 }
 
+void GetEmailTemplateResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailTemplate))
+    {
+        
+        writer.key(_XPLATSTR("emailTemplate"));
+        ModelBase::writeJson(writer, m_EmailTemplate);
+    }
+
+    writer.endObject();
+}
+
 bool GetEmailTemplateResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplate")):
+            if(field.first == _XPLATSTR("emailTemplate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CustomEmailTemplate> refVal_setEmailTemplate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplate);
+                    setEmailTemplate(refVal_setEmailTemplate);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailTemplate"))))
+    return ok;
+}
+
+void GetEmailTemplateResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailTemplate")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailTemplate))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailTemplate")), m_EmailTemplate);
+    }
+}
+
+bool GetEmailTemplateResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<CustomEmailTemplate> refVal_setEmailTemplate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplate);
-            setEmailTemplate(refVal_setEmailTemplate);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplate")):
+            {
+                std::shared_ptr<CustomEmailTemplate> refVal_setEmailTemplate;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailTemplate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailTemplate(refVal_setEmailTemplate);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetEmailTemplateResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetEmailTemplateResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_EmailTemplateIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailTemplate")), m_EmailTemplate));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetEmailTemplateResponse::getStatus() const
 void GetEmailTemplateResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetEmailTemplateResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetEmailTemplateResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<CustomEmailTemplate> GetEmailTemplateResponse::getEmailTemplate() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<CustomEmailTemplate> GetEmailTemplateResponse::getEmailTemplate(
 void GetEmailTemplateResponse::setEmailTemplate(const std::shared_ptr<CustomEmailTemplate>& value)
 {
     m_EmailTemplate = value;
-    m_EmailTemplateIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailTemplate);
 }
 
 bool GetEmailTemplateResponse::emailTemplateIsSet() const
 {
-    return m_EmailTemplateIsSet;
+    return m_FieldsSet.test(FieldBit_EmailTemplate);
 }
 
 void GetEmailTemplateResponse::unsetEmailTemplate()
 {
-    m_EmailTemplateIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailTemplate);
 }
 
 }
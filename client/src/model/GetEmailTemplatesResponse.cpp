@@ -20,8 +20,6 @@ namespace model {
 
 GetEmailTemplatesResponse::GetEmailTemplatesResponse()
 {
-    m_StatusIsSet = false;
-    m_EmailTemplatesIsSet = false;
 }
 
 GetEmailTemplatesResponse::~GetEmailTemplatesResponse()
@@ -36,12 +34,12 @@ void GetEmailTemplatesResponse::validate()
 web::json::value GetEmailTemplatesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_EmailTemplatesIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplates))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailTemplates"))] = ModelBase::toJson(m_EmailTemplates);
@@ -50,32 +48,119 @@ web::json::value GetEmailTemplatesResponse::toJson() const
     return val;
 }
 
+void GetEmailTemplatesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailTemplates))
+    {
+        
+        writer.key(_XPLATSTR("emailTemplates"));
+        ModelBase::writeJson(writer, m_EmailTemplates);
+    }
+
+    writer.endObject();
+}
+
 bool GetEmailTemplatesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplates")):
+            if(field.first == _XPLATSTR("emailTemplates"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CustomEmailTemplate>> refVal_setEmailTemplates;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplates);
+                    setEmailTemplates(refVal_setEmailTemplates);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailTemplates"))))
+    return ok;
+}
+
+void GetEmailTemplatesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailTemplates")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailTemplates))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailTemplates")), m_EmailTemplates);
+    }
+}
+
+bool GetEmailTemplatesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<CustomEmailTemplate>> refVal_setEmailTemplates;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplates);
-            setEmailTemplates(refVal_setEmailTemplates);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplates")):
+            {
+                std::vector<std::shared_ptr<CustomEmailTemplate>> refVal_setEmailTemplates;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailTemplates))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailTemplates(refVal_setEmailTemplates);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetEmailTemplatesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetEmailTemplatesResponse::toMultipart(std::shared_ptr<MultipartFormData> m
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_EmailTemplatesIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplates))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailTemplates")), m_EmailTemplates));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetEmailTemplatesResponse::getStatus() const
 void GetEmailTemplatesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetEmailTemplatesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetEmailTemplatesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<CustomEmailTemplate>> GetEmailTemplatesResponse::getEmailTemplates() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<CustomEmailTemplate>> GetEmailTemplatesResponse::get
 void GetEmailTemplatesResponse::setEmailTemplates(const std::vector<std::shared_ptr<CustomEmailTemplate>>& value)
 {
     m_EmailTemplates = value;
-    m_EmailTemplatesIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailTemplates);
 }
 
 bool GetEmailTemplatesResponse::emailTemplatesIsSet() const
 {
-    return m_EmailTemplatesIsSet;
+    return m_FieldsSet.test(FieldBit_EmailTemplates);
 }
 
 void GetEmailTemplatesResponse::unsetEmailTemplates()
 {
-    m_EmailTemplatesIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailTemplates);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetEventLogResponse::GetEventLogResponse()
 {
-    m_EventsIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetEventLogResponse::~GetEventLogResponse()
@@ -36,12 +34,12 @@ void GetEventLogResponse::validate()
 web::json::value GetEventLogResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_EventsIsSet)
+    if(m_FieldsSet.test(FieldBit_Events))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("events"))] = ModelBase::toJson(m_Events);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value GetEventLogResponse::toJson() const
     return val;
 }
 
+void GetEventLogResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Events))
+    {
+        
+        writer.key(_XPLATSTR("events"));
+        ModelBase::writeJson(writer, m_Events);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetEventLogResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("events"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("events")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<EventLogEntry>> refVal_setEvents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEvents);
-            setEvents(refVal_setEvents);
-            
+        case ModelBase::fieldHash(_XPLATSTR("events")):
+            if(field.first == _XPLATSTR("events"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<EventLogEntry>> refVal_setEvents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEvents);
+                    setEvents(refVal_setEvents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetEventLogResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Events))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("events")), m_Events);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetEventLogResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("events")):
+            {
+                std::vector<std::shared_ptr<EventLogEntry>> refVal_setEvents;
+                if(!ModelBase::readBinary(reader, field, refVal_setEvents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEvents(refVal_setEvents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetEventLogResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetEventLogResponse::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_EventsIsSet)
+    if(m_FieldsSet.test(FieldBit_Events))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("events")), m_Events));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::shared_ptr<EventLogEntry>> GetEventLogResponse::getEvents() con
 void GetEventLogResponse::setEvents(const std::vector<std::shared_ptr<EventLogEntry>>& value)
 {
     m_Events = value;
-    m_EventsIsSet = true;
+    m_FieldsSet.set(FieldBit_Events);
 }
 
 bool GetEventLogResponse::eventsIsSet() const
 {
-    return m_EventsIsSet;
+    return m_FieldsSet.test(FieldBit_Events);
 }
 
 void GetEventLogResponse::unsetEvents()
 {
-    m_EventsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Events);
 }
 std::shared_ptr<APIStatus> GetEventLogResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> GetEventLogResponse::getStatus() const
 void GetEventLogResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetEventLogResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetEventLogResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetFeedPostsResponse::GetFeedPostsResponse()
 {
-    m_StatusIsSet = false;
-    m_FeedPostsIsSet = false;
 }
 
 GetFeedPostsResponse::~GetFeedPostsResponse()
@@ -36,12 +34,12 @@ void GetFeedPostsResponse::validate()
 web::json::value GetFeedPostsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_FeedPostsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedPosts"))] = ModelBase::toJson(m_FeedPosts);
@@ -50,32 +48,119 @@ web::json::value GetFeedPostsResponse::toJson() const
     return val;
 }
 
+void GetFeedPostsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
+    {
+        
+        writer.key(_XPLATSTR("feedPosts"));
+        ModelBase::writeJson(writer, m_FeedPosts);
+    }
+
+    writer.endObject();
+}
+
 bool GetFeedPostsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedPosts")):
+            if(field.first == _XPLATSTR("feedPosts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPosts);
+                    setFeedPosts(refVal_setFeedPosts);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedPosts"))))
+    return ok;
+}
+
+void GetFeedPostsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedPosts")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedPosts")), m_FeedPosts);
+    }
+}
+
+bool GetFeedPostsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPosts);
-            setFeedPosts(refVal_setFeedPosts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedPosts")):
+            {
+                std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedPosts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedPosts(refVal_setFeedPosts);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetFeedPostsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetFeedPostsResponse::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_FeedPostsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedPosts")), m_FeedPosts));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetFeedPostsResponse::getStatus() const
 void GetFeedPostsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetFeedPostsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetFeedPostsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<FeedPost>> GetFeedPostsResponse::getFeedPosts() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<FeedPost>> GetFeedPostsResponse::getFeedPosts() cons
 void GetFeedPostsResponse::setFeedPosts(const std::vector<std::shared_ptr<FeedPost>>& value)
 {
     m_FeedPosts = value;
-    m_FeedPostsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedPosts);
 }
 
 bool GetFeedPostsResponse::feedPostsIsSet() const
 {
-    return m_FeedPostsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedPosts);
 }
 
 void GetFeedPostsResponse::unsetFeedPosts()
 {
-    m_FeedPostsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedPosts);
 }
 
 }
@@ -20,10 +20,6 @@ namespace model {
 
 GetGifsTrendingResponse::GetGifsTrendingResponse()
 {
-    m_ImagesIsSet = false;
-    m_StatusIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
 }
 
 GetGifsTrendingResponse::~GetGifsTrendingResponse()
@@ -38,17 +34,17 @@ void GetGifsTrendingResponse::validate()
 web::json::value GetGifsTrendingResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Images))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("images"))] = ModelBase::toJson(m_Images);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
@@ -57,43 +53,153 @@ web::json::value GetGifsTrendingResponse::toJson() const
     return val;
 }
 
+void GetGifsTrendingResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Images))
+    {
+        
+        writer.key(_XPLATSTR("images"));
+        ModelBase::writeJson(writer, m_Images);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+
+    writer.endObject();
+}
+
 bool GetGifsTrendingResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("images"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("images")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> refVal_setImages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setImages);
-            setImages(refVal_setImages);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("images")):
+            if(field.first == _XPLATSTR("images"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> refVal_setImages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setImages);
+                    setImages(refVal_setImages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    return ok;
+}
+
+void GetGifsTrendingResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Images))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("images")), m_Images);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+}
+
+bool GetGifsTrendingResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("images")):
+            {
+                std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> refVal_setImages;
+                if(!ModelBase::readBinary(reader, field, refVal_setImages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setImages(refVal_setImages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetGifsTrendingResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -103,15 +209,15 @@ void GetGifsTrendingResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Images))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("images")), m_Images));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
@@ -157,17 +263,17 @@ std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>>
 void GetGifsTrendingResponse::setImages(const std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>>& value)
 {
     m_Images = value;
-    m_ImagesIsSet = true;
+    m_FieldsSet.set(FieldBit_Images);
 }
 
 bool GetGifsTrendingResponse::imagesIsSet() const
 {
-    return m_ImagesIsSet;
+    return m_FieldsSet.test(FieldBit_Images);
 }
 
 void GetGifsTrendingResponse::unsetImages()
 {
-    m_ImagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Images);
 }
 std::shared_ptr<APIStatus> GetGifsTrendingResponse::getStatus() const
 {
@@ -178,17 +284,17 @@ std::shared_ptr<APIStatus> GetGifsTrendingResponse::getStatus() const
 void GetGifsTrendingResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetGifsTrendingResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetGifsTrendingResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t GetGifsTrendingResponse::getCode() const
 {
@@ -199,17 +305,17 @@ utility::string_t GetGifsTrendingResponse::getCode() const
 void GetGifsTrendingResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool GetGifsTrendingResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void GetGifsTrendingResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetModeratorsResponse::GetModeratorsResponse()
 {
-    m_StatusIsSet = false;
-    m_ModeratorsIsSet = false;
 }
 
 GetModeratorsResponse::~GetModeratorsResponse()
@@ -36,12 +34,12 @@ void GetModeratorsResponse::validate()
 web::json::value GetModeratorsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_Moderators))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderators"))] = ModelBase::toJson(m_Moderators);
@@ -50,32 +48,119 @@ web::json::value GetModeratorsResponse::toJson() const
     return val;
 }
 
+void GetModeratorsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Moderators))
+    {
+        
+        writer.key(_XPLATSTR("moderators"));
+        ModelBase::writeJson(writer, m_Moderators);
+    }
+
+    writer.endObject();
+}
+
 bool GetModeratorsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderators")):
+            if(field.first == _XPLATSTR("moderators"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<Moderator>> refVal_setModerators;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerators);
+                    setModerators(refVal_setModerators);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderators"))))
+    return ok;
+}
+
+void GetModeratorsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderators")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Moderators))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderators")), m_Moderators);
+    }
+}
+
+bool GetModeratorsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<Moderator>> refVal_setModerators;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerators);
-            setModerators(refVal_setModerators);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderators")):
+            {
+                std::vector<std::shared_ptr<Moderator>> refVal_setModerators;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerators))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerators(refVal_setModerators);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetModeratorsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetModeratorsResponse::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_Moderators))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderators")), m_Moderators));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetModeratorsResponse::getStatus() const
 void GetModeratorsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetModeratorsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetModeratorsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<Moderator>> GetModeratorsResponse::getModerators() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<Moderator>> GetModeratorsResponse::getModerators() c
 void GetModeratorsResponse::setModerators(const std::vector<std::shared_ptr<Moderator>>& value)
 {
     m_Moderators = value;
-    m_ModeratorsIsSet = true;
+    m_FieldsSet.set(FieldBit_Moderators);
 }
 
 bool GetModeratorsResponse::moderatorsIsSet() const
 {
-    return m_ModeratorsIsSet;
+    return m_FieldsSet.test(FieldBit_Moderators);
 }
 
 void GetModeratorsResponse::unsetModerators()
 {
-    m_ModeratorsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Moderators);
 }
 
 }
@@ -20,13 +20,8 @@ namespace model {
 
 GetMyNotificationsResponse::GetMyNotificationsResponse()
 {
-    m_TranslationsIsSet = false;
     m_IsSubscribed = false;
-    m_IsSubscribedIsSet = false;
     m_HasMore = false;
-    m_HasMoreIsSet = false;
-    m_NotificationsIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetMyNotificationsResponse::~GetMyNotificationsResponse()
@@ -41,27 +36,27 @@ void GetMyNotificationsResponse::validate()
 web::json::value GetMyNotificationsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TranslationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translations"))] = ModelBase::toJson(m_Translations);
     }
-    if(m_IsSubscribedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSubscribed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSubscribed"))] = ModelBase::toJson(m_IsSubscribed);
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasMore"))] = ModelBase::toJson(m_HasMore);
     }
-    if(m_NotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Notifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notifications"))] = ModelBase::toJson(m_Notifications);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -70,65 +65,221 @@ web::json::value GetMyNotificationsResponse::toJson() const
     return val;
 }
 
+void GetMyNotificationsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Translations))
+    {
+        
+        writer.key(_XPLATSTR("translations"));
+        ModelBase::writeJson(writer, m_Translations);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSubscribed))
+    {
+        
+        writer.key(_XPLATSTR("isSubscribed"));
+        ModelBase::writeJson(writer, m_IsSubscribed);
+    }
+    if(m_FieldsSet.test(FieldBit_HasMore))
+    {
+        
+        writer.key(_XPLATSTR("hasMore"));
+        ModelBase::writeJson(writer, m_HasMore);
+    }
+    if(m_FieldsSet.test(FieldBit_Notifications))
+    {
+        
+        writer.key(_XPLATSTR("notifications"));
+        ModelBase::writeJson(writer, m_Notifications);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetMyNotificationsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translations"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translations")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setTranslations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
-            setTranslations(refVal_setTranslations);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSubscribed"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSubscribed")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setIsSubscribed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSubscribed);
-            setIsSubscribed(refVal_setIsSubscribed);
-            
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            if(field.first == _XPLATSTR("translations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setTranslations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
+                    setTranslations(refVal_setTranslations);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSubscribed")):
+            if(field.first == _XPLATSTR("isSubscribed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSubscribed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSubscribed);
+                    setIsSubscribed(refVal_setIsSubscribed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            if(field.first == _XPLATSTR("hasMore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasMore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
+                    setHasMore(refVal_setHasMore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notifications")):
+            if(field.first == _XPLATSTR("notifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<RenderableUserNotification>> refVal_setNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotifications);
+                    setNotifications(refVal_setNotifications);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasMore"))))
+    return ok;
+}
+
+void GetMyNotificationsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasMore")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasMore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
-            setHasMore(refVal_setHasMore);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translations")), m_Translations);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notifications"))))
+    if(m_FieldsSet.test(FieldBit_IsSubscribed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notifications")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<RenderableUserNotification>> refVal_setNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotifications);
-            setNotifications(refVal_setNotifications);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSubscribed")), m_IsSubscribed);
+    }
+    if(m_FieldsSet.test(FieldBit_HasMore))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasMore")), m_HasMore);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(m_FieldsSet.test(FieldBit_Notifications))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notifications")), m_Notifications);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetMyNotificationsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setTranslations;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslations(refVal_setTranslations);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSubscribed")):
+            {
+                bool refVal_setIsSubscribed;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSubscribed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSubscribed(refVal_setIsSubscribed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            {
+                bool refVal_setHasMore;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasMore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasMore(refVal_setHasMore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notifications")):
+            {
+                std::vector<std::shared_ptr<RenderableUserNotification>> refVal_setNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotifications(refVal_setNotifications);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetMyNotificationsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -138,23 +289,23 @@ void GetMyNotificationsResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TranslationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translations")), m_Translations));
     }
-    if(m_IsSubscribedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSubscribed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSubscribed")), m_IsSubscribed));
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasMore")), m_HasMore));
     }
-    if(m_NotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Notifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notifications")), m_Notifications));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -212,17 +363,17 @@ std::map<utility::string_t, utility::string_t> GetMyNotificationsResponse::getTr
 void GetMyNotificationsResponse::setTranslations(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Translations = value;
-    m_TranslationsIsSet = true;
+    m_FieldsSet.set(FieldBit_Translations);
 }
 
 bool GetMyNotificationsResponse::translationsIsSet() const
 {
-    return m_TranslationsIsSet;
+    return m_FieldsSet.test(FieldBit_Translations);
 }
 
 void GetMyNotificationsResponse::unsetTranslations()
 {
-    m_TranslationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Translations);
 }
 bool GetMyNotificationsResponse::isIsSubscribed() const
 {
@@ -232,17 +383,17 @@ bool GetMyNotificationsResponse::isIsSubscribed() const
 void GetMyNotificationsResponse::setIsSubscribed(bool value)
 {
     m_IsSubscribed = value;
-    m_IsSubscribedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSubscribed);
 }
 
 bool GetMyNotificationsResponse::isSubscribedIsSet() const
 {
-    return m_IsSubscribedIsSet;
+    return m_FieldsSet.test(FieldBit_IsSubscribed);
 }
 
 void GetMyNotificationsResponse::unsetIsSubscribed()
 {
-    m_IsSubscribedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSubscribed);
 }
 bool GetMyNotificationsResponse::isHasMore() const
 {
@@ -252,17 +403,17 @@ bool GetMyNotificationsResponse::isHasMore() const
 void GetMyNotificationsResponse::setHasMore(bool value)
 {
     m_HasMore = value;
-    m_HasMoreIsSet = true;
+    m_FieldsSet.set(FieldBit_HasMore);
 }
 
 bool GetMyNotificationsResponse::hasMoreIsSet() const
 {
-    return m_HasMoreIsSet;
+    return m_FieldsSet.test(FieldBit_HasMore);
 }
 
 void GetMyNotificationsResponse::unsetHasMore()
 {
-    m_HasMoreIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasMore);
 }
 std::vector<std::shared_ptr<RenderableUserNotification>> GetMyNotificationsResponse::getNotifications() const
 {
@@ -273,17 +424,17 @@ std::vector<std::shared_ptr<RenderableUserNotification>> GetMyNotificationsRespo
 void GetMyNotificationsResponse::setNotifications(const std::vector<std::shared_ptr<RenderableUserNotification>>& value)
 {
     m_Notifications = value;
-    m_NotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_Notifications);
 }
 
 bool GetMyNotificationsResponse::notificationsIsSet() const
 {
-    return m_NotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_Notifications);
 }
 
 void GetMyNotificationsResponse::unsetNotifications()
 {
-    m_NotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Notifications);
 }
 std::shared_ptr<APIStatus> GetMyNotificationsResponse::getStatus() const
 {
@@ -294,17 +445,17 @@ std::shared_ptr<APIStatus> GetMyNotificationsResponse::getStatus() const
 void GetMyNotificationsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetMyNotificationsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetMyNotificationsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetNotificationsResponse::GetNotificationsResponse()
 {
-    m_StatusIsSet = false;
-    m_NotificationsIsSet = false;
 }
 
 GetNotificationsResponse::~GetNotificationsResponse()
@@ -36,12 +34,12 @@ void GetNotificationsResponse::validate()
 web::json::value GetNotificationsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_NotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Notifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notifications"))] = ModelBase::toJson(m_Notifications);
@@ -50,32 +48,119 @@ web::json::value GetNotificationsResponse::toJson() const
     return val;
 }
 
+void GetNotificationsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Notifications))
+    {
+        
+        writer.key(_XPLATSTR("notifications"));
+        ModelBase::writeJson(writer, m_Notifications);
+    }
+
+    writer.endObject();
+}
+
 bool GetNotificationsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notifications")):
+            if(field.first == _XPLATSTR("notifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<UserNotification>> refVal_setNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotifications);
+                    setNotifications(refVal_setNotifications);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notifications"))))
+    return ok;
+}
+
+void GetNotificationsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notifications")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Notifications))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notifications")), m_Notifications);
+    }
+}
+
+bool GetNotificationsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<UserNotification>> refVal_setNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotifications);
-            setNotifications(refVal_setNotifications);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notifications")):
+            {
+                std::vector<std::shared_ptr<UserNotification>> refVal_setNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotifications(refVal_setNotifications);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetNotificationsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetNotificationsResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_NotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Notifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notifications")), m_Notifications));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetNotificationsResponse::getStatus() const
 void GetNotificationsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetNotificationsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetNotificationsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<UserNotification>> GetNotificationsResponse::getNotifications() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<UserNotification>> GetNotificationsResponse::getNoti
 void GetNotificationsResponse::setNotifications(const std::vector<std::shared_ptr<UserNotification>>& value)
 {
     m_Notifications = value;
-    m_NotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_Notifications);
 }
 
 bool GetNotificationsResponse::notificationsIsSet() const
 {
-    return m_NotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_Notifications);
 }
 
 void GetNotificationsResponse::unsetNotifications()
 {
-    m_NotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Notifications);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetPendingWebhookEventsResponse::GetPendingWebhookEventsResponse()
 {
-    m_StatusIsSet = false;
-    m_PendingWebhookEventsIsSet = false;
 }
 
 GetPendingWebhookEventsResponse::~GetPendingWebhookEventsResponse()
@@ -36,12 +34,12 @@ void GetPendingWebhookEventsResponse::validate()
 web::json::value GetPendingWebhookEventsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_PendingWebhookEventsIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingWebhookEvents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pendingWebhookEvents"))] = ModelBase::toJson(m_PendingWebhookEvents);
@@ -50,32 +48,119 @@ web::json::value GetPendingWebhookEventsResponse::toJson() const
     return val;
 }
 
+void GetPendingWebhookEventsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_PendingWebhookEvents))
+    {
+        
+        writer.key(_XPLATSTR("pendingWebhookEvents"));
+        ModelBase::writeJson(writer, m_PendingWebhookEvents);
+    }
+
+    writer.endObject();
+}
+
 bool GetPendingWebhookEventsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pendingWebhookEvents")):
+            if(field.first == _XPLATSTR("pendingWebhookEvents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PendingCommentToSyncOutbound>> refVal_setPendingWebhookEvents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPendingWebhookEvents);
+                    setPendingWebhookEvents(refVal_setPendingWebhookEvents);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pendingWebhookEvents"))))
+    return ok;
+}
+
+void GetPendingWebhookEventsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pendingWebhookEvents")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_PendingWebhookEvents))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pendingWebhookEvents")), m_PendingWebhookEvents);
+    }
+}
+
+bool GetPendingWebhookEventsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<PendingCommentToSyncOutbound>> refVal_setPendingWebhookEvents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPendingWebhookEvents);
-            setPendingWebhookEvents(refVal_setPendingWebhookEvents);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pendingWebhookEvents")):
+            {
+                std::vector<std::shared_ptr<PendingCommentToSyncOutbound>> refVal_setPendingWebhookEvents;
+                if(!ModelBase::readBinary(reader, field, refVal_setPendingWebhookEvents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPendingWebhookEvents(refVal_setPendingWebhookEvents);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetPendingWebhookEventsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetPendingWebhookEventsResponse::toMultipart(std::shared_ptr<MultipartFormD
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_PendingWebhookEventsIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingWebhookEvents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pendingWebhookEvents")), m_PendingWebhookEvents));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetPendingWebhookEventsResponse::getStatus() const
 void GetPendingWebhookEventsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetPendingWebhookEventsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetPendingWebhookEventsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<PendingCommentToSyncOutbound>> GetPendingWebhookEventsResponse::getPendingWebhookEvents() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<PendingCommentToSyncOutbound>> GetPendingWebhookEven
 void GetPendingWebhookEventsResponse::setPendingWebhookEvents(const std::vector<std::shared_ptr<PendingCommentToSyncOutbound>>& value)
 {
     m_PendingWebhookEvents = value;
-    m_PendingWebhookEventsIsSet = true;
+    m_FieldsSet.set(FieldBit_PendingWebhookEvents);
 }
 
 bool GetPendingWebhookEventsResponse::pendingWebhookEventsIsSet() const
 {
-    return m_PendingWebhookEventsIsSet;
+    return m_FieldsSet.test(FieldBit_PendingWebhookEvents);
 }
 
 void GetPendingWebhookEventsResponse::unsetPendingWebhookEvents()
 {
-    m_PendingWebhookEventsIsSet = false;
+    m_FieldsSet.reset(FieldBit_PendingWebhookEvents);
 }
 
 }
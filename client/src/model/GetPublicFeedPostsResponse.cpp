@@ -20,8 +20,6 @@ namespace model {
 
 GetPublicFeedPostsResponse::GetPublicFeedPostsResponse()
 {
-    m_StatusIsSet = false;
-    m_FeedPostsIsSet = false;
 }
 
 GetPublicFeedPostsResponse::~GetPublicFeedPostsResponse()
@@ -36,62 +34,172 @@ void GetPublicFeedPostsResponse::validate()
 web::json::value GetPublicFeedPostsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_FeedPostsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedPosts"))] = ModelBase::toJson(m_FeedPosts);
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User);
     }
 
     return val;
 }
 
+void GetPublicFeedPostsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
+    {
+        
+        writer.key(_XPLATSTR("feedPosts"));
+        ModelBase::writeJson(writer, m_FeedPosts);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        writer.key(_XPLATSTR("user"));
+        ModelBase::writeJson(writer, m_User);
+    }
+
+    writer.endObject();
+}
+
 bool GetPublicFeedPostsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedPosts"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedPosts")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPosts);
-            setFeedPosts(refVal_setFeedPosts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedPosts")):
+            if(field.first == _XPLATSTR("feedPosts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPosts);
+                    setFeedPosts(refVal_setFeedPosts);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            if(field.first == _XPLATSTR("user"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserSessionInfo> refVal_setUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
+                    setUser(refVal_setUser);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("user"))))
+    return ok;
+}
+
+void GetPublicFeedPostsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedPosts")), m_FeedPosts);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("user")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("user")), m_User);
+    }
+}
+
+bool GetPublicFeedPostsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<UserSessionInfo> refVal_setUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
-            setUser(refVal_setUser);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedPosts")):
+            {
+                std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedPosts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedPosts(refVal_setFeedPosts);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            {
+                std::shared_ptr<UserSessionInfo> refVal_setUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUser(refVal_setUser);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetPublicFeedPostsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -101,17 +209,17 @@ void GetPublicFeedPostsResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_FeedPostsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedPosts")), m_FeedPosts));
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User));
     }
 }
 
@@ -155,17 +263,17 @@ std::shared_ptr<APIStatus> GetPublicFeedPostsResponse::getStatus() const
 void GetPublicFeedPostsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetPublicFeedPostsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetPublicFeedPostsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<FeedPost>> GetPublicFeedPostsResponse::getFeedPosts() const
 {
@@ -176,37 +284,38 @@ std::vector<std::shared_ptr<FeedPost>> GetPublicFeedPostsResponse::getFeedPosts(
 void GetPublicFeedPostsResponse::setFeedPosts(const std::vector<std::shared_ptr<FeedPost>>& value)
 {
     m_FeedPosts = value;
-    m_FeedPostsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedPosts);
 }
 
 bool GetPublicFeedPostsResponse::feedPostsIsSet() const
 {
-    return m_FeedPostsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedPosts);
 }
 
 void GetPublicFeedPostsResponse::unsetFeedPosts()
 {
-    m_FeedPostsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedPosts);
 }
 std::shared_ptr<UserSessionInfo> GetPublicFeedPostsResponse::getUser() const
 {
-    return m_User.get();
+    return m_User;
 }
 
 
 void GetPublicFeedPostsResponse::setUser(const std::shared_ptr<UserSessionInfo>& value)
 {
     m_User = value;
+    m_FieldsSet.set(FieldBit_User);
 }
 
 bool GetPublicFeedPostsResponse::userIsSet() const
 {
-    return m_User.has_value();
+    return m_FieldsSet.test(FieldBit_User);
 }
 
 void GetPublicFeedPostsResponse::unsetUser()
 {
-    m_User.reset();
+    m_FieldsSet.reset(FieldBit_User);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetPublicPagesResponse::GetPublicPagesResponse()
 {
-    m_PagesIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetPublicPagesResponse::~GetPublicPagesResponse()
@@ -36,17 +34,17 @@ void GetPublicPagesResponse::validate()
 web::json::value GetPublicPagesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NextCursor.has_value())
+    if(m_FieldsSet.test(FieldBit_NextCursor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("nextCursor"))] = ModelBase::toJson(m_NextCursor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("nextCursor"))] = ModelBase::toJson(m_NextCursor);
     }
-    if(m_PagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pages"))] = ModelBase::toJson(m_Pages);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -55,43 +53,153 @@ web::json::value GetPublicPagesResponse::toJson() const
     return val;
 }
 
+void GetPublicPagesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_NextCursor))
+    {
+        
+        writer.key(_XPLATSTR("nextCursor"));
+        ModelBase::writeJson(writer, m_NextCursor);
+    }
+    if(m_FieldsSet.test(FieldBit_Pages))
+    {
+        
+        writer.key(_XPLATSTR("pages"));
+        ModelBase::writeJson(writer, m_Pages);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetPublicPagesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("nextCursor"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("nextCursor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setNextCursor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNextCursor);
-            setNextCursor(refVal_setNextCursor);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pages"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pages")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<PublicPage>> refVal_setPages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPages);
-            setPages(refVal_setPages);
-            
+        case ModelBase::fieldHash(_XPLATSTR("nextCursor")):
+            if(field.first == _XPLATSTR("nextCursor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNextCursor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNextCursor);
+                    setNextCursor(refVal_setNextCursor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pages")):
+            if(field.first == _XPLATSTR("pages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PublicPage>> refVal_setPages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPages);
+                    setPages(refVal_setPages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetPublicPagesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_NextCursor))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("nextCursor")), m_NextCursor);
+    }
+    if(m_FieldsSet.test(FieldBit_Pages))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pages")), m_Pages);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetPublicPagesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("nextCursor")):
+            {
+                utility::string_t refVal_setNextCursor;
+                if(!ModelBase::readBinary(reader, field, refVal_setNextCursor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNextCursor(refVal_setNextCursor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pages")):
+            {
+                std::vector<std::shared_ptr<PublicPage>> refVal_setPages;
+                if(!ModelBase::readBinary(reader, field, refVal_setPages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPages(refVal_setPages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetPublicPagesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -101,15 +209,15 @@ void GetPublicPagesResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NextCursor.has_value())
+    if(m_FieldsSet.test(FieldBit_NextCursor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextCursor")), m_NextCursor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextCursor")), m_NextCursor));
     }
-    if(m_PagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pages")), m_Pages));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -148,23 +256,24 @@ bool GetPublicPagesResponse::fromMultiPart(std::shared_ptr<MultipartFormData> mu
 
 utility::string_t GetPublicPagesResponse::getNextCursor() const
 {
-    return m_NextCursor.get();
+    return m_NextCursor;
 }
 
 
 void GetPublicPagesResponse::setNextCursor(const utility::string_t& value)
 {
     m_NextCursor = value;
+    m_FieldsSet.set(FieldBit_NextCursor);
 }
 
 bool GetPublicPagesResponse::nextCursorIsSet() const
 {
-    return m_NextCursor.has_value();
+    return m_FieldsSet.test(FieldBit_NextCursor);
 }
 
 void GetPublicPagesResponse::unsetNextCursor()
 {
-    m_NextCursor.reset();
+    m_FieldsSet.reset(FieldBit_NextCursor);
 }
 std::vector<std::shared_ptr<PublicPage>> GetPublicPagesResponse::getPages() const
 {
@@ -175,17 +284,17 @@ std::vector<std::shared_ptr<PublicPage>> GetPublicPagesResponse::getPages() cons
 void GetPublicPagesResponse::setPages(const std::vector<std::shared_ptr<PublicPage>>& value)
 {
     m_Pages = value;
-    m_PagesIsSet = true;
+    m_FieldsSet.set(FieldBit_Pages);
 }
 
 bool GetPublicPagesResponse::pagesIsSet() const
 {
-    return m_PagesIsSet;
+    return m_FieldsSet.test(FieldBit_Pages);
 }
 
 void GetPublicPagesResponse::unsetPages()
 {
-    m_PagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Pages);
 }
 std::shared_ptr<APIStatus> GetPublicPagesResponse::getStatus() const
 {
@@ -196,17 +305,17 @@ std::shared_ptr<APIStatus> GetPublicPagesResponse::getStatus() const
 void GetPublicPagesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetPublicPagesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetPublicPagesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
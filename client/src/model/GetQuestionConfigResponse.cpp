@@ -20,8 +20,6 @@ namespace model {
 
 GetQuestionConfigResponse::GetQuestionConfigResponse()
 {
-    m_StatusIsSet = false;
-    m_QuestionConfigIsSet = false;
 }
 
 GetQuestionConfigResponse::~GetQuestionConfigResponse()
@@ -36,12 +34,12 @@ void GetQuestionConfigResponse::validate()
 web::json::value GetQuestionConfigResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_QuestionConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionConfig))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionConfig"))] = ModelBase::toJson(m_QuestionConfig);
@@ -50,32 +48,119 @@ web::json::value GetQuestionConfigResponse::toJson() const
     return val;
 }
 
+void GetQuestionConfigResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionConfig))
+    {
+        
+        writer.key(_XPLATSTR("questionConfig"));
+        ModelBase::writeJson(writer, m_QuestionConfig);
+    }
+
+    writer.endObject();
+}
+
 bool GetQuestionConfigResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionConfig")):
+            if(field.first == _XPLATSTR("questionConfig"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QuestionConfig> refVal_setQuestionConfig;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionConfig);
+                    setQuestionConfig(refVal_setQuestionConfig);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionConfig"))))
+    return ok;
+}
+
+void GetQuestionConfigResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionConfig")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionConfig))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionConfig")), m_QuestionConfig);
+    }
+}
+
+bool GetQuestionConfigResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<QuestionConfig> refVal_setQuestionConfig;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionConfig);
-            setQuestionConfig(refVal_setQuestionConfig);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionConfig")):
+            {
+                std::shared_ptr<QuestionConfig> refVal_setQuestionConfig;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionConfig))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionConfig(refVal_setQuestionConfig);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetQuestionConfigResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetQuestionConfigResponse::toMultipart(std::shared_ptr<MultipartFormData> m
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_QuestionConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionConfig))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionConfig")), m_QuestionConfig));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetQuestionConfigResponse::getStatus() const
 void GetQuestionConfigResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetQuestionConfigResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetQuestionConfigResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<QuestionConfig> GetQuestionConfigResponse::getQuestionConfig() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<QuestionConfig> GetQuestionConfigResponse::getQuestionConfig() c
 void GetQuestionConfigResponse::setQuestionConfig(const std::shared_ptr<QuestionConfig>& value)
 {
     m_QuestionConfig = value;
-    m_QuestionConfigIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionConfig);
 }
 
 bool GetQuestionConfigResponse::questionConfigIsSet() const
 {
-    return m_QuestionConfigIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionConfig);
 }
 
 void GetQuestionConfigResponse::unsetQuestionConfig()
 {
-    m_QuestionConfigIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionConfig);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetQuestionConfigsResponse::GetQuestionConfigsResponse()
 {
-    m_StatusIsSet = false;
-    m_QuestionConfigsIsSet = false;
 }
 
 GetQuestionConfigsResponse::~GetQuestionConfigsResponse()
@@ -36,12 +34,12 @@ void GetQuestionConfigsResponse::validate()
 web::json::value GetQuestionConfigsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_QuestionConfigsIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionConfigs))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionConfigs"))] = ModelBase::toJson(m_QuestionConfigs);
@@ -50,32 +48,119 @@ web::json::value GetQuestionConfigsResponse::toJson() const
     return val;
 }
 
+void GetQuestionConfigsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionConfigs))
+    {
+        
+        writer.key(_XPLATSTR("questionConfigs"));
+        ModelBase::writeJson(writer, m_QuestionConfigs);
+    }
+
+    writer.endObject();
+}
+
 bool GetQuestionConfigsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionConfigs")):
+            if(field.first == _XPLATSTR("questionConfigs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<QuestionConfig>> refVal_setQuestionConfigs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionConfigs);
+                    setQuestionConfigs(refVal_setQuestionConfigs);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionConfigs"))))
+    return ok;
+}
+
+void GetQuestionConfigsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionConfigs")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionConfigs))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionConfigs")), m_QuestionConfigs);
+    }
+}
+
+bool GetQuestionConfigsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<QuestionConfig>> refVal_setQuestionConfigs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionConfigs);
-            setQuestionConfigs(refVal_setQuestionConfigs);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionConfigs")):
+            {
+                std::vector<std::shared_ptr<QuestionConfig>> refVal_setQuestionConfigs;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionConfigs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionConfigs(refVal_setQuestionConfigs);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetQuestionConfigsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetQuestionConfigsResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_QuestionConfigsIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionConfigs))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionConfigs")), m_QuestionConfigs));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetQuestionConfigsResponse::getStatus() const
 void GetQuestionConfigsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetQuestionConfigsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetQuestionConfigsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<QuestionConfig>> GetQuestionConfigsResponse::getQuestionConfigs() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<QuestionConfig>> GetQuestionConfigsResponse::getQues
 void GetQuestionConfigsResponse::setQuestionConfigs(const std::vector<std::shared_ptr<QuestionConfig>>& value)
 {
     m_QuestionConfigs = value;
-    m_QuestionConfigsIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionConfigs);
 }
 
 bool GetQuestionConfigsResponse::questionConfigsIsSet() const
 {
-    return m_QuestionConfigsIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionConfigs);
 }
 
 void GetQuestionConfigsResponse::unsetQuestionConfigs()
 {
-    m_QuestionConfigsIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionConfigs);
 }
 
 }
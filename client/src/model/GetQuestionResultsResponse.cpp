@@ -20,8 +20,6 @@ namespace model {
 
 GetQuestionResultsResponse::GetQuestionResultsResponse()
 {
-    m_StatusIsSet = false;
-    m_QuestionResultsIsSet = false;
 }
 
 GetQuestionResultsResponse::~GetQuestionResultsResponse()
@@ -36,12 +34,12 @@ void GetQuestionResultsResponse::validate()
 web::json::value GetQuestionResultsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_QuestionResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionResults))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionResults"))] = ModelBase::toJson(m_QuestionResults);
@@ -50,32 +48,119 @@ web::json::value GetQuestionResultsResponse::toJson() const
     return val;
 }
 
+void GetQuestionResultsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionResults))
+    {
+        
+        writer.key(_XPLATSTR("questionResults"));
+        ModelBase::writeJson(writer, m_QuestionResults);
+    }
+
+    writer.endObject();
+}
+
 bool GetQuestionResultsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionResults")):
+            if(field.first == _XPLATSTR("questionResults"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<QuestionResult>> refVal_setQuestionResults;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionResults);
+                    setQuestionResults(refVal_setQuestionResults);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionResults"))))
+    return ok;
+}
+
+void GetQuestionResultsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionResults")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionResults))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionResults")), m_QuestionResults);
+    }
+}
+
+bool GetQuestionResultsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<QuestionResult>> refVal_setQuestionResults;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionResults);
-            setQuestionResults(refVal_setQuestionResults);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionResults")):
+            {
+                std::vector<std::shared_ptr<QuestionResult>> refVal_setQuestionResults;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionResults))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionResults(refVal_setQuestionResults);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetQuestionResultsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetQuestionResultsResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_QuestionResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionResults))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionResults")), m_QuestionResults));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetQuestionResultsResponse::getStatus() const
 void GetQuestionResultsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetQuestionResultsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetQuestionResultsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<QuestionResult>> GetQuestionResultsResponse::getQuestionResults() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<QuestionResult>> GetQuestionResultsResponse::getQues
 void GetQuestionResultsResponse::setQuestionResults(const std::vector<std::shared_ptr<QuestionResult>>& value)
 {
     m_QuestionResults = value;
-    m_QuestionResultsIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionResults);
 }
 
 bool GetQuestionResultsResponse::questionResultsIsSet() const
 {
-    return m_QuestionResultsIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionResults);
 }
 
 void GetQuestionResultsResponse::unsetQuestionResults()
 {
-    m_QuestionResultsIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionResults);
 }
 
 }
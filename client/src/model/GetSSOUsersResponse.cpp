@@ -20,9 +20,6 @@ namespace model {
 
 GetSSOUsersResponse::GetSSOUsersResponse()
 {
-    m_UsersIsSet = false;
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
 }
 
 GetSSOUsersResponse::~GetSSOUsersResponse()
@@ -37,12 +34,12 @@ void GetSSOUsersResponse::validate()
 web::json::value GetSSOUsersResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("users"))] = ModelBase::toJson(m_Users);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -51,32 +48,119 @@ web::json::value GetSSOUsersResponse::toJson() const
     return val;
 }
 
+void GetSSOUsersResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        writer.key(_XPLATSTR("users"));
+        ModelBase::writeJson(writer, m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetSSOUsersResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("users"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("users")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<APISSOUser>> refVal_setUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
-            setUsers(refVal_setUsers);
-            
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            if(field.first == _XPLATSTR("users"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APISSOUser>> refVal_setUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
+                    setUsers(refVal_setUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetSSOUsersResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Users))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("users")), m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetSSOUsersResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            {
+                std::vector<std::shared_ptr<APISSOUser>> refVal_setUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsers(refVal_setUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetSSOUsersResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void GetSSOUsersResponse::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("users")), m_Users));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -130,17 +214,17 @@ std::vector<std::shared_ptr<APISSOUser>> GetSSOUsersResponse::getUsers() const
 void GetSSOUsersResponse::setUsers(const std::vector<std::shared_ptr<APISSOUser>>& value)
 {
     m_Users = value;
-    m_UsersIsSet = true;
+    m_FieldsSet.set(FieldBit_Users);
 }
 
 bool GetSSOUsersResponse::usersIsSet() const
 {
-    return m_UsersIsSet;
+    return m_FieldsSet.test(FieldBit_Users);
 }
 
 void GetSSOUsersResponse::unsetUsers()
 {
-    m_UsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Users);
 }
 utility::string_t GetSSOUsersResponse::getStatus() const
 {
@@ -151,17 +235,17 @@ utility::string_t GetSSOUsersResponse::getStatus() const
 void GetSSOUsersResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetSSOUsersResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetSSOUsersResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
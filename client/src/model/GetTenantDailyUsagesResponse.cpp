@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantDailyUsagesResponse::GetTenantDailyUsagesResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantDailyUsagesIsSet = false;
 }
 
 GetTenantDailyUsagesResponse::~GetTenantDailyUsagesResponse()
@@ -36,12 +34,12 @@ void GetTenantDailyUsagesResponse::validate()
 web::json::value GetTenantDailyUsagesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantDailyUsagesIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantDailyUsages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantDailyUsages"))] = ModelBase::toJson(m_TenantDailyUsages);
@@ -50,32 +48,119 @@ web::json::value GetTenantDailyUsagesResponse::toJson() const
     return val;
 }
 
+void GetTenantDailyUsagesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantDailyUsages))
+    {
+        
+        writer.key(_XPLATSTR("tenantDailyUsages"));
+        ModelBase::writeJson(writer, m_TenantDailyUsages);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantDailyUsagesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantDailyUsages")):
+            if(field.first == _XPLATSTR("tenantDailyUsages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APITenantDailyUsage>> refVal_setTenantDailyUsages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantDailyUsages);
+                    setTenantDailyUsages(refVal_setTenantDailyUsages);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantDailyUsages"))))
+    return ok;
+}
+
+void GetTenantDailyUsagesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantDailyUsages")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantDailyUsages))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantDailyUsages")), m_TenantDailyUsages);
+    }
+}
+
+bool GetTenantDailyUsagesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<APITenantDailyUsage>> refVal_setTenantDailyUsages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantDailyUsages);
-            setTenantDailyUsages(refVal_setTenantDailyUsages);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantDailyUsages")):
+            {
+                std::vector<std::shared_ptr<APITenantDailyUsage>> refVal_setTenantDailyUsages;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantDailyUsages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantDailyUsages(refVal_setTenantDailyUsages);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantDailyUsagesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantDailyUsagesResponse::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantDailyUsagesIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantDailyUsages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantDailyUsages")), m_TenantDailyUsages));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTenantDailyUsagesResponse::getStatus() const
 void GetTenantDailyUsagesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantDailyUsagesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantDailyUsagesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<APITenantDailyUsage>> GetTenantDailyUsagesResponse::getTenantDailyUsages() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<APITenantDailyUsage>> GetTenantDailyUsagesResponse::
 void GetTenantDailyUsagesResponse::setTenantDailyUsages(const std::vector<std::shared_ptr<APITenantDailyUsage>>& value)
 {
     m_TenantDailyUsages = value;
-    m_TenantDailyUsagesIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantDailyUsages);
 }
 
 bool GetTenantDailyUsagesResponse::tenantDailyUsagesIsSet() const
 {
-    return m_TenantDailyUsagesIsSet;
+    return m_FieldsSet.test(FieldBit_TenantDailyUsages);
 }
 
 void GetTenantDailyUsagesResponse::unsetTenantDailyUsages()
 {
-    m_TenantDailyUsagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantDailyUsages);
 }
 
 }
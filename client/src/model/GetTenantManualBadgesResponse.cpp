@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantManualBadgesResponse::GetTenantManualBadgesResponse()
 {
-    m_BadgesIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetTenantManualBadgesResponse::~GetTenantManualBadgesResponse()
@@ -36,12 +34,12 @@ void GetTenantManualBadgesResponse::validate()
 web::json::value GetTenantManualBadgesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value GetTenantManualBadgesResponse::toJson() const
     return val;
 }
 
+void GetTenantManualBadgesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantManualBadgesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<TenantBadge>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<TenantBadge>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetTenantManualBadgesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetTenantManualBadgesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<TenantBadge>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantManualBadgesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantManualBadgesResponse::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::shared_ptr<TenantBadge>> GetTenantManualBadgesResponse::getBadg
 void GetTenantManualBadgesResponse::setBadges(const std::vector<std::shared_ptr<TenantBadge>>& value)
 {
     m_Badges = value;
-    m_BadgesIsSet = true;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool GetTenantManualBadgesResponse::badgesIsSet() const
 {
-    return m_BadgesIsSet;
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void GetTenantManualBadgesResponse::unsetBadges()
 {
-    m_BadgesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 std::shared_ptr<APIStatus> GetTenantManualBadgesResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> GetTenantManualBadgesResponse::getStatus() const
 void GetTenantManualBadgesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantManualBadgesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantManualBadgesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
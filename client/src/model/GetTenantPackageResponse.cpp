@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantPackageResponse::GetTenantPackageResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantPackageIsSet = false;
 }
 
 GetTenantPackageResponse::~GetTenantPackageResponse()
@@ -36,12 +34,12 @@ void GetTenantPackageResponse::validate()
 web::json::value GetTenantPackageResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantPackageIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantPackage))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantPackage"))] = ModelBase::toJson(m_TenantPackage);
@@ -50,32 +48,119 @@ web::json::value GetTenantPackageResponse::toJson() const
     return val;
 }
 
+void GetTenantPackageResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantPackage))
+    {
+        
+        writer.key(_XPLATSTR("tenantPackage"));
+        ModelBase::writeJson(writer, m_TenantPackage);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantPackageResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantPackage")):
+            if(field.first == _XPLATSTR("tenantPackage"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<TenantPackage> refVal_setTenantPackage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantPackage);
+                    setTenantPackage(refVal_setTenantPackage);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantPackage"))))
+    return ok;
+}
+
+void GetTenantPackageResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantPackage")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantPackage))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantPackage")), m_TenantPackage);
+    }
+}
+
+bool GetTenantPackageResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<TenantPackage> refVal_setTenantPackage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantPackage);
-            setTenantPackage(refVal_setTenantPackage);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantPackage")):
+            {
+                std::shared_ptr<TenantPackage> refVal_setTenantPackage;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantPackage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantPackage(refVal_setTenantPackage);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantPackageResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantPackageResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantPackageIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantPackage))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantPackage")), m_TenantPackage));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTenantPackageResponse::getStatus() const
 void GetTenantPackageResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantPackageResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantPackageResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<TenantPackage> GetTenantPackageResponse::getTenantPackage() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<TenantPackage> GetTenantPackageResponse::getTenantPackage() cons
 void GetTenantPackageResponse::setTenantPackage(const std::shared_ptr<TenantPackage>& value)
 {
     m_TenantPackage = value;
-    m_TenantPackageIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantPackage);
 }
 
 bool GetTenantPackageResponse::tenantPackageIsSet() const
 {
-    return m_TenantPackageIsSet;
+    return m_FieldsSet.test(FieldBit_TenantPackage);
 }
 
 void GetTenantPackageResponse::unsetTenantPackage()
 {
-    m_TenantPackageIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantPackage);
 }
 
 }
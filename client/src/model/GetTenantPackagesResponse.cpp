@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantPackagesResponse::GetTenantPackagesResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantPackagesIsSet = false;
 }
 
 GetTenantPackagesResponse::~GetTenantPackagesResponse()
@@ -36,12 +34,12 @@ void GetTenantPackagesResponse::validate()
 web::json::value GetTenantPackagesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantPackagesIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantPackages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantPackages"))] = ModelBase::toJson(m_TenantPackages);
@@ -50,32 +48,119 @@ web::json::value GetTenantPackagesResponse::toJson() const
     return val;
 }
 
+void GetTenantPackagesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantPackages))
+    {
+        
+        writer.key(_XPLATSTR("tenantPackages"));
+        ModelBase::writeJson(writer, m_TenantPackages);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantPackagesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantPackages")):
+            if(field.first == _XPLATSTR("tenantPackages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<TenantPackage>> refVal_setTenantPackages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantPackages);
+                    setTenantPackages(refVal_setTenantPackages);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantPackages"))))
+    return ok;
+}
+
+void GetTenantPackagesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantPackages")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantPackages))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantPackages")), m_TenantPackages);
+    }
+}
+
+bool GetTenantPackagesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<TenantPackage>> refVal_setTenantPackages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantPackages);
-            setTenantPackages(refVal_setTenantPackages);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantPackages")):
+            {
+                std::vector<std::shared_ptr<TenantPackage>> refVal_setTenantPackages;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantPackages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantPackages(refVal_setTenantPackages);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantPackagesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantPackagesResponse::toMultipart(std::shared_ptr<MultipartFormData> m
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantPackagesIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantPackages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantPackages")), m_TenantPackages));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTenantPackagesResponse::getStatus() const
 void GetTenantPackagesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantPackagesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantPackagesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<TenantPackage>> GetTenantPackagesResponse::getTenantPackages() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<TenantPackage>> GetTenantPackagesResponse::getTenant
 void GetTenantPackagesResponse::setTenantPackages(const std::vector<std::shared_ptr<TenantPackage>>& value)
 {
     m_TenantPackages = value;
-    m_TenantPackagesIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantPackages);
 }
 
 bool GetTenantPackagesResponse::tenantPackagesIsSet() const
 {
-    return m_TenantPackagesIsSet;
+    return m_FieldsSet.test(FieldBit_TenantPackages);
 }
 
 void GetTenantPackagesResponse::unsetTenantPackages()
 {
-    m_TenantPackagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantPackages);
 }
 
 }
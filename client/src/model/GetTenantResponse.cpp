@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantResponse::GetTenantResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantIsSet = false;
 }
 
 GetTenantResponse::~GetTenantResponse()
@@ -36,12 +34,12 @@ void GetTenantResponse::validate()
 web::json::value GetTenantResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantIsSet)
+    if(m_FieldsSet.test(FieldBit_Tenant))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenant"))] = ModelBase::toJson(m_Tenant);
@@ -50,32 +48,119 @@ web::json::value GetTenantResponse::toJson() const
     return val;
 }
 
+void GetTenantResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tenant))
+    {
+        
+        writer.key(_XPLATSTR("tenant"));
+        ModelBase::writeJson(writer, m_Tenant);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenant")):
+            if(field.first == _XPLATSTR("tenant"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APITenant> refVal_setTenant;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenant);
+                    setTenant(refVal_setTenant);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenant"))))
+    return ok;
+}
+
+void GetTenantResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenant")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tenant))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenant")), m_Tenant);
+    }
+}
+
+bool GetTenantResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APITenant> refVal_setTenant;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenant);
-            setTenant(refVal_setTenant);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenant")):
+            {
+                std::shared_ptr<APITenant> refVal_setTenant;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenant))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenant(refVal_setTenant);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantIsSet)
+    if(m_FieldsSet.test(FieldBit_Tenant))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenant")), m_Tenant));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTenantResponse::getStatus() const
 void GetTenantResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APITenant> GetTenantResponse::getTenant() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APITenant> GetTenantResponse::getTenant() const
 void GetTenantResponse::setTenant(const std::shared_ptr<APITenant>& value)
 {
     m_Tenant = value;
-    m_TenantIsSet = true;
+    m_FieldsSet.set(FieldBit_Tenant);
 }
 
 bool GetTenantResponse::tenantIsSet() const
 {
-    return m_TenantIsSet;
+    return m_FieldsSet.test(FieldBit_Tenant);
 }
 
 void GetTenantResponse::unsetTenant()
 {
-    m_TenantIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tenant);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantUserResponse::GetTenantUserResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantUserIsSet = false;
 }
 
 GetTenantUserResponse::~GetTenantUserResponse()
@@ -36,12 +34,12 @@ void GetTenantUserResponse::validate()
 web::json::value GetTenantUserResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantUserIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantUser"))] = ModelBase::toJson(m_TenantUser);
@@ -50,32 +48,119 @@ web::json::value GetTenantUserResponse::toJson() const
     return val;
 }
 
+void GetTenantUserResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantUser))
+    {
+        
+        writer.key(_XPLATSTR("tenantUser"));
+        ModelBase::writeJson(writer, m_TenantUser);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantUserResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantUser")):
+            if(field.first == _XPLATSTR("tenantUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<User> refVal_setTenantUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantUser);
+                    setTenantUser(refVal_setTenantUser);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantUser"))))
+    return ok;
+}
+
+void GetTenantUserResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantUser")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantUser))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantUser")), m_TenantUser);
+    }
+}
+
+bool GetTenantUserResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<User> refVal_setTenantUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantUser);
-            setTenantUser(refVal_setTenantUser);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantUser")):
+            {
+                std::shared_ptr<User> refVal_setTenantUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantUser(refVal_setTenantUser);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantUserResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantUserResponse::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantUserIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantUser")), m_TenantUser));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTenantUserResponse::getStatus() const
 void GetTenantUserResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantUserResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantUserResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<User> GetTenantUserResponse::getTenantUser() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<User> GetTenantUserResponse::getTenantUser() const
 void GetTenantUserResponse::setTenantUser(const std::shared_ptr<User>& value)
 {
     m_TenantUser = value;
-    m_TenantUserIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantUser);
 }
 
 bool GetTenantUserResponse::tenantUserIsSet() const
 {
-    return m_TenantUserIsSet;
+    return m_FieldsSet.test(FieldBit_TenantUser);
 }
 
 void GetTenantUserResponse::unsetTenantUser()
 {
-    m_TenantUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantUser);
 }
 
 }
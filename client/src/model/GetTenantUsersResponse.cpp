@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantUsersResponse::GetTenantUsersResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantUsersIsSet = false;
 }
 
 GetTenantUsersResponse::~GetTenantUsersResponse()
@@ -36,12 +34,12 @@ void GetTenantUsersResponse::validate()
 web::json::value GetTenantUsersResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantUsers"))] = ModelBase::toJson(m_TenantUsers);
@@ -50,32 +48,119 @@ web::json::value GetTenantUsersResponse::toJson() const
     return val;
 }
 
+void GetTenantUsersResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantUsers))
+    {
+        
+        writer.key(_XPLATSTR("tenantUsers"));
+        ModelBase::writeJson(writer, m_TenantUsers);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantUsersResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantUsers")):
+            if(field.first == _XPLATSTR("tenantUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<User>> refVal_setTenantUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantUsers);
+                    setTenantUsers(refVal_setTenantUsers);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantUsers"))))
+    return ok;
+}
+
+void GetTenantUsersResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantUsers")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantUsers))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantUsers")), m_TenantUsers);
+    }
+}
+
+bool GetTenantUsersResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<User>> refVal_setTenantUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantUsers);
-            setTenantUsers(refVal_setTenantUsers);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantUsers")):
+            {
+                std::vector<std::shared_ptr<User>> refVal_setTenantUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantUsers(refVal_setTenantUsers);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantUsersResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantUsersResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantUsers")), m_TenantUsers));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTenantUsersResponse::getStatus() const
 void GetTenantUsersResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantUsersResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantUsersResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<User>> GetTenantUsersResponse::getTenantUsers() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<User>> GetTenantUsersResponse::getTenantUsers() cons
 void GetTenantUsersResponse::setTenantUsers(const std::vector<std::shared_ptr<User>>& value)
 {
     m_TenantUsers = value;
-    m_TenantUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantUsers);
 }
 
 bool GetTenantUsersResponse::tenantUsersIsSet() const
 {
-    return m_TenantUsersIsSet;
+    return m_FieldsSet.test(FieldBit_TenantUsers);
 }
 
 void GetTenantUsersResponse::unsetTenantUsers()
 {
-    m_TenantUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantUsers);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetTenantsResponse::GetTenantsResponse()
 {
-    m_StatusIsSet = false;
-    m_TenantsIsSet = false;
 }
 
 GetTenantsResponse::~GetTenantsResponse()
@@ -36,12 +34,12 @@ void GetTenantsResponse::validate()
 web::json::value GetTenantsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TenantsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tenants))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenants"))] = ModelBase::toJson(m_Tenants);
@@ -50,32 +48,119 @@ web::json::value GetTenantsResponse::toJson() const
     return val;
 }
 
+void GetTenantsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tenants))
+    {
+        
+        writer.key(_XPLATSTR("tenants"));
+        ModelBase::writeJson(writer, m_Tenants);
+    }
+
+    writer.endObject();
+}
+
 bool GetTenantsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenants")):
+            if(field.first == _XPLATSTR("tenants"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APITenant>> refVal_setTenants;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenants);
+                    setTenants(refVal_setTenants);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenants"))))
+    return ok;
+}
+
+void GetTenantsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenants")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tenants))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenants")), m_Tenants);
+    }
+}
+
+bool GetTenantsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<APITenant>> refVal_setTenants;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenants);
-            setTenants(refVal_setTenants);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenants")):
+            {
+                std::vector<std::shared_ptr<APITenant>> refVal_setTenants;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenants))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenants(refVal_setTenants);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTenantsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTenantsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipar
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TenantsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tenants))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenants")), m_Tenants));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTenantsResponse::getStatus() const
 void GetTenantsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTenantsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTenantsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<APITenant>> GetTenantsResponse::getTenants() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<APITenant>> GetTenantsResponse::getTenants() const
 void GetTenantsResponse::setTenants(const std::vector<std::shared_ptr<APITenant>>& value)
 {
     m_Tenants = value;
-    m_TenantsIsSet = true;
+    m_FieldsSet.set(FieldBit_Tenants);
 }
 
 bool GetTenantsResponse::tenantsIsSet() const
 {
-    return m_TenantsIsSet;
+    return m_FieldsSet.test(FieldBit_Tenants);
 }
 
 void GetTenantsResponse::unsetTenants()
 {
-    m_TenantsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tenants);
 }
 
 }
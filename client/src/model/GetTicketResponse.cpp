@@ -20,9 +20,6 @@ namespace model {
 
 GetTicketResponse::GetTicketResponse()
 {
-    m_StatusIsSet = false;
-    m_TicketIsSet = false;
-    m_AvailableStatesIsSet = false;
 }
 
 GetTicketResponse::~GetTicketResponse()
@@ -37,17 +34,17 @@ void GetTicketResponse::validate()
 web::json::value GetTicketResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TicketIsSet)
+    if(m_FieldsSet.test(FieldBit_Ticket))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ticket"))] = ModelBase::toJson(m_Ticket);
     }
-    if(m_AvailableStatesIsSet)
+    if(m_FieldsSet.test(FieldBit_AvailableStates))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("availableStates"))] = ModelBase::toJson(m_AvailableStates);
@@ -56,43 +53,153 @@ web::json::value GetTicketResponse::toJson() const
     return val;
 }
 
+void GetTicketResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Ticket))
+    {
+        
+        writer.key(_XPLATSTR("ticket"));
+        ModelBase::writeJson(writer, m_Ticket);
+    }
+    if(m_FieldsSet.test(FieldBit_AvailableStates))
+    {
+        
+        writer.key(_XPLATSTR("availableStates"));
+        ModelBase::writeJson(writer, m_AvailableStates);
+    }
+
+    writer.endObject();
+}
+
 bool GetTicketResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ticket"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ticket")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APITicketDetail> refVal_setTicket;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTicket);
-            setTicket(refVal_setTicket);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ticket")):
+            if(field.first == _XPLATSTR("ticket"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APITicketDetail> refVal_setTicket;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTicket);
+                    setTicket(refVal_setTicket);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("availableStates")):
+            if(field.first == _XPLATSTR("availableStates"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<double> refVal_setAvailableStates;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvailableStates);
+                    setAvailableStates(refVal_setAvailableStates);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("availableStates"))))
+    return ok;
+}
+
+void GetTicketResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Ticket))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ticket")), m_Ticket);
+    }
+    if(m_FieldsSet.test(FieldBit_AvailableStates))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("availableStates")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("availableStates")), m_AvailableStates);
+    }
+}
+
+bool GetTicketResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<double> refVal_setAvailableStates;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvailableStates);
-            setAvailableStates(refVal_setAvailableStates);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ticket")):
+            {
+                std::shared_ptr<APITicketDetail> refVal_setTicket;
+                if(!ModelBase::readBinary(reader, field, refVal_setTicket))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTicket(refVal_setTicket);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("availableStates")):
+            {
+                std::vector<double> refVal_setAvailableStates;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvailableStates))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvailableStates(refVal_setAvailableStates);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTicketResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -102,15 +209,15 @@ void GetTicketResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TicketIsSet)
+    if(m_FieldsSet.test(FieldBit_Ticket))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ticket")), m_Ticket));
     }
-    if(m_AvailableStatesIsSet)
+    if(m_FieldsSet.test(FieldBit_AvailableStates))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("availableStates")), m_AvailableStates));
     }
@@ -156,17 +263,17 @@ std::shared_ptr<APIStatus> GetTicketResponse::getStatus() const
 void GetTicketResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTicketResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTicketResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APITicketDetail> GetTicketResponse::getTicket() const
 {
@@ -177,17 +284,17 @@ std::shared_ptr<APITicketDetail> GetTicketResponse::getTicket() const
 void GetTicketResponse::setTicket(const std::shared_ptr<APITicketDetail>& value)
 {
     m_Ticket = value;
-    m_TicketIsSet = true;
+    m_FieldsSet.set(FieldBit_Ticket);
 }
 
 bool GetTicketResponse::ticketIsSet() const
 {
-    return m_TicketIsSet;
+    return m_FieldsSet.test(FieldBit_Ticket);
 }
 
 void GetTicketResponse::unsetTicket()
 {
-    m_TicketIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ticket);
 }
 std::vector<double> GetTicketResponse::getAvailableStates() const
 {
@@ -197,17 +304,17 @@ std::vector<double> GetTicketResponse::getAvailableStates() const
 void GetTicketResponse::setAvailableStates(std::vector<double> value)
 {
     m_AvailableStates = value;
-    m_AvailableStatesIsSet = true;
+    m_FieldsSet.set(FieldBit_AvailableStates);
 }
 
 bool GetTicketResponse::availableStatesIsSet() const
 {
-    return m_AvailableStatesIsSet;
+    return m_FieldsSet.test(FieldBit_AvailableStates);
 }
 
 void GetTicketResponse::unsetAvailableStates()
 {
-    m_AvailableStatesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AvailableStates);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GetTicketsResponse::GetTicketsResponse()
 {
-    m_StatusIsSet = false;
-    m_TicketsIsSet = false;
 }
 
 GetTicketsResponse::~GetTicketsResponse()
@@ -36,12 +34,12 @@ void GetTicketsResponse::validate()
 web::json::value GetTicketsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TicketsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tickets))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tickets"))] = ModelBase::toJson(m_Tickets);
@@ -50,32 +48,119 @@ web::json::value GetTicketsResponse::toJson() const
     return val;
 }
 
+void GetTicketsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tickets))
+    {
+        
+        writer.key(_XPLATSTR("tickets"));
+        ModelBase::writeJson(writer, m_Tickets);
+    }
+
+    writer.endObject();
+}
+
 bool GetTicketsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tickets")):
+            if(field.first == _XPLATSTR("tickets"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APITicket>> refVal_setTickets;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTickets);
+                    setTickets(refVal_setTickets);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tickets"))))
+    return ok;
+}
+
+void GetTicketsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tickets")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Tickets))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tickets")), m_Tickets);
+    }
+}
+
+bool GetTicketsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<APITicket>> refVal_setTickets;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTickets);
-            setTickets(refVal_setTickets);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tickets")):
+            {
+                std::vector<std::shared_ptr<APITicket>> refVal_setTickets;
+                if(!ModelBase::readBinary(reader, field, refVal_setTickets))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTickets(refVal_setTickets);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTicketsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTicketsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipar
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TicketsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tickets))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tickets")), m_Tickets));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetTicketsResponse::getStatus() const
 void GetTicketsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTicketsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTicketsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<APITicket>> GetTicketsResponse::getTickets() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<APITicket>> GetTicketsResponse::getTickets() const
 void GetTicketsResponse::setTickets(const std::vector<std::shared_ptr<APITicket>>& value)
 {
     m_Tickets = value;
-    m_TicketsIsSet = true;
+    m_FieldsSet.set(FieldBit_Tickets);
 }
 
 bool GetTicketsResponse::ticketsIsSet() const
 {
-    return m_TicketsIsSet;
+    return m_FieldsSet.test(FieldBit_Tickets);
 }
 
 void GetTicketsResponse::unsetTickets()
 {
-    m_TicketsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tickets);
 }
 
 }
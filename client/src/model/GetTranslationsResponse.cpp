@@ -20,8 +20,6 @@ namespace model {
 
 GetTranslationsResponse::GetTranslationsResponse()
 {
-    m_TranslationsIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetTranslationsResponse::~GetTranslationsResponse()
@@ -36,12 +34,12 @@ void GetTranslationsResponse::validate()
 web::json::value GetTranslationsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TranslationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translations"))] = ModelBase::toJson(m_Translations);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value GetTranslationsResponse::toJson() const
     return val;
 }
 
+void GetTranslationsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Translations))
+    {
+        
+        writer.key(_XPLATSTR("translations"));
+        ModelBase::writeJson(writer, m_Translations);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetTranslationsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translations"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translations")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, utility::string_t> refVal_setTranslations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
-            setTranslations(refVal_setTranslations);
-            
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            if(field.first == _XPLATSTR("translations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setTranslations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
+                    setTranslations(refVal_setTranslations);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetTranslationsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translations")), m_Translations);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetTranslationsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setTranslations;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslations(refVal_setTranslations);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetTranslationsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetTranslationsResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TranslationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translations")), m_Translations));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::map<utility::string_t, utility::string_t> GetTranslationsResponse::getTrans
 void GetTranslationsResponse::setTranslations(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Translations = value;
-    m_TranslationsIsSet = true;
+    m_FieldsSet.set(FieldBit_Translations);
 }
 
 bool GetTranslationsResponse::translationsIsSet() const
 {
-    return m_TranslationsIsSet;
+    return m_FieldsSet.test(FieldBit_Translations);
 }
 
 void GetTranslationsResponse::unsetTranslations()
 {
-    m_TranslationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Translations);
 }
 std::shared_ptr<APIStatus> GetTranslationsResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> GetTranslationsResponse::getStatus() const
 void GetTranslationsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetTranslationsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetTranslationsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
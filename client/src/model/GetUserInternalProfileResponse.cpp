@@ -20,8 +20,6 @@ namespace model {
 
 GetUserInternalProfileResponse::GetUserInternalProfileResponse()
 {
-    m_ProfileIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetUserInternalProfileResponse::~GetUserInternalProfileResponse()
@@ -36,12 +34,12 @@ void GetUserInternalProfileResponse::validate()
 web::json::value GetUserInternalProfileResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ProfileIsSet)
+    if(m_FieldsSet.test(FieldBit_Profile))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("profile"))] = ModelBase::toJson(m_Profile);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value GetUserInternalProfileResponse::toJson() const
     return val;
 }
 
+void GetUserInternalProfileResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Profile))
+    {
+        
+        writer.key(_XPLATSTR("profile"));
+        ModelBase::writeJson(writer, m_Profile);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetUserInternalProfileResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("profile"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("profile")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<GetUserInternalProfileResponse_profile> refVal_setProfile;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setProfile);
-            setProfile(refVal_setProfile);
-            
+        case ModelBase::fieldHash(_XPLATSTR("profile")):
+            if(field.first == _XPLATSTR("profile"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<GetUserInternalProfileResponse_profile> refVal_setProfile;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setProfile);
+                    setProfile(refVal_setProfile);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetUserInternalProfileResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Profile))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("profile")), m_Profile);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetUserInternalProfileResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("profile")):
+            {
+                std::shared_ptr<GetUserInternalProfileResponse_profile> refVal_setProfile;
+                if(!ModelBase::readBinary(reader, field, refVal_setProfile))
+                {
+                    ok = false;
+                    continue;
+                }
+                setProfile(refVal_setProfile);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetUserInternalProfileResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetUserInternalProfileResponse::toMultipart(std::shared_ptr<MultipartFormDa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ProfileIsSet)
+    if(m_FieldsSet.test(FieldBit_Profile))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("profile")), m_Profile));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<GetUserInternalProfileResponse_profile> GetUserInternalProfileRe
 void GetUserInternalProfileResponse::setProfile(const std::shared_ptr<GetUserInternalProfileResponse_profile>& value)
 {
     m_Profile = value;
-    m_ProfileIsSet = true;
+    m_FieldsSet.set(FieldBit_Profile);
 }
 
 bool GetUserInternalProfileResponse::profileIsSet() const
 {
-    return m_ProfileIsSet;
+    return m_FieldsSet.test(FieldBit_Profile);
 }
 
 void GetUserInternalProfileResponse::unsetProfile()
 {
-    m_ProfileIsSet = false;
+    m_FieldsSet.reset(FieldBit_Profile);
 }
 std::shared_ptr<APIStatus> GetUserInternalProfileResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> GetUserInternalProfileResponse::getStatus() const
 void GetUserInternalProfileResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetUserInternalProfileResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetUserInternalProfileResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
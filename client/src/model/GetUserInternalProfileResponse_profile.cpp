@@ -20,26 +20,8 @@ namespace model {
 
 GetUserInternalProfileResponse_profile::GetUserInternalProfileResponse_profile()
 {
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_IpHash = utility::conversions::to_string_t("");
-    m_IpHashIsSet = false;
-    m_CountryFlag = utility::conversions::to_string_t("");
-    m_CountryFlagIsSet = false;
-    m_CountryCode = utility::conversions::to_string_t("");
-    m_CountryCodeIsSet = false;
-    m_Bio = utility::conversions::to_string_t("");
-    m_BioIsSet = false;
     m_Karma = 0.0;
-    m_KarmaIsSet = false;
-    m_Locale = utility::conversions::to_string_t("");
-    m_LocaleIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_Username = utility::conversions::to_string_t("");
-    m_UsernameIsSet = false;
 }
 
 GetUserInternalProfileResponse_profile::~GetUserInternalProfileResponse_profile()
@@ -54,286 +36,718 @@ void GetUserInternalProfileResponse_profile::validate()
 web::json::value GetUserInternalProfileResponse_profile::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_FirstCommentDate.has_value())
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("firstCommentDate"))] = ModelBase::toJson(m_FirstCommentDate.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("firstCommentDate"))] = ModelBase::toJson(m_FirstCommentDate);
     }
-    if(m_IpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ipHash"))] = ModelBase::toJson(m_IpHash);
     }
-    if(m_CountryFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("countryFlag"))] = ModelBase::toJson(m_CountryFlag);
     }
-    if(m_CountryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("countryCode"))] = ModelBase::toJson(m_CountryCode);
     }
-    if(m_WebsiteUrl.has_value())
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))] = ModelBase::toJson(m_WebsiteUrl.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))] = ModelBase::toJson(m_WebsiteUrl);
     }
-    if(m_BioIsSet)
+    if(m_FieldsSet.test(FieldBit_Bio))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bio"))] = ModelBase::toJson(m_Bio);
     }
-    if(m_KarmaIsSet)
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("karma"))] = ModelBase::toJson(m_Karma);
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail);
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
 
     return val;
 }
 
+void GetUserInternalProfileResponse_profile::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
+    {
+        
+        writer.key(_XPLATSTR("firstCommentDate"));
+        ModelBase::writeJson(writer, m_FirstCommentDate);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHash))
+    {
+        
+        writer.key(_XPLATSTR("ipHash"));
+        ModelBase::writeJson(writer, m_IpHash);
+    }
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
+    {
+        
+        writer.key(_XPLATSTR("countryFlag"));
+        ModelBase::writeJson(writer, m_CountryFlag);
+    }
+    if(m_FieldsSet.test(FieldBit_CountryCode))
+    {
+        
+        writer.key(_XPLATSTR("countryCode"));
+        ModelBase::writeJson(writer, m_CountryCode);
+    }
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
+    {
+        
+        writer.key(_XPLATSTR("websiteUrl"));
+        ModelBase::writeJson(writer, m_WebsiteUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_Bio))
+    {
+        
+        writer.key(_XPLATSTR("bio"));
+        ModelBase::writeJson(writer, m_Bio);
+    }
+    if(m_FieldsSet.test(FieldBit_Karma))
+    {
+        
+        writer.key(_XPLATSTR("karma"));
+        ModelBase::writeJson(writer, m_Karma);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
+    {
+        
+        writer.key(_XPLATSTR("commenterEmail"));
+        ModelBase::writeJson(writer, m_CommenterEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+
+    writer.endObject();
+}
+
 bool GetUserInternalProfileResponse_profile::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("firstCommentDate"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("firstCommentDate")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::datetime refVal_setFirstCommentDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFirstCommentDate);
-            setFirstCommentDate(refVal_setFirstCommentDate);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
+                    setCommenterName(refVal_setCommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("firstCommentDate")):
+            if(field.first == _XPLATSTR("firstCommentDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setFirstCommentDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFirstCommentDate);
+                    setFirstCommentDate(refVal_setFirstCommentDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            if(field.first == _XPLATSTR("ipHash"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setIpHash;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
+                    setIpHash(refVal_setIpHash);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("countryFlag")):
+            if(field.first == _XPLATSTR("countryFlag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCountryFlag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCountryFlag);
+                    setCountryFlag(refVal_setCountryFlag);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("countryCode")):
+            if(field.first == _XPLATSTR("countryCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCountryCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCountryCode);
+                    setCountryCode(refVal_setCountryCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            if(field.first == _XPLATSTR("websiteUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWebsiteUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
+                    setWebsiteUrl(refVal_setWebsiteUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bio")):
+            if(field.first == _XPLATSTR("bio"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBio;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBio);
+                    setBio(refVal_setBio);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("karma")):
+            if(field.first == _XPLATSTR("karma"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setKarma;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setKarma);
+                    setKarma(refVal_setKarma);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            if(field.first == _XPLATSTR("commenterEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
+                    setCommenterEmail(refVal_setCommenterEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ipHash"))))
+    return ok;
+}
+
+void GetUserInternalProfileResponse_profile::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ipHash")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setIpHash;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
-            setIpHash(refVal_setIpHash);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("countryFlag"))))
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("countryFlag")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCountryFlag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCountryFlag);
-            setCountryFlag(refVal_setCountryFlag);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("firstCommentDate")), m_FirstCommentDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("countryCode"))))
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("countryCode")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCountryCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCountryCode);
-            setCountryCode(refVal_setCountryCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ipHash")), m_IpHash);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))))
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("websiteUrl")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWebsiteUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
-            setWebsiteUrl(refVal_setWebsiteUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("countryFlag")), m_CountryFlag);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bio"))))
+    if(m_FieldsSet.test(FieldBit_CountryCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bio")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBio;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBio);
-            setBio(refVal_setBio);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("countryCode")), m_CountryCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("karma"))))
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("karma")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setKarma;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setKarma);
-            setKarma(refVal_setKarma);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("websiteUrl")), m_WebsiteUrl);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_Bio))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bio")), m_Bio);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("karma")), m_Karma);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))))
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
-            setCommenterEmail(refVal_setCommenterEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_Username))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterEmail")), m_CommenterEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+}
+
+bool GetUserInternalProfileResponse_profile::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                utility::string_t refVal_setCommenterName;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterName(refVal_setCommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("firstCommentDate")):
+            {
+                utility::datetime refVal_setFirstCommentDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setFirstCommentDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFirstCommentDate(refVal_setFirstCommentDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            {
+                utility::string_t refVal_setIpHash;
+                if(!ModelBase::readBinary(reader, field, refVal_setIpHash))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIpHash(refVal_setIpHash);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("countryFlag")):
+            {
+                utility::string_t refVal_setCountryFlag;
+                if(!ModelBase::readBinary(reader, field, refVal_setCountryFlag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCountryFlag(refVal_setCountryFlag);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("countryCode")):
+            {
+                utility::string_t refVal_setCountryCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCountryCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCountryCode(refVal_setCountryCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            {
+                utility::string_t refVal_setWebsiteUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setWebsiteUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWebsiteUrl(refVal_setWebsiteUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bio")):
+            {
+                utility::string_t refVal_setBio;
+                if(!ModelBase::readBinary(reader, field, refVal_setBio))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBio(refVal_setBio);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("karma")):
+            {
+                double refVal_setKarma;
+                if(!ModelBase::readBinary(reader, field, refVal_setKarma))
+                {
+                    ok = false;
+                    continue;
+                }
+                setKarma(refVal_setKarma);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            {
+                utility::string_t refVal_setCommenterEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterEmail(refVal_setCommenterEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetUserInternalProfileResponse_profile::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -343,73 +757,73 @@ void GetUserInternalProfileResponse_profile::toMultipart(std::shared_ptr<Multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_FirstCommentDate.has_value())
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("firstCommentDate")), m_FirstCommentDate.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("firstCommentDate")), m_FirstCommentDate));
     }
-    if(m_IpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHash")), m_IpHash));
     }
-    if(m_CountryFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("countryFlag")), m_CountryFlag));
     }
-    if(m_CountryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("countryCode")), m_CountryCode));
     }
-    if(m_WebsiteUrl.has_value())
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("websiteUrl")), m_WebsiteUrl.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("websiteUrl")), m_WebsiteUrl));
     }
-    if(m_BioIsSet)
+    if(m_FieldsSet.test(FieldBit_Bio))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bio")), m_Bio));
     }
-    if(m_KarmaIsSet)
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("karma")), m_Karma));
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail));
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
 }
 
@@ -537,37 +951,38 @@ utility::string_t GetUserInternalProfileResponse_profile::getCommenterName() con
 void GetUserInternalProfileResponse_profile::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool GetUserInternalProfileResponse_profile::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void GetUserInternalProfileResponse_profile::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::datetime GetUserInternalProfileResponse_profile::getFirstCommentDate() const
 {
-    return m_FirstCommentDate.get();
+    return m_FirstCommentDate;
 }
 
 
 void GetUserInternalProfileResponse_profile::setFirstCommentDate(const utility::datetime& value)
 {
     m_FirstCommentDate = value;
+    m_FieldsSet.set(FieldBit_FirstCommentDate);
 }
 
 bool GetUserInternalProfileResponse_profile::firstCommentDateIsSet() const
 {
-    return m_FirstCommentDate.has_value();
+    return m_FieldsSet.test(FieldBit_FirstCommentDate);
 }
 
 void GetUserInternalProfileResponse_profile::unsetFirstCommentDate()
 {
-    m_FirstCommentDate.reset();
+    m_FieldsSet.reset(FieldBit_FirstCommentDate);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getIpHash() const
 {
@@ -578,17 +993,17 @@ utility::string_t GetUserInternalProfileResponse_profile::getIpHash() const
 void GetUserInternalProfileResponse_profile::setIpHash(const utility::string_t& value)
 {
     m_IpHash = value;
-    m_IpHashIsSet = true;
+    m_FieldsSet.set(FieldBit_IpHash);
 }
 
 bool GetUserInternalProfileResponse_profile::ipHashIsSet() const
 {
-    return m_IpHashIsSet;
+    return m_FieldsSet.test(FieldBit_IpHash);
 }
 
 void GetUserInternalProfileResponse_profile::unsetIpHash()
 {
-    m_IpHashIsSet = false;
+    m_FieldsSet.reset(FieldBit_IpHash);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getCountryFlag() const
 {
@@ -599,17 +1014,17 @@ utility::string_t GetUserInternalProfileResponse_profile::getCountryFlag() const
 void GetUserInternalProfileResponse_profile::setCountryFlag(const utility::string_t& value)
 {
     m_CountryFlag = value;
-    m_CountryFlagIsSet = true;
+    m_FieldsSet.set(FieldBit_CountryFlag);
 }
 
 bool GetUserInternalProfileResponse_profile::countryFlagIsSet() const
 {
-    return m_CountryFlagIsSet;
+    return m_FieldsSet.test(FieldBit_CountryFlag);
 }
 
 void GetUserInternalProfileResponse_profile::unsetCountryFlag()
 {
-    m_CountryFlagIsSet = false;
+    m_FieldsSet.reset(FieldBit_CountryFlag);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getCountryCode() const
 {
@@ -620,37 +1035,38 @@ utility::string_t GetUserInternalProfileResponse_profile::getCountryCode() const
 void GetUserInternalProfileResponse_profile::setCountryCode(const utility::string_t& value)
 {
     m_CountryCode = value;
-    m_CountryCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_CountryCode);
 }
 
 bool GetUserInternalProfileResponse_profile::countryCodeIsSet() const
 {
-    return m_CountryCodeIsSet;
+    return m_FieldsSet.test(FieldBit_CountryCode);
 }
 
 void GetUserInternalProfileResponse_profile::unsetCountryCode()
 {
-    m_CountryCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_CountryCode);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getWebsiteUrl() const
 {
-    return m_WebsiteUrl.get();
+    return m_WebsiteUrl;
 }
 
 
 void GetUserInternalProfileResponse_profile::setWebsiteUrl(const utility::string_t& value)
 {
     m_WebsiteUrl = value;
+    m_FieldsSet.set(FieldBit_WebsiteUrl);
 }
 
 bool GetUserInternalProfileResponse_profile::websiteUrlIsSet() const
 {
-    return m_WebsiteUrl.has_value();
+    return m_FieldsSet.test(FieldBit_WebsiteUrl);
 }
 
 void GetUserInternalProfileResponse_profile::unsetWebsiteUrl()
 {
-    m_WebsiteUrl.reset();
+    m_FieldsSet.reset(FieldBit_WebsiteUrl);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getBio() const
 {
@@ -661,17 +1077,17 @@ utility::string_t GetUserInternalProfileResponse_profile::getBio() const
 void GetUserInternalProfileResponse_profile::setBio(const utility::string_t& value)
 {
     m_Bio = value;
-    m_BioIsSet = true;
+    m_FieldsSet.set(FieldBit_Bio);
 }
 
 bool GetUserInternalProfileResponse_profile::bioIsSet() const
 {
-    return m_BioIsSet;
+    return m_FieldsSet.test(FieldBit_Bio);
 }
 
 void GetUserInternalProfileResponse_profile::unsetBio()
 {
-    m_BioIsSet = false;
+    m_FieldsSet.reset(FieldBit_Bio);
 }
 double GetUserInternalProfileResponse_profile::getKarma() const
 {
@@ -681,17 +1097,17 @@ double GetUserInternalProfileResponse_profile::getKarma() const
 void GetUserInternalProfileResponse_profile::setKarma(double value)
 {
     m_Karma = value;
-    m_KarmaIsSet = true;
+    m_FieldsSet.set(FieldBit_Karma);
 }
 
 bool GetUserInternalProfileResponse_profile::karmaIsSet() const
 {
-    return m_KarmaIsSet;
+    return m_FieldsSet.test(FieldBit_Karma);
 }
 
 void GetUserInternalProfileResponse_profile::unsetKarma()
 {
-    m_KarmaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Karma);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getLocale() const
 {
@@ -702,17 +1118,17 @@ utility::string_t GetUserInternalProfileResponse_profile::getLocale() const
 void GetUserInternalProfileResponse_profile::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
-    m_LocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool GetUserInternalProfileResponse_profile::localeIsSet() const
 {
-    return m_LocaleIsSet;
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void GetUserInternalProfileResponse_profile::unsetLocale()
 {
-    m_LocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 bool GetUserInternalProfileResponse_profile::isVerified() const
 {
@@ -722,37 +1138,38 @@ bool GetUserInternalProfileResponse_profile::isVerified() const
 void GetUserInternalProfileResponse_profile::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool GetUserInternalProfileResponse_profile::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void GetUserInternalProfileResponse_profile::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void GetUserInternalProfileResponse_profile::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool GetUserInternalProfileResponse_profile::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void GetUserInternalProfileResponse_profile::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getDisplayName() const
 {
@@ -763,17 +1180,17 @@ utility::string_t GetUserInternalProfileResponse_profile::getDisplayName() const
 void GetUserInternalProfileResponse_profile::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool GetUserInternalProfileResponse_profile::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void GetUserInternalProfileResponse_profile::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getUsername() const
 {
@@ -784,97 +1201,101 @@ utility::string_t GetUserInternalProfileResponse_profile::getUsername() const
 void GetUserInternalProfileResponse_profile::setUsername(const utility::string_t& value)
 {
     m_Username = value;
-    m_UsernameIsSet = true;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool GetUserInternalProfileResponse_profile::usernameIsSet() const
 {
-    return m_UsernameIsSet;
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void GetUserInternalProfileResponse_profile::unsetUsername()
 {
-    m_UsernameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getCommenterEmail() const
 {
-    return m_CommenterEmail.get();
+    return m_CommenterEmail;
 }
 
 
 void GetUserInternalProfileResponse_profile::setCommenterEmail(const utility::string_t& value)
 {
     m_CommenterEmail = value;
+    m_FieldsSet.set(FieldBit_CommenterEmail);
 }
 
 bool GetUserInternalProfileResponse_profile::commenterEmailIsSet() const
 {
-    return m_CommenterEmail.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterEmail);
 }
 
 void GetUserInternalProfileResponse_profile::unsetCommenterEmail()
 {
-    m_CommenterEmail.reset();
+    m_FieldsSet.reset(FieldBit_CommenterEmail);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getEmail() const
 {
-    return m_Email.get();
+    return m_Email;
 }
 
 
 void GetUserInternalProfileResponse_profile::setEmail(const utility::string_t& value)
 {
     m_Email = value;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool GetUserInternalProfileResponse_profile::emailIsSet() const
 {
-    return m_Email.has_value();
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void GetUserInternalProfileResponse_profile::unsetEmail()
 {
-    m_Email.reset();
+    m_FieldsSet.reset(FieldBit_Email);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getAnonUserId() const
 {
-    return m_AnonUserId.get();
+    return m_AnonUserId;
 }
 
 
 void GetUserInternalProfileResponse_profile::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool GetUserInternalProfileResponse_profile::anonUserIdIsSet() const
 {
-    return m_AnonUserId.has_value();
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void GetUserInternalProfileResponse_profile::unsetAnonUserId()
 {
-    m_AnonUserId.reset();
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t GetUserInternalProfileResponse_profile::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void GetUserInternalProfileResponse_profile::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool GetUserInternalProfileResponse_profile::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void GetUserInternalProfileResponse_profile::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 
 }
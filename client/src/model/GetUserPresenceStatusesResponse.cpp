@@ -20,8 +20,6 @@ namespace model {
 
 GetUserPresenceStatusesResponse::GetUserPresenceStatusesResponse()
 {
-    m_StatusIsSet = false;
-    m_UserIdsOnlineIsSet = false;
 }
 
 GetUserPresenceStatusesResponse::~GetUserPresenceStatusesResponse()
@@ -36,12 +34,12 @@ void GetUserPresenceStatusesResponse::validate()
 web::json::value GetUserPresenceStatusesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_UserIdsOnlineIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdsOnline))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userIdsOnline"))] = ModelBase::toJson(m_UserIdsOnline);
@@ -50,32 +48,119 @@ web::json::value GetUserPresenceStatusesResponse::toJson() const
     return val;
 }
 
+void GetUserPresenceStatusesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIdsOnline))
+    {
+        
+        writer.key(_XPLATSTR("userIdsOnline"));
+        ModelBase::writeJson(writer, m_UserIdsOnline);
+    }
+
+    writer.endObject();
+}
+
 bool GetUserPresenceStatusesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userIdsOnline")):
+            if(field.first == _XPLATSTR("userIdsOnline"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, bool> refVal_setUserIdsOnline;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdsOnline);
+                    setUserIdsOnline(refVal_setUserIdsOnline);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userIdsOnline"))))
+    return ok;
+}
+
+void GetUserPresenceStatusesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userIdsOnline")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIdsOnline))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userIdsOnline")), m_UserIdsOnline);
+    }
+}
+
+bool GetUserPresenceStatusesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, bool> refVal_setUserIdsOnline;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdsOnline);
-            setUserIdsOnline(refVal_setUserIdsOnline);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userIdsOnline")):
+            {
+                std::map<utility::string_t, bool> refVal_setUserIdsOnline;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserIdsOnline))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserIdsOnline(refVal_setUserIdsOnline);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetUserPresenceStatusesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetUserPresenceStatusesResponse::toMultipart(std::shared_ptr<MultipartFormD
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_UserIdsOnlineIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdsOnline))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userIdsOnline")), m_UserIdsOnline));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> GetUserPresenceStatusesResponse::getStatus() const
 void GetUserPresenceStatusesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetUserPresenceStatusesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetUserPresenceStatusesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::map<utility::string_t, bool> GetUserPresenceStatusesResponse::getUserIdsOnline() const
 {
@@ -149,17 +234,17 @@ std::map<utility::string_t, bool> GetUserPresenceStatusesResponse::getUserIdsOnl
 void GetUserPresenceStatusesResponse::setUserIdsOnline(std::map<utility::string_t, bool> value)
 {
     m_UserIdsOnline = value;
-    m_UserIdsOnlineIsSet = true;
+    m_FieldsSet.set(FieldBit_UserIdsOnline);
 }
 
 bool GetUserPresenceStatusesResponse::userIdsOnlineIsSet() const
 {
-    return m_UserIdsOnlineIsSet;
+    return m_FieldsSet.test(FieldBit_UserIdsOnline);
 }
 
 void GetUserPresenceStatusesResponse::unsetUserIdsOnline()
 {
-    m_UserIdsOnlineIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserIdsOnline);
 }
 
 }
@@ -21,10 +21,7 @@ namespace model {
 GetUserTrustFactorResponse::GetUserTrustFactorResponse()
 {
     m_ManualTrustFactor = 0.0;
-    m_ManualTrustFactorIsSet = false;
     m_AutoTrustFactor = 0.0;
-    m_AutoTrustFactorIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetUserTrustFactorResponse::~GetUserTrustFactorResponse()
@@ -39,17 +36,17 @@ void GetUserTrustFactorResponse::validate()
 web::json::value GetUserTrustFactorResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ManualTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor"))] = ModelBase::toJson(m_ManualTrustFactor);
     }
-    if(m_AutoTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor"))] = ModelBase::toJson(m_AutoTrustFactor);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -58,43 +55,153 @@ web::json::value GetUserTrustFactorResponse::toJson() const
     return val;
 }
 
+void GetUserTrustFactorResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
+    {
+        
+        writer.key(_XPLATSTR("manualTrustFactor"));
+        ModelBase::writeJson(writer, m_ManualTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
+    {
+        
+        writer.key(_XPLATSTR("autoTrustFactor"));
+        ModelBase::writeJson(writer, m_AutoTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetUserTrustFactorResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setManualTrustFactor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setManualTrustFactor);
-            setManualTrustFactor(refVal_setManualTrustFactor);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setAutoTrustFactor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoTrustFactor);
-            setAutoTrustFactor(refVal_setAutoTrustFactor);
-            
+        case ModelBase::fieldHash(_XPLATSTR("manualTrustFactor")):
+            if(field.first == _XPLATSTR("manualTrustFactor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setManualTrustFactor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setManualTrustFactor);
+                    setManualTrustFactor(refVal_setManualTrustFactor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoTrustFactor")):
+            if(field.first == _XPLATSTR("autoTrustFactor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAutoTrustFactor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoTrustFactor);
+                    setAutoTrustFactor(refVal_setAutoTrustFactor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetUserTrustFactorResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("manualTrustFactor")), m_ManualTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoTrustFactor")), m_AutoTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetUserTrustFactorResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("manualTrustFactor")):
+            {
+                double refVal_setManualTrustFactor;
+                if(!ModelBase::readBinary(reader, field, refVal_setManualTrustFactor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setManualTrustFactor(refVal_setManualTrustFactor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoTrustFactor")):
+            {
+                double refVal_setAutoTrustFactor;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoTrustFactor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoTrustFactor(refVal_setAutoTrustFactor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetUserTrustFactorResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -104,15 +211,15 @@ void GetUserTrustFactorResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ManualTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor")), m_ManualTrustFactor));
     }
-    if(m_AutoTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor")), m_AutoTrustFactor));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -157,17 +264,17 @@ double GetUserTrustFactorResponse::getManualTrustFactor() const
 void GetUserTrustFactorResponse::setManualTrustFactor(double value)
 {
     m_ManualTrustFactor = value;
-    m_ManualTrustFactorIsSet = true;
+    m_FieldsSet.set(FieldBit_ManualTrustFactor);
 }
 
 bool GetUserTrustFactorResponse::manualTrustFactorIsSet() const
 {
-    return m_ManualTrustFactorIsSet;
+    return m_FieldsSet.test(FieldBit_ManualTrustFactor);
 }
 
 void GetUserTrustFactorResponse::unsetManualTrustFactor()
 {
-    m_ManualTrustFactorIsSet = false;
+    m_FieldsSet.reset(FieldBit_ManualTrustFactor);
 }
 double GetUserTrustFactorResponse::getAutoTrustFactor() const
 {
@@ -177,17 +284,17 @@ double GetUserTrustFactorResponse::getAutoTrustFactor() const
 void GetUserTrustFactorResponse::setAutoTrustFactor(double value)
 {
     m_AutoTrustFactor = value;
-    m_AutoTrustFactorIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoTrustFactor);
 }
 
 bool GetUserTrustFactorResponse::autoTrustFactorIsSet() const
 {
-    return m_AutoTrustFactorIsSet;
+    return m_FieldsSet.test(FieldBit_AutoTrustFactor);
 }
 
 void GetUserTrustFactorResponse::unsetAutoTrustFactor()
 {
-    m_AutoTrustFactorIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoTrustFactor);
 }
 std::shared_ptr<APIStatus> GetUserTrustFactorResponse::getStatus() const
 {
@@ -198,17 +305,17 @@ std::shared_ptr<APIStatus> GetUserTrustFactorResponse::getStatus() const
 void GetUserTrustFactorResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetUserTrustFactorResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetUserTrustFactorResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
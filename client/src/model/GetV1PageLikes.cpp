@@ -20,15 +20,9 @@ namespace model {
 
 GetV1PageLikes::GetV1PageLikes()
 {
-    m_UrlIdWS = utility::conversions::to_string_t("");
-    m_UrlIdWSIsSet = false;
     m_DidLike = false;
-    m_DidLikeIsSet = false;
     m_CommentCount = 0;
-    m_CommentCountIsSet = false;
     m_LikeCount = 0;
-    m_LikeCountIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetV1PageLikes::~GetV1PageLikes()
@@ -43,27 +37,27 @@ void GetV1PageLikes::validate()
 web::json::value GetV1PageLikes::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))] = ModelBase::toJson(m_UrlIdWS);
     }
-    if(m_DidLikeIsSet)
+    if(m_FieldsSet.test(FieldBit_DidLike))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("didLike"))] = ModelBase::toJson(m_DidLike);
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentCount"))] = ModelBase::toJson(m_CommentCount);
     }
-    if(m_LikeCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LikeCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("likeCount"))] = ModelBase::toJson(m_LikeCount);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -72,65 +66,221 @@ web::json::value GetV1PageLikes::toJson() const
     return val;
 }
 
+void GetV1PageLikes::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
+    {
+        
+        writer.key(_XPLATSTR("urlIdWS"));
+        ModelBase::writeJson(writer, m_UrlIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_DidLike))
+    {
+        
+        writer.key(_XPLATSTR("didLike"));
+        ModelBase::writeJson(writer, m_DidLike);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        writer.key(_XPLATSTR("commentCount"));
+        ModelBase::writeJson(writer, m_CommentCount);
+    }
+    if(m_FieldsSet.test(FieldBit_LikeCount))
+    {
+        
+        writer.key(_XPLATSTR("likeCount"));
+        ModelBase::writeJson(writer, m_LikeCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetV1PageLikes::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
-            setUrlIdWS(refVal_setUrlIdWS);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("didLike"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("didLike")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setDidLike;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDidLike);
-            setDidLike(refVal_setDidLike);
-            
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            if(field.first == _XPLATSTR("urlIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
+                    setUrlIdWS(refVal_setUrlIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("didLike")):
+            if(field.first == _XPLATSTR("didLike"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDidLike;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDidLike);
+                    setDidLike(refVal_setDidLike);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            if(field.first == _XPLATSTR("commentCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setCommentCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
+                    setCommentCount(refVal_setCommentCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("likeCount")):
+            if(field.first == _XPLATSTR("likeCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setLikeCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLikeCount);
+                    setLikeCount(refVal_setLikeCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentCount"))))
+    return ok;
+}
+
+void GetV1PageLikes::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setCommentCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentCount);
-            setCommentCount(refVal_setCommentCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdWS")), m_UrlIdWS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("likeCount"))))
+    if(m_FieldsSet.test(FieldBit_DidLike))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("likeCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setLikeCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLikeCount);
-            setLikeCount(refVal_setLikeCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("didLike")), m_DidLike);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentCount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentCount")), m_CommentCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(m_FieldsSet.test(FieldBit_LikeCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("likeCount")), m_LikeCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetV1PageLikes::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            {
+                utility::string_t refVal_setUrlIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlIdWS(refVal_setUrlIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("didLike")):
+            {
+                bool refVal_setDidLike;
+                if(!ModelBase::readBinary(reader, field, refVal_setDidLike))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDidLike(refVal_setDidLike);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentCount")):
+            {
+                int32_t refVal_setCommentCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentCount(refVal_setCommentCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("likeCount")):
+            {
+                int32_t refVal_setLikeCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setLikeCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLikeCount(refVal_setLikeCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetV1PageLikes::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -140,23 +290,23 @@ void GetV1PageLikes::toMultipart(std::shared_ptr<MultipartFormData> multipart, c
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdWS")), m_UrlIdWS));
     }
-    if(m_DidLikeIsSet)
+    if(m_FieldsSet.test(FieldBit_DidLike))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("didLike")), m_DidLike));
     }
-    if(m_CommentCountIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentCount")), m_CommentCount));
     }
-    if(m_LikeCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LikeCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("likeCount")), m_LikeCount));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -214,17 +364,17 @@ utility::string_t GetV1PageLikes::getUrlIdWS() const
 void GetV1PageLikes::setUrlIdWS(const utility::string_t& value)
 {
     m_UrlIdWS = value;
-    m_UrlIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdWS);
 }
 
 bool GetV1PageLikes::urlIdWSIsSet() const
 {
-    return m_UrlIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdWS);
 }
 
 void GetV1PageLikes::unsetUrlIdWS()
 {
-    m_UrlIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdWS);
 }
 bool GetV1PageLikes::isDidLike() const
 {
@@ -234,17 +384,17 @@ bool GetV1PageLikes::isDidLike() const
 void GetV1PageLikes::setDidLike(bool value)
 {
     m_DidLike = value;
-    m_DidLikeIsSet = true;
+    m_FieldsSet.set(FieldBit_DidLike);
 }
 
 bool GetV1PageLikes::didLikeIsSet() const
 {
-    return m_DidLikeIsSet;
+    return m_FieldsSet.test(FieldBit_DidLike);
 }
 
 void GetV1PageLikes::unsetDidLike()
 {
-    m_DidLikeIsSet = false;
+    m_FieldsSet.reset(FieldBit_DidLike);
 }
 int32_t GetV1PageLikes::getCommentCount() const
 {
@@ -254,17 +404,17 @@ int32_t GetV1PageLikes::getCommentCount() const
 void GetV1PageLikes::setCommentCount(int32_t value)
 {
     m_CommentCount = value;
-    m_CommentCountIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentCount);
 }
 
 bool GetV1PageLikes::commentCountIsSet() const
 {
-    return m_CommentCountIsSet;
+    return m_FieldsSet.test(FieldBit_CommentCount);
 }
 
 void GetV1PageLikes::unsetCommentCount()
 {
-    m_CommentCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentCount);
 }
 int32_t GetV1PageLikes::getLikeCount() const
 {
@@ -274,17 +424,17 @@ int32_t GetV1PageLikes::getLikeCount() const
 void GetV1PageLikes::setLikeCount(int32_t value)
 {
     m_LikeCount = value;
-    m_LikeCountIsSet = true;
+    m_FieldsSet.set(FieldBit_LikeCount);
 }
 
 bool GetV1PageLikes::likeCountIsSet() const
 {
-    return m_LikeCountIsSet;
+    return m_FieldsSet.test(FieldBit_LikeCount);
 }
 
 void GetV1PageLikes::unsetLikeCount()
 {
-    m_LikeCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_LikeCount);
 }
 std::shared_ptr<APIStatus> GetV1PageLikes::getStatus() const
 {
@@ -295,17 +445,17 @@ std::shared_ptr<APIStatus> GetV1PageLikes::getStatus() const
 void GetV1PageLikes::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetV1PageLikes::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetV1PageLikes::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
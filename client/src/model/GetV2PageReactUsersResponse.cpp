@@ -20,8 +20,6 @@ namespace model {
 
 GetV2PageReactUsersResponse::GetV2PageReactUsersResponse()
 {
-    m_UserNamesIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetV2PageReactUsersResponse::~GetV2PageReactUsersResponse()
@@ -36,12 +34,12 @@ void GetV2PageReactUsersResponse::validate()
 web::json::value GetV2PageReactUsersResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_UserNames))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userNames"))] = ModelBase::toJson(m_UserNames);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value GetV2PageReactUsersResponse::toJson() const
     return val;
 }
 
+void GetV2PageReactUsersResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_UserNames))
+    {
+        
+        writer.key(_XPLATSTR("userNames"));
+        ModelBase::writeJson(writer, m_UserNames);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetV2PageReactUsersResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userNames"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userNames")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setUserNames;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserNames);
-            setUserNames(refVal_setUserNames);
-            
+        case ModelBase::fieldHash(_XPLATSTR("userNames")):
+            if(field.first == _XPLATSTR("userNames"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setUserNames;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserNames);
+                    setUserNames(refVal_setUserNames);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetV2PageReactUsersResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_UserNames))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userNames")), m_UserNames);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetV2PageReactUsersResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("userNames")):
+            {
+                std::vector<utility::string_t> refVal_setUserNames;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserNames))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserNames(refVal_setUserNames);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetV2PageReactUsersResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GetV2PageReactUsersResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_UserNames))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userNames")), m_UserNames));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<utility::string_t> GetV2PageReactUsersResponse::getUserNames() const
 void GetV2PageReactUsersResponse::setUserNames(const std::vector<utility::string_t>& value)
 {
     m_UserNames = value;
-    m_UserNamesIsSet = true;
+    m_FieldsSet.set(FieldBit_UserNames);
 }
 
 bool GetV2PageReactUsersResponse::userNamesIsSet() const
 {
-    return m_UserNamesIsSet;
+    return m_FieldsSet.test(FieldBit_UserNames);
 }
 
 void GetV2PageReactUsersResponse::unsetUserNames()
 {
-    m_UserNamesIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserNames);
 }
 std::shared_ptr<APIStatus> GetV2PageReactUsersResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> GetV2PageReactUsersResponse::getStatus() const
 void GetV2PageReactUsersResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetV2PageReactUsersResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetV2PageReactUsersResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
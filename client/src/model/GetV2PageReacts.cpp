@@ -20,9 +20,6 @@ namespace model {
 
 GetV2PageReacts::GetV2PageReacts()
 {
-    m_ReactedIdsIsSet = false;
-    m_CountsIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GetV2PageReacts::~GetV2PageReacts()
@@ -37,17 +34,17 @@ void GetV2PageReacts::validate()
 web::json::value GetV2PageReacts::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReactedIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ReactedIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reactedIds"))] = ModelBase::toJson(m_ReactedIds);
     }
-    if(m_CountsIsSet)
+    if(m_FieldsSet.test(FieldBit_Counts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("counts"))] = ModelBase::toJson(m_Counts);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -56,43 +53,153 @@ web::json::value GetV2PageReacts::toJson() const
     return val;
 }
 
+void GetV2PageReacts::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ReactedIds))
+    {
+        
+        writer.key(_XPLATSTR("reactedIds"));
+        ModelBase::writeJson(writer, m_ReactedIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Counts))
+    {
+        
+        writer.key(_XPLATSTR("counts"));
+        ModelBase::writeJson(writer, m_Counts);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GetV2PageReacts::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reactedIds"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reactedIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setReactedIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReactedIds);
-            setReactedIds(refVal_setReactedIds);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("counts"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("counts")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, double> refVal_setCounts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCounts);
-            setCounts(refVal_setCounts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reactedIds")):
+            if(field.first == _XPLATSTR("reactedIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setReactedIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReactedIds);
+                    setReactedIds(refVal_setReactedIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("counts")):
+            if(field.first == _XPLATSTR("counts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, double> refVal_setCounts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCounts);
+                    setCounts(refVal_setCounts);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GetV2PageReacts::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ReactedIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reactedIds")), m_ReactedIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Counts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("counts")), m_Counts);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GetV2PageReacts::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reactedIds")):
+            {
+                std::vector<utility::string_t> refVal_setReactedIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setReactedIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReactedIds(refVal_setReactedIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("counts")):
+            {
+                std::map<utility::string_t, double> refVal_setCounts;
+                if(!ModelBase::readBinary(reader, field, refVal_setCounts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCounts(refVal_setCounts);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetV2PageReacts::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -102,15 +209,15 @@ void GetV2PageReacts::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReactedIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ReactedIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reactedIds")), m_ReactedIds));
     }
-    if(m_CountsIsSet)
+    if(m_FieldsSet.test(FieldBit_Counts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("counts")), m_Counts));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -156,17 +263,17 @@ std::vector<utility::string_t> GetV2PageReacts::getReactedIds() const
 void GetV2PageReacts::setReactedIds(const std::vector<utility::string_t>& value)
 {
     m_ReactedIds = value;
-    m_ReactedIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ReactedIds);
 }
 
 bool GetV2PageReacts::reactedIdsIsSet() const
 {
-    return m_ReactedIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ReactedIds);
 }
 
 void GetV2PageReacts::unsetReactedIds()
 {
-    m_ReactedIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReactedIds);
 }
 std::map<utility::string_t, double> GetV2PageReacts::getCounts() const
 {
@@ -176,17 +283,17 @@ std::map<utility::string_t, double> GetV2PageReacts::getCounts() const
 void GetV2PageReacts::setCounts(std::map<utility::string_t, double> value)
 {
     m_Counts = value;
-    m_CountsIsSet = true;
+    m_FieldsSet.set(FieldBit_Counts);
 }
 
 bool GetV2PageReacts::countsIsSet() const
 {
-    return m_CountsIsSet;
+    return m_FieldsSet.test(FieldBit_Counts);
 }
 
 void GetV2PageReacts::unsetCounts()
 {
-    m_CountsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Counts);
 }
 std::shared_ptr<APIStatus> GetV2PageReacts::getStatus() const
 {
@@ -197,17 +304,17 @@ std::shared_ptr<APIStatus> GetV2PageReacts::getStatus() const
 void GetV2PageReacts::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetV2PageReacts::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetV2PageReacts::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
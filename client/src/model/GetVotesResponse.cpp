@@ -20,10 +20,6 @@ namespace model {
 
 GetVotesResponse::GetVotesResponse()
 {
-    m_StatusIsSet = false;
-    m_AppliedAuthorizedVotesIsSet = false;
-    m_AppliedAnonymousVotesIsSet = false;
-    m_PendingVotesIsSet = false;
 }
 
 GetVotesResponse::~GetVotesResponse()
@@ -38,22 +34,22 @@ void GetVotesResponse::validate()
 web::json::value GetVotesResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_AppliedAuthorizedVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_AppliedAuthorizedVotes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("appliedAuthorizedVotes"))] = ModelBase::toJson(m_AppliedAuthorizedVotes);
     }
-    if(m_AppliedAnonymousVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_AppliedAnonymousVotes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("appliedAnonymousVotes"))] = ModelBase::toJson(m_AppliedAnonymousVotes);
     }
-    if(m_PendingVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingVotes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pendingVotes"))] = ModelBase::toJson(m_PendingVotes);
@@ -62,54 +58,187 @@ web::json::value GetVotesResponse::toJson() const
     return val;
 }
 
+void GetVotesResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_AppliedAuthorizedVotes))
+    {
+        
+        writer.key(_XPLATSTR("appliedAuthorizedVotes"));
+        ModelBase::writeJson(writer, m_AppliedAuthorizedVotes);
+    }
+    if(m_FieldsSet.test(FieldBit_AppliedAnonymousVotes))
+    {
+        
+        writer.key(_XPLATSTR("appliedAnonymousVotes"));
+        ModelBase::writeJson(writer, m_AppliedAnonymousVotes);
+    }
+    if(m_FieldsSet.test(FieldBit_PendingVotes))
+    {
+        
+        writer.key(_XPLATSTR("pendingVotes"));
+        ModelBase::writeJson(writer, m_PendingVotes);
+    }
+
+    writer.endObject();
+}
+
 bool GetVotesResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("appliedAuthorizedVotes"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("appliedAuthorizedVotes")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<PublicVote>> refVal_setAppliedAuthorizedVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAppliedAuthorizedVotes);
-            setAppliedAuthorizedVotes(refVal_setAppliedAuthorizedVotes);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("appliedAuthorizedVotes")):
+            if(field.first == _XPLATSTR("appliedAuthorizedVotes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PublicVote>> refVal_setAppliedAuthorizedVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAppliedAuthorizedVotes);
+                    setAppliedAuthorizedVotes(refVal_setAppliedAuthorizedVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("appliedAnonymousVotes")):
+            if(field.first == _XPLATSTR("appliedAnonymousVotes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PublicVote>> refVal_setAppliedAnonymousVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAppliedAnonymousVotes);
+                    setAppliedAnonymousVotes(refVal_setAppliedAnonymousVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pendingVotes")):
+            if(field.first == _XPLATSTR("pendingVotes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PublicVote>> refVal_setPendingVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPendingVotes);
+                    setPendingVotes(refVal_setPendingVotes);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("appliedAnonymousVotes"))))
+    return ok;
+}
+
+void GetVotesResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("appliedAnonymousVotes")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<PublicVote>> refVal_setAppliedAnonymousVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAppliedAnonymousVotes);
-            setAppliedAnonymousVotes(refVal_setAppliedAnonymousVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pendingVotes"))))
+    if(m_FieldsSet.test(FieldBit_AppliedAuthorizedVotes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pendingVotes")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("appliedAuthorizedVotes")), m_AppliedAuthorizedVotes);
+    }
+    if(m_FieldsSet.test(FieldBit_AppliedAnonymousVotes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("appliedAnonymousVotes")), m_AppliedAnonymousVotes);
+    }
+    if(m_FieldsSet.test(FieldBit_PendingVotes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pendingVotes")), m_PendingVotes);
+    }
+}
+
+bool GetVotesResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<PublicVote>> refVal_setPendingVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPendingVotes);
-            setPendingVotes(refVal_setPendingVotes);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("appliedAuthorizedVotes")):
+            {
+                std::vector<std::shared_ptr<PublicVote>> refVal_setAppliedAuthorizedVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setAppliedAuthorizedVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAppliedAuthorizedVotes(refVal_setAppliedAuthorizedVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("appliedAnonymousVotes")):
+            {
+                std::vector<std::shared_ptr<PublicVote>> refVal_setAppliedAnonymousVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setAppliedAnonymousVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAppliedAnonymousVotes(refVal_setAppliedAnonymousVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pendingVotes")):
+            {
+                std::vector<std::shared_ptr<PublicVote>> refVal_setPendingVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setPendingVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPendingVotes(refVal_setPendingVotes);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GetVotesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -119,19 +248,19 @@ void GetVotesResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_AppliedAuthorizedVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_AppliedAuthorizedVotes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("appliedAuthorizedVotes")), m_AppliedAuthorizedVotes));
     }
-    if(m_AppliedAnonymousVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_AppliedAnonymousVotes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("appliedAnonymousVotes")), m_AppliedAnonymousVotes));
     }
-    if(m_PendingVotesIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingVotes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pendingVotes")), m_PendingVotes));
     }
@@ -183,17 +312,17 @@ std::shared_ptr<APIStatus> GetVotesResponse::getStatus() const
 void GetVotesResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GetVotesResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GetVotesResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<PublicVote>> GetVotesResponse::getAppliedAuthorizedVotes() const
 {
@@ -204,17 +333,17 @@ std::vector<std::shared_ptr<PublicVote>> GetVotesResponse::getAppliedAuthorizedV
 void GetVotesResponse::setAppliedAuthorizedVotes(const std::vector<std::shared_ptr<PublicVote>>& value)
 {
     m_AppliedAuthorizedVotes = value;
-    m_AppliedAuthorizedVotesIsSet = true;
+    m_FieldsSet.set(FieldBit_AppliedAuthorizedVotes);
 }
 
 bool GetVotesResponse::appliedAuthorizedVotesIsSet() const
 {
-    return m_AppliedAuthorizedVotesIsSet;
+    return m_FieldsSet.test(FieldBit_AppliedAuthorizedVotes);
 }
 
 void GetVotesResponse::unsetAppliedAuthorizedVotes()
 {
-    m_AppliedAuthorizedVotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AppliedAuthorizedVotes);
 }
 std::vector<std::shared_ptr<PublicVote>> GetVotesResponse::getAppliedAnonymousVotes() const
 {
@@ -225,17 +354,17 @@ std::vector<std::shared_ptr<PublicVote>> GetVotesResponse::getAppliedAnonymousVo
 void GetVotesResponse::setAppliedAnonymousVotes(const std::vector<std::shared_ptr<PublicVote>>& value)
 {
     m_AppliedAnonymousVotes = value;
-    m_AppliedAnonymousVotesIsSet = true;
+    m_FieldsSet.set(FieldBit_AppliedAnonymousVotes);
 }
 
 bool GetVotesResponse::appliedAnonymousVotesIsSet() const
 {
-    return m_AppliedAnonymousVotesIsSet;
+    return m_FieldsSet.test(FieldBit_AppliedAnonymousVotes);
 }
 
 void GetVotesResponse::unsetAppliedAnonymousVotes()
 {
-    m_AppliedAnonymousVotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AppliedAnonymousVotes);
 }
 std::vector<std::shared_ptr<PublicVote>> GetVotesResponse::getPendingVotes() const
 {
@@ -246,17 +375,17 @@ std::vector<std::shared_ptr<PublicVote>> GetVotesResponse::getPendingVotes() con
 void GetVotesResponse::setPendingVotes(const std::vector<std::shared_ptr<PublicVote>>& value)
 {
     m_PendingVotes = value;
-    m_PendingVotesIsSet = true;
+    m_FieldsSet.set(FieldBit_PendingVotes);
 }
 
 bool GetVotesResponse::pendingVotesIsSet() const
 {
-    return m_PendingVotesIsSet;
+    return m_FieldsSet.test(FieldBit_PendingVotes);
 }
 
 void GetVotesResponse::unsetPendingVotes()
 {
-    m_PendingVotesIsSet = false;
+    m_FieldsSet.reset(FieldBit_PendingVotes);
 }
 
 }
@@ -20,9 +20,6 @@ namespace model {
 
 GifGetLargeResponse::GifGetLargeResponse()
 {
-    m_Src = utility::conversions::to_string_t("");
-    m_SrcIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GifGetLargeResponse::~GifGetLargeResponse()
@@ -37,12 +34,12 @@ void GifGetLargeResponse::validate()
 web::json::value GifGetLargeResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_SrcIsSet)
+    if(m_FieldsSet.test(FieldBit_Src))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("src"))] = ModelBase::toJson(m_Src);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -51,32 +48,119 @@ web::json::value GifGetLargeResponse::toJson() const
     return val;
 }
 
+void GifGetLargeResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Src))
+    {
+        
+        writer.key(_XPLATSTR("src"));
+        ModelBase::writeJson(writer, m_Src);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GifGetLargeResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("src"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("src")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSrc);
-            setSrc(refVal_setSrc);
-            
+        case ModelBase::fieldHash(_XPLATSTR("src")):
+            if(field.first == _XPLATSTR("src"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSrc);
+                    setSrc(refVal_setSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GifGetLargeResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Src))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("src")), m_Src);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GifGetLargeResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("src")):
+            {
+                utility::string_t refVal_setSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSrc(refVal_setSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GifGetLargeResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void GifGetLargeResponse::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_SrcIsSet)
+    if(m_FieldsSet.test(FieldBit_Src))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("src")), m_Src));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -130,17 +214,17 @@ utility::string_t GifGetLargeResponse::getSrc() const
 void GifGetLargeResponse::setSrc(const utility::string_t& value)
 {
     m_Src = value;
-    m_SrcIsSet = true;
+    m_FieldsSet.set(FieldBit_Src);
 }
 
 bool GifGetLargeResponse::srcIsSet() const
 {
-    return m_SrcIsSet;
+    return m_FieldsSet.test(FieldBit_Src);
 }
 
 void GifGetLargeResponse::unsetSrc()
 {
-    m_SrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_Src);
 }
 std::shared_ptr<APIStatus> GifGetLargeResponse::getStatus() const
 {
@@ -151,17 +235,17 @@ std::shared_ptr<APIStatus> GifGetLargeResponse::getStatus() const
 void GifGetLargeResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GifGetLargeResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GifGetLargeResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 GifSearchResponse::GifSearchResponse()
 {
-    m_ImagesIsSet = false;
-    m_StatusIsSet = false;
 }
 
 GifSearchResponse::~GifSearchResponse()
@@ -36,12 +34,12 @@ void GifSearchResponse::validate()
 web::json::value GifSearchResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Images))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("images"))] = ModelBase::toJson(m_Images);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value GifSearchResponse::toJson() const
     return val;
 }
 
+void GifSearchResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Images))
+    {
+        
+        writer.key(_XPLATSTR("images"));
+        ModelBase::writeJson(writer, m_Images);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool GifSearchResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("images"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("images")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> refVal_setImages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setImages);
-            setImages(refVal_setImages);
-            
+        case ModelBase::fieldHash(_XPLATSTR("images")):
+            if(field.first == _XPLATSTR("images"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> refVal_setImages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setImages);
+                    setImages(refVal_setImages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void GifSearchResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Images))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("images")), m_Images);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool GifSearchResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("images")):
+            {
+                std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>> refVal_setImages;
+                if(!ModelBase::readBinary(reader, field, refVal_setImages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setImages(refVal_setImages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void GifSearchResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void GifSearchResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Images))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("images")), m_Images));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>>
 void GifSearchResponse::setImages(const std::vector<std::vector<std::shared_ptr<GifSearchResponse_images_inner_inner>>>& value)
 {
     m_Images = value;
-    m_ImagesIsSet = true;
+    m_FieldsSet.set(FieldBit_Images);
 }
 
 bool GifSearchResponse::imagesIsSet() const
 {
-    return m_ImagesIsSet;
+    return m_FieldsSet.test(FieldBit_Images);
 }
 
 void GifSearchResponse::unsetImages()
 {
-    m_ImagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Images);
 }
 std::shared_ptr<APIStatus> GifSearchResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> GifSearchResponse::getStatus() const
 void GifSearchResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool GifSearchResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void GifSearchResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -38,6 +38,13 @@ web::json::value GifSearchResponse_images_inner_inner::toJson() const
     return val;
 }
 
+void GifSearchResponse_images_inner_inner::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+
+    writer.endObject();
+}
+
 bool GifSearchResponse_images_inner_inner::fromJson(const web::json::value& val)
 {
     bool ok = true;
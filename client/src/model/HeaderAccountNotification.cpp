@@ -20,16 +20,6 @@ namespace model {
 
 HeaderAccountNotification::HeaderAccountNotification()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_Message = utility::conversions::to_string_t("");
-    m_MessageIsSet = false;
-    m_Severity = utility::conversions::to_string_t("");
-    m_SeverityIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
 }
 
 HeaderAccountNotification::~HeaderAccountNotification()
@@ -44,174 +34,445 @@ void HeaderAccountNotification::validate()
 web::json::value HeaderAccountNotification::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_MessageIsSet)
+    if(m_FieldsSet.test(FieldBit_Message))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("message"))] = ModelBase::toJson(m_Message);
     }
-    if(m_MessagesByLocale.has_value())
+    if(m_FieldsSet.test(FieldBit_MessagesByLocale))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("messagesByLocale"))] = ModelBase::toJson(m_MessagesByLocale.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("messagesByLocale"))] = ModelBase::toJson(m_MessagesByLocale);
     }
-    if(m_Dates.has_value())
+    if(m_FieldsSet.test(FieldBit_Dates))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("dates"))] = ModelBase::toJson(m_Dates.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("dates"))] = ModelBase::toJson(m_Dates);
     }
-    if(m_SeverityIsSet)
+    if(m_FieldsSet.test(FieldBit_Severity))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("severity"))] = ModelBase::toJson(m_Severity);
     }
-    if(m_LinkUrl.has_value())
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("linkUrl"))] = ModelBase::toJson(m_LinkUrl.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("linkUrl"))] = ModelBase::toJson(m_LinkUrl);
     }
-    if(m_LinkText.has_value())
+    if(m_FieldsSet.test(FieldBit_LinkText))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("linkText"))] = ModelBase::toJson(m_LinkText.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("linkText"))] = ModelBase::toJson(m_LinkText);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_Type.has_value())
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
 
     return val;
 }
 
+void HeaderAccountNotification::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Message))
+    {
+        
+        writer.key(_XPLATSTR("message"));
+        ModelBase::writeJson(writer, m_Message);
+    }
+    if(m_FieldsSet.test(FieldBit_MessagesByLocale))
+    {
+        
+        writer.key(_XPLATSTR("messagesByLocale"));
+        ModelBase::writeJson(writer, m_MessagesByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_Dates))
+    {
+        
+        writer.key(_XPLATSTR("dates"));
+        ModelBase::writeJson(writer, m_Dates);
+    }
+    if(m_FieldsSet.test(FieldBit_Severity))
+    {
+        
+        writer.key(_XPLATSTR("severity"));
+        ModelBase::writeJson(writer, m_Severity);
+    }
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
+    {
+        
+        writer.key(_XPLATSTR("linkUrl"));
+        ModelBase::writeJson(writer, m_LinkUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_LinkText))
+    {
+        
+        writer.key(_XPLATSTR("linkText"));
+        ModelBase::writeJson(writer, m_LinkText);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+
+    writer.endObject();
+}
+
 bool HeaderAccountNotification::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("message")):
+            if(field.first == _XPLATSTR("message"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setMessage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMessage);
+                    setMessage(refVal_setMessage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("messagesByLocale")):
+            if(field.first == _XPLATSTR("messagesByLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setMessagesByLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMessagesByLocale);
+                    setMessagesByLocale(refVal_setMessagesByLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("dates")):
+            if(field.first == _XPLATSTR("dates"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setDates;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDates);
+                    setDates(refVal_setDates);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("severity")):
+            if(field.first == _XPLATSTR("severity"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSeverity;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSeverity);
+                    setSeverity(refVal_setSeverity);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("linkUrl")):
+            if(field.first == _XPLATSTR("linkUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLinkUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLinkUrl);
+                    setLinkUrl(refVal_setLinkUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("linkText")):
+            if(field.first == _XPLATSTR("linkText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLinkText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLinkText);
+                    setLinkText(refVal_setLinkText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("message"))))
+    return ok;
+}
+
+void HeaderAccountNotification::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("message")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setMessage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMessage);
-            setMessage(refVal_setMessage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("messagesByLocale"))))
+    if(m_FieldsSet.test(FieldBit_Title))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("messagesByLocale")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setMessagesByLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMessagesByLocale);
-            setMessagesByLocale(refVal_setMessagesByLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("dates"))))
+    if(m_FieldsSet.test(FieldBit_Message))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("dates")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setDates;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDates);
-            setDates(refVal_setDates);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("message")), m_Message);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("severity"))))
+    if(m_FieldsSet.test(FieldBit_MessagesByLocale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("severity")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSeverity;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSeverity);
-            setSeverity(refVal_setSeverity);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("messagesByLocale")), m_MessagesByLocale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("linkUrl"))))
+    if(m_FieldsSet.test(FieldBit_Dates))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("linkUrl")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLinkUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLinkUrl);
-            setLinkUrl(refVal_setLinkUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("dates")), m_Dates);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("linkText"))))
+    if(m_FieldsSet.test(FieldBit_Severity))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("linkText")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLinkText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLinkText);
-            setLinkText(refVal_setLinkText);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("severity")), m_Severity);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("linkUrl")), m_LinkUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_LinkText))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("linkText")), m_LinkText);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
+    }
+}
+
+bool HeaderAccountNotification::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("message")):
+            {
+                utility::string_t refVal_setMessage;
+                if(!ModelBase::readBinary(reader, field, refVal_setMessage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMessage(refVal_setMessage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("messagesByLocale")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setMessagesByLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setMessagesByLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMessagesByLocale(refVal_setMessagesByLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("dates")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setDates;
+                if(!ModelBase::readBinary(reader, field, refVal_setDates))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDates(refVal_setDates);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("severity")):
+            {
+                utility::string_t refVal_setSeverity;
+                if(!ModelBase::readBinary(reader, field, refVal_setSeverity))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSeverity(refVal_setSeverity);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("linkUrl")):
+            {
+                utility::string_t refVal_setLinkUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setLinkUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLinkUrl(refVal_setLinkUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("linkText")):
+            {
+                utility::string_t refVal_setLinkText;
+                if(!ModelBase::readBinary(reader, field, refVal_setLinkText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLinkText(refVal_setLinkText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                utility::string_t refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void HeaderAccountNotification::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -221,45 +482,45 @@ void HeaderAccountNotification::toMultipart(std::shared_ptr<MultipartFormData> m
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_MessageIsSet)
+    if(m_FieldsSet.test(FieldBit_Message))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("message")), m_Message));
     }
-    if(m_MessagesByLocale.has_value())
+    if(m_FieldsSet.test(FieldBit_MessagesByLocale))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("messagesByLocale")), m_MessagesByLocale.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("messagesByLocale")), m_MessagesByLocale));
     }
-    if(m_Dates.has_value())
+    if(m_FieldsSet.test(FieldBit_Dates))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("dates")), m_Dates.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("dates")), m_Dates));
     }
-    if(m_SeverityIsSet)
+    if(m_FieldsSet.test(FieldBit_Severity))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("severity")), m_Severity));
     }
-    if(m_LinkUrl.has_value())
+    if(m_FieldsSet.test(FieldBit_LinkUrl))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("linkUrl")), m_LinkUrl.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("linkUrl")), m_LinkUrl));
     }
-    if(m_LinkText.has_value())
+    if(m_FieldsSet.test(FieldBit_LinkText))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("linkText")), m_LinkText.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("linkText")), m_LinkText));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_Type.has_value())
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
 }
 
@@ -345,17 +606,17 @@ utility::string_t HeaderAccountNotification::getId() const
 void HeaderAccountNotification::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool HeaderAccountNotification::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void HeaderAccountNotification::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t HeaderAccountNotification::getTitle() const
 {
@@ -366,17 +627,17 @@ utility::string_t HeaderAccountNotification::getTitle() const
 void HeaderAccountNotification::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool HeaderAccountNotification::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void HeaderAccountNotification::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t HeaderAccountNotification::getMessage() const
 {
@@ -387,57 +648,59 @@ utility::string_t HeaderAccountNotification::getMessage() const
 void HeaderAccountNotification::setMessage(const utility::string_t& value)
 {
     m_Message = value;
-    m_MessageIsSet = true;
+    m_FieldsSet.set(FieldBit_Message);
 }
 
 bool HeaderAccountNotification::messageIsSet() const
 {
-    return m_MessageIsSet;
+    return m_FieldsSet.test(FieldBit_Message);
 }
 
 void HeaderAccountNotification::unsetMessage()
 {
-    m_MessageIsSet = false;
+    m_FieldsSet.reset(FieldBit_Message);
 }
 std::map<utility::string_t, utility::string_t> HeaderAccountNotification::getMessagesByLocale() const
 {
-    return m_MessagesByLocale.get();
+    return m_MessagesByLocale;
 }
 
 
 void HeaderAccountNotification::setMessagesByLocale(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_MessagesByLocale = value;
+    m_FieldsSet.set(FieldBit_MessagesByLocale);
 }
 
 bool HeaderAccountNotification::messagesByLocaleIsSet() const
 {
-    return m_MessagesByLocale.has_value();
+    return m_FieldsSet.test(FieldBit_MessagesByLocale);
 }
 
 void HeaderAccountNotification::unsetMessagesByLocale()
 {
-    m_MessagesByLocale.reset();
+    m_FieldsSet.reset(FieldBit_MessagesByLocale);
 }
 std::map<utility::string_t, utility::string_t> HeaderAccountNotification::getDates() const
 {
-    return m_Dates.get();
+    return m_Dates;
 }
 
 
 void HeaderAccountNotification::setDates(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Dates = value;
+    m_FieldsSet.set(FieldBit_Dates);
 }
 
 bool HeaderAccountNotification::datesIsSet() const
 {
-    return m_Dates.has_value();
+    return m_FieldsSet.test(FieldBit_Dates);
 }
 
 void HeaderAccountNotification::unsetDates()
 {
-    m_Dates.reset();
+    m_FieldsSet.reset(FieldBit_Dates);
 }
 utility::string_t HeaderAccountNotification::getSeverity() const
 {
@@ -448,57 +711,59 @@ utility::string_t HeaderAccountNotification::getSeverity() const
 void HeaderAccountNotification::setSeverity(const utility::string_t& value)
 {
     m_Severity = value;
-    m_SeverityIsSet = true;
+    m_FieldsSet.set(FieldBit_Severity);
 }
 
 bool HeaderAccountNotification::severityIsSet() const
 {
-    return m_SeverityIsSet;
+    return m_FieldsSet.test(FieldBit_Severity);
 }
 
 void HeaderAccountNotification::unsetSeverity()
 {
-    m_SeverityIsSet = false;
+    m_FieldsSet.reset(FieldBit_Severity);
 }
 utility::string_t HeaderAccountNotification::getLinkUrl() const
 {
-    return m_LinkUrl.get();
+    return m_LinkUrl;
 }
 
 
 void HeaderAccountNotification::setLinkUrl(const utility::string_t& value)
 {
     m_LinkUrl = value;
+    m_FieldsSet.set(FieldBit_LinkUrl);
 }
 
 bool HeaderAccountNotification::linkUrlIsSet() const
 {
-    return m_LinkUrl.has_value();
+    return m_FieldsSet.test(FieldBit_LinkUrl);
 }
 
 void HeaderAccountNotification::unsetLinkUrl()
 {
-    m_LinkUrl.reset();
+    m_FieldsSet.reset(FieldBit_LinkUrl);
 }
 utility::string_t HeaderAccountNotification::getLinkText() const
 {
-    return m_LinkText.get();
+    return m_LinkText;
 }
 
 
 void HeaderAccountNotification::setLinkText(const utility::string_t& value)
 {
     m_LinkText = value;
+    m_FieldsSet.set(FieldBit_LinkText);
 }
 
 bool HeaderAccountNotification::linkTextIsSet() const
 {
-    return m_LinkText.has_value();
+    return m_FieldsSet.test(FieldBit_LinkText);
 }
 
 void HeaderAccountNotification::unsetLinkText()
 {
-    m_LinkText.reset();
+    m_FieldsSet.reset(FieldBit_LinkText);
 }
 utility::datetime HeaderAccountNotification::getCreatedAt() const
 {
@@ -509,37 +774,38 @@ utility::datetime HeaderAccountNotification::getCreatedAt() const
 void HeaderAccountNotification::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool HeaderAccountNotification::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void HeaderAccountNotification::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t HeaderAccountNotification::getType() const
 {
-    return m_Type.get();
+    return m_Type;
 }
 
 
 void HeaderAccountNotification::setType(const utility::string_t& value)
 {
     m_Type = value;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool HeaderAccountNotification::typeIsSet() const
 {
-    return m_Type.has_value();
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void HeaderAccountNotification::unsetType()
 {
-    m_Type.reset();
+    m_FieldsSet.reset(FieldBit_Type);
 }
 
 }
@@ -20,14 +20,6 @@ namespace model {
 
 HeaderState::HeaderState()
 {
-    m_StatusIsSet = false;
-    m_NotificationTypeIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_UserIdWS = utility::conversions::to_string_t("");
-    m_UserIdWSIsSet = false;
-    m_NotificationCountsIsSet = false;
-    m_AccountNotificationsIsSet = false;
 }
 
 HeaderState::~HeaderState()
@@ -42,32 +34,32 @@ void HeaderState::validate()
 web::json::value HeaderState::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_NotificationTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("NotificationType"))] = ModelBase::toJson(m_NotificationType);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userIdWS"))] = ModelBase::toJson(m_UserIdWS);
     }
-    if(m_NotificationCountsIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationCounts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationCounts"))] = ModelBase::toJson(m_NotificationCounts);
     }
-    if(m_AccountNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccountNotifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("accountNotifications"))] = ModelBase::toJson(m_AccountNotifications);
@@ -76,76 +68,255 @@ web::json::value HeaderState::toJson() const
     return val;
 }
 
+void HeaderState::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationType))
+    {
+        
+        writer.key(_XPLATSTR("NotificationType"));
+        ModelBase::writeJson(writer, m_NotificationType);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
+    {
+        
+        writer.key(_XPLATSTR("userIdWS"));
+        ModelBase::writeJson(writer, m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationCounts))
+    {
+        
+        writer.key(_XPLATSTR("notificationCounts"));
+        ModelBase::writeJson(writer, m_NotificationCounts);
+    }
+    if(m_FieldsSet.test(FieldBit_AccountNotifications))
+    {
+        
+        writer.key(_XPLATSTR("accountNotifications"));
+        ModelBase::writeJson(writer, m_AccountNotifications);
+    }
+
+    writer.endObject();
+}
+
 bool HeaderState::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("NotificationType"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("NotificationType")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<Object> refVal_setNotificationType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationType);
-            setNotificationType(refVal_setNotificationType);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("NotificationType")):
+            if(field.first == _XPLATSTR("NotificationType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setNotificationType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationType);
+                    setNotificationType(refVal_setNotificationType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            if(field.first == _XPLATSTR("userIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
+                    setUserIdWS(refVal_setUserIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationCounts")):
+            if(field.first == _XPLATSTR("notificationCounts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<NotificationAndCount>> refVal_setNotificationCounts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationCounts);
+                    setNotificationCounts(refVal_setNotificationCounts);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("accountNotifications")):
+            if(field.first == _XPLATSTR("accountNotifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<HeaderAccountNotification>> refVal_setAccountNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAccountNotifications);
+                    setAccountNotifications(refVal_setAccountNotifications);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    return ok;
+}
+
+void HeaderState::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userIdWS"))))
+    if(m_FieldsSet.test(FieldBit_NotificationType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
-            setUserIdWS(refVal_setUserIdWS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("NotificationType")), m_NotificationType);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationCounts"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationCounts")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<NotificationAndCount>> refVal_setNotificationCounts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationCounts);
-            setNotificationCounts(refVal_setNotificationCounts);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("accountNotifications"))))
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("accountNotifications")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userIdWS")), m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationCounts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationCounts")), m_NotificationCounts);
+    }
+    if(m_FieldsSet.test(FieldBit_AccountNotifications))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("accountNotifications")), m_AccountNotifications);
+    }
+}
+
+bool HeaderState::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<HeaderAccountNotification>> refVal_setAccountNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAccountNotifications);
-            setAccountNotifications(refVal_setAccountNotifications);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("NotificationType")):
+            {
+                std::shared_ptr<Object> refVal_setNotificationType;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationType(refVal_setNotificationType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            {
+                utility::string_t refVal_setUserIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserIdWS(refVal_setUserIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationCounts")):
+            {
+                std::vector<std::shared_ptr<NotificationAndCount>> refVal_setNotificationCounts;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationCounts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationCounts(refVal_setNotificationCounts);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("accountNotifications")):
+            {
+                std::vector<std::shared_ptr<HeaderAccountNotification>> refVal_setAccountNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setAccountNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAccountNotifications(refVal_setAccountNotifications);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void HeaderState::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -155,27 +326,27 @@ void HeaderState::toMultipart(std::shared_ptr<MultipartFormData> multipart, cons
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_NotificationTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("NotificationType")), m_NotificationType));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userIdWS")), m_UserIdWS));
     }
-    if(m_NotificationCountsIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationCounts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationCounts")), m_NotificationCounts));
     }
-    if(m_AccountNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccountNotifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("accountNotifications")), m_AccountNotifications));
     }
@@ -239,17 +410,17 @@ std::shared_ptr<APIStatus> HeaderState::getStatus() const
 void HeaderState::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool HeaderState::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void HeaderState::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<Object> HeaderState::getNotificationType() const
 {
@@ -260,17 +431,17 @@ std::shared_ptr<Object> HeaderState::getNotificationType() const
 void HeaderState::setNotificationType(const std::shared_ptr<Object>& value)
 {
     m_NotificationType = value;
-    m_NotificationTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationType);
 }
 
 bool HeaderState::notificationTypeIsSet() const
 {
-    return m_NotificationTypeIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationType);
 }
 
 void HeaderState::unsetNotificationType()
 {
-    m_NotificationTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationType);
 }
 utility::string_t HeaderState::getUserId() const
 {
@@ -281,17 +452,17 @@ utility::string_t HeaderState::getUserId() const
 void HeaderState::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool HeaderState::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void HeaderState::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t HeaderState::getUserIdWS() const
 {
@@ -302,17 +473,17 @@ utility::string_t HeaderState::getUserIdWS() const
 void HeaderState::setUserIdWS(const utility::string_t& value)
 {
     m_UserIdWS = value;
-    m_UserIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UserIdWS);
 }
 
 bool HeaderState::userIdWSIsSet() const
 {
-    return m_UserIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UserIdWS);
 }
 
 void HeaderState::unsetUserIdWS()
 {
-    m_UserIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserIdWS);
 }
 std::vector<std::shared_ptr<NotificationAndCount>> HeaderState::getNotificationCounts() const
 {
@@ -323,17 +494,17 @@ std::vector<std::shared_ptr<NotificationAndCount>> HeaderState::getNotificationC
 void HeaderState::setNotificationCounts(const std::vector<std::shared_ptr<NotificationAndCount>>& value)
 {
     m_NotificationCounts = value;
-    m_NotificationCountsIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationCounts);
 }
 
 bool HeaderState::notificationCountsIsSet() const
 {
-    return m_NotificationCountsIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationCounts);
 }
 
 void HeaderState::unsetNotificationCounts()
 {
-    m_NotificationCountsIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationCounts);
 }
 std::vector<std::shared_ptr<HeaderAccountNotification>> HeaderState::getAccountNotifications() const
 {
@@ -344,17 +515,17 @@ std::vector<std::shared_ptr<HeaderAccountNotification>> HeaderState::getAccountN
 void HeaderState::setAccountNotifications(const std::vector<std::shared_ptr<HeaderAccountNotification>>& value)
 {
     m_AccountNotifications = value;
-    m_AccountNotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_AccountNotifications);
 }
 
 bool HeaderState::accountNotificationsIsSet() const
 {
-    return m_AccountNotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_AccountNotifications);
 }
 
 void HeaderState::unsetAccountNotifications()
 {
-    m_AccountNotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AccountNotifications);
 }
 
 }
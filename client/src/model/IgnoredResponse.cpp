@@ -20,8 +20,6 @@ namespace model {
 
 IgnoredResponse::IgnoredResponse()
 {
-    m_StatusIsSet = false;
-    m_NoteIsSet = false;
 }
 
 IgnoredResponse::~IgnoredResponse()
@@ -36,12 +34,12 @@ void IgnoredResponse::validate()
 web::json::value IgnoredResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_NoteIsSet)
+    if(m_FieldsSet.test(FieldBit_Note))
     {
         
         utility::string_t refVal = fromNoteEnum(m_Note);
@@ -52,33 +50,123 @@ web::json::value IgnoredResponse::toJson() const
     return val;
 }
 
+void IgnoredResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Note))
+    {
+        
+        utility::string_t refVal = fromNoteEnum(m_Note);
+        writer.key(_XPLATSTR("note"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+
+    writer.endObject();
+}
+
 bool IgnoredResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("note")):
+            if(field.first == _XPLATSTR("note"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNote;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNote);
+                    setNote(toNoteEnum(refVal_setNote));
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("note"))))
+    return ok;
+}
+
+void IgnoredResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Note))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("note")));
-        if(!fieldValue.is_null())
+        
+        utility::string_t refVal = fromNoteEnum(m_Note);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("note")), refVal);
+        
+    }
+}
+
+bool IgnoredResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setNote;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNote);
-            
-            setNote(toNoteEnum(refVal_setNote));
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("note")):
+            {
+                utility::string_t refVal_setNote;
+                if(!ModelBase::readBinary(reader, field, refVal_setNote))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNote(toNoteEnum(refVal_setNote));
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void IgnoredResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -88,11 +176,11 @@ void IgnoredResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_NoteIsSet)
+    if(m_FieldsSet.test(FieldBit_Note))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("note")), fromNoteEnum(m_Note)));
     }
@@ -159,17 +247,17 @@ std::shared_ptr<APIStatus> IgnoredResponse::getStatus() const
 void IgnoredResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool IgnoredResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void IgnoredResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 IgnoredResponse::NoteEnum IgnoredResponse::getNote() const
 {
@@ -180,17 +268,17 @@ IgnoredResponse::NoteEnum IgnoredResponse::getNote() const
 void IgnoredResponse::setNote(const NoteEnum value)
 {
     m_Note = value;
-    m_NoteIsSet = true;
+    m_FieldsSet.set(FieldBit_Note);
 }
 
 bool IgnoredResponse::noteIsSet() const
 {
-    return m_NoteIsSet;
+    return m_FieldsSet.test(FieldBit_Note);
 }
 
 void IgnoredResponse::unsetNote()
 {
-    m_NoteIsSet = false;
+    m_FieldsSet.reset(FieldBit_Note);
 }
 
 }
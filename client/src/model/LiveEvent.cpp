@@ -20,29 +20,10 @@ namespace model {
 
 LiveEvent::LiveEvent()
 {
-    m_TypeIsSet = false;
     m_Timestamp = 0L;
-    m_TimestampIsSet = false;
     m_Ts = 0L;
-    m_TsIsSet = false;
-    m_BroadcastId = utility::conversions::to_string_t("");
-    m_BroadcastIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_BadgesIsSet = false;
-    m_NotificationIsSet = false;
-    m_VoteIsSet = false;
-    m_CommentIsSet = false;
-    m_FeedPostIsSet = false;
-    m_ExtraInfoIsSet = false;
-    m_ConfigIsSet = false;
     m_IsClosed = false;
-    m_IsClosedIsSet = false;
-    m_UjIsSet = false;
-    m_UlIsSet = false;
     m_Sc = 0;
-    m_ScIsSet = false;
-    m_ChangesIsSet = false;
 }
 
 LiveEvent::~LiveEvent()
@@ -57,87 +38,87 @@ void LiveEvent::validate()
 web::json::value LiveEvent::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_TimestampIsSet)
+    if(m_FieldsSet.test(FieldBit_Timestamp))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("timestamp"))] = ModelBase::toJson(m_Timestamp);
     }
-    if(m_TsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ts"))] = ModelBase::toJson(m_Ts);
     }
-    if(m_BroadcastIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BroadcastId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("broadcastId"))] = ModelBase::toJson(m_BroadcastId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_NotificationIsSet)
+    if(m_FieldsSet.test(FieldBit_Notification))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notification"))] = ModelBase::toJson(m_Notification);
     }
-    if(m_VoteIsSet)
+    if(m_FieldsSet.test(FieldBit_Vote))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("vote"))] = ModelBase::toJson(m_Vote);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_FeedPostIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPost))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedPost"))] = ModelBase::toJson(m_FeedPost);
     }
-    if(m_ExtraInfoIsSet)
+    if(m_FieldsSet.test(FieldBit_ExtraInfo))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("extraInfo"))] = ModelBase::toJson(m_ExtraInfo);
     }
-    if(m_ConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_Config))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("config"))] = ModelBase::toJson(m_Config);
     }
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isClosed"))] = ModelBase::toJson(m_IsClosed);
     }
-    if(m_UjIsSet)
+    if(m_FieldsSet.test(FieldBit_Uj))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("uj"))] = ModelBase::toJson(m_Uj);
     }
-    if(m_UlIsSet)
+    if(m_FieldsSet.test(FieldBit_Ul))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ul"))] = ModelBase::toJson(m_Ul);
     }
-    if(m_ScIsSet)
+    if(m_FieldsSet.test(FieldBit_Sc))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sc"))] = ModelBase::toJson(m_Sc);
     }
-    if(m_ChangesIsSet)
+    if(m_FieldsSet.test(FieldBit_Changes))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("changes"))] = ModelBase::toJson(m_Changes);
@@ -146,197 +127,629 @@ web::json::value LiveEvent::toJson() const
     return val;
 }
 
+void LiveEvent::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Timestamp))
+    {
+        
+        writer.key(_XPLATSTR("timestamp"));
+        ModelBase::writeJson(writer, m_Timestamp);
+    }
+    if(m_FieldsSet.test(FieldBit_Ts))
+    {
+        
+        writer.key(_XPLATSTR("ts"));
+        ModelBase::writeJson(writer, m_Ts);
+    }
+    if(m_FieldsSet.test(FieldBit_BroadcastId))
+    {
+        
+        writer.key(_XPLATSTR("broadcastId"));
+        ModelBase::writeJson(writer, m_BroadcastId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Notification))
+    {
+        
+        writer.key(_XPLATSTR("notification"));
+        ModelBase::writeJson(writer, m_Notification);
+    }
+    if(m_FieldsSet.test(FieldBit_Vote))
+    {
+        
+        writer.key(_XPLATSTR("vote"));
+        ModelBase::writeJson(writer, m_Vote);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPost))
+    {
+        
+        writer.key(_XPLATSTR("feedPost"));
+        ModelBase::writeJson(writer, m_FeedPost);
+    }
+    if(m_FieldsSet.test(FieldBit_ExtraInfo))
+    {
+        
+        writer.key(_XPLATSTR("extraInfo"));
+        ModelBase::writeJson(writer, m_ExtraInfo);
+    }
+    if(m_FieldsSet.test(FieldBit_Config))
+    {
+        
+        writer.key(_XPLATSTR("config"));
+        ModelBase::writeJson(writer, m_Config);
+    }
+    if(m_FieldsSet.test(FieldBit_IsClosed))
+    {
+        
+        writer.key(_XPLATSTR("isClosed"));
+        ModelBase::writeJson(writer, m_IsClosed);
+    }
+    if(m_FieldsSet.test(FieldBit_Uj))
+    {
+        
+        writer.key(_XPLATSTR("uj"));
+        ModelBase::writeJson(writer, m_Uj);
+    }
+    if(m_FieldsSet.test(FieldBit_Ul))
+    {
+        
+        writer.key(_XPLATSTR("ul"));
+        ModelBase::writeJson(writer, m_Ul);
+    }
+    if(m_FieldsSet.test(FieldBit_Sc))
+    {
+        
+        writer.key(_XPLATSTR("sc"));
+        ModelBase::writeJson(writer, m_Sc);
+    }
+    if(m_FieldsSet.test(FieldBit_Changes))
+    {
+        
+        writer.key(_XPLATSTR("changes"));
+        ModelBase::writeJson(writer, m_Changes);
+    }
+
+    writer.endObject();
+}
+
 bool LiveEvent::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<LiveEventType> refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("timestamp"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("timestamp")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int64_t refVal_setTimestamp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTimestamp);
-            setTimestamp(refVal_setTimestamp);
-            
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<LiveEventType> refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("timestamp")):
+            if(field.first == _XPLATSTR("timestamp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setTimestamp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTimestamp);
+                    setTimestamp(refVal_setTimestamp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ts")):
+            if(field.first == _XPLATSTR("ts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setTs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTs);
+                    setTs(refVal_setTs);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("broadcastId")):
+            if(field.first == _XPLATSTR("broadcastId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBroadcastId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBroadcastId);
+                    setBroadcastId(refVal_setBroadcastId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notification")):
+            if(field.first == _XPLATSTR("notification"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserNotification> refVal_setNotification;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotification);
+                    setNotification(refVal_setNotification);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("vote")):
+            if(field.first == _XPLATSTR("vote"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<PubSubVote> refVal_setVote;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVote);
+                    setVote(refVal_setVote);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<PubSubComment> refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedPost")):
+            if(field.first == _XPLATSTR("feedPost"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<FeedPost> refVal_setFeedPost;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPost);
+                    setFeedPost(refVal_setFeedPost);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("extraInfo")):
+            if(field.first == _XPLATSTR("extraInfo"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<LiveEvent_extraInfo> refVal_setExtraInfo;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExtraInfo);
+                    setExtraInfo(refVal_setExtraInfo);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("config")):
+            if(field.first == _XPLATSTR("config"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setConfig;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConfig);
+                    setConfig(refVal_setConfig);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            if(field.first == _XPLATSTR("isClosed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsClosed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
+                    setIsClosed(refVal_setIsClosed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("uj")):
+            if(field.first == _XPLATSTR("uj"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setUj;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUj);
+                    setUj(refVal_setUj);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ul")):
+            if(field.first == _XPLATSTR("ul"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setUl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUl);
+                    setUl(refVal_setUl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sc")):
+            if(field.first == _XPLATSTR("sc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setSc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSc);
+                    setSc(refVal_setSc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("changes")):
+            if(field.first == _XPLATSTR("changes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, int32_t> refVal_setChanges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setChanges);
+                    setChanges(refVal_setChanges);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ts"))))
+    return ok;
+}
+
+void LiveEvent::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ts")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setTs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTs);
-            setTs(refVal_setTs);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("broadcastId"))))
+    if(m_FieldsSet.test(FieldBit_Timestamp))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("broadcastId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBroadcastId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBroadcastId);
-            setBroadcastId(refVal_setBroadcastId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("timestamp")), m_Timestamp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_Ts))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ts")), m_Ts);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(m_FieldsSet.test(FieldBit_BroadcastId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("broadcastId")), m_BroadcastId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notification"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notification")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<UserNotification> refVal_setNotification;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotification);
-            setNotification(refVal_setNotification);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("vote"))))
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("vote")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<PubSubVote> refVal_setVote;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVote);
-            setVote(refVal_setVote);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(m_FieldsSet.test(FieldBit_Notification))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<PubSubComment> refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notification")), m_Notification);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedPost"))))
+    if(m_FieldsSet.test(FieldBit_Vote))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedPost")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<FeedPost> refVal_setFeedPost;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPost);
-            setFeedPost(refVal_setFeedPost);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("vote")), m_Vote);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("extraInfo"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("extraInfo")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<LiveEvent_extraInfo> refVal_setExtraInfo;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExtraInfo);
-            setExtraInfo(refVal_setExtraInfo);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("config"))))
+    if(m_FieldsSet.test(FieldBit_FeedPost))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("config")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<Object> refVal_setConfig;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConfig);
-            setConfig(refVal_setConfig);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedPost")), m_FeedPost);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isClosed"))))
+    if(m_FieldsSet.test(FieldBit_ExtraInfo))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isClosed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsClosed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
-            setIsClosed(refVal_setIsClosed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("extraInfo")), m_ExtraInfo);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("uj"))))
+    if(m_FieldsSet.test(FieldBit_Config))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("uj")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setUj;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUj);
-            setUj(refVal_setUj);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("config")), m_Config);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ul"))))
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ul")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setUl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUl);
-            setUl(refVal_setUl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isClosed")), m_IsClosed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sc"))))
+    if(m_FieldsSet.test(FieldBit_Uj))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sc")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setSc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSc);
-            setSc(refVal_setSc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("uj")), m_Uj);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("changes"))))
+    if(m_FieldsSet.test(FieldBit_Ul))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("changes")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ul")), m_Ul);
+    }
+    if(m_FieldsSet.test(FieldBit_Sc))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sc")), m_Sc);
+    }
+    if(m_FieldsSet.test(FieldBit_Changes))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("changes")), m_Changes);
+    }
+}
+
+bool LiveEvent::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, int32_t> refVal_setChanges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setChanges);
-            setChanges(refVal_setChanges);
-            
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                std::shared_ptr<LiveEventType> refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("timestamp")):
+            {
+                int64_t refVal_setTimestamp;
+                if(!ModelBase::readBinary(reader, field, refVal_setTimestamp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTimestamp(refVal_setTimestamp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ts")):
+            {
+                int64_t refVal_setTs;
+                if(!ModelBase::readBinary(reader, field, refVal_setTs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTs(refVal_setTs);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("broadcastId")):
+            {
+                utility::string_t refVal_setBroadcastId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBroadcastId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBroadcastId(refVal_setBroadcastId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notification")):
+            {
+                std::shared_ptr<UserNotification> refVal_setNotification;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotification))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotification(refVal_setNotification);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("vote")):
+            {
+                std::shared_ptr<PubSubVote> refVal_setVote;
+                if(!ModelBase::readBinary(reader, field, refVal_setVote))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVote(refVal_setVote);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                std::shared_ptr<PubSubComment> refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedPost")):
+            {
+                std::shared_ptr<FeedPost> refVal_setFeedPost;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedPost))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedPost(refVal_setFeedPost);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("extraInfo")):
+            {
+                std::shared_ptr<LiveEvent_extraInfo> refVal_setExtraInfo;
+                if(!ModelBase::readBinary(reader, field, refVal_setExtraInfo))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExtraInfo(refVal_setExtraInfo);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("config")):
+            {
+                std::shared_ptr<Object> refVal_setConfig;
+                if(!ModelBase::readBinary(reader, field, refVal_setConfig))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConfig(refVal_setConfig);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            {
+                bool refVal_setIsClosed;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsClosed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsClosed(refVal_setIsClosed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("uj")):
+            {
+                std::vector<utility::string_t> refVal_setUj;
+                if(!ModelBase::readBinary(reader, field, refVal_setUj))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUj(refVal_setUj);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ul")):
+            {
+                std::vector<utility::string_t> refVal_setUl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUl(refVal_setUl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sc")):
+            {
+                int32_t refVal_setSc;
+                if(!ModelBase::readBinary(reader, field, refVal_setSc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSc(refVal_setSc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("changes")):
+            {
+                std::map<utility::string_t, int32_t> refVal_setChanges;
+                if(!ModelBase::readBinary(reader, field, refVal_setChanges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setChanges(refVal_setChanges);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void LiveEvent::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -346,71 +759,71 @@ void LiveEvent::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_TimestampIsSet)
+    if(m_FieldsSet.test(FieldBit_Timestamp))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("timestamp")), m_Timestamp));
     }
-    if(m_TsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ts")), m_Ts));
     }
-    if(m_BroadcastIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BroadcastId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("broadcastId")), m_BroadcastId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_NotificationIsSet)
+    if(m_FieldsSet.test(FieldBit_Notification))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notification")), m_Notification));
     }
-    if(m_VoteIsSet)
+    if(m_FieldsSet.test(FieldBit_Vote))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("vote")), m_Vote));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_FeedPostIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPost))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedPost")), m_FeedPost));
     }
-    if(m_ExtraInfoIsSet)
+    if(m_FieldsSet.test(FieldBit_ExtraInfo))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("extraInfo")), m_ExtraInfo));
     }
-    if(m_ConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_Config))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("config")), m_Config));
     }
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isClosed")), m_IsClosed));
     }
-    if(m_UjIsSet)
+    if(m_FieldsSet.test(FieldBit_Uj))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("uj")), m_Uj));
     }
-    if(m_UlIsSet)
+    if(m_FieldsSet.test(FieldBit_Ul))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ul")), m_Ul));
     }
-    if(m_ScIsSet)
+    if(m_FieldsSet.test(FieldBit_Sc))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sc")), m_Sc));
     }
-    if(m_ChangesIsSet)
+    if(m_FieldsSet.test(FieldBit_Changes))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("changes")), m_Changes));
     }
@@ -540,17 +953,17 @@ std::shared_ptr<LiveEventType> LiveEvent::getType() const
 void LiveEvent::setType(const std::shared_ptr<LiveEventType>& value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool LiveEvent::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void LiveEvent::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 int64_t LiveEvent::getTimestamp() const
 {
@@ -560,17 +973,17 @@ int64_t LiveEvent::getTimestamp() const
 void LiveEvent::setTimestamp(int64_t value)
 {
     m_Timestamp = value;
-    m_TimestampIsSet = true;
+    m_FieldsSet.set(FieldBit_Timestamp);
 }
 
 bool LiveEvent::timestampIsSet() const
 {
-    return m_TimestampIsSet;
+    return m_FieldsSet.test(FieldBit_Timestamp);
 }
 
 void LiveEvent::unsetTimestamp()
 {
-    m_TimestampIsSet = false;
+    m_FieldsSet.reset(FieldBit_Timestamp);
 }
 int64_t LiveEvent::getTs() const
 {
@@ -580,17 +993,17 @@ int64_t LiveEvent::getTs() const
 void LiveEvent::setTs(int64_t value)
 {
     m_Ts = value;
-    m_TsIsSet = true;
+    m_FieldsSet.set(FieldBit_Ts);
 }
 
 bool LiveEvent::tsIsSet() const
 {
-    return m_TsIsSet;
+    return m_FieldsSet.test(FieldBit_Ts);
 }
 
 void LiveEvent::unsetTs()
 {
-    m_TsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ts);
 }
 utility::string_t LiveEvent::getBroadcastId() const
 {
@@ -601,17 +1014,17 @@ utility::string_t LiveEvent::getBroadcastId() const
 void LiveEvent::setBroadcastId(const utility::string_t& value)
 {
     m_BroadcastId = value;
-    m_BroadcastIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BroadcastId);
 }
 
 bool LiveEvent::broadcastIdIsSet() const
 {
-    return m_BroadcastIdIsSet;
+    return m_FieldsSet.test(FieldBit_BroadcastId);
 }
 
 void LiveEvent::unsetBroadcastId()
 {
-    m_BroadcastIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BroadcastId);
 }
 utility::string_t LiveEvent::getUserId() const
 {
@@ -622,17 +1035,17 @@ utility::string_t LiveEvent::getUserId() const
 void LiveEvent::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool LiveEvent::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void LiveEvent::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> LiveEvent::getBadges() const
 {
@@ -643,17 +1056,17 @@ std::vector<std::shared_ptr<CommentUserBadgeInfo>> LiveEvent::getBadges() const
 void LiveEvent::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
-    m_BadgesIsSet = true;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool LiveEvent::badgesIsSet() const
 {
-    return m_BadgesIsSet;
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void LiveEvent::unsetBadges()
 {
-    m_BadgesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 std::shared_ptr<UserNotification> LiveEvent::getNotification() const
 {
@@ -664,17 +1077,17 @@ std::shared_ptr<UserNotification> LiveEvent::getNotification() const
 void LiveEvent::setNotification(const std::shared_ptr<UserNotification>& value)
 {
     m_Notification = value;
-    m_NotificationIsSet = true;
+    m_FieldsSet.set(FieldBit_Notification);
 }
 
 bool LiveEvent::notificationIsSet() const
 {
-    return m_NotificationIsSet;
+    return m_FieldsSet.test(FieldBit_Notification);
 }
 
 void LiveEvent::unsetNotification()
 {
-    m_NotificationIsSet = false;
+    m_FieldsSet.reset(FieldBit_Notification);
 }
 std::shared_ptr<PubSubVote> LiveEvent::getVote() const
 {
@@ -685,17 +1098,17 @@ std::shared_ptr<PubSubVote> LiveEvent::getVote() const
 void LiveEvent::setVote(const std::shared_ptr<PubSubVote>& value)
 {
     m_Vote = value;
-    m_VoteIsSet = true;
+    m_FieldsSet.set(FieldBit_Vote);
 }
 
 bool LiveEvent::voteIsSet() const
 {
-    return m_VoteIsSet;
+    return m_FieldsSet.test(FieldBit_Vote);
 }
 
 void LiveEvent::unsetVote()
 {
-    m_VoteIsSet = false;
+    m_FieldsSet.reset(FieldBit_Vote);
 }
 std::shared_ptr<PubSubComment> LiveEvent::getComment() const
 {
@@ -706,17 +1119,17 @@ std::shared_ptr<PubSubComment> LiveEvent::getComment() const
 void LiveEvent::setComment(const std::shared_ptr<PubSubComment>& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool LiveEvent::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void LiveEvent::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 std::shared_ptr<FeedPost> LiveEvent::getFeedPost() const
 {
@@ -727,17 +1140,17 @@ std::shared_ptr<FeedPost> LiveEvent::getFeedPost() const
 void LiveEvent::setFeedPost(const std::shared_ptr<FeedPost>& value)
 {
     m_FeedPost = value;
-    m_FeedPostIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedPost);
 }
 
 bool LiveEvent::feedPostIsSet() const
 {
-    return m_FeedPostIsSet;
+    return m_FieldsSet.test(FieldBit_FeedPost);
 }
 
 void LiveEvent::unsetFeedPost()
 {
-    m_FeedPostIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedPost);
 }
 std::shared_ptr<LiveEvent_extraInfo> LiveEvent::getExtraInfo() const
 {
@@ -748,17 +1161,17 @@ std::shared_ptr<LiveEvent_extraInfo> LiveEvent::getExtraInfo() const
 void LiveEvent::setExtraInfo(const std::shared_ptr<LiveEvent_extraInfo>& value)
 {
     m_ExtraInfo = value;
-    m_ExtraInfoIsSet = true;
+    m_FieldsSet.set(FieldBit_ExtraInfo);
 }
 
 bool LiveEvent::extraInfoIsSet() const
 {
-    return m_ExtraInfoIsSet;
+    return m_FieldsSet.test(FieldBit_ExtraInfo);
 }
 
 void LiveEvent::unsetExtraInfo()
 {
-    m_ExtraInfoIsSet = false;
+    m_FieldsSet.reset(FieldBit_ExtraInfo);
 }
 std::shared_ptr<Object> LiveEvent::getConfig() const
 {
@@ -769,17 +1182,17 @@ std::shared_ptr<Object> LiveEvent::getConfig() const
 void LiveEvent::setConfig(const std::shared_ptr<Object>& value)
 {
     m_Config = value;
-    m_ConfigIsSet = true;
+    m_FieldsSet.set(FieldBit_Config);
 }
 
 bool LiveEvent::configIsSet() const
 {
-    return m_ConfigIsSet;
+    return m_FieldsSet.test(FieldBit_Config);
 }
 
 void LiveEvent::unsetConfig()
 {
-    m_ConfigIsSet = false;
+    m_FieldsSet.reset(FieldBit_Config);
 }
 bool LiveEvent::isIsClosed() const
 {
@@ -789,17 +1202,17 @@ bool LiveEvent::isIsClosed() const
 void LiveEvent::setIsClosed(bool value)
 {
     m_IsClosed = value;
-    m_IsClosedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsClosed);
 }
 
 bool LiveEvent::isClosedIsSet() const
 {
-    return m_IsClosedIsSet;
+    return m_FieldsSet.test(FieldBit_IsClosed);
 }
 
 void LiveEvent::unsetIsClosed()
 {
-    m_IsClosedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsClosed);
 }
 std::vector<utility::string_t> LiveEvent::getUj() const
 {
@@ -810,17 +1223,17 @@ std::vector<utility::string_t> LiveEvent::getUj() const
 void LiveEvent::setUj(const std::vector<utility::string_t>& value)
 {
     m_Uj = value;
-    m_UjIsSet = true;
+    m_FieldsSet.set(FieldBit_Uj);
 }
 
 bool LiveEvent::ujIsSet() const
 {
-    return m_UjIsSet;
+    return m_FieldsSet.test(FieldBit_Uj);
 }
 
 void LiveEvent::unsetUj()
 {
-    m_UjIsSet = false;
+    m_FieldsSet.reset(FieldBit_Uj);
 }
 std::vector<utility::string_t> LiveEvent::getUl() const
 {
@@ -831,17 +1244,17 @@ std::vector<utility::string_t> LiveEvent::getUl() const
 void LiveEvent::setUl(const std::vector<utility::string_t>& value)
 {
     m_Ul = value;
-    m_UlIsSet = true;
+    m_FieldsSet.set(FieldBit_Ul);
 }
 
 bool LiveEvent::ulIsSet() const
 {
-    return m_UlIsSet;
+    return m_FieldsSet.test(FieldBit_Ul);
 }
 
 void LiveEvent::unsetUl()
 {
-    m_UlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ul);
 }
 int32_t LiveEvent::getSc() const
 {
@@ -851,17 +1264,17 @@ int32_t LiveEvent::getSc() const
 void LiveEvent::setSc(int32_t value)
 {
     m_Sc = value;
-    m_ScIsSet = true;
+    m_FieldsSet.set(FieldBit_Sc);
 }
 
 bool LiveEvent::scIsSet() const
 {
-    return m_ScIsSet;
+    return m_FieldsSet.test(FieldBit_Sc);
 }
 
 void LiveEvent::unsetSc()
 {
-    m_ScIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sc);
 }
 std::map<utility::string_t, int32_t> LiveEvent::getChanges() const
 {
@@ -871,17 +1284,17 @@ std::map<utility::string_t, int32_t> LiveEvent::getChanges() const
 void LiveEvent::setChanges(std::map<utility::string_t, int32_t> value)
 {
     m_Changes = value;
-    m_ChangesIsSet = true;
+    m_FieldsSet.set(FieldBit_Changes);
 }
 
 bool LiveEvent::changesIsSet() const
 {
-    return m_ChangesIsSet;
+    return m_FieldsSet.test(FieldBit_Changes);
 }
 
 void LiveEvent::unsetChanges()
 {
-    m_ChangesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Changes);
 }
 
 }
@@ -20,7 +20,6 @@ namespace model {
 
 LiveEvent_extraInfo::LiveEvent_extraInfo()
 {
-    m_CommentPositionsIsSet = false;
 }
 
 LiveEvent_extraInfo::~LiveEvent_extraInfo()
@@ -35,7 +34,7 @@ void LiveEvent_extraInfo::validate()
 web::json::value LiveEvent_extraInfo::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentPositionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentPositions"))] = ModelBase::toJson(m_CommentPositions);
@@ -44,23 +43,87 @@ web::json::value LiveEvent_extraInfo::toJson() const
     return val;
 }
 
+void LiveEvent_extraInfo::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
+    {
+        
+        writer.key(_XPLATSTR("commentPositions"));
+        ModelBase::writeJson(writer, m_CommentPositions);
+    }
+
+    writer.endObject();
+}
+
 bool LiveEvent_extraInfo::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentPositions"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentPositions")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> refVal_setCommentPositions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentPositions);
-            setCommentPositions(refVal_setCommentPositions);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commentPositions")):
+            if(field.first == _XPLATSTR("commentPositions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> refVal_setCommentPositions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentPositions);
+                    setCommentPositions(refVal_setCommentPositions);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void LiveEvent_extraInfo::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentPositions")), m_CommentPositions);
+    }
+}
+
+bool LiveEvent_extraInfo::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("commentPositions")):
+            {
+                std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>> refVal_setCommentPositions;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentPositions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentPositions(refVal_setCommentPositions);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void LiveEvent_extraInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void LiveEvent_extraInfo::toMultipart(std::shared_ptr<MultipartFormData> multipa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentPositionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentPositions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentPositions")), m_CommentPositions));
     }
@@ -102,17 +165,17 @@ std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null
 void LiveEvent_extraInfo::setCommentPositions(const std::map<utility::string_t, std::shared_ptr<Record_string__before_string_or_null__after_string_or_null___value>>& value)
 {
     m_CommentPositions = value;
-    m_CommentPositionsIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentPositions);
 }
 
 bool LiveEvent_extraInfo::commentPositionsIsSet() const
 {
-    return m_CommentPositionsIsSet;
+    return m_FieldsSet.test(FieldBit_CommentPositions);
 }
 
 void LiveEvent_extraInfo::unsetCommentPositions()
 {
-    m_CommentPositionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentPositions);
 }
 
 }
@@ -21,11 +21,7 @@ namespace model {
 MediaAsset::MediaAsset()
 {
     m_w = 0;
-    m_wIsSet = false;
     m_h = 0;
-    m_hIsSet = false;
-    m_Src = utility::conversions::to_string_t("");
-    m_SrcIsSet = false;
 }
 
 MediaAsset::~MediaAsset()
@@ -40,17 +36,17 @@ void MediaAsset::validate()
 web::json::value MediaAsset::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_wIsSet)
+    if(m_FieldsSet.test(FieldBit_w))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("w"))] = ModelBase::toJson(m_w);
     }
-    if(m_hIsSet)
+    if(m_FieldsSet.test(FieldBit_h))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("h"))] = ModelBase::toJson(m_h);
     }
-    if(m_SrcIsSet)
+    if(m_FieldsSet.test(FieldBit_Src))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("src"))] = ModelBase::toJson(m_Src);
@@ -59,43 +55,153 @@ web::json::value MediaAsset::toJson() const
     return val;
 }
 
+void MediaAsset::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_w))
+    {
+        
+        writer.key(_XPLATSTR("w"));
+        ModelBase::writeJson(writer, m_w);
+    }
+    if(m_FieldsSet.test(FieldBit_h))
+    {
+        
+        writer.key(_XPLATSTR("h"));
+        ModelBase::writeJson(writer, m_h);
+    }
+    if(m_FieldsSet.test(FieldBit_Src))
+    {
+        
+        writer.key(_XPLATSTR("src"));
+        ModelBase::writeJson(writer, m_Src);
+    }
+
+    writer.endObject();
+}
+
 bool MediaAsset::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("w"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("w")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setW;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setW);
-            setW(refVal_setW);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("h"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("h")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int32_t refVal_setH;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setH);
-            setH(refVal_setH);
-            
+        case ModelBase::fieldHash(_XPLATSTR("w")):
+            if(field.first == _XPLATSTR("w"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setW;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setW);
+                    setW(refVal_setW);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("h")):
+            if(field.first == _XPLATSTR("h"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setH;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setH);
+                    setH(refVal_setH);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("src")):
+            if(field.first == _XPLATSTR("src"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSrc);
+                    setSrc(refVal_setSrc);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("src"))))
+    return ok;
+}
+
+void MediaAsset::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_w))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("w")), m_w);
+    }
+    if(m_FieldsSet.test(FieldBit_h))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("h")), m_h);
+    }
+    if(m_FieldsSet.test(FieldBit_Src))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("src")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("src")), m_Src);
+    }
+}
+
+bool MediaAsset::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSrc);
-            setSrc(refVal_setSrc);
-            
+        case ModelBase::fieldHash(_XPLATSTR("w")):
+            {
+                int32_t refVal_setW;
+                if(!ModelBase::readBinary(reader, field, refVal_setW))
+                {
+                    ok = false;
+                    continue;
+                }
+                setW(refVal_setW);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("h")):
+            {
+                int32_t refVal_setH;
+                if(!ModelBase::readBinary(reader, field, refVal_setH))
+                {
+                    ok = false;
+                    continue;
+                }
+                setH(refVal_setH);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("src")):
+            {
+                utility::string_t refVal_setSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSrc(refVal_setSrc);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void MediaAsset::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -105,15 +211,15 @@ void MediaAsset::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_wIsSet)
+    if(m_FieldsSet.test(FieldBit_w))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("w")), m_w));
     }
-    if(m_hIsSet)
+    if(m_FieldsSet.test(FieldBit_h))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("h")), m_h));
     }
-    if(m_SrcIsSet)
+    if(m_FieldsSet.test(FieldBit_Src))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("src")), m_Src));
     }
@@ -158,17 +264,17 @@ int32_t MediaAsset::getW() const
 void MediaAsset::setW(int32_t value)
 {
     m_w = value;
-    m_wIsSet = true;
+    m_FieldsSet.set(FieldBit_w);
 }
 
 bool MediaAsset::WIsSet() const
 {
-    return m_wIsSet;
+    return m_FieldsSet.test(FieldBit_w);
 }
 
 void MediaAsset::unsetw()
 {
-    m_wIsSet = false;
+    m_FieldsSet.reset(FieldBit_w);
 }
 int32_t MediaAsset::getH() const
 {
@@ -178,17 +284,17 @@ int32_t MediaAsset::getH() const
 void MediaAsset::setH(int32_t value)
 {
     m_h = value;
-    m_hIsSet = true;
+    m_FieldsSet.set(FieldBit_h);
 }
 
 bool MediaAsset::HIsSet() const
 {
-    return m_hIsSet;
+    return m_FieldsSet.test(FieldBit_h);
 }
 
 void MediaAsset::unseth()
 {
-    m_hIsSet = false;
+    m_FieldsSet.reset(FieldBit_h);
 }
 utility::string_t MediaAsset::getSrc() const
 {
@@ -199,17 +305,17 @@ utility::string_t MediaAsset::getSrc() const
 void MediaAsset::setSrc(const utility::string_t& value)
 {
     m_Src = value;
-    m_SrcIsSet = true;
+    m_FieldsSet.set(FieldBit_Src);
 }
 
 bool MediaAsset::srcIsSet() const
 {
-    return m_SrcIsSet;
+    return m_FieldsSet.test(FieldBit_Src);
 }
 
 void MediaAsset::unsetSrc()
 {
-    m_SrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_Src);
 }
 
 }
@@ -20,9 +20,6 @@ namespace model {
 
 MetaItem::MetaItem()
 {
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_ValuesIsSet = false;
 }
 
 MetaItem::~MetaItem()
@@ -37,12 +34,12 @@ void MetaItem::validate()
 web::json::value MetaItem::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_ValuesIsSet)
+    if(m_FieldsSet.test(FieldBit_Values))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("values"))] = ModelBase::toJson(m_Values);
@@ -51,32 +48,119 @@ web::json::value MetaItem::toJson() const
     return val;
 }
 
+void MetaItem::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Values))
+    {
+        
+        writer.key(_XPLATSTR("values"));
+        ModelBase::writeJson(writer, m_Values);
+    }
+
+    writer.endObject();
+}
+
 bool MetaItem::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("values")):
+            if(field.first == _XPLATSTR("values"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setValues;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setValues);
+                    setValues(refVal_setValues);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("values"))))
+    return ok;
+}
+
+void MetaItem::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("values")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Values))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("values")), m_Values);
+    }
+}
+
+bool MetaItem::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<utility::string_t> refVal_setValues;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setValues);
-            setValues(refVal_setValues);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("values")):
+            {
+                std::vector<utility::string_t> refVal_setValues;
+                if(!ModelBase::readBinary(reader, field, refVal_setValues))
+                {
+                    ok = false;
+                    continue;
+                }
+                setValues(refVal_setValues);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void MetaItem::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void MetaItem::toMultipart(std::shared_ptr<MultipartFormData> multipart, const u
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_ValuesIsSet)
+    if(m_FieldsSet.test(FieldBit_Values))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("values")), m_Values));
     }
@@ -130,17 +214,17 @@ utility::string_t MetaItem::getName() const
 void MetaItem::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool MetaItem::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void MetaItem::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 std::vector<utility::string_t> MetaItem::getValues() const
 {
@@ -151,17 +235,17 @@ std::vector<utility::string_t> MetaItem::getValues() const
 void MetaItem::setValues(const std::vector<utility::string_t>& value)
 {
     m_Values = value;
-    m_ValuesIsSet = true;
+    m_FieldsSet.set(FieldBit_Values);
 }
 
 bool MetaItem::valuesIsSet() const
 {
-    return m_ValuesIsSet;
+    return m_FieldsSet.test(FieldBit_Values);
 }
 
 void MetaItem::unsetValues()
 {
-    m_ValuesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Values);
 }
 
 }
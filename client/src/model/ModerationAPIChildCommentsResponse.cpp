@@ -20,8 +20,6 @@ namespace model {
 
 ModerationAPIChildCommentsResponse::ModerationAPIChildCommentsResponse()
 {
-    m_CommentsIsSet = false;
-    m_StatusIsSet = false;
 }
 
 ModerationAPIChildCommentsResponse::~ModerationAPIChildCommentsResponse()
@@ -36,12 +34,12 @@ void ModerationAPIChildCommentsResponse::validate()
 web::json::value ModerationAPIChildCommentsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comments"))] = ModelBase::toJson(m_Comments);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value ModerationAPIChildCommentsResponse::toJson() const
     return val;
 }
 
+void ModerationAPIChildCommentsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Comments))
+    {
+        
+        writer.key(_XPLATSTR("comments"));
+        ModelBase::writeJson(writer, m_Comments);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationAPIChildCommentsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comments"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comments")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<ModerationAPIComment>> refVal_setComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
-            setComments(refVal_setComments);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            if(field.first == _XPLATSTR("comments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<ModerationAPIComment>> refVal_setComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
+                    setComments(refVal_setComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void ModerationAPIChildCommentsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comments")), m_Comments);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool ModerationAPIChildCommentsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            {
+                std::vector<std::shared_ptr<ModerationAPIComment>> refVal_setComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComments(refVal_setComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationAPIChildCommentsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void ModerationAPIChildCommentsResponse::toMultipart(std::shared_ptr<MultipartFo
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comments")), m_Comments));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::shared_ptr<ModerationAPIComment>> ModerationAPIChildCommentsRes
 void ModerationAPIChildCommentsResponse::setComments(const std::vector<std::shared_ptr<ModerationAPIComment>>& value)
 {
     m_Comments = value;
-    m_CommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_Comments);
 }
 
 bool ModerationAPIChildCommentsResponse::commentsIsSet() const
 {
-    return m_CommentsIsSet;
+    return m_FieldsSet.test(FieldBit_Comments);
 }
 
 void ModerationAPIChildCommentsResponse::unsetComments()
 {
-    m_CommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comments);
 }
 std::shared_ptr<APIStatus> ModerationAPIChildCommentsResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> ModerationAPIChildCommentsResponse::getStatus() const
 void ModerationAPIChildCommentsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationAPIChildCommentsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationAPIChildCommentsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -21,51 +21,26 @@ namespace model {
 ModerationAPIComment::ModerationAPIComment()
 {
     m_IsLocalDeleted = false;
-    m_IsLocalDeletedIsSet = false;
     m_ReplyCount = 0.0;
-    m_ReplyCountIsSet = false;
-    m_FeedbackResultsIsSet = false;
     m_IsVotedUp = false;
-    m_IsVotedUpIsSet = false;
     m_IsVotedDown = false;
-    m_IsVotedDownIsSet = false;
-    m_MyVoteId = utility::conversions::to_string_t("");
-    m_MyVoteIdIsSet = false;
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_CommentHTML = utility::conversions::to_string_t("");
-    m_CommentHTMLIsSet = false;
     m_Reviewed = false;
-    m_ReviewedIsSet = false;
     m_IsSpam = false;
-    m_IsSpamIsSet = false;
     m_PermNotSpam = false;
-    m_PermNotSpamIsSet = false;
     m_HasLinks = false;
-    m_HasLinksIsSet = false;
     m_HasCode = false;
-    m_HasCodeIsSet = false;
     m_Approved = false;
-    m_ApprovedIsSet = false;
     m_IsBannedUser = false;
-    m_IsBannedUserIsSet = false;
     m_IsByAdmin = false;
-    m_IsByAdminIsSet = false;
     m_IsByModerator = false;
-    m_IsByModeratorIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
-    m_FeedbackIdsIsSet = false;
     m_IsDeleted = false;
-    m_IsDeletedIsSet = false;
+    m_Votes = 0.0;
+    m_VotesUp = 0.0;
+    m_VotesDown = 0.0;
+    m_IsPinned = false;
+    m_IsLocked = false;
+    m_FlagCount = 0.0;
 }
 
 ModerationAPIComment::~ModerationAPIComment()
@@ -80,212 +55,212 @@ void ModerationAPIComment::validate()
 web::json::value ModerationAPIComment::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IsLocalDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsLocalDeleted))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isLocalDeleted"))] = ModelBase::toJson(m_IsLocalDeleted);
     }
-    if(m_ReplyCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ReplyCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("replyCount"))] = ModelBase::toJson(m_ReplyCount);
     }
-    if(m_FeedbackResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackResults))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackResults"))] = ModelBase::toJson(m_FeedbackResults);
     }
-    if(m_IsVotedUpIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isVotedUp"))] = ModelBase::toJson(m_IsVotedUp);
     }
-    if(m_IsVotedDownIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isVotedDown"))] = ModelBase::toJson(m_IsVotedDown);
     }
-    if(m_MyVoteIdIsSet)
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("myVoteId"))] = ModelBase::toJson(m_MyVoteId);
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink);
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentHTML"))] = ModelBase::toJson(m_CommentHTML);
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId);
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
     }
-    if(m_LocalDateString.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("localDateString"))] = ModelBase::toJson(m_LocalDateString);
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes);
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp);
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown);
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt);
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewed"))] = ModelBase::toJson(m_Reviewed);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSpam"))] = ModelBase::toJson(m_IsSpam);
     }
-    if(m_PermNotSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("permNotSpam"))] = ModelBase::toJson(m_PermNotSpam);
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasLinks"))] = ModelBase::toJson(m_HasLinks);
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasCode"))] = ModelBase::toJson(m_HasCode);
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approved"))] = ModelBase::toJson(m_Approved);
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))] = ModelBase::toJson(m_IsBannedUser);
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))] = ModelBase::toJson(m_IsByAdmin);
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByModerator"))] = ModelBase::toJson(m_IsByModerator);
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned);
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked);
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount);
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))] = ModelBase::toJson(m_FeedbackIds);
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeleted"))] = ModelBase::toJson(m_IsDeleted);
@@ -294,472 +269,1467 @@ web::json::value ModerationAPIComment::toJson() const
     return val;
 }
 
+void ModerationAPIComment::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_IsLocalDeleted))
+    {
+        
+        writer.key(_XPLATSTR("isLocalDeleted"));
+        ModelBase::writeJson(writer, m_IsLocalDeleted);
+    }
+    if(m_FieldsSet.test(FieldBit_ReplyCount))
+    {
+        
+        writer.key(_XPLATSTR("replyCount"));
+        ModelBase::writeJson(writer, m_ReplyCount);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackResults))
+    {
+        
+        writer.key(_XPLATSTR("feedbackResults"));
+        ModelBase::writeJson(writer, m_FeedbackResults);
+    }
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
+    {
+        
+        writer.key(_XPLATSTR("isVotedUp"));
+        ModelBase::writeJson(writer, m_IsVotedUp);
+    }
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
+    {
+        
+        writer.key(_XPLATSTR("isVotedDown"));
+        ModelBase::writeJson(writer, m_IsVotedDown);
+    }
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
+    {
+        
+        writer.key(_XPLATSTR("myVoteId"));
+        ModelBase::writeJson(writer, m_MyVoteId);
+    }
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
+    {
+        
+        writer.key(_XPLATSTR("commenterLink"));
+        ModelBase::writeJson(writer, m_CommenterLink);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
+    {
+        
+        writer.key(_XPLATSTR("commentHTML"));
+        ModelBase::writeJson(writer, m_CommentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_ParentId))
+    {
+        
+        writer.key(_XPLATSTR("parentId"));
+        ModelBase::writeJson(writer, m_ParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
+    {
+        
+        writer.key(_XPLATSTR("localDateString"));
+        ModelBase::writeJson(writer, m_LocalDateString);
+    }
+    if(m_FieldsSet.test(FieldBit_Votes))
+    {
+        
+        writer.key(_XPLATSTR("votes"));
+        ModelBase::writeJson(writer, m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        writer.key(_XPLATSTR("votesUp"));
+        ModelBase::writeJson(writer, m_VotesUp);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        writer.key(_XPLATSTR("votesDown"));
+        ModelBase::writeJson(writer, m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
+    {
+        
+        writer.key(_XPLATSTR("expireAt"));
+        ModelBase::writeJson(writer, m_ExpireAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Reviewed))
+    {
+        
+        writer.key(_XPLATSTR("reviewed"));
+        ModelBase::writeJson(writer, m_Reviewed);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSpam))
+    {
+        
+        writer.key(_XPLATSTR("isSpam"));
+        ModelBase::writeJson(writer, m_IsSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
+    {
+        
+        writer.key(_XPLATSTR("permNotSpam"));
+        ModelBase::writeJson(writer, m_PermNotSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_HasLinks))
+    {
+        
+        writer.key(_XPLATSTR("hasLinks"));
+        ModelBase::writeJson(writer, m_HasLinks);
+    }
+    if(m_FieldsSet.test(FieldBit_HasCode))
+    {
+        
+        writer.key(_XPLATSTR("hasCode"));
+        ModelBase::writeJson(writer, m_HasCode);
+    }
+    if(m_FieldsSet.test(FieldBit_Approved))
+    {
+        
+        writer.key(_XPLATSTR("approved"));
+        ModelBase::writeJson(writer, m_Approved);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
+    {
+        
+        writer.key(_XPLATSTR("isBannedUser"));
+        ModelBase::writeJson(writer, m_IsBannedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isByAdmin"));
+        ModelBase::writeJson(writer, m_IsByAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
+    {
+        
+        writer.key(_XPLATSTR("isByModerator"));
+        ModelBase::writeJson(writer, m_IsByModerator);
+    }
+    if(m_FieldsSet.test(FieldBit_IsPinned))
+    {
+        
+        writer.key(_XPLATSTR("isPinned"));
+        ModelBase::writeJson(writer, m_IsPinned);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLocked))
+    {
+        
+        writer.key(_XPLATSTR("isLocked"));
+        ModelBase::writeJson(writer, m_IsLocked);
+    }
+    if(m_FieldsSet.test(FieldBit_FlagCount))
+    {
+        
+        writer.key(_XPLATSTR("flagCount"));
+        ModelBase::writeJson(writer, m_FlagCount);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        writer.key(_XPLATSTR("feedbackIds"));
+        ModelBase::writeJson(writer, m_FeedbackIds);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
+    {
+        
+        writer.key(_XPLATSTR("isDeleted"));
+        ModelBase::writeJson(writer, m_IsDeleted);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationAPIComment::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLocalDeleted"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLocalDeleted")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLocalDeleted;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocalDeleted);
-            setIsLocalDeleted(refVal_setIsLocalDeleted);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("replyCount"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("replyCount")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setReplyCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReplyCount);
-            setReplyCount(refVal_setReplyCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isLocalDeleted")):
+            if(field.first == _XPLATSTR("isLocalDeleted"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLocalDeleted;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocalDeleted);
+                    setIsLocalDeleted(refVal_setIsLocalDeleted);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("replyCount")):
+            if(field.first == _XPLATSTR("replyCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setReplyCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReplyCount);
+                    setReplyCount(refVal_setReplyCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackResults")):
+            if(field.first == _XPLATSTR("feedbackResults"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackResults;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackResults);
+                    setFeedbackResults(refVal_setFeedbackResults);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedUp")):
+            if(field.first == _XPLATSTR("isVotedUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsVotedUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedUp);
+                    setIsVotedUp(refVal_setIsVotedUp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedDown")):
+            if(field.first == _XPLATSTR("isVotedDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsVotedDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedDown);
+                    setIsVotedDown(refVal_setIsVotedDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("myVoteId")):
+            if(field.first == _XPLATSTR("myVoteId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setMyVoteId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMyVoteId);
+                    setMyVoteId(refVal_setMyVoteId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_TenantId);
+                    m_FieldsSet.set(FieldBit_TenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_UrlId);
+                    m_FieldsSet.set(FieldBit_UrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_Url);
+                    m_FieldsSet.set(FieldBit_Url);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_PageTitle);
+                    m_FieldsSet.set(FieldBit_PageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_CommenterName);
+                    m_FieldsSet.set(FieldBit_CommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            if(field.first == _XPLATSTR("commenterLink"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterLink;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
+                    setCommenterLink(refVal_setCommenterLink);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            if(field.first == _XPLATSTR("commentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
+                    setCommentHTML(refVal_setCommentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            if(field.first == _XPLATSTR("parentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
+                    setParentId(refVal_setParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            if(field.first == _XPLATSTR("localDateString"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocalDateString;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
+                    setLocalDateString(refVal_setLocalDateString);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            if(field.first == _XPLATSTR("votes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
+                    setVotes(refVal_setVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            if(field.first == _XPLATSTR("votesUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
+                    setVotesUp(refVal_setVotesUp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            if(field.first == _XPLATSTR("votesDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVotesDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
+                    setVotesDown(refVal_setVotesDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            if(field.first == _XPLATSTR("expireAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setExpireAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
+                    setExpireAt(refVal_setExpireAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            if(field.first == _XPLATSTR("reviewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
+                    setReviewed(refVal_setReviewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_AvatarSrc);
+                    m_FieldsSet.set(FieldBit_AvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            if(field.first == _XPLATSTR("isSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
+                    setIsSpam(refVal_setIsSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("permNotSpam")):
+            if(field.first == _XPLATSTR("permNotSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setPermNotSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPermNotSpam);
+                    setPermNotSpam(refVal_setPermNotSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            if(field.first == _XPLATSTR("hasLinks"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
+                    setHasLinks(refVal_setHasLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            if(field.first == _XPLATSTR("hasCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
+                    setHasCode(refVal_setHasCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            if(field.first == _XPLATSTR("approved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
+                    setApproved(refVal_setApproved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            if(field.first == _XPLATSTR("isBannedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsBannedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
+                    setIsBannedUser(refVal_setIsBannedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            if(field.first == _XPLATSTR("isByAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
+                    setIsByAdmin(refVal_setIsByAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            if(field.first == _XPLATSTR("isByModerator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByModerator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
+                    setIsByModerator(refVal_setIsByModerator);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            if(field.first == _XPLATSTR("isPinned"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsPinned;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
+                    setIsPinned(refVal_setIsPinned);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            if(field.first == _XPLATSTR("isLocked"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLocked;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
+                    setIsLocked(refVal_setIsLocked);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            if(field.first == _XPLATSTR("flagCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlagCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
+                    setFlagCount(refVal_setFlagCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            if(field.first == _XPLATSTR("feedbackIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
+                    setFeedbackIds(refVal_setFeedbackIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            if(field.first == _XPLATSTR("isDeleted"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeleted;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
+                    setIsDeleted(refVal_setIsDeleted);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackResults"))))
+    return ok;
+}
+
+void ModerationAPIComment::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_IsLocalDeleted))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackResults")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackResults;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackResults);
-            setFeedbackResults(refVal_setFeedbackResults);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLocalDeleted")), m_IsLocalDeleted);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isVotedUp"))))
+    if(m_FieldsSet.test(FieldBit_ReplyCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isVotedUp")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsVotedUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedUp);
-            setIsVotedUp(refVal_setIsVotedUp);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("replyCount")), m_ReplyCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isVotedDown"))))
+    if(m_FieldsSet.test(FieldBit_FeedbackResults))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isVotedDown")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsVotedDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedDown);
-            setIsVotedDown(refVal_setIsVotedDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackResults")), m_FeedbackResults);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("myVoteId"))))
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("myVoteId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setMyVoteId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMyVoteId);
-            setMyVoteId(refVal_setMyVoteId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isVotedUp")), m_IsVotedUp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isVotedDown")), m_IsVotedDown);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("myVoteId")), m_MyVoteId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterLink"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterLink")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterLink;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
-            setCommenterLink(refVal_setCommenterLink);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentHTML"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentHTML")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
-            setCommentHTML(refVal_setCommentHTML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("parentId"))))
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("parentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
-            setParentId(refVal_setParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterLink")), m_CommenterLink);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentHTML")), m_CommentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("localDateString"))))
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("localDateString")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocalDateString;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocalDateString);
-            setLocalDateString(refVal_setLocalDateString);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("parentId")), m_ParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votes"))))
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votes")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
-            setVotes(refVal_setVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUp"))))
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUp")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
-            setVotesUp(refVal_setVotesUp);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("localDateString")), m_LocalDateString);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDown"))))
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDown")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVotesDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
-            setVotesDown(refVal_setVotesDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votes")), m_Votes);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expireAt"))))
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expireAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setExpireAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
-            setExpireAt(refVal_setExpireAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUp")), m_VotesUp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewed"))))
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
-            setReviewed(refVal_setReviewed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDown")), m_VotesDown);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expireAt")), m_ExpireAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSpam"))))
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
-            setIsSpam(refVal_setIsSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewed")), m_Reviewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("permNotSpam"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("permNotSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setPermNotSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPermNotSpam);
-            setPermNotSpam(refVal_setPermNotSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasLinks"))))
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasLinks")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
-            setHasLinks(refVal_setHasLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSpam")), m_IsSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasCode"))))
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasCode")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
-            setHasCode(refVal_setHasCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("permNotSpam")), m_PermNotSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approved"))))
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approved")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
-            setApproved(refVal_setApproved);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasLinks")), m_HasLinks);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasCode")), m_HasCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))))
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isBannedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsBannedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
-            setIsBannedUser(refVal_setIsBannedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approved")), m_Approved);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
-            setIsByAdmin(refVal_setIsByAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByModerator"))))
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByModerator")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByModerator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
-            setIsByModerator(refVal_setIsByModerator);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isBannedUser")), m_IsBannedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isPinned"))))
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isPinned")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsPinned;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
-            setIsPinned(refVal_setIsPinned);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByAdmin")), m_IsByAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLocked"))))
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLocked")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLocked;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
-            setIsLocked(refVal_setIsLocked);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByModerator")), m_IsByModerator);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flagCount"))))
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flagCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlagCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
-            setFlagCount(refVal_setFlagCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isPinned")), m_IsPinned);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLocked")), m_IsLocked);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flagCount")), m_FlagCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))))
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
-            setFeedbackIds(refVal_setFeedbackIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackIds")), m_FeedbackIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeleted"))))
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeleted")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeleted")), m_IsDeleted);
+    }
+}
+
+bool ModerationAPIComment::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setIsDeleted;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
-            setIsDeleted(refVal_setIsDeleted);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isLocalDeleted")):
+            {
+                bool refVal_setIsLocalDeleted;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLocalDeleted))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLocalDeleted(refVal_setIsLocalDeleted);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("replyCount")):
+            {
+                double refVal_setReplyCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setReplyCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReplyCount(refVal_setReplyCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackResults")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackResults;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackResults))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackResults(refVal_setFeedbackResults);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedUp")):
+            {
+                bool refVal_setIsVotedUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsVotedUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsVotedUp(refVal_setIsVotedUp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedDown")):
+            {
+                bool refVal_setIsVotedDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsVotedDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsVotedDown(refVal_setIsVotedDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("myVoteId")):
+            {
+                utility::string_t refVal_setMyVoteId;
+                if(!ModelBase::readBinary(reader, field, refVal_setMyVoteId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMyVoteId(refVal_setMyVoteId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_TenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_TenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_UrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_UrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_Url))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_Url);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_PageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_PageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_CommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_CommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            {
+                utility::string_t refVal_setCommenterLink;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterLink))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterLink(refVal_setCommenterLink);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            {
+                utility::string_t refVal_setCommentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentHTML(refVal_setCommentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            {
+                utility::string_t refVal_setParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setParentId(refVal_setParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                utility::datetime refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("localDateString")):
+            {
+                utility::string_t refVal_setLocalDateString;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocalDateString))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocalDateString(refVal_setLocalDateString);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            {
+                double refVal_setVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotes(refVal_setVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            {
+                double refVal_setVotesUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUp(refVal_setVotesUp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            {
+                double refVal_setVotesDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDown(refVal_setVotesDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            {
+                utility::datetime refVal_setExpireAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpireAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpireAt(refVal_setExpireAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            {
+                bool refVal_setReviewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewed(refVal_setReviewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_AvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_AvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            {
+                bool refVal_setIsSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSpam(refVal_setIsSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("permNotSpam")):
+            {
+                bool refVal_setPermNotSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setPermNotSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPermNotSpam(refVal_setPermNotSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            {
+                bool refVal_setHasLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasLinks(refVal_setHasLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            {
+                bool refVal_setHasCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasCode(refVal_setHasCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            {
+                bool refVal_setApproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setApproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApproved(refVal_setApproved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            {
+                bool refVal_setIsBannedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsBannedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsBannedUser(refVal_setIsBannedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            {
+                bool refVal_setIsByAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByAdmin(refVal_setIsByAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            {
+                bool refVal_setIsByModerator;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByModerator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByModerator(refVal_setIsByModerator);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            {
+                bool refVal_setIsPinned;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsPinned))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsPinned(refVal_setIsPinned);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            {
+                bool refVal_setIsLocked;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLocked))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLocked(refVal_setIsLocked);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            {
+                double refVal_setFlagCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlagCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlagCount(refVal_setFlagCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackIds(refVal_setFeedbackIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            {
+                bool refVal_setIsDeleted;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeleted))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeleted(refVal_setIsDeleted);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationAPIComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -769,171 +1739,171 @@ void ModerationAPIComment::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IsLocalDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsLocalDeleted))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocalDeleted")), m_IsLocalDeleted));
     }
-    if(m_ReplyCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ReplyCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("replyCount")), m_ReplyCount));
     }
-    if(m_FeedbackResultsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackResults))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackResults")), m_FeedbackResults));
     }
-    if(m_IsVotedUpIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isVotedUp")), m_IsVotedUp));
     }
-    if(m_IsVotedDownIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isVotedDown")), m_IsVotedDown));
     }
-    if(m_MyVoteIdIsSet)
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("myVoteId")), m_MyVoteId));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink));
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentHTML")), m_CommentHTML));
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId));
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
-    if(m_LocalDateString.has_value())
+    if(m_FieldsSet.test(FieldBit_LocalDateString))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("localDateString")), m_LocalDateString));
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes));
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp));
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown));
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt));
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewed")), m_Reviewed));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSpam")), m_IsSpam));
     }
-    if(m_PermNotSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_PermNotSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("permNotSpam")), m_PermNotSpam));
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasLinks")), m_HasLinks));
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasCode")), m_HasCode));
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approved")), m_Approved));
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isBannedUser")), m_IsBannedUser));
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByAdmin")), m_IsByAdmin));
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByModerator")), m_IsByModerator));
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned));
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked));
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount));
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackIds")), m_FeedbackIds));
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeleted")), m_IsDeleted));
     }
@@ -1212,17 +2182,17 @@ bool ModerationAPIComment::isIsLocalDeleted() const
 void ModerationAPIComment::setIsLocalDeleted(bool value)
 {
     m_IsLocalDeleted = value;
-    m_IsLocalDeletedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsLocalDeleted);
 }
 
 bool ModerationAPIComment::isLocalDeletedIsSet() const
 {
-    return m_IsLocalDeletedIsSet;
+    return m_FieldsSet.test(FieldBit_IsLocalDeleted);
 }
 
 void ModerationAPIComment::unsetIsLocalDeleted()
 {
-    m_IsLocalDeletedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsLocalDeleted);
 }
 double ModerationAPIComment::getReplyCount() const
 {
@@ -1232,17 +2202,17 @@ double ModerationAPIComment::getReplyCount() const
 void ModerationAPIComment::setReplyCount(double value)
 {
     m_ReplyCount = value;
-    m_ReplyCountIsSet = true;
+    m_FieldsSet.set(FieldBit_ReplyCount);
 }
 
 bool ModerationAPIComment::replyCountIsSet() const
 {
-    return m_ReplyCountIsSet;
+    return m_FieldsSet.test(FieldBit_ReplyCount);
 }
 
 void ModerationAPIComment::unsetReplyCount()
 {
-    m_ReplyCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReplyCount);
 }
 std::vector<utility::string_t> ModerationAPIComment::getFeedbackResults() const
 {
@@ -1253,17 +2223,17 @@ std::vector<utility::string_t> ModerationAPIComment::getFeedbackResults() const
 void ModerationAPIComment::setFeedbackResults(const std::vector<utility::string_t>& value)
 {
     m_FeedbackResults = value;
-    m_FeedbackResultsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackResults);
 }
 
 bool ModerationAPIComment::feedbackResultsIsSet() const
 {
-    return m_FeedbackResultsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackResults);
 }
 
 void ModerationAPIComment::unsetFeedbackResults()
 {
-    m_FeedbackResultsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackResults);
 }
 bool ModerationAPIComment::isIsVotedUp() const
 {
@@ -1273,17 +2243,17 @@ bool ModerationAPIComment::isIsVotedUp() const
 void ModerationAPIComment::setIsVotedUp(bool value)
 {
     m_IsVotedUp = value;
-    m_IsVotedUpIsSet = true;
+    m_FieldsSet.set(FieldBit_IsVotedUp);
 }
 
 bool ModerationAPIComment::isVotedUpIsSet() const
 {
-    return m_IsVotedUpIsSet;
+    return m_FieldsSet.test(FieldBit_IsVotedUp);
 }
 
 void ModerationAPIComment::unsetIsVotedUp()
 {
-    m_IsVotedUpIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsVotedUp);
 }
 bool ModerationAPIComment::isIsVotedDown() const
 {
@@ -1293,17 +2263,17 @@ bool ModerationAPIComment::isIsVotedDown() const
 void ModerationAPIComment::setIsVotedDown(bool value)
 {
     m_IsVotedDown = value;
-    m_IsVotedDownIsSet = true;
+    m_FieldsSet.set(FieldBit_IsVotedDown);
 }
 
 bool ModerationAPIComment::isVotedDownIsSet() const
 {
-    return m_IsVotedDownIsSet;
+    return m_FieldsSet.test(FieldBit_IsVotedDown);
 }
 
 void ModerationAPIComment::unsetIsVotedDown()
 {
-    m_IsVotedDownIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsVotedDown);
 }
 utility::string_t ModerationAPIComment::getMyVoteId() const
 {
@@ -1314,17 +2284,17 @@ utility::string_t ModerationAPIComment::getMyVoteId() const
 void ModerationAPIComment::setMyVoteId(const utility::string_t& value)
 {
     m_MyVoteId = value;
-    m_MyVoteIdIsSet = true;
+    m_FieldsSet.set(FieldBit_MyVoteId);
 }
 
 bool ModerationAPIComment::myVoteIdIsSet() const
 {
-    return m_MyVoteIdIsSet;
+    return m_FieldsSet.test(FieldBit_MyVoteId);
 }
 
 void ModerationAPIComment::unsetMyVoteId()
 {
-    m_MyVoteIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_MyVoteId);
 }
 utility::string_t ModerationAPIComment::getId() const
 {
@@ -1335,17 +2305,17 @@ utility::string_t ModerationAPIComment::getId() const
 void ModerationAPIComment::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool ModerationAPIComment::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void ModerationAPIComment::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t ModerationAPIComment::getTenantId() const
 {
@@ -1356,17 +2326,17 @@ utility::string_t ModerationAPIComment::getTenantId() const
 void ModerationAPIComment::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool ModerationAPIComment::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void ModerationAPIComment::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t ModerationAPIComment::getUrlId() const
 {
@@ -1377,17 +2347,17 @@ utility::string_t ModerationAPIComment::getUrlId() const
 void ModerationAPIComment::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool ModerationAPIComment::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void ModerationAPIComment::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t ModerationAPIComment::getUrl() const
 {
@@ -1398,77 +2368,80 @@ utility::string_t ModerationAPIComment::getUrl() const
 void ModerationAPIComment::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool ModerationAPIComment::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void ModerationAPIComment::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t ModerationAPIComment::getPageTitle() const
 {
-    return m_PageTitle.get();
+    return m_PageTitle;
 }
 
 
 void ModerationAPIComment::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool ModerationAPIComment::pageTitleIsSet() const
 {
-    return m_PageTitle.has_value();
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void ModerationAPIComment::unsetPageTitle()
 {
-    m_PageTitle.reset();
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 utility::string_t ModerationAPIComment::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void ModerationAPIComment::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool ModerationAPIComment::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void ModerationAPIComment::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t ModerationAPIComment::getAnonUserId() const
 {
-    return m_AnonUserId.get();
+    return m_AnonUserId;
 }
 
 
 void ModerationAPIComment::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool ModerationAPIComment::anonUserIdIsSet() const
 {
-    return m_AnonUserId.has_value();
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void ModerationAPIComment::unsetAnonUserId()
 {
-    m_AnonUserId.reset();
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t ModerationAPIComment::getCommenterName() const
 {
@@ -1479,37 +2452,38 @@ utility::string_t ModerationAPIComment::getCommenterName() const
 void ModerationAPIComment::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool ModerationAPIComment::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void ModerationAPIComment::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::string_t ModerationAPIComment::getCommenterLink() const
 {
-    return m_CommenterLink.get();
+    return m_CommenterLink;
 }
 
 
 void ModerationAPIComment::setCommenterLink(const utility::string_t& value)
 {
     m_CommenterLink = value;
+    m_FieldsSet.set(FieldBit_CommenterLink);
 }
 
 bool ModerationAPIComment::commenterLinkIsSet() const
 {
-    return m_CommenterLink.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterLink);
 }
 
 void ModerationAPIComment::unsetCommenterLink()
 {
-    m_CommenterLink.reset();
+    m_FieldsSet.reset(FieldBit_CommenterLink);
 }
 utility::string_t ModerationAPIComment::getCommentHTML() const
 {
@@ -1520,154 +2494,161 @@ utility::string_t ModerationAPIComment::getCommentHTML() const
 void ModerationAPIComment::setCommentHTML(const utility::string_t& value)
 {
     m_CommentHTML = value;
-    m_CommentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentHTML);
 }
 
 bool ModerationAPIComment::commentHTMLIsSet() const
 {
-    return m_CommentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_CommentHTML);
 }
 
 void ModerationAPIComment::unsetCommentHTML()
 {
-    m_CommentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentHTML);
 }
 utility::string_t ModerationAPIComment::getParentId() const
 {
-    return m_ParentId.get();
+    return m_ParentId;
 }
 
 
 void ModerationAPIComment::setParentId(const utility::string_t& value)
 {
     m_ParentId = value;
+    m_FieldsSet.set(FieldBit_ParentId);
 }
 
 bool ModerationAPIComment::parentIdIsSet() const
 {
-    return m_ParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ParentId);
 }
 
 void ModerationAPIComment::unsetParentId()
 {
-    m_ParentId.reset();
+    m_FieldsSet.reset(FieldBit_ParentId);
 }
 utility::datetime ModerationAPIComment::getDate() const
 {
-    return m_date.get();
+    return m_date;
 }
 
 
 void ModerationAPIComment::setDate(const utility::datetime& value)
 {
     m_date = value;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool ModerationAPIComment::dateIsSet() const
 {
-    return m_date.has_value();
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void ModerationAPIComment::unsetdate()
 {
-    m_date.reset();
+    m_FieldsSet.reset(FieldBit_date);
 }
 utility::string_t ModerationAPIComment::getLocalDateString() const
 {
-    return m_LocalDateString.get();
+    return m_LocalDateString;
 }
 
 
 void ModerationAPIComment::setLocalDateString(const utility::string_t& value)
 {
     m_LocalDateString = value;
+    m_FieldsSet.set(FieldBit_LocalDateString);
 }
 
 bool ModerationAPIComment::localDateStringIsSet() const
 {
-    return m_LocalDateString.has_value();
+    return m_FieldsSet.test(FieldBit_LocalDateString);
 }
 
 void ModerationAPIComment::unsetLocalDateString()
 {
-    m_LocalDateString.reset();
+    m_FieldsSet.reset(FieldBit_LocalDateString);
 }
 double ModerationAPIComment::getVotes() const
 {
-    return m_Votes.get();
+    return m_Votes;
 }
 
 void ModerationAPIComment::setVotes(double value)
 {
     m_Votes = value;
+    m_FieldsSet.set(FieldBit_Votes);
 }
 
 bool ModerationAPIComment::votesIsSet() const
 {
-    return m_Votes.has_value();
+    return m_FieldsSet.test(FieldBit_Votes);
 }
 
 void ModerationAPIComment::unsetVotes()
 {
-    m_Votes.reset();
+    m_FieldsSet.reset(FieldBit_Votes);
 }
 double ModerationAPIComment::getVotesUp() const
 {
-    return m_VotesUp.get();
+    return m_VotesUp;
 }
 
 void ModerationAPIComment::setVotesUp(double value)
 {
     m_VotesUp = value;
+    m_FieldsSet.set(FieldBit_VotesUp);
 }
 
 bool ModerationAPIComment::votesUpIsSet() const
 {
-    return m_VotesUp.has_value();
+    return m_FieldsSet.test(FieldBit_VotesUp);
 }
 
 void ModerationAPIComment::unsetVotesUp()
 {
-    m_VotesUp.reset();
+    m_FieldsSet.reset(FieldBit_VotesUp);
 }
 double ModerationAPIComment::getVotesDown() const
 {
-    return m_VotesDown.get();
+    return m_VotesDown;
 }
 
 void ModerationAPIComment::setVotesDown(double value)
 {
     m_VotesDown = value;
+    m_FieldsSet.set(FieldBit_VotesDown);
 }
 
 bool ModerationAPIComment::votesDownIsSet() const
 {
-    return m_VotesDown.has_value();
+    return m_FieldsSet.test(FieldBit_VotesDown);
 }
 
 void ModerationAPIComment::unsetVotesDown()
 {
-    m_VotesDown.reset();
+    m_FieldsSet.reset(FieldBit_VotesDown);
 }
 utility::datetime ModerationAPIComment::getExpireAt() const
 {
-    return m_ExpireAt.get();
+    return m_ExpireAt;
 }
 
 
 void ModerationAPIComment::setExpireAt(const utility::datetime& value)
 {
     m_ExpireAt = value;
+    m_FieldsSet.set(FieldBit_ExpireAt);
 }
 
 bool ModerationAPIComment::expireAtIsSet() const
 {
-    return m_ExpireAt.has_value();
+    return m_FieldsSet.test(FieldBit_ExpireAt);
 }
 
 void ModerationAPIComment::unsetExpireAt()
 {
-    m_ExpireAt.reset();
+    m_FieldsSet.reset(FieldBit_ExpireAt);
 }
 bool ModerationAPIComment::isReviewed() const
 {
@@ -1677,37 +2658,38 @@ bool ModerationAPIComment::isReviewed() const
 void ModerationAPIComment::setReviewed(bool value)
 {
     m_Reviewed = value;
-    m_ReviewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Reviewed);
 }
 
 bool ModerationAPIComment::reviewedIsSet() const
 {
-    return m_ReviewedIsSet;
+    return m_FieldsSet.test(FieldBit_Reviewed);
 }
 
 void ModerationAPIComment::unsetReviewed()
 {
-    m_ReviewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reviewed);
 }
 utility::string_t ModerationAPIComment::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void ModerationAPIComment::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool ModerationAPIComment::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void ModerationAPIComment::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 bool ModerationAPIComment::isIsSpam() const
 {
@@ -1717,17 +2699,17 @@ bool ModerationAPIComment::isIsSpam() const
 void ModerationAPIComment::setIsSpam(bool value)
 {
     m_IsSpam = value;
-    m_IsSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSpam);
 }
 
 bool ModerationAPIComment::isSpamIsSet() const
 {
-    return m_IsSpamIsSet;
+    return m_FieldsSet.test(FieldBit_IsSpam);
 }
 
 void ModerationAPIComment::unsetIsSpam()
 {
-    m_IsSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSpam);
 }
 bool ModerationAPIComment::isPermNotSpam() const
 {
@@ -1737,17 +2719,17 @@ bool ModerationAPIComment::isPermNotSpam() const
 void ModerationAPIComment::setPermNotSpam(bool value)
 {
     m_PermNotSpam = value;
-    m_PermNotSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_PermNotSpam);
 }
 
 bool ModerationAPIComment::permNotSpamIsSet() const
 {
-    return m_PermNotSpamIsSet;
+    return m_FieldsSet.test(FieldBit_PermNotSpam);
 }
 
 void ModerationAPIComment::unsetPermNotSpam()
 {
-    m_PermNotSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_PermNotSpam);
 }
 bool ModerationAPIComment::isHasLinks() const
 {
@@ -1757,17 +2739,17 @@ bool ModerationAPIComment::isHasLinks() const
 void ModerationAPIComment::setHasLinks(bool value)
 {
     m_HasLinks = value;
-    m_HasLinksIsSet = true;
+    m_FieldsSet.set(FieldBit_HasLinks);
 }
 
 bool ModerationAPIComment::hasLinksIsSet() const
 {
-    return m_HasLinksIsSet;
+    return m_FieldsSet.test(FieldBit_HasLinks);
 }
 
 void ModerationAPIComment::unsetHasLinks()
 {
-    m_HasLinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasLinks);
 }
 bool ModerationAPIComment::isHasCode() const
 {
@@ -1777,17 +2759,17 @@ bool ModerationAPIComment::isHasCode() const
 void ModerationAPIComment::setHasCode(bool value)
 {
     m_HasCode = value;
-    m_HasCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_HasCode);
 }
 
 bool ModerationAPIComment::hasCodeIsSet() const
 {
-    return m_HasCodeIsSet;
+    return m_FieldsSet.test(FieldBit_HasCode);
 }
 
 void ModerationAPIComment::unsetHasCode()
 {
-    m_HasCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasCode);
 }
 bool ModerationAPIComment::isApproved() const
 {
@@ -1797,37 +2779,38 @@ bool ModerationAPIComment::isApproved() const
 void ModerationAPIComment::setApproved(bool value)
 {
     m_Approved = value;
-    m_ApprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_Approved);
 }
 
 bool ModerationAPIComment::approvedIsSet() const
 {
-    return m_ApprovedIsSet;
+    return m_FieldsSet.test(FieldBit_Approved);
 }
 
 void ModerationAPIComment::unsetApproved()
 {
-    m_ApprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Approved);
 }
 utility::string_t ModerationAPIComment::getLocale() const
 {
-    return m_Locale.get();
+    return m_Locale;
 }
 
 
 void ModerationAPIComment::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool ModerationAPIComment::localeIsSet() const
 {
-    return m_Locale.has_value();
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void ModerationAPIComment::unsetLocale()
 {
-    m_Locale.reset();
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 bool ModerationAPIComment::isIsBannedUser() const
 {
@@ -1837,17 +2820,17 @@ bool ModerationAPIComment::isIsBannedUser() const
 void ModerationAPIComment::setIsBannedUser(bool value)
 {
     m_IsBannedUser = value;
-    m_IsBannedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsBannedUser);
 }
 
 bool ModerationAPIComment::isBannedUserIsSet() const
 {
-    return m_IsBannedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsBannedUser);
 }
 
 void ModerationAPIComment::unsetIsBannedUser()
 {
-    m_IsBannedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsBannedUser);
 }
 bool ModerationAPIComment::isIsByAdmin() const
 {
@@ -1857,17 +2840,17 @@ bool ModerationAPIComment::isIsByAdmin() const
 void ModerationAPIComment::setIsByAdmin(bool value)
 {
     m_IsByAdmin = value;
-    m_IsByAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByAdmin);
 }
 
 bool ModerationAPIComment::isByAdminIsSet() const
 {
-    return m_IsByAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsByAdmin);
 }
 
 void ModerationAPIComment::unsetIsByAdmin()
 {
-    m_IsByAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByAdmin);
 }
 bool ModerationAPIComment::isIsByModerator() const
 {
@@ -1877,114 +2860,119 @@ bool ModerationAPIComment::isIsByModerator() const
 void ModerationAPIComment::setIsByModerator(bool value)
 {
     m_IsByModerator = value;
-    m_IsByModeratorIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByModerator);
 }
 
 bool ModerationAPIComment::isByModeratorIsSet() const
 {
-    return m_IsByModeratorIsSet;
+    return m_FieldsSet.test(FieldBit_IsByModerator);
 }
 
 void ModerationAPIComment::unsetIsByModerator()
 {
-    m_IsByModeratorIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByModerator);
 }
 bool ModerationAPIComment::isIsPinned() const
 {
-    return m_IsPinned.get();
+    return m_IsPinned;
 }
 
 void ModerationAPIComment::setIsPinned(bool value)
 {
     m_IsPinned = value;
+    m_FieldsSet.set(FieldBit_IsPinned);
 }
 
 bool ModerationAPIComment::isPinnedIsSet() const
 {
-    return m_IsPinned.has_value();
+    return m_FieldsSet.test(FieldBit_IsPinned);
 }
 
 void ModerationAPIComment::unsetIsPinned()
 {
-    m_IsPinned.reset();
+    m_FieldsSet.reset(FieldBit_IsPinned);
 }
 bool ModerationAPIComment::isIsLocked() const
 {
-    return m_IsLocked.get();
+    return m_IsLocked;
 }
 
 void ModerationAPIComment::setIsLocked(bool value)
 {
     m_IsLocked = value;
+    m_FieldsSet.set(FieldBit_IsLocked);
 }
 
 bool ModerationAPIComment::isLockedIsSet() const
 {
-    return m_IsLocked.has_value();
+    return m_FieldsSet.test(FieldBit_IsLocked);
 }
 
 void ModerationAPIComment::unsetIsLocked()
 {
-    m_IsLocked.reset();
+    m_FieldsSet.reset(FieldBit_IsLocked);
 }
 double ModerationAPIComment::getFlagCount() const
 {
-    return m_FlagCount.get();
+    return m_FlagCount;
 }
 
 void ModerationAPIComment::setFlagCount(double value)
 {
     m_FlagCount = value;
+    m_FieldsSet.set(FieldBit_FlagCount);
 }
 
 bool ModerationAPIComment::flagCountIsSet() const
 {
-    return m_FlagCount.has_value();
+    return m_FieldsSet.test(FieldBit_FlagCount);
 }
 
 void ModerationAPIComment::unsetFlagCount()
 {
-    m_FlagCount.reset();
+    m_FieldsSet.reset(FieldBit_FlagCount);
 }
 utility::string_t ModerationAPIComment::getDisplayLabel() const
 {
-    return m_DisplayLabel.get();
+    return m_DisplayLabel;
 }
 
 
 void ModerationAPIComment::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool ModerationAPIComment::displayLabelIsSet() const
 {
-    return m_DisplayLabel.has_value();
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void ModerationAPIComment::unsetDisplayLabel()
 {
-    m_DisplayLabel.reset();
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> ModerationAPIComment::getBadges() const
 {
-    return m_Badges.get();
+    return m_Badges;
 }
 
 
 void ModerationAPIComment::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool ModerationAPIComment::badgesIsSet() const
 {
-    return m_Badges.has_value();
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void ModerationAPIComment::unsetBadges()
 {
-    m_Badges.reset();
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 bool ModerationAPIComment::isVerified() const
 {
@@ -1994,17 +2982,17 @@ bool ModerationAPIComment::isVerified() const
 void ModerationAPIComment::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool ModerationAPIComment::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void ModerationAPIComment::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 std::vector<utility::string_t> ModerationAPIComment::getFeedbackIds() const
 {
@@ -2015,17 +3003,17 @@ std::vector<utility::string_t> ModerationAPIComment::getFeedbackIds() const
 void ModerationAPIComment::setFeedbackIds(const std::vector<utility::string_t>& value)
 {
     m_FeedbackIds = value;
-    m_FeedbackIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackIds);
 }
 
 bool ModerationAPIComment::feedbackIdsIsSet() const
 {
-    return m_FeedbackIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackIds);
 }
 
 void ModerationAPIComment::unsetFeedbackIds()
 {
-    m_FeedbackIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackIds);
 }
 bool ModerationAPIComment::isIsDeleted() const
 {
@@ -2035,17 +3023,17 @@ bool ModerationAPIComment::isIsDeleted() const
 void ModerationAPIComment::setIsDeleted(bool value)
 {
     m_IsDeleted = value;
-    m_IsDeletedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeleted);
 }
 
 bool ModerationAPIComment::isDeletedIsSet() const
 {
-    return m_IsDeletedIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeleted);
 }
 
 void ModerationAPIComment::unsetIsDeleted()
 {
-    m_IsDeletedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeleted);
 }
 
 }
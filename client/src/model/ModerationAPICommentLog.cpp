@@ -20,14 +20,6 @@ namespace model {
 
 ModerationAPICommentLog::ModerationAPICommentLog()
 {
-    m_date = utility::datetime();
-    m_dateIsSet = false;
-    m_Username = utility::conversions::to_string_t("");
-    m_UsernameIsSet = false;
-    m_ActionName = utility::conversions::to_string_t("");
-    m_ActionNameIsSet = false;
-    m_MessageHTML = utility::conversions::to_string_t("");
-    m_MessageHTMLIsSet = false;
 }
 
 ModerationAPICommentLog::~ModerationAPICommentLog()
@@ -42,22 +34,22 @@ void ModerationAPICommentLog::validate()
 web::json::value ModerationAPICommentLog::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_ActionNameIsSet)
+    if(m_FieldsSet.test(FieldBit_ActionName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("actionName"))] = ModelBase::toJson(m_ActionName);
     }
-    if(m_MessageHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_MessageHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("messageHTML"))] = ModelBase::toJson(m_MessageHTML);
@@ -66,54 +58,187 @@ web::json::value ModerationAPICommentLog::toJson() const
     return val;
 }
 
+void ModerationAPICommentLog::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_ActionName))
+    {
+        
+        writer.key(_XPLATSTR("actionName"));
+        ModelBase::writeJson(writer, m_ActionName);
+    }
+    if(m_FieldsSet.test(FieldBit_MessageHTML))
+    {
+        
+        writer.key(_XPLATSTR("messageHTML"));
+        ModelBase::writeJson(writer, m_MessageHTML);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationAPICommentLog::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("actionName")):
+            if(field.first == _XPLATSTR("actionName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setActionName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setActionName);
+                    setActionName(refVal_setActionName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("messageHTML")):
+            if(field.first == _XPLATSTR("messageHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setMessageHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMessageHTML);
+                    setMessageHTML(refVal_setMessageHTML);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("actionName"))))
+    return ok;
+}
+
+void ModerationAPICommentLog::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("actionName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setActionName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setActionName);
-            setActionName(refVal_setActionName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("messageHTML"))))
+    if(m_FieldsSet.test(FieldBit_Username))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("messageHTML")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_ActionName))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("actionName")), m_ActionName);
+    }
+    if(m_FieldsSet.test(FieldBit_MessageHTML))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("messageHTML")), m_MessageHTML);
+    }
+}
+
+bool ModerationAPICommentLog::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setMessageHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMessageHTML);
-            setMessageHTML(refVal_setMessageHTML);
-            
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                utility::datetime refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("actionName")):
+            {
+                utility::string_t refVal_setActionName;
+                if(!ModelBase::readBinary(reader, field, refVal_setActionName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setActionName(refVal_setActionName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("messageHTML")):
+            {
+                utility::string_t refVal_setMessageHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setMessageHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMessageHTML(refVal_setMessageHTML);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationAPICommentLog::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -123,19 +248,19 @@ void ModerationAPICommentLog::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_ActionNameIsSet)
+    if(m_FieldsSet.test(FieldBit_ActionName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("actionName")), m_ActionName));
     }
-    if(m_MessageHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_MessageHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("messageHTML")), m_MessageHTML));
     }
@@ -187,17 +312,17 @@ utility::datetime ModerationAPICommentLog::getDate() const
 void ModerationAPICommentLog::setDate(const utility::datetime& value)
 {
     m_date = value;
-    m_dateIsSet = true;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool ModerationAPICommentLog::dateIsSet() const
 {
-    return m_dateIsSet;
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void ModerationAPICommentLog::unsetdate()
 {
-    m_dateIsSet = false;
+    m_FieldsSet.reset(FieldBit_date);
 }
 utility::string_t ModerationAPICommentLog::getUsername() const
 {
@@ -208,17 +333,17 @@ utility::string_t ModerationAPICommentLog::getUsername() const
 void ModerationAPICommentLog::setUsername(const utility::string_t& value)
 {
     m_Username = value;
-    m_UsernameIsSet = true;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool ModerationAPICommentLog::usernameIsSet() const
 {
-    return m_UsernameIsSet;
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void ModerationAPICommentLog::unsetUsername()
 {
-    m_UsernameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t ModerationAPICommentLog::getActionName() const
 {
@@ -229,17 +354,17 @@ utility::string_t ModerationAPICommentLog::getActionName() const
 void ModerationAPICommentLog::setActionName(const utility::string_t& value)
 {
     m_ActionName = value;
-    m_ActionNameIsSet = true;
+    m_FieldsSet.set(FieldBit_ActionName);
 }
 
 bool ModerationAPICommentLog::actionNameIsSet() const
 {
-    return m_ActionNameIsSet;
+    return m_FieldsSet.test(FieldBit_ActionName);
 }
 
 void ModerationAPICommentLog::unsetActionName()
 {
-    m_ActionNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_ActionName);
 }
 utility::string_t ModerationAPICommentLog::getMessageHTML() const
 {
@@ -250,17 +375,17 @@ utility::string_t ModerationAPICommentLog::getMessageHTML() const
 void ModerationAPICommentLog::setMessageHTML(const utility::string_t& value)
 {
     m_MessageHTML = value;
-    m_MessageHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_MessageHTML);
 }
 
 bool ModerationAPICommentLog::messageHTMLIsSet() const
 {
-    return m_MessageHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_MessageHTML);
 }
 
 void ModerationAPICommentLog::unsetMessageHTML()
 {
-    m_MessageHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_MessageHTML);
 }
 
 }
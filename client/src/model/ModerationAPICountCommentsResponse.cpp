@@ -20,9 +20,7 @@ namespace model {
 
 ModerationAPICountCommentsResponse::ModerationAPICountCommentsResponse()
 {
-    m_StatusIsSet = false;
     m_Count = 0.0;
-    m_CountIsSet = false;
 }
 
 ModerationAPICountCommentsResponse::~ModerationAPICountCommentsResponse()
@@ -37,12 +35,12 @@ void ModerationAPICountCommentsResponse::validate()
 web::json::value ModerationAPICountCommentsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("count"))] = ModelBase::toJson(m_Count);
@@ -51,32 +49,119 @@ web::json::value ModerationAPICountCommentsResponse::toJson() const
     return val;
 }
 
+void ModerationAPICountCommentsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Count))
+    {
+        
+        writer.key(_XPLATSTR("count"));
+        ModelBase::writeJson(writer, m_Count);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationAPICountCommentsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            if(field.first == _XPLATSTR("count"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
+                    setCount(refVal_setCount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("count"))))
+    return ok;
+}
+
+void ModerationAPICountCommentsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("count")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Count))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("count")), m_Count);
+    }
+}
+
+bool ModerationAPICountCommentsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            double refVal_setCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
-            setCount(refVal_setCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            {
+                double refVal_setCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCount(refVal_setCount);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationAPICountCommentsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +171,11 @@ void ModerationAPICountCommentsResponse::toMultipart(std::shared_ptr<MultipartFo
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("count")), m_Count));
     }
@@ -130,17 +215,17 @@ std::shared_ptr<APIStatus> ModerationAPICountCommentsResponse::getStatus() const
 void ModerationAPICountCommentsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationAPICountCommentsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationAPICountCommentsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 double ModerationAPICountCommentsResponse::getCount() const
 {
@@ -150,17 +235,17 @@ double ModerationAPICountCommentsResponse::getCount() const
 void ModerationAPICountCommentsResponse::setCount(double value)
 {
     m_Count = value;
-    m_CountIsSet = true;
+    m_FieldsSet.set(FieldBit_Count);
 }
 
 bool ModerationAPICountCommentsResponse::countIsSet() const
 {
-    return m_CountIsSet;
+    return m_FieldsSet.test(FieldBit_Count);
 }
 
 void ModerationAPICountCommentsResponse::unsetCount()
 {
-    m_CountIsSet = false;
+    m_FieldsSet.reset(FieldBit_Count);
 }
 
 }
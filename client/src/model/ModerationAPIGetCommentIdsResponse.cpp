@@ -20,10 +20,7 @@ namespace model {
 
 ModerationAPIGetCommentIdsResponse::ModerationAPIGetCommentIdsResponse()
 {
-    m_IdsIsSet = false;
     m_HasMore = false;
-    m_HasMoreIsSet = false;
-    m_StatusIsSet = false;
 }
 
 ModerationAPIGetCommentIdsResponse::~ModerationAPIGetCommentIdsResponse()
@@ -38,17 +35,17 @@ void ModerationAPIGetCommentIdsResponse::validate()
 web::json::value ModerationAPIGetCommentIdsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ids))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ids"))] = ModelBase::toJson(m_Ids);
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasMore"))] = ModelBase::toJson(m_HasMore);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -57,43 +54,153 @@ web::json::value ModerationAPIGetCommentIdsResponse::toJson() const
     return val;
 }
 
+void ModerationAPIGetCommentIdsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Ids))
+    {
+        
+        writer.key(_XPLATSTR("ids"));
+        ModelBase::writeJson(writer, m_Ids);
+    }
+    if(m_FieldsSet.test(FieldBit_HasMore))
+    {
+        
+        writer.key(_XPLATSTR("hasMore"));
+        ModelBase::writeJson(writer, m_HasMore);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationAPIGetCommentIdsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ids"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ids")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIds);
-            setIds(refVal_setIds);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasMore"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasMore")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setHasMore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
-            setHasMore(refVal_setHasMore);
-            
+        case ModelBase::fieldHash(_XPLATSTR("ids")):
+            if(field.first == _XPLATSTR("ids"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIds);
+                    setIds(refVal_setIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            if(field.first == _XPLATSTR("hasMore"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasMore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasMore);
+                    setHasMore(refVal_setHasMore);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void ModerationAPIGetCommentIdsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Ids))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ids")), m_Ids);
+    }
+    if(m_FieldsSet.test(FieldBit_HasMore))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasMore")), m_HasMore);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool ModerationAPIGetCommentIdsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("ids")):
+            {
+                std::vector<utility::string_t> refVal_setIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIds(refVal_setIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasMore")):
+            {
+                bool refVal_setHasMore;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasMore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasMore(refVal_setHasMore);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationAPIGetCommentIdsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -103,15 +210,15 @@ void ModerationAPIGetCommentIdsResponse::toMultipart(std::shared_ptr<MultipartFo
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ids))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ids")), m_Ids));
     }
-    if(m_HasMoreIsSet)
+    if(m_FieldsSet.test(FieldBit_HasMore))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasMore")), m_HasMore));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -157,17 +264,17 @@ std::vector<utility::string_t> ModerationAPIGetCommentIdsResponse::getIds() cons
 void ModerationAPIGetCommentIdsResponse::setIds(const std::vector<utility::string_t>& value)
 {
     m_Ids = value;
-    m_IdsIsSet = true;
+    m_FieldsSet.set(FieldBit_Ids);
 }
 
 bool ModerationAPIGetCommentIdsResponse::idsIsSet() const
 {
-    return m_IdsIsSet;
+    return m_FieldsSet.test(FieldBit_Ids);
 }
 
 void ModerationAPIGetCommentIdsResponse::unsetIds()
 {
-    m_IdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ids);
 }
 bool ModerationAPIGetCommentIdsResponse::isHasMore() const
 {
@@ -177,17 +284,17 @@ bool ModerationAPIGetCommentIdsResponse::isHasMore() const
 void ModerationAPIGetCommentIdsResponse::setHasMore(bool value)
 {
     m_HasMore = value;
-    m_HasMoreIsSet = true;
+    m_FieldsSet.set(FieldBit_HasMore);
 }
 
 bool ModerationAPIGetCommentIdsResponse::hasMoreIsSet() const
 {
-    return m_HasMoreIsSet;
+    return m_FieldsSet.test(FieldBit_HasMore);
 }
 
 void ModerationAPIGetCommentIdsResponse::unsetHasMore()
 {
-    m_HasMoreIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasMore);
 }
 std::shared_ptr<APIStatus> ModerationAPIGetCommentIdsResponse::getStatus() const
 {
@@ -198,17 +305,17 @@ std::shared_ptr<APIStatus> ModerationAPIGetCommentIdsResponse::getStatus() const
 void ModerationAPIGetCommentIdsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationAPIGetCommentIdsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationAPIGetCommentIdsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
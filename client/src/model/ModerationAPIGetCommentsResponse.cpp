@@ -20,10 +20,6 @@ namespace model {
 
 ModerationAPIGetCommentsResponse::ModerationAPIGetCommentsResponse()
 {
-    m_StatusIsSet = false;
-    m_TranslationsIsSet = false;
-    m_CommentsIsSet = false;
-    m_ModerationFilterIsSet = false;
 }
 
 ModerationAPIGetCommentsResponse::~ModerationAPIGetCommentsResponse()
@@ -38,22 +34,22 @@ void ModerationAPIGetCommentsResponse::validate()
 web::json::value ModerationAPIGetCommentsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_TranslationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translations"))] = ModelBase::toJson(m_Translations);
     }
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comments"))] = ModelBase::toJson(m_Comments);
     }
-    if(m_ModerationFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderationFilter"))] = ModelBase::toJson(m_ModerationFilter);
@@ -62,54 +58,187 @@ web::json::value ModerationAPIGetCommentsResponse::toJson() const
     return val;
 }
 
+void ModerationAPIGetCommentsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Translations))
+    {
+        
+        writer.key(_XPLATSTR("translations"));
+        ModelBase::writeJson(writer, m_Translations);
+    }
+    if(m_FieldsSet.test(FieldBit_Comments))
+    {
+        
+        writer.key(_XPLATSTR("comments"));
+        ModelBase::writeJson(writer, m_Comments);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
+    {
+        
+        writer.key(_XPLATSTR("moderationFilter"));
+        ModelBase::writeJson(writer, m_ModerationFilter);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationAPIGetCommentsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translations"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translations")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<Object> refVal_setTranslations;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
-            setTranslations(refVal_setTranslations);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            if(field.first == _XPLATSTR("translations"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setTranslations;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslations);
+                    setTranslations(refVal_setTranslations);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            if(field.first == _XPLATSTR("comments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<ModerationAPIComment>> refVal_setComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
+                    setComments(refVal_setComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationFilter")):
+            if(field.first == _XPLATSTR("moderationFilter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<ModerationFilter> refVal_setModerationFilter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationFilter);
+                    setModerationFilter(refVal_setModerationFilter);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comments"))))
+    return ok;
+}
+
+void ModerationAPIGetCommentsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comments")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<ModerationAPIComment>> refVal_setComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComments);
-            setComments(refVal_setComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationFilter"))))
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationFilter")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translations")), m_Translations);
+    }
+    if(m_FieldsSet.test(FieldBit_Comments))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comments")), m_Comments);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationFilter")), m_ModerationFilter);
+    }
+}
+
+bool ModerationAPIGetCommentsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<ModerationFilter> refVal_setModerationFilter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationFilter);
-            setModerationFilter(refVal_setModerationFilter);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translations")):
+            {
+                std::shared_ptr<Object> refVal_setTranslations;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslations))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslations(refVal_setTranslations);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comments")):
+            {
+                std::vector<std::shared_ptr<ModerationAPIComment>> refVal_setComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComments(refVal_setComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationFilter")):
+            {
+                std::shared_ptr<ModerationFilter> refVal_setModerationFilter;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationFilter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationFilter(refVal_setModerationFilter);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationAPIGetCommentsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -119,19 +248,19 @@ void ModerationAPIGetCommentsResponse::toMultipart(std::shared_ptr<MultipartForm
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_TranslationsIsSet)
+    if(m_FieldsSet.test(FieldBit_Translations))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translations")), m_Translations));
     }
-    if(m_CommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_Comments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comments")), m_Comments));
     }
-    if(m_ModerationFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationFilter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationFilter")), m_ModerationFilter));
     }
@@ -183,17 +312,17 @@ std::shared_ptr<APIStatus> ModerationAPIGetCommentsResponse::getStatus() const
 void ModerationAPIGetCommentsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationAPIGetCommentsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationAPIGetCommentsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<Object> ModerationAPIGetCommentsResponse::getTranslations() const
 {
@@ -204,17 +333,17 @@ std::shared_ptr<Object> ModerationAPIGetCommentsResponse::getTranslations() cons
 void ModerationAPIGetCommentsResponse::setTranslations(const std::shared_ptr<Object>& value)
 {
     m_Translations = value;
-    m_TranslationsIsSet = true;
+    m_FieldsSet.set(FieldBit_Translations);
 }
 
 bool ModerationAPIGetCommentsResponse::translationsIsSet() const
 {
-    return m_TranslationsIsSet;
+    return m_FieldsSet.test(FieldBit_Translations);
 }
 
 void ModerationAPIGetCommentsResponse::unsetTranslations()
 {
-    m_TranslationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Translations);
 }
 std::vector<std::shared_ptr<ModerationAPIComment>> ModerationAPIGetCommentsResponse::getComments() const
 {
@@ -225,17 +354,17 @@ std::vector<std::shared_ptr<ModerationAPIComment>> ModerationAPIGetCommentsRespo
 void ModerationAPIGetCommentsResponse::setComments(const std::vector<std::shared_ptr<ModerationAPIComment>>& value)
 {
     m_Comments = value;
-    m_CommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_Comments);
 }
 
 bool ModerationAPIGetCommentsResponse::commentsIsSet() const
 {
-    return m_CommentsIsSet;
+    return m_FieldsSet.test(FieldBit_Comments);
 }
 
 void ModerationAPIGetCommentsResponse::unsetComments()
 {
-    m_CommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comments);
 }
 std::shared_ptr<ModerationFilter> ModerationAPIGetCommentsResponse::getModerationFilter() const
 {
@@ -246,17 +375,17 @@ std::shared_ptr<ModerationFilter> ModerationAPIGetCommentsResponse::getModeratio
 void ModerationAPIGetCommentsResponse::setModerationFilter(const std::shared_ptr<ModerationFilter>& value)
 {
     m_ModerationFilter = value;
-    m_ModerationFilterIsSet = true;
+    m_FieldsSet.set(FieldBit_ModerationFilter);
 }
 
 bool ModerationAPIGetCommentsResponse::moderationFilterIsSet() const
 {
-    return m_ModerationFilterIsSet;
+    return m_FieldsSet.test(FieldBit_ModerationFilter);
 }
 
 void ModerationAPIGetCommentsResponse::unsetModerationFilter()
 {
-    m_ModerationFilterIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModerationFilter);
 }
 
 }
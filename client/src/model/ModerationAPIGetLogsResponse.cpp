@@ -20,8 +20,6 @@ namespace model {
 
 ModerationAPIGetLogsResponse::ModerationAPIGetLogsResponse()
 {
-    m_LogsIsSet = false;
-    m_StatusIsSet = false;
 }
 
 ModerationAPIGetLogsResponse::~ModerationAPIGetLogsResponse()
@@ -36,12 +34,12 @@ void ModerationAPIGetLogsResponse::validate()
 web::json::value ModerationAPIGetLogsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_LogsIsSet)
+    if(m_FieldsSet.test(FieldBit_Logs))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("logs"))] = ModelBase::toJson(m_Logs);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value ModerationAPIGetLogsResponse::toJson() const
     return val;
 }
 
+void ModerationAPIGetLogsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Logs))
+    {
+        
+        writer.key(_XPLATSTR("logs"));
+        ModelBase::writeJson(writer, m_Logs);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationAPIGetLogsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("logs"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("logs")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<ModerationAPICommentLog>> refVal_setLogs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLogs);
-            setLogs(refVal_setLogs);
-            
+        case ModelBase::fieldHash(_XPLATSTR("logs")):
+            if(field.first == _XPLATSTR("logs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<ModerationAPICommentLog>> refVal_setLogs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLogs);
+                    setLogs(refVal_setLogs);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void ModerationAPIGetLogsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Logs))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("logs")), m_Logs);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool ModerationAPIGetLogsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("logs")):
+            {
+                std::vector<std::shared_ptr<ModerationAPICommentLog>> refVal_setLogs;
+                if(!ModelBase::readBinary(reader, field, refVal_setLogs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLogs(refVal_setLogs);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationAPIGetLogsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void ModerationAPIGetLogsResponse::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_LogsIsSet)
+    if(m_FieldsSet.test(FieldBit_Logs))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logs")), m_Logs));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::shared_ptr<ModerationAPICommentLog>> ModerationAPIGetLogsRespon
 void ModerationAPIGetLogsResponse::setLogs(const std::vector<std::shared_ptr<ModerationAPICommentLog>>& value)
 {
     m_Logs = value;
-    m_LogsIsSet = true;
+    m_FieldsSet.set(FieldBit_Logs);
 }
 
 bool ModerationAPIGetLogsResponse::logsIsSet() const
 {
-    return m_LogsIsSet;
+    return m_FieldsSet.test(FieldBit_Logs);
 }
 
 void ModerationAPIGetLogsResponse::unsetLogs()
 {
-    m_LogsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Logs);
 }
 std::shared_ptr<APIStatus> ModerationAPIGetLogsResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> ModerationAPIGetLogsResponse::getStatus() const
 void ModerationAPIGetLogsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationAPIGetLogsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationAPIGetLogsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
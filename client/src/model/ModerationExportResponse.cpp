@@ -20,10 +20,6 @@ namespace model {
 
 ModerationExportResponse::ModerationExportResponse()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
-    m_BatchJobId = utility::conversions::to_string_t("");
-    m_BatchJobIdIsSet = false;
 }
 
 ModerationExportResponse::~ModerationExportResponse()
@@ -38,12 +34,12 @@ void ModerationExportResponse::validate()
 web::json::value ModerationExportResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_BatchJobIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BatchJobId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("batchJobId"))] = ModelBase::toJson(m_BatchJobId);
@@ -52,32 +48,119 @@ web::json::value ModerationExportResponse::toJson() const
     return val;
 }
 
+void ModerationExportResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_BatchJobId))
+    {
+        
+        writer.key(_XPLATSTR("batchJobId"));
+        ModelBase::writeJson(writer, m_BatchJobId);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationExportResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("batchJobId")):
+            if(field.first == _XPLATSTR("batchJobId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBatchJobId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBatchJobId);
+                    setBatchJobId(refVal_setBatchJobId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("batchJobId"))))
+    return ok;
+}
+
+void ModerationExportResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("batchJobId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_BatchJobId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("batchJobId")), m_BatchJobId);
+    }
+}
+
+bool ModerationExportResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setBatchJobId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBatchJobId);
-            setBatchJobId(refVal_setBatchJobId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("batchJobId")):
+            {
+                utility::string_t refVal_setBatchJobId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBatchJobId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBatchJobId(refVal_setBatchJobId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationExportResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -87,11 +170,11 @@ void ModerationExportResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_BatchJobIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BatchJobId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("batchJobId")), m_BatchJobId));
     }
@@ -131,17 +214,17 @@ utility::string_t ModerationExportResponse::getStatus() const
 void ModerationExportResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationExportResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationExportResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t ModerationExportResponse::getBatchJobId() const
 {
@@ -152,17 +235,17 @@ utility::string_t ModerationExportResponse::getBatchJobId() const
 void ModerationExportResponse::setBatchJobId(const utility::string_t& value)
 {
     m_BatchJobId = value;
-    m_BatchJobIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BatchJobId);
 }
 
 bool ModerationExportResponse::batchJobIdIsSet() const
 {
-    return m_BatchJobIdIsSet;
+    return m_FieldsSet.test(FieldBit_BatchJobId);
 }
 
 void ModerationExportResponse::unsetBatchJobId()
 {
-    m_BatchJobIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BatchJobId);
 }
 
 }
@@ -20,14 +20,7 @@ namespace model {
 
 ModerationExportStatusResponse::ModerationExportStatusResponse()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
-    m_JobStatus = utility::conversions::to_string_t("");
-    m_JobStatusIsSet = false;
     m_RecordCount = 0;
-    m_RecordCountIsSet = false;
-    m_DownloadUrl = utility::conversions::to_string_t("");
-    m_DownloadUrlIsSet = false;
 }
 
 ModerationExportStatusResponse::~ModerationExportStatusResponse()
@@ -42,22 +35,22 @@ void ModerationExportStatusResponse::validate()
 web::json::value ModerationExportStatusResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_JobStatusIsSet)
+    if(m_FieldsSet.test(FieldBit_JobStatus))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("jobStatus"))] = ModelBase::toJson(m_JobStatus);
     }
-    if(m_RecordCountIsSet)
+    if(m_FieldsSet.test(FieldBit_RecordCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("recordCount"))] = ModelBase::toJson(m_RecordCount);
     }
-    if(m_DownloadUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_DownloadUrl))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("downloadUrl"))] = ModelBase::toJson(m_DownloadUrl);
@@ -66,54 +59,187 @@ web::json::value ModerationExportStatusResponse::toJson() const
     return val;
 }
 
+void ModerationExportStatusResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_JobStatus))
+    {
+        
+        writer.key(_XPLATSTR("jobStatus"));
+        ModelBase::writeJson(writer, m_JobStatus);
+    }
+    if(m_FieldsSet.test(FieldBit_RecordCount))
+    {
+        
+        writer.key(_XPLATSTR("recordCount"));
+        ModelBase::writeJson(writer, m_RecordCount);
+    }
+    if(m_FieldsSet.test(FieldBit_DownloadUrl))
+    {
+        
+        writer.key(_XPLATSTR("downloadUrl"));
+        ModelBase::writeJson(writer, m_DownloadUrl);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationExportStatusResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("jobStatus"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("jobStatus")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setJobStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setJobStatus);
-            setJobStatus(refVal_setJobStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("jobStatus")):
+            if(field.first == _XPLATSTR("jobStatus"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setJobStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setJobStatus);
+                    setJobStatus(refVal_setJobStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("recordCount")):
+            if(field.first == _XPLATSTR("recordCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setRecordCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRecordCount);
+                    setRecordCount(refVal_setRecordCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("downloadUrl")):
+            if(field.first == _XPLATSTR("downloadUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDownloadUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDownloadUrl);
+                    setDownloadUrl(refVal_setDownloadUrl);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("recordCount"))))
+    return ok;
+}
+
+void ModerationExportStatusResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("recordCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setRecordCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRecordCount);
-            setRecordCount(refVal_setRecordCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("downloadUrl"))))
+    if(m_FieldsSet.test(FieldBit_JobStatus))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("downloadUrl")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("jobStatus")), m_JobStatus);
+    }
+    if(m_FieldsSet.test(FieldBit_RecordCount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("recordCount")), m_RecordCount);
+    }
+    if(m_FieldsSet.test(FieldBit_DownloadUrl))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("downloadUrl")), m_DownloadUrl);
+    }
+}
+
+bool ModerationExportStatusResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setDownloadUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDownloadUrl);
-            setDownloadUrl(refVal_setDownloadUrl);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("jobStatus")):
+            {
+                utility::string_t refVal_setJobStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setJobStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setJobStatus(refVal_setJobStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("recordCount")):
+            {
+                int32_t refVal_setRecordCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setRecordCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRecordCount(refVal_setRecordCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("downloadUrl")):
+            {
+                utility::string_t refVal_setDownloadUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setDownloadUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDownloadUrl(refVal_setDownloadUrl);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationExportStatusResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -123,19 +249,19 @@ void ModerationExportStatusResponse::toMultipart(std::shared_ptr<MultipartFormDa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_JobStatusIsSet)
+    if(m_FieldsSet.test(FieldBit_JobStatus))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("jobStatus")), m_JobStatus));
     }
-    if(m_RecordCountIsSet)
+    if(m_FieldsSet.test(FieldBit_RecordCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("recordCount")), m_RecordCount));
     }
-    if(m_DownloadUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_DownloadUrl))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("downloadUrl")), m_DownloadUrl));
     }
@@ -187,17 +313,17 @@ utility::string_t ModerationExportStatusResponse::getStatus() const
 void ModerationExportStatusResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationExportStatusResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationExportStatusResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t ModerationExportStatusResponse::getJobStatus() const
 {
@@ -208,17 +334,17 @@ utility::string_t ModerationExportStatusResponse::getJobStatus() const
 void ModerationExportStatusResponse::setJobStatus(const utility::string_t& value)
 {
     m_JobStatus = value;
-    m_JobStatusIsSet = true;
+    m_FieldsSet.set(FieldBit_JobStatus);
 }
 
 bool ModerationExportStatusResponse::jobStatusIsSet() const
 {
-    return m_JobStatusIsSet;
+    return m_FieldsSet.test(FieldBit_JobStatus);
 }
 
 void ModerationExportStatusResponse::unsetJobStatus()
 {
-    m_JobStatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_JobStatus);
 }
 int32_t ModerationExportStatusResponse::getRecordCount() const
 {
@@ -228,17 +354,17 @@ int32_t ModerationExportStatusResponse::getRecordCount() const
 void ModerationExportStatusResponse::setRecordCount(int32_t value)
 {
     m_RecordCount = value;
-    m_RecordCountIsSet = true;
+    m_FieldsSet.set(FieldBit_RecordCount);
 }
 
 bool ModerationExportStatusResponse::recordCountIsSet() const
 {
-    return m_RecordCountIsSet;
+    return m_FieldsSet.test(FieldBit_RecordCount);
 }
 
 void ModerationExportStatusResponse::unsetRecordCount()
 {
-    m_RecordCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_RecordCount);
 }
 utility::string_t ModerationExportStatusResponse::getDownloadUrl() const
 {
@@ -249,17 +375,17 @@ utility::string_t ModerationExportStatusResponse::getDownloadUrl() const
 void ModerationExportStatusResponse::setDownloadUrl(const utility::string_t& value)
 {
     m_DownloadUrl = value;
-    m_DownloadUrlIsSet = true;
+    m_FieldsSet.set(FieldBit_DownloadUrl);
 }
 
 bool ModerationExportStatusResponse::downloadUrlIsSet() const
 {
-    return m_DownloadUrlIsSet;
+    return m_FieldsSet.test(FieldBit_DownloadUrl);
 }
 
 void ModerationExportStatusResponse::unsetDownloadUrl()
 {
-    m_DownloadUrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_DownloadUrl);
 }
 
 }
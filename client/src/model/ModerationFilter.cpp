@@ -21,27 +21,11 @@ namespace model {
 ModerationFilter::ModerationFilter()
 {
     m_Reviewed = false;
-    m_ReviewedIsSet = false;
     m_Approved = false;
-    m_ApprovedIsSet = false;
     m_IsSpam = false;
-    m_IsSpamIsSet = false;
     m_IsBannedUser = false;
-    m_IsBannedUserIsSet = false;
     m_IsLocked = false;
-    m_IsLockedIsSet = false;
     m_FlagCountGt = 0.0;
-    m_FlagCountGtIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_Domain = utility::conversions::to_string_t("");
-    m_DomainIsSet = false;
-    m_ModerationGroupIdsIsSet = false;
-    m_CommentTextSearchIsSet = false;
-    m_ExactCommentText = utility::conversions::to_string_t("");
-    m_ExactCommentTextIsSet = false;
 }
 
 ModerationFilter::~ModerationFilter()
@@ -56,62 +40,62 @@ void ModerationFilter::validate()
 web::json::value ModerationFilter::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewed"))] = ModelBase::toJson(m_Reviewed);
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approved"))] = ModelBase::toJson(m_Approved);
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSpam"))] = ModelBase::toJson(m_IsSpam);
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))] = ModelBase::toJson(m_IsBannedUser);
     }
-    if(m_IsLockedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked);
     }
-    if(m_FlagCountGtIsSet)
+    if(m_FieldsSet.test(FieldBit_FlagCountGt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flagCountGt"))] = ModelBase::toJson(m_FlagCountGt);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds);
     }
-    if(m_CommentTextSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentTextSearch))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentTextSearch"))] = ModelBase::toJson(m_CommentTextSearch);
     }
-    if(m_ExactCommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ExactCommentText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("exactCommentText"))] = ModelBase::toJson(m_ExactCommentText);
@@ -120,142 +104,459 @@ web::json::value ModerationFilter::toJson() const
     return val;
 }
 
+void ModerationFilter::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Reviewed))
+    {
+        
+        writer.key(_XPLATSTR("reviewed"));
+        ModelBase::writeJson(writer, m_Reviewed);
+    }
+    if(m_FieldsSet.test(FieldBit_Approved))
+    {
+        
+        writer.key(_XPLATSTR("approved"));
+        ModelBase::writeJson(writer, m_Approved);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSpam))
+    {
+        
+        writer.key(_XPLATSTR("isSpam"));
+        ModelBase::writeJson(writer, m_IsSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
+    {
+        
+        writer.key(_XPLATSTR("isBannedUser"));
+        ModelBase::writeJson(writer, m_IsBannedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLocked))
+    {
+        
+        writer.key(_XPLATSTR("isLocked"));
+        ModelBase::writeJson(writer, m_IsLocked);
+    }
+    if(m_FieldsSet.test(FieldBit_FlagCountGt))
+    {
+        
+        writer.key(_XPLATSTR("flagCountGt"));
+        ModelBase::writeJson(writer, m_FlagCountGt);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("moderationGroupIds"));
+        ModelBase::writeJson(writer, m_ModerationGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentTextSearch))
+    {
+        
+        writer.key(_XPLATSTR("commentTextSearch"));
+        ModelBase::writeJson(writer, m_CommentTextSearch);
+    }
+    if(m_FieldsSet.test(FieldBit_ExactCommentText))
+    {
+        
+        writer.key(_XPLATSTR("exactCommentText"));
+        ModelBase::writeJson(writer, m_ExactCommentText);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationFilter::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewed"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
-            setReviewed(refVal_setReviewed);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approved"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approved")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setApproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
-            setApproved(refVal_setApproved);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            if(field.first == _XPLATSTR("reviewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
+                    setReviewed(refVal_setReviewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            if(field.first == _XPLATSTR("approved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
+                    setApproved(refVal_setApproved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            if(field.first == _XPLATSTR("isSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
+                    setIsSpam(refVal_setIsSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            if(field.first == _XPLATSTR("isBannedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsBannedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
+                    setIsBannedUser(refVal_setIsBannedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            if(field.first == _XPLATSTR("isLocked"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLocked;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
+                    setIsLocked(refVal_setIsLocked);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flagCountGt")):
+            if(field.first == _XPLATSTR("flagCountGt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlagCountGt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCountGt);
+                    setFlagCountGt(refVal_setFlagCountGt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            if(field.first == _XPLATSTR("moderationGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModerationGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
+                    setModerationGroupIds(refVal_setModerationGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentTextSearch")):
+            if(field.first == _XPLATSTR("commentTextSearch"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setCommentTextSearch;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentTextSearch);
+                    setCommentTextSearch(refVal_setCommentTextSearch);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("exactCommentText")):
+            if(field.first == _XPLATSTR("exactCommentText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setExactCommentText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExactCommentText);
+                    setExactCommentText(refVal_setExactCommentText);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSpam"))))
+    return ok;
+}
+
+void ModerationFilter::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
-            setIsSpam(refVal_setIsSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewed")), m_Reviewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))))
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isBannedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsBannedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
-            setIsBannedUser(refVal_setIsBannedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approved")), m_Approved);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLocked"))))
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLocked")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLocked;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
-            setIsLocked(refVal_setIsLocked);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSpam")), m_IsSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flagCountGt"))))
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flagCountGt")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlagCountGt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCountGt);
-            setFlagCountGt(refVal_setFlagCountGt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isBannedUser")), m_IsBannedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLocked")), m_IsLocked);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_FlagCountGt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flagCountGt")), m_FlagCountGt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModerationGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
-            setModerationGroupIds(refVal_setModerationGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentTextSearch"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentTextSearch")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setCommentTextSearch;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentTextSearch);
-            setCommentTextSearch(refVal_setCommentTextSearch);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("exactCommentText"))))
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("exactCommentText")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentTextSearch))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentTextSearch")), m_CommentTextSearch);
+    }
+    if(m_FieldsSet.test(FieldBit_ExactCommentText))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("exactCommentText")), m_ExactCommentText);
+    }
+}
+
+bool ModerationFilter::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setExactCommentText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExactCommentText);
-            setExactCommentText(refVal_setExactCommentText);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            {
+                bool refVal_setReviewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewed(refVal_setReviewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            {
+                bool refVal_setApproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setApproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApproved(refVal_setApproved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            {
+                bool refVal_setIsSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSpam(refVal_setIsSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            {
+                bool refVal_setIsBannedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsBannedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsBannedUser(refVal_setIsBannedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            {
+                bool refVal_setIsLocked;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLocked))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLocked(refVal_setIsLocked);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flagCountGt")):
+            {
+                double refVal_setFlagCountGt;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlagCountGt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlagCountGt(refVal_setFlagCountGt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setModerationGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationGroupIds(refVal_setModerationGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentTextSearch")):
+            {
+                std::vector<utility::string_t> refVal_setCommentTextSearch;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentTextSearch))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentTextSearch(refVal_setCommentTextSearch);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("exactCommentText")):
+            {
+                utility::string_t refVal_setExactCommentText;
+                if(!ModelBase::readBinary(reader, field, refVal_setExactCommentText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExactCommentText(refVal_setExactCommentText);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationFilter::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -265,51 +566,51 @@ void ModerationFilter::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewed")), m_Reviewed));
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approved")), m_Approved));
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSpam")), m_IsSpam));
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isBannedUser")), m_IsBannedUser));
     }
-    if(m_IsLockedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked));
     }
-    if(m_FlagCountGtIsSet)
+    if(m_FieldsSet.test(FieldBit_FlagCountGt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCountGt")), m_FlagCountGt));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_ModerationGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds));
     }
-    if(m_CommentTextSearchIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentTextSearch))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentTextSearch")), m_CommentTextSearch));
     }
-    if(m_ExactCommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ExactCommentText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("exactCommentText")), m_ExactCommentText));
     }
@@ -408,17 +709,17 @@ bool ModerationFilter::isReviewed() const
 void ModerationFilter::setReviewed(bool value)
 {
     m_Reviewed = value;
-    m_ReviewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Reviewed);
 }
 
 bool ModerationFilter::reviewedIsSet() const
 {
-    return m_ReviewedIsSet;
+    return m_FieldsSet.test(FieldBit_Reviewed);
 }
 
 void ModerationFilter::unsetReviewed()
 {
-    m_ReviewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reviewed);
 }
 bool ModerationFilter::isApproved() const
 {
@@ -428,17 +729,17 @@ bool ModerationFilter::isApproved() const
 void ModerationFilter::setApproved(bool value)
 {
     m_Approved = value;
-    m_ApprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_Approved);
 }
 
 bool ModerationFilter::approvedIsSet() const
 {
-    return m_ApprovedIsSet;
+    return m_FieldsSet.test(FieldBit_Approved);
 }
 
 void ModerationFilter::unsetApproved()
 {
-    m_ApprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Approved);
 }
 bool ModerationFilter::isIsSpam() const
 {
@@ -448,17 +749,17 @@ bool ModerationFilter::isIsSpam() const
 void ModerationFilter::setIsSpam(bool value)
 {
     m_IsSpam = value;
-    m_IsSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSpam);
 }
 
 bool ModerationFilter::isSpamIsSet() const
 {
-    return m_IsSpamIsSet;
+    return m_FieldsSet.test(FieldBit_IsSpam);
 }
 
 void ModerationFilter::unsetIsSpam()
 {
-    m_IsSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSpam);
 }
 bool ModerationFilter::isIsBannedUser() const
 {
@@ -468,17 +769,17 @@ bool ModerationFilter::isIsBannedUser() const
 void ModerationFilter::setIsBannedUser(bool value)
 {
     m_IsBannedUser = value;
-    m_IsBannedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsBannedUser);
 }
 
 bool ModerationFilter::isBannedUserIsSet() const
 {
-    return m_IsBannedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsBannedUser);
 }
 
 void ModerationFilter::unsetIsBannedUser()
 {
-    m_IsBannedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsBannedUser);
 }
 bool ModerationFilter::isIsLocked() const
 {
@@ -488,17 +789,17 @@ bool ModerationFilter::isIsLocked() const
 void ModerationFilter::setIsLocked(bool value)
 {
     m_IsLocked = value;
-    m_IsLockedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsLocked);
 }
 
 bool ModerationFilter::isLockedIsSet() const
 {
-    return m_IsLockedIsSet;
+    return m_FieldsSet.test(FieldBit_IsLocked);
 }
 
 void ModerationFilter::unsetIsLocked()
 {
-    m_IsLockedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsLocked);
 }
 double ModerationFilter::getFlagCountGt() const
 {
@@ -508,17 +809,17 @@ double ModerationFilter::getFlagCountGt() const
 void ModerationFilter::setFlagCountGt(double value)
 {
     m_FlagCountGt = value;
-    m_FlagCountGtIsSet = true;
+    m_FieldsSet.set(FieldBit_FlagCountGt);
 }
 
 bool ModerationFilter::flagCountGtIsSet() const
 {
-    return m_FlagCountGtIsSet;
+    return m_FieldsSet.test(FieldBit_FlagCountGt);
 }
 
 void ModerationFilter::unsetFlagCountGt()
 {
-    m_FlagCountGtIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlagCountGt);
 }
 utility::string_t ModerationFilter::getUserId() const
 {
@@ -529,17 +830,17 @@ utility::string_t ModerationFilter::getUserId() const
 void ModerationFilter::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool ModerationFilter::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void ModerationFilter::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t ModerationFilter::getUrlId() const
 {
@@ -550,17 +851,17 @@ utility::string_t ModerationFilter::getUrlId() const
 void ModerationFilter::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool ModerationFilter::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void ModerationFilter::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t ModerationFilter::getDomain() const
 {
@@ -571,17 +872,17 @@ utility::string_t ModerationFilter::getDomain() const
 void ModerationFilter::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
-    m_DomainIsSet = true;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool ModerationFilter::domainIsSet() const
 {
-    return m_DomainIsSet;
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void ModerationFilter::unsetDomain()
 {
-    m_DomainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 std::vector<utility::string_t> ModerationFilter::getModerationGroupIds() const
 {
@@ -592,17 +893,17 @@ std::vector<utility::string_t> ModerationFilter::getModerationGroupIds() const
 void ModerationFilter::setModerationGroupIds(const std::vector<utility::string_t>& value)
 {
     m_ModerationGroupIds = value;
-    m_ModerationGroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ModerationGroupIds);
 }
 
 bool ModerationFilter::moderationGroupIdsIsSet() const
 {
-    return m_ModerationGroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ModerationGroupIds);
 }
 
 void ModerationFilter::unsetModerationGroupIds()
 {
-    m_ModerationGroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModerationGroupIds);
 }
 std::vector<utility::string_t> ModerationFilter::getCommentTextSearch() const
 {
@@ -613,17 +914,17 @@ std::vector<utility::string_t> ModerationFilter::getCommentTextSearch() const
 void ModerationFilter::setCommentTextSearch(const std::vector<utility::string_t>& value)
 {
     m_CommentTextSearch = value;
-    m_CommentTextSearchIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentTextSearch);
 }
 
 bool ModerationFilter::commentTextSearchIsSet() const
 {
-    return m_CommentTextSearchIsSet;
+    return m_FieldsSet.test(FieldBit_CommentTextSearch);
 }
 
 void ModerationFilter::unsetCommentTextSearch()
 {
-    m_CommentTextSearchIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentTextSearch);
 }
 utility::string_t ModerationFilter::getExactCommentText() const
 {
@@ -634,17 +935,17 @@ utility::string_t ModerationFilter::getExactCommentText() const
 void ModerationFilter::setExactCommentText(const utility::string_t& value)
 {
     m_ExactCommentText = value;
-    m_ExactCommentTextIsSet = true;
+    m_FieldsSet.set(FieldBit_ExactCommentText);
 }
 
 bool ModerationFilter::exactCommentTextIsSet() const
 {
-    return m_ExactCommentTextIsSet;
+    return m_FieldsSet.test(FieldBit_ExactCommentText);
 }
 
 void ModerationFilter::unsetExactCommentText()
 {
-    m_ExactCommentTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_ExactCommentText);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 ModerationPageSearchResponse::ModerationPageSearchResponse()
 {
-    m_PagesIsSet = false;
-    m_StatusIsSet = false;
 }
 
 ModerationPageSearchResponse::~ModerationPageSearchResponse()
@@ -36,12 +34,12 @@ void ModerationPageSearchResponse::validate()
 web::json::value ModerationPageSearchResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_PagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pages"))] = ModelBase::toJson(m_Pages);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value ModerationPageSearchResponse::toJson() const
     return val;
 }
 
+void ModerationPageSearchResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Pages))
+    {
+        
+        writer.key(_XPLATSTR("pages"));
+        ModelBase::writeJson(writer, m_Pages);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationPageSearchResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pages"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pages")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<ModerationPageSearchProjected>> refVal_setPages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPages);
-            setPages(refVal_setPages);
-            
+        case ModelBase::fieldHash(_XPLATSTR("pages")):
+            if(field.first == _XPLATSTR("pages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<ModerationPageSearchProjected>> refVal_setPages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPages);
+                    setPages(refVal_setPages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void ModerationPageSearchResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pages")), m_Pages);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool ModerationPageSearchResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("pages")):
+            {
+                std::vector<std::shared_ptr<ModerationPageSearchProjected>> refVal_setPages;
+                if(!ModelBase::readBinary(reader, field, refVal_setPages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPages(refVal_setPages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationPageSearchResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void ModerationPageSearchResponse::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_PagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pages")), m_Pages));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::shared_ptr<ModerationPageSearchProjected>> ModerationPageSearch
 void ModerationPageSearchResponse::setPages(const std::vector<std::shared_ptr<ModerationPageSearchProjected>>& value)
 {
     m_Pages = value;
-    m_PagesIsSet = true;
+    m_FieldsSet.set(FieldBit_Pages);
 }
 
 bool ModerationPageSearchResponse::pagesIsSet() const
 {
-    return m_PagesIsSet;
+    return m_FieldsSet.test(FieldBit_Pages);
 }
 
 void ModerationPageSearchResponse::unsetPages()
 {
-    m_PagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Pages);
 }
 std::shared_ptr<APIStatus> ModerationPageSearchResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> ModerationPageSearchResponse::getStatus() const
 void ModerationPageSearchResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationPageSearchResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationPageSearchResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
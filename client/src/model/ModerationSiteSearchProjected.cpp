@@ -20,8 +20,6 @@ namespace model {
 
 ModerationSiteSearchProjected::ModerationSiteSearchProjected()
 {
-    m_Domain = utility::conversions::to_string_t("");
-    m_DomainIsSet = false;
 }
 
 ModerationSiteSearchProjected::~ModerationSiteSearchProjected()
@@ -36,46 +34,133 @@ void ModerationSiteSearchProjected::validate()
 web::json::value ModerationSiteSearchProjected::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_LogoSrc100px.has_value())
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))] = ModelBase::toJson(m_LogoSrc100px.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))] = ModelBase::toJson(m_LogoSrc100px);
     }
 
     return val;
 }
 
+void ModerationSiteSearchProjected::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
+    {
+        
+        writer.key(_XPLATSTR("logoSrc100px"));
+        ModelBase::writeJson(writer, m_LogoSrc100px);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationSiteSearchProjected::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc100px")):
+            if(field.first == _XPLATSTR("logoSrc100px"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLogoSrc100px;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc100px);
+                    setLogoSrc100px(refVal_setLogoSrc100px);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))))
+    return ok;
+}
+
+void ModerationSiteSearchProjected::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("logoSrc100px")), m_LogoSrc100px);
+    }
+}
+
+bool ModerationSiteSearchProjected::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setLogoSrc100px;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc100px);
-            setLogoSrc100px(refVal_setLogoSrc100px);
-            
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc100px")):
+            {
+                utility::string_t refVal_setLogoSrc100px;
+                if(!ModelBase::readBinary(reader, field, refVal_setLogoSrc100px))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLogoSrc100px(refVal_setLogoSrc100px);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationSiteSearchProjected::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,13 +170,13 @@ void ModerationSiteSearchProjected::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_LogoSrc100px.has_value())
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")), m_LogoSrc100px.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")), m_LogoSrc100px));
     }
 }
 
@@ -129,37 +214,38 @@ utility::string_t ModerationSiteSearchProjected::getDomain() const
 void ModerationSiteSearchProjected::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
-    m_DomainIsSet = true;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool ModerationSiteSearchProjected::domainIsSet() const
 {
-    return m_DomainIsSet;
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void ModerationSiteSearchProjected::unsetDomain()
 {
-    m_DomainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t ModerationSiteSearchProjected::getLogoSrc100px() const
 {
-    return m_LogoSrc100px.get();
+    return m_LogoSrc100px;
 }
 
 
 void ModerationSiteSearchProjected::setLogoSrc100px(const utility::string_t& value)
 {
     m_LogoSrc100px = value;
+    m_FieldsSet.set(FieldBit_LogoSrc100px);
 }
 
 bool ModerationSiteSearchProjected::logoSrc100pxIsSet() const
 {
-    return m_LogoSrc100px.has_value();
+    return m_FieldsSet.test(FieldBit_LogoSrc100px);
 }
 
 void ModerationSiteSearchProjected::unsetLogoSrc100px()
 {
-    m_LogoSrc100px.reset();
+    m_FieldsSet.reset(FieldBit_LogoSrc100px);
 }
 
 }
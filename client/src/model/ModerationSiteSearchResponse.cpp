@@ -20,8 +20,6 @@ namespace model {
 
 ModerationSiteSearchResponse::ModerationSiteSearchResponse()
 {
-    m_SitesIsSet = false;
-    m_StatusIsSet = false;
 }
 
 ModerationSiteSearchResponse::~ModerationSiteSearchResponse()
@@ -36,12 +34,12 @@ void ModerationSiteSearchResponse::validate()
 web::json::value ModerationSiteSearchResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_SitesIsSet)
+    if(m_FieldsSet.test(FieldBit_Sites))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sites"))] = ModelBase::toJson(m_Sites);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value ModerationSiteSearchResponse::toJson() const
     return val;
 }
 
+void ModerationSiteSearchResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Sites))
+    {
+        
+        writer.key(_XPLATSTR("sites"));
+        ModelBase::writeJson(writer, m_Sites);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationSiteSearchResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sites"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sites")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<ModerationSiteSearchProjected>> refVal_setSites;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSites);
-            setSites(refVal_setSites);
-            
+        case ModelBase::fieldHash(_XPLATSTR("sites")):
+            if(field.first == _XPLATSTR("sites"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<ModerationSiteSearchProjected>> refVal_setSites;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSites);
+                    setSites(refVal_setSites);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void ModerationSiteSearchResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Sites))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sites")), m_Sites);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool ModerationSiteSearchResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("sites")):
+            {
+                std::vector<std::shared_ptr<ModerationSiteSearchProjected>> refVal_setSites;
+                if(!ModelBase::readBinary(reader, field, refVal_setSites))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSites(refVal_setSites);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationSiteSearchResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void ModerationSiteSearchResponse::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_SitesIsSet)
+    if(m_FieldsSet.test(FieldBit_Sites))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sites")), m_Sites));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::shared_ptr<ModerationSiteSearchProjected>> ModerationSiteSearch
 void ModerationSiteSearchResponse::setSites(const std::vector<std::shared_ptr<ModerationSiteSearchProjected>>& value)
 {
     m_Sites = value;
-    m_SitesIsSet = true;
+    m_FieldsSet.set(FieldBit_Sites);
 }
 
 bool ModerationSiteSearchResponse::sitesIsSet() const
 {
-    return m_SitesIsSet;
+    return m_FieldsSet.test(FieldBit_Sites);
 }
 
 void ModerationSiteSearchResponse::unsetSites()
 {
-    m_SitesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sites);
 }
 std::shared_ptr<APIStatus> ModerationSiteSearchResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> ModerationSiteSearchResponse::getStatus() const
 void ModerationSiteSearchResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationSiteSearchResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationSiteSearchResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
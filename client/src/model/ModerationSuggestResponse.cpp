@@ -20,12 +20,6 @@ namespace model {
 
 ModerationSuggestResponse::ModerationSuggestResponse()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
-    m_PagesIsSet = false;
-    m_UsersIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
 }
 
 ModerationSuggestResponse::~ModerationSuggestResponse()
@@ -40,22 +34,22 @@ void ModerationSuggestResponse::validate()
 web::json::value ModerationSuggestResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_PagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pages"))] = ModelBase::toJson(m_Pages);
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("users"))] = ModelBase::toJson(m_Users);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
@@ -64,54 +58,187 @@ web::json::value ModerationSuggestResponse::toJson() const
     return val;
 }
 
+void ModerationSuggestResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Pages))
+    {
+        
+        writer.key(_XPLATSTR("pages"));
+        ModelBase::writeJson(writer, m_Pages);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        writer.key(_XPLATSTR("users"));
+        ModelBase::writeJson(writer, m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+
+    writer.endObject();
+}
+
 bool ModerationSuggestResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pages"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pages")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<ModerationPageSearchProjected>> refVal_setPages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPages);
-            setPages(refVal_setPages);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pages")):
+            if(field.first == _XPLATSTR("pages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<ModerationPageSearchProjected>> refVal_setPages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPages);
+                    setPages(refVal_setPages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            if(field.first == _XPLATSTR("users"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<ModerationUserSearchProjected>> refVal_setUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
+                    setUsers(refVal_setUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("users"))))
+    return ok;
+}
+
+void ModerationSuggestResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("users")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<ModerationUserSearchProjected>> refVal_setUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
-            setUsers(refVal_setUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pages")), m_Pages);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("users")), m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+}
+
+bool ModerationSuggestResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pages")):
+            {
+                std::vector<std::shared_ptr<ModerationPageSearchProjected>> refVal_setPages;
+                if(!ModelBase::readBinary(reader, field, refVal_setPages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPages(refVal_setPages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            {
+                std::vector<std::shared_ptr<ModerationUserSearchProjected>> refVal_setUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsers(refVal_setUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ModerationSuggestResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -121,19 +248,19 @@ void ModerationSuggestResponse::toMultipart(std::shared_ptr<MultipartFormData> m
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_PagesIsSet)
+    if(m_FieldsSet.test(FieldBit_Pages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pages")), m_Pages));
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("users")), m_Users));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
@@ -185,17 +312,17 @@ utility::string_t ModerationSuggestResponse::getStatus() const
 void ModerationSuggestResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ModerationSuggestResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ModerationSuggestResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<ModerationPageSearchProjected>> ModerationSuggestResponse::getPages() const
 {
@@ -206,17 +333,17 @@ std::vector<std::shared_ptr<ModerationPageSearchProjected>> ModerationSuggestRes
 void ModerationSuggestResponse::setPages(const std::vector<std::shared_ptr<ModerationPageSearchProjected>>& value)
 {
     m_Pages = value;
-    m_PagesIsSet = true;
+    m_FieldsSet.set(FieldBit_Pages);
 }
 
 bool ModerationSuggestResponse::pagesIsSet() const
 {
-    return m_PagesIsSet;
+    return m_FieldsSet.test(FieldBit_Pages);
 }
 
 void ModerationSuggestResponse::unsetPages()
 {
-    m_PagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Pages);
 }
 std::vector<std::shared_ptr<ModerationUserSearchProjected>> ModerationSuggestResponse::getUsers() const
 {
@@ -227,17 +354,17 @@ std::vector<std::shared_ptr<ModerationUserSearchProjected>> ModerationSuggestRes
 void ModerationSuggestResponse::setUsers(const std::vector<std::shared_ptr<ModerationUserSearchProjected>>& value)
 {
     m_Users = value;
-    m_UsersIsSet = true;
+    m_FieldsSet.set(FieldBit_Users);
 }
 
 bool ModerationSuggestResponse::usersIsSet() const
 {
-    return m_UsersIsSet;
+    return m_FieldsSet.test(FieldBit_Users);
 }
 
 void ModerationSuggestResponse::unsetUsers()
 {
-    m_UsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Users);
 }
 utility::string_t ModerationSuggestResponse::getCode() const
 {
@@ -248,17 +375,17 @@ utility::string_t ModerationSuggestResponse::getCode() const
 void ModerationSuggestResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool ModerationSuggestResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void ModerationSuggestResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 
 }
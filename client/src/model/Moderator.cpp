@@ -20,34 +20,17 @@ namespace model {
 
 Moderator::Moderator()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
     m_AcceptedInvite = false;
-    m_AcceptedInviteIsSet = false;
     m_MarkReviewedCount = 0.0;
-    m_MarkReviewedCountIsSet = false;
     m_DeletedCount = 0.0;
-    m_DeletedCountIsSet = false;
     m_MarkedSpamCount = 0.0;
-    m_MarkedSpamCountIsSet = false;
     m_MarkedNotSpamCount = 0.0;
-    m_MarkedNotSpamCountIsSet = false;
     m_ApprovedCount = 0.0;
-    m_ApprovedCountIsSet = false;
     m_UnApprovedCount = 0.0;
-    m_UnApprovedCountIsSet = false;
     m_EditedCount = 0.0;
-    m_EditedCountIsSet = false;
     m_BannedCount = 0.0;
-    m_BannedCountIsSet = false;
     m_UnFlaggedCount = 0.0;
-    m_UnFlaggedCountIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
     m_IsEmailSuppressed = false;
-    m_IsEmailSuppressedIsSet = false;
 }
 
 Moderator::~Moderator()
@@ -62,97 +45,97 @@ void Moderator::validate()
 web::json::value Moderator::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_Name.has_value())
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_AcceptedInviteIsSet)
+    if(m_FieldsSet.test(FieldBit_AcceptedInvite))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("acceptedInvite"))] = ModelBase::toJson(m_AcceptedInvite);
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_MarkReviewedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MarkReviewedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("markReviewedCount"))] = ModelBase::toJson(m_MarkReviewedCount);
     }
-    if(m_DeletedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_DeletedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("deletedCount"))] = ModelBase::toJson(m_DeletedCount);
     }
-    if(m_MarkedSpamCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MarkedSpamCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("markedSpamCount"))] = ModelBase::toJson(m_MarkedSpamCount);
     }
-    if(m_MarkedNotSpamCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MarkedNotSpamCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("markedNotSpamCount"))] = ModelBase::toJson(m_MarkedNotSpamCount);
     }
-    if(m_ApprovedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ApprovedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approvedCount"))] = ModelBase::toJson(m_ApprovedCount);
     }
-    if(m_UnApprovedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_UnApprovedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("unApprovedCount"))] = ModelBase::toJson(m_UnApprovedCount);
     }
-    if(m_EditedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_EditedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("editedCount"))] = ModelBase::toJson(m_EditedCount);
     }
-    if(m_BannedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bannedCount"))] = ModelBase::toJson(m_BannedCount);
     }
-    if(m_UnFlaggedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_UnFlaggedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("unFlaggedCount"))] = ModelBase::toJson(m_UnFlaggedCount);
     }
-    if(m_VerificationId.has_value())
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("verificationId"))] = ModelBase::toJson(m_VerificationId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("verificationId"))] = ModelBase::toJson(m_VerificationId);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_ModerationGroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))] = ModelBase::toJson(m_ModerationGroupIds);
     }
-    if(m_IsEmailSuppressedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed"))] = ModelBase::toJson(m_IsEmailSuppressed);
@@ -161,219 +144,697 @@ web::json::value Moderator::toJson() const
     return val;
 }
 
+void Moderator::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_AcceptedInvite))
+    {
+        
+        writer.key(_XPLATSTR("acceptedInvite"));
+        ModelBase::writeJson(writer, m_AcceptedInvite);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_MarkReviewedCount))
+    {
+        
+        writer.key(_XPLATSTR("markReviewedCount"));
+        ModelBase::writeJson(writer, m_MarkReviewedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_DeletedCount))
+    {
+        
+        writer.key(_XPLATSTR("deletedCount"));
+        ModelBase::writeJson(writer, m_DeletedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_MarkedSpamCount))
+    {
+        
+        writer.key(_XPLATSTR("markedSpamCount"));
+        ModelBase::writeJson(writer, m_MarkedSpamCount);
+    }
+    if(m_FieldsSet.test(FieldBit_MarkedNotSpamCount))
+    {
+        
+        writer.key(_XPLATSTR("markedNotSpamCount"));
+        ModelBase::writeJson(writer, m_MarkedNotSpamCount);
+    }
+    if(m_FieldsSet.test(FieldBit_ApprovedCount))
+    {
+        
+        writer.key(_XPLATSTR("approvedCount"));
+        ModelBase::writeJson(writer, m_ApprovedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_UnApprovedCount))
+    {
+        
+        writer.key(_XPLATSTR("unApprovedCount"));
+        ModelBase::writeJson(writer, m_UnApprovedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_EditedCount))
+    {
+        
+        writer.key(_XPLATSTR("editedCount"));
+        ModelBase::writeJson(writer, m_EditedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedCount))
+    {
+        
+        writer.key(_XPLATSTR("bannedCount"));
+        ModelBase::writeJson(writer, m_BannedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_UnFlaggedCount))
+    {
+        
+        writer.key(_XPLATSTR("unFlaggedCount"));
+        ModelBase::writeJson(writer, m_UnFlaggedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_VerificationId))
+    {
+        
+        writer.key(_XPLATSTR("verificationId"));
+        ModelBase::writeJson(writer, m_VerificationId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("moderationGroupIds"));
+        ModelBase::writeJson(writer, m_ModerationGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
+    {
+        
+        writer.key(_XPLATSTR("isEmailSuppressed"));
+        ModelBase::writeJson(writer, m_IsEmailSuppressed);
+    }
+
+    writer.endObject();
+}
+
 bool Moderator::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("acceptedInvite")):
+            if(field.first == _XPLATSTR("acceptedInvite"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAcceptedInvite;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAcceptedInvite);
+                    setAcceptedInvite(refVal_setAcceptedInvite);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("markReviewedCount")):
+            if(field.first == _XPLATSTR("markReviewedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMarkReviewedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMarkReviewedCount);
+                    setMarkReviewedCount(refVal_setMarkReviewedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("deletedCount")):
+            if(field.first == _XPLATSTR("deletedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setDeletedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDeletedCount);
+                    setDeletedCount(refVal_setDeletedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("markedSpamCount")):
+            if(field.first == _XPLATSTR("markedSpamCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMarkedSpamCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMarkedSpamCount);
+                    setMarkedSpamCount(refVal_setMarkedSpamCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("markedNotSpamCount")):
+            if(field.first == _XPLATSTR("markedNotSpamCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMarkedNotSpamCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMarkedNotSpamCount);
+                    setMarkedNotSpamCount(refVal_setMarkedNotSpamCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approvedCount")):
+            if(field.first == _XPLATSTR("approvedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setApprovedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApprovedCount);
+                    setApprovedCount(refVal_setApprovedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("unApprovedCount")):
+            if(field.first == _XPLATSTR("unApprovedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setUnApprovedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUnApprovedCount);
+                    setUnApprovedCount(refVal_setUnApprovedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("editedCount")):
+            if(field.first == _XPLATSTR("editedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setEditedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEditedCount);
+                    setEditedCount(refVal_setEditedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bannedCount")):
+            if(field.first == _XPLATSTR("bannedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setBannedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedCount);
+                    setBannedCount(refVal_setBannedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("unFlaggedCount")):
+            if(field.first == _XPLATSTR("unFlaggedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setUnFlaggedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUnFlaggedCount);
+                    setUnFlaggedCount(refVal_setUnFlaggedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verificationId")):
+            if(field.first == _XPLATSTR("verificationId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setVerificationId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerificationId);
+                    setVerificationId(refVal_setVerificationId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            if(field.first == _XPLATSTR("moderationGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModerationGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
+                    setModerationGroupIds(refVal_setModerationGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isEmailSuppressed")):
+            if(field.first == _XPLATSTR("isEmailSuppressed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsEmailSuppressed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsEmailSuppressed);
+                    setIsEmailSuppressed(refVal_setIsEmailSuppressed);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    return ok;
+}
+
+void Moderator::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("acceptedInvite"))))
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("acceptedInvite")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAcceptedInvite;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAcceptedInvite);
-            setAcceptedInvite(refVal_setAcceptedInvite);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("markReviewedCount"))))
+    if(m_FieldsSet.test(FieldBit_AcceptedInvite))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("markReviewedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMarkReviewedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMarkReviewedCount);
-            setMarkReviewedCount(refVal_setMarkReviewedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("acceptedInvite")), m_AcceptedInvite);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("deletedCount"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("deletedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setDeletedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDeletedCount);
-            setDeletedCount(refVal_setDeletedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("markedSpamCount"))))
+    if(m_FieldsSet.test(FieldBit_MarkReviewedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("markedSpamCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMarkedSpamCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMarkedSpamCount);
-            setMarkedSpamCount(refVal_setMarkedSpamCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("markReviewedCount")), m_MarkReviewedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("markedNotSpamCount"))))
+    if(m_FieldsSet.test(FieldBit_DeletedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("markedNotSpamCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMarkedNotSpamCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMarkedNotSpamCount);
-            setMarkedNotSpamCount(refVal_setMarkedNotSpamCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("deletedCount")), m_DeletedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approvedCount"))))
+    if(m_FieldsSet.test(FieldBit_MarkedSpamCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approvedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setApprovedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApprovedCount);
-            setApprovedCount(refVal_setApprovedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("markedSpamCount")), m_MarkedSpamCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("unApprovedCount"))))
+    if(m_FieldsSet.test(FieldBit_MarkedNotSpamCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("unApprovedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setUnApprovedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUnApprovedCount);
-            setUnApprovedCount(refVal_setUnApprovedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("markedNotSpamCount")), m_MarkedNotSpamCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("editedCount"))))
+    if(m_FieldsSet.test(FieldBit_ApprovedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("editedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setEditedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEditedCount);
-            setEditedCount(refVal_setEditedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approvedCount")), m_ApprovedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedCount"))))
+    if(m_FieldsSet.test(FieldBit_UnApprovedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setBannedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedCount);
-            setBannedCount(refVal_setBannedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("unApprovedCount")), m_UnApprovedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("unFlaggedCount"))))
+    if(m_FieldsSet.test(FieldBit_EditedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("unFlaggedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setUnFlaggedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUnFlaggedCount);
-            setUnFlaggedCount(refVal_setUnFlaggedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("editedCount")), m_EditedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verificationId"))))
+    if(m_FieldsSet.test(FieldBit_BannedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verificationId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setVerificationId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerificationId);
-            setVerificationId(refVal_setVerificationId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedCount")), m_BannedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_UnFlaggedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("unFlaggedCount")), m_UnFlaggedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds"))))
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModerationGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModerationGroupIds);
-            setModerationGroupIds(refVal_setModerationGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verificationId")), m_VerificationId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed"))))
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isEmailSuppressed")), m_IsEmailSuppressed);
+    }
+}
+
+bool Moderator::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setIsEmailSuppressed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsEmailSuppressed);
-            setIsEmailSuppressed(refVal_setIsEmailSuppressed);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("acceptedInvite")):
+            {
+                bool refVal_setAcceptedInvite;
+                if(!ModelBase::readBinary(reader, field, refVal_setAcceptedInvite))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAcceptedInvite(refVal_setAcceptedInvite);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("markReviewedCount")):
+            {
+                double refVal_setMarkReviewedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setMarkReviewedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMarkReviewedCount(refVal_setMarkReviewedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("deletedCount")):
+            {
+                double refVal_setDeletedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setDeletedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDeletedCount(refVal_setDeletedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("markedSpamCount")):
+            {
+                double refVal_setMarkedSpamCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setMarkedSpamCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMarkedSpamCount(refVal_setMarkedSpamCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("markedNotSpamCount")):
+            {
+                double refVal_setMarkedNotSpamCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setMarkedNotSpamCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMarkedNotSpamCount(refVal_setMarkedNotSpamCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approvedCount")):
+            {
+                double refVal_setApprovedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setApprovedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApprovedCount(refVal_setApprovedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("unApprovedCount")):
+            {
+                double refVal_setUnApprovedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setUnApprovedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUnApprovedCount(refVal_setUnApprovedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("editedCount")):
+            {
+                double refVal_setEditedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setEditedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEditedCount(refVal_setEditedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bannedCount")):
+            {
+                double refVal_setBannedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedCount(refVal_setBannedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("unFlaggedCount")):
+            {
+                double refVal_setUnFlaggedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setUnFlaggedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUnFlaggedCount(refVal_setUnFlaggedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verificationId")):
+            {
+                utility::string_t refVal_setVerificationId;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerificationId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerificationId(refVal_setVerificationId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderationGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setModerationGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModerationGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModerationGroupIds(refVal_setModerationGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isEmailSuppressed")):
+            {
+                bool refVal_setIsEmailSuppressed;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsEmailSuppressed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsEmailSuppressed(refVal_setIsEmailSuppressed);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void Moderator::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -383,79 +844,79 @@ void Moderator::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_Name.has_value())
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_AcceptedInviteIsSet)
+    if(m_FieldsSet.test(FieldBit_AcceptedInvite))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("acceptedInvite")), m_AcceptedInvite));
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_MarkReviewedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MarkReviewedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("markReviewedCount")), m_MarkReviewedCount));
     }
-    if(m_DeletedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_DeletedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("deletedCount")), m_DeletedCount));
     }
-    if(m_MarkedSpamCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MarkedSpamCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("markedSpamCount")), m_MarkedSpamCount));
     }
-    if(m_MarkedNotSpamCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MarkedNotSpamCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("markedNotSpamCount")), m_MarkedNotSpamCount));
     }
-    if(m_ApprovedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ApprovedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approvedCount")), m_ApprovedCount));
     }
-    if(m_UnApprovedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_UnApprovedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("unApprovedCount")), m_UnApprovedCount));
     }
-    if(m_EditedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_EditedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("editedCount")), m_EditedCount));
     }
-    if(m_BannedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedCount")), m_BannedCount));
     }
-    if(m_UnFlaggedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_UnFlaggedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("unFlaggedCount")), m_UnFlaggedCount));
     }
-    if(m_VerificationId.has_value())
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verificationId")), m_VerificationId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verificationId")), m_VerificationId));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_ModerationGroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_ModerationGroupIds))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderationGroupIds")), m_ModerationGroupIds));
     }
-    if(m_IsEmailSuppressedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed")), m_IsEmailSuppressed));
     }
@@ -597,17 +1058,17 @@ utility::string_t Moderator::getId() const
 void Moderator::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool Moderator::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void Moderator::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t Moderator::getTenantId() const
 {
@@ -618,57 +1079,59 @@ utility::string_t Moderator::getTenantId() const
 void Moderator::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool Moderator::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void Moderator::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t Moderator::getName() const
 {
-    return m_Name.get();
+    return m_Name;
 }
 
 
 void Moderator::setName(const utility::string_t& value)
 {
     m_Name = value;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool Moderator::nameIsSet() const
 {
-    return m_Name.has_value();
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void Moderator::unsetName()
 {
-    m_Name.reset();
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t Moderator::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void Moderator::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool Moderator::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void Moderator::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 bool Moderator::isAcceptedInvite() const
 {
@@ -678,37 +1141,38 @@ bool Moderator::isAcceptedInvite() const
 void Moderator::setAcceptedInvite(bool value)
 {
     m_AcceptedInvite = value;
-    m_AcceptedInviteIsSet = true;
+    m_FieldsSet.set(FieldBit_AcceptedInvite);
 }
 
 bool Moderator::acceptedInviteIsSet() const
 {
-    return m_AcceptedInviteIsSet;
+    return m_FieldsSet.test(FieldBit_AcceptedInvite);
 }
 
 void Moderator::unsetAcceptedInvite()
 {
-    m_AcceptedInviteIsSet = false;
+    m_FieldsSet.reset(FieldBit_AcceptedInvite);
 }
 utility::string_t Moderator::getEmail() const
 {
-    return m_Email.get();
+    return m_Email;
 }
 
 
 void Moderator::setEmail(const utility::string_t& value)
 {
     m_Email = value;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool Moderator::emailIsSet() const
 {
-    return m_Email.has_value();
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void Moderator::unsetEmail()
 {
-    m_Email.reset();
+    m_FieldsSet.reset(FieldBit_Email);
 }
 double Moderator::getMarkReviewedCount() const
 {
@@ -718,17 +1182,17 @@ double Moderator::getMarkReviewedCount() const
 void Moderator::setMarkReviewedCount(double value)
 {
     m_MarkReviewedCount = value;
-    m_MarkReviewedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_MarkReviewedCount);
 }
 
 bool Moderator::markReviewedCountIsSet() const
 {
-    return m_MarkReviewedCountIsSet;
+    return m_FieldsSet.test(FieldBit_MarkReviewedCount);
 }
 
 void Moderator::unsetMarkReviewedCount()
 {
-    m_MarkReviewedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_MarkReviewedCount);
 }
 double Moderator::getDeletedCount() const
 {
@@ -738,17 +1202,17 @@ double Moderator::getDeletedCount() const
 void Moderator::setDeletedCount(double value)
 {
     m_DeletedCount = value;
-    m_DeletedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_DeletedCount);
 }
 
 bool Moderator::deletedCountIsSet() const
 {
-    return m_DeletedCountIsSet;
+    return m_FieldsSet.test(FieldBit_DeletedCount);
 }
 
 void Moderator::unsetDeletedCount()
 {
-    m_DeletedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_DeletedCount);
 }
 double Moderator::getMarkedSpamCount() const
 {
@@ -758,17 +1222,17 @@ double Moderator::getMarkedSpamCount() const
 void Moderator::setMarkedSpamCount(double value)
 {
     m_MarkedSpamCount = value;
-    m_MarkedSpamCountIsSet = true;
+    m_FieldsSet.set(FieldBit_MarkedSpamCount);
 }
 
 bool Moderator::markedSpamCountIsSet() const
 {
-    return m_MarkedSpamCountIsSet;
+    return m_FieldsSet.test(FieldBit_MarkedSpamCount);
 }
 
 void Moderator::unsetMarkedSpamCount()
 {
-    m_MarkedSpamCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_MarkedSpamCount);
 }
 double Moderator::getMarkedNotSpamCount() const
 {
@@ -778,17 +1242,17 @@ double Moderator::getMarkedNotSpamCount() const
 void Moderator::setMarkedNotSpamCount(double value)
 {
     m_MarkedNotSpamCount = value;
-    m_MarkedNotSpamCountIsSet = true;
+    m_FieldsSet.set(FieldBit_MarkedNotSpamCount);
 }
 
 bool Moderator::markedNotSpamCountIsSet() const
 {
-    return m_MarkedNotSpamCountIsSet;
+    return m_FieldsSet.test(FieldBit_MarkedNotSpamCount);
 }
 
 void Moderator::unsetMarkedNotSpamCount()
 {
-    m_MarkedNotSpamCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_MarkedNotSpamCount);
 }
 double Moderator::getApprovedCount() const
 {
@@ -798,17 +1262,17 @@ double Moderator::getApprovedCount() const
 void Moderator::setApprovedCount(double value)
 {
     m_ApprovedCount = value;
-    m_ApprovedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_ApprovedCount);
 }
 
 bool Moderator::approvedCountIsSet() const
 {
-    return m_ApprovedCountIsSet;
+    return m_FieldsSet.test(FieldBit_ApprovedCount);
 }
 
 void Moderator::unsetApprovedCount()
 {
-    m_ApprovedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_ApprovedCount);
 }
 double Moderator::getUnApprovedCount() const
 {
@@ -818,17 +1282,17 @@ double Moderator::getUnApprovedCount() const
 void Moderator::setUnApprovedCount(double value)
 {
     m_UnApprovedCount = value;
-    m_UnApprovedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_UnApprovedCount);
 }
 
 bool Moderator::unApprovedCountIsSet() const
 {
-    return m_UnApprovedCountIsSet;
+    return m_FieldsSet.test(FieldBit_UnApprovedCount);
 }
 
 void Moderator::unsetUnApprovedCount()
 {
-    m_UnApprovedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_UnApprovedCount);
 }
 double Moderator::getEditedCount() const
 {
@@ -838,17 +1302,17 @@ double Moderator::getEditedCount() const
 void Moderator::setEditedCount(double value)
 {
     m_EditedCount = value;
-    m_EditedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_EditedCount);
 }
 
 bool Moderator::editedCountIsSet() const
 {
-    return m_EditedCountIsSet;
+    return m_FieldsSet.test(FieldBit_EditedCount);
 }
 
 void Moderator::unsetEditedCount()
 {
-    m_EditedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_EditedCount);
 }
 double Moderator::getBannedCount() const
 {
@@ -858,17 +1322,17 @@ double Moderator::getBannedCount() const
 void Moderator::setBannedCount(double value)
 {
     m_BannedCount = value;
-    m_BannedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_BannedCount);
 }
 
 bool Moderator::bannedCountIsSet() const
 {
-    return m_BannedCountIsSet;
+    return m_FieldsSet.test(FieldBit_BannedCount);
 }
 
 void Moderator::unsetBannedCount()
 {
-    m_BannedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_BannedCount);
 }
 double Moderator::getUnFlaggedCount() const
 {
@@ -878,37 +1342,38 @@ double Moderator::getUnFlaggedCount() const
 void Moderator::setUnFlaggedCount(double value)
 {
     m_UnFlaggedCount = value;
-    m_UnFlaggedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_UnFlaggedCount);
 }
 
 bool Moderator::unFlaggedCountIsSet() const
 {
-    return m_UnFlaggedCountIsSet;
+    return m_FieldsSet.test(FieldBit_UnFlaggedCount);
 }
 
 void Moderator::unsetUnFlaggedCount()
 {
-    m_UnFlaggedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_UnFlaggedCount);
 }
 utility::string_t Moderator::getVerificationId() const
 {
-    return m_VerificationId.get();
+    return m_VerificationId;
 }
 
 
 void Moderator::setVerificationId(const utility::string_t& value)
 {
     m_VerificationId = value;
+    m_FieldsSet.set(FieldBit_VerificationId);
 }
 
 bool Moderator::verificationIdIsSet() const
 {
-    return m_VerificationId.has_value();
+    return m_FieldsSet.test(FieldBit_VerificationId);
 }
 
 void Moderator::unsetVerificationId()
 {
-    m_VerificationId.reset();
+    m_FieldsSet.reset(FieldBit_VerificationId);
 }
 utility::datetime Moderator::getCreatedAt() const
 {
@@ -919,37 +1384,38 @@ utility::datetime Moderator::getCreatedAt() const
 void Moderator::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool Moderator::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void Moderator::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 std::vector<utility::string_t> Moderator::getModerationGroupIds() const
 {
-    return m_ModerationGroupIds.get();
+    return m_ModerationGroupIds;
 }
 
 
 void Moderator::setModerationGroupIds(const std::vector<utility::string_t>& value)
 {
     m_ModerationGroupIds = value;
+    m_FieldsSet.set(FieldBit_ModerationGroupIds);
 }
 
 bool Moderator::moderationGroupIdsIsSet() const
 {
-    return m_ModerationGroupIds.has_value();
+    return m_FieldsSet.test(FieldBit_ModerationGroupIds);
 }
 
 void Moderator::unsetModerationGroupIds()
 {
-    m_ModerationGroupIds.reset();
+    m_FieldsSet.reset(FieldBit_ModerationGroupIds);
 }
 bool Moderator::isIsEmailSuppressed() const
 {
@@ -959,17 +1425,17 @@ bool Moderator::isIsEmailSuppressed() const
 void Moderator::setIsEmailSuppressed(bool value)
 {
     m_IsEmailSuppressed = value;
-    m_IsEmailSuppressedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsEmailSuppressed);
 }
 
 bool Moderator::isEmailSuppressedIsSet() const
 {
-    return m_IsEmailSuppressedIsSet;
+    return m_FieldsSet.test(FieldBit_IsEmailSuppressed);
 }
 
 void Moderator::unsetIsEmailSuppressed()
 {
-    m_IsEmailSuppressedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsEmailSuppressed);
 }
 
 }
@@ -20,9 +20,7 @@ namespace model {
 
 NotificationAndCount::NotificationAndCount()
 {
-    m_TypeIsSet = false;
     m_Count = 0L;
-    m_CountIsSet = false;
 }
 
 NotificationAndCount::~NotificationAndCount()
@@ -37,12 +35,12 @@ void NotificationAndCount::validate()
 web::json::value NotificationAndCount::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("count"))] = ModelBase::toJson(m_Count);
@@ -51,32 +49,119 @@ web::json::value NotificationAndCount::toJson() const
     return val;
 }
 
+void NotificationAndCount::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Count))
+    {
+        
+        writer.key(_XPLATSTR("count"));
+        ModelBase::writeJson(writer, m_Count);
+    }
+
+    writer.endObject();
+}
+
 bool NotificationAndCount::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<NotificationType> refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<NotificationType> refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            if(field.first == _XPLATSTR("count"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
+                    setCount(refVal_setCount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("count"))))
+    return ok;
+}
+
+void NotificationAndCount::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("count")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Count))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("count")), m_Count);
+    }
+}
+
+bool NotificationAndCount::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int64_t refVal_setCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
-            setCount(refVal_setCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                std::shared_ptr<NotificationType> refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            {
+                int64_t refVal_setCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCount(refVal_setCount);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void NotificationAndCount::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +171,11 @@ void NotificationAndCount::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("count")), m_Count));
     }
@@ -130,17 +215,17 @@ std::shared_ptr<NotificationType> NotificationAndCount::getType() const
 void NotificationAndCount::setType(const std::shared_ptr<NotificationType>& value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool NotificationAndCount::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void NotificationAndCount::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 int64_t NotificationAndCount::getCount() const
 {
@@ -150,17 +235,17 @@ int64_t NotificationAndCount::getCount() const
 void NotificationAndCount::setCount(int64_t value)
 {
     m_Count = value;
-    m_CountIsSet = true;
+    m_FieldsSet.set(FieldBit_Count);
 }
 
 bool NotificationAndCount::countIsSet() const
 {
-    return m_CountIsSet;
+    return m_FieldsSet.test(FieldBit_Count);
 }
 
 void NotificationAndCount::unsetCount()
 {
-    m_CountIsSet = false;
+    m_FieldsSet.reset(FieldBit_Count);
 }
 
 }
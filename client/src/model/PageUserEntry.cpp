@@ -21,13 +21,6 @@ namespace model {
 PageUserEntry::PageUserEntry()
 {
     m_IsPrivate = false;
-    m_IsPrivateIsSet = false;
-    m_AvatarSrc = utility::conversions::to_string_t("");
-    m_AvatarSrcIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
 }
 
 PageUserEntry::~PageUserEntry()
@@ -42,22 +35,22 @@ void PageUserEntry::validate()
 web::json::value PageUserEntry::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IsPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsPrivate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isPrivate"))] = ModelBase::toJson(m_IsPrivate);
     }
-    if(m_AvatarSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
@@ -66,54 +59,187 @@ web::json::value PageUserEntry::toJson() const
     return val;
 }
 
+void PageUserEntry::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_IsPrivate))
+    {
+        
+        writer.key(_XPLATSTR("isPrivate"));
+        ModelBase::writeJson(writer, m_IsPrivate);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+
+    writer.endObject();
+}
+
 bool PageUserEntry::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isPrivate"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isPrivate")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsPrivate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsPrivate);
-            setIsPrivate(refVal_setIsPrivate);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isPrivate")):
+            if(field.first == _XPLATSTR("isPrivate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsPrivate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsPrivate);
+                    setIsPrivate(refVal_setIsPrivate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    return ok;
+}
+
+void PageUserEntry::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_IsPrivate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isPrivate")), m_IsPrivate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
+    }
+}
+
+bool PageUserEntry::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isPrivate")):
+            {
+                bool refVal_setIsPrivate;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsPrivate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsPrivate(refVal_setIsPrivate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PageUserEntry::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -123,19 +249,19 @@ void PageUserEntry::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IsPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsPrivate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPrivate")), m_IsPrivate));
     }
-    if(m_AvatarSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
@@ -186,17 +312,17 @@ bool PageUserEntry::isIsPrivate() const
 void PageUserEntry::setIsPrivate(bool value)
 {
     m_IsPrivate = value;
-    m_IsPrivateIsSet = true;
+    m_FieldsSet.set(FieldBit_IsPrivate);
 }
 
 bool PageUserEntry::isPrivateIsSet() const
 {
-    return m_IsPrivateIsSet;
+    return m_FieldsSet.test(FieldBit_IsPrivate);
 }
 
 void PageUserEntry::unsetIsPrivate()
 {
-    m_IsPrivateIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsPrivate);
 }
 utility::string_t PageUserEntry::getAvatarSrc() const
 {
@@ -207,17 +333,17 @@ utility::string_t PageUserEntry::getAvatarSrc() const
 void PageUserEntry::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
-    m_AvatarSrcIsSet = true;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool PageUserEntry::avatarSrcIsSet() const
 {
-    return m_AvatarSrcIsSet;
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void PageUserEntry::unsetAvatarSrc()
 {
-    m_AvatarSrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 utility::string_t PageUserEntry::getDisplayName() const
 {
@@ -228,17 +354,17 @@ utility::string_t PageUserEntry::getDisplayName() const
 void PageUserEntry::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool PageUserEntry::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void PageUserEntry::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::string_t PageUserEntry::getId() const
 {
@@ -249,17 +375,17 @@ utility::string_t PageUserEntry::getId() const
 void PageUserEntry::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool PageUserEntry::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void PageUserEntry::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 PageUsersInfoResponse::PageUsersInfoResponse()
 {
-    m_UsersIsSet = false;
-    m_StatusIsSet = false;
 }
 
 PageUsersInfoResponse::~PageUsersInfoResponse()
@@ -36,12 +34,12 @@ void PageUsersInfoResponse::validate()
 web::json::value PageUsersInfoResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("users"))] = ModelBase::toJson(m_Users);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -50,32 +48,119 @@ web::json::value PageUsersInfoResponse::toJson() const
     return val;
 }
 
+void PageUsersInfoResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        writer.key(_XPLATSTR("users"));
+        ModelBase::writeJson(writer, m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool PageUsersInfoResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("users"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("users")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
-            setUsers(refVal_setUsers);
-            
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            if(field.first == _XPLATSTR("users"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
+                    setUsers(refVal_setUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void PageUsersInfoResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Users))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("users")), m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool PageUsersInfoResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            {
+                std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsers(refVal_setUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PageUsersInfoResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void PageUsersInfoResponse::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("users")), m_Users));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ std::vector<std::shared_ptr<PageUserEntry>> PageUsersInfoResponse::getUsers() co
 void PageUsersInfoResponse::setUsers(const std::vector<std::shared_ptr<PageUserEntry>>& value)
 {
     m_Users = value;
-    m_UsersIsSet = true;
+    m_FieldsSet.set(FieldBit_Users);
 }
 
 bool PageUsersInfoResponse::usersIsSet() const
 {
-    return m_UsersIsSet;
+    return m_FieldsSet.test(FieldBit_Users);
 }
 
 void PageUsersInfoResponse::unsetUsers()
 {
-    m_UsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Users);
 }
 std::shared_ptr<APIStatus> PageUsersInfoResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> PageUsersInfoResponse::getStatus() const
 void PageUsersInfoResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool PageUsersInfoResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void PageUsersInfoResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 PageUsersOfflineResponse::PageUsersOfflineResponse()
 {
-    m_UsersIsSet = false;
-    m_StatusIsSet = false;
 }
 
 PageUsersOfflineResponse::~PageUsersOfflineResponse()
@@ -36,22 +34,22 @@ void PageUsersOfflineResponse::validate()
 web::json::value PageUsersOfflineResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NextAfterUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId"))] = ModelBase::toJson(m_NextAfterUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId"))] = ModelBase::toJson(m_NextAfterUserId);
     }
-    if(m_NextAfterName.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterName"))] = ModelBase::toJson(m_NextAfterName.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterName"))] = ModelBase::toJson(m_NextAfterName);
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("users"))] = ModelBase::toJson(m_Users);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -60,54 +58,187 @@ web::json::value PageUsersOfflineResponse::toJson() const
     return val;
 }
 
+void PageUsersOfflineResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
+    {
+        
+        writer.key(_XPLATSTR("nextAfterUserId"));
+        ModelBase::writeJson(writer, m_NextAfterUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
+    {
+        
+        writer.key(_XPLATSTR("nextAfterName"));
+        ModelBase::writeJson(writer, m_NextAfterName);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        writer.key(_XPLATSTR("users"));
+        ModelBase::writeJson(writer, m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool PageUsersOfflineResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setNextAfterUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterUserId);
-            setNextAfterUserId(refVal_setNextAfterUserId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("nextAfterName"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("nextAfterName")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setNextAfterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterName);
-            setNextAfterName(refVal_setNextAfterName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterUserId")):
+            if(field.first == _XPLATSTR("nextAfterUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNextAfterUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterUserId);
+                    setNextAfterUserId(refVal_setNextAfterUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterName")):
+            if(field.first == _XPLATSTR("nextAfterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNextAfterName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterName);
+                    setNextAfterName(refVal_setNextAfterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            if(field.first == _XPLATSTR("users"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
+                    setUsers(refVal_setUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("users"))))
+    return ok;
+}
+
+void PageUsersOfflineResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("users")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
-            setUsers(refVal_setUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("nextAfterUserId")), m_NextAfterUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("nextAfterName")), m_NextAfterName);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("users")), m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool PageUsersOfflineResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterUserId")):
+            {
+                utility::string_t refVal_setNextAfterUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setNextAfterUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNextAfterUserId(refVal_setNextAfterUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterName")):
+            {
+                utility::string_t refVal_setNextAfterName;
+                if(!ModelBase::readBinary(reader, field, refVal_setNextAfterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNextAfterName(refVal_setNextAfterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            {
+                std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsers(refVal_setUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PageUsersOfflineResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -117,19 +248,19 @@ void PageUsersOfflineResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NextAfterUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId")), m_NextAfterUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId")), m_NextAfterUserId));
     }
-    if(m_NextAfterName.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterName")), m_NextAfterName.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterName")), m_NextAfterName));
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("users")), m_Users));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -174,43 +305,45 @@ bool PageUsersOfflineResponse::fromMultiPart(std::shared_ptr<MultipartFormData>
 
 utility::string_t PageUsersOfflineResponse::getNextAfterUserId() const
 {
-    return m_NextAfterUserId.get();
+    return m_NextAfterUserId;
 }
 
 
 void PageUsersOfflineResponse::setNextAfterUserId(const utility::string_t& value)
 {
     m_NextAfterUserId = value;
+    m_FieldsSet.set(FieldBit_NextAfterUserId);
 }
 
 bool PageUsersOfflineResponse::nextAfterUserIdIsSet() const
 {
-    return m_NextAfterUserId.has_value();
+    return m_FieldsSet.test(FieldBit_NextAfterUserId);
 }
 
 void PageUsersOfflineResponse::unsetNextAfterUserId()
 {
-    m_NextAfterUserId.reset();
+    m_FieldsSet.reset(FieldBit_NextAfterUserId);
 }
 utility::string_t PageUsersOfflineResponse::getNextAfterName() const
 {
-    return m_NextAfterName.get();
+    return m_NextAfterName;
 }
 
 
 void PageUsersOfflineResponse::setNextAfterName(const utility::string_t& value)
 {
     m_NextAfterName = value;
+    m_FieldsSet.set(FieldBit_NextAfterName);
 }
 
 bool PageUsersOfflineResponse::nextAfterNameIsSet() const
 {
-    return m_NextAfterName.has_value();
+    return m_FieldsSet.test(FieldBit_NextAfterName);
 }
 
 void PageUsersOfflineResponse::unsetNextAfterName()
 {
-    m_NextAfterName.reset();
+    m_FieldsSet.reset(FieldBit_NextAfterName);
 }
 std::vector<std::shared_ptr<PageUserEntry>> PageUsersOfflineResponse::getUsers() const
 {
@@ -221,17 +354,17 @@ std::vector<std::shared_ptr<PageUserEntry>> PageUsersOfflineResponse::getUsers()
 void PageUsersOfflineResponse::setUsers(const std::vector<std::shared_ptr<PageUserEntry>>& value)
 {
     m_Users = value;
-    m_UsersIsSet = true;
+    m_FieldsSet.set(FieldBit_Users);
 }
 
 bool PageUsersOfflineResponse::usersIsSet() const
 {
-    return m_UsersIsSet;
+    return m_FieldsSet.test(FieldBit_Users);
 }
 
 void PageUsersOfflineResponse::unsetUsers()
 {
-    m_UsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Users);
 }
 std::shared_ptr<APIStatus> PageUsersOfflineResponse::getStatus() const
 {
@@ -242,17 +375,17 @@ std::shared_ptr<APIStatus> PageUsersOfflineResponse::getStatus() const
 void PageUsersOfflineResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool PageUsersOfflineResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void PageUsersOfflineResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -21,11 +21,7 @@ namespace model {
 PageUsersOnlineResponse::PageUsersOnlineResponse()
 {
     m_TotalCount = 0.0;
-    m_TotalCountIsSet = false;
     m_AnonCount = 0.0;
-    m_AnonCountIsSet = false;
-    m_UsersIsSet = false;
-    m_StatusIsSet = false;
 }
 
 PageUsersOnlineResponse::~PageUsersOnlineResponse()
@@ -40,32 +36,32 @@ void PageUsersOnlineResponse::validate()
 web::json::value PageUsersOnlineResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NextAfterUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId"))] = ModelBase::toJson(m_NextAfterUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId"))] = ModelBase::toJson(m_NextAfterUserId);
     }
-    if(m_NextAfterName.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterName"))] = ModelBase::toJson(m_NextAfterName.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("nextAfterName"))] = ModelBase::toJson(m_NextAfterName);
     }
-    if(m_TotalCountIsSet)
+    if(m_FieldsSet.test(FieldBit_TotalCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("totalCount"))] = ModelBase::toJson(m_TotalCount);
     }
-    if(m_AnonCountIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("anonCount"))] = ModelBase::toJson(m_AnonCount);
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("users"))] = ModelBase::toJson(m_Users);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -74,76 +70,255 @@ web::json::value PageUsersOnlineResponse::toJson() const
     return val;
 }
 
+void PageUsersOnlineResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
+    {
+        
+        writer.key(_XPLATSTR("nextAfterUserId"));
+        ModelBase::writeJson(writer, m_NextAfterUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
+    {
+        
+        writer.key(_XPLATSTR("nextAfterName"));
+        ModelBase::writeJson(writer, m_NextAfterName);
+    }
+    if(m_FieldsSet.test(FieldBit_TotalCount))
+    {
+        
+        writer.key(_XPLATSTR("totalCount"));
+        ModelBase::writeJson(writer, m_TotalCount);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonCount))
+    {
+        
+        writer.key(_XPLATSTR("anonCount"));
+        ModelBase::writeJson(writer, m_AnonCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        writer.key(_XPLATSTR("users"));
+        ModelBase::writeJson(writer, m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool PageUsersOnlineResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setNextAfterUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterUserId);
-            setNextAfterUserId(refVal_setNextAfterUserId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("nextAfterName"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("nextAfterName")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setNextAfterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterName);
-            setNextAfterName(refVal_setNextAfterName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterUserId")):
+            if(field.first == _XPLATSTR("nextAfterUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNextAfterUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterUserId);
+                    setNextAfterUserId(refVal_setNextAfterUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterName")):
+            if(field.first == _XPLATSTR("nextAfterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNextAfterName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNextAfterName);
+                    setNextAfterName(refVal_setNextAfterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("totalCount")):
+            if(field.first == _XPLATSTR("totalCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setTotalCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTotalCount);
+                    setTotalCount(refVal_setTotalCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonCount")):
+            if(field.first == _XPLATSTR("anonCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAnonCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonCount);
+                    setAnonCount(refVal_setAnonCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            if(field.first == _XPLATSTR("users"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
+                    setUsers(refVal_setUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("totalCount"))))
+    return ok;
+}
+
+void PageUsersOnlineResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("totalCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setTotalCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTotalCount);
-            setTotalCount(refVal_setTotalCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("nextAfterUserId")), m_NextAfterUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonCount"))))
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAnonCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonCount);
-            setAnonCount(refVal_setAnonCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("nextAfterName")), m_NextAfterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("users"))))
+    if(m_FieldsSet.test(FieldBit_TotalCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("users")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
-            setUsers(refVal_setUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("totalCount")), m_TotalCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(m_FieldsSet.test(FieldBit_AnonCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonCount")), m_AnonCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("users")), m_Users);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool PageUsersOnlineResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterUserId")):
+            {
+                utility::string_t refVal_setNextAfterUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setNextAfterUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNextAfterUserId(refVal_setNextAfterUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("nextAfterName")):
+            {
+                utility::string_t refVal_setNextAfterName;
+                if(!ModelBase::readBinary(reader, field, refVal_setNextAfterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNextAfterName(refVal_setNextAfterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("totalCount")):
+            {
+                double refVal_setTotalCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setTotalCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTotalCount(refVal_setTotalCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonCount")):
+            {
+                double refVal_setAnonCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonCount(refVal_setAnonCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            {
+                std::vector<std::shared_ptr<PageUserEntry>> refVal_setUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsers(refVal_setUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PageUsersOnlineResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -153,27 +328,27 @@ void PageUsersOnlineResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NextAfterUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId")), m_NextAfterUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterUserId")), m_NextAfterUserId));
     }
-    if(m_NextAfterName.has_value())
+    if(m_FieldsSet.test(FieldBit_NextAfterName))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterName")), m_NextAfterName.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAfterName")), m_NextAfterName));
     }
-    if(m_TotalCountIsSet)
+    if(m_FieldsSet.test(FieldBit_TotalCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("totalCount")), m_TotalCount));
     }
-    if(m_AnonCountIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonCount")), m_AnonCount));
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("users")), m_Users));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -230,43 +405,45 @@ bool PageUsersOnlineResponse::fromMultiPart(std::shared_ptr<MultipartFormData> m
 
 utility::string_t PageUsersOnlineResponse::getNextAfterUserId() const
 {
-    return m_NextAfterUserId.get();
+    return m_NextAfterUserId;
 }
 
 
 void PageUsersOnlineResponse::setNextAfterUserId(const utility::string_t& value)
 {
     m_NextAfterUserId = value;
+    m_FieldsSet.set(FieldBit_NextAfterUserId);
 }
 
 bool PageUsersOnlineResponse::nextAfterUserIdIsSet() const
 {
-    return m_NextAfterUserId.has_value();
+    return m_FieldsSet.test(FieldBit_NextAfterUserId);
 }
 
 void PageUsersOnlineResponse::unsetNextAfterUserId()
 {
-    m_NextAfterUserId.reset();
+    m_FieldsSet.reset(FieldBit_NextAfterUserId);
 }
 utility::string_t PageUsersOnlineResponse::getNextAfterName() const
 {
-    return m_NextAfterName.get();
+    return m_NextAfterName;
 }
 
 
 void PageUsersOnlineResponse::setNextAfterName(const utility::string_t& value)
 {
     m_NextAfterName = value;
+    m_FieldsSet.set(FieldBit_NextAfterName);
 }
 
 bool PageUsersOnlineResponse::nextAfterNameIsSet() const
 {
-    return m_NextAfterName.has_value();
+    return m_FieldsSet.test(FieldBit_NextAfterName);
 }
 
 void PageUsersOnlineResponse::unsetNextAfterName()
 {
-    m_NextAfterName.reset();
+    m_FieldsSet.reset(FieldBit_NextAfterName);
 }
 double PageUsersOnlineResponse::getTotalCount() const
 {
@@ -276,17 +453,17 @@ double PageUsersOnlineResponse::getTotalCount() const
 void PageUsersOnlineResponse::setTotalCount(double value)
 {
     m_TotalCount = value;
-    m_TotalCountIsSet = true;
+    m_FieldsSet.set(FieldBit_TotalCount);
 }
 
 bool PageUsersOnlineResponse::totalCountIsSet() const
 {
-    return m_TotalCountIsSet;
+    return m_FieldsSet.test(FieldBit_TotalCount);
 }
 
 void PageUsersOnlineResponse::unsetTotalCount()
 {
-    m_TotalCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_TotalCount);
 }
 double PageUsersOnlineResponse::getAnonCount() const
 {
@@ -296,17 +473,17 @@ double PageUsersOnlineResponse::getAnonCount() const
 void PageUsersOnlineResponse::setAnonCount(double value)
 {
     m_AnonCount = value;
-    m_AnonCountIsSet = true;
+    m_FieldsSet.set(FieldBit_AnonCount);
 }
 
 bool PageUsersOnlineResponse::anonCountIsSet() const
 {
-    return m_AnonCountIsSet;
+    return m_FieldsSet.test(FieldBit_AnonCount);
 }
 
 void PageUsersOnlineResponse::unsetAnonCount()
 {
-    m_AnonCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_AnonCount);
 }
 std::vector<std::shared_ptr<PageUserEntry>> PageUsersOnlineResponse::getUsers() const
 {
@@ -317,17 +494,17 @@ std::vector<std::shared_ptr<PageUserEntry>> PageUsersOnlineResponse::getUsers()
 void PageUsersOnlineResponse::setUsers(const std::vector<std::shared_ptr<PageUserEntry>>& value)
 {
     m_Users = value;
-    m_UsersIsSet = true;
+    m_FieldsSet.set(FieldBit_Users);
 }
 
 bool PageUsersOnlineResponse::usersIsSet() const
 {
-    return m_UsersIsSet;
+    return m_FieldsSet.test(FieldBit_Users);
 }
 
 void PageUsersOnlineResponse::unsetUsers()
 {
-    m_UsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Users);
 }
 std::shared_ptr<APIStatus> PageUsersOnlineResponse::getStatus() const
 {
@@ -338,17 +515,17 @@ std::shared_ptr<APIStatus> PageUsersOnlineResponse::getStatus() const
 void PageUsersOnlineResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool PageUsersOnlineResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void PageUsersOnlineResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,19 +20,6 @@ namespace model {
 
 PatchDomainConfigParams::PatchDomainConfigParams()
 {
-    m_Domain = utility::conversions::to_string_t("");
-    m_DomainIsSet = false;
-    m_EmailFromName = utility::conversions::to_string_t("");
-    m_EmailFromNameIsSet = false;
-    m_EmailFromEmail = utility::conversions::to_string_t("");
-    m_EmailFromEmailIsSet = false;
-    m_LogoSrc = utility::conversions::to_string_t("");
-    m_LogoSrcIsSet = false;
-    m_LogoSrc100px = utility::conversions::to_string_t("");
-    m_LogoSrc100pxIsSet = false;
-    m_FooterUnsubscribeURL = utility::conversions::to_string_t("");
-    m_FooterUnsubscribeURLIsSet = false;
-    m_EmailHeadersIsSet = false;
 }
 
 PatchDomainConfigParams::~PatchDomainConfigParams()
@@ -47,37 +34,37 @@ void PatchDomainConfigParams::validate()
 web::json::value PatchDomainConfigParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_EmailFromNameIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailFromName"))] = ModelBase::toJson(m_EmailFromName);
     }
-    if(m_EmailFromEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailFromEmail"))] = ModelBase::toJson(m_EmailFromEmail);
     }
-    if(m_LogoSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("logoSrc"))] = ModelBase::toJson(m_LogoSrc);
     }
-    if(m_LogoSrc100pxIsSet)
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))] = ModelBase::toJson(m_LogoSrc100px);
     }
-    if(m_FooterUnsubscribeURLIsSet)
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL"))] = ModelBase::toJson(m_FooterUnsubscribeURL);
     }
-    if(m_EmailHeadersIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailHeaders"))] = ModelBase::toJson(m_EmailHeaders);
@@ -86,87 +73,289 @@ web::json::value PatchDomainConfigParams::toJson() const
     return val;
 }
 
+void PatchDomainConfigParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
+    {
+        
+        writer.key(_XPLATSTR("emailFromName"));
+        ModelBase::writeJson(writer, m_EmailFromName);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
+    {
+        
+        writer.key(_XPLATSTR("emailFromEmail"));
+        ModelBase::writeJson(writer, m_EmailFromEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
+    {
+        
+        writer.key(_XPLATSTR("logoSrc"));
+        ModelBase::writeJson(writer, m_LogoSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
+    {
+        
+        writer.key(_XPLATSTR("logoSrc100px"));
+        ModelBase::writeJson(writer, m_LogoSrc100px);
+    }
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
+    {
+        
+        writer.key(_XPLATSTR("footerUnsubscribeURL"));
+        ModelBase::writeJson(writer, m_FooterUnsubscribeURL);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
+    {
+        
+        writer.key(_XPLATSTR("emailHeaders"));
+        ModelBase::writeJson(writer, m_EmailHeaders);
+    }
+
+    writer.endObject();
+}
+
 bool PatchDomainConfigParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailFromName"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailFromName")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setEmailFromName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromName);
-            setEmailFromName(refVal_setEmailFromName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromName")):
+            if(field.first == _XPLATSTR("emailFromName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailFromName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromName);
+                    setEmailFromName(refVal_setEmailFromName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromEmail")):
+            if(field.first == _XPLATSTR("emailFromEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailFromEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromEmail);
+                    setEmailFromEmail(refVal_setEmailFromEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc")):
+            if(field.first == _XPLATSTR("logoSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLogoSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc);
+                    setLogoSrc(refVal_setLogoSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc100px")):
+            if(field.first == _XPLATSTR("logoSrc100px"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLogoSrc100px;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc100px);
+                    setLogoSrc100px(refVal_setLogoSrc100px);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("footerUnsubscribeURL")):
+            if(field.first == _XPLATSTR("footerUnsubscribeURL"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFooterUnsubscribeURL;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFooterUnsubscribeURL);
+                    setFooterUnsubscribeURL(refVal_setFooterUnsubscribeURL);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("emailHeaders")):
+            if(field.first == _XPLATSTR("emailHeaders"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setEmailHeaders;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailHeaders);
+                    setEmailHeaders(refVal_setEmailHeaders);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailFromEmail"))))
+    return ok;
+}
+
+void PatchDomainConfigParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailFromEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmailFromEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailFromEmail);
-            setEmailFromEmail(refVal_setEmailFromEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("logoSrc"))))
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("logoSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLogoSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc);
-            setLogoSrc(refVal_setLogoSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailFromName")), m_EmailFromName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("logoSrc100px"))))
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLogoSrc100px;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLogoSrc100px);
-            setLogoSrc100px(refVal_setLogoSrc100px);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailFromEmail")), m_EmailFromEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL"))))
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFooterUnsubscribeURL;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFooterUnsubscribeURL);
-            setFooterUnsubscribeURL(refVal_setFooterUnsubscribeURL);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("logoSrc")), m_LogoSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailHeaders"))))
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailHeaders")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("logoSrc100px")), m_LogoSrc100px);
+    }
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("footerUnsubscribeURL")), m_FooterUnsubscribeURL);
+    }
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailHeaders")), m_EmailHeaders);
+    }
+}
+
+bool PatchDomainConfigParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, utility::string_t> refVal_setEmailHeaders;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailHeaders);
-            setEmailHeaders(refVal_setEmailHeaders);
-            
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromName")):
+            {
+                utility::string_t refVal_setEmailFromName;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailFromName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailFromName(refVal_setEmailFromName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailFromEmail")):
+            {
+                utility::string_t refVal_setEmailFromEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailFromEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailFromEmail(refVal_setEmailFromEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc")):
+            {
+                utility::string_t refVal_setLogoSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setLogoSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLogoSrc(refVal_setLogoSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("logoSrc100px")):
+            {
+                utility::string_t refVal_setLogoSrc100px;
+                if(!ModelBase::readBinary(reader, field, refVal_setLogoSrc100px))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLogoSrc100px(refVal_setLogoSrc100px);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("footerUnsubscribeURL")):
+            {
+                utility::string_t refVal_setFooterUnsubscribeURL;
+                if(!ModelBase::readBinary(reader, field, refVal_setFooterUnsubscribeURL))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFooterUnsubscribeURL(refVal_setFooterUnsubscribeURL);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("emailHeaders")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setEmailHeaders;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailHeaders))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailHeaders(refVal_setEmailHeaders);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PatchDomainConfigParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -176,31 +365,31 @@ void PatchDomainConfigParams::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_EmailFromNameIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailFromName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailFromName")), m_EmailFromName));
     }
-    if(m_EmailFromEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailFromEmail))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailFromEmail")), m_EmailFromEmail));
     }
-    if(m_LogoSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_LogoSrc))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc")), m_LogoSrc));
     }
-    if(m_LogoSrc100pxIsSet)
+    if(m_FieldsSet.test(FieldBit_LogoSrc100px))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("logoSrc100px")), m_LogoSrc100px));
     }
-    if(m_FooterUnsubscribeURLIsSet)
+    if(m_FieldsSet.test(FieldBit_FooterUnsubscribeURL))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("footerUnsubscribeURL")), m_FooterUnsubscribeURL));
     }
-    if(m_EmailHeadersIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailHeaders))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailHeaders")), m_EmailHeaders));
     }
@@ -270,17 +459,17 @@ utility::string_t PatchDomainConfigParams::getDomain() const
 void PatchDomainConfigParams::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
-    m_DomainIsSet = true;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool PatchDomainConfigParams::domainIsSet() const
 {
-    return m_DomainIsSet;
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void PatchDomainConfigParams::unsetDomain()
 {
-    m_DomainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t PatchDomainConfigParams::getEmailFromName() const
 {
@@ -291,17 +480,17 @@ utility::string_t PatchDomainConfigParams::getEmailFromName() const
 void PatchDomainConfigParams::setEmailFromName(const utility::string_t& value)
 {
     m_EmailFromName = value;
-    m_EmailFromNameIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailFromName);
 }
 
 bool PatchDomainConfigParams::emailFromNameIsSet() const
 {
-    return m_EmailFromNameIsSet;
+    return m_FieldsSet.test(FieldBit_EmailFromName);
 }
 
 void PatchDomainConfigParams::unsetEmailFromName()
 {
-    m_EmailFromNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailFromName);
 }
 utility::string_t PatchDomainConfigParams::getEmailFromEmail() const
 {
@@ -312,17 +501,17 @@ utility::string_t PatchDomainConfigParams::getEmailFromEmail() const
 void PatchDomainConfigParams::setEmailFromEmail(const utility::string_t& value)
 {
     m_EmailFromEmail = value;
-    m_EmailFromEmailIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailFromEmail);
 }
 
 bool PatchDomainConfigParams::emailFromEmailIsSet() const
 {
-    return m_EmailFromEmailIsSet;
+    return m_FieldsSet.test(FieldBit_EmailFromEmail);
 }
 
 void PatchDomainConfigParams::unsetEmailFromEmail()
 {
-    m_EmailFromEmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailFromEmail);
 }
 utility::string_t PatchDomainConfigParams::getLogoSrc() const
 {
@@ -333,17 +522,17 @@ utility::string_t PatchDomainConfigParams::getLogoSrc() const
 void PatchDomainConfigParams::setLogoSrc(const utility::string_t& value)
 {
     m_LogoSrc = value;
-    m_LogoSrcIsSet = true;
+    m_FieldsSet.set(FieldBit_LogoSrc);
 }
 
 bool PatchDomainConfigParams::logoSrcIsSet() const
 {
-    return m_LogoSrcIsSet;
+    return m_FieldsSet.test(FieldBit_LogoSrc);
 }
 
 void PatchDomainConfigParams::unsetLogoSrc()
 {
-    m_LogoSrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_LogoSrc);
 }
 utility::string_t PatchDomainConfigParams::getLogoSrc100px() const
 {
@@ -354,17 +543,17 @@ utility::string_t PatchDomainConfigParams::getLogoSrc100px() const
 void PatchDomainConfigParams::setLogoSrc100px(const utility::string_t& value)
 {
     m_LogoSrc100px = value;
-    m_LogoSrc100pxIsSet = true;
+    m_FieldsSet.set(FieldBit_LogoSrc100px);
 }
 
 bool PatchDomainConfigParams::logoSrc100pxIsSet() const
 {
-    return m_LogoSrc100pxIsSet;
+    return m_FieldsSet.test(FieldBit_LogoSrc100px);
 }
 
 void PatchDomainConfigParams::unsetLogoSrc100px()
 {
-    m_LogoSrc100pxIsSet = false;
+    m_FieldsSet.reset(FieldBit_LogoSrc100px);
 }
 utility::string_t PatchDomainConfigParams::getFooterUnsubscribeURL() const
 {
@@ -375,17 +564,17 @@ utility::string_t PatchDomainConfigParams::getFooterUnsubscribeURL() const
 void PatchDomainConfigParams::setFooterUnsubscribeURL(const utility::string_t& value)
 {
     m_FooterUnsubscribeURL = value;
-    m_FooterUnsubscribeURLIsSet = true;
+    m_FieldsSet.set(FieldBit_FooterUnsubscribeURL);
 }
 
 bool PatchDomainConfigParams::footerUnsubscribeURLIsSet() const
 {
-    return m_FooterUnsubscribeURLIsSet;
+    return m_FieldsSet.test(FieldBit_FooterUnsubscribeURL);
 }
 
 void PatchDomainConfigParams::unsetFooterUnsubscribeURL()
 {
-    m_FooterUnsubscribeURLIsSet = false;
+    m_FieldsSet.reset(FieldBit_FooterUnsubscribeURL);
 }
 std::map<utility::string_t, utility::string_t> PatchDomainConfigParams::getEmailHeaders() const
 {
@@ -396,17 +585,17 @@ std::map<utility::string_t, utility::string_t> PatchDomainConfigParams::getEmail
 void PatchDomainConfigParams::setEmailHeaders(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_EmailHeaders = value;
-    m_EmailHeadersIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailHeaders);
 }
 
 bool PatchDomainConfigParams::emailHeadersIsSet() const
 {
-    return m_EmailHeadersIsSet;
+    return m_FieldsSet.test(FieldBit_EmailHeaders);
 }
 
 void PatchDomainConfigParams::unsetEmailHeaders()
 {
-    m_EmailHeadersIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailHeaders);
 }
 
 }
@@ -20,15 +20,7 @@ namespace model {
 
 PatchPageAPIResponse::PatchPageAPIResponse()
 {
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
     m_CommentsUpdated = 0L;
-    m_CommentsUpdatedIsSet = false;
-    m_PageIsSet = false;
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
 }
 
 PatchPageAPIResponse::~PatchPageAPIResponse()
@@ -43,27 +35,27 @@ void PatchPageAPIResponse::validate()
 web::json::value PatchPageAPIResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_CommentsUpdatedIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentsUpdated))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentsUpdated"))] = ModelBase::toJson(m_CommentsUpdated);
     }
-    if(m_PageIsSet)
+    if(m_FieldsSet.test(FieldBit_Page))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("page"))] = ModelBase::toJson(m_Page);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -72,65 +64,221 @@ web::json::value PatchPageAPIResponse::toJson() const
     return val;
 }
 
+void PatchPageAPIResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentsUpdated))
+    {
+        
+        writer.key(_XPLATSTR("commentsUpdated"));
+        ModelBase::writeJson(writer, m_CommentsUpdated);
+    }
+    if(m_FieldsSet.test(FieldBit_Page))
+    {
+        
+        writer.key(_XPLATSTR("page"));
+        ModelBase::writeJson(writer, m_Page);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool PatchPageAPIResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentsUpdated")):
+            if(field.first == _XPLATSTR("commentsUpdated"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setCommentsUpdated;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentsUpdated);
+                    setCommentsUpdated(refVal_setCommentsUpdated);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("page")):
+            if(field.first == _XPLATSTR("page"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIPage> refVal_setPage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPage);
+                    setPage(refVal_setPage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentsUpdated"))))
+    return ok;
+}
+
+void PatchPageAPIResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentsUpdated")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setCommentsUpdated;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentsUpdated);
-            setCommentsUpdated(refVal_setCommentsUpdated);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("page"))))
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("page")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIPage> refVal_setPage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPage);
-            setPage(refVal_setPage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentsUpdated))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentsUpdated")), m_CommentsUpdated);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(m_FieldsSet.test(FieldBit_Page))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("page")), m_Page);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool PatchPageAPIResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentsUpdated")):
+            {
+                int64_t refVal_setCommentsUpdated;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentsUpdated))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentsUpdated(refVal_setCommentsUpdated);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("page")):
+            {
+                std::shared_ptr<APIPage> refVal_setPage;
+                if(!ModelBase::readBinary(reader, field, refVal_setPage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPage(refVal_setPage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PatchPageAPIResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -140,23 +288,23 @@ void PatchPageAPIResponse::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_CommentsUpdatedIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentsUpdated))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentsUpdated")), m_CommentsUpdated));
     }
-    if(m_PageIsSet)
+    if(m_FieldsSet.test(FieldBit_Page))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("page")), m_Page));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -214,17 +362,17 @@ utility::string_t PatchPageAPIResponse::getReason() const
 void PatchPageAPIResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool PatchPageAPIResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void PatchPageAPIResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t PatchPageAPIResponse::getCode() const
 {
@@ -235,17 +383,17 @@ utility::string_t PatchPageAPIResponse::getCode() const
 void PatchPageAPIResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool PatchPageAPIResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void PatchPageAPIResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 int64_t PatchPageAPIResponse::getCommentsUpdated() const
 {
@@ -255,17 +403,17 @@ int64_t PatchPageAPIResponse::getCommentsUpdated() const
 void PatchPageAPIResponse::setCommentsUpdated(int64_t value)
 {
     m_CommentsUpdated = value;
-    m_CommentsUpdatedIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentsUpdated);
 }
 
 bool PatchPageAPIResponse::commentsUpdatedIsSet() const
 {
-    return m_CommentsUpdatedIsSet;
+    return m_FieldsSet.test(FieldBit_CommentsUpdated);
 }
 
 void PatchPageAPIResponse::unsetCommentsUpdated()
 {
-    m_CommentsUpdatedIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentsUpdated);
 }
 std::shared_ptr<APIPage> PatchPageAPIResponse::getPage() const
 {
@@ -276,17 +424,17 @@ std::shared_ptr<APIPage> PatchPageAPIResponse::getPage() const
 void PatchPageAPIResponse::setPage(const std::shared_ptr<APIPage>& value)
 {
     m_Page = value;
-    m_PageIsSet = true;
+    m_FieldsSet.set(FieldBit_Page);
 }
 
 bool PatchPageAPIResponse::pageIsSet() const
 {
-    return m_PageIsSet;
+    return m_FieldsSet.test(FieldBit_Page);
 }
 
 void PatchPageAPIResponse::unsetPage()
 {
-    m_PageIsSet = false;
+    m_FieldsSet.reset(FieldBit_Page);
 }
 utility::string_t PatchPageAPIResponse::getStatus() const
 {
@@ -297,17 +445,17 @@ utility::string_t PatchPageAPIResponse::getStatus() const
 void PatchPageAPIResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool PatchPageAPIResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void PatchPageAPIResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
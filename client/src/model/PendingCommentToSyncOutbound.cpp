@@ -20,28 +20,9 @@ namespace model {
 
 PendingCommentToSyncOutbound::PendingCommentToSyncOutbound()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_CommentId = utility::conversions::to_string_t("");
-    m_CommentIdIsSet = false;
-    m_CommentIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
     m_AttemptCount = 0.0;
-    m_AttemptCountIsSet = false;
-    m_NextAttemptAt = utility::datetime();
-    m_NextAttemptAtIsSet = false;
     m_EventType = 0.0;
-    m_EventTypeIsSet = false;
     m_Type = 0.0;
-    m_TypeIsSet = false;
-    m_Domain = utility::conversions::to_string_t("");
-    m_DomainIsSet = false;
-    m_LastErrorIsSet = false;
-    m_WebhookId = utility::conversions::to_string_t("");
-    m_WebhookIdIsSet = false;
 }
 
 PendingCommentToSyncOutbound::~PendingCommentToSyncOutbound()
@@ -56,67 +37,67 @@ void PendingCommentToSyncOutbound::validate()
 web::json::value PendingCommentToSyncOutbound::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_CommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentId"))] = ModelBase::toJson(m_CommentId);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_ExternalId.has_value())
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("externalId"))] = ModelBase::toJson(m_ExternalId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("externalId"))] = ModelBase::toJson(m_ExternalId);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_AttemptCountIsSet)
+    if(m_FieldsSet.test(FieldBit_AttemptCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("attemptCount"))] = ModelBase::toJson(m_AttemptCount);
     }
-    if(m_NextAttemptAtIsSet)
+    if(m_FieldsSet.test(FieldBit_NextAttemptAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("nextAttemptAt"))] = ModelBase::toJson(m_NextAttemptAt);
     }
-    if(m_EventTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_EventType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("eventType"))] = ModelBase::toJson(m_EventType);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_LastErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_LastError))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastError"))] = ModelBase::toJson(m_LastError);
     }
-    if(m_WebhookIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WebhookId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("webhookId"))] = ModelBase::toJson(m_WebhookId);
@@ -125,153 +106,493 @@ web::json::value PendingCommentToSyncOutbound::toJson() const
     return val;
 }
 
+void PendingCommentToSyncOutbound::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentId))
+    {
+        
+        writer.key(_XPLATSTR("commentId"));
+        ModelBase::writeJson(writer, m_CommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_ExternalId))
+    {
+        
+        writer.key(_XPLATSTR("externalId"));
+        ModelBase::writeJson(writer, m_ExternalId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_AttemptCount))
+    {
+        
+        writer.key(_XPLATSTR("attemptCount"));
+        ModelBase::writeJson(writer, m_AttemptCount);
+    }
+    if(m_FieldsSet.test(FieldBit_NextAttemptAt))
+    {
+        
+        writer.key(_XPLATSTR("nextAttemptAt"));
+        ModelBase::writeJson(writer, m_NextAttemptAt);
+    }
+    if(m_FieldsSet.test(FieldBit_EventType))
+    {
+        
+        writer.key(_XPLATSTR("eventType"));
+        ModelBase::writeJson(writer, m_EventType);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_LastError))
+    {
+        
+        writer.key(_XPLATSTR("lastError"));
+        ModelBase::writeJson(writer, m_LastError);
+    }
+    if(m_FieldsSet.test(FieldBit_WebhookId))
+    {
+        
+        writer.key(_XPLATSTR("webhookId"));
+        ModelBase::writeJson(writer, m_WebhookId);
+    }
+
+    writer.endObject();
+}
+
 bool PendingCommentToSyncOutbound::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
-            setCommentId(refVal_setCommentId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            if(field.first == _XPLATSTR("commentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
+                    setCommentId(refVal_setCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<FComment> refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("externalId")):
+            if(field.first == _XPLATSTR("externalId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setExternalId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExternalId);
+                    setExternalId(refVal_setExternalId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("attemptCount")):
+            if(field.first == _XPLATSTR("attemptCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAttemptCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAttemptCount);
+                    setAttemptCount(refVal_setAttemptCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("nextAttemptAt")):
+            if(field.first == _XPLATSTR("nextAttemptAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setNextAttemptAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNextAttemptAt);
+                    setNextAttemptAt(refVal_setNextAttemptAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("eventType")):
+            if(field.first == _XPLATSTR("eventType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setEventType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEventType);
+                    setEventType(refVal_setEventType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastError")):
+            if(field.first == _XPLATSTR("lastError"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<Object> refVal_setLastError;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastError);
+                    setLastError(refVal_setLastError);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("webhookId")):
+            if(field.first == _XPLATSTR("webhookId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWebhookId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWebhookId);
+                    setWebhookId(refVal_setWebhookId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    return ok;
+}
+
+void PendingCommentToSyncOutbound::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<FComment> refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("externalId"))))
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("externalId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setExternalId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExternalId);
-            setExternalId(refVal_setExternalId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentId")), m_CommentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("externalId")), m_ExternalId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("attemptCount"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("attemptCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAttemptCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAttemptCount);
-            setAttemptCount(refVal_setAttemptCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("nextAttemptAt"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("nextAttemptAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setNextAttemptAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNextAttemptAt);
-            setNextAttemptAt(refVal_setNextAttemptAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("eventType"))))
+    if(m_FieldsSet.test(FieldBit_AttemptCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("eventType")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setEventType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEventType);
-            setEventType(refVal_setEventType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("attemptCount")), m_AttemptCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_NextAttemptAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("nextAttemptAt")), m_NextAttemptAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_EventType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("eventType")), m_EventType);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastError"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastError")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<Object> refVal_setLastError;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastError);
-            setLastError(refVal_setLastError);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("webhookId"))))
+    if(m_FieldsSet.test(FieldBit_LastError))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("webhookId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastError")), m_LastError);
+    }
+    if(m_FieldsSet.test(FieldBit_WebhookId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("webhookId")), m_WebhookId);
+    }
+}
+
+bool PendingCommentToSyncOutbound::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setWebhookId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWebhookId);
-            setWebhookId(refVal_setWebhookId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            {
+                utility::string_t refVal_setCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentId(refVal_setCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                std::shared_ptr<FComment> refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("externalId")):
+            {
+                utility::string_t refVal_setExternalId;
+                if(!ModelBase::readBinary(reader, field, refVal_setExternalId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExternalId(refVal_setExternalId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("attemptCount")):
+            {
+                double refVal_setAttemptCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setAttemptCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAttemptCount(refVal_setAttemptCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("nextAttemptAt")):
+            {
+                utility::datetime refVal_setNextAttemptAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setNextAttemptAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNextAttemptAt(refVal_setNextAttemptAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("eventType")):
+            {
+                double refVal_setEventType;
+                if(!ModelBase::readBinary(reader, field, refVal_setEventType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEventType(refVal_setEventType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                double refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastError")):
+            {
+                std::shared_ptr<Object> refVal_setLastError;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastError))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastError(refVal_setLastError);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("webhookId")):
+            {
+                utility::string_t refVal_setWebhookId;
+                if(!ModelBase::readBinary(reader, field, refVal_setWebhookId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWebhookId(refVal_setWebhookId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PendingCommentToSyncOutbound::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -281,55 +602,55 @@ void PendingCommentToSyncOutbound::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_CommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentId")), m_CommentId));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_ExternalId.has_value())
+    if(m_FieldsSet.test(FieldBit_ExternalId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalId")), m_ExternalId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("externalId")), m_ExternalId));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_AttemptCountIsSet)
+    if(m_FieldsSet.test(FieldBit_AttemptCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("attemptCount")), m_AttemptCount));
     }
-    if(m_NextAttemptAtIsSet)
+    if(m_FieldsSet.test(FieldBit_NextAttemptAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nextAttemptAt")), m_NextAttemptAt));
     }
-    if(m_EventTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_EventType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("eventType")), m_EventType));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_LastErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_LastError))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastError")), m_LastError));
     }
-    if(m_WebhookIdIsSet)
+    if(m_FieldsSet.test(FieldBit_WebhookId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("webhookId")), m_WebhookId));
     }
@@ -435,17 +756,17 @@ utility::string_t PendingCommentToSyncOutbound::getId() const
 void PendingCommentToSyncOutbound::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool PendingCommentToSyncOutbound::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void PendingCommentToSyncOutbound::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t PendingCommentToSyncOutbound::getCommentId() const
 {
@@ -456,17 +777,17 @@ utility::string_t PendingCommentToSyncOutbound::getCommentId() const
 void PendingCommentToSyncOutbound::setCommentId(const utility::string_t& value)
 {
     m_CommentId = value;
-    m_CommentIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentId);
 }
 
 bool PendingCommentToSyncOutbound::commentIdIsSet() const
 {
-    return m_CommentIdIsSet;
+    return m_FieldsSet.test(FieldBit_CommentId);
 }
 
 void PendingCommentToSyncOutbound::unsetCommentId()
 {
-    m_CommentIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentId);
 }
 std::shared_ptr<FComment> PendingCommentToSyncOutbound::getComment() const
 {
@@ -477,37 +798,38 @@ std::shared_ptr<FComment> PendingCommentToSyncOutbound::getComment() const
 void PendingCommentToSyncOutbound::setComment(const std::shared_ptr<FComment>& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool PendingCommentToSyncOutbound::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void PendingCommentToSyncOutbound::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 utility::string_t PendingCommentToSyncOutbound::getExternalId() const
 {
-    return m_ExternalId.get();
+    return m_ExternalId;
 }
 
 
 void PendingCommentToSyncOutbound::setExternalId(const utility::string_t& value)
 {
     m_ExternalId = value;
+    m_FieldsSet.set(FieldBit_ExternalId);
 }
 
 bool PendingCommentToSyncOutbound::externalIdIsSet() const
 {
-    return m_ExternalId.has_value();
+    return m_FieldsSet.test(FieldBit_ExternalId);
 }
 
 void PendingCommentToSyncOutbound::unsetExternalId()
 {
-    m_ExternalId.reset();
+    m_FieldsSet.reset(FieldBit_ExternalId);
 }
 utility::datetime PendingCommentToSyncOutbound::getCreatedAt() const
 {
@@ -518,17 +840,17 @@ utility::datetime PendingCommentToSyncOutbound::getCreatedAt() const
 void PendingCommentToSyncOutbound::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool PendingCommentToSyncOutbound::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void PendingCommentToSyncOutbound::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t PendingCommentToSyncOutbound::getTenantId() const
 {
@@ -539,17 +861,17 @@ utility::string_t PendingCommentToSyncOutbound::getTenantId() const
 void PendingCommentToSyncOutbound::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool PendingCommentToSyncOutbound::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void PendingCommentToSyncOutbound::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 double PendingCommentToSyncOutbound::getAttemptCount() const
 {
@@ -559,17 +881,17 @@ double PendingCommentToSyncOutbound::getAttemptCount() const
 void PendingCommentToSyncOutbound::setAttemptCount(double value)
 {
     m_AttemptCount = value;
-    m_AttemptCountIsSet = true;
+    m_FieldsSet.set(FieldBit_AttemptCount);
 }
 
 bool PendingCommentToSyncOutbound::attemptCountIsSet() const
 {
-    return m_AttemptCountIsSet;
+    return m_FieldsSet.test(FieldBit_AttemptCount);
 }
 
 void PendingCommentToSyncOutbound::unsetAttemptCount()
 {
-    m_AttemptCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_AttemptCount);
 }
 utility::datetime PendingCommentToSyncOutbound::getNextAttemptAt() const
 {
@@ -580,17 +902,17 @@ utility::datetime PendingCommentToSyncOutbound::getNextAttemptAt() const
 void PendingCommentToSyncOutbound::setNextAttemptAt(const utility::datetime& value)
 {
     m_NextAttemptAt = value;
-    m_NextAttemptAtIsSet = true;
+    m_FieldsSet.set(FieldBit_NextAttemptAt);
 }
 
 bool PendingCommentToSyncOutbound::nextAttemptAtIsSet() const
 {
-    return m_NextAttemptAtIsSet;
+    return m_FieldsSet.test(FieldBit_NextAttemptAt);
 }
 
 void PendingCommentToSyncOutbound::unsetNextAttemptAt()
 {
-    m_NextAttemptAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_NextAttemptAt);
 }
 double PendingCommentToSyncOutbound::getEventType() const
 {
@@ -600,17 +922,17 @@ double PendingCommentToSyncOutbound::getEventType() const
 void PendingCommentToSyncOutbound::setEventType(double value)
 {
     m_EventType = value;
-    m_EventTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_EventType);
 }
 
 bool PendingCommentToSyncOutbound::eventTypeIsSet() const
 {
-    return m_EventTypeIsSet;
+    return m_FieldsSet.test(FieldBit_EventType);
 }
 
 void PendingCommentToSyncOutbound::unsetEventType()
 {
-    m_EventTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_EventType);
 }
 double PendingCommentToSyncOutbound::getType() const
 {
@@ -620,17 +942,17 @@ double PendingCommentToSyncOutbound::getType() const
 void PendingCommentToSyncOutbound::setType(double value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool PendingCommentToSyncOutbound::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void PendingCommentToSyncOutbound::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 utility::string_t PendingCommentToSyncOutbound::getDomain() const
 {
@@ -641,17 +963,17 @@ utility::string_t PendingCommentToSyncOutbound::getDomain() const
 void PendingCommentToSyncOutbound::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
-    m_DomainIsSet = true;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool PendingCommentToSyncOutbound::domainIsSet() const
 {
-    return m_DomainIsSet;
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void PendingCommentToSyncOutbound::unsetDomain()
 {
-    m_DomainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 std::shared_ptr<Object> PendingCommentToSyncOutbound::getLastError() const
 {
@@ -662,17 +984,17 @@ std::shared_ptr<Object> PendingCommentToSyncOutbound::getLastError() const
 void PendingCommentToSyncOutbound::setLastError(const std::shared_ptr<Object>& value)
 {
     m_LastError = value;
-    m_LastErrorIsSet = true;
+    m_FieldsSet.set(FieldBit_LastError);
 }
 
 bool PendingCommentToSyncOutbound::lastErrorIsSet() const
 {
-    return m_LastErrorIsSet;
+    return m_FieldsSet.test(FieldBit_LastError);
 }
 
 void PendingCommentToSyncOutbound::unsetLastError()
 {
-    m_LastErrorIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastError);
 }
 utility::string_t PendingCommentToSyncOutbound::getWebhookId() const
 {
@@ -683,17 +1005,17 @@ utility::string_t PendingCommentToSyncOutbound::getWebhookId() const
 void PendingCommentToSyncOutbound::setWebhookId(const utility::string_t& value)
 {
     m_WebhookId = value;
-    m_WebhookIdIsSet = true;
+    m_FieldsSet.set(FieldBit_WebhookId);
 }
 
 bool PendingCommentToSyncOutbound::webhookIdIsSet() const
 {
-    return m_WebhookIdIsSet;
+    return m_FieldsSet.test(FieldBit_WebhookId);
 }
 
 void PendingCommentToSyncOutbound::unsetWebhookId()
 {
-    m_WebhookIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_WebhookId);
 }
 
 }
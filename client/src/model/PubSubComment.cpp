@@ -20,51 +20,28 @@ namespace model {
 
 PubSubComment::PubSubComment()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_CommentHTML = utility::conversions::to_string_t("");
-    m_CommentHTMLIsSet = false;
-    m_Comment = utility::conversions::to_string_t("");
-    m_CommentIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
     m_HasImages = false;
-    m_HasImagesIsSet = false;
     m_HasLinks = false;
-    m_HasLinksIsSet = false;
     m_IsByAdmin = false;
-    m_IsByAdminIsSet = false;
     m_IsByModerator = false;
-    m_IsByModeratorIsSet = false;
     m_IsDeleted = false;
-    m_IsDeletedIsSet = false;
     m_IsDeletedUser = false;
-    m_IsDeletedUserIsSet = false;
     m_IsSpam = false;
-    m_IsSpamIsSet = false;
-    m_FeedbackIdsIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
     m_Reviewed = false;
-    m_ReviewedIsSet = false;
     m_HasCode = false;
-    m_HasCodeIsSet = false;
     m_Approved = false;
-    m_ApprovedIsSet = false;
     m_IsBannedUser = false;
-    m_IsBannedUserIsSet = false;
     m_IsLive = false;
-    m_IsLiveIsSet = false;
     m_Hidden = false;
-    m_HiddenIsSet = false;
-    m_date = utility::conversions::to_string_t("");
-    m_dateIsSet = false;
+    m_Votes = 0;
+    m_VotesUp = 0;
+    m_VotesDown = 0;
+    m_IsPinned = false;
+    m_IsLocked = false;
+    m_Rating = 0.0;
+    m_ViewCount = 0L;
+    m_FlagCount = 0;
 }
 
 PubSubComment::~PubSubComment()
@@ -79,217 +56,217 @@ void PubSubComment::validate()
 web::json::value PubSubComment::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink);
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentHTML"))] = ModelBase::toJson(m_CommentHTML);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId);
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes);
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp);
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasImages"))] = ModelBase::toJson(m_HasImages);
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasLinks"))] = ModelBase::toJson(m_HasLinks);
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))] = ModelBase::toJson(m_IsByAdmin);
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByModerator"))] = ModelBase::toJson(m_IsByModerator);
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned);
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked);
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating);
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_ViewCount.has_value())
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("viewCount"))] = ModelBase::toJson(m_ViewCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("viewCount"))] = ModelBase::toJson(m_ViewCount);
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeleted"))] = ModelBase::toJson(m_IsDeleted);
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))] = ModelBase::toJson(m_IsDeletedUser);
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSpam"))] = ModelBase::toJson(m_IsSpam);
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))] = ModelBase::toJson(m_FeedbackIds);
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("flagCount"))] = ModelBase::toJson(m_FlagCount);
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("expireAt"))] = ModelBase::toJson(m_ExpireAt);
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reviewed"))] = ModelBase::toJson(m_Reviewed);
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasCode"))] = ModelBase::toJson(m_HasCode);
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approved"))] = ModelBase::toJson(m_Approved);
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))] = ModelBase::toJson(m_IsBannedUser);
     }
-    if(m_GroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("groupIds"))] = ModelBase::toJson(m_GroupIds.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("groupIds"))] = ModelBase::toJson(m_GroupIds);
     }
-    if(m_IsLiveIsSet)
+    if(m_FieldsSet.test(FieldBit_IsLive))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isLive"))] = ModelBase::toJson(m_IsLive);
     }
-    if(m_HiddenIsSet)
+    if(m_FieldsSet.test(FieldBit_Hidden))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hidden"))] = ModelBase::toJson(m_Hidden);
     }
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
@@ -298,483 +275,1501 @@ web::json::value PubSubComment::toJson() const
     return val;
 }
 
+void PubSubComment::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
+    {
+        
+        writer.key(_XPLATSTR("commenterLink"));
+        ModelBase::writeJson(writer, m_CommenterLink);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
+    {
+        
+        writer.key(_XPLATSTR("commentHTML"));
+        ModelBase::writeJson(writer, m_CommentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_ParentId))
+    {
+        
+        writer.key(_XPLATSTR("parentId"));
+        ModelBase::writeJson(writer, m_ParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Votes))
+    {
+        
+        writer.key(_XPLATSTR("votes"));
+        ModelBase::writeJson(writer, m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        writer.key(_XPLATSTR("votesUp"));
+        ModelBase::writeJson(writer, m_VotesUp);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        writer.key(_XPLATSTR("votesDown"));
+        ModelBase::writeJson(writer, m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_HasImages))
+    {
+        
+        writer.key(_XPLATSTR("hasImages"));
+        ModelBase::writeJson(writer, m_HasImages);
+    }
+    if(m_FieldsSet.test(FieldBit_HasLinks))
+    {
+        
+        writer.key(_XPLATSTR("hasLinks"));
+        ModelBase::writeJson(writer, m_HasLinks);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isByAdmin"));
+        ModelBase::writeJson(writer, m_IsByAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
+    {
+        
+        writer.key(_XPLATSTR("isByModerator"));
+        ModelBase::writeJson(writer, m_IsByModerator);
+    }
+    if(m_FieldsSet.test(FieldBit_IsPinned))
+    {
+        
+        writer.key(_XPLATSTR("isPinned"));
+        ModelBase::writeJson(writer, m_IsPinned);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLocked))
+    {
+        
+        writer.key(_XPLATSTR("isLocked"));
+        ModelBase::writeJson(writer, m_IsLocked);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_Rating))
+    {
+        
+        writer.key(_XPLATSTR("rating"));
+        ModelBase::writeJson(writer, m_Rating);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_ViewCount))
+    {
+        
+        writer.key(_XPLATSTR("viewCount"));
+        ModelBase::writeJson(writer, m_ViewCount);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
+    {
+        
+        writer.key(_XPLATSTR("isDeleted"));
+        ModelBase::writeJson(writer, m_IsDeleted);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
+    {
+        
+        writer.key(_XPLATSTR("isDeletedUser"));
+        ModelBase::writeJson(writer, m_IsDeletedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSpam))
+    {
+        
+        writer.key(_XPLATSTR("isSpam"));
+        ModelBase::writeJson(writer, m_IsSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        writer.key(_XPLATSTR("feedbackIds"));
+        ModelBase::writeJson(writer, m_FeedbackIds);
+    }
+    if(m_FieldsSet.test(FieldBit_FlagCount))
+    {
+        
+        writer.key(_XPLATSTR("flagCount"));
+        ModelBase::writeJson(writer, m_FlagCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
+    {
+        
+        writer.key(_XPLATSTR("expireAt"));
+        ModelBase::writeJson(writer, m_ExpireAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Reviewed))
+    {
+        
+        writer.key(_XPLATSTR("reviewed"));
+        ModelBase::writeJson(writer, m_Reviewed);
+    }
+    if(m_FieldsSet.test(FieldBit_HasCode))
+    {
+        
+        writer.key(_XPLATSTR("hasCode"));
+        ModelBase::writeJson(writer, m_HasCode);
+    }
+    if(m_FieldsSet.test(FieldBit_Approved))
+    {
+        
+        writer.key(_XPLATSTR("approved"));
+        ModelBase::writeJson(writer, m_Approved);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
+    {
+        
+        writer.key(_XPLATSTR("isBannedUser"));
+        ModelBase::writeJson(writer, m_IsBannedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_GroupIds))
+    {
+        
+        writer.key(_XPLATSTR("groupIds"));
+        ModelBase::writeJson(writer, m_GroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLive))
+    {
+        
+        writer.key(_XPLATSTR("isLive"));
+        ModelBase::writeJson(writer, m_IsLive);
+    }
+    if(m_FieldsSet.test(FieldBit_Hidden))
+    {
+        
+        writer.key(_XPLATSTR("hidden"));
+        ModelBase::writeJson(writer, m_Hidden);
+    }
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+
+    writer.endObject();
+}
+
 bool PubSubComment::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_TenantId);
+                    m_FieldsSet.set(FieldBit_TenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_UrlId);
+                    m_FieldsSet.set(FieldBit_UrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_CommenterName);
+                    m_FieldsSet.set(FieldBit_CommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            if(field.first == _XPLATSTR("commenterLink"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterLink;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
+                    setCommenterLink(refVal_setCommenterLink);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            if(field.first == _XPLATSTR("commentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
+                    setCommentHTML(refVal_setCommentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            if(field.first == _XPLATSTR("parentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
+                    setParentId(refVal_setParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            if(field.first == _XPLATSTR("votes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
+                    setVotes(refVal_setVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            if(field.first == _XPLATSTR("votesUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
+                    setVotesUp(refVal_setVotesUp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            if(field.first == _XPLATSTR("votesDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
+                    setVotesDown(refVal_setVotesDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_AvatarSrc);
+                    m_FieldsSet.set(FieldBit_AvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            if(field.first == _XPLATSTR("hasImages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasImages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
+                    setHasImages(refVal_setHasImages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            if(field.first == _XPLATSTR("hasLinks"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
+                    setHasLinks(refVal_setHasLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            if(field.first == _XPLATSTR("isByAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
+                    setIsByAdmin(refVal_setIsByAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            if(field.first == _XPLATSTR("isByModerator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByModerator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
+                    setIsByModerator(refVal_setIsByModerator);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            if(field.first == _XPLATSTR("isPinned"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsPinned;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
+                    setIsPinned(refVal_setIsPinned);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            if(field.first == _XPLATSTR("isLocked"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLocked;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
+                    setIsLocked(refVal_setIsLocked);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            if(field.first == _XPLATSTR("rating"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setRating;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
+                    setRating(refVal_setRating);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("viewCount")):
+            if(field.first == _XPLATSTR("viewCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setViewCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setViewCount);
+                    setViewCount(refVal_setViewCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            if(field.first == _XPLATSTR("isDeleted"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeleted;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
+                    setIsDeleted(refVal_setIsDeleted);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            if(field.first == _XPLATSTR("isDeletedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeletedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
+                    setIsDeletedUser(refVal_setIsDeletedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            if(field.first == _XPLATSTR("isSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
+                    setIsSpam(refVal_setIsSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            if(field.first == _XPLATSTR("feedbackIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
+                    setFeedbackIds(refVal_setFeedbackIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            if(field.first == _XPLATSTR("flagCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setFlagCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
+                    setFlagCount(refVal_setFlagCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_Url);
+                    m_FieldsSet.set(FieldBit_Url);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_PageTitle);
+                    m_FieldsSet.set(FieldBit_PageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            if(field.first == _XPLATSTR("expireAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setExpireAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
+                    setExpireAt(refVal_setExpireAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            if(field.first == _XPLATSTR("reviewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setReviewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
+                    setReviewed(refVal_setReviewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            if(field.first == _XPLATSTR("hasCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
+                    setHasCode(refVal_setHasCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            if(field.first == _XPLATSTR("approved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
+                    setApproved(refVal_setApproved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            if(field.first == _XPLATSTR("isBannedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsBannedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
+                    setIsBannedUser(refVal_setIsBannedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            if(field.first == _XPLATSTR("groupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
+                    setGroupIds(refVal_setGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isLive")):
+            if(field.first == _XPLATSTR("isLive"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLive;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLive);
+                    setIsLive(refVal_setIsLive);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hidden")):
+            if(field.first == _XPLATSTR("hidden"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHidden;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHidden);
+                    setHidden(refVal_setHidden);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    return ok;
+}
+
+void PubSubComment::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterLink"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterLink")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterLink;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
-            setCommenterLink(refVal_setCommenterLink);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentHTML"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentHTML")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
-            setCommentHTML(refVal_setCommentHTML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterLink")), m_CommenterLink);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("parentId"))))
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("parentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
-            setParentId(refVal_setParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentHTML")), m_CommentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votes"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votes")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
-            setVotes(refVal_setVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUp"))))
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUp")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
-            setVotesUp(refVal_setVotesUp);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("parentId")), m_ParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDown"))))
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDown")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
-            setVotesDown(refVal_setVotesDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votes")), m_Votes);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUp")), m_VotesUp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDown")), m_VotesDown);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasImages"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasImages")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasImages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
-            setHasImages(refVal_setHasImages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasLinks"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasLinks")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasLinks);
-            setHasLinks(refVal_setHasLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))))
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
-            setIsByAdmin(refVal_setIsByAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasImages")), m_HasImages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByModerator"))))
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByModerator")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByModerator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
-            setIsByModerator(refVal_setIsByModerator);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasLinks")), m_HasLinks);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isPinned"))))
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isPinned")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsPinned;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
-            setIsPinned(refVal_setIsPinned);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByAdmin")), m_IsByAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLocked"))))
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLocked")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLocked;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
-            setIsLocked(refVal_setIsLocked);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByModerator")), m_IsByModerator);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isPinned")), m_IsPinned);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rating"))))
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rating")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setRating;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
-            setRating(refVal_setRating);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLocked")), m_IsLocked);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("viewCount"))))
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("viewCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setViewCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setViewCount);
-            setViewCount(refVal_setViewCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rating")), m_Rating);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeleted"))))
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeleted")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeleted;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
-            setIsDeleted(refVal_setIsDeleted);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))))
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeletedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
-            setIsDeletedUser(refVal_setIsDeletedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("viewCount")), m_ViewCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSpam"))))
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
-            setIsSpam(refVal_setIsSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeleted")), m_IsDeleted);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeletedUser")), m_IsDeletedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))))
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
-            setFeedbackIds(refVal_setFeedbackIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSpam")), m_IsSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flagCount"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flagCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setFlagCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlagCount);
-            setFlagCount(refVal_setFlagCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackIds")), m_FeedbackIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flagCount")), m_FlagCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("expireAt"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("expireAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setExpireAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setExpireAt);
-            setExpireAt(refVal_setExpireAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reviewed"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reviewed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setReviewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReviewed);
-            setReviewed(refVal_setReviewed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasCode"))))
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasCode")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasCode);
-            setHasCode(refVal_setHasCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("expireAt")), m_ExpireAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approved"))))
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approved")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
-            setApproved(refVal_setApproved);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reviewed")), m_Reviewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasCode")), m_HasCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isBannedUser"))))
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isBannedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsBannedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsBannedUser);
-            setIsBannedUser(refVal_setIsBannedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approved")), m_Approved);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("groupIds"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("groupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
-            setGroupIds(refVal_setGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLive"))))
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLive")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLive;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLive);
-            setIsLive(refVal_setIsLive);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isBannedUser")), m_IsBannedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hidden"))))
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hidden")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHidden;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHidden);
-            setHidden(refVal_setHidden);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("groupIds")), m_GroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLive))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLive")), m_IsLive);
+    }
+    if(m_FieldsSet.test(FieldBit_Hidden))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hidden")), m_Hidden);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
+    }
+}
+
+bool PubSubComment::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_TenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_TenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_UrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_UrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_CommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_CommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            {
+                utility::string_t refVal_setCommenterLink;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterLink))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterLink(refVal_setCommenterLink);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            {
+                utility::string_t refVal_setCommentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentHTML(refVal_setCommentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                utility::string_t refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            {
+                utility::string_t refVal_setParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setParentId(refVal_setParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            {
+                int32_t refVal_setVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotes(refVal_setVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            {
+                int32_t refVal_setVotesUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUp(refVal_setVotesUp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            {
+                int32_t refVal_setVotesDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDown(refVal_setVotesDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_AvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_AvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            {
+                bool refVal_setHasImages;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasImages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasImages(refVal_setHasImages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasLinks")):
+            {
+                bool refVal_setHasLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasLinks(refVal_setHasLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            {
+                bool refVal_setIsByAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByAdmin(refVal_setIsByAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            {
+                bool refVal_setIsByModerator;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByModerator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByModerator(refVal_setIsByModerator);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            {
+                bool refVal_setIsPinned;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsPinned))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsPinned(refVal_setIsPinned);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            {
+                bool refVal_setIsLocked;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLocked))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLocked(refVal_setIsLocked);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            {
+                double refVal_setRating;
+                if(!ModelBase::readBinary(reader, field, refVal_setRating))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRating(refVal_setRating);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("viewCount")):
+            {
+                int64_t refVal_setViewCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setViewCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setViewCount(refVal_setViewCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            {
+                bool refVal_setIsDeleted;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeleted))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeleted(refVal_setIsDeleted);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            {
+                bool refVal_setIsDeletedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeletedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeletedUser(refVal_setIsDeletedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            {
+                bool refVal_setIsSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSpam(refVal_setIsSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackIds(refVal_setFeedbackIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flagCount")):
+            {
+                int32_t refVal_setFlagCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlagCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlagCount(refVal_setFlagCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_Url))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_Url);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_PageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_PageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("expireAt")):
+            {
+                utility::datetime refVal_setExpireAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setExpireAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setExpireAt(refVal_setExpireAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reviewed")):
+            {
+                bool refVal_setReviewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setReviewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReviewed(refVal_setReviewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasCode")):
+            {
+                bool refVal_setHasCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasCode(refVal_setHasCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            {
+                bool refVal_setApproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setApproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApproved(refVal_setApproved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isBannedUser")):
+            {
+                bool refVal_setIsBannedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsBannedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsBannedUser(refVal_setIsBannedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            {
+                std::vector<utility::string_t> refVal_setGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGroupIds(refVal_setGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isLive")):
+            {
+                bool refVal_setIsLive;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLive))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLive(refVal_setIsLive);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hidden")):
+            {
+                bool refVal_setHidden;
+                if(!ModelBase::readBinary(reader, field, refVal_setHidden))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHidden(refVal_setHidden);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                utility::string_t refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PubSubComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -784,175 +1779,175 @@ void PubSubComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink));
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentHTML")), m_CommentHTML));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId));
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes));
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp));
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasImages")), m_HasImages));
     }
-    if(m_HasLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLinks))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasLinks")), m_HasLinks));
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByAdmin")), m_IsByAdmin));
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByModerator")), m_IsByModerator));
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned));
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked));
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating));
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_ViewCount.has_value())
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewCount")), m_ViewCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewCount")), m_ViewCount));
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeleted")), m_IsDeleted));
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")), m_IsDeletedUser));
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSpam")), m_IsSpam));
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackIds")), m_FeedbackIds));
     }
-    if(m_FlagCount.has_value())
+    if(m_FieldsSet.test(FieldBit_FlagCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flagCount")), m_FlagCount));
     }
-    if(m_Domain.has_value())
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_ExpireAt.has_value())
+    if(m_FieldsSet.test(FieldBit_ExpireAt))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("expireAt")), m_ExpireAt));
     }
-    if(m_ReviewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Reviewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reviewed")), m_Reviewed));
     }
-    if(m_HasCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HasCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasCode")), m_HasCode));
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approved")), m_Approved));
     }
-    if(m_Locale.has_value())
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_IsBannedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBannedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isBannedUser")), m_IsBannedUser));
     }
-    if(m_GroupIds.has_value())
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groupIds")), m_GroupIds.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groupIds")), m_GroupIds));
     }
-    if(m_IsLiveIsSet)
+    if(m_FieldsSet.test(FieldBit_IsLive))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLive")), m_IsLive));
     }
-    if(m_HiddenIsSet)
+    if(m_FieldsSet.test(FieldBit_Hidden))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hidden")), m_Hidden));
     }
-    if(m_dateIsSet)
+    if(m_FieldsSet.test(FieldBit_date))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
@@ -1238,17 +2233,17 @@ utility::string_t PubSubComment::getId() const
 void PubSubComment::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool PubSubComment::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void PubSubComment::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t PubSubComment::getTenantId() const
 {
@@ -1259,37 +2254,38 @@ utility::string_t PubSubComment::getTenantId() const
 void PubSubComment::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool PubSubComment::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void PubSubComment::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t PubSubComment::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void PubSubComment::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool PubSubComment::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void PubSubComment::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t PubSubComment::getUrlId() const
 {
@@ -1300,17 +2296,17 @@ utility::string_t PubSubComment::getUrlId() const
 void PubSubComment::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool PubSubComment::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void PubSubComment::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t PubSubComment::getCommenterName() const
 {
@@ -1321,37 +2317,38 @@ utility::string_t PubSubComment::getCommenterName() const
 void PubSubComment::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool PubSubComment::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void PubSubComment::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::string_t PubSubComment::getCommenterLink() const
 {
-    return m_CommenterLink.get();
+    return m_CommenterLink;
 }
 
 
 void PubSubComment::setCommenterLink(const utility::string_t& value)
 {
     m_CommenterLink = value;
+    m_FieldsSet.set(FieldBit_CommenterLink);
 }
 
 bool PubSubComment::commenterLinkIsSet() const
 {
-    return m_CommenterLink.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterLink);
 }
 
 void PubSubComment::unsetCommenterLink()
 {
-    m_CommenterLink.reset();
+    m_FieldsSet.reset(FieldBit_CommenterLink);
 }
 utility::string_t PubSubComment::getCommentHTML() const
 {
@@ -1362,17 +2359,17 @@ utility::string_t PubSubComment::getCommentHTML() const
 void PubSubComment::setCommentHTML(const utility::string_t& value)
 {
     m_CommentHTML = value;
-    m_CommentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentHTML);
 }
 
 bool PubSubComment::commentHTMLIsSet() const
 {
-    return m_CommentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_CommentHTML);
 }
 
 void PubSubComment::unsetCommentHTML()
 {
-    m_CommentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentHTML);
 }
 utility::string_t PubSubComment::getComment() const
 {
@@ -1383,94 +2380,98 @@ utility::string_t PubSubComment::getComment() const
 void PubSubComment::setComment(const utility::string_t& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool PubSubComment::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void PubSubComment::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 utility::string_t PubSubComment::getParentId() const
 {
-    return m_ParentId.get();
+    return m_ParentId;
 }
 
 
 void PubSubComment::setParentId(const utility::string_t& value)
 {
     m_ParentId = value;
+    m_FieldsSet.set(FieldBit_ParentId);
 }
 
 bool PubSubComment::parentIdIsSet() const
 {
-    return m_ParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ParentId);
 }
 
 void PubSubComment::unsetParentId()
 {
-    m_ParentId.reset();
+    m_FieldsSet.reset(FieldBit_ParentId);
 }
 int32_t PubSubComment::getVotes() const
 {
-    return m_Votes.get();
+    return m_Votes;
 }
 
 void PubSubComment::setVotes(int32_t value)
 {
     m_Votes = value;
+    m_FieldsSet.set(FieldBit_Votes);
 }
 
 bool PubSubComment::votesIsSet() const
 {
-    return m_Votes.has_value();
+    return m_FieldsSet.test(FieldBit_Votes);
 }
 
 void PubSubComment::unsetVotes()
 {
-    m_Votes.reset();
+    m_FieldsSet.reset(FieldBit_Votes);
 }
 int32_t PubSubComment::getVotesUp() const
 {
-    return m_VotesUp.get();
+    return m_VotesUp;
 }
 
 void PubSubComment::setVotesUp(int32_t value)
 {
     m_VotesUp = value;
+    m_FieldsSet.set(FieldBit_VotesUp);
 }
 
 bool PubSubComment::votesUpIsSet() const
 {
-    return m_VotesUp.has_value();
+    return m_FieldsSet.test(FieldBit_VotesUp);
 }
 
 void PubSubComment::unsetVotesUp()
 {
-    m_VotesUp.reset();
+    m_FieldsSet.reset(FieldBit_VotesUp);
 }
 int32_t PubSubComment::getVotesDown() const
 {
-    return m_VotesDown.get();
+    return m_VotesDown;
 }
 
 void PubSubComment::setVotesDown(int32_t value)
 {
     m_VotesDown = value;
+    m_FieldsSet.set(FieldBit_VotesDown);
 }
 
 bool PubSubComment::votesDownIsSet() const
 {
-    return m_VotesDown.has_value();
+    return m_FieldsSet.test(FieldBit_VotesDown);
 }
 
 void PubSubComment::unsetVotesDown()
 {
-    m_VotesDown.reset();
+    m_FieldsSet.reset(FieldBit_VotesDown);
 }
 bool PubSubComment::isVerified() const
 {
@@ -1480,37 +2481,38 @@ bool PubSubComment::isVerified() const
 void PubSubComment::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool PubSubComment::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void PubSubComment::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 utility::string_t PubSubComment::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void PubSubComment::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool PubSubComment::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void PubSubComment::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 bool PubSubComment::isHasImages() const
 {
@@ -1520,17 +2522,17 @@ bool PubSubComment::isHasImages() const
 void PubSubComment::setHasImages(bool value)
 {
     m_HasImages = value;
-    m_HasImagesIsSet = true;
+    m_FieldsSet.set(FieldBit_HasImages);
 }
 
 bool PubSubComment::hasImagesIsSet() const
 {
-    return m_HasImagesIsSet;
+    return m_FieldsSet.test(FieldBit_HasImages);
 }
 
 void PubSubComment::unsetHasImages()
 {
-    m_HasImagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasImages);
 }
 bool PubSubComment::isHasLinks() const
 {
@@ -1540,17 +2542,17 @@ bool PubSubComment::isHasLinks() const
 void PubSubComment::setHasLinks(bool value)
 {
     m_HasLinks = value;
-    m_HasLinksIsSet = true;
+    m_FieldsSet.set(FieldBit_HasLinks);
 }
 
 bool PubSubComment::hasLinksIsSet() const
 {
-    return m_HasLinksIsSet;
+    return m_FieldsSet.test(FieldBit_HasLinks);
 }
 
 void PubSubComment::unsetHasLinks()
 {
-    m_HasLinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasLinks);
 }
 bool PubSubComment::isIsByAdmin() const
 {
@@ -1560,17 +2562,17 @@ bool PubSubComment::isIsByAdmin() const
 void PubSubComment::setIsByAdmin(bool value)
 {
     m_IsByAdmin = value;
-    m_IsByAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByAdmin);
 }
 
 bool PubSubComment::isByAdminIsSet() const
 {
-    return m_IsByAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsByAdmin);
 }
 
 void PubSubComment::unsetIsByAdmin()
 {
-    m_IsByAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByAdmin);
 }
 bool PubSubComment::isIsByModerator() const
 {
@@ -1580,133 +2582,139 @@ bool PubSubComment::isIsByModerator() const
 void PubSubComment::setIsByModerator(bool value)
 {
     m_IsByModerator = value;
-    m_IsByModeratorIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByModerator);
 }
 
 bool PubSubComment::isByModeratorIsSet() const
 {
-    return m_IsByModeratorIsSet;
+    return m_FieldsSet.test(FieldBit_IsByModerator);
 }
 
 void PubSubComment::unsetIsByModerator()
 {
-    m_IsByModeratorIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByModerator);
 }
 bool PubSubComment::isIsPinned() const
 {
-    return m_IsPinned.get();
+    return m_IsPinned;
 }
 
 void PubSubComment::setIsPinned(bool value)
 {
     m_IsPinned = value;
+    m_FieldsSet.set(FieldBit_IsPinned);
 }
 
 bool PubSubComment::isPinnedIsSet() const
 {
-    return m_IsPinned.has_value();
+    return m_FieldsSet.test(FieldBit_IsPinned);
 }
 
 void PubSubComment::unsetIsPinned()
 {
-    m_IsPinned.reset();
+    m_FieldsSet.reset(FieldBit_IsPinned);
 }
 bool PubSubComment::isIsLocked() const
 {
-    return m_IsLocked.get();
+    return m_IsLocked;
 }
 
 void PubSubComment::setIsLocked(bool value)
 {
     m_IsLocked = value;
+    m_FieldsSet.set(FieldBit_IsLocked);
 }
 
 bool PubSubComment::isLockedIsSet() const
 {
-    return m_IsLocked.has_value();
+    return m_FieldsSet.test(FieldBit_IsLocked);
 }
 
 void PubSubComment::unsetIsLocked()
 {
-    m_IsLocked.reset();
+    m_FieldsSet.reset(FieldBit_IsLocked);
 }
 utility::string_t PubSubComment::getDisplayLabel() const
 {
-    return m_DisplayLabel.get();
+    return m_DisplayLabel;
 }
 
 
 void PubSubComment::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool PubSubComment::displayLabelIsSet() const
 {
-    return m_DisplayLabel.has_value();
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void PubSubComment::unsetDisplayLabel()
 {
-    m_DisplayLabel.reset();
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 double PubSubComment::getRating() const
 {
-    return m_Rating.get();
+    return m_Rating;
 }
 
 void PubSubComment::setRating(double value)
 {
     m_Rating = value;
+    m_FieldsSet.set(FieldBit_Rating);
 }
 
 bool PubSubComment::ratingIsSet() const
 {
-    return m_Rating.has_value();
+    return m_FieldsSet.test(FieldBit_Rating);
 }
 
 void PubSubComment::unsetRating()
 {
-    m_Rating.reset();
+    m_FieldsSet.reset(FieldBit_Rating);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> PubSubComment::getBadges() const
 {
-    return m_Badges.get();
+    return m_Badges;
 }
 
 
 void PubSubComment::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool PubSubComment::badgesIsSet() const
 {
-    return m_Badges.has_value();
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void PubSubComment::unsetBadges()
 {
-    m_Badges.reset();
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 int64_t PubSubComment::getViewCount() const
 {
-    return m_ViewCount.get();
+    return m_ViewCount;
 }
 
 void PubSubComment::setViewCount(int64_t value)
 {
     m_ViewCount = value;
+    m_FieldsSet.set(FieldBit_ViewCount);
 }
 
 bool PubSubComment::viewCountIsSet() const
 {
-    return m_ViewCount.has_value();
+    return m_FieldsSet.test(FieldBit_ViewCount);
 }
 
 void PubSubComment::unsetViewCount()
 {
-    m_ViewCount.reset();
+    m_FieldsSet.reset(FieldBit_ViewCount);
 }
 bool PubSubComment::isIsDeleted() const
 {
@@ -1716,17 +2724,17 @@ bool PubSubComment::isIsDeleted() const
 void PubSubComment::setIsDeleted(bool value)
 {
     m_IsDeleted = value;
-    m_IsDeletedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeleted);
 }
 
 bool PubSubComment::isDeletedIsSet() const
 {
-    return m_IsDeletedIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeleted);
 }
 
 void PubSubComment::unsetIsDeleted()
 {
-    m_IsDeletedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeleted);
 }
 bool PubSubComment::isIsDeletedUser() const
 {
@@ -1736,17 +2744,17 @@ bool PubSubComment::isIsDeletedUser() const
 void PubSubComment::setIsDeletedUser(bool value)
 {
     m_IsDeletedUser = value;
-    m_IsDeletedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeletedUser);
 }
 
 bool PubSubComment::isDeletedUserIsSet() const
 {
-    return m_IsDeletedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeletedUser);
 }
 
 void PubSubComment::unsetIsDeletedUser()
 {
-    m_IsDeletedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeletedUser);
 }
 bool PubSubComment::isIsSpam() const
 {
@@ -1756,37 +2764,38 @@ bool PubSubComment::isIsSpam() const
 void PubSubComment::setIsSpam(bool value)
 {
     m_IsSpam = value;
-    m_IsSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSpam);
 }
 
 bool PubSubComment::isSpamIsSet() const
 {
-    return m_IsSpamIsSet;
+    return m_FieldsSet.test(FieldBit_IsSpam);
 }
 
 void PubSubComment::unsetIsSpam()
 {
-    m_IsSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSpam);
 }
 utility::string_t PubSubComment::getAnonUserId() const
 {
-    return m_AnonUserId.get();
+    return m_AnonUserId;
 }
 
 
 void PubSubComment::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool PubSubComment::anonUserIdIsSet() const
 {
-    return m_AnonUserId.has_value();
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void PubSubComment::unsetAnonUserId()
 {
-    m_AnonUserId.reset();
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 std::vector<utility::string_t> PubSubComment::getFeedbackIds() const
 {
@@ -1797,56 +2806,58 @@ std::vector<utility::string_t> PubSubComment::getFeedbackIds() const
 void PubSubComment::setFeedbackIds(const std::vector<utility::string_t>& value)
 {
     m_FeedbackIds = value;
-    m_FeedbackIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackIds);
 }
 
 bool PubSubComment::feedbackIdsIsSet() const
 {
-    return m_FeedbackIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackIds);
 }
 
 void PubSubComment::unsetFeedbackIds()
 {
-    m_FeedbackIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackIds);
 }
 int32_t PubSubComment::getFlagCount() const
 {
-    return m_FlagCount.get();
+    return m_FlagCount;
 }
 
 void PubSubComment::setFlagCount(int32_t value)
 {
     m_FlagCount = value;
+    m_FieldsSet.set(FieldBit_FlagCount);
 }
 
 bool PubSubComment::flagCountIsSet() const
 {
-    return m_FlagCount.has_value();
+    return m_FieldsSet.test(FieldBit_FlagCount);
 }
 
 void PubSubComment::unsetFlagCount()
 {
-    m_FlagCount.reset();
+    m_FieldsSet.reset(FieldBit_FlagCount);
 }
 utility::string_t PubSubComment::getDomain() const
 {
-    return m_Domain.get();
+    return m_Domain;
 }
 
 
 void PubSubComment::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool PubSubComment::domainIsSet() const
 {
-    return m_Domain.has_value();
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void PubSubComment::unsetDomain()
 {
-    m_Domain.reset();
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 utility::string_t PubSubComment::getUrl() const
 {
@@ -1857,57 +2868,59 @@ utility::string_t PubSubComment::getUrl() const
 void PubSubComment::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool PubSubComment::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void PubSubComment::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t PubSubComment::getPageTitle() const
 {
-    return m_PageTitle.get();
+    return m_PageTitle;
 }
 
 
 void PubSubComment::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool PubSubComment::pageTitleIsSet() const
 {
-    return m_PageTitle.has_value();
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void PubSubComment::unsetPageTitle()
 {
-    m_PageTitle.reset();
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 utility::datetime PubSubComment::getExpireAt() const
 {
-    return m_ExpireAt.get();
+    return m_ExpireAt;
 }
 
 
 void PubSubComment::setExpireAt(const utility::datetime& value)
 {
     m_ExpireAt = value;
+    m_FieldsSet.set(FieldBit_ExpireAt);
 }
 
 bool PubSubComment::expireAtIsSet() const
 {
-    return m_ExpireAt.has_value();
+    return m_FieldsSet.test(FieldBit_ExpireAt);
 }
 
 void PubSubComment::unsetExpireAt()
 {
-    m_ExpireAt.reset();
+    m_FieldsSet.reset(FieldBit_ExpireAt);
 }
 bool PubSubComment::isReviewed() const
 {
@@ -1917,17 +2930,17 @@ bool PubSubComment::isReviewed() const
 void PubSubComment::setReviewed(bool value)
 {
     m_Reviewed = value;
-    m_ReviewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Reviewed);
 }
 
 bool PubSubComment::reviewedIsSet() const
 {
-    return m_ReviewedIsSet;
+    return m_FieldsSet.test(FieldBit_Reviewed);
 }
 
 void PubSubComment::unsetReviewed()
 {
-    m_ReviewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reviewed);
 }
 bool PubSubComment::isHasCode() const
 {
@@ -1937,17 +2950,17 @@ bool PubSubComment::isHasCode() const
 void PubSubComment::setHasCode(bool value)
 {
     m_HasCode = value;
-    m_HasCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_HasCode);
 }
 
 bool PubSubComment::hasCodeIsSet() const
 {
-    return m_HasCodeIsSet;
+    return m_FieldsSet.test(FieldBit_HasCode);
 }
 
 void PubSubComment::unsetHasCode()
 {
-    m_HasCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasCode);
 }
 bool PubSubComment::isApproved() const
 {
@@ -1957,37 +2970,38 @@ bool PubSubComment::isApproved() const
 void PubSubComment::setApproved(bool value)
 {
     m_Approved = value;
-    m_ApprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_Approved);
 }
 
 bool PubSubComment::approvedIsSet() const
 {
-    return m_ApprovedIsSet;
+    return m_FieldsSet.test(FieldBit_Approved);
 }
 
 void PubSubComment::unsetApproved()
 {
-    m_ApprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Approved);
 }
 utility::string_t PubSubComment::getLocale() const
 {
-    return m_Locale.get();
+    return m_Locale;
 }
 
 
 void PubSubComment::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool PubSubComment::localeIsSet() const
 {
-    return m_Locale.has_value();
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void PubSubComment::unsetLocale()
 {
-    m_Locale.reset();
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 bool PubSubComment::isIsBannedUser() const
 {
@@ -1997,37 +3011,38 @@ bool PubSubComment::isIsBannedUser() const
 void PubSubComment::setIsBannedUser(bool value)
 {
     m_IsBannedUser = value;
-    m_IsBannedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsBannedUser);
 }
 
 bool PubSubComment::isBannedUserIsSet() const
 {
-    return m_IsBannedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsBannedUser);
 }
 
 void PubSubComment::unsetIsBannedUser()
 {
-    m_IsBannedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsBannedUser);
 }
 std::vector<utility::string_t> PubSubComment::getGroupIds() const
 {
-    return m_GroupIds.get();
+    return m_GroupIds;
 }
 
 
 void PubSubComment::setGroupIds(const std::vector<utility::string_t>& value)
 {
     m_GroupIds = value;
+    m_FieldsSet.set(FieldBit_GroupIds);
 }
 
 bool PubSubComment::groupIdsIsSet() const
 {
-    return m_GroupIds.has_value();
+    return m_FieldsSet.test(FieldBit_GroupIds);
 }
 
 void PubSubComment::unsetGroupIds()
 {
-    m_GroupIds.reset();
+    m_FieldsSet.reset(FieldBit_GroupIds);
 }
 bool PubSubComment::isIsLive() const
 {
@@ -2037,17 +3052,17 @@ bool PubSubComment::isIsLive() const
 void PubSubComment::setIsLive(bool value)
 {
     m_IsLive = value;
-    m_IsLiveIsSet = true;
+    m_FieldsSet.set(FieldBit_IsLive);
 }
 
 bool PubSubComment::isLiveIsSet() const
 {
-    return m_IsLiveIsSet;
+    return m_FieldsSet.test(FieldBit_IsLive);
 }
 
 void PubSubComment::unsetIsLive()
 {
-    m_IsLiveIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsLive);
 }
 bool PubSubComment::isHidden() const
 {
@@ -2057,17 +3072,17 @@ bool PubSubComment::isHidden() const
 void PubSubComment::setHidden(bool value)
 {
     m_Hidden = value;
-    m_HiddenIsSet = true;
+    m_FieldsSet.set(FieldBit_Hidden);
 }
 
 bool PubSubComment::hiddenIsSet() const
 {
-    return m_HiddenIsSet;
+    return m_FieldsSet.test(FieldBit_Hidden);
 }
 
 void PubSubComment::unsetHidden()
 {
-    m_HiddenIsSet = false;
+    m_FieldsSet.reset(FieldBit_Hidden);
 }
 utility::string_t PubSubComment::getDate() const
 {
@@ -2078,17 +3093,17 @@ utility::string_t PubSubComment::getDate() const
 void PubSubComment::setDate(const utility::string_t& value)
 {
     m_date = value;
-    m_dateIsSet = true;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool PubSubComment::dateIsSet() const
 {
-    return m_dateIsSet;
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void PubSubComment::unsetdate()
 {
-    m_dateIsSet = false;
+    m_FieldsSet.reset(FieldBit_date);
 }
 
 }
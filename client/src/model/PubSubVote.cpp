@@ -20,20 +20,8 @@ namespace model {
 
 PubSubVote::PubSubVote()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_UrlIdRaw = utility::conversions::to_string_t("");
-    m_UrlIdRawIsSet = false;
-    m_CommentId = utility::conversions::to_string_t("");
-    m_CommentIdIsSet = false;
     m_Direction = 0;
-    m_DirectionIsSet = false;
     m_CreatedAt = 0L;
-    m_CreatedAtIsSet = false;
 }
 
 PubSubVote::~PubSubVote()
@@ -48,158 +36,406 @@ void PubSubVote::validate()
 web::json::value PubSubVote::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_UrlIdRawIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdRaw"))] = ModelBase::toJson(m_UrlIdRaw);
     }
-    if(m_CommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentId"))] = ModelBase::toJson(m_CommentId);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_DirectionIsSet)
+    if(m_FieldsSet.test(FieldBit_Direction))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("direction"))] = ModelBase::toJson(m_Direction);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_VerificationId.has_value())
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("verificationId"))] = ModelBase::toJson(m_VerificationId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("verificationId"))] = ModelBase::toJson(m_VerificationId);
     }
 
     return val;
 }
 
+void PubSubVote::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
+    {
+        
+        writer.key(_XPLATSTR("urlIdRaw"));
+        ModelBase::writeJson(writer, m_UrlIdRaw);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentId))
+    {
+        
+        writer.key(_XPLATSTR("commentId"));
+        ModelBase::writeJson(writer, m_CommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Direction))
+    {
+        
+        writer.key(_XPLATSTR("direction"));
+        ModelBase::writeJson(writer, m_Direction);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_VerificationId))
+    {
+        
+        writer.key(_XPLATSTR("verificationId"));
+        ModelBase::writeJson(writer, m_VerificationId);
+    }
+
+    writer.endObject();
+}
+
 bool PubSubVote::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdRaw")):
+            if(field.first == _XPLATSTR("urlIdRaw"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlIdRaw;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdRaw);
+                    setUrlIdRaw(refVal_setUrlIdRaw);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            if(field.first == _XPLATSTR("commentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
+                    setCommentId(refVal_setCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("direction")):
+            if(field.first == _XPLATSTR("direction"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setDirection;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDirection);
+                    setDirection(refVal_setDirection);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verificationId")):
+            if(field.first == _XPLATSTR("verificationId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setVerificationId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerificationId);
+                    setVerificationId(refVal_setVerificationId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    return ok;
+}
+
+void PubSubVote::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdRaw"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdRaw")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdRaw;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdRaw);
-            setUrlIdRaw(refVal_setUrlIdRaw);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
-            setCommentId(refVal_setCommentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdRaw")), m_UrlIdRaw);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("direction"))))
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("direction")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setDirection;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDirection);
-            setDirection(refVal_setDirection);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentId")), m_CommentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_Direction))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("direction")), m_Direction);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verificationId"))))
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verificationId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verificationId")), m_VerificationId);
+    }
+}
+
+bool PubSubVote::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setVerificationId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerificationId);
-            setVerificationId(refVal_setVerificationId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdRaw")):
+            {
+                utility::string_t refVal_setUrlIdRaw;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlIdRaw))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlIdRaw(refVal_setUrlIdRaw);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            {
+                utility::string_t refVal_setCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentId(refVal_setCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("direction")):
+            {
+                int32_t refVal_setDirection;
+                if(!ModelBase::readBinary(reader, field, refVal_setDirection))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDirection(refVal_setDirection);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                int64_t refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verificationId")):
+            {
+                utility::string_t refVal_setVerificationId;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerificationId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerificationId(refVal_setVerificationId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PubSubVote::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -209,41 +445,41 @@ void PubSubVote::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_UrlIdRawIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdRaw))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdRaw")), m_UrlIdRaw));
     }
-    if(m_CommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentId")), m_CommentId));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_DirectionIsSet)
+    if(m_FieldsSet.test(FieldBit_Direction))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("direction")), m_Direction));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_VerificationId.has_value())
+    if(m_FieldsSet.test(FieldBit_VerificationId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verificationId")), m_VerificationId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verificationId")), m_VerificationId));
     }
 }
 
@@ -323,17 +559,17 @@ utility::string_t PubSubVote::getId() const
 void PubSubVote::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool PubSubVote::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void PubSubVote::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t PubSubVote::getTenantId() const
 {
@@ -344,17 +580,17 @@ utility::string_t PubSubVote::getTenantId() const
 void PubSubVote::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool PubSubVote::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void PubSubVote::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t PubSubVote::getUrlId() const
 {
@@ -365,17 +601,17 @@ utility::string_t PubSubVote::getUrlId() const
 void PubSubVote::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool PubSubVote::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void PubSubVote::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t PubSubVote::getUrlIdRaw() const
 {
@@ -386,17 +622,17 @@ utility::string_t PubSubVote::getUrlIdRaw() const
 void PubSubVote::setUrlIdRaw(const utility::string_t& value)
 {
     m_UrlIdRaw = value;
-    m_UrlIdRawIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdRaw);
 }
 
 bool PubSubVote::urlIdRawIsSet() const
 {
-    return m_UrlIdRawIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdRaw);
 }
 
 void PubSubVote::unsetUrlIdRaw()
 {
-    m_UrlIdRawIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdRaw);
 }
 utility::string_t PubSubVote::getCommentId() const
 {
@@ -407,37 +643,38 @@ utility::string_t PubSubVote::getCommentId() const
 void PubSubVote::setCommentId(const utility::string_t& value)
 {
     m_CommentId = value;
-    m_CommentIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentId);
 }
 
 bool PubSubVote::commentIdIsSet() const
 {
-    return m_CommentIdIsSet;
+    return m_FieldsSet.test(FieldBit_CommentId);
 }
 
 void PubSubVote::unsetCommentId()
 {
-    m_CommentIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentId);
 }
 utility::string_t PubSubVote::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void PubSubVote::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool PubSubVote::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void PubSubVote::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 int32_t PubSubVote::getDirection() const
 {
@@ -447,17 +684,17 @@ int32_t PubSubVote::getDirection() const
 void PubSubVote::setDirection(int32_t value)
 {
     m_Direction = value;
-    m_DirectionIsSet = true;
+    m_FieldsSet.set(FieldBit_Direction);
 }
 
 bool PubSubVote::directionIsSet() const
 {
-    return m_DirectionIsSet;
+    return m_FieldsSet.test(FieldBit_Direction);
 }
 
 void PubSubVote::unsetDirection()
 {
-    m_DirectionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Direction);
 }
 int64_t PubSubVote::getCreatedAt() const
 {
@@ -467,37 +704,38 @@ int64_t PubSubVote::getCreatedAt() const
 void PubSubVote::setCreatedAt(int64_t value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool PubSubVote::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void PubSubVote::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t PubSubVote::getVerificationId() const
 {
-    return m_VerificationId.get();
+    return m_VerificationId;
 }
 
 
 void PubSubVote::setVerificationId(const utility::string_t& value)
 {
     m_VerificationId = value;
+    m_FieldsSet.set(FieldBit_VerificationId);
 }
 
 bool PubSubVote::verificationIdIsSet() const
 {
-    return m_VerificationId.has_value();
+    return m_FieldsSet.test(FieldBit_VerificationId);
 }
 
 void PubSubVote::unsetVerificationId()
 {
-    m_VerificationId.reset();
+    m_FieldsSet.reset(FieldBit_VerificationId);
 }
 
 }
@@ -20,10 +20,7 @@ namespace model {
 
 PublicAPIDeleteCommentResponse::PublicAPIDeleteCommentResponse()
 {
-    m_CommentIsSet = false;
     m_HardRemoved = false;
-    m_HardRemovedIsSet = false;
-    m_StatusIsSet = false;
 }
 
 PublicAPIDeleteCommentResponse::~PublicAPIDeleteCommentResponse()
@@ -38,17 +35,17 @@ void PublicAPIDeleteCommentResponse::validate()
 web::json::value PublicAPIDeleteCommentResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_HardRemovedIsSet)
+    if(m_FieldsSet.test(FieldBit_HardRemoved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hardRemoved"))] = ModelBase::toJson(m_HardRemoved);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -57,43 +54,153 @@ web::json::value PublicAPIDeleteCommentResponse::toJson() const
     return val;
 }
 
+void PublicAPIDeleteCommentResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_HardRemoved))
+    {
+        
+        writer.key(_XPLATSTR("hardRemoved"));
+        ModelBase::writeJson(writer, m_HardRemoved);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool PublicAPIDeleteCommentResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<DeletedCommentResultComment> refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hardRemoved"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hardRemoved")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setHardRemoved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHardRemoved);
-            setHardRemoved(refVal_setHardRemoved);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<DeletedCommentResultComment> refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hardRemoved")):
+            if(field.first == _XPLATSTR("hardRemoved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHardRemoved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHardRemoved);
+                    setHardRemoved(refVal_setHardRemoved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void PublicAPIDeleteCommentResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_HardRemoved))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hardRemoved")), m_HardRemoved);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool PublicAPIDeleteCommentResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                std::shared_ptr<DeletedCommentResultComment> refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hardRemoved")):
+            {
+                bool refVal_setHardRemoved;
+                if(!ModelBase::readBinary(reader, field, refVal_setHardRemoved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHardRemoved(refVal_setHardRemoved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PublicAPIDeleteCommentResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -103,15 +210,15 @@ void PublicAPIDeleteCommentResponse::toMultipart(std::shared_ptr<MultipartFormDa
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_HardRemovedIsSet)
+    if(m_FieldsSet.test(FieldBit_HardRemoved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hardRemoved")), m_HardRemoved));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -157,17 +264,17 @@ std::shared_ptr<DeletedCommentResultComment> PublicAPIDeleteCommentResponse::get
 void PublicAPIDeleteCommentResponse::setComment(const std::shared_ptr<DeletedCommentResultComment>& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool PublicAPIDeleteCommentResponse::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void PublicAPIDeleteCommentResponse::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 bool PublicAPIDeleteCommentResponse::isHardRemoved() const
 {
@@ -177,17 +284,17 @@ bool PublicAPIDeleteCommentResponse::isHardRemoved() const
 void PublicAPIDeleteCommentResponse::setHardRemoved(bool value)
 {
     m_HardRemoved = value;
-    m_HardRemovedIsSet = true;
+    m_FieldsSet.set(FieldBit_HardRemoved);
 }
 
 bool PublicAPIDeleteCommentResponse::hardRemovedIsSet() const
 {
-    return m_HardRemovedIsSet;
+    return m_FieldsSet.test(FieldBit_HardRemoved);
 }
 
 void PublicAPIDeleteCommentResponse::unsetHardRemoved()
 {
-    m_HardRemovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_HardRemoved);
 }
 std::shared_ptr<APIStatus> PublicAPIDeleteCommentResponse::getStatus() const
 {
@@ -198,17 +305,17 @@ std::shared_ptr<APIStatus> PublicAPIDeleteCommentResponse::getStatus() const
 void PublicAPIDeleteCommentResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool PublicAPIDeleteCommentResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void PublicAPIDeleteCommentResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
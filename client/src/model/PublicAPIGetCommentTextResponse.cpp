@@ -20,11 +20,6 @@ namespace model {
 
 PublicAPIGetCommentTextResponse::PublicAPIGetCommentTextResponse()
 {
-    m_StatusIsSet = false;
-    m_CommentText = utility::conversions::to_string_t("");
-    m_CommentTextIsSet = false;
-    m_SanitizedCommentText = utility::conversions::to_string_t("");
-    m_SanitizedCommentTextIsSet = false;
 }
 
 PublicAPIGetCommentTextResponse::~PublicAPIGetCommentTextResponse()
@@ -39,17 +34,17 @@ void PublicAPIGetCommentTextResponse::validate()
 web::json::value PublicAPIGetCommentTextResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentText"))] = ModelBase::toJson(m_CommentText);
     }
-    if(m_SanitizedCommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_SanitizedCommentText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sanitizedCommentText"))] = ModelBase::toJson(m_SanitizedCommentText);
@@ -58,43 +53,153 @@ web::json::value PublicAPIGetCommentTextResponse::toJson() const
     return val;
 }
 
+void PublicAPIGetCommentTextResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentText))
+    {
+        
+        writer.key(_XPLATSTR("commentText"));
+        ModelBase::writeJson(writer, m_CommentText);
+    }
+    if(m_FieldsSet.test(FieldBit_SanitizedCommentText))
+    {
+        
+        writer.key(_XPLATSTR("sanitizedCommentText"));
+        ModelBase::writeJson(writer, m_SanitizedCommentText);
+    }
+
+    writer.endObject();
+}
+
 bool PublicAPIGetCommentTextResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentText"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentText")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCommentText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentText);
-            setCommentText(refVal_setCommentText);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentText")):
+            if(field.first == _XPLATSTR("commentText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentText);
+                    setCommentText(refVal_setCommentText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sanitizedCommentText")):
+            if(field.first == _XPLATSTR("sanitizedCommentText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSanitizedCommentText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSanitizedCommentText);
+                    setSanitizedCommentText(refVal_setSanitizedCommentText);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sanitizedCommentText"))))
+    return ok;
+}
+
+void PublicAPIGetCommentTextResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentText))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentText")), m_CommentText);
+    }
+    if(m_FieldsSet.test(FieldBit_SanitizedCommentText))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sanitizedCommentText")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sanitizedCommentText")), m_SanitizedCommentText);
+    }
+}
+
+bool PublicAPIGetCommentTextResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setSanitizedCommentText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSanitizedCommentText);
-            setSanitizedCommentText(refVal_setSanitizedCommentText);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentText")):
+            {
+                utility::string_t refVal_setCommentText;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentText(refVal_setCommentText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sanitizedCommentText")):
+            {
+                utility::string_t refVal_setSanitizedCommentText;
+                if(!ModelBase::readBinary(reader, field, refVal_setSanitizedCommentText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSanitizedCommentText(refVal_setSanitizedCommentText);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PublicAPIGetCommentTextResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -104,15 +209,15 @@ void PublicAPIGetCommentTextResponse::toMultipart(std::shared_ptr<MultipartFormD
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentText")), m_CommentText));
     }
-    if(m_SanitizedCommentTextIsSet)
+    if(m_FieldsSet.test(FieldBit_SanitizedCommentText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sanitizedCommentText")), m_SanitizedCommentText));
     }
@@ -158,17 +263,17 @@ std::shared_ptr<APIStatus> PublicAPIGetCommentTextResponse::getStatus() const
 void PublicAPIGetCommentTextResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool PublicAPIGetCommentTextResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void PublicAPIGetCommentTextResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t PublicAPIGetCommentTextResponse::getCommentText() const
 {
@@ -179,17 +284,17 @@ utility::string_t PublicAPIGetCommentTextResponse::getCommentText() const
 void PublicAPIGetCommentTextResponse::setCommentText(const utility::string_t& value)
 {
     m_CommentText = value;
-    m_CommentTextIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentText);
 }
 
 bool PublicAPIGetCommentTextResponse::commentTextIsSet() const
 {
-    return m_CommentTextIsSet;
+    return m_FieldsSet.test(FieldBit_CommentText);
 }
 
 void PublicAPIGetCommentTextResponse::unsetCommentText()
 {
-    m_CommentTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentText);
 }
 utility::string_t PublicAPIGetCommentTextResponse::getSanitizedCommentText() const
 {
@@ -200,17 +305,17 @@ utility::string_t PublicAPIGetCommentTextResponse::getSanitizedCommentText() con
 void PublicAPIGetCommentTextResponse::setSanitizedCommentText(const utility::string_t& value)
 {
     m_SanitizedCommentText = value;
-    m_SanitizedCommentTextIsSet = true;
+    m_FieldsSet.set(FieldBit_SanitizedCommentText);
 }
 
 bool PublicAPIGetCommentTextResponse::sanitizedCommentTextIsSet() const
 {
-    return m_SanitizedCommentTextIsSet;
+    return m_FieldsSet.test(FieldBit_SanitizedCommentText);
 }
 
 void PublicAPIGetCommentTextResponse::unsetSanitizedCommentText()
 {
-    m_SanitizedCommentTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_SanitizedCommentText);
 }
 
 }
@@ -34,32 +34,96 @@ void PublicBlockFromCommentParams::validate()
 web::json::value PublicBlockFromCommentParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentIds.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentIds))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commentIds"))] = ModelBase::toJson(m_CommentIds.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commentIds"))] = ModelBase::toJson(m_CommentIds);
     }
 
     return val;
 }
 
+void PublicBlockFromCommentParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommentIds))
+    {
+        
+        writer.key(_XPLATSTR("commentIds"));
+        ModelBase::writeJson(writer, m_CommentIds);
+    }
+
+    writer.endObject();
+}
+
 bool PublicBlockFromCommentParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentIds"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentIds")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setCommentIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIds);
-            setCommentIds(refVal_setCommentIds);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commentIds")):
+            if(field.first == _XPLATSTR("commentIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setCommentIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIds);
+                    setCommentIds(refVal_setCommentIds);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void PublicBlockFromCommentParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommentIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentIds")), m_CommentIds);
+    }
+}
+
+bool PublicBlockFromCommentParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("commentIds")):
+            {
+                std::vector<utility::string_t> refVal_setCommentIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentIds(refVal_setCommentIds);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void PublicBlockFromCommentParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -67,9 +131,9 @@ void PublicBlockFromCommentParams::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentIds.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentIds))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentIds")), m_CommentIds.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentIds")), m_CommentIds));
     }
 }
 
@@ -94,23 +158,24 @@ bool PublicBlockFromCommentParams::fromMultiPart(std::shared_ptr<MultipartFormDa
 
 std::vector<utility::string_t> PublicBlockFromCommentParams::getCommentIds() const
 {
-    return m_CommentIds.get();
+    return m_CommentIds;
 }
 
 
 void PublicBlockFromCommentParams::setCommentIds(const std::vector<utility::string_t>& value)
 {
     m_CommentIds = value;
+    m_FieldsSet.set(FieldBit_CommentIds);
 }
 
 bool PublicBlockFromCommentParams::commentIdsIsSet() const
 {
-    return m_CommentIds.has_value();
+    return m_FieldsSet.test(FieldBit_CommentIds);
 }
 
 void PublicBlockFromCommentParams::unsetCommentIds()
 {
-    m_CommentIds.reset();
+    m_FieldsSet.reset(FieldBit_CommentIds);
 }
 
 }
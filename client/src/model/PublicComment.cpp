@@ -20,52 +20,30 @@ namespace model {
 
 PublicComment::PublicComment()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_CommenterName = utility::conversions::to_string_t("");
-    m_CommenterNameIsSet = false;
-    m_CommentHTML = utility::conversions::to_string_t("");
-    m_CommentHTMLIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
     m_HasImages = false;
-    m_HasImagesIsSet = false;
     m_IsByAdmin = false;
-    m_IsByAdminIsSet = false;
     m_IsByModerator = false;
-    m_IsByModeratorIsSet = false;
     m_IsDeleted = false;
-    m_IsDeletedIsSet = false;
     m_IsDeletedUser = false;
-    m_IsDeletedUserIsSet = false;
     m_IsSpam = false;
-    m_IsSpamIsSet = false;
-    m_FeedbackIdsIsSet = false;
     m_RequiresVerification = false;
-    m_RequiresVerificationIsSet = false;
-    m_EditKey = utility::conversions::to_string_t("");
-    m_EditKeyIsSet = false;
     m_Approved = false;
-    m_ApprovedIsSet = false;
     m_IsUnread = false;
-    m_IsUnreadIsSet = false;
-    m_MyVoteId = utility::conversions::to_string_t("");
-    m_MyVoteIdIsSet = false;
     m_IsVotedDown = false;
-    m_IsVotedDownIsSet = false;
     m_IsVotedUp = false;
-    m_IsVotedUpIsSet = false;
     m_HasChildren = false;
-    m_HasChildrenIsSet = false;
     m_NestedChildrenCount = 0;
-    m_NestedChildrenCountIsSet = false;
     m_ChildCount = 0;
-    m_ChildCountIsSet = false;
-    m_ChildrenIsSet = false;
     m_IsFlagged = false;
-    m_IsFlaggedIsSet = false;
     m_IsBlocked = false;
-    m_IsBlockedIsSet = false;
+    m_Votes = 0;
+    m_VotesUp = 0;
+    m_VotesDown = 0;
+    m_IsPinned = false;
+    m_IsLocked = false;
+    m_Rating = 0.0;
+    m_ViewCount = 0L;
 }
 
 PublicComment::~PublicComment()
@@ -80,197 +58,197 @@ void PublicComment::validate()
 web::json::value PublicComment::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterLink"))] = ModelBase::toJson(m_CommenterLink);
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentHTML"))] = ModelBase::toJson(m_CommentHTML);
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("parentId"))] = ModelBase::toJson(m_ParentId);
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("date"))] = ModelBase::toJson(m_date);
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votes"))] = ModelBase::toJson(m_Votes);
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesUp"))] = ModelBase::toJson(m_VotesUp);
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("votesDown"))] = ModelBase::toJson(m_VotesDown);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasImages"))] = ModelBase::toJson(m_HasImages);
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))] = ModelBase::toJson(m_IsByAdmin);
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isByModerator"))] = ModelBase::toJson(m_IsByModerator);
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isPinned"))] = ModelBase::toJson(m_IsPinned);
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("isLocked"))] = ModelBase::toJson(m_IsLocked);
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("rating"))] = ModelBase::toJson(m_Rating);
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_ViewCount.has_value())
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("viewCount"))] = ModelBase::toJson(m_ViewCount.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("viewCount"))] = ModelBase::toJson(m_ViewCount);
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeleted"))] = ModelBase::toJson(m_IsDeleted);
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))] = ModelBase::toJson(m_IsDeletedUser);
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSpam"))] = ModelBase::toJson(m_IsSpam);
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))] = ModelBase::toJson(m_FeedbackIds);
     }
-    if(m_RequiresVerificationIsSet)
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("requiresVerification"))] = ModelBase::toJson(m_RequiresVerification);
     }
-    if(m_EditKeyIsSet)
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("editKey"))] = ModelBase::toJson(m_EditKey);
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("approved"))] = ModelBase::toJson(m_Approved);
     }
-    if(m_IsUnreadIsSet)
+    if(m_FieldsSet.test(FieldBit_IsUnread))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isUnread"))] = ModelBase::toJson(m_IsUnread);
     }
-    if(m_MyVoteIdIsSet)
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("myVoteId"))] = ModelBase::toJson(m_MyVoteId);
     }
-    if(m_IsVotedDownIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isVotedDown"))] = ModelBase::toJson(m_IsVotedDown);
     }
-    if(m_IsVotedUpIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isVotedUp"))] = ModelBase::toJson(m_IsVotedUp);
     }
-    if(m_HasChildrenIsSet)
+    if(m_FieldsSet.test(FieldBit_HasChildren))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasChildren"))] = ModelBase::toJson(m_HasChildren);
     }
-    if(m_NestedChildrenCountIsSet)
+    if(m_FieldsSet.test(FieldBit_NestedChildrenCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("nestedChildrenCount"))] = ModelBase::toJson(m_NestedChildrenCount);
     }
-    if(m_ChildCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ChildCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("childCount"))] = ModelBase::toJson(m_ChildCount);
     }
-    if(m_ChildrenIsSet)
+    if(m_FieldsSet.test(FieldBit_Children))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("children"))] = ModelBase::toJson(m_Children);
     }
-    if(m_IsFlaggedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFlagged))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isFlagged"))] = ModelBase::toJson(m_IsFlagged);
     }
-    if(m_IsBlockedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBlocked))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isBlocked"))] = ModelBase::toJson(m_IsBlocked);
@@ -279,439 +257,1373 @@ web::json::value PublicComment::toJson() const
     return val;
 }
 
+void PublicComment::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
+    {
+        
+        writer.key(_XPLATSTR("commenterLink"));
+        ModelBase::writeJson(writer, m_CommenterLink);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
+    {
+        
+        writer.key(_XPLATSTR("commentHTML"));
+        ModelBase::writeJson(writer, m_CommentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_ParentId))
+    {
+        
+        writer.key(_XPLATSTR("parentId"));
+        ModelBase::writeJson(writer, m_ParentId);
+    }
+    if(m_FieldsSet.test(FieldBit_date))
+    {
+        
+        writer.key(_XPLATSTR("date"));
+        ModelBase::writeJson(writer, m_date);
+    }
+    if(m_FieldsSet.test(FieldBit_Votes))
+    {
+        
+        writer.key(_XPLATSTR("votes"));
+        ModelBase::writeJson(writer, m_Votes);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesUp))
+    {
+        
+        writer.key(_XPLATSTR("votesUp"));
+        ModelBase::writeJson(writer, m_VotesUp);
+    }
+    if(m_FieldsSet.test(FieldBit_VotesDown))
+    {
+        
+        writer.key(_XPLATSTR("votesDown"));
+        ModelBase::writeJson(writer, m_VotesDown);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_HasImages))
+    {
+        
+        writer.key(_XPLATSTR("hasImages"));
+        ModelBase::writeJson(writer, m_HasImages);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isByAdmin"));
+        ModelBase::writeJson(writer, m_IsByAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
+    {
+        
+        writer.key(_XPLATSTR("isByModerator"));
+        ModelBase::writeJson(writer, m_IsByModerator);
+    }
+    if(m_FieldsSet.test(FieldBit_IsPinned))
+    {
+        
+        writer.key(_XPLATSTR("isPinned"));
+        ModelBase::writeJson(writer, m_IsPinned);
+    }
+    if(m_FieldsSet.test(FieldBit_IsLocked))
+    {
+        
+        writer.key(_XPLATSTR("isLocked"));
+        ModelBase::writeJson(writer, m_IsLocked);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_Rating))
+    {
+        
+        writer.key(_XPLATSTR("rating"));
+        ModelBase::writeJson(writer, m_Rating);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_ViewCount))
+    {
+        
+        writer.key(_XPLATSTR("viewCount"));
+        ModelBase::writeJson(writer, m_ViewCount);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
+    {
+        
+        writer.key(_XPLATSTR("isDeleted"));
+        ModelBase::writeJson(writer, m_IsDeleted);
+    }
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
+    {
+        
+        writer.key(_XPLATSTR("isDeletedUser"));
+        ModelBase::writeJson(writer, m_IsDeletedUser);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSpam))
+    {
+        
+        writer.key(_XPLATSTR("isSpam"));
+        ModelBase::writeJson(writer, m_IsSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
+    {
+        
+        writer.key(_XPLATSTR("feedbackIds"));
+        ModelBase::writeJson(writer, m_FeedbackIds);
+    }
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
+    {
+        
+        writer.key(_XPLATSTR("requiresVerification"));
+        ModelBase::writeJson(writer, m_RequiresVerification);
+    }
+    if(m_FieldsSet.test(FieldBit_EditKey))
+    {
+        
+        writer.key(_XPLATSTR("editKey"));
+        ModelBase::writeJson(writer, m_EditKey);
+    }
+    if(m_FieldsSet.test(FieldBit_Approved))
+    {
+        
+        writer.key(_XPLATSTR("approved"));
+        ModelBase::writeJson(writer, m_Approved);
+    }
+    if(m_FieldsSet.test(FieldBit_IsUnread))
+    {
+        
+        writer.key(_XPLATSTR("isUnread"));
+        ModelBase::writeJson(writer, m_IsUnread);
+    }
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
+    {
+        
+        writer.key(_XPLATSTR("myVoteId"));
+        ModelBase::writeJson(writer, m_MyVoteId);
+    }
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
+    {
+        
+        writer.key(_XPLATSTR("isVotedDown"));
+        ModelBase::writeJson(writer, m_IsVotedDown);
+    }
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
+    {
+        
+        writer.key(_XPLATSTR("isVotedUp"));
+        ModelBase::writeJson(writer, m_IsVotedUp);
+    }
+    if(m_FieldsSet.test(FieldBit_HasChildren))
+    {
+        
+        writer.key(_XPLATSTR("hasChildren"));
+        ModelBase::writeJson(writer, m_HasChildren);
+    }
+    if(m_FieldsSet.test(FieldBit_NestedChildrenCount))
+    {
+        
+        writer.key(_XPLATSTR("nestedChildrenCount"));
+        ModelBase::writeJson(writer, m_NestedChildrenCount);
+    }
+    if(m_FieldsSet.test(FieldBit_ChildCount))
+    {
+        
+        writer.key(_XPLATSTR("childCount"));
+        ModelBase::writeJson(writer, m_ChildCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Children))
+    {
+        
+        writer.key(_XPLATSTR("children"));
+        ModelBase::writeJson(writer, m_Children);
+    }
+    if(m_FieldsSet.test(FieldBit_IsFlagged))
+    {
+        
+        writer.key(_XPLATSTR("isFlagged"));
+        ModelBase::writeJson(writer, m_IsFlagged);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBlocked))
+    {
+        
+        writer.key(_XPLATSTR("isBlocked"));
+        ModelBase::writeJson(writer, m_IsBlocked);
+    }
+
+    writer.endObject();
+}
+
 bool PublicComment::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_CommenterName);
+                    m_FieldsSet.set(FieldBit_CommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            if(field.first == _XPLATSTR("commenterLink"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterLink;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
+                    setCommenterLink(refVal_setCommenterLink);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            if(field.first == _XPLATSTR("commentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
+                    setCommentHTML(refVal_setCommentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            if(field.first == _XPLATSTR("parentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setParentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
+                    setParentId(refVal_setParentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            if(field.first == _XPLATSTR("date"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
+                    setDate(refVal_setDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            if(field.first == _XPLATSTR("votes"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotes;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
+                    setVotes(refVal_setVotes);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            if(field.first == _XPLATSTR("votesUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
+                    setVotesUp(refVal_setVotesUp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            if(field.first == _XPLATSTR("votesDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setVotesDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
+                    setVotesDown(refVal_setVotesDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    ok &= ModelBase::fromJson(fieldValue, m_AvatarSrc);
+                    m_FieldsSet.set(FieldBit_AvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            if(field.first == _XPLATSTR("hasImages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasImages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
+                    setHasImages(refVal_setHasImages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            if(field.first == _XPLATSTR("isByAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
+                    setIsByAdmin(refVal_setIsByAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            if(field.first == _XPLATSTR("isByModerator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsByModerator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
+                    setIsByModerator(refVal_setIsByModerator);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            if(field.first == _XPLATSTR("isPinned"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsPinned;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
+                    setIsPinned(refVal_setIsPinned);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            if(field.first == _XPLATSTR("isLocked"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsLocked;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
+                    setIsLocked(refVal_setIsLocked);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            if(field.first == _XPLATSTR("rating"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setRating;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
+                    setRating(refVal_setRating);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("viewCount")):
+            if(field.first == _XPLATSTR("viewCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setViewCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setViewCount);
+                    setViewCount(refVal_setViewCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            if(field.first == _XPLATSTR("isDeleted"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeleted;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
+                    setIsDeleted(refVal_setIsDeleted);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            if(field.first == _XPLATSTR("isDeletedUser"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsDeletedUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
+                    setIsDeletedUser(refVal_setIsDeletedUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            if(field.first == _XPLATSTR("isSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
+                    setIsSpam(refVal_setIsSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            if(field.first == _XPLATSTR("feedbackIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeedbackIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
+                    setFeedbackIds(refVal_setFeedbackIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("requiresVerification")):
+            if(field.first == _XPLATSTR("requiresVerification"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setRequiresVerification;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRequiresVerification);
+                    setRequiresVerification(refVal_setRequiresVerification);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("editKey")):
+            if(field.first == _XPLATSTR("editKey"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEditKey;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEditKey);
+                    setEditKey(refVal_setEditKey);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            if(field.first == _XPLATSTR("approved"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setApproved;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
+                    setApproved(refVal_setApproved);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isUnread")):
+            if(field.first == _XPLATSTR("isUnread"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsUnread;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsUnread);
+                    setIsUnread(refVal_setIsUnread);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("myVoteId")):
+            if(field.first == _XPLATSTR("myVoteId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setMyVoteId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMyVoteId);
+                    setMyVoteId(refVal_setMyVoteId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedDown")):
+            if(field.first == _XPLATSTR("isVotedDown"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsVotedDown;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedDown);
+                    setIsVotedDown(refVal_setIsVotedDown);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedUp")):
+            if(field.first == _XPLATSTR("isVotedUp"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsVotedUp;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedUp);
+                    setIsVotedUp(refVal_setIsVotedUp);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasChildren")):
+            if(field.first == _XPLATSTR("hasChildren"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasChildren;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasChildren);
+                    setHasChildren(refVal_setHasChildren);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("nestedChildrenCount")):
+            if(field.first == _XPLATSTR("nestedChildrenCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setNestedChildrenCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNestedChildrenCount);
+                    setNestedChildrenCount(refVal_setNestedChildrenCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("childCount")):
+            if(field.first == _XPLATSTR("childCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setChildCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setChildCount);
+                    setChildCount(refVal_setChildCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("children")):
+            if(field.first == _XPLATSTR("children"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<PublicComment>> refVal_setChildren;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setChildren);
+                    setChildren(refVal_setChildren);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isFlagged")):
+            if(field.first == _XPLATSTR("isFlagged"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsFlagged;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsFlagged);
+                    setIsFlagged(refVal_setIsFlagged);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isBlocked")):
+            if(field.first == _XPLATSTR("isBlocked"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsBlocked;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsBlocked);
+                    setIsBlocked(refVal_setIsBlocked);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    return ok;
+}
+
+void PublicComment::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterLink"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterLink")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterLink;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterLink);
-            setCommenterLink(refVal_setCommenterLink);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentHTML"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentHTML")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentHTML);
-            setCommentHTML(refVal_setCommentHTML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("parentId"))))
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("parentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setParentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setParentId);
-            setParentId(refVal_setParentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterLink")), m_CommenterLink);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("date"))))
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("date")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDate);
-            setDate(refVal_setDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentHTML")), m_CommentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votes"))))
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votes")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotes;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotes);
-            setVotes(refVal_setVotes);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("parentId")), m_ParentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesUp"))))
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesUp")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesUp);
-            setVotesUp(refVal_setVotesUp);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("date")), m_date);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("votesDown"))))
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("votesDown")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setVotesDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVotesDown);
-            setVotesDown(refVal_setVotesDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votes")), m_Votes);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesUp")), m_VotesUp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votesDown")), m_VotesDown);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasImages"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasImages")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasImages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasImages);
-            setHasImages(refVal_setHasImages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByAdmin"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByAdmin);
-            setIsByAdmin(refVal_setIsByAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isByModerator"))))
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isByModerator")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsByModerator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsByModerator);
-            setIsByModerator(refVal_setIsByModerator);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasImages")), m_HasImages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isPinned"))))
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isPinned")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsPinned;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsPinned);
-            setIsPinned(refVal_setIsPinned);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByAdmin")), m_IsByAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isLocked"))))
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isLocked")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsLocked;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsLocked);
-            setIsLocked(refVal_setIsLocked);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isByModerator")), m_IsByModerator);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isPinned")), m_IsPinned);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("rating"))))
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("rating")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setRating;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRating);
-            setRating(refVal_setRating);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isLocked")), m_IsLocked);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("viewCount"))))
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("viewCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setViewCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setViewCount);
-            setViewCount(refVal_setViewCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("rating")), m_Rating);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeleted"))))
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeleted")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeleted;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeleted);
-            setIsDeleted(refVal_setIsDeleted);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser"))))
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsDeletedUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsDeletedUser);
-            setIsDeletedUser(refVal_setIsDeletedUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("viewCount")), m_ViewCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSpam"))))
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSpam);
-            setIsSpam(refVal_setIsSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeleted")), m_IsDeleted);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isDeletedUser")), m_IsDeletedUser);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedbackIds"))))
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedbackIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeedbackIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedbackIds);
-            setFeedbackIds(refVal_setFeedbackIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSpam")), m_IsSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("requiresVerification"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("requiresVerification")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setRequiresVerification;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRequiresVerification);
-            setRequiresVerification(refVal_setRequiresVerification);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("editKey"))))
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("editKey")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEditKey;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEditKey);
-            setEditKey(refVal_setEditKey);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedbackIds")), m_FeedbackIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("approved"))))
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("approved")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setApproved;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setApproved);
-            setApproved(refVal_setApproved);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("requiresVerification")), m_RequiresVerification);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isUnread"))))
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isUnread")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsUnread;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsUnread);
-            setIsUnread(refVal_setIsUnread);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("editKey")), m_EditKey);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("myVoteId"))))
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("myVoteId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setMyVoteId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMyVoteId);
-            setMyVoteId(refVal_setMyVoteId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("approved")), m_Approved);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isVotedDown"))))
+    if(m_FieldsSet.test(FieldBit_IsUnread))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isVotedDown")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsVotedDown;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedDown);
-            setIsVotedDown(refVal_setIsVotedDown);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isUnread")), m_IsUnread);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isVotedUp"))))
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isVotedUp")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsVotedUp;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsVotedUp);
-            setIsVotedUp(refVal_setIsVotedUp);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("myVoteId")), m_MyVoteId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasChildren"))))
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasChildren")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasChildren;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasChildren);
-            setHasChildren(refVal_setHasChildren);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isVotedDown")), m_IsVotedDown);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("nestedChildrenCount"))))
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("nestedChildrenCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setNestedChildrenCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNestedChildrenCount);
-            setNestedChildrenCount(refVal_setNestedChildrenCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isVotedUp")), m_IsVotedUp);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("childCount"))))
+    if(m_FieldsSet.test(FieldBit_HasChildren))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("childCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setChildCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setChildCount);
-            setChildCount(refVal_setChildCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasChildren")), m_HasChildren);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("children"))))
+    if(m_FieldsSet.test(FieldBit_NestedChildrenCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("children")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<PublicComment>> refVal_setChildren;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setChildren);
-            setChildren(refVal_setChildren);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("nestedChildrenCount")), m_NestedChildrenCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isFlagged"))))
+    if(m_FieldsSet.test(FieldBit_ChildCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isFlagged")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsFlagged;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsFlagged);
-            setIsFlagged(refVal_setIsFlagged);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("childCount")), m_ChildCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Children))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("children")), m_Children);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isBlocked"))))
+    if(m_FieldsSet.test(FieldBit_IsFlagged))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isBlocked")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isFlagged")), m_IsFlagged);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBlocked))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isBlocked")), m_IsBlocked);
+    }
+}
+
+bool PublicComment::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setIsBlocked;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsBlocked);
-            setIsBlocked(refVal_setIsBlocked);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_CommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_CommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterLink")):
+            {
+                utility::string_t refVal_setCommenterLink;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterLink))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterLink(refVal_setCommenterLink);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentHTML")):
+            {
+                utility::string_t refVal_setCommentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentHTML(refVal_setCommentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("parentId")):
+            {
+                utility::string_t refVal_setParentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setParentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setParentId(refVal_setParentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("date")):
+            {
+                utility::datetime refVal_setDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDate(refVal_setDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votes")):
+            {
+                int32_t refVal_setVotes;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotes))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotes(refVal_setVotes);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesUp")):
+            {
+                int32_t refVal_setVotesUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesUp(refVal_setVotesUp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("votesDown")):
+            {
+                int32_t refVal_setVotesDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setVotesDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVotesDown(refVal_setVotesDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                if(!ModelBase::readBinary(reader, field, m_AvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                m_FieldsSet.set(FieldBit_AvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasImages")):
+            {
+                bool refVal_setHasImages;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasImages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasImages(refVal_setHasImages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByAdmin")):
+            {
+                bool refVal_setIsByAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByAdmin(refVal_setIsByAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isByModerator")):
+            {
+                bool refVal_setIsByModerator;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsByModerator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsByModerator(refVal_setIsByModerator);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isPinned")):
+            {
+                bool refVal_setIsPinned;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsPinned))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsPinned(refVal_setIsPinned);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isLocked")):
+            {
+                bool refVal_setIsLocked;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsLocked))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsLocked(refVal_setIsLocked);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("rating")):
+            {
+                double refVal_setRating;
+                if(!ModelBase::readBinary(reader, field, refVal_setRating))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRating(refVal_setRating);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("viewCount")):
+            {
+                int64_t refVal_setViewCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setViewCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setViewCount(refVal_setViewCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeleted")):
+            {
+                bool refVal_setIsDeleted;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeleted))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeleted(refVal_setIsDeleted);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isDeletedUser")):
+            {
+                bool refVal_setIsDeletedUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsDeletedUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsDeletedUser(refVal_setIsDeletedUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSpam")):
+            {
+                bool refVal_setIsSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSpam(refVal_setIsSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedbackIds")):
+            {
+                std::vector<utility::string_t> refVal_setFeedbackIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedbackIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedbackIds(refVal_setFeedbackIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("requiresVerification")):
+            {
+                bool refVal_setRequiresVerification;
+                if(!ModelBase::readBinary(reader, field, refVal_setRequiresVerification))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRequiresVerification(refVal_setRequiresVerification);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("editKey")):
+            {
+                utility::string_t refVal_setEditKey;
+                if(!ModelBase::readBinary(reader, field, refVal_setEditKey))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEditKey(refVal_setEditKey);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("approved")):
+            {
+                bool refVal_setApproved;
+                if(!ModelBase::readBinary(reader, field, refVal_setApproved))
+                {
+                    ok = false;
+                    continue;
+                }
+                setApproved(refVal_setApproved);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isUnread")):
+            {
+                bool refVal_setIsUnread;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsUnread))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsUnread(refVal_setIsUnread);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("myVoteId")):
+            {
+                utility::string_t refVal_setMyVoteId;
+                if(!ModelBase::readBinary(reader, field, refVal_setMyVoteId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMyVoteId(refVal_setMyVoteId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedDown")):
+            {
+                bool refVal_setIsVotedDown;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsVotedDown))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsVotedDown(refVal_setIsVotedDown);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isVotedUp")):
+            {
+                bool refVal_setIsVotedUp;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsVotedUp))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsVotedUp(refVal_setIsVotedUp);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasChildren")):
+            {
+                bool refVal_setHasChildren;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasChildren))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasChildren(refVal_setHasChildren);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("nestedChildrenCount")):
+            {
+                int32_t refVal_setNestedChildrenCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setNestedChildrenCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNestedChildrenCount(refVal_setNestedChildrenCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("childCount")):
+            {
+                int32_t refVal_setChildCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setChildCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setChildCount(refVal_setChildCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("children")):
+            {
+                std::vector<std::shared_ptr<PublicComment>> refVal_setChildren;
+                if(!ModelBase::readBinary(reader, field, refVal_setChildren))
+                {
+                    ok = false;
+                    continue;
+                }
+                setChildren(refVal_setChildren);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isFlagged")):
+            {
+                bool refVal_setIsFlagged;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsFlagged))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsFlagged(refVal_setIsFlagged);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isBlocked")):
+            {
+                bool refVal_setIsBlocked;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsBlocked))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsBlocked(refVal_setIsBlocked);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PublicComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -721,159 +1633,159 @@ void PublicComment::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_CommenterNameIsSet)
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_CommenterLink.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterLink))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterLink")), m_CommenterLink));
     }
-    if(m_CommentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentHTML")), m_CommentHTML));
     }
-    if(m_ParentId.has_value())
+    if(m_FieldsSet.test(FieldBit_ParentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("parentId")), m_ParentId));
     }
-    if(m_date.has_value())
+    if(m_FieldsSet.test(FieldBit_date))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("date")), m_date));
     }
-    if(m_Votes.has_value())
+    if(m_FieldsSet.test(FieldBit_Votes))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votes")), m_Votes));
     }
-    if(m_VotesUp.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesUp))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesUp")), m_VotesUp));
     }
-    if(m_VotesDown.has_value())
+    if(m_FieldsSet.test(FieldBit_VotesDown))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("votesDown")), m_VotesDown));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_HasImagesIsSet)
+    if(m_FieldsSet.test(FieldBit_HasImages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasImages")), m_HasImages));
     }
-    if(m_IsByAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByAdmin")), m_IsByAdmin));
     }
-    if(m_IsByModeratorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsByModerator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isByModerator")), m_IsByModerator));
     }
-    if(m_IsPinned.has_value())
+    if(m_FieldsSet.test(FieldBit_IsPinned))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isPinned")), m_IsPinned));
     }
-    if(m_IsLocked.has_value())
+    if(m_FieldsSet.test(FieldBit_IsLocked))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isLocked")), m_IsLocked));
     }
-    if(m_DisplayLabel.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_Rating.has_value())
+    if(m_FieldsSet.test(FieldBit_Rating))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("rating")), m_Rating));
     }
-    if(m_Badges.has_value())
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_ViewCount.has_value())
+    if(m_FieldsSet.test(FieldBit_ViewCount))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewCount")), m_ViewCount.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewCount")), m_ViewCount));
     }
-    if(m_IsDeletedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeleted))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeleted")), m_IsDeleted));
     }
-    if(m_IsDeletedUserIsSet)
+    if(m_FieldsSet.test(FieldBit_IsDeletedUser))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isDeletedUser")), m_IsDeletedUser));
     }
-    if(m_IsSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSpam")), m_IsSpam));
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_FeedbackIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedbackIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedbackIds")), m_FeedbackIds));
     }
-    if(m_RequiresVerificationIsSet)
+    if(m_FieldsSet.test(FieldBit_RequiresVerification))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("requiresVerification")), m_RequiresVerification));
     }
-    if(m_EditKeyIsSet)
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("editKey")), m_EditKey));
     }
-    if(m_ApprovedIsSet)
+    if(m_FieldsSet.test(FieldBit_Approved))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("approved")), m_Approved));
     }
-    if(m_IsUnreadIsSet)
+    if(m_FieldsSet.test(FieldBit_IsUnread))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isUnread")), m_IsUnread));
     }
-    if(m_MyVoteIdIsSet)
+    if(m_FieldsSet.test(FieldBit_MyVoteId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("myVoteId")), m_MyVoteId));
     }
-    if(m_IsVotedDownIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedDown))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isVotedDown")), m_IsVotedDown));
     }
-    if(m_IsVotedUpIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVotedUp))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isVotedUp")), m_IsVotedUp));
     }
-    if(m_HasChildrenIsSet)
+    if(m_FieldsSet.test(FieldBit_HasChildren))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasChildren")), m_HasChildren));
     }
-    if(m_NestedChildrenCountIsSet)
+    if(m_FieldsSet.test(FieldBit_NestedChildrenCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("nestedChildrenCount")), m_NestedChildrenCount));
     }
-    if(m_ChildCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ChildCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("childCount")), m_ChildCount));
     }
-    if(m_ChildrenIsSet)
+    if(m_FieldsSet.test(FieldBit_Children))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("children")), m_Children));
     }
-    if(m_IsFlaggedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFlagged))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isFlagged")), m_IsFlagged));
     }
-    if(m_IsBlockedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBlocked))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isBlocked")), m_IsBlocked));
     }
@@ -1135,37 +2047,38 @@ utility::string_t PublicComment::getId() const
 void PublicComment::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool PublicComment::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void PublicComment::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t PublicComment::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void PublicComment::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool PublicComment::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void PublicComment::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t PublicComment::getCommenterName() const
 {
@@ -1176,37 +2089,38 @@ utility::string_t PublicComment::getCommenterName() const
 void PublicComment::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
-    m_CommenterNameIsSet = true;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool PublicComment::commenterNameIsSet() const
 {
-    return m_CommenterNameIsSet;
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void PublicComment::unsetCommenterName()
 {
-    m_CommenterNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 utility::string_t PublicComment::getCommenterLink() const
 {
-    return m_CommenterLink.get();
+    return m_CommenterLink;
 }
 
 
 void PublicComment::setCommenterLink(const utility::string_t& value)
 {
     m_CommenterLink = value;
+    m_FieldsSet.set(FieldBit_CommenterLink);
 }
 
 bool PublicComment::commenterLinkIsSet() const
 {
-    return m_CommenterLink.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterLink);
 }
 
 void PublicComment::unsetCommenterLink()
 {
-    m_CommenterLink.reset();
+    m_FieldsSet.reset(FieldBit_CommenterLink);
 }
 utility::string_t PublicComment::getCommentHTML() const
 {
@@ -1217,114 +2131,119 @@ utility::string_t PublicComment::getCommentHTML() const
 void PublicComment::setCommentHTML(const utility::string_t& value)
 {
     m_CommentHTML = value;
-    m_CommentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentHTML);
 }
 
 bool PublicComment::commentHTMLIsSet() const
 {
-    return m_CommentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_CommentHTML);
 }
 
 void PublicComment::unsetCommentHTML()
 {
-    m_CommentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentHTML);
 }
 utility::string_t PublicComment::getParentId() const
 {
-    return m_ParentId.get();
+    return m_ParentId;
 }
 
 
 void PublicComment::setParentId(const utility::string_t& value)
 {
     m_ParentId = value;
+    m_FieldsSet.set(FieldBit_ParentId);
 }
 
 bool PublicComment::parentIdIsSet() const
 {
-    return m_ParentId.has_value();
+    return m_FieldsSet.test(FieldBit_ParentId);
 }
 
 void PublicComment::unsetParentId()
 {
-    m_ParentId.reset();
+    m_FieldsSet.reset(FieldBit_ParentId);
 }
 utility::datetime PublicComment::getDate() const
 {
-    return m_date.get();
+    return m_date;
 }
 
 
 void PublicComment::setDate(const utility::datetime& value)
 {
     m_date = value;
+    m_FieldsSet.set(FieldBit_date);
 }
 
 bool PublicComment::dateIsSet() const
 {
-    return m_date.has_value();
+    return m_FieldsSet.test(FieldBit_date);
 }
 
 void PublicComment::unsetdate()
 {
-    m_date.reset();
+    m_FieldsSet.reset(FieldBit_date);
 }
 int32_t PublicComment::getVotes() const
 {
-    return m_Votes.get();
+    return m_Votes;
 }
 
 void PublicComment::setVotes(int32_t value)
 {
     m_Votes = value;
+    m_FieldsSet.set(FieldBit_Votes);
 }
 
 bool PublicComment::votesIsSet() const
 {
-    return m_Votes.has_value();
+    return m_FieldsSet.test(FieldBit_Votes);
 }
 
 void PublicComment::unsetVotes()
 {
-    m_Votes.reset();
+    m_FieldsSet.reset(FieldBit_Votes);
 }
 int32_t PublicComment::getVotesUp() const
 {
-    return m_VotesUp.get();
+    return m_VotesUp;
 }
 
 void PublicComment::setVotesUp(int32_t value)
 {
     m_VotesUp = value;
+    m_FieldsSet.set(FieldBit_VotesUp);
 }
 
 bool PublicComment::votesUpIsSet() const
 {
-    return m_VotesUp.has_value();
+    return m_FieldsSet.test(FieldBit_VotesUp);
 }
 
 void PublicComment::unsetVotesUp()
 {
-    m_VotesUp.reset();
+    m_FieldsSet.reset(FieldBit_VotesUp);
 }
 int32_t PublicComment::getVotesDown() const
 {
-    return m_VotesDown.get();
+    return m_VotesDown;
 }
 
 void PublicComment::setVotesDown(int32_t value)
 {
     m_VotesDown = value;
+    m_FieldsSet.set(FieldBit_VotesDown);
 }
 
 bool PublicComment::votesDownIsSet() const
 {
-    return m_VotesDown.has_value();
+    return m_FieldsSet.test(FieldBit_VotesDown);
 }
 
 void PublicComment::unsetVotesDown()
 {
-    m_VotesDown.reset();
+    m_FieldsSet.reset(FieldBit_VotesDown);
 }
 bool PublicComment::isVerified() const
 {
@@ -1334,37 +2253,38 @@ bool PublicComment::isVerified() const
 void PublicComment::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool PublicComment::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void PublicComment::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 utility::string_t PublicComment::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void PublicComment::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool PublicComment::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void PublicComment::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 bool PublicComment::isHasImages() const
 {
@@ -1374,17 +2294,17 @@ bool PublicComment::isHasImages() const
 void PublicComment::setHasImages(bool value)
 {
     m_HasImages = value;
-    m_HasImagesIsSet = true;
+    m_FieldsSet.set(FieldBit_HasImages);
 }
 
 bool PublicComment::hasImagesIsSet() const
 {
-    return m_HasImagesIsSet;
+    return m_FieldsSet.test(FieldBit_HasImages);
 }
 
 void PublicComment::unsetHasImages()
 {
-    m_HasImagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasImages);
 }
 bool PublicComment::isIsByAdmin() const
 {
@@ -1394,17 +2314,17 @@ bool PublicComment::isIsByAdmin() const
 void PublicComment::setIsByAdmin(bool value)
 {
     m_IsByAdmin = value;
-    m_IsByAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByAdmin);
 }
 
 bool PublicComment::isByAdminIsSet() const
 {
-    return m_IsByAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsByAdmin);
 }
 
 void PublicComment::unsetIsByAdmin()
 {
-    m_IsByAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByAdmin);
 }
 bool PublicComment::isIsByModerator() const
 {
@@ -1414,133 +2334,139 @@ bool PublicComment::isIsByModerator() const
 void PublicComment::setIsByModerator(bool value)
 {
     m_IsByModerator = value;
-    m_IsByModeratorIsSet = true;
+    m_FieldsSet.set(FieldBit_IsByModerator);
 }
 
 bool PublicComment::isByModeratorIsSet() const
 {
-    return m_IsByModeratorIsSet;
+    return m_FieldsSet.test(FieldBit_IsByModerator);
 }
 
 void PublicComment::unsetIsByModerator()
 {
-    m_IsByModeratorIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsByModerator);
 }
 bool PublicComment::isIsPinned() const
 {
-    return m_IsPinned.get();
+    return m_IsPinned;
 }
 
 void PublicComment::setIsPinned(bool value)
 {
     m_IsPinned = value;
+    m_FieldsSet.set(FieldBit_IsPinned);
 }
 
 bool PublicComment::isPinnedIsSet() const
 {
-    return m_IsPinned.has_value();
+    return m_FieldsSet.test(FieldBit_IsPinned);
 }
 
 void PublicComment::unsetIsPinned()
 {
-    m_IsPinned.reset();
+    m_FieldsSet.reset(FieldBit_IsPinned);
 }
 bool PublicComment::isIsLocked() const
 {
-    return m_IsLocked.get();
+    return m_IsLocked;
 }
 
 void PublicComment::setIsLocked(bool value)
 {
     m_IsLocked = value;
+    m_FieldsSet.set(FieldBit_IsLocked);
 }
 
 bool PublicComment::isLockedIsSet() const
 {
-    return m_IsLocked.has_value();
+    return m_FieldsSet.test(FieldBit_IsLocked);
 }
 
 void PublicComment::unsetIsLocked()
 {
-    m_IsLocked.reset();
+    m_FieldsSet.reset(FieldBit_IsLocked);
 }
 utility::string_t PublicComment::getDisplayLabel() const
 {
-    return m_DisplayLabel.get();
+    return m_DisplayLabel;
 }
 
 
 void PublicComment::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool PublicComment::displayLabelIsSet() const
 {
-    return m_DisplayLabel.has_value();
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void PublicComment::unsetDisplayLabel()
 {
-    m_DisplayLabel.reset();
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 double PublicComment::getRating() const
 {
-    return m_Rating.get();
+    return m_Rating;
 }
 
 void PublicComment::setRating(double value)
 {
     m_Rating = value;
+    m_FieldsSet.set(FieldBit_Rating);
 }
 
 bool PublicComment::ratingIsSet() const
 {
-    return m_Rating.has_value();
+    return m_FieldsSet.test(FieldBit_Rating);
 }
 
 void PublicComment::unsetRating()
 {
-    m_Rating.reset();
+    m_FieldsSet.reset(FieldBit_Rating);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> PublicComment::getBadges() const
 {
-    return m_Badges.get();
+    return m_Badges;
 }
 
 
 void PublicComment::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool PublicComment::badgesIsSet() const
 {
-    return m_Badges.has_value();
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void PublicComment::unsetBadges()
 {
-    m_Badges.reset();
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 int64_t PublicComment::getViewCount() const
 {
-    return m_ViewCount.get();
+    return m_ViewCount;
 }
 
 void PublicComment::setViewCount(int64_t value)
 {
     m_ViewCount = value;
+    m_FieldsSet.set(FieldBit_ViewCount);
 }
 
 bool PublicComment::viewCountIsSet() const
 {
-    return m_ViewCount.has_value();
+    return m_FieldsSet.test(FieldBit_ViewCount);
 }
 
 void PublicComment::unsetViewCount()
 {
-    m_ViewCount.reset();
+    m_FieldsSet.reset(FieldBit_ViewCount);
 }
 bool PublicComment::isIsDeleted() const
 {
@@ -1550,17 +2476,17 @@ bool PublicComment::isIsDeleted() const
 void PublicComment::setIsDeleted(bool value)
 {
     m_IsDeleted = value;
-    m_IsDeletedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeleted);
 }
 
 bool PublicComment::isDeletedIsSet() const
 {
-    return m_IsDeletedIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeleted);
 }
 
 void PublicComment::unsetIsDeleted()
 {
-    m_IsDeletedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeleted);
 }
 bool PublicComment::isIsDeletedUser() const
 {
@@ -1570,17 +2496,17 @@ bool PublicComment::isIsDeletedUser() const
 void PublicComment::setIsDeletedUser(bool value)
 {
     m_IsDeletedUser = value;
-    m_IsDeletedUserIsSet = true;
+    m_FieldsSet.set(FieldBit_IsDeletedUser);
 }
 
 bool PublicComment::isDeletedUserIsSet() const
 {
-    return m_IsDeletedUserIsSet;
+    return m_FieldsSet.test(FieldBit_IsDeletedUser);
 }
 
 void PublicComment::unsetIsDeletedUser()
 {
-    m_IsDeletedUserIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsDeletedUser);
 }
 bool PublicComment::isIsSpam() const
 {
@@ -1590,37 +2516,38 @@ bool PublicComment::isIsSpam() const
 void PublicComment::setIsSpam(bool value)
 {
     m_IsSpam = value;
-    m_IsSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSpam);
 }
 
 bool PublicComment::isSpamIsSet() const
 {
-    return m_IsSpamIsSet;
+    return m_FieldsSet.test(FieldBit_IsSpam);
 }
 
 void PublicComment::unsetIsSpam()
 {
-    m_IsSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSpam);
 }
 utility::string_t PublicComment::getAnonUserId() const
 {
-    return m_AnonUserId.get();
+    return m_AnonUserId;
 }
 
 
 void PublicComment::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool PublicComment::anonUserIdIsSet() const
 {
-    return m_AnonUserId.has_value();
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void PublicComment::unsetAnonUserId()
 {
-    m_AnonUserId.reset();
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 std::vector<utility::string_t> PublicComment::getFeedbackIds() const
 {
@@ -1631,17 +2558,17 @@ std::vector<utility::string_t> PublicComment::getFeedbackIds() const
 void PublicComment::setFeedbackIds(const std::vector<utility::string_t>& value)
 {
     m_FeedbackIds = value;
-    m_FeedbackIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedbackIds);
 }
 
 bool PublicComment::feedbackIdsIsSet() const
 {
-    return m_FeedbackIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedbackIds);
 }
 
 void PublicComment::unsetFeedbackIds()
 {
-    m_FeedbackIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedbackIds);
 }
 bool PublicComment::isRequiresVerification() const
 {
@@ -1651,17 +2578,17 @@ bool PublicComment::isRequiresVerification() const
 void PublicComment::setRequiresVerification(bool value)
 {
     m_RequiresVerification = value;
-    m_RequiresVerificationIsSet = true;
+    m_FieldsSet.set(FieldBit_RequiresVerification);
 }
 
 bool PublicComment::requiresVerificationIsSet() const
 {
-    return m_RequiresVerificationIsSet;
+    return m_FieldsSet.test(FieldBit_RequiresVerification);
 }
 
 void PublicComment::unsetRequiresVerification()
 {
-    m_RequiresVerificationIsSet = false;
+    m_FieldsSet.reset(FieldBit_RequiresVerification);
 }
 utility::string_t PublicComment::getEditKey() const
 {
@@ -1672,17 +2599,17 @@ utility::string_t PublicComment::getEditKey() const
 void PublicComment::setEditKey(const utility::string_t& value)
 {
     m_EditKey = value;
-    m_EditKeyIsSet = true;
+    m_FieldsSet.set(FieldBit_EditKey);
 }
 
 bool PublicComment::editKeyIsSet() const
 {
-    return m_EditKeyIsSet;
+    return m_FieldsSet.test(FieldBit_EditKey);
 }
 
 void PublicComment::unsetEditKey()
 {
-    m_EditKeyIsSet = false;
+    m_FieldsSet.reset(FieldBit_EditKey);
 }
 bool PublicComment::isApproved() const
 {
@@ -1692,17 +2619,17 @@ bool PublicComment::isApproved() const
 void PublicComment::setApproved(bool value)
 {
     m_Approved = value;
-    m_ApprovedIsSet = true;
+    m_FieldsSet.set(FieldBit_Approved);
 }
 
 bool PublicComment::approvedIsSet() const
 {
-    return m_ApprovedIsSet;
+    return m_FieldsSet.test(FieldBit_Approved);
 }
 
 void PublicComment::unsetApproved()
 {
-    m_ApprovedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Approved);
 }
 bool PublicComment::isIsUnread() const
 {
@@ -1712,17 +2639,17 @@ bool PublicComment::isIsUnread() const
 void PublicComment::setIsUnread(bool value)
 {
     m_IsUnread = value;
-    m_IsUnreadIsSet = true;
+    m_FieldsSet.set(FieldBit_IsUnread);
 }
 
 bool PublicComment::isUnreadIsSet() const
 {
-    return m_IsUnreadIsSet;
+    return m_FieldsSet.test(FieldBit_IsUnread);
 }
 
 void PublicComment::unsetIsUnread()
 {
-    m_IsUnreadIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsUnread);
 }
 utility::string_t PublicComment::getMyVoteId() const
 {
@@ -1733,17 +2660,17 @@ utility::string_t PublicComment::getMyVoteId() const
 void PublicComment::setMyVoteId(const utility::string_t& value)
 {
     m_MyVoteId = value;
-    m_MyVoteIdIsSet = true;
+    m_FieldsSet.set(FieldBit_MyVoteId);
 }
 
 bool PublicComment::myVoteIdIsSet() const
 {
-    return m_MyVoteIdIsSet;
+    return m_FieldsSet.test(FieldBit_MyVoteId);
 }
 
 void PublicComment::unsetMyVoteId()
 {
-    m_MyVoteIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_MyVoteId);
 }
 bool PublicComment::isIsVotedDown() const
 {
@@ -1753,17 +2680,17 @@ bool PublicComment::isIsVotedDown() const
 void PublicComment::setIsVotedDown(bool value)
 {
     m_IsVotedDown = value;
-    m_IsVotedDownIsSet = true;
+    m_FieldsSet.set(FieldBit_IsVotedDown);
 }
 
 bool PublicComment::isVotedDownIsSet() const
 {
-    return m_IsVotedDownIsSet;
+    return m_FieldsSet.test(FieldBit_IsVotedDown);
 }
 
 void PublicComment::unsetIsVotedDown()
 {
-    m_IsVotedDownIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsVotedDown);
 }
 bool PublicComment::isIsVotedUp() const
 {
@@ -1773,17 +2700,17 @@ bool PublicComment::isIsVotedUp() const
 void PublicComment::setIsVotedUp(bool value)
 {
     m_IsVotedUp = value;
-    m_IsVotedUpIsSet = true;
+    m_FieldsSet.set(FieldBit_IsVotedUp);
 }
 
 bool PublicComment::isVotedUpIsSet() const
 {
-    return m_IsVotedUpIsSet;
+    return m_FieldsSet.test(FieldBit_IsVotedUp);
 }
 
 void PublicComment::unsetIsVotedUp()
 {
-    m_IsVotedUpIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsVotedUp);
 }
 bool PublicComment::isHasChildren() const
 {
@@ -1793,17 +2720,17 @@ bool PublicComment::isHasChildren() const
 void PublicComment::setHasChildren(bool value)
 {
     m_HasChildren = value;
-    m_HasChildrenIsSet = true;
+    m_FieldsSet.set(FieldBit_HasChildren);
 }
 
 bool PublicComment::hasChildrenIsSet() const
 {
-    return m_HasChildrenIsSet;
+    return m_FieldsSet.test(FieldBit_HasChildren);
 }
 
 void PublicComment::unsetHasChildren()
 {
-    m_HasChildrenIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasChildren);
 }
 int32_t PublicComment::getNestedChildrenCount() const
 {
@@ -1813,17 +2740,17 @@ int32_t PublicComment::getNestedChildrenCount() const
 void PublicComment::setNestedChildrenCount(int32_t value)
 {
     m_NestedChildrenCount = value;
-    m_NestedChildrenCountIsSet = true;
+    m_FieldsSet.set(FieldBit_NestedChildrenCount);
 }
 
 bool PublicComment::nestedChildrenCountIsSet() const
 {
-    return m_NestedChildrenCountIsSet;
+    return m_FieldsSet.test(FieldBit_NestedChildrenCount);
 }
 
 void PublicComment::unsetNestedChildrenCount()
 {
-    m_NestedChildrenCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_NestedChildrenCount);
 }
 int32_t PublicComment::getChildCount() const
 {
@@ -1833,17 +2760,17 @@ int32_t PublicComment::getChildCount() const
 void PublicComment::setChildCount(int32_t value)
 {
     m_ChildCount = value;
-    m_ChildCountIsSet = true;
+    m_FieldsSet.set(FieldBit_ChildCount);
 }
 
 bool PublicComment::childCountIsSet() const
 {
-    return m_ChildCountIsSet;
+    return m_FieldsSet.test(FieldBit_ChildCount);
 }
 
 void PublicComment::unsetChildCount()
 {
-    m_ChildCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_ChildCount);
 }
 std::vector<std::shared_ptr<PublicComment>> PublicComment::getChildren() const
 {
@@ -1854,17 +2781,17 @@ std::vector<std::shared_ptr<PublicComment>> PublicComment::getChildren() const
 void PublicComment::setChildren(const std::vector<std::shared_ptr<PublicComment>>& value)
 {
     m_Children = value;
-    m_ChildrenIsSet = true;
+    m_FieldsSet.set(FieldBit_Children);
 }
 
 bool PublicComment::childrenIsSet() const
 {
-    return m_ChildrenIsSet;
+    return m_FieldsSet.test(FieldBit_Children);
 }
 
 void PublicComment::unsetChildren()
 {
-    m_ChildrenIsSet = false;
+    m_FieldsSet.reset(FieldBit_Children);
 }
 bool PublicComment::isIsFlagged() const
 {
@@ -1874,17 +2801,17 @@ bool PublicComment::isIsFlagged() const
 void PublicComment::setIsFlagged(bool value)
 {
     m_IsFlagged = value;
-    m_IsFlaggedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsFlagged);
 }
 
 bool PublicComment::isFlaggedIsSet() const
 {
-    return m_IsFlaggedIsSet;
+    return m_FieldsSet.test(FieldBit_IsFlagged);
 }
 
 void PublicComment::unsetIsFlagged()
 {
-    m_IsFlaggedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsFlagged);
 }
 bool PublicComment::isIsBlocked() const
 {
@@ -1894,17 +2821,17 @@ bool PublicComment::isIsBlocked() const
 void PublicComment::setIsBlocked(bool value)
 {
     m_IsBlocked = value;
-    m_IsBlockedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsBlocked);
 }
 
 bool PublicComment::isBlockedIsSet() const
 {
-    return m_IsBlockedIsSet;
+    return m_FieldsSet.test(FieldBit_IsBlocked);
 }
 
 void PublicComment::unsetIsBlocked()
 {
-    m_IsBlockedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsBlocked);
 }
 
 }
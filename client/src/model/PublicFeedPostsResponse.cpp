@@ -20,15 +20,6 @@ namespace model {
 
 PublicFeedPostsResponse::PublicFeedPostsResponse()
 {
-    m_StatusIsSet = false;
-    m_FeedPostsIsSet = false;
-    m_UrlIdWS = utility::conversions::to_string_t("");
-    m_UrlIdWSIsSet = false;
-    m_UserIdWS = utility::conversions::to_string_t("");
-    m_UserIdWSIsSet = false;
-    m_TenantIdWS = utility::conversions::to_string_t("");
-    m_TenantIdWSIsSet = false;
-    m_MyReactsIsSet = false;
 }
 
 PublicFeedPostsResponse::~PublicFeedPostsResponse()
@@ -43,37 +34,37 @@ void PublicFeedPostsResponse::validate()
 web::json::value PublicFeedPostsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_FeedPostsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("feedPosts"))] = ModelBase::toJson(m_FeedPosts);
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User);
     }
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))] = ModelBase::toJson(m_UrlIdWS);
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userIdWS"))] = ModelBase::toJson(m_UserIdWS);
     }
-    if(m_TenantIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantIdWS"))] = ModelBase::toJson(m_TenantIdWS);
     }
-    if(m_MyReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_MyReacts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("myReacts"))] = ModelBase::toJson(m_MyReacts);
@@ -82,87 +73,289 @@ web::json::value PublicFeedPostsResponse::toJson() const
     return val;
 }
 
+void PublicFeedPostsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
+    {
+        
+        writer.key(_XPLATSTR("feedPosts"));
+        ModelBase::writeJson(writer, m_FeedPosts);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        writer.key(_XPLATSTR("user"));
+        ModelBase::writeJson(writer, m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
+    {
+        
+        writer.key(_XPLATSTR("urlIdWS"));
+        ModelBase::writeJson(writer, m_UrlIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
+    {
+        
+        writer.key(_XPLATSTR("userIdWS"));
+        ModelBase::writeJson(writer, m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
+    {
+        
+        writer.key(_XPLATSTR("tenantIdWS"));
+        ModelBase::writeJson(writer, m_TenantIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_MyReacts))
+    {
+        
+        writer.key(_XPLATSTR("myReacts"));
+        ModelBase::writeJson(writer, m_MyReacts);
+    }
+
+    writer.endObject();
+}
+
 bool PublicFeedPostsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("feedPosts"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("feedPosts")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPosts);
-            setFeedPosts(refVal_setFeedPosts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("feedPosts")):
+            if(field.first == _XPLATSTR("feedPosts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeedPosts);
+                    setFeedPosts(refVal_setFeedPosts);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            if(field.first == _XPLATSTR("user"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserSessionInfo> refVal_setUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
+                    setUser(refVal_setUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            if(field.first == _XPLATSTR("urlIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
+                    setUrlIdWS(refVal_setUrlIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            if(field.first == _XPLATSTR("userIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
+                    setUserIdWS(refVal_setUserIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantIdWS")):
+            if(field.first == _XPLATSTR("tenantIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantIdWS);
+                    setTenantIdWS(refVal_setTenantIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("myReacts")):
+            if(field.first == _XPLATSTR("myReacts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::map<utility::string_t, bool>> refVal_setMyReacts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMyReacts);
+                    setMyReacts(refVal_setMyReacts);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("user"))))
+    return ok;
+}
+
+void PublicFeedPostsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("user")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<UserSessionInfo> refVal_setUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
-            setUser(refVal_setUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))))
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
-            setUrlIdWS(refVal_setUrlIdWS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("feedPosts")), m_FeedPosts);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userIdWS"))))
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
-            setUserIdWS(refVal_setUserIdWS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("user")), m_User);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantIdWS"))))
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTenantIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantIdWS);
-            setTenantIdWS(refVal_setTenantIdWS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdWS")), m_UrlIdWS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("myReacts"))))
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("myReacts")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userIdWS")), m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantIdWS")), m_TenantIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_MyReacts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("myReacts")), m_MyReacts);
+    }
+}
+
+bool PublicFeedPostsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, std::map<utility::string_t, bool>> refVal_setMyReacts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMyReacts);
-            setMyReacts(refVal_setMyReacts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("feedPosts")):
+            {
+                std::vector<std::shared_ptr<FeedPost>> refVal_setFeedPosts;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeedPosts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeedPosts(refVal_setFeedPosts);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            {
+                std::shared_ptr<UserSessionInfo> refVal_setUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUser(refVal_setUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            {
+                utility::string_t refVal_setUrlIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlIdWS(refVal_setUrlIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            {
+                utility::string_t refVal_setUserIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserIdWS(refVal_setUserIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantIdWS")):
+            {
+                utility::string_t refVal_setTenantIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantIdWS(refVal_setTenantIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("myReacts")):
+            {
+                std::map<utility::string_t, std::map<utility::string_t, bool>> refVal_setMyReacts;
+                if(!ModelBase::readBinary(reader, field, refVal_setMyReacts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMyReacts(refVal_setMyReacts);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void PublicFeedPostsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -172,31 +365,31 @@ void PublicFeedPostsResponse::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_FeedPostsIsSet)
+    if(m_FieldsSet.test(FieldBit_FeedPosts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("feedPosts")), m_FeedPosts));
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User));
     }
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdWS")), m_UrlIdWS));
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userIdWS")), m_UserIdWS));
     }
-    if(m_TenantIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantIdWS")), m_TenantIdWS));
     }
-    if(m_MyReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_MyReacts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("myReacts")), m_MyReacts));
     }
@@ -266,17 +459,17 @@ std::shared_ptr<APIStatus> PublicFeedPostsResponse::getStatus() const
 void PublicFeedPostsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool PublicFeedPostsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void PublicFeedPostsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<FeedPost>> PublicFeedPostsResponse::getFeedPosts() const
 {
@@ -287,37 +480,38 @@ std::vector<std::shared_ptr<FeedPost>> PublicFeedPostsResponse::getFeedPosts() c
 void PublicFeedPostsResponse::setFeedPosts(const std::vector<std::shared_ptr<FeedPost>>& value)
 {
     m_FeedPosts = value;
-    m_FeedPostsIsSet = true;
+    m_FieldsSet.set(FieldBit_FeedPosts);
 }
 
 bool PublicFeedPostsResponse::feedPostsIsSet() const
 {
-    return m_FeedPostsIsSet;
+    return m_FieldsSet.test(FieldBit_FeedPosts);
 }
 
 void PublicFeedPostsResponse::unsetFeedPosts()
 {
-    m_FeedPostsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeedPosts);
 }
 std::shared_ptr<UserSessionInfo> PublicFeedPostsResponse::getUser() const
 {
-    return m_User.get();
+    return m_User;
 }
 
 
 void PublicFeedPostsResponse::setUser(const std::shared_ptr<UserSessionInfo>& value)
 {
     m_User = value;
+    m_FieldsSet.set(FieldBit_User);
 }
 
 bool PublicFeedPostsResponse::userIsSet() const
 {
-    return m_User.has_value();
+    return m_FieldsSet.test(FieldBit_User);
 }
 
 void PublicFeedPostsResponse::unsetUser()
 {
-    m_User.reset();
+    m_FieldsSet.reset(FieldBit_User);
 }
 utility::string_t PublicFeedPostsResponse::getUrlIdWS() const
 {
@@ -328,17 +522,17 @@ utility::string_t PublicFeedPostsResponse::getUrlIdWS() const
 void PublicFeedPostsResponse::setUrlIdWS(const utility::string_t& value)
 {
     m_UrlIdWS = value;
-    m_UrlIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdWS);
 }
 
 bool PublicFeedPostsResponse::urlIdWSIsSet() const
 {
-    return m_UrlIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdWS);
 }
 
 void PublicFeedPostsResponse::unsetUrlIdWS()
 {
-    m_UrlIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdWS);
 }
 utility::string_t PublicFeedPostsResponse::getUserIdWS() const
 {
@@ -349,17 +543,17 @@ utility::string_t PublicFeedPostsResponse::getUserIdWS() const
 void PublicFeedPostsResponse::setUserIdWS(const utility::string_t& value)
 {
     m_UserIdWS = value;
-    m_UserIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UserIdWS);
 }
 
 bool PublicFeedPostsResponse::userIdWSIsSet() const
 {
-    return m_UserIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UserIdWS);
 }
 
 void PublicFeedPostsResponse::unsetUserIdWS()
 {
-    m_UserIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserIdWS);
 }
 utility::string_t PublicFeedPostsResponse::getTenantIdWS() const
 {
@@ -370,17 +564,17 @@ utility::string_t PublicFeedPostsResponse::getTenantIdWS() const
 void PublicFeedPostsResponse::setTenantIdWS(const utility::string_t& value)
 {
     m_TenantIdWS = value;
-    m_TenantIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantIdWS);
 }
 
 bool PublicFeedPostsResponse::tenantIdWSIsSet() const
 {
-    return m_TenantIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_TenantIdWS);
 }
 
 void PublicFeedPostsResponse::unsetTenantIdWS()
 {
-    m_TenantIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantIdWS);
 }
 std::map<utility::string_t, std::map<utility::string_t, bool>> PublicFeedPostsResponse::getMyReacts() const
 {
@@ -391,17 +585,17 @@ std::map<utility::string_t, std::map<utility::string_t, bool>> PublicFeedPostsRe
 void PublicFeedPostsResponse::setMyReacts(const std::map<utility::string_t, std::map<utility::string_t, bool>>& value)
 {
     m_MyReacts = value;
-    m_MyReactsIsSet = true;
+    m_FieldsSet.set(FieldBit_MyReacts);
 }
 
 bool PublicFeedPostsResponse::myReactsIsSet() const
 {
-    return m_MyReactsIsSet;
+    return m_FieldsSet.test(FieldBit_MyReacts);
 }
 
 void PublicFeedPostsResponse::unsetMyReacts()
 {
-    m_MyReactsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MyReacts);
 }
 
 }
@@ -20,10 +20,6 @@ namespace model {
 
 QueryPredicate::QueryPredicate()
 {
-    m_Key = utility::conversions::to_string_t("");
-    m_KeyIsSet = false;
-    m_ValueIsSet = false;
-    m_r_operatorIsSet = false;
 }
 
 QueryPredicate::~QueryPredicate()
@@ -38,17 +34,17 @@ void QueryPredicate::validate()
 web::json::value QueryPredicate::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_KeyIsSet)
+    if(m_FieldsSet.test(FieldBit_Key))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("key"))] = ModelBase::toJson(m_Key);
     }
-    if(m_ValueIsSet)
+    if(m_FieldsSet.test(FieldBit_Value))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("value"))] = ModelBase::toJson(m_Value);
     }
-    if(m_r_operatorIsSet)
+    if(m_FieldsSet.test(FieldBit_r_operator))
     {
         
         utility::string_t refVal = fromR_operatorEnum(m_r_operator);
@@ -59,44 +55,157 @@ web::json::value QueryPredicate::toJson() const
     return val;
 }
 
+void QueryPredicate::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Key))
+    {
+        
+        writer.key(_XPLATSTR("key"));
+        ModelBase::writeJson(writer, m_Key);
+    }
+    if(m_FieldsSet.test(FieldBit_Value))
+    {
+        
+        writer.key(_XPLATSTR("value"));
+        ModelBase::writeJson(writer, m_Value);
+    }
+    if(m_FieldsSet.test(FieldBit_r_operator))
+    {
+        
+        utility::string_t refVal = fromR_operatorEnum(m_r_operator);
+        writer.key(_XPLATSTR("operator"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+
+    writer.endObject();
+}
+
 bool QueryPredicate::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("key"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("key")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setKey;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setKey);
-            setKey(refVal_setKey);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("value"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("value")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<QueryPredicate_value> refVal_setValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setValue);
-            setValue(refVal_setValue);
-            
+        case ModelBase::fieldHash(_XPLATSTR("key")):
+            if(field.first == _XPLATSTR("key"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setKey;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setKey);
+                    setKey(refVal_setKey);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("value")):
+            if(field.first == _XPLATSTR("value"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<QueryPredicate_value> refVal_setValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setValue);
+                    setValue(refVal_setValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("operator")):
+            if(field.first == _XPLATSTR("operator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setROperator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setROperator);
+                    setROperator(toR_operatorEnum(refVal_setROperator));
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("operator"))))
+    return ok;
+}
+
+void QueryPredicate::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Key))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("key")), m_Key);
+    }
+    if(m_FieldsSet.test(FieldBit_Value))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("value")), m_Value);
+    }
+    if(m_FieldsSet.test(FieldBit_r_operator))
+    {
+        
+        utility::string_t refVal = fromR_operatorEnum(m_r_operator);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("operator")), refVal);
+        
+    }
+}
+
+bool QueryPredicate::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("operator")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            utility::string_t refVal_setROperator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setROperator);
-            
-            setROperator(toR_operatorEnum(refVal_setROperator));
-            
+        case ModelBase::fieldHash(_XPLATSTR("key")):
+            {
+                utility::string_t refVal_setKey;
+                if(!ModelBase::readBinary(reader, field, refVal_setKey))
+                {
+                    ok = false;
+                    continue;
+                }
+                setKey(refVal_setKey);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("value")):
+            {
+                std::shared_ptr<QueryPredicate_value> refVal_setValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setValue(refVal_setValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("operator")):
+            {
+                utility::string_t refVal_setROperator;
+                if(!ModelBase::readBinary(reader, field, refVal_setROperator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setROperator(toR_operatorEnum(refVal_setROperator));
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void QueryPredicate::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -106,15 +215,15 @@ void QueryPredicate::toMultipart(std::shared_ptr<MultipartFormData> multipart, c
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_KeyIsSet)
+    if(m_FieldsSet.test(FieldBit_Key))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("key")), m_Key));
     }
-    if(m_ValueIsSet)
+    if(m_FieldsSet.test(FieldBit_Value))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("value")), m_Value));
     }
-    if(m_r_operatorIsSet)
+    if(m_FieldsSet.test(FieldBit_r_operator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("operator")), fromR_operatorEnum(m_r_operator)));
     }
@@ -205,17 +314,17 @@ utility::string_t QueryPredicate::getKey() const
 void QueryPredicate::setKey(const utility::string_t& value)
 {
     m_Key = value;
-    m_KeyIsSet = true;
+    m_FieldsSet.set(FieldBit_Key);
 }
 
 bool QueryPredicate::keyIsSet() const
 {
-    return m_KeyIsSet;
+    return m_FieldsSet.test(FieldBit_Key);
 }
 
 void QueryPredicate::unsetKey()
 {
-    m_KeyIsSet = false;
+    m_FieldsSet.reset(FieldBit_Key);
 }
 std::shared_ptr<QueryPredicate_value> QueryPredicate::getValue() const
 {
@@ -226,17 +335,17 @@ std::shared_ptr<QueryPredicate_value> QueryPredicate::getValue() const
 void QueryPredicate::setValue(const std::shared_ptr<QueryPredicate_value>& value)
 {
     m_Value = value;
-    m_ValueIsSet = true;
+    m_FieldsSet.set(FieldBit_Value);
 }
 
 bool QueryPredicate::valueIsSet() const
 {
-    return m_ValueIsSet;
+    return m_FieldsSet.test(FieldBit_Value);
 }
 
 void QueryPredicate::unsetValue()
 {
-    m_ValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_Value);
 }
 QueryPredicate::R_operatorEnum QueryPredicate::getROperator() const
 {
@@ -247,17 +356,17 @@ QueryPredicate::R_operatorEnum QueryPredicate::getROperator() const
 void QueryPredicate::setROperator(const R_operatorEnum value)
 {
     m_r_operator = value;
-    m_r_operatorIsSet = true;
+    m_FieldsSet.set(FieldBit_r_operator);
 }
 
 bool QueryPredicate::rOperatorIsSet() const
 {
-    return m_r_operatorIsSet;
+    return m_FieldsSet.test(FieldBit_r_operator);
 }
 
 void QueryPredicate::unsetr_operator()
 {
-    m_r_operatorIsSet = false;
+    m_FieldsSet.reset(FieldBit_r_operator);
 }
 
 }
@@ -38,6 +38,13 @@ web::json::value QueryPredicate_value::toJson() const
     return val;
 }
 
+void QueryPredicate_value::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+
+    writer.endObject();
+}
+
 bool QueryPredicate_value::fromJson(const web::json::value& val)
 {
     bool ok = true;
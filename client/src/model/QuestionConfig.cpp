@@ -20,46 +20,13 @@ namespace model {
 
 QuestionConfig::QuestionConfig()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_Question = utility::conversions::to_string_t("");
-    m_QuestionIsSet = false;
-    m_SummaryLabel = utility::conversions::to_string_t("");
-    m_SummaryLabelIsSet = false;
-    m_HelpText = utility::conversions::to_string_t("");
-    m_HelpTextIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_CreatedBy = utility::conversions::to_string_t("");
-    m_CreatedByIsSet = false;
     m_UsedCount = 0.0;
-    m_UsedCountIsSet = false;
-    m_LastUsed = utility::datetime();
-    m_LastUsedIsSet = false;
-    m_Type = utility::conversions::to_string_t("");
-    m_TypeIsSet = false;
     m_NumStars = 0.0;
-    m_NumStarsIsSet = false;
     m_Min = 0.0;
-    m_MinIsSet = false;
     m_Max = 0.0;
-    m_MaxIsSet = false;
     m_DefaultValue = 0.0;
-    m_DefaultValueIsSet = false;
-    m_LabelNegative = utility::conversions::to_string_t("");
-    m_LabelNegativeIsSet = false;
-    m_LabelPositive = utility::conversions::to_string_t("");
-    m_LabelPositiveIsSet = false;
-    m_CustomOptionsIsSet = false;
-    m_SubQuestionIdsIsSet = false;
     m_AlwaysShowSubQuestions = false;
-    m_AlwaysShowSubQuestionsIsSet = false;
     m_ReportingOrder = 0.0;
-    m_ReportingOrderIsSet = false;
 }
 
 QuestionConfig::~QuestionConfig()
@@ -74,107 +41,107 @@ void QuestionConfig::validate()
 web::json::value QuestionConfig::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_QuestionIsSet)
+    if(m_FieldsSet.test(FieldBit_Question))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("question"))] = ModelBase::toJson(m_Question);
     }
-    if(m_SummaryLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_SummaryLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("summaryLabel"))] = ModelBase::toJson(m_SummaryLabel);
     }
-    if(m_HelpTextIsSet)
+    if(m_FieldsSet.test(FieldBit_HelpText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("helpText"))] = ModelBase::toJson(m_HelpText);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_CreatedByIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdBy"))] = ModelBase::toJson(m_CreatedBy);
     }
-    if(m_UsedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_UsedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("usedCount"))] = ModelBase::toJson(m_UsedCount);
     }
-    if(m_LastUsedIsSet)
+    if(m_FieldsSet.test(FieldBit_LastUsed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastUsed"))] = ModelBase::toJson(m_LastUsed);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_NumStarsIsSet)
+    if(m_FieldsSet.test(FieldBit_NumStars))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("numStars"))] = ModelBase::toJson(m_NumStars);
     }
-    if(m_MinIsSet)
+    if(m_FieldsSet.test(FieldBit_Min))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("min"))] = ModelBase::toJson(m_Min);
     }
-    if(m_MaxIsSet)
+    if(m_FieldsSet.test(FieldBit_Max))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("max"))] = ModelBase::toJson(m_Max);
     }
-    if(m_DefaultValueIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("defaultValue"))] = ModelBase::toJson(m_DefaultValue);
     }
-    if(m_LabelNegativeIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("labelNegative"))] = ModelBase::toJson(m_LabelNegative);
     }
-    if(m_LabelPositiveIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("labelPositive"))] = ModelBase::toJson(m_LabelPositive);
     }
-    if(m_CustomOptionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("customOptions"))] = ModelBase::toJson(m_CustomOptions);
     }
-    if(m_SubQuestionIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("subQuestionIds"))] = ModelBase::toJson(m_SubQuestionIds);
     }
-    if(m_AlwaysShowSubQuestionsIsSet)
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions"))] = ModelBase::toJson(m_AlwaysShowSubQuestions);
     }
-    if(m_ReportingOrderIsSet)
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reportingOrder"))] = ModelBase::toJson(m_ReportingOrder);
@@ -183,241 +150,765 @@ web::json::value QuestionConfig::toJson() const
     return val;
 }
 
+void QuestionConfig::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Question))
+    {
+        
+        writer.key(_XPLATSTR("question"));
+        ModelBase::writeJson(writer, m_Question);
+    }
+    if(m_FieldsSet.test(FieldBit_SummaryLabel))
+    {
+        
+        writer.key(_XPLATSTR("summaryLabel"));
+        ModelBase::writeJson(writer, m_SummaryLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_HelpText))
+    {
+        
+        writer.key(_XPLATSTR("helpText"));
+        ModelBase::writeJson(writer, m_HelpText);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
+    {
+        
+        writer.key(_XPLATSTR("createdBy"));
+        ModelBase::writeJson(writer, m_CreatedBy);
+    }
+    if(m_FieldsSet.test(FieldBit_UsedCount))
+    {
+        
+        writer.key(_XPLATSTR("usedCount"));
+        ModelBase::writeJson(writer, m_UsedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_LastUsed))
+    {
+        
+        writer.key(_XPLATSTR("lastUsed"));
+        ModelBase::writeJson(writer, m_LastUsed);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_NumStars))
+    {
+        
+        writer.key(_XPLATSTR("numStars"));
+        ModelBase::writeJson(writer, m_NumStars);
+    }
+    if(m_FieldsSet.test(FieldBit_Min))
+    {
+        
+        writer.key(_XPLATSTR("min"));
+        ModelBase::writeJson(writer, m_Min);
+    }
+    if(m_FieldsSet.test(FieldBit_Max))
+    {
+        
+        writer.key(_XPLATSTR("max"));
+        ModelBase::writeJson(writer, m_Max);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
+    {
+        
+        writer.key(_XPLATSTR("defaultValue"));
+        ModelBase::writeJson(writer, m_DefaultValue);
+    }
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
+    {
+        
+        writer.key(_XPLATSTR("labelNegative"));
+        ModelBase::writeJson(writer, m_LabelNegative);
+    }
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
+    {
+        
+        writer.key(_XPLATSTR("labelPositive"));
+        ModelBase::writeJson(writer, m_LabelPositive);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
+    {
+        
+        writer.key(_XPLATSTR("customOptions"));
+        ModelBase::writeJson(writer, m_CustomOptions);
+    }
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
+    {
+        
+        writer.key(_XPLATSTR("subQuestionIds"));
+        ModelBase::writeJson(writer, m_SubQuestionIds);
+    }
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
+    {
+        
+        writer.key(_XPLATSTR("alwaysShowSubQuestions"));
+        ModelBase::writeJson(writer, m_AlwaysShowSubQuestions);
+    }
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
+    {
+        
+        writer.key(_XPLATSTR("reportingOrder"));
+        ModelBase::writeJson(writer, m_ReportingOrder);
+    }
+
+    writer.endObject();
+}
+
 bool QuestionConfig::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("question")):
+            if(field.first == _XPLATSTR("question"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setQuestion;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestion);
+                    setQuestion(refVal_setQuestion);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("summaryLabel")):
+            if(field.first == _XPLATSTR("summaryLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSummaryLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSummaryLabel);
+                    setSummaryLabel(refVal_setSummaryLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("helpText")):
+            if(field.first == _XPLATSTR("helpText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setHelpText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHelpText);
+                    setHelpText(refVal_setHelpText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdBy")):
+            if(field.first == _XPLATSTR("createdBy"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedBy;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedBy);
+                    setCreatedBy(refVal_setCreatedBy);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("usedCount")):
+            if(field.first == _XPLATSTR("usedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setUsedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsedCount);
+                    setUsedCount(refVal_setUsedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastUsed")):
+            if(field.first == _XPLATSTR("lastUsed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setLastUsed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastUsed);
+                    setLastUsed(refVal_setLastUsed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("numStars")):
+            if(field.first == _XPLATSTR("numStars"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNumStars;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNumStars);
+                    setNumStars(refVal_setNumStars);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("min")):
+            if(field.first == _XPLATSTR("min"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMin);
+                    setMin(refVal_setMin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("max")):
+            if(field.first == _XPLATSTR("max"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMax;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMax);
+                    setMax(refVal_setMax);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultValue")):
+            if(field.first == _XPLATSTR("defaultValue"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setDefaultValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultValue);
+                    setDefaultValue(refVal_setDefaultValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("labelNegative")):
+            if(field.first == _XPLATSTR("labelNegative"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLabelNegative;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLabelNegative);
+                    setLabelNegative(refVal_setLabelNegative);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("labelPositive")):
+            if(field.first == _XPLATSTR("labelPositive"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLabelPositive;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLabelPositive);
+                    setLabelPositive(refVal_setLabelPositive);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("customOptions")):
+            if(field.first == _XPLATSTR("customOptions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> refVal_setCustomOptions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCustomOptions);
+                    setCustomOptions(refVal_setCustomOptions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("subQuestionIds")):
+            if(field.first == _XPLATSTR("subQuestionIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setSubQuestionIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSubQuestionIds);
+                    setSubQuestionIds(refVal_setSubQuestionIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("alwaysShowSubQuestions")):
+            if(field.first == _XPLATSTR("alwaysShowSubQuestions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAlwaysShowSubQuestions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAlwaysShowSubQuestions);
+                    setAlwaysShowSubQuestions(refVal_setAlwaysShowSubQuestions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reportingOrder")):
+            if(field.first == _XPLATSTR("reportingOrder"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setReportingOrder;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReportingOrder);
+                    setReportingOrder(refVal_setReportingOrder);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    return ok;
+}
+
+void QuestionConfig::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("question"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("question")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setQuestion;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestion);
-            setQuestion(refVal_setQuestion);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("summaryLabel"))))
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("summaryLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSummaryLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSummaryLabel);
-            setSummaryLabel(refVal_setSummaryLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("helpText"))))
+    if(m_FieldsSet.test(FieldBit_Question))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("helpText")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setHelpText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHelpText);
-            setHelpText(refVal_setHelpText);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("question")), m_Question);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_SummaryLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("summaryLabel")), m_SummaryLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdBy"))))
+    if(m_FieldsSet.test(FieldBit_HelpText))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdBy")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedBy;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedBy);
-            setCreatedBy(refVal_setCreatedBy);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("helpText")), m_HelpText);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("usedCount"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("usedCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setUsedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsedCount);
-            setUsedCount(refVal_setUsedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastUsed"))))
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastUsed")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setLastUsed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastUsed);
-            setLastUsed(refVal_setLastUsed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdBy")), m_CreatedBy);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_UsedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("usedCount")), m_UsedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("numStars"))))
+    if(m_FieldsSet.test(FieldBit_LastUsed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("numStars")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setNumStars;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNumStars);
-            setNumStars(refVal_setNumStars);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastUsed")), m_LastUsed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("min"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("min")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMin);
-            setMin(refVal_setMin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("max"))))
+    if(m_FieldsSet.test(FieldBit_NumStars))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("max")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMax;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMax);
-            setMax(refVal_setMax);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("numStars")), m_NumStars);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultValue"))))
+    if(m_FieldsSet.test(FieldBit_Min))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultValue")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setDefaultValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultValue);
-            setDefaultValue(refVal_setDefaultValue);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("min")), m_Min);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("labelNegative"))))
+    if(m_FieldsSet.test(FieldBit_Max))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("labelNegative")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLabelNegative;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLabelNegative);
-            setLabelNegative(refVal_setLabelNegative);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("max")), m_Max);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("labelPositive"))))
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("labelPositive")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLabelPositive;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLabelPositive);
-            setLabelPositive(refVal_setLabelPositive);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultValue")), m_DefaultValue);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("customOptions"))))
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("customOptions")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> refVal_setCustomOptions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCustomOptions);
-            setCustomOptions(refVal_setCustomOptions);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("labelNegative")), m_LabelNegative);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("subQuestionIds"))))
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("subQuestionIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setSubQuestionIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSubQuestionIds);
-            setSubQuestionIds(refVal_setSubQuestionIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("labelPositive")), m_LabelPositive);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions"))))
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAlwaysShowSubQuestions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAlwaysShowSubQuestions);
-            setAlwaysShowSubQuestions(refVal_setAlwaysShowSubQuestions);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("customOptions")), m_CustomOptions);
+    }
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("subQuestionIds")), m_SubQuestionIds);
+    }
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("alwaysShowSubQuestions")), m_AlwaysShowSubQuestions);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reportingOrder"))))
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reportingOrder")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reportingOrder")), m_ReportingOrder);
+    }
+}
+
+bool QuestionConfig::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            double refVal_setReportingOrder;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReportingOrder);
-            setReportingOrder(refVal_setReportingOrder);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("question")):
+            {
+                utility::string_t refVal_setQuestion;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestion))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestion(refVal_setQuestion);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("summaryLabel")):
+            {
+                utility::string_t refVal_setSummaryLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setSummaryLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSummaryLabel(refVal_setSummaryLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("helpText")):
+            {
+                utility::string_t refVal_setHelpText;
+                if(!ModelBase::readBinary(reader, field, refVal_setHelpText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHelpText(refVal_setHelpText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdBy")):
+            {
+                utility::string_t refVal_setCreatedBy;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedBy))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedBy(refVal_setCreatedBy);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("usedCount")):
+            {
+                double refVal_setUsedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsedCount(refVal_setUsedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastUsed")):
+            {
+                utility::datetime refVal_setLastUsed;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastUsed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastUsed(refVal_setLastUsed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                utility::string_t refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("numStars")):
+            {
+                double refVal_setNumStars;
+                if(!ModelBase::readBinary(reader, field, refVal_setNumStars))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNumStars(refVal_setNumStars);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("min")):
+            {
+                double refVal_setMin;
+                if(!ModelBase::readBinary(reader, field, refVal_setMin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMin(refVal_setMin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("max")):
+            {
+                double refVal_setMax;
+                if(!ModelBase::readBinary(reader, field, refVal_setMax))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMax(refVal_setMax);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultValue")):
+            {
+                double refVal_setDefaultValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultValue(refVal_setDefaultValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("labelNegative")):
+            {
+                utility::string_t refVal_setLabelNegative;
+                if(!ModelBase::readBinary(reader, field, refVal_setLabelNegative))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLabelNegative(refVal_setLabelNegative);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("labelPositive")):
+            {
+                utility::string_t refVal_setLabelPositive;
+                if(!ModelBase::readBinary(reader, field, refVal_setLabelPositive))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLabelPositive(refVal_setLabelPositive);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("customOptions")):
+            {
+                std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> refVal_setCustomOptions;
+                if(!ModelBase::readBinary(reader, field, refVal_setCustomOptions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCustomOptions(refVal_setCustomOptions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("subQuestionIds")):
+            {
+                std::vector<utility::string_t> refVal_setSubQuestionIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setSubQuestionIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSubQuestionIds(refVal_setSubQuestionIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("alwaysShowSubQuestions")):
+            {
+                bool refVal_setAlwaysShowSubQuestions;
+                if(!ModelBase::readBinary(reader, field, refVal_setAlwaysShowSubQuestions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAlwaysShowSubQuestions(refVal_setAlwaysShowSubQuestions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reportingOrder")):
+            {
+                double refVal_setReportingOrder;
+                if(!ModelBase::readBinary(reader, field, refVal_setReportingOrder))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReportingOrder(refVal_setReportingOrder);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void QuestionConfig::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -427,87 +918,87 @@ void QuestionConfig::toMultipart(std::shared_ptr<MultipartFormData> multipart, c
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_QuestionIsSet)
+    if(m_FieldsSet.test(FieldBit_Question))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("question")), m_Question));
     }
-    if(m_SummaryLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_SummaryLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("summaryLabel")), m_SummaryLabel));
     }
-    if(m_HelpTextIsSet)
+    if(m_FieldsSet.test(FieldBit_HelpText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("helpText")), m_HelpText));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_CreatedByIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdBy")), m_CreatedBy));
     }
-    if(m_UsedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_UsedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("usedCount")), m_UsedCount));
     }
-    if(m_LastUsedIsSet)
+    if(m_FieldsSet.test(FieldBit_LastUsed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastUsed")), m_LastUsed));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_NumStarsIsSet)
+    if(m_FieldsSet.test(FieldBit_NumStars))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("numStars")), m_NumStars));
     }
-    if(m_MinIsSet)
+    if(m_FieldsSet.test(FieldBit_Min))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("min")), m_Min));
     }
-    if(m_MaxIsSet)
+    if(m_FieldsSet.test(FieldBit_Max))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("max")), m_Max));
     }
-    if(m_DefaultValueIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultValue")), m_DefaultValue));
     }
-    if(m_LabelNegativeIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("labelNegative")), m_LabelNegative));
     }
-    if(m_LabelPositiveIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("labelPositive")), m_LabelPositive));
     }
-    if(m_CustomOptionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customOptions")), m_CustomOptions));
     }
-    if(m_SubQuestionIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("subQuestionIds")), m_SubQuestionIds));
     }
-    if(m_AlwaysShowSubQuestionsIsSet)
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions")), m_AlwaysShowSubQuestions));
     }
-    if(m_ReportingOrderIsSet)
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reportingOrder")), m_ReportingOrder));
     }
@@ -661,17 +1152,17 @@ utility::string_t QuestionConfig::getId() const
 void QuestionConfig::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool QuestionConfig::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void QuestionConfig::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t QuestionConfig::getTenantId() const
 {
@@ -682,17 +1173,17 @@ utility::string_t QuestionConfig::getTenantId() const
 void QuestionConfig::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool QuestionConfig::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void QuestionConfig::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t QuestionConfig::getName() const
 {
@@ -703,17 +1194,17 @@ utility::string_t QuestionConfig::getName() const
 void QuestionConfig::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool QuestionConfig::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void QuestionConfig::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t QuestionConfig::getQuestion() const
 {
@@ -724,17 +1215,17 @@ utility::string_t QuestionConfig::getQuestion() const
 void QuestionConfig::setQuestion(const utility::string_t& value)
 {
     m_Question = value;
-    m_QuestionIsSet = true;
+    m_FieldsSet.set(FieldBit_Question);
 }
 
 bool QuestionConfig::questionIsSet() const
 {
-    return m_QuestionIsSet;
+    return m_FieldsSet.test(FieldBit_Question);
 }
 
 void QuestionConfig::unsetQuestion()
 {
-    m_QuestionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Question);
 }
 utility::string_t QuestionConfig::getSummaryLabel() const
 {
@@ -745,17 +1236,17 @@ utility::string_t QuestionConfig::getSummaryLabel() const
 void QuestionConfig::setSummaryLabel(const utility::string_t& value)
 {
     m_SummaryLabel = value;
-    m_SummaryLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_SummaryLabel);
 }
 
 bool QuestionConfig::summaryLabelIsSet() const
 {
-    return m_SummaryLabelIsSet;
+    return m_FieldsSet.test(FieldBit_SummaryLabel);
 }
 
 void QuestionConfig::unsetSummaryLabel()
 {
-    m_SummaryLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_SummaryLabel);
 }
 utility::string_t QuestionConfig::getHelpText() const
 {
@@ -766,17 +1257,17 @@ utility::string_t QuestionConfig::getHelpText() const
 void QuestionConfig::setHelpText(const utility::string_t& value)
 {
     m_HelpText = value;
-    m_HelpTextIsSet = true;
+    m_FieldsSet.set(FieldBit_HelpText);
 }
 
 bool QuestionConfig::helpTextIsSet() const
 {
-    return m_HelpTextIsSet;
+    return m_FieldsSet.test(FieldBit_HelpText);
 }
 
 void QuestionConfig::unsetHelpText()
 {
-    m_HelpTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_HelpText);
 }
 utility::datetime QuestionConfig::getCreatedAt() const
 {
@@ -787,17 +1278,17 @@ utility::datetime QuestionConfig::getCreatedAt() const
 void QuestionConfig::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool QuestionConfig::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void QuestionConfig::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t QuestionConfig::getCreatedBy() const
 {
@@ -808,17 +1299,17 @@ utility::string_t QuestionConfig::getCreatedBy() const
 void QuestionConfig::setCreatedBy(const utility::string_t& value)
 {
     m_CreatedBy = value;
-    m_CreatedByIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedBy);
 }
 
 bool QuestionConfig::createdByIsSet() const
 {
-    return m_CreatedByIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedBy);
 }
 
 void QuestionConfig::unsetCreatedBy()
 {
-    m_CreatedByIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedBy);
 }
 double QuestionConfig::getUsedCount() const
 {
@@ -828,17 +1319,17 @@ double QuestionConfig::getUsedCount() const
 void QuestionConfig::setUsedCount(double value)
 {
     m_UsedCount = value;
-    m_UsedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_UsedCount);
 }
 
 bool QuestionConfig::usedCountIsSet() const
 {
-    return m_UsedCountIsSet;
+    return m_FieldsSet.test(FieldBit_UsedCount);
 }
 
 void QuestionConfig::unsetUsedCount()
 {
-    m_UsedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_UsedCount);
 }
 utility::datetime QuestionConfig::getLastUsed() const
 {
@@ -849,17 +1340,17 @@ utility::datetime QuestionConfig::getLastUsed() const
 void QuestionConfig::setLastUsed(const utility::datetime& value)
 {
     m_LastUsed = value;
-    m_LastUsedIsSet = true;
+    m_FieldsSet.set(FieldBit_LastUsed);
 }
 
 bool QuestionConfig::lastUsedIsSet() const
 {
-    return m_LastUsedIsSet;
+    return m_FieldsSet.test(FieldBit_LastUsed);
 }
 
 void QuestionConfig::unsetLastUsed()
 {
-    m_LastUsedIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastUsed);
 }
 utility::string_t QuestionConfig::getType() const
 {
@@ -870,17 +1361,17 @@ utility::string_t QuestionConfig::getType() const
 void QuestionConfig::setType(const utility::string_t& value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool QuestionConfig::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void QuestionConfig::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 double QuestionConfig::getNumStars() const
 {
@@ -890,17 +1381,17 @@ double QuestionConfig::getNumStars() const
 void QuestionConfig::setNumStars(double value)
 {
     m_NumStars = value;
-    m_NumStarsIsSet = true;
+    m_FieldsSet.set(FieldBit_NumStars);
 }
 
 bool QuestionConfig::numStarsIsSet() const
 {
-    return m_NumStarsIsSet;
+    return m_FieldsSet.test(FieldBit_NumStars);
 }
 
 void QuestionConfig::unsetNumStars()
 {
-    m_NumStarsIsSet = false;
+    m_FieldsSet.reset(FieldBit_NumStars);
 }
 double QuestionConfig::getMin() const
 {
@@ -910,17 +1401,17 @@ double QuestionConfig::getMin() const
 void QuestionConfig::setMin(double value)
 {
     m_Min = value;
-    m_MinIsSet = true;
+    m_FieldsSet.set(FieldBit_Min);
 }
 
 bool QuestionConfig::minIsSet() const
 {
-    return m_MinIsSet;
+    return m_FieldsSet.test(FieldBit_Min);
 }
 
 void QuestionConfig::unsetMin()
 {
-    m_MinIsSet = false;
+    m_FieldsSet.reset(FieldBit_Min);
 }
 double QuestionConfig::getMax() const
 {
@@ -930,17 +1421,17 @@ double QuestionConfig::getMax() const
 void QuestionConfig::setMax(double value)
 {
     m_Max = value;
-    m_MaxIsSet = true;
+    m_FieldsSet.set(FieldBit_Max);
 }
 
 bool QuestionConfig::maxIsSet() const
 {
-    return m_MaxIsSet;
+    return m_FieldsSet.test(FieldBit_Max);
 }
 
 void QuestionConfig::unsetMax()
 {
-    m_MaxIsSet = false;
+    m_FieldsSet.reset(FieldBit_Max);
 }
 double QuestionConfig::getDefaultValue() const
 {
@@ -950,17 +1441,17 @@ double QuestionConfig::getDefaultValue() const
 void QuestionConfig::setDefaultValue(double value)
 {
     m_DefaultValue = value;
-    m_DefaultValueIsSet = true;
+    m_FieldsSet.set(FieldBit_DefaultValue);
 }
 
 bool QuestionConfig::defaultValueIsSet() const
 {
-    return m_DefaultValueIsSet;
+    return m_FieldsSet.test(FieldBit_DefaultValue);
 }
 
 void QuestionConfig::unsetDefaultValue()
 {
-    m_DefaultValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_DefaultValue);
 }
 utility::string_t QuestionConfig::getLabelNegative() const
 {
@@ -971,17 +1462,17 @@ utility::string_t QuestionConfig::getLabelNegative() const
 void QuestionConfig::setLabelNegative(const utility::string_t& value)
 {
     m_LabelNegative = value;
-    m_LabelNegativeIsSet = true;
+    m_FieldsSet.set(FieldBit_LabelNegative);
 }
 
 bool QuestionConfig::labelNegativeIsSet() const
 {
-    return m_LabelNegativeIsSet;
+    return m_FieldsSet.test(FieldBit_LabelNegative);
 }
 
 void QuestionConfig::unsetLabelNegative()
 {
-    m_LabelNegativeIsSet = false;
+    m_FieldsSet.reset(FieldBit_LabelNegative);
 }
 utility::string_t QuestionConfig::getLabelPositive() const
 {
@@ -992,17 +1483,17 @@ utility::string_t QuestionConfig::getLabelPositive() const
 void QuestionConfig::setLabelPositive(const utility::string_t& value)
 {
     m_LabelPositive = value;
-    m_LabelPositiveIsSet = true;
+    m_FieldsSet.set(FieldBit_LabelPositive);
 }
 
 bool QuestionConfig::labelPositiveIsSet() const
 {
-    return m_LabelPositiveIsSet;
+    return m_FieldsSet.test(FieldBit_LabelPositive);
 }
 
 void QuestionConfig::unsetLabelPositive()
 {
-    m_LabelPositiveIsSet = false;
+    m_FieldsSet.reset(FieldBit_LabelPositive);
 }
 std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> QuestionConfig::getCustomOptions() const
 {
@@ -1013,17 +1504,17 @@ std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> QuestionConfig:
 void QuestionConfig::setCustomOptions(const std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>>& value)
 {
     m_CustomOptions = value;
-    m_CustomOptionsIsSet = true;
+    m_FieldsSet.set(FieldBit_CustomOptions);
 }
 
 bool QuestionConfig::customOptionsIsSet() const
 {
-    return m_CustomOptionsIsSet;
+    return m_FieldsSet.test(FieldBit_CustomOptions);
 }
 
 void QuestionConfig::unsetCustomOptions()
 {
-    m_CustomOptionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_CustomOptions);
 }
 std::vector<utility::string_t> QuestionConfig::getSubQuestionIds() const
 {
@@ -1034,17 +1525,17 @@ std::vector<utility::string_t> QuestionConfig::getSubQuestionIds() const
 void QuestionConfig::setSubQuestionIds(const std::vector<utility::string_t>& value)
 {
     m_SubQuestionIds = value;
-    m_SubQuestionIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_SubQuestionIds);
 }
 
 bool QuestionConfig::subQuestionIdsIsSet() const
 {
-    return m_SubQuestionIdsIsSet;
+    return m_FieldsSet.test(FieldBit_SubQuestionIds);
 }
 
 void QuestionConfig::unsetSubQuestionIds()
 {
-    m_SubQuestionIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_SubQuestionIds);
 }
 bool QuestionConfig::isAlwaysShowSubQuestions() const
 {
@@ -1054,17 +1545,17 @@ bool QuestionConfig::isAlwaysShowSubQuestions() const
 void QuestionConfig::setAlwaysShowSubQuestions(bool value)
 {
     m_AlwaysShowSubQuestions = value;
-    m_AlwaysShowSubQuestionsIsSet = true;
+    m_FieldsSet.set(FieldBit_AlwaysShowSubQuestions);
 }
 
 bool QuestionConfig::alwaysShowSubQuestionsIsSet() const
 {
-    return m_AlwaysShowSubQuestionsIsSet;
+    return m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions);
 }
 
 void QuestionConfig::unsetAlwaysShowSubQuestions()
 {
-    m_AlwaysShowSubQuestionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AlwaysShowSubQuestions);
 }
 double QuestionConfig::getReportingOrder() const
 {
@@ -1074,17 +1565,17 @@ double QuestionConfig::getReportingOrder() const
 void QuestionConfig::setReportingOrder(double value)
 {
     m_ReportingOrder = value;
-    m_ReportingOrderIsSet = true;
+    m_FieldsSet.set(FieldBit_ReportingOrder);
 }
 
 bool QuestionConfig::reportingOrderIsSet() const
 {
-    return m_ReportingOrderIsSet;
+    return m_FieldsSet.test(FieldBit_ReportingOrder);
 }
 
 void QuestionConfig::unsetReportingOrder()
 {
-    m_ReportingOrderIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReportingOrder);
 }
 
 }
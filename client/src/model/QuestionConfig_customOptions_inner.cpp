@@ -20,10 +20,6 @@ namespace model {
 
 QuestionConfig_customOptions_inner::QuestionConfig_customOptions_inner()
 {
-    m_ImageSrc = utility::conversions::to_string_t("");
-    m_ImageSrcIsSet = false;
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
 }
 
 QuestionConfig_customOptions_inner::~QuestionConfig_customOptions_inner()
@@ -38,12 +34,12 @@ void QuestionConfig_customOptions_inner::validate()
 web::json::value QuestionConfig_customOptions_inner::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ImageSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_ImageSrc))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("imageSrc"))] = ModelBase::toJson(m_ImageSrc);
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
@@ -52,32 +48,119 @@ web::json::value QuestionConfig_customOptions_inner::toJson() const
     return val;
 }
 
+void QuestionConfig_customOptions_inner::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ImageSrc))
+    {
+        
+        writer.key(_XPLATSTR("imageSrc"));
+        ModelBase::writeJson(writer, m_ImageSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+
+    writer.endObject();
+}
+
 bool QuestionConfig_customOptions_inner::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("imageSrc"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("imageSrc")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setImageSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setImageSrc);
-            setImageSrc(refVal_setImageSrc);
-            
+        case ModelBase::fieldHash(_XPLATSTR("imageSrc")):
+            if(field.first == _XPLATSTR("imageSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setImageSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setImageSrc);
+                    setImageSrc(refVal_setImageSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    return ok;
+}
+
+void QuestionConfig_customOptions_inner::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ImageSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("imageSrc")), m_ImageSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
+    }
+}
+
+bool QuestionConfig_customOptions_inner::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("imageSrc")):
+            {
+                utility::string_t refVal_setImageSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setImageSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setImageSrc(refVal_setImageSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void QuestionConfig_customOptions_inner::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -87,11 +170,11 @@ void QuestionConfig_customOptions_inner::toMultipart(std::shared_ptr<MultipartFo
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ImageSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_ImageSrc))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("imageSrc")), m_ImageSrc));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
@@ -131,17 +214,17 @@ utility::string_t QuestionConfig_customOptions_inner::getImageSrc() const
 void QuestionConfig_customOptions_inner::setImageSrc(const utility::string_t& value)
 {
     m_ImageSrc = value;
-    m_ImageSrcIsSet = true;
+    m_FieldsSet.set(FieldBit_ImageSrc);
 }
 
 bool QuestionConfig_customOptions_inner::imageSrcIsSet() const
 {
-    return m_ImageSrcIsSet;
+    return m_FieldsSet.test(FieldBit_ImageSrc);
 }
 
 void QuestionConfig_customOptions_inner::unsetImageSrc()
 {
-    m_ImageSrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_ImageSrc);
 }
 utility::string_t QuestionConfig_customOptions_inner::getName() const
 {
@@ -152,17 +235,17 @@ utility::string_t QuestionConfig_customOptions_inner::getName() const
 void QuestionConfig_customOptions_inner::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool QuestionConfig_customOptions_inner::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void QuestionConfig_customOptions_inner::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 
 }
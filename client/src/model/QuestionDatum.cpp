@@ -20,9 +20,7 @@ namespace model {
 
 QuestionDatum::QuestionDatum()
 {
-    m_vIsSet = false;
     m_Total = 0L;
-    m_TotalIsSet = false;
 }
 
 QuestionDatum::~QuestionDatum()
@@ -37,12 +35,12 @@ void QuestionDatum::validate()
 web::json::value QuestionDatum::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_vIsSet)
+    if(m_FieldsSet.test(FieldBit_v))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("v"))] = ModelBase::toJson(m_v);
     }
-    if(m_TotalIsSet)
+    if(m_FieldsSet.test(FieldBit_Total))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("total"))] = ModelBase::toJson(m_Total);
@@ -51,32 +49,119 @@ web::json::value QuestionDatum::toJson() const
     return val;
 }
 
+void QuestionDatum::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_v))
+    {
+        
+        writer.key(_XPLATSTR("v"));
+        ModelBase::writeJson(writer, m_v);
+    }
+    if(m_FieldsSet.test(FieldBit_Total))
+    {
+        
+        writer.key(_XPLATSTR("total"));
+        ModelBase::writeJson(writer, m_Total);
+    }
+
+    writer.endObject();
+}
+
 bool QuestionDatum::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("v"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("v")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, double> refVal_setV;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setV);
-            setV(refVal_setV);
-            
+        case ModelBase::fieldHash(_XPLATSTR("v")):
+            if(field.first == _XPLATSTR("v"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, double> refVal_setV;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setV);
+                    setV(refVal_setV);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("total")):
+            if(field.first == _XPLATSTR("total"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setTotal;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTotal);
+                    setTotal(refVal_setTotal);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("total"))))
+    return ok;
+}
+
+void QuestionDatum::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_v))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("total")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("v")), m_v);
+    }
+    if(m_FieldsSet.test(FieldBit_Total))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("total")), m_Total);
+    }
+}
+
+bool QuestionDatum::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int64_t refVal_setTotal;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTotal);
-            setTotal(refVal_setTotal);
-            
+        case ModelBase::fieldHash(_XPLATSTR("v")):
+            {
+                std::map<utility::string_t, double> refVal_setV;
+                if(!ModelBase::readBinary(reader, field, refVal_setV))
+                {
+                    ok = false;
+                    continue;
+                }
+                setV(refVal_setV);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("total")):
+            {
+                int64_t refVal_setTotal;
+                if(!ModelBase::readBinary(reader, field, refVal_setTotal))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTotal(refVal_setTotal);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void QuestionDatum::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +171,11 @@ void QuestionDatum::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_vIsSet)
+    if(m_FieldsSet.test(FieldBit_v))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("v")), m_v));
     }
-    if(m_TotalIsSet)
+    if(m_FieldsSet.test(FieldBit_Total))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("total")), m_Total));
     }
@@ -129,17 +214,17 @@ std::map<utility::string_t, double> QuestionDatum::getV() const
 void QuestionDatum::setV(std::map<utility::string_t, double> value)
 {
     m_v = value;
-    m_vIsSet = true;
+    m_FieldsSet.set(FieldBit_v);
 }
 
 bool QuestionDatum::VIsSet() const
 {
-    return m_vIsSet;
+    return m_FieldsSet.test(FieldBit_v);
 }
 
 void QuestionDatum::unsetv()
 {
-    m_vIsSet = false;
+    m_FieldsSet.reset(FieldBit_v);
 }
 int64_t QuestionDatum::getTotal() const
 {
@@ -149,17 +234,17 @@ int64_t QuestionDatum::getTotal() const
 void QuestionDatum::setTotal(int64_t value)
 {
     m_Total = value;
-    m_TotalIsSet = true;
+    m_FieldsSet.set(FieldBit_Total);
 }
 
 bool QuestionDatum::totalIsSet() const
 {
-    return m_TotalIsSet;
+    return m_FieldsSet.test(FieldBit_Total);
 }
 
 void QuestionDatum::unsetTotal()
 {
-    m_TotalIsSet = false;
+    m_FieldsSet.reset(FieldBit_Total);
 }
 
 }
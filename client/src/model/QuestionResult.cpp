@@ -20,24 +20,7 @@ namespace model {
 
 QuestionResult::QuestionResult()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_AnonUserId = utility::conversions::to_string_t("");
-    m_AnonUserIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
     m_Value = 0;
-    m_ValueIsSet = false;
-    m_QuestionId = utility::conversions::to_string_t("");
-    m_QuestionIdIsSet = false;
-    m_IpHash = utility::conversions::to_string_t("");
-    m_IpHashIsSet = false;
 }
 
 QuestionResult::~QuestionResult()
@@ -52,57 +35,57 @@ void QuestionResult::validate()
 web::json::value QuestionResult::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_ValueIsSet)
+    if(m_FieldsSet.test(FieldBit_Value))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("value"))] = ModelBase::toJson(m_Value);
     }
-    if(m_CommentId.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commentId"))] = ModelBase::toJson(m_CommentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commentId"))] = ModelBase::toJson(m_CommentId);
     }
-    if(m_QuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("questionId"))] = ModelBase::toJson(m_QuestionId);
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
-    if(m_IpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ipHash"))] = ModelBase::toJson(m_IpHash);
@@ -111,131 +94,425 @@ web::json::value QuestionResult::toJson() const
     return val;
 }
 
+void QuestionResult::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Value))
+    {
+        
+        writer.key(_XPLATSTR("value"));
+        ModelBase::writeJson(writer, m_Value);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentId))
+    {
+        
+        writer.key(_XPLATSTR("commentId"));
+        ModelBase::writeJson(writer, m_CommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionId))
+    {
+        
+        writer.key(_XPLATSTR("questionId"));
+        ModelBase::writeJson(writer, m_QuestionId);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHash))
+    {
+        
+        writer.key(_XPLATSTR("ipHash"));
+        ModelBase::writeJson(writer, m_IpHash);
+    }
+
+    writer.endObject();
+}
+
 bool QuestionResult::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("value")):
+            if(field.first == _XPLATSTR("value"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setValue);
+                    setValue(refVal_setValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            if(field.first == _XPLATSTR("commentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
+                    setCommentId(refVal_setCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("questionId")):
+            if(field.first == _XPLATSTR("questionId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setQuestionId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionId);
+                    setQuestionId(refVal_setQuestionId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<MetaItem>> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            if(field.first == _XPLATSTR("ipHash"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setIpHash;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
+                    setIpHash(refVal_setIpHash);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    return ok;
+}
+
+void QuestionResult::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("value"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("value")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setValue);
-            setValue(refVal_setValue);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentId"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentId);
-            setCommentId(refVal_setCommentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("questionId"))))
+    if(m_FieldsSet.test(FieldBit_Value))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("questionId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setQuestionId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestionId);
-            setQuestionId(refVal_setQuestionId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("value")), m_Value);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<MetaItem>> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentId")), m_CommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_QuestionId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("questionId")), m_QuestionId);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_IpHash))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ipHash")), m_IpHash);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ipHash"))))
+}
+
+bool QuestionResult::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ipHash")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            utility::string_t refVal_setIpHash;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIpHash);
-            setIpHash(refVal_setIpHash);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("value")):
+            {
+                int32_t refVal_setValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setValue(refVal_setValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentId")):
+            {
+                utility::string_t refVal_setCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentId(refVal_setCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("questionId")):
+            {
+                utility::string_t refVal_setQuestionId;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestionId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestionId(refVal_setQuestionId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::vector<std::shared_ptr<MetaItem>> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ipHash")):
+            {
+                utility::string_t refVal_setIpHash;
+                if(!ModelBase::readBinary(reader, field, refVal_setIpHash))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIpHash(refVal_setIpHash);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void QuestionResult::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -245,47 +522,47 @@ void QuestionResult::toMultipart(std::shared_ptr<MultipartFormData> multipart, c
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_AnonUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_ValueIsSet)
+    if(m_FieldsSet.test(FieldBit_Value))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("value")), m_Value));
     }
-    if(m_CommentId.has_value())
+    if(m_FieldsSet.test(FieldBit_CommentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentId")), m_CommentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentId")), m_CommentId));
     }
-    if(m_QuestionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_QuestionId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("questionId")), m_QuestionId));
     }
-    if(m_Meta.has_value())
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
-    if(m_IpHashIsSet)
+    if(m_FieldsSet.test(FieldBit_IpHash))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ipHash")), m_IpHash));
     }
@@ -379,17 +656,17 @@ utility::string_t QuestionResult::getId() const
 void QuestionResult::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool QuestionResult::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void QuestionResult::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t QuestionResult::getTenantId() const
 {
@@ -400,17 +677,17 @@ utility::string_t QuestionResult::getTenantId() const
 void QuestionResult::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool QuestionResult::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void QuestionResult::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t QuestionResult::getUrlId() const
 {
@@ -421,17 +698,17 @@ utility::string_t QuestionResult::getUrlId() const
 void QuestionResult::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool QuestionResult::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void QuestionResult::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t QuestionResult::getAnonUserId() const
 {
@@ -442,17 +719,17 @@ utility::string_t QuestionResult::getAnonUserId() const
 void QuestionResult::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
-    m_AnonUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool QuestionResult::anonUserIdIsSet() const
 {
-    return m_AnonUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void QuestionResult::unsetAnonUserId()
 {
-    m_AnonUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t QuestionResult::getUserId() const
 {
@@ -463,17 +740,17 @@ utility::string_t QuestionResult::getUserId() const
 void QuestionResult::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool QuestionResult::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void QuestionResult::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::datetime QuestionResult::getCreatedAt() const
 {
@@ -484,17 +761,17 @@ utility::datetime QuestionResult::getCreatedAt() const
 void QuestionResult::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool QuestionResult::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void QuestionResult::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 int32_t QuestionResult::getValue() const
 {
@@ -504,37 +781,38 @@ int32_t QuestionResult::getValue() const
 void QuestionResult::setValue(int32_t value)
 {
     m_Value = value;
-    m_ValueIsSet = true;
+    m_FieldsSet.set(FieldBit_Value);
 }
 
 bool QuestionResult::valueIsSet() const
 {
-    return m_ValueIsSet;
+    return m_FieldsSet.test(FieldBit_Value);
 }
 
 void QuestionResult::unsetValue()
 {
-    m_ValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_Value);
 }
 utility::string_t QuestionResult::getCommentId() const
 {
-    return m_CommentId.get();
+    return m_CommentId;
 }
 
 
 void QuestionResult::setCommentId(const utility::string_t& value)
 {
     m_CommentId = value;
+    m_FieldsSet.set(FieldBit_CommentId);
 }
 
 bool QuestionResult::commentIdIsSet() const
 {
-    return m_CommentId.has_value();
+    return m_FieldsSet.test(FieldBit_CommentId);
 }
 
 void QuestionResult::unsetCommentId()
 {
-    m_CommentId.reset();
+    m_FieldsSet.reset(FieldBit_CommentId);
 }
 utility::string_t QuestionResult::getQuestionId() const
 {
@@ -545,37 +823,38 @@ utility::string_t QuestionResult::getQuestionId() const
 void QuestionResult::setQuestionId(const utility::string_t& value)
 {
     m_QuestionId = value;
-    m_QuestionIdIsSet = true;
+    m_FieldsSet.set(FieldBit_QuestionId);
 }
 
 bool QuestionResult::questionIdIsSet() const
 {
-    return m_QuestionIdIsSet;
+    return m_FieldsSet.test(FieldBit_QuestionId);
 }
 
 void QuestionResult::unsetQuestionId()
 {
-    m_QuestionIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_QuestionId);
 }
 std::vector<std::shared_ptr<MetaItem>> QuestionResult::getMeta() const
 {
-    return m_Meta.get();
+    return m_Meta;
 }
 
 
 void QuestionResult::setMeta(const std::vector<std::shared_ptr<MetaItem>>& value)
 {
     m_Meta = value;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool QuestionResult::metaIsSet() const
 {
-    return m_Meta.has_value();
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void QuestionResult::unsetMeta()
 {
-    m_Meta.reset();
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 utility::string_t QuestionResult::getIpHash() const
 {
@@ -586,17 +865,17 @@ utility::string_t QuestionResult::getIpHash() const
 void QuestionResult::setIpHash(const utility::string_t& value)
 {
     m_IpHash = value;
-    m_IpHashIsSet = true;
+    m_FieldsSet.set(FieldBit_IpHash);
 }
 
 bool QuestionResult::ipHashIsSet() const
 {
-    return m_IpHashIsSet;
+    return m_FieldsSet.test(FieldBit_IpHash);
 }
 
 void QuestionResult::unsetIpHash()
 {
-    m_IpHashIsSet = false;
+    m_FieldsSet.reset(FieldBit_IpHash);
 }
 
 }
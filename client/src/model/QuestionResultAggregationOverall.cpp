@@ -20,15 +20,8 @@ namespace model {
 
 QuestionResultAggregationOverall::QuestionResultAggregationOverall()
 {
-    m_DataByDateBucketIsSet = false;
-    m_DataByUrlIdIsSet = false;
-    m_CountsByValueIsSet = false;
     m_Total = 0L;
-    m_TotalIsSet = false;
     m_Average = 0.0;
-    m_AverageIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
 }
 
 QuestionResultAggregationOverall::~QuestionResultAggregationOverall()
@@ -43,32 +36,32 @@ void QuestionResultAggregationOverall::validate()
 web::json::value QuestionResultAggregationOverall::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_DataByDateBucketIsSet)
+    if(m_FieldsSet.test(FieldBit_DataByDateBucket))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("dataByDateBucket"))] = ModelBase::toJson(m_DataByDateBucket);
     }
-    if(m_DataByUrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_DataByUrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("dataByUrlId"))] = ModelBase::toJson(m_DataByUrlId);
     }
-    if(m_CountsByValueIsSet)
+    if(m_FieldsSet.test(FieldBit_CountsByValue))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("countsByValue"))] = ModelBase::toJson(m_CountsByValue);
     }
-    if(m_TotalIsSet)
+    if(m_FieldsSet.test(FieldBit_Total))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("total"))] = ModelBase::toJson(m_Total);
     }
-    if(m_AverageIsSet)
+    if(m_FieldsSet.test(FieldBit_Average))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("average"))] = ModelBase::toJson(m_Average);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
@@ -77,76 +70,255 @@ web::json::value QuestionResultAggregationOverall::toJson() const
     return val;
 }
 
+void QuestionResultAggregationOverall::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_DataByDateBucket))
+    {
+        
+        writer.key(_XPLATSTR("dataByDateBucket"));
+        ModelBase::writeJson(writer, m_DataByDateBucket);
+    }
+    if(m_FieldsSet.test(FieldBit_DataByUrlId))
+    {
+        
+        writer.key(_XPLATSTR("dataByUrlId"));
+        ModelBase::writeJson(writer, m_DataByUrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_CountsByValue))
+    {
+        
+        writer.key(_XPLATSTR("countsByValue"));
+        ModelBase::writeJson(writer, m_CountsByValue);
+    }
+    if(m_FieldsSet.test(FieldBit_Total))
+    {
+        
+        writer.key(_XPLATSTR("total"));
+        ModelBase::writeJson(writer, m_Total);
+    }
+    if(m_FieldsSet.test(FieldBit_Average))
+    {
+        
+        writer.key(_XPLATSTR("average"));
+        ModelBase::writeJson(writer, m_Average);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+
+    writer.endObject();
+}
+
 bool QuestionResultAggregationOverall::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("dataByDateBucket"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("dataByDateBucket")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::shared_ptr<QuestionDatum>> refVal_setDataByDateBucket;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDataByDateBucket);
-            setDataByDateBucket(refVal_setDataByDateBucket);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("dataByUrlId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("dataByUrlId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, std::shared_ptr<QuestionDatum>> refVal_setDataByUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDataByUrlId);
-            setDataByUrlId(refVal_setDataByUrlId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("dataByDateBucket")):
+            if(field.first == _XPLATSTR("dataByDateBucket"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<QuestionDatum>> refVal_setDataByDateBucket;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDataByDateBucket);
+                    setDataByDateBucket(refVal_setDataByDateBucket);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("dataByUrlId")):
+            if(field.first == _XPLATSTR("dataByUrlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<QuestionDatum>> refVal_setDataByUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDataByUrlId);
+                    setDataByUrlId(refVal_setDataByUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("countsByValue")):
+            if(field.first == _XPLATSTR("countsByValue"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, int32_t> refVal_setCountsByValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCountsByValue);
+                    setCountsByValue(refVal_setCountsByValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("total")):
+            if(field.first == _XPLATSTR("total"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setTotal;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTotal);
+                    setTotal(refVal_setTotal);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("average")):
+            if(field.first == _XPLATSTR("average"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAverage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAverage);
+                    setAverage(refVal_setAverage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("countsByValue"))))
+    return ok;
+}
+
+void QuestionResultAggregationOverall::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_DataByDateBucket))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("countsByValue")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, int32_t> refVal_setCountsByValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCountsByValue);
-            setCountsByValue(refVal_setCountsByValue);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("dataByDateBucket")), m_DataByDateBucket);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("total"))))
+    if(m_FieldsSet.test(FieldBit_DataByUrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("total")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setTotal;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTotal);
-            setTotal(refVal_setTotal);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("dataByUrlId")), m_DataByUrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("average"))))
+    if(m_FieldsSet.test(FieldBit_CountsByValue))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("average")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAverage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAverage);
-            setAverage(refVal_setAverage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("countsByValue")), m_CountsByValue);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_Total))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("total")), m_Total);
+    }
+    if(m_FieldsSet.test(FieldBit_Average))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("average")), m_Average);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
+    }
+}
+
+bool QuestionResultAggregationOverall::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
+        case ModelBase::fieldHash(_XPLATSTR("dataByDateBucket")):
+            {
+                std::map<utility::string_t, std::shared_ptr<QuestionDatum>> refVal_setDataByDateBucket;
+                if(!ModelBase::readBinary(reader, field, refVal_setDataByDateBucket))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDataByDateBucket(refVal_setDataByDateBucket);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("dataByUrlId")):
+            {
+                std::map<utility::string_t, std::shared_ptr<QuestionDatum>> refVal_setDataByUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setDataByUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDataByUrlId(refVal_setDataByUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("countsByValue")):
+            {
+                std::map<utility::string_t, int32_t> refVal_setCountsByValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setCountsByValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCountsByValue(refVal_setCountsByValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("total")):
+            {
+                int64_t refVal_setTotal;
+                if(!ModelBase::readBinary(reader, field, refVal_setTotal))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTotal(refVal_setTotal);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("average")):
+            {
+                double refVal_setAverage;
+                if(!ModelBase::readBinary(reader, field, refVal_setAverage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAverage(refVal_setAverage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void QuestionResultAggregationOverall::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -156,27 +328,27 @@ void QuestionResultAggregationOverall::toMultipart(std::shared_ptr<MultipartForm
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_DataByDateBucketIsSet)
+    if(m_FieldsSet.test(FieldBit_DataByDateBucket))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("dataByDateBucket")), m_DataByDateBucket));
     }
-    if(m_DataByUrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_DataByUrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("dataByUrlId")), m_DataByUrlId));
     }
-    if(m_CountsByValueIsSet)
+    if(m_FieldsSet.test(FieldBit_CountsByValue))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("countsByValue")), m_CountsByValue));
     }
-    if(m_TotalIsSet)
+    if(m_FieldsSet.test(FieldBit_Total))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("total")), m_Total));
     }
-    if(m_AverageIsSet)
+    if(m_FieldsSet.test(FieldBit_Average))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("average")), m_Average));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
@@ -240,17 +412,17 @@ std::map<utility::string_t, std::shared_ptr<QuestionDatum>> QuestionResultAggreg
 void QuestionResultAggregationOverall::setDataByDateBucket(const std::map<utility::string_t, std::shared_ptr<QuestionDatum>>& value)
 {
     m_DataByDateBucket = value;
-    m_DataByDateBucketIsSet = true;
+    m_FieldsSet.set(FieldBit_DataByDateBucket);
 }
 
 bool QuestionResultAggregationOverall::dataByDateBucketIsSet() const
 {
-    return m_DataByDateBucketIsSet;
+    return m_FieldsSet.test(FieldBit_DataByDateBucket);
 }
 
 void QuestionResultAggregationOverall::unsetDataByDateBucket()
 {
-    m_DataByDateBucketIsSet = false;
+    m_FieldsSet.reset(FieldBit_DataByDateBucket);
 }
 std::map<utility::string_t, std::shared_ptr<QuestionDatum>> QuestionResultAggregationOverall::getDataByUrlId() const
 {
@@ -261,17 +433,17 @@ std::map<utility::string_t, std::shared_ptr<QuestionDatum>> QuestionResultAggreg
 void QuestionResultAggregationOverall::setDataByUrlId(const std::map<utility::string_t, std::shared_ptr<QuestionDatum>>& value)
 {
     m_DataByUrlId = value;
-    m_DataByUrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_DataByUrlId);
 }
 
 bool QuestionResultAggregationOverall::dataByUrlIdIsSet() const
 {
-    return m_DataByUrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_DataByUrlId);
 }
 
 void QuestionResultAggregationOverall::unsetDataByUrlId()
 {
-    m_DataByUrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_DataByUrlId);
 }
 std::map<utility::string_t, int32_t> QuestionResultAggregationOverall::getCountsByValue() const
 {
@@ -281,17 +453,17 @@ std::map<utility::string_t, int32_t> QuestionResultAggregationOverall::getCounts
 void QuestionResultAggregationOverall::setCountsByValue(std::map<utility::string_t, int32_t> value)
 {
     m_CountsByValue = value;
-    m_CountsByValueIsSet = true;
+    m_FieldsSet.set(FieldBit_CountsByValue);
 }
 
 bool QuestionResultAggregationOverall::countsByValueIsSet() const
 {
-    return m_CountsByValueIsSet;
+    return m_FieldsSet.test(FieldBit_CountsByValue);
 }
 
 void QuestionResultAggregationOverall::unsetCountsByValue()
 {
-    m_CountsByValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_CountsByValue);
 }
 int64_t QuestionResultAggregationOverall::getTotal() const
 {
@@ -301,17 +473,17 @@ int64_t QuestionResultAggregationOverall::getTotal() const
 void QuestionResultAggregationOverall::setTotal(int64_t value)
 {
     m_Total = value;
-    m_TotalIsSet = true;
+    m_FieldsSet.set(FieldBit_Total);
 }
 
 bool QuestionResultAggregationOverall::totalIsSet() const
 {
-    return m_TotalIsSet;
+    return m_FieldsSet.test(FieldBit_Total);
 }
 
 void QuestionResultAggregationOverall::unsetTotal()
 {
-    m_TotalIsSet = false;
+    m_FieldsSet.reset(FieldBit_Total);
 }
 double QuestionResultAggregationOverall::getAverage() const
 {
@@ -321,17 +493,17 @@ double QuestionResultAggregationOverall::getAverage() const
 void QuestionResultAggregationOverall::setAverage(double value)
 {
     m_Average = value;
-    m_AverageIsSet = true;
+    m_FieldsSet.set(FieldBit_Average);
 }
 
 bool QuestionResultAggregationOverall::averageIsSet() const
 {
-    return m_AverageIsSet;
+    return m_FieldsSet.test(FieldBit_Average);
 }
 
 void QuestionResultAggregationOverall::unsetAverage()
 {
-    m_AverageIsSet = false;
+    m_FieldsSet.reset(FieldBit_Average);
 }
 utility::datetime QuestionResultAggregationOverall::getCreatedAt() const
 {
@@ -342,17 +514,17 @@ utility::datetime QuestionResultAggregationOverall::getCreatedAt() const
 void QuestionResultAggregationOverall::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool QuestionResultAggregationOverall::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void QuestionResultAggregationOverall::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 ReactBodyParams::ReactBodyParams()
 {
-    m_ReactType = utility::conversions::to_string_t("");
-    m_ReactTypeIsSet = false;
 }
 
 ReactBodyParams::~ReactBodyParams()
@@ -36,7 +34,7 @@ void ReactBodyParams::validate()
 web::json::value ReactBodyParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ReactTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_ReactType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reactType"))] = ModelBase::toJson(m_ReactType);
@@ -45,23 +43,87 @@ web::json::value ReactBodyParams::toJson() const
     return val;
 }
 
+void ReactBodyParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ReactType))
+    {
+        
+        writer.key(_XPLATSTR("reactType"));
+        ModelBase::writeJson(writer, m_ReactType);
+    }
+
+    writer.endObject();
+}
+
 bool ReactBodyParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reactType"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reactType")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setReactType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReactType);
-            setReactType(refVal_setReactType);
-            
+        case ModelBase::fieldHash(_XPLATSTR("reactType")):
+            if(field.first == _XPLATSTR("reactType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReactType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReactType);
+                    setReactType(refVal_setReactType);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void ReactBodyParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ReactType))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reactType")), m_ReactType);
+    }
+}
+
+bool ReactBodyParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("reactType")):
+            {
+                utility::string_t refVal_setReactType;
+                if(!ModelBase::readBinary(reader, field, refVal_setReactType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReactType(refVal_setReactType);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void ReactBodyParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -69,7 +131,7 @@ void ReactBodyParams::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ReactTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_ReactType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reactType")), m_ReactType));
     }
@@ -103,17 +165,17 @@ utility::string_t ReactBodyParams::getReactType() const
 void ReactBodyParams::setReactType(const utility::string_t& value)
 {
     m_ReactType = value;
-    m_ReactTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_ReactType);
 }
 
 bool ReactBodyParams::reactTypeIsSet() const
 {
-    return m_ReactTypeIsSet;
+    return m_FieldsSet.test(FieldBit_ReactType);
 }
 
 void ReactBodyParams::unsetReactType()
 {
-    m_ReactTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReactType);
 }
 
 }
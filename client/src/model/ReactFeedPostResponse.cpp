@@ -20,11 +20,7 @@ namespace model {
 
 ReactFeedPostResponse::ReactFeedPostResponse()
 {
-    m_StatusIsSet = false;
-    m_ReactType = utility::conversions::to_string_t("");
-    m_ReactTypeIsSet = false;
     m_IsUndo = false;
-    m_IsUndoIsSet = false;
 }
 
 ReactFeedPostResponse::~ReactFeedPostResponse()
@@ -39,17 +35,17 @@ void ReactFeedPostResponse::validate()
 web::json::value ReactFeedPostResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ReactTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_ReactType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reactType"))] = ModelBase::toJson(m_ReactType);
     }
-    if(m_IsUndoIsSet)
+    if(m_FieldsSet.test(FieldBit_IsUndo))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isUndo"))] = ModelBase::toJson(m_IsUndo);
@@ -58,43 +54,153 @@ web::json::value ReactFeedPostResponse::toJson() const
     return val;
 }
 
+void ReactFeedPostResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_ReactType))
+    {
+        
+        writer.key(_XPLATSTR("reactType"));
+        ModelBase::writeJson(writer, m_ReactType);
+    }
+    if(m_FieldsSet.test(FieldBit_IsUndo))
+    {
+        
+        writer.key(_XPLATSTR("isUndo"));
+        ModelBase::writeJson(writer, m_IsUndo);
+    }
+
+    writer.endObject();
+}
+
 bool ReactFeedPostResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reactType"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reactType")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setReactType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReactType);
-            setReactType(refVal_setReactType);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reactType")):
+            if(field.first == _XPLATSTR("reactType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReactType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReactType);
+                    setReactType(refVal_setReactType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isUndo")):
+            if(field.first == _XPLATSTR("isUndo"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsUndo;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsUndo);
+                    setIsUndo(refVal_setIsUndo);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isUndo"))))
+    return ok;
+}
+
+void ReactFeedPostResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_ReactType))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reactType")), m_ReactType);
+    }
+    if(m_FieldsSet.test(FieldBit_IsUndo))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isUndo")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isUndo")), m_IsUndo);
+    }
+}
+
+bool ReactFeedPostResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setIsUndo;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsUndo);
-            setIsUndo(refVal_setIsUndo);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reactType")):
+            {
+                utility::string_t refVal_setReactType;
+                if(!ModelBase::readBinary(reader, field, refVal_setReactType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReactType(refVal_setReactType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isUndo")):
+            {
+                bool refVal_setIsUndo;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsUndo))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsUndo(refVal_setIsUndo);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ReactFeedPostResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -104,15 +210,15 @@ void ReactFeedPostResponse::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ReactTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_ReactType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reactType")), m_ReactType));
     }
-    if(m_IsUndoIsSet)
+    if(m_FieldsSet.test(FieldBit_IsUndo))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isUndo")), m_IsUndo));
     }
@@ -158,17 +264,17 @@ std::shared_ptr<APIStatus> ReactFeedPostResponse::getStatus() const
 void ReactFeedPostResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool ReactFeedPostResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void ReactFeedPostResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t ReactFeedPostResponse::getReactType() const
 {
@@ -179,17 +285,17 @@ utility::string_t ReactFeedPostResponse::getReactType() const
 void ReactFeedPostResponse::setReactType(const utility::string_t& value)
 {
     m_ReactType = value;
-    m_ReactTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_ReactType);
 }
 
 bool ReactFeedPostResponse::reactTypeIsSet() const
 {
-    return m_ReactTypeIsSet;
+    return m_FieldsSet.test(FieldBit_ReactType);
 }
 
 void ReactFeedPostResponse::unsetReactType()
 {
-    m_ReactTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReactType);
 }
 bool ReactFeedPostResponse::isIsUndo() const
 {
@@ -199,17 +305,17 @@ bool ReactFeedPostResponse::isIsUndo() const
 void ReactFeedPostResponse::setIsUndo(bool value)
 {
     m_IsUndo = value;
-    m_IsUndoIsSet = true;
+    m_FieldsSet.set(FieldBit_IsUndo);
 }
 
 bool ReactFeedPostResponse::isUndoIsSet() const
 {
-    return m_IsUndoIsSet;
+    return m_FieldsSet.test(FieldBit_IsUndo);
 }
 
 void ReactFeedPostResponse::unsetIsUndo()
 {
-    m_IsUndoIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsUndo);
 }
 
 }
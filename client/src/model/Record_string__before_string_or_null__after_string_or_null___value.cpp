@@ -34,46 +34,133 @@ void Record_string__before_string_or_null__after_string_or_null___value::validat
 web::json::value Record_string__before_string_or_null__after_string_or_null___value::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_After.has_value())
+    if(m_FieldsSet.test(FieldBit_After))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("after"))] = ModelBase::toJson(m_After.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("after"))] = ModelBase::toJson(m_After);
     }
-    if(m_Before.has_value())
+    if(m_FieldsSet.test(FieldBit_Before))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("before"))] = ModelBase::toJson(m_Before.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("before"))] = ModelBase::toJson(m_Before);
     }
 
     return val;
 }
 
+void Record_string__before_string_or_null__after_string_or_null___value::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_After))
+    {
+        
+        writer.key(_XPLATSTR("after"));
+        ModelBase::writeJson(writer, m_After);
+    }
+    if(m_FieldsSet.test(FieldBit_Before))
+    {
+        
+        writer.key(_XPLATSTR("before"));
+        ModelBase::writeJson(writer, m_Before);
+    }
+
+    writer.endObject();
+}
+
 bool Record_string__before_string_or_null__after_string_or_null___value::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("after"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("after")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setAfter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAfter);
-            setAfter(refVal_setAfter);
-            
+        case ModelBase::fieldHash(_XPLATSTR("after")):
+            if(field.first == _XPLATSTR("after"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAfter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAfter);
+                    setAfter(refVal_setAfter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("before")):
+            if(field.first == _XPLATSTR("before"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBefore;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBefore);
+                    setBefore(refVal_setBefore);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("before"))))
+    return ok;
+}
+
+void Record_string__before_string_or_null__after_string_or_null___value::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_After))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("before")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("after")), m_After);
+    }
+    if(m_FieldsSet.test(FieldBit_Before))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("before")), m_Before);
+    }
+}
+
+bool Record_string__before_string_or_null__after_string_or_null___value::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setBefore;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBefore);
-            setBefore(refVal_setBefore);
-            
+        case ModelBase::fieldHash(_XPLATSTR("after")):
+            {
+                utility::string_t refVal_setAfter;
+                if(!ModelBase::readBinary(reader, field, refVal_setAfter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAfter(refVal_setAfter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("before")):
+            {
+                utility::string_t refVal_setBefore;
+                if(!ModelBase::readBinary(reader, field, refVal_setBefore))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBefore(refVal_setBefore);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void Record_string__before_string_or_null__after_string_or_null___value::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -83,13 +170,13 @@ void Record_string__before_string_or_null__after_string_or_null___value::toMulti
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_After.has_value())
+    if(m_FieldsSet.test(FieldBit_After))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("after")), m_After.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("after")), m_After));
     }
-    if(m_Before.has_value())
+    if(m_FieldsSet.test(FieldBit_Before))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("before")), m_Before.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("before")), m_Before));
     }
 }
 
@@ -120,43 +207,45 @@ bool Record_string__before_string_or_null__after_string_or_null___value::fromMul
 
 utility::string_t Record_string__before_string_or_null__after_string_or_null___value::getAfter() const
 {
-    return m_After.get();
+    return m_After;
 }
 
 
 void Record_string__before_string_or_null__after_string_or_null___value::setAfter(const utility::string_t& value)
 {
     m_After = value;
+    m_FieldsSet.set(FieldBit_After);
 }
 
 bool Record_string__before_string_or_null__after_string_or_null___value::afterIsSet() const
 {
-    return m_After.has_value();
+    return m_FieldsSet.test(FieldBit_After);
 }
 
 void Record_string__before_string_or_null__after_string_or_null___value::unsetAfter()
 {
-    m_After.reset();
+    m_FieldsSet.reset(FieldBit_After);
 }
 utility::string_t Record_string__before_string_or_null__after_string_or_null___value::getBefore() const
 {
-    return m_Before.get();
+    return m_Before;
 }
 
 
 void Record_string__before_string_or_null__after_string_or_null___value::setBefore(const utility::string_t& value)
 {
     m_Before = value;
+    m_FieldsSet.set(FieldBit_Before);
 }
 
 bool Record_string__before_string_or_null__after_string_or_null___value::beforeIsSet() const
 {
-    return m_Before.has_value();
+    return m_FieldsSet.test(FieldBit_Before);
 }
 
 void Record_string__before_string_or_null__after_string_or_null___value::unsetBefore()
 {
-    m_Before.reset();
+    m_FieldsSet.reset(FieldBit_Before);
 }
 
 }
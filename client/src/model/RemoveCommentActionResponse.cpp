@@ -20,10 +20,6 @@ namespace model {
 
 RemoveCommentActionResponse::RemoveCommentActionResponse()
 {
-    m_Status = utility::conversions::to_string_t("");
-    m_StatusIsSet = false;
-    m_Action = utility::conversions::to_string_t("");
-    m_ActionIsSet = false;
 }
 
 RemoveCommentActionResponse::~RemoveCommentActionResponse()
@@ -38,12 +34,12 @@ void RemoveCommentActionResponse::validate()
 web::json::value RemoveCommentActionResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ActionIsSet)
+    if(m_FieldsSet.test(FieldBit_Action))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("action"))] = ModelBase::toJson(m_Action);
@@ -52,32 +48,119 @@ web::json::value RemoveCommentActionResponse::toJson() const
     return val;
 }
 
+void RemoveCommentActionResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Action))
+    {
+        
+        writer.key(_XPLATSTR("action"));
+        ModelBase::writeJson(writer, m_Action);
+    }
+
+    writer.endObject();
+}
+
 bool RemoveCommentActionResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("action")):
+            if(field.first == _XPLATSTR("action"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAction;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAction);
+                    setAction(refVal_setAction);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("action"))))
+    return ok;
+}
+
+void RemoveCommentActionResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("action")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Action))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("action")), m_Action);
+    }
+}
+
+bool RemoveCommentActionResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setAction;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAction);
-            setAction(refVal_setAction);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("action")):
+            {
+                utility::string_t refVal_setAction;
+                if(!ModelBase::readBinary(reader, field, refVal_setAction))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAction(refVal_setAction);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void RemoveCommentActionResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -87,11 +170,11 @@ void RemoveCommentActionResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ActionIsSet)
+    if(m_FieldsSet.test(FieldBit_Action))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("action")), m_Action));
     }
@@ -131,17 +214,17 @@ utility::string_t RemoveCommentActionResponse::getStatus() const
 void RemoveCommentActionResponse::setStatus(const utility::string_t& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool RemoveCommentActionResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void RemoveCommentActionResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t RemoveCommentActionResponse::getAction() const
 {
@@ -152,17 +235,17 @@ utility::string_t RemoveCommentActionResponse::getAction() const
 void RemoveCommentActionResponse::setAction(const utility::string_t& value)
 {
     m_Action = value;
-    m_ActionIsSet = true;
+    m_FieldsSet.set(FieldBit_Action);
 }
 
 bool RemoveCommentActionResponse::actionIsSet() const
 {
-    return m_ActionIsSet;
+    return m_FieldsSet.test(FieldBit_Action);
 }
 
 void RemoveCommentActionResponse::unsetAction()
 {
-    m_ActionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Action);
 }
 
 }
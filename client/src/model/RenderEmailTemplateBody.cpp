@@ -20,12 +20,6 @@ namespace model {
 
 RenderEmailTemplateBody::RenderEmailTemplateBody()
 {
-    m_EmailTemplateId = utility::conversions::to_string_t("");
-    m_EmailTemplateIdIsSet = false;
-    m_Ejs = utility::conversions::to_string_t("");
-    m_EjsIsSet = false;
-    m_TestDataIsSet = false;
-    m_TranslationOverridesByLocaleIsSet = false;
 }
 
 RenderEmailTemplateBody::~RenderEmailTemplateBody()
@@ -40,22 +34,22 @@ void RenderEmailTemplateBody::validate()
 web::json::value RenderEmailTemplateBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))] = ModelBase::toJson(m_EmailTemplateId);
     }
-    if(m_EjsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ejs"))] = ModelBase::toJson(m_Ejs);
     }
-    if(m_TestDataIsSet)
+    if(m_FieldsSet.test(FieldBit_TestData))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("testData"))] = ModelBase::toJson(m_TestData);
     }
-    if(m_TranslationOverridesByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale"))] = ModelBase::toJson(m_TranslationOverridesByLocale);
@@ -64,54 +58,187 @@ web::json::value RenderEmailTemplateBody::toJson() const
     return val;
 }
 
+void RenderEmailTemplateBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
+    {
+        
+        writer.key(_XPLATSTR("emailTemplateId"));
+        ModelBase::writeJson(writer, m_EmailTemplateId);
+    }
+    if(m_FieldsSet.test(FieldBit_Ejs))
+    {
+        
+        writer.key(_XPLATSTR("ejs"));
+        ModelBase::writeJson(writer, m_Ejs);
+    }
+    if(m_FieldsSet.test(FieldBit_TestData))
+    {
+        
+        writer.key(_XPLATSTR("testData"));
+        ModelBase::writeJson(writer, m_TestData);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
+    {
+        
+        writer.key(_XPLATSTR("translationOverridesByLocale"));
+        ModelBase::writeJson(writer, m_TranslationOverridesByLocale);
+    }
+
+    writer.endObject();
+}
+
 bool RenderEmailTemplateBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmailTemplateId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
-            setEmailTemplateId(refVal_setEmailTemplateId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ejs"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ejs")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setEjs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEjs);
-            setEjs(refVal_setEjs);
-            
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            if(field.first == _XPLATSTR("emailTemplateId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailTemplateId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
+                    setEmailTemplateId(refVal_setEmailTemplateId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ejs")):
+            if(field.first == _XPLATSTR("ejs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEjs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEjs);
+                    setEjs(refVal_setEjs);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("testData")):
+            if(field.first == _XPLATSTR("testData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setTestData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTestData);
+                    setTestData(refVal_setTestData);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")):
+            if(field.first == _XPLATSTR("translationOverridesByLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslationOverridesByLocale);
+                    setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("testData"))))
+    return ok;
+}
+
+void RenderEmailTemplateBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("testData")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setTestData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTestData);
-            setTestData(refVal_setTestData);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailTemplateId")), m_EmailTemplateId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale"))))
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ejs")), m_Ejs);
+    }
+    if(m_FieldsSet.test(FieldBit_TestData))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("testData")), m_TestData);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")), m_TranslationOverridesByLocale);
+    }
+}
+
+bool RenderEmailTemplateBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslationOverridesByLocale);
-            setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
-            
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            {
+                utility::string_t refVal_setEmailTemplateId;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailTemplateId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailTemplateId(refVal_setEmailTemplateId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ejs")):
+            {
+                utility::string_t refVal_setEjs;
+                if(!ModelBase::readBinary(reader, field, refVal_setEjs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEjs(refVal_setEjs);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("testData")):
+            {
+                std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setTestData;
+                if(!ModelBase::readBinary(reader, field, refVal_setTestData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTestData(refVal_setTestData);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")):
+            {
+                std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslationOverridesByLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void RenderEmailTemplateBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -121,19 +248,19 @@ void RenderEmailTemplateBody::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")), m_EmailTemplateId));
     }
-    if(m_EjsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ejs")), m_Ejs));
     }
-    if(m_TestDataIsSet)
+    if(m_FieldsSet.test(FieldBit_TestData))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("testData")), m_TestData));
     }
-    if(m_TranslationOverridesByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale")), m_TranslationOverridesByLocale));
     }
@@ -185,17 +312,17 @@ utility::string_t RenderEmailTemplateBody::getEmailTemplateId() const
 void RenderEmailTemplateBody::setEmailTemplateId(const utility::string_t& value)
 {
     m_EmailTemplateId = value;
-    m_EmailTemplateIdIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailTemplateId);
 }
 
 bool RenderEmailTemplateBody::emailTemplateIdIsSet() const
 {
-    return m_EmailTemplateIdIsSet;
+    return m_FieldsSet.test(FieldBit_EmailTemplateId);
 }
 
 void RenderEmailTemplateBody::unsetEmailTemplateId()
 {
-    m_EmailTemplateIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailTemplateId);
 }
 utility::string_t RenderEmailTemplateBody::getEjs() const
 {
@@ -206,17 +333,17 @@ utility::string_t RenderEmailTemplateBody::getEjs() const
 void RenderEmailTemplateBody::setEjs(const utility::string_t& value)
 {
     m_Ejs = value;
-    m_EjsIsSet = true;
+    m_FieldsSet.set(FieldBit_Ejs);
 }
 
 bool RenderEmailTemplateBody::ejsIsSet() const
 {
-    return m_EjsIsSet;
+    return m_FieldsSet.test(FieldBit_Ejs);
 }
 
 void RenderEmailTemplateBody::unsetEjs()
 {
-    m_EjsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ejs);
 }
 std::map<utility::string_t, std::shared_ptr<AnyType>> RenderEmailTemplateBody::getTestData() const
 {
@@ -227,17 +354,17 @@ std::map<utility::string_t, std::shared_ptr<AnyType>> RenderEmailTemplateBody::g
 void RenderEmailTemplateBody::setTestData(const std::map<utility::string_t, std::shared_ptr<AnyType>>& value)
 {
     m_TestData = value;
-    m_TestDataIsSet = true;
+    m_FieldsSet.set(FieldBit_TestData);
 }
 
 bool RenderEmailTemplateBody::testDataIsSet() const
 {
-    return m_TestDataIsSet;
+    return m_FieldsSet.test(FieldBit_TestData);
 }
 
 void RenderEmailTemplateBody::unsetTestData()
 {
-    m_TestDataIsSet = false;
+    m_FieldsSet.reset(FieldBit_TestData);
 }
 std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> RenderEmailTemplateBody::getTranslationOverridesByLocale() const
 {
@@ -248,17 +375,17 @@ std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> Rend
 void RenderEmailTemplateBody::setTranslationOverridesByLocale(const std::map<utility::string_t, std::map<utility::string_t, utility::string_t>>& value)
 {
     m_TranslationOverridesByLocale = value;
-    m_TranslationOverridesByLocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_TranslationOverridesByLocale);
 }
 
 bool RenderEmailTemplateBody::translationOverridesByLocaleIsSet() const
 {
-    return m_TranslationOverridesByLocaleIsSet;
+    return m_FieldsSet.test(FieldBit_TranslationOverridesByLocale);
 }
 
 void RenderEmailTemplateBody::unsetTranslationOverridesByLocale()
 {
-    m_TranslationOverridesByLocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_TranslationOverridesByLocale);
 }
 
 }
@@ -20,9 +20,6 @@ namespace model {
 
 RenderEmailTemplateResponse::RenderEmailTemplateResponse()
 {
-    m_StatusIsSet = false;
-    m_Html = utility::conversions::to_string_t("");
-    m_HtmlIsSet = false;
 }
 
 RenderEmailTemplateResponse::~RenderEmailTemplateResponse()
@@ -37,12 +34,12 @@ void RenderEmailTemplateResponse::validate()
 web::json::value RenderEmailTemplateResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_HtmlIsSet)
+    if(m_FieldsSet.test(FieldBit_Html))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("html"))] = ModelBase::toJson(m_Html);
@@ -51,32 +48,119 @@ web::json::value RenderEmailTemplateResponse::toJson() const
     return val;
 }
 
+void RenderEmailTemplateResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Html))
+    {
+        
+        writer.key(_XPLATSTR("html"));
+        ModelBase::writeJson(writer, m_Html);
+    }
+
+    writer.endObject();
+}
+
 bool RenderEmailTemplateResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("html")):
+            if(field.first == _XPLATSTR("html"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setHtml;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHtml);
+                    setHtml(refVal_setHtml);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("html"))))
+    return ok;
+}
+
+void RenderEmailTemplateResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("html")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Html))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("html")), m_Html);
+    }
+}
+
+bool RenderEmailTemplateResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setHtml;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHtml);
-            setHtml(refVal_setHtml);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("html")):
+            {
+                utility::string_t refVal_setHtml;
+                if(!ModelBase::readBinary(reader, field, refVal_setHtml))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHtml(refVal_setHtml);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void RenderEmailTemplateResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void RenderEmailTemplateResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_HtmlIsSet)
+    if(m_FieldsSet.test(FieldBit_Html))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("html")), m_Html));
     }
@@ -130,17 +214,17 @@ std::shared_ptr<APIStatus> RenderEmailTemplateResponse::getStatus() const
 void RenderEmailTemplateResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool RenderEmailTemplateResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void RenderEmailTemplateResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t RenderEmailTemplateResponse::getHtml() const
 {
@@ -151,17 +235,17 @@ utility::string_t RenderEmailTemplateResponse::getHtml() const
 void RenderEmailTemplateResponse::setHtml(const utility::string_t& value)
 {
     m_Html = value;
-    m_HtmlIsSet = true;
+    m_FieldsSet.set(FieldBit_Html);
 }
 
 bool RenderEmailTemplateResponse::htmlIsSet() const
 {
-    return m_HtmlIsSet;
+    return m_FieldsSet.test(FieldBit_Html);
 }
 
 void RenderEmailTemplateResponse::unsetHtml()
 {
-    m_HtmlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Html);
 }
 
 }
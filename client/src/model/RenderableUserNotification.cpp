@@ -20,33 +20,8 @@ namespace model {
 
 RenderableUserNotification::RenderableUserNotification()
 {
-    m_ConversationId = utility::conversions::to_string_t("");
-    m_ConversationIdIsSet = false;
-    m_ContextHTML = utility::conversions::to_string_t("");
-    m_ContextHTMLIsSet = false;
-    m_FromUserNamesIsSet = false;
-    m_FromUserIdsIsSet = false;
-    m_RelatedIdsIsSet = false;
     m_Count = 0L;
-    m_CountIsSet = false;
     m_OptedOut = false;
-    m_OptedOutIsSet = false;
-    m_TypeIsSet = false;
-    m_CreatedAt = utility::conversions::to_string_t("");
-    m_CreatedAtIsSet = false;
-    m_Sent = utility::conversions::to_string_t("");
-    m_SentIsSet = false;
-    m_Viewed = utility::conversions::to_string_t("");
-    m_ViewedIsSet = false;
-    m_RelatedObjectId = utility::conversions::to_string_t("");
-    m_RelatedObjectIdIsSet = false;
-    m_RelatedObjectTypeIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
 }
 
 RenderableUserNotification::~RenderableUserNotification()
@@ -61,107 +36,107 @@ void RenderableUserNotification::validate()
 web::json::value RenderableUserNotification::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ConversationIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ConversationId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("conversationId"))] = ModelBase::toJson(m_ConversationId);
     }
-    if(m_ContextHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContextHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("contextHTML"))] = ModelBase::toJson(m_ContextHTML);
     }
-    if(m_FromUserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromUserNames"))] = ModelBase::toJson(m_FromUserNames);
     }
-    if(m_FromUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromUserIds"))] = ModelBase::toJson(m_FromUserIds);
     }
-    if(m_RelatedIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("relatedIds"))] = ModelBase::toJson(m_RelatedIds);
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("count"))] = ModelBase::toJson(m_Count);
     }
-    if(m_OptedOutIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedOut"))] = ModelBase::toJson(m_OptedOut);
     }
-    if(m_FromUserAvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc"))] = ModelBase::toJson(m_FromUserAvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc"))] = ModelBase::toJson(m_FromUserAvatarSrc);
     }
-    if(m_FromUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserId"))] = ModelBase::toJson(m_FromUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserId"))] = ModelBase::toJson(m_FromUserId);
     }
-    if(m_FromUserName.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserName))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserName"))] = ModelBase::toJson(m_FromUserName.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserName"))] = ModelBase::toJson(m_FromUserName);
     }
-    if(m_FromCommentId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromCommentId"))] = ModelBase::toJson(m_FromCommentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromCommentId"))] = ModelBase::toJson(m_FromCommentId);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_SentIsSet)
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sent"))] = ModelBase::toJson(m_Sent);
     }
-    if(m_ViewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("viewed"))] = ModelBase::toJson(m_Viewed);
     }
-    if(m_RelatedObjectIdIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("relatedObjectId"))] = ModelBase::toJson(m_RelatedObjectId);
     }
-    if(m_RelatedObjectTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("relatedObjectType"))] = ModelBase::toJson(m_RelatedObjectType);
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
@@ -170,241 +145,765 @@ web::json::value RenderableUserNotification::toJson() const
     return val;
 }
 
+void RenderableUserNotification::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_ConversationId))
+    {
+        
+        writer.key(_XPLATSTR("conversationId"));
+        ModelBase::writeJson(writer, m_ConversationId);
+    }
+    if(m_FieldsSet.test(FieldBit_ContextHTML))
+    {
+        
+        writer.key(_XPLATSTR("contextHTML"));
+        ModelBase::writeJson(writer, m_ContextHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
+    {
+        
+        writer.key(_XPLATSTR("fromUserNames"));
+        ModelBase::writeJson(writer, m_FromUserNames);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
+    {
+        
+        writer.key(_XPLATSTR("fromUserIds"));
+        ModelBase::writeJson(writer, m_FromUserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
+    {
+        
+        writer.key(_XPLATSTR("relatedIds"));
+        ModelBase::writeJson(writer, m_RelatedIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Count))
+    {
+        
+        writer.key(_XPLATSTR("count"));
+        ModelBase::writeJson(writer, m_Count);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedOut))
+    {
+        
+        writer.key(_XPLATSTR("optedOut"));
+        ModelBase::writeJson(writer, m_OptedOut);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("fromUserAvatarSrc"));
+        ModelBase::writeJson(writer, m_FromUserAvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserId))
+    {
+        
+        writer.key(_XPLATSTR("fromUserId"));
+        ModelBase::writeJson(writer, m_FromUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserName))
+    {
+        
+        writer.key(_XPLATSTR("fromUserName"));
+        ModelBase::writeJson(writer, m_FromUserName);
+    }
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
+    {
+        
+        writer.key(_XPLATSTR("fromCommentId"));
+        ModelBase::writeJson(writer, m_FromCommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Sent))
+    {
+        
+        writer.key(_XPLATSTR("sent"));
+        ModelBase::writeJson(writer, m_Sent);
+    }
+    if(m_FieldsSet.test(FieldBit_Viewed))
+    {
+        
+        writer.key(_XPLATSTR("viewed"));
+        ModelBase::writeJson(writer, m_Viewed);
+    }
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
+    {
+        
+        writer.key(_XPLATSTR("relatedObjectId"));
+        ModelBase::writeJson(writer, m_RelatedObjectId);
+    }
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
+    {
+        
+        writer.key(_XPLATSTR("relatedObjectType"));
+        ModelBase::writeJson(writer, m_RelatedObjectType);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+
+    writer.endObject();
+}
+
 bool RenderableUserNotification::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("conversationId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("conversationId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setConversationId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setConversationId);
-            setConversationId(refVal_setConversationId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("contextHTML"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("contextHTML")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setContextHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setContextHTML);
-            setContextHTML(refVal_setContextHTML);
-            
+        case ModelBase::fieldHash(_XPLATSTR("conversationId")):
+            if(field.first == _XPLATSTR("conversationId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setConversationId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setConversationId);
+                    setConversationId(refVal_setConversationId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("contextHTML")):
+            if(field.first == _XPLATSTR("contextHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setContextHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setContextHTML);
+                    setContextHTML(refVal_setContextHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserNames")):
+            if(field.first == _XPLATSTR("fromUserNames"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFromUserNames;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserNames);
+                    setFromUserNames(refVal_setFromUserNames);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserIds")):
+            if(field.first == _XPLATSTR("fromUserIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFromUserIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserIds);
+                    setFromUserIds(refVal_setFromUserIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("relatedIds")):
+            if(field.first == _XPLATSTR("relatedIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setRelatedIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedIds);
+                    setRelatedIds(refVal_setRelatedIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            if(field.first == _XPLATSTR("count"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
+                    setCount(refVal_setCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedOut")):
+            if(field.first == _XPLATSTR("optedOut"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedOut;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedOut);
+                    setOptedOut(refVal_setOptedOut);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserAvatarSrc")):
+            if(field.first == _XPLATSTR("fromUserAvatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserAvatarSrc);
+                    setFromUserAvatarSrc(refVal_setFromUserAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            if(field.first == _XPLATSTR("fromUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
+                    setFromUserId(refVal_setFromUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserName")):
+            if(field.first == _XPLATSTR("fromUserName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserName);
+                    setFromUserName(refVal_setFromUserName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromCommentId")):
+            if(field.first == _XPLATSTR("fromCommentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromCommentId);
+                    setFromCommentId(refVal_setFromCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<NotificationType> refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sent")):
+            if(field.first == _XPLATSTR("sent"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSent;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSent);
+                    setSent(refVal_setSent);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("viewed")):
+            if(field.first == _XPLATSTR("viewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setViewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setViewed);
+                    setViewed(refVal_setViewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectId")):
+            if(field.first == _XPLATSTR("relatedObjectId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setRelatedObjectId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectId);
+                    setRelatedObjectId(refVal_setRelatedObjectId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectType")):
+            if(field.first == _XPLATSTR("relatedObjectType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<NotificationObjectType> refVal_setRelatedObjectType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectType);
+                    setRelatedObjectType(refVal_setRelatedObjectType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPageTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
+                    setPageTitle(refVal_setPageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserNames"))))
+    return ok;
+}
+
+void RenderableUserNotification::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_ConversationId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserNames")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFromUserNames;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserNames);
-            setFromUserNames(refVal_setFromUserNames);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("conversationId")), m_ConversationId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserIds"))))
+    if(m_FieldsSet.test(FieldBit_ContextHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFromUserIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserIds);
-            setFromUserIds(refVal_setFromUserIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("contextHTML")), m_ContextHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("relatedIds"))))
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("relatedIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setRelatedIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedIds);
-            setRelatedIds(refVal_setRelatedIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserNames")), m_FromUserNames);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("count"))))
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("count")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
-            setCount(refVal_setCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserIds")), m_FromUserIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedOut"))))
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedOut")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedOut;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedOut);
-            setOptedOut(refVal_setOptedOut);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("relatedIds")), m_RelatedIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_Count))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserAvatarSrc);
-            setFromUserAvatarSrc(refVal_setFromUserAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("count")), m_Count);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserId"))))
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
-            setFromUserId(refVal_setFromUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedOut")), m_OptedOut);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserName"))))
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserName);
-            setFromUserName(refVal_setFromUserName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserAvatarSrc")), m_FromUserAvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromCommentId"))))
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromCommentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromCommentId);
-            setFromCommentId(refVal_setFromCommentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserId")), m_FromUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_FromUserName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<NotificationType> refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserName")), m_FromUserName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromCommentId")), m_FromCommentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sent"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sent")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSent;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSent);
-            setSent(refVal_setSent);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("viewed"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("viewed")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setViewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setViewed);
-            setViewed(refVal_setViewed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("relatedObjectId"))))
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("relatedObjectId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setRelatedObjectId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectId);
-            setRelatedObjectId(refVal_setRelatedObjectId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sent")), m_Sent);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("relatedObjectType"))))
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("relatedObjectType")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<NotificationObjectType> refVal_setRelatedObjectType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectType);
-            setRelatedObjectType(refVal_setRelatedObjectType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("viewed")), m_Viewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("relatedObjectId")), m_RelatedObjectId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("relatedObjectType")), m_RelatedObjectType);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
+    }
+}
+
+bool RenderableUserNotification::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("conversationId")):
+            {
+                utility::string_t refVal_setConversationId;
+                if(!ModelBase::readBinary(reader, field, refVal_setConversationId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setConversationId(refVal_setConversationId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("contextHTML")):
+            {
+                utility::string_t refVal_setContextHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setContextHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setContextHTML(refVal_setContextHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserNames")):
+            {
+                std::vector<utility::string_t> refVal_setFromUserNames;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserNames))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserNames(refVal_setFromUserNames);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserIds")):
+            {
+                std::vector<utility::string_t> refVal_setFromUserIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserIds(refVal_setFromUserIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("relatedIds")):
+            {
+                std::vector<utility::string_t> refVal_setRelatedIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setRelatedIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRelatedIds(refVal_setRelatedIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            {
+                int64_t refVal_setCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCount(refVal_setCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedOut")):
+            {
+                bool refVal_setOptedOut;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedOut))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedOut(refVal_setOptedOut);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserAvatarSrc")):
+            {
+                utility::string_t refVal_setFromUserAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserAvatarSrc(refVal_setFromUserAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            {
+                utility::string_t refVal_setFromUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserId(refVal_setFromUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserName")):
+            {
+                utility::string_t refVal_setFromUserName;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserName(refVal_setFromUserName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromCommentId")):
+            {
+                utility::string_t refVal_setFromCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromCommentId(refVal_setFromCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                std::shared_ptr<NotificationType> refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::string_t refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sent")):
+            {
+                utility::string_t refVal_setSent;
+                if(!ModelBase::readBinary(reader, field, refVal_setSent))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSent(refVal_setSent);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("viewed")):
+            {
+                utility::string_t refVal_setViewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setViewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setViewed(refVal_setViewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectId")):
+            {
+                utility::string_t refVal_setRelatedObjectId;
+                if(!ModelBase::readBinary(reader, field, refVal_setRelatedObjectId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRelatedObjectId(refVal_setRelatedObjectId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectType")):
+            {
+                std::shared_ptr<NotificationObjectType> refVal_setRelatedObjectType;
+                if(!ModelBase::readBinary(reader, field, refVal_setRelatedObjectType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRelatedObjectType(refVal_setRelatedObjectType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                utility::string_t refVal_setPageTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageTitle(refVal_setPageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void RenderableUserNotification::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -414,87 +913,87 @@ void RenderableUserNotification::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ConversationIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ConversationId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("conversationId")), m_ConversationId));
     }
-    if(m_ContextHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContextHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("contextHTML")), m_ContextHTML));
     }
-    if(m_FromUserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserNames")), m_FromUserNames));
     }
-    if(m_FromUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserIds")), m_FromUserIds));
     }
-    if(m_RelatedIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("relatedIds")), m_RelatedIds));
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("count")), m_Count));
     }
-    if(m_OptedOutIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedOut")), m_OptedOut));
     }
-    if(m_FromUserAvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc")), m_FromUserAvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc")), m_FromUserAvatarSrc));
     }
-    if(m_FromUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserId")), m_FromUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserId")), m_FromUserId));
     }
-    if(m_FromUserName.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserName))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserName")), m_FromUserName.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserName")), m_FromUserName));
     }
-    if(m_FromCommentId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromCommentId")), m_FromCommentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromCommentId")), m_FromCommentId));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_SentIsSet)
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sent")), m_Sent));
     }
-    if(m_ViewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewed")), m_Viewed));
     }
-    if(m_RelatedObjectIdIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("relatedObjectId")), m_RelatedObjectId));
     }
-    if(m_RelatedObjectTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("relatedObjectType")), m_RelatedObjectType));
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
@@ -648,17 +1147,17 @@ utility::string_t RenderableUserNotification::getConversationId() const
 void RenderableUserNotification::setConversationId(const utility::string_t& value)
 {
     m_ConversationId = value;
-    m_ConversationIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ConversationId);
 }
 
 bool RenderableUserNotification::conversationIdIsSet() const
 {
-    return m_ConversationIdIsSet;
+    return m_FieldsSet.test(FieldBit_ConversationId);
 }
 
 void RenderableUserNotification::unsetConversationId()
 {
-    m_ConversationIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ConversationId);
 }
 utility::string_t RenderableUserNotification::getContextHTML() const
 {
@@ -669,17 +1168,17 @@ utility::string_t RenderableUserNotification::getContextHTML() const
 void RenderableUserNotification::setContextHTML(const utility::string_t& value)
 {
     m_ContextHTML = value;
-    m_ContextHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_ContextHTML);
 }
 
 bool RenderableUserNotification::contextHTMLIsSet() const
 {
-    return m_ContextHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_ContextHTML);
 }
 
 void RenderableUserNotification::unsetContextHTML()
 {
-    m_ContextHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_ContextHTML);
 }
 std::vector<utility::string_t> RenderableUserNotification::getFromUserNames() const
 {
@@ -690,17 +1189,17 @@ std::vector<utility::string_t> RenderableUserNotification::getFromUserNames() co
 void RenderableUserNotification::setFromUserNames(const std::vector<utility::string_t>& value)
 {
     m_FromUserNames = value;
-    m_FromUserNamesIsSet = true;
+    m_FieldsSet.set(FieldBit_FromUserNames);
 }
 
 bool RenderableUserNotification::fromUserNamesIsSet() const
 {
-    return m_FromUserNamesIsSet;
+    return m_FieldsSet.test(FieldBit_FromUserNames);
 }
 
 void RenderableUserNotification::unsetFromUserNames()
 {
-    m_FromUserNamesIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromUserNames);
 }
 std::vector<utility::string_t> RenderableUserNotification::getFromUserIds() const
 {
@@ -711,17 +1210,17 @@ std::vector<utility::string_t> RenderableUserNotification::getFromUserIds() cons
 void RenderableUserNotification::setFromUserIds(const std::vector<utility::string_t>& value)
 {
     m_FromUserIds = value;
-    m_FromUserIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FromUserIds);
 }
 
 bool RenderableUserNotification::fromUserIdsIsSet() const
 {
-    return m_FromUserIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FromUserIds);
 }
 
 void RenderableUserNotification::unsetFromUserIds()
 {
-    m_FromUserIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromUserIds);
 }
 std::vector<utility::string_t> RenderableUserNotification::getRelatedIds() const
 {
@@ -732,17 +1231,17 @@ std::vector<utility::string_t> RenderableUserNotification::getRelatedIds() const
 void RenderableUserNotification::setRelatedIds(const std::vector<utility::string_t>& value)
 {
     m_RelatedIds = value;
-    m_RelatedIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_RelatedIds);
 }
 
 bool RenderableUserNotification::relatedIdsIsSet() const
 {
-    return m_RelatedIdsIsSet;
+    return m_FieldsSet.test(FieldBit_RelatedIds);
 }
 
 void RenderableUserNotification::unsetRelatedIds()
 {
-    m_RelatedIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_RelatedIds);
 }
 int64_t RenderableUserNotification::getCount() const
 {
@@ -752,17 +1251,17 @@ int64_t RenderableUserNotification::getCount() const
 void RenderableUserNotification::setCount(int64_t value)
 {
     m_Count = value;
-    m_CountIsSet = true;
+    m_FieldsSet.set(FieldBit_Count);
 }
 
 bool RenderableUserNotification::countIsSet() const
 {
-    return m_CountIsSet;
+    return m_FieldsSet.test(FieldBit_Count);
 }
 
 void RenderableUserNotification::unsetCount()
 {
-    m_CountIsSet = false;
+    m_FieldsSet.reset(FieldBit_Count);
 }
 bool RenderableUserNotification::isOptedOut() const
 {
@@ -772,97 +1271,101 @@ bool RenderableUserNotification::isOptedOut() const
 void RenderableUserNotification::setOptedOut(bool value)
 {
     m_OptedOut = value;
-    m_OptedOutIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedOut);
 }
 
 bool RenderableUserNotification::optedOutIsSet() const
 {
-    return m_OptedOutIsSet;
+    return m_FieldsSet.test(FieldBit_OptedOut);
 }
 
 void RenderableUserNotification::unsetOptedOut()
 {
-    m_OptedOutIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedOut);
 }
 utility::string_t RenderableUserNotification::getFromUserAvatarSrc() const
 {
-    return m_FromUserAvatarSrc.get();
+    return m_FromUserAvatarSrc;
 }
 
 
 void RenderableUserNotification::setFromUserAvatarSrc(const utility::string_t& value)
 {
     m_FromUserAvatarSrc = value;
+    m_FieldsSet.set(FieldBit_FromUserAvatarSrc);
 }
 
 bool RenderableUserNotification::fromUserAvatarSrcIsSet() const
 {
-    return m_FromUserAvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserAvatarSrc);
 }
 
 void RenderableUserNotification::unsetFromUserAvatarSrc()
 {
-    m_FromUserAvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_FromUserAvatarSrc);
 }
 utility::string_t RenderableUserNotification::getFromUserId() const
 {
-    return m_FromUserId.get();
+    return m_FromUserId;
 }
 
 
 void RenderableUserNotification::setFromUserId(const utility::string_t& value)
 {
     m_FromUserId = value;
+    m_FieldsSet.set(FieldBit_FromUserId);
 }
 
 bool RenderableUserNotification::fromUserIdIsSet() const
 {
-    return m_FromUserId.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserId);
 }
 
 void RenderableUserNotification::unsetFromUserId()
 {
-    m_FromUserId.reset();
+    m_FieldsSet.reset(FieldBit_FromUserId);
 }
 utility::string_t RenderableUserNotification::getFromUserName() const
 {
-    return m_FromUserName.get();
+    return m_FromUserName;
 }
 
 
 void RenderableUserNotification::setFromUserName(const utility::string_t& value)
 {
     m_FromUserName = value;
+    m_FieldsSet.set(FieldBit_FromUserName);
 }
 
 bool RenderableUserNotification::fromUserNameIsSet() const
 {
-    return m_FromUserName.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserName);
 }
 
 void RenderableUserNotification::unsetFromUserName()
 {
-    m_FromUserName.reset();
+    m_FieldsSet.reset(FieldBit_FromUserName);
 }
 utility::string_t RenderableUserNotification::getFromCommentId() const
 {
-    return m_FromCommentId.get();
+    return m_FromCommentId;
 }
 
 
 void RenderableUserNotification::setFromCommentId(const utility::string_t& value)
 {
     m_FromCommentId = value;
+    m_FieldsSet.set(FieldBit_FromCommentId);
 }
 
 bool RenderableUserNotification::fromCommentIdIsSet() const
 {
-    return m_FromCommentId.has_value();
+    return m_FieldsSet.test(FieldBit_FromCommentId);
 }
 
 void RenderableUserNotification::unsetFromCommentId()
 {
-    m_FromCommentId.reset();
+    m_FieldsSet.reset(FieldBit_FromCommentId);
 }
 std::shared_ptr<NotificationType> RenderableUserNotification::getType() const
 {
@@ -873,17 +1376,17 @@ std::shared_ptr<NotificationType> RenderableUserNotification::getType() const
 void RenderableUserNotification::setType(const std::shared_ptr<NotificationType>& value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool RenderableUserNotification::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void RenderableUserNotification::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 utility::string_t RenderableUserNotification::getCreatedAt() const
 {
@@ -894,17 +1397,17 @@ utility::string_t RenderableUserNotification::getCreatedAt() const
 void RenderableUserNotification::setCreatedAt(const utility::string_t& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool RenderableUserNotification::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void RenderableUserNotification::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t RenderableUserNotification::getSent() const
 {
@@ -915,17 +1418,17 @@ utility::string_t RenderableUserNotification::getSent() const
 void RenderableUserNotification::setSent(const utility::string_t& value)
 {
     m_Sent = value;
-    m_SentIsSet = true;
+    m_FieldsSet.set(FieldBit_Sent);
 }
 
 bool RenderableUserNotification::sentIsSet() const
 {
-    return m_SentIsSet;
+    return m_FieldsSet.test(FieldBit_Sent);
 }
 
 void RenderableUserNotification::unsetSent()
 {
-    m_SentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sent);
 }
 utility::string_t RenderableUserNotification::getViewed() const
 {
@@ -936,17 +1439,17 @@ utility::string_t RenderableUserNotification::getViewed() const
 void RenderableUserNotification::setViewed(const utility::string_t& value)
 {
     m_Viewed = value;
-    m_ViewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Viewed);
 }
 
 bool RenderableUserNotification::viewedIsSet() const
 {
-    return m_ViewedIsSet;
+    return m_FieldsSet.test(FieldBit_Viewed);
 }
 
 void RenderableUserNotification::unsetViewed()
 {
-    m_ViewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Viewed);
 }
 utility::string_t RenderableUserNotification::getRelatedObjectId() const
 {
@@ -957,17 +1460,17 @@ utility::string_t RenderableUserNotification::getRelatedObjectId() const
 void RenderableUserNotification::setRelatedObjectId(const utility::string_t& value)
 {
     m_RelatedObjectId = value;
-    m_RelatedObjectIdIsSet = true;
+    m_FieldsSet.set(FieldBit_RelatedObjectId);
 }
 
 bool RenderableUserNotification::relatedObjectIdIsSet() const
 {
-    return m_RelatedObjectIdIsSet;
+    return m_FieldsSet.test(FieldBit_RelatedObjectId);
 }
 
 void RenderableUserNotification::unsetRelatedObjectId()
 {
-    m_RelatedObjectIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_RelatedObjectId);
 }
 std::shared_ptr<NotificationObjectType> RenderableUserNotification::getRelatedObjectType() const
 {
@@ -978,37 +1481,38 @@ std::shared_ptr<NotificationObjectType> RenderableUserNotification::getRelatedOb
 void RenderableUserNotification::setRelatedObjectType(const std::shared_ptr<NotificationObjectType>& value)
 {
     m_RelatedObjectType = value;
-    m_RelatedObjectTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_RelatedObjectType);
 }
 
 bool RenderableUserNotification::relatedObjectTypeIsSet() const
 {
-    return m_RelatedObjectTypeIsSet;
+    return m_FieldsSet.test(FieldBit_RelatedObjectType);
 }
 
 void RenderableUserNotification::unsetRelatedObjectType()
 {
-    m_RelatedObjectTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_RelatedObjectType);
 }
 utility::string_t RenderableUserNotification::getPageTitle() const
 {
-    return m_PageTitle.get();
+    return m_PageTitle;
 }
 
 
 void RenderableUserNotification::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool RenderableUserNotification::pageTitleIsSet() const
 {
-    return m_PageTitle.has_value();
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void RenderableUserNotification::unsetPageTitle()
 {
-    m_PageTitle.reset();
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 utility::string_t RenderableUserNotification::getUrl() const
 {
@@ -1019,17 +1523,17 @@ utility::string_t RenderableUserNotification::getUrl() const
 void RenderableUserNotification::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool RenderableUserNotification::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void RenderableUserNotification::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t RenderableUserNotification::getUrlId() const
 {
@@ -1040,17 +1544,17 @@ utility::string_t RenderableUserNotification::getUrlId() const
 void RenderableUserNotification::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool RenderableUserNotification::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void RenderableUserNotification::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t RenderableUserNotification::getId() const
 {
@@ -1061,17 +1565,17 @@ utility::string_t RenderableUserNotification::getId() const
 void RenderableUserNotification::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool RenderableUserNotification::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void RenderableUserNotification::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 
 }
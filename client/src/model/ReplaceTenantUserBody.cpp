@@ -20,61 +20,24 @@ namespace model {
 
 ReplaceTenantUserBody::ReplaceTenantUserBody()
 {
-    m_Username = utility::conversions::to_string_t("");
-    m_UsernameIsSet = false;
-    m_Email = utility::conversions::to_string_t("");
-    m_EmailIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_WebsiteUrl = utility::conversions::to_string_t("");
-    m_WebsiteUrlIsSet = false;
     m_SignUpDate = 0.0;
-    m_SignUpDateIsSet = false;
-    m_Locale = utility::conversions::to_string_t("");
-    m_LocaleIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
     m_LoginCount = 0.0;
-    m_LoginCountIsSet = false;
     m_OptedInNotifications = false;
-    m_OptedInNotificationsIsSet = false;
     m_OptedInTenantNotifications = false;
-    m_OptedInTenantNotificationsIsSet = false;
     m_HideAccountCode = false;
-    m_HideAccountCodeIsSet = false;
-    m_AvatarSrc = utility::conversions::to_string_t("");
-    m_AvatarSrcIsSet = false;
     m_IsHelpRequestAdmin = false;
-    m_IsHelpRequestAdminIsSet = false;
     m_IsAccountOwner = false;
-    m_IsAccountOwnerIsSet = false;
     m_IsAdminAdmin = false;
-    m_IsAdminAdminIsSet = false;
     m_IsBillingAdmin = false;
-    m_IsBillingAdminIsSet = false;
     m_IsAnalyticsAdmin = false;
-    m_IsAnalyticsAdminIsSet = false;
     m_IsCustomizationAdmin = false;
-    m_IsCustomizationAdminIsSet = false;
     m_IsManageDataAdmin = false;
-    m_IsManageDataAdminIsSet = false;
     m_IsCommentModeratorAdmin = false;
-    m_IsCommentModeratorAdminIsSet = false;
     m_IsAPIAdmin = false;
-    m_IsAPIAdminIsSet = false;
-    m_ModeratorIdsIsSet = false;
     m_DigestEmailFrequency = 0.0;
-    m_DigestEmailFrequencyIsSet = false;
-    m_DisplayLabel = utility::conversions::to_string_t("");
-    m_DisplayLabelIsSet = false;
-    m_CreatedFromUrlId = utility::conversions::to_string_t("");
-    m_CreatedFromUrlIdIsSet = false;
-    m_CreatedFromTenantId = utility::conversions::to_string_t("");
-    m_CreatedFromTenantIdIsSet = false;
     m_LastLoginDate = 0.0;
-    m_LastLoginDateIsSet = false;
     m_Karma = 0.0;
-    m_KarmaIsSet = false;
 }
 
 ReplaceTenantUserBody::~ReplaceTenantUserBody()
@@ -89,142 +52,142 @@ void ReplaceTenantUserBody::validate()
 web::json::value ReplaceTenantUserBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_WebsiteUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))] = ModelBase::toJson(m_WebsiteUrl);
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("signUpDate"))] = ModelBase::toJson(m_SignUpDate);
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_LoginCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("loginCount"))] = ModelBase::toJson(m_LoginCount);
     }
-    if(m_OptedInNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedInNotifications"))] = ModelBase::toJson(m_OptedInNotifications);
     }
-    if(m_OptedInTenantNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications"))] = ModelBase::toJson(m_OptedInTenantNotifications);
     }
-    if(m_HideAccountCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hideAccountCode"))] = ModelBase::toJson(m_HideAccountCode);
     }
-    if(m_AvatarSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_IsHelpRequestAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin"))] = ModelBase::toJson(m_IsHelpRequestAdmin);
     }
-    if(m_IsAccountOwnerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAccountOwner"))] = ModelBase::toJson(m_IsAccountOwner);
     }
-    if(m_IsAdminAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin"))] = ModelBase::toJson(m_IsAdminAdmin);
     }
-    if(m_IsBillingAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin"))] = ModelBase::toJson(m_IsBillingAdmin);
     }
-    if(m_IsAnalyticsAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin"))] = ModelBase::toJson(m_IsAnalyticsAdmin);
     }
-    if(m_IsCustomizationAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin"))] = ModelBase::toJson(m_IsCustomizationAdmin);
     }
-    if(m_IsManageDataAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin"))] = ModelBase::toJson(m_IsManageDataAdmin);
     }
-    if(m_IsCommentModeratorAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin"))] = ModelBase::toJson(m_IsCommentModeratorAdmin);
     }
-    if(m_IsAPIAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin"))] = ModelBase::toJson(m_IsAPIAdmin);
     }
-    if(m_ModeratorIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderatorIds"))] = ModelBase::toJson(m_ModeratorIds);
     }
-    if(m_DigestEmailFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency"))] = ModelBase::toJson(m_DigestEmailFrequency);
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_CreatedFromUrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId"))] = ModelBase::toJson(m_CreatedFromUrlId);
     }
-    if(m_CreatedFromTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId"))] = ModelBase::toJson(m_CreatedFromTenantId);
     }
-    if(m_LastLoginDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastLoginDate"))] = ModelBase::toJson(m_LastLoginDate);
     }
-    if(m_KarmaIsSet)
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("karma"))] = ModelBase::toJson(m_Karma);
@@ -233,318 +196,1003 @@ web::json::value ReplaceTenantUserBody::toJson() const
     return val;
 }
 
+void ReplaceTenantUserBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
+    {
+        
+        writer.key(_XPLATSTR("websiteUrl"));
+        ModelBase::writeJson(writer, m_WebsiteUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
+    {
+        
+        writer.key(_XPLATSTR("signUpDate"));
+        ModelBase::writeJson(writer, m_SignUpDate);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_LoginCount))
+    {
+        
+        writer.key(_XPLATSTR("loginCount"));
+        ModelBase::writeJson(writer, m_LoginCount);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
+    {
+        
+        writer.key(_XPLATSTR("optedInNotifications"));
+        ModelBase::writeJson(writer, m_OptedInNotifications);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
+    {
+        
+        writer.key(_XPLATSTR("optedInTenantNotifications"));
+        ModelBase::writeJson(writer, m_OptedInTenantNotifications);
+    }
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
+    {
+        
+        writer.key(_XPLATSTR("hideAccountCode"));
+        ModelBase::writeJson(writer, m_HideAccountCode);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isHelpRequestAdmin"));
+        ModelBase::writeJson(writer, m_IsHelpRequestAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
+    {
+        
+        writer.key(_XPLATSTR("isAccountOwner"));
+        ModelBase::writeJson(writer, m_IsAccountOwner);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isAdminAdmin"));
+        ModelBase::writeJson(writer, m_IsAdminAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isBillingAdmin"));
+        ModelBase::writeJson(writer, m_IsBillingAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isAnalyticsAdmin"));
+        ModelBase::writeJson(writer, m_IsAnalyticsAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isCustomizationAdmin"));
+        ModelBase::writeJson(writer, m_IsCustomizationAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isManageDataAdmin"));
+        ModelBase::writeJson(writer, m_IsManageDataAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isCommentModeratorAdmin"));
+        ModelBase::writeJson(writer, m_IsCommentModeratorAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isAPIAdmin"));
+        ModelBase::writeJson(writer, m_IsAPIAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
+    {
+        
+        writer.key(_XPLATSTR("moderatorIds"));
+        ModelBase::writeJson(writer, m_ModeratorIds);
+    }
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
+    {
+        
+        writer.key(_XPLATSTR("digestEmailFrequency"));
+        ModelBase::writeJson(writer, m_DigestEmailFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
+    {
+        
+        writer.key(_XPLATSTR("createdFromUrlId"));
+        ModelBase::writeJson(writer, m_CreatedFromUrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
+    {
+        
+        writer.key(_XPLATSTR("createdFromTenantId"));
+        ModelBase::writeJson(writer, m_CreatedFromTenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
+    {
+        
+        writer.key(_XPLATSTR("lastLoginDate"));
+        ModelBase::writeJson(writer, m_LastLoginDate);
+    }
+    if(m_FieldsSet.test(FieldBit_Karma))
+    {
+        
+        writer.key(_XPLATSTR("karma"));
+        ModelBase::writeJson(writer, m_Karma);
+    }
+
+    writer.endObject();
+}
+
 bool ReplaceTenantUserBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            if(field.first == _XPLATSTR("websiteUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWebsiteUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
+                    setWebsiteUrl(refVal_setWebsiteUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            if(field.first == _XPLATSTR("signUpDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setSignUpDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
+                    setSignUpDate(refVal_setSignUpDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("loginCount")):
+            if(field.first == _XPLATSTR("loginCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setLoginCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLoginCount);
+                    setLoginCount(refVal_setLoginCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedInNotifications")):
+            if(field.first == _XPLATSTR("optedInNotifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedInNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInNotifications);
+                    setOptedInNotifications(refVal_setOptedInNotifications);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedInTenantNotifications")):
+            if(field.first == _XPLATSTR("optedInTenantNotifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedInTenantNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInTenantNotifications);
+                    setOptedInTenantNotifications(refVal_setOptedInTenantNotifications);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hideAccountCode")):
+            if(field.first == _XPLATSTR("hideAccountCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHideAccountCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHideAccountCode);
+                    setHideAccountCode(refVal_setHideAccountCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isHelpRequestAdmin")):
+            if(field.first == _XPLATSTR("isHelpRequestAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsHelpRequestAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsHelpRequestAdmin);
+                    setIsHelpRequestAdmin(refVal_setIsHelpRequestAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAccountOwner")):
+            if(field.first == _XPLATSTR("isAccountOwner"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAccountOwner;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAccountOwner);
+                    setIsAccountOwner(refVal_setIsAccountOwner);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")):
+            if(field.first == _XPLATSTR("isAdminAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAdminAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAdminAdmin);
+                    setIsAdminAdmin(refVal_setIsAdminAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isBillingAdmin")):
+            if(field.first == _XPLATSTR("isBillingAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsBillingAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsBillingAdmin);
+                    setIsBillingAdmin(refVal_setIsBillingAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAnalyticsAdmin")):
+            if(field.first == _XPLATSTR("isAnalyticsAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAnalyticsAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAnalyticsAdmin);
+                    setIsAnalyticsAdmin(refVal_setIsAnalyticsAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isCustomizationAdmin")):
+            if(field.first == _XPLATSTR("isCustomizationAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsCustomizationAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsCustomizationAdmin);
+                    setIsCustomizationAdmin(refVal_setIsCustomizationAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isManageDataAdmin")):
+            if(field.first == _XPLATSTR("isManageDataAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsManageDataAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsManageDataAdmin);
+                    setIsManageDataAdmin(refVal_setIsManageDataAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")):
+            if(field.first == _XPLATSTR("isCommentModeratorAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsCommentModeratorAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsCommentModeratorAdmin);
+                    setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAPIAdmin")):
+            if(field.first == _XPLATSTR("isAPIAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAPIAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAPIAdmin);
+                    setIsAPIAdmin(refVal_setIsAPIAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderatorIds")):
+            if(field.first == _XPLATSTR("moderatorIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModeratorIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModeratorIds);
+                    setModeratorIds(refVal_setModeratorIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("digestEmailFrequency")):
+            if(field.first == _XPLATSTR("digestEmailFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setDigestEmailFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDigestEmailFrequency);
+                    setDigestEmailFrequency(refVal_setDigestEmailFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")):
+            if(field.first == _XPLATSTR("createdFromUrlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedFromUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromUrlId);
+                    setCreatedFromUrlId(refVal_setCreatedFromUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromTenantId")):
+            if(field.first == _XPLATSTR("createdFromTenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedFromTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromTenantId);
+                    setCreatedFromTenantId(refVal_setCreatedFromTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastLoginDate")):
+            if(field.first == _XPLATSTR("lastLoginDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setLastLoginDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastLoginDate);
+                    setLastLoginDate(refVal_setLastLoginDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("karma")):
+            if(field.first == _XPLATSTR("karma"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setKarma;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setKarma);
+                    setKarma(refVal_setKarma);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    return ok;
+}
+
+void ReplaceTenantUserBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Username))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("websiteUrl")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWebsiteUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
-            setWebsiteUrl(refVal_setWebsiteUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("signUpDate"))))
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("signUpDate")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setSignUpDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
-            setSignUpDate(refVal_setSignUpDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("websiteUrl")), m_WebsiteUrl);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("signUpDate")), m_SignUpDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("loginCount"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("loginCount")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setLoginCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLoginCount);
-            setLoginCount(refVal_setLoginCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedInNotifications"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedInNotifications")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedInNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInNotifications);
-            setOptedInNotifications(refVal_setOptedInNotifications);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications"))))
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedInTenantNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInTenantNotifications);
-            setOptedInTenantNotifications(refVal_setOptedInTenantNotifications);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("loginCount")), m_LoginCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hideAccountCode"))))
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hideAccountCode")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHideAccountCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHideAccountCode);
-            setHideAccountCode(refVal_setHideAccountCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedInNotifications")), m_OptedInNotifications);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedInTenantNotifications")), m_OptedInTenantNotifications);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin"))))
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsHelpRequestAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsHelpRequestAdmin);
-            setIsHelpRequestAdmin(refVal_setIsHelpRequestAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hideAccountCode")), m_HideAccountCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAccountOwner"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAccountOwner")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAccountOwner;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAccountOwner);
-            setIsAccountOwner(refVal_setIsAccountOwner);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAdminAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAdminAdmin);
-            setIsAdminAdmin(refVal_setIsAdminAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isHelpRequestAdmin")), m_IsHelpRequestAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsBillingAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsBillingAdmin);
-            setIsBillingAdmin(refVal_setIsBillingAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAccountOwner")), m_IsAccountOwner);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAnalyticsAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAnalyticsAdmin);
-            setIsAnalyticsAdmin(refVal_setIsAnalyticsAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")), m_IsAdminAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsCustomizationAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsCustomizationAdmin);
-            setIsCustomizationAdmin(refVal_setIsCustomizationAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isBillingAdmin")), m_IsBillingAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsManageDataAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsManageDataAdmin);
-            setIsManageDataAdmin(refVal_setIsManageDataAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAnalyticsAdmin")), m_IsAnalyticsAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsCommentModeratorAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsCommentModeratorAdmin);
-            setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isCustomizationAdmin")), m_IsCustomizationAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAPIAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAPIAdmin);
-            setIsAPIAdmin(refVal_setIsAPIAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isManageDataAdmin")), m_IsManageDataAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderatorIds"))))
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderatorIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModeratorIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModeratorIds);
-            setModeratorIds(refVal_setModeratorIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")), m_IsCommentModeratorAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency"))))
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setDigestEmailFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDigestEmailFrequency);
-            setDigestEmailFrequency(refVal_setDigestEmailFrequency);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAPIAdmin")), m_IsAPIAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderatorIds")), m_ModeratorIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId"))))
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedFromUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromUrlId);
-            setCreatedFromUrlId(refVal_setCreatedFromUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("digestEmailFrequency")), m_DigestEmailFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedFromTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromTenantId);
-            setCreatedFromTenantId(refVal_setCreatedFromTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastLoginDate"))))
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastLoginDate")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setLastLoginDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastLoginDate);
-            setLastLoginDate(refVal_setLastLoginDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")), m_CreatedFromUrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdFromTenantId")), m_CreatedFromTenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("karma"))))
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("karma")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastLoginDate")), m_LastLoginDate);
+    }
+    if(m_FieldsSet.test(FieldBit_Karma))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("karma")), m_Karma);
+    }
+}
+
+bool ReplaceTenantUserBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            double refVal_setKarma;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setKarma);
-            setKarma(refVal_setKarma);
-            
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            {
+                utility::string_t refVal_setWebsiteUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setWebsiteUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWebsiteUrl(refVal_setWebsiteUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            {
+                double refVal_setSignUpDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setSignUpDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSignUpDate(refVal_setSignUpDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("loginCount")):
+            {
+                double refVal_setLoginCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setLoginCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLoginCount(refVal_setLoginCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedInNotifications")):
+            {
+                bool refVal_setOptedInNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedInNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedInNotifications(refVal_setOptedInNotifications);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedInTenantNotifications")):
+            {
+                bool refVal_setOptedInTenantNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedInTenantNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedInTenantNotifications(refVal_setOptedInTenantNotifications);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hideAccountCode")):
+            {
+                bool refVal_setHideAccountCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setHideAccountCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHideAccountCode(refVal_setHideAccountCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isHelpRequestAdmin")):
+            {
+                bool refVal_setIsHelpRequestAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsHelpRequestAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsHelpRequestAdmin(refVal_setIsHelpRequestAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAccountOwner")):
+            {
+                bool refVal_setIsAccountOwner;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAccountOwner))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAccountOwner(refVal_setIsAccountOwner);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")):
+            {
+                bool refVal_setIsAdminAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAdminAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAdminAdmin(refVal_setIsAdminAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isBillingAdmin")):
+            {
+                bool refVal_setIsBillingAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsBillingAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsBillingAdmin(refVal_setIsBillingAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAnalyticsAdmin")):
+            {
+                bool refVal_setIsAnalyticsAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAnalyticsAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAnalyticsAdmin(refVal_setIsAnalyticsAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isCustomizationAdmin")):
+            {
+                bool refVal_setIsCustomizationAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsCustomizationAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsCustomizationAdmin(refVal_setIsCustomizationAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isManageDataAdmin")):
+            {
+                bool refVal_setIsManageDataAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsManageDataAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsManageDataAdmin(refVal_setIsManageDataAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")):
+            {
+                bool refVal_setIsCommentModeratorAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsCommentModeratorAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAPIAdmin")):
+            {
+                bool refVal_setIsAPIAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAPIAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAPIAdmin(refVal_setIsAPIAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderatorIds")):
+            {
+                std::vector<utility::string_t> refVal_setModeratorIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModeratorIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModeratorIds(refVal_setModeratorIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("digestEmailFrequency")):
+            {
+                double refVal_setDigestEmailFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setDigestEmailFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDigestEmailFrequency(refVal_setDigestEmailFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")):
+            {
+                utility::string_t refVal_setCreatedFromUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedFromUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedFromUrlId(refVal_setCreatedFromUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromTenantId")):
+            {
+                utility::string_t refVal_setCreatedFromTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedFromTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedFromTenantId(refVal_setCreatedFromTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastLoginDate")):
+            {
+                double refVal_setLastLoginDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastLoginDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastLoginDate(refVal_setLastLoginDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("karma")):
+            {
+                double refVal_setKarma;
+                if(!ModelBase::readBinary(reader, field, refVal_setKarma))
+                {
+                    ok = false;
+                    continue;
+                }
+                setKarma(refVal_setKarma);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void ReplaceTenantUserBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -554,115 +1202,115 @@ void ReplaceTenantUserBody::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_WebsiteUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("websiteUrl")), m_WebsiteUrl));
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("signUpDate")), m_SignUpDate));
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_LoginCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("loginCount")), m_LoginCount));
     }
-    if(m_OptedInNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedInNotifications")), m_OptedInNotifications));
     }
-    if(m_OptedInTenantNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications")), m_OptedInTenantNotifications));
     }
-    if(m_HideAccountCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hideAccountCode")), m_HideAccountCode));
     }
-    if(m_AvatarSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_IsHelpRequestAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin")), m_IsHelpRequestAdmin));
     }
-    if(m_IsAccountOwnerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAccountOwner")), m_IsAccountOwner));
     }
-    if(m_IsAdminAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin")), m_IsAdminAdmin));
     }
-    if(m_IsBillingAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin")), m_IsBillingAdmin));
     }
-    if(m_IsAnalyticsAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin")), m_IsAnalyticsAdmin));
     }
-    if(m_IsCustomizationAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin")), m_IsCustomizationAdmin));
     }
-    if(m_IsManageDataAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin")), m_IsManageDataAdmin));
     }
-    if(m_IsCommentModeratorAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin")), m_IsCommentModeratorAdmin));
     }
-    if(m_IsAPIAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin")), m_IsAPIAdmin));
     }
-    if(m_ModeratorIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderatorIds")), m_ModeratorIds));
     }
-    if(m_DigestEmailFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency")), m_DigestEmailFrequency));
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_CreatedFromUrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId")), m_CreatedFromUrlId));
     }
-    if(m_CreatedFromTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId")), m_CreatedFromTenantId));
     }
-    if(m_LastLoginDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastLoginDate")), m_LastLoginDate));
     }
-    if(m_KarmaIsSet)
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("karma")), m_Karma));
     }
@@ -858,17 +1506,17 @@ utility::string_t ReplaceTenantUserBody::getUsername() const
 void ReplaceTenantUserBody::setUsername(const utility::string_t& value)
 {
     m_Username = value;
-    m_UsernameIsSet = true;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool ReplaceTenantUserBody::usernameIsSet() const
 {
-    return m_UsernameIsSet;
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void ReplaceTenantUserBody::unsetUsername()
 {
-    m_UsernameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t ReplaceTenantUserBody::getEmail() const
 {
@@ -879,17 +1527,17 @@ utility::string_t ReplaceTenantUserBody::getEmail() const
 void ReplaceTenantUserBody::setEmail(const utility::string_t& value)
 {
     m_Email = value;
-    m_EmailIsSet = true;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool ReplaceTenantUserBody::emailIsSet() const
 {
-    return m_EmailIsSet;
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void ReplaceTenantUserBody::unsetEmail()
 {
-    m_EmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_Email);
 }
 utility::string_t ReplaceTenantUserBody::getDisplayName() const
 {
@@ -900,17 +1548,17 @@ utility::string_t ReplaceTenantUserBody::getDisplayName() const
 void ReplaceTenantUserBody::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool ReplaceTenantUserBody::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void ReplaceTenantUserBody::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::string_t ReplaceTenantUserBody::getWebsiteUrl() const
 {
@@ -921,17 +1569,17 @@ utility::string_t ReplaceTenantUserBody::getWebsiteUrl() const
 void ReplaceTenantUserBody::setWebsiteUrl(const utility::string_t& value)
 {
     m_WebsiteUrl = value;
-    m_WebsiteUrlIsSet = true;
+    m_FieldsSet.set(FieldBit_WebsiteUrl);
 }
 
 bool ReplaceTenantUserBody::websiteUrlIsSet() const
 {
-    return m_WebsiteUrlIsSet;
+    return m_FieldsSet.test(FieldBit_WebsiteUrl);
 }
 
 void ReplaceTenantUserBody::unsetWebsiteUrl()
 {
-    m_WebsiteUrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_WebsiteUrl);
 }
 double ReplaceTenantUserBody::getSignUpDate() const
 {
@@ -941,17 +1589,17 @@ double ReplaceTenantUserBody::getSignUpDate() const
 void ReplaceTenantUserBody::setSignUpDate(double value)
 {
     m_SignUpDate = value;
-    m_SignUpDateIsSet = true;
+    m_FieldsSet.set(FieldBit_SignUpDate);
 }
 
 bool ReplaceTenantUserBody::signUpDateIsSet() const
 {
-    return m_SignUpDateIsSet;
+    return m_FieldsSet.test(FieldBit_SignUpDate);
 }
 
 void ReplaceTenantUserBody::unsetSignUpDate()
 {
-    m_SignUpDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_SignUpDate);
 }
 utility::string_t ReplaceTenantUserBody::getLocale() const
 {
@@ -962,17 +1610,17 @@ utility::string_t ReplaceTenantUserBody::getLocale() const
 void ReplaceTenantUserBody::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
-    m_LocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool ReplaceTenantUserBody::localeIsSet() const
 {
-    return m_LocaleIsSet;
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void ReplaceTenantUserBody::unsetLocale()
 {
-    m_LocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 bool ReplaceTenantUserBody::isVerified() const
 {
@@ -982,17 +1630,17 @@ bool ReplaceTenantUserBody::isVerified() const
 void ReplaceTenantUserBody::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool ReplaceTenantUserBody::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void ReplaceTenantUserBody::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 double ReplaceTenantUserBody::getLoginCount() const
 {
@@ -1002,17 +1650,17 @@ double ReplaceTenantUserBody::getLoginCount() const
 void ReplaceTenantUserBody::setLoginCount(double value)
 {
     m_LoginCount = value;
-    m_LoginCountIsSet = true;
+    m_FieldsSet.set(FieldBit_LoginCount);
 }
 
 bool ReplaceTenantUserBody::loginCountIsSet() const
 {
-    return m_LoginCountIsSet;
+    return m_FieldsSet.test(FieldBit_LoginCount);
 }
 
 void ReplaceTenantUserBody::unsetLoginCount()
 {
-    m_LoginCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_LoginCount);
 }
 bool ReplaceTenantUserBody::isOptedInNotifications() const
 {
@@ -1022,17 +1670,17 @@ bool ReplaceTenantUserBody::isOptedInNotifications() const
 void ReplaceTenantUserBody::setOptedInNotifications(bool value)
 {
     m_OptedInNotifications = value;
-    m_OptedInNotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedInNotifications);
 }
 
 bool ReplaceTenantUserBody::optedInNotificationsIsSet() const
 {
-    return m_OptedInNotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_OptedInNotifications);
 }
 
 void ReplaceTenantUserBody::unsetOptedInNotifications()
 {
-    m_OptedInNotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedInNotifications);
 }
 bool ReplaceTenantUserBody::isOptedInTenantNotifications() const
 {
@@ -1042,17 +1690,17 @@ bool ReplaceTenantUserBody::isOptedInTenantNotifications() const
 void ReplaceTenantUserBody::setOptedInTenantNotifications(bool value)
 {
     m_OptedInTenantNotifications = value;
-    m_OptedInTenantNotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedInTenantNotifications);
 }
 
 bool ReplaceTenantUserBody::optedInTenantNotificationsIsSet() const
 {
-    return m_OptedInTenantNotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_OptedInTenantNotifications);
 }
 
 void ReplaceTenantUserBody::unsetOptedInTenantNotifications()
 {
-    m_OptedInTenantNotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedInTenantNotifications);
 }
 bool ReplaceTenantUserBody::isHideAccountCode() const
 {
@@ -1062,17 +1710,17 @@ bool ReplaceTenantUserBody::isHideAccountCode() const
 void ReplaceTenantUserBody::setHideAccountCode(bool value)
 {
     m_HideAccountCode = value;
-    m_HideAccountCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_HideAccountCode);
 }
 
 bool ReplaceTenantUserBody::hideAccountCodeIsSet() const
 {
-    return m_HideAccountCodeIsSet;
+    return m_FieldsSet.test(FieldBit_HideAccountCode);
 }
 
 void ReplaceTenantUserBody::unsetHideAccountCode()
 {
-    m_HideAccountCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_HideAccountCode);
 }
 utility::string_t ReplaceTenantUserBody::getAvatarSrc() const
 {
@@ -1083,17 +1731,17 @@ utility::string_t ReplaceTenantUserBody::getAvatarSrc() const
 void ReplaceTenantUserBody::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
-    m_AvatarSrcIsSet = true;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool ReplaceTenantUserBody::avatarSrcIsSet() const
 {
-    return m_AvatarSrcIsSet;
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void ReplaceTenantUserBody::unsetAvatarSrc()
 {
-    m_AvatarSrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 bool ReplaceTenantUserBody::isIsHelpRequestAdmin() const
 {
@@ -1103,17 +1751,17 @@ bool ReplaceTenantUserBody::isIsHelpRequestAdmin() const
 void ReplaceTenantUserBody::setIsHelpRequestAdmin(bool value)
 {
     m_IsHelpRequestAdmin = value;
-    m_IsHelpRequestAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsHelpRequestAdmin);
 }
 
 bool ReplaceTenantUserBody::isHelpRequestAdminIsSet() const
 {
-    return m_IsHelpRequestAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsHelpRequestAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsHelpRequestAdmin()
 {
-    m_IsHelpRequestAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsHelpRequestAdmin);
 }
 bool ReplaceTenantUserBody::isIsAccountOwner() const
 {
@@ -1123,17 +1771,17 @@ bool ReplaceTenantUserBody::isIsAccountOwner() const
 void ReplaceTenantUserBody::setIsAccountOwner(bool value)
 {
     m_IsAccountOwner = value;
-    m_IsAccountOwnerIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAccountOwner);
 }
 
 bool ReplaceTenantUserBody::isAccountOwnerIsSet() const
 {
-    return m_IsAccountOwnerIsSet;
+    return m_FieldsSet.test(FieldBit_IsAccountOwner);
 }
 
 void ReplaceTenantUserBody::unsetIsAccountOwner()
 {
-    m_IsAccountOwnerIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAccountOwner);
 }
 bool ReplaceTenantUserBody::isIsAdminAdmin() const
 {
@@ -1143,17 +1791,17 @@ bool ReplaceTenantUserBody::isIsAdminAdmin() const
 void ReplaceTenantUserBody::setIsAdminAdmin(bool value)
 {
     m_IsAdminAdmin = value;
-    m_IsAdminAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAdminAdmin);
 }
 
 bool ReplaceTenantUserBody::isAdminAdminIsSet() const
 {
-    return m_IsAdminAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsAdminAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsAdminAdmin()
 {
-    m_IsAdminAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAdminAdmin);
 }
 bool ReplaceTenantUserBody::isIsBillingAdmin() const
 {
@@ -1163,17 +1811,17 @@ bool ReplaceTenantUserBody::isIsBillingAdmin() const
 void ReplaceTenantUserBody::setIsBillingAdmin(bool value)
 {
     m_IsBillingAdmin = value;
-    m_IsBillingAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsBillingAdmin);
 }
 
 bool ReplaceTenantUserBody::isBillingAdminIsSet() const
 {
-    return m_IsBillingAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsBillingAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsBillingAdmin()
 {
-    m_IsBillingAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsBillingAdmin);
 }
 bool ReplaceTenantUserBody::isIsAnalyticsAdmin() const
 {
@@ -1183,17 +1831,17 @@ bool ReplaceTenantUserBody::isIsAnalyticsAdmin() const
 void ReplaceTenantUserBody::setIsAnalyticsAdmin(bool value)
 {
     m_IsAnalyticsAdmin = value;
-    m_IsAnalyticsAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAnalyticsAdmin);
 }
 
 bool ReplaceTenantUserBody::isAnalyticsAdminIsSet() const
 {
-    return m_IsAnalyticsAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsAnalyticsAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsAnalyticsAdmin()
 {
-    m_IsAnalyticsAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAnalyticsAdmin);
 }
 bool ReplaceTenantUserBody::isIsCustomizationAdmin() const
 {
@@ -1203,17 +1851,17 @@ bool ReplaceTenantUserBody::isIsCustomizationAdmin() const
 void ReplaceTenantUserBody::setIsCustomizationAdmin(bool value)
 {
     m_IsCustomizationAdmin = value;
-    m_IsCustomizationAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsCustomizationAdmin);
 }
 
 bool ReplaceTenantUserBody::isCustomizationAdminIsSet() const
 {
-    return m_IsCustomizationAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsCustomizationAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsCustomizationAdmin()
 {
-    m_IsCustomizationAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsCustomizationAdmin);
 }
 bool ReplaceTenantUserBody::isIsManageDataAdmin() const
 {
@@ -1223,17 +1871,17 @@ bool ReplaceTenantUserBody::isIsManageDataAdmin() const
 void ReplaceTenantUserBody::setIsManageDataAdmin(bool value)
 {
     m_IsManageDataAdmin = value;
-    m_IsManageDataAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsManageDataAdmin);
 }
 
 bool ReplaceTenantUserBody::isManageDataAdminIsSet() const
 {
-    return m_IsManageDataAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsManageDataAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsManageDataAdmin()
 {
-    m_IsManageDataAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsManageDataAdmin);
 }
 bool ReplaceTenantUserBody::isIsCommentModeratorAdmin() const
 {
@@ -1243,17 +1891,17 @@ bool ReplaceTenantUserBody::isIsCommentModeratorAdmin() const
 void ReplaceTenantUserBody::setIsCommentModeratorAdmin(bool value)
 {
     m_IsCommentModeratorAdmin = value;
-    m_IsCommentModeratorAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsCommentModeratorAdmin);
 }
 
 bool ReplaceTenantUserBody::isCommentModeratorAdminIsSet() const
 {
-    return m_IsCommentModeratorAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsCommentModeratorAdmin()
 {
-    m_IsCommentModeratorAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsCommentModeratorAdmin);
 }
 bool ReplaceTenantUserBody::isIsAPIAdmin() const
 {
@@ -1263,17 +1911,17 @@ bool ReplaceTenantUserBody::isIsAPIAdmin() const
 void ReplaceTenantUserBody::setIsAPIAdmin(bool value)
 {
     m_IsAPIAdmin = value;
-    m_IsAPIAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAPIAdmin);
 }
 
 bool ReplaceTenantUserBody::isAPIAdminIsSet() const
 {
-    return m_IsAPIAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsAPIAdmin);
 }
 
 void ReplaceTenantUserBody::unsetIsAPIAdmin()
 {
-    m_IsAPIAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAPIAdmin);
 }
 std::vector<utility::string_t> ReplaceTenantUserBody::getModeratorIds() const
 {
@@ -1284,17 +1932,17 @@ std::vector<utility::string_t> ReplaceTenantUserBody::getModeratorIds() const
 void ReplaceTenantUserBody::setModeratorIds(const std::vector<utility::string_t>& value)
 {
     m_ModeratorIds = value;
-    m_ModeratorIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ModeratorIds);
 }
 
 bool ReplaceTenantUserBody::moderatorIdsIsSet() const
 {
-    return m_ModeratorIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ModeratorIds);
 }
 
 void ReplaceTenantUserBody::unsetModeratorIds()
 {
-    m_ModeratorIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModeratorIds);
 }
 double ReplaceTenantUserBody::getDigestEmailFrequency() const
 {
@@ -1304,17 +1952,17 @@ double ReplaceTenantUserBody::getDigestEmailFrequency() const
 void ReplaceTenantUserBody::setDigestEmailFrequency(double value)
 {
     m_DigestEmailFrequency = value;
-    m_DigestEmailFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_DigestEmailFrequency);
 }
 
 bool ReplaceTenantUserBody::digestEmailFrequencyIsSet() const
 {
-    return m_DigestEmailFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_DigestEmailFrequency);
 }
 
 void ReplaceTenantUserBody::unsetDigestEmailFrequency()
 {
-    m_DigestEmailFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_DigestEmailFrequency);
 }
 utility::string_t ReplaceTenantUserBody::getDisplayLabel() const
 {
@@ -1325,17 +1973,17 @@ utility::string_t ReplaceTenantUserBody::getDisplayLabel() const
 void ReplaceTenantUserBody::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
-    m_DisplayLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool ReplaceTenantUserBody::displayLabelIsSet() const
 {
-    return m_DisplayLabelIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void ReplaceTenantUserBody::unsetDisplayLabel()
 {
-    m_DisplayLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 utility::string_t ReplaceTenantUserBody::getCreatedFromUrlId() const
 {
@@ -1346,17 +1994,17 @@ utility::string_t ReplaceTenantUserBody::getCreatedFromUrlId() const
 void ReplaceTenantUserBody::setCreatedFromUrlId(const utility::string_t& value)
 {
     m_CreatedFromUrlId = value;
-    m_CreatedFromUrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedFromUrlId);
 }
 
 bool ReplaceTenantUserBody::createdFromUrlIdIsSet() const
 {
-    return m_CreatedFromUrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedFromUrlId);
 }
 
 void ReplaceTenantUserBody::unsetCreatedFromUrlId()
 {
-    m_CreatedFromUrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedFromUrlId);
 }
 utility::string_t ReplaceTenantUserBody::getCreatedFromTenantId() const
 {
@@ -1367,17 +2015,17 @@ utility::string_t ReplaceTenantUserBody::getCreatedFromTenantId() const
 void ReplaceTenantUserBody::setCreatedFromTenantId(const utility::string_t& value)
 {
     m_CreatedFromTenantId = value;
-    m_CreatedFromTenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedFromTenantId);
 }
 
 bool ReplaceTenantUserBody::createdFromTenantIdIsSet() const
 {
-    return m_CreatedFromTenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedFromTenantId);
 }
 
 void ReplaceTenantUserBody::unsetCreatedFromTenantId()
 {
-    m_CreatedFromTenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedFromTenantId);
 }
 double ReplaceTenantUserBody::getLastLoginDate() const
 {
@@ -1387,17 +2035,17 @@ double ReplaceTenantUserBody::getLastLoginDate() const
 void ReplaceTenantUserBody::setLastLoginDate(double value)
 {
     m_LastLoginDate = value;
-    m_LastLoginDateIsSet = true;
+    m_FieldsSet.set(FieldBit_LastLoginDate);
 }
 
 bool ReplaceTenantUserBody::lastLoginDateIsSet() const
 {
-    return m_LastLoginDateIsSet;
+    return m_FieldsSet.test(FieldBit_LastLoginDate);
 }
 
 void ReplaceTenantUserBody::unsetLastLoginDate()
 {
-    m_LastLoginDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastLoginDate);
 }
 double ReplaceTenantUserBody::getKarma() const
 {
@@ -1407,17 +2055,17 @@ double ReplaceTenantUserBody::getKarma() const
 void ReplaceTenantUserBody::setKarma(double value)
 {
     m_Karma = value;
-    m_KarmaIsSet = true;
+    m_FieldsSet.set(FieldBit_Karma);
 }
 
 bool ReplaceTenantUserBody::karmaIsSet() const
 {
-    return m_KarmaIsSet;
+    return m_FieldsSet.test(FieldBit_Karma);
 }
 
 void ReplaceTenantUserBody::unsetKarma()
 {
-    m_KarmaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Karma);
 }
 
 }
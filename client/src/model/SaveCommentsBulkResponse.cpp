@@ -20,22 +20,8 @@ namespace model {
 
 SaveCommentsBulkResponse::SaveCommentsBulkResponse()
 {
-    m_StatusIsSet = false;
-    m_CommentIsSet = false;
-    m_ModuleDataIsSet = false;
-    m_Reason = utility::conversions::to_string_t("");
-    m_ReasonIsSet = false;
-    m_Code = utility::conversions::to_string_t("");
-    m_CodeIsSet = false;
-    m_SecondaryCode = utility::conversions::to_string_t("");
-    m_SecondaryCodeIsSet = false;
     m_BannedUntil = 0L;
-    m_BannedUntilIsSet = false;
     m_MaxCharacterLength = 0;
-    m_MaxCharacterLengthIsSet = false;
-    m_TranslatedError = utility::conversions::to_string_t("");
-    m_TranslatedErrorIsSet = false;
-    m_CustomConfigIsSet = false;
 }
 
 SaveCommentsBulkResponse::~SaveCommentsBulkResponse()
@@ -50,57 +36,57 @@ void SaveCommentsBulkResponse::validate()
 web::json::value SaveCommentsBulkResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("comment"))] = ModelBase::toJson(m_Comment);
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User);
     }
-    if(m_ModuleDataIsSet)
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moduleData"))] = ModelBase::toJson(m_ModuleData);
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reason"))] = ModelBase::toJson(m_Reason);
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("code"))] = ModelBase::toJson(m_Code);
     }
-    if(m_SecondaryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("secondaryCode"))] = ModelBase::toJson(m_SecondaryCode);
     }
-    if(m_BannedUntilIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))] = ModelBase::toJson(m_BannedUntil);
     }
-    if(m_MaxCharacterLengthIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength"))] = ModelBase::toJson(m_MaxCharacterLength);
     }
-    if(m_TranslatedErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translatedError"))] = ModelBase::toJson(m_TranslatedError);
     }
-    if(m_CustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("customConfig"))] = ModelBase::toJson(m_CustomConfig);
@@ -109,131 +95,425 @@ web::json::value SaveCommentsBulkResponse::toJson() const
     return val;
 }
 
+void SaveCommentsBulkResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Comment))
+    {
+        
+        writer.key(_XPLATSTR("comment"));
+        ModelBase::writeJson(writer, m_Comment);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        writer.key(_XPLATSTR("user"));
+        ModelBase::writeJson(writer, m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_ModuleData))
+    {
+        
+        writer.key(_XPLATSTR("moduleData"));
+        ModelBase::writeJson(writer, m_ModuleData);
+    }
+    if(m_FieldsSet.test(FieldBit_Reason))
+    {
+        
+        writer.key(_XPLATSTR("reason"));
+        ModelBase::writeJson(writer, m_Reason);
+    }
+    if(m_FieldsSet.test(FieldBit_Code))
+    {
+        
+        writer.key(_XPLATSTR("code"));
+        ModelBase::writeJson(writer, m_Code);
+    }
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
+    {
+        
+        writer.key(_XPLATSTR("secondaryCode"));
+        ModelBase::writeJson(writer, m_SecondaryCode);
+    }
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
+    {
+        
+        writer.key(_XPLATSTR("bannedUntil"));
+        ModelBase::writeJson(writer, m_BannedUntil);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
+    {
+        
+        writer.key(_XPLATSTR("maxCharacterLength"));
+        ModelBase::writeJson(writer, m_MaxCharacterLength);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
+    {
+        
+        writer.key(_XPLATSTR("translatedError"));
+        ModelBase::writeJson(writer, m_TranslatedError);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
+    {
+        
+        writer.key(_XPLATSTR("customConfig"));
+        ModelBase::writeJson(writer, m_CustomConfig);
+    }
+
+    writer.endObject();
+}
+
 bool SaveCommentsBulkResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("comment"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("comment")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIComment> refVal_setComment;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
-            setComment(refVal_setComment);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            if(field.first == _XPLATSTR("comment"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIComment> refVal_setComment;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setComment);
+                    setComment(refVal_setComment);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            if(field.first == _XPLATSTR("user"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserSessionInfo> refVal_setUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
+                    setUser(refVal_setUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moduleData")):
+            if(field.first == _XPLATSTR("moduleData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<Object>> refVal_setModuleData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModuleData);
+                    setModuleData(refVal_setModuleData);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            if(field.first == _XPLATSTR("reason"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReason;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
+                    setReason(refVal_setReason);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            if(field.first == _XPLATSTR("code"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
+                    setCode(refVal_setCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("secondaryCode")):
+            if(field.first == _XPLATSTR("secondaryCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSecondaryCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSecondaryCode);
+                    setSecondaryCode(refVal_setSecondaryCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            if(field.first == _XPLATSTR("bannedUntil"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setBannedUntil;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
+                    setBannedUntil(refVal_setBannedUntil);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxCharacterLength")):
+            if(field.first == _XPLATSTR("maxCharacterLength"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setMaxCharacterLength;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCharacterLength);
+                    setMaxCharacterLength(refVal_setMaxCharacterLength);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translatedError")):
+            if(field.first == _XPLATSTR("translatedError"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTranslatedError;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslatedError);
+                    setTranslatedError(refVal_setTranslatedError);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("customConfig")):
+            if(field.first == _XPLATSTR("customConfig"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCustomConfig);
+                    setCustomConfig(refVal_setCustomConfig);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("user"))))
+    return ok;
+}
+
+void SaveCommentsBulkResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("user")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<UserSessionInfo> refVal_setUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
-            setUser(refVal_setUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moduleData"))))
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moduleData")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::shared_ptr<Object>> refVal_setModuleData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModuleData);
-            setModuleData(refVal_setModuleData);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("comment")), m_Comment);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reason"))))
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reason")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setReason;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReason);
-            setReason(refVal_setReason);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("user")), m_User);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("code"))))
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("code")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCode);
-            setCode(refVal_setCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moduleData")), m_ModuleData);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("secondaryCode"))))
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("secondaryCode")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSecondaryCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSecondaryCode);
-            setSecondaryCode(refVal_setSecondaryCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reason")), m_Reason);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bannedUntil"))))
+    if(m_FieldsSet.test(FieldBit_Code))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bannedUntil")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setBannedUntil;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBannedUntil);
-            setBannedUntil(refVal_setBannedUntil);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("code")), m_Code);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength"))))
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setMaxCharacterLength;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCharacterLength);
-            setMaxCharacterLength(refVal_setMaxCharacterLength);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("secondaryCode")), m_SecondaryCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translatedError"))))
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translatedError")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTranslatedError;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslatedError);
-            setTranslatedError(refVal_setTranslatedError);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bannedUntil")), m_BannedUntil);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxCharacterLength")), m_MaxCharacterLength);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translatedError")), m_TranslatedError);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("customConfig")), m_CustomConfig);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("customConfig"))))
+}
+
+bool SaveCommentsBulkResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("customConfig")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCustomConfig);
-            setCustomConfig(refVal_setCustomConfig);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("comment")):
+            {
+                std::shared_ptr<APIComment> refVal_setComment;
+                if(!ModelBase::readBinary(reader, field, refVal_setComment))
+                {
+                    ok = false;
+                    continue;
+                }
+                setComment(refVal_setComment);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            {
+                std::shared_ptr<UserSessionInfo> refVal_setUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUser(refVal_setUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moduleData")):
+            {
+                std::map<utility::string_t, std::shared_ptr<Object>> refVal_setModuleData;
+                if(!ModelBase::readBinary(reader, field, refVal_setModuleData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModuleData(refVal_setModuleData);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reason")):
+            {
+                utility::string_t refVal_setReason;
+                if(!ModelBase::readBinary(reader, field, refVal_setReason))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReason(refVal_setReason);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("code")):
+            {
+                utility::string_t refVal_setCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCode(refVal_setCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("secondaryCode")):
+            {
+                utility::string_t refVal_setSecondaryCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setSecondaryCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSecondaryCode(refVal_setSecondaryCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bannedUntil")):
+            {
+                int64_t refVal_setBannedUntil;
+                if(!ModelBase::readBinary(reader, field, refVal_setBannedUntil))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBannedUntil(refVal_setBannedUntil);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxCharacterLength")):
+            {
+                int32_t refVal_setMaxCharacterLength;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxCharacterLength))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxCharacterLength(refVal_setMaxCharacterLength);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translatedError")):
+            {
+                utility::string_t refVal_setTranslatedError;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslatedError))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslatedError(refVal_setTranslatedError);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("customConfig")):
+            {
+                std::shared_ptr<CustomConfigParameters> refVal_setCustomConfig;
+                if(!ModelBase::readBinary(reader, field, refVal_setCustomConfig))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCustomConfig(refVal_setCustomConfig);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void SaveCommentsBulkResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -243,47 +523,47 @@ void SaveCommentsBulkResponse::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_CommentIsSet)
+    if(m_FieldsSet.test(FieldBit_Comment))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("comment")), m_Comment));
     }
-    if(m_User.has_value())
+    if(m_FieldsSet.test(FieldBit_User))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User));
     }
-    if(m_ModuleDataIsSet)
+    if(m_FieldsSet.test(FieldBit_ModuleData))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moduleData")), m_ModuleData));
     }
-    if(m_ReasonIsSet)
+    if(m_FieldsSet.test(FieldBit_Reason))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reason")), m_Reason));
     }
-    if(m_CodeIsSet)
+    if(m_FieldsSet.test(FieldBit_Code))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("code")), m_Code));
     }
-    if(m_SecondaryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_SecondaryCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("secondaryCode")), m_SecondaryCode));
     }
-    if(m_BannedUntilIsSet)
+    if(m_FieldsSet.test(FieldBit_BannedUntil))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bannedUntil")), m_BannedUntil));
     }
-    if(m_MaxCharacterLengthIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCharacterLength))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCharacterLength")), m_MaxCharacterLength));
     }
-    if(m_TranslatedErrorIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslatedError))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translatedError")), m_TranslatedError));
     }
-    if(m_CustomConfigIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomConfig))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customConfig")), m_CustomConfig));
     }
@@ -377,17 +657,17 @@ std::shared_ptr<APIStatus> SaveCommentsBulkResponse::getStatus() const
 void SaveCommentsBulkResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool SaveCommentsBulkResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void SaveCommentsBulkResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<APIComment> SaveCommentsBulkResponse::getComment() const
 {
@@ -398,37 +678,38 @@ std::shared_ptr<APIComment> SaveCommentsBulkResponse::getComment() const
 void SaveCommentsBulkResponse::setComment(const std::shared_ptr<APIComment>& value)
 {
     m_Comment = value;
-    m_CommentIsSet = true;
+    m_FieldsSet.set(FieldBit_Comment);
 }
 
 bool SaveCommentsBulkResponse::commentIsSet() const
 {
-    return m_CommentIsSet;
+    return m_FieldsSet.test(FieldBit_Comment);
 }
 
 void SaveCommentsBulkResponse::unsetComment()
 {
-    m_CommentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Comment);
 }
 std::shared_ptr<UserSessionInfo> SaveCommentsBulkResponse::getUser() const
 {
-    return m_User.get();
+    return m_User;
 }
 
 
 void SaveCommentsBulkResponse::setUser(const std::shared_ptr<UserSessionInfo>& value)
 {
     m_User = value;
+    m_FieldsSet.set(FieldBit_User);
 }
 
 bool SaveCommentsBulkResponse::userIsSet() const
 {
-    return m_User.has_value();
+    return m_FieldsSet.test(FieldBit_User);
 }
 
 void SaveCommentsBulkResponse::unsetUser()
 {
-    m_User.reset();
+    m_FieldsSet.reset(FieldBit_User);
 }
 std::map<utility::string_t, std::shared_ptr<Object>> SaveCommentsBulkResponse::getModuleData() const
 {
@@ -439,17 +720,17 @@ std::map<utility::string_t, std::shared_ptr<Object>> SaveCommentsBulkResponse::g
 void SaveCommentsBulkResponse::setModuleData(const std::map<utility::string_t, std::shared_ptr<Object>>& value)
 {
     m_ModuleData = value;
-    m_ModuleDataIsSet = true;
+    m_FieldsSet.set(FieldBit_ModuleData);
 }
 
 bool SaveCommentsBulkResponse::moduleDataIsSet() const
 {
-    return m_ModuleDataIsSet;
+    return m_FieldsSet.test(FieldBit_ModuleData);
 }
 
 void SaveCommentsBulkResponse::unsetModuleData()
 {
-    m_ModuleDataIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModuleData);
 }
 utility::string_t SaveCommentsBulkResponse::getReason() const
 {
@@ -460,17 +741,17 @@ utility::string_t SaveCommentsBulkResponse::getReason() const
 void SaveCommentsBulkResponse::setReason(const utility::string_t& value)
 {
     m_Reason = value;
-    m_ReasonIsSet = true;
+    m_FieldsSet.set(FieldBit_Reason);
 }
 
 bool SaveCommentsBulkResponse::reasonIsSet() const
 {
-    return m_ReasonIsSet;
+    return m_FieldsSet.test(FieldBit_Reason);
 }
 
 void SaveCommentsBulkResponse::unsetReason()
 {
-    m_ReasonIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reason);
 }
 utility::string_t SaveCommentsBulkResponse::getCode() const
 {
@@ -481,17 +762,17 @@ utility::string_t SaveCommentsBulkResponse::getCode() const
 void SaveCommentsBulkResponse::setCode(const utility::string_t& value)
 {
     m_Code = value;
-    m_CodeIsSet = true;
+    m_FieldsSet.set(FieldBit_Code);
 }
 
 bool SaveCommentsBulkResponse::codeIsSet() const
 {
-    return m_CodeIsSet;
+    return m_FieldsSet.test(FieldBit_Code);
 }
 
 void SaveCommentsBulkResponse::unsetCode()
 {
-    m_CodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Code);
 }
 utility::string_t SaveCommentsBulkResponse::getSecondaryCode() const
 {
@@ -502,17 +783,17 @@ utility::string_t SaveCommentsBulkResponse::getSecondaryCode() const
 void SaveCommentsBulkResponse::setSecondaryCode(const utility::string_t& value)
 {
     m_SecondaryCode = value;
-    m_SecondaryCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_SecondaryCode);
 }
 
 bool SaveCommentsBulkResponse::secondaryCodeIsSet() const
 {
-    return m_SecondaryCodeIsSet;
+    return m_FieldsSet.test(FieldBit_SecondaryCode);
 }
 
 void SaveCommentsBulkResponse::unsetSecondaryCode()
 {
-    m_SecondaryCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_SecondaryCode);
 }
 int64_t SaveCommentsBulkResponse::getBannedUntil() const
 {
@@ -522,17 +803,17 @@ int64_t SaveCommentsBulkResponse::getBannedUntil() const
 void SaveCommentsBulkResponse::setBannedUntil(int64_t value)
 {
     m_BannedUntil = value;
-    m_BannedUntilIsSet = true;
+    m_FieldsSet.set(FieldBit_BannedUntil);
 }
 
 bool SaveCommentsBulkResponse::bannedUntilIsSet() const
 {
-    return m_BannedUntilIsSet;
+    return m_FieldsSet.test(FieldBit_BannedUntil);
 }
 
 void SaveCommentsBulkResponse::unsetBannedUntil()
 {
-    m_BannedUntilIsSet = false;
+    m_FieldsSet.reset(FieldBit_BannedUntil);
 }
 int32_t SaveCommentsBulkResponse::getMaxCharacterLength() const
 {
@@ -542,17 +823,17 @@ int32_t SaveCommentsBulkResponse::getMaxCharacterLength() const
 void SaveCommentsBulkResponse::setMaxCharacterLength(int32_t value)
 {
     m_MaxCharacterLength = value;
-    m_MaxCharacterLengthIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxCharacterLength);
 }
 
 bool SaveCommentsBulkResponse::maxCharacterLengthIsSet() const
 {
-    return m_MaxCharacterLengthIsSet;
+    return m_FieldsSet.test(FieldBit_MaxCharacterLength);
 }
 
 void SaveCommentsBulkResponse::unsetMaxCharacterLength()
 {
-    m_MaxCharacterLengthIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxCharacterLength);
 }
 utility::string_t SaveCommentsBulkResponse::getTranslatedError() const
 {
@@ -563,17 +844,17 @@ utility::string_t SaveCommentsBulkResponse::getTranslatedError() const
 void SaveCommentsBulkResponse::setTranslatedError(const utility::string_t& value)
 {
     m_TranslatedError = value;
-    m_TranslatedErrorIsSet = true;
+    m_FieldsSet.set(FieldBit_TranslatedError);
 }
 
 bool SaveCommentsBulkResponse::translatedErrorIsSet() const
 {
-    return m_TranslatedErrorIsSet;
+    return m_FieldsSet.test(FieldBit_TranslatedError);
 }
 
 void SaveCommentsBulkResponse::unsetTranslatedError()
 {
-    m_TranslatedErrorIsSet = false;
+    m_FieldsSet.reset(FieldBit_TranslatedError);
 }
 std::shared_ptr<CustomConfigParameters> SaveCommentsBulkResponse::getCustomConfig() const
 {
@@ -584,17 +865,17 @@ std::shared_ptr<CustomConfigParameters> SaveCommentsBulkResponse::getCustomConfi
 void SaveCommentsBulkResponse::setCustomConfig(const std::shared_ptr<CustomConfigParameters>& value)
 {
     m_CustomConfig = value;
-    m_CustomConfigIsSet = true;
+    m_FieldsSet.set(FieldBit_CustomConfig);
 }
 
 bool SaveCommentsBulkResponse::customConfigIsSet() const
 {
-    return m_CustomConfigIsSet;
+    return m_FieldsSet.test(FieldBit_CustomConfig);
 }
 
 void SaveCommentsBulkResponse::unsetCustomConfig()
 {
-    m_CustomConfigIsSet = false;
+    m_FieldsSet.reset(FieldBit_CustomConfig);
 }
 
 }
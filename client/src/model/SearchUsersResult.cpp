@@ -20,9 +20,6 @@ namespace model {
 
 SearchUsersResult::SearchUsersResult()
 {
-    m_StatusIsSet = false;
-    m_SectionsIsSet = false;
-    m_UsersIsSet = false;
 }
 
 SearchUsersResult::~SearchUsersResult()
@@ -37,17 +34,17 @@ void SearchUsersResult::validate()
 web::json::value SearchUsersResult::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_SectionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Sections))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sections"))] = ModelBase::toJson(m_Sections);
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("users"))] = ModelBase::toJson(m_Users);
@@ -56,43 +53,153 @@ web::json::value SearchUsersResult::toJson() const
     return val;
 }
 
+void SearchUsersResult::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Sections))
+    {
+        
+        writer.key(_XPLATSTR("sections"));
+        ModelBase::writeJson(writer, m_Sections);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        writer.key(_XPLATSTR("users"));
+        ModelBase::writeJson(writer, m_Users);
+    }
+
+    writer.endObject();
+}
+
 bool SearchUsersResult::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sections"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sections")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<std::shared_ptr<UserSearchSectionResult>> refVal_setSections;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSections);
-            setSections(refVal_setSections);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sections")):
+            if(field.first == _XPLATSTR("sections"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<UserSearchSectionResult>> refVal_setSections;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSections);
+                    setSections(refVal_setSections);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            if(field.first == _XPLATSTR("users"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<UserSearchResult>> refVal_setUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
+                    setUsers(refVal_setUsers);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("users"))))
+    return ok;
+}
+
+void SearchUsersResult::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Sections))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sections")), m_Sections);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("users")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("users")), m_Users);
+    }
+}
+
+bool SearchUsersResult::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<UserSearchResult>> refVal_setUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
-            setUsers(refVal_setUsers);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sections")):
+            {
+                std::vector<std::shared_ptr<UserSearchSectionResult>> refVal_setSections;
+                if(!ModelBase::readBinary(reader, field, refVal_setSections))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSections(refVal_setSections);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            {
+                std::vector<std::shared_ptr<UserSearchResult>> refVal_setUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsers(refVal_setUsers);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void SearchUsersResult::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -102,15 +209,15 @@ void SearchUsersResult::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_SectionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Sections))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sections")), m_Sections));
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("users")), m_Users));
     }
@@ -156,17 +263,17 @@ std::shared_ptr<APIStatus> SearchUsersResult::getStatus() const
 void SearchUsersResult::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool SearchUsersResult::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void SearchUsersResult::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<UserSearchSectionResult>> SearchUsersResult::getSections() const
 {
@@ -177,17 +284,17 @@ std::vector<std::shared_ptr<UserSearchSectionResult>> SearchUsersResult::getSect
 void SearchUsersResult::setSections(const std::vector<std::shared_ptr<UserSearchSectionResult>>& value)
 {
     m_Sections = value;
-    m_SectionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Sections);
 }
 
 bool SearchUsersResult::sectionsIsSet() const
 {
-    return m_SectionsIsSet;
+    return m_FieldsSet.test(FieldBit_Sections);
 }
 
 void SearchUsersResult::unsetSections()
 {
-    m_SectionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sections);
 }
 std::vector<std::shared_ptr<UserSearchResult>> SearchUsersResult::getUsers() const
 {
@@ -198,17 +305,17 @@ std::vector<std::shared_ptr<UserSearchResult>> SearchUsersResult::getUsers() con
 void SearchUsersResult::setUsers(const std::vector<std::shared_ptr<UserSearchResult>>& value)
 {
     m_Users = value;
-    m_UsersIsSet = true;
+    m_FieldsSet.set(FieldBit_Users);
 }
 
 bool SearchUsersResult::usersIsSet() const
 {
-    return m_UsersIsSet;
+    return m_FieldsSet.test(FieldBit_Users);
 }
 
 void SearchUsersResult::unsetUsers()
 {
-    m_UsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Users);
 }
 
 }
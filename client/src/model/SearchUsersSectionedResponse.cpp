@@ -20,8 +20,6 @@ namespace model {
 
 SearchUsersSectionedResponse::SearchUsersSectionedResponse()
 {
-    m_StatusIsSet = false;
-    m_SectionsIsSet = false;
 }
 
 SearchUsersSectionedResponse::~SearchUsersSectionedResponse()
@@ -36,12 +34,12 @@ void SearchUsersSectionedResponse::validate()
 web::json::value SearchUsersSectionedResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_SectionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Sections))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sections"))] = ModelBase::toJson(m_Sections);
@@ -50,32 +48,119 @@ web::json::value SearchUsersSectionedResponse::toJson() const
     return val;
 }
 
+void SearchUsersSectionedResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Sections))
+    {
+        
+        writer.key(_XPLATSTR("sections"));
+        ModelBase::writeJson(writer, m_Sections);
+    }
+
+    writer.endObject();
+}
+
 bool SearchUsersSectionedResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sections")):
+            if(field.first == _XPLATSTR("sections"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<UserSearchSectionResult>> refVal_setSections;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSections);
+                    setSections(refVal_setSections);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sections"))))
+    return ok;
+}
+
+void SearchUsersSectionedResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sections")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Sections))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sections")), m_Sections);
+    }
+}
+
+bool SearchUsersSectionedResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<UserSearchSectionResult>> refVal_setSections;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSections);
-            setSections(refVal_setSections);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sections")):
+            {
+                std::vector<std::shared_ptr<UserSearchSectionResult>> refVal_setSections;
+                if(!ModelBase::readBinary(reader, field, refVal_setSections))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSections(refVal_setSections);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void SearchUsersSectionedResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void SearchUsersSectionedResponse::toMultipart(std::shared_ptr<MultipartFormData
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_SectionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Sections))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sections")), m_Sections));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> SearchUsersSectionedResponse::getStatus() const
 void SearchUsersSectionedResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool SearchUsersSectionedResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void SearchUsersSectionedResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::vector<std::shared_ptr<UserSearchSectionResult>> SearchUsersSectionedResponse::getSections() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<UserSearchSectionResult>> SearchUsersSectionedRespon
 void SearchUsersSectionedResponse::setSections(const std::vector<std::shared_ptr<UserSearchSectionResult>>& value)
 {
     m_Sections = value;
-    m_SectionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Sections);
 }
 
 bool SearchUsersSectionedResponse::sectionsIsSet() const
 {
-    return m_SectionsIsSet;
+    return m_FieldsSet.test(FieldBit_Sections);
 }
 
 void SearchUsersSectionedResponse::unsetSections()
 {
-    m_SectionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sections);
 }
 
 }
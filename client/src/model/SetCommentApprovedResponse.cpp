@@ -21,8 +21,6 @@ namespace model {
 SetCommentApprovedResponse::SetCommentApprovedResponse()
 {
     m_DidResetFlaggedCount = false;
-    m_DidResetFlaggedCountIsSet = false;
-    m_StatusIsSet = false;
 }
 
 SetCommentApprovedResponse::~SetCommentApprovedResponse()
@@ -37,12 +35,12 @@ void SetCommentApprovedResponse::validate()
 web::json::value SetCommentApprovedResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_DidResetFlaggedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_DidResetFlaggedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("didResetFlaggedCount"))] = ModelBase::toJson(m_DidResetFlaggedCount);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -51,32 +49,119 @@ web::json::value SetCommentApprovedResponse::toJson() const
     return val;
 }
 
+void SetCommentApprovedResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_DidResetFlaggedCount))
+    {
+        
+        writer.key(_XPLATSTR("didResetFlaggedCount"));
+        ModelBase::writeJson(writer, m_DidResetFlaggedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool SetCommentApprovedResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("didResetFlaggedCount"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("didResetFlaggedCount")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setDidResetFlaggedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDidResetFlaggedCount);
-            setDidResetFlaggedCount(refVal_setDidResetFlaggedCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("didResetFlaggedCount")):
+            if(field.first == _XPLATSTR("didResetFlaggedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDidResetFlaggedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDidResetFlaggedCount);
+                    setDidResetFlaggedCount(refVal_setDidResetFlaggedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void SetCommentApprovedResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_DidResetFlaggedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("didResetFlaggedCount")), m_DidResetFlaggedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool SetCommentApprovedResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("didResetFlaggedCount")):
+            {
+                bool refVal_setDidResetFlaggedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setDidResetFlaggedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDidResetFlaggedCount(refVal_setDidResetFlaggedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void SetCommentApprovedResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +171,11 @@ void SetCommentApprovedResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_DidResetFlaggedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_DidResetFlaggedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("didResetFlaggedCount")), m_DidResetFlaggedCount));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ bool SetCommentApprovedResponse::isDidResetFlaggedCount() const
 void SetCommentApprovedResponse::setDidResetFlaggedCount(bool value)
 {
     m_DidResetFlaggedCount = value;
-    m_DidResetFlaggedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_DidResetFlaggedCount);
 }
 
 bool SetCommentApprovedResponse::didResetFlaggedCountIsSet() const
 {
-    return m_DidResetFlaggedCountIsSet;
+    return m_FieldsSet.test(FieldBit_DidResetFlaggedCount);
 }
 
 void SetCommentApprovedResponse::unsetDidResetFlaggedCount()
 {
-    m_DidResetFlaggedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_DidResetFlaggedCount);
 }
 std::shared_ptr<APIStatus> SetCommentApprovedResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> SetCommentApprovedResponse::getStatus() const
 void SetCommentApprovedResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool SetCommentApprovedResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void SetCommentApprovedResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -20,9 +20,6 @@ namespace model {
 
 SetCommentTextResponse::SetCommentTextResponse()
 {
-    m_NewCommentTextHTML = utility::conversions::to_string_t("");
-    m_NewCommentTextHTMLIsSet = false;
-    m_StatusIsSet = false;
 }
 
 SetCommentTextResponse::~SetCommentTextResponse()
@@ -37,12 +34,12 @@ void SetCommentTextResponse::validate()
 web::json::value SetCommentTextResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NewCommentTextHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_NewCommentTextHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("newCommentTextHTML"))] = ModelBase::toJson(m_NewCommentTextHTML);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -51,32 +48,119 @@ web::json::value SetCommentTextResponse::toJson() const
     return val;
 }
 
+void SetCommentTextResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_NewCommentTextHTML))
+    {
+        
+        writer.key(_XPLATSTR("newCommentTextHTML"));
+        ModelBase::writeJson(writer, m_NewCommentTextHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool SetCommentTextResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("newCommentTextHTML"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("newCommentTextHTML")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setNewCommentTextHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNewCommentTextHTML);
-            setNewCommentTextHTML(refVal_setNewCommentTextHTML);
-            
+        case ModelBase::fieldHash(_XPLATSTR("newCommentTextHTML")):
+            if(field.first == _XPLATSTR("newCommentTextHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNewCommentTextHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNewCommentTextHTML);
+                    setNewCommentTextHTML(refVal_setNewCommentTextHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void SetCommentTextResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_NewCommentTextHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("newCommentTextHTML")), m_NewCommentTextHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool SetCommentTextResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("newCommentTextHTML")):
+            {
+                utility::string_t refVal_setNewCommentTextHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setNewCommentTextHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNewCommentTextHTML(refVal_setNewCommentTextHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void SetCommentTextResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +170,11 @@ void SetCommentTextResponse::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NewCommentTextHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_NewCommentTextHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("newCommentTextHTML")), m_NewCommentTextHTML));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -130,17 +214,17 @@ utility::string_t SetCommentTextResponse::getNewCommentTextHTML() const
 void SetCommentTextResponse::setNewCommentTextHTML(const utility::string_t& value)
 {
     m_NewCommentTextHTML = value;
-    m_NewCommentTextHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_NewCommentTextHTML);
 }
 
 bool SetCommentTextResponse::newCommentTextHTMLIsSet() const
 {
-    return m_NewCommentTextHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_NewCommentTextHTML);
 }
 
 void SetCommentTextResponse::unsetNewCommentTextHTML()
 {
-    m_NewCommentTextHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_NewCommentTextHTML);
 }
 std::shared_ptr<APIStatus> SetCommentTextResponse::getStatus() const
 {
@@ -151,17 +235,17 @@ std::shared_ptr<APIStatus> SetCommentTextResponse::getStatus() const
 void SetCommentTextResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool SetCommentTextResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void SetCommentTextResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
@@ -21,8 +21,6 @@ namespace model {
 SetUserTrustFactorResponse::SetUserTrustFactorResponse()
 {
     m_PreviousManualTrustFactor = 0.0;
-    m_PreviousManualTrustFactorIsSet = false;
-    m_StatusIsSet = false;
 }
 
 SetUserTrustFactorResponse::~SetUserTrustFactorResponse()
@@ -37,12 +35,12 @@ void SetUserTrustFactorResponse::validate()
 web::json::value SetUserTrustFactorResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_PreviousManualTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_PreviousManualTrustFactor))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("previousManualTrustFactor"))] = ModelBase::toJson(m_PreviousManualTrustFactor);
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
@@ -51,32 +49,119 @@ web::json::value SetUserTrustFactorResponse::toJson() const
     return val;
 }
 
+void SetUserTrustFactorResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_PreviousManualTrustFactor))
+    {
+        
+        writer.key(_XPLATSTR("previousManualTrustFactor"));
+        ModelBase::writeJson(writer, m_PreviousManualTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+
+    writer.endObject();
+}
+
 bool SetUserTrustFactorResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("previousManualTrustFactor"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("previousManualTrustFactor")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setPreviousManualTrustFactor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPreviousManualTrustFactor);
-            setPreviousManualTrustFactor(refVal_setPreviousManualTrustFactor);
-            
+        case ModelBase::fieldHash(_XPLATSTR("previousManualTrustFactor")):
+            if(field.first == _XPLATSTR("previousManualTrustFactor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setPreviousManualTrustFactor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPreviousManualTrustFactor);
+                    setPreviousManualTrustFactor(refVal_setPreviousManualTrustFactor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    return ok;
+}
+
+void SetUserTrustFactorResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_PreviousManualTrustFactor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("previousManualTrustFactor")), m_PreviousManualTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+}
+
+bool SetUserTrustFactorResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("previousManualTrustFactor")):
+            {
+                double refVal_setPreviousManualTrustFactor;
+                if(!ModelBase::readBinary(reader, field, refVal_setPreviousManualTrustFactor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPreviousManualTrustFactor(refVal_setPreviousManualTrustFactor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void SetUserTrustFactorResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +171,11 @@ void SetUserTrustFactorResponse::toMultipart(std::shared_ptr<MultipartFormData>
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_PreviousManualTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_PreviousManualTrustFactor))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("previousManualTrustFactor")), m_PreviousManualTrustFactor));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
@@ -129,17 +214,17 @@ double SetUserTrustFactorResponse::getPreviousManualTrustFactor() const
 void SetUserTrustFactorResponse::setPreviousManualTrustFactor(double value)
 {
     m_PreviousManualTrustFactor = value;
-    m_PreviousManualTrustFactorIsSet = true;
+    m_FieldsSet.set(FieldBit_PreviousManualTrustFactor);
 }
 
 bool SetUserTrustFactorResponse::previousManualTrustFactorIsSet() const
 {
-    return m_PreviousManualTrustFactorIsSet;
+    return m_FieldsSet.test(FieldBit_PreviousManualTrustFactor);
 }
 
 void SetUserTrustFactorResponse::unsetPreviousManualTrustFactor()
 {
-    m_PreviousManualTrustFactorIsSet = false;
+    m_FieldsSet.reset(FieldBit_PreviousManualTrustFactor);
 }
 std::shared_ptr<APIStatus> SetUserTrustFactorResponse::getStatus() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<APIStatus> SetUserTrustFactorResponse::getStatus() const
 void SetUserTrustFactorResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool SetUserTrustFactorResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void SetUserTrustFactorResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 
 }
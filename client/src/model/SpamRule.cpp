@@ -20,9 +20,6 @@ namespace model {
 
 SpamRule::SpamRule()
 {
-    m_ActionsIsSet = false;
-    m_CommentContains = utility::conversions::to_string_t("");
-    m_CommentContainsIsSet = false;
 }
 
 SpamRule::~SpamRule()
@@ -37,14 +34,14 @@ void SpamRule::validate()
 web::json::value SpamRule::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ActionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Actions))
     {
         
         std::vector<utility::string_t> refVal = fromActionsEnum(m_Actions);
         val[utility::conversions::to_string_t(_XPLATSTR("actions"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_CommentContainsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentContains))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentContains"))] = ModelBase::toJson(m_CommentContains);
@@ -53,33 +50,123 @@ web::json::value SpamRule::toJson() const
     return val;
 }
 
+void SpamRule::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Actions))
+    {
+        
+        std::vector<utility::string_t> refVal = fromActionsEnum(m_Actions);
+        writer.key(_XPLATSTR("actions"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_CommentContains))
+    {
+        
+        writer.key(_XPLATSTR("commentContains"));
+        ModelBase::writeJson(writer, m_CommentContains);
+    }
+
+    writer.endObject();
+}
+
 bool SpamRule::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("actions"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("actions")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setActions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setActions);
-            
-            setActions(toActionsEnum(refVal_setActions));
-            
+        case ModelBase::fieldHash(_XPLATSTR("actions")):
+            if(field.first == _XPLATSTR("actions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setActions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setActions);
+                    setActions(toActionsEnum(refVal_setActions));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentContains")):
+            if(field.first == _XPLATSTR("commentContains"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommentContains;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentContains);
+                    setCommentContains(refVal_setCommentContains);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentContains"))))
+    return ok;
+}
+
+void SpamRule::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Actions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentContains")));
-        if(!fieldValue.is_null())
+        
+        std::vector<utility::string_t> refVal = fromActionsEnum(m_Actions);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("actions")), refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_CommentContains))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentContains")), m_CommentContains);
+    }
+}
+
+bool SpamRule::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setCommentContains;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentContains);
-            setCommentContains(refVal_setCommentContains);
-            
+        case ModelBase::fieldHash(_XPLATSTR("actions")):
+            {
+                std::vector<utility::string_t> refVal_setActions;
+                if(!ModelBase::readBinary(reader, field, refVal_setActions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setActions(toActionsEnum(refVal_setActions));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentContains")):
+            {
+                utility::string_t refVal_setCommentContains;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentContains))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentContains(refVal_setCommentContains);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void SpamRule::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -89,11 +176,11 @@ void SpamRule::toMultipart(std::shared_ptr<MultipartFormData> multipart, const u
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ActionsIsSet)
+    if(m_FieldsSet.test(FieldBit_Actions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("actions")), fromActionsEnum(m_Actions)));
             }
-    if(m_CommentContainsIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentContains))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentContains")), m_CommentContains));
     }
@@ -182,17 +269,17 @@ std::vector<SpamRule::ActionsEnum> SpamRule::getActions() const
 void SpamRule::setActions(const std::vector<ActionsEnum> value)
 {
     m_Actions = value;
-    m_ActionsIsSet = true;
+    m_FieldsSet.set(FieldBit_Actions);
 }
 
 bool SpamRule::actionsIsSet() const
 {
-    return m_ActionsIsSet;
+    return m_FieldsSet.test(FieldBit_Actions);
 }
 
 void SpamRule::unsetActions()
 {
-    m_ActionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Actions);
 }
 utility::string_t SpamRule::getCommentContains() const
 {
@@ -203,17 +290,17 @@ utility::string_t SpamRule::getCommentContains() const
 void SpamRule::setCommentContains(const utility::string_t& value)
 {
     m_CommentContains = value;
-    m_CommentContainsIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentContains);
 }
 
 bool SpamRule::commentContainsIsSet() const
 {
-    return m_CommentContainsIsSet;
+    return m_FieldsSet.test(FieldBit_CommentContains);
 }
 
 void SpamRule::unsetCommentContains()
 {
-    m_CommentContainsIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentContains);
 }
 
 }
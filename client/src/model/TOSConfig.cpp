@@ -21,10 +21,6 @@ namespace model {
 TOSConfig::TOSConfig()
 {
     m_Enabled = false;
-    m_EnabledIsSet = false;
-    m_TextByLocaleIsSet = false;
-    m_LastUpdated = utility::datetime();
-    m_LastUpdatedIsSet = false;
 }
 
 TOSConfig::~TOSConfig()
@@ -39,17 +35,17 @@ void TOSConfig::validate()
 web::json::value TOSConfig::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_EnabledIsSet)
+    if(m_FieldsSet.test(FieldBit_Enabled))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enabled"))] = ModelBase::toJson(m_Enabled);
     }
-    if(m_TextByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TextByLocale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("textByLocale"))] = ModelBase::toJson(m_TextByLocale);
     }
-    if(m_LastUpdatedIsSet)
+    if(m_FieldsSet.test(FieldBit_LastUpdated))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastUpdated"))] = ModelBase::toJson(m_LastUpdated);
@@ -58,43 +54,153 @@ web::json::value TOSConfig::toJson() const
     return val;
 }
 
+void TOSConfig::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Enabled))
+    {
+        
+        writer.key(_XPLATSTR("enabled"));
+        ModelBase::writeJson(writer, m_Enabled);
+    }
+    if(m_FieldsSet.test(FieldBit_TextByLocale))
+    {
+        
+        writer.key(_XPLATSTR("textByLocale"));
+        ModelBase::writeJson(writer, m_TextByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_LastUpdated))
+    {
+        
+        writer.key(_XPLATSTR("lastUpdated"));
+        ModelBase::writeJson(writer, m_LastUpdated);
+    }
+
+    writer.endObject();
+}
+
 bool TOSConfig::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enabled"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enabled")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnabled;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnabled);
-            setEnabled(refVal_setEnabled);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("textByLocale"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("textByLocale")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::map<utility::string_t, utility::string_t> refVal_setTextByLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTextByLocale);
-            setTextByLocale(refVal_setTextByLocale);
-            
+        case ModelBase::fieldHash(_XPLATSTR("enabled")):
+            if(field.first == _XPLATSTR("enabled"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnabled;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnabled);
+                    setEnabled(refVal_setEnabled);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("textByLocale")):
+            if(field.first == _XPLATSTR("textByLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setTextByLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTextByLocale);
+                    setTextByLocale(refVal_setTextByLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastUpdated")):
+            if(field.first == _XPLATSTR("lastUpdated"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setLastUpdated;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastUpdated);
+                    setLastUpdated(refVal_setLastUpdated);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastUpdated"))))
+    return ok;
+}
+
+void TOSConfig::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Enabled))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enabled")), m_Enabled);
+    }
+    if(m_FieldsSet.test(FieldBit_TextByLocale))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("textByLocale")), m_TextByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_LastUpdated))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastUpdated")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastUpdated")), m_LastUpdated);
+    }
+}
+
+bool TOSConfig::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::datetime refVal_setLastUpdated;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastUpdated);
-            setLastUpdated(refVal_setLastUpdated);
-            
+        case ModelBase::fieldHash(_XPLATSTR("enabled")):
+            {
+                bool refVal_setEnabled;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnabled))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnabled(refVal_setEnabled);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("textByLocale")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setTextByLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setTextByLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTextByLocale(refVal_setTextByLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastUpdated")):
+            {
+                utility::datetime refVal_setLastUpdated;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastUpdated))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastUpdated(refVal_setLastUpdated);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void TOSConfig::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -104,15 +210,15 @@ void TOSConfig::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_EnabledIsSet)
+    if(m_FieldsSet.test(FieldBit_Enabled))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enabled")), m_Enabled));
     }
-    if(m_TextByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TextByLocale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textByLocale")), m_TextByLocale));
     }
-    if(m_LastUpdatedIsSet)
+    if(m_FieldsSet.test(FieldBit_LastUpdated))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastUpdated")), m_LastUpdated));
     }
@@ -157,17 +263,17 @@ bool TOSConfig::isEnabled() const
 void TOSConfig::setEnabled(bool value)
 {
     m_Enabled = value;
-    m_EnabledIsSet = true;
+    m_FieldsSet.set(FieldBit_Enabled);
 }
 
 bool TOSConfig::enabledIsSet() const
 {
-    return m_EnabledIsSet;
+    return m_FieldsSet.test(FieldBit_Enabled);
 }
 
 void TOSConfig::unsetEnabled()
 {
-    m_EnabledIsSet = false;
+    m_FieldsSet.reset(FieldBit_Enabled);
 }
 std::map<utility::string_t, utility::string_t> TOSConfig::getTextByLocale() const
 {
@@ -178,17 +284,17 @@ std::map<utility::string_t, utility::string_t> TOSConfig::getTextByLocale() cons
 void TOSConfig::setTextByLocale(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_TextByLocale = value;
-    m_TextByLocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_TextByLocale);
 }
 
 bool TOSConfig::textByLocaleIsSet() const
 {
-    return m_TextByLocaleIsSet;
+    return m_FieldsSet.test(FieldBit_TextByLocale);
 }
 
 void TOSConfig::unsetTextByLocale()
 {
-    m_TextByLocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_TextByLocale);
 }
 utility::datetime TOSConfig::getLastUpdated() const
 {
@@ -199,17 +305,17 @@ utility::datetime TOSConfig::getLastUpdated() const
 void TOSConfig::setLastUpdated(const utility::datetime& value)
 {
     m_LastUpdated = value;
-    m_LastUpdatedIsSet = true;
+    m_FieldsSet.set(FieldBit_LastUpdated);
 }
 
 bool TOSConfig::lastUpdatedIsSet() const
 {
-    return m_LastUpdatedIsSet;
+    return m_FieldsSet.test(FieldBit_LastUpdated);
 }
 
 void TOSConfig::unsetLastUpdated()
 {
-    m_LastUpdatedIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastUpdated);
 }
 
 }
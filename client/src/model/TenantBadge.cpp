@@ -20,32 +20,13 @@ namespace model {
 
 TenantBadge::TenantBadge()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_CreatedByUserId = utility::conversions::to_string_t("");
-    m_CreatedByUserIdIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
     m_Enabled = false;
-    m_EnabledIsSet = false;
     m_Type = 0.0;
-    m_TypeIsSet = false;
     m_Threshold = 0.0;
-    m_ThresholdIsSet = false;
     m_Uses = 0.0;
-    m_UsesIsSet = false;
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_Description = utility::conversions::to_string_t("");
-    m_DescriptionIsSet = false;
-    m_DisplayLabel = utility::conversions::to_string_t("");
-    m_DisplayLabelIsSet = false;
     m_IsAwaitingReprocess = false;
-    m_IsAwaitingReprocessIsSet = false;
     m_IsAwaitingDeletion = false;
-    m_IsAwaitingDeletionIsSet = false;
+    m_VeteranUserThresholdMillis = 0.0;
 }
 
 TenantBadge::~TenantBadge()
@@ -60,350 +41,874 @@ void TenantBadge::validate()
 web::json::value TenantBadge::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_CreatedByUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedByUserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdByUserId"))] = ModelBase::toJson(m_CreatedByUserId);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_EnabledIsSet)
+    if(m_FieldsSet.test(FieldBit_Enabled))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enabled"))] = ModelBase::toJson(m_Enabled);
     }
-    if(m_UrlId.has_value())
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_ThresholdIsSet)
+    if(m_FieldsSet.test(FieldBit_Threshold))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("threshold"))] = ModelBase::toJson(m_Threshold);
     }
-    if(m_UsesIsSet)
+    if(m_FieldsSet.test(FieldBit_Uses))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("uses"))] = ModelBase::toJson(m_Uses);
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("description"))] = ModelBase::toJson(m_Description);
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_DisplaySrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displaySrc"))] = ModelBase::toJson(m_DisplaySrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displaySrc"))] = ModelBase::toJson(m_DisplaySrc);
     }
-    if(m_BackgroundColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))] = ModelBase::toJson(m_BackgroundColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))] = ModelBase::toJson(m_BackgroundColor);
     }
-    if(m_BorderColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("borderColor"))] = ModelBase::toJson(m_BorderColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("borderColor"))] = ModelBase::toJson(m_BorderColor);
     }
-    if(m_TextColor.has_value())
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("textColor"))] = ModelBase::toJson(m_TextColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("textColor"))] = ModelBase::toJson(m_TextColor);
     }
-    if(m_CssClass.has_value())
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("cssClass"))] = ModelBase::toJson(m_CssClass.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("cssClass"))] = ModelBase::toJson(m_CssClass);
     }
-    if(m_VeteranUserThresholdMillis.has_value())
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis"))] = ModelBase::toJson(m_VeteranUserThresholdMillis.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis"))] = ModelBase::toJson(m_VeteranUserThresholdMillis);
     }
-    if(m_IsAwaitingReprocessIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAwaitingReprocess))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAwaitingReprocess"))] = ModelBase::toJson(m_IsAwaitingReprocess);
     }
-    if(m_IsAwaitingDeletionIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAwaitingDeletion))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAwaitingDeletion"))] = ModelBase::toJson(m_IsAwaitingDeletion);
     }
-    if(m_ReplacesBadgeId.has_value())
+    if(m_FieldsSet.test(FieldBit_ReplacesBadgeId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("replacesBadgeId"))] = ModelBase::toJson(m_ReplacesBadgeId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("replacesBadgeId"))] = ModelBase::toJson(m_ReplacesBadgeId);
     }
 
     return val;
 }
 
+void TenantBadge::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedByUserId))
+    {
+        
+        writer.key(_XPLATSTR("createdByUserId"));
+        ModelBase::writeJson(writer, m_CreatedByUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Enabled))
+    {
+        
+        writer.key(_XPLATSTR("enabled"));
+        ModelBase::writeJson(writer, m_Enabled);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Threshold))
+    {
+        
+        writer.key(_XPLATSTR("threshold"));
+        ModelBase::writeJson(writer, m_Threshold);
+    }
+    if(m_FieldsSet.test(FieldBit_Uses))
+    {
+        
+        writer.key(_XPLATSTR("uses"));
+        ModelBase::writeJson(writer, m_Uses);
+    }
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Description))
+    {
+        
+        writer.key(_XPLATSTR("description"));
+        ModelBase::writeJson(writer, m_Description);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
+    {
+        
+        writer.key(_XPLATSTR("displaySrc"));
+        ModelBase::writeJson(writer, m_DisplaySrc);
+    }
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
+    {
+        
+        writer.key(_XPLATSTR("backgroundColor"));
+        ModelBase::writeJson(writer, m_BackgroundColor);
+    }
+    if(m_FieldsSet.test(FieldBit_BorderColor))
+    {
+        
+        writer.key(_XPLATSTR("borderColor"));
+        ModelBase::writeJson(writer, m_BorderColor);
+    }
+    if(m_FieldsSet.test(FieldBit_TextColor))
+    {
+        
+        writer.key(_XPLATSTR("textColor"));
+        ModelBase::writeJson(writer, m_TextColor);
+    }
+    if(m_FieldsSet.test(FieldBit_CssClass))
+    {
+        
+        writer.key(_XPLATSTR("cssClass"));
+        ModelBase::writeJson(writer, m_CssClass);
+    }
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
+    {
+        
+        writer.key(_XPLATSTR("veteranUserThresholdMillis"));
+        ModelBase::writeJson(writer, m_VeteranUserThresholdMillis);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAwaitingReprocess))
+    {
+        
+        writer.key(_XPLATSTR("isAwaitingReprocess"));
+        ModelBase::writeJson(writer, m_IsAwaitingReprocess);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAwaitingDeletion))
+    {
+        
+        writer.key(_XPLATSTR("isAwaitingDeletion"));
+        ModelBase::writeJson(writer, m_IsAwaitingDeletion);
+    }
+    if(m_FieldsSet.test(FieldBit_ReplacesBadgeId))
+    {
+        
+        writer.key(_XPLATSTR("replacesBadgeId"));
+        ModelBase::writeJson(writer, m_ReplacesBadgeId);
+    }
+
+    writer.endObject();
+}
+
 bool TenantBadge::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdByUserId")):
+            if(field.first == _XPLATSTR("createdByUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedByUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedByUserId);
+                    setCreatedByUserId(refVal_setCreatedByUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enabled")):
+            if(field.first == _XPLATSTR("enabled"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnabled;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnabled);
+                    setEnabled(refVal_setEnabled);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("threshold")):
+            if(field.first == _XPLATSTR("threshold"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setThreshold;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setThreshold);
+                    setThreshold(refVal_setThreshold);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("uses")):
+            if(field.first == _XPLATSTR("uses"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setUses;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUses);
+                    setUses(refVal_setUses);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            if(field.first == _XPLATSTR("description"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDescription;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
+                    setDescription(refVal_setDescription);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displaySrc")):
+            if(field.first == _XPLATSTR("displaySrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplaySrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplaySrc);
+                    setDisplaySrc(refVal_setDisplaySrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("backgroundColor")):
+            if(field.first == _XPLATSTR("backgroundColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBackgroundColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBackgroundColor);
+                    setBackgroundColor(refVal_setBackgroundColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("borderColor")):
+            if(field.first == _XPLATSTR("borderColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBorderColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBorderColor);
+                    setBorderColor(refVal_setBorderColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("textColor")):
+            if(field.first == _XPLATSTR("textColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTextColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTextColor);
+                    setTextColor(refVal_setTextColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("cssClass")):
+            if(field.first == _XPLATSTR("cssClass"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCssClass;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCssClass);
+                    setCssClass(refVal_setCssClass);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("veteranUserThresholdMillis")):
+            if(field.first == _XPLATSTR("veteranUserThresholdMillis"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setVeteranUserThresholdMillis;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVeteranUserThresholdMillis);
+                    setVeteranUserThresholdMillis(refVal_setVeteranUserThresholdMillis);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAwaitingReprocess")):
+            if(field.first == _XPLATSTR("isAwaitingReprocess"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAwaitingReprocess;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAwaitingReprocess);
+                    setIsAwaitingReprocess(refVal_setIsAwaitingReprocess);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAwaitingDeletion")):
+            if(field.first == _XPLATSTR("isAwaitingDeletion"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAwaitingDeletion;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAwaitingDeletion);
+                    setIsAwaitingDeletion(refVal_setIsAwaitingDeletion);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("replacesBadgeId")):
+            if(field.first == _XPLATSTR("replacesBadgeId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setReplacesBadgeId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReplacesBadgeId);
+                    setReplacesBadgeId(refVal_setReplacesBadgeId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdByUserId"))))
+    return ok;
+}
+
+void TenantBadge::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdByUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedByUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedByUserId);
-            setCreatedByUserId(refVal_setCreatedByUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enabled"))))
+    if(m_FieldsSet.test(FieldBit_CreatedByUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enabled")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnabled;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnabled);
-            setEnabled(refVal_setEnabled);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdByUserId")), m_CreatedByUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_Enabled))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enabled")), m_Enabled);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("threshold"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("threshold")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setThreshold;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setThreshold);
-            setThreshold(refVal_setThreshold);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("uses"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("uses")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setUses;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUses);
-            setUses(refVal_setUses);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    if(m_FieldsSet.test(FieldBit_Threshold))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("threshold")), m_Threshold);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("description"))))
+    if(m_FieldsSet.test(FieldBit_Uses))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("description")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDescription;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
-            setDescription(refVal_setDescription);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("uses")), m_Uses);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displaySrc"))))
+    if(m_FieldsSet.test(FieldBit_Description))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displaySrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplaySrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplaySrc);
-            setDisplaySrc(refVal_setDisplaySrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("description")), m_Description);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("backgroundColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBackgroundColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBackgroundColor);
-            setBackgroundColor(refVal_setBackgroundColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("borderColor"))))
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("borderColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBorderColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBorderColor);
-            setBorderColor(refVal_setBorderColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displaySrc")), m_DisplaySrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("textColor"))))
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("textColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTextColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTextColor);
-            setTextColor(refVal_setTextColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("backgroundColor")), m_BackgroundColor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("cssClass"))))
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("cssClass")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCssClass;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCssClass);
-            setCssClass(refVal_setCssClass);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("borderColor")), m_BorderColor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis"))))
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setVeteranUserThresholdMillis;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVeteranUserThresholdMillis);
-            setVeteranUserThresholdMillis(refVal_setVeteranUserThresholdMillis);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("textColor")), m_TextColor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAwaitingReprocess"))))
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAwaitingReprocess")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAwaitingReprocess;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAwaitingReprocess);
-            setIsAwaitingReprocess(refVal_setIsAwaitingReprocess);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("cssClass")), m_CssClass);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAwaitingDeletion"))))
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAwaitingDeletion")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAwaitingDeletion;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAwaitingDeletion);
-            setIsAwaitingDeletion(refVal_setIsAwaitingDeletion);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("veteranUserThresholdMillis")), m_VeteranUserThresholdMillis);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAwaitingReprocess))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAwaitingReprocess")), m_IsAwaitingReprocess);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAwaitingDeletion))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAwaitingDeletion")), m_IsAwaitingDeletion);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("replacesBadgeId"))))
+    if(m_FieldsSet.test(FieldBit_ReplacesBadgeId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("replacesBadgeId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("replacesBadgeId")), m_ReplacesBadgeId);
+    }
+}
+
+bool TenantBadge::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setReplacesBadgeId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReplacesBadgeId);
-            setReplacesBadgeId(refVal_setReplacesBadgeId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdByUserId")):
+            {
+                utility::string_t refVal_setCreatedByUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedByUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedByUserId(refVal_setCreatedByUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enabled")):
+            {
+                bool refVal_setEnabled;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnabled))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnabled(refVal_setEnabled);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                double refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("threshold")):
+            {
+                double refVal_setThreshold;
+                if(!ModelBase::readBinary(reader, field, refVal_setThreshold))
+                {
+                    ok = false;
+                    continue;
+                }
+                setThreshold(refVal_setThreshold);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("uses")):
+            {
+                double refVal_setUses;
+                if(!ModelBase::readBinary(reader, field, refVal_setUses))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUses(refVal_setUses);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            {
+                utility::string_t refVal_setDescription;
+                if(!ModelBase::readBinary(reader, field, refVal_setDescription))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDescription(refVal_setDescription);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displaySrc")):
+            {
+                utility::string_t refVal_setDisplaySrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplaySrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplaySrc(refVal_setDisplaySrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("backgroundColor")):
+            {
+                utility::string_t refVal_setBackgroundColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setBackgroundColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBackgroundColor(refVal_setBackgroundColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("borderColor")):
+            {
+                utility::string_t refVal_setBorderColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setBorderColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBorderColor(refVal_setBorderColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("textColor")):
+            {
+                utility::string_t refVal_setTextColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setTextColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTextColor(refVal_setTextColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("cssClass")):
+            {
+                utility::string_t refVal_setCssClass;
+                if(!ModelBase::readBinary(reader, field, refVal_setCssClass))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCssClass(refVal_setCssClass);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("veteranUserThresholdMillis")):
+            {
+                double refVal_setVeteranUserThresholdMillis;
+                if(!ModelBase::readBinary(reader, field, refVal_setVeteranUserThresholdMillis))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVeteranUserThresholdMillis(refVal_setVeteranUserThresholdMillis);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAwaitingReprocess")):
+            {
+                bool refVal_setIsAwaitingReprocess;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAwaitingReprocess))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAwaitingReprocess(refVal_setIsAwaitingReprocess);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAwaitingDeletion")):
+            {
+                bool refVal_setIsAwaitingDeletion;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAwaitingDeletion))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAwaitingDeletion(refVal_setIsAwaitingDeletion);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("replacesBadgeId")):
+            {
+                utility::string_t refVal_setReplacesBadgeId;
+                if(!ModelBase::readBinary(reader, field, refVal_setReplacesBadgeId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReplacesBadgeId(refVal_setReplacesBadgeId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void TenantBadge::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -413,89 +918,89 @@ void TenantBadge::toMultipart(std::shared_ptr<MultipartFormData> multipart, cons
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_CreatedByUserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedByUserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdByUserId")), m_CreatedByUserId));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_EnabledIsSet)
+    if(m_FieldsSet.test(FieldBit_Enabled))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enabled")), m_Enabled));
     }
-    if(m_UrlId.has_value())
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_ThresholdIsSet)
+    if(m_FieldsSet.test(FieldBit_Threshold))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("threshold")), m_Threshold));
     }
-    if(m_UsesIsSet)
+    if(m_FieldsSet.test(FieldBit_Uses))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("uses")), m_Uses));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("description")), m_Description));
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_DisplaySrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displaySrc")), m_DisplaySrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displaySrc")), m_DisplaySrc));
     }
-    if(m_BackgroundColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("backgroundColor")), m_BackgroundColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("backgroundColor")), m_BackgroundColor));
     }
-    if(m_BorderColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("borderColor")), m_BorderColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("borderColor")), m_BorderColor));
     }
-    if(m_TextColor.has_value())
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textColor")), m_TextColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textColor")), m_TextColor));
     }
-    if(m_CssClass.has_value())
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("cssClass")), m_CssClass.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("cssClass")), m_CssClass));
     }
-    if(m_VeteranUserThresholdMillis.has_value())
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis")), m_VeteranUserThresholdMillis.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis")), m_VeteranUserThresholdMillis));
     }
-    if(m_IsAwaitingReprocessIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAwaitingReprocess))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAwaitingReprocess")), m_IsAwaitingReprocess));
     }
-    if(m_IsAwaitingDeletionIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAwaitingDeletion))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAwaitingDeletion")), m_IsAwaitingDeletion));
     }
-    if(m_ReplacesBadgeId.has_value())
+    if(m_FieldsSet.test(FieldBit_ReplacesBadgeId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("replacesBadgeId")), m_ReplacesBadgeId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("replacesBadgeId")), m_ReplacesBadgeId));
     }
 }
 
@@ -647,17 +1152,17 @@ utility::string_t TenantBadge::getId() const
 void TenantBadge::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool TenantBadge::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void TenantBadge::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t TenantBadge::getTenantId() const
 {
@@ -668,17 +1173,17 @@ utility::string_t TenantBadge::getTenantId() const
 void TenantBadge::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool TenantBadge::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void TenantBadge::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t TenantBadge::getCreatedByUserId() const
 {
@@ -689,17 +1194,17 @@ utility::string_t TenantBadge::getCreatedByUserId() const
 void TenantBadge::setCreatedByUserId(const utility::string_t& value)
 {
     m_CreatedByUserId = value;
-    m_CreatedByUserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedByUserId);
 }
 
 bool TenantBadge::createdByUserIdIsSet() const
 {
-    return m_CreatedByUserIdIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedByUserId);
 }
 
 void TenantBadge::unsetCreatedByUserId()
 {
-    m_CreatedByUserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedByUserId);
 }
 utility::datetime TenantBadge::getCreatedAt() const
 {
@@ -710,17 +1215,17 @@ utility::datetime TenantBadge::getCreatedAt() const
 void TenantBadge::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool TenantBadge::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void TenantBadge::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 bool TenantBadge::isEnabled() const
 {
@@ -730,37 +1235,38 @@ bool TenantBadge::isEnabled() const
 void TenantBadge::setEnabled(bool value)
 {
     m_Enabled = value;
-    m_EnabledIsSet = true;
+    m_FieldsSet.set(FieldBit_Enabled);
 }
 
 bool TenantBadge::enabledIsSet() const
 {
-    return m_EnabledIsSet;
+    return m_FieldsSet.test(FieldBit_Enabled);
 }
 
 void TenantBadge::unsetEnabled()
 {
-    m_EnabledIsSet = false;
+    m_FieldsSet.reset(FieldBit_Enabled);
 }
 utility::string_t TenantBadge::getUrlId() const
 {
-    return m_UrlId.get();
+    return m_UrlId;
 }
 
 
 void TenantBadge::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool TenantBadge::urlIdIsSet() const
 {
-    return m_UrlId.has_value();
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void TenantBadge::unsetUrlId()
 {
-    m_UrlId.reset();
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 double TenantBadge::getType() const
 {
@@ -770,17 +1276,17 @@ double TenantBadge::getType() const
 void TenantBadge::setType(double value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool TenantBadge::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void TenantBadge::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 double TenantBadge::getThreshold() const
 {
@@ -790,17 +1296,17 @@ double TenantBadge::getThreshold() const
 void TenantBadge::setThreshold(double value)
 {
     m_Threshold = value;
-    m_ThresholdIsSet = true;
+    m_FieldsSet.set(FieldBit_Threshold);
 }
 
 bool TenantBadge::thresholdIsSet() const
 {
-    return m_ThresholdIsSet;
+    return m_FieldsSet.test(FieldBit_Threshold);
 }
 
 void TenantBadge::unsetThreshold()
 {
-    m_ThresholdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Threshold);
 }
 double TenantBadge::getUses() const
 {
@@ -810,17 +1316,17 @@ double TenantBadge::getUses() const
 void TenantBadge::setUses(double value)
 {
     m_Uses = value;
-    m_UsesIsSet = true;
+    m_FieldsSet.set(FieldBit_Uses);
 }
 
 bool TenantBadge::usesIsSet() const
 {
-    return m_UsesIsSet;
+    return m_FieldsSet.test(FieldBit_Uses);
 }
 
 void TenantBadge::unsetUses()
 {
-    m_UsesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Uses);
 }
 utility::string_t TenantBadge::getName() const
 {
@@ -831,17 +1337,17 @@ utility::string_t TenantBadge::getName() const
 void TenantBadge::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool TenantBadge::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void TenantBadge::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t TenantBadge::getDescription() const
 {
@@ -852,17 +1358,17 @@ utility::string_t TenantBadge::getDescription() const
 void TenantBadge::setDescription(const utility::string_t& value)
 {
     m_Description = value;
-    m_DescriptionIsSet = true;
+    m_FieldsSet.set(FieldBit_Description);
 }
 
 bool TenantBadge::descriptionIsSet() const
 {
-    return m_DescriptionIsSet;
+    return m_FieldsSet.test(FieldBit_Description);
 }
 
 void TenantBadge::unsetDescription()
 {
-    m_DescriptionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Description);
 }
 utility::string_t TenantBadge::getDisplayLabel() const
 {
@@ -873,136 +1379,142 @@ utility::string_t TenantBadge::getDisplayLabel() const
 void TenantBadge::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
-    m_DisplayLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool TenantBadge::displayLabelIsSet() const
 {
-    return m_DisplayLabelIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void TenantBadge::unsetDisplayLabel()
 {
-    m_DisplayLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 utility::string_t TenantBadge::getDisplaySrc() const
 {
-    return m_DisplaySrc.get();
+    return m_DisplaySrc;
 }
 
 
 void TenantBadge::setDisplaySrc(const utility::string_t& value)
 {
     m_DisplaySrc = value;
+    m_FieldsSet.set(FieldBit_DisplaySrc);
 }
 
 bool TenantBadge::displaySrcIsSet() const
 {
-    return m_DisplaySrc.has_value();
+    return m_FieldsSet.test(FieldBit_DisplaySrc);
 }
 
 void TenantBadge::unsetDisplaySrc()
 {
-    m_DisplaySrc.reset();
+    m_FieldsSet.reset(FieldBit_DisplaySrc);
 }
 utility::string_t TenantBadge::getBackgroundColor() const
 {
-    return m_BackgroundColor.get();
+    return m_BackgroundColor;
 }
 
 
 void TenantBadge::setBackgroundColor(const utility::string_t& value)
 {
     m_BackgroundColor = value;
+    m_FieldsSet.set(FieldBit_BackgroundColor);
 }
 
 bool TenantBadge::backgroundColorIsSet() const
 {
-    return m_BackgroundColor.has_value();
+    return m_FieldsSet.test(FieldBit_BackgroundColor);
 }
 
 void TenantBadge::unsetBackgroundColor()
 {
-    m_BackgroundColor.reset();
+    m_FieldsSet.reset(FieldBit_BackgroundColor);
 }
 utility::string_t TenantBadge::getBorderColor() const
 {
-    return m_BorderColor.get();
+    return m_BorderColor;
 }
 
 
 void TenantBadge::setBorderColor(const utility::string_t& value)
 {
     m_BorderColor = value;
+    m_FieldsSet.set(FieldBit_BorderColor);
 }
 
 bool TenantBadge::borderColorIsSet() const
 {
-    return m_BorderColor.has_value();
+    return m_FieldsSet.test(FieldBit_BorderColor);
 }
 
 void TenantBadge::unsetBorderColor()
 {
-    m_BorderColor.reset();
+    m_FieldsSet.reset(FieldBit_BorderColor);
 }
 utility::string_t TenantBadge::getTextColor() const
 {
-    return m_TextColor.get();
+    return m_TextColor;
 }
 
 
 void TenantBadge::setTextColor(const utility::string_t& value)
 {
     m_TextColor = value;
+    m_FieldsSet.set(FieldBit_TextColor);
 }
 
 bool TenantBadge::textColorIsSet() const
 {
-    return m_TextColor.has_value();
+    return m_FieldsSet.test(FieldBit_TextColor);
 }
 
 void TenantBadge::unsetTextColor()
 {
-    m_TextColor.reset();
+    m_FieldsSet.reset(FieldBit_TextColor);
 }
 utility::string_t TenantBadge::getCssClass() const
 {
-    return m_CssClass.get();
+    return m_CssClass;
 }
 
 
 void TenantBadge::setCssClass(const utility::string_t& value)
 {
     m_CssClass = value;
+    m_FieldsSet.set(FieldBit_CssClass);
 }
 
 bool TenantBadge::cssClassIsSet() const
 {
-    return m_CssClass.has_value();
+    return m_FieldsSet.test(FieldBit_CssClass);
 }
 
 void TenantBadge::unsetCssClass()
 {
-    m_CssClass.reset();
+    m_FieldsSet.reset(FieldBit_CssClass);
 }
 double TenantBadge::getVeteranUserThresholdMillis() const
 {
-    return m_VeteranUserThresholdMillis.get();
+    return m_VeteranUserThresholdMillis;
 }
 
 void TenantBadge::setVeteranUserThresholdMillis(double value)
 {
     m_VeteranUserThresholdMillis = value;
+    m_FieldsSet.set(FieldBit_VeteranUserThresholdMillis);
 }
 
 bool TenantBadge::veteranUserThresholdMillisIsSet() const
 {
-    return m_VeteranUserThresholdMillis.has_value();
+    return m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis);
 }
 
 void TenantBadge::unsetVeteranUserThresholdMillis()
 {
-    m_VeteranUserThresholdMillis.reset();
+    m_FieldsSet.reset(FieldBit_VeteranUserThresholdMillis);
 }
 bool TenantBadge::isIsAwaitingReprocess() const
 {
@@ -1012,17 +1524,17 @@ bool TenantBadge::isIsAwaitingReprocess() const
 void TenantBadge::setIsAwaitingReprocess(bool value)
 {
     m_IsAwaitingReprocess = value;
-    m_IsAwaitingReprocessIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAwaitingReprocess);
 }
 
 bool TenantBadge::isAwaitingReprocessIsSet() const
 {
-    return m_IsAwaitingReprocessIsSet;
+    return m_FieldsSet.test(FieldBit_IsAwaitingReprocess);
 }
 
 void TenantBadge::unsetIsAwaitingReprocess()
 {
-    m_IsAwaitingReprocessIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAwaitingReprocess);
 }
 bool TenantBadge::isIsAwaitingDeletion() const
 {
@@ -1032,37 +1544,38 @@ bool TenantBadge::isIsAwaitingDeletion() const
 void TenantBadge::setIsAwaitingDeletion(bool value)
 {
     m_IsAwaitingDeletion = value;
-    m_IsAwaitingDeletionIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAwaitingDeletion);
 }
 
 bool TenantBadge::isAwaitingDeletionIsSet() const
 {
-    return m_IsAwaitingDeletionIsSet;
+    return m_FieldsSet.test(FieldBit_IsAwaitingDeletion);
 }
 
 void TenantBadge::unsetIsAwaitingDeletion()
 {
-    m_IsAwaitingDeletionIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAwaitingDeletion);
 }
 utility::string_t TenantBadge::getReplacesBadgeId() const
 {
-    return m_ReplacesBadgeId.get();
+    return m_ReplacesBadgeId;
 }
 
 
 void TenantBadge::setReplacesBadgeId(const utility::string_t& value)
 {
     m_ReplacesBadgeId = value;
+    m_FieldsSet.set(FieldBit_ReplacesBadgeId);
 }
 
 bool TenantBadge::replacesBadgeIdIsSet() const
 {
-    return m_ReplacesBadgeId.has_value();
+    return m_FieldsSet.test(FieldBit_ReplacesBadgeId);
 }
 
 void TenantBadge::unsetReplacesBadgeId()
 {
-    m_ReplacesBadgeId.reset();
+    m_FieldsSet.reset(FieldBit_ReplacesBadgeId);
 }
 
 }
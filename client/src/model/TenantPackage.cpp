@@ -20,119 +20,58 @@ namespace model {
 
 TenantPackage::TenantPackage()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_TemplateId = utility::conversions::to_string_t("");
-    m_TemplateIdIsSet = false;
     m_MaxMonthlyPageLoads = 0.0;
-    m_MaxMonthlyPageLoadsIsSet = false;
     m_MaxMonthlyAPICredits = 0.0;
-    m_MaxMonthlyAPICreditsIsSet = false;
     m_MaxMonthlySmallWidgetsCredits = 0.0;
-    m_MaxMonthlySmallWidgetsCreditsIsSet = false;
     m_MaxMonthlyComments = 0.0;
-    m_MaxMonthlyCommentsIsSet = false;
     m_MaxConcurrentUsers = 0.0;
-    m_MaxConcurrentUsersIsSet = false;
     m_MaxTenantUsers = 0.0;
-    m_MaxTenantUsersIsSet = false;
     m_MaxSSOUsers = 0.0;
-    m_MaxSSOUsersIsSet = false;
     m_MaxModerators = 0.0;
-    m_MaxModeratorsIsSet = false;
     m_MaxDomains = 0.0;
-    m_MaxDomainsIsSet = false;
     m_MaxWhiteLabeledTenants = 0.0;
-    m_MaxWhiteLabeledTenantsIsSet = false;
     m_MaxMonthlyEventLogRequests = 0.0;
-    m_MaxMonthlyEventLogRequestsIsSet = false;
     m_MaxCustomCollectionSize = 0.0;
-    m_MaxCustomCollectionSizeIsSet = false;
     m_HasWhiteLabeling = false;
-    m_HasWhiteLabelingIsSet = false;
     m_HasDebranding = false;
-    m_HasDebrandingIsSet = false;
     m_HasLLMSpamDetection = false;
-    m_HasLLMSpamDetectionIsSet = false;
-    m_ForWhoText = utility::conversions::to_string_t("");
-    m_ForWhoTextIsSet = false;
-    m_FeatureTaglinesIsSet = false;
     m_HasAuditing = false;
-    m_HasAuditingIsSet = false;
     m_HasFlexPricing = false;
-    m_HasFlexPricingIsSet = false;
     m_EnableSAML = false;
-    m_EnableSAMLIsSet = false;
     m_EnableCanvasLTI = false;
-    m_EnableCanvasLTIIsSet = false;
     m_FlexPageLoadCostCents = 0.0;
-    m_FlexPageLoadCostCentsIsSet = false;
     m_FlexPageLoadUnit = 0.0;
-    m_FlexPageLoadUnitIsSet = false;
     m_FlexCommentCostCents = 0.0;
-    m_FlexCommentCostCentsIsSet = false;
     m_FlexCommentUnit = 0.0;
-    m_FlexCommentUnitIsSet = false;
     m_FlexSSOUserCostCents = 0.0;
-    m_FlexSSOUserCostCentsIsSet = false;
     m_FlexSSOUserUnit = 0.0;
-    m_FlexSSOUserUnitIsSet = false;
     m_FlexAPICreditCostCents = 0.0;
-    m_FlexAPICreditCostCentsIsSet = false;
     m_FlexAPICreditUnit = 0.0;
-    m_FlexAPICreditUnitIsSet = false;
     m_FlexSmallWidgetsCreditCostCents = 0.0;
-    m_FlexSmallWidgetsCreditCostCentsIsSet = false;
     m_FlexSmallWidgetsCreditUnit = 0.0;
-    m_FlexSmallWidgetsCreditUnitIsSet = false;
     m_FlexModeratorCostCents = 0.0;
-    m_FlexModeratorCostCentsIsSet = false;
     m_FlexModeratorUnit = 0.0;
-    m_FlexModeratorUnitIsSet = false;
     m_FlexAdminCostCents = 0.0;
-    m_FlexAdminCostCentsIsSet = false;
     m_FlexAdminUnit = 0.0;
-    m_FlexAdminUnitIsSet = false;
     m_FlexDomainCostCents = 0.0;
-    m_FlexDomainCostCentsIsSet = false;
     m_FlexDomainUnit = 0.0;
-    m_FlexDomainUnitIsSet = false;
     m_FlexChatGPTCostCents = 0.0;
-    m_FlexChatGPTCostCentsIsSet = false;
     m_FlexChatGPTUnit = 0.0;
-    m_FlexChatGPTUnitIsSet = false;
     m_FlexLLMCostCents = 0.0;
-    m_FlexLLMCostCentsIsSet = false;
     m_FlexLLMUnit = 0.0;
-    m_FlexLLMUnitIsSet = false;
     m_FlexMinimumCostCents = 0.0;
-    m_FlexMinimumCostCentsIsSet = false;
     m_FlexManagedTenantCostCents = 0.0;
-    m_FlexManagedTenantCostCentsIsSet = false;
     m_FlexSSOAdminCostCents = 0.0;
-    m_FlexSSOAdminCostCentsIsSet = false;
     m_FlexSSOAdminUnit = 0.0;
-    m_FlexSSOAdminUnitIsSet = false;
     m_FlexSSOModeratorCostCents = 0.0;
-    m_FlexSSOModeratorCostCentsIsSet = false;
     m_FlexSSOModeratorUnit = 0.0;
-    m_FlexSSOModeratorUnitIsSet = false;
     m_IsSSOBillingMonthlyActiveUsers = false;
-    m_IsSSOBillingMonthlyActiveUsersIsSet = false;
     m_HasAIAgents = false;
-    m_HasAIAgentsIsSet = false;
     m_MaxAIAgents = 0.0;
-    m_MaxAIAgentsIsSet = false;
     m_AiAgentDailyBudgetCents = 0.0;
-    m_AiAgentDailyBudgetCentsIsSet = false;
     m_AiAgentMonthlyBudgetCents = 0.0;
-    m_AiAgentMonthlyBudgetCentsIsSet = false;
+    m_MonthlyCostUSD = 0.0;
+    m_YearlyCostUSD = 0.0;
 }
 
 TenantPackage::~TenantPackage()
@@ -147,307 +86,307 @@ void TenantPackage::validate()
 web::json::value TenantPackage::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_TemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TemplateId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("templateId"))] = ModelBase::toJson(m_TemplateId);
     }
-    if(m_MonthlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))] = ModelBase::toJson(m_MonthlyCostUSD.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))] = ModelBase::toJson(m_MonthlyCostUSD);
     }
-    if(m_YearlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))] = ModelBase::toJson(m_YearlyCostUSD.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))] = ModelBase::toJson(m_YearlyCostUSD);
     }
-    if(m_MonthlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId"))] = ModelBase::toJson(m_MonthlyStripePlanId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId"))] = ModelBase::toJson(m_MonthlyStripePlanId);
     }
-    if(m_YearlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId"))] = ModelBase::toJson(m_YearlyStripePlanId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId"))] = ModelBase::toJson(m_YearlyStripePlanId);
     }
-    if(m_MaxMonthlyPageLoadsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads"))] = ModelBase::toJson(m_MaxMonthlyPageLoads);
     }
-    if(m_MaxMonthlyAPICreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits"))] = ModelBase::toJson(m_MaxMonthlyAPICredits);
     }
-    if(m_MaxMonthlySmallWidgetsCreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits"))] = ModelBase::toJson(m_MaxMonthlySmallWidgetsCredits);
     }
-    if(m_MaxMonthlyCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments"))] = ModelBase::toJson(m_MaxMonthlyComments);
     }
-    if(m_MaxConcurrentUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers"))] = ModelBase::toJson(m_MaxConcurrentUsers);
     }
-    if(m_MaxTenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers"))] = ModelBase::toJson(m_MaxTenantUsers);
     }
-    if(m_MaxSSOUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers"))] = ModelBase::toJson(m_MaxSSOUsers);
     }
-    if(m_MaxModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxModerators"))] = ModelBase::toJson(m_MaxModerators);
     }
-    if(m_MaxDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxDomains"))] = ModelBase::toJson(m_MaxDomains);
     }
-    if(m_MaxWhiteLabeledTenantsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants"))] = ModelBase::toJson(m_MaxWhiteLabeledTenants);
     }
-    if(m_MaxMonthlyEventLogRequestsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests"))] = ModelBase::toJson(m_MaxMonthlyEventLogRequests);
     }
-    if(m_MaxCustomCollectionSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize"))] = ModelBase::toJson(m_MaxCustomCollectionSize);
     }
-    if(m_HasWhiteLabelingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling"))] = ModelBase::toJson(m_HasWhiteLabeling);
     }
-    if(m_HasDebrandingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasDebranding"))] = ModelBase::toJson(m_HasDebranding);
     }
-    if(m_HasLLMSpamDetectionIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection"))] = ModelBase::toJson(m_HasLLMSpamDetection);
     }
-    if(m_ForWhoTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("forWhoText"))] = ModelBase::toJson(m_ForWhoText);
     }
-    if(m_FeatureTaglinesIsSet)
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("featureTaglines"))] = ModelBase::toJson(m_FeatureTaglines);
     }
-    if(m_HasAuditingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasAuditing"))] = ModelBase::toJson(m_HasAuditing);
     }
-    if(m_HasFlexPricingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing"))] = ModelBase::toJson(m_HasFlexPricing);
     }
-    if(m_EnableSAMLIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableSAML"))] = ModelBase::toJson(m_EnableSAML);
     }
-    if(m_EnableCanvasLTIIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableCanvasLTI))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableCanvasLTI"))] = ModelBase::toJson(m_EnableCanvasLTI);
     }
-    if(m_FlexPageLoadCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents"))] = ModelBase::toJson(m_FlexPageLoadCostCents);
     }
-    if(m_FlexPageLoadUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit"))] = ModelBase::toJson(m_FlexPageLoadUnit);
     }
-    if(m_FlexCommentCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents"))] = ModelBase::toJson(m_FlexCommentCostCents);
     }
-    if(m_FlexCommentUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit"))] = ModelBase::toJson(m_FlexCommentUnit);
     }
-    if(m_FlexSSOUserCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents"))] = ModelBase::toJson(m_FlexSSOUserCostCents);
     }
-    if(m_FlexSSOUserUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit"))] = ModelBase::toJson(m_FlexSSOUserUnit);
     }
-    if(m_FlexAPICreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents"))] = ModelBase::toJson(m_FlexAPICreditCostCents);
     }
-    if(m_FlexAPICreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit"))] = ModelBase::toJson(m_FlexAPICreditUnit);
     }
-    if(m_FlexSmallWidgetsCreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents"))] = ModelBase::toJson(m_FlexSmallWidgetsCreditCostCents);
     }
-    if(m_FlexSmallWidgetsCreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit"))] = ModelBase::toJson(m_FlexSmallWidgetsCreditUnit);
     }
-    if(m_FlexModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents"))] = ModelBase::toJson(m_FlexModeratorCostCents);
     }
-    if(m_FlexModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit"))] = ModelBase::toJson(m_FlexModeratorUnit);
     }
-    if(m_FlexAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents"))] = ModelBase::toJson(m_FlexAdminCostCents);
     }
-    if(m_FlexAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit"))] = ModelBase::toJson(m_FlexAdminUnit);
     }
-    if(m_FlexDomainCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents"))] = ModelBase::toJson(m_FlexDomainCostCents);
     }
-    if(m_FlexDomainUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit"))] = ModelBase::toJson(m_FlexDomainUnit);
     }
-    if(m_FlexChatGPTCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexChatGPTCostCents"))] = ModelBase::toJson(m_FlexChatGPTCostCents);
     }
-    if(m_FlexChatGPTUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexChatGPTUnit"))] = ModelBase::toJson(m_FlexChatGPTUnit);
     }
-    if(m_FlexLLMCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents"))] = ModelBase::toJson(m_FlexLLMCostCents);
     }
-    if(m_FlexLLMUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit"))] = ModelBase::toJson(m_FlexLLMUnit);
     }
-    if(m_FlexMinimumCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents"))] = ModelBase::toJson(m_FlexMinimumCostCents);
     }
-    if(m_FlexManagedTenantCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents"))] = ModelBase::toJson(m_FlexManagedTenantCostCents);
     }
-    if(m_FlexSSOAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents"))] = ModelBase::toJson(m_FlexSSOAdminCostCents);
     }
-    if(m_FlexSSOAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit"))] = ModelBase::toJson(m_FlexSSOAdminUnit);
     }
-    if(m_FlexSSOModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents"))] = ModelBase::toJson(m_FlexSSOModeratorCostCents);
     }
-    if(m_FlexSSOModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit"))] = ModelBase::toJson(m_FlexSSOModeratorUnit);
     }
-    if(m_IsSSOBillingMonthlyActiveUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSSOBillingMonthlyActiveUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSSOBillingMonthlyActiveUsers"))] = ModelBase::toJson(m_IsSSOBillingMonthlyActiveUsers);
     }
-    if(m_HasAIAgentsIsSet)
+    if(m_FieldsSet.test(FieldBit_HasAIAgents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasAIAgents"))] = ModelBase::toJson(m_HasAIAgents);
     }
-    if(m_MaxAIAgentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxAIAgents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxAIAgents"))] = ModelBase::toJson(m_MaxAIAgents);
     }
-    if(m_AiAgentDailyBudgetCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_AiAgentDailyBudgetCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("aiAgentDailyBudgetCents"))] = ModelBase::toJson(m_AiAgentDailyBudgetCents);
     }
-    if(m_AiAgentMonthlyBudgetCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_AiAgentMonthlyBudgetCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("aiAgentMonthlyBudgetCents"))] = ModelBase::toJson(m_AiAgentMonthlyBudgetCents);
@@ -456,681 +395,2125 @@ web::json::value TenantPackage::toJson() const
     return val;
 }
 
+void TenantPackage::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_TemplateId))
+    {
+        
+        writer.key(_XPLATSTR("templateId"));
+        ModelBase::writeJson(writer, m_TemplateId);
+    }
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
+    {
+        
+        writer.key(_XPLATSTR("monthlyCostUSD"));
+        ModelBase::writeJson(writer, m_MonthlyCostUSD);
+    }
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
+    {
+        
+        writer.key(_XPLATSTR("yearlyCostUSD"));
+        ModelBase::writeJson(writer, m_YearlyCostUSD);
+    }
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
+    {
+        
+        writer.key(_XPLATSTR("monthlyStripePlanId"));
+        ModelBase::writeJson(writer, m_MonthlyStripePlanId);
+    }
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
+    {
+        
+        writer.key(_XPLATSTR("yearlyStripePlanId"));
+        ModelBase::writeJson(writer, m_YearlyStripePlanId);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyPageLoads"));
+        ModelBase::writeJson(writer, m_MaxMonthlyPageLoads);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyAPICredits"));
+        ModelBase::writeJson(writer, m_MaxMonthlyAPICredits);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlySmallWidgetsCredits"));
+        ModelBase::writeJson(writer, m_MaxMonthlySmallWidgetsCredits);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyComments"));
+        ModelBase::writeJson(writer, m_MaxMonthlyComments);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxConcurrentUsers"));
+        ModelBase::writeJson(writer, m_MaxConcurrentUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxTenantUsers"));
+        ModelBase::writeJson(writer, m_MaxTenantUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxSSOUsers"));
+        ModelBase::writeJson(writer, m_MaxSSOUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
+    {
+        
+        writer.key(_XPLATSTR("maxModerators"));
+        ModelBase::writeJson(writer, m_MaxModerators);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
+    {
+        
+        writer.key(_XPLATSTR("maxDomains"));
+        ModelBase::writeJson(writer, m_MaxDomains);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
+    {
+        
+        writer.key(_XPLATSTR("maxWhiteLabeledTenants"));
+        ModelBase::writeJson(writer, m_MaxWhiteLabeledTenants);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyEventLogRequests"));
+        ModelBase::writeJson(writer, m_MaxMonthlyEventLogRequests);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
+    {
+        
+        writer.key(_XPLATSTR("maxCustomCollectionSize"));
+        ModelBase::writeJson(writer, m_MaxCustomCollectionSize);
+    }
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
+    {
+        
+        writer.key(_XPLATSTR("hasWhiteLabeling"));
+        ModelBase::writeJson(writer, m_HasWhiteLabeling);
+    }
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
+    {
+        
+        writer.key(_XPLATSTR("hasDebranding"));
+        ModelBase::writeJson(writer, m_HasDebranding);
+    }
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
+    {
+        
+        writer.key(_XPLATSTR("hasLLMSpamDetection"));
+        ModelBase::writeJson(writer, m_HasLLMSpamDetection);
+    }
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
+    {
+        
+        writer.key(_XPLATSTR("forWhoText"));
+        ModelBase::writeJson(writer, m_ForWhoText);
+    }
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
+    {
+        
+        writer.key(_XPLATSTR("featureTaglines"));
+        ModelBase::writeJson(writer, m_FeatureTaglines);
+    }
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
+    {
+        
+        writer.key(_XPLATSTR("hasAuditing"));
+        ModelBase::writeJson(writer, m_HasAuditing);
+    }
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
+    {
+        
+        writer.key(_XPLATSTR("hasFlexPricing"));
+        ModelBase::writeJson(writer, m_HasFlexPricing);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
+    {
+        
+        writer.key(_XPLATSTR("enableSAML"));
+        ModelBase::writeJson(writer, m_EnableSAML);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableCanvasLTI))
+    {
+        
+        writer.key(_XPLATSTR("enableCanvasLTI"));
+        ModelBase::writeJson(writer, m_EnableCanvasLTI);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexPageLoadCostCents"));
+        ModelBase::writeJson(writer, m_FlexPageLoadCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexPageLoadUnit"));
+        ModelBase::writeJson(writer, m_FlexPageLoadUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexCommentCostCents"));
+        ModelBase::writeJson(writer, m_FlexCommentCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexCommentUnit"));
+        ModelBase::writeJson(writer, m_FlexCommentUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOUserCostCents"));
+        ModelBase::writeJson(writer, m_FlexSSOUserCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOUserUnit"));
+        ModelBase::writeJson(writer, m_FlexSSOUserUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexAPICreditCostCents"));
+        ModelBase::writeJson(writer, m_FlexAPICreditCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexAPICreditUnit"));
+        ModelBase::writeJson(writer, m_FlexAPICreditUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSmallWidgetsCreditCostCents"));
+        ModelBase::writeJson(writer, m_FlexSmallWidgetsCreditCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSmallWidgetsCreditUnit"));
+        ModelBase::writeJson(writer, m_FlexSmallWidgetsCreditUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexModeratorCostCents"));
+        ModelBase::writeJson(writer, m_FlexModeratorCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexModeratorUnit"));
+        ModelBase::writeJson(writer, m_FlexModeratorUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexAdminCostCents"));
+        ModelBase::writeJson(writer, m_FlexAdminCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexAdminUnit"));
+        ModelBase::writeJson(writer, m_FlexAdminUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexDomainCostCents"));
+        ModelBase::writeJson(writer, m_FlexDomainCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexDomainUnit"));
+        ModelBase::writeJson(writer, m_FlexDomainUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexChatGPTCostCents"));
+        ModelBase::writeJson(writer, m_FlexChatGPTCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexChatGPTUnit"));
+        ModelBase::writeJson(writer, m_FlexChatGPTUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexLLMCostCents"));
+        ModelBase::writeJson(writer, m_FlexLLMCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexLLMUnit"));
+        ModelBase::writeJson(writer, m_FlexLLMUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexMinimumCostCents"));
+        ModelBase::writeJson(writer, m_FlexMinimumCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexManagedTenantCostCents"));
+        ModelBase::writeJson(writer, m_FlexManagedTenantCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOAdminCostCents"));
+        ModelBase::writeJson(writer, m_FlexSSOAdminCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOAdminUnit"));
+        ModelBase::writeJson(writer, m_FlexSSOAdminUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOModeratorCostCents"));
+        ModelBase::writeJson(writer, m_FlexSSOModeratorCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOModeratorUnit"));
+        ModelBase::writeJson(writer, m_FlexSSOModeratorUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSSOBillingMonthlyActiveUsers))
+    {
+        
+        writer.key(_XPLATSTR("isSSOBillingMonthlyActiveUsers"));
+        ModelBase::writeJson(writer, m_IsSSOBillingMonthlyActiveUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_HasAIAgents))
+    {
+        
+        writer.key(_XPLATSTR("hasAIAgents"));
+        ModelBase::writeJson(writer, m_HasAIAgents);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxAIAgents))
+    {
+        
+        writer.key(_XPLATSTR("maxAIAgents"));
+        ModelBase::writeJson(writer, m_MaxAIAgents);
+    }
+    if(m_FieldsSet.test(FieldBit_AiAgentDailyBudgetCents))
+    {
+        
+        writer.key(_XPLATSTR("aiAgentDailyBudgetCents"));
+        ModelBase::writeJson(writer, m_AiAgentDailyBudgetCents);
+    }
+    if(m_FieldsSet.test(FieldBit_AiAgentMonthlyBudgetCents))
+    {
+        
+        writer.key(_XPLATSTR("aiAgentMonthlyBudgetCents"));
+        ModelBase::writeJson(writer, m_AiAgentMonthlyBudgetCents);
+    }
+
+    writer.endObject();
+}
+
 bool TenantPackage::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("templateId")):
+            if(field.first == _XPLATSTR("templateId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTemplateId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTemplateId);
+                    setTemplateId(refVal_setTemplateId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")):
+            if(field.first == _XPLATSTR("monthlyCostUSD"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMonthlyCostUSD;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyCostUSD);
+                    setMonthlyCostUSD(refVal_setMonthlyCostUSD);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")):
+            if(field.first == _XPLATSTR("yearlyCostUSD"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setYearlyCostUSD;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyCostUSD);
+                    setYearlyCostUSD(refVal_setYearlyCostUSD);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyStripePlanId")):
+            if(field.first == _XPLATSTR("monthlyStripePlanId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setMonthlyStripePlanId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyStripePlanId);
+                    setMonthlyStripePlanId(refVal_setMonthlyStripePlanId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyStripePlanId")):
+            if(field.first == _XPLATSTR("yearlyStripePlanId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setYearlyStripePlanId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyStripePlanId);
+                    setYearlyStripePlanId(refVal_setYearlyStripePlanId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")):
+            if(field.first == _XPLATSTR("maxMonthlyPageLoads"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyPageLoads;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyPageLoads);
+                    setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")):
+            if(field.first == _XPLATSTR("maxMonthlyAPICredits"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyAPICredits;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyAPICredits);
+                    setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlySmallWidgetsCredits")):
+            if(field.first == _XPLATSTR("maxMonthlySmallWidgetsCredits"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlySmallWidgetsCredits;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlySmallWidgetsCredits);
+                    setMaxMonthlySmallWidgetsCredits(refVal_setMaxMonthlySmallWidgetsCredits);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")):
+            if(field.first == _XPLATSTR("maxMonthlyComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyComments);
+                    setMaxMonthlyComments(refVal_setMaxMonthlyComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")):
+            if(field.first == _XPLATSTR("maxConcurrentUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxConcurrentUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxConcurrentUsers);
+                    setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")):
+            if(field.first == _XPLATSTR("maxTenantUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxTenantUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxTenantUsers);
+                    setMaxTenantUsers(refVal_setMaxTenantUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")):
+            if(field.first == _XPLATSTR("maxSSOUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxSSOUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxSSOUsers);
+                    setMaxSSOUsers(refVal_setMaxSSOUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxModerators")):
+            if(field.first == _XPLATSTR("maxModerators"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxModerators;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxModerators);
+                    setMaxModerators(refVal_setMaxModerators);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxDomains")):
+            if(field.first == _XPLATSTR("maxDomains"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxDomains;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxDomains);
+                    setMaxDomains(refVal_setMaxDomains);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxWhiteLabeledTenants")):
+            if(field.first == _XPLATSTR("maxWhiteLabeledTenants"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxWhiteLabeledTenants;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxWhiteLabeledTenants);
+                    setMaxWhiteLabeledTenants(refVal_setMaxWhiteLabeledTenants);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyEventLogRequests")):
+            if(field.first == _XPLATSTR("maxMonthlyEventLogRequests"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyEventLogRequests;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyEventLogRequests);
+                    setMaxMonthlyEventLogRequests(refVal_setMaxMonthlyEventLogRequests);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")):
+            if(field.first == _XPLATSTR("maxCustomCollectionSize"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxCustomCollectionSize;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCustomCollectionSize);
+                    setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")):
+            if(field.first == _XPLATSTR("hasWhiteLabeling"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasWhiteLabeling;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasWhiteLabeling);
+                    setHasWhiteLabeling(refVal_setHasWhiteLabeling);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasDebranding")):
+            if(field.first == _XPLATSTR("hasDebranding"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasDebranding;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasDebranding);
+                    setHasDebranding(refVal_setHasDebranding);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasLLMSpamDetection")):
+            if(field.first == _XPLATSTR("hasLLMSpamDetection"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasLLMSpamDetection;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasLLMSpamDetection);
+                    setHasLLMSpamDetection(refVal_setHasLLMSpamDetection);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("forWhoText")):
+            if(field.first == _XPLATSTR("forWhoText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setForWhoText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setForWhoText);
+                    setForWhoText(refVal_setForWhoText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("featureTaglines")):
+            if(field.first == _XPLATSTR("featureTaglines"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeatureTaglines;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeatureTaglines);
+                    setFeatureTaglines(refVal_setFeatureTaglines);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasAuditing")):
+            if(field.first == _XPLATSTR("hasAuditing"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasAuditing;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasAuditing);
+                    setHasAuditing(refVal_setHasAuditing);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")):
+            if(field.first == _XPLATSTR("hasFlexPricing"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasFlexPricing;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasFlexPricing);
+                    setHasFlexPricing(refVal_setHasFlexPricing);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableSAML")):
+            if(field.first == _XPLATSTR("enableSAML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableSAML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSAML);
+                    setEnableSAML(refVal_setEnableSAML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableCanvasLTI")):
+            if(field.first == _XPLATSTR("enableCanvasLTI"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableCanvasLTI;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableCanvasLTI);
+                    setEnableCanvasLTI(refVal_setEnableCanvasLTI);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")):
+            if(field.first == _XPLATSTR("flexPageLoadCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexPageLoadCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadCostCents);
+                    setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")):
+            if(field.first == _XPLATSTR("flexPageLoadUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexPageLoadUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadUnit);
+                    setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")):
+            if(field.first == _XPLATSTR("flexCommentCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexCommentCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentCostCents);
+                    setFlexCommentCostCents(refVal_setFlexCommentCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")):
+            if(field.first == _XPLATSTR("flexCommentUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexCommentUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentUnit);
+                    setFlexCommentUnit(refVal_setFlexCommentUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")):
+            if(field.first == _XPLATSTR("flexSSOUserCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOUserCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserCostCents);
+                    setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")):
+            if(field.first == _XPLATSTR("flexSSOUserUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOUserUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserUnit);
+                    setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")):
+            if(field.first == _XPLATSTR("flexAPICreditCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAPICreditCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditCostCents);
+                    setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")):
+            if(field.first == _XPLATSTR("flexAPICreditUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAPICreditUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditUnit);
+                    setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditCostCents")):
+            if(field.first == _XPLATSTR("flexSmallWidgetsCreditCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSmallWidgetsCreditCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditCostCents);
+                    setFlexSmallWidgetsCreditCostCents(refVal_setFlexSmallWidgetsCreditCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditUnit")):
+            if(field.first == _XPLATSTR("flexSmallWidgetsCreditUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSmallWidgetsCreditUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditUnit);
+                    setFlexSmallWidgetsCreditUnit(refVal_setFlexSmallWidgetsCreditUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")):
+            if(field.first == _XPLATSTR("flexModeratorCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexModeratorCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorCostCents);
+                    setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")):
+            if(field.first == _XPLATSTR("flexModeratorUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexModeratorUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorUnit);
+                    setFlexModeratorUnit(refVal_setFlexModeratorUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")):
+            if(field.first == _XPLATSTR("flexAdminCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAdminCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminCostCents);
+                    setFlexAdminCostCents(refVal_setFlexAdminCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")):
+            if(field.first == _XPLATSTR("flexAdminUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAdminUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminUnit);
+                    setFlexAdminUnit(refVal_setFlexAdminUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")):
+            if(field.first == _XPLATSTR("flexDomainCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexDomainCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainCostCents);
+                    setFlexDomainCostCents(refVal_setFlexDomainCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")):
+            if(field.first == _XPLATSTR("flexDomainUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexDomainUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainUnit);
+                    setFlexDomainUnit(refVal_setFlexDomainUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexChatGPTCostCents")):
+            if(field.first == _XPLATSTR("flexChatGPTCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexChatGPTCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexChatGPTCostCents);
+                    setFlexChatGPTCostCents(refVal_setFlexChatGPTCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexChatGPTUnit")):
+            if(field.first == _XPLATSTR("flexChatGPTUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexChatGPTUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexChatGPTUnit);
+                    setFlexChatGPTUnit(refVal_setFlexChatGPTUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMCostCents")):
+            if(field.first == _XPLATSTR("flexLLMCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexLLMCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMCostCents);
+                    setFlexLLMCostCents(refVal_setFlexLLMCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMUnit")):
+            if(field.first == _XPLATSTR("flexLLMUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexLLMUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMUnit);
+                    setFlexLLMUnit(refVal_setFlexLLMUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")):
+            if(field.first == _XPLATSTR("flexMinimumCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexMinimumCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexMinimumCostCents);
+                    setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexManagedTenantCostCents")):
+            if(field.first == _XPLATSTR("flexManagedTenantCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexManagedTenantCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexManagedTenantCostCents);
+                    setFlexManagedTenantCostCents(refVal_setFlexManagedTenantCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminCostCents")):
+            if(field.first == _XPLATSTR("flexSSOAdminCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOAdminCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminCostCents);
+                    setFlexSSOAdminCostCents(refVal_setFlexSSOAdminCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminUnit")):
+            if(field.first == _XPLATSTR("flexSSOAdminUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOAdminUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminUnit);
+                    setFlexSSOAdminUnit(refVal_setFlexSSOAdminUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorCostCents")):
+            if(field.first == _XPLATSTR("flexSSOModeratorCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOModeratorCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorCostCents);
+                    setFlexSSOModeratorCostCents(refVal_setFlexSSOModeratorCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorUnit")):
+            if(field.first == _XPLATSTR("flexSSOModeratorUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOModeratorUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorUnit);
+                    setFlexSSOModeratorUnit(refVal_setFlexSSOModeratorUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSSOBillingMonthlyActiveUsers")):
+            if(field.first == _XPLATSTR("isSSOBillingMonthlyActiveUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSSOBillingMonthlyActiveUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSSOBillingMonthlyActiveUsers);
+                    setIsSSOBillingMonthlyActiveUsers(refVal_setIsSSOBillingMonthlyActiveUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasAIAgents")):
+            if(field.first == _XPLATSTR("hasAIAgents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasAIAgents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasAIAgents);
+                    setHasAIAgents(refVal_setHasAIAgents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxAIAgents")):
+            if(field.first == _XPLATSTR("maxAIAgents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxAIAgents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxAIAgents);
+                    setMaxAIAgents(refVal_setMaxAIAgents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("aiAgentDailyBudgetCents")):
+            if(field.first == _XPLATSTR("aiAgentDailyBudgetCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAiAgentDailyBudgetCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAiAgentDailyBudgetCents);
+                    setAiAgentDailyBudgetCents(refVal_setAiAgentDailyBudgetCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("aiAgentMonthlyBudgetCents")):
+            if(field.first == _XPLATSTR("aiAgentMonthlyBudgetCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAiAgentMonthlyBudgetCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAiAgentMonthlyBudgetCents);
+                    setAiAgentMonthlyBudgetCents(refVal_setAiAgentMonthlyBudgetCents);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    return ok;
+}
+
+void TenantPackage::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("templateId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("templateId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTemplateId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTemplateId);
-            setTemplateId(refVal_setTemplateId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMonthlyCostUSD;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyCostUSD);
-            setMonthlyCostUSD(refVal_setMonthlyCostUSD);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))))
+    if(m_FieldsSet.test(FieldBit_TemplateId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setYearlyCostUSD;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyCostUSD);
-            setYearlyCostUSD(refVal_setYearlyCostUSD);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("templateId")), m_TemplateId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId"))))
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setMonthlyStripePlanId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyStripePlanId);
-            setMonthlyStripePlanId(refVal_setMonthlyStripePlanId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId"))))
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setYearlyStripePlanId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyStripePlanId);
-            setYearlyStripePlanId(refVal_setYearlyStripePlanId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads"))))
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyPageLoads;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyPageLoads);
-            setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("monthlyStripePlanId")), m_MonthlyStripePlanId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits"))))
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyAPICredits;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyAPICredits);
-            setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("yearlyStripePlanId")), m_YearlyStripePlanId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlySmallWidgetsCredits;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlySmallWidgetsCredits);
-            setMaxMonthlySmallWidgetsCredits(refVal_setMaxMonthlySmallWidgetsCredits);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")), m_MaxMonthlyPageLoads);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyComments);
-            setMaxMonthlyComments(refVal_setMaxMonthlyComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")), m_MaxMonthlyAPICredits);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxConcurrentUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxConcurrentUsers);
-            setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlySmallWidgetsCredits")), m_MaxMonthlySmallWidgetsCredits);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxTenantUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxTenantUsers);
-            setMaxTenantUsers(refVal_setMaxTenantUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")), m_MaxMonthlyComments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxSSOUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxSSOUsers);
-            setMaxSSOUsers(refVal_setMaxSSOUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")), m_MaxConcurrentUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxModerators"))))
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxModerators")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxModerators;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxModerators);
-            setMaxModerators(refVal_setMaxModerators);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")), m_MaxTenantUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxDomains"))))
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxDomains")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxDomains;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxDomains);
-            setMaxDomains(refVal_setMaxDomains);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")), m_MaxSSOUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants"))))
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxWhiteLabeledTenants;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxWhiteLabeledTenants);
-            setMaxWhiteLabeledTenants(refVal_setMaxWhiteLabeledTenants);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxModerators")), m_MaxModerators);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests"))))
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyEventLogRequests;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyEventLogRequests);
-            setMaxMonthlyEventLogRequests(refVal_setMaxMonthlyEventLogRequests);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxDomains")), m_MaxDomains);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize"))))
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxCustomCollectionSize;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCustomCollectionSize);
-            setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxWhiteLabeledTenants")), m_MaxWhiteLabeledTenants);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasWhiteLabeling;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasWhiteLabeling);
-            setHasWhiteLabeling(refVal_setHasWhiteLabeling);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyEventLogRequests")), m_MaxMonthlyEventLogRequests);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasDebranding"))))
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasDebranding")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasDebranding;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasDebranding);
-            setHasDebranding(refVal_setHasDebranding);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")), m_MaxCustomCollectionSize);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection"))))
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasLLMSpamDetection;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasLLMSpamDetection);
-            setHasLLMSpamDetection(refVal_setHasLLMSpamDetection);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")), m_HasWhiteLabeling);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("forWhoText"))))
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("forWhoText")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setForWhoText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setForWhoText);
-            setForWhoText(refVal_setForWhoText);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasDebranding")), m_HasDebranding);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("featureTaglines"))))
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("featureTaglines")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeatureTaglines;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeatureTaglines);
-            setFeatureTaglines(refVal_setFeatureTaglines);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasLLMSpamDetection")), m_HasLLMSpamDetection);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasAuditing"))))
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasAuditing")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasAuditing;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasAuditing);
-            setHasAuditing(refVal_setHasAuditing);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("forWhoText")), m_ForWhoText);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing"))))
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasFlexPricing;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasFlexPricing);
-            setHasFlexPricing(refVal_setHasFlexPricing);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("featureTaglines")), m_FeatureTaglines);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableSAML"))))
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableSAML")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableSAML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSAML);
-            setEnableSAML(refVal_setEnableSAML);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasAuditing")), m_HasAuditing);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableCanvasLTI"))))
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableCanvasLTI")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableCanvasLTI;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableCanvasLTI);
-            setEnableCanvasLTI(refVal_setEnableCanvasLTI);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")), m_HasFlexPricing);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents"))))
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexPageLoadCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadCostCents);
-            setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableSAML")), m_EnableSAML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit"))))
+    if(m_FieldsSet.test(FieldBit_EnableCanvasLTI))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexPageLoadUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadUnit);
-            setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableCanvasLTI")), m_EnableCanvasLTI);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexCommentCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentCostCents);
-            setFlexCommentCostCents(refVal_setFlexCommentCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")), m_FlexPageLoadCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexCommentUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentUnit);
-            setFlexCommentUnit(refVal_setFlexCommentUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")), m_FlexPageLoadUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOUserCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserCostCents);
-            setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")), m_FlexCommentCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOUserUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserUnit);
-            setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")), m_FlexCommentUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAPICreditCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditCostCents);
-            setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")), m_FlexSSOUserCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAPICreditUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditUnit);
-            setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")), m_FlexSSOUserUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSmallWidgetsCreditCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditCostCents);
-            setFlexSmallWidgetsCreditCostCents(refVal_setFlexSmallWidgetsCreditCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")), m_FlexAPICreditCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSmallWidgetsCreditUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSmallWidgetsCreditUnit);
-            setFlexSmallWidgetsCreditUnit(refVal_setFlexSmallWidgetsCreditUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")), m_FlexAPICreditUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexModeratorCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorCostCents);
-            setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditCostCents")), m_FlexSmallWidgetsCreditCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexModeratorUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorUnit);
-            setFlexModeratorUnit(refVal_setFlexModeratorUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditUnit")), m_FlexSmallWidgetsCreditUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAdminCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminCostCents);
-            setFlexAdminCostCents(refVal_setFlexAdminCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")), m_FlexModeratorCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAdminUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminUnit);
-            setFlexAdminUnit(refVal_setFlexAdminUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")), m_FlexModeratorUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexDomainCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainCostCents);
-            setFlexDomainCostCents(refVal_setFlexDomainCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")), m_FlexAdminCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexDomainUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainUnit);
-            setFlexDomainUnit(refVal_setFlexDomainUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")), m_FlexAdminUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexChatGPTCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexChatGPTCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexChatGPTCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexChatGPTCostCents);
-            setFlexChatGPTCostCents(refVal_setFlexChatGPTCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")), m_FlexDomainCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexChatGPTUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexChatGPTUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexChatGPTUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexChatGPTUnit);
-            setFlexChatGPTUnit(refVal_setFlexChatGPTUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")), m_FlexDomainUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexLLMCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMCostCents);
-            setFlexLLMCostCents(refVal_setFlexLLMCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexChatGPTCostCents")), m_FlexChatGPTCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexLLMUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexLLMUnit);
-            setFlexLLMUnit(refVal_setFlexLLMUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexChatGPTUnit")), m_FlexChatGPTUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexMinimumCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexMinimumCostCents);
-            setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexLLMCostCents")), m_FlexLLMCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexManagedTenantCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexManagedTenantCostCents);
-            setFlexManagedTenantCostCents(refVal_setFlexManagedTenantCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexLLMUnit")), m_FlexLLMUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOAdminCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminCostCents);
-            setFlexSSOAdminCostCents(refVal_setFlexSSOAdminCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")), m_FlexMinimumCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOAdminUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOAdminUnit);
-            setFlexSSOAdminUnit(refVal_setFlexSSOAdminUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexManagedTenantCostCents")), m_FlexManagedTenantCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOModeratorCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorCostCents);
-            setFlexSSOModeratorCostCents(refVal_setFlexSSOModeratorCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOAdminCostCents")), m_FlexSSOAdminCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOModeratorUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOModeratorUnit);
-            setFlexSSOModeratorUnit(refVal_setFlexSSOModeratorUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOAdminUnit")), m_FlexSSOAdminUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSSOBillingMonthlyActiveUsers"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSSOBillingMonthlyActiveUsers")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSSOBillingMonthlyActiveUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSSOBillingMonthlyActiveUsers);
-            setIsSSOBillingMonthlyActiveUsers(refVal_setIsSSOBillingMonthlyActiveUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorCostCents")), m_FlexSSOModeratorCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasAIAgents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasAIAgents")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasAIAgents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasAIAgents);
-            setHasAIAgents(refVal_setHasAIAgents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorUnit")), m_FlexSSOModeratorUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxAIAgents"))))
+    if(m_FieldsSet.test(FieldBit_IsSSOBillingMonthlyActiveUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxAIAgents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxAIAgents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxAIAgents);
-            setMaxAIAgents(refVal_setMaxAIAgents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSSOBillingMonthlyActiveUsers")), m_IsSSOBillingMonthlyActiveUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("aiAgentDailyBudgetCents"))))
+    if(m_FieldsSet.test(FieldBit_HasAIAgents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("aiAgentDailyBudgetCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAiAgentDailyBudgetCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAiAgentDailyBudgetCents);
-            setAiAgentDailyBudgetCents(refVal_setAiAgentDailyBudgetCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasAIAgents")), m_HasAIAgents);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxAIAgents))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxAIAgents")), m_MaxAIAgents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("aiAgentMonthlyBudgetCents"))))
+    if(m_FieldsSet.test(FieldBit_AiAgentDailyBudgetCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("aiAgentMonthlyBudgetCents")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("aiAgentDailyBudgetCents")), m_AiAgentDailyBudgetCents);
+    }
+    if(m_FieldsSet.test(FieldBit_AiAgentMonthlyBudgetCents))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("aiAgentMonthlyBudgetCents")), m_AiAgentMonthlyBudgetCents);
+    }
+}
+
+bool TenantPackage::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            double refVal_setAiAgentMonthlyBudgetCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAiAgentMonthlyBudgetCents);
-            setAiAgentMonthlyBudgetCents(refVal_setAiAgentMonthlyBudgetCents);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("templateId")):
+            {
+                utility::string_t refVal_setTemplateId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTemplateId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTemplateId(refVal_setTemplateId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")):
+            {
+                double refVal_setMonthlyCostUSD;
+                if(!ModelBase::readBinary(reader, field, refVal_setMonthlyCostUSD))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMonthlyCostUSD(refVal_setMonthlyCostUSD);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")):
+            {
+                double refVal_setYearlyCostUSD;
+                if(!ModelBase::readBinary(reader, field, refVal_setYearlyCostUSD))
+                {
+                    ok = false;
+                    continue;
+                }
+                setYearlyCostUSD(refVal_setYearlyCostUSD);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyStripePlanId")):
+            {
+                utility::string_t refVal_setMonthlyStripePlanId;
+                if(!ModelBase::readBinary(reader, field, refVal_setMonthlyStripePlanId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMonthlyStripePlanId(refVal_setMonthlyStripePlanId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyStripePlanId")):
+            {
+                utility::string_t refVal_setYearlyStripePlanId;
+                if(!ModelBase::readBinary(reader, field, refVal_setYearlyStripePlanId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setYearlyStripePlanId(refVal_setYearlyStripePlanId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")):
+            {
+                double refVal_setMaxMonthlyPageLoads;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyPageLoads))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")):
+            {
+                double refVal_setMaxMonthlyAPICredits;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyAPICredits))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlySmallWidgetsCredits")):
+            {
+                double refVal_setMaxMonthlySmallWidgetsCredits;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlySmallWidgetsCredits))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlySmallWidgetsCredits(refVal_setMaxMonthlySmallWidgetsCredits);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")):
+            {
+                double refVal_setMaxMonthlyComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyComments(refVal_setMaxMonthlyComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")):
+            {
+                double refVal_setMaxConcurrentUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxConcurrentUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")):
+            {
+                double refVal_setMaxTenantUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxTenantUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxTenantUsers(refVal_setMaxTenantUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")):
+            {
+                double refVal_setMaxSSOUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxSSOUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxSSOUsers(refVal_setMaxSSOUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxModerators")):
+            {
+                double refVal_setMaxModerators;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxModerators))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxModerators(refVal_setMaxModerators);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxDomains")):
+            {
+                double refVal_setMaxDomains;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxDomains))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxDomains(refVal_setMaxDomains);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxWhiteLabeledTenants")):
+            {
+                double refVal_setMaxWhiteLabeledTenants;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxWhiteLabeledTenants))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxWhiteLabeledTenants(refVal_setMaxWhiteLabeledTenants);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyEventLogRequests")):
+            {
+                double refVal_setMaxMonthlyEventLogRequests;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyEventLogRequests))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyEventLogRequests(refVal_setMaxMonthlyEventLogRequests);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")):
+            {
+                double refVal_setMaxCustomCollectionSize;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxCustomCollectionSize))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")):
+            {
+                bool refVal_setHasWhiteLabeling;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasWhiteLabeling))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasWhiteLabeling(refVal_setHasWhiteLabeling);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasDebranding")):
+            {
+                bool refVal_setHasDebranding;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasDebranding))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasDebranding(refVal_setHasDebranding);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasLLMSpamDetection")):
+            {
+                bool refVal_setHasLLMSpamDetection;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasLLMSpamDetection))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasLLMSpamDetection(refVal_setHasLLMSpamDetection);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("forWhoText")):
+            {
+                utility::string_t refVal_setForWhoText;
+                if(!ModelBase::readBinary(reader, field, refVal_setForWhoText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setForWhoText(refVal_setForWhoText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("featureTaglines")):
+            {
+                std::vector<utility::string_t> refVal_setFeatureTaglines;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeatureTaglines))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeatureTaglines(refVal_setFeatureTaglines);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasAuditing")):
+            {
+                bool refVal_setHasAuditing;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasAuditing))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasAuditing(refVal_setHasAuditing);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")):
+            {
+                bool refVal_setHasFlexPricing;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasFlexPricing))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasFlexPricing(refVal_setHasFlexPricing);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableSAML")):
+            {
+                bool refVal_setEnableSAML;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableSAML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableSAML(refVal_setEnableSAML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableCanvasLTI")):
+            {
+                bool refVal_setEnableCanvasLTI;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableCanvasLTI))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableCanvasLTI(refVal_setEnableCanvasLTI);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")):
+            {
+                double refVal_setFlexPageLoadCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexPageLoadCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")):
+            {
+                double refVal_setFlexPageLoadUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexPageLoadUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")):
+            {
+                double refVal_setFlexCommentCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexCommentCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexCommentCostCents(refVal_setFlexCommentCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")):
+            {
+                double refVal_setFlexCommentUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexCommentUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexCommentUnit(refVal_setFlexCommentUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")):
+            {
+                double refVal_setFlexSSOUserCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOUserCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")):
+            {
+                double refVal_setFlexSSOUserUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOUserUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")):
+            {
+                double refVal_setFlexAPICreditCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAPICreditCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")):
+            {
+                double refVal_setFlexAPICreditUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAPICreditUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditCostCents")):
+            {
+                double refVal_setFlexSmallWidgetsCreditCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSmallWidgetsCreditCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSmallWidgetsCreditCostCents(refVal_setFlexSmallWidgetsCreditCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSmallWidgetsCreditUnit")):
+            {
+                double refVal_setFlexSmallWidgetsCreditUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSmallWidgetsCreditUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSmallWidgetsCreditUnit(refVal_setFlexSmallWidgetsCreditUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")):
+            {
+                double refVal_setFlexModeratorCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexModeratorCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")):
+            {
+                double refVal_setFlexModeratorUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexModeratorUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexModeratorUnit(refVal_setFlexModeratorUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")):
+            {
+                double refVal_setFlexAdminCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAdminCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAdminCostCents(refVal_setFlexAdminCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")):
+            {
+                double refVal_setFlexAdminUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAdminUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAdminUnit(refVal_setFlexAdminUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")):
+            {
+                double refVal_setFlexDomainCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexDomainCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexDomainCostCents(refVal_setFlexDomainCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")):
+            {
+                double refVal_setFlexDomainUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexDomainUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexDomainUnit(refVal_setFlexDomainUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexChatGPTCostCents")):
+            {
+                double refVal_setFlexChatGPTCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexChatGPTCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexChatGPTCostCents(refVal_setFlexChatGPTCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexChatGPTUnit")):
+            {
+                double refVal_setFlexChatGPTUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexChatGPTUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexChatGPTUnit(refVal_setFlexChatGPTUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMCostCents")):
+            {
+                double refVal_setFlexLLMCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexLLMCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexLLMCostCents(refVal_setFlexLLMCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexLLMUnit")):
+            {
+                double refVal_setFlexLLMUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexLLMUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexLLMUnit(refVal_setFlexLLMUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")):
+            {
+                double refVal_setFlexMinimumCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexMinimumCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexManagedTenantCostCents")):
+            {
+                double refVal_setFlexManagedTenantCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexManagedTenantCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexManagedTenantCostCents(refVal_setFlexManagedTenantCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminCostCents")):
+            {
+                double refVal_setFlexSSOAdminCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOAdminCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOAdminCostCents(refVal_setFlexSSOAdminCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOAdminUnit")):
+            {
+                double refVal_setFlexSSOAdminUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOAdminUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOAdminUnit(refVal_setFlexSSOAdminUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorCostCents")):
+            {
+                double refVal_setFlexSSOModeratorCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOModeratorCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOModeratorCostCents(refVal_setFlexSSOModeratorCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOModeratorUnit")):
+            {
+                double refVal_setFlexSSOModeratorUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOModeratorUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOModeratorUnit(refVal_setFlexSSOModeratorUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSSOBillingMonthlyActiveUsers")):
+            {
+                bool refVal_setIsSSOBillingMonthlyActiveUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSSOBillingMonthlyActiveUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSSOBillingMonthlyActiveUsers(refVal_setIsSSOBillingMonthlyActiveUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasAIAgents")):
+            {
+                bool refVal_setHasAIAgents;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasAIAgents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasAIAgents(refVal_setHasAIAgents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxAIAgents")):
+            {
+                double refVal_setMaxAIAgents;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxAIAgents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxAIAgents(refVal_setMaxAIAgents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("aiAgentDailyBudgetCents")):
+            {
+                double refVal_setAiAgentDailyBudgetCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setAiAgentDailyBudgetCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAiAgentDailyBudgetCents(refVal_setAiAgentDailyBudgetCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("aiAgentMonthlyBudgetCents")):
+            {
+                double refVal_setAiAgentMonthlyBudgetCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setAiAgentMonthlyBudgetCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAiAgentMonthlyBudgetCents(refVal_setAiAgentMonthlyBudgetCents);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void TenantPackage::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -1140,247 +2523,247 @@ void TenantPackage::toMultipart(std::shared_ptr<MultipartFormData> multipart, co
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_TemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TemplateId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("templateId")), m_TemplateId));
     }
-    if(m_MonthlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD));
     }
-    if(m_YearlyCostUSD.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD));
     }
-    if(m_MonthlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_MonthlyStripePlanId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId")), m_MonthlyStripePlanId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyStripePlanId")), m_MonthlyStripePlanId));
     }
-    if(m_YearlyStripePlanId.has_value())
+    if(m_FieldsSet.test(FieldBit_YearlyStripePlanId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId")), m_YearlyStripePlanId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyStripePlanId")), m_YearlyStripePlanId));
     }
-    if(m_MaxMonthlyPageLoadsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads")), m_MaxMonthlyPageLoads));
     }
-    if(m_MaxMonthlyAPICreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits")), m_MaxMonthlyAPICredits));
     }
-    if(m_MaxMonthlySmallWidgetsCreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlySmallWidgetsCredits")), m_MaxMonthlySmallWidgetsCredits));
     }
-    if(m_MaxMonthlyCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments")), m_MaxMonthlyComments));
     }
-    if(m_MaxConcurrentUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers")), m_MaxConcurrentUsers));
     }
-    if(m_MaxTenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers")), m_MaxTenantUsers));
     }
-    if(m_MaxSSOUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers")), m_MaxSSOUsers));
     }
-    if(m_MaxModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxModerators")), m_MaxModerators));
     }
-    if(m_MaxDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxDomains")), m_MaxDomains));
     }
-    if(m_MaxWhiteLabeledTenantsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxWhiteLabeledTenants")), m_MaxWhiteLabeledTenants));
     }
-    if(m_MaxMonthlyEventLogRequestsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyEventLogRequests")), m_MaxMonthlyEventLogRequests));
     }
-    if(m_MaxCustomCollectionSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize")), m_MaxCustomCollectionSize));
     }
-    if(m_HasWhiteLabelingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling")), m_HasWhiteLabeling));
     }
-    if(m_HasDebrandingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasDebranding")), m_HasDebranding));
     }
-    if(m_HasLLMSpamDetectionIsSet)
+    if(m_FieldsSet.test(FieldBit_HasLLMSpamDetection))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasLLMSpamDetection")), m_HasLLMSpamDetection));
     }
-    if(m_ForWhoTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("forWhoText")), m_ForWhoText));
     }
-    if(m_FeatureTaglinesIsSet)
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("featureTaglines")), m_FeatureTaglines));
     }
-    if(m_HasAuditingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasAuditing))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasAuditing")), m_HasAuditing));
     }
-    if(m_HasFlexPricingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing")), m_HasFlexPricing));
     }
-    if(m_EnableSAMLIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSAML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableSAML")), m_EnableSAML));
     }
-    if(m_EnableCanvasLTIIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableCanvasLTI))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableCanvasLTI")), m_EnableCanvasLTI));
     }
-    if(m_FlexPageLoadCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents")), m_FlexPageLoadCostCents));
     }
-    if(m_FlexPageLoadUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit")), m_FlexPageLoadUnit));
     }
-    if(m_FlexCommentCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents")), m_FlexCommentCostCents));
     }
-    if(m_FlexCommentUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit")), m_FlexCommentUnit));
     }
-    if(m_FlexSSOUserCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents")), m_FlexSSOUserCostCents));
     }
-    if(m_FlexSSOUserUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit")), m_FlexSSOUserUnit));
     }
-    if(m_FlexAPICreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents")), m_FlexAPICreditCostCents));
     }
-    if(m_FlexAPICreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit")), m_FlexAPICreditUnit));
     }
-    if(m_FlexSmallWidgetsCreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditCostCents")), m_FlexSmallWidgetsCreditCostCents));
     }
-    if(m_FlexSmallWidgetsCreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSmallWidgetsCreditUnit")), m_FlexSmallWidgetsCreditUnit));
     }
-    if(m_FlexModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents")), m_FlexModeratorCostCents));
     }
-    if(m_FlexModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit")), m_FlexModeratorUnit));
     }
-    if(m_FlexAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents")), m_FlexAdminCostCents));
     }
-    if(m_FlexAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit")), m_FlexAdminUnit));
     }
-    if(m_FlexDomainCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents")), m_FlexDomainCostCents));
     }
-    if(m_FlexDomainUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit")), m_FlexDomainUnit));
     }
-    if(m_FlexChatGPTCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexChatGPTCostCents")), m_FlexChatGPTCostCents));
     }
-    if(m_FlexChatGPTUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexChatGPTUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexChatGPTUnit")), m_FlexChatGPTUnit));
     }
-    if(m_FlexLLMCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexLLMCostCents")), m_FlexLLMCostCents));
     }
-    if(m_FlexLLMUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexLLMUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexLLMUnit")), m_FlexLLMUnit));
     }
-    if(m_FlexMinimumCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents")), m_FlexMinimumCostCents));
     }
-    if(m_FlexManagedTenantCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexManagedTenantCostCents")), m_FlexManagedTenantCostCents));
     }
-    if(m_FlexSSOAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminCostCents")), m_FlexSSOAdminCostCents));
     }
-    if(m_FlexSSOAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOAdminUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOAdminUnit")), m_FlexSSOAdminUnit));
     }
-    if(m_FlexSSOModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorCostCents")), m_FlexSSOModeratorCostCents));
     }
-    if(m_FlexSSOModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOModeratorUnit")), m_FlexSSOModeratorUnit));
     }
-    if(m_IsSSOBillingMonthlyActiveUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSSOBillingMonthlyActiveUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSSOBillingMonthlyActiveUsers")), m_IsSSOBillingMonthlyActiveUsers));
     }
-    if(m_HasAIAgentsIsSet)
+    if(m_FieldsSet.test(FieldBit_HasAIAgents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasAIAgents")), m_HasAIAgents));
     }
-    if(m_MaxAIAgentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxAIAgents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxAIAgents")), m_MaxAIAgents));
     }
-    if(m_AiAgentDailyBudgetCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_AiAgentDailyBudgetCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("aiAgentDailyBudgetCents")), m_AiAgentDailyBudgetCents));
     }
-    if(m_AiAgentMonthlyBudgetCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_AiAgentMonthlyBudgetCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("aiAgentMonthlyBudgetCents")), m_AiAgentMonthlyBudgetCents));
     }
@@ -1774,17 +3157,17 @@ utility::string_t TenantPackage::getId() const
 void TenantPackage::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool TenantPackage::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void TenantPackage::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t TenantPackage::getName() const
 {
@@ -1795,17 +3178,17 @@ utility::string_t TenantPackage::getName() const
 void TenantPackage::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool TenantPackage::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void TenantPackage::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t TenantPackage::getTenantId() const
 {
@@ -1816,17 +3199,17 @@ utility::string_t TenantPackage::getTenantId() const
 void TenantPackage::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool TenantPackage::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void TenantPackage::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::datetime TenantPackage::getCreatedAt() const
 {
@@ -1837,17 +3220,17 @@ utility::datetime TenantPackage::getCreatedAt() const
 void TenantPackage::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool TenantPackage::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void TenantPackage::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 utility::string_t TenantPackage::getTemplateId() const
 {
@@ -1858,95 +3241,99 @@ utility::string_t TenantPackage::getTemplateId() const
 void TenantPackage::setTemplateId(const utility::string_t& value)
 {
     m_TemplateId = value;
-    m_TemplateIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TemplateId);
 }
 
 bool TenantPackage::templateIdIsSet() const
 {
-    return m_TemplateIdIsSet;
+    return m_FieldsSet.test(FieldBit_TemplateId);
 }
 
 void TenantPackage::unsetTemplateId()
 {
-    m_TemplateIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TemplateId);
 }
 double TenantPackage::getMonthlyCostUSD() const
 {
-    return m_MonthlyCostUSD.get();
+    return m_MonthlyCostUSD;
 }
 
 void TenantPackage::setMonthlyCostUSD(double value)
 {
     m_MonthlyCostUSD = value;
+    m_FieldsSet.set(FieldBit_MonthlyCostUSD);
 }
 
 bool TenantPackage::monthlyCostUSDIsSet() const
 {
-    return m_MonthlyCostUSD.has_value();
+    return m_FieldsSet.test(FieldBit_MonthlyCostUSD);
 }
 
 void TenantPackage::unsetMonthlyCostUSD()
 {
-    m_MonthlyCostUSD.reset();
+    m_FieldsSet.reset(FieldBit_MonthlyCostUSD);
 }
 double TenantPackage::getYearlyCostUSD() const
 {
-    return m_YearlyCostUSD.get();
+    return m_YearlyCostUSD;
 }
 
 void TenantPackage::setYearlyCostUSD(double value)
 {
     m_YearlyCostUSD = value;
+    m_FieldsSet.set(FieldBit_YearlyCostUSD);
 }
 
 bool TenantPackage::yearlyCostUSDIsSet() const
 {
-    return m_YearlyCostUSD.has_value();
+    return m_FieldsSet.test(FieldBit_YearlyCostUSD);
 }
 
 void TenantPackage::unsetYearlyCostUSD()
 {
-    m_YearlyCostUSD.reset();
+    m_FieldsSet.reset(FieldBit_YearlyCostUSD);
 }
 utility::string_t TenantPackage::getMonthlyStripePlanId() const
 {
-    return m_MonthlyStripePlanId.get();
+    return m_MonthlyStripePlanId;
 }
 
 
 void TenantPackage::setMonthlyStripePlanId(const utility::string_t& value)
 {
     m_MonthlyStripePlanId = value;
+    m_FieldsSet.set(FieldBit_MonthlyStripePlanId);
 }
 
 bool TenantPackage::monthlyStripePlanIdIsSet() const
 {
-    return m_MonthlyStripePlanId.has_value();
+    return m_FieldsSet.test(FieldBit_MonthlyStripePlanId);
 }
 
 void TenantPackage::unsetMonthlyStripePlanId()
 {
-    m_MonthlyStripePlanId.reset();
+    m_FieldsSet.reset(FieldBit_MonthlyStripePlanId);
 }
 utility::string_t TenantPackage::getYearlyStripePlanId() const
 {
-    return m_YearlyStripePlanId.get();
+    return m_YearlyStripePlanId;
 }
 
 
 void TenantPackage::setYearlyStripePlanId(const utility::string_t& value)
 {
     m_YearlyStripePlanId = value;
+    m_FieldsSet.set(FieldBit_YearlyStripePlanId);
 }
 
 bool TenantPackage::yearlyStripePlanIdIsSet() const
 {
-    return m_YearlyStripePlanId.has_value();
+    return m_FieldsSet.test(FieldBit_YearlyStripePlanId);
 }
 
 void TenantPackage::unsetYearlyStripePlanId()
 {
-    m_YearlyStripePlanId.reset();
+    m_FieldsSet.reset(FieldBit_YearlyStripePlanId);
 }
 double TenantPackage::getMaxMonthlyPageLoads() const
 {
@@ -1956,17 +3343,17 @@ double TenantPackage::getMaxMonthlyPageLoads() const
 void TenantPackage::setMaxMonthlyPageLoads(double value)
 {
     m_MaxMonthlyPageLoads = value;
-    m_MaxMonthlyPageLoadsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyPageLoads);
 }
 
 bool TenantPackage::maxMonthlyPageLoadsIsSet() const
 {
-    return m_MaxMonthlyPageLoadsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads);
 }
 
 void TenantPackage::unsetMaxMonthlyPageLoads()
 {
-    m_MaxMonthlyPageLoadsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyPageLoads);
 }
 double TenantPackage::getMaxMonthlyAPICredits() const
 {
@@ -1976,17 +3363,17 @@ double TenantPackage::getMaxMonthlyAPICredits() const
 void TenantPackage::setMaxMonthlyAPICredits(double value)
 {
     m_MaxMonthlyAPICredits = value;
-    m_MaxMonthlyAPICreditsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyAPICredits);
 }
 
 bool TenantPackage::maxMonthlyAPICreditsIsSet() const
 {
-    return m_MaxMonthlyAPICreditsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits);
 }
 
 void TenantPackage::unsetMaxMonthlyAPICredits()
 {
-    m_MaxMonthlyAPICreditsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyAPICredits);
 }
 double TenantPackage::getMaxMonthlySmallWidgetsCredits() const
 {
@@ -1996,17 +3383,17 @@ double TenantPackage::getMaxMonthlySmallWidgetsCredits() const
 void TenantPackage::setMaxMonthlySmallWidgetsCredits(double value)
 {
     m_MaxMonthlySmallWidgetsCredits = value;
-    m_MaxMonthlySmallWidgetsCreditsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlySmallWidgetsCredits);
 }
 
 bool TenantPackage::maxMonthlySmallWidgetsCreditsIsSet() const
 {
-    return m_MaxMonthlySmallWidgetsCreditsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlySmallWidgetsCredits);
 }
 
 void TenantPackage::unsetMaxMonthlySmallWidgetsCredits()
 {
-    m_MaxMonthlySmallWidgetsCreditsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlySmallWidgetsCredits);
 }
 double TenantPackage::getMaxMonthlyComments() const
 {
@@ -2016,17 +3403,17 @@ double TenantPackage::getMaxMonthlyComments() const
 void TenantPackage::setMaxMonthlyComments(double value)
 {
     m_MaxMonthlyComments = value;
-    m_MaxMonthlyCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyComments);
 }
 
 bool TenantPackage::maxMonthlyCommentsIsSet() const
 {
-    return m_MaxMonthlyCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyComments);
 }
 
 void TenantPackage::unsetMaxMonthlyComments()
 {
-    m_MaxMonthlyCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyComments);
 }
 double TenantPackage::getMaxConcurrentUsers() const
 {
@@ -2036,17 +3423,17 @@ double TenantPackage::getMaxConcurrentUsers() const
 void TenantPackage::setMaxConcurrentUsers(double value)
 {
     m_MaxConcurrentUsers = value;
-    m_MaxConcurrentUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxConcurrentUsers);
 }
 
 bool TenantPackage::maxConcurrentUsersIsSet() const
 {
-    return m_MaxConcurrentUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxConcurrentUsers);
 }
 
 void TenantPackage::unsetMaxConcurrentUsers()
 {
-    m_MaxConcurrentUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxConcurrentUsers);
 }
 double TenantPackage::getMaxTenantUsers() const
 {
@@ -2056,17 +3443,17 @@ double TenantPackage::getMaxTenantUsers() const
 void TenantPackage::setMaxTenantUsers(double value)
 {
     m_MaxTenantUsers = value;
-    m_MaxTenantUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxTenantUsers);
 }
 
 bool TenantPackage::maxTenantUsersIsSet() const
 {
-    return m_MaxTenantUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxTenantUsers);
 }
 
 void TenantPackage::unsetMaxTenantUsers()
 {
-    m_MaxTenantUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxTenantUsers);
 }
 double TenantPackage::getMaxSSOUsers() const
 {
@@ -2076,17 +3463,17 @@ double TenantPackage::getMaxSSOUsers() const
 void TenantPackage::setMaxSSOUsers(double value)
 {
     m_MaxSSOUsers = value;
-    m_MaxSSOUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxSSOUsers);
 }
 
 bool TenantPackage::maxSSOUsersIsSet() const
 {
-    return m_MaxSSOUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxSSOUsers);
 }
 
 void TenantPackage::unsetMaxSSOUsers()
 {
-    m_MaxSSOUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxSSOUsers);
 }
 double TenantPackage::getMaxModerators() const
 {
@@ -2096,17 +3483,17 @@ double TenantPackage::getMaxModerators() const
 void TenantPackage::setMaxModerators(double value)
 {
     m_MaxModerators = value;
-    m_MaxModeratorsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxModerators);
 }
 
 bool TenantPackage::maxModeratorsIsSet() const
 {
-    return m_MaxModeratorsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxModerators);
 }
 
 void TenantPackage::unsetMaxModerators()
 {
-    m_MaxModeratorsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxModerators);
 }
 double TenantPackage::getMaxDomains() const
 {
@@ -2116,17 +3503,17 @@ double TenantPackage::getMaxDomains() const
 void TenantPackage::setMaxDomains(double value)
 {
     m_MaxDomains = value;
-    m_MaxDomainsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxDomains);
 }
 
 bool TenantPackage::maxDomainsIsSet() const
 {
-    return m_MaxDomainsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxDomains);
 }
 
 void TenantPackage::unsetMaxDomains()
 {
-    m_MaxDomainsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxDomains);
 }
 double TenantPackage::getMaxWhiteLabeledTenants() const
 {
@@ -2136,17 +3523,17 @@ double TenantPackage::getMaxWhiteLabeledTenants() const
 void TenantPackage::setMaxWhiteLabeledTenants(double value)
 {
     m_MaxWhiteLabeledTenants = value;
-    m_MaxWhiteLabeledTenantsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxWhiteLabeledTenants);
 }
 
 bool TenantPackage::maxWhiteLabeledTenantsIsSet() const
 {
-    return m_MaxWhiteLabeledTenantsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxWhiteLabeledTenants);
 }
 
 void TenantPackage::unsetMaxWhiteLabeledTenants()
 {
-    m_MaxWhiteLabeledTenantsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxWhiteLabeledTenants);
 }
 double TenantPackage::getMaxMonthlyEventLogRequests() const
 {
@@ -2156,17 +3543,17 @@ double TenantPackage::getMaxMonthlyEventLogRequests() const
 void TenantPackage::setMaxMonthlyEventLogRequests(double value)
 {
     m_MaxMonthlyEventLogRequests = value;
-    m_MaxMonthlyEventLogRequestsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyEventLogRequests);
 }
 
 bool TenantPackage::maxMonthlyEventLogRequestsIsSet() const
 {
-    return m_MaxMonthlyEventLogRequestsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyEventLogRequests);
 }
 
 void TenantPackage::unsetMaxMonthlyEventLogRequests()
 {
-    m_MaxMonthlyEventLogRequestsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyEventLogRequests);
 }
 double TenantPackage::getMaxCustomCollectionSize() const
 {
@@ -2176,17 +3563,17 @@ double TenantPackage::getMaxCustomCollectionSize() const
 void TenantPackage::setMaxCustomCollectionSize(double value)
 {
     m_MaxCustomCollectionSize = value;
-    m_MaxCustomCollectionSizeIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxCustomCollectionSize);
 }
 
 bool TenantPackage::maxCustomCollectionSizeIsSet() const
 {
-    return m_MaxCustomCollectionSizeIsSet;
+    return m_FieldsSet.test(FieldBit_MaxCustomCollectionSize);
 }
 
 void TenantPackage::unsetMaxCustomCollectionSize()
 {
-    m_MaxCustomCollectionSizeIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxCustomCollectionSize);
 }
 bool TenantPackage::isHasWhiteLabeling() const
 {
@@ -2196,17 +3583,17 @@ bool TenantPackage::isHasWhiteLabeling() const
 void TenantPackage::setHasWhiteLabeling(bool value)
 {
     m_HasWhiteLabeling = value;
-    m_HasWhiteLabelingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasWhiteLabeling);
 }
 
 bool TenantPackage::hasWhiteLabelingIsSet() const
 {
-    return m_HasWhiteLabelingIsSet;
+    return m_FieldsSet.test(FieldBit_HasWhiteLabeling);
 }
 
 void TenantPackage::unsetHasWhiteLabeling()
 {
-    m_HasWhiteLabelingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasWhiteLabeling);
 }
 bool TenantPackage::isHasDebranding() const
 {
@@ -2216,17 +3603,17 @@ bool TenantPackage::isHasDebranding() const
 void TenantPackage::setHasDebranding(bool value)
 {
     m_HasDebranding = value;
-    m_HasDebrandingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasDebranding);
 }
 
 bool TenantPackage::hasDebrandingIsSet() const
 {
-    return m_HasDebrandingIsSet;
+    return m_FieldsSet.test(FieldBit_HasDebranding);
 }
 
 void TenantPackage::unsetHasDebranding()
 {
-    m_HasDebrandingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasDebranding);
 }
 bool TenantPackage::isHasLLMSpamDetection() const
 {
@@ -2236,17 +3623,17 @@ bool TenantPackage::isHasLLMSpamDetection() const
 void TenantPackage::setHasLLMSpamDetection(bool value)
 {
     m_HasLLMSpamDetection = value;
-    m_HasLLMSpamDetectionIsSet = true;
+    m_FieldsSet.set(FieldBit_HasLLMSpamDetection);
 }
 
 bool TenantPackage::hasLLMSpamDetectionIsSet() const
 {
-    return m_HasLLMSpamDetectionIsSet;
+    return m_FieldsSet.test(FieldBit_HasLLMSpamDetection);
 }
 
 void TenantPackage::unsetHasLLMSpamDetection()
 {
-    m_HasLLMSpamDetectionIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasLLMSpamDetection);
 }
 utility::string_t TenantPackage::getForWhoText() const
 {
@@ -2257,17 +3644,17 @@ utility::string_t TenantPackage::getForWhoText() const
 void TenantPackage::setForWhoText(const utility::string_t& value)
 {
     m_ForWhoText = value;
-    m_ForWhoTextIsSet = true;
+    m_FieldsSet.set(FieldBit_ForWhoText);
 }
 
 bool TenantPackage::forWhoTextIsSet() const
 {
-    return m_ForWhoTextIsSet;
+    return m_FieldsSet.test(FieldBit_ForWhoText);
 }
 
 void TenantPackage::unsetForWhoText()
 {
-    m_ForWhoTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_ForWhoText);
 }
 std::vector<utility::string_t> TenantPackage::getFeatureTaglines() const
 {
@@ -2278,17 +3665,17 @@ std::vector<utility::string_t> TenantPackage::getFeatureTaglines() const
 void TenantPackage::setFeatureTaglines(const std::vector<utility::string_t>& value)
 {
     m_FeatureTaglines = value;
-    m_FeatureTaglinesIsSet = true;
+    m_FieldsSet.set(FieldBit_FeatureTaglines);
 }
 
 bool TenantPackage::featureTaglinesIsSet() const
 {
-    return m_FeatureTaglinesIsSet;
+    return m_FieldsSet.test(FieldBit_FeatureTaglines);
 }
 
 void TenantPackage::unsetFeatureTaglines()
 {
-    m_FeatureTaglinesIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeatureTaglines);
 }
 bool TenantPackage::isHasAuditing() const
 {
@@ -2298,17 +3685,17 @@ bool TenantPackage::isHasAuditing() const
 void TenantPackage::setHasAuditing(bool value)
 {
     m_HasAuditing = value;
-    m_HasAuditingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasAuditing);
 }
 
 bool TenantPackage::hasAuditingIsSet() const
 {
-    return m_HasAuditingIsSet;
+    return m_FieldsSet.test(FieldBit_HasAuditing);
 }
 
 void TenantPackage::unsetHasAuditing()
 {
-    m_HasAuditingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasAuditing);
 }
 bool TenantPackage::isHasFlexPricing() const
 {
@@ -2318,17 +3705,17 @@ bool TenantPackage::isHasFlexPricing() const
 void TenantPackage::setHasFlexPricing(bool value)
 {
     m_HasFlexPricing = value;
-    m_HasFlexPricingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasFlexPricing);
 }
 
 bool TenantPackage::hasFlexPricingIsSet() const
 {
-    return m_HasFlexPricingIsSet;
+    return m_FieldsSet.test(FieldBit_HasFlexPricing);
 }
 
 void TenantPackage::unsetHasFlexPricing()
 {
-    m_HasFlexPricingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasFlexPricing);
 }
 bool TenantPackage::isEnableSAML() const
 {
@@ -2338,17 +3725,17 @@ bool TenantPackage::isEnableSAML() const
 void TenantPackage::setEnableSAML(bool value)
 {
     m_EnableSAML = value;
-    m_EnableSAMLIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableSAML);
 }
 
 bool TenantPackage::enableSAMLIsSet() const
 {
-    return m_EnableSAMLIsSet;
+    return m_FieldsSet.test(FieldBit_EnableSAML);
 }
 
 void TenantPackage::unsetEnableSAML()
 {
-    m_EnableSAMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableSAML);
 }
 bool TenantPackage::isEnableCanvasLTI() const
 {
@@ -2358,17 +3745,17 @@ bool TenantPackage::isEnableCanvasLTI() const
 void TenantPackage::setEnableCanvasLTI(bool value)
 {
     m_EnableCanvasLTI = value;
-    m_EnableCanvasLTIIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableCanvasLTI);
 }
 
 bool TenantPackage::enableCanvasLTIIsSet() const
 {
-    return m_EnableCanvasLTIIsSet;
+    return m_FieldsSet.test(FieldBit_EnableCanvasLTI);
 }
 
 void TenantPackage::unsetEnableCanvasLTI()
 {
-    m_EnableCanvasLTIIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableCanvasLTI);
 }
 double TenantPackage::getFlexPageLoadCostCents() const
 {
@@ -2378,17 +3765,17 @@ double TenantPackage::getFlexPageLoadCostCents() const
 void TenantPackage::setFlexPageLoadCostCents(double value)
 {
     m_FlexPageLoadCostCents = value;
-    m_FlexPageLoadCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexPageLoadCostCents);
 }
 
 bool TenantPackage::flexPageLoadCostCentsIsSet() const
 {
-    return m_FlexPageLoadCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexPageLoadCostCents);
 }
 
 void TenantPackage::unsetFlexPageLoadCostCents()
 {
-    m_FlexPageLoadCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexPageLoadCostCents);
 }
 double TenantPackage::getFlexPageLoadUnit() const
 {
@@ -2398,17 +3785,17 @@ double TenantPackage::getFlexPageLoadUnit() const
 void TenantPackage::setFlexPageLoadUnit(double value)
 {
     m_FlexPageLoadUnit = value;
-    m_FlexPageLoadUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexPageLoadUnit);
 }
 
 bool TenantPackage::flexPageLoadUnitIsSet() const
 {
-    return m_FlexPageLoadUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexPageLoadUnit);
 }
 
 void TenantPackage::unsetFlexPageLoadUnit()
 {
-    m_FlexPageLoadUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexPageLoadUnit);
 }
 double TenantPackage::getFlexCommentCostCents() const
 {
@@ -2418,17 +3805,17 @@ double TenantPackage::getFlexCommentCostCents() const
 void TenantPackage::setFlexCommentCostCents(double value)
 {
     m_FlexCommentCostCents = value;
-    m_FlexCommentCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexCommentCostCents);
 }
 
 bool TenantPackage::flexCommentCostCentsIsSet() const
 {
-    return m_FlexCommentCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexCommentCostCents);
 }
 
 void TenantPackage::unsetFlexCommentCostCents()
 {
-    m_FlexCommentCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexCommentCostCents);
 }
 double TenantPackage::getFlexCommentUnit() const
 {
@@ -2438,17 +3825,17 @@ double TenantPackage::getFlexCommentUnit() const
 void TenantPackage::setFlexCommentUnit(double value)
 {
     m_FlexCommentUnit = value;
-    m_FlexCommentUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexCommentUnit);
 }
 
 bool TenantPackage::flexCommentUnitIsSet() const
 {
-    return m_FlexCommentUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexCommentUnit);
 }
 
 void TenantPackage::unsetFlexCommentUnit()
 {
-    m_FlexCommentUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexCommentUnit);
 }
 double TenantPackage::getFlexSSOUserCostCents() const
 {
@@ -2458,17 +3845,17 @@ double TenantPackage::getFlexSSOUserCostCents() const
 void TenantPackage::setFlexSSOUserCostCents(double value)
 {
     m_FlexSSOUserCostCents = value;
-    m_FlexSSOUserCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOUserCostCents);
 }
 
 bool TenantPackage::flexSSOUserCostCentsIsSet() const
 {
-    return m_FlexSSOUserCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOUserCostCents);
 }
 
 void TenantPackage::unsetFlexSSOUserCostCents()
 {
-    m_FlexSSOUserCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOUserCostCents);
 }
 double TenantPackage::getFlexSSOUserUnit() const
 {
@@ -2478,17 +3865,17 @@ double TenantPackage::getFlexSSOUserUnit() const
 void TenantPackage::setFlexSSOUserUnit(double value)
 {
     m_FlexSSOUserUnit = value;
-    m_FlexSSOUserUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOUserUnit);
 }
 
 bool TenantPackage::flexSSOUserUnitIsSet() const
 {
-    return m_FlexSSOUserUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOUserUnit);
 }
 
 void TenantPackage::unsetFlexSSOUserUnit()
 {
-    m_FlexSSOUserUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOUserUnit);
 }
 double TenantPackage::getFlexAPICreditCostCents() const
 {
@@ -2498,17 +3885,17 @@ double TenantPackage::getFlexAPICreditCostCents() const
 void TenantPackage::setFlexAPICreditCostCents(double value)
 {
     m_FlexAPICreditCostCents = value;
-    m_FlexAPICreditCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAPICreditCostCents);
 }
 
 bool TenantPackage::flexAPICreditCostCentsIsSet() const
 {
-    return m_FlexAPICreditCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAPICreditCostCents);
 }
 
 void TenantPackage::unsetFlexAPICreditCostCents()
 {
-    m_FlexAPICreditCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAPICreditCostCents);
 }
 double TenantPackage::getFlexAPICreditUnit() const
 {
@@ -2518,17 +3905,17 @@ double TenantPackage::getFlexAPICreditUnit() const
 void TenantPackage::setFlexAPICreditUnit(double value)
 {
     m_FlexAPICreditUnit = value;
-    m_FlexAPICreditUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAPICreditUnit);
 }
 
 bool TenantPackage::flexAPICreditUnitIsSet() const
 {
-    return m_FlexAPICreditUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAPICreditUnit);
 }
 
 void TenantPackage::unsetFlexAPICreditUnit()
 {
-    m_FlexAPICreditUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAPICreditUnit);
 }
 double TenantPackage::getFlexSmallWidgetsCreditCostCents() const
 {
@@ -2538,17 +3925,17 @@ double TenantPackage::getFlexSmallWidgetsCreditCostCents() const
 void TenantPackage::setFlexSmallWidgetsCreditCostCents(double value)
 {
     m_FlexSmallWidgetsCreditCostCents = value;
-    m_FlexSmallWidgetsCreditCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSmallWidgetsCreditCostCents);
 }
 
 bool TenantPackage::flexSmallWidgetsCreditCostCentsIsSet() const
 {
-    return m_FlexSmallWidgetsCreditCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditCostCents);
 }
 
 void TenantPackage::unsetFlexSmallWidgetsCreditCostCents()
 {
-    m_FlexSmallWidgetsCreditCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSmallWidgetsCreditCostCents);
 }
 double TenantPackage::getFlexSmallWidgetsCreditUnit() const
 {
@@ -2558,17 +3945,17 @@ double TenantPackage::getFlexSmallWidgetsCreditUnit() const
 void TenantPackage::setFlexSmallWidgetsCreditUnit(double value)
 {
     m_FlexSmallWidgetsCreditUnit = value;
-    m_FlexSmallWidgetsCreditUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSmallWidgetsCreditUnit);
 }
 
 bool TenantPackage::flexSmallWidgetsCreditUnitIsSet() const
 {
-    return m_FlexSmallWidgetsCreditUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSmallWidgetsCreditUnit);
 }
 
 void TenantPackage::unsetFlexSmallWidgetsCreditUnit()
 {
-    m_FlexSmallWidgetsCreditUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSmallWidgetsCreditUnit);
 }
 double TenantPackage::getFlexModeratorCostCents() const
 {
@@ -2578,17 +3965,17 @@ double TenantPackage::getFlexModeratorCostCents() const
 void TenantPackage::setFlexModeratorCostCents(double value)
 {
     m_FlexModeratorCostCents = value;
-    m_FlexModeratorCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexModeratorCostCents);
 }
 
 bool TenantPackage::flexModeratorCostCentsIsSet() const
 {
-    return m_FlexModeratorCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexModeratorCostCents);
 }
 
 void TenantPackage::unsetFlexModeratorCostCents()
 {
-    m_FlexModeratorCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexModeratorCostCents);
 }
 double TenantPackage::getFlexModeratorUnit() const
 {
@@ -2598,17 +3985,17 @@ double TenantPackage::getFlexModeratorUnit() const
 void TenantPackage::setFlexModeratorUnit(double value)
 {
     m_FlexModeratorUnit = value;
-    m_FlexModeratorUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexModeratorUnit);
 }
 
 bool TenantPackage::flexModeratorUnitIsSet() const
 {
-    return m_FlexModeratorUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexModeratorUnit);
 }
 
 void TenantPackage::unsetFlexModeratorUnit()
 {
-    m_FlexModeratorUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexModeratorUnit);
 }
 double TenantPackage::getFlexAdminCostCents() const
 {
@@ -2618,17 +4005,17 @@ double TenantPackage::getFlexAdminCostCents() const
 void TenantPackage::setFlexAdminCostCents(double value)
 {
     m_FlexAdminCostCents = value;
-    m_FlexAdminCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAdminCostCents);
 }
 
 bool TenantPackage::flexAdminCostCentsIsSet() const
 {
-    return m_FlexAdminCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAdminCostCents);
 }
 
 void TenantPackage::unsetFlexAdminCostCents()
 {
-    m_FlexAdminCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAdminCostCents);
 }
 double TenantPackage::getFlexAdminUnit() const
 {
@@ -2638,17 +4025,17 @@ double TenantPackage::getFlexAdminUnit() const
 void TenantPackage::setFlexAdminUnit(double value)
 {
     m_FlexAdminUnit = value;
-    m_FlexAdminUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAdminUnit);
 }
 
 bool TenantPackage::flexAdminUnitIsSet() const
 {
-    return m_FlexAdminUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAdminUnit);
 }
 
 void TenantPackage::unsetFlexAdminUnit()
 {
-    m_FlexAdminUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAdminUnit);
 }
 double TenantPackage::getFlexDomainCostCents() const
 {
@@ -2658,17 +4045,17 @@ double TenantPackage::getFlexDomainCostCents() const
 void TenantPackage::setFlexDomainCostCents(double value)
 {
     m_FlexDomainCostCents = value;
-    m_FlexDomainCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexDomainCostCents);
 }
 
 bool TenantPackage::flexDomainCostCentsIsSet() const
 {
-    return m_FlexDomainCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexDomainCostCents);
 }
 
 void TenantPackage::unsetFlexDomainCostCents()
 {
-    m_FlexDomainCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexDomainCostCents);
 }
 double TenantPackage::getFlexDomainUnit() const
 {
@@ -2678,17 +4065,17 @@ double TenantPackage::getFlexDomainUnit() const
 void TenantPackage::setFlexDomainUnit(double value)
 {
     m_FlexDomainUnit = value;
-    m_FlexDomainUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexDomainUnit);
 }
 
 bool TenantPackage::flexDomainUnitIsSet() const
 {
-    return m_FlexDomainUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexDomainUnit);
 }
 
 void TenantPackage::unsetFlexDomainUnit()
 {
-    m_FlexDomainUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexDomainUnit);
 }
 double TenantPackage::getFlexChatGPTCostCents() const
 {
@@ -2698,17 +4085,17 @@ double TenantPackage::getFlexChatGPTCostCents() const
 void TenantPackage::setFlexChatGPTCostCents(double value)
 {
     m_FlexChatGPTCostCents = value;
-    m_FlexChatGPTCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexChatGPTCostCents);
 }
 
 bool TenantPackage::flexChatGPTCostCentsIsSet() const
 {
-    return m_FlexChatGPTCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexChatGPTCostCents);
 }
 
 void TenantPackage::unsetFlexChatGPTCostCents()
 {
-    m_FlexChatGPTCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexChatGPTCostCents);
 }
 double TenantPackage::getFlexChatGPTUnit() const
 {
@@ -2718,17 +4105,17 @@ double TenantPackage::getFlexChatGPTUnit() const
 void TenantPackage::setFlexChatGPTUnit(double value)
 {
     m_FlexChatGPTUnit = value;
-    m_FlexChatGPTUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexChatGPTUnit);
 }
 
 bool TenantPackage::flexChatGPTUnitIsSet() const
 {
-    return m_FlexChatGPTUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexChatGPTUnit);
 }
 
 void TenantPackage::unsetFlexChatGPTUnit()
 {
-    m_FlexChatGPTUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexChatGPTUnit);
 }
 double TenantPackage::getFlexLLMCostCents() const
 {
@@ -2738,17 +4125,17 @@ double TenantPackage::getFlexLLMCostCents() const
 void TenantPackage::setFlexLLMCostCents(double value)
 {
     m_FlexLLMCostCents = value;
-    m_FlexLLMCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexLLMCostCents);
 }
 
 bool TenantPackage::flexLLMCostCentsIsSet() const
 {
-    return m_FlexLLMCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexLLMCostCents);
 }
 
 void TenantPackage::unsetFlexLLMCostCents()
 {
-    m_FlexLLMCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexLLMCostCents);
 }
 double TenantPackage::getFlexLLMUnit() const
 {
@@ -2758,17 +4145,17 @@ double TenantPackage::getFlexLLMUnit() const
 void TenantPackage::setFlexLLMUnit(double value)
 {
     m_FlexLLMUnit = value;
-    m_FlexLLMUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexLLMUnit);
 }
 
 bool TenantPackage::flexLLMUnitIsSet() const
 {
-    return m_FlexLLMUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexLLMUnit);
 }
 
 void TenantPackage::unsetFlexLLMUnit()
 {
-    m_FlexLLMUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexLLMUnit);
 }
 double TenantPackage::getFlexMinimumCostCents() const
 {
@@ -2778,17 +4165,17 @@ double TenantPackage::getFlexMinimumCostCents() const
 void TenantPackage::setFlexMinimumCostCents(double value)
 {
     m_FlexMinimumCostCents = value;
-    m_FlexMinimumCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexMinimumCostCents);
 }
 
 bool TenantPackage::flexMinimumCostCentsIsSet() const
 {
-    return m_FlexMinimumCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexMinimumCostCents);
 }
 
 void TenantPackage::unsetFlexMinimumCostCents()
 {
-    m_FlexMinimumCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexMinimumCostCents);
 }
 double TenantPackage::getFlexManagedTenantCostCents() const
 {
@@ -2798,17 +4185,17 @@ double TenantPackage::getFlexManagedTenantCostCents() const
 void TenantPackage::setFlexManagedTenantCostCents(double value)
 {
     m_FlexManagedTenantCostCents = value;
-    m_FlexManagedTenantCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexManagedTenantCostCents);
 }
 
 bool TenantPackage::flexManagedTenantCostCentsIsSet() const
 {
-    return m_FlexManagedTenantCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexManagedTenantCostCents);
 }
 
 void TenantPackage::unsetFlexManagedTenantCostCents()
 {
-    m_FlexManagedTenantCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexManagedTenantCostCents);
 }
 double TenantPackage::getFlexSSOAdminCostCents() const
 {
@@ -2818,17 +4205,17 @@ double TenantPackage::getFlexSSOAdminCostCents() const
 void TenantPackage::setFlexSSOAdminCostCents(double value)
 {
     m_FlexSSOAdminCostCents = value;
-    m_FlexSSOAdminCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOAdminCostCents);
 }
 
 bool TenantPackage::flexSSOAdminCostCentsIsSet() const
 {
-    return m_FlexSSOAdminCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOAdminCostCents);
 }
 
 void TenantPackage::unsetFlexSSOAdminCostCents()
 {
-    m_FlexSSOAdminCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOAdminCostCents);
 }
 double TenantPackage::getFlexSSOAdminUnit() const
 {
@@ -2838,17 +4225,17 @@ double TenantPackage::getFlexSSOAdminUnit() const
 void TenantPackage::setFlexSSOAdminUnit(double value)
 {
     m_FlexSSOAdminUnit = value;
-    m_FlexSSOAdminUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOAdminUnit);
 }
 
 bool TenantPackage::flexSSOAdminUnitIsSet() const
 {
-    return m_FlexSSOAdminUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOAdminUnit);
 }
 
 void TenantPackage::unsetFlexSSOAdminUnit()
 {
-    m_FlexSSOAdminUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOAdminUnit);
 }
 double TenantPackage::getFlexSSOModeratorCostCents() const
 {
@@ -2858,17 +4245,17 @@ double TenantPackage::getFlexSSOModeratorCostCents() const
 void TenantPackage::setFlexSSOModeratorCostCents(double value)
 {
     m_FlexSSOModeratorCostCents = value;
-    m_FlexSSOModeratorCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOModeratorCostCents);
 }
 
 bool TenantPackage::flexSSOModeratorCostCentsIsSet() const
 {
-    return m_FlexSSOModeratorCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOModeratorCostCents);
 }
 
 void TenantPackage::unsetFlexSSOModeratorCostCents()
 {
-    m_FlexSSOModeratorCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOModeratorCostCents);
 }
 double TenantPackage::getFlexSSOModeratorUnit() const
 {
@@ -2878,17 +4265,17 @@ double TenantPackage::getFlexSSOModeratorUnit() const
 void TenantPackage::setFlexSSOModeratorUnit(double value)
 {
     m_FlexSSOModeratorUnit = value;
-    m_FlexSSOModeratorUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOModeratorUnit);
 }
 
 bool TenantPackage::flexSSOModeratorUnitIsSet() const
 {
-    return m_FlexSSOModeratorUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOModeratorUnit);
 }
 
 void TenantPackage::unsetFlexSSOModeratorUnit()
 {
-    m_FlexSSOModeratorUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOModeratorUnit);
 }
 bool TenantPackage::isIsSSOBillingMonthlyActiveUsers() const
 {
@@ -2898,17 +4285,17 @@ bool TenantPackage::isIsSSOBillingMonthlyActiveUsers() const
 void TenantPackage::setIsSSOBillingMonthlyActiveUsers(bool value)
 {
     m_IsSSOBillingMonthlyActiveUsers = value;
-    m_IsSSOBillingMonthlyActiveUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSSOBillingMonthlyActiveUsers);
 }
 
 bool TenantPackage::isSSOBillingMonthlyActiveUsersIsSet() const
 {
-    return m_IsSSOBillingMonthlyActiveUsersIsSet;
+    return m_FieldsSet.test(FieldBit_IsSSOBillingMonthlyActiveUsers);
 }
 
 void TenantPackage::unsetIsSSOBillingMonthlyActiveUsers()
 {
-    m_IsSSOBillingMonthlyActiveUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSSOBillingMonthlyActiveUsers);
 }
 bool TenantPackage::isHasAIAgents() const
 {
@@ -2918,17 +4305,17 @@ bool TenantPackage::isHasAIAgents() const
 void TenantPackage::setHasAIAgents(bool value)
 {
     m_HasAIAgents = value;
-    m_HasAIAgentsIsSet = true;
+    m_FieldsSet.set(FieldBit_HasAIAgents);
 }
 
 bool TenantPackage::hasAIAgentsIsSet() const
 {
-    return m_HasAIAgentsIsSet;
+    return m_FieldsSet.test(FieldBit_HasAIAgents);
 }
 
 void TenantPackage::unsetHasAIAgents()
 {
-    m_HasAIAgentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasAIAgents);
 }
 double TenantPackage::getMaxAIAgents() const
 {
@@ -2938,17 +4325,17 @@ double TenantPackage::getMaxAIAgents() const
 void TenantPackage::setMaxAIAgents(double value)
 {
     m_MaxAIAgents = value;
-    m_MaxAIAgentsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxAIAgents);
 }
 
 bool TenantPackage::maxAIAgentsIsSet() const
 {
-    return m_MaxAIAgentsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxAIAgents);
 }
 
 void TenantPackage::unsetMaxAIAgents()
 {
-    m_MaxAIAgentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxAIAgents);
 }
 double TenantPackage::getAiAgentDailyBudgetCents() const
 {
@@ -2958,17 +4345,17 @@ double TenantPackage::getAiAgentDailyBudgetCents() const
 void TenantPackage::setAiAgentDailyBudgetCents(double value)
 {
     m_AiAgentDailyBudgetCents = value;
-    m_AiAgentDailyBudgetCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_AiAgentDailyBudgetCents);
 }
 
 bool TenantPackage::aiAgentDailyBudgetCentsIsSet() const
 {
-    return m_AiAgentDailyBudgetCentsIsSet;
+    return m_FieldsSet.test(FieldBit_AiAgentDailyBudgetCents);
 }
 
 void TenantPackage::unsetAiAgentDailyBudgetCents()
 {
-    m_AiAgentDailyBudgetCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AiAgentDailyBudgetCents);
 }
 double TenantPackage::getAiAgentMonthlyBudgetCents() const
 {
@@ -2978,17 +4365,17 @@ double TenantPackage::getAiAgentMonthlyBudgetCents() const
 void TenantPackage::setAiAgentMonthlyBudgetCents(double value)
 {
     m_AiAgentMonthlyBudgetCents = value;
-    m_AiAgentMonthlyBudgetCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_AiAgentMonthlyBudgetCents);
 }
 
 bool TenantPackage::aiAgentMonthlyBudgetCentsIsSet() const
 {
-    return m_AiAgentMonthlyBudgetCentsIsSet;
+    return m_FieldsSet.test(FieldBit_AiAgentMonthlyBudgetCents);
 }
 
 void TenantPackage::unsetAiAgentMonthlyBudgetCents()
 {
-    m_AiAgentMonthlyBudgetCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AiAgentMonthlyBudgetCents);
 }
 
 }
@@ -20,7 +20,6 @@ namespace model {
 
 UnBlockFromCommentParams::UnBlockFromCommentParams()
 {
-    m_CommentIdsToCheckIsSet = false;
 }
 
 UnBlockFromCommentParams::~UnBlockFromCommentParams()
@@ -35,7 +34,7 @@ void UnBlockFromCommentParams::validate()
 web::json::value UnBlockFromCommentParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommentIdsToCheckIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck"))] = ModelBase::toJson(m_CommentIdsToCheck);
@@ -44,23 +43,87 @@ web::json::value UnBlockFromCommentParams::toJson() const
     return val;
 }
 
+void UnBlockFromCommentParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
+    {
+        
+        writer.key(_XPLATSTR("commentIdsToCheck"));
+        ModelBase::writeJson(writer, m_CommentIdsToCheck);
+    }
+
+    writer.endObject();
+}
+
 bool UnBlockFromCommentParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setCommentIdsToCheck;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIdsToCheck);
-            setCommentIdsToCheck(refVal_setCommentIdsToCheck);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commentIdsToCheck")):
+            if(field.first == _XPLATSTR("commentIdsToCheck"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setCommentIdsToCheck;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentIdsToCheck);
+                    setCommentIdsToCheck(refVal_setCommentIdsToCheck);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void UnBlockFromCommentParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentIdsToCheck")), m_CommentIdsToCheck);
+    }
+}
+
+bool UnBlockFromCommentParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("commentIdsToCheck")):
+            {
+                std::vector<utility::string_t> refVal_setCommentIdsToCheck;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentIdsToCheck))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentIdsToCheck(refVal_setCommentIdsToCheck);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void UnBlockFromCommentParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -68,7 +131,7 @@ void UnBlockFromCommentParams::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommentIdsToCheckIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentIdsToCheck))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentIdsToCheck")), m_CommentIdsToCheck));
     }
@@ -102,17 +165,17 @@ std::vector<utility::string_t> UnBlockFromCommentParams::getCommentIdsToCheck()
 void UnBlockFromCommentParams::setCommentIdsToCheck(const std::vector<utility::string_t>& value)
 {
     m_CommentIdsToCheck = value;
-    m_CommentIdsToCheckIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentIdsToCheck);
 }
 
 bool UnBlockFromCommentParams::commentIdsToCheckIsSet() const
 {
-    return m_CommentIdsToCheckIsSet;
+    return m_FieldsSet.test(FieldBit_CommentIdsToCheck);
 }
 
 void UnBlockFromCommentParams::unsetCommentIdsToCheck()
 {
-    m_CommentIdsToCheckIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentIdsToCheck);
 }
 
 }
@@ -21,14 +21,6 @@ namespace model {
 UpdateAPIPageData::UpdateAPIPageData()
 {
     m_IsClosed = false;
-    m_IsClosedIsSet = false;
-    m_AccessibleByGroupIdsIsSet = false;
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
 }
 
 UpdateAPIPageData::~UpdateAPIPageData()
@@ -43,27 +35,27 @@ void UpdateAPIPageData::validate()
 web::json::value UpdateAPIPageData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isClosed"))] = ModelBase::toJson(m_IsClosed);
     }
-    if(m_AccessibleByGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds"))] = ModelBase::toJson(m_AccessibleByGroupIds);
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
@@ -72,65 +64,221 @@ web::json::value UpdateAPIPageData::toJson() const
     return val;
 }
 
+void UpdateAPIPageData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_IsClosed))
+    {
+        
+        writer.key(_XPLATSTR("isClosed"));
+        ModelBase::writeJson(writer, m_IsClosed);
+    }
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
+    {
+        
+        writer.key(_XPLATSTR("accessibleByGroupIds"));
+        ModelBase::writeJson(writer, m_AccessibleByGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateAPIPageData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isClosed"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isClosed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsClosed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
-            setIsClosed(refVal_setIsClosed);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAccessibleByGroupIds);
-            setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            if(field.first == _XPLATSTR("isClosed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsClosed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsClosed);
+                    setIsClosed(refVal_setIsClosed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")):
+            if(field.first == _XPLATSTR("accessibleByGroupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAccessibleByGroupIds);
+                    setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    return ok;
+}
+
+void UpdateAPIPageData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isClosed")), m_IsClosed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")), m_AccessibleByGroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
+    }
+}
+
+bool UpdateAPIPageData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("isClosed")):
+            {
+                bool refVal_setIsClosed;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsClosed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsClosed(refVal_setIsClosed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("accessibleByGroupIds")):
+            {
+                std::vector<utility::string_t> refVal_setAccessibleByGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setAccessibleByGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAccessibleByGroupIds(refVal_setAccessibleByGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateAPIPageData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -140,23 +288,23 @@ void UpdateAPIPageData::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IsClosedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsClosed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isClosed")), m_IsClosed));
     }
-    if(m_AccessibleByGroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_AccessibleByGroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("accessibleByGroupIds")), m_AccessibleByGroupIds));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
@@ -213,17 +361,17 @@ bool UpdateAPIPageData::isIsClosed() const
 void UpdateAPIPageData::setIsClosed(bool value)
 {
     m_IsClosed = value;
-    m_IsClosedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsClosed);
 }
 
 bool UpdateAPIPageData::isClosedIsSet() const
 {
-    return m_IsClosedIsSet;
+    return m_FieldsSet.test(FieldBit_IsClosed);
 }
 
 void UpdateAPIPageData::unsetIsClosed()
 {
-    m_IsClosedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsClosed);
 }
 std::vector<utility::string_t> UpdateAPIPageData::getAccessibleByGroupIds() const
 {
@@ -234,17 +382,17 @@ std::vector<utility::string_t> UpdateAPIPageData::getAccessibleByGroupIds() cons
 void UpdateAPIPageData::setAccessibleByGroupIds(const std::vector<utility::string_t>& value)
 {
     m_AccessibleByGroupIds = value;
-    m_AccessibleByGroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_AccessibleByGroupIds);
 }
 
 bool UpdateAPIPageData::accessibleByGroupIdsIsSet() const
 {
-    return m_AccessibleByGroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_AccessibleByGroupIds);
 }
 
 void UpdateAPIPageData::unsetAccessibleByGroupIds()
 {
-    m_AccessibleByGroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AccessibleByGroupIds);
 }
 utility::string_t UpdateAPIPageData::getTitle() const
 {
@@ -255,17 +403,17 @@ utility::string_t UpdateAPIPageData::getTitle() const
 void UpdateAPIPageData::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool UpdateAPIPageData::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void UpdateAPIPageData::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t UpdateAPIPageData::getUrl() const
 {
@@ -276,17 +424,17 @@ utility::string_t UpdateAPIPageData::getUrl() const
 void UpdateAPIPageData::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool UpdateAPIPageData::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void UpdateAPIPageData::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t UpdateAPIPageData::getUrlId() const
 {
@@ -297,17 +445,17 @@ utility::string_t UpdateAPIPageData::getUrlId() const
 void UpdateAPIPageData::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool UpdateAPIPageData::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void UpdateAPIPageData::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 
 }
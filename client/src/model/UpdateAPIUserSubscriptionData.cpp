@@ -21,7 +21,6 @@ namespace model {
 UpdateAPIUserSubscriptionData::UpdateAPIUserSubscriptionData()
 {
     m_NotificationFrequency = 0.0;
-    m_NotificationFrequencyIsSet = false;
 }
 
 UpdateAPIUserSubscriptionData::~UpdateAPIUserSubscriptionData()
@@ -36,7 +35,7 @@ void UpdateAPIUserSubscriptionData::validate()
 web::json::value UpdateAPIUserSubscriptionData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))] = ModelBase::toJson(m_NotificationFrequency);
@@ -45,23 +44,87 @@ web::json::value UpdateAPIUserSubscriptionData::toJson() const
     return val;
 }
 
+void UpdateAPIUserSubscriptionData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
+    {
+        
+        writer.key(_XPLATSTR("notificationFrequency"));
+        ModelBase::writeJson(writer, m_NotificationFrequency);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateAPIUserSubscriptionData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setNotificationFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
-            setNotificationFrequency(refVal_setNotificationFrequency);
-            
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            if(field.first == _XPLATSTR("notificationFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNotificationFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
+                    setNotificationFrequency(refVal_setNotificationFrequency);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void UpdateAPIUserSubscriptionData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationFrequency")), m_NotificationFrequency);
+    }
+}
+
+bool UpdateAPIUserSubscriptionData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            {
+                double refVal_setNotificationFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationFrequency(refVal_setNotificationFrequency);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void UpdateAPIUserSubscriptionData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -69,7 +132,7 @@ void UpdateAPIUserSubscriptionData::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")), m_NotificationFrequency));
     }
@@ -102,17 +165,17 @@ double UpdateAPIUserSubscriptionData::getNotificationFrequency() const
 void UpdateAPIUserSubscriptionData::setNotificationFrequency(double value)
 {
     m_NotificationFrequency = value;
-    m_NotificationFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationFrequency);
 }
 
 bool UpdateAPIUserSubscriptionData::notificationFrequencyIsSet() const
 {
-    return m_NotificationFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationFrequency);
 }
 
 void UpdateAPIUserSubscriptionData::unsetNotificationFrequency()
 {
-    m_NotificationFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationFrequency);
 }
 
 }
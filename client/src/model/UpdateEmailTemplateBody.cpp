@@ -20,16 +20,6 @@ namespace model {
 
 UpdateEmailTemplateBody::UpdateEmailTemplateBody()
 {
-    m_EmailTemplateId = utility::conversions::to_string_t("");
-    m_EmailTemplateIdIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_Ejs = utility::conversions::to_string_t("");
-    m_EjsIsSet = false;
-    m_Domain = utility::conversions::to_string_t("");
-    m_DomainIsSet = false;
-    m_TranslationOverridesByLocaleIsSet = false;
-    m_TestDataIsSet = false;
 }
 
 UpdateEmailTemplateBody::~UpdateEmailTemplateBody()
@@ -44,32 +34,32 @@ void UpdateEmailTemplateBody::validate()
 web::json::value UpdateEmailTemplateBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))] = ModelBase::toJson(m_EmailTemplateId);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_EjsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ejs"))] = ModelBase::toJson(m_Ejs);
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domain"))] = ModelBase::toJson(m_Domain);
     }
-    if(m_TranslationOverridesByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale"))] = ModelBase::toJson(m_TranslationOverridesByLocale);
     }
-    if(m_TestDataIsSet)
+    if(m_FieldsSet.test(FieldBit_TestData))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("testData"))] = ModelBase::toJson(m_TestData);
@@ -78,76 +68,255 @@ web::json::value UpdateEmailTemplateBody::toJson() const
     return val;
 }
 
+void UpdateEmailTemplateBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
+    {
+        
+        writer.key(_XPLATSTR("emailTemplateId"));
+        ModelBase::writeJson(writer, m_EmailTemplateId);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_Ejs))
+    {
+        
+        writer.key(_XPLATSTR("ejs"));
+        ModelBase::writeJson(writer, m_Ejs);
+    }
+    if(m_FieldsSet.test(FieldBit_Domain))
+    {
+        
+        writer.key(_XPLATSTR("domain"));
+        ModelBase::writeJson(writer, m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
+    {
+        
+        writer.key(_XPLATSTR("translationOverridesByLocale"));
+        ModelBase::writeJson(writer, m_TranslationOverridesByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_TestData))
+    {
+        
+        writer.key(_XPLATSTR("testData"));
+        ModelBase::writeJson(writer, m_TestData);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateEmailTemplateBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmailTemplateId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
-            setEmailTemplateId(refVal_setEmailTemplateId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            if(field.first == _XPLATSTR("emailTemplateId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmailTemplateId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmailTemplateId);
+                    setEmailTemplateId(refVal_setEmailTemplateId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ejs")):
+            if(field.first == _XPLATSTR("ejs"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEjs;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEjs);
+                    setEjs(refVal_setEjs);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            if(field.first == _XPLATSTR("domain"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDomain;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
+                    setDomain(refVal_setDomain);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")):
+            if(field.first == _XPLATSTR("translationOverridesByLocale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTranslationOverridesByLocale);
+                    setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("testData")):
+            if(field.first == _XPLATSTR("testData"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setTestData;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTestData);
+                    setTestData(refVal_setTestData);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ejs"))))
+    return ok;
+}
+
+void UpdateEmailTemplateBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ejs")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEjs;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEjs);
-            setEjs(refVal_setEjs);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("emailTemplateId")), m_EmailTemplateId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domain"))))
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domain")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDomain;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomain);
-            setDomain(refVal_setDomain);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale"))))
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTranslationOverridesByLocale);
-            setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ejs")), m_Ejs);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("testData"))))
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("testData")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domain")), m_Domain);
+    }
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")), m_TranslationOverridesByLocale);
+    }
+    if(m_FieldsSet.test(FieldBit_TestData))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("testData")), m_TestData);
+    }
+}
+
+bool UpdateEmailTemplateBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setTestData;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTestData);
-            setTestData(refVal_setTestData);
-            
+        case ModelBase::fieldHash(_XPLATSTR("emailTemplateId")):
+            {
+                utility::string_t refVal_setEmailTemplateId;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmailTemplateId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmailTemplateId(refVal_setEmailTemplateId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ejs")):
+            {
+                utility::string_t refVal_setEjs;
+                if(!ModelBase::readBinary(reader, field, refVal_setEjs))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEjs(refVal_setEjs);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domain")):
+            {
+                utility::string_t refVal_setDomain;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomain))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomain(refVal_setDomain);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("translationOverridesByLocale")):
+            {
+                std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> refVal_setTranslationOverridesByLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setTranslationOverridesByLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTranslationOverridesByLocale(refVal_setTranslationOverridesByLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("testData")):
+            {
+                std::map<utility::string_t, std::shared_ptr<AnyType>> refVal_setTestData;
+                if(!ModelBase::readBinary(reader, field, refVal_setTestData))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTestData(refVal_setTestData);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateEmailTemplateBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -157,27 +326,27 @@ void UpdateEmailTemplateBody::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_EmailTemplateIdIsSet)
+    if(m_FieldsSet.test(FieldBit_EmailTemplateId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("emailTemplateId")), m_EmailTemplateId));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_EjsIsSet)
+    if(m_FieldsSet.test(FieldBit_Ejs))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ejs")), m_Ejs));
     }
-    if(m_DomainIsSet)
+    if(m_FieldsSet.test(FieldBit_Domain))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domain")), m_Domain));
     }
-    if(m_TranslationOverridesByLocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_TranslationOverridesByLocale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("translationOverridesByLocale")), m_TranslationOverridesByLocale));
     }
-    if(m_TestDataIsSet)
+    if(m_FieldsSet.test(FieldBit_TestData))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("testData")), m_TestData));
     }
@@ -241,17 +410,17 @@ utility::string_t UpdateEmailTemplateBody::getEmailTemplateId() const
 void UpdateEmailTemplateBody::setEmailTemplateId(const utility::string_t& value)
 {
     m_EmailTemplateId = value;
-    m_EmailTemplateIdIsSet = true;
+    m_FieldsSet.set(FieldBit_EmailTemplateId);
 }
 
 bool UpdateEmailTemplateBody::emailTemplateIdIsSet() const
 {
-    return m_EmailTemplateIdIsSet;
+    return m_FieldsSet.test(FieldBit_EmailTemplateId);
 }
 
 void UpdateEmailTemplateBody::unsetEmailTemplateId()
 {
-    m_EmailTemplateIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_EmailTemplateId);
 }
 utility::string_t UpdateEmailTemplateBody::getDisplayName() const
 {
@@ -262,17 +431,17 @@ utility::string_t UpdateEmailTemplateBody::getDisplayName() const
 void UpdateEmailTemplateBody::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool UpdateEmailTemplateBody::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void UpdateEmailTemplateBody::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::string_t UpdateEmailTemplateBody::getEjs() const
 {
@@ -283,17 +452,17 @@ utility::string_t UpdateEmailTemplateBody::getEjs() const
 void UpdateEmailTemplateBody::setEjs(const utility::string_t& value)
 {
     m_Ejs = value;
-    m_EjsIsSet = true;
+    m_FieldsSet.set(FieldBit_Ejs);
 }
 
 bool UpdateEmailTemplateBody::ejsIsSet() const
 {
-    return m_EjsIsSet;
+    return m_FieldsSet.test(FieldBit_Ejs);
 }
 
 void UpdateEmailTemplateBody::unsetEjs()
 {
-    m_EjsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Ejs);
 }
 utility::string_t UpdateEmailTemplateBody::getDomain() const
 {
@@ -304,17 +473,17 @@ utility::string_t UpdateEmailTemplateBody::getDomain() const
 void UpdateEmailTemplateBody::setDomain(const utility::string_t& value)
 {
     m_Domain = value;
-    m_DomainIsSet = true;
+    m_FieldsSet.set(FieldBit_Domain);
 }
 
 bool UpdateEmailTemplateBody::domainIsSet() const
 {
-    return m_DomainIsSet;
+    return m_FieldsSet.test(FieldBit_Domain);
 }
 
 void UpdateEmailTemplateBody::unsetDomain()
 {
-    m_DomainIsSet = false;
+    m_FieldsSet.reset(FieldBit_Domain);
 }
 std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> UpdateEmailTemplateBody::getTranslationOverridesByLocale() const
 {
@@ -325,17 +494,17 @@ std::map<utility::string_t, std::map<utility::string_t, utility::string_t>> Upda
 void UpdateEmailTemplateBody::setTranslationOverridesByLocale(const std::map<utility::string_t, std::map<utility::string_t, utility::string_t>>& value)
 {
     m_TranslationOverridesByLocale = value;
-    m_TranslationOverridesByLocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_TranslationOverridesByLocale);
 }
 
 bool UpdateEmailTemplateBody::translationOverridesByLocaleIsSet() const
 {
-    return m_TranslationOverridesByLocaleIsSet;
+    return m_FieldsSet.test(FieldBit_TranslationOverridesByLocale);
 }
 
 void UpdateEmailTemplateBody::unsetTranslationOverridesByLocale()
 {
-    m_TranslationOverridesByLocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_TranslationOverridesByLocale);
 }
 std::map<utility::string_t, std::shared_ptr<AnyType>> UpdateEmailTemplateBody::getTestData() const
 {
@@ -346,17 +515,17 @@ std::map<utility::string_t, std::shared_ptr<AnyType>> UpdateEmailTemplateBody::g
 void UpdateEmailTemplateBody::setTestData(const std::map<utility::string_t, std::shared_ptr<AnyType>>& value)
 {
     m_TestData = value;
-    m_TestDataIsSet = true;
+    m_FieldsSet.set(FieldBit_TestData);
 }
 
 bool UpdateEmailTemplateBody::testDataIsSet() const
 {
-    return m_TestDataIsSet;
+    return m_FieldsSet.test(FieldBit_TestData);
 }
 
 void UpdateEmailTemplateBody::unsetTestData()
 {
-    m_TestDataIsSet = false;
+    m_FieldsSet.reset(FieldBit_TestData);
 }
 
 }
@@ -20,14 +20,6 @@ namespace model {
 
 UpdateFeedPostParams::UpdateFeedPostParams()
 {
-    m_Title = utility::conversions::to_string_t("");
-    m_TitleIsSet = false;
-    m_ContentHTML = utility::conversions::to_string_t("");
-    m_ContentHTMLIsSet = false;
-    m_MediaIsSet = false;
-    m_LinksIsSet = false;
-    m_TagsIsSet = false;
-    m_MetaIsSet = false;
 }
 
 UpdateFeedPostParams::~UpdateFeedPostParams()
@@ -42,32 +34,32 @@ void UpdateFeedPostParams::validate()
 web::json::value UpdateFeedPostParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("title"))] = ModelBase::toJson(m_Title);
     }
-    if(m_ContentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("contentHTML"))] = ModelBase::toJson(m_ContentHTML);
     }
-    if(m_MediaIsSet)
+    if(m_FieldsSet.test(FieldBit_Media))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("media"))] = ModelBase::toJson(m_Media);
     }
-    if(m_LinksIsSet)
+    if(m_FieldsSet.test(FieldBit_Links))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("links"))] = ModelBase::toJson(m_Links);
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tags"))] = ModelBase::toJson(m_Tags);
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
@@ -76,76 +68,255 @@ web::json::value UpdateFeedPostParams::toJson() const
     return val;
 }
 
+void UpdateFeedPostParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Title))
+    {
+        
+        writer.key(_XPLATSTR("title"));
+        ModelBase::writeJson(writer, m_Title);
+    }
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
+    {
+        
+        writer.key(_XPLATSTR("contentHTML"));
+        ModelBase::writeJson(writer, m_ContentHTML);
+    }
+    if(m_FieldsSet.test(FieldBit_Media))
+    {
+        
+        writer.key(_XPLATSTR("media"));
+        ModelBase::writeJson(writer, m_Media);
+    }
+    if(m_FieldsSet.test(FieldBit_Links))
+    {
+        
+        writer.key(_XPLATSTR("links"));
+        ModelBase::writeJson(writer, m_Links);
+    }
+    if(m_FieldsSet.test(FieldBit_Tags))
+    {
+        
+        writer.key(_XPLATSTR("tags"));
+        ModelBase::writeJson(writer, m_Tags);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateFeedPostParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("title"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("title")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
-            setTitle(refVal_setTitle);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("contentHTML"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("contentHTML")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setContentHTML;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setContentHTML);
-            setContentHTML(refVal_setContentHTML);
-            
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            if(field.first == _XPLATSTR("title"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTitle);
+                    setTitle(refVal_setTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("contentHTML")):
+            if(field.first == _XPLATSTR("contentHTML"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setContentHTML;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setContentHTML);
+                    setContentHTML(refVal_setContentHTML);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("media")):
+            if(field.first == _XPLATSTR("media"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMedia);
+                    setMedia(refVal_setMedia);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("links")):
+            if(field.first == _XPLATSTR("links"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLinks);
+                    setLinks(refVal_setLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            if(field.first == _XPLATSTR("tags"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setTags;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
+                    setTags(refVal_setTags);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("media"))))
+    return ok;
+}
+
+void UpdateFeedPostParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Title))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("media")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMedia);
-            setMedia(refVal_setMedia);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("title")), m_Title);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("links"))))
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("links")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLinks);
-            setLinks(refVal_setLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("contentHTML")), m_ContentHTML);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tags"))))
+    if(m_FieldsSet.test(FieldBit_Media))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tags")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setTags;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTags);
-            setTags(refVal_setTags);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("media")), m_Media);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_Links))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("links")), m_Links);
+    }
+    if(m_FieldsSet.test(FieldBit_Tags))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tags")), m_Tags);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
+    }
+}
+
+bool UpdateFeedPostParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, utility::string_t> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
+        case ModelBase::fieldHash(_XPLATSTR("title")):
+            {
+                utility::string_t refVal_setTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTitle(refVal_setTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("contentHTML")):
+            {
+                utility::string_t refVal_setContentHTML;
+                if(!ModelBase::readBinary(reader, field, refVal_setContentHTML))
+                {
+                    ok = false;
+                    continue;
+                }
+                setContentHTML(refVal_setContentHTML);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("media")):
+            {
+                std::vector<std::shared_ptr<FeedPostMediaItem>> refVal_setMedia;
+                if(!ModelBase::readBinary(reader, field, refVal_setMedia))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMedia(refVal_setMedia);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("links")):
+            {
+                std::vector<std::shared_ptr<FeedPostLink>> refVal_setLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLinks(refVal_setLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tags")):
+            {
+                std::vector<utility::string_t> refVal_setTags;
+                if(!ModelBase::readBinary(reader, field, refVal_setTags))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTags(refVal_setTags);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateFeedPostParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -155,27 +326,27 @@ void UpdateFeedPostParams::toMultipart(std::shared_ptr<MultipartFormData> multip
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_TitleIsSet)
+    if(m_FieldsSet.test(FieldBit_Title))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("title")), m_Title));
     }
-    if(m_ContentHTMLIsSet)
+    if(m_FieldsSet.test(FieldBit_ContentHTML))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("contentHTML")), m_ContentHTML));
     }
-    if(m_MediaIsSet)
+    if(m_FieldsSet.test(FieldBit_Media))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("media")), m_Media));
     }
-    if(m_LinksIsSet)
+    if(m_FieldsSet.test(FieldBit_Links))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("links")), m_Links));
     }
-    if(m_TagsIsSet)
+    if(m_FieldsSet.test(FieldBit_Tags))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tags")), m_Tags));
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
@@ -239,17 +410,17 @@ utility::string_t UpdateFeedPostParams::getTitle() const
 void UpdateFeedPostParams::setTitle(const utility::string_t& value)
 {
     m_Title = value;
-    m_TitleIsSet = true;
+    m_FieldsSet.set(FieldBit_Title);
 }
 
 bool UpdateFeedPostParams::titleIsSet() const
 {
-    return m_TitleIsSet;
+    return m_FieldsSet.test(FieldBit_Title);
 }
 
 void UpdateFeedPostParams::unsetTitle()
 {
-    m_TitleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Title);
 }
 utility::string_t UpdateFeedPostParams::getContentHTML() const
 {
@@ -260,17 +431,17 @@ utility::string_t UpdateFeedPostParams::getContentHTML() const
 void UpdateFeedPostParams::setContentHTML(const utility::string_t& value)
 {
     m_ContentHTML = value;
-    m_ContentHTMLIsSet = true;
+    m_FieldsSet.set(FieldBit_ContentHTML);
 }
 
 bool UpdateFeedPostParams::contentHTMLIsSet() const
 {
-    return m_ContentHTMLIsSet;
+    return m_FieldsSet.test(FieldBit_ContentHTML);
 }
 
 void UpdateFeedPostParams::unsetContentHTML()
 {
-    m_ContentHTMLIsSet = false;
+    m_FieldsSet.reset(FieldBit_ContentHTML);
 }
 std::vector<std::shared_ptr<FeedPostMediaItem>> UpdateFeedPostParams::getMedia() const
 {
@@ -281,17 +452,17 @@ std::vector<std::shared_ptr<FeedPostMediaItem>> UpdateFeedPostParams::getMedia()
 void UpdateFeedPostParams::setMedia(const std::vector<std::shared_ptr<FeedPostMediaItem>>& value)
 {
     m_Media = value;
-    m_MediaIsSet = true;
+    m_FieldsSet.set(FieldBit_Media);
 }
 
 bool UpdateFeedPostParams::mediaIsSet() const
 {
-    return m_MediaIsSet;
+    return m_FieldsSet.test(FieldBit_Media);
 }
 
 void UpdateFeedPostParams::unsetMedia()
 {
-    m_MediaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Media);
 }
 std::vector<std::shared_ptr<FeedPostLink>> UpdateFeedPostParams::getLinks() const
 {
@@ -302,17 +473,17 @@ std::vector<std::shared_ptr<FeedPostLink>> UpdateFeedPostParams::getLinks() cons
 void UpdateFeedPostParams::setLinks(const std::vector<std::shared_ptr<FeedPostLink>>& value)
 {
     m_Links = value;
-    m_LinksIsSet = true;
+    m_FieldsSet.set(FieldBit_Links);
 }
 
 bool UpdateFeedPostParams::linksIsSet() const
 {
-    return m_LinksIsSet;
+    return m_FieldsSet.test(FieldBit_Links);
 }
 
 void UpdateFeedPostParams::unsetLinks()
 {
-    m_LinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_Links);
 }
 std::vector<utility::string_t> UpdateFeedPostParams::getTags() const
 {
@@ -323,17 +494,17 @@ std::vector<utility::string_t> UpdateFeedPostParams::getTags() const
 void UpdateFeedPostParams::setTags(const std::vector<utility::string_t>& value)
 {
     m_Tags = value;
-    m_TagsIsSet = true;
+    m_FieldsSet.set(FieldBit_Tags);
 }
 
 bool UpdateFeedPostParams::tagsIsSet() const
 {
-    return m_TagsIsSet;
+    return m_FieldsSet.test(FieldBit_Tags);
 }
 
 void UpdateFeedPostParams::unsetTags()
 {
-    m_TagsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Tags);
 }
 std::map<utility::string_t, utility::string_t> UpdateFeedPostParams::getMeta() const
 {
@@ -344,17 +515,17 @@ std::map<utility::string_t, utility::string_t> UpdateFeedPostParams::getMeta() c
 void UpdateFeedPostParams::setMeta(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Meta = value;
-    m_MetaIsSet = true;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool UpdateFeedPostParams::metaIsSet() const
 {
-    return m_MetaIsSet;
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void UpdateFeedPostParams::unsetMeta()
 {
-    m_MetaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 
 }
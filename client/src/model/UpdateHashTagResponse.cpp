@@ -20,8 +20,6 @@ namespace model {
 
 UpdateHashTagResponse::UpdateHashTagResponse()
 {
-    m_StatusIsSet = false;
-    m_HashTagIsSet = false;
 }
 
 UpdateHashTagResponse::~UpdateHashTagResponse()
@@ -36,12 +34,12 @@ void UpdateHashTagResponse::validate()
 web::json::value UpdateHashTagResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_HashTagIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hashTag"))] = ModelBase::toJson(m_HashTag);
@@ -50,32 +48,119 @@ web::json::value UpdateHashTagResponse::toJson() const
     return val;
 }
 
+void UpdateHashTagResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTag))
+    {
+        
+        writer.key(_XPLATSTR("hashTag"));
+        ModelBase::writeJson(writer, m_HashTag);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateHashTagResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hashTag")):
+            if(field.first == _XPLATSTR("hashTag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<TenantHashTag> refVal_setHashTag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHashTag);
+                    setHashTag(refVal_setHashTag);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hashTag"))))
+    return ok;
+}
+
+void UpdateHashTagResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hashTag")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_HashTag))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hashTag")), m_HashTag);
+    }
+}
+
+bool UpdateHashTagResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::shared_ptr<TenantHashTag> refVal_setHashTag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHashTag);
-            setHashTag(refVal_setHashTag);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hashTag")):
+            {
+                std::shared_ptr<TenantHashTag> refVal_setHashTag;
+                if(!ModelBase::readBinary(reader, field, refVal_setHashTag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHashTag(refVal_setHashTag);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateHashTagResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void UpdateHashTagResponse::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_HashTagIsSet)
+    if(m_FieldsSet.test(FieldBit_HashTag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hashTag")), m_HashTag));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> UpdateHashTagResponse::getStatus() const
 void UpdateHashTagResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool UpdateHashTagResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void UpdateHashTagResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::shared_ptr<TenantHashTag> UpdateHashTagResponse::getHashTag() const
 {
@@ -150,17 +235,17 @@ std::shared_ptr<TenantHashTag> UpdateHashTagResponse::getHashTag() const
 void UpdateHashTagResponse::setHashTag(const std::shared_ptr<TenantHashTag>& value)
 {
     m_HashTag = value;
-    m_HashTagIsSet = true;
+    m_FieldsSet.set(FieldBit_HashTag);
 }
 
 bool UpdateHashTagResponse::hashTagIsSet() const
 {
-    return m_HashTagIsSet;
+    return m_FieldsSet.test(FieldBit_HashTag);
 }
 
 void UpdateHashTagResponse::unsetHashTag()
 {
-    m_HashTagIsSet = false;
+    m_FieldsSet.reset(FieldBit_HashTag);
 }
 
 }
@@ -21,10 +21,7 @@ namespace model {
 UpdateNotificationBody::UpdateNotificationBody()
 {
     m_Viewed = false;
-    m_ViewedIsSet = false;
     m_OptedOut = false;
-    m_OptedOutIsSet = false;
-    m_AdditionalPropertiesIsSet = false;
 }
 
 UpdateNotificationBody::~UpdateNotificationBody()
@@ -39,18 +36,18 @@ void UpdateNotificationBody::validate()
 web::json::value UpdateNotificationBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_ViewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("viewed"))] = ModelBase::toJson(m_Viewed);
     }
-    if(m_OptedOutIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedOut"))] = ModelBase::toJson(m_OptedOut);
     }
     // Serialize additional properties
-    if(m_AdditionalPropertiesIsSet)
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
         for(const auto& item : m_AdditionalProperties)
         {
@@ -61,45 +58,159 @@ web::json::value UpdateNotificationBody::toJson() const
     return val;
 }
 
+void UpdateNotificationBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Viewed))
+    {
+        
+        writer.key(_XPLATSTR("viewed"));
+        ModelBase::writeJson(writer, m_Viewed);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedOut))
+    {
+        
+        writer.key(_XPLATSTR("optedOut"));
+        ModelBase::writeJson(writer, m_OptedOut);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
+        {
+            writer.key(item.first);
+            writer.value(item.second);
+        }
+    }
+
+    writer.endObject();
+}
+
 bool UpdateNotificationBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("viewed"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("viewed")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setViewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setViewed);
-            setViewed(refVal_setViewed);
-            
+        case ModelBase::fieldHash(_XPLATSTR("viewed")):
+            if(field.first == _XPLATSTR("viewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setViewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setViewed);
+                    setViewed(refVal_setViewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedOut")):
+            if(field.first == _XPLATSTR("optedOut"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedOut;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedOut);
+                    setOptedOut(refVal_setOptedOut);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        // This is an additional property
+        m_AdditionalProperties[field.first] = fieldValue;
+        m_FieldsSet.set(FieldBit_AdditionalProperties);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedOut"))))
+    return ok;
+}
+
+void UpdateNotificationBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Viewed))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("viewed")), m_Viewed);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedOut))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedOut")), m_OptedOut);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedOut")));
-        if(!fieldValue.is_null())
+        for(const auto& item : m_AdditionalProperties)
         {
-            bool refVal_setOptedOut;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedOut);
-            setOptedOut(refVal_setOptedOut);
-            
+            writer.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);
+            writer.writeString(item.first);
+            writer.writeString(item.second.serialize());
         }
     }
-    // Capture additional properties (keys not defined in the schema)
-    if(val.is_object())
+}
+
+bool UpdateNotificationBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        for(const auto& item : val.as_object())
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("viewed")):
+            {
+                bool refVal_setViewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setViewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setViewed(refVal_setViewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedOut")):
+            {
+                bool refVal_setOptedOut;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedOut))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedOut(refVal_setOptedOut);
+            }
+            continue;
+        default:
+            break;
+        }
+        if(field.wireType == BinaryWireType::Named)
         {
-            // Skip known properties
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("viewed"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("optedOut"))) continue;
-            // This is an additional property
-            m_AdditionalProperties[item.first] = item.second;
-            m_AdditionalPropertiesIsSet = true;
+            utility::string_t key;
+            utility::string_t text;
+            if(reader.readString(key) && reader.readString(text))
+            {
+                try
+                {
+                    m_AdditionalProperties[key] = web::json::value::parse(text);
+                }
+                catch(const web::json::json_exception&)
+                {
+                    return false;
+                }
+                m_FieldsSet.set(FieldBit_AdditionalProperties);
+            }
+            continue;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateNotificationBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -109,11 +220,11 @@ void UpdateNotificationBody::toMultipart(std::shared_ptr<MultipartFormData> mult
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_ViewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewed")), m_Viewed));
     }
-    if(m_OptedOutIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedOut")), m_OptedOut));
     }
@@ -152,17 +263,17 @@ bool UpdateNotificationBody::isViewed() const
 void UpdateNotificationBody::setViewed(bool value)
 {
     m_Viewed = value;
-    m_ViewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Viewed);
 }
 
 bool UpdateNotificationBody::viewedIsSet() const
 {
-    return m_ViewedIsSet;
+    return m_FieldsSet.test(FieldBit_Viewed);
 }
 
 void UpdateNotificationBody::unsetViewed()
 {
-    m_ViewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Viewed);
 }
 bool UpdateNotificationBody::isOptedOut() const
 {
@@ -172,17 +283,17 @@ bool UpdateNotificationBody::isOptedOut() const
 void UpdateNotificationBody::setOptedOut(bool value)
 {
     m_OptedOut = value;
-    m_OptedOutIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedOut);
 }
 
 bool UpdateNotificationBody::optedOutIsSet() const
 {
-    return m_OptedOutIsSet;
+    return m_FieldsSet.test(FieldBit_OptedOut);
 }
 
 void UpdateNotificationBody::unsetOptedOut()
 {
-    m_OptedOutIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedOut);
 }
 
 
@@ -194,24 +305,24 @@ std::map<utility::string_t, web::json::value> UpdateNotificationBody::getAdditio
 void UpdateNotificationBody::setAdditionalProperties(const std::map<utility::string_t, web::json::value>& value)
 {
     m_AdditionalProperties = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 void UpdateNotificationBody::addAdditionalProperty(const utility::string_t& key, const web::json::value& value)
 {
     m_AdditionalProperties[key] = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 bool UpdateNotificationBody::additionalPropertiesIsSet() const
 {
-    return m_AdditionalPropertiesIsSet;
+    return m_FieldsSet.test(FieldBit_AdditionalProperties);
 }
 
 void UpdateNotificationBody::unsetAdditionalProperties()
 {
     m_AdditionalProperties.clear();
-    m_AdditionalPropertiesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdditionalProperties);
 }
 }
 }
@@ -20,33 +20,12 @@ namespace model {
 
 UpdateQuestionConfigBody::UpdateQuestionConfigBody()
 {
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_Question = utility::conversions::to_string_t("");
-    m_QuestionIsSet = false;
-    m_HelpText = utility::conversions::to_string_t("");
-    m_HelpTextIsSet = false;
-    m_Type = utility::conversions::to_string_t("");
-    m_TypeIsSet = false;
     m_NumStars = 0.0;
-    m_NumStarsIsSet = false;
     m_Min = 0.0;
-    m_MinIsSet = false;
     m_Max = 0.0;
-    m_MaxIsSet = false;
     m_DefaultValue = 0.0;
-    m_DefaultValueIsSet = false;
-    m_LabelNegative = utility::conversions::to_string_t("");
-    m_LabelNegativeIsSet = false;
-    m_LabelPositive = utility::conversions::to_string_t("");
-    m_LabelPositiveIsSet = false;
-    m_CustomOptionsIsSet = false;
-    m_SubQuestionIdsIsSet = false;
     m_AlwaysShowSubQuestions = false;
-    m_AlwaysShowSubQuestionsIsSet = false;
     m_ReportingOrder = 0.0;
-    m_ReportingOrderIsSet = false;
-    m_AdditionalPropertiesIsSet = false;
 }
 
 UpdateQuestionConfigBody::~UpdateQuestionConfigBody()
@@ -61,78 +40,78 @@ void UpdateQuestionConfigBody::validate()
 web::json::value UpdateQuestionConfigBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_QuestionIsSet)
+    if(m_FieldsSet.test(FieldBit_Question))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("question"))] = ModelBase::toJson(m_Question);
     }
-    if(m_HelpTextIsSet)
+    if(m_FieldsSet.test(FieldBit_HelpText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("helpText"))] = ModelBase::toJson(m_HelpText);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_NumStarsIsSet)
+    if(m_FieldsSet.test(FieldBit_NumStars))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("numStars"))] = ModelBase::toJson(m_NumStars);
     }
-    if(m_MinIsSet)
+    if(m_FieldsSet.test(FieldBit_Min))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("min"))] = ModelBase::toJson(m_Min);
     }
-    if(m_MaxIsSet)
+    if(m_FieldsSet.test(FieldBit_Max))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("max"))] = ModelBase::toJson(m_Max);
     }
-    if(m_DefaultValueIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("defaultValue"))] = ModelBase::toJson(m_DefaultValue);
     }
-    if(m_LabelNegativeIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("labelNegative"))] = ModelBase::toJson(m_LabelNegative);
     }
-    if(m_LabelPositiveIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("labelPositive"))] = ModelBase::toJson(m_LabelPositive);
     }
-    if(m_CustomOptionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("customOptions"))] = ModelBase::toJson(m_CustomOptions);
     }
-    if(m_SubQuestionIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("subQuestionIds"))] = ModelBase::toJson(m_SubQuestionIds);
     }
-    if(m_AlwaysShowSubQuestionsIsSet)
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions"))] = ModelBase::toJson(m_AlwaysShowSubQuestions);
     }
-    if(m_ReportingOrderIsSet)
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reportingOrder"))] = ModelBase::toJson(m_ReportingOrder);
     }
     // Serialize additional properties
-    if(m_AdditionalPropertiesIsSet)
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
     {
         for(const auto& item : m_AdditionalProperties)
         {
@@ -143,189 +122,567 @@ web::json::value UpdateQuestionConfigBody::toJson() const
     return val;
 }
 
-bool UpdateQuestionConfigBody::fromJson(const web::json::value& val)
+void UpdateQuestionConfigBody::writeJson(JsonWriter& writer) const
 {
-    bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("question"))))
+    if(m_FieldsSet.test(FieldBit_Question))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("question")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setQuestion;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setQuestion);
-            setQuestion(refVal_setQuestion);
-            
-        }
+        
+        writer.key(_XPLATSTR("question"));
+        ModelBase::writeJson(writer, m_Question);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("helpText"))))
+    if(m_FieldsSet.test(FieldBit_HelpText))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("helpText")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setHelpText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHelpText);
-            setHelpText(refVal_setHelpText);
-            
-        }
+        
+        writer.key(_XPLATSTR("helpText"));
+        ModelBase::writeJson(writer, m_HelpText);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("numStars"))))
+    if(m_FieldsSet.test(FieldBit_NumStars))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("numStars")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setNumStars;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNumStars);
-            setNumStars(refVal_setNumStars);
-            
-        }
+        
+        writer.key(_XPLATSTR("numStars"));
+        ModelBase::writeJson(writer, m_NumStars);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("min"))))
+    if(m_FieldsSet.test(FieldBit_Min))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("min")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMin);
-            setMin(refVal_setMin);
-            
-        }
+        
+        writer.key(_XPLATSTR("min"));
+        ModelBase::writeJson(writer, m_Min);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("max"))))
+    if(m_FieldsSet.test(FieldBit_Max))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("max")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMax;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMax);
-            setMax(refVal_setMax);
-            
-        }
+        
+        writer.key(_XPLATSTR("max"));
+        ModelBase::writeJson(writer, m_Max);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("defaultValue"))))
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("defaultValue")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setDefaultValue;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultValue);
-            setDefaultValue(refVal_setDefaultValue);
-            
-        }
+        
+        writer.key(_XPLATSTR("defaultValue"));
+        ModelBase::writeJson(writer, m_DefaultValue);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("labelNegative"))))
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("labelNegative")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLabelNegative;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLabelNegative);
-            setLabelNegative(refVal_setLabelNegative);
-            
-        }
+        
+        writer.key(_XPLATSTR("labelNegative"));
+        ModelBase::writeJson(writer, m_LabelNegative);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("labelPositive"))))
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("labelPositive")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLabelPositive;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLabelPositive);
-            setLabelPositive(refVal_setLabelPositive);
-            
-        }
+        
+        writer.key(_XPLATSTR("labelPositive"));
+        ModelBase::writeJson(writer, m_LabelPositive);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("customOptions"))))
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("customOptions")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> refVal_setCustomOptions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCustomOptions);
-            setCustomOptions(refVal_setCustomOptions);
-            
-        }
+        
+        writer.key(_XPLATSTR("customOptions"));
+        ModelBase::writeJson(writer, m_CustomOptions);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("subQuestionIds"))))
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("subQuestionIds")));
-        if(!fieldValue.is_null())
+        
+        writer.key(_XPLATSTR("subQuestionIds"));
+        ModelBase::writeJson(writer, m_SubQuestionIds);
+    }
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
+    {
+        
+        writer.key(_XPLATSTR("alwaysShowSubQuestions"));
+        ModelBase::writeJson(writer, m_AlwaysShowSubQuestions);
+    }
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
+    {
+        
+        writer.key(_XPLATSTR("reportingOrder"));
+        ModelBase::writeJson(writer, m_ReportingOrder);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            std::vector<utility::string_t> refVal_setSubQuestionIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSubQuestionIds);
-            setSubQuestionIds(refVal_setSubQuestionIds);
-            
+            writer.key(item.first);
+            writer.value(item.second);
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions"))))
+
+    writer.endObject();
+}
+
+bool UpdateQuestionConfigBody::fromJson(const web::json::value& val)
+{
+    bool ok = true;
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setAlwaysShowSubQuestions;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAlwaysShowSubQuestions);
-            setAlwaysShowSubQuestions(refVal_setAlwaysShowSubQuestions);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("question")):
+            if(field.first == _XPLATSTR("question"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setQuestion;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setQuestion);
+                    setQuestion(refVal_setQuestion);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("helpText")):
+            if(field.first == _XPLATSTR("helpText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setHelpText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHelpText);
+                    setHelpText(refVal_setHelpText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("numStars")):
+            if(field.first == _XPLATSTR("numStars"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNumStars;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNumStars);
+                    setNumStars(refVal_setNumStars);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("min")):
+            if(field.first == _XPLATSTR("min"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMin);
+                    setMin(refVal_setMin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("max")):
+            if(field.first == _XPLATSTR("max"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMax;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMax);
+                    setMax(refVal_setMax);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("defaultValue")):
+            if(field.first == _XPLATSTR("defaultValue"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setDefaultValue;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDefaultValue);
+                    setDefaultValue(refVal_setDefaultValue);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("labelNegative")):
+            if(field.first == _XPLATSTR("labelNegative"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLabelNegative;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLabelNegative);
+                    setLabelNegative(refVal_setLabelNegative);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("labelPositive")):
+            if(field.first == _XPLATSTR("labelPositive"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLabelPositive;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLabelPositive);
+                    setLabelPositive(refVal_setLabelPositive);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("customOptions")):
+            if(field.first == _XPLATSTR("customOptions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> refVal_setCustomOptions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCustomOptions);
+                    setCustomOptions(refVal_setCustomOptions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("subQuestionIds")):
+            if(field.first == _XPLATSTR("subQuestionIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setSubQuestionIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSubQuestionIds);
+                    setSubQuestionIds(refVal_setSubQuestionIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("alwaysShowSubQuestions")):
+            if(field.first == _XPLATSTR("alwaysShowSubQuestions"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAlwaysShowSubQuestions;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAlwaysShowSubQuestions);
+                    setAlwaysShowSubQuestions(refVal_setAlwaysShowSubQuestions);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reportingOrder")):
+            if(field.first == _XPLATSTR("reportingOrder"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setReportingOrder;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReportingOrder);
+                    setReportingOrder(refVal_setReportingOrder);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        // This is an additional property
+        m_AdditionalProperties[field.first] = fieldValue;
+        m_FieldsSet.set(FieldBit_AdditionalProperties);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reportingOrder"))))
+    return ok;
+}
+
+void UpdateQuestionConfigBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Question))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("question")), m_Question);
+    }
+    if(m_FieldsSet.test(FieldBit_HelpText))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("helpText")), m_HelpText);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_NumStars))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("numStars")), m_NumStars);
+    }
+    if(m_FieldsSet.test(FieldBit_Min))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("min")), m_Min);
+    }
+    if(m_FieldsSet.test(FieldBit_Max))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("max")), m_Max);
+    }
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("defaultValue")), m_DefaultValue);
+    }
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reportingOrder")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("labelNegative")), m_LabelNegative);
+    }
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("labelPositive")), m_LabelPositive);
+    }
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("customOptions")), m_CustomOptions);
+    }
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("subQuestionIds")), m_SubQuestionIds);
+    }
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("alwaysShowSubQuestions")), m_AlwaysShowSubQuestions);
+    }
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reportingOrder")), m_ReportingOrder);
+    }
+    // Serialize additional properties
+    if(m_FieldsSet.test(FieldBit_AdditionalProperties))
+    {
+        for(const auto& item : m_AdditionalProperties)
         {
-            double refVal_setReportingOrder;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReportingOrder);
-            setReportingOrder(refVal_setReportingOrder);
-            
+            writer.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);
+            writer.writeString(item.first);
+            writer.writeString(item.second.serialize());
         }
     }
-    // Capture additional properties (keys not defined in the schema)
-    if(val.is_object())
+}
+
+bool UpdateQuestionConfigBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        for(const auto& item : val.as_object())
+        switch(field.tag)
         {
-            // Skip known properties
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("name"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("question"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("helpText"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("type"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("numStars"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("min"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("max"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("defaultValue"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("labelNegative"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("labelPositive"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("customOptions"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("subQuestionIds"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions"))) continue;
-            if(item.first == utility::conversions::to_string_t(_XPLATSTR("reportingOrder"))) continue;
-            // This is an additional property
-            m_AdditionalProperties[item.first] = item.second;
-            m_AdditionalPropertiesIsSet = true;
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("question")):
+            {
+                utility::string_t refVal_setQuestion;
+                if(!ModelBase::readBinary(reader, field, refVal_setQuestion))
+                {
+                    ok = false;
+                    continue;
+                }
+                setQuestion(refVal_setQuestion);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("helpText")):
+            {
+                utility::string_t refVal_setHelpText;
+                if(!ModelBase::readBinary(reader, field, refVal_setHelpText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHelpText(refVal_setHelpText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                utility::string_t refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("numStars")):
+            {
+                double refVal_setNumStars;
+                if(!ModelBase::readBinary(reader, field, refVal_setNumStars))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNumStars(refVal_setNumStars);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("min")):
+            {
+                double refVal_setMin;
+                if(!ModelBase::readBinary(reader, field, refVal_setMin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMin(refVal_setMin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("max")):
+            {
+                double refVal_setMax;
+                if(!ModelBase::readBinary(reader, field, refVal_setMax))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMax(refVal_setMax);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("defaultValue")):
+            {
+                double refVal_setDefaultValue;
+                if(!ModelBase::readBinary(reader, field, refVal_setDefaultValue))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDefaultValue(refVal_setDefaultValue);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("labelNegative")):
+            {
+                utility::string_t refVal_setLabelNegative;
+                if(!ModelBase::readBinary(reader, field, refVal_setLabelNegative))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLabelNegative(refVal_setLabelNegative);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("labelPositive")):
+            {
+                utility::string_t refVal_setLabelPositive;
+                if(!ModelBase::readBinary(reader, field, refVal_setLabelPositive))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLabelPositive(refVal_setLabelPositive);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("customOptions")):
+            {
+                std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> refVal_setCustomOptions;
+                if(!ModelBase::readBinary(reader, field, refVal_setCustomOptions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCustomOptions(refVal_setCustomOptions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("subQuestionIds")):
+            {
+                std::vector<utility::string_t> refVal_setSubQuestionIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setSubQuestionIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSubQuestionIds(refVal_setSubQuestionIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("alwaysShowSubQuestions")):
+            {
+                bool refVal_setAlwaysShowSubQuestions;
+                if(!ModelBase::readBinary(reader, field, refVal_setAlwaysShowSubQuestions))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAlwaysShowSubQuestions(refVal_setAlwaysShowSubQuestions);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reportingOrder")):
+            {
+                double refVal_setReportingOrder;
+                if(!ModelBase::readBinary(reader, field, refVal_setReportingOrder))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReportingOrder(refVal_setReportingOrder);
+            }
+            continue;
+        default:
+            break;
         }
+        if(field.wireType == BinaryWireType::Named)
+        {
+            utility::string_t key;
+            utility::string_t text;
+            if(reader.readString(key) && reader.readString(text))
+            {
+                try
+                {
+                    m_AdditionalProperties[key] = web::json::value::parse(text);
+                }
+                catch(const web::json::json_exception&)
+                {
+                    return false;
+                }
+                m_FieldsSet.set(FieldBit_AdditionalProperties);
+            }
+            continue;
+        }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateQuestionConfigBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -335,59 +692,59 @@ void UpdateQuestionConfigBody::toMultipart(std::shared_ptr<MultipartFormData> mu
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_QuestionIsSet)
+    if(m_FieldsSet.test(FieldBit_Question))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("question")), m_Question));
     }
-    if(m_HelpTextIsSet)
+    if(m_FieldsSet.test(FieldBit_HelpText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("helpText")), m_HelpText));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_NumStarsIsSet)
+    if(m_FieldsSet.test(FieldBit_NumStars))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("numStars")), m_NumStars));
     }
-    if(m_MinIsSet)
+    if(m_FieldsSet.test(FieldBit_Min))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("min")), m_Min));
     }
-    if(m_MaxIsSet)
+    if(m_FieldsSet.test(FieldBit_Max))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("max")), m_Max));
     }
-    if(m_DefaultValueIsSet)
+    if(m_FieldsSet.test(FieldBit_DefaultValue))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("defaultValue")), m_DefaultValue));
     }
-    if(m_LabelNegativeIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelNegative))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("labelNegative")), m_LabelNegative));
     }
-    if(m_LabelPositiveIsSet)
+    if(m_FieldsSet.test(FieldBit_LabelPositive))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("labelPositive")), m_LabelPositive));
     }
-    if(m_CustomOptionsIsSet)
+    if(m_FieldsSet.test(FieldBit_CustomOptions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("customOptions")), m_CustomOptions));
     }
-    if(m_SubQuestionIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_SubQuestionIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("subQuestionIds")), m_SubQuestionIds));
     }
-    if(m_AlwaysShowSubQuestionsIsSet)
+    if(m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("alwaysShowSubQuestions")), m_AlwaysShowSubQuestions));
     }
-    if(m_ReportingOrderIsSet)
+    if(m_FieldsSet.test(FieldBit_ReportingOrder))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reportingOrder")), m_ReportingOrder));
     }
@@ -499,17 +856,17 @@ utility::string_t UpdateQuestionConfigBody::getName() const
 void UpdateQuestionConfigBody::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool UpdateQuestionConfigBody::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void UpdateQuestionConfigBody::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t UpdateQuestionConfigBody::getQuestion() const
 {
@@ -520,17 +877,17 @@ utility::string_t UpdateQuestionConfigBody::getQuestion() const
 void UpdateQuestionConfigBody::setQuestion(const utility::string_t& value)
 {
     m_Question = value;
-    m_QuestionIsSet = true;
+    m_FieldsSet.set(FieldBit_Question);
 }
 
 bool UpdateQuestionConfigBody::questionIsSet() const
 {
-    return m_QuestionIsSet;
+    return m_FieldsSet.test(FieldBit_Question);
 }
 
 void UpdateQuestionConfigBody::unsetQuestion()
 {
-    m_QuestionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Question);
 }
 utility::string_t UpdateQuestionConfigBody::getHelpText() const
 {
@@ -541,17 +898,17 @@ utility::string_t UpdateQuestionConfigBody::getHelpText() const
 void UpdateQuestionConfigBody::setHelpText(const utility::string_t& value)
 {
     m_HelpText = value;
-    m_HelpTextIsSet = true;
+    m_FieldsSet.set(FieldBit_HelpText);
 }
 
 bool UpdateQuestionConfigBody::helpTextIsSet() const
 {
-    return m_HelpTextIsSet;
+    return m_FieldsSet.test(FieldBit_HelpText);
 }
 
 void UpdateQuestionConfigBody::unsetHelpText()
 {
-    m_HelpTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_HelpText);
 }
 utility::string_t UpdateQuestionConfigBody::getType() const
 {
@@ -562,17 +919,17 @@ utility::string_t UpdateQuestionConfigBody::getType() const
 void UpdateQuestionConfigBody::setType(const utility::string_t& value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool UpdateQuestionConfigBody::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void UpdateQuestionConfigBody::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 double UpdateQuestionConfigBody::getNumStars() const
 {
@@ -582,17 +939,17 @@ double UpdateQuestionConfigBody::getNumStars() const
 void UpdateQuestionConfigBody::setNumStars(double value)
 {
     m_NumStars = value;
-    m_NumStarsIsSet = true;
+    m_FieldsSet.set(FieldBit_NumStars);
 }
 
 bool UpdateQuestionConfigBody::numStarsIsSet() const
 {
-    return m_NumStarsIsSet;
+    return m_FieldsSet.test(FieldBit_NumStars);
 }
 
 void UpdateQuestionConfigBody::unsetNumStars()
 {
-    m_NumStarsIsSet = false;
+    m_FieldsSet.reset(FieldBit_NumStars);
 }
 double UpdateQuestionConfigBody::getMin() const
 {
@@ -602,17 +959,17 @@ double UpdateQuestionConfigBody::getMin() const
 void UpdateQuestionConfigBody::setMin(double value)
 {
     m_Min = value;
-    m_MinIsSet = true;
+    m_FieldsSet.set(FieldBit_Min);
 }
 
 bool UpdateQuestionConfigBody::minIsSet() const
 {
-    return m_MinIsSet;
+    return m_FieldsSet.test(FieldBit_Min);
 }
 
 void UpdateQuestionConfigBody::unsetMin()
 {
-    m_MinIsSet = false;
+    m_FieldsSet.reset(FieldBit_Min);
 }
 double UpdateQuestionConfigBody::getMax() const
 {
@@ -622,17 +979,17 @@ double UpdateQuestionConfigBody::getMax() const
 void UpdateQuestionConfigBody::setMax(double value)
 {
     m_Max = value;
-    m_MaxIsSet = true;
+    m_FieldsSet.set(FieldBit_Max);
 }
 
 bool UpdateQuestionConfigBody::maxIsSet() const
 {
-    return m_MaxIsSet;
+    return m_FieldsSet.test(FieldBit_Max);
 }
 
 void UpdateQuestionConfigBody::unsetMax()
 {
-    m_MaxIsSet = false;
+    m_FieldsSet.reset(FieldBit_Max);
 }
 double UpdateQuestionConfigBody::getDefaultValue() const
 {
@@ -642,17 +999,17 @@ double UpdateQuestionConfigBody::getDefaultValue() const
 void UpdateQuestionConfigBody::setDefaultValue(double value)
 {
     m_DefaultValue = value;
-    m_DefaultValueIsSet = true;
+    m_FieldsSet.set(FieldBit_DefaultValue);
 }
 
 bool UpdateQuestionConfigBody::defaultValueIsSet() const
 {
-    return m_DefaultValueIsSet;
+    return m_FieldsSet.test(FieldBit_DefaultValue);
 }
 
 void UpdateQuestionConfigBody::unsetDefaultValue()
 {
-    m_DefaultValueIsSet = false;
+    m_FieldsSet.reset(FieldBit_DefaultValue);
 }
 utility::string_t UpdateQuestionConfigBody::getLabelNegative() const
 {
@@ -663,17 +1020,17 @@ utility::string_t UpdateQuestionConfigBody::getLabelNegative() const
 void UpdateQuestionConfigBody::setLabelNegative(const utility::string_t& value)
 {
     m_LabelNegative = value;
-    m_LabelNegativeIsSet = true;
+    m_FieldsSet.set(FieldBit_LabelNegative);
 }
 
 bool UpdateQuestionConfigBody::labelNegativeIsSet() const
 {
-    return m_LabelNegativeIsSet;
+    return m_FieldsSet.test(FieldBit_LabelNegative);
 }
 
 void UpdateQuestionConfigBody::unsetLabelNegative()
 {
-    m_LabelNegativeIsSet = false;
+    m_FieldsSet.reset(FieldBit_LabelNegative);
 }
 utility::string_t UpdateQuestionConfigBody::getLabelPositive() const
 {
@@ -684,17 +1041,17 @@ utility::string_t UpdateQuestionConfigBody::getLabelPositive() const
 void UpdateQuestionConfigBody::setLabelPositive(const utility::string_t& value)
 {
     m_LabelPositive = value;
-    m_LabelPositiveIsSet = true;
+    m_FieldsSet.set(FieldBit_LabelPositive);
 }
 
 bool UpdateQuestionConfigBody::labelPositiveIsSet() const
 {
-    return m_LabelPositiveIsSet;
+    return m_FieldsSet.test(FieldBit_LabelPositive);
 }
 
 void UpdateQuestionConfigBody::unsetLabelPositive()
 {
-    m_LabelPositiveIsSet = false;
+    m_FieldsSet.reset(FieldBit_LabelPositive);
 }
 std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> UpdateQuestionConfigBody::getCustomOptions() const
 {
@@ -705,17 +1062,17 @@ std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>> UpdateQuestionC
 void UpdateQuestionConfigBody::setCustomOptions(const std::vector<std::shared_ptr<QuestionConfig_customOptions_inner>>& value)
 {
     m_CustomOptions = value;
-    m_CustomOptionsIsSet = true;
+    m_FieldsSet.set(FieldBit_CustomOptions);
 }
 
 bool UpdateQuestionConfigBody::customOptionsIsSet() const
 {
-    return m_CustomOptionsIsSet;
+    return m_FieldsSet.test(FieldBit_CustomOptions);
 }
 
 void UpdateQuestionConfigBody::unsetCustomOptions()
 {
-    m_CustomOptionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_CustomOptions);
 }
 std::vector<utility::string_t> UpdateQuestionConfigBody::getSubQuestionIds() const
 {
@@ -726,17 +1083,17 @@ std::vector<utility::string_t> UpdateQuestionConfigBody::getSubQuestionIds() con
 void UpdateQuestionConfigBody::setSubQuestionIds(const std::vector<utility::string_t>& value)
 {
     m_SubQuestionIds = value;
-    m_SubQuestionIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_SubQuestionIds);
 }
 
 bool UpdateQuestionConfigBody::subQuestionIdsIsSet() const
 {
-    return m_SubQuestionIdsIsSet;
+    return m_FieldsSet.test(FieldBit_SubQuestionIds);
 }
 
 void UpdateQuestionConfigBody::unsetSubQuestionIds()
 {
-    m_SubQuestionIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_SubQuestionIds);
 }
 bool UpdateQuestionConfigBody::isAlwaysShowSubQuestions() const
 {
@@ -746,17 +1103,17 @@ bool UpdateQuestionConfigBody::isAlwaysShowSubQuestions() const
 void UpdateQuestionConfigBody::setAlwaysShowSubQuestions(bool value)
 {
     m_AlwaysShowSubQuestions = value;
-    m_AlwaysShowSubQuestionsIsSet = true;
+    m_FieldsSet.set(FieldBit_AlwaysShowSubQuestions);
 }
 
 bool UpdateQuestionConfigBody::alwaysShowSubQuestionsIsSet() const
 {
-    return m_AlwaysShowSubQuestionsIsSet;
+    return m_FieldsSet.test(FieldBit_AlwaysShowSubQuestions);
 }
 
 void UpdateQuestionConfigBody::unsetAlwaysShowSubQuestions()
 {
-    m_AlwaysShowSubQuestionsIsSet = false;
+    m_FieldsSet.reset(FieldBit_AlwaysShowSubQuestions);
 }
 double UpdateQuestionConfigBody::getReportingOrder() const
 {
@@ -766,17 +1123,17 @@ double UpdateQuestionConfigBody::getReportingOrder() const
 void UpdateQuestionConfigBody::setReportingOrder(double value)
 {
     m_ReportingOrder = value;
-    m_ReportingOrderIsSet = true;
+    m_FieldsSet.set(FieldBit_ReportingOrder);
 }
 
 bool UpdateQuestionConfigBody::reportingOrderIsSet() const
 {
-    return m_ReportingOrderIsSet;
+    return m_FieldsSet.test(FieldBit_ReportingOrder);
 }
 
 void UpdateQuestionConfigBody::unsetReportingOrder()
 {
-    m_ReportingOrderIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReportingOrder);
 }
 
 
@@ -788,24 +1145,24 @@ std::map<utility::string_t, web::json::value> UpdateQuestionConfigBody::getAddit
 void UpdateQuestionConfigBody::setAdditionalProperties(const std::map<utility::string_t, web::json::value>& value)
 {
     m_AdditionalProperties = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 void UpdateQuestionConfigBody::addAdditionalProperty(const utility::string_t& key, const web::json::value& value)
 {
     m_AdditionalProperties[key] = value;
-    m_AdditionalPropertiesIsSet = true;
+    m_FieldsSet.set(FieldBit_AdditionalProperties);
 }
 
 bool UpdateQuestionConfigBody::additionalPropertiesIsSet() const
 {
-    return m_AdditionalPropertiesIsSet;
+    return m_FieldsSet.test(FieldBit_AdditionalProperties);
 }
 
 void UpdateQuestionConfigBody::unsetAdditionalProperties()
 {
     m_AdditionalProperties.clear();
-    m_AdditionalPropertiesIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdditionalProperties);
 }
 }
 }
@@ -20,51 +20,19 @@ namespace model {
 
 UpdateTenantBody::UpdateTenantBody()
 {
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
-    m_Email = utility::conversions::to_string_t("");
-    m_EmailIsSet = false;
     m_SignUpDate = 0.0;
-    m_SignUpDateIsSet = false;
-    m_PackageId = utility::conversions::to_string_t("");
-    m_PackageIdIsSet = false;
     m_PaymentFrequency = 0.0;
-    m_PaymentFrequencyIsSet = false;
     m_BillingInfoValid = false;
-    m_BillingInfoValidIsSet = false;
     m_BillingHandledExternally = false;
-    m_BillingHandledExternallyIsSet = false;
-    m_CreatedBy = utility::conversions::to_string_t("");
-    m_CreatedByIsSet = false;
     m_IsSetup = false;
-    m_IsSetupIsSet = false;
-    m_DomainConfigurationIsSet = false;
-    m_BillingInfoIsSet = false;
-    m_StripeCustomerId = utility::conversions::to_string_t("");
-    m_StripeCustomerIdIsSet = false;
-    m_StripeSubscriptionId = utility::conversions::to_string_t("");
-    m_StripeSubscriptionIdIsSet = false;
-    m_StripePlanId = utility::conversions::to_string_t("");
-    m_StripePlanIdIsSet = false;
     m_EnableProfanityFilter = false;
-    m_EnableProfanityFilterIsSet = false;
     m_EnableSpamFilter = false;
-    m_EnableSpamFilterIsSet = false;
     m_RemoveUnverifiedComments = false;
-    m_RemoveUnverifiedCommentsIsSet = false;
     m_UnverifiedCommentsTTLms = 0.0;
-    m_UnverifiedCommentsTTLmsIsSet = false;
     m_CommentsRequireApproval = false;
-    m_CommentsRequireApprovalIsSet = false;
     m_AutoApproveCommentOnVerification = false;
-    m_AutoApproveCommentOnVerificationIsSet = false;
     m_SendProfaneToSpam = false;
-    m_SendProfaneToSpamIsSet = false;
     m_DeAnonIpAddr = 0.0;
-    m_DeAnonIpAddrIsSet = false;
-    m_MetaIsSet = false;
-    m_ManagedByTenantId = utility::conversions::to_string_t("");
-    m_ManagedByTenantIdIsSet = false;
 }
 
 UpdateTenantBody::~UpdateTenantBody()
@@ -79,122 +47,122 @@ void UpdateTenantBody::validate()
 web::json::value UpdateTenantBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("signUpDate"))] = ModelBase::toJson(m_SignUpDate);
     }
-    if(m_PackageIdIsSet)
+    if(m_FieldsSet.test(FieldBit_PackageId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("packageId"))] = ModelBase::toJson(m_PackageId);
     }
-    if(m_PaymentFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_PaymentFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("paymentFrequency"))] = ModelBase::toJson(m_PaymentFrequency);
     }
-    if(m_BillingInfoValidIsSet)
+    if(m_FieldsSet.test(FieldBit_BillingInfoValid))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("billingInfoValid"))] = ModelBase::toJson(m_BillingInfoValid);
     }
-    if(m_BillingHandledExternallyIsSet)
+    if(m_FieldsSet.test(FieldBit_BillingHandledExternally))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("billingHandledExternally"))] = ModelBase::toJson(m_BillingHandledExternally);
     }
-    if(m_CreatedByIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdBy"))] = ModelBase::toJson(m_CreatedBy);
     }
-    if(m_IsSetupIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSetup))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSetup"))] = ModelBase::toJson(m_IsSetup);
     }
-    if(m_DomainConfigurationIsSet)
+    if(m_FieldsSet.test(FieldBit_DomainConfiguration))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("domainConfiguration"))] = ModelBase::toJson(m_DomainConfiguration);
     }
-    if(m_BillingInfoIsSet)
+    if(m_FieldsSet.test(FieldBit_BillingInfo))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("billingInfo"))] = ModelBase::toJson(m_BillingInfo);
     }
-    if(m_StripeCustomerIdIsSet)
+    if(m_FieldsSet.test(FieldBit_StripeCustomerId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("stripeCustomerId"))] = ModelBase::toJson(m_StripeCustomerId);
     }
-    if(m_StripeSubscriptionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_StripeSubscriptionId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("stripeSubscriptionId"))] = ModelBase::toJson(m_StripeSubscriptionId);
     }
-    if(m_StripePlanIdIsSet)
+    if(m_FieldsSet.test(FieldBit_StripePlanId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("stripePlanId"))] = ModelBase::toJson(m_StripePlanId);
     }
-    if(m_EnableProfanityFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableProfanityFilter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableProfanityFilter"))] = ModelBase::toJson(m_EnableProfanityFilter);
     }
-    if(m_EnableSpamFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSpamFilter))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("enableSpamFilter"))] = ModelBase::toJson(m_EnableSpamFilter);
     }
-    if(m_RemoveUnverifiedCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_RemoveUnverifiedComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("removeUnverifiedComments"))] = ModelBase::toJson(m_RemoveUnverifiedComments);
     }
-    if(m_UnverifiedCommentsTTLmsIsSet)
+    if(m_FieldsSet.test(FieldBit_UnverifiedCommentsTTLms))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("unverifiedCommentsTTLms"))] = ModelBase::toJson(m_UnverifiedCommentsTTLms);
     }
-    if(m_CommentsRequireApprovalIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentsRequireApproval))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("commentsRequireApproval"))] = ModelBase::toJson(m_CommentsRequireApproval);
     }
-    if(m_AutoApproveCommentOnVerificationIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoApproveCommentOnVerification))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoApproveCommentOnVerification"))] = ModelBase::toJson(m_AutoApproveCommentOnVerification);
     }
-    if(m_SendProfaneToSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_SendProfaneToSpam))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sendProfaneToSpam"))] = ModelBase::toJson(m_SendProfaneToSpam);
     }
-    if(m_DeAnonIpAddrIsSet)
+    if(m_FieldsSet.test(FieldBit_DeAnonIpAddr))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("deAnonIpAddr"))] = ModelBase::toJson(m_DeAnonIpAddr);
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("meta"))] = ModelBase::toJson(m_Meta);
     }
-    if(m_ManagedByTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("managedByTenantId"))] = ModelBase::toJson(m_ManagedByTenantId);
@@ -203,274 +171,867 @@ web::json::value UpdateTenantBody::toJson() const
     return val;
 }
 
+void UpdateTenantBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
+    {
+        
+        writer.key(_XPLATSTR("signUpDate"));
+        ModelBase::writeJson(writer, m_SignUpDate);
+    }
+    if(m_FieldsSet.test(FieldBit_PackageId))
+    {
+        
+        writer.key(_XPLATSTR("packageId"));
+        ModelBase::writeJson(writer, m_PackageId);
+    }
+    if(m_FieldsSet.test(FieldBit_PaymentFrequency))
+    {
+        
+        writer.key(_XPLATSTR("paymentFrequency"));
+        ModelBase::writeJson(writer, m_PaymentFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_BillingInfoValid))
+    {
+        
+        writer.key(_XPLATSTR("billingInfoValid"));
+        ModelBase::writeJson(writer, m_BillingInfoValid);
+    }
+    if(m_FieldsSet.test(FieldBit_BillingHandledExternally))
+    {
+        
+        writer.key(_XPLATSTR("billingHandledExternally"));
+        ModelBase::writeJson(writer, m_BillingHandledExternally);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
+    {
+        
+        writer.key(_XPLATSTR("createdBy"));
+        ModelBase::writeJson(writer, m_CreatedBy);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSetup))
+    {
+        
+        writer.key(_XPLATSTR("isSetup"));
+        ModelBase::writeJson(writer, m_IsSetup);
+    }
+    if(m_FieldsSet.test(FieldBit_DomainConfiguration))
+    {
+        
+        writer.key(_XPLATSTR("domainConfiguration"));
+        ModelBase::writeJson(writer, m_DomainConfiguration);
+    }
+    if(m_FieldsSet.test(FieldBit_BillingInfo))
+    {
+        
+        writer.key(_XPLATSTR("billingInfo"));
+        ModelBase::writeJson(writer, m_BillingInfo);
+    }
+    if(m_FieldsSet.test(FieldBit_StripeCustomerId))
+    {
+        
+        writer.key(_XPLATSTR("stripeCustomerId"));
+        ModelBase::writeJson(writer, m_StripeCustomerId);
+    }
+    if(m_FieldsSet.test(FieldBit_StripeSubscriptionId))
+    {
+        
+        writer.key(_XPLATSTR("stripeSubscriptionId"));
+        ModelBase::writeJson(writer, m_StripeSubscriptionId);
+    }
+    if(m_FieldsSet.test(FieldBit_StripePlanId))
+    {
+        
+        writer.key(_XPLATSTR("stripePlanId"));
+        ModelBase::writeJson(writer, m_StripePlanId);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableProfanityFilter))
+    {
+        
+        writer.key(_XPLATSTR("enableProfanityFilter"));
+        ModelBase::writeJson(writer, m_EnableProfanityFilter);
+    }
+    if(m_FieldsSet.test(FieldBit_EnableSpamFilter))
+    {
+        
+        writer.key(_XPLATSTR("enableSpamFilter"));
+        ModelBase::writeJson(writer, m_EnableSpamFilter);
+    }
+    if(m_FieldsSet.test(FieldBit_RemoveUnverifiedComments))
+    {
+        
+        writer.key(_XPLATSTR("removeUnverifiedComments"));
+        ModelBase::writeJson(writer, m_RemoveUnverifiedComments);
+    }
+    if(m_FieldsSet.test(FieldBit_UnverifiedCommentsTTLms))
+    {
+        
+        writer.key(_XPLATSTR("unverifiedCommentsTTLms"));
+        ModelBase::writeJson(writer, m_UnverifiedCommentsTTLms);
+    }
+    if(m_FieldsSet.test(FieldBit_CommentsRequireApproval))
+    {
+        
+        writer.key(_XPLATSTR("commentsRequireApproval"));
+        ModelBase::writeJson(writer, m_CommentsRequireApproval);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoApproveCommentOnVerification))
+    {
+        
+        writer.key(_XPLATSTR("autoApproveCommentOnVerification"));
+        ModelBase::writeJson(writer, m_AutoApproveCommentOnVerification);
+    }
+    if(m_FieldsSet.test(FieldBit_SendProfaneToSpam))
+    {
+        
+        writer.key(_XPLATSTR("sendProfaneToSpam"));
+        ModelBase::writeJson(writer, m_SendProfaneToSpam);
+    }
+    if(m_FieldsSet.test(FieldBit_DeAnonIpAddr))
+    {
+        
+        writer.key(_XPLATSTR("deAnonIpAddr"));
+        ModelBase::writeJson(writer, m_DeAnonIpAddr);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        writer.key(_XPLATSTR("meta"));
+        ModelBase::writeJson(writer, m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
+    {
+        
+        writer.key(_XPLATSTR("managedByTenantId"));
+        ModelBase::writeJson(writer, m_ManagedByTenantId);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateTenantBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            if(field.first == _XPLATSTR("signUpDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setSignUpDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
+                    setSignUpDate(refVal_setSignUpDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("packageId")):
+            if(field.first == _XPLATSTR("packageId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPackageId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPackageId);
+                    setPackageId(refVal_setPackageId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("paymentFrequency")):
+            if(field.first == _XPLATSTR("paymentFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setPaymentFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPaymentFrequency);
+                    setPaymentFrequency(refVal_setPaymentFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("billingInfoValid")):
+            if(field.first == _XPLATSTR("billingInfoValid"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setBillingInfoValid;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBillingInfoValid);
+                    setBillingInfoValid(refVal_setBillingInfoValid);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("billingHandledExternally")):
+            if(field.first == _XPLATSTR("billingHandledExternally"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setBillingHandledExternally;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBillingHandledExternally);
+                    setBillingHandledExternally(refVal_setBillingHandledExternally);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdBy")):
+            if(field.first == _XPLATSTR("createdBy"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedBy;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedBy);
+                    setCreatedBy(refVal_setCreatedBy);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSetup")):
+            if(field.first == _XPLATSTR("isSetup"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSetup;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSetup);
+                    setIsSetup(refVal_setIsSetup);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("domainConfiguration")):
+            if(field.first == _XPLATSTR("domainConfiguration"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<APIDomainConfiguration>> refVal_setDomainConfiguration;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDomainConfiguration);
+                    setDomainConfiguration(refVal_setDomainConfiguration);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("billingInfo")):
+            if(field.first == _XPLATSTR("billingInfo"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<BillingInfo> refVal_setBillingInfo;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBillingInfo);
+                    setBillingInfo(refVal_setBillingInfo);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("stripeCustomerId")):
+            if(field.first == _XPLATSTR("stripeCustomerId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStripeCustomerId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStripeCustomerId);
+                    setStripeCustomerId(refVal_setStripeCustomerId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("stripeSubscriptionId")):
+            if(field.first == _XPLATSTR("stripeSubscriptionId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStripeSubscriptionId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStripeSubscriptionId);
+                    setStripeSubscriptionId(refVal_setStripeSubscriptionId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("stripePlanId")):
+            if(field.first == _XPLATSTR("stripePlanId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStripePlanId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStripePlanId);
+                    setStripePlanId(refVal_setStripePlanId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableProfanityFilter")):
+            if(field.first == _XPLATSTR("enableProfanityFilter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableProfanityFilter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableProfanityFilter);
+                    setEnableProfanityFilter(refVal_setEnableProfanityFilter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("enableSpamFilter")):
+            if(field.first == _XPLATSTR("enableSpamFilter"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setEnableSpamFilter;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSpamFilter);
+                    setEnableSpamFilter(refVal_setEnableSpamFilter);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("removeUnverifiedComments")):
+            if(field.first == _XPLATSTR("removeUnverifiedComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setRemoveUnverifiedComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRemoveUnverifiedComments);
+                    setRemoveUnverifiedComments(refVal_setRemoveUnverifiedComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("unverifiedCommentsTTLms")):
+            if(field.first == _XPLATSTR("unverifiedCommentsTTLms"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setUnverifiedCommentsTTLms;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUnverifiedCommentsTTLms);
+                    setUnverifiedCommentsTTLms(refVal_setUnverifiedCommentsTTLms);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commentsRequireApproval")):
+            if(field.first == _XPLATSTR("commentsRequireApproval"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setCommentsRequireApproval;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommentsRequireApproval);
+                    setCommentsRequireApproval(refVal_setCommentsRequireApproval);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoApproveCommentOnVerification")):
+            if(field.first == _XPLATSTR("autoApproveCommentOnVerification"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAutoApproveCommentOnVerification;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoApproveCommentOnVerification);
+                    setAutoApproveCommentOnVerification(refVal_setAutoApproveCommentOnVerification);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sendProfaneToSpam")):
+            if(field.first == _XPLATSTR("sendProfaneToSpam"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setSendProfaneToSpam;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSendProfaneToSpam);
+                    setSendProfaneToSpam(refVal_setSendProfaneToSpam);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("deAnonIpAddr")):
+            if(field.first == _XPLATSTR("deAnonIpAddr"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setDeAnonIpAddr;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDeAnonIpAddr);
+                    setDeAnonIpAddr(refVal_setDeAnonIpAddr);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            if(field.first == _XPLATSTR("meta"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
+                    setMeta(refVal_setMeta);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("managedByTenantId")):
+            if(field.first == _XPLATSTR("managedByTenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setManagedByTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setManagedByTenantId);
+                    setManagedByTenantId(refVal_setManagedByTenantId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("signUpDate"))))
+    return ok;
+}
+
+void UpdateTenantBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("signUpDate")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setSignUpDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
-            setSignUpDate(refVal_setSignUpDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("packageId"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("packageId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPackageId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPackageId);
-            setPackageId(refVal_setPackageId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("paymentFrequency"))))
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("paymentFrequency")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setPaymentFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPaymentFrequency);
-            setPaymentFrequency(refVal_setPaymentFrequency);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("signUpDate")), m_SignUpDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("billingInfoValid"))))
+    if(m_FieldsSet.test(FieldBit_PackageId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("billingInfoValid")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setBillingInfoValid;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBillingInfoValid);
-            setBillingInfoValid(refVal_setBillingInfoValid);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("packageId")), m_PackageId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("billingHandledExternally"))))
+    if(m_FieldsSet.test(FieldBit_PaymentFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("billingHandledExternally")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setBillingHandledExternally;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBillingHandledExternally);
-            setBillingHandledExternally(refVal_setBillingHandledExternally);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("paymentFrequency")), m_PaymentFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdBy"))))
+    if(m_FieldsSet.test(FieldBit_BillingInfoValid))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdBy")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedBy;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedBy);
-            setCreatedBy(refVal_setCreatedBy);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("billingInfoValid")), m_BillingInfoValid);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSetup"))))
+    if(m_FieldsSet.test(FieldBit_BillingHandledExternally))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSetup")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSetup;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSetup);
-            setIsSetup(refVal_setIsSetup);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("billingHandledExternally")), m_BillingHandledExternally);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("domainConfiguration"))))
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("domainConfiguration")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<APIDomainConfiguration>> refVal_setDomainConfiguration;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDomainConfiguration);
-            setDomainConfiguration(refVal_setDomainConfiguration);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdBy")), m_CreatedBy);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("billingInfo"))))
+    if(m_FieldsSet.test(FieldBit_IsSetup))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("billingInfo")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<BillingInfo> refVal_setBillingInfo;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBillingInfo);
-            setBillingInfo(refVal_setBillingInfo);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSetup")), m_IsSetup);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("stripeCustomerId"))))
+    if(m_FieldsSet.test(FieldBit_DomainConfiguration))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("stripeCustomerId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStripeCustomerId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStripeCustomerId);
-            setStripeCustomerId(refVal_setStripeCustomerId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("domainConfiguration")), m_DomainConfiguration);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("stripeSubscriptionId"))))
+    if(m_FieldsSet.test(FieldBit_BillingInfo))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("stripeSubscriptionId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStripeSubscriptionId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStripeSubscriptionId);
-            setStripeSubscriptionId(refVal_setStripeSubscriptionId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("billingInfo")), m_BillingInfo);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("stripePlanId"))))
+    if(m_FieldsSet.test(FieldBit_StripeCustomerId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("stripePlanId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStripePlanId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStripePlanId);
-            setStripePlanId(refVal_setStripePlanId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("stripeCustomerId")), m_StripeCustomerId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableProfanityFilter"))))
+    if(m_FieldsSet.test(FieldBit_StripeSubscriptionId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableProfanityFilter")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableProfanityFilter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableProfanityFilter);
-            setEnableProfanityFilter(refVal_setEnableProfanityFilter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("stripeSubscriptionId")), m_StripeSubscriptionId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("enableSpamFilter"))))
+    if(m_FieldsSet.test(FieldBit_StripePlanId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("enableSpamFilter")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setEnableSpamFilter;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEnableSpamFilter);
-            setEnableSpamFilter(refVal_setEnableSpamFilter);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("stripePlanId")), m_StripePlanId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("removeUnverifiedComments"))))
+    if(m_FieldsSet.test(FieldBit_EnableProfanityFilter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("removeUnverifiedComments")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setRemoveUnverifiedComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRemoveUnverifiedComments);
-            setRemoveUnverifiedComments(refVal_setRemoveUnverifiedComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableProfanityFilter")), m_EnableProfanityFilter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("unverifiedCommentsTTLms"))))
+    if(m_FieldsSet.test(FieldBit_EnableSpamFilter))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("unverifiedCommentsTTLms")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setUnverifiedCommentsTTLms;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUnverifiedCommentsTTLms);
-            setUnverifiedCommentsTTLms(refVal_setUnverifiedCommentsTTLms);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("enableSpamFilter")), m_EnableSpamFilter);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commentsRequireApproval"))))
+    if(m_FieldsSet.test(FieldBit_RemoveUnverifiedComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commentsRequireApproval")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setCommentsRequireApproval;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommentsRequireApproval);
-            setCommentsRequireApproval(refVal_setCommentsRequireApproval);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("removeUnverifiedComments")), m_RemoveUnverifiedComments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoApproveCommentOnVerification"))))
+    if(m_FieldsSet.test(FieldBit_UnverifiedCommentsTTLms))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoApproveCommentOnVerification")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setAutoApproveCommentOnVerification;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoApproveCommentOnVerification);
-            setAutoApproveCommentOnVerification(refVal_setAutoApproveCommentOnVerification);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("unverifiedCommentsTTLms")), m_UnverifiedCommentsTTLms);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sendProfaneToSpam"))))
+    if(m_FieldsSet.test(FieldBit_CommentsRequireApproval))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sendProfaneToSpam")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setSendProfaneToSpam;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSendProfaneToSpam);
-            setSendProfaneToSpam(refVal_setSendProfaneToSpam);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commentsRequireApproval")), m_CommentsRequireApproval);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("deAnonIpAddr"))))
+    if(m_FieldsSet.test(FieldBit_AutoApproveCommentOnVerification))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("deAnonIpAddr")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setDeAnonIpAddr;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDeAnonIpAddr);
-            setDeAnonIpAddr(refVal_setDeAnonIpAddr);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoApproveCommentOnVerification")), m_AutoApproveCommentOnVerification);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("meta"))))
+    if(m_FieldsSet.test(FieldBit_SendProfaneToSpam))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("meta")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, utility::string_t> refVal_setMeta;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMeta);
-            setMeta(refVal_setMeta);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sendProfaneToSpam")), m_SendProfaneToSpam);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("managedByTenantId"))))
+    if(m_FieldsSet.test(FieldBit_DeAnonIpAddr))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("managedByTenantId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("deAnonIpAddr")), m_DeAnonIpAddr);
+    }
+    if(m_FieldsSet.test(FieldBit_Meta))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("meta")), m_Meta);
+    }
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("managedByTenantId")), m_ManagedByTenantId);
+    }
+}
+
+bool UpdateTenantBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setManagedByTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setManagedByTenantId);
-            setManagedByTenantId(refVal_setManagedByTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            {
+                double refVal_setSignUpDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setSignUpDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSignUpDate(refVal_setSignUpDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("packageId")):
+            {
+                utility::string_t refVal_setPackageId;
+                if(!ModelBase::readBinary(reader, field, refVal_setPackageId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPackageId(refVal_setPackageId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("paymentFrequency")):
+            {
+                double refVal_setPaymentFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setPaymentFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPaymentFrequency(refVal_setPaymentFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("billingInfoValid")):
+            {
+                bool refVal_setBillingInfoValid;
+                if(!ModelBase::readBinary(reader, field, refVal_setBillingInfoValid))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBillingInfoValid(refVal_setBillingInfoValid);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("billingHandledExternally")):
+            {
+                bool refVal_setBillingHandledExternally;
+                if(!ModelBase::readBinary(reader, field, refVal_setBillingHandledExternally))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBillingHandledExternally(refVal_setBillingHandledExternally);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdBy")):
+            {
+                utility::string_t refVal_setCreatedBy;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedBy))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedBy(refVal_setCreatedBy);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSetup")):
+            {
+                bool refVal_setIsSetup;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSetup))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSetup(refVal_setIsSetup);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("domainConfiguration")):
+            {
+                std::vector<std::shared_ptr<APIDomainConfiguration>> refVal_setDomainConfiguration;
+                if(!ModelBase::readBinary(reader, field, refVal_setDomainConfiguration))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDomainConfiguration(refVal_setDomainConfiguration);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("billingInfo")):
+            {
+                std::shared_ptr<BillingInfo> refVal_setBillingInfo;
+                if(!ModelBase::readBinary(reader, field, refVal_setBillingInfo))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBillingInfo(refVal_setBillingInfo);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("stripeCustomerId")):
+            {
+                utility::string_t refVal_setStripeCustomerId;
+                if(!ModelBase::readBinary(reader, field, refVal_setStripeCustomerId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStripeCustomerId(refVal_setStripeCustomerId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("stripeSubscriptionId")):
+            {
+                utility::string_t refVal_setStripeSubscriptionId;
+                if(!ModelBase::readBinary(reader, field, refVal_setStripeSubscriptionId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStripeSubscriptionId(refVal_setStripeSubscriptionId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("stripePlanId")):
+            {
+                utility::string_t refVal_setStripePlanId;
+                if(!ModelBase::readBinary(reader, field, refVal_setStripePlanId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStripePlanId(refVal_setStripePlanId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableProfanityFilter")):
+            {
+                bool refVal_setEnableProfanityFilter;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableProfanityFilter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableProfanityFilter(refVal_setEnableProfanityFilter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("enableSpamFilter")):
+            {
+                bool refVal_setEnableSpamFilter;
+                if(!ModelBase::readBinary(reader, field, refVal_setEnableSpamFilter))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEnableSpamFilter(refVal_setEnableSpamFilter);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("removeUnverifiedComments")):
+            {
+                bool refVal_setRemoveUnverifiedComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setRemoveUnverifiedComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRemoveUnverifiedComments(refVal_setRemoveUnverifiedComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("unverifiedCommentsTTLms")):
+            {
+                double refVal_setUnverifiedCommentsTTLms;
+                if(!ModelBase::readBinary(reader, field, refVal_setUnverifiedCommentsTTLms))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUnverifiedCommentsTTLms(refVal_setUnverifiedCommentsTTLms);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commentsRequireApproval")):
+            {
+                bool refVal_setCommentsRequireApproval;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommentsRequireApproval))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommentsRequireApproval(refVal_setCommentsRequireApproval);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoApproveCommentOnVerification")):
+            {
+                bool refVal_setAutoApproveCommentOnVerification;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoApproveCommentOnVerification))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoApproveCommentOnVerification(refVal_setAutoApproveCommentOnVerification);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sendProfaneToSpam")):
+            {
+                bool refVal_setSendProfaneToSpam;
+                if(!ModelBase::readBinary(reader, field, refVal_setSendProfaneToSpam))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSendProfaneToSpam(refVal_setSendProfaneToSpam);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("deAnonIpAddr")):
+            {
+                double refVal_setDeAnonIpAddr;
+                if(!ModelBase::readBinary(reader, field, refVal_setDeAnonIpAddr))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDeAnonIpAddr(refVal_setDeAnonIpAddr);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("meta")):
+            {
+                std::map<utility::string_t, utility::string_t> refVal_setMeta;
+                if(!ModelBase::readBinary(reader, field, refVal_setMeta))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMeta(refVal_setMeta);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("managedByTenantId")):
+            {
+                utility::string_t refVal_setManagedByTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setManagedByTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setManagedByTenantId(refVal_setManagedByTenantId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateTenantBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -480,99 +1041,99 @@ void UpdateTenantBody::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_EmailIsSet)
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("signUpDate")), m_SignUpDate));
     }
-    if(m_PackageIdIsSet)
+    if(m_FieldsSet.test(FieldBit_PackageId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("packageId")), m_PackageId));
     }
-    if(m_PaymentFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_PaymentFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("paymentFrequency")), m_PaymentFrequency));
     }
-    if(m_BillingInfoValidIsSet)
+    if(m_FieldsSet.test(FieldBit_BillingInfoValid))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("billingInfoValid")), m_BillingInfoValid));
     }
-    if(m_BillingHandledExternallyIsSet)
+    if(m_FieldsSet.test(FieldBit_BillingHandledExternally))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("billingHandledExternally")), m_BillingHandledExternally));
     }
-    if(m_CreatedByIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedBy))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdBy")), m_CreatedBy));
     }
-    if(m_IsSetupIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSetup))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSetup")), m_IsSetup));
     }
-    if(m_DomainConfigurationIsSet)
+    if(m_FieldsSet.test(FieldBit_DomainConfiguration))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("domainConfiguration")), m_DomainConfiguration));
     }
-    if(m_BillingInfoIsSet)
+    if(m_FieldsSet.test(FieldBit_BillingInfo))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("billingInfo")), m_BillingInfo));
     }
-    if(m_StripeCustomerIdIsSet)
+    if(m_FieldsSet.test(FieldBit_StripeCustomerId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("stripeCustomerId")), m_StripeCustomerId));
     }
-    if(m_StripeSubscriptionIdIsSet)
+    if(m_FieldsSet.test(FieldBit_StripeSubscriptionId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("stripeSubscriptionId")), m_StripeSubscriptionId));
     }
-    if(m_StripePlanIdIsSet)
+    if(m_FieldsSet.test(FieldBit_StripePlanId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("stripePlanId")), m_StripePlanId));
     }
-    if(m_EnableProfanityFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableProfanityFilter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableProfanityFilter")), m_EnableProfanityFilter));
     }
-    if(m_EnableSpamFilterIsSet)
+    if(m_FieldsSet.test(FieldBit_EnableSpamFilter))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("enableSpamFilter")), m_EnableSpamFilter));
     }
-    if(m_RemoveUnverifiedCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_RemoveUnverifiedComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("removeUnverifiedComments")), m_RemoveUnverifiedComments));
     }
-    if(m_UnverifiedCommentsTTLmsIsSet)
+    if(m_FieldsSet.test(FieldBit_UnverifiedCommentsTTLms))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("unverifiedCommentsTTLms")), m_UnverifiedCommentsTTLms));
     }
-    if(m_CommentsRequireApprovalIsSet)
+    if(m_FieldsSet.test(FieldBit_CommentsRequireApproval))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commentsRequireApproval")), m_CommentsRequireApproval));
     }
-    if(m_AutoApproveCommentOnVerificationIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoApproveCommentOnVerification))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoApproveCommentOnVerification")), m_AutoApproveCommentOnVerification));
     }
-    if(m_SendProfaneToSpamIsSet)
+    if(m_FieldsSet.test(FieldBit_SendProfaneToSpam))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sendProfaneToSpam")), m_SendProfaneToSpam));
     }
-    if(m_DeAnonIpAddrIsSet)
+    if(m_FieldsSet.test(FieldBit_DeAnonIpAddr))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("deAnonIpAddr")), m_DeAnonIpAddr));
     }
-    if(m_MetaIsSet)
+    if(m_FieldsSet.test(FieldBit_Meta))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("meta")), m_Meta));
     }
-    if(m_ManagedByTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_ManagedByTenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("managedByTenantId")), m_ManagedByTenantId));
     }
@@ -744,17 +1305,17 @@ utility::string_t UpdateTenantBody::getName() const
 void UpdateTenantBody::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool UpdateTenantBody::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void UpdateTenantBody::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 utility::string_t UpdateTenantBody::getEmail() const
 {
@@ -765,17 +1326,17 @@ utility::string_t UpdateTenantBody::getEmail() const
 void UpdateTenantBody::setEmail(const utility::string_t& value)
 {
     m_Email = value;
-    m_EmailIsSet = true;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool UpdateTenantBody::emailIsSet() const
 {
-    return m_EmailIsSet;
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void UpdateTenantBody::unsetEmail()
 {
-    m_EmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_Email);
 }
 double UpdateTenantBody::getSignUpDate() const
 {
@@ -785,17 +1346,17 @@ double UpdateTenantBody::getSignUpDate() const
 void UpdateTenantBody::setSignUpDate(double value)
 {
     m_SignUpDate = value;
-    m_SignUpDateIsSet = true;
+    m_FieldsSet.set(FieldBit_SignUpDate);
 }
 
 bool UpdateTenantBody::signUpDateIsSet() const
 {
-    return m_SignUpDateIsSet;
+    return m_FieldsSet.test(FieldBit_SignUpDate);
 }
 
 void UpdateTenantBody::unsetSignUpDate()
 {
-    m_SignUpDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_SignUpDate);
 }
 utility::string_t UpdateTenantBody::getPackageId() const
 {
@@ -806,17 +1367,17 @@ utility::string_t UpdateTenantBody::getPackageId() const
 void UpdateTenantBody::setPackageId(const utility::string_t& value)
 {
     m_PackageId = value;
-    m_PackageIdIsSet = true;
+    m_FieldsSet.set(FieldBit_PackageId);
 }
 
 bool UpdateTenantBody::packageIdIsSet() const
 {
-    return m_PackageIdIsSet;
+    return m_FieldsSet.test(FieldBit_PackageId);
 }
 
 void UpdateTenantBody::unsetPackageId()
 {
-    m_PackageIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_PackageId);
 }
 double UpdateTenantBody::getPaymentFrequency() const
 {
@@ -826,17 +1387,17 @@ double UpdateTenantBody::getPaymentFrequency() const
 void UpdateTenantBody::setPaymentFrequency(double value)
 {
     m_PaymentFrequency = value;
-    m_PaymentFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_PaymentFrequency);
 }
 
 bool UpdateTenantBody::paymentFrequencyIsSet() const
 {
-    return m_PaymentFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_PaymentFrequency);
 }
 
 void UpdateTenantBody::unsetPaymentFrequency()
 {
-    m_PaymentFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_PaymentFrequency);
 }
 bool UpdateTenantBody::isBillingInfoValid() const
 {
@@ -846,17 +1407,17 @@ bool UpdateTenantBody::isBillingInfoValid() const
 void UpdateTenantBody::setBillingInfoValid(bool value)
 {
     m_BillingInfoValid = value;
-    m_BillingInfoValidIsSet = true;
+    m_FieldsSet.set(FieldBit_BillingInfoValid);
 }
 
 bool UpdateTenantBody::billingInfoValidIsSet() const
 {
-    return m_BillingInfoValidIsSet;
+    return m_FieldsSet.test(FieldBit_BillingInfoValid);
 }
 
 void UpdateTenantBody::unsetBillingInfoValid()
 {
-    m_BillingInfoValidIsSet = false;
+    m_FieldsSet.reset(FieldBit_BillingInfoValid);
 }
 bool UpdateTenantBody::isBillingHandledExternally() const
 {
@@ -866,17 +1427,17 @@ bool UpdateTenantBody::isBillingHandledExternally() const
 void UpdateTenantBody::setBillingHandledExternally(bool value)
 {
     m_BillingHandledExternally = value;
-    m_BillingHandledExternallyIsSet = true;
+    m_FieldsSet.set(FieldBit_BillingHandledExternally);
 }
 
 bool UpdateTenantBody::billingHandledExternallyIsSet() const
 {
-    return m_BillingHandledExternallyIsSet;
+    return m_FieldsSet.test(FieldBit_BillingHandledExternally);
 }
 
 void UpdateTenantBody::unsetBillingHandledExternally()
 {
-    m_BillingHandledExternallyIsSet = false;
+    m_FieldsSet.reset(FieldBit_BillingHandledExternally);
 }
 utility::string_t UpdateTenantBody::getCreatedBy() const
 {
@@ -887,17 +1448,17 @@ utility::string_t UpdateTenantBody::getCreatedBy() const
 void UpdateTenantBody::setCreatedBy(const utility::string_t& value)
 {
     m_CreatedBy = value;
-    m_CreatedByIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedBy);
 }
 
 bool UpdateTenantBody::createdByIsSet() const
 {
-    return m_CreatedByIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedBy);
 }
 
 void UpdateTenantBody::unsetCreatedBy()
 {
-    m_CreatedByIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedBy);
 }
 bool UpdateTenantBody::isIsSetup() const
 {
@@ -907,17 +1468,17 @@ bool UpdateTenantBody::isIsSetup() const
 void UpdateTenantBody::setIsSetup(bool value)
 {
     m_IsSetup = value;
-    m_IsSetupIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSetup);
 }
 
 bool UpdateTenantBody::isSetupIsSet() const
 {
-    return m_IsSetupIsSet;
+    return m_FieldsSet.test(FieldBit_IsSetup);
 }
 
 void UpdateTenantBody::unsetIsSetup()
 {
-    m_IsSetupIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSetup);
 }
 std::vector<std::shared_ptr<APIDomainConfiguration>> UpdateTenantBody::getDomainConfiguration() const
 {
@@ -928,17 +1489,17 @@ std::vector<std::shared_ptr<APIDomainConfiguration>> UpdateTenantBody::getDomain
 void UpdateTenantBody::setDomainConfiguration(const std::vector<std::shared_ptr<APIDomainConfiguration>>& value)
 {
     m_DomainConfiguration = value;
-    m_DomainConfigurationIsSet = true;
+    m_FieldsSet.set(FieldBit_DomainConfiguration);
 }
 
 bool UpdateTenantBody::domainConfigurationIsSet() const
 {
-    return m_DomainConfigurationIsSet;
+    return m_FieldsSet.test(FieldBit_DomainConfiguration);
 }
 
 void UpdateTenantBody::unsetDomainConfiguration()
 {
-    m_DomainConfigurationIsSet = false;
+    m_FieldsSet.reset(FieldBit_DomainConfiguration);
 }
 std::shared_ptr<BillingInfo> UpdateTenantBody::getBillingInfo() const
 {
@@ -949,17 +1510,17 @@ std::shared_ptr<BillingInfo> UpdateTenantBody::getBillingInfo() const
 void UpdateTenantBody::setBillingInfo(const std::shared_ptr<BillingInfo>& value)
 {
     m_BillingInfo = value;
-    m_BillingInfoIsSet = true;
+    m_FieldsSet.set(FieldBit_BillingInfo);
 }
 
 bool UpdateTenantBody::billingInfoIsSet() const
 {
-    return m_BillingInfoIsSet;
+    return m_FieldsSet.test(FieldBit_BillingInfo);
 }
 
 void UpdateTenantBody::unsetBillingInfo()
 {
-    m_BillingInfoIsSet = false;
+    m_FieldsSet.reset(FieldBit_BillingInfo);
 }
 utility::string_t UpdateTenantBody::getStripeCustomerId() const
 {
@@ -970,17 +1531,17 @@ utility::string_t UpdateTenantBody::getStripeCustomerId() const
 void UpdateTenantBody::setStripeCustomerId(const utility::string_t& value)
 {
     m_StripeCustomerId = value;
-    m_StripeCustomerIdIsSet = true;
+    m_FieldsSet.set(FieldBit_StripeCustomerId);
 }
 
 bool UpdateTenantBody::stripeCustomerIdIsSet() const
 {
-    return m_StripeCustomerIdIsSet;
+    return m_FieldsSet.test(FieldBit_StripeCustomerId);
 }
 
 void UpdateTenantBody::unsetStripeCustomerId()
 {
-    m_StripeCustomerIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_StripeCustomerId);
 }
 utility::string_t UpdateTenantBody::getStripeSubscriptionId() const
 {
@@ -991,17 +1552,17 @@ utility::string_t UpdateTenantBody::getStripeSubscriptionId() const
 void UpdateTenantBody::setStripeSubscriptionId(const utility::string_t& value)
 {
     m_StripeSubscriptionId = value;
-    m_StripeSubscriptionIdIsSet = true;
+    m_FieldsSet.set(FieldBit_StripeSubscriptionId);
 }
 
 bool UpdateTenantBody::stripeSubscriptionIdIsSet() const
 {
-    return m_StripeSubscriptionIdIsSet;
+    return m_FieldsSet.test(FieldBit_StripeSubscriptionId);
 }
 
 void UpdateTenantBody::unsetStripeSubscriptionId()
 {
-    m_StripeSubscriptionIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_StripeSubscriptionId);
 }
 utility::string_t UpdateTenantBody::getStripePlanId() const
 {
@@ -1012,17 +1573,17 @@ utility::string_t UpdateTenantBody::getStripePlanId() const
 void UpdateTenantBody::setStripePlanId(const utility::string_t& value)
 {
     m_StripePlanId = value;
-    m_StripePlanIdIsSet = true;
+    m_FieldsSet.set(FieldBit_StripePlanId);
 }
 
 bool UpdateTenantBody::stripePlanIdIsSet() const
 {
-    return m_StripePlanIdIsSet;
+    return m_FieldsSet.test(FieldBit_StripePlanId);
 }
 
 void UpdateTenantBody::unsetStripePlanId()
 {
-    m_StripePlanIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_StripePlanId);
 }
 bool UpdateTenantBody::isEnableProfanityFilter() const
 {
@@ -1032,17 +1593,17 @@ bool UpdateTenantBody::isEnableProfanityFilter() const
 void UpdateTenantBody::setEnableProfanityFilter(bool value)
 {
     m_EnableProfanityFilter = value;
-    m_EnableProfanityFilterIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableProfanityFilter);
 }
 
 bool UpdateTenantBody::enableProfanityFilterIsSet() const
 {
-    return m_EnableProfanityFilterIsSet;
+    return m_FieldsSet.test(FieldBit_EnableProfanityFilter);
 }
 
 void UpdateTenantBody::unsetEnableProfanityFilter()
 {
-    m_EnableProfanityFilterIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableProfanityFilter);
 }
 bool UpdateTenantBody::isEnableSpamFilter() const
 {
@@ -1052,17 +1613,17 @@ bool UpdateTenantBody::isEnableSpamFilter() const
 void UpdateTenantBody::setEnableSpamFilter(bool value)
 {
     m_EnableSpamFilter = value;
-    m_EnableSpamFilterIsSet = true;
+    m_FieldsSet.set(FieldBit_EnableSpamFilter);
 }
 
 bool UpdateTenantBody::enableSpamFilterIsSet() const
 {
-    return m_EnableSpamFilterIsSet;
+    return m_FieldsSet.test(FieldBit_EnableSpamFilter);
 }
 
 void UpdateTenantBody::unsetEnableSpamFilter()
 {
-    m_EnableSpamFilterIsSet = false;
+    m_FieldsSet.reset(FieldBit_EnableSpamFilter);
 }
 bool UpdateTenantBody::isRemoveUnverifiedComments() const
 {
@@ -1072,17 +1633,17 @@ bool UpdateTenantBody::isRemoveUnverifiedComments() const
 void UpdateTenantBody::setRemoveUnverifiedComments(bool value)
 {
     m_RemoveUnverifiedComments = value;
-    m_RemoveUnverifiedCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_RemoveUnverifiedComments);
 }
 
 bool UpdateTenantBody::removeUnverifiedCommentsIsSet() const
 {
-    return m_RemoveUnverifiedCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_RemoveUnverifiedComments);
 }
 
 void UpdateTenantBody::unsetRemoveUnverifiedComments()
 {
-    m_RemoveUnverifiedCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_RemoveUnverifiedComments);
 }
 double UpdateTenantBody::getUnverifiedCommentsTTLms() const
 {
@@ -1092,17 +1653,17 @@ double UpdateTenantBody::getUnverifiedCommentsTTLms() const
 void UpdateTenantBody::setUnverifiedCommentsTTLms(double value)
 {
     m_UnverifiedCommentsTTLms = value;
-    m_UnverifiedCommentsTTLmsIsSet = true;
+    m_FieldsSet.set(FieldBit_UnverifiedCommentsTTLms);
 }
 
 bool UpdateTenantBody::unverifiedCommentsTTLmsIsSet() const
 {
-    return m_UnverifiedCommentsTTLmsIsSet;
+    return m_FieldsSet.test(FieldBit_UnverifiedCommentsTTLms);
 }
 
 void UpdateTenantBody::unsetUnverifiedCommentsTTLms()
 {
-    m_UnverifiedCommentsTTLmsIsSet = false;
+    m_FieldsSet.reset(FieldBit_UnverifiedCommentsTTLms);
 }
 bool UpdateTenantBody::isCommentsRequireApproval() const
 {
@@ -1112,17 +1673,17 @@ bool UpdateTenantBody::isCommentsRequireApproval() const
 void UpdateTenantBody::setCommentsRequireApproval(bool value)
 {
     m_CommentsRequireApproval = value;
-    m_CommentsRequireApprovalIsSet = true;
+    m_FieldsSet.set(FieldBit_CommentsRequireApproval);
 }
 
 bool UpdateTenantBody::commentsRequireApprovalIsSet() const
 {
-    return m_CommentsRequireApprovalIsSet;
+    return m_FieldsSet.test(FieldBit_CommentsRequireApproval);
 }
 
 void UpdateTenantBody::unsetCommentsRequireApproval()
 {
-    m_CommentsRequireApprovalIsSet = false;
+    m_FieldsSet.reset(FieldBit_CommentsRequireApproval);
 }
 bool UpdateTenantBody::isAutoApproveCommentOnVerification() const
 {
@@ -1132,17 +1693,17 @@ bool UpdateTenantBody::isAutoApproveCommentOnVerification() const
 void UpdateTenantBody::setAutoApproveCommentOnVerification(bool value)
 {
     m_AutoApproveCommentOnVerification = value;
-    m_AutoApproveCommentOnVerificationIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoApproveCommentOnVerification);
 }
 
 bool UpdateTenantBody::autoApproveCommentOnVerificationIsSet() const
 {
-    return m_AutoApproveCommentOnVerificationIsSet;
+    return m_FieldsSet.test(FieldBit_AutoApproveCommentOnVerification);
 }
 
 void UpdateTenantBody::unsetAutoApproveCommentOnVerification()
 {
-    m_AutoApproveCommentOnVerificationIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoApproveCommentOnVerification);
 }
 bool UpdateTenantBody::isSendProfaneToSpam() const
 {
@@ -1152,17 +1713,17 @@ bool UpdateTenantBody::isSendProfaneToSpam() const
 void UpdateTenantBody::setSendProfaneToSpam(bool value)
 {
     m_SendProfaneToSpam = value;
-    m_SendProfaneToSpamIsSet = true;
+    m_FieldsSet.set(FieldBit_SendProfaneToSpam);
 }
 
 bool UpdateTenantBody::sendProfaneToSpamIsSet() const
 {
-    return m_SendProfaneToSpamIsSet;
+    return m_FieldsSet.test(FieldBit_SendProfaneToSpam);
 }
 
 void UpdateTenantBody::unsetSendProfaneToSpam()
 {
-    m_SendProfaneToSpamIsSet = false;
+    m_FieldsSet.reset(FieldBit_SendProfaneToSpam);
 }
 double UpdateTenantBody::getDeAnonIpAddr() const
 {
@@ -1172,17 +1733,17 @@ double UpdateTenantBody::getDeAnonIpAddr() const
 void UpdateTenantBody::setDeAnonIpAddr(double value)
 {
     m_DeAnonIpAddr = value;
-    m_DeAnonIpAddrIsSet = true;
+    m_FieldsSet.set(FieldBit_DeAnonIpAddr);
 }
 
 bool UpdateTenantBody::deAnonIpAddrIsSet() const
 {
-    return m_DeAnonIpAddrIsSet;
+    return m_FieldsSet.test(FieldBit_DeAnonIpAddr);
 }
 
 void UpdateTenantBody::unsetDeAnonIpAddr()
 {
-    m_DeAnonIpAddrIsSet = false;
+    m_FieldsSet.reset(FieldBit_DeAnonIpAddr);
 }
 std::map<utility::string_t, utility::string_t> UpdateTenantBody::getMeta() const
 {
@@ -1193,17 +1754,17 @@ std::map<utility::string_t, utility::string_t> UpdateTenantBody::getMeta() const
 void UpdateTenantBody::setMeta(const std::map<utility::string_t, utility::string_t>& value)
 {
     m_Meta = value;
-    m_MetaIsSet = true;
+    m_FieldsSet.set(FieldBit_Meta);
 }
 
 bool UpdateTenantBody::metaIsSet() const
 {
-    return m_MetaIsSet;
+    return m_FieldsSet.test(FieldBit_Meta);
 }
 
 void UpdateTenantBody::unsetMeta()
 {
-    m_MetaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Meta);
 }
 utility::string_t UpdateTenantBody::getManagedByTenantId() const
 {
@@ -1214,17 +1775,17 @@ utility::string_t UpdateTenantBody::getManagedByTenantId() const
 void UpdateTenantBody::setManagedByTenantId(const utility::string_t& value)
 {
     m_ManagedByTenantId = value;
-    m_ManagedByTenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_ManagedByTenantId);
 }
 
 bool UpdateTenantBody::managedByTenantIdIsSet() const
 {
-    return m_ManagedByTenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_ManagedByTenantId);
 }
 
 void UpdateTenantBody::unsetManagedByTenantId()
 {
-    m_ManagedByTenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_ManagedByTenantId);
 }
 
 }
@@ -20,69 +20,35 @@ namespace model {
 
 UpdateTenantPackageBody::UpdateTenantPackageBody()
 {
-    m_Name = utility::conversions::to_string_t("");
-    m_NameIsSet = false;
     m_MonthlyCostUSD = 0.0;
-    m_MonthlyCostUSDIsSet = false;
     m_YearlyCostUSD = 0.0;
-    m_YearlyCostUSDIsSet = false;
     m_MaxMonthlyPageLoads = 0.0;
-    m_MaxMonthlyPageLoadsIsSet = false;
     m_MaxMonthlyAPICredits = 0.0;
-    m_MaxMonthlyAPICreditsIsSet = false;
     m_MaxMonthlyComments = 0.0;
-    m_MaxMonthlyCommentsIsSet = false;
     m_MaxConcurrentUsers = 0.0;
-    m_MaxConcurrentUsersIsSet = false;
     m_MaxTenantUsers = 0.0;
-    m_MaxTenantUsersIsSet = false;
     m_MaxSSOUsers = 0.0;
-    m_MaxSSOUsersIsSet = false;
     m_MaxModerators = 0.0;
-    m_MaxModeratorsIsSet = false;
     m_MaxDomains = 0.0;
-    m_MaxDomainsIsSet = false;
     m_MaxCustomCollectionSize = 0.0;
-    m_MaxCustomCollectionSizeIsSet = false;
     m_HasDebranding = false;
-    m_HasDebrandingIsSet = false;
     m_HasWhiteLabeling = false;
-    m_HasWhiteLabelingIsSet = false;
-    m_ForWhoText = utility::conversions::to_string_t("");
-    m_ForWhoTextIsSet = false;
-    m_FeatureTaglinesIsSet = false;
     m_HasFlexPricing = false;
-    m_HasFlexPricingIsSet = false;
     m_FlexPageLoadCostCents = 0.0;
-    m_FlexPageLoadCostCentsIsSet = false;
     m_FlexPageLoadUnit = 0.0;
-    m_FlexPageLoadUnitIsSet = false;
     m_FlexCommentCostCents = 0.0;
-    m_FlexCommentCostCentsIsSet = false;
     m_FlexCommentUnit = 0.0;
-    m_FlexCommentUnitIsSet = false;
     m_FlexSSOUserCostCents = 0.0;
-    m_FlexSSOUserCostCentsIsSet = false;
     m_FlexSSOUserUnit = 0.0;
-    m_FlexSSOUserUnitIsSet = false;
     m_FlexAPICreditCostCents = 0.0;
-    m_FlexAPICreditCostCentsIsSet = false;
     m_FlexAPICreditUnit = 0.0;
-    m_FlexAPICreditUnitIsSet = false;
     m_FlexModeratorCostCents = 0.0;
-    m_FlexModeratorCostCentsIsSet = false;
     m_FlexModeratorUnit = 0.0;
-    m_FlexModeratorUnitIsSet = false;
     m_FlexAdminCostCents = 0.0;
-    m_FlexAdminCostCentsIsSet = false;
     m_FlexAdminUnit = 0.0;
-    m_FlexAdminUnitIsSet = false;
     m_FlexDomainCostCents = 0.0;
-    m_FlexDomainCostCentsIsSet = false;
     m_FlexDomainUnit = 0.0;
-    m_FlexDomainUnitIsSet = false;
     m_FlexMinimumCostCents = 0.0;
-    m_FlexMinimumCostCentsIsSet = false;
 }
 
 UpdateTenantPackageBody::~UpdateTenantPackageBody()
@@ -97,162 +63,162 @@ void UpdateTenantPackageBody::validate()
 web::json::value UpdateTenantPackageBody::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("name"))] = ModelBase::toJson(m_Name);
     }
-    if(m_MonthlyCostUSDIsSet)
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))] = ModelBase::toJson(m_MonthlyCostUSD);
     }
-    if(m_YearlyCostUSDIsSet)
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))] = ModelBase::toJson(m_YearlyCostUSD);
     }
-    if(m_MaxMonthlyPageLoadsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads"))] = ModelBase::toJson(m_MaxMonthlyPageLoads);
     }
-    if(m_MaxMonthlyAPICreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits"))] = ModelBase::toJson(m_MaxMonthlyAPICredits);
     }
-    if(m_MaxMonthlyCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments"))] = ModelBase::toJson(m_MaxMonthlyComments);
     }
-    if(m_MaxConcurrentUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers"))] = ModelBase::toJson(m_MaxConcurrentUsers);
     }
-    if(m_MaxTenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers"))] = ModelBase::toJson(m_MaxTenantUsers);
     }
-    if(m_MaxSSOUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers"))] = ModelBase::toJson(m_MaxSSOUsers);
     }
-    if(m_MaxModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxModerators"))] = ModelBase::toJson(m_MaxModerators);
     }
-    if(m_MaxDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxDomains"))] = ModelBase::toJson(m_MaxDomains);
     }
-    if(m_MaxCustomCollectionSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize"))] = ModelBase::toJson(m_MaxCustomCollectionSize);
     }
-    if(m_HasDebrandingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasDebranding"))] = ModelBase::toJson(m_HasDebranding);
     }
-    if(m_HasWhiteLabelingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling"))] = ModelBase::toJson(m_HasWhiteLabeling);
     }
-    if(m_ForWhoTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("forWhoText"))] = ModelBase::toJson(m_ForWhoText);
     }
-    if(m_FeatureTaglinesIsSet)
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("featureTaglines"))] = ModelBase::toJson(m_FeatureTaglines);
     }
-    if(m_HasFlexPricingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing"))] = ModelBase::toJson(m_HasFlexPricing);
     }
-    if(m_FlexPageLoadCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents"))] = ModelBase::toJson(m_FlexPageLoadCostCents);
     }
-    if(m_FlexPageLoadUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit"))] = ModelBase::toJson(m_FlexPageLoadUnit);
     }
-    if(m_FlexCommentCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents"))] = ModelBase::toJson(m_FlexCommentCostCents);
     }
-    if(m_FlexCommentUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit"))] = ModelBase::toJson(m_FlexCommentUnit);
     }
-    if(m_FlexSSOUserCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents"))] = ModelBase::toJson(m_FlexSSOUserCostCents);
     }
-    if(m_FlexSSOUserUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit"))] = ModelBase::toJson(m_FlexSSOUserUnit);
     }
-    if(m_FlexAPICreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents"))] = ModelBase::toJson(m_FlexAPICreditCostCents);
     }
-    if(m_FlexAPICreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit"))] = ModelBase::toJson(m_FlexAPICreditUnit);
     }
-    if(m_FlexModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents"))] = ModelBase::toJson(m_FlexModeratorCostCents);
     }
-    if(m_FlexModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit"))] = ModelBase::toJson(m_FlexModeratorUnit);
     }
-    if(m_FlexAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents"))] = ModelBase::toJson(m_FlexAdminCostCents);
     }
-    if(m_FlexAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit"))] = ModelBase::toJson(m_FlexAdminUnit);
     }
-    if(m_FlexDomainCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents"))] = ModelBase::toJson(m_FlexDomainCostCents);
     }
-    if(m_FlexDomainUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit"))] = ModelBase::toJson(m_FlexDomainUnit);
     }
-    if(m_FlexMinimumCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents"))] = ModelBase::toJson(m_FlexMinimumCostCents);
@@ -261,362 +227,1139 @@ web::json::value UpdateTenantPackageBody::toJson() const
     return val;
 }
 
+void UpdateTenantPackageBody::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Name))
+    {
+        
+        writer.key(_XPLATSTR("name"));
+        ModelBase::writeJson(writer, m_Name);
+    }
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
+    {
+        
+        writer.key(_XPLATSTR("monthlyCostUSD"));
+        ModelBase::writeJson(writer, m_MonthlyCostUSD);
+    }
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
+    {
+        
+        writer.key(_XPLATSTR("yearlyCostUSD"));
+        ModelBase::writeJson(writer, m_YearlyCostUSD);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyPageLoads"));
+        ModelBase::writeJson(writer, m_MaxMonthlyPageLoads);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyAPICredits"));
+        ModelBase::writeJson(writer, m_MaxMonthlyAPICredits);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
+    {
+        
+        writer.key(_XPLATSTR("maxMonthlyComments"));
+        ModelBase::writeJson(writer, m_MaxMonthlyComments);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxConcurrentUsers"));
+        ModelBase::writeJson(writer, m_MaxConcurrentUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxTenantUsers"));
+        ModelBase::writeJson(writer, m_MaxTenantUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
+    {
+        
+        writer.key(_XPLATSTR("maxSSOUsers"));
+        ModelBase::writeJson(writer, m_MaxSSOUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
+    {
+        
+        writer.key(_XPLATSTR("maxModerators"));
+        ModelBase::writeJson(writer, m_MaxModerators);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
+    {
+        
+        writer.key(_XPLATSTR("maxDomains"));
+        ModelBase::writeJson(writer, m_MaxDomains);
+    }
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
+    {
+        
+        writer.key(_XPLATSTR("maxCustomCollectionSize"));
+        ModelBase::writeJson(writer, m_MaxCustomCollectionSize);
+    }
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
+    {
+        
+        writer.key(_XPLATSTR("hasDebranding"));
+        ModelBase::writeJson(writer, m_HasDebranding);
+    }
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
+    {
+        
+        writer.key(_XPLATSTR("hasWhiteLabeling"));
+        ModelBase::writeJson(writer, m_HasWhiteLabeling);
+    }
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
+    {
+        
+        writer.key(_XPLATSTR("forWhoText"));
+        ModelBase::writeJson(writer, m_ForWhoText);
+    }
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
+    {
+        
+        writer.key(_XPLATSTR("featureTaglines"));
+        ModelBase::writeJson(writer, m_FeatureTaglines);
+    }
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
+    {
+        
+        writer.key(_XPLATSTR("hasFlexPricing"));
+        ModelBase::writeJson(writer, m_HasFlexPricing);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexPageLoadCostCents"));
+        ModelBase::writeJson(writer, m_FlexPageLoadCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexPageLoadUnit"));
+        ModelBase::writeJson(writer, m_FlexPageLoadUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexCommentCostCents"));
+        ModelBase::writeJson(writer, m_FlexCommentCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexCommentUnit"));
+        ModelBase::writeJson(writer, m_FlexCommentUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOUserCostCents"));
+        ModelBase::writeJson(writer, m_FlexSSOUserCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexSSOUserUnit"));
+        ModelBase::writeJson(writer, m_FlexSSOUserUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexAPICreditCostCents"));
+        ModelBase::writeJson(writer, m_FlexAPICreditCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexAPICreditUnit"));
+        ModelBase::writeJson(writer, m_FlexAPICreditUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexModeratorCostCents"));
+        ModelBase::writeJson(writer, m_FlexModeratorCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexModeratorUnit"));
+        ModelBase::writeJson(writer, m_FlexModeratorUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexAdminCostCents"));
+        ModelBase::writeJson(writer, m_FlexAdminCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexAdminUnit"));
+        ModelBase::writeJson(writer, m_FlexAdminUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexDomainCostCents"));
+        ModelBase::writeJson(writer, m_FlexDomainCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
+    {
+        
+        writer.key(_XPLATSTR("flexDomainUnit"));
+        ModelBase::writeJson(writer, m_FlexDomainUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
+    {
+        
+        writer.key(_XPLATSTR("flexMinimumCostCents"));
+        ModelBase::writeJson(writer, m_FlexMinimumCostCents);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateTenantPackageBody::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("name"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("name")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setName);
-            setName(refVal_setName);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            double refVal_setMonthlyCostUSD;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyCostUSD);
-            setMonthlyCostUSD(refVal_setMonthlyCostUSD);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            if(field.first == _XPLATSTR("name"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setName);
+                    setName(refVal_setName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")):
+            if(field.first == _XPLATSTR("monthlyCostUSD"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMonthlyCostUSD;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMonthlyCostUSD);
+                    setMonthlyCostUSD(refVal_setMonthlyCostUSD);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")):
+            if(field.first == _XPLATSTR("yearlyCostUSD"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setYearlyCostUSD;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyCostUSD);
+                    setYearlyCostUSD(refVal_setYearlyCostUSD);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")):
+            if(field.first == _XPLATSTR("maxMonthlyPageLoads"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyPageLoads;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyPageLoads);
+                    setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")):
+            if(field.first == _XPLATSTR("maxMonthlyAPICredits"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyAPICredits;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyAPICredits);
+                    setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")):
+            if(field.first == _XPLATSTR("maxMonthlyComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxMonthlyComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyComments);
+                    setMaxMonthlyComments(refVal_setMaxMonthlyComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")):
+            if(field.first == _XPLATSTR("maxConcurrentUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxConcurrentUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxConcurrentUsers);
+                    setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")):
+            if(field.first == _XPLATSTR("maxTenantUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxTenantUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxTenantUsers);
+                    setMaxTenantUsers(refVal_setMaxTenantUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")):
+            if(field.first == _XPLATSTR("maxSSOUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxSSOUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxSSOUsers);
+                    setMaxSSOUsers(refVal_setMaxSSOUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxModerators")):
+            if(field.first == _XPLATSTR("maxModerators"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxModerators;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxModerators);
+                    setMaxModerators(refVal_setMaxModerators);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxDomains")):
+            if(field.first == _XPLATSTR("maxDomains"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxDomains;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxDomains);
+                    setMaxDomains(refVal_setMaxDomains);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")):
+            if(field.first == _XPLATSTR("maxCustomCollectionSize"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setMaxCustomCollectionSize;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCustomCollectionSize);
+                    setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasDebranding")):
+            if(field.first == _XPLATSTR("hasDebranding"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasDebranding;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasDebranding);
+                    setHasDebranding(refVal_setHasDebranding);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")):
+            if(field.first == _XPLATSTR("hasWhiteLabeling"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasWhiteLabeling;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasWhiteLabeling);
+                    setHasWhiteLabeling(refVal_setHasWhiteLabeling);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("forWhoText")):
+            if(field.first == _XPLATSTR("forWhoText"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setForWhoText;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setForWhoText);
+                    setForWhoText(refVal_setForWhoText);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("featureTaglines")):
+            if(field.first == _XPLATSTR("featureTaglines"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFeatureTaglines;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFeatureTaglines);
+                    setFeatureTaglines(refVal_setFeatureTaglines);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")):
+            if(field.first == _XPLATSTR("hasFlexPricing"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasFlexPricing;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasFlexPricing);
+                    setHasFlexPricing(refVal_setHasFlexPricing);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")):
+            if(field.first == _XPLATSTR("flexPageLoadCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexPageLoadCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadCostCents);
+                    setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")):
+            if(field.first == _XPLATSTR("flexPageLoadUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexPageLoadUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadUnit);
+                    setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")):
+            if(field.first == _XPLATSTR("flexCommentCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexCommentCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentCostCents);
+                    setFlexCommentCostCents(refVal_setFlexCommentCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")):
+            if(field.first == _XPLATSTR("flexCommentUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexCommentUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentUnit);
+                    setFlexCommentUnit(refVal_setFlexCommentUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")):
+            if(field.first == _XPLATSTR("flexSSOUserCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOUserCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserCostCents);
+                    setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")):
+            if(field.first == _XPLATSTR("flexSSOUserUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexSSOUserUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserUnit);
+                    setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")):
+            if(field.first == _XPLATSTR("flexAPICreditCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAPICreditCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditCostCents);
+                    setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")):
+            if(field.first == _XPLATSTR("flexAPICreditUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAPICreditUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditUnit);
+                    setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")):
+            if(field.first == _XPLATSTR("flexModeratorCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexModeratorCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorCostCents);
+                    setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")):
+            if(field.first == _XPLATSTR("flexModeratorUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexModeratorUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorUnit);
+                    setFlexModeratorUnit(refVal_setFlexModeratorUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")):
+            if(field.first == _XPLATSTR("flexAdminCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAdminCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminCostCents);
+                    setFlexAdminCostCents(refVal_setFlexAdminCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")):
+            if(field.first == _XPLATSTR("flexAdminUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexAdminUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminUnit);
+                    setFlexAdminUnit(refVal_setFlexAdminUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")):
+            if(field.first == _XPLATSTR("flexDomainCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexDomainCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainCostCents);
+                    setFlexDomainCostCents(refVal_setFlexDomainCostCents);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")):
+            if(field.first == _XPLATSTR("flexDomainUnit"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexDomainUnit;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainUnit);
+                    setFlexDomainUnit(refVal_setFlexDomainUnit);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")):
+            if(field.first == _XPLATSTR("flexMinimumCostCents"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setFlexMinimumCostCents;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFlexMinimumCostCents);
+                    setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD"))))
+    return ok;
+}
+
+void UpdateTenantPackageBody::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Name))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setYearlyCostUSD;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setYearlyCostUSD);
-            setYearlyCostUSD(refVal_setYearlyCostUSD);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("name")), m_Name);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads"))))
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyPageLoads;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyPageLoads);
-            setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits"))))
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyAPICredits;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyAPICredits);
-            setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxMonthlyComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxMonthlyComments);
-            setMaxMonthlyComments(refVal_setMaxMonthlyComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")), m_MaxMonthlyPageLoads);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxConcurrentUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxConcurrentUsers);
-            setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")), m_MaxMonthlyAPICredits);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxTenantUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxTenantUsers);
-            setMaxTenantUsers(refVal_setMaxTenantUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")), m_MaxMonthlyComments);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers"))))
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxSSOUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxSSOUsers);
-            setMaxSSOUsers(refVal_setMaxSSOUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")), m_MaxConcurrentUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxModerators"))))
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxModerators")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxModerators;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxModerators);
-            setMaxModerators(refVal_setMaxModerators);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")), m_MaxTenantUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxDomains"))))
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxDomains")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxDomains;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxDomains);
-            setMaxDomains(refVal_setMaxDomains);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")), m_MaxSSOUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize"))))
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setMaxCustomCollectionSize;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMaxCustomCollectionSize);
-            setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxModerators")), m_MaxModerators);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasDebranding"))))
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasDebranding")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasDebranding;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasDebranding);
-            setHasDebranding(refVal_setHasDebranding);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxDomains")), m_MaxDomains);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling"))))
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasWhiteLabeling;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasWhiteLabeling);
-            setHasWhiteLabeling(refVal_setHasWhiteLabeling);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")), m_MaxCustomCollectionSize);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("forWhoText"))))
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("forWhoText")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setForWhoText;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setForWhoText);
-            setForWhoText(refVal_setForWhoText);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasDebranding")), m_HasDebranding);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("featureTaglines"))))
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("featureTaglines")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFeatureTaglines;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFeatureTaglines);
-            setFeatureTaglines(refVal_setFeatureTaglines);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")), m_HasWhiteLabeling);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing"))))
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasFlexPricing;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasFlexPricing);
-            setHasFlexPricing(refVal_setHasFlexPricing);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("forWhoText")), m_ForWhoText);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexPageLoadCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadCostCents);
-            setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("featureTaglines")), m_FeatureTaglines);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit"))))
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexPageLoadUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexPageLoadUnit);
-            setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")), m_HasFlexPricing);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexCommentCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentCostCents);
-            setFlexCommentCostCents(refVal_setFlexCommentCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")), m_FlexPageLoadCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexCommentUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexCommentUnit);
-            setFlexCommentUnit(refVal_setFlexCommentUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")), m_FlexPageLoadUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOUserCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserCostCents);
-            setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")), m_FlexCommentCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexSSOUserUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexSSOUserUnit);
-            setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")), m_FlexCommentUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAPICreditCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditCostCents);
-            setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")), m_FlexSSOUserCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAPICreditUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAPICreditUnit);
-            setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")), m_FlexSSOUserUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexModeratorCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorCostCents);
-            setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")), m_FlexAPICreditCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexModeratorUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexModeratorUnit);
-            setFlexModeratorUnit(refVal_setFlexModeratorUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")), m_FlexAPICreditUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAdminCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminCostCents);
-            setFlexAdminCostCents(refVal_setFlexAdminCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")), m_FlexModeratorCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexAdminUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexAdminUnit);
-            setFlexAdminUnit(refVal_setFlexAdminUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")), m_FlexModeratorUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexDomainCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainCostCents);
-            setFlexDomainCostCents(refVal_setFlexDomainCostCents);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")), m_FlexAdminCostCents);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit"))))
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setFlexDomainUnit;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexDomainUnit);
-            setFlexDomainUnit(refVal_setFlexDomainUnit);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")), m_FlexAdminUnit);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents"))))
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")), m_FlexDomainCostCents);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")), m_FlexDomainUnit);
+    }
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")), m_FlexMinimumCostCents);
+    }
+}
+
+bool UpdateTenantPackageBody::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            double refVal_setFlexMinimumCostCents;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFlexMinimumCostCents);
-            setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
-            
+        case ModelBase::fieldHash(_XPLATSTR("name")):
+            {
+                utility::string_t refVal_setName;
+                if(!ModelBase::readBinary(reader, field, refVal_setName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setName(refVal_setName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("monthlyCostUSD")):
+            {
+                double refVal_setMonthlyCostUSD;
+                if(!ModelBase::readBinary(reader, field, refVal_setMonthlyCostUSD))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMonthlyCostUSD(refVal_setMonthlyCostUSD);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("yearlyCostUSD")):
+            {
+                double refVal_setYearlyCostUSD;
+                if(!ModelBase::readBinary(reader, field, refVal_setYearlyCostUSD))
+                {
+                    ok = false;
+                    continue;
+                }
+                setYearlyCostUSD(refVal_setYearlyCostUSD);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyPageLoads")):
+            {
+                double refVal_setMaxMonthlyPageLoads;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyPageLoads))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyPageLoads(refVal_setMaxMonthlyPageLoads);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyAPICredits")):
+            {
+                double refVal_setMaxMonthlyAPICredits;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyAPICredits))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyAPICredits(refVal_setMaxMonthlyAPICredits);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxMonthlyComments")):
+            {
+                double refVal_setMaxMonthlyComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxMonthlyComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxMonthlyComments(refVal_setMaxMonthlyComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxConcurrentUsers")):
+            {
+                double refVal_setMaxConcurrentUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxConcurrentUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxConcurrentUsers(refVal_setMaxConcurrentUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxTenantUsers")):
+            {
+                double refVal_setMaxTenantUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxTenantUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxTenantUsers(refVal_setMaxTenantUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxSSOUsers")):
+            {
+                double refVal_setMaxSSOUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxSSOUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxSSOUsers(refVal_setMaxSSOUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxModerators")):
+            {
+                double refVal_setMaxModerators;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxModerators))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxModerators(refVal_setMaxModerators);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxDomains")):
+            {
+                double refVal_setMaxDomains;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxDomains))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxDomains(refVal_setMaxDomains);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("maxCustomCollectionSize")):
+            {
+                double refVal_setMaxCustomCollectionSize;
+                if(!ModelBase::readBinary(reader, field, refVal_setMaxCustomCollectionSize))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMaxCustomCollectionSize(refVal_setMaxCustomCollectionSize);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasDebranding")):
+            {
+                bool refVal_setHasDebranding;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasDebranding))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasDebranding(refVal_setHasDebranding);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasWhiteLabeling")):
+            {
+                bool refVal_setHasWhiteLabeling;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasWhiteLabeling))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasWhiteLabeling(refVal_setHasWhiteLabeling);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("forWhoText")):
+            {
+                utility::string_t refVal_setForWhoText;
+                if(!ModelBase::readBinary(reader, field, refVal_setForWhoText))
+                {
+                    ok = false;
+                    continue;
+                }
+                setForWhoText(refVal_setForWhoText);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("featureTaglines")):
+            {
+                std::vector<utility::string_t> refVal_setFeatureTaglines;
+                if(!ModelBase::readBinary(reader, field, refVal_setFeatureTaglines))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFeatureTaglines(refVal_setFeatureTaglines);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasFlexPricing")):
+            {
+                bool refVal_setHasFlexPricing;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasFlexPricing))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasFlexPricing(refVal_setHasFlexPricing);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadCostCents")):
+            {
+                double refVal_setFlexPageLoadCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexPageLoadCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexPageLoadCostCents(refVal_setFlexPageLoadCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexPageLoadUnit")):
+            {
+                double refVal_setFlexPageLoadUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexPageLoadUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexPageLoadUnit(refVal_setFlexPageLoadUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentCostCents")):
+            {
+                double refVal_setFlexCommentCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexCommentCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexCommentCostCents(refVal_setFlexCommentCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexCommentUnit")):
+            {
+                double refVal_setFlexCommentUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexCommentUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexCommentUnit(refVal_setFlexCommentUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserCostCents")):
+            {
+                double refVal_setFlexSSOUserCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOUserCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOUserCostCents(refVal_setFlexSSOUserCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexSSOUserUnit")):
+            {
+                double refVal_setFlexSSOUserUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexSSOUserUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexSSOUserUnit(refVal_setFlexSSOUserUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditCostCents")):
+            {
+                double refVal_setFlexAPICreditCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAPICreditCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAPICreditCostCents(refVal_setFlexAPICreditCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAPICreditUnit")):
+            {
+                double refVal_setFlexAPICreditUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAPICreditUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAPICreditUnit(refVal_setFlexAPICreditUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorCostCents")):
+            {
+                double refVal_setFlexModeratorCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexModeratorCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexModeratorCostCents(refVal_setFlexModeratorCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexModeratorUnit")):
+            {
+                double refVal_setFlexModeratorUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexModeratorUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexModeratorUnit(refVal_setFlexModeratorUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminCostCents")):
+            {
+                double refVal_setFlexAdminCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAdminCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAdminCostCents(refVal_setFlexAdminCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexAdminUnit")):
+            {
+                double refVal_setFlexAdminUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexAdminUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexAdminUnit(refVal_setFlexAdminUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainCostCents")):
+            {
+                double refVal_setFlexDomainCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexDomainCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexDomainCostCents(refVal_setFlexDomainCostCents);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexDomainUnit")):
+            {
+                double refVal_setFlexDomainUnit;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexDomainUnit))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexDomainUnit(refVal_setFlexDomainUnit);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("flexMinimumCostCents")):
+            {
+                double refVal_setFlexMinimumCostCents;
+                if(!ModelBase::readBinary(reader, field, refVal_setFlexMinimumCostCents))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFlexMinimumCostCents(refVal_setFlexMinimumCostCents);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateTenantPackageBody::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -626,131 +1369,131 @@ void UpdateTenantPackageBody::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_NameIsSet)
+    if(m_FieldsSet.test(FieldBit_Name))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("name")), m_Name));
     }
-    if(m_MonthlyCostUSDIsSet)
+    if(m_FieldsSet.test(FieldBit_MonthlyCostUSD))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("monthlyCostUSD")), m_MonthlyCostUSD));
     }
-    if(m_YearlyCostUSDIsSet)
+    if(m_FieldsSet.test(FieldBit_YearlyCostUSD))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("yearlyCostUSD")), m_YearlyCostUSD));
     }
-    if(m_MaxMonthlyPageLoadsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyPageLoads")), m_MaxMonthlyPageLoads));
     }
-    if(m_MaxMonthlyAPICreditsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyAPICredits")), m_MaxMonthlyAPICredits));
     }
-    if(m_MaxMonthlyCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxMonthlyComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxMonthlyComments")), m_MaxMonthlyComments));
     }
-    if(m_MaxConcurrentUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxConcurrentUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxConcurrentUsers")), m_MaxConcurrentUsers));
     }
-    if(m_MaxTenantUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxTenantUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxTenantUsers")), m_MaxTenantUsers));
     }
-    if(m_MaxSSOUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxSSOUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxSSOUsers")), m_MaxSSOUsers));
     }
-    if(m_MaxModeratorsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxModerators))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxModerators")), m_MaxModerators));
     }
-    if(m_MaxDomainsIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxDomains))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxDomains")), m_MaxDomains));
     }
-    if(m_MaxCustomCollectionSizeIsSet)
+    if(m_FieldsSet.test(FieldBit_MaxCustomCollectionSize))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("maxCustomCollectionSize")), m_MaxCustomCollectionSize));
     }
-    if(m_HasDebrandingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasDebranding))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasDebranding")), m_HasDebranding));
     }
-    if(m_HasWhiteLabelingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasWhiteLabeling))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasWhiteLabeling")), m_HasWhiteLabeling));
     }
-    if(m_ForWhoTextIsSet)
+    if(m_FieldsSet.test(FieldBit_ForWhoText))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("forWhoText")), m_ForWhoText));
     }
-    if(m_FeatureTaglinesIsSet)
+    if(m_FieldsSet.test(FieldBit_FeatureTaglines))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("featureTaglines")), m_FeatureTaglines));
     }
-    if(m_HasFlexPricingIsSet)
+    if(m_FieldsSet.test(FieldBit_HasFlexPricing))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasFlexPricing")), m_HasFlexPricing));
     }
-    if(m_FlexPageLoadCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexPageLoadCostCents")), m_FlexPageLoadCostCents));
     }
-    if(m_FlexPageLoadUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexPageLoadUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexPageLoadUnit")), m_FlexPageLoadUnit));
     }
-    if(m_FlexCommentCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexCommentCostCents")), m_FlexCommentCostCents));
     }
-    if(m_FlexCommentUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexCommentUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexCommentUnit")), m_FlexCommentUnit));
     }
-    if(m_FlexSSOUserCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOUserCostCents")), m_FlexSSOUserCostCents));
     }
-    if(m_FlexSSOUserUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexSSOUserUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexSSOUserUnit")), m_FlexSSOUserUnit));
     }
-    if(m_FlexAPICreditCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAPICreditCostCents")), m_FlexAPICreditCostCents));
     }
-    if(m_FlexAPICreditUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAPICreditUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAPICreditUnit")), m_FlexAPICreditUnit));
     }
-    if(m_FlexModeratorCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexModeratorCostCents")), m_FlexModeratorCostCents));
     }
-    if(m_FlexModeratorUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexModeratorUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexModeratorUnit")), m_FlexModeratorUnit));
     }
-    if(m_FlexAdminCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAdminCostCents")), m_FlexAdminCostCents));
     }
-    if(m_FlexAdminUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexAdminUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexAdminUnit")), m_FlexAdminUnit));
     }
-    if(m_FlexDomainCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexDomainCostCents")), m_FlexDomainCostCents));
     }
-    if(m_FlexDomainUnitIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexDomainUnit))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexDomainUnit")), m_FlexDomainUnit));
     }
-    if(m_FlexMinimumCostCentsIsSet)
+    if(m_FieldsSet.test(FieldBit_FlexMinimumCostCents))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("flexMinimumCostCents")), m_FlexMinimumCostCents));
     }
@@ -970,17 +1713,17 @@ utility::string_t UpdateTenantPackageBody::getName() const
 void UpdateTenantPackageBody::setName(const utility::string_t& value)
 {
     m_Name = value;
-    m_NameIsSet = true;
+    m_FieldsSet.set(FieldBit_Name);
 }
 
 bool UpdateTenantPackageBody::nameIsSet() const
 {
-    return m_NameIsSet;
+    return m_FieldsSet.test(FieldBit_Name);
 }
 
 void UpdateTenantPackageBody::unsetName()
 {
-    m_NameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Name);
 }
 double UpdateTenantPackageBody::getMonthlyCostUSD() const
 {
@@ -990,17 +1733,17 @@ double UpdateTenantPackageBody::getMonthlyCostUSD() const
 void UpdateTenantPackageBody::setMonthlyCostUSD(double value)
 {
     m_MonthlyCostUSD = value;
-    m_MonthlyCostUSDIsSet = true;
+    m_FieldsSet.set(FieldBit_MonthlyCostUSD);
 }
 
 bool UpdateTenantPackageBody::monthlyCostUSDIsSet() const
 {
-    return m_MonthlyCostUSDIsSet;
+    return m_FieldsSet.test(FieldBit_MonthlyCostUSD);
 }
 
 void UpdateTenantPackageBody::unsetMonthlyCostUSD()
 {
-    m_MonthlyCostUSDIsSet = false;
+    m_FieldsSet.reset(FieldBit_MonthlyCostUSD);
 }
 double UpdateTenantPackageBody::getYearlyCostUSD() const
 {
@@ -1010,17 +1753,17 @@ double UpdateTenantPackageBody::getYearlyCostUSD() const
 void UpdateTenantPackageBody::setYearlyCostUSD(double value)
 {
     m_YearlyCostUSD = value;
-    m_YearlyCostUSDIsSet = true;
+    m_FieldsSet.set(FieldBit_YearlyCostUSD);
 }
 
 bool UpdateTenantPackageBody::yearlyCostUSDIsSet() const
 {
-    return m_YearlyCostUSDIsSet;
+    return m_FieldsSet.test(FieldBit_YearlyCostUSD);
 }
 
 void UpdateTenantPackageBody::unsetYearlyCostUSD()
 {
-    m_YearlyCostUSDIsSet = false;
+    m_FieldsSet.reset(FieldBit_YearlyCostUSD);
 }
 double UpdateTenantPackageBody::getMaxMonthlyPageLoads() const
 {
@@ -1030,17 +1773,17 @@ double UpdateTenantPackageBody::getMaxMonthlyPageLoads() const
 void UpdateTenantPackageBody::setMaxMonthlyPageLoads(double value)
 {
     m_MaxMonthlyPageLoads = value;
-    m_MaxMonthlyPageLoadsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyPageLoads);
 }
 
 bool UpdateTenantPackageBody::maxMonthlyPageLoadsIsSet() const
 {
-    return m_MaxMonthlyPageLoadsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyPageLoads);
 }
 
 void UpdateTenantPackageBody::unsetMaxMonthlyPageLoads()
 {
-    m_MaxMonthlyPageLoadsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyPageLoads);
 }
 double UpdateTenantPackageBody::getMaxMonthlyAPICredits() const
 {
@@ -1050,17 +1793,17 @@ double UpdateTenantPackageBody::getMaxMonthlyAPICredits() const
 void UpdateTenantPackageBody::setMaxMonthlyAPICredits(double value)
 {
     m_MaxMonthlyAPICredits = value;
-    m_MaxMonthlyAPICreditsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyAPICredits);
 }
 
 bool UpdateTenantPackageBody::maxMonthlyAPICreditsIsSet() const
 {
-    return m_MaxMonthlyAPICreditsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyAPICredits);
 }
 
 void UpdateTenantPackageBody::unsetMaxMonthlyAPICredits()
 {
-    m_MaxMonthlyAPICreditsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyAPICredits);
 }
 double UpdateTenantPackageBody::getMaxMonthlyComments() const
 {
@@ -1070,17 +1813,17 @@ double UpdateTenantPackageBody::getMaxMonthlyComments() const
 void UpdateTenantPackageBody::setMaxMonthlyComments(double value)
 {
     m_MaxMonthlyComments = value;
-    m_MaxMonthlyCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxMonthlyComments);
 }
 
 bool UpdateTenantPackageBody::maxMonthlyCommentsIsSet() const
 {
-    return m_MaxMonthlyCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxMonthlyComments);
 }
 
 void UpdateTenantPackageBody::unsetMaxMonthlyComments()
 {
-    m_MaxMonthlyCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxMonthlyComments);
 }
 double UpdateTenantPackageBody::getMaxConcurrentUsers() const
 {
@@ -1090,17 +1833,17 @@ double UpdateTenantPackageBody::getMaxConcurrentUsers() const
 void UpdateTenantPackageBody::setMaxConcurrentUsers(double value)
 {
     m_MaxConcurrentUsers = value;
-    m_MaxConcurrentUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxConcurrentUsers);
 }
 
 bool UpdateTenantPackageBody::maxConcurrentUsersIsSet() const
 {
-    return m_MaxConcurrentUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxConcurrentUsers);
 }
 
 void UpdateTenantPackageBody::unsetMaxConcurrentUsers()
 {
-    m_MaxConcurrentUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxConcurrentUsers);
 }
 double UpdateTenantPackageBody::getMaxTenantUsers() const
 {
@@ -1110,17 +1853,17 @@ double UpdateTenantPackageBody::getMaxTenantUsers() const
 void UpdateTenantPackageBody::setMaxTenantUsers(double value)
 {
     m_MaxTenantUsers = value;
-    m_MaxTenantUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxTenantUsers);
 }
 
 bool UpdateTenantPackageBody::maxTenantUsersIsSet() const
 {
-    return m_MaxTenantUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxTenantUsers);
 }
 
 void UpdateTenantPackageBody::unsetMaxTenantUsers()
 {
-    m_MaxTenantUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxTenantUsers);
 }
 double UpdateTenantPackageBody::getMaxSSOUsers() const
 {
@@ -1130,17 +1873,17 @@ double UpdateTenantPackageBody::getMaxSSOUsers() const
 void UpdateTenantPackageBody::setMaxSSOUsers(double value)
 {
     m_MaxSSOUsers = value;
-    m_MaxSSOUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxSSOUsers);
 }
 
 bool UpdateTenantPackageBody::maxSSOUsersIsSet() const
 {
-    return m_MaxSSOUsersIsSet;
+    return m_FieldsSet.test(FieldBit_MaxSSOUsers);
 }
 
 void UpdateTenantPackageBody::unsetMaxSSOUsers()
 {
-    m_MaxSSOUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxSSOUsers);
 }
 double UpdateTenantPackageBody::getMaxModerators() const
 {
@@ -1150,17 +1893,17 @@ double UpdateTenantPackageBody::getMaxModerators() const
 void UpdateTenantPackageBody::setMaxModerators(double value)
 {
     m_MaxModerators = value;
-    m_MaxModeratorsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxModerators);
 }
 
 bool UpdateTenantPackageBody::maxModeratorsIsSet() const
 {
-    return m_MaxModeratorsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxModerators);
 }
 
 void UpdateTenantPackageBody::unsetMaxModerators()
 {
-    m_MaxModeratorsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxModerators);
 }
 double UpdateTenantPackageBody::getMaxDomains() const
 {
@@ -1170,17 +1913,17 @@ double UpdateTenantPackageBody::getMaxDomains() const
 void UpdateTenantPackageBody::setMaxDomains(double value)
 {
     m_MaxDomains = value;
-    m_MaxDomainsIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxDomains);
 }
 
 bool UpdateTenantPackageBody::maxDomainsIsSet() const
 {
-    return m_MaxDomainsIsSet;
+    return m_FieldsSet.test(FieldBit_MaxDomains);
 }
 
 void UpdateTenantPackageBody::unsetMaxDomains()
 {
-    m_MaxDomainsIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxDomains);
 }
 double UpdateTenantPackageBody::getMaxCustomCollectionSize() const
 {
@@ -1190,17 +1933,17 @@ double UpdateTenantPackageBody::getMaxCustomCollectionSize() const
 void UpdateTenantPackageBody::setMaxCustomCollectionSize(double value)
 {
     m_MaxCustomCollectionSize = value;
-    m_MaxCustomCollectionSizeIsSet = true;
+    m_FieldsSet.set(FieldBit_MaxCustomCollectionSize);
 }
 
 bool UpdateTenantPackageBody::maxCustomCollectionSizeIsSet() const
 {
-    return m_MaxCustomCollectionSizeIsSet;
+    return m_FieldsSet.test(FieldBit_MaxCustomCollectionSize);
 }
 
 void UpdateTenantPackageBody::unsetMaxCustomCollectionSize()
 {
-    m_MaxCustomCollectionSizeIsSet = false;
+    m_FieldsSet.reset(FieldBit_MaxCustomCollectionSize);
 }
 bool UpdateTenantPackageBody::isHasDebranding() const
 {
@@ -1210,17 +1953,17 @@ bool UpdateTenantPackageBody::isHasDebranding() const
 void UpdateTenantPackageBody::setHasDebranding(bool value)
 {
     m_HasDebranding = value;
-    m_HasDebrandingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasDebranding);
 }
 
 bool UpdateTenantPackageBody::hasDebrandingIsSet() const
 {
-    return m_HasDebrandingIsSet;
+    return m_FieldsSet.test(FieldBit_HasDebranding);
 }
 
 void UpdateTenantPackageBody::unsetHasDebranding()
 {
-    m_HasDebrandingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasDebranding);
 }
 bool UpdateTenantPackageBody::isHasWhiteLabeling() const
 {
@@ -1230,17 +1973,17 @@ bool UpdateTenantPackageBody::isHasWhiteLabeling() const
 void UpdateTenantPackageBody::setHasWhiteLabeling(bool value)
 {
     m_HasWhiteLabeling = value;
-    m_HasWhiteLabelingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasWhiteLabeling);
 }
 
 bool UpdateTenantPackageBody::hasWhiteLabelingIsSet() const
 {
-    return m_HasWhiteLabelingIsSet;
+    return m_FieldsSet.test(FieldBit_HasWhiteLabeling);
 }
 
 void UpdateTenantPackageBody::unsetHasWhiteLabeling()
 {
-    m_HasWhiteLabelingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasWhiteLabeling);
 }
 utility::string_t UpdateTenantPackageBody::getForWhoText() const
 {
@@ -1251,17 +1994,17 @@ utility::string_t UpdateTenantPackageBody::getForWhoText() const
 void UpdateTenantPackageBody::setForWhoText(const utility::string_t& value)
 {
     m_ForWhoText = value;
-    m_ForWhoTextIsSet = true;
+    m_FieldsSet.set(FieldBit_ForWhoText);
 }
 
 bool UpdateTenantPackageBody::forWhoTextIsSet() const
 {
-    return m_ForWhoTextIsSet;
+    return m_FieldsSet.test(FieldBit_ForWhoText);
 }
 
 void UpdateTenantPackageBody::unsetForWhoText()
 {
-    m_ForWhoTextIsSet = false;
+    m_FieldsSet.reset(FieldBit_ForWhoText);
 }
 std::vector<utility::string_t> UpdateTenantPackageBody::getFeatureTaglines() const
 {
@@ -1272,17 +2015,17 @@ std::vector<utility::string_t> UpdateTenantPackageBody::getFeatureTaglines() con
 void UpdateTenantPackageBody::setFeatureTaglines(const std::vector<utility::string_t>& value)
 {
     m_FeatureTaglines = value;
-    m_FeatureTaglinesIsSet = true;
+    m_FieldsSet.set(FieldBit_FeatureTaglines);
 }
 
 bool UpdateTenantPackageBody::featureTaglinesIsSet() const
 {
-    return m_FeatureTaglinesIsSet;
+    return m_FieldsSet.test(FieldBit_FeatureTaglines);
 }
 
 void UpdateTenantPackageBody::unsetFeatureTaglines()
 {
-    m_FeatureTaglinesIsSet = false;
+    m_FieldsSet.reset(FieldBit_FeatureTaglines);
 }
 bool UpdateTenantPackageBody::isHasFlexPricing() const
 {
@@ -1292,17 +2035,17 @@ bool UpdateTenantPackageBody::isHasFlexPricing() const
 void UpdateTenantPackageBody::setHasFlexPricing(bool value)
 {
     m_HasFlexPricing = value;
-    m_HasFlexPricingIsSet = true;
+    m_FieldsSet.set(FieldBit_HasFlexPricing);
 }
 
 bool UpdateTenantPackageBody::hasFlexPricingIsSet() const
 {
-    return m_HasFlexPricingIsSet;
+    return m_FieldsSet.test(FieldBit_HasFlexPricing);
 }
 
 void UpdateTenantPackageBody::unsetHasFlexPricing()
 {
-    m_HasFlexPricingIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasFlexPricing);
 }
 double UpdateTenantPackageBody::getFlexPageLoadCostCents() const
 {
@@ -1312,17 +2055,17 @@ double UpdateTenantPackageBody::getFlexPageLoadCostCents() const
 void UpdateTenantPackageBody::setFlexPageLoadCostCents(double value)
 {
     m_FlexPageLoadCostCents = value;
-    m_FlexPageLoadCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexPageLoadCostCents);
 }
 
 bool UpdateTenantPackageBody::flexPageLoadCostCentsIsSet() const
 {
-    return m_FlexPageLoadCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexPageLoadCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexPageLoadCostCents()
 {
-    m_FlexPageLoadCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexPageLoadCostCents);
 }
 double UpdateTenantPackageBody::getFlexPageLoadUnit() const
 {
@@ -1332,17 +2075,17 @@ double UpdateTenantPackageBody::getFlexPageLoadUnit() const
 void UpdateTenantPackageBody::setFlexPageLoadUnit(double value)
 {
     m_FlexPageLoadUnit = value;
-    m_FlexPageLoadUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexPageLoadUnit);
 }
 
 bool UpdateTenantPackageBody::flexPageLoadUnitIsSet() const
 {
-    return m_FlexPageLoadUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexPageLoadUnit);
 }
 
 void UpdateTenantPackageBody::unsetFlexPageLoadUnit()
 {
-    m_FlexPageLoadUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexPageLoadUnit);
 }
 double UpdateTenantPackageBody::getFlexCommentCostCents() const
 {
@@ -1352,17 +2095,17 @@ double UpdateTenantPackageBody::getFlexCommentCostCents() const
 void UpdateTenantPackageBody::setFlexCommentCostCents(double value)
 {
     m_FlexCommentCostCents = value;
-    m_FlexCommentCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexCommentCostCents);
 }
 
 bool UpdateTenantPackageBody::flexCommentCostCentsIsSet() const
 {
-    return m_FlexCommentCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexCommentCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexCommentCostCents()
 {
-    m_FlexCommentCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexCommentCostCents);
 }
 double UpdateTenantPackageBody::getFlexCommentUnit() const
 {
@@ -1372,17 +2115,17 @@ double UpdateTenantPackageBody::getFlexCommentUnit() const
 void UpdateTenantPackageBody::setFlexCommentUnit(double value)
 {
     m_FlexCommentUnit = value;
-    m_FlexCommentUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexCommentUnit);
 }
 
 bool UpdateTenantPackageBody::flexCommentUnitIsSet() const
 {
-    return m_FlexCommentUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexCommentUnit);
 }
 
 void UpdateTenantPackageBody::unsetFlexCommentUnit()
 {
-    m_FlexCommentUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexCommentUnit);
 }
 double UpdateTenantPackageBody::getFlexSSOUserCostCents() const
 {
@@ -1392,17 +2135,17 @@ double UpdateTenantPackageBody::getFlexSSOUserCostCents() const
 void UpdateTenantPackageBody::setFlexSSOUserCostCents(double value)
 {
     m_FlexSSOUserCostCents = value;
-    m_FlexSSOUserCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOUserCostCents);
 }
 
 bool UpdateTenantPackageBody::flexSSOUserCostCentsIsSet() const
 {
-    return m_FlexSSOUserCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOUserCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexSSOUserCostCents()
 {
-    m_FlexSSOUserCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOUserCostCents);
 }
 double UpdateTenantPackageBody::getFlexSSOUserUnit() const
 {
@@ -1412,17 +2155,17 @@ double UpdateTenantPackageBody::getFlexSSOUserUnit() const
 void UpdateTenantPackageBody::setFlexSSOUserUnit(double value)
 {
     m_FlexSSOUserUnit = value;
-    m_FlexSSOUserUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexSSOUserUnit);
 }
 
 bool UpdateTenantPackageBody::flexSSOUserUnitIsSet() const
 {
-    return m_FlexSSOUserUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexSSOUserUnit);
 }
 
 void UpdateTenantPackageBody::unsetFlexSSOUserUnit()
 {
-    m_FlexSSOUserUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexSSOUserUnit);
 }
 double UpdateTenantPackageBody::getFlexAPICreditCostCents() const
 {
@@ -1432,17 +2175,17 @@ double UpdateTenantPackageBody::getFlexAPICreditCostCents() const
 void UpdateTenantPackageBody::setFlexAPICreditCostCents(double value)
 {
     m_FlexAPICreditCostCents = value;
-    m_FlexAPICreditCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAPICreditCostCents);
 }
 
 bool UpdateTenantPackageBody::flexAPICreditCostCentsIsSet() const
 {
-    return m_FlexAPICreditCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAPICreditCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexAPICreditCostCents()
 {
-    m_FlexAPICreditCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAPICreditCostCents);
 }
 double UpdateTenantPackageBody::getFlexAPICreditUnit() const
 {
@@ -1452,17 +2195,17 @@ double UpdateTenantPackageBody::getFlexAPICreditUnit() const
 void UpdateTenantPackageBody::setFlexAPICreditUnit(double value)
 {
     m_FlexAPICreditUnit = value;
-    m_FlexAPICreditUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAPICreditUnit);
 }
 
 bool UpdateTenantPackageBody::flexAPICreditUnitIsSet() const
 {
-    return m_FlexAPICreditUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAPICreditUnit);
 }
 
 void UpdateTenantPackageBody::unsetFlexAPICreditUnit()
 {
-    m_FlexAPICreditUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAPICreditUnit);
 }
 double UpdateTenantPackageBody::getFlexModeratorCostCents() const
 {
@@ -1472,17 +2215,17 @@ double UpdateTenantPackageBody::getFlexModeratorCostCents() const
 void UpdateTenantPackageBody::setFlexModeratorCostCents(double value)
 {
     m_FlexModeratorCostCents = value;
-    m_FlexModeratorCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexModeratorCostCents);
 }
 
 bool UpdateTenantPackageBody::flexModeratorCostCentsIsSet() const
 {
-    return m_FlexModeratorCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexModeratorCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexModeratorCostCents()
 {
-    m_FlexModeratorCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexModeratorCostCents);
 }
 double UpdateTenantPackageBody::getFlexModeratorUnit() const
 {
@@ -1492,17 +2235,17 @@ double UpdateTenantPackageBody::getFlexModeratorUnit() const
 void UpdateTenantPackageBody::setFlexModeratorUnit(double value)
 {
     m_FlexModeratorUnit = value;
-    m_FlexModeratorUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexModeratorUnit);
 }
 
 bool UpdateTenantPackageBody::flexModeratorUnitIsSet() const
 {
-    return m_FlexModeratorUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexModeratorUnit);
 }
 
 void UpdateTenantPackageBody::unsetFlexModeratorUnit()
 {
-    m_FlexModeratorUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexModeratorUnit);
 }
 double UpdateTenantPackageBody::getFlexAdminCostCents() const
 {
@@ -1512,17 +2255,17 @@ double UpdateTenantPackageBody::getFlexAdminCostCents() const
 void UpdateTenantPackageBody::setFlexAdminCostCents(double value)
 {
     m_FlexAdminCostCents = value;
-    m_FlexAdminCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAdminCostCents);
 }
 
 bool UpdateTenantPackageBody::flexAdminCostCentsIsSet() const
 {
-    return m_FlexAdminCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAdminCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexAdminCostCents()
 {
-    m_FlexAdminCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAdminCostCents);
 }
 double UpdateTenantPackageBody::getFlexAdminUnit() const
 {
@@ -1532,17 +2275,17 @@ double UpdateTenantPackageBody::getFlexAdminUnit() const
 void UpdateTenantPackageBody::setFlexAdminUnit(double value)
 {
     m_FlexAdminUnit = value;
-    m_FlexAdminUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexAdminUnit);
 }
 
 bool UpdateTenantPackageBody::flexAdminUnitIsSet() const
 {
-    return m_FlexAdminUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexAdminUnit);
 }
 
 void UpdateTenantPackageBody::unsetFlexAdminUnit()
 {
-    m_FlexAdminUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexAdminUnit);
 }
 double UpdateTenantPackageBody::getFlexDomainCostCents() const
 {
@@ -1552,17 +2295,17 @@ double UpdateTenantPackageBody::getFlexDomainCostCents() const
 void UpdateTenantPackageBody::setFlexDomainCostCents(double value)
 {
     m_FlexDomainCostCents = value;
-    m_FlexDomainCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexDomainCostCents);
 }
 
 bool UpdateTenantPackageBody::flexDomainCostCentsIsSet() const
 {
-    return m_FlexDomainCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexDomainCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexDomainCostCents()
 {
-    m_FlexDomainCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexDomainCostCents);
 }
 double UpdateTenantPackageBody::getFlexDomainUnit() const
 {
@@ -1572,17 +2315,17 @@ double UpdateTenantPackageBody::getFlexDomainUnit() const
 void UpdateTenantPackageBody::setFlexDomainUnit(double value)
 {
     m_FlexDomainUnit = value;
-    m_FlexDomainUnitIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexDomainUnit);
 }
 
 bool UpdateTenantPackageBody::flexDomainUnitIsSet() const
 {
-    return m_FlexDomainUnitIsSet;
+    return m_FieldsSet.test(FieldBit_FlexDomainUnit);
 }
 
 void UpdateTenantPackageBody::unsetFlexDomainUnit()
 {
-    m_FlexDomainUnitIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexDomainUnit);
 }
 double UpdateTenantPackageBody::getFlexMinimumCostCents() const
 {
@@ -1592,17 +2335,17 @@ double UpdateTenantPackageBody::getFlexMinimumCostCents() const
 void UpdateTenantPackageBody::setFlexMinimumCostCents(double value)
 {
     m_FlexMinimumCostCents = value;
-    m_FlexMinimumCostCentsIsSet = true;
+    m_FieldsSet.set(FieldBit_FlexMinimumCostCents);
 }
 
 bool UpdateTenantPackageBody::flexMinimumCostCentsIsSet() const
 {
-    return m_FlexMinimumCostCentsIsSet;
+    return m_FieldsSet.test(FieldBit_FlexMinimumCostCents);
 }
 
 void UpdateTenantPackageBody::unsetFlexMinimumCostCents()
 {
-    m_FlexMinimumCostCentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FlexMinimumCostCents);
 }
 
 }
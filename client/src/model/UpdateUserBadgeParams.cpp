@@ -21,7 +21,6 @@ namespace model {
 UpdateUserBadgeParams::UpdateUserBadgeParams()
 {
     m_DisplayedOnComments = false;
-    m_DisplayedOnCommentsIsSet = false;
 }
 
 UpdateUserBadgeParams::~UpdateUserBadgeParams()
@@ -36,7 +35,7 @@ void UpdateUserBadgeParams::validate()
 web::json::value UpdateUserBadgeParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_DisplayedOnCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayedOnComments"))] = ModelBase::toJson(m_DisplayedOnComments);
@@ -45,23 +44,87 @@ web::json::value UpdateUserBadgeParams::toJson() const
     return val;
 }
 
+void UpdateUserBadgeParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
+    {
+        
+        writer.key(_XPLATSTR("displayedOnComments"));
+        ModelBase::writeJson(writer, m_DisplayedOnComments);
+    }
+
+    writer.endObject();
+}
+
 bool UpdateUserBadgeParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayedOnComments"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayedOnComments")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setDisplayedOnComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayedOnComments);
-            setDisplayedOnComments(refVal_setDisplayedOnComments);
-            
+        case ModelBase::fieldHash(_XPLATSTR("displayedOnComments")):
+            if(field.first == _XPLATSTR("displayedOnComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisplayedOnComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayedOnComments);
+                    setDisplayedOnComments(refVal_setDisplayedOnComments);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void UpdateUserBadgeParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayedOnComments")), m_DisplayedOnComments);
+    }
+}
+
+bool UpdateUserBadgeParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("displayedOnComments")):
+            {
+                bool refVal_setDisplayedOnComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayedOnComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayedOnComments(refVal_setDisplayedOnComments);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void UpdateUserBadgeParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -69,7 +132,7 @@ void UpdateUserBadgeParams::toMultipart(std::shared_ptr<MultipartFormData> multi
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_DisplayedOnCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayedOnComments")), m_DisplayedOnComments));
     }
@@ -102,17 +165,17 @@ bool UpdateUserBadgeParams::isDisplayedOnComments() const
 void UpdateUserBadgeParams::setDisplayedOnComments(bool value)
 {
     m_DisplayedOnComments = value;
-    m_DisplayedOnCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayedOnComments);
 }
 
 bool UpdateUserBadgeParams::displayedOnCommentsIsSet() const
 {
-    return m_DisplayedOnCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayedOnComments);
 }
 
 void UpdateUserBadgeParams::unsetDisplayedOnComments()
 {
-    m_DisplayedOnCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayedOnComments);
 }
 
 }
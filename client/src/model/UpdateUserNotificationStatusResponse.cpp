@@ -20,12 +20,8 @@ namespace model {
 
 UpdateUserNotificationStatusResponse::UpdateUserNotificationStatusResponse()
 {
-    m_StatusIsSet = false;
     m_MatchedCount = 0L;
-    m_MatchedCountIsSet = false;
     m_ModifiedCount = 0L;
-    m_ModifiedCountIsSet = false;
-    m_NoteIsSet = false;
 }
 
 UpdateUserNotificationStatusResponse::~UpdateUserNotificationStatusResponse()
@@ -40,22 +36,22 @@ void UpdateUserNotificationStatusResponse::validate()
 web::json::value UpdateUserNotificationStatusResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_MatchedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("matchedCount"))] = ModelBase::toJson(m_MatchedCount);
     }
-    if(m_ModifiedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("modifiedCount"))] = ModelBase::toJson(m_ModifiedCount);
     }
-    if(m_NoteIsSet)
+    if(m_FieldsSet.test(FieldBit_Note))
     {
         
         utility::string_t refVal = fromNoteEnum(m_Note);
@@ -66,55 +62,191 @@ web::json::value UpdateUserNotificationStatusResponse::toJson() const
     return val;
 }
 
+void UpdateUserNotificationStatusResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
+    {
+        
+        writer.key(_XPLATSTR("matchedCount"));
+        ModelBase::writeJson(writer, m_MatchedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
+    {
+        
+        writer.key(_XPLATSTR("modifiedCount"));
+        ModelBase::writeJson(writer, m_ModifiedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_Note))
+    {
+        
+        utility::string_t refVal = fromNoteEnum(m_Note);
+        writer.key(_XPLATSTR("note"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+
+    writer.endObject();
+}
+
 bool UpdateUserNotificationStatusResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("matchedCount"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("matchedCount")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int64_t refVal_setMatchedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedCount);
-            setMatchedCount(refVal_setMatchedCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("matchedCount")):
+            if(field.first == _XPLATSTR("matchedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setMatchedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedCount);
+                    setMatchedCount(refVal_setMatchedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("modifiedCount")):
+            if(field.first == _XPLATSTR("modifiedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setModifiedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModifiedCount);
+                    setModifiedCount(refVal_setModifiedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("note")):
+            if(field.first == _XPLATSTR("note"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setNote;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNote);
+                    setNote(toNoteEnum(refVal_setNote));
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("modifiedCount"))))
+    return ok;
+}
+
+void UpdateUserNotificationStatusResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("modifiedCount")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setModifiedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModifiedCount);
-            setModifiedCount(refVal_setModifiedCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("matchedCount")), m_MatchedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("modifiedCount")), m_ModifiedCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("note"))))
+    if(m_FieldsSet.test(FieldBit_Note))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("note")));
-        if(!fieldValue.is_null())
+        
+        utility::string_t refVal = fromNoteEnum(m_Note);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("note")), refVal);
+        
+    }
+}
+
+bool UpdateUserNotificationStatusResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setNote;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNote);
-            
-            setNote(toNoteEnum(refVal_setNote));
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("matchedCount")):
+            {
+                int64_t refVal_setMatchedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setMatchedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMatchedCount(refVal_setMatchedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("modifiedCount")):
+            {
+                int64_t refVal_setModifiedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setModifiedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModifiedCount(refVal_setModifiedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("note")):
+            {
+                utility::string_t refVal_setNote;
+                if(!ModelBase::readBinary(reader, field, refVal_setNote))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNote(toNoteEnum(refVal_setNote));
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UpdateUserNotificationStatusResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -124,19 +256,19 @@ void UpdateUserNotificationStatusResponse::toMultipart(std::shared_ptr<Multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_MatchedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("matchedCount")), m_MatchedCount));
     }
-    if(m_ModifiedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("modifiedCount")), m_ModifiedCount));
     }
-    if(m_NoteIsSet)
+    if(m_FieldsSet.test(FieldBit_Note))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("note")), fromNoteEnum(m_Note)));
     }
@@ -215,17 +347,17 @@ std::shared_ptr<APIStatus> UpdateUserNotificationStatusResponse::getStatus() con
 void UpdateUserNotificationStatusResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool UpdateUserNotificationStatusResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void UpdateUserNotificationStatusResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 int64_t UpdateUserNotificationStatusResponse::getMatchedCount() const
 {
@@ -235,17 +367,17 @@ int64_t UpdateUserNotificationStatusResponse::getMatchedCount() const
 void UpdateUserNotificationStatusResponse::setMatchedCount(int64_t value)
 {
     m_MatchedCount = value;
-    m_MatchedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_MatchedCount);
 }
 
 bool UpdateUserNotificationStatusResponse::matchedCountIsSet() const
 {
-    return m_MatchedCountIsSet;
+    return m_FieldsSet.test(FieldBit_MatchedCount);
 }
 
 void UpdateUserNotificationStatusResponse::unsetMatchedCount()
 {
-    m_MatchedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_MatchedCount);
 }
 int64_t UpdateUserNotificationStatusResponse::getModifiedCount() const
 {
@@ -255,17 +387,17 @@ int64_t UpdateUserNotificationStatusResponse::getModifiedCount() const
 void UpdateUserNotificationStatusResponse::setModifiedCount(int64_t value)
 {
     m_ModifiedCount = value;
-    m_ModifiedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_ModifiedCount);
 }
 
 bool UpdateUserNotificationStatusResponse::modifiedCountIsSet() const
 {
-    return m_ModifiedCountIsSet;
+    return m_FieldsSet.test(FieldBit_ModifiedCount);
 }
 
 void UpdateUserNotificationStatusResponse::unsetModifiedCount()
 {
-    m_ModifiedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModifiedCount);
 }
 UpdateUserNotificationStatusResponse::NoteEnum UpdateUserNotificationStatusResponse::getNote() const
 {
@@ -276,17 +408,17 @@ UpdateUserNotificationStatusResponse::NoteEnum UpdateUserNotificationStatusRespo
 void UpdateUserNotificationStatusResponse::setNote(const NoteEnum value)
 {
     m_Note = value;
-    m_NoteIsSet = true;
+    m_FieldsSet.set(FieldBit_Note);
 }
 
 bool UpdateUserNotificationStatusResponse::noteIsSet() const
 {
-    return m_NoteIsSet;
+    return m_FieldsSet.test(FieldBit_Note);
 }
 
 void UpdateUserNotificationStatusResponse::unsetNote()
 {
-    m_NoteIsSet = false;
+    m_FieldsSet.reset(FieldBit_Note);
 }
 
 }
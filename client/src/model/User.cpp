@@ -20,108 +20,38 @@ namespace model {
 
 User::User()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_Username = utility::conversions::to_string_t("");
-    m_UsernameIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_PendingEmail = utility::conversions::to_string_t("");
-    m_PendingEmailIsSet = false;
-    m_BackupEmail = utility::conversions::to_string_t("");
-    m_BackupEmailIsSet = false;
-    m_PendingBackupEmail = utility::conversions::to_string_t("");
-    m_PendingBackupEmailIsSet = false;
     m_SignUpDate = 0L;
-    m_SignUpDateIsSet = false;
-    m_CreatedFromIpHashed = utility::conversions::to_string_t("");
-    m_CreatedFromIpHashedIsSet = false;
     m_Verified = false;
-    m_VerifiedIsSet = false;
-    m_LoginId = utility::conversions::to_string_t("");
-    m_LoginIdIsSet = false;
     m_LoginIdDate = 0L;
-    m_LoginIdDateIsSet = false;
     m_LoginCount = 0;
-    m_LoginCountIsSet = false;
     m_OptedInNotifications = false;
-    m_OptedInNotificationsIsSet = false;
     m_OptedInTenantNotifications = false;
-    m_OptedInTenantNotificationsIsSet = false;
     m_HideAccountCode = false;
-    m_HideAccountCodeIsSet = false;
     m_IsFastCommentsHelpRequestAdmin = false;
-    m_IsFastCommentsHelpRequestAdminIsSet = false;
     m_IsHelpRequestAdmin = false;
-    m_IsHelpRequestAdminIsSet = false;
     m_IsAccountOwner = false;
-    m_IsAccountOwnerIsSet = false;
     m_IsAdminAdmin = false;
-    m_IsAdminAdminIsSet = false;
     m_IsBillingAdmin = false;
-    m_IsBillingAdminIsSet = false;
     m_IsAnalyticsAdmin = false;
-    m_IsAnalyticsAdminIsSet = false;
     m_IsCustomizationAdmin = false;
-    m_IsCustomizationAdminIsSet = false;
     m_IsManageDataAdmin = false;
-    m_IsManageDataAdminIsSet = false;
     m_IsCommentModeratorAdmin = false;
-    m_IsCommentModeratorAdminIsSet = false;
     m_IsAPIAdmin = false;
-    m_IsAPIAdminIsSet = false;
     m_IsSiteAdmin = false;
-    m_IsSiteAdminIsSet = false;
-    m_ModeratorIdsIsSet = false;
     m_IsImpersonator = false;
-    m_IsImpersonatorIsSet = false;
     m_IsCouponManager = false;
-    m_IsCouponManagerIsSet = false;
-    m_Locale = utility::conversions::to_string_t("");
-    m_LocaleIsSet = false;
-    m_DigestEmailFrequencyIsSet = false;
     m_NotificationFrequency = 0.0;
-    m_NotificationFrequencyIsSet = false;
     m_AdminNotificationFrequency = 0.0;
-    m_AdminNotificationFrequencyIsSet = false;
-    m_AgentApprovalNotificationFrequencyIsSet = false;
-    m_LastTenantNotificationSentDate = utility::datetime();
-    m_LastTenantNotificationSentDateIsSet = false;
-    m_LastReplyNotificationSentDate = utility::datetime();
-    m_LastReplyNotificationSentDateIsSet = false;
     m_IgnoredAddToMySiteMessages = false;
-    m_IgnoredAddToMySiteMessagesIsSet = false;
-    m_LastLoginDate = utility::datetime();
-    m_LastLoginDateIsSet = false;
-    m_DisplayLabel = utility::conversions::to_string_t("");
-    m_DisplayLabelIsSet = false;
     m_IsProfileActivityPrivate = false;
-    m_IsProfileActivityPrivateIsSet = false;
     m_IsProfileCommentsPrivate = false;
-    m_IsProfileCommentsPrivateIsSet = false;
     m_IsProfileDMDisabled = false;
-    m_IsProfileDMDisabledIsSet = false;
     m_ProfileCommentApprovalMode = 0.0;
-    m_ProfileCommentApprovalModeIsSet = false;
     m_Karma = 0.0;
-    m_KarmaIsSet = false;
-    m_PasswordHash = utility::conversions::to_string_t("");
-    m_PasswordHashIsSet = false;
     m_HasBlockedUsers = false;
-    m_HasBlockedUsersIsSet = false;
-    m_Bio = utility::conversions::to_string_t("");
-    m_BioIsSet = false;
-    m_HeaderBackgroundSrc = utility::conversions::to_string_t("");
-    m_HeaderBackgroundSrcIsSet = false;
-    m_CountryCode = utility::conversions::to_string_t("");
-    m_CountryCodeIsSet = false;
-    m_CountryFlag = utility::conversions::to_string_t("");
-    m_CountryFlagIsSet = false;
-    m_SocialLinksIsSet = false;
     m_HasTwoFactor = false;
-    m_HasTwoFactorIsSet = false;
     m_IsEmailSuppressed = false;
-    m_IsEmailSuppressedIsSet = false;
+    m_AverageTicketAckTimeMS = 0.0;
 }
 
 User::~User()
@@ -136,302 +66,302 @@ void User::validate()
 web::json::value User::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantId.has_value())
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_WebsiteUrl.has_value())
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))] = ModelBase::toJson(m_WebsiteUrl.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))] = ModelBase::toJson(m_WebsiteUrl);
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_PendingEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingEmail))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pendingEmail"))] = ModelBase::toJson(m_PendingEmail);
     }
-    if(m_BackupEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_BackupEmail))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("backupEmail"))] = ModelBase::toJson(m_BackupEmail);
     }
-    if(m_PendingBackupEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingBackupEmail))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("pendingBackupEmail"))] = ModelBase::toJson(m_PendingBackupEmail);
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("signUpDate"))] = ModelBase::toJson(m_SignUpDate);
     }
-    if(m_CreatedFromUrlId.has_value())
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId"))] = ModelBase::toJson(m_CreatedFromUrlId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId"))] = ModelBase::toJson(m_CreatedFromUrlId);
     }
-    if(m_CreatedFromTenantId.has_value())
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId"))] = ModelBase::toJson(m_CreatedFromTenantId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId"))] = ModelBase::toJson(m_CreatedFromTenantId);
     }
-    if(m_CreatedFromIpHashedIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromIpHashed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdFromIpHashed"))] = ModelBase::toJson(m_CreatedFromIpHashed);
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("verified"))] = ModelBase::toJson(m_Verified);
     }
-    if(m_LoginIdIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("loginId"))] = ModelBase::toJson(m_LoginId);
     }
-    if(m_LoginIdDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginIdDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("loginIdDate"))] = ModelBase::toJson(m_LoginIdDate);
     }
-    if(m_LoginCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("loginCount"))] = ModelBase::toJson(m_LoginCount);
     }
-    if(m_OptedInNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedInNotifications"))] = ModelBase::toJson(m_OptedInNotifications);
     }
-    if(m_OptedInTenantNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications"))] = ModelBase::toJson(m_OptedInTenantNotifications);
     }
-    if(m_HideAccountCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hideAccountCode"))] = ModelBase::toJson(m_HideAccountCode);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_IsFastCommentsHelpRequestAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFastCommentsHelpRequestAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isFastCommentsHelpRequestAdmin"))] = ModelBase::toJson(m_IsFastCommentsHelpRequestAdmin);
     }
-    if(m_IsHelpRequestAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin"))] = ModelBase::toJson(m_IsHelpRequestAdmin);
     }
-    if(m_IsAccountOwnerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAccountOwner"))] = ModelBase::toJson(m_IsAccountOwner);
     }
-    if(m_IsAdminAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin"))] = ModelBase::toJson(m_IsAdminAdmin);
     }
-    if(m_IsBillingAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin"))] = ModelBase::toJson(m_IsBillingAdmin);
     }
-    if(m_IsAnalyticsAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin"))] = ModelBase::toJson(m_IsAnalyticsAdmin);
     }
-    if(m_IsCustomizationAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin"))] = ModelBase::toJson(m_IsCustomizationAdmin);
     }
-    if(m_IsManageDataAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin"))] = ModelBase::toJson(m_IsManageDataAdmin);
     }
-    if(m_IsCommentModeratorAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin"))] = ModelBase::toJson(m_IsCommentModeratorAdmin);
     }
-    if(m_IsAPIAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin"))] = ModelBase::toJson(m_IsAPIAdmin);
     }
-    if(m_IsSiteAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin"))] = ModelBase::toJson(m_IsSiteAdmin);
     }
-    if(m_ModeratorIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("moderatorIds"))] = ModelBase::toJson(m_ModeratorIds);
     }
-    if(m_IsImpersonatorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsImpersonator))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isImpersonator"))] = ModelBase::toJson(m_IsImpersonator);
     }
-    if(m_IsCouponManagerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCouponManager))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isCouponManager"))] = ModelBase::toJson(m_IsCouponManager);
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("locale"))] = ModelBase::toJson(m_Locale);
     }
-    if(m_DigestEmailFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency"))] = ModelBase::toJson(m_DigestEmailFrequency);
     }
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))] = ModelBase::toJson(m_NotificationFrequency);
     }
-    if(m_AdminNotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_AdminNotificationFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("adminNotificationFrequency"))] = ModelBase::toJson(m_AdminNotificationFrequency);
     }
-    if(m_AgentApprovalNotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_AgentApprovalNotificationFrequency))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("agentApprovalNotificationFrequency"))] = ModelBase::toJson(m_AgentApprovalNotificationFrequency);
     }
-    if(m_LastTenantNotificationSentDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastTenantNotificationSentDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastTenantNotificationSentDate"))] = ModelBase::toJson(m_LastTenantNotificationSentDate);
     }
-    if(m_LastReplyNotificationSentDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastReplyNotificationSentDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastReplyNotificationSentDate"))] = ModelBase::toJson(m_LastReplyNotificationSentDate);
     }
-    if(m_IgnoredAddToMySiteMessagesIsSet)
+    if(m_FieldsSet.test(FieldBit_IgnoredAddToMySiteMessages))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("ignoredAddToMySiteMessages"))] = ModelBase::toJson(m_IgnoredAddToMySiteMessages);
     }
-    if(m_LastLoginDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("lastLoginDate"))] = ModelBase::toJson(m_LastLoginDate);
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_IsProfileActivityPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate"))] = ModelBase::toJson(m_IsProfileActivityPrivate);
     }
-    if(m_IsProfileCommentsPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate"))] = ModelBase::toJson(m_IsProfileCommentsPrivate);
     }
-    if(m_IsProfileDMDisabledIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled"))] = ModelBase::toJson(m_IsProfileDMDisabled);
     }
-    if(m_ProfileCommentApprovalModeIsSet)
+    if(m_FieldsSet.test(FieldBit_ProfileCommentApprovalMode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("profileCommentApprovalMode"))] = ModelBase::toJson(m_ProfileCommentApprovalMode);
     }
-    if(m_KarmaIsSet)
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("karma"))] = ModelBase::toJson(m_Karma);
     }
-    if(m_PasswordHashIsSet)
+    if(m_FieldsSet.test(FieldBit_PasswordHash))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("passwordHash"))] = ModelBase::toJson(m_PasswordHash);
     }
-    if(m_AverageTicketAckTimeMS.has_value())
+    if(m_FieldsSet.test(FieldBit_AverageTicketAckTimeMS))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("averageTicketAckTimeMS"))] = ModelBase::toJson(m_AverageTicketAckTimeMS.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("averageTicketAckTimeMS"))] = ModelBase::toJson(m_AverageTicketAckTimeMS);
     }
-    if(m_HasBlockedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers"))] = ModelBase::toJson(m_HasBlockedUsers);
     }
-    if(m_BioIsSet)
+    if(m_FieldsSet.test(FieldBit_Bio))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("bio"))] = ModelBase::toJson(m_Bio);
     }
-    if(m_HeaderBackgroundSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_HeaderBackgroundSrc))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("headerBackgroundSrc"))] = ModelBase::toJson(m_HeaderBackgroundSrc);
     }
-    if(m_CountryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryCode))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("countryCode"))] = ModelBase::toJson(m_CountryCode);
     }
-    if(m_CountryFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("countryFlag"))] = ModelBase::toJson(m_CountryFlag);
     }
-    if(m_SocialLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_SocialLinks))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("socialLinks"))] = ModelBase::toJson(m_SocialLinks);
     }
-    if(m_HasTwoFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_HasTwoFactor))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasTwoFactor"))] = ModelBase::toJson(m_HasTwoFactor);
     }
-    if(m_IsEmailSuppressedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed"))] = ModelBase::toJson(m_IsEmailSuppressed);
@@ -440,670 +370,2091 @@ web::json::value User::toJson() const
     return val;
 }
 
+void User::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
+    {
+        
+        writer.key(_XPLATSTR("websiteUrl"));
+        ModelBase::writeJson(writer, m_WebsiteUrl);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_PendingEmail))
+    {
+        
+        writer.key(_XPLATSTR("pendingEmail"));
+        ModelBase::writeJson(writer, m_PendingEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_BackupEmail))
+    {
+        
+        writer.key(_XPLATSTR("backupEmail"));
+        ModelBase::writeJson(writer, m_BackupEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_PendingBackupEmail))
+    {
+        
+        writer.key(_XPLATSTR("pendingBackupEmail"));
+        ModelBase::writeJson(writer, m_PendingBackupEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
+    {
+        
+        writer.key(_XPLATSTR("signUpDate"));
+        ModelBase::writeJson(writer, m_SignUpDate);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
+    {
+        
+        writer.key(_XPLATSTR("createdFromUrlId"));
+        ModelBase::writeJson(writer, m_CreatedFromUrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
+    {
+        
+        writer.key(_XPLATSTR("createdFromTenantId"));
+        ModelBase::writeJson(writer, m_CreatedFromTenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedFromIpHashed))
+    {
+        
+        writer.key(_XPLATSTR("createdFromIpHashed"));
+        ModelBase::writeJson(writer, m_CreatedFromIpHashed);
+    }
+    if(m_FieldsSet.test(FieldBit_Verified))
+    {
+        
+        writer.key(_XPLATSTR("verified"));
+        ModelBase::writeJson(writer, m_Verified);
+    }
+    if(m_FieldsSet.test(FieldBit_LoginId))
+    {
+        
+        writer.key(_XPLATSTR("loginId"));
+        ModelBase::writeJson(writer, m_LoginId);
+    }
+    if(m_FieldsSet.test(FieldBit_LoginIdDate))
+    {
+        
+        writer.key(_XPLATSTR("loginIdDate"));
+        ModelBase::writeJson(writer, m_LoginIdDate);
+    }
+    if(m_FieldsSet.test(FieldBit_LoginCount))
+    {
+        
+        writer.key(_XPLATSTR("loginCount"));
+        ModelBase::writeJson(writer, m_LoginCount);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
+    {
+        
+        writer.key(_XPLATSTR("optedInNotifications"));
+        ModelBase::writeJson(writer, m_OptedInNotifications);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
+    {
+        
+        writer.key(_XPLATSTR("optedInTenantNotifications"));
+        ModelBase::writeJson(writer, m_OptedInTenantNotifications);
+    }
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
+    {
+        
+        writer.key(_XPLATSTR("hideAccountCode"));
+        ModelBase::writeJson(writer, m_HideAccountCode);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_IsFastCommentsHelpRequestAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isFastCommentsHelpRequestAdmin"));
+        ModelBase::writeJson(writer, m_IsFastCommentsHelpRequestAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isHelpRequestAdmin"));
+        ModelBase::writeJson(writer, m_IsHelpRequestAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
+    {
+        
+        writer.key(_XPLATSTR("isAccountOwner"));
+        ModelBase::writeJson(writer, m_IsAccountOwner);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isAdminAdmin"));
+        ModelBase::writeJson(writer, m_IsAdminAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isBillingAdmin"));
+        ModelBase::writeJson(writer, m_IsBillingAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isAnalyticsAdmin"));
+        ModelBase::writeJson(writer, m_IsAnalyticsAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isCustomizationAdmin"));
+        ModelBase::writeJson(writer, m_IsCustomizationAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isManageDataAdmin"));
+        ModelBase::writeJson(writer, m_IsManageDataAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isCommentModeratorAdmin"));
+        ModelBase::writeJson(writer, m_IsCommentModeratorAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isAPIAdmin"));
+        ModelBase::writeJson(writer, m_IsAPIAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
+    {
+        
+        writer.key(_XPLATSTR("isSiteAdmin"));
+        ModelBase::writeJson(writer, m_IsSiteAdmin);
+    }
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
+    {
+        
+        writer.key(_XPLATSTR("moderatorIds"));
+        ModelBase::writeJson(writer, m_ModeratorIds);
+    }
+    if(m_FieldsSet.test(FieldBit_IsImpersonator))
+    {
+        
+        writer.key(_XPLATSTR("isImpersonator"));
+        ModelBase::writeJson(writer, m_IsImpersonator);
+    }
+    if(m_FieldsSet.test(FieldBit_IsCouponManager))
+    {
+        
+        writer.key(_XPLATSTR("isCouponManager"));
+        ModelBase::writeJson(writer, m_IsCouponManager);
+    }
+    if(m_FieldsSet.test(FieldBit_Locale))
+    {
+        
+        writer.key(_XPLATSTR("locale"));
+        ModelBase::writeJson(writer, m_Locale);
+    }
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
+    {
+        
+        writer.key(_XPLATSTR("digestEmailFrequency"));
+        ModelBase::writeJson(writer, m_DigestEmailFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
+    {
+        
+        writer.key(_XPLATSTR("notificationFrequency"));
+        ModelBase::writeJson(writer, m_NotificationFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_AdminNotificationFrequency))
+    {
+        
+        writer.key(_XPLATSTR("adminNotificationFrequency"));
+        ModelBase::writeJson(writer, m_AdminNotificationFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_AgentApprovalNotificationFrequency))
+    {
+        
+        writer.key(_XPLATSTR("agentApprovalNotificationFrequency"));
+        ModelBase::writeJson(writer, m_AgentApprovalNotificationFrequency);
+    }
+    if(m_FieldsSet.test(FieldBit_LastTenantNotificationSentDate))
+    {
+        
+        writer.key(_XPLATSTR("lastTenantNotificationSentDate"));
+        ModelBase::writeJson(writer, m_LastTenantNotificationSentDate);
+    }
+    if(m_FieldsSet.test(FieldBit_LastReplyNotificationSentDate))
+    {
+        
+        writer.key(_XPLATSTR("lastReplyNotificationSentDate"));
+        ModelBase::writeJson(writer, m_LastReplyNotificationSentDate);
+    }
+    if(m_FieldsSet.test(FieldBit_IgnoredAddToMySiteMessages))
+    {
+        
+        writer.key(_XPLATSTR("ignoredAddToMySiteMessages"));
+        ModelBase::writeJson(writer, m_IgnoredAddToMySiteMessages);
+    }
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
+    {
+        
+        writer.key(_XPLATSTR("lastLoginDate"));
+        ModelBase::writeJson(writer, m_LastLoginDate);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
+    {
+        
+        writer.key(_XPLATSTR("isProfileActivityPrivate"));
+        ModelBase::writeJson(writer, m_IsProfileActivityPrivate);
+    }
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
+    {
+        
+        writer.key(_XPLATSTR("isProfileCommentsPrivate"));
+        ModelBase::writeJson(writer, m_IsProfileCommentsPrivate);
+    }
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
+    {
+        
+        writer.key(_XPLATSTR("isProfileDMDisabled"));
+        ModelBase::writeJson(writer, m_IsProfileDMDisabled);
+    }
+    if(m_FieldsSet.test(FieldBit_ProfileCommentApprovalMode))
+    {
+        
+        writer.key(_XPLATSTR("profileCommentApprovalMode"));
+        ModelBase::writeJson(writer, m_ProfileCommentApprovalMode);
+    }
+    if(m_FieldsSet.test(FieldBit_Karma))
+    {
+        
+        writer.key(_XPLATSTR("karma"));
+        ModelBase::writeJson(writer, m_Karma);
+    }
+    if(m_FieldsSet.test(FieldBit_PasswordHash))
+    {
+        
+        writer.key(_XPLATSTR("passwordHash"));
+        ModelBase::writeJson(writer, m_PasswordHash);
+    }
+    if(m_FieldsSet.test(FieldBit_AverageTicketAckTimeMS))
+    {
+        
+        writer.key(_XPLATSTR("averageTicketAckTimeMS"));
+        ModelBase::writeJson(writer, m_AverageTicketAckTimeMS);
+    }
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
+    {
+        
+        writer.key(_XPLATSTR("hasBlockedUsers"));
+        ModelBase::writeJson(writer, m_HasBlockedUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_Bio))
+    {
+        
+        writer.key(_XPLATSTR("bio"));
+        ModelBase::writeJson(writer, m_Bio);
+    }
+    if(m_FieldsSet.test(FieldBit_HeaderBackgroundSrc))
+    {
+        
+        writer.key(_XPLATSTR("headerBackgroundSrc"));
+        ModelBase::writeJson(writer, m_HeaderBackgroundSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_CountryCode))
+    {
+        
+        writer.key(_XPLATSTR("countryCode"));
+        ModelBase::writeJson(writer, m_CountryCode);
+    }
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
+    {
+        
+        writer.key(_XPLATSTR("countryFlag"));
+        ModelBase::writeJson(writer, m_CountryFlag);
+    }
+    if(m_FieldsSet.test(FieldBit_SocialLinks))
+    {
+        
+        writer.key(_XPLATSTR("socialLinks"));
+        ModelBase::writeJson(writer, m_SocialLinks);
+    }
+    if(m_FieldsSet.test(FieldBit_HasTwoFactor))
+    {
+        
+        writer.key(_XPLATSTR("hasTwoFactor"));
+        ModelBase::writeJson(writer, m_HasTwoFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
+    {
+        
+        writer.key(_XPLATSTR("isEmailSuppressed"));
+        ModelBase::writeJson(writer, m_IsEmailSuppressed);
+    }
+
+    writer.endObject();
+}
+
 bool User::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            if(field.first == _XPLATSTR("websiteUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWebsiteUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
+                    setWebsiteUrl(refVal_setWebsiteUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pendingEmail")):
+            if(field.first == _XPLATSTR("pendingEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPendingEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPendingEmail);
+                    setPendingEmail(refVal_setPendingEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("backupEmail")):
+            if(field.first == _XPLATSTR("backupEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBackupEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBackupEmail);
+                    setBackupEmail(refVal_setBackupEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pendingBackupEmail")):
+            if(field.first == _XPLATSTR("pendingBackupEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPendingBackupEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPendingBackupEmail);
+                    setPendingBackupEmail(refVal_setPendingBackupEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            if(field.first == _XPLATSTR("signUpDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setSignUpDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
+                    setSignUpDate(refVal_setSignUpDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")):
+            if(field.first == _XPLATSTR("createdFromUrlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedFromUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromUrlId);
+                    setCreatedFromUrlId(refVal_setCreatedFromUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromTenantId")):
+            if(field.first == _XPLATSTR("createdFromTenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedFromTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromTenantId);
+                    setCreatedFromTenantId(refVal_setCreatedFromTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromIpHashed")):
+            if(field.first == _XPLATSTR("createdFromIpHashed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCreatedFromIpHashed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromIpHashed);
+                    setCreatedFromIpHashed(refVal_setCreatedFromIpHashed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            if(field.first == _XPLATSTR("verified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
+                    setVerified(refVal_setVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("loginId")):
+            if(field.first == _XPLATSTR("loginId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLoginId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLoginId);
+                    setLoginId(refVal_setLoginId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("loginIdDate")):
+            if(field.first == _XPLATSTR("loginIdDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setLoginIdDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLoginIdDate);
+                    setLoginIdDate(refVal_setLoginIdDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("loginCount")):
+            if(field.first == _XPLATSTR("loginCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setLoginCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLoginCount);
+                    setLoginCount(refVal_setLoginCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedInNotifications")):
+            if(field.first == _XPLATSTR("optedInNotifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedInNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInNotifications);
+                    setOptedInNotifications(refVal_setOptedInNotifications);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedInTenantNotifications")):
+            if(field.first == _XPLATSTR("optedInTenantNotifications"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedInTenantNotifications;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInTenantNotifications);
+                    setOptedInTenantNotifications(refVal_setOptedInTenantNotifications);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hideAccountCode")):
+            if(field.first == _XPLATSTR("hideAccountCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHideAccountCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHideAccountCode);
+                    setHideAccountCode(refVal_setHideAccountCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isFastCommentsHelpRequestAdmin")):
+            if(field.first == _XPLATSTR("isFastCommentsHelpRequestAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsFastCommentsHelpRequestAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsFastCommentsHelpRequestAdmin);
+                    setIsFastCommentsHelpRequestAdmin(refVal_setIsFastCommentsHelpRequestAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isHelpRequestAdmin")):
+            if(field.first == _XPLATSTR("isHelpRequestAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsHelpRequestAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsHelpRequestAdmin);
+                    setIsHelpRequestAdmin(refVal_setIsHelpRequestAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAccountOwner")):
+            if(field.first == _XPLATSTR("isAccountOwner"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAccountOwner;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAccountOwner);
+                    setIsAccountOwner(refVal_setIsAccountOwner);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")):
+            if(field.first == _XPLATSTR("isAdminAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAdminAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAdminAdmin);
+                    setIsAdminAdmin(refVal_setIsAdminAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isBillingAdmin")):
+            if(field.first == _XPLATSTR("isBillingAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsBillingAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsBillingAdmin);
+                    setIsBillingAdmin(refVal_setIsBillingAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAnalyticsAdmin")):
+            if(field.first == _XPLATSTR("isAnalyticsAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAnalyticsAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAnalyticsAdmin);
+                    setIsAnalyticsAdmin(refVal_setIsAnalyticsAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isCustomizationAdmin")):
+            if(field.first == _XPLATSTR("isCustomizationAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsCustomizationAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsCustomizationAdmin);
+                    setIsCustomizationAdmin(refVal_setIsCustomizationAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isManageDataAdmin")):
+            if(field.first == _XPLATSTR("isManageDataAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsManageDataAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsManageDataAdmin);
+                    setIsManageDataAdmin(refVal_setIsManageDataAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")):
+            if(field.first == _XPLATSTR("isCommentModeratorAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsCommentModeratorAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsCommentModeratorAdmin);
+                    setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAPIAdmin")):
+            if(field.first == _XPLATSTR("isAPIAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAPIAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAPIAdmin);
+                    setIsAPIAdmin(refVal_setIsAPIAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isSiteAdmin")):
+            if(field.first == _XPLATSTR("isSiteAdmin"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsSiteAdmin;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsSiteAdmin);
+                    setIsSiteAdmin(refVal_setIsSiteAdmin);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("moderatorIds")):
+            if(field.first == _XPLATSTR("moderatorIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setModeratorIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModeratorIds);
+                    setModeratorIds(refVal_setModeratorIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isImpersonator")):
+            if(field.first == _XPLATSTR("isImpersonator"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsImpersonator;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsImpersonator);
+                    setIsImpersonator(refVal_setIsImpersonator);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isCouponManager")):
+            if(field.first == _XPLATSTR("isCouponManager"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsCouponManager;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsCouponManager);
+                    setIsCouponManager(refVal_setIsCouponManager);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            if(field.first == _XPLATSTR("locale"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setLocale;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
+                    setLocale(refVal_setLocale);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("digestEmailFrequency")):
+            if(field.first == _XPLATSTR("digestEmailFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<DigestEmailFrequency> refVal_setDigestEmailFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDigestEmailFrequency);
+                    setDigestEmailFrequency(refVal_setDigestEmailFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            if(field.first == _XPLATSTR("notificationFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setNotificationFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
+                    setNotificationFrequency(refVal_setNotificationFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("adminNotificationFrequency")):
+            if(field.first == _XPLATSTR("adminNotificationFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAdminNotificationFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAdminNotificationFrequency);
+                    setAdminNotificationFrequency(refVal_setAdminNotificationFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("agentApprovalNotificationFrequency")):
+            if(field.first == _XPLATSTR("agentApprovalNotificationFrequency"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<ImportedAgentApprovalNotificationFrequency> refVal_setAgentApprovalNotificationFrequency;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAgentApprovalNotificationFrequency);
+                    setAgentApprovalNotificationFrequency(refVal_setAgentApprovalNotificationFrequency);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastTenantNotificationSentDate")):
+            if(field.first == _XPLATSTR("lastTenantNotificationSentDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setLastTenantNotificationSentDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastTenantNotificationSentDate);
+                    setLastTenantNotificationSentDate(refVal_setLastTenantNotificationSentDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastReplyNotificationSentDate")):
+            if(field.first == _XPLATSTR("lastReplyNotificationSentDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setLastReplyNotificationSentDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastReplyNotificationSentDate);
+                    setLastReplyNotificationSentDate(refVal_setLastReplyNotificationSentDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("ignoredAddToMySiteMessages")):
+            if(field.first == _XPLATSTR("ignoredAddToMySiteMessages"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIgnoredAddToMySiteMessages;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIgnoredAddToMySiteMessages);
+                    setIgnoredAddToMySiteMessages(refVal_setIgnoredAddToMySiteMessages);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("lastLoginDate")):
+            if(field.first == _XPLATSTR("lastLoginDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setLastLoginDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setLastLoginDate);
+                    setLastLoginDate(refVal_setLastLoginDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileActivityPrivate")):
+            if(field.first == _XPLATSTR("isProfileActivityPrivate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsProfileActivityPrivate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileActivityPrivate);
+                    setIsProfileActivityPrivate(refVal_setIsProfileActivityPrivate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileCommentsPrivate")):
+            if(field.first == _XPLATSTR("isProfileCommentsPrivate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsProfileCommentsPrivate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileCommentsPrivate);
+                    setIsProfileCommentsPrivate(refVal_setIsProfileCommentsPrivate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileDMDisabled")):
+            if(field.first == _XPLATSTR("isProfileDMDisabled"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsProfileDMDisabled;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileDMDisabled);
+                    setIsProfileDMDisabled(refVal_setIsProfileDMDisabled);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("profileCommentApprovalMode")):
+            if(field.first == _XPLATSTR("profileCommentApprovalMode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setProfileCommentApprovalMode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setProfileCommentApprovalMode);
+                    setProfileCommentApprovalMode(refVal_setProfileCommentApprovalMode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("karma")):
+            if(field.first == _XPLATSTR("karma"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setKarma;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setKarma);
+                    setKarma(refVal_setKarma);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("passwordHash")):
+            if(field.first == _XPLATSTR("passwordHash"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPasswordHash;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPasswordHash);
+                    setPasswordHash(refVal_setPasswordHash);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("averageTicketAckTimeMS")):
+            if(field.first == _XPLATSTR("averageTicketAckTimeMS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAverageTicketAckTimeMS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAverageTicketAckTimeMS);
+                    setAverageTicketAckTimeMS(refVal_setAverageTicketAckTimeMS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")):
+            if(field.first == _XPLATSTR("hasBlockedUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasBlockedUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasBlockedUsers);
+                    setHasBlockedUsers(refVal_setHasBlockedUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("bio")):
+            if(field.first == _XPLATSTR("bio"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBio;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBio);
+                    setBio(refVal_setBio);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("headerBackgroundSrc")):
+            if(field.first == _XPLATSTR("headerBackgroundSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setHeaderBackgroundSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHeaderBackgroundSrc);
+                    setHeaderBackgroundSrc(refVal_setHeaderBackgroundSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("countryCode")):
+            if(field.first == _XPLATSTR("countryCode"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCountryCode;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCountryCode);
+                    setCountryCode(refVal_setCountryCode);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("countryFlag")):
+            if(field.first == _XPLATSTR("countryFlag"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCountryFlag;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCountryFlag);
+                    setCountryFlag(refVal_setCountryFlag);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("socialLinks")):
+            if(field.first == _XPLATSTR("socialLinks"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setSocialLinks;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSocialLinks);
+                    setSocialLinks(refVal_setSocialLinks);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasTwoFactor")):
+            if(field.first == _XPLATSTR("hasTwoFactor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasTwoFactor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasTwoFactor);
+                    setHasTwoFactor(refVal_setHasTwoFactor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isEmailSuppressed")):
+            if(field.first == _XPLATSTR("isEmailSuppressed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsEmailSuppressed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsEmailSuppressed);
+                    setIsEmailSuppressed(refVal_setIsEmailSuppressed);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    return ok;
+}
+
+void User::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))))
+    if(m_FieldsSet.test(FieldBit_Username))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("websiteUrl")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setWebsiteUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
-            setWebsiteUrl(refVal_setWebsiteUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pendingEmail"))))
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pendingEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPendingEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPendingEmail);
-            setPendingEmail(refVal_setPendingEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("websiteUrl")), m_WebsiteUrl);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("backupEmail"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("backupEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBackupEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBackupEmail);
-            setBackupEmail(refVal_setBackupEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pendingBackupEmail"))))
+    if(m_FieldsSet.test(FieldBit_PendingEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pendingBackupEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPendingBackupEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPendingBackupEmail);
-            setPendingBackupEmail(refVal_setPendingBackupEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pendingEmail")), m_PendingEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("signUpDate"))))
+    if(m_FieldsSet.test(FieldBit_BackupEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("signUpDate")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setSignUpDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSignUpDate);
-            setSignUpDate(refVal_setSignUpDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("backupEmail")), m_BackupEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId"))))
+    if(m_FieldsSet.test(FieldBit_PendingBackupEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedFromUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromUrlId);
-            setCreatedFromUrlId(refVal_setCreatedFromUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pendingBackupEmail")), m_PendingBackupEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId"))))
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedFromTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromTenantId);
-            setCreatedFromTenantId(refVal_setCreatedFromTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("signUpDate")), m_SignUpDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdFromIpHashed"))))
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdFromIpHashed")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCreatedFromIpHashed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedFromIpHashed);
-            setCreatedFromIpHashed(refVal_setCreatedFromIpHashed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")), m_CreatedFromUrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("verified"))))
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("verified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVerified);
-            setVerified(refVal_setVerified);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdFromTenantId")), m_CreatedFromTenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("loginId"))))
+    if(m_FieldsSet.test(FieldBit_CreatedFromIpHashed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("loginId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLoginId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLoginId);
-            setLoginId(refVal_setLoginId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdFromIpHashed")), m_CreatedFromIpHashed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("loginIdDate"))))
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("loginIdDate")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setLoginIdDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLoginIdDate);
-            setLoginIdDate(refVal_setLoginIdDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("verified")), m_Verified);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("loginCount"))))
+    if(m_FieldsSet.test(FieldBit_LoginId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("loginCount")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setLoginCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLoginCount);
-            setLoginCount(refVal_setLoginCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("loginId")), m_LoginId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedInNotifications"))))
+    if(m_FieldsSet.test(FieldBit_LoginIdDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedInNotifications")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedInNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInNotifications);
-            setOptedInNotifications(refVal_setOptedInNotifications);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("loginIdDate")), m_LoginIdDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications"))))
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedInTenantNotifications;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedInTenantNotifications);
-            setOptedInTenantNotifications(refVal_setOptedInTenantNotifications);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("loginCount")), m_LoginCount);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hideAccountCode"))))
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hideAccountCode")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHideAccountCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHideAccountCode);
-            setHideAccountCode(refVal_setHideAccountCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedInNotifications")), m_OptedInNotifications);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedInTenantNotifications")), m_OptedInTenantNotifications);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isFastCommentsHelpRequestAdmin"))))
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isFastCommentsHelpRequestAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsFastCommentsHelpRequestAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsFastCommentsHelpRequestAdmin);
-            setIsFastCommentsHelpRequestAdmin(refVal_setIsFastCommentsHelpRequestAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hideAccountCode")), m_HideAccountCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsHelpRequestAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsHelpRequestAdmin);
-            setIsHelpRequestAdmin(refVal_setIsHelpRequestAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAccountOwner"))))
+    if(m_FieldsSet.test(FieldBit_IsFastCommentsHelpRequestAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAccountOwner")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAccountOwner;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAccountOwner);
-            setIsAccountOwner(refVal_setIsAccountOwner);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isFastCommentsHelpRequestAdmin")), m_IsFastCommentsHelpRequestAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAdminAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAdminAdmin);
-            setIsAdminAdmin(refVal_setIsAdminAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isHelpRequestAdmin")), m_IsHelpRequestAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsBillingAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsBillingAdmin);
-            setIsBillingAdmin(refVal_setIsBillingAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAccountOwner")), m_IsAccountOwner);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAnalyticsAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAnalyticsAdmin);
-            setIsAnalyticsAdmin(refVal_setIsAnalyticsAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")), m_IsAdminAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsCustomizationAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsCustomizationAdmin);
-            setIsCustomizationAdmin(refVal_setIsCustomizationAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isBillingAdmin")), m_IsBillingAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsManageDataAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsManageDataAdmin);
-            setIsManageDataAdmin(refVal_setIsManageDataAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAnalyticsAdmin")), m_IsAnalyticsAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsCommentModeratorAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsCommentModeratorAdmin);
-            setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isCustomizationAdmin")), m_IsCustomizationAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAPIAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAPIAdmin);
-            setIsAPIAdmin(refVal_setIsAPIAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isManageDataAdmin")), m_IsManageDataAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin"))))
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsSiteAdmin;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsSiteAdmin);
-            setIsSiteAdmin(refVal_setIsSiteAdmin);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")), m_IsCommentModeratorAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("moderatorIds"))))
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("moderatorIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setModeratorIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModeratorIds);
-            setModeratorIds(refVal_setModeratorIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAPIAdmin")), m_IsAPIAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isImpersonator"))))
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isImpersonator")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsImpersonator;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsImpersonator);
-            setIsImpersonator(refVal_setIsImpersonator);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isSiteAdmin")), m_IsSiteAdmin);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isCouponManager"))))
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isCouponManager")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsCouponManager;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsCouponManager);
-            setIsCouponManager(refVal_setIsCouponManager);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("moderatorIds")), m_ModeratorIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("locale"))))
+    if(m_FieldsSet.test(FieldBit_IsImpersonator))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("locale")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setLocale;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLocale);
-            setLocale(refVal_setLocale);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isImpersonator")), m_IsImpersonator);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency"))))
+    if(m_FieldsSet.test(FieldBit_IsCouponManager))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<DigestEmailFrequency> refVal_setDigestEmailFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDigestEmailFrequency);
-            setDigestEmailFrequency(refVal_setDigestEmailFrequency);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isCouponManager")), m_IsCouponManager);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency"))))
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setNotificationFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNotificationFrequency);
-            setNotificationFrequency(refVal_setNotificationFrequency);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("locale")), m_Locale);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("adminNotificationFrequency"))))
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("adminNotificationFrequency")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAdminNotificationFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAdminNotificationFrequency);
-            setAdminNotificationFrequency(refVal_setAdminNotificationFrequency);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("digestEmailFrequency")), m_DigestEmailFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("agentApprovalNotificationFrequency"))))
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("agentApprovalNotificationFrequency")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<ImportedAgentApprovalNotificationFrequency> refVal_setAgentApprovalNotificationFrequency;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAgentApprovalNotificationFrequency);
-            setAgentApprovalNotificationFrequency(refVal_setAgentApprovalNotificationFrequency);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("notificationFrequency")), m_NotificationFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastTenantNotificationSentDate"))))
+    if(m_FieldsSet.test(FieldBit_AdminNotificationFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastTenantNotificationSentDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setLastTenantNotificationSentDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastTenantNotificationSentDate);
-            setLastTenantNotificationSentDate(refVal_setLastTenantNotificationSentDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("adminNotificationFrequency")), m_AdminNotificationFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastReplyNotificationSentDate"))))
+    if(m_FieldsSet.test(FieldBit_AgentApprovalNotificationFrequency))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastReplyNotificationSentDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setLastReplyNotificationSentDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastReplyNotificationSentDate);
-            setLastReplyNotificationSentDate(refVal_setLastReplyNotificationSentDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("agentApprovalNotificationFrequency")), m_AgentApprovalNotificationFrequency);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("ignoredAddToMySiteMessages"))))
+    if(m_FieldsSet.test(FieldBit_LastTenantNotificationSentDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("ignoredAddToMySiteMessages")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIgnoredAddToMySiteMessages;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIgnoredAddToMySiteMessages);
-            setIgnoredAddToMySiteMessages(refVal_setIgnoredAddToMySiteMessages);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastTenantNotificationSentDate")), m_LastTenantNotificationSentDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("lastLoginDate"))))
+    if(m_FieldsSet.test(FieldBit_LastReplyNotificationSentDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("lastLoginDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setLastLoginDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setLastLoginDate);
-            setLastLoginDate(refVal_setLastLoginDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastReplyNotificationSentDate")), m_LastReplyNotificationSentDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_IgnoredAddToMySiteMessages))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("ignoredAddToMySiteMessages")), m_IgnoredAddToMySiteMessages);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate"))))
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsProfileActivityPrivate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileActivityPrivate);
-            setIsProfileActivityPrivate(refVal_setIsProfileActivityPrivate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("lastLoginDate")), m_LastLoginDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsProfileCommentsPrivate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileCommentsPrivate);
-            setIsProfileCommentsPrivate(refVal_setIsProfileCommentsPrivate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled"))))
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsProfileDMDisabled;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsProfileDMDisabled);
-            setIsProfileDMDisabled(refVal_setIsProfileDMDisabled);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isProfileActivityPrivate")), m_IsProfileActivityPrivate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("profileCommentApprovalMode"))))
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("profileCommentApprovalMode")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setProfileCommentApprovalMode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setProfileCommentApprovalMode);
-            setProfileCommentApprovalMode(refVal_setProfileCommentApprovalMode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isProfileCommentsPrivate")), m_IsProfileCommentsPrivate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("karma"))))
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("karma")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setKarma;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setKarma);
-            setKarma(refVal_setKarma);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isProfileDMDisabled")), m_IsProfileDMDisabled);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("passwordHash"))))
+    if(m_FieldsSet.test(FieldBit_ProfileCommentApprovalMode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("passwordHash")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPasswordHash;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPasswordHash);
-            setPasswordHash(refVal_setPasswordHash);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("profileCommentApprovalMode")), m_ProfileCommentApprovalMode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("averageTicketAckTimeMS"))))
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("averageTicketAckTimeMS")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAverageTicketAckTimeMS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAverageTicketAckTimeMS);
-            setAverageTicketAckTimeMS(refVal_setAverageTicketAckTimeMS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("karma")), m_Karma);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers"))))
+    if(m_FieldsSet.test(FieldBit_PasswordHash))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasBlockedUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasBlockedUsers);
-            setHasBlockedUsers(refVal_setHasBlockedUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("passwordHash")), m_PasswordHash);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("bio"))))
+    if(m_FieldsSet.test(FieldBit_AverageTicketAckTimeMS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("bio")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBio;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBio);
-            setBio(refVal_setBio);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("averageTicketAckTimeMS")), m_AverageTicketAckTimeMS);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("headerBackgroundSrc"))))
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("headerBackgroundSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setHeaderBackgroundSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHeaderBackgroundSrc);
-            setHeaderBackgroundSrc(refVal_setHeaderBackgroundSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")), m_HasBlockedUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("countryCode"))))
+    if(m_FieldsSet.test(FieldBit_Bio))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("countryCode")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCountryCode;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCountryCode);
-            setCountryCode(refVal_setCountryCode);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("bio")), m_Bio);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("countryFlag"))))
+    if(m_FieldsSet.test(FieldBit_HeaderBackgroundSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("countryFlag")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCountryFlag;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCountryFlag);
-            setCountryFlag(refVal_setCountryFlag);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("headerBackgroundSrc")), m_HeaderBackgroundSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("socialLinks"))))
+    if(m_FieldsSet.test(FieldBit_CountryCode))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("socialLinks")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setSocialLinks;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSocialLinks);
-            setSocialLinks(refVal_setSocialLinks);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("countryCode")), m_CountryCode);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasTwoFactor"))))
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasTwoFactor")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasTwoFactor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasTwoFactor);
-            setHasTwoFactor(refVal_setHasTwoFactor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("countryFlag")), m_CountryFlag);
+    }
+    if(m_FieldsSet.test(FieldBit_SocialLinks))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("socialLinks")), m_SocialLinks);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed"))))
+    if(m_FieldsSet.test(FieldBit_HasTwoFactor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasTwoFactor")), m_HasTwoFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isEmailSuppressed")), m_IsEmailSuppressed);
+    }
+}
+
+bool User::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setIsEmailSuppressed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsEmailSuppressed);
-            setIsEmailSuppressed(refVal_setIsEmailSuppressed);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            {
+                utility::string_t refVal_setWebsiteUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setWebsiteUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWebsiteUrl(refVal_setWebsiteUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pendingEmail")):
+            {
+                utility::string_t refVal_setPendingEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setPendingEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPendingEmail(refVal_setPendingEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("backupEmail")):
+            {
+                utility::string_t refVal_setBackupEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setBackupEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBackupEmail(refVal_setBackupEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pendingBackupEmail")):
+            {
+                utility::string_t refVal_setPendingBackupEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setPendingBackupEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPendingBackupEmail(refVal_setPendingBackupEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("signUpDate")):
+            {
+                int64_t refVal_setSignUpDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setSignUpDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSignUpDate(refVal_setSignUpDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromUrlId")):
+            {
+                utility::string_t refVal_setCreatedFromUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedFromUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedFromUrlId(refVal_setCreatedFromUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromTenantId")):
+            {
+                utility::string_t refVal_setCreatedFromTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedFromTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedFromTenantId(refVal_setCreatedFromTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdFromIpHashed")):
+            {
+                utility::string_t refVal_setCreatedFromIpHashed;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedFromIpHashed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedFromIpHashed(refVal_setCreatedFromIpHashed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("verified")):
+            {
+                bool refVal_setVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVerified(refVal_setVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("loginId")):
+            {
+                utility::string_t refVal_setLoginId;
+                if(!ModelBase::readBinary(reader, field, refVal_setLoginId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLoginId(refVal_setLoginId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("loginIdDate")):
+            {
+                int64_t refVal_setLoginIdDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setLoginIdDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLoginIdDate(refVal_setLoginIdDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("loginCount")):
+            {
+                int32_t refVal_setLoginCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setLoginCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLoginCount(refVal_setLoginCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedInNotifications")):
+            {
+                bool refVal_setOptedInNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedInNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedInNotifications(refVal_setOptedInNotifications);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedInTenantNotifications")):
+            {
+                bool refVal_setOptedInTenantNotifications;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedInTenantNotifications))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedInTenantNotifications(refVal_setOptedInTenantNotifications);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hideAccountCode")):
+            {
+                bool refVal_setHideAccountCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setHideAccountCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHideAccountCode(refVal_setHideAccountCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isFastCommentsHelpRequestAdmin")):
+            {
+                bool refVal_setIsFastCommentsHelpRequestAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsFastCommentsHelpRequestAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsFastCommentsHelpRequestAdmin(refVal_setIsFastCommentsHelpRequestAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isHelpRequestAdmin")):
+            {
+                bool refVal_setIsHelpRequestAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsHelpRequestAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsHelpRequestAdmin(refVal_setIsHelpRequestAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAccountOwner")):
+            {
+                bool refVal_setIsAccountOwner;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAccountOwner))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAccountOwner(refVal_setIsAccountOwner);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAdminAdmin")):
+            {
+                bool refVal_setIsAdminAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAdminAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAdminAdmin(refVal_setIsAdminAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isBillingAdmin")):
+            {
+                bool refVal_setIsBillingAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsBillingAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsBillingAdmin(refVal_setIsBillingAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAnalyticsAdmin")):
+            {
+                bool refVal_setIsAnalyticsAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAnalyticsAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAnalyticsAdmin(refVal_setIsAnalyticsAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isCustomizationAdmin")):
+            {
+                bool refVal_setIsCustomizationAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsCustomizationAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsCustomizationAdmin(refVal_setIsCustomizationAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isManageDataAdmin")):
+            {
+                bool refVal_setIsManageDataAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsManageDataAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsManageDataAdmin(refVal_setIsManageDataAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isCommentModeratorAdmin")):
+            {
+                bool refVal_setIsCommentModeratorAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsCommentModeratorAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsCommentModeratorAdmin(refVal_setIsCommentModeratorAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAPIAdmin")):
+            {
+                bool refVal_setIsAPIAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAPIAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAPIAdmin(refVal_setIsAPIAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isSiteAdmin")):
+            {
+                bool refVal_setIsSiteAdmin;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsSiteAdmin))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsSiteAdmin(refVal_setIsSiteAdmin);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("moderatorIds")):
+            {
+                std::vector<utility::string_t> refVal_setModeratorIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setModeratorIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModeratorIds(refVal_setModeratorIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isImpersonator")):
+            {
+                bool refVal_setIsImpersonator;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsImpersonator))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsImpersonator(refVal_setIsImpersonator);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isCouponManager")):
+            {
+                bool refVal_setIsCouponManager;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsCouponManager))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsCouponManager(refVal_setIsCouponManager);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("locale")):
+            {
+                utility::string_t refVal_setLocale;
+                if(!ModelBase::readBinary(reader, field, refVal_setLocale))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLocale(refVal_setLocale);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("digestEmailFrequency")):
+            {
+                std::shared_ptr<DigestEmailFrequency> refVal_setDigestEmailFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setDigestEmailFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDigestEmailFrequency(refVal_setDigestEmailFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("notificationFrequency")):
+            {
+                double refVal_setNotificationFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setNotificationFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNotificationFrequency(refVal_setNotificationFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("adminNotificationFrequency")):
+            {
+                double refVal_setAdminNotificationFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setAdminNotificationFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAdminNotificationFrequency(refVal_setAdminNotificationFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("agentApprovalNotificationFrequency")):
+            {
+                std::shared_ptr<ImportedAgentApprovalNotificationFrequency> refVal_setAgentApprovalNotificationFrequency;
+                if(!ModelBase::readBinary(reader, field, refVal_setAgentApprovalNotificationFrequency))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAgentApprovalNotificationFrequency(refVal_setAgentApprovalNotificationFrequency);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastTenantNotificationSentDate")):
+            {
+                utility::datetime refVal_setLastTenantNotificationSentDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastTenantNotificationSentDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastTenantNotificationSentDate(refVal_setLastTenantNotificationSentDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastReplyNotificationSentDate")):
+            {
+                utility::datetime refVal_setLastReplyNotificationSentDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastReplyNotificationSentDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastReplyNotificationSentDate(refVal_setLastReplyNotificationSentDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("ignoredAddToMySiteMessages")):
+            {
+                bool refVal_setIgnoredAddToMySiteMessages;
+                if(!ModelBase::readBinary(reader, field, refVal_setIgnoredAddToMySiteMessages))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIgnoredAddToMySiteMessages(refVal_setIgnoredAddToMySiteMessages);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("lastLoginDate")):
+            {
+                utility::datetime refVal_setLastLoginDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setLastLoginDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setLastLoginDate(refVal_setLastLoginDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileActivityPrivate")):
+            {
+                bool refVal_setIsProfileActivityPrivate;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsProfileActivityPrivate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsProfileActivityPrivate(refVal_setIsProfileActivityPrivate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileCommentsPrivate")):
+            {
+                bool refVal_setIsProfileCommentsPrivate;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsProfileCommentsPrivate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsProfileCommentsPrivate(refVal_setIsProfileCommentsPrivate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isProfileDMDisabled")):
+            {
+                bool refVal_setIsProfileDMDisabled;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsProfileDMDisabled))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsProfileDMDisabled(refVal_setIsProfileDMDisabled);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("profileCommentApprovalMode")):
+            {
+                double refVal_setProfileCommentApprovalMode;
+                if(!ModelBase::readBinary(reader, field, refVal_setProfileCommentApprovalMode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setProfileCommentApprovalMode(refVal_setProfileCommentApprovalMode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("karma")):
+            {
+                double refVal_setKarma;
+                if(!ModelBase::readBinary(reader, field, refVal_setKarma))
+                {
+                    ok = false;
+                    continue;
+                }
+                setKarma(refVal_setKarma);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("passwordHash")):
+            {
+                utility::string_t refVal_setPasswordHash;
+                if(!ModelBase::readBinary(reader, field, refVal_setPasswordHash))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPasswordHash(refVal_setPasswordHash);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("averageTicketAckTimeMS")):
+            {
+                double refVal_setAverageTicketAckTimeMS;
+                if(!ModelBase::readBinary(reader, field, refVal_setAverageTicketAckTimeMS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAverageTicketAckTimeMS(refVal_setAverageTicketAckTimeMS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")):
+            {
+                bool refVal_setHasBlockedUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasBlockedUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasBlockedUsers(refVal_setHasBlockedUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("bio")):
+            {
+                utility::string_t refVal_setBio;
+                if(!ModelBase::readBinary(reader, field, refVal_setBio))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBio(refVal_setBio);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("headerBackgroundSrc")):
+            {
+                utility::string_t refVal_setHeaderBackgroundSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setHeaderBackgroundSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHeaderBackgroundSrc(refVal_setHeaderBackgroundSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("countryCode")):
+            {
+                utility::string_t refVal_setCountryCode;
+                if(!ModelBase::readBinary(reader, field, refVal_setCountryCode))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCountryCode(refVal_setCountryCode);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("countryFlag")):
+            {
+                utility::string_t refVal_setCountryFlag;
+                if(!ModelBase::readBinary(reader, field, refVal_setCountryFlag))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCountryFlag(refVal_setCountryFlag);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("socialLinks")):
+            {
+                std::vector<utility::string_t> refVal_setSocialLinks;
+                if(!ModelBase::readBinary(reader, field, refVal_setSocialLinks))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSocialLinks(refVal_setSocialLinks);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasTwoFactor")):
+            {
+                bool refVal_setHasTwoFactor;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasTwoFactor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasTwoFactor(refVal_setHasTwoFactor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isEmailSuppressed")):
+            {
+                bool refVal_setIsEmailSuppressed;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsEmailSuppressed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsEmailSuppressed(refVal_setIsEmailSuppressed);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void User::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -1113,243 +2464,243 @@ void User::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utili
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantId.has_value())
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_WebsiteUrl.has_value())
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("websiteUrl")), m_WebsiteUrl.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("websiteUrl")), m_WebsiteUrl));
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_PendingEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingEmail))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pendingEmail")), m_PendingEmail));
     }
-    if(m_BackupEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_BackupEmail))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("backupEmail")), m_BackupEmail));
     }
-    if(m_PendingBackupEmailIsSet)
+    if(m_FieldsSet.test(FieldBit_PendingBackupEmail))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pendingBackupEmail")), m_PendingBackupEmail));
     }
-    if(m_SignUpDateIsSet)
+    if(m_FieldsSet.test(FieldBit_SignUpDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("signUpDate")), m_SignUpDate));
     }
-    if(m_CreatedFromUrlId.has_value())
+    if(m_FieldsSet.test(FieldBit_CreatedFromUrlId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId")), m_CreatedFromUrlId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromUrlId")), m_CreatedFromUrlId));
     }
-    if(m_CreatedFromTenantId.has_value())
+    if(m_FieldsSet.test(FieldBit_CreatedFromTenantId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId")), m_CreatedFromTenantId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromTenantId")), m_CreatedFromTenantId));
     }
-    if(m_CreatedFromIpHashedIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedFromIpHashed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdFromIpHashed")), m_CreatedFromIpHashed));
     }
-    if(m_VerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_Verified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("verified")), m_Verified));
     }
-    if(m_LoginIdIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("loginId")), m_LoginId));
     }
-    if(m_LoginIdDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginIdDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("loginIdDate")), m_LoginIdDate));
     }
-    if(m_LoginCountIsSet)
+    if(m_FieldsSet.test(FieldBit_LoginCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("loginCount")), m_LoginCount));
     }
-    if(m_OptedInNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInNotifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedInNotifications")), m_OptedInNotifications));
     }
-    if(m_OptedInTenantNotificationsIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedInTenantNotifications))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedInTenantNotifications")), m_OptedInTenantNotifications));
     }
-    if(m_HideAccountCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_HideAccountCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hideAccountCode")), m_HideAccountCode));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_IsFastCommentsHelpRequestAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsFastCommentsHelpRequestAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isFastCommentsHelpRequestAdmin")), m_IsFastCommentsHelpRequestAdmin));
     }
-    if(m_IsHelpRequestAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsHelpRequestAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isHelpRequestAdmin")), m_IsHelpRequestAdmin));
     }
-    if(m_IsAccountOwnerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAccountOwner))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAccountOwner")), m_IsAccountOwner));
     }
-    if(m_IsAdminAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAdminAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAdminAdmin")), m_IsAdminAdmin));
     }
-    if(m_IsBillingAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsBillingAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isBillingAdmin")), m_IsBillingAdmin));
     }
-    if(m_IsAnalyticsAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAnalyticsAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAnalyticsAdmin")), m_IsAnalyticsAdmin));
     }
-    if(m_IsCustomizationAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCustomizationAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isCustomizationAdmin")), m_IsCustomizationAdmin));
     }
-    if(m_IsManageDataAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsManageDataAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isManageDataAdmin")), m_IsManageDataAdmin));
     }
-    if(m_IsCommentModeratorAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isCommentModeratorAdmin")), m_IsCommentModeratorAdmin));
     }
-    if(m_IsAPIAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAPIAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAPIAdmin")), m_IsAPIAdmin));
     }
-    if(m_IsSiteAdminIsSet)
+    if(m_FieldsSet.test(FieldBit_IsSiteAdmin))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isSiteAdmin")), m_IsSiteAdmin));
     }
-    if(m_ModeratorIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_ModeratorIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("moderatorIds")), m_ModeratorIds));
     }
-    if(m_IsImpersonatorIsSet)
+    if(m_FieldsSet.test(FieldBit_IsImpersonator))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isImpersonator")), m_IsImpersonator));
     }
-    if(m_IsCouponManagerIsSet)
+    if(m_FieldsSet.test(FieldBit_IsCouponManager))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isCouponManager")), m_IsCouponManager));
     }
-    if(m_LocaleIsSet)
+    if(m_FieldsSet.test(FieldBit_Locale))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("locale")), m_Locale));
     }
-    if(m_DigestEmailFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_DigestEmailFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("digestEmailFrequency")), m_DigestEmailFrequency));
     }
-    if(m_NotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_NotificationFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("notificationFrequency")), m_NotificationFrequency));
     }
-    if(m_AdminNotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_AdminNotificationFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("adminNotificationFrequency")), m_AdminNotificationFrequency));
     }
-    if(m_AgentApprovalNotificationFrequencyIsSet)
+    if(m_FieldsSet.test(FieldBit_AgentApprovalNotificationFrequency))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("agentApprovalNotificationFrequency")), m_AgentApprovalNotificationFrequency));
     }
-    if(m_LastTenantNotificationSentDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastTenantNotificationSentDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastTenantNotificationSentDate")), m_LastTenantNotificationSentDate));
     }
-    if(m_LastReplyNotificationSentDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastReplyNotificationSentDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastReplyNotificationSentDate")), m_LastReplyNotificationSentDate));
     }
-    if(m_IgnoredAddToMySiteMessagesIsSet)
+    if(m_FieldsSet.test(FieldBit_IgnoredAddToMySiteMessages))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("ignoredAddToMySiteMessages")), m_IgnoredAddToMySiteMessages));
     }
-    if(m_LastLoginDateIsSet)
+    if(m_FieldsSet.test(FieldBit_LastLoginDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("lastLoginDate")), m_LastLoginDate));
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_IsProfileActivityPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileActivityPrivate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isProfileActivityPrivate")), m_IsProfileActivityPrivate));
     }
-    if(m_IsProfileCommentsPrivateIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isProfileCommentsPrivate")), m_IsProfileCommentsPrivate));
     }
-    if(m_IsProfileDMDisabledIsSet)
+    if(m_FieldsSet.test(FieldBit_IsProfileDMDisabled))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isProfileDMDisabled")), m_IsProfileDMDisabled));
     }
-    if(m_ProfileCommentApprovalModeIsSet)
+    if(m_FieldsSet.test(FieldBit_ProfileCommentApprovalMode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("profileCommentApprovalMode")), m_ProfileCommentApprovalMode));
     }
-    if(m_KarmaIsSet)
+    if(m_FieldsSet.test(FieldBit_Karma))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("karma")), m_Karma));
     }
-    if(m_PasswordHashIsSet)
+    if(m_FieldsSet.test(FieldBit_PasswordHash))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("passwordHash")), m_PasswordHash));
     }
-    if(m_AverageTicketAckTimeMS.has_value())
+    if(m_FieldsSet.test(FieldBit_AverageTicketAckTimeMS))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("averageTicketAckTimeMS")), m_AverageTicketAckTimeMS.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("averageTicketAckTimeMS")), m_AverageTicketAckTimeMS));
     }
-    if(m_HasBlockedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers")), m_HasBlockedUsers));
     }
-    if(m_BioIsSet)
+    if(m_FieldsSet.test(FieldBit_Bio))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("bio")), m_Bio));
     }
-    if(m_HeaderBackgroundSrcIsSet)
+    if(m_FieldsSet.test(FieldBit_HeaderBackgroundSrc))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("headerBackgroundSrc")), m_HeaderBackgroundSrc));
     }
-    if(m_CountryCodeIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryCode))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("countryCode")), m_CountryCode));
     }
-    if(m_CountryFlagIsSet)
+    if(m_FieldsSet.test(FieldBit_CountryFlag))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("countryFlag")), m_CountryFlag));
     }
-    if(m_SocialLinksIsSet)
+    if(m_FieldsSet.test(FieldBit_SocialLinks))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("socialLinks")), m_SocialLinks));
     }
-    if(m_HasTwoFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_HasTwoFactor))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasTwoFactor")), m_HasTwoFactor));
     }
-    if(m_IsEmailSuppressedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsEmailSuppressed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isEmailSuppressed")), m_IsEmailSuppressed));
     }
@@ -1737,37 +3088,38 @@ utility::string_t User::getId() const
 void User::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool User::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void User::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t User::getTenantId() const
 {
-    return m_TenantId.get();
+    return m_TenantId;
 }
 
 
 void User::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool User::tenantIdIsSet() const
 {
-    return m_TenantId.has_value();
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void User::unsetTenantId()
 {
-    m_TenantId.reset();
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t User::getUsername() const
 {
@@ -1778,17 +3130,17 @@ utility::string_t User::getUsername() const
 void User::setUsername(const utility::string_t& value)
 {
     m_Username = value;
-    m_UsernameIsSet = true;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool User::usernameIsSet() const
 {
-    return m_UsernameIsSet;
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void User::unsetUsername()
 {
-    m_UsernameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t User::getDisplayName() const
 {
@@ -1799,57 +3151,59 @@ utility::string_t User::getDisplayName() const
 void User::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool User::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void User::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::string_t User::getWebsiteUrl() const
 {
-    return m_WebsiteUrl.get();
+    return m_WebsiteUrl;
 }
 
 
 void User::setWebsiteUrl(const utility::string_t& value)
 {
     m_WebsiteUrl = value;
+    m_FieldsSet.set(FieldBit_WebsiteUrl);
 }
 
 bool User::websiteUrlIsSet() const
 {
-    return m_WebsiteUrl.has_value();
+    return m_FieldsSet.test(FieldBit_WebsiteUrl);
 }
 
 void User::unsetWebsiteUrl()
 {
-    m_WebsiteUrl.reset();
+    m_FieldsSet.reset(FieldBit_WebsiteUrl);
 }
 utility::string_t User::getEmail() const
 {
-    return m_Email.get();
+    return m_Email;
 }
 
 
 void User::setEmail(const utility::string_t& value)
 {
     m_Email = value;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool User::emailIsSet() const
 {
-    return m_Email.has_value();
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void User::unsetEmail()
 {
-    m_Email.reset();
+    m_FieldsSet.reset(FieldBit_Email);
 }
 utility::string_t User::getPendingEmail() const
 {
@@ -1860,17 +3214,17 @@ utility::string_t User::getPendingEmail() const
 void User::setPendingEmail(const utility::string_t& value)
 {
     m_PendingEmail = value;
-    m_PendingEmailIsSet = true;
+    m_FieldsSet.set(FieldBit_PendingEmail);
 }
 
 bool User::pendingEmailIsSet() const
 {
-    return m_PendingEmailIsSet;
+    return m_FieldsSet.test(FieldBit_PendingEmail);
 }
 
 void User::unsetPendingEmail()
 {
-    m_PendingEmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_PendingEmail);
 }
 utility::string_t User::getBackupEmail() const
 {
@@ -1881,17 +3235,17 @@ utility::string_t User::getBackupEmail() const
 void User::setBackupEmail(const utility::string_t& value)
 {
     m_BackupEmail = value;
-    m_BackupEmailIsSet = true;
+    m_FieldsSet.set(FieldBit_BackupEmail);
 }
 
 bool User::backupEmailIsSet() const
 {
-    return m_BackupEmailIsSet;
+    return m_FieldsSet.test(FieldBit_BackupEmail);
 }
 
 void User::unsetBackupEmail()
 {
-    m_BackupEmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_BackupEmail);
 }
 utility::string_t User::getPendingBackupEmail() const
 {
@@ -1902,17 +3256,17 @@ utility::string_t User::getPendingBackupEmail() const
 void User::setPendingBackupEmail(const utility::string_t& value)
 {
     m_PendingBackupEmail = value;
-    m_PendingBackupEmailIsSet = true;
+    m_FieldsSet.set(FieldBit_PendingBackupEmail);
 }
 
 bool User::pendingBackupEmailIsSet() const
 {
-    return m_PendingBackupEmailIsSet;
+    return m_FieldsSet.test(FieldBit_PendingBackupEmail);
 }
 
 void User::unsetPendingBackupEmail()
 {
-    m_PendingBackupEmailIsSet = false;
+    m_FieldsSet.reset(FieldBit_PendingBackupEmail);
 }
 int64_t User::getSignUpDate() const
 {
@@ -1922,57 +3276,59 @@ int64_t User::getSignUpDate() const
 void User::setSignUpDate(int64_t value)
 {
     m_SignUpDate = value;
-    m_SignUpDateIsSet = true;
+    m_FieldsSet.set(FieldBit_SignUpDate);
 }
 
 bool User::signUpDateIsSet() const
 {
-    return m_SignUpDateIsSet;
+    return m_FieldsSet.test(FieldBit_SignUpDate);
 }
 
 void User::unsetSignUpDate()
 {
-    m_SignUpDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_SignUpDate);
 }
 utility::string_t User::getCreatedFromUrlId() const
 {
-    return m_CreatedFromUrlId.get();
+    return m_CreatedFromUrlId;
 }
 
 
 void User::setCreatedFromUrlId(const utility::string_t& value)
 {
     m_CreatedFromUrlId = value;
+    m_FieldsSet.set(FieldBit_CreatedFromUrlId);
 }
 
 bool User::createdFromUrlIdIsSet() const
 {
-    return m_CreatedFromUrlId.has_value();
+    return m_FieldsSet.test(FieldBit_CreatedFromUrlId);
 }
 
 void User::unsetCreatedFromUrlId()
 {
-    m_CreatedFromUrlId.reset();
+    m_FieldsSet.reset(FieldBit_CreatedFromUrlId);
 }
 utility::string_t User::getCreatedFromTenantId() const
 {
-    return m_CreatedFromTenantId.get();
+    return m_CreatedFromTenantId;
 }
 
 
 void User::setCreatedFromTenantId(const utility::string_t& value)
 {
     m_CreatedFromTenantId = value;
+    m_FieldsSet.set(FieldBit_CreatedFromTenantId);
 }
 
 bool User::createdFromTenantIdIsSet() const
 {
-    return m_CreatedFromTenantId.has_value();
+    return m_FieldsSet.test(FieldBit_CreatedFromTenantId);
 }
 
 void User::unsetCreatedFromTenantId()
 {
-    m_CreatedFromTenantId.reset();
+    m_FieldsSet.reset(FieldBit_CreatedFromTenantId);
 }
 utility::string_t User::getCreatedFromIpHashed() const
 {
@@ -1983,17 +3339,17 @@ utility::string_t User::getCreatedFromIpHashed() const
 void User::setCreatedFromIpHashed(const utility::string_t& value)
 {
     m_CreatedFromIpHashed = value;
-    m_CreatedFromIpHashedIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedFromIpHashed);
 }
 
 bool User::createdFromIpHashedIsSet() const
 {
-    return m_CreatedFromIpHashedIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedFromIpHashed);
 }
 
 void User::unsetCreatedFromIpHashed()
 {
-    m_CreatedFromIpHashedIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedFromIpHashed);
 }
 bool User::isVerified() const
 {
@@ -2003,17 +3359,17 @@ bool User::isVerified() const
 void User::setVerified(bool value)
 {
     m_Verified = value;
-    m_VerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_Verified);
 }
 
 bool User::verifiedIsSet() const
 {
-    return m_VerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_Verified);
 }
 
 void User::unsetVerified()
 {
-    m_VerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Verified);
 }
 utility::string_t User::getLoginId() const
 {
@@ -2024,17 +3380,17 @@ utility::string_t User::getLoginId() const
 void User::setLoginId(const utility::string_t& value)
 {
     m_LoginId = value;
-    m_LoginIdIsSet = true;
+    m_FieldsSet.set(FieldBit_LoginId);
 }
 
 bool User::loginIdIsSet() const
 {
-    return m_LoginIdIsSet;
+    return m_FieldsSet.test(FieldBit_LoginId);
 }
 
 void User::unsetLoginId()
 {
-    m_LoginIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_LoginId);
 }
 int64_t User::getLoginIdDate() const
 {
@@ -2044,17 +3400,17 @@ int64_t User::getLoginIdDate() const
 void User::setLoginIdDate(int64_t value)
 {
     m_LoginIdDate = value;
-    m_LoginIdDateIsSet = true;
+    m_FieldsSet.set(FieldBit_LoginIdDate);
 }
 
 bool User::loginIdDateIsSet() const
 {
-    return m_LoginIdDateIsSet;
+    return m_FieldsSet.test(FieldBit_LoginIdDate);
 }
 
 void User::unsetLoginIdDate()
 {
-    m_LoginIdDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_LoginIdDate);
 }
 int32_t User::getLoginCount() const
 {
@@ -2064,17 +3420,17 @@ int32_t User::getLoginCount() const
 void User::setLoginCount(int32_t value)
 {
     m_LoginCount = value;
-    m_LoginCountIsSet = true;
+    m_FieldsSet.set(FieldBit_LoginCount);
 }
 
 bool User::loginCountIsSet() const
 {
-    return m_LoginCountIsSet;
+    return m_FieldsSet.test(FieldBit_LoginCount);
 }
 
 void User::unsetLoginCount()
 {
-    m_LoginCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_LoginCount);
 }
 bool User::isOptedInNotifications() const
 {
@@ -2084,17 +3440,17 @@ bool User::isOptedInNotifications() const
 void User::setOptedInNotifications(bool value)
 {
     m_OptedInNotifications = value;
-    m_OptedInNotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedInNotifications);
 }
 
 bool User::optedInNotificationsIsSet() const
 {
-    return m_OptedInNotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_OptedInNotifications);
 }
 
 void User::unsetOptedInNotifications()
 {
-    m_OptedInNotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedInNotifications);
 }
 bool User::isOptedInTenantNotifications() const
 {
@@ -2104,17 +3460,17 @@ bool User::isOptedInTenantNotifications() const
 void User::setOptedInTenantNotifications(bool value)
 {
     m_OptedInTenantNotifications = value;
-    m_OptedInTenantNotificationsIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedInTenantNotifications);
 }
 
 bool User::optedInTenantNotificationsIsSet() const
 {
-    return m_OptedInTenantNotificationsIsSet;
+    return m_FieldsSet.test(FieldBit_OptedInTenantNotifications);
 }
 
 void User::unsetOptedInTenantNotifications()
 {
-    m_OptedInTenantNotificationsIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedInTenantNotifications);
 }
 bool User::isHideAccountCode() const
 {
@@ -2124,37 +3480,38 @@ bool User::isHideAccountCode() const
 void User::setHideAccountCode(bool value)
 {
     m_HideAccountCode = value;
-    m_HideAccountCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_HideAccountCode);
 }
 
 bool User::hideAccountCodeIsSet() const
 {
-    return m_HideAccountCodeIsSet;
+    return m_FieldsSet.test(FieldBit_HideAccountCode);
 }
 
 void User::unsetHideAccountCode()
 {
-    m_HideAccountCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_HideAccountCode);
 }
 utility::string_t User::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void User::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool User::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void User::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 bool User::isIsFastCommentsHelpRequestAdmin() const
 {
@@ -2164,17 +3521,17 @@ bool User::isIsFastCommentsHelpRequestAdmin() const
 void User::setIsFastCommentsHelpRequestAdmin(bool value)
 {
     m_IsFastCommentsHelpRequestAdmin = value;
-    m_IsFastCommentsHelpRequestAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsFastCommentsHelpRequestAdmin);
 }
 
 bool User::isFastCommentsHelpRequestAdminIsSet() const
 {
-    return m_IsFastCommentsHelpRequestAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsFastCommentsHelpRequestAdmin);
 }
 
 void User::unsetIsFastCommentsHelpRequestAdmin()
 {
-    m_IsFastCommentsHelpRequestAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsFastCommentsHelpRequestAdmin);
 }
 bool User::isIsHelpRequestAdmin() const
 {
@@ -2184,17 +3541,17 @@ bool User::isIsHelpRequestAdmin() const
 void User::setIsHelpRequestAdmin(bool value)
 {
     m_IsHelpRequestAdmin = value;
-    m_IsHelpRequestAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsHelpRequestAdmin);
 }
 
 bool User::isHelpRequestAdminIsSet() const
 {
-    return m_IsHelpRequestAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsHelpRequestAdmin);
 }
 
 void User::unsetIsHelpRequestAdmin()
 {
-    m_IsHelpRequestAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsHelpRequestAdmin);
 }
 bool User::isIsAccountOwner() const
 {
@@ -2204,17 +3561,17 @@ bool User::isIsAccountOwner() const
 void User::setIsAccountOwner(bool value)
 {
     m_IsAccountOwner = value;
-    m_IsAccountOwnerIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAccountOwner);
 }
 
 bool User::isAccountOwnerIsSet() const
 {
-    return m_IsAccountOwnerIsSet;
+    return m_FieldsSet.test(FieldBit_IsAccountOwner);
 }
 
 void User::unsetIsAccountOwner()
 {
-    m_IsAccountOwnerIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAccountOwner);
 }
 bool User::isIsAdminAdmin() const
 {
@@ -2224,17 +3581,17 @@ bool User::isIsAdminAdmin() const
 void User::setIsAdminAdmin(bool value)
 {
     m_IsAdminAdmin = value;
-    m_IsAdminAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAdminAdmin);
 }
 
 bool User::isAdminAdminIsSet() const
 {
-    return m_IsAdminAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsAdminAdmin);
 }
 
 void User::unsetIsAdminAdmin()
 {
-    m_IsAdminAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAdminAdmin);
 }
 bool User::isIsBillingAdmin() const
 {
@@ -2244,17 +3601,17 @@ bool User::isIsBillingAdmin() const
 void User::setIsBillingAdmin(bool value)
 {
     m_IsBillingAdmin = value;
-    m_IsBillingAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsBillingAdmin);
 }
 
 bool User::isBillingAdminIsSet() const
 {
-    return m_IsBillingAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsBillingAdmin);
 }
 
 void User::unsetIsBillingAdmin()
 {
-    m_IsBillingAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsBillingAdmin);
 }
 bool User::isIsAnalyticsAdmin() const
 {
@@ -2264,17 +3621,17 @@ bool User::isIsAnalyticsAdmin() const
 void User::setIsAnalyticsAdmin(bool value)
 {
     m_IsAnalyticsAdmin = value;
-    m_IsAnalyticsAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAnalyticsAdmin);
 }
 
 bool User::isAnalyticsAdminIsSet() const
 {
-    return m_IsAnalyticsAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsAnalyticsAdmin);
 }
 
 void User::unsetIsAnalyticsAdmin()
 {
-    m_IsAnalyticsAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAnalyticsAdmin);
 }
 bool User::isIsCustomizationAdmin() const
 {
@@ -2284,17 +3641,17 @@ bool User::isIsCustomizationAdmin() const
 void User::setIsCustomizationAdmin(bool value)
 {
     m_IsCustomizationAdmin = value;
-    m_IsCustomizationAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsCustomizationAdmin);
 }
 
 bool User::isCustomizationAdminIsSet() const
 {
-    return m_IsCustomizationAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsCustomizationAdmin);
 }
 
 void User::unsetIsCustomizationAdmin()
 {
-    m_IsCustomizationAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsCustomizationAdmin);
 }
 bool User::isIsManageDataAdmin() const
 {
@@ -2304,17 +3661,17 @@ bool User::isIsManageDataAdmin() const
 void User::setIsManageDataAdmin(bool value)
 {
     m_IsManageDataAdmin = value;
-    m_IsManageDataAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsManageDataAdmin);
 }
 
 bool User::isManageDataAdminIsSet() const
 {
-    return m_IsManageDataAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsManageDataAdmin);
 }
 
 void User::unsetIsManageDataAdmin()
 {
-    m_IsManageDataAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsManageDataAdmin);
 }
 bool User::isIsCommentModeratorAdmin() const
 {
@@ -2324,17 +3681,17 @@ bool User::isIsCommentModeratorAdmin() const
 void User::setIsCommentModeratorAdmin(bool value)
 {
     m_IsCommentModeratorAdmin = value;
-    m_IsCommentModeratorAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsCommentModeratorAdmin);
 }
 
 bool User::isCommentModeratorAdminIsSet() const
 {
-    return m_IsCommentModeratorAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsCommentModeratorAdmin);
 }
 
 void User::unsetIsCommentModeratorAdmin()
 {
-    m_IsCommentModeratorAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsCommentModeratorAdmin);
 }
 bool User::isIsAPIAdmin() const
 {
@@ -2344,17 +3701,17 @@ bool User::isIsAPIAdmin() const
 void User::setIsAPIAdmin(bool value)
 {
     m_IsAPIAdmin = value;
-    m_IsAPIAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAPIAdmin);
 }
 
 bool User::isAPIAdminIsSet() const
 {
-    return m_IsAPIAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsAPIAdmin);
 }
 
 void User::unsetIsAPIAdmin()
 {
-    m_IsAPIAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAPIAdmin);
 }
 bool User::isIsSiteAdmin() const
 {
@@ -2364,17 +3721,17 @@ bool User::isIsSiteAdmin() const
 void User::setIsSiteAdmin(bool value)
 {
     m_IsSiteAdmin = value;
-    m_IsSiteAdminIsSet = true;
+    m_FieldsSet.set(FieldBit_IsSiteAdmin);
 }
 
 bool User::isSiteAdminIsSet() const
 {
-    return m_IsSiteAdminIsSet;
+    return m_FieldsSet.test(FieldBit_IsSiteAdmin);
 }
 
 void User::unsetIsSiteAdmin()
 {
-    m_IsSiteAdminIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsSiteAdmin);
 }
 std::vector<utility::string_t> User::getModeratorIds() const
 {
@@ -2385,17 +3742,17 @@ std::vector<utility::string_t> User::getModeratorIds() const
 void User::setModeratorIds(const std::vector<utility::string_t>& value)
 {
     m_ModeratorIds = value;
-    m_ModeratorIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_ModeratorIds);
 }
 
 bool User::moderatorIdsIsSet() const
 {
-    return m_ModeratorIdsIsSet;
+    return m_FieldsSet.test(FieldBit_ModeratorIds);
 }
 
 void User::unsetModeratorIds()
 {
-    m_ModeratorIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModeratorIds);
 }
 bool User::isIsImpersonator() const
 {
@@ -2405,17 +3762,17 @@ bool User::isIsImpersonator() const
 void User::setIsImpersonator(bool value)
 {
     m_IsImpersonator = value;
-    m_IsImpersonatorIsSet = true;
+    m_FieldsSet.set(FieldBit_IsImpersonator);
 }
 
 bool User::isImpersonatorIsSet() const
 {
-    return m_IsImpersonatorIsSet;
+    return m_FieldsSet.test(FieldBit_IsImpersonator);
 }
 
 void User::unsetIsImpersonator()
 {
-    m_IsImpersonatorIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsImpersonator);
 }
 bool User::isIsCouponManager() const
 {
@@ -2425,17 +3782,17 @@ bool User::isIsCouponManager() const
 void User::setIsCouponManager(bool value)
 {
     m_IsCouponManager = value;
-    m_IsCouponManagerIsSet = true;
+    m_FieldsSet.set(FieldBit_IsCouponManager);
 }
 
 bool User::isCouponManagerIsSet() const
 {
-    return m_IsCouponManagerIsSet;
+    return m_FieldsSet.test(FieldBit_IsCouponManager);
 }
 
 void User::unsetIsCouponManager()
 {
-    m_IsCouponManagerIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsCouponManager);
 }
 utility::string_t User::getLocale() const
 {
@@ -2446,17 +3803,17 @@ utility::string_t User::getLocale() const
 void User::setLocale(const utility::string_t& value)
 {
     m_Locale = value;
-    m_LocaleIsSet = true;
+    m_FieldsSet.set(FieldBit_Locale);
 }
 
 bool User::localeIsSet() const
 {
-    return m_LocaleIsSet;
+    return m_FieldsSet.test(FieldBit_Locale);
 }
 
 void User::unsetLocale()
 {
-    m_LocaleIsSet = false;
+    m_FieldsSet.reset(FieldBit_Locale);
 }
 std::shared_ptr<DigestEmailFrequency> User::getDigestEmailFrequency() const
 {
@@ -2467,17 +3824,17 @@ std::shared_ptr<DigestEmailFrequency> User::getDigestEmailFrequency() const
 void User::setDigestEmailFrequency(const std::shared_ptr<DigestEmailFrequency>& value)
 {
     m_DigestEmailFrequency = value;
-    m_DigestEmailFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_DigestEmailFrequency);
 }
 
 bool User::digestEmailFrequencyIsSet() const
 {
-    return m_DigestEmailFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_DigestEmailFrequency);
 }
 
 void User::unsetDigestEmailFrequency()
 {
-    m_DigestEmailFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_DigestEmailFrequency);
 }
 double User::getNotificationFrequency() const
 {
@@ -2487,17 +3844,17 @@ double User::getNotificationFrequency() const
 void User::setNotificationFrequency(double value)
 {
     m_NotificationFrequency = value;
-    m_NotificationFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_NotificationFrequency);
 }
 
 bool User::notificationFrequencyIsSet() const
 {
-    return m_NotificationFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_NotificationFrequency);
 }
 
 void User::unsetNotificationFrequency()
 {
-    m_NotificationFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_NotificationFrequency);
 }
 double User::getAdminNotificationFrequency() const
 {
@@ -2507,17 +3864,17 @@ double User::getAdminNotificationFrequency() const
 void User::setAdminNotificationFrequency(double value)
 {
     m_AdminNotificationFrequency = value;
-    m_AdminNotificationFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_AdminNotificationFrequency);
 }
 
 bool User::adminNotificationFrequencyIsSet() const
 {
-    return m_AdminNotificationFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_AdminNotificationFrequency);
 }
 
 void User::unsetAdminNotificationFrequency()
 {
-    m_AdminNotificationFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_AdminNotificationFrequency);
 }
 std::shared_ptr<ImportedAgentApprovalNotificationFrequency> User::getAgentApprovalNotificationFrequency() const
 {
@@ -2528,17 +3885,17 @@ std::shared_ptr<ImportedAgentApprovalNotificationFrequency> User::getAgentApprov
 void User::setAgentApprovalNotificationFrequency(const std::shared_ptr<ImportedAgentApprovalNotificationFrequency>& value)
 {
     m_AgentApprovalNotificationFrequency = value;
-    m_AgentApprovalNotificationFrequencyIsSet = true;
+    m_FieldsSet.set(FieldBit_AgentApprovalNotificationFrequency);
 }
 
 bool User::agentApprovalNotificationFrequencyIsSet() const
 {
-    return m_AgentApprovalNotificationFrequencyIsSet;
+    return m_FieldsSet.test(FieldBit_AgentApprovalNotificationFrequency);
 }
 
 void User::unsetAgentApprovalNotificationFrequency()
 {
-    m_AgentApprovalNotificationFrequencyIsSet = false;
+    m_FieldsSet.reset(FieldBit_AgentApprovalNotificationFrequency);
 }
 utility::datetime User::getLastTenantNotificationSentDate() const
 {
@@ -2549,17 +3906,17 @@ utility::datetime User::getLastTenantNotificationSentDate() const
 void User::setLastTenantNotificationSentDate(const utility::datetime& value)
 {
     m_LastTenantNotificationSentDate = value;
-    m_LastTenantNotificationSentDateIsSet = true;
+    m_FieldsSet.set(FieldBit_LastTenantNotificationSentDate);
 }
 
 bool User::lastTenantNotificationSentDateIsSet() const
 {
-    return m_LastTenantNotificationSentDateIsSet;
+    return m_FieldsSet.test(FieldBit_LastTenantNotificationSentDate);
 }
 
 void User::unsetLastTenantNotificationSentDate()
 {
-    m_LastTenantNotificationSentDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastTenantNotificationSentDate);
 }
 utility::datetime User::getLastReplyNotificationSentDate() const
 {
@@ -2570,17 +3927,17 @@ utility::datetime User::getLastReplyNotificationSentDate() const
 void User::setLastReplyNotificationSentDate(const utility::datetime& value)
 {
     m_LastReplyNotificationSentDate = value;
-    m_LastReplyNotificationSentDateIsSet = true;
+    m_FieldsSet.set(FieldBit_LastReplyNotificationSentDate);
 }
 
 bool User::lastReplyNotificationSentDateIsSet() const
 {
-    return m_LastReplyNotificationSentDateIsSet;
+    return m_FieldsSet.test(FieldBit_LastReplyNotificationSentDate);
 }
 
 void User::unsetLastReplyNotificationSentDate()
 {
-    m_LastReplyNotificationSentDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastReplyNotificationSentDate);
 }
 bool User::isIgnoredAddToMySiteMessages() const
 {
@@ -2590,17 +3947,17 @@ bool User::isIgnoredAddToMySiteMessages() const
 void User::setIgnoredAddToMySiteMessages(bool value)
 {
     m_IgnoredAddToMySiteMessages = value;
-    m_IgnoredAddToMySiteMessagesIsSet = true;
+    m_FieldsSet.set(FieldBit_IgnoredAddToMySiteMessages);
 }
 
 bool User::ignoredAddToMySiteMessagesIsSet() const
 {
-    return m_IgnoredAddToMySiteMessagesIsSet;
+    return m_FieldsSet.test(FieldBit_IgnoredAddToMySiteMessages);
 }
 
 void User::unsetIgnoredAddToMySiteMessages()
 {
-    m_IgnoredAddToMySiteMessagesIsSet = false;
+    m_FieldsSet.reset(FieldBit_IgnoredAddToMySiteMessages);
 }
 utility::datetime User::getLastLoginDate() const
 {
@@ -2611,17 +3968,17 @@ utility::datetime User::getLastLoginDate() const
 void User::setLastLoginDate(const utility::datetime& value)
 {
     m_LastLoginDate = value;
-    m_LastLoginDateIsSet = true;
+    m_FieldsSet.set(FieldBit_LastLoginDate);
 }
 
 bool User::lastLoginDateIsSet() const
 {
-    return m_LastLoginDateIsSet;
+    return m_FieldsSet.test(FieldBit_LastLoginDate);
 }
 
 void User::unsetLastLoginDate()
 {
-    m_LastLoginDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_LastLoginDate);
 }
 utility::string_t User::getDisplayLabel() const
 {
@@ -2632,17 +3989,17 @@ utility::string_t User::getDisplayLabel() const
 void User::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
-    m_DisplayLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool User::displayLabelIsSet() const
 {
-    return m_DisplayLabelIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void User::unsetDisplayLabel()
 {
-    m_DisplayLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 bool User::isIsProfileActivityPrivate() const
 {
@@ -2652,17 +4009,17 @@ bool User::isIsProfileActivityPrivate() const
 void User::setIsProfileActivityPrivate(bool value)
 {
     m_IsProfileActivityPrivate = value;
-    m_IsProfileActivityPrivateIsSet = true;
+    m_FieldsSet.set(FieldBit_IsProfileActivityPrivate);
 }
 
 bool User::isProfileActivityPrivateIsSet() const
 {
-    return m_IsProfileActivityPrivateIsSet;
+    return m_FieldsSet.test(FieldBit_IsProfileActivityPrivate);
 }
 
 void User::unsetIsProfileActivityPrivate()
 {
-    m_IsProfileActivityPrivateIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsProfileActivityPrivate);
 }
 bool User::isIsProfileCommentsPrivate() const
 {
@@ -2672,17 +4029,17 @@ bool User::isIsProfileCommentsPrivate() const
 void User::setIsProfileCommentsPrivate(bool value)
 {
     m_IsProfileCommentsPrivate = value;
-    m_IsProfileCommentsPrivateIsSet = true;
+    m_FieldsSet.set(FieldBit_IsProfileCommentsPrivate);
 }
 
 bool User::isProfileCommentsPrivateIsSet() const
 {
-    return m_IsProfileCommentsPrivateIsSet;
+    return m_FieldsSet.test(FieldBit_IsProfileCommentsPrivate);
 }
 
 void User::unsetIsProfileCommentsPrivate()
 {
-    m_IsProfileCommentsPrivateIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsProfileCommentsPrivate);
 }
 bool User::isIsProfileDMDisabled() const
 {
@@ -2692,17 +4049,17 @@ bool User::isIsProfileDMDisabled() const
 void User::setIsProfileDMDisabled(bool value)
 {
     m_IsProfileDMDisabled = value;
-    m_IsProfileDMDisabledIsSet = true;
+    m_FieldsSet.set(FieldBit_IsProfileDMDisabled);
 }
 
 bool User::isProfileDMDisabledIsSet() const
 {
-    return m_IsProfileDMDisabledIsSet;
+    return m_FieldsSet.test(FieldBit_IsProfileDMDisabled);
 }
 
 void User::unsetIsProfileDMDisabled()
 {
-    m_IsProfileDMDisabledIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsProfileDMDisabled);
 }
 double User::getProfileCommentApprovalMode() const
 {
@@ -2712,17 +4069,17 @@ double User::getProfileCommentApprovalMode() const
 void User::setProfileCommentApprovalMode(double value)
 {
     m_ProfileCommentApprovalMode = value;
-    m_ProfileCommentApprovalModeIsSet = true;
+    m_FieldsSet.set(FieldBit_ProfileCommentApprovalMode);
 }
 
 bool User::profileCommentApprovalModeIsSet() const
 {
-    return m_ProfileCommentApprovalModeIsSet;
+    return m_FieldsSet.test(FieldBit_ProfileCommentApprovalMode);
 }
 
 void User::unsetProfileCommentApprovalMode()
 {
-    m_ProfileCommentApprovalModeIsSet = false;
+    m_FieldsSet.reset(FieldBit_ProfileCommentApprovalMode);
 }
 double User::getKarma() const
 {
@@ -2732,17 +4089,17 @@ double User::getKarma() const
 void User::setKarma(double value)
 {
     m_Karma = value;
-    m_KarmaIsSet = true;
+    m_FieldsSet.set(FieldBit_Karma);
 }
 
 bool User::karmaIsSet() const
 {
-    return m_KarmaIsSet;
+    return m_FieldsSet.test(FieldBit_Karma);
 }
 
 void User::unsetKarma()
 {
-    m_KarmaIsSet = false;
+    m_FieldsSet.reset(FieldBit_Karma);
 }
 utility::string_t User::getPasswordHash() const
 {
@@ -2753,36 +4110,37 @@ utility::string_t User::getPasswordHash() const
 void User::setPasswordHash(const utility::string_t& value)
 {
     m_PasswordHash = value;
-    m_PasswordHashIsSet = true;
+    m_FieldsSet.set(FieldBit_PasswordHash);
 }
 
 bool User::passwordHashIsSet() const
 {
-    return m_PasswordHashIsSet;
+    return m_FieldsSet.test(FieldBit_PasswordHash);
 }
 
 void User::unsetPasswordHash()
 {
-    m_PasswordHashIsSet = false;
+    m_FieldsSet.reset(FieldBit_PasswordHash);
 }
 double User::getAverageTicketAckTimeMS() const
 {
-    return m_AverageTicketAckTimeMS.get();
+    return m_AverageTicketAckTimeMS;
 }
 
 void User::setAverageTicketAckTimeMS(double value)
 {
     m_AverageTicketAckTimeMS = value;
+    m_FieldsSet.set(FieldBit_AverageTicketAckTimeMS);
 }
 
 bool User::averageTicketAckTimeMSIsSet() const
 {
-    return m_AverageTicketAckTimeMS.has_value();
+    return m_FieldsSet.test(FieldBit_AverageTicketAckTimeMS);
 }
 
 void User::unsetAverageTicketAckTimeMS()
 {
-    m_AverageTicketAckTimeMS.reset();
+    m_FieldsSet.reset(FieldBit_AverageTicketAckTimeMS);
 }
 bool User::isHasBlockedUsers() const
 {
@@ -2792,17 +4150,17 @@ bool User::isHasBlockedUsers() const
 void User::setHasBlockedUsers(bool value)
 {
     m_HasBlockedUsers = value;
-    m_HasBlockedUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_HasBlockedUsers);
 }
 
 bool User::hasBlockedUsersIsSet() const
 {
-    return m_HasBlockedUsersIsSet;
+    return m_FieldsSet.test(FieldBit_HasBlockedUsers);
 }
 
 void User::unsetHasBlockedUsers()
 {
-    m_HasBlockedUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasBlockedUsers);
 }
 utility::string_t User::getBio() const
 {
@@ -2813,17 +4171,17 @@ utility::string_t User::getBio() const
 void User::setBio(const utility::string_t& value)
 {
     m_Bio = value;
-    m_BioIsSet = true;
+    m_FieldsSet.set(FieldBit_Bio);
 }
 
 bool User::bioIsSet() const
 {
-    return m_BioIsSet;
+    return m_FieldsSet.test(FieldBit_Bio);
 }
 
 void User::unsetBio()
 {
-    m_BioIsSet = false;
+    m_FieldsSet.reset(FieldBit_Bio);
 }
 utility::string_t User::getHeaderBackgroundSrc() const
 {
@@ -2834,17 +4192,17 @@ utility::string_t User::getHeaderBackgroundSrc() const
 void User::setHeaderBackgroundSrc(const utility::string_t& value)
 {
     m_HeaderBackgroundSrc = value;
-    m_HeaderBackgroundSrcIsSet = true;
+    m_FieldsSet.set(FieldBit_HeaderBackgroundSrc);
 }
 
 bool User::headerBackgroundSrcIsSet() const
 {
-    return m_HeaderBackgroundSrcIsSet;
+    return m_FieldsSet.test(FieldBit_HeaderBackgroundSrc);
 }
 
 void User::unsetHeaderBackgroundSrc()
 {
-    m_HeaderBackgroundSrcIsSet = false;
+    m_FieldsSet.reset(FieldBit_HeaderBackgroundSrc);
 }
 utility::string_t User::getCountryCode() const
 {
@@ -2855,17 +4213,17 @@ utility::string_t User::getCountryCode() const
 void User::setCountryCode(const utility::string_t& value)
 {
     m_CountryCode = value;
-    m_CountryCodeIsSet = true;
+    m_FieldsSet.set(FieldBit_CountryCode);
 }
 
 bool User::countryCodeIsSet() const
 {
-    return m_CountryCodeIsSet;
+    return m_FieldsSet.test(FieldBit_CountryCode);
 }
 
 void User::unsetCountryCode()
 {
-    m_CountryCodeIsSet = false;
+    m_FieldsSet.reset(FieldBit_CountryCode);
 }
 utility::string_t User::getCountryFlag() const
 {
@@ -2876,17 +4234,17 @@ utility::string_t User::getCountryFlag() const
 void User::setCountryFlag(const utility::string_t& value)
 {
     m_CountryFlag = value;
-    m_CountryFlagIsSet = true;
+    m_FieldsSet.set(FieldBit_CountryFlag);
 }
 
 bool User::countryFlagIsSet() const
 {
-    return m_CountryFlagIsSet;
+    return m_FieldsSet.test(FieldBit_CountryFlag);
 }
 
 void User::unsetCountryFlag()
 {
-    m_CountryFlagIsSet = false;
+    m_FieldsSet.reset(FieldBit_CountryFlag);
 }
 std::vector<utility::string_t> User::getSocialLinks() const
 {
@@ -2897,17 +4255,17 @@ std::vector<utility::string_t> User::getSocialLinks() const
 void User::setSocialLinks(const std::vector<utility::string_t>& value)
 {
     m_SocialLinks = value;
-    m_SocialLinksIsSet = true;
+    m_FieldsSet.set(FieldBit_SocialLinks);
 }
 
 bool User::socialLinksIsSet() const
 {
-    return m_SocialLinksIsSet;
+    return m_FieldsSet.test(FieldBit_SocialLinks);
 }
 
 void User::unsetSocialLinks()
 {
-    m_SocialLinksIsSet = false;
+    m_FieldsSet.reset(FieldBit_SocialLinks);
 }
 bool User::isHasTwoFactor() const
 {
@@ -2917,17 +4275,17 @@ bool User::isHasTwoFactor() const
 void User::setHasTwoFactor(bool value)
 {
     m_HasTwoFactor = value;
-    m_HasTwoFactorIsSet = true;
+    m_FieldsSet.set(FieldBit_HasTwoFactor);
 }
 
 bool User::hasTwoFactorIsSet() const
 {
-    return m_HasTwoFactorIsSet;
+    return m_FieldsSet.test(FieldBit_HasTwoFactor);
 }
 
 void User::unsetHasTwoFactor()
 {
-    m_HasTwoFactorIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasTwoFactor);
 }
 bool User::isIsEmailSuppressed() const
 {
@@ -2937,17 +4295,17 @@ bool User::isIsEmailSuppressed() const
 void User::setIsEmailSuppressed(bool value)
 {
     m_IsEmailSuppressed = value;
-    m_IsEmailSuppressedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsEmailSuppressed);
 }
 
 bool User::isEmailSuppressedIsSet() const
 {
-    return m_IsEmailSuppressedIsSet;
+    return m_FieldsSet.test(FieldBit_IsEmailSuppressed);
 }
 
 void User::unsetIsEmailSuppressed()
 {
-    m_IsEmailSuppressedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsEmailSuppressed);
 }
 
 }
@@ -20,32 +20,11 @@ namespace model {
 
 UserBadge::UserBadge()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_BadgeId = utility::conversions::to_string_t("");
-    m_BadgeIdIsSet = false;
-    m_FromTenantId = utility::conversions::to_string_t("");
-    m_FromTenantIdIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
     m_Type = 0;
-    m_TypeIsSet = false;
     m_Threshold = 0L;
-    m_ThresholdIsSet = false;
-    m_Description = utility::conversions::to_string_t("");
-    m_DescriptionIsSet = false;
-    m_DisplayLabel = utility::conversions::to_string_t("");
-    m_DisplayLabelIsSet = false;
     m_VeteranUserThresholdMillis = 0L;
-    m_VeteranUserThresholdMillisIsSet = false;
     m_DisplayedOnComments = false;
-    m_DisplayedOnCommentsIsSet = false;
-    m_ReceivedAt = utility::datetime();
-    m_ReceivedAtIsSet = false;
     m_Order = 0;
-    m_OrderIsSet = false;
 }
 
 UserBadge::~UserBadge()
@@ -60,318 +39,796 @@ void UserBadge::validate()
 web::json::value UserBadge::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_BadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badgeId"))] = ModelBase::toJson(m_BadgeId);
     }
-    if(m_FromTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromTenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromTenantId"))] = ModelBase::toJson(m_FromTenantId);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_ThresholdIsSet)
+    if(m_FieldsSet.test(FieldBit_Threshold))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("threshold"))] = ModelBase::toJson(m_Threshold);
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("description"))] = ModelBase::toJson(m_Description);
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_DisplaySrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("displaySrc"))] = ModelBase::toJson(m_DisplaySrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("displaySrc"))] = ModelBase::toJson(m_DisplaySrc);
     }
-    if(m_BackgroundColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))] = ModelBase::toJson(m_BackgroundColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))] = ModelBase::toJson(m_BackgroundColor);
     }
-    if(m_BorderColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("borderColor"))] = ModelBase::toJson(m_BorderColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("borderColor"))] = ModelBase::toJson(m_BorderColor);
     }
-    if(m_TextColor.has_value())
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("textColor"))] = ModelBase::toJson(m_TextColor.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("textColor"))] = ModelBase::toJson(m_TextColor);
     }
-    if(m_CssClass.has_value())
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("cssClass"))] = ModelBase::toJson(m_CssClass.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("cssClass"))] = ModelBase::toJson(m_CssClass);
     }
-    if(m_VeteranUserThresholdMillisIsSet)
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis"))] = ModelBase::toJson(m_VeteranUserThresholdMillis);
     }
-    if(m_DisplayedOnCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayedOnComments"))] = ModelBase::toJson(m_DisplayedOnComments);
     }
-    if(m_ReceivedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_ReceivedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("receivedAt"))] = ModelBase::toJson(m_ReceivedAt);
     }
-    if(m_OrderIsSet)
+    if(m_FieldsSet.test(FieldBit_Order))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("order"))] = ModelBase::toJson(m_Order);
     }
-    if(m_UrlId.has_value())
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
 
     return val;
 }
 
+void UserBadge::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_BadgeId))
+    {
+        
+        writer.key(_XPLATSTR("badgeId"));
+        ModelBase::writeJson(writer, m_BadgeId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromTenantId))
+    {
+        
+        writer.key(_XPLATSTR("fromTenantId"));
+        ModelBase::writeJson(writer, m_FromTenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_Threshold))
+    {
+        
+        writer.key(_XPLATSTR("threshold"));
+        ModelBase::writeJson(writer, m_Threshold);
+    }
+    if(m_FieldsSet.test(FieldBit_Description))
+    {
+        
+        writer.key(_XPLATSTR("description"));
+        ModelBase::writeJson(writer, m_Description);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
+    {
+        
+        writer.key(_XPLATSTR("displaySrc"));
+        ModelBase::writeJson(writer, m_DisplaySrc);
+    }
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
+    {
+        
+        writer.key(_XPLATSTR("backgroundColor"));
+        ModelBase::writeJson(writer, m_BackgroundColor);
+    }
+    if(m_FieldsSet.test(FieldBit_BorderColor))
+    {
+        
+        writer.key(_XPLATSTR("borderColor"));
+        ModelBase::writeJson(writer, m_BorderColor);
+    }
+    if(m_FieldsSet.test(FieldBit_TextColor))
+    {
+        
+        writer.key(_XPLATSTR("textColor"));
+        ModelBase::writeJson(writer, m_TextColor);
+    }
+    if(m_FieldsSet.test(FieldBit_CssClass))
+    {
+        
+        writer.key(_XPLATSTR("cssClass"));
+        ModelBase::writeJson(writer, m_CssClass);
+    }
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
+    {
+        
+        writer.key(_XPLATSTR("veteranUserThresholdMillis"));
+        ModelBase::writeJson(writer, m_VeteranUserThresholdMillis);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
+    {
+        
+        writer.key(_XPLATSTR("displayedOnComments"));
+        ModelBase::writeJson(writer, m_DisplayedOnComments);
+    }
+    if(m_FieldsSet.test(FieldBit_ReceivedAt))
+    {
+        
+        writer.key(_XPLATSTR("receivedAt"));
+        ModelBase::writeJson(writer, m_ReceivedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Order))
+    {
+        
+        writer.key(_XPLATSTR("order"));
+        ModelBase::writeJson(writer, m_Order);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+
+    writer.endObject();
+}
+
 bool UserBadge::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badgeId")):
+            if(field.first == _XPLATSTR("badgeId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBadgeId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadgeId);
+                    setBadgeId(refVal_setBadgeId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromTenantId")):
+            if(field.first == _XPLATSTR("fromTenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromTenantId);
+                    setFromTenantId(refVal_setFromTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("threshold")):
+            if(field.first == _XPLATSTR("threshold"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setThreshold;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setThreshold);
+                    setThreshold(refVal_setThreshold);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            if(field.first == _XPLATSTR("description"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDescription;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
+                    setDescription(refVal_setDescription);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displaySrc")):
+            if(field.first == _XPLATSTR("displaySrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplaySrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplaySrc);
+                    setDisplaySrc(refVal_setDisplaySrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("backgroundColor")):
+            if(field.first == _XPLATSTR("backgroundColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBackgroundColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBackgroundColor);
+                    setBackgroundColor(refVal_setBackgroundColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("borderColor")):
+            if(field.first == _XPLATSTR("borderColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setBorderColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBorderColor);
+                    setBorderColor(refVal_setBorderColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("textColor")):
+            if(field.first == _XPLATSTR("textColor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTextColor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTextColor);
+                    setTextColor(refVal_setTextColor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("cssClass")):
+            if(field.first == _XPLATSTR("cssClass"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCssClass;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCssClass);
+                    setCssClass(refVal_setCssClass);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("veteranUserThresholdMillis")):
+            if(field.first == _XPLATSTR("veteranUserThresholdMillis"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setVeteranUserThresholdMillis;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVeteranUserThresholdMillis);
+                    setVeteranUserThresholdMillis(refVal_setVeteranUserThresholdMillis);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayedOnComments")):
+            if(field.first == _XPLATSTR("displayedOnComments"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setDisplayedOnComments;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayedOnComments);
+                    setDisplayedOnComments(refVal_setDisplayedOnComments);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("receivedAt")):
+            if(field.first == _XPLATSTR("receivedAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setReceivedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReceivedAt);
+                    setReceivedAt(refVal_setReceivedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("order")):
+            if(field.first == _XPLATSTR("order"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int32_t refVal_setOrder;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOrder);
+                    setOrder(refVal_setOrder);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badgeId"))))
+    return ok;
+}
+
+void UserBadge::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badgeId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBadgeId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadgeId);
-            setBadgeId(refVal_setBadgeId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromTenantId"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromTenantId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromTenantId);
-            setFromTenantId(refVal_setFromTenantId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badgeId")), m_BadgeId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_FromTenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromTenantId")), m_FromTenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("threshold"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("threshold")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setThreshold;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setThreshold);
-            setThreshold(refVal_setThreshold);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("description"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("description")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDescription;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDescription);
-            setDescription(refVal_setDescription);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_Threshold))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("threshold")), m_Threshold);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displaySrc"))))
+    if(m_FieldsSet.test(FieldBit_Description))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displaySrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplaySrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplaySrc);
-            setDisplaySrc(refVal_setDisplaySrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("description")), m_Description);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("backgroundColor"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("backgroundColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBackgroundColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBackgroundColor);
-            setBackgroundColor(refVal_setBackgroundColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("borderColor"))))
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("borderColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setBorderColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBorderColor);
-            setBorderColor(refVal_setBorderColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displaySrc")), m_DisplaySrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("textColor"))))
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("textColor")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setTextColor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTextColor);
-            setTextColor(refVal_setTextColor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("backgroundColor")), m_BackgroundColor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("cssClass"))))
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("cssClass")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCssClass;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCssClass);
-            setCssClass(refVal_setCssClass);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("borderColor")), m_BorderColor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis"))))
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setVeteranUserThresholdMillis;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVeteranUserThresholdMillis);
-            setVeteranUserThresholdMillis(refVal_setVeteranUserThresholdMillis);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("textColor")), m_TextColor);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayedOnComments"))))
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayedOnComments")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setDisplayedOnComments;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayedOnComments);
-            setDisplayedOnComments(refVal_setDisplayedOnComments);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("cssClass")), m_CssClass);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("receivedAt"))))
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("receivedAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setReceivedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReceivedAt);
-            setReceivedAt(refVal_setReceivedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("veteranUserThresholdMillis")), m_VeteranUserThresholdMillis);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("order"))))
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("order")));
-        if(!fieldValue.is_null())
-        {
-            int32_t refVal_setOrder;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOrder);
-            setOrder(refVal_setOrder);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayedOnComments")), m_DisplayedOnComments);
+    }
+    if(m_FieldsSet.test(FieldBit_ReceivedAt))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("receivedAt")), m_ReceivedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Order))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("order")), m_Order);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
+    }
+}
+
+bool UserBadge::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badgeId")):
+            {
+                utility::string_t refVal_setBadgeId;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadgeId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadgeId(refVal_setBadgeId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromTenantId")):
+            {
+                utility::string_t refVal_setFromTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromTenantId(refVal_setFromTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                int32_t refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("threshold")):
+            {
+                int64_t refVal_setThreshold;
+                if(!ModelBase::readBinary(reader, field, refVal_setThreshold))
+                {
+                    ok = false;
+                    continue;
+                }
+                setThreshold(refVal_setThreshold);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("description")):
+            {
+                utility::string_t refVal_setDescription;
+                if(!ModelBase::readBinary(reader, field, refVal_setDescription))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDescription(refVal_setDescription);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displaySrc")):
+            {
+                utility::string_t refVal_setDisplaySrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplaySrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplaySrc(refVal_setDisplaySrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("backgroundColor")):
+            {
+                utility::string_t refVal_setBackgroundColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setBackgroundColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBackgroundColor(refVal_setBackgroundColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("borderColor")):
+            {
+                utility::string_t refVal_setBorderColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setBorderColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBorderColor(refVal_setBorderColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("textColor")):
+            {
+                utility::string_t refVal_setTextColor;
+                if(!ModelBase::readBinary(reader, field, refVal_setTextColor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTextColor(refVal_setTextColor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("cssClass")):
+            {
+                utility::string_t refVal_setCssClass;
+                if(!ModelBase::readBinary(reader, field, refVal_setCssClass))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCssClass(refVal_setCssClass);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("veteranUserThresholdMillis")):
+            {
+                int64_t refVal_setVeteranUserThresholdMillis;
+                if(!ModelBase::readBinary(reader, field, refVal_setVeteranUserThresholdMillis))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVeteranUserThresholdMillis(refVal_setVeteranUserThresholdMillis);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayedOnComments")):
+            {
+                bool refVal_setDisplayedOnComments;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayedOnComments))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayedOnComments(refVal_setDisplayedOnComments);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("receivedAt")):
+            {
+                utility::datetime refVal_setReceivedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setReceivedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReceivedAt(refVal_setReceivedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("order")):
+            {
+                int32_t refVal_setOrder;
+                if(!ModelBase::readBinary(reader, field, refVal_setOrder))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOrder(refVal_setOrder);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserBadge::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -381,81 +838,81 @@ void UserBadge::toMultipart(std::shared_ptr<MultipartFormData> multipart, const
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_BadgeIdIsSet)
+    if(m_FieldsSet.test(FieldBit_BadgeId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badgeId")), m_BadgeId));
     }
-    if(m_FromTenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FromTenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromTenantId")), m_FromTenantId));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_ThresholdIsSet)
+    if(m_FieldsSet.test(FieldBit_Threshold))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("threshold")), m_Threshold));
     }
-    if(m_DescriptionIsSet)
+    if(m_FieldsSet.test(FieldBit_Description))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("description")), m_Description));
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_DisplaySrc.has_value())
+    if(m_FieldsSet.test(FieldBit_DisplaySrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displaySrc")), m_DisplaySrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displaySrc")), m_DisplaySrc));
     }
-    if(m_BackgroundColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BackgroundColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("backgroundColor")), m_BackgroundColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("backgroundColor")), m_BackgroundColor));
     }
-    if(m_BorderColor.has_value())
+    if(m_FieldsSet.test(FieldBit_BorderColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("borderColor")), m_BorderColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("borderColor")), m_BorderColor));
     }
-    if(m_TextColor.has_value())
+    if(m_FieldsSet.test(FieldBit_TextColor))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textColor")), m_TextColor.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("textColor")), m_TextColor));
     }
-    if(m_CssClass.has_value())
+    if(m_FieldsSet.test(FieldBit_CssClass))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("cssClass")), m_CssClass.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("cssClass")), m_CssClass));
     }
-    if(m_VeteranUserThresholdMillisIsSet)
+    if(m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("veteranUserThresholdMillis")), m_VeteranUserThresholdMillis));
     }
-    if(m_DisplayedOnCommentsIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayedOnComments))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayedOnComments")), m_DisplayedOnComments));
     }
-    if(m_ReceivedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_ReceivedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("receivedAt")), m_ReceivedAt));
     }
-    if(m_OrderIsSet)
+    if(m_FieldsSet.test(FieldBit_Order))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("order")), m_Order));
     }
-    if(m_UrlId.has_value())
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
 }
 
@@ -595,17 +1052,17 @@ utility::string_t UserBadge::getId() const
 void UserBadge::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool UserBadge::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void UserBadge::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t UserBadge::getUserId() const
 {
@@ -616,17 +1073,17 @@ utility::string_t UserBadge::getUserId() const
 void UserBadge::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool UserBadge::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void UserBadge::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t UserBadge::getBadgeId() const
 {
@@ -637,17 +1094,17 @@ utility::string_t UserBadge::getBadgeId() const
 void UserBadge::setBadgeId(const utility::string_t& value)
 {
     m_BadgeId = value;
-    m_BadgeIdIsSet = true;
+    m_FieldsSet.set(FieldBit_BadgeId);
 }
 
 bool UserBadge::badgeIdIsSet() const
 {
-    return m_BadgeIdIsSet;
+    return m_FieldsSet.test(FieldBit_BadgeId);
 }
 
 void UserBadge::unsetBadgeId()
 {
-    m_BadgeIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_BadgeId);
 }
 utility::string_t UserBadge::getFromTenantId() const
 {
@@ -658,17 +1115,17 @@ utility::string_t UserBadge::getFromTenantId() const
 void UserBadge::setFromTenantId(const utility::string_t& value)
 {
     m_FromTenantId = value;
-    m_FromTenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_FromTenantId);
 }
 
 bool UserBadge::fromTenantIdIsSet() const
 {
-    return m_FromTenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_FromTenantId);
 }
 
 void UserBadge::unsetFromTenantId()
 {
-    m_FromTenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromTenantId);
 }
 utility::datetime UserBadge::getCreatedAt() const
 {
@@ -679,17 +1136,17 @@ utility::datetime UserBadge::getCreatedAt() const
 void UserBadge::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool UserBadge::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void UserBadge::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 int32_t UserBadge::getType() const
 {
@@ -699,17 +1156,17 @@ int32_t UserBadge::getType() const
 void UserBadge::setType(int32_t value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool UserBadge::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void UserBadge::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 int64_t UserBadge::getThreshold() const
 {
@@ -719,17 +1176,17 @@ int64_t UserBadge::getThreshold() const
 void UserBadge::setThreshold(int64_t value)
 {
     m_Threshold = value;
-    m_ThresholdIsSet = true;
+    m_FieldsSet.set(FieldBit_Threshold);
 }
 
 bool UserBadge::thresholdIsSet() const
 {
-    return m_ThresholdIsSet;
+    return m_FieldsSet.test(FieldBit_Threshold);
 }
 
 void UserBadge::unsetThreshold()
 {
-    m_ThresholdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Threshold);
 }
 utility::string_t UserBadge::getDescription() const
 {
@@ -740,17 +1197,17 @@ utility::string_t UserBadge::getDescription() const
 void UserBadge::setDescription(const utility::string_t& value)
 {
     m_Description = value;
-    m_DescriptionIsSet = true;
+    m_FieldsSet.set(FieldBit_Description);
 }
 
 bool UserBadge::descriptionIsSet() const
 {
-    return m_DescriptionIsSet;
+    return m_FieldsSet.test(FieldBit_Description);
 }
 
 void UserBadge::unsetDescription()
 {
-    m_DescriptionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Description);
 }
 utility::string_t UserBadge::getDisplayLabel() const
 {
@@ -761,117 +1218,122 @@ utility::string_t UserBadge::getDisplayLabel() const
 void UserBadge::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
-    m_DisplayLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool UserBadge::displayLabelIsSet() const
 {
-    return m_DisplayLabelIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void UserBadge::unsetDisplayLabel()
 {
-    m_DisplayLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 utility::string_t UserBadge::getDisplaySrc() const
 {
-    return m_DisplaySrc.get();
+    return m_DisplaySrc;
 }
 
 
 void UserBadge::setDisplaySrc(const utility::string_t& value)
 {
     m_DisplaySrc = value;
+    m_FieldsSet.set(FieldBit_DisplaySrc);
 }
 
 bool UserBadge::displaySrcIsSet() const
 {
-    return m_DisplaySrc.has_value();
+    return m_FieldsSet.test(FieldBit_DisplaySrc);
 }
 
 void UserBadge::unsetDisplaySrc()
 {
-    m_DisplaySrc.reset();
+    m_FieldsSet.reset(FieldBit_DisplaySrc);
 }
 utility::string_t UserBadge::getBackgroundColor() const
 {
-    return m_BackgroundColor.get();
+    return m_BackgroundColor;
 }
 
 
 void UserBadge::setBackgroundColor(const utility::string_t& value)
 {
     m_BackgroundColor = value;
+    m_FieldsSet.set(FieldBit_BackgroundColor);
 }
 
 bool UserBadge::backgroundColorIsSet() const
 {
-    return m_BackgroundColor.has_value();
+    return m_FieldsSet.test(FieldBit_BackgroundColor);
 }
 
 void UserBadge::unsetBackgroundColor()
 {
-    m_BackgroundColor.reset();
+    m_FieldsSet.reset(FieldBit_BackgroundColor);
 }
 utility::string_t UserBadge::getBorderColor() const
 {
-    return m_BorderColor.get();
+    return m_BorderColor;
 }
 
 
 void UserBadge::setBorderColor(const utility::string_t& value)
 {
     m_BorderColor = value;
+    m_FieldsSet.set(FieldBit_BorderColor);
 }
 
 bool UserBadge::borderColorIsSet() const
 {
-    return m_BorderColor.has_value();
+    return m_FieldsSet.test(FieldBit_BorderColor);
 }
 
 void UserBadge::unsetBorderColor()
 {
-    m_BorderColor.reset();
+    m_FieldsSet.reset(FieldBit_BorderColor);
 }
 utility::string_t UserBadge::getTextColor() const
 {
-    return m_TextColor.get();
+    return m_TextColor;
 }
 
 
 void UserBadge::setTextColor(const utility::string_t& value)
 {
     m_TextColor = value;
+    m_FieldsSet.set(FieldBit_TextColor);
 }
 
 bool UserBadge::textColorIsSet() const
 {
-    return m_TextColor.has_value();
+    return m_FieldsSet.test(FieldBit_TextColor);
 }
 
 void UserBadge::unsetTextColor()
 {
-    m_TextColor.reset();
+    m_FieldsSet.reset(FieldBit_TextColor);
 }
 utility::string_t UserBadge::getCssClass() const
 {
-    return m_CssClass.get();
+    return m_CssClass;
 }
 
 
 void UserBadge::setCssClass(const utility::string_t& value)
 {
     m_CssClass = value;
+    m_FieldsSet.set(FieldBit_CssClass);
 }
 
 bool UserBadge::cssClassIsSet() const
 {
-    return m_CssClass.has_value();
+    return m_FieldsSet.test(FieldBit_CssClass);
 }
 
 void UserBadge::unsetCssClass()
 {
-    m_CssClass.reset();
+    m_FieldsSet.reset(FieldBit_CssClass);
 }
 int64_t UserBadge::getVeteranUserThresholdMillis() const
 {
@@ -881,17 +1343,17 @@ int64_t UserBadge::getVeteranUserThresholdMillis() const
 void UserBadge::setVeteranUserThresholdMillis(int64_t value)
 {
     m_VeteranUserThresholdMillis = value;
-    m_VeteranUserThresholdMillisIsSet = true;
+    m_FieldsSet.set(FieldBit_VeteranUserThresholdMillis);
 }
 
 bool UserBadge::veteranUserThresholdMillisIsSet() const
 {
-    return m_VeteranUserThresholdMillisIsSet;
+    return m_FieldsSet.test(FieldBit_VeteranUserThresholdMillis);
 }
 
 void UserBadge::unsetVeteranUserThresholdMillis()
 {
-    m_VeteranUserThresholdMillisIsSet = false;
+    m_FieldsSet.reset(FieldBit_VeteranUserThresholdMillis);
 }
 bool UserBadge::isDisplayedOnComments() const
 {
@@ -901,17 +1363,17 @@ bool UserBadge::isDisplayedOnComments() const
 void UserBadge::setDisplayedOnComments(bool value)
 {
     m_DisplayedOnComments = value;
-    m_DisplayedOnCommentsIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayedOnComments);
 }
 
 bool UserBadge::displayedOnCommentsIsSet() const
 {
-    return m_DisplayedOnCommentsIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayedOnComments);
 }
 
 void UserBadge::unsetDisplayedOnComments()
 {
-    m_DisplayedOnCommentsIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayedOnComments);
 }
 utility::datetime UserBadge::getReceivedAt() const
 {
@@ -922,17 +1384,17 @@ utility::datetime UserBadge::getReceivedAt() const
 void UserBadge::setReceivedAt(const utility::datetime& value)
 {
     m_ReceivedAt = value;
-    m_ReceivedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_ReceivedAt);
 }
 
 bool UserBadge::receivedAtIsSet() const
 {
-    return m_ReceivedAtIsSet;
+    return m_FieldsSet.test(FieldBit_ReceivedAt);
 }
 
 void UserBadge::unsetReceivedAt()
 {
-    m_ReceivedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_ReceivedAt);
 }
 int32_t UserBadge::getOrder() const
 {
@@ -942,37 +1404,38 @@ int32_t UserBadge::getOrder() const
 void UserBadge::setOrder(int32_t value)
 {
     m_Order = value;
-    m_OrderIsSet = true;
+    m_FieldsSet.set(FieldBit_Order);
 }
 
 bool UserBadge::orderIsSet() const
 {
-    return m_OrderIsSet;
+    return m_FieldsSet.test(FieldBit_Order);
 }
 
 void UserBadge::unsetOrder()
 {
-    m_OrderIsSet = false;
+    m_FieldsSet.reset(FieldBit_Order);
 }
 utility::string_t UserBadge::getUrlId() const
 {
-    return m_UrlId.get();
+    return m_UrlId;
 }
 
 
 void UserBadge::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool UserBadge::urlIdIsSet() const
 {
-    return m_UrlId.has_value();
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void UserBadge::unsetUrlId()
 {
-    m_UrlId.reset();
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 
 }
@@ -20,23 +20,8 @@ namespace model {
 
 UserBadgeProgress::UserBadgeProgress()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_UserId = utility::conversions::to_string_t("");
-    m_UserIdIsSet = false;
-    m_FirstCommentId = utility::conversions::to_string_t("");
-    m_FirstCommentIdIsSet = false;
-    m_FirstCommentDate = utility::datetime();
-    m_FirstCommentDateIsSet = false;
     m_AutoTrustFactor = 0.0;
-    m_AutoTrustFactorIsSet = false;
     m_ManualTrustFactor = 0.0;
-    m_ManualTrustFactorIsSet = false;
-    m_ProgressIsSet = false;
-    m_TosAcceptedAt = utility::datetime();
-    m_TosAcceptedAtIsSet = false;
 }
 
 UserBadgeProgress::~UserBadgeProgress()
@@ -51,47 +36,47 @@ void UserBadgeProgress::validate()
 web::json::value UserBadgeProgress::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_FirstCommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FirstCommentId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("firstCommentId"))] = ModelBase::toJson(m_FirstCommentId);
     }
-    if(m_FirstCommentDateIsSet)
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("firstCommentDate"))] = ModelBase::toJson(m_FirstCommentDate);
     }
-    if(m_AutoTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor"))] = ModelBase::toJson(m_AutoTrustFactor);
     }
-    if(m_ManualTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor"))] = ModelBase::toJson(m_ManualTrustFactor);
     }
-    if(m_ProgressIsSet)
+    if(m_FieldsSet.test(FieldBit_Progress))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("progress"))] = ModelBase::toJson(m_Progress);
     }
-    if(m_TosAcceptedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt"))] = ModelBase::toJson(m_TosAcceptedAt);
@@ -100,109 +85,357 @@ web::json::value UserBadgeProgress::toJson() const
     return val;
 }
 
+void UserBadgeProgress::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FirstCommentId))
+    {
+        
+        writer.key(_XPLATSTR("firstCommentId"));
+        ModelBase::writeJson(writer, m_FirstCommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
+    {
+        
+        writer.key(_XPLATSTR("firstCommentDate"));
+        ModelBase::writeJson(writer, m_FirstCommentDate);
+    }
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
+    {
+        
+        writer.key(_XPLATSTR("autoTrustFactor"));
+        ModelBase::writeJson(writer, m_AutoTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
+    {
+        
+        writer.key(_XPLATSTR("manualTrustFactor"));
+        ModelBase::writeJson(writer, m_ManualTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_Progress))
+    {
+        
+        writer.key(_XPLATSTR("progress"));
+        ModelBase::writeJson(writer, m_Progress);
+    }
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
+    {
+        
+        writer.key(_XPLATSTR("tosAcceptedAt"));
+        ModelBase::writeJson(writer, m_TosAcceptedAt);
+    }
+
+    writer.endObject();
+}
+
 bool UserBadgeProgress::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("firstCommentId")):
+            if(field.first == _XPLATSTR("firstCommentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFirstCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFirstCommentId);
+                    setFirstCommentId(refVal_setFirstCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("firstCommentDate")):
+            if(field.first == _XPLATSTR("firstCommentDate"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setFirstCommentDate;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFirstCommentDate);
+                    setFirstCommentDate(refVal_setFirstCommentDate);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("autoTrustFactor")):
+            if(field.first == _XPLATSTR("autoTrustFactor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setAutoTrustFactor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAutoTrustFactor);
+                    setAutoTrustFactor(refVal_setAutoTrustFactor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("manualTrustFactor")):
+            if(field.first == _XPLATSTR("manualTrustFactor"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    double refVal_setManualTrustFactor;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setManualTrustFactor);
+                    setManualTrustFactor(refVal_setManualTrustFactor);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("progress")):
+            if(field.first == _XPLATSTR("progress"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, double> refVal_setProgress;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setProgress);
+                    setProgress(refVal_setProgress);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tosAcceptedAt")):
+            if(field.first == _XPLATSTR("tosAcceptedAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setTosAcceptedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTosAcceptedAt);
+                    setTosAcceptedAt(refVal_setTosAcceptedAt);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    return ok;
+}
+
+void UserBadgeProgress::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("firstCommentId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("firstCommentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFirstCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFirstCommentId);
-            setFirstCommentId(refVal_setFirstCommentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("firstCommentDate"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("firstCommentDate")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setFirstCommentDate;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFirstCommentDate);
-            setFirstCommentDate(refVal_setFirstCommentDate);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor"))))
+    if(m_FieldsSet.test(FieldBit_FirstCommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setAutoTrustFactor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAutoTrustFactor);
-            setAutoTrustFactor(refVal_setAutoTrustFactor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("firstCommentId")), m_FirstCommentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor"))))
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor")));
-        if(!fieldValue.is_null())
-        {
-            double refVal_setManualTrustFactor;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setManualTrustFactor);
-            setManualTrustFactor(refVal_setManualTrustFactor);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("firstCommentDate")), m_FirstCommentDate);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("progress"))))
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("progress")));
-        if(!fieldValue.is_null())
-        {
-            std::map<utility::string_t, double> refVal_setProgress;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setProgress);
-            setProgress(refVal_setProgress);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("autoTrustFactor")), m_AutoTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("manualTrustFactor")), m_ManualTrustFactor);
+    }
+    if(m_FieldsSet.test(FieldBit_Progress))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("progress")), m_Progress);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt"))))
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tosAcceptedAt")), m_TosAcceptedAt);
+    }
+}
+
+bool UserBadgeProgress::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::datetime refVal_setTosAcceptedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTosAcceptedAt);
-            setTosAcceptedAt(refVal_setTosAcceptedAt);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("firstCommentId")):
+            {
+                utility::string_t refVal_setFirstCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFirstCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFirstCommentId(refVal_setFirstCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("firstCommentDate")):
+            {
+                utility::datetime refVal_setFirstCommentDate;
+                if(!ModelBase::readBinary(reader, field, refVal_setFirstCommentDate))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFirstCommentDate(refVal_setFirstCommentDate);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("autoTrustFactor")):
+            {
+                double refVal_setAutoTrustFactor;
+                if(!ModelBase::readBinary(reader, field, refVal_setAutoTrustFactor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAutoTrustFactor(refVal_setAutoTrustFactor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("manualTrustFactor")):
+            {
+                double refVal_setManualTrustFactor;
+                if(!ModelBase::readBinary(reader, field, refVal_setManualTrustFactor))
+                {
+                    ok = false;
+                    continue;
+                }
+                setManualTrustFactor(refVal_setManualTrustFactor);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("progress")):
+            {
+                std::map<utility::string_t, double> refVal_setProgress;
+                if(!ModelBase::readBinary(reader, field, refVal_setProgress))
+                {
+                    ok = false;
+                    continue;
+                }
+                setProgress(refVal_setProgress);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tosAcceptedAt")):
+            {
+                utility::datetime refVal_setTosAcceptedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setTosAcceptedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTosAcceptedAt(refVal_setTosAcceptedAt);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserBadgeProgress::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -212,39 +445,39 @@ void UserBadgeProgress::toMultipart(std::shared_ptr<MultipartFormData> multipart
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UserIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_FirstCommentIdIsSet)
+    if(m_FieldsSet.test(FieldBit_FirstCommentId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("firstCommentId")), m_FirstCommentId));
     }
-    if(m_FirstCommentDateIsSet)
+    if(m_FieldsSet.test(FieldBit_FirstCommentDate))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("firstCommentDate")), m_FirstCommentDate));
     }
-    if(m_AutoTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_AutoTrustFactor))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("autoTrustFactor")), m_AutoTrustFactor));
     }
-    if(m_ManualTrustFactorIsSet)
+    if(m_FieldsSet.test(FieldBit_ManualTrustFactor))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("manualTrustFactor")), m_ManualTrustFactor));
     }
-    if(m_ProgressIsSet)
+    if(m_FieldsSet.test(FieldBit_Progress))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("progress")), m_Progress));
     }
-    if(m_TosAcceptedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_TosAcceptedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tosAcceptedAt")), m_TosAcceptedAt));
     }
@@ -326,17 +559,17 @@ utility::string_t UserBadgeProgress::getId() const
 void UserBadgeProgress::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool UserBadgeProgress::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void UserBadgeProgress::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t UserBadgeProgress::getTenantId() const
 {
@@ -347,17 +580,17 @@ utility::string_t UserBadgeProgress::getTenantId() const
 void UserBadgeProgress::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool UserBadgeProgress::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void UserBadgeProgress::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t UserBadgeProgress::getUserId() const
 {
@@ -368,17 +601,17 @@ utility::string_t UserBadgeProgress::getUserId() const
 void UserBadgeProgress::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
-    m_UserIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool UserBadgeProgress::userIdIsSet() const
 {
-    return m_UserIdIsSet;
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void UserBadgeProgress::unsetUserId()
 {
-    m_UserIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t UserBadgeProgress::getFirstCommentId() const
 {
@@ -389,17 +622,17 @@ utility::string_t UserBadgeProgress::getFirstCommentId() const
 void UserBadgeProgress::setFirstCommentId(const utility::string_t& value)
 {
     m_FirstCommentId = value;
-    m_FirstCommentIdIsSet = true;
+    m_FieldsSet.set(FieldBit_FirstCommentId);
 }
 
 bool UserBadgeProgress::firstCommentIdIsSet() const
 {
-    return m_FirstCommentIdIsSet;
+    return m_FieldsSet.test(FieldBit_FirstCommentId);
 }
 
 void UserBadgeProgress::unsetFirstCommentId()
 {
-    m_FirstCommentIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_FirstCommentId);
 }
 utility::datetime UserBadgeProgress::getFirstCommentDate() const
 {
@@ -410,17 +643,17 @@ utility::datetime UserBadgeProgress::getFirstCommentDate() const
 void UserBadgeProgress::setFirstCommentDate(const utility::datetime& value)
 {
     m_FirstCommentDate = value;
-    m_FirstCommentDateIsSet = true;
+    m_FieldsSet.set(FieldBit_FirstCommentDate);
 }
 
 bool UserBadgeProgress::firstCommentDateIsSet() const
 {
-    return m_FirstCommentDateIsSet;
+    return m_FieldsSet.test(FieldBit_FirstCommentDate);
 }
 
 void UserBadgeProgress::unsetFirstCommentDate()
 {
-    m_FirstCommentDateIsSet = false;
+    m_FieldsSet.reset(FieldBit_FirstCommentDate);
 }
 double UserBadgeProgress::getAutoTrustFactor() const
 {
@@ -430,17 +663,17 @@ double UserBadgeProgress::getAutoTrustFactor() const
 void UserBadgeProgress::setAutoTrustFactor(double value)
 {
     m_AutoTrustFactor = value;
-    m_AutoTrustFactorIsSet = true;
+    m_FieldsSet.set(FieldBit_AutoTrustFactor);
 }
 
 bool UserBadgeProgress::autoTrustFactorIsSet() const
 {
-    return m_AutoTrustFactorIsSet;
+    return m_FieldsSet.test(FieldBit_AutoTrustFactor);
 }
 
 void UserBadgeProgress::unsetAutoTrustFactor()
 {
-    m_AutoTrustFactorIsSet = false;
+    m_FieldsSet.reset(FieldBit_AutoTrustFactor);
 }
 double UserBadgeProgress::getManualTrustFactor() const
 {
@@ -450,17 +683,17 @@ double UserBadgeProgress::getManualTrustFactor() const
 void UserBadgeProgress::setManualTrustFactor(double value)
 {
     m_ManualTrustFactor = value;
-    m_ManualTrustFactorIsSet = true;
+    m_FieldsSet.set(FieldBit_ManualTrustFactor);
 }
 
 bool UserBadgeProgress::manualTrustFactorIsSet() const
 {
-    return m_ManualTrustFactorIsSet;
+    return m_FieldsSet.test(FieldBit_ManualTrustFactor);
 }
 
 void UserBadgeProgress::unsetManualTrustFactor()
 {
-    m_ManualTrustFactorIsSet = false;
+    m_FieldsSet.reset(FieldBit_ManualTrustFactor);
 }
 std::map<utility::string_t, double> UserBadgeProgress::getProgress() const
 {
@@ -470,17 +703,17 @@ std::map<utility::string_t, double> UserBadgeProgress::getProgress() const
 void UserBadgeProgress::setProgress(std::map<utility::string_t, double> value)
 {
     m_Progress = value;
-    m_ProgressIsSet = true;
+    m_FieldsSet.set(FieldBit_Progress);
 }
 
 bool UserBadgeProgress::progressIsSet() const
 {
-    return m_ProgressIsSet;
+    return m_FieldsSet.test(FieldBit_Progress);
 }
 
 void UserBadgeProgress::unsetProgress()
 {
-    m_ProgressIsSet = false;
+    m_FieldsSet.reset(FieldBit_Progress);
 }
 utility::datetime UserBadgeProgress::getTosAcceptedAt() const
 {
@@ -491,17 +724,17 @@ utility::datetime UserBadgeProgress::getTosAcceptedAt() const
 void UserBadgeProgress::setTosAcceptedAt(const utility::datetime& value)
 {
     m_TosAcceptedAt = value;
-    m_TosAcceptedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_TosAcceptedAt);
 }
 
 bool UserBadgeProgress::tosAcceptedAtIsSet() const
 {
-    return m_TosAcceptedAtIsSet;
+    return m_FieldsSet.test(FieldBit_TosAcceptedAt);
 }
 
 void UserBadgeProgress::unsetTosAcceptedAt()
 {
-    m_TosAcceptedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_TosAcceptedAt);
 }
 
 }
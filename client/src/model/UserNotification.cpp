@@ -20,33 +20,11 @@ namespace model {
 
 UserNotification::UserNotification()
 {
-    m__id = utility::conversions::to_string_t("");
-    m__idIsSet = false;
-    m_TenantId = utility::conversions::to_string_t("");
-    m_TenantIdIsSet = false;
-    m_UrlId = utility::conversions::to_string_t("");
-    m_UrlIdIsSet = false;
-    m_Url = utility::conversions::to_string_t("");
-    m_UrlIsSet = false;
-    m_RelatedObjectTypeIsSet = false;
-    m_RelatedObjectId = utility::conversions::to_string_t("");
-    m_RelatedObjectIdIsSet = false;
     m_Viewed = false;
-    m_ViewedIsSet = false;
     m_IsUnreadMessage = false;
-    m_IsUnreadMessageIsSet = false;
     m_Sent = false;
-    m_SentIsSet = false;
-    m_CreatedAt = utility::datetime();
-    m_CreatedAtIsSet = false;
-    m_TypeIsSet = false;
     m_OptedOut = false;
-    m_OptedOutIsSet = false;
     m_Count = 0L;
-    m_CountIsSet = false;
-    m_RelatedIdsIsSet = false;
-    m_FromUserIdsIsSet = false;
-    m_FromUserNamesIsSet = false;
 }
 
 UserNotification::~UserNotification()
@@ -61,122 +39,122 @@ void UserNotification::validate()
 web::json::value UserNotification::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("_id"))] = ModelBase::toJson(m__id);
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantId"))] = ModelBase::toJson(m_TenantId);
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("userId"))] = ModelBase::toJson(m_UserId);
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("anonUserId"))] = ModelBase::toJson(m_AnonUserId);
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlId"))] = ModelBase::toJson(m_UrlId);
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("pageTitle"))] = ModelBase::toJson(m_PageTitle);
     }
-    if(m_RelatedObjectTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("relatedObjectType"))] = ModelBase::toJson(m_RelatedObjectType);
     }
-    if(m_RelatedObjectIdIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("relatedObjectId"))] = ModelBase::toJson(m_RelatedObjectId);
     }
-    if(m_ViewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("viewed"))] = ModelBase::toJson(m_Viewed);
     }
-    if(m_IsUnreadMessageIsSet)
+    if(m_FieldsSet.test(FieldBit_IsUnreadMessage))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isUnreadMessage"))] = ModelBase::toJson(m_IsUnreadMessage);
     }
-    if(m_SentIsSet)
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("sent"))] = ModelBase::toJson(m_Sent);
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("createdAt"))] = ModelBase::toJson(m_CreatedAt);
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("type"))] = ModelBase::toJson(m_Type);
     }
-    if(m_FromCommentId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromCommentId"))] = ModelBase::toJson(m_FromCommentId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromCommentId"))] = ModelBase::toJson(m_FromCommentId);
     }
-    if(m_FromVoteId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromVoteId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromVoteId"))] = ModelBase::toJson(m_FromVoteId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromVoteId"))] = ModelBase::toJson(m_FromVoteId);
     }
-    if(m_FromUserName.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserName))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserName"))] = ModelBase::toJson(m_FromUserName.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserName"))] = ModelBase::toJson(m_FromUserName);
     }
-    if(m_FromUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserId"))] = ModelBase::toJson(m_FromUserId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserId"))] = ModelBase::toJson(m_FromUserId);
     }
-    if(m_FromUserAvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc"))] = ModelBase::toJson(m_FromUserAvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc"))] = ModelBase::toJson(m_FromUserAvatarSrc);
     }
-    if(m_OptedOutIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("optedOut"))] = ModelBase::toJson(m_OptedOut);
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("count"))] = ModelBase::toJson(m_Count);
     }
-    if(m_RelatedIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("relatedIds"))] = ModelBase::toJson(m_RelatedIds);
     }
-    if(m_FromUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromUserIds"))] = ModelBase::toJson(m_FromUserIds);
     }
-    if(m_FromUserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("fromUserNames"))] = ModelBase::toJson(m_FromUserNames);
@@ -185,274 +163,867 @@ web::json::value UserNotification::toJson() const
     return val;
 }
 
+void UserNotification::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit__id))
+    {
+        
+        writer.key(_XPLATSTR("_id"));
+        ModelBase::writeJson(writer, m__id);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantId))
+    {
+        
+        writer.key(_XPLATSTR("tenantId"));
+        ModelBase::writeJson(writer, m_TenantId);
+    }
+    if(m_FieldsSet.test(FieldBit_UserId))
+    {
+        
+        writer.key(_XPLATSTR("userId"));
+        ModelBase::writeJson(writer, m_UserId);
+    }
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
+    {
+        
+        writer.key(_XPLATSTR("anonUserId"));
+        ModelBase::writeJson(writer, m_AnonUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_UrlId))
+    {
+        
+        writer.key(_XPLATSTR("urlId"));
+        ModelBase::writeJson(writer, m_UrlId);
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+    if(m_FieldsSet.test(FieldBit_PageTitle))
+    {
+        
+        writer.key(_XPLATSTR("pageTitle"));
+        ModelBase::writeJson(writer, m_PageTitle);
+    }
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
+    {
+        
+        writer.key(_XPLATSTR("relatedObjectType"));
+        ModelBase::writeJson(writer, m_RelatedObjectType);
+    }
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
+    {
+        
+        writer.key(_XPLATSTR("relatedObjectId"));
+        ModelBase::writeJson(writer, m_RelatedObjectId);
+    }
+    if(m_FieldsSet.test(FieldBit_Viewed))
+    {
+        
+        writer.key(_XPLATSTR("viewed"));
+        ModelBase::writeJson(writer, m_Viewed);
+    }
+    if(m_FieldsSet.test(FieldBit_IsUnreadMessage))
+    {
+        
+        writer.key(_XPLATSTR("isUnreadMessage"));
+        ModelBase::writeJson(writer, m_IsUnreadMessage);
+    }
+    if(m_FieldsSet.test(FieldBit_Sent))
+    {
+        
+        writer.key(_XPLATSTR("sent"));
+        ModelBase::writeJson(writer, m_Sent);
+    }
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
+    {
+        
+        writer.key(_XPLATSTR("createdAt"));
+        ModelBase::writeJson(writer, m_CreatedAt);
+    }
+    if(m_FieldsSet.test(FieldBit_Type))
+    {
+        
+        writer.key(_XPLATSTR("type"));
+        ModelBase::writeJson(writer, m_Type);
+    }
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
+    {
+        
+        writer.key(_XPLATSTR("fromCommentId"));
+        ModelBase::writeJson(writer, m_FromCommentId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromVoteId))
+    {
+        
+        writer.key(_XPLATSTR("fromVoteId"));
+        ModelBase::writeJson(writer, m_FromVoteId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserName))
+    {
+        
+        writer.key(_XPLATSTR("fromUserName"));
+        ModelBase::writeJson(writer, m_FromUserName);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserId))
+    {
+        
+        writer.key(_XPLATSTR("fromUserId"));
+        ModelBase::writeJson(writer, m_FromUserId);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("fromUserAvatarSrc"));
+        ModelBase::writeJson(writer, m_FromUserAvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_OptedOut))
+    {
+        
+        writer.key(_XPLATSTR("optedOut"));
+        ModelBase::writeJson(writer, m_OptedOut);
+    }
+    if(m_FieldsSet.test(FieldBit_Count))
+    {
+        
+        writer.key(_XPLATSTR("count"));
+        ModelBase::writeJson(writer, m_Count);
+    }
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
+    {
+        
+        writer.key(_XPLATSTR("relatedIds"));
+        ModelBase::writeJson(writer, m_RelatedIds);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
+    {
+        
+        writer.key(_XPLATSTR("fromUserIds"));
+        ModelBase::writeJson(writer, m_FromUserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
+    {
+        
+        writer.key(_XPLATSTR("fromUserNames"));
+        ModelBase::writeJson(writer, m_FromUserNames);
+    }
+
+    writer.endObject();
+}
+
 bool UserNotification::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("_id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("_id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setTenantId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
-            setTenantId(refVal_setTenantId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            if(field.first == _XPLATSTR("_id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            if(field.first == _XPLATSTR("tenantId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantId);
+                    setTenantId(refVal_setTenantId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            if(field.first == _XPLATSTR("userId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
+                    setUserId(refVal_setUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            if(field.first == _XPLATSTR("anonUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAnonUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
+                    setAnonUserId(refVal_setAnonUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            if(field.first == _XPLATSTR("urlId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
+                    setUrlId(refVal_setUrlId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            if(field.first == _XPLATSTR("pageTitle"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setPageTitle;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
+                    setPageTitle(refVal_setPageTitle);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectType")):
+            if(field.first == _XPLATSTR("relatedObjectType"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<NotificationObjectType> refVal_setRelatedObjectType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectType);
+                    setRelatedObjectType(refVal_setRelatedObjectType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectId")):
+            if(field.first == _XPLATSTR("relatedObjectId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setRelatedObjectId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectId);
+                    setRelatedObjectId(refVal_setRelatedObjectId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("viewed")):
+            if(field.first == _XPLATSTR("viewed"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setViewed;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setViewed);
+                    setViewed(refVal_setViewed);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isUnreadMessage")):
+            if(field.first == _XPLATSTR("isUnreadMessage"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsUnreadMessage;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsUnreadMessage);
+                    setIsUnreadMessage(refVal_setIsUnreadMessage);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sent")):
+            if(field.first == _XPLATSTR("sent"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setSent;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSent);
+                    setSent(refVal_setSent);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            if(field.first == _XPLATSTR("createdAt"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::datetime refVal_setCreatedAt;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
+                    setCreatedAt(refVal_setCreatedAt);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            if(field.first == _XPLATSTR("type"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<NotificationType> refVal_setType;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setType);
+                    setType(refVal_setType);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromCommentId")):
+            if(field.first == _XPLATSTR("fromCommentId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromCommentId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromCommentId);
+                    setFromCommentId(refVal_setFromCommentId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromVoteId")):
+            if(field.first == _XPLATSTR("fromVoteId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromVoteId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromVoteId);
+                    setFromVoteId(refVal_setFromVoteId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserName")):
+            if(field.first == _XPLATSTR("fromUserName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserName);
+                    setFromUserName(refVal_setFromUserName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            if(field.first == _XPLATSTR("fromUserId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
+                    setFromUserId(refVal_setFromUserId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserAvatarSrc")):
+            if(field.first == _XPLATSTR("fromUserAvatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setFromUserAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserAvatarSrc);
+                    setFromUserAvatarSrc(refVal_setFromUserAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("optedOut")):
+            if(field.first == _XPLATSTR("optedOut"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setOptedOut;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setOptedOut);
+                    setOptedOut(refVal_setOptedOut);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            if(field.first == _XPLATSTR("count"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
+                    setCount(refVal_setCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("relatedIds")):
+            if(field.first == _XPLATSTR("relatedIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setRelatedIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedIds);
+                    setRelatedIds(refVal_setRelatedIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserIds")):
+            if(field.first == _XPLATSTR("fromUserIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFromUserIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserIds);
+                    setFromUserIds(refVal_setFromUserIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserNames")):
+            if(field.first == _XPLATSTR("fromUserNames"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setFromUserNames;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserNames);
+                    setFromUserNames(refVal_setFromUserNames);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userId"))))
+    return ok;
+}
+
+void UserNotification::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit__id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserId);
-            setUserId(refVal_setUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("_id")), m__id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("anonUserId"))))
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("anonUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAnonUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAnonUserId);
-            setAnonUserId(refVal_setAnonUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantId")), m_TenantId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlId"))))
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlId);
-            setUrlId(refVal_setUrlId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userId")), m_UserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("anonUserId")), m_AnonUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("pageTitle"))))
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("pageTitle")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setPageTitle;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setPageTitle);
-            setPageTitle(refVal_setPageTitle);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlId")), m_UrlId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("relatedObjectType"))))
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("relatedObjectType")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<NotificationObjectType> refVal_setRelatedObjectType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectType);
-            setRelatedObjectType(refVal_setRelatedObjectType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("relatedObjectId"))))
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("relatedObjectId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setRelatedObjectId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedObjectId);
-            setRelatedObjectId(refVal_setRelatedObjectId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("pageTitle")), m_PageTitle);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("viewed"))))
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("viewed")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setViewed;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setViewed);
-            setViewed(refVal_setViewed);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("relatedObjectType")), m_RelatedObjectType);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isUnreadMessage"))))
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isUnreadMessage")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsUnreadMessage;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsUnreadMessage);
-            setIsUnreadMessage(refVal_setIsUnreadMessage);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("relatedObjectId")), m_RelatedObjectId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sent"))))
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sent")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setSent;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSent);
-            setSent(refVal_setSent);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("viewed")), m_Viewed);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("createdAt"))))
+    if(m_FieldsSet.test(FieldBit_IsUnreadMessage))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("createdAt")));
-        if(!fieldValue.is_null())
-        {
-            utility::datetime refVal_setCreatedAt;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCreatedAt);
-            setCreatedAt(refVal_setCreatedAt);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isUnreadMessage")), m_IsUnreadMessage);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("type"))))
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("type")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<NotificationType> refVal_setType;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setType);
-            setType(refVal_setType);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sent")), m_Sent);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromCommentId"))))
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromCommentId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromCommentId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromCommentId);
-            setFromCommentId(refVal_setFromCommentId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("createdAt")), m_CreatedAt);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromVoteId"))))
+    if(m_FieldsSet.test(FieldBit_Type))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromVoteId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromVoteId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromVoteId);
-            setFromVoteId(refVal_setFromVoteId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("type")), m_Type);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserName"))))
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserName);
-            setFromUserName(refVal_setFromUserName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromCommentId")), m_FromCommentId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserId"))))
+    if(m_FieldsSet.test(FieldBit_FromVoteId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserId);
-            setFromUserId(refVal_setFromUserId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromVoteId")), m_FromVoteId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc"))))
+    if(m_FieldsSet.test(FieldBit_FromUserName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setFromUserAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserAvatarSrc);
-            setFromUserAvatarSrc(refVal_setFromUserAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserName")), m_FromUserName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("optedOut"))))
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("optedOut")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setOptedOut;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setOptedOut);
-            setOptedOut(refVal_setOptedOut);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserId")), m_FromUserId);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("count"))))
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("count")));
-        if(!fieldValue.is_null())
-        {
-            int64_t refVal_setCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCount);
-            setCount(refVal_setCount);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserAvatarSrc")), m_FromUserAvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("relatedIds"))))
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("relatedIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setRelatedIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setRelatedIds);
-            setRelatedIds(refVal_setRelatedIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("optedOut")), m_OptedOut);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserIds"))))
+    if(m_FieldsSet.test(FieldBit_Count))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setFromUserIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserIds);
-            setFromUserIds(refVal_setFromUserIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("count")), m_Count);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("fromUserNames"))))
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("fromUserNames")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("relatedIds")), m_RelatedIds);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserIds")), m_FromUserIds);
+    }
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("fromUserNames")), m_FromUserNames);
+    }
+}
+
+bool UserNotification::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<utility::string_t> refVal_setFromUserNames;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setFromUserNames);
-            setFromUserNames(refVal_setFromUserNames);
-            
+        case ModelBase::fieldHash(_XPLATSTR("_id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantId")):
+            {
+                utility::string_t refVal_setTenantId;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantId(refVal_setTenantId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userId")):
+            {
+                utility::string_t refVal_setUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserId(refVal_setUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("anonUserId")):
+            {
+                utility::string_t refVal_setAnonUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setAnonUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAnonUserId(refVal_setAnonUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("urlId")):
+            {
+                utility::string_t refVal_setUrlId;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlId(refVal_setUrlId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("pageTitle")):
+            {
+                utility::string_t refVal_setPageTitle;
+                if(!ModelBase::readBinary(reader, field, refVal_setPageTitle))
+                {
+                    ok = false;
+                    continue;
+                }
+                setPageTitle(refVal_setPageTitle);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectType")):
+            {
+                std::shared_ptr<NotificationObjectType> refVal_setRelatedObjectType;
+                if(!ModelBase::readBinary(reader, field, refVal_setRelatedObjectType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRelatedObjectType(refVal_setRelatedObjectType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("relatedObjectId")):
+            {
+                utility::string_t refVal_setRelatedObjectId;
+                if(!ModelBase::readBinary(reader, field, refVal_setRelatedObjectId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRelatedObjectId(refVal_setRelatedObjectId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("viewed")):
+            {
+                bool refVal_setViewed;
+                if(!ModelBase::readBinary(reader, field, refVal_setViewed))
+                {
+                    ok = false;
+                    continue;
+                }
+                setViewed(refVal_setViewed);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isUnreadMessage")):
+            {
+                bool refVal_setIsUnreadMessage;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsUnreadMessage))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsUnreadMessage(refVal_setIsUnreadMessage);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sent")):
+            {
+                bool refVal_setSent;
+                if(!ModelBase::readBinary(reader, field, refVal_setSent))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSent(refVal_setSent);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("createdAt")):
+            {
+                utility::datetime refVal_setCreatedAt;
+                if(!ModelBase::readBinary(reader, field, refVal_setCreatedAt))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCreatedAt(refVal_setCreatedAt);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("type")):
+            {
+                std::shared_ptr<NotificationType> refVal_setType;
+                if(!ModelBase::readBinary(reader, field, refVal_setType))
+                {
+                    ok = false;
+                    continue;
+                }
+                setType(refVal_setType);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromCommentId")):
+            {
+                utility::string_t refVal_setFromCommentId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromCommentId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromCommentId(refVal_setFromCommentId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromVoteId")):
+            {
+                utility::string_t refVal_setFromVoteId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromVoteId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromVoteId(refVal_setFromVoteId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserName")):
+            {
+                utility::string_t refVal_setFromUserName;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserName(refVal_setFromUserName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserId")):
+            {
+                utility::string_t refVal_setFromUserId;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserId(refVal_setFromUserId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserAvatarSrc")):
+            {
+                utility::string_t refVal_setFromUserAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserAvatarSrc(refVal_setFromUserAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("optedOut")):
+            {
+                bool refVal_setOptedOut;
+                if(!ModelBase::readBinary(reader, field, refVal_setOptedOut))
+                {
+                    ok = false;
+                    continue;
+                }
+                setOptedOut(refVal_setOptedOut);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("count")):
+            {
+                int64_t refVal_setCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCount(refVal_setCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("relatedIds")):
+            {
+                std::vector<utility::string_t> refVal_setRelatedIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setRelatedIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setRelatedIds(refVal_setRelatedIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserIds")):
+            {
+                std::vector<utility::string_t> refVal_setFromUserIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserIds(refVal_setFromUserIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("fromUserNames")):
+            {
+                std::vector<utility::string_t> refVal_setFromUserNames;
+                if(!ModelBase::readBinary(reader, field, refVal_setFromUserNames))
+                {
+                    ok = false;
+                    continue;
+                }
+                setFromUserNames(refVal_setFromUserNames);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserNotification::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -462,99 +1033,99 @@ void UserNotification::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m__idIsSet)
+    if(m_FieldsSet.test(FieldBit__id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("_id")), m__id));
     }
-    if(m_TenantIdIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantId")), m_TenantId));
     }
-    if(m_UserId.has_value())
+    if(m_FieldsSet.test(FieldBit_UserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userId")), m_UserId));
     }
-    if(m_AnonUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_AnonUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("anonUserId")), m_AnonUserId));
     }
-    if(m_UrlIdIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlId")), m_UrlId));
     }
-    if(m_UrlIsSet)
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
-    if(m_PageTitle.has_value())
+    if(m_FieldsSet.test(FieldBit_PageTitle))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("pageTitle")), m_PageTitle));
     }
-    if(m_RelatedObjectTypeIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectType))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("relatedObjectType")), m_RelatedObjectType));
     }
-    if(m_RelatedObjectIdIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedObjectId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("relatedObjectId")), m_RelatedObjectId));
     }
-    if(m_ViewedIsSet)
+    if(m_FieldsSet.test(FieldBit_Viewed))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("viewed")), m_Viewed));
     }
-    if(m_IsUnreadMessageIsSet)
+    if(m_FieldsSet.test(FieldBit_IsUnreadMessage))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isUnreadMessage")), m_IsUnreadMessage));
     }
-    if(m_SentIsSet)
+    if(m_FieldsSet.test(FieldBit_Sent))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sent")), m_Sent));
     }
-    if(m_CreatedAtIsSet)
+    if(m_FieldsSet.test(FieldBit_CreatedAt))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("createdAt")), m_CreatedAt));
     }
-    if(m_TypeIsSet)
+    if(m_FieldsSet.test(FieldBit_Type))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("type")), m_Type));
     }
-    if(m_FromCommentId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromCommentId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromCommentId")), m_FromCommentId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromCommentId")), m_FromCommentId));
     }
-    if(m_FromVoteId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromVoteId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromVoteId")), m_FromVoteId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromVoteId")), m_FromVoteId));
     }
-    if(m_FromUserName.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserName))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserName")), m_FromUserName.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserName")), m_FromUserName));
     }
-    if(m_FromUserId.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserId")), m_FromUserId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserId")), m_FromUserId));
     }
-    if(m_FromUserAvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_FromUserAvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc")), m_FromUserAvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserAvatarSrc")), m_FromUserAvatarSrc));
     }
-    if(m_OptedOutIsSet)
+    if(m_FieldsSet.test(FieldBit_OptedOut))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("optedOut")), m_OptedOut));
     }
-    if(m_CountIsSet)
+    if(m_FieldsSet.test(FieldBit_Count))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("count")), m_Count));
     }
-    if(m_RelatedIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_RelatedIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("relatedIds")), m_RelatedIds));
     }
-    if(m_FromUserIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserIds")), m_FromUserIds));
     }
-    if(m_FromUserNamesIsSet)
+    if(m_FieldsSet.test(FieldBit_FromUserNames))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("fromUserNames")), m_FromUserNames));
     }
@@ -726,17 +1297,17 @@ utility::string_t UserNotification::getId() const
 void UserNotification::setId(const utility::string_t& value)
 {
     m__id = value;
-    m__idIsSet = true;
+    m_FieldsSet.set(FieldBit__id);
 }
 
 bool UserNotification::idIsSet() const
 {
-    return m__idIsSet;
+    return m_FieldsSet.test(FieldBit__id);
 }
 
 void UserNotification::unset_id()
 {
-    m__idIsSet = false;
+    m_FieldsSet.reset(FieldBit__id);
 }
 utility::string_t UserNotification::getTenantId() const
 {
@@ -747,57 +1318,59 @@ utility::string_t UserNotification::getTenantId() const
 void UserNotification::setTenantId(const utility::string_t& value)
 {
     m_TenantId = value;
-    m_TenantIdIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantId);
 }
 
 bool UserNotification::tenantIdIsSet() const
 {
-    return m_TenantIdIsSet;
+    return m_FieldsSet.test(FieldBit_TenantId);
 }
 
 void UserNotification::unsetTenantId()
 {
-    m_TenantIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantId);
 }
 utility::string_t UserNotification::getUserId() const
 {
-    return m_UserId.get();
+    return m_UserId;
 }
 
 
 void UserNotification::setUserId(const utility::string_t& value)
 {
     m_UserId = value;
+    m_FieldsSet.set(FieldBit_UserId);
 }
 
 bool UserNotification::userIdIsSet() const
 {
-    return m_UserId.has_value();
+    return m_FieldsSet.test(FieldBit_UserId);
 }
 
 void UserNotification::unsetUserId()
 {
-    m_UserId.reset();
+    m_FieldsSet.reset(FieldBit_UserId);
 }
 utility::string_t UserNotification::getAnonUserId() const
 {
-    return m_AnonUserId.get();
+    return m_AnonUserId;
 }
 
 
 void UserNotification::setAnonUserId(const utility::string_t& value)
 {
     m_AnonUserId = value;
+    m_FieldsSet.set(FieldBit_AnonUserId);
 }
 
 bool UserNotification::anonUserIdIsSet() const
 {
-    return m_AnonUserId.has_value();
+    return m_FieldsSet.test(FieldBit_AnonUserId);
 }
 
 void UserNotification::unsetAnonUserId()
 {
-    m_AnonUserId.reset();
+    m_FieldsSet.reset(FieldBit_AnonUserId);
 }
 utility::string_t UserNotification::getUrlId() const
 {
@@ -808,17 +1381,17 @@ utility::string_t UserNotification::getUrlId() const
 void UserNotification::setUrlId(const utility::string_t& value)
 {
     m_UrlId = value;
-    m_UrlIdIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlId);
 }
 
 bool UserNotification::urlIdIsSet() const
 {
-    return m_UrlIdIsSet;
+    return m_FieldsSet.test(FieldBit_UrlId);
 }
 
 void UserNotification::unsetUrlId()
 {
-    m_UrlIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlId);
 }
 utility::string_t UserNotification::getUrl() const
 {
@@ -829,37 +1402,38 @@ utility::string_t UserNotification::getUrl() const
 void UserNotification::setUrl(const utility::string_t& value)
 {
     m_Url = value;
-    m_UrlIsSet = true;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool UserNotification::urlIsSet() const
 {
-    return m_UrlIsSet;
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void UserNotification::unsetUrl()
 {
-    m_UrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_Url);
 }
 utility::string_t UserNotification::getPageTitle() const
 {
-    return m_PageTitle.get();
+    return m_PageTitle;
 }
 
 
 void UserNotification::setPageTitle(const utility::string_t& value)
 {
     m_PageTitle = value;
+    m_FieldsSet.set(FieldBit_PageTitle);
 }
 
 bool UserNotification::pageTitleIsSet() const
 {
-    return m_PageTitle.has_value();
+    return m_FieldsSet.test(FieldBit_PageTitle);
 }
 
 void UserNotification::unsetPageTitle()
 {
-    m_PageTitle.reset();
+    m_FieldsSet.reset(FieldBit_PageTitle);
 }
 std::shared_ptr<NotificationObjectType> UserNotification::getRelatedObjectType() const
 {
@@ -870,17 +1444,17 @@ std::shared_ptr<NotificationObjectType> UserNotification::getRelatedObjectType()
 void UserNotification::setRelatedObjectType(const std::shared_ptr<NotificationObjectType>& value)
 {
     m_RelatedObjectType = value;
-    m_RelatedObjectTypeIsSet = true;
+    m_FieldsSet.set(FieldBit_RelatedObjectType);
 }
 
 bool UserNotification::relatedObjectTypeIsSet() const
 {
-    return m_RelatedObjectTypeIsSet;
+    return m_FieldsSet.test(FieldBit_RelatedObjectType);
 }
 
 void UserNotification::unsetRelatedObjectType()
 {
-    m_RelatedObjectTypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_RelatedObjectType);
 }
 utility::string_t UserNotification::getRelatedObjectId() const
 {
@@ -891,17 +1465,17 @@ utility::string_t UserNotification::getRelatedObjectId() const
 void UserNotification::setRelatedObjectId(const utility::string_t& value)
 {
     m_RelatedObjectId = value;
-    m_RelatedObjectIdIsSet = true;
+    m_FieldsSet.set(FieldBit_RelatedObjectId);
 }
 
 bool UserNotification::relatedObjectIdIsSet() const
 {
-    return m_RelatedObjectIdIsSet;
+    return m_FieldsSet.test(FieldBit_RelatedObjectId);
 }
 
 void UserNotification::unsetRelatedObjectId()
 {
-    m_RelatedObjectIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_RelatedObjectId);
 }
 bool UserNotification::isViewed() const
 {
@@ -911,17 +1485,17 @@ bool UserNotification::isViewed() const
 void UserNotification::setViewed(bool value)
 {
     m_Viewed = value;
-    m_ViewedIsSet = true;
+    m_FieldsSet.set(FieldBit_Viewed);
 }
 
 bool UserNotification::viewedIsSet() const
 {
-    return m_ViewedIsSet;
+    return m_FieldsSet.test(FieldBit_Viewed);
 }
 
 void UserNotification::unsetViewed()
 {
-    m_ViewedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Viewed);
 }
 bool UserNotification::isIsUnreadMessage() const
 {
@@ -931,17 +1505,17 @@ bool UserNotification::isIsUnreadMessage() const
 void UserNotification::setIsUnreadMessage(bool value)
 {
     m_IsUnreadMessage = value;
-    m_IsUnreadMessageIsSet = true;
+    m_FieldsSet.set(FieldBit_IsUnreadMessage);
 }
 
 bool UserNotification::isUnreadMessageIsSet() const
 {
-    return m_IsUnreadMessageIsSet;
+    return m_FieldsSet.test(FieldBit_IsUnreadMessage);
 }
 
 void UserNotification::unsetIsUnreadMessage()
 {
-    m_IsUnreadMessageIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsUnreadMessage);
 }
 bool UserNotification::isSent() const
 {
@@ -951,17 +1525,17 @@ bool UserNotification::isSent() const
 void UserNotification::setSent(bool value)
 {
     m_Sent = value;
-    m_SentIsSet = true;
+    m_FieldsSet.set(FieldBit_Sent);
 }
 
 bool UserNotification::sentIsSet() const
 {
-    return m_SentIsSet;
+    return m_FieldsSet.test(FieldBit_Sent);
 }
 
 void UserNotification::unsetSent()
 {
-    m_SentIsSet = false;
+    m_FieldsSet.reset(FieldBit_Sent);
 }
 utility::datetime UserNotification::getCreatedAt() const
 {
@@ -972,17 +1546,17 @@ utility::datetime UserNotification::getCreatedAt() const
 void UserNotification::setCreatedAt(const utility::datetime& value)
 {
     m_CreatedAt = value;
-    m_CreatedAtIsSet = true;
+    m_FieldsSet.set(FieldBit_CreatedAt);
 }
 
 bool UserNotification::createdAtIsSet() const
 {
-    return m_CreatedAtIsSet;
+    return m_FieldsSet.test(FieldBit_CreatedAt);
 }
 
 void UserNotification::unsetCreatedAt()
 {
-    m_CreatedAtIsSet = false;
+    m_FieldsSet.reset(FieldBit_CreatedAt);
 }
 std::shared_ptr<NotificationType> UserNotification::getType() const
 {
@@ -993,117 +1567,122 @@ std::shared_ptr<NotificationType> UserNotification::getType() const
 void UserNotification::setType(const std::shared_ptr<NotificationType>& value)
 {
     m_Type = value;
-    m_TypeIsSet = true;
+    m_FieldsSet.set(FieldBit_Type);
 }
 
 bool UserNotification::typeIsSet() const
 {
-    return m_TypeIsSet;
+    return m_FieldsSet.test(FieldBit_Type);
 }
 
 void UserNotification::unsetType()
 {
-    m_TypeIsSet = false;
+    m_FieldsSet.reset(FieldBit_Type);
 }
 utility::string_t UserNotification::getFromCommentId() const
 {
-    return m_FromCommentId.get();
+    return m_FromCommentId;
 }
 
 
 void UserNotification::setFromCommentId(const utility::string_t& value)
 {
     m_FromCommentId = value;
+    m_FieldsSet.set(FieldBit_FromCommentId);
 }
 
 bool UserNotification::fromCommentIdIsSet() const
 {
-    return m_FromCommentId.has_value();
+    return m_FieldsSet.test(FieldBit_FromCommentId);
 }
 
 void UserNotification::unsetFromCommentId()
 {
-    m_FromCommentId.reset();
+    m_FieldsSet.reset(FieldBit_FromCommentId);
 }
 utility::string_t UserNotification::getFromVoteId() const
 {
-    return m_FromVoteId.get();
+    return m_FromVoteId;
 }
 
 
 void UserNotification::setFromVoteId(const utility::string_t& value)
 {
     m_FromVoteId = value;
+    m_FieldsSet.set(FieldBit_FromVoteId);
 }
 
 bool UserNotification::fromVoteIdIsSet() const
 {
-    return m_FromVoteId.has_value();
+    return m_FieldsSet.test(FieldBit_FromVoteId);
 }
 
 void UserNotification::unsetFromVoteId()
 {
-    m_FromVoteId.reset();
+    m_FieldsSet.reset(FieldBit_FromVoteId);
 }
 utility::string_t UserNotification::getFromUserName() const
 {
-    return m_FromUserName.get();
+    return m_FromUserName;
 }
 
 
 void UserNotification::setFromUserName(const utility::string_t& value)
 {
     m_FromUserName = value;
+    m_FieldsSet.set(FieldBit_FromUserName);
 }
 
 bool UserNotification::fromUserNameIsSet() const
 {
-    return m_FromUserName.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserName);
 }
 
 void UserNotification::unsetFromUserName()
 {
-    m_FromUserName.reset();
+    m_FieldsSet.reset(FieldBit_FromUserName);
 }
 utility::string_t UserNotification::getFromUserId() const
 {
-    return m_FromUserId.get();
+    return m_FromUserId;
 }
 
 
 void UserNotification::setFromUserId(const utility::string_t& value)
 {
     m_FromUserId = value;
+    m_FieldsSet.set(FieldBit_FromUserId);
 }
 
 bool UserNotification::fromUserIdIsSet() const
 {
-    return m_FromUserId.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserId);
 }
 
 void UserNotification::unsetFromUserId()
 {
-    m_FromUserId.reset();
+    m_FieldsSet.reset(FieldBit_FromUserId);
 }
 utility::string_t UserNotification::getFromUserAvatarSrc() const
 {
-    return m_FromUserAvatarSrc.get();
+    return m_FromUserAvatarSrc;
 }
 
 
 void UserNotification::setFromUserAvatarSrc(const utility::string_t& value)
 {
     m_FromUserAvatarSrc = value;
+    m_FieldsSet.set(FieldBit_FromUserAvatarSrc);
 }
 
 bool UserNotification::fromUserAvatarSrcIsSet() const
 {
-    return m_FromUserAvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_FromUserAvatarSrc);
 }
 
 void UserNotification::unsetFromUserAvatarSrc()
 {
-    m_FromUserAvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_FromUserAvatarSrc);
 }
 bool UserNotification::isOptedOut() const
 {
@@ -1113,17 +1692,17 @@ bool UserNotification::isOptedOut() const
 void UserNotification::setOptedOut(bool value)
 {
     m_OptedOut = value;
-    m_OptedOutIsSet = true;
+    m_FieldsSet.set(FieldBit_OptedOut);
 }
 
 bool UserNotification::optedOutIsSet() const
 {
-    return m_OptedOutIsSet;
+    return m_FieldsSet.test(FieldBit_OptedOut);
 }
 
 void UserNotification::unsetOptedOut()
 {
-    m_OptedOutIsSet = false;
+    m_FieldsSet.reset(FieldBit_OptedOut);
 }
 int64_t UserNotification::getCount() const
 {
@@ -1133,17 +1712,17 @@ int64_t UserNotification::getCount() const
 void UserNotification::setCount(int64_t value)
 {
     m_Count = value;
-    m_CountIsSet = true;
+    m_FieldsSet.set(FieldBit_Count);
 }
 
 bool UserNotification::countIsSet() const
 {
-    return m_CountIsSet;
+    return m_FieldsSet.test(FieldBit_Count);
 }
 
 void UserNotification::unsetCount()
 {
-    m_CountIsSet = false;
+    m_FieldsSet.reset(FieldBit_Count);
 }
 std::vector<utility::string_t> UserNotification::getRelatedIds() const
 {
@@ -1154,17 +1733,17 @@ std::vector<utility::string_t> UserNotification::getRelatedIds() const
 void UserNotification::setRelatedIds(const std::vector<utility::string_t>& value)
 {
     m_RelatedIds = value;
-    m_RelatedIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_RelatedIds);
 }
 
 bool UserNotification::relatedIdsIsSet() const
 {
-    return m_RelatedIdsIsSet;
+    return m_FieldsSet.test(FieldBit_RelatedIds);
 }
 
 void UserNotification::unsetRelatedIds()
 {
-    m_RelatedIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_RelatedIds);
 }
 std::vector<utility::string_t> UserNotification::getFromUserIds() const
 {
@@ -1175,17 +1754,17 @@ std::vector<utility::string_t> UserNotification::getFromUserIds() const
 void UserNotification::setFromUserIds(const std::vector<utility::string_t>& value)
 {
     m_FromUserIds = value;
-    m_FromUserIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_FromUserIds);
 }
 
 bool UserNotification::fromUserIdsIsSet() const
 {
-    return m_FromUserIdsIsSet;
+    return m_FieldsSet.test(FieldBit_FromUserIds);
 }
 
 void UserNotification::unsetFromUserIds()
 {
-    m_FromUserIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromUserIds);
 }
 std::vector<utility::string_t> UserNotification::getFromUserNames() const
 {
@@ -1196,17 +1775,17 @@ std::vector<utility::string_t> UserNotification::getFromUserNames() const
 void UserNotification::setFromUserNames(const std::vector<utility::string_t>& value)
 {
     m_FromUserNames = value;
-    m_FromUserNamesIsSet = true;
+    m_FieldsSet.set(FieldBit_FromUserNames);
 }
 
 bool UserNotification::fromUserNamesIsSet() const
 {
-    return m_FromUserNamesIsSet;
+    return m_FieldsSet.test(FieldBit_FromUserNames);
 }
 
 void UserNotification::unsetFromUserNames()
 {
-    m_FromUserNamesIsSet = false;
+    m_FieldsSet.reset(FieldBit_FromUserNames);
 }
 
 }
@@ -20,11 +20,8 @@ namespace model {
 
 UserNotificationWriteResponse::UserNotificationWriteResponse()
 {
-    m_StatusIsSet = false;
     m_MatchedCount = 0L;
-    m_MatchedCountIsSet = false;
     m_ModifiedCount = 0L;
-    m_ModifiedCountIsSet = false;
 }
 
 UserNotificationWriteResponse::~UserNotificationWriteResponse()
@@ -39,17 +36,17 @@ void UserNotificationWriteResponse::validate()
 web::json::value UserNotificationWriteResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_MatchedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("matchedCount"))] = ModelBase::toJson(m_MatchedCount);
     }
-    if(m_ModifiedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("modifiedCount"))] = ModelBase::toJson(m_ModifiedCount);
@@ -58,43 +55,153 @@ web::json::value UserNotificationWriteResponse::toJson() const
     return val;
 }
 
+void UserNotificationWriteResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
+    {
+        
+        writer.key(_XPLATSTR("matchedCount"));
+        ModelBase::writeJson(writer, m_MatchedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
+    {
+        
+        writer.key(_XPLATSTR("modifiedCount"));
+        ModelBase::writeJson(writer, m_ModifiedCount);
+    }
+
+    writer.endObject();
+}
+
 bool UserNotificationWriteResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("matchedCount"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("matchedCount")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            int64_t refVal_setMatchedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedCount);
-            setMatchedCount(refVal_setMatchedCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("matchedCount")):
+            if(field.first == _XPLATSTR("matchedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setMatchedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setMatchedCount);
+                    setMatchedCount(refVal_setMatchedCount);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("modifiedCount")):
+            if(field.first == _XPLATSTR("modifiedCount"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    int64_t refVal_setModifiedCount;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setModifiedCount);
+                    setModifiedCount(refVal_setModifiedCount);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("modifiedCount"))))
+    return ok;
+}
+
+void UserNotificationWriteResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("matchedCount")), m_MatchedCount);
+    }
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("modifiedCount")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("modifiedCount")), m_ModifiedCount);
+    }
+}
+
+bool UserNotificationWriteResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            int64_t refVal_setModifiedCount;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setModifiedCount);
-            setModifiedCount(refVal_setModifiedCount);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("matchedCount")):
+            {
+                int64_t refVal_setMatchedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setMatchedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setMatchedCount(refVal_setMatchedCount);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("modifiedCount")):
+            {
+                int64_t refVal_setModifiedCount;
+                if(!ModelBase::readBinary(reader, field, refVal_setModifiedCount))
+                {
+                    ok = false;
+                    continue;
+                }
+                setModifiedCount(refVal_setModifiedCount);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserNotificationWriteResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -104,15 +211,15 @@ void UserNotificationWriteResponse::toMultipart(std::shared_ptr<MultipartFormDat
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_MatchedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_MatchedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("matchedCount")), m_MatchedCount));
     }
-    if(m_ModifiedCountIsSet)
+    if(m_FieldsSet.test(FieldBit_ModifiedCount))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("modifiedCount")), m_ModifiedCount));
     }
@@ -158,17 +265,17 @@ std::shared_ptr<APIStatus> UserNotificationWriteResponse::getStatus() const
 void UserNotificationWriteResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool UserNotificationWriteResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void UserNotificationWriteResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 int64_t UserNotificationWriteResponse::getMatchedCount() const
 {
@@ -178,17 +285,17 @@ int64_t UserNotificationWriteResponse::getMatchedCount() const
 void UserNotificationWriteResponse::setMatchedCount(int64_t value)
 {
     m_MatchedCount = value;
-    m_MatchedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_MatchedCount);
 }
 
 bool UserNotificationWriteResponse::matchedCountIsSet() const
 {
-    return m_MatchedCountIsSet;
+    return m_FieldsSet.test(FieldBit_MatchedCount);
 }
 
 void UserNotificationWriteResponse::unsetMatchedCount()
 {
-    m_MatchedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_MatchedCount);
 }
 int64_t UserNotificationWriteResponse::getModifiedCount() const
 {
@@ -198,17 +305,17 @@ int64_t UserNotificationWriteResponse::getModifiedCount() const
 void UserNotificationWriteResponse::setModifiedCount(int64_t value)
 {
     m_ModifiedCount = value;
-    m_ModifiedCountIsSet = true;
+    m_FieldsSet.set(FieldBit_ModifiedCount);
 }
 
 bool UserNotificationWriteResponse::modifiedCountIsSet() const
 {
-    return m_ModifiedCountIsSet;
+    return m_FieldsSet.test(FieldBit_ModifiedCount);
 }
 
 void UserNotificationWriteResponse::unsetModifiedCount()
 {
-    m_ModifiedCountIsSet = false;
+    m_FieldsSet.reset(FieldBit_ModifiedCount);
 }
 
 }
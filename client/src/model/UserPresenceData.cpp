@@ -20,12 +20,6 @@ namespace model {
 
 UserPresenceData::UserPresenceData()
 {
-    m_UrlIdWS = utility::conversions::to_string_t("");
-    m_UrlIdWSIsSet = false;
-    m_UserIdWS = utility::conversions::to_string_t("");
-    m_UserIdWSIsSet = false;
-    m_TenantIdWS = utility::conversions::to_string_t("");
-    m_TenantIdWSIsSet = false;
 }
 
 UserPresenceData::~UserPresenceData()
@@ -40,17 +34,17 @@ void UserPresenceData::validate()
 web::json::value UserPresenceData::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))] = ModelBase::toJson(m_UrlIdWS);
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("userIdWS"))] = ModelBase::toJson(m_UserIdWS);
     }
-    if(m_TenantIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("tenantIdWS"))] = ModelBase::toJson(m_TenantIdWS);
@@ -59,43 +53,153 @@ web::json::value UserPresenceData::toJson() const
     return val;
 }
 
+void UserPresenceData::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
+    {
+        
+        writer.key(_XPLATSTR("urlIdWS"));
+        ModelBase::writeJson(writer, m_UrlIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
+    {
+        
+        writer.key(_XPLATSTR("userIdWS"));
+        ModelBase::writeJson(writer, m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
+    {
+        
+        writer.key(_XPLATSTR("tenantIdWS"));
+        ModelBase::writeJson(writer, m_TenantIdWS);
+    }
+
+    writer.endObject();
+}
+
 bool UserPresenceData::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("urlIdWS"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("urlIdWS")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUrlIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
-            setUrlIdWS(refVal_setUrlIdWS);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("userIdWS"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("userIdWS")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setUserIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
-            setUserIdWS(refVal_setUserIdWS);
-            
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            if(field.first == _XPLATSTR("urlIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrlIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrlIdWS);
+                    setUrlIdWS(refVal_setUrlIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            if(field.first == _XPLATSTR("userIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUserIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUserIdWS);
+                    setUserIdWS(refVal_setUserIdWS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("tenantIdWS")):
+            if(field.first == _XPLATSTR("tenantIdWS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setTenantIdWS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setTenantIdWS);
+                    setTenantIdWS(refVal_setTenantIdWS);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("tenantIdWS"))))
+    return ok;
+}
+
+void UserPresenceData::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("urlIdWS")), m_UrlIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("userIdWS")), m_UserIdWS);
+    }
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("tenantIdWS")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("tenantIdWS")), m_TenantIdWS);
+    }
+}
+
+bool UserPresenceData::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setTenantIdWS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setTenantIdWS);
-            setTenantIdWS(refVal_setTenantIdWS);
-            
+        case ModelBase::fieldHash(_XPLATSTR("urlIdWS")):
+            {
+                utility::string_t refVal_setUrlIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrlIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrlIdWS(refVal_setUrlIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("userIdWS")):
+            {
+                utility::string_t refVal_setUserIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setUserIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUserIdWS(refVal_setUserIdWS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("tenantIdWS")):
+            {
+                utility::string_t refVal_setTenantIdWS;
+                if(!ModelBase::readBinary(reader, field, refVal_setTenantIdWS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setTenantIdWS(refVal_setTenantIdWS);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserPresenceData::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -105,15 +209,15 @@ void UserPresenceData::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_UrlIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UrlIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("urlIdWS")), m_UrlIdWS));
     }
-    if(m_UserIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_UserIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("userIdWS")), m_UserIdWS));
     }
-    if(m_TenantIdWSIsSet)
+    if(m_FieldsSet.test(FieldBit_TenantIdWS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("tenantIdWS")), m_TenantIdWS));
     }
@@ -159,17 +263,17 @@ utility::string_t UserPresenceData::getUrlIdWS() const
 void UserPresenceData::setUrlIdWS(const utility::string_t& value)
 {
     m_UrlIdWS = value;
-    m_UrlIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UrlIdWS);
 }
 
 bool UserPresenceData::urlIdWSIsSet() const
 {
-    return m_UrlIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UrlIdWS);
 }
 
 void UserPresenceData::unsetUrlIdWS()
 {
-    m_UrlIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UrlIdWS);
 }
 utility::string_t UserPresenceData::getUserIdWS() const
 {
@@ -180,17 +284,17 @@ utility::string_t UserPresenceData::getUserIdWS() const
 void UserPresenceData::setUserIdWS(const utility::string_t& value)
 {
     m_UserIdWS = value;
-    m_UserIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_UserIdWS);
 }
 
 bool UserPresenceData::userIdWSIsSet() const
 {
-    return m_UserIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_UserIdWS);
 }
 
 void UserPresenceData::unsetUserIdWS()
 {
-    m_UserIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_UserIdWS);
 }
 utility::string_t UserPresenceData::getTenantIdWS() const
 {
@@ -201,17 +305,17 @@ utility::string_t UserPresenceData::getTenantIdWS() const
 void UserPresenceData::setTenantIdWS(const utility::string_t& value)
 {
     m_TenantIdWS = value;
-    m_TenantIdWSIsSet = true;
+    m_FieldsSet.set(FieldBit_TenantIdWS);
 }
 
 bool UserPresenceData::tenantIdWSIsSet() const
 {
-    return m_TenantIdWSIsSet;
+    return m_FieldsSet.test(FieldBit_TenantIdWS);
 }
 
 void UserPresenceData::unsetTenantIdWS()
 {
-    m_TenantIdWSIsSet = false;
+    m_FieldsSet.reset(FieldBit_TenantIdWS);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 UserReactsResponse::UserReactsResponse()
 {
-    m_StatusIsSet = false;
-    m_ReactsIsSet = false;
 }
 
 UserReactsResponse::~UserReactsResponse()
@@ -36,12 +34,12 @@ void UserReactsResponse::validate()
 web::json::value UserReactsResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_ReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_Reacts))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("reacts"))] = ModelBase::toJson(m_Reacts);
@@ -50,32 +48,119 @@ web::json::value UserReactsResponse::toJson() const
     return val;
 }
 
+void UserReactsResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Reacts))
+    {
+        
+        writer.key(_XPLATSTR("reacts"));
+        ModelBase::writeJson(writer, m_Reacts);
+    }
+
+    writer.endObject();
+}
+
 bool UserReactsResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("reacts")):
+            if(field.first == _XPLATSTR("reacts"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::map<utility::string_t, std::map<utility::string_t, bool>> refVal_setReacts;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setReacts);
+                    setReacts(refVal_setReacts);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("reacts"))))
+    return ok;
+}
+
+void UserReactsResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("reacts")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_Reacts))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("reacts")), m_Reacts);
+    }
+}
+
+bool UserReactsResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::map<utility::string_t, std::map<utility::string_t, bool>> refVal_setReacts;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setReacts);
-            setReacts(refVal_setReacts);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("reacts")):
+            {
+                std::map<utility::string_t, std::map<utility::string_t, bool>> refVal_setReacts;
+                if(!ModelBase::readBinary(reader, field, refVal_setReacts))
+                {
+                    ok = false;
+                    continue;
+                }
+                setReacts(refVal_setReacts);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserReactsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void UserReactsResponse::toMultipart(std::shared_ptr<MultipartFormData> multipar
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_ReactsIsSet)
+    if(m_FieldsSet.test(FieldBit_Reacts))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("reacts")), m_Reacts));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<APIStatus> UserReactsResponse::getStatus() const
 void UserReactsResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool UserReactsResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void UserReactsResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 std::map<utility::string_t, std::map<utility::string_t, bool>> UserReactsResponse::getReacts() const
 {
@@ -150,17 +235,17 @@ std::map<utility::string_t, std::map<utility::string_t, bool>> UserReactsRespons
 void UserReactsResponse::setReacts(const std::map<utility::string_t, std::map<utility::string_t, bool>>& value)
 {
     m_Reacts = value;
-    m_ReactsIsSet = true;
+    m_FieldsSet.set(FieldBit_Reacts);
 }
 
 bool UserReactsResponse::reactsIsSet() const
 {
-    return m_ReactsIsSet;
+    return m_FieldsSet.test(FieldBit_Reacts);
 }
 
 void UserReactsResponse::unsetReacts()
 {
-    m_ReactsIsSet = false;
+    m_FieldsSet.reset(FieldBit_Reacts);
 }
 
 }
@@ -20,8 +20,6 @@ namespace model {
 
 UserSearchSectionResult::UserSearchSectionResult()
 {
-    m_SectionIsSet = false;
-    m_UsersIsSet = false;
 }
 
 UserSearchSectionResult::~UserSearchSectionResult()
@@ -36,12 +34,12 @@ void UserSearchSectionResult::validate()
 web::json::value UserSearchSectionResult::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_SectionIsSet)
+    if(m_FieldsSet.test(FieldBit_Section))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("section"))] = ModelBase::toJson(m_Section);
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("users"))] = ModelBase::toJson(m_Users);
@@ -50,32 +48,119 @@ web::json::value UserSearchSectionResult::toJson() const
     return val;
 }
 
+void UserSearchSectionResult::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Section))
+    {
+        
+        writer.key(_XPLATSTR("section"));
+        ModelBase::writeJson(writer, m_Section);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        writer.key(_XPLATSTR("users"));
+        ModelBase::writeJson(writer, m_Users);
+    }
+
+    writer.endObject();
+}
+
 bool UserSearchSectionResult::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("section"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("section")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<UserSearchSection> refVal_setSection;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSection);
-            setSection(refVal_setSection);
-            
+        case ModelBase::fieldHash(_XPLATSTR("section")):
+            if(field.first == _XPLATSTR("section"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<UserSearchSection> refVal_setSection;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSection);
+                    setSection(refVal_setSection);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            if(field.first == _XPLATSTR("users"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<UserSearchResult>> refVal_setUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
+                    setUsers(refVal_setUsers);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("users"))))
+    return ok;
+}
+
+void UserSearchSectionResult::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Section))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("users")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("section")), m_Section);
+    }
+    if(m_FieldsSet.test(FieldBit_Users))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("users")), m_Users);
+    }
+}
+
+bool UserSearchSectionResult::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            std::vector<std::shared_ptr<UserSearchResult>> refVal_setUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsers);
-            setUsers(refVal_setUsers);
-            
+        case ModelBase::fieldHash(_XPLATSTR("section")):
+            {
+                std::shared_ptr<UserSearchSection> refVal_setSection;
+                if(!ModelBase::readBinary(reader, field, refVal_setSection))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSection(refVal_setSection);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("users")):
+            {
+                std::vector<std::shared_ptr<UserSearchResult>> refVal_setUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsers(refVal_setUsers);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserSearchSectionResult::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -85,11 +170,11 @@ void UserSearchSectionResult::toMultipart(std::shared_ptr<MultipartFormData> mul
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_SectionIsSet)
+    if(m_FieldsSet.test(FieldBit_Section))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("section")), m_Section));
     }
-    if(m_UsersIsSet)
+    if(m_FieldsSet.test(FieldBit_Users))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("users")), m_Users));
     }
@@ -129,17 +214,17 @@ std::shared_ptr<UserSearchSection> UserSearchSectionResult::getSection() const
 void UserSearchSectionResult::setSection(const std::shared_ptr<UserSearchSection>& value)
 {
     m_Section = value;
-    m_SectionIsSet = true;
+    m_FieldsSet.set(FieldBit_Section);
 }
 
 bool UserSearchSectionResult::sectionIsSet() const
 {
-    return m_SectionIsSet;
+    return m_FieldsSet.test(FieldBit_Section);
 }
 
 void UserSearchSectionResult::unsetSection()
 {
-    m_SectionIsSet = false;
+    m_FieldsSet.reset(FieldBit_Section);
 }
 std::vector<std::shared_ptr<UserSearchResult>> UserSearchSectionResult::getUsers() const
 {
@@ -150,17 +235,17 @@ std::vector<std::shared_ptr<UserSearchResult>> UserSearchSectionResult::getUsers
 void UserSearchSectionResult::setUsers(const std::vector<std::shared_ptr<UserSearchResult>>& value)
 {
     m_Users = value;
-    m_UsersIsSet = true;
+    m_FieldsSet.set(FieldBit_Users);
 }
 
 bool UserSearchSectionResult::usersIsSet() const
 {
-    return m_UsersIsSet;
+    return m_FieldsSet.test(FieldBit_Users);
 }
 
 void UserSearchSectionResult::unsetUsers()
 {
-    m_UsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_Users);
 }
 
 }
@@ -20,26 +20,10 @@ namespace model {
 
 UserSessionInfo::UserSessionInfo()
 {
-    m_Id = utility::conversions::to_string_t("");
-    m_IdIsSet = false;
     m_Authorized = false;
-    m_AuthorizedIsSet = false;
-    m_BadgesIsSet = false;
-    m_DisplayLabel = utility::conversions::to_string_t("");
-    m_DisplayLabelIsSet = false;
-    m_DisplayName = utility::conversions::to_string_t("");
-    m_DisplayNameIsSet = false;
-    m_GroupIdsIsSet = false;
     m_HasBlockedUsers = false;
-    m_HasBlockedUsersIsSet = false;
     m_IsAnonSession = false;
-    m_IsAnonSessionIsSet = false;
     m_NeedsTOS = false;
-    m_NeedsTOSIsSet = false;
-    m_Username = utility::conversions::to_string_t("");
-    m_UsernameIsSet = false;
-    m_WebsiteUrl = utility::conversions::to_string_t("");
-    m_WebsiteUrlIsSet = false;
 }
 
 UserSessionInfo::~UserSessionInfo()
@@ -54,72 +38,72 @@ void UserSessionInfo::validate()
 web::json::value UserSessionInfo::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("id"))] = ModelBase::toJson(m_Id);
     }
-    if(m_AuthorizedIsSet)
+    if(m_FieldsSet.test(FieldBit_Authorized))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("authorized"))] = ModelBase::toJson(m_Authorized);
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))] = ModelBase::toJson(m_AvatarSrc);
     }
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("badges"))] = ModelBase::toJson(m_Badges);
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayLabel"))] = ModelBase::toJson(m_DisplayLabel);
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("displayName"))] = ModelBase::toJson(m_DisplayName);
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("email"))] = ModelBase::toJson(m_Email);
     }
-    if(m_GroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("groupIds"))] = ModelBase::toJson(m_GroupIds);
     }
-    if(m_HasBlockedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers"))] = ModelBase::toJson(m_HasBlockedUsers);
     }
-    if(m_IsAnonSessionIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAnonSession))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isAnonSession"))] = ModelBase::toJson(m_IsAnonSession);
     }
-    if(m_NeedsTOSIsSet)
+    if(m_FieldsSet.test(FieldBit_NeedsTOS))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("needsTOS"))] = ModelBase::toJson(m_NeedsTOS);
     }
-    if(m_SessionId.has_value())
+    if(m_FieldsSet.test(FieldBit_SessionId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("sessionId"))] = ModelBase::toJson(m_SessionId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("sessionId"))] = ModelBase::toJson(m_SessionId);
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("username"))] = ModelBase::toJson(m_Username);
     }
-    if(m_WebsiteUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))] = ModelBase::toJson(m_WebsiteUrl);
@@ -128,164 +112,527 @@ web::json::value UserSessionInfo::toJson() const
     return val;
 }
 
+void UserSessionInfo::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Id))
+    {
+        
+        writer.key(_XPLATSTR("id"));
+        ModelBase::writeJson(writer, m_Id);
+    }
+    if(m_FieldsSet.test(FieldBit_Authorized))
+    {
+        
+        writer.key(_XPLATSTR("authorized"));
+        ModelBase::writeJson(writer, m_Authorized);
+    }
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
+    {
+        
+        writer.key(_XPLATSTR("avatarSrc"));
+        ModelBase::writeJson(writer, m_AvatarSrc);
+    }
+    if(m_FieldsSet.test(FieldBit_Badges))
+    {
+        
+        writer.key(_XPLATSTR("badges"));
+        ModelBase::writeJson(writer, m_Badges);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
+    {
+        
+        writer.key(_XPLATSTR("displayLabel"));
+        ModelBase::writeJson(writer, m_DisplayLabel);
+    }
+    if(m_FieldsSet.test(FieldBit_DisplayName))
+    {
+        
+        writer.key(_XPLATSTR("displayName"));
+        ModelBase::writeJson(writer, m_DisplayName);
+    }
+    if(m_FieldsSet.test(FieldBit_Email))
+    {
+        
+        writer.key(_XPLATSTR("email"));
+        ModelBase::writeJson(writer, m_Email);
+    }
+    if(m_FieldsSet.test(FieldBit_GroupIds))
+    {
+        
+        writer.key(_XPLATSTR("groupIds"));
+        ModelBase::writeJson(writer, m_GroupIds);
+    }
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
+    {
+        
+        writer.key(_XPLATSTR("hasBlockedUsers"));
+        ModelBase::writeJson(writer, m_HasBlockedUsers);
+    }
+    if(m_FieldsSet.test(FieldBit_IsAnonSession))
+    {
+        
+        writer.key(_XPLATSTR("isAnonSession"));
+        ModelBase::writeJson(writer, m_IsAnonSession);
+    }
+    if(m_FieldsSet.test(FieldBit_NeedsTOS))
+    {
+        
+        writer.key(_XPLATSTR("needsTOS"));
+        ModelBase::writeJson(writer, m_NeedsTOS);
+    }
+    if(m_FieldsSet.test(FieldBit_SessionId))
+    {
+        
+        writer.key(_XPLATSTR("sessionId"));
+        ModelBase::writeJson(writer, m_SessionId);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        writer.key(_XPLATSTR("username"));
+        ModelBase::writeJson(writer, m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
+    {
+        
+        writer.key(_XPLATSTR("websiteUrl"));
+        ModelBase::writeJson(writer, m_WebsiteUrl);
+    }
+
+    writer.endObject();
+}
+
 bool UserSessionInfo::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("id"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("id")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setId);
-            setId(refVal_setId);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("authorized"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("authorized")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            bool refVal_setAuthorized;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAuthorized);
-            setAuthorized(refVal_setAuthorized);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            if(field.first == _XPLATSTR("id"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setId);
+                    setId(refVal_setId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("authorized")):
+            if(field.first == _XPLATSTR("authorized"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setAuthorized;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAuthorized);
+                    setAuthorized(refVal_setAuthorized);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            if(field.first == _XPLATSTR("avatarSrc"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setAvatarSrc;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
+                    setAvatarSrc(refVal_setAvatarSrc);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            if(field.first == _XPLATSTR("badges"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
+                    setBadges(refVal_setBadges);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            if(field.first == _XPLATSTR("displayLabel"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayLabel;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
+                    setDisplayLabel(refVal_setDisplayLabel);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            if(field.first == _XPLATSTR("displayName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setDisplayName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
+                    setDisplayName(refVal_setDisplayName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            if(field.first == _XPLATSTR("email"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
+                    setEmail(refVal_setEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            if(field.first == _XPLATSTR("groupIds"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::vector<utility::string_t> refVal_setGroupIds;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
+                    setGroupIds(refVal_setGroupIds);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")):
+            if(field.first == _XPLATSTR("hasBlockedUsers"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setHasBlockedUsers;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setHasBlockedUsers);
+                    setHasBlockedUsers(refVal_setHasBlockedUsers);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isAnonSession")):
+            if(field.first == _XPLATSTR("isAnonSession"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsAnonSession;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsAnonSession);
+                    setIsAnonSession(refVal_setIsAnonSession);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("needsTOS")):
+            if(field.first == _XPLATSTR("needsTOS"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setNeedsTOS;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setNeedsTOS);
+                    setNeedsTOS(refVal_setNeedsTOS);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("sessionId")):
+            if(field.first == _XPLATSTR("sessionId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSessionId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSessionId);
+                    setSessionId(refVal_setSessionId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            if(field.first == _XPLATSTR("username"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUsername;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
+                    setUsername(refVal_setUsername);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            if(field.first == _XPLATSTR("websiteUrl"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setWebsiteUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
+                    setWebsiteUrl(refVal_setWebsiteUrl);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("avatarSrc"))))
+    return ok;
+}
+
+void UserSessionInfo::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Id))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("avatarSrc")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setAvatarSrc;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setAvatarSrc);
-            setAvatarSrc(refVal_setAvatarSrc);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("id")), m_Id);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("badges"))))
+    if(m_FieldsSet.test(FieldBit_Authorized))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("badges")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setBadges);
-            setBadges(refVal_setBadges);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("authorized")), m_Authorized);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayLabel"))))
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayLabel")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayLabel;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayLabel);
-            setDisplayLabel(refVal_setDisplayLabel);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("avatarSrc")), m_AvatarSrc);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("displayName"))))
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("displayName")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setDisplayName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setDisplayName);
-            setDisplayName(refVal_setDisplayName);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("badges")), m_Badges);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("email"))))
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("email")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEmail);
-            setEmail(refVal_setEmail);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayLabel")), m_DisplayLabel);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("groupIds"))))
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("groupIds")));
-        if(!fieldValue.is_null())
-        {
-            std::vector<utility::string_t> refVal_setGroupIds;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setGroupIds);
-            setGroupIds(refVal_setGroupIds);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("displayName")), m_DisplayName);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers"))))
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setHasBlockedUsers;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setHasBlockedUsers);
-            setHasBlockedUsers(refVal_setHasBlockedUsers);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("email")), m_Email);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isAnonSession"))))
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isAnonSession")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsAnonSession;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsAnonSession);
-            setIsAnonSession(refVal_setIsAnonSession);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("groupIds")), m_GroupIds);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("needsTOS"))))
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("needsTOS")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setNeedsTOS;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setNeedsTOS);
-            setNeedsTOS(refVal_setNeedsTOS);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")), m_HasBlockedUsers);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sessionId"))))
+    if(m_FieldsSet.test(FieldBit_IsAnonSession))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sessionId")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setSessionId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSessionId);
-            setSessionId(refVal_setSessionId);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isAnonSession")), m_IsAnonSession);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("username"))))
+    if(m_FieldsSet.test(FieldBit_NeedsTOS))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("username")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setUsername;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUsername);
-            setUsername(refVal_setUsername);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("needsTOS")), m_NeedsTOS);
+    }
+    if(m_FieldsSet.test(FieldBit_SessionId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sessionId")), m_SessionId);
+    }
+    if(m_FieldsSet.test(FieldBit_Username))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("username")), m_Username);
+    }
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("websiteUrl")), m_WebsiteUrl);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("websiteUrl"))))
+}
+
+bool UserSessionInfo::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("websiteUrl")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            utility::string_t refVal_setWebsiteUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWebsiteUrl);
-            setWebsiteUrl(refVal_setWebsiteUrl);
-            
+        case ModelBase::fieldHash(_XPLATSTR("id")):
+            {
+                utility::string_t refVal_setId;
+                if(!ModelBase::readBinary(reader, field, refVal_setId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setId(refVal_setId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("authorized")):
+            {
+                bool refVal_setAuthorized;
+                if(!ModelBase::readBinary(reader, field, refVal_setAuthorized))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAuthorized(refVal_setAuthorized);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("avatarSrc")):
+            {
+                utility::string_t refVal_setAvatarSrc;
+                if(!ModelBase::readBinary(reader, field, refVal_setAvatarSrc))
+                {
+                    ok = false;
+                    continue;
+                }
+                setAvatarSrc(refVal_setAvatarSrc);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("badges")):
+            {
+                std::vector<std::shared_ptr<CommentUserBadgeInfo>> refVal_setBadges;
+                if(!ModelBase::readBinary(reader, field, refVal_setBadges))
+                {
+                    ok = false;
+                    continue;
+                }
+                setBadges(refVal_setBadges);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayLabel")):
+            {
+                utility::string_t refVal_setDisplayLabel;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayLabel))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayLabel(refVal_setDisplayLabel);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("displayName")):
+            {
+                utility::string_t refVal_setDisplayName;
+                if(!ModelBase::readBinary(reader, field, refVal_setDisplayName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setDisplayName(refVal_setDisplayName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("email")):
+            {
+                utility::string_t refVal_setEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEmail(refVal_setEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("groupIds")):
+            {
+                std::vector<utility::string_t> refVal_setGroupIds;
+                if(!ModelBase::readBinary(reader, field, refVal_setGroupIds))
+                {
+                    ok = false;
+                    continue;
+                }
+                setGroupIds(refVal_setGroupIds);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("hasBlockedUsers")):
+            {
+                bool refVal_setHasBlockedUsers;
+                if(!ModelBase::readBinary(reader, field, refVal_setHasBlockedUsers))
+                {
+                    ok = false;
+                    continue;
+                }
+                setHasBlockedUsers(refVal_setHasBlockedUsers);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isAnonSession")):
+            {
+                bool refVal_setIsAnonSession;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsAnonSession))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsAnonSession(refVal_setIsAnonSession);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("needsTOS")):
+            {
+                bool refVal_setNeedsTOS;
+                if(!ModelBase::readBinary(reader, field, refVal_setNeedsTOS))
+                {
+                    ok = false;
+                    continue;
+                }
+                setNeedsTOS(refVal_setNeedsTOS);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("sessionId")):
+            {
+                utility::string_t refVal_setSessionId;
+                if(!ModelBase::readBinary(reader, field, refVal_setSessionId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSessionId(refVal_setSessionId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("username")):
+            {
+                utility::string_t refVal_setUsername;
+                if(!ModelBase::readBinary(reader, field, refVal_setUsername))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUsername(refVal_setUsername);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("websiteUrl")):
+            {
+                utility::string_t refVal_setWebsiteUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setWebsiteUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWebsiteUrl(refVal_setWebsiteUrl);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void UserSessionInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -295,59 +642,59 @@ void UserSessionInfo::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_IdIsSet)
+    if(m_FieldsSet.test(FieldBit_Id))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("id")), m_Id));
     }
-    if(m_AuthorizedIsSet)
+    if(m_FieldsSet.test(FieldBit_Authorized))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("authorized")), m_Authorized));
     }
-    if(m_AvatarSrc.has_value())
+    if(m_FieldsSet.test(FieldBit_AvatarSrc))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("avatarSrc")), m_AvatarSrc));
     }
-    if(m_BadgesIsSet)
+    if(m_FieldsSet.test(FieldBit_Badges))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("badges")), m_Badges));
     }
-    if(m_DisplayLabelIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayLabel))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayLabel")), m_DisplayLabel));
     }
-    if(m_DisplayNameIsSet)
+    if(m_FieldsSet.test(FieldBit_DisplayName))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("displayName")), m_DisplayName));
     }
-    if(m_Email.has_value())
+    if(m_FieldsSet.test(FieldBit_Email))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("email")), m_Email));
     }
-    if(m_GroupIdsIsSet)
+    if(m_FieldsSet.test(FieldBit_GroupIds))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("groupIds")), m_GroupIds));
     }
-    if(m_HasBlockedUsersIsSet)
+    if(m_FieldsSet.test(FieldBit_HasBlockedUsers))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("hasBlockedUsers")), m_HasBlockedUsers));
     }
-    if(m_IsAnonSessionIsSet)
+    if(m_FieldsSet.test(FieldBit_IsAnonSession))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isAnonSession")), m_IsAnonSession));
     }
-    if(m_NeedsTOSIsSet)
+    if(m_FieldsSet.test(FieldBit_NeedsTOS))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("needsTOS")), m_NeedsTOS));
     }
-    if(m_SessionId.has_value())
+    if(m_FieldsSet.test(FieldBit_SessionId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sessionId")), m_SessionId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sessionId")), m_SessionId));
     }
-    if(m_UsernameIsSet)
+    if(m_FieldsSet.test(FieldBit_Username))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("username")), m_Username));
     }
-    if(m_WebsiteUrlIsSet)
+    if(m_FieldsSet.test(FieldBit_WebsiteUrl))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("websiteUrl")), m_WebsiteUrl));
     }
@@ -459,17 +806,17 @@ utility::string_t UserSessionInfo::getId() const
 void UserSessionInfo::setId(const utility::string_t& value)
 {
     m_Id = value;
-    m_IdIsSet = true;
+    m_FieldsSet.set(FieldBit_Id);
 }
 
 bool UserSessionInfo::idIsSet() const
 {
-    return m_IdIsSet;
+    return m_FieldsSet.test(FieldBit_Id);
 }
 
 void UserSessionInfo::unsetId()
 {
-    m_IdIsSet = false;
+    m_FieldsSet.reset(FieldBit_Id);
 }
 bool UserSessionInfo::isAuthorized() const
 {
@@ -479,37 +826,38 @@ bool UserSessionInfo::isAuthorized() const
 void UserSessionInfo::setAuthorized(bool value)
 {
     m_Authorized = value;
-    m_AuthorizedIsSet = true;
+    m_FieldsSet.set(FieldBit_Authorized);
 }
 
 bool UserSessionInfo::authorizedIsSet() const
 {
-    return m_AuthorizedIsSet;
+    return m_FieldsSet.test(FieldBit_Authorized);
 }
 
 void UserSessionInfo::unsetAuthorized()
 {
-    m_AuthorizedIsSet = false;
+    m_FieldsSet.reset(FieldBit_Authorized);
 }
 utility::string_t UserSessionInfo::getAvatarSrc() const
 {
-    return m_AvatarSrc.get();
+    return m_AvatarSrc;
 }
 
 
 void UserSessionInfo::setAvatarSrc(const utility::string_t& value)
 {
     m_AvatarSrc = value;
+    m_FieldsSet.set(FieldBit_AvatarSrc);
 }
 
 bool UserSessionInfo::avatarSrcIsSet() const
 {
-    return m_AvatarSrc.has_value();
+    return m_FieldsSet.test(FieldBit_AvatarSrc);
 }
 
 void UserSessionInfo::unsetAvatarSrc()
 {
-    m_AvatarSrc.reset();
+    m_FieldsSet.reset(FieldBit_AvatarSrc);
 }
 std::vector<std::shared_ptr<CommentUserBadgeInfo>> UserSessionInfo::getBadges() const
 {
@@ -520,17 +868,17 @@ std::vector<std::shared_ptr<CommentUserBadgeInfo>> UserSessionInfo::getBadges()
 void UserSessionInfo::setBadges(const std::vector<std::shared_ptr<CommentUserBadgeInfo>>& value)
 {
     m_Badges = value;
-    m_BadgesIsSet = true;
+    m_FieldsSet.set(FieldBit_Badges);
 }
 
 bool UserSessionInfo::badgesIsSet() const
 {
-    return m_BadgesIsSet;
+    return m_FieldsSet.test(FieldBit_Badges);
 }
 
 void UserSessionInfo::unsetBadges()
 {
-    m_BadgesIsSet = false;
+    m_FieldsSet.reset(FieldBit_Badges);
 }
 utility::string_t UserSessionInfo::getDisplayLabel() const
 {
@@ -541,17 +889,17 @@ utility::string_t UserSessionInfo::getDisplayLabel() const
 void UserSessionInfo::setDisplayLabel(const utility::string_t& value)
 {
     m_DisplayLabel = value;
-    m_DisplayLabelIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayLabel);
 }
 
 bool UserSessionInfo::displayLabelIsSet() const
 {
-    return m_DisplayLabelIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayLabel);
 }
 
 void UserSessionInfo::unsetDisplayLabel()
 {
-    m_DisplayLabelIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayLabel);
 }
 utility::string_t UserSessionInfo::getDisplayName() const
 {
@@ -562,37 +910,38 @@ utility::string_t UserSessionInfo::getDisplayName() const
 void UserSessionInfo::setDisplayName(const utility::string_t& value)
 {
     m_DisplayName = value;
-    m_DisplayNameIsSet = true;
+    m_FieldsSet.set(FieldBit_DisplayName);
 }
 
 bool UserSessionInfo::displayNameIsSet() const
 {
-    return m_DisplayNameIsSet;
+    return m_FieldsSet.test(FieldBit_DisplayName);
 }
 
 void UserSessionInfo::unsetDisplayName()
 {
-    m_DisplayNameIsSet = false;
+    m_FieldsSet.reset(FieldBit_DisplayName);
 }
 utility::string_t UserSessionInfo::getEmail() const
 {
-    return m_Email.get();
+    return m_Email;
 }
 
 
 void UserSessionInfo::setEmail(const utility::string_t& value)
 {
     m_Email = value;
+    m_FieldsSet.set(FieldBit_Email);
 }
 
 bool UserSessionInfo::emailIsSet() const
 {
-    return m_Email.has_value();
+    return m_FieldsSet.test(FieldBit_Email);
 }
 
 void UserSessionInfo::unsetEmail()
 {
-    m_Email.reset();
+    m_FieldsSet.reset(FieldBit_Email);
 }
 std::vector<utility::string_t> UserSessionInfo::getGroupIds() const
 {
@@ -603,17 +952,17 @@ std::vector<utility::string_t> UserSessionInfo::getGroupIds() const
 void UserSessionInfo::setGroupIds(const std::vector<utility::string_t>& value)
 {
     m_GroupIds = value;
-    m_GroupIdsIsSet = true;
+    m_FieldsSet.set(FieldBit_GroupIds);
 }
 
 bool UserSessionInfo::groupIdsIsSet() const
 {
-    return m_GroupIdsIsSet;
+    return m_FieldsSet.test(FieldBit_GroupIds);
 }
 
 void UserSessionInfo::unsetGroupIds()
 {
-    m_GroupIdsIsSet = false;
+    m_FieldsSet.reset(FieldBit_GroupIds);
 }
 bool UserSessionInfo::isHasBlockedUsers() const
 {
@@ -623,17 +972,17 @@ bool UserSessionInfo::isHasBlockedUsers() const
 void UserSessionInfo::setHasBlockedUsers(bool value)
 {
     m_HasBlockedUsers = value;
-    m_HasBlockedUsersIsSet = true;
+    m_FieldsSet.set(FieldBit_HasBlockedUsers);
 }
 
 bool UserSessionInfo::hasBlockedUsersIsSet() const
 {
-    return m_HasBlockedUsersIsSet;
+    return m_FieldsSet.test(FieldBit_HasBlockedUsers);
 }
 
 void UserSessionInfo::unsetHasBlockedUsers()
 {
-    m_HasBlockedUsersIsSet = false;
+    m_FieldsSet.reset(FieldBit_HasBlockedUsers);
 }
 bool UserSessionInfo::isIsAnonSession() const
 {
@@ -643,17 +992,17 @@ bool UserSessionInfo::isIsAnonSession() const
 void UserSessionInfo::setIsAnonSession(bool value)
 {
     m_IsAnonSession = value;
-    m_IsAnonSessionIsSet = true;
+    m_FieldsSet.set(FieldBit_IsAnonSession);
 }
 
 bool UserSessionInfo::isAnonSessionIsSet() const
 {
-    return m_IsAnonSessionIsSet;
+    return m_FieldsSet.test(FieldBit_IsAnonSession);
 }
 
 void UserSessionInfo::unsetIsAnonSession()
 {
-    m_IsAnonSessionIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsAnonSession);
 }
 bool UserSessionInfo::isNeedsTOS() const
 {
@@ -663,37 +1012,38 @@ bool UserSessionInfo::isNeedsTOS() const
 void UserSessionInfo::setNeedsTOS(bool value)
 {
     m_NeedsTOS = value;
-    m_NeedsTOSIsSet = true;
+    m_FieldsSet.set(FieldBit_NeedsTOS);
 }
 
 bool UserSessionInfo::needsTOSIsSet() const
 {
-    return m_NeedsTOSIsSet;
+    return m_FieldsSet.test(FieldBit_NeedsTOS);
 }
 
 void UserSessionInfo::unsetNeedsTOS()
 {
-    m_NeedsTOSIsSet = false;
+    m_FieldsSet.reset(FieldBit_NeedsTOS);
 }
 utility::string_t UserSessionInfo::getSessionId() const
 {
-    return m_SessionId.get();
+    return m_SessionId;
 }
 
 
 void UserSessionInfo::setSessionId(const utility::string_t& value)
 {
     m_SessionId = value;
+    m_FieldsSet.set(FieldBit_SessionId);
 }
 
 bool UserSessionInfo::sessionIdIsSet() const
 {
-    return m_SessionId.has_value();
+    return m_FieldsSet.test(FieldBit_SessionId);
 }
 
 void UserSessionInfo::unsetSessionId()
 {
-    m_SessionId.reset();
+    m_FieldsSet.reset(FieldBit_SessionId);
 }
 utility::string_t UserSessionInfo::getUsername() const
 {
@@ -704,17 +1054,17 @@ utility::string_t UserSessionInfo::getUsername() const
 void UserSessionInfo::setUsername(const utility::string_t& value)
 {
     m_Username = value;
-    m_UsernameIsSet = true;
+    m_FieldsSet.set(FieldBit_Username);
 }
 
 bool UserSessionInfo::usernameIsSet() const
 {
-    return m_UsernameIsSet;
+    return m_FieldsSet.test(FieldBit_Username);
 }
 
 void UserSessionInfo::unsetUsername()
 {
-    m_UsernameIsSet = false;
+    m_FieldsSet.reset(FieldBit_Username);
 }
 utility::string_t UserSessionInfo::getWebsiteUrl() const
 {
@@ -725,17 +1075,17 @@ utility::string_t UserSessionInfo::getWebsiteUrl() const
 void UserSessionInfo::setWebsiteUrl(const utility::string_t& value)
 {
     m_WebsiteUrl = value;
-    m_WebsiteUrlIsSet = true;
+    m_FieldsSet.set(FieldBit_WebsiteUrl);
 }
 
 bool UserSessionInfo::websiteUrlIsSet() const
 {
-    return m_WebsiteUrlIsSet;
+    return m_FieldsSet.test(FieldBit_WebsiteUrl);
 }
 
 void UserSessionInfo::unsetWebsiteUrl()
 {
-    m_WebsiteUrlIsSet = false;
+    m_FieldsSet.reset(FieldBit_WebsiteUrl);
 }
 
 }
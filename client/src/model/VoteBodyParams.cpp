@@ -20,7 +20,6 @@ namespace model {
 
 VoteBodyParams::VoteBodyParams()
 {
-    m_VoteDirIsSet = false;
 }
 
 VoteBodyParams::~VoteBodyParams()
@@ -35,81 +34,217 @@ void VoteBodyParams::validate()
 web::json::value VoteBodyParams::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))] = ModelBase::toJson(m_CommenterEmail);
     }
-    if(m_CommenterName.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("commenterName"))] = ModelBase::toJson(m_CommenterName);
     }
-    if(m_VoteDirIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteDir))
     {
         
         utility::string_t refVal = fromVoteDirEnum(m_VoteDir);
         val[utility::conversions::to_string_t(_XPLATSTR("voteDir"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_Url.has_value())
+    if(m_FieldsSet.test(FieldBit_Url))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("url"))] = ModelBase::toJson(m_Url);
     }
 
     return val;
 }
 
+void VoteBodyParams::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
+    {
+        
+        writer.key(_XPLATSTR("commenterEmail"));
+        ModelBase::writeJson(writer, m_CommenterEmail);
+    }
+    if(m_FieldsSet.test(FieldBit_CommenterName))
+    {
+        
+        writer.key(_XPLATSTR("commenterName"));
+        ModelBase::writeJson(writer, m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_VoteDir))
+    {
+        
+        utility::string_t refVal = fromVoteDirEnum(m_VoteDir);
+        writer.key(_XPLATSTR("voteDir"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        writer.key(_XPLATSTR("url"));
+        ModelBase::writeJson(writer, m_Url);
+    }
+
+    writer.endObject();
+}
+
 bool VoteBodyParams::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterEmail"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterEmail")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setCommenterEmail;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
-            setCommenterEmail(refVal_setCommenterEmail);
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("commenterName"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("commenterName")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setCommenterName;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
-            setCommenterName(refVal_setCommenterName);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            if(field.first == _XPLATSTR("commenterEmail"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterEmail;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterEmail);
+                    setCommenterEmail(refVal_setCommenterEmail);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            if(field.first == _XPLATSTR("commenterName"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setCommenterName;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setCommenterName);
+                    setCommenterName(refVal_setCommenterName);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("voteDir")):
+            if(field.first == _XPLATSTR("voteDir"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setVoteDir;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVoteDir);
+                    setVoteDir(toVoteDirEnum(refVal_setVoteDir));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            if(field.first == _XPLATSTR("url"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setUrl;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
+                    setUrl(refVal_setUrl);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("voteDir"))))
+    return ok;
+}
+
+void VoteBodyParams::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("voteDir")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setVoteDir;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVoteDir);
-            
-            setVoteDir(toVoteDirEnum(refVal_setVoteDir));
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterEmail")), m_CommenterEmail);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("url"))))
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("url")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("commenterName")), m_CommenterName);
+    }
+    if(m_FieldsSet.test(FieldBit_VoteDir))
+    {
+        
+        utility::string_t refVal = fromVoteDirEnum(m_VoteDir);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("voteDir")), refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_Url))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("url")), m_Url);
+    }
+}
+
+bool VoteBodyParams::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            utility::string_t refVal_setUrl;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUrl);
-            setUrl(refVal_setUrl);
-            
+        case ModelBase::fieldHash(_XPLATSTR("commenterEmail")):
+            {
+                utility::string_t refVal_setCommenterEmail;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterEmail))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterEmail(refVal_setCommenterEmail);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("commenterName")):
+            {
+                utility::string_t refVal_setCommenterName;
+                if(!ModelBase::readBinary(reader, field, refVal_setCommenterName))
+                {
+                    ok = false;
+                    continue;
+                }
+                setCommenterName(refVal_setCommenterName);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("voteDir")):
+            {
+                utility::string_t refVal_setVoteDir;
+                if(!ModelBase::readBinary(reader, field, refVal_setVoteDir))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVoteDir(toVoteDirEnum(refVal_setVoteDir));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("url")):
+            {
+                utility::string_t refVal_setUrl;
+                if(!ModelBase::readBinary(reader, field, refVal_setUrl))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUrl(refVal_setUrl);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void VoteBodyParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -119,21 +254,21 @@ void VoteBodyParams::toMultipart(std::shared_ptr<MultipartFormData> multipart, c
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_CommenterEmail.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterEmail))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterEmail")), m_CommenterEmail));
     }
-    if(m_CommenterName.has_value())
+    if(m_FieldsSet.test(FieldBit_CommenterName))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("commenterName")), m_CommenterName));
     }
-    if(m_VoteDirIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteDir))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("voteDir")), fromVoteDirEnum(m_VoteDir)));
     }
-    if(m_Url.has_value())
+    if(m_FieldsSet.test(FieldBit_Url))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("url")), m_Url));
     }
 }
 
@@ -203,43 +338,45 @@ const utility::string_t VoteBodyParams::fromVoteDirEnum(const VoteDirEnum value)
 
 utility::string_t VoteBodyParams::getCommenterEmail() const
 {
-    return m_CommenterEmail.get();
+    return m_CommenterEmail;
 }
 
 
 void VoteBodyParams::setCommenterEmail(const utility::string_t& value)
 {
     m_CommenterEmail = value;
+    m_FieldsSet.set(FieldBit_CommenterEmail);
 }
 
 bool VoteBodyParams::commenterEmailIsSet() const
 {
-    return m_CommenterEmail.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterEmail);
 }
 
 void VoteBodyParams::unsetCommenterEmail()
 {
-    m_CommenterEmail.reset();
+    m_FieldsSet.reset(FieldBit_CommenterEmail);
 }
 utility::string_t VoteBodyParams::getCommenterName() const
 {
-    return m_CommenterName.get();
+    return m_CommenterName;
 }
 
 
 void VoteBodyParams::setCommenterName(const utility::string_t& value)
 {
     m_CommenterName = value;
+    m_FieldsSet.set(FieldBit_CommenterName);
 }
 
 bool VoteBodyParams::commenterNameIsSet() const
 {
-    return m_CommenterName.has_value();
+    return m_FieldsSet.test(FieldBit_CommenterName);
 }
 
 void VoteBodyParams::unsetCommenterName()
 {
-    m_CommenterName.reset();
+    m_FieldsSet.reset(FieldBit_CommenterName);
 }
 VoteBodyParams::VoteDirEnum VoteBodyParams::getVoteDir() const
 {
@@ -250,37 +387,38 @@ VoteBodyParams::VoteDirEnum VoteBodyParams::getVoteDir() const
 void VoteBodyParams::setVoteDir(const VoteDirEnum value)
 {
     m_VoteDir = value;
-    m_VoteDirIsSet = true;
+    m_FieldsSet.set(FieldBit_VoteDir);
 }
 
 bool VoteBodyParams::voteDirIsSet() const
 {
-    return m_VoteDirIsSet;
+    return m_FieldsSet.test(FieldBit_VoteDir);
 }
 
 void VoteBodyParams::unsetVoteDir()
 {
-    m_VoteDirIsSet = false;
+    m_FieldsSet.reset(FieldBit_VoteDir);
 }
 utility::string_t VoteBodyParams::getUrl() const
 {
-    return m_Url.get();
+    return m_Url;
 }
 
 
 void VoteBodyParams::setUrl(const utility::string_t& value)
 {
     m_Url = value;
+    m_FieldsSet.set(FieldBit_Url);
 }
 
 bool VoteBodyParams::urlIsSet() const
 {
-    return m_Url.has_value();
+    return m_FieldsSet.test(FieldBit_Url);
 }
 
 void VoteBodyParams::unsetUrl()
 {
-    m_Url.reset();
+    m_FieldsSet.reset(FieldBit_Url);
 }
 
 }
@@ -20,9 +20,7 @@ namespace model {
 
 VoteDeleteResponse::VoteDeleteResponse()
 {
-    m_StatusIsSet = false;
     m_WasPendingVote = false;
-    m_WasPendingVoteIsSet = false;
 }
 
 VoteDeleteResponse::~VoteDeleteResponse()
@@ -37,12 +35,12 @@ void VoteDeleteResponse::validate()
 web::json::value VoteDeleteResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(m_Status);
     }
-    if(m_WasPendingVoteIsSet)
+    if(m_FieldsSet.test(FieldBit_WasPendingVote))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("wasPendingVote"))] = ModelBase::toJson(m_WasPendingVote);
@@ -51,32 +49,119 @@ web::json::value VoteDeleteResponse::toJson() const
     return val;
 }
 
+void VoteDeleteResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_WasPendingVote))
+    {
+        
+        writer.key(_XPLATSTR("wasPendingVote"));
+        ModelBase::writeJson(writer, m_WasPendingVote);
+    }
+
+    writer.endObject();
+}
+
 bool VoteDeleteResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
+    {
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            std::shared_ptr<APIStatus> refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            setStatus(refVal_setStatus);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<APIStatus> refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(refVal_setStatus);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("wasPendingVote")):
+            if(field.first == _XPLATSTR("wasPendingVote"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setWasPendingVote;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setWasPendingVote);
+                    setWasPendingVote(refVal_setWasPendingVote);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("wasPendingVote"))))
+    return ok;
+}
+
+void VoteDeleteResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("wasPendingVote")));
-        if(!fieldValue.is_null())
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), m_Status);
+    }
+    if(m_FieldsSet.test(FieldBit_WasPendingVote))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("wasPendingVote")), m_WasPendingVote);
+    }
+}
+
+bool VoteDeleteResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
         {
-            bool refVal_setWasPendingVote;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setWasPendingVote);
-            setWasPendingVote(refVal_setWasPendingVote);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                std::shared_ptr<APIStatus> refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(refVal_setStatus);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("wasPendingVote")):
+            {
+                bool refVal_setWasPendingVote;
+                if(!ModelBase::readBinary(reader, field, refVal_setWasPendingVote))
+                {
+                    ok = false;
+                    continue;
+                }
+                setWasPendingVote(refVal_setWasPendingVote);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void VoteDeleteResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -86,11 +171,11 @@ void VoteDeleteResponse::toMultipart(std::shared_ptr<MultipartFormData> multipar
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), m_Status));
     }
-    if(m_WasPendingVoteIsSet)
+    if(m_FieldsSet.test(FieldBit_WasPendingVote))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("wasPendingVote")), m_WasPendingVote));
     }
@@ -130,17 +215,17 @@ std::shared_ptr<APIStatus> VoteDeleteResponse::getStatus() const
 void VoteDeleteResponse::setStatus(const std::shared_ptr<APIStatus>& value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool VoteDeleteResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void VoteDeleteResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 bool VoteDeleteResponse::isWasPendingVote() const
 {
@@ -150,17 +235,17 @@ bool VoteDeleteResponse::isWasPendingVote() const
 void VoteDeleteResponse::setWasPendingVote(bool value)
 {
     m_WasPendingVote = value;
-    m_WasPendingVoteIsSet = true;
+    m_FieldsSet.set(FieldBit_WasPendingVote);
 }
 
 bool VoteDeleteResponse::wasPendingVoteIsSet() const
 {
-    return m_WasPendingVoteIsSet;
+    return m_FieldsSet.test(FieldBit_WasPendingVote);
 }
 
 void VoteDeleteResponse::unsetWasPendingVote()
 {
-    m_WasPendingVoteIsSet = false;
+    m_FieldsSet.reset(FieldBit_WasPendingVote);
 }
 
 }
@@ -20,14 +20,7 @@ namespace model {
 
 VoteResponse::VoteResponse()
 {
-    m_StatusIsSet = false;
-    m_VoteId = utility::conversions::to_string_t("");
-    m_VoteIdIsSet = false;
     m_IsVerified = false;
-    m_IsVerifiedIsSet = false;
-    m_UserIsSet = false;
-    m_EditKey = utility::conversions::to_string_t("");
-    m_EditKeyIsSet = false;
 }
 
 VoteResponse::~VoteResponse()
@@ -42,29 +35,29 @@ void VoteResponse::validate()
 web::json::value VoteResponse::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         
         utility::string_t refVal = fromStatusEnum(m_Status);
         val[utility::conversions::to_string_t(_XPLATSTR("status"))] = ModelBase::toJson(refVal);
         
     }
-    if(m_VoteIdIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteId))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("voteId"))] = ModelBase::toJson(m_VoteId);
     }
-    if(m_IsVerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVerified))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("isVerified"))] = ModelBase::toJson(m_IsVerified);
     }
-    if(m_UserIsSet)
+    if(m_FieldsSet.test(FieldBit_User))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("user"))] = ModelBase::toJson(m_User);
     }
-    if(m_EditKeyIsSet)
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
         
         val[utility::conversions::to_string_t(_XPLATSTR("editKey"))] = ModelBase::toJson(m_EditKey);
@@ -73,66 +66,225 @@ web::json::value VoteResponse::toJson() const
     return val;
 }
 
+void VoteResponse::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_Status))
+    {
+        
+        utility::string_t refVal = fromStatusEnum(m_Status);
+        writer.key(_XPLATSTR("status"));
+        ModelBase::writeJson(writer, refVal);
+        
+    }
+    if(m_FieldsSet.test(FieldBit_VoteId))
+    {
+        
+        writer.key(_XPLATSTR("voteId"));
+        ModelBase::writeJson(writer, m_VoteId);
+    }
+    if(m_FieldsSet.test(FieldBit_IsVerified))
+    {
+        
+        writer.key(_XPLATSTR("isVerified"));
+        ModelBase::writeJson(writer, m_IsVerified);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        writer.key(_XPLATSTR("user"));
+        ModelBase::writeJson(writer, m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_EditKey))
+    {
+        
+        writer.key(_XPLATSTR("editKey"));
+        ModelBase::writeJson(writer, m_EditKey);
+    }
+
+    writer.endObject();
+}
+
 bool VoteResponse::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("status"))))
+    if(!val.is_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("status")));
-        if(!fieldValue.is_null())
-        {
-            utility::string_t refVal_setStatus;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
-            
-            setStatus(toStatusEnum(refVal_setStatus));
-            
-        }
+        return ok;
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("voteId"))))
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("voteId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setVoteId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setVoteId);
-            setVoteId(refVal_setVoteId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            if(field.first == _XPLATSTR("status"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setStatus;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setStatus);
+                    setStatus(toStatusEnum(refVal_setStatus));
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("voteId")):
+            if(field.first == _XPLATSTR("voteId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setVoteId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setVoteId);
+                    setVoteId(refVal_setVoteId);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("isVerified")):
+            if(field.first == _XPLATSTR("isVerified"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    bool refVal_setIsVerified;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setIsVerified);
+                    setIsVerified(refVal_setIsVerified);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            if(field.first == _XPLATSTR("user"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    std::shared_ptr<VoteResponseUser> refVal_setUser;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
+                    setUser(refVal_setUser);
+                }
+                continue;
+            }
+            break;
+        case ModelBase::fieldHash(_XPLATSTR("editKey")):
+            if(field.first == _XPLATSTR("editKey"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setEditKey;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setEditKey);
+                    setEditKey(refVal_setEditKey);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("isVerified"))))
+    return ok;
+}
+
+void VoteResponse::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_Status))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("isVerified")));
-        if(!fieldValue.is_null())
-        {
-            bool refVal_setIsVerified;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setIsVerified);
-            setIsVerified(refVal_setIsVerified);
-            
-        }
+        
+        utility::string_t refVal = fromStatusEnum(m_Status);
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("status")), refVal);
+        
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("user"))))
+    if(m_FieldsSet.test(FieldBit_VoteId))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("user")));
-        if(!fieldValue.is_null())
-        {
-            std::shared_ptr<VoteResponseUser> refVal_setUser;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setUser);
-            setUser(refVal_setUser);
-            
-        }
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("voteId")), m_VoteId);
+    }
+    if(m_FieldsSet.test(FieldBit_IsVerified))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("isVerified")), m_IsVerified);
+    }
+    if(m_FieldsSet.test(FieldBit_User))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("user")), m_User);
+    }
+    if(m_FieldsSet.test(FieldBit_EditKey))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("editKey")), m_EditKey);
     }
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("editKey"))))
+}
+
+bool VoteResponse::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("editKey")));
-        if(!fieldValue.is_null())
+        switch(field.tag)
         {
-            utility::string_t refVal_setEditKey;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setEditKey);
-            setEditKey(refVal_setEditKey);
-            
+        case ModelBase::fieldHash(_XPLATSTR("status")):
+            {
+                utility::string_t refVal_setStatus;
+                if(!ModelBase::readBinary(reader, field, refVal_setStatus))
+                {
+                    ok = false;
+                    continue;
+                }
+                setStatus(toStatusEnum(refVal_setStatus));
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("voteId")):
+            {
+                utility::string_t refVal_setVoteId;
+                if(!ModelBase::readBinary(reader, field, refVal_setVoteId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setVoteId(refVal_setVoteId);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("isVerified")):
+            {
+                bool refVal_setIsVerified;
+                if(!ModelBase::readBinary(reader, field, refVal_setIsVerified))
+                {
+                    ok = false;
+                    continue;
+                }
+                setIsVerified(refVal_setIsVerified);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("user")):
+            {
+                std::shared_ptr<VoteResponseUser> refVal_setUser;
+                if(!ModelBase::readBinary(reader, field, refVal_setUser))
+                {
+                    ok = false;
+                    continue;
+                }
+                setUser(refVal_setUser);
+            }
+            continue;
+        case ModelBase::fieldHash(_XPLATSTR("editKey")):
+            {
+                utility::string_t refVal_setEditKey;
+                if(!ModelBase::readBinary(reader, field, refVal_setEditKey))
+                {
+                    ok = false;
+                    continue;
+                }
+                setEditKey(refVal_setEditKey);
+            }
+            continue;
+        default:
+            break;
         }
+        reader.skip(field);
     }
-    return ok;
+    return ok && reader.ok();
 }
 
 void VoteResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
@@ -142,23 +294,23 @@ void VoteResponse::toMultipart(std::shared_ptr<MultipartFormData> multipart, con
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_StatusIsSet)
+    if(m_FieldsSet.test(FieldBit_Status))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("status")), fromStatusEnum(m_Status)));
     }
-    if(m_VoteIdIsSet)
+    if(m_FieldsSet.test(FieldBit_VoteId))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("voteId")), m_VoteId));
     }
-    if(m_IsVerifiedIsSet)
+    if(m_FieldsSet.test(FieldBit_IsVerified))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("isVerified")), m_IsVerified));
     }
-    if(m_UserIsSet)
+    if(m_FieldsSet.test(FieldBit_User))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("user")), m_User));
     }
-    if(m_EditKeyIsSet)
+    if(m_FieldsSet.test(FieldBit_EditKey))
     {
         multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("editKey")), m_EditKey));
     }
@@ -249,17 +401,17 @@ VoteResponse::StatusEnum VoteResponse::getStatus() const
 void VoteResponse::setStatus(const StatusEnum value)
 {
     m_Status = value;
-    m_StatusIsSet = true;
+    m_FieldsSet.set(FieldBit_Status);
 }
 
 bool VoteResponse::statusIsSet() const
 {
-    return m_StatusIsSet;
+    return m_FieldsSet.test(FieldBit_Status);
 }
 
 void VoteResponse::unsetStatus()
 {
-    m_StatusIsSet = false;
+    m_FieldsSet.reset(FieldBit_Status);
 }
 utility::string_t VoteResponse::getVoteId() const
 {
@@ -270,17 +422,17 @@ utility::string_t VoteResponse::getVoteId() const
 void VoteResponse::setVoteId(const utility::string_t& value)
 {
     m_VoteId = value;
-    m_VoteIdIsSet = true;
+    m_FieldsSet.set(FieldBit_VoteId);
 }
 
 bool VoteResponse::voteIdIsSet() const
 {
-    return m_VoteIdIsSet;
+    return m_FieldsSet.test(FieldBit_VoteId);
 }
 
 void VoteResponse::unsetVoteId()
 {
-    m_VoteIdIsSet = false;
+    m_FieldsSet.reset(FieldBit_VoteId);
 }
 bool VoteResponse::isIsVerified() const
 {
@@ -290,17 +442,17 @@ bool VoteResponse::isIsVerified() const
 void VoteResponse::setIsVerified(bool value)
 {
     m_IsVerified = value;
-    m_IsVerifiedIsSet = true;
+    m_FieldsSet.set(FieldBit_IsVerified);
 }
 
 bool VoteResponse::isVerifiedIsSet() const
 {
-    return m_IsVerifiedIsSet;
+    return m_FieldsSet.test(FieldBit_IsVerified);
 }
 
 void VoteResponse::unsetIsVerified()
 {
-    m_IsVerifiedIsSet = false;
+    m_FieldsSet.reset(FieldBit_IsVerified);
 }
 std::shared_ptr<VoteResponseUser> VoteResponse::getUser() const
 {
@@ -311,17 +463,17 @@ std::shared_ptr<VoteResponseUser> VoteResponse::getUser() const
 void VoteResponse::setUser(const std::shared_ptr<VoteResponseUser>& value)
 {
     m_User = value;
-    m_UserIsSet = true;
+    m_FieldsSet.set(FieldBit_User);
 }
 
 bool VoteResponse::userIsSet() const
 {
-    return m_UserIsSet;
+    return m_FieldsSet.test(FieldBit_User);
 }
 
 void VoteResponse::unsetUser()
 {
-    m_UserIsSet = false;
+    m_FieldsSet.reset(FieldBit_User);
 }
 utility::string_t VoteResponse::getEditKey() const
 {
@@ -332,17 +484,17 @@ utility::string_t VoteResponse::getEditKey() const
 void VoteResponse::setEditKey(const utility::string_t& value)
 {
     m_EditKey = value;
-    m_EditKeyIsSet = true;
+    m_FieldsSet.set(FieldBit_EditKey);
 }
 
 bool VoteResponse::editKeyIsSet() const
 {
-    return m_EditKeyIsSet;
+    return m_FieldsSet.test(FieldBit_EditKey);
 }
 
 void VoteResponse::unsetEditKey()
 {
-    m_EditKeyIsSet = false;
+    m_FieldsSet.reset(FieldBit_EditKey);
 }
 
 }
@@ -34,32 +34,96 @@ void VoteResponseUser::validate()
 web::json::value VoteResponseUser::toJson() const
 {
     web::json::value val = web::json::value::object();
-    if(m_SessionId.has_value())
+    if(m_FieldsSet.test(FieldBit_SessionId))
     {
         
-        val[utility::conversions::to_string_t(_XPLATSTR("sessionId"))] = ModelBase::toJson(m_SessionId.get());
+        val[utility::conversions::to_string_t(_XPLATSTR("sessionId"))] = ModelBase::toJson(m_SessionId);
     }
 
     return val;
 }
 
+void VoteResponseUser::writeJson(JsonWriter& writer) const
+{
+    writer.beginObject();
+    if(m_FieldsSet.test(FieldBit_SessionId))
+    {
+        
+        writer.key(_XPLATSTR("sessionId"));
+        ModelBase::writeJson(writer, m_SessionId);
+    }
+
+    writer.endObject();
+}
+
 bool VoteResponseUser::fromJson(const web::json::value& val)
 {
     bool ok = true;
-    if(val.has_field(utility::conversions::to_string_t(_XPLATSTR("sessionId"))))
+    if(!val.is_object())
+    {
+        return ok;
+    }
+    // Single pass over the payload; each key is dispatched on its hash.
+    for(const auto& field : val.as_object())
     {
-        const web::json::value& fieldValue = val.at(utility::conversions::to_string_t(_XPLATSTR("sessionId")));
-        if(!fieldValue.is_null())
+        const web::json::value& fieldValue = field.second;
+        switch(ModelBase::fieldHash(field.first))
         {
-            utility::string_t refVal_setSessionId;
-            ok &= ModelBase::fromJson(fieldValue, refVal_setSessionId);
-            setSessionId(refVal_setSessionId);
-            
+        case ModelBase::fieldHash(_XPLATSTR("sessionId")):
+            if(field.first == _XPLATSTR("sessionId"))
+            {
+                if(!fieldValue.is_null())
+                {
+                    utility::string_t refVal_setSessionId;
+                    ok &= ModelBase::fromJson(fieldValue, refVal_setSessionId);
+                    setSessionId(refVal_setSessionId);
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
         }
     }
     return ok;
 }
 
+void VoteResponseUser::writeBinary(BinaryWriter& writer) const
+{
+    if(m_FieldsSet.test(FieldBit_SessionId))
+    {
+        
+        ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("sessionId")), m_SessionId);
+    }
+}
+
+bool VoteResponseUser::readBinary(BinaryReader& reader)
+{
+    bool ok = true;
+    BinaryField field;
+    while(reader.nextField(field))
+    {
+        switch(field.tag)
+        {
+        case ModelBase::fieldHash(_XPLATSTR("sessionId")):
+            {
+                utility::string_t refVal_setSessionId;
+                if(!ModelBase::readBinary(reader, field, refVal_setSessionId))
+                {
+                    ok = false;
+                    continue;
+                }
+                setSessionId(refVal_setSessionId);
+            }
+            continue;
+        default:
+            break;
+        }
+        reader.skip(field);
+    }
+    return ok && reader.ok();
+}
+
 void VoteResponseUser::toMultipart(std::shared_ptr<MultipartFormData> multipart, const utility::string_t& prefix) const
 {
     utility::string_t namePrefix = prefix;
@@ -67,9 +131,9 @@ void VoteResponseUser::toMultipart(std::shared_ptr<MultipartFormData> multipart,
     {
         namePrefix += utility::conversions::to_string_t(_XPLATSTR("."));
     }
-    if(m_SessionId.has_value())
+    if(m_FieldsSet.test(FieldBit_SessionId))
     {
-        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sessionId")), m_SessionId.get()));
+        multipart->add(ModelBase::toHttpContent(namePrefix + utility::conversions::to_string_t(_XPLATSTR("sessionId")), m_SessionId));
     }
 }
 
@@ -94,23 +158,24 @@ bool VoteResponseUser::fromMultiPart(std::shared_ptr<MultipartFormData> multipar
 
 utility::string_t VoteResponseUser::getSessionId() const
 {
-    return m_SessionId.get();
+    return m_SessionId;
 }
 
 
 void VoteResponseUser::setSessionId(const utility::string_t& value)
 {
     m_SessionId = value;
+    m_FieldsSet.set(FieldBit_SessionId);
 }
 
 bool VoteResponseUser::sessionIdIsSet() const
 {
-    return m_SessionId.has_value();
+    return m_FieldsSet.test(FieldBit_SessionId);
 }
 
 void VoteResponseUser::unsetSessionId()
 {
-    m_SessionId.reset();
+    m_FieldsSet.reset(FieldBit_SessionId);
 }
 
 }
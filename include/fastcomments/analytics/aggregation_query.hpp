@@ -0,0 +1,182 @@
+#ifndef FASTCOMMENTS_ANALYTICS_AGGREGATION_QUERY_HPP
+#define FASTCOMMENTS_ANALYTICS_AGGREGATION_QUERY_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cpprest/json.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/DefaultApi.h"
+
+namespace fastcomments {
+namespace analytics {
+
+using org::openapitools::client::api::AggregateOptions;
+using org::openapitools::client::api::ApiClient;
+
+enum class AggregateOp { Sum, CountDistinct, Distinct, Avg, Min, Max, Count };
+
+enum class PredicateOp { Eq, NotEq, GreaterThan, LessThan, Contains };
+
+// Calendar buckets in UTC, matching the API's AggregateTimeBucket values.
+enum class TimeBucket { Day, Month, Year };
+
+// [startMs, endMs) in Unix epoch milliseconds.
+struct BucketRange {
+    int64_t startMs = 0;
+    int64_t endMs = 0;
+};
+
+// The bucket containing timeMs, and the one `offset` buckets after it.
+BucketRange bucketAt(TimeBucket bucket, int64_t timeMs, int64_t offset = 0);
+
+// A typed AggregationRequest. The generated model can't carry predicate
+// values (QueryPredicate_value has no members), so the request is built as
+// JSON here.
+//
+// Two queries that differ only in the order of their predicates, groupBy
+// fields or operations ask the server the same thing; canonicalKey() is the
+// same for both, and hash() is derived from it.
+class AggregationQuery {
+public:
+    explicit AggregationQuery(utility::string_t resourceName);
+
+    AggregationQuery& where(const utility::string_t& key, PredicateOp op, const utility::string_t& value);
+    AggregationQuery& where(const utility::string_t& key, PredicateOp op, const utility::char_t* value);
+    AggregationQuery& where(const utility::string_t& key, PredicateOp op, double value);
+    AggregationQuery& where(const utility::string_t& key, PredicateOp op, bool value);
+
+    AggregationQuery& groupBy(const utility::string_t& field);
+
+    // Results are keyed by alias, or by field when there is none.
+    AggregationQuery& aggregate(AggregateOp op, const utility::string_t& field,
+                                const utility::string_t& alias = {}, bool expandArray = false);
+    AggregationQuery& count(const utility::string_t& field, const utility::string_t& alias = {});
+    AggregationQuery& sum(const utility::string_t& field, const utility::string_t& alias = {});
+
+    AggregationQuery& sortBy(const utility::string_t& field, bool ascending = true);
+
+    // Splits the query into the last `count` calendar buckets of `timeField`,
+    // the current one included. Each bucket is its own request, bounded by
+    // greater_than / less_than predicates on timeField in epoch milliseconds,
+    // so an AggregationCache only has to re-query the bucket that is still
+    // filling.
+    AggregationQuery& bucketBy(const utility::string_t& timeField, TimeBucket bucket, size_t count);
+
+    bool bucketed() const { return bucketCount_ > 0; }
+    // The bucket ranges the query covers at nowMs, oldest first.
+    std::vector<BucketRange> buckets(int64_t nowMs) const;
+
+    // The request body; for a bucketed query, the body for one bucket.
+    web::json::value toJson() const;
+    web::json::value toJson(const BucketRange& bucket) const;
+
+    std::string canonicalKey() const;
+    uint64_t hash() const;
+
+private:
+    struct Predicate {
+        utility::string_t key;
+        PredicateOp op;
+        web::json::value value;
+    };
+    struct Operation {
+        AggregateOp op;
+        utility::string_t field;
+        utility::string_t alias;
+        bool expandArray;
+    };
+
+    web::json::value toJson(const BucketRange* bucket) const;
+
+    utility::string_t resourceName_;
+    std::vector<Predicate> predicates_;
+    std::vector<utility::string_t> groupBy_;
+    std::vector<Operation> operations_;
+    utility::string_t sortField_;
+    bool sortAscending_ = true;
+    utility::string_t timeField_;
+    TimeBucket bucket_ = TimeBucket::Day;
+    size_t bucketCount_ = 0;
+};
+
+// One item of the response's data array.
+struct AggregationRow {
+    // Start of the row's bucket for bucketed queries, 0 otherwise.
+    int64_t bucketStartMs = 0;
+    std::map<utility::string_t, utility::string_t> groups;
+    // The AggregationValue objects (numericValue, stringValue, distinctCount,
+    // ...) keyed by operation alias.
+    std::map<utility::string_t, web::json::value> values;
+
+    // values[key].numericValue, or 0.
+    double number(const utility::string_t& key) const;
+};
+
+struct AggregationResult {
+    // Bucket by bucket, oldest first; within a bucket in the server's order.
+    std::vector<AggregationRow> rows;
+    size_t requests = 0;        // buckets fetched for this call
+    size_t cachedBuckets = 0;   // buckets served from the cache
+};
+
+// Posts one request body and resolves to the response's data array.
+using AggregateFetch = std::function<pplx::task<web::json::value>(const web::json::value& request)>;
+
+// POST /api/v1/aggregate. AggregateResponse drops the per-operation values,
+// so the response JSON is read directly.
+AggregateFetch aggregateFetch(std::shared_ptr<const ApiClient> apiClient, utility::string_t tenantId,
+                              AggregateOptions options = {});
+
+struct AggregationCacheStats {
+    uint64_t requests = 0;
+    uint64_t cachedBuckets = 0;
+    size_t entries = 0;
+};
+
+struct AggregationCacheOptions {
+    // How long the result of an unbucketed query, or of a bucket that was
+    // still filling when it was fetched, is served before it is fetched again.
+    std::chrono::milliseconds maxAge{std::chrono::seconds(60)};
+    // Distinct queries kept; the least recently used is dropped first.
+    size_t maxEntries = 256;
+    // Current time in epoch milliseconds; the system clock by default.
+    std::function<int64_t()> now;
+};
+
+// Caches aggregation results by AggregationQuery::hash().
+//
+// A bucket that had ended when it was fetched is final and never requested
+// again, so refreshing a "last 30 days" dashboard costs one request for
+// today instead of thirty. A bucket that was still filling is refreshed once
+// maxAge has passed, and once more after it ends. Concurrent get()s for the
+// same query share the requests in flight. A failed request fails the get()
+// and leaves the cached rows as they were.
+class AggregationCache {
+public:
+    explicit AggregationCache(AggregateFetch fetch, AggregationCacheOptions options = {});
+
+    pplx::task<AggregationResult> get(const AggregationQuery& query);
+
+    void invalidate(const AggregationQuery& query);
+    void clear();
+
+    AggregationCacheStats stats() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace analytics
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_ANALYTICS_AGGREGATION_QUERY_HPP
@@ -0,0 +1,150 @@
+#ifndef FASTCOMMENTS_ANALYTICS_COMMENT_BATCH_HPP
+#define FASTCOMMENTS_ANALYTICS_COMMENT_BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cpprest/json.h>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace model {
+class APIGetCommentsResponse;
+class ModerationAPIGetCommentsResponse;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace analytics {
+
+// One bit per row, 64 rows per word. Bits past size() are always zero.
+class Bitmap {
+public:
+    Bitmap() = default;
+    explicit Bitmap(size_t size, bool value = false);
+
+    size_t size() const { return size_; }
+    bool test(size_t row) const { return (words_[row >> 6] >> (row & 63)) & 1u; }
+    void set(size_t row, bool value = true);
+    void resize(size_t size);
+
+    size_t count() const;
+    std::vector<uint32_t> rows() const;
+
+    Bitmap& operator&=(const Bitmap& other);
+    Bitmap& operator|=(const Bitmap& other);
+    Bitmap operator~() const;
+
+    const std::vector<uint64_t>& words() const { return words_; }
+    std::vector<uint64_t>& words() { return words_; }
+
+private:
+    void clearTail();
+
+    size_t size_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+Bitmap operator&(Bitmap a, const Bitmap& b);
+Bitmap operator|(Bitmap a, const Bitmap& b);
+
+enum class CommentFlag {
+    Approved,
+    Reviewed,
+    Spam,
+    Deleted,
+    Pinned,
+    Locked,
+    ByAdmin,
+    ByModerator,
+    Verified
+};
+
+constexpr size_t kCommentFlagCount = 9;
+
+struct VoteStats {
+    size_t count = 0;
+    int64_t votes = 0;
+    int64_t votesUp = 0;
+    int64_t votesDown = 0;
+    int64_t minDate = 0;   // ms since epoch; 0 when count == 0
+    int64_t maxDate = 0;
+};
+
+// Struct-of-arrays view of a page (or many pages) of comments. Every column has
+// size() entries and row i of each column describes the same comment, so scans
+// over one attribute touch only that attribute's memory.
+class CommentBatch {
+public:
+    static constexpr int32_t kNoParent = -1;       // top-level comment
+    static constexpr int32_t kParentNotInBatch = -2;
+
+    // Decodes the "comments" array of a getComments / getApiComments response
+    // body straight into columns, without materializing model objects.
+    static CommentBatch fromJson(const web::json::value& response);
+    static CommentBatch fromResponse(const org::openapitools::client::model::APIGetCommentsResponse& response);
+    static CommentBatch fromResponse(const org::openapitools::client::model::ModerationAPIGetCommentsResponse& response);
+
+    size_t size() const { return ids_.size(); }
+    bool empty() const { return ids_.empty(); }
+    void reserve(size_t rows);
+
+    // Appends the rows of other and re-links parents that are now resolvable.
+    void append(const CommentBatch& other);
+    // Joins parts in order. Parents are linked once at the end, so this is
+    // linear where append() in a loop re-links every row on every call.
+    static CommentBatch concat(const std::vector<CommentBatch>& parts);
+
+    const std::vector<std::string>& ids() const { return ids_; }
+    const std::vector<int64_t>& dates() const { return dates_; }
+    const std::vector<int32_t>& votes() const { return votes_; }
+    const std::vector<int32_t>& votesUp() const { return votesUp_; }
+    const std::vector<int32_t>& votesDown() const { return votesDown_; }
+    const Bitmap& flag(CommentFlag f) const { return flags_[static_cast<size_t>(f)]; }
+
+    // Row of the parent comment, kNoParent or kParentNotInBatch.
+    const std::vector<int32_t>& parents() const { return parents_; }
+    // Raw parent id, kept so parents can be re-linked after append().
+    const std::vector<std::string>& parentIds() const { return parentIds_; }
+
+    // Filters. Each returns a Bitmap of size() rows.
+    Bitmap dateBetween(int64_t fromMs, int64_t toMs) const;   // [fromMs, toMs)
+    Bitmap votesAtLeast(int32_t minVotes) const;
+    Bitmap topLevel() const;
+
+    // Aggregates over all rows, or over the rows set in selection.
+    VoteStats voteStats() const;
+    VoteStats voteStats(const Bitmap& selection) const;
+
+    // Row orderings; stable for equal keys.
+    std::vector<uint32_t> orderByDate(bool descending = false) const;
+    std::vector<uint32_t> orderByVotes(bool descending = false) const;
+
+    // Copies the given rows, in order, into a new batch.
+    CommentBatch gather(const std::vector<uint32_t>& rows) const;
+
+private:
+    void addRow(std::string id, int64_t date, int32_t votes, int32_t votesUp, int32_t votesDown,
+                const bool (&flags)[kCommentFlagCount], std::string parentId);
+    void appendRows(const CommentBatch& other);
+    void linkParents();
+
+    std::vector<std::string> ids_;
+    std::vector<int64_t> dates_;
+    std::vector<int32_t> votes_;
+    std::vector<int32_t> votesUp_;
+    std::vector<int32_t> votesDown_;
+    std::vector<int32_t> parents_;
+    std::vector<std::string> parentIds_;
+    Bitmap flags_[kCommentFlagCount];
+};
+
+} // namespace analytics
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_ANALYTICS_COMMENT_BATCH_HPP
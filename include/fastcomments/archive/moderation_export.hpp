@@ -0,0 +1,136 @@
+#ifndef FASTCOMMENTS_ARCHIVE_MODERATION_EXPORT_HPP
+#define FASTCOMMENTS_ARCHIVE_MODERATION_EXPORT_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "fastcomments/analytics/comment_batch.hpp"
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace api {
+class ModerationApi;
+struct PostApiExportOptions;
+}
+namespace model {
+class ModerationExportStatusResponse;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace archive {
+
+using org::openapitools::client::api::ModerationApi;
+using org::openapitools::client::api::PostApiExportOptions;
+using org::openapitools::client::model::ModerationExportStatusResponse;
+
+// The calls an export job makes. moderationExportBackend() wires them to a
+// ModerationApi and a plain HTTP GET of the download URL; tests substitute
+// their own.
+struct ExportJobBackend {
+    // Read the next piece only once the returned task completes; it fails
+    // when the download should stop.
+    using ChunkHandler = std::function<pplx::task<void>(const char* data, size_t size)>;
+
+    // postApiExport; resolves to the batch job id.
+    std::function<pplx::task<utility::string_t>()> start;
+    // getApiExportStatus for the job.
+    std::function<pplx::task<std::shared_ptr<ModerationExportStatusResponse>>(const utility::string_t& batchJobId)> status;
+    // Fetches the finished export, handing the body to onChunk piece by piece
+    // and in order. A failed onChunk task must fail the download.
+    std::function<pplx::task<void>(const utility::string_t& downloadUrl, ChunkHandler onChunk)> download;
+};
+
+// Exports every comment matching filters (all comments without them). The
+// status polls use filters.sso.
+ExportJobBackend moderationExportBackend(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId);
+ExportJobBackend moderationExportBackend(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId,
+                                         const PostApiExportOptions& filters);
+
+enum class ExportPhase {
+    Starting,
+    Waiting,       // job running; recordCount and nextPoll are current
+    Downloading,   // bytes (and records, for toBatch) are current
+    Done
+};
+
+struct ExportProgress {
+    ExportPhase phase = ExportPhase::Starting;
+    utility::string_t batchJobId;
+    utility::string_t jobStatus;
+    int32_t recordCount = 0;              // as reported by getApiExportStatus
+    uint32_t polls = 0;
+    std::chrono::milliseconds nextPoll{0};
+    uint64_t bytes = 0;                   // downloaded so far
+    uint64_t records = 0;                 // decoded so far; toBatch only
+};
+
+struct ExportSummary {
+    utility::string_t batchJobId;
+    int32_t recordCount = 0;
+    uint32_t polls = 0;
+    uint64_t bytes = 0;
+    std::chrono::milliseconds elapsed{0};
+};
+
+struct ExportPipelineOptions {
+    // The first status poll is made after initialPollInterval. While the
+    // reported recordCount keeps growing the interval halves, down to
+    // minPollInterval, so a job that is nearly done is noticed quickly; while
+    // it stands still the interval doubles, up to maxPollInterval, so a queued
+    // or slow job costs few requests.
+    std::chrono::milliseconds initialPollInterval{1000};
+    std::chrono::milliseconds minPollInterval{250};
+    std::chrono::milliseconds maxPollInterval{15000};
+    // The export fails with std::runtime_error if the job hasn't produced a
+    // download URL after this long.
+    std::chrono::milliseconds timeout{std::chrono::minutes(30)};
+    // Downloaded chunks waiting for the writer or decoder before the download
+    // waits for it.
+    size_t maxQueuedChunks = 16;
+    // Called on phase changes, after every poll and after every downloaded
+    // chunk; one call at a time.
+    std::function<void(const ExportProgress&)> onProgress;
+};
+
+// Runs a moderation export end to end: postApiExport, getApiExportStatus until
+// the job reports a download URL, then the download. The download is written
+// or decoded on a thread of its own, so the next chunk is being fetched while
+// the last one is processed; a slow consumer holds the download back rather
+// than buffering the whole export.
+//
+// A job whose jobStatus reports a failure, or that runs past the timeout,
+// fails the returned task with std::runtime_error.
+class ExportPipeline {
+public:
+    ExportPipeline(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId, ExportPipelineOptions options = {});
+    ExportPipeline(ExportJobBackend backend, ExportPipelineOptions options = {});
+
+    // Writes the export, byte for byte, to path. The data goes to
+    // "<path>.part", which is renamed to path once complete.
+    pplx::task<ExportSummary> toFile(std::string path) const;
+
+    // Decodes the export into a CommentBatch as it downloads. The body may be a
+    // JSON array of comments, an object with a "comments" array, or one comment
+    // object per line.
+    pplx::task<analytics::CommentBatch> toBatch() const;
+
+private:
+    ExportJobBackend backend_;
+    ExportPipelineOptions options_;
+};
+
+} // namespace archive
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_ARCHIVE_MODERATION_EXPORT_HPP
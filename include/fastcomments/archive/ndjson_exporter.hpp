@@ -0,0 +1,121 @@
+#ifndef FASTCOMMENTS_ARCHIVE_NDJSON_EXPORTER_HPP
+#define FASTCOMMENTS_ARCHIVE_NDJSON_EXPORTER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace api {
+class DefaultApi;
+}
+namespace model {
+class ModelBase;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace archive {
+
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::model::ModelBase;
+
+// One fetched page. Each record becomes one line of the export.
+struct ExportPage {
+    std::vector<std::shared_ptr<ModelBase>> records;
+    bool last = false;
+};
+
+// Where an export reads from. fetch(cursor) returns the page at cursor and
+// next(cursor, page) the cursor of the page after it; what a cursor means (skip
+// offset, index into a list of pages) is up to the source. The name is stored
+// in the checkpoint so a resume can't continue a different export.
+struct ExportSource {
+    std::string name;
+    std::function<pplx::task<ExportPage>(int64_t cursor)> fetch;
+    std::function<int64_t(int64_t cursor, const ExportPage& page)> next;
+};
+
+// getComments, oldest first, pageSize comments per request.
+ExportSource commentsSource(std::shared_ptr<DefaultApi> api, utility::string_t tenantId, int32_t pageSize = 100);
+// getAuditLogs in ascending order, so entries added during the export land on later pages.
+ExportSource auditLogsSource(std::shared_ptr<DefaultApi> api, utility::string_t tenantId, int32_t pageSize = 1000);
+// getVotes for each urlId in turn (the endpoint is per page and unpaginated).
+// Applied votes are exported; pending votes are not.
+ExportSource votesSource(std::shared_ptr<DefaultApi> api, utility::string_t tenantId,
+                         std::vector<utility::string_t> urlIds);
+
+enum class Compression {
+    None,
+    Gzip
+};
+
+struct ExportOptions {
+    Compression compression = Compression::None;
+    // Continue from "<path>.checkpoint" when one exists; otherwise start over.
+    bool resume = true;
+};
+
+// Written to "<path>.checkpoint" after every page is on disk.
+struct ExportCheckpoint {
+    std::string source;
+    int64_t cursor = 0;      // cursor of the next page to fetch
+    uint64_t records = 0;
+    uint64_t bytes = 0;      // length of the export file at the checkpoint
+    bool complete = false;
+};
+
+struct ExportStats {
+    uint64_t pages = 0;      // fetched by this run
+    uint64_t records = 0;    // in the file, including resumed ones
+    uint64_t bytes = 0;
+    bool resumed = false;
+};
+
+// Streams a paginated source into a newline-delimited JSON file. The request
+// for page N+1 is in flight while page N is written, records are serialized
+// straight from the models (no json::value), and at most two pages are held in
+// memory whatever the tenant size.
+//
+// The file is flushed and a checkpoint written after every page. An
+// interrupted export resumes by truncating the file back to the last
+// checkpoint and fetching from its cursor, so no record is lost or duplicated.
+// If the file is gone or shorter than the checkpoint, the export starts over.
+// With gzip each checkpointed page is its own gzip member; gzip readers treat
+// the concatenation as one stream.
+class NdjsonExporter {
+public:
+    explicit NdjsonExporter(std::string path, ExportOptions options = {});
+
+    NdjsonExporter(const NdjsonExporter&) = delete;
+    NdjsonExporter& operator=(const NdjsonExporter&) = delete;
+
+    // Runs the export to the last page on the calling thread. Fetch errors are
+    // rethrown after the last complete page has been checkpointed.
+    ExportStats run(const ExportSource& source);
+
+    const std::string& path() const { return path_; }
+    std::string checkpointPath() const { return path_ + ".checkpoint"; }
+
+    static bool readCheckpoint(const std::string& path, ExportCheckpoint& out);
+
+private:
+    void writeCheckpoint(const ExportCheckpoint& checkpoint) const;
+
+    std::string path_;
+    ExportOptions options_;
+};
+
+} // namespace archive
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_ARCHIVE_NDJSON_EXPORTER_HPP
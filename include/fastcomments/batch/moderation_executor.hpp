@@ -0,0 +1,124 @@
+#ifndef FASTCOMMENTS_BATCH_MODERATION_EXECUTOR_HPP
+#define FASTCOMMENTS_BATCH_MODERATION_EXECUTOR_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace api {
+class ModerationApi;
+}
+namespace model {
+class ModerationAPIComment;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::ModerationApi;
+using org::openapitools::client::model::ModerationAPIComment;
+
+struct ModerationAction {
+    enum class Kind {
+        SetApproved,
+        SetSpam,
+        SetReviewed,
+        Remove
+    };
+
+    Kind kind = Kind::SetApproved;
+    bool value = true;          // approved / spam / reviewed
+    bool permNotSpam = false;   // SetSpam with value == false only
+
+    static ModerationAction approve(bool approved = true) { return {Kind::SetApproved, approved, false}; }
+    static ModerationAction markSpam(bool spam = true, bool permNotSpam = false) { return {Kind::SetSpam, spam, permNotSpam}; }
+    static ModerationAction review(bool reviewed = true) { return {Kind::SetReviewed, reviewed, false}; }
+    static ModerationAction remove() { return {Kind::Remove, true, false}; }
+};
+
+// Whether the comment is already in the state the action would put it in.
+bool alreadyApplied(const ModerationAction& action, const ModerationAPIComment& comment);
+
+// The calls the executor makes. moderationBackend() wires them to a
+// ModerationApi; tests substitute their own.
+struct ModerationBackend {
+    std::function<pplx::task<void>(const ModerationAction& action, const utility::string_t& commentId)> apply;
+    // postCommentsByIds; comments that no longer exist are simply absent.
+    std::function<pplx::task<std::vector<std::shared_ptr<ModerationAPIComment>>>(
+        const std::vector<utility::string_t>& commentIds)> lookup;
+};
+
+ModerationBackend moderationBackend(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId,
+                                    boost::optional<utility::string_t> sso = boost::none,
+                                    boost::optional<utility::string_t> broadcastId = boost::none);
+
+struct ModerationProgress {
+    size_t total = 0;
+    size_t done = 0;        // succeeded + failed + skipped
+    size_t succeeded = 0;
+    size_t failed = 0;
+    size_t skipped = 0;
+};
+
+struct ModerationFailure {
+    utility::string_t commentId;
+    std::string error;
+    int attempts = 0;
+};
+
+struct ModerationReport {
+    std::vector<utility::string_t> succeeded;
+    // Already in the target state, or gone, when skipUnchanged is on.
+    std::vector<utility::string_t> skipped;
+    std::vector<ModerationFailure> failures;
+};
+
+struct ModerationOptions {
+    // Action calls in flight at once.
+    size_t concurrency = 8;
+    // Attempts per comment. Only server errors (5xx), 429 and transport
+    // failures are retried; other 4xx responses fail the comment at once.
+    int maxAttempts = 3;
+    // Wait before the first retry; doubled for each one after.
+    std::chrono::milliseconds retryDelay{200};
+    // Look the comments up with postCommentsByIds first and skip those that
+    // are already in the target state or no longer exist.
+    bool skipUnchanged = false;
+    size_t lookupChunk = 100;
+    // Called after every comment, one call at a time, with the running totals.
+    std::function<void(const ModerationProgress&)> onProgress;
+};
+
+// Applies one moderation action to a set of comments with bounded concurrency
+// and per-comment retries. Duplicate ids are acted on once. A comment that
+// still fails after its retries is reported in ModerationReport::failures and
+// does not stop the others; run() itself only fails if the lookup does.
+class ModerationExecutor {
+public:
+    ModerationExecutor(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId, ModerationOptions options = {});
+    ModerationExecutor(ModerationBackend backend, ModerationOptions options = {});
+
+    pplx::task<ModerationReport> run(std::vector<utility::string_t> commentIds, ModerationAction action) const;
+
+private:
+    ModerationBackend backend_;
+    ModerationOptions options_;
+};
+
+} // namespace batch
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_BATCH_MODERATION_EXECUTOR_HPP
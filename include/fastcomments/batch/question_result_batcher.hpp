@@ -0,0 +1,82 @@
+#ifndef FASTCOMMENTS_BATCH_QUESTION_RESULT_BATCHER_HPP
+#define FASTCOMMENTS_BATCH_QUESTION_RESULT_BATCHER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/DefaultApi.h"
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::AggregateQuestionResultsOptions;
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::model::BulkAggregateQuestionResultsRequest;
+using org::openapitools::client::model::BulkAggregateQuestionResultsResponse;
+using org::openapitools::client::model::QuestionResultAggregationOverall;
+
+struct QuestionBatcherOptions {
+    // A batch is sent when it holds maxCount distinct aggregations, or
+    // maxDelay after the first of them was queued.
+    size_t maxCount = 50;
+    std::chrono::milliseconds maxDelay{10};
+    // Bulk requests in flight at once; full batches wait for a free slot.
+    size_t maxInFlight = 4;
+};
+
+struct QuestionBatcherStats {
+    uint64_t calls = 0;
+    uint64_t aggregations = 0;   // distinct aggregations sent
+    uint64_t requests = 0;
+    uint64_t failed = 0;         // calls whose future ended in an error
+};
+
+// Front-end for bulkAggregateQuestionResults with the per-question API of
+// aggregateQuestionResults: aggregate() queues one aggregation and returns a
+// future for its own QuestionResultAggregationOverall. Aggregations queued
+// within maxDelay of each other go out as one bulk request, each under its
+// own aggId, and the response's data map is split back out to the callers.
+//
+// Identical aggregations queued into the same batch are sent once and share
+// the result. forceRecalculate applies to a whole bulk request, so a call
+// that differs from the open batch in it starts a new batch. An aggId
+// missing from the response fails that call's future; a failed request fails
+// every future in its batch.
+class QuestionResultBatcher {
+public:
+    using SendBatch = std::function<pplx::task<std::shared_ptr<BulkAggregateQuestionResultsResponse>>(
+        std::shared_ptr<BulkAggregateQuestionResultsRequest> request, bool forceRecalculate)>;
+
+    QuestionResultBatcher(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+                          QuestionBatcherOptions options = {});
+    explicit QuestionResultBatcher(SendBatch send, QuestionBatcherOptions options = {});
+    // Sends whatever is queued. Futures already handed out still resolve.
+    ~QuestionResultBatcher();
+
+    QuestionResultBatcher(const QuestionResultBatcher&) = delete;
+    QuestionResultBatcher& operator=(const QuestionResultBatcher&) = delete;
+
+    // Takes the same options as DefaultApi::aggregateQuestionResults.
+    pplx::task<std::shared_ptr<QuestionResultAggregationOverall>> aggregate(const AggregateQuestionResultsOptions& query);
+
+    // Sends the queued aggregations now. Resolves once every call made before
+    // it has its result.
+    pplx::task<void> flush();
+
+    QuestionBatcherStats stats() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace batch
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_BATCH_QUESTION_RESULT_BATCHER_HPP
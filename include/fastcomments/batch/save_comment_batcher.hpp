@@ -0,0 +1,77 @@
+#ifndef FASTCOMMENTS_BATCH_SAVE_COMMENT_BATCHER_HPP
+#define FASTCOMMENTS_BATCH_SAVE_COMMENT_BATCHER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/DefaultApi.h"
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::model::CreateCommentParams;
+using org::openapitools::client::model::SaveCommentsBulkResponse;
+
+struct SaveBatcherOptions {
+    // A batch is sent as soon as any of these is reached.
+    size_t maxCount = 100;
+    size_t maxBytes = 512 * 1024;   // serialized JSON of the batch
+    std::chrono::milliseconds maxDelay{50};   // since the oldest queued comment
+    // Bulk requests in flight at once; full batches wait for a free slot.
+    size_t maxInFlight = 4;
+    org::openapitools::client::api::SaveCommentsBulkOptions bulkOptions;
+};
+
+struct SaveBatcherStats {
+    uint64_t comments = 0;
+    uint64_t requests = 0;
+    uint64_t failed = 0;   // comments whose future ended in an error
+};
+
+// Front-end for saveCommentsBulk with a per-comment API: save() queues one
+// comment and returns a future for its own result. Queued comments go out as
+// one saveCommentsBulk call when the batch reaches maxCount or maxBytes, or
+// maxDelay after the first of them was queued.
+//
+// The bulk response is matched to the batch by position. A comment the server
+// rejected fails its future with an ApiException carrying the reason; a failed
+// request fails every future in its batch. Other comments are unaffected.
+class SaveCommentBatcher {
+public:
+    using SendBatch = std::function<pplx::task<std::vector<std::shared_ptr<SaveCommentsBulkResponse>>>(
+        std::vector<std::shared_ptr<CreateCommentParams>> batch)>;
+
+    SaveCommentBatcher(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, SaveBatcherOptions options = {});
+    // send replaces the saveCommentsBulk call, e.g. to add retries.
+    explicit SaveCommentBatcher(SendBatch send, SaveBatcherOptions options = {});
+    // Sends whatever is queued. Futures already handed out still resolve.
+    ~SaveCommentBatcher();
+
+    SaveCommentBatcher(const SaveCommentBatcher&) = delete;
+    SaveCommentBatcher& operator=(const SaveCommentBatcher&) = delete;
+
+    pplx::task<std::shared_ptr<SaveCommentsBulkResponse>> save(std::shared_ptr<CreateCommentParams> comment);
+
+    // Sends the queued comments now. Resolves once every comment queued before
+    // the call has its result.
+    pplx::task<void> flush();
+
+    SaveBatcherStats stats() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace batch
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_BATCH_SAVE_COMMENT_BATCHER_HPP
@@ -0,0 +1,114 @@
+#ifndef FASTCOMMENTS_BATCH_USER_LOADER_HPP
+#define FASTCOMMENTS_BATCH_USER_LOADER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace api {
+class DefaultApi;
+class PublicApi;
+}
+namespace model {
+class PageUserEntry;
+class User;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::api::PublicApi;
+using org::openapitools::client::model::PageUserEntry;
+using org::openapitools::client::model::User;
+
+// The calls a loader makes. userLoaderBackend() wires them to the APIs;
+// tests substitute their own.
+struct UserLoaderBackend {
+    // PublicApi::getUsersInfo for a comma-joined list of ids. Unknown ids are
+    // simply absent from the result.
+    std::function<pplx::task<std::vector<std::shared_ptr<PageUserEntry>>>(const std::vector<utility::string_t>& userIds)> usersInfo;
+    // DefaultApi::getUser; there is no bulk form.
+    std::function<pplx::task<std::shared_ptr<User>>(const utility::string_t& userId)> user;
+};
+
+// Either API may be null if the loader is only used for the other call.
+UserLoaderBackend userLoaderBackend(std::shared_ptr<const PublicApi> publicApi,
+                                    std::shared_ptr<const DefaultApi> defaultApi, utility::string_t tenantId);
+
+struct UserLoaderOptions {
+    // Loads made within this long of the first queued one are dispatched
+    // together; dispatch() sends them sooner.
+    std::chrono::milliseconds batchWindow{2};
+    // Ids per getUsersInfo request; a full batch is sent at once.
+    size_t maxIdsPerRequest = 100;
+    // Keep results for the loader's lifetime, so a user is fetched at most
+    // once per loader. Off, only loads in flight are shared.
+    bool memoize = true;
+};
+
+struct UserLoaderStats {
+    uint64_t loads = 0;
+    uint64_t shared = 0;          // answered by a load already queued, in flight or memoized
+    uint64_t infoRequests = 0;    // getUsersInfo calls
+    uint64_t userRequests = 0;    // getUser calls
+};
+
+// DataLoader-style front-end for user lookups within one request cycle.
+//
+// Code paths that each need a few users call loadInfo() / loadUser()
+// independently. Loads gathered during a batchWindow are sent together: the
+// distinct ids for getUsersInfo go out as one request per maxIdsPerRequest,
+// and each distinct id for getUser is fetched once. Every caller gets a
+// future for its own user, so N lookups of the same handful of users cost
+// one getUsersInfo call.
+//
+// With memoize on (the default) a loader is a per-request cache: create one
+// per request cycle and drop it afterwards. A failed fetch is never memoized;
+// the next load of that id fetches again.
+class UserLoader {
+public:
+    UserLoader(std::shared_ptr<const PublicApi> publicApi, std::shared_ptr<const DefaultApi> defaultApi,
+               utility::string_t tenantId, UserLoaderOptions options = {});
+    explicit UserLoader(UserLoaderBackend backend, UserLoaderOptions options = {});
+    // Sends whatever is queued. Futures already handed out still resolve.
+    ~UserLoader();
+
+    UserLoader(const UserLoader&) = delete;
+    UserLoader& operator=(const UserLoader&) = delete;
+
+    // Resolves to nullptr for an id getUsersInfo doesn't know.
+    pplx::task<std::shared_ptr<PageUserEntry>> loadInfo(const utility::string_t& userId);
+    // In the order of userIds.
+    pplx::task<std::vector<std::shared_ptr<PageUserEntry>>> loadInfos(const std::vector<utility::string_t>& userIds);
+    pplx::task<std::shared_ptr<User>> loadUser(const utility::string_t& userId);
+
+    // Sends the queued loads now. Resolves once they have all settled.
+    pplx::task<void> dispatch();
+
+    // Forgets memoized results; loads in flight are unaffected.
+    void clear();
+
+    UserLoaderStats stats() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace batch
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_BATCH_USER_LOADER_HPP
@@ -0,0 +1,114 @@
+#ifndef FASTCOMMENTS_BATCH_WEBHOOK_DRAINER_HPP
+#define FASTCOMMENTS_BATCH_WEBHOOK_DRAINER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/DefaultApi.h"
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::api::GetPendingWebhookEventsOptions;
+using org::openapitools::client::model::PendingCommentToSyncOutbound;
+
+// The calls a drainer makes. pendingWebhookBackend() wires them to a
+// DefaultApi; tests substitute their own.
+struct WebhookBackend {
+    // getPendingWebhookEvents at skip.
+    std::function<pplx::task<std::vector<std::shared_ptr<PendingCommentToSyncOutbound>>>(int64_t skip)> fetch;
+    // getPendingWebhookEventCount with the same filters.
+    std::function<pplx::task<int64_t>()> count;
+    // deletePendingWebhookEvent.
+    std::function<pplx::task<void>(const utility::string_t& eventId)> remove;
+};
+
+// Events matching filter (eventType, domain, attemptCountGT, ...); its skip is ignored.
+WebhookBackend pendingWebhookBackend(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+                                     GetPendingWebhookEventsOptions filter = {});
+
+// Delivers one event. The event is deleted once the returned task succeeds;
+// if it fails the event stays pending and is not handed out again this drain.
+using WebhookHandler = std::function<pplx::task<void>(std::shared_ptr<PendingCommentToSyncOutbound> event)>;
+
+struct DrainMetrics {
+    int64_t pendingAtStart = -1;   // getPendingWebhookEventCount before the first round
+    int64_t pending = -1;          // at the start of the latest round
+    uint64_t rounds = 0;
+    uint64_t fetched = 0;          // events listed, including ones already handled
+    uint64_t handled = 0;          // handler succeeded
+    uint64_t failed = 0;           // handler failed
+    uint64_t acked = 0;            // deleted after handling
+    uint64_t ackFailures = 0;      // delete attempts that failed
+    int64_t maxLagMs = 0;          // oldest handled event's age (createdAt to handling)
+    std::chrono::milliseconds elapsed{0};
+    double eventsPerSecond = 0;    // handled per second of elapsed time
+};
+
+struct DrainFailure {
+    utility::string_t eventId;
+    std::string error;
+    bool handled = false;          // true when only the delete failed
+};
+
+struct DrainReport {
+    DrainMetrics metrics;
+    std::vector<DrainFailure> failures;
+};
+
+struct DrainOptions {
+    // Page requests in flight while listing.
+    size_t fetchParallelism = 4;
+    // Handler calls running at once.
+    size_t workers = 8;
+    // Delete requests in flight at once.
+    size_t maxAcksInFlight = 8;
+    // Delete attempts per event before it is reported as a failure.
+    int maxAckAttempts = 3;
+    // Listing rounds at most; see WebhookDrainer.
+    size_t maxRounds = 10;
+    // Called after every handled or failed event and every round, one call at
+    // a time.
+    std::function<void(const DrainMetrics&)> onProgress;
+};
+
+// Drains the pending-webhook queue: lists the events with concurrent page
+// requests, hands each to the handler on a bounded pool of workers, and
+// deletes it as soon as the handler succeeds, with the deletes pipelined
+// alongside the handling.
+//
+// Delivery is at least once. An event is deleted only after its handler
+// succeeded, and one whose delete failed is re-deleted, not re-handled, when
+// it is listed again. Deleting while listing shifts the skip offsets under the
+// pages still to come, so a listing round can miss events; the drainer lists
+// again until a round finds nothing new or maxRounds is reached.
+//
+// A failed page request stops the listing; drain() rethrows its error once the
+// events listed before it have been handled and deleted.
+class WebhookDrainer {
+public:
+    WebhookDrainer(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, WebhookHandler handler,
+                   GetPendingWebhookEventsOptions filter = {}, DrainOptions options = {});
+    WebhookDrainer(WebhookBackend backend, WebhookHandler handler, DrainOptions options = {});
+
+    pplx::task<DrainReport> drain() const;
+
+private:
+    WebhookBackend backend_;
+    WebhookHandler handler_;
+    DrainOptions options_;
+};
+
+} // namespace batch
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_BATCH_WEBHOOK_DRAINER_HPP
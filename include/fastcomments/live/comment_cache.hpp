@@ -0,0 +1,96 @@
+#ifndef FASTCOMMENTS_LIVE_COMMENT_CACHE_HPP
+#define FASTCOMMENTS_LIVE_COMMENT_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/PublicApi.h"
+#include "fastcomments/live/live_stream.hpp"
+
+namespace fastcomments {
+namespace live {
+
+using org::openapitools::client::api::GetCommentsPublicOptions;
+using org::openapitools::client::api::PublicApi;
+using CommentsResponse = org::openapitools::client::model::GetCommentsResponseWithPresence_PublicComment_;
+
+using CommentsFetch = std::function<pplx::task<std::shared_ptr<CommentsResponse>>(
+    const utility::string_t& tenantId, const utility::string_t& urlId, const GetCommentsPublicOptions& options)>;
+
+CommentsFetch commentsFetch(std::shared_ptr<const PublicApi> api);
+
+// FNV-1a of every option that is set, sso included, since responses differ
+// per viewer.
+uint64_t optionsHash(const GetCommentsPublicOptions& options);
+
+struct CommentCacheOptions {
+    // Responses kept; the least recently used is dropped first.
+    size_t maxEntries = 512;
+};
+
+struct CommentCacheStats {
+    uint64_t hits = 0;
+    uint64_t requests = 0;
+    uint64_t shared = 0;        // gets that joined a request in flight
+    uint64_t patched = 0;       // responses updated in place by an event
+    uint64_t invalidated = 0;   // responses dropped by an event
+    size_t entries = 0;
+};
+
+// getCommentsPublic responses by (tenantId, urlId, optionsHash), kept
+// current by the thread's live events instead of expiring.
+//
+// Events that only change what a listed comment shows are patched into the
+// responses that list it: updated-comment (text, author display, votes,
+// locked) and new-vote / deleted-vote (vote counts). Anything that can add,
+// remove or reorder comments drops the thread's responses: new-comment,
+// deleted-comment, thread-state-change, an update to approval, spam,
+// deleted, pinned or parent, and an update to a comment no cached response
+// lists. Vote changes also drop responses sorted by most votes (MR). A
+// viewer's own vote flags (isVotedUp, myVoteId) are not patched.
+//
+// Patched responses are copies; a response handed out earlier never changes.
+// Concurrent gets of the same response share one request, and a response
+// requested before an event for its thread is returned but not cached.
+class CommentCache {
+public:
+    explicit CommentCache(std::shared_ptr<const PublicApi> api, CommentCacheOptions options = {});
+    explicit CommentCache(CommentsFetch fetch, CommentCacheOptions options = {});
+
+    pplx::task<std::shared_ptr<const CommentsResponse>> get(const utility::string_t& tenantId,
+                                                            const utility::string_t& urlId,
+                                                            const GetCommentsPublicOptions& options);
+
+    // An event from the LiveStream subscribed to (tenantId, urlId).
+    void apply(const utility::string_t& tenantId, const utility::string_t& urlId, const LiveEvent& event);
+    // Callbacks for the LiveStream subscribed to (tenantId, urlId): events go
+    // to apply(), and a reconnect drops the thread since events may have been
+    // missed. Both are safe to call after the cache is gone.
+    LiveStream::EventCallback eventHandler(const utility::string_t& tenantId, const utility::string_t& urlId) const;
+    LiveStream::ReconnectCallback reconnectHandler(const utility::string_t& tenantId, const utility::string_t& urlId) const;
+    // Installs both on the stream, replacing its onEvent and onReconnect
+    // callbacks; call the handlers from your own callbacks to keep those.
+    void attach(LiveStream& stream, const utility::string_t& tenantId, const utility::string_t& urlId) const {
+        stream.onEvent(eventHandler(tenantId, urlId));
+        stream.onReconnect(reconnectHandler(tenantId, urlId));
+    }
+
+    void invalidate(const utility::string_t& tenantId, const utility::string_t& urlId);
+    void clear();
+
+    CommentCacheStats stats() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace live
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_LIVE_COMMENT_CACHE_HPP
@@ -0,0 +1,105 @@
+#ifndef FASTCOMMENTS_LIVE_PRESENCE_SERVICE_HPP
+#define FASTCOMMENTS_LIVE_PRESENCE_SERVICE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "fastcomments/live/live_stream.hpp"
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace api {
+class PublicApi;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace live {
+
+using org::openapitools::client::api::PublicApi;
+
+// userId -> online.
+using PresenceStatuses = std::map<utility::string_t, bool>;
+
+// One getUserPresenceStatuses request. Users missing from the response are
+// taken to be offline.
+using PresenceFetch = std::function<pplx::task<PresenceStatuses>(const std::vector<utility::string_t>& userIds)>;
+
+PresenceFetch presenceFetch(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlIdWS);
+
+struct PresenceOptions {
+    // How long a status is served before it is asked for again. Presence
+    // events refresh it without a request.
+    std::chrono::milliseconds ttl{std::chrono::seconds(30)};
+    // Lookups made within this long of the first queued user share one request.
+    std::chrono::milliseconds batchWindow{10};
+    // Users per request; a full batch is sent at once.
+    size_t maxUsersPerRequest = 100;
+};
+
+struct PresenceStats {
+    uint64_t lookups = 0;
+    uint64_t cached = 0;         // users answered from the cache
+    uint64_t shared = 0;         // users already being fetched for another lookup
+    uint64_t requests = 0;
+    uint64_t usersRequested = 0;
+    uint64_t eventUpdates = 0;   // users updated by presence events
+};
+
+// Presence lookups for one page (tenantId, urlIdWS).
+//
+// lookup() answers from the cache what it can and queues the rest. Users
+// queued within batchWindow of each other, by any number of lookups, go out
+// as one getUserPresenceStatuses request, and a user already being fetched
+// is not asked for twice. Each status is kept for ttl.
+//
+// Pass the page's LiveStream events to apply(): "p-u" events carry the users
+// who joined (uj) and left (ul), and refresh those entries without a request.
+// A status from an event is not overwritten by a response to a request that
+// was sent before the event arrived, and lookups waiting on that request get
+// the event's status too.
+class PresenceService {
+public:
+    PresenceService(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlIdWS,
+                    PresenceOptions options = {});
+    explicit PresenceService(PresenceFetch fetch, PresenceOptions options = {});
+    // Sends whatever is queued. Lookups already handed out still resolve.
+    ~PresenceService();
+
+    PresenceService(const PresenceService&) = delete;
+    PresenceService& operator=(const PresenceService&) = delete;
+
+    // Resolves to the status of every requested user. A failed request fails
+    // the lookups waiting on it.
+    pplx::task<PresenceStatuses> lookup(const std::vector<utility::string_t>& userIds);
+
+    // The cached status, if there is a fresh one.
+    boost::optional<bool> cached(const utility::string_t& userId) const;
+
+    // Applies a "p-u" event; other events are ignored.
+    void apply(const LiveEvent& event);
+    void applyPresence(const std::vector<utility::string_t>& joined, const std::vector<utility::string_t>& left);
+
+    PresenceStats stats() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace live
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_LIVE_PRESENCE_SERVICE_HPP
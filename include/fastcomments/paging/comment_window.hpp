@@ -0,0 +1,97 @@
+#ifndef FASTCOMMENTS_PAGING_COMMENT_WINDOW_HPP
+#define FASTCOMMENTS_PAGING_COMMENT_WINDOW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/PublicApi.h"
+
+namespace fastcomments {
+namespace paging {
+
+using org::openapitools::client::api::GetCommentsPublicOptions;
+using org::openapitools::client::api::PublicApi;
+using org::openapitools::client::model::PublicComment;
+
+// At most one of the two is set; neither means the start of the thread.
+struct CommentCursor {
+    boost::optional<utility::string_t> afterCommentId;
+    boost::optional<utility::string_t> beforeCommentId;
+};
+
+// Up to `limit` comments next to the cursor, in thread order either way.
+using CommentPageFetch = std::function<pplx::task<std::vector<std::shared_ptr<PublicComment>>>(
+    const CommentCursor& cursor, int32_t limit)>;
+
+// getCommentsPublic for one thread. page, skip, limit and the cursors in
+// options are overwritten; everything else (sort direction, sso, asTree, ...)
+// is sent with every request.
+CommentPageFetch commentPageFetch(std::shared_ptr<const PublicApi> api, utility::string_t tenantId,
+                                  utility::string_t urlId, GetCommentsPublicOptions options = {});
+
+// Rough in-memory size of a comment and its children, for the window budget.
+size_t estimateBytes(const PublicComment& comment);
+
+struct CommentWindowOptions {
+    int32_t pageSize = 30;
+    // Estimated bytes of comments held. Pages furthest from the last request
+    // are dropped first; the comments just served are always kept.
+    size_t maxBytes = 2 * 1024 * 1024;
+    // Keep this many pages ready ahead of the last request, in its direction.
+    size_t prefetchPages = 1;
+};
+
+struct CommentWindowStats {
+    uint64_t requests = 0;
+    uint64_t hits = 0;            // served without waiting for a fetch
+    uint64_t fetches = 0;
+    uint64_t evictedPages = 0;
+    size_t comments = 0;          // held now
+    size_t bytes = 0;             // estimated, held now
+};
+
+// A sliding window over one thread's comments for infinite scroll.
+//
+// The window holds one contiguous run of the thread, page by page. A request
+// next to what it holds (the comments after or before an id in the window)
+// is served from memory and extended with afterCommentId / beforeCommentId
+// fetches as needed; a request for an id outside it starts a new window
+// there. After each request the next pages in the scroll direction are
+// prefetched, and pages at the far end are dropped to stay within maxBytes,
+// so a long session on a huge thread holds a bounded number of comments.
+// Comments a fetch returns that the window already holds are skipped.
+//
+// Requests are served one at a time in call order.
+class CommentWindow {
+public:
+    CommentWindow(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId,
+                  GetCommentsPublicOptions options = {}, CommentWindowOptions windowOptions = {});
+    explicit CommentWindow(CommentPageFetch fetch, CommentWindowOptions options = {});
+
+    CommentWindow(const CommentWindow&) = delete;
+    CommentWindow& operator=(const CommentWindow&) = delete;
+
+    // The first `count` comments of the thread.
+    pplx::task<std::vector<std::shared_ptr<PublicComment>>> first(size_t count);
+    // Up to `count` comments after / before commentId; fewer at the ends.
+    pplx::task<std::vector<std::shared_ptr<PublicComment>>> after(const utility::string_t& commentId, size_t count);
+    pplx::task<std::vector<std::shared_ptr<PublicComment>>> before(const utility::string_t& commentId, size_t count);
+
+    CommentWindowStats stats() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace paging
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_PAGING_COMMENT_WINDOW_HPP
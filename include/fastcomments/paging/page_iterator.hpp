@@ -0,0 +1,174 @@
+#ifndef FASTCOMMENTS_PAGING_PAGE_ITERATOR_HPP
+#define FASTCOMMENTS_PAGING_PAGE_ITERATOR_HPP
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/DefaultApi.h"
+#include "FastCommentsClient/api/ModerationApi.h"
+#include "FastCommentsClient/api/PublicApi.h"
+
+namespace fastcomments {
+namespace paging {
+
+// A fetched page and the cursor of the page after it; no cursor means this was
+// the last page.
+template <typename Item, typename Cursor>
+struct Page {
+    std::vector<Item> items;
+    boost::optional<Cursor> next;
+};
+
+// Walks a paginated endpoint one page at a time. When next() resolves with page
+// N the request for page N+1 is already in flight, so processing a page
+// overlaps with fetching the one after it. Call next() again only after the
+// previous call has resolved, like any async generator.
+//
+// If a fetch fails, next() rethrows and the following next() requests the same
+// page again, so a caller can retry without losing its place.
+template <typename Item, typename Cursor>
+class PageIterator {
+public:
+    using PageType = Page<Item, Cursor>;
+    using Fetch = std::function<pplx::task<PageType>(const Cursor&)>;
+
+    PageIterator(Fetch fetch, Cursor first) : state_(std::make_shared<State>()) {
+        state_->fetch = std::move(fetch);
+        state_->cursor = std::move(first);
+    }
+
+    // Resolves to the items of the next page, or to none after the last page.
+    pplx::task<boost::optional<std::vector<Item>>> next() {
+        auto state = state_;
+        if (!state->cursor) return pplx::task_from_result(boost::optional<std::vector<Item>>());
+        if (!state->pending) state->pending = state->start(*state->cursor);
+        auto current = *state->pending;
+        return current.then([state](pplx::task<PageType> fetched) {
+            PageType page;
+            try {
+                page = fetched.get();
+            } catch (...) {
+                state->pending = boost::none;   // next() fetches the same cursor again
+                throw;
+            }
+            state->cursor = page.next;
+            state->pending = boost::none;
+            if (state->cursor) state->pending = state->start(*state->cursor);
+            return boost::optional<std::vector<Item>>(std::move(page.items));
+        });
+    }
+
+    // Calls onPage for every remaining page, in order, and resolves after the
+    // last one. onPage runs while the following page is being fetched.
+    pplx::task<void> forEachPage(std::function<void(std::vector<Item>&)> onPage) {
+        return drain(*this, std::make_shared<std::function<void(std::vector<Item>&)>>(std::move(onPage)));
+    }
+
+    // Cursor of the page the next call to next() returns; none once exhausted.
+    const boost::optional<Cursor>& cursor() const { return state_->cursor; }
+    bool done() const { return !state_->cursor; }
+
+private:
+    struct State {
+        Fetch fetch;
+        boost::optional<Cursor> cursor;
+        boost::optional<pplx::task<PageType>> pending;
+
+        ~State() {
+            // A prefetch nobody asked for may still fail; observe it.
+            if (pending) {
+                pending->then([](pplx::task<PageType> t) {
+                    try {
+                        t.get();
+                    } catch (...) {
+                    }
+                });
+            }
+        }
+
+        pplx::task<PageType> start(const Cursor& at) {
+            try {
+                return fetch(at);
+            } catch (...) {
+                return pplx::task_from_exception<PageType>(std::current_exception());
+            }
+        }
+    };
+
+    static pplx::task<void> drain(PageIterator it, std::shared_ptr<std::function<void(std::vector<Item>&)>> onPage) {
+        return it.next().then([it, onPage](boost::optional<std::vector<Item>> items) {
+            if (!items) return pplx::task_from_result();
+            (*onPage)(*items);
+            return drain(it, onPage);
+        });
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::api::ModerationApi;
+using org::openapitools::client::api::PublicApi;
+using org::openapitools::client::model::APIAuditLog;
+using org::openapitools::client::model::APIComment;
+using org::openapitools::client::model::APISSOUser;
+using org::openapitools::client::model::FeedPost;
+using org::openapitools::client::model::PageUserEntry;
+using org::openapitools::client::model::PublicPage;
+
+// Cursor for endpoints that page by offset.
+using SkipCursor = int64_t;
+
+// Cursor for getOnlineUsers/getOfflineUsers: the (name, userId) of the last
+// user returned.
+struct UserCursor {
+    utility::string_t afterName;
+    utility::string_t afterUserId;
+};
+
+// page/skip. options.skip is the starting offset and options.limit the page
+// size (100 when unset); page/skip in options are otherwise overwritten. A
+// short page is the last.
+PageIterator<std::shared_ptr<APIComment>, SkipCursor> commentPages(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetCommentsOptions options = {});
+PageIterator<std::shared_ptr<APIAuditLog>, SkipCursor> auditLogPages(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetAuditLogsOptions options = {});
+// getSSOUsers takes no limit, so the walk ends on the first empty page.
+PageIterator<std::shared_ptr<APISSOUser>, SkipCursor> ssoUserPages(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, int32_t skip = 0);
+
+// cursor: follows nextCursor until the server stops returning one.
+PageIterator<std::shared_ptr<PublicPage>, utility::string_t> publicPagePages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetPagesPublicOptions options = {});
+
+// afterId: the id of the last item is the cursor for the next request. Feed
+// posts end on a short page when options.limit is set, otherwise on an empty
+// page; comment ids end when hasMore is false.
+PageIterator<std::shared_ptr<FeedPost>, utility::string_t> feedPostPages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetFeedPostsPublicOptions options = {});
+PageIterator<utility::string_t, utility::string_t> commentIdPages(
+    std::shared_ptr<const ModerationApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetApiIdsOptions options = {});
+
+// afterName/afterUserId: follows nextAfterName/nextAfterUserId.
+PageIterator<std::shared_ptr<PageUserEntry>, UserCursor> onlineUserPages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId);
+PageIterator<std::shared_ptr<PageUserEntry>, UserCursor> offlineUserPages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId);
+
+} // namespace paging
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_PAGING_PAGE_ITERATOR_HPP
@@ -0,0 +1,318 @@
+#ifndef FASTCOMMENTS_PAGING_SKIP_FAN_OUT_HPP
+#define FASTCOMMENTS_PAGING_SKIP_FAN_OUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+#include "FastCommentsClient/api/DefaultApi.h"
+
+namespace fastcomments {
+namespace paging {
+
+struct FanOutOptions {
+    // Page requests in flight at once.
+    size_t parallelism = 4;
+    // Items per page. 0 learns it from the first page, which is then fetched
+    // on its own before the fan-out starts.
+    int64_t pageSize = 0;
+    int64_t startSkip = 0;
+    // Optional probe for the number of items from startSkip on. Only the first
+    // page is requested until it answers; after that requests are not issued
+    // past the total unless the page at the reported end comes back full.
+    std::function<pplx::task<int64_t>()> total;
+};
+
+struct FanOutStats {
+    uint64_t pages = 0;      // delivered to the caller
+    uint64_t items = 0;
+    uint64_t requests = 0;   // including pages fetched past the end and discarded
+    int64_t pageSize = 0;
+};
+
+// Full scan of an endpoint paged only by skip. Up to `parallelism` pages are
+// requested concurrently, ahead of the end of the data: a short (or empty) page
+// marks the end, and anything fetched past it is discarded. Pages are handed to
+// the caller strictly in order, one at a time, as soon as every page before
+// them has arrived.
+//
+// A failed page stops new requests. run() rethrows its error once the pages
+// before it have been delivered and the requests in flight have finished;
+// failures past the end of the data are ignored.
+template <typename Item>
+class SkipFanOut {
+public:
+    using Fetch = std::function<pplx::task<std::vector<Item>>(int64_t skip)>;
+    using OnPage = std::function<void(std::vector<Item>&)>;
+
+    SkipFanOut(Fetch fetch, FanOutOptions options = {}) : fetch_(std::move(fetch)), options_(std::move(options)) {
+        if (options_.parallelism == 0) options_.parallelism = 1;
+    }
+
+    pplx::task<FanOutStats> run(OnPage onPage) const {
+        auto scan = std::make_shared<Scan>(fetch_, options_, std::move(onPage));
+        if (options_.total) {
+            auto probe = options_.total;
+            scan->addProbe(probe());
+        }
+        if (options_.pageSize > 0) {
+            scan->start(options_.pageSize, 0);
+        } else {
+            scan->learnPageSize();
+        }
+        return pplx::create_task(scan->done);
+    }
+
+    // Every item, in order.
+    pplx::task<std::vector<Item>> collect() const {
+        auto items = std::make_shared<std::vector<Item>>();
+        return run([items](std::vector<Item>& page) {
+            items->insert(items->end(), std::make_move_iterator(page.begin()), std::make_move_iterator(page.end()));
+        }).then([items](FanOutStats) { return std::move(*items); });
+    }
+
+private:
+    static constexpr int64_t kOpen = std::numeric_limits<int64_t>::max();
+
+    struct Scan : std::enable_shared_from_this<Scan> {
+        Scan(Fetch f, const FanOutOptions& o, OnPage p) : fetch(std::move(f)), options(o), onPage(std::move(p)) {}
+
+        Fetch fetch;
+        FanOutOptions options;
+        OnPage onPage;
+        pplx::task_completion_event<FanOutStats> done;
+
+        std::mutex mu;
+        FanOutStats stats;
+        int64_t pageSize = 0;
+        int64_t nextIssue = 0;      // index of the next page to request
+        int64_t issueLimit = kOpen; // last page index worth requesting
+        int64_t end = kOpen;        // index of the first short page
+        int64_t nextDeliver = 0;
+        size_t inFlight = 0;
+        bool delivering = false;
+        bool started = false;
+        bool probing = false;
+        std::map<int64_t, std::vector<Item>> ready;
+        std::map<int64_t, std::exception_ptr> failed;
+        std::exception_ptr error;
+        int64_t probedTotal = -1;
+        int64_t lastFull = -1;      // highest page index that came back full
+
+        void addProbe(pplx::task<int64_t> probe) {
+            auto self = this->shared_from_this();
+            std::lock_guard<std::mutex> lock(mu);
+            ++inFlight;
+            probing = true;
+            probe.then([self](pplx::task<int64_t> t) {
+                int64_t total = -1;
+                try {
+                    total = t.get();
+                } catch (...) {
+                    // Without a total the scan just walks ahead.
+                }
+                std::unique_lock<std::mutex> lock(self->mu);
+                --self->inFlight;
+                self->probing = false;
+                self->probedTotal = total;
+                self->applyProbe();
+                self->pump(lock);
+            });
+        }
+
+        // Caller holds mu. A full page at or past the probed end means the total
+        // was exact or stale, so one more page is always worth asking for.
+        void applyProbe() {
+            if (probedTotal < 0 || pageSize <= 0) return;
+            const int64_t pages = (probedTotal + pageSize - 1) / pageSize;
+            issueLimit = std::max<int64_t>(pages - 1, lastFull + 1);
+        }
+
+        void learnPageSize() {
+            auto self = this->shared_from_this();
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                ++inFlight;
+                ++stats.requests;
+            }
+            call(options.startSkip).then([self](pplx::task<std::vector<Item>> t) {
+                std::vector<Item> items;
+                try {
+                    items = t.get();
+                } catch (...) {
+                    std::unique_lock<std::mutex> lock(self->mu);
+                    --self->inFlight;
+                    self->error = std::current_exception();
+                    self->pump(lock);
+                    return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(self->mu);
+                    --self->inFlight;
+                }
+                self->start(static_cast<int64_t>(items.size()), 1);
+                self->complete(0, std::move(items));
+            });
+        }
+
+        void start(int64_t size, int64_t firstIssue) {
+            std::unique_lock<std::mutex> lock(mu);
+            pageSize = size;
+            stats.pageSize = size;
+            nextIssue = firstIssue;
+            started = true;
+            // An empty first page means there is nothing to scan.
+            if (pageSize <= 0) end = 0;
+            applyProbe();
+            pump(lock);
+        }
+
+        pplx::task<std::vector<Item>> call(int64_t skip) {
+            try {
+                return fetch(skip);
+            } catch (...) {
+                return pplx::task_from_exception<std::vector<Item>>(std::current_exception());
+            }
+        }
+
+        void complete(int64_t index, std::vector<Item> items) {
+            std::unique_lock<std::mutex> lock(mu);
+            if (static_cast<int64_t>(items.size()) < pageSize || items.empty()) {
+                end = std::min(end, index);
+            } else {
+                lastFull = std::max(lastFull, index);
+                applyProbe();
+            }
+            if (index <= end) ready.emplace(index, std::move(items));
+            pump(lock);
+        }
+
+        void fail(int64_t index, std::exception_ptr e) {
+            std::unique_lock<std::mutex> lock(mu);
+            if (index <= end) failed.emplace(index, e);
+            pump(lock);
+        }
+
+        // Delivers ready pages in order, tops up the requests in flight and
+        // resolves `done` once nothing is left. Called with mu held.
+        void pump(std::unique_lock<std::mutex>& lock) {
+            if (!delivering) {
+                delivering = true;
+                while (!error && nextDeliver <= end) {
+                    auto it = ready.find(nextDeliver);
+                    if (it == ready.end()) {
+                        // Only a failure the scan actually needed is an error.
+                        auto failure = failed.find(nextDeliver);
+                        if (failure != failed.end()) error = failure->second;
+                        break;
+                    }
+                    std::vector<Item> items = std::move(it->second);
+                    ready.erase(it);
+                    ++nextDeliver;
+                    if (items.empty()) continue;
+                    ++stats.pages;
+                    stats.items += items.size();
+                    lock.unlock();
+                    try {
+                        onPage(items);
+                    } catch (...) {
+                        lock.lock();
+                        if (!error) error = std::current_exception();
+                        break;
+                    }
+                    lock.lock();
+                }
+                delivering = false;
+            }
+            issue();
+            if (inFlight == 0 && !delivering && (error || (started && nextDeliver > end))) {
+                if (error) {
+                    done.set_exception(error);
+                } else {
+                    done.set(stats);
+                }
+            }
+        }
+
+        // Called with mu held.
+        void issue() {
+            if (!started || error || !failed.empty()) return;
+            auto self = this->shared_from_this();
+            // Only the first page goes out alongside the probe.
+            while (inFlight < options.parallelism && nextIssue <= end && nextIssue <= issueLimit &&
+                   !(probing && nextIssue > 0)) {
+                const int64_t index = nextIssue++;
+                ++inFlight;
+                ++stats.requests;
+                call(options.startSkip + index * pageSize).then([self, index](pplx::task<std::vector<Item>> t) {
+                    std::vector<Item> items;
+                    std::exception_ptr e;
+                    try {
+                        items = t.get();
+                    } catch (...) {
+                        e = std::current_exception();
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(self->mu);
+                        --self->inFlight;
+                    }
+                    if (e) {
+                        self->fail(index, e);
+                    } else {
+                        self->complete(index, std::move(items));
+                    }
+                });
+            }
+        }
+    };
+
+    Fetch fetch_;
+    FanOutOptions options_;
+};
+
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::model::APIAuditLog;
+using org::openapitools::client::model::APISSOUser;
+using org::openapitools::client::model::APITenantDailyUsage;
+using org::openapitools::client::model::PendingCommentToSyncOutbound;
+using org::openapitools::client::model::QuestionResult;
+using org::openapitools::client::model::User;
+
+// Scans over the skip-paged DefaultApi endpoints. The skip in each options
+// struct is ignored; use FanOutOptions::startSkip.
+//
+// getAuditLogs takes a limit, so its page size is options.limit (100 when
+// unset) rather than learned.
+SkipFanOut<std::shared_ptr<APIAuditLog>> auditLogScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetAuditLogsOptions options = {}, FanOutOptions fanOut = {});
+SkipFanOut<std::shared_ptr<User>> tenantUserScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, FanOutOptions fanOut = {});
+SkipFanOut<std::shared_ptr<APISSOUser>> ssoUserScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, FanOutOptions fanOut = {});
+// Probes getPendingWebhookEventCount with the same filters unless fanOut.total is set.
+SkipFanOut<std::shared_ptr<PendingCommentToSyncOutbound>> pendingWebhookEventScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetPendingWebhookEventsOptions options = {}, FanOutOptions fanOut = {});
+SkipFanOut<std::shared_ptr<QuestionResult>> questionResultScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetQuestionResultsOptions options = {}, FanOutOptions fanOut = {});
+SkipFanOut<std::shared_ptr<APITenantDailyUsage>> tenantDailyUsageScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+    org::openapitools::client::api::GetTenantDailyUsagesOptions options = {}, FanOutOptions fanOut = {});
+
+} // namespace paging
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_PAGING_SKIP_FAN_OUT_HPP
@@ -0,0 +1,126 @@
+#ifndef FASTCOMMENTS_STORE_COMMENT_STORE_HPP
+#define FASTCOMMENTS_STORE_COMMENT_STORE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <cpprest/details/basic_types.h>
+
+#include "FastCommentsClient/model/PublicComment.h"
+
+namespace fastcomments {
+namespace store {
+
+using org::openapitools::client::model::PublicComment;
+
+// A stored comment, read in place from the mapped file. The strings are UTF-8
+// and stay valid for as long as the store is open, even after the comment is
+// replaced or removed.
+struct CommentView {
+    enum Flag : uint32_t {
+        Verified = 1u << 0,
+        HasImages = 1u << 1,
+        ByAdmin = 1u << 2,
+        ByModerator = 1u << 3,
+        Pinned = 1u << 4,
+        Locked = 1u << 5,
+        Deleted = 1u << 6,
+        DeletedUser = 1u << 7,
+        Spam = 1u << 8,
+        Approved = 1u << 9,
+        HasChildren = 1u << 10
+    };
+
+    std::string_view id;
+    std::string_view parentId;
+    std::string_view userId;
+    std::string_view anonUserId;
+    std::string_view commenterName;
+    std::string_view commenterLink;
+    std::string_view avatarSrc;
+    std::string_view displayLabel;
+    std::string_view commentHTML;
+    int64_t date = 0;   // epoch ms
+    int32_t votes = 0;
+    int32_t votesUp = 0;
+    int32_t votesDown = 0;
+    int32_t childCount = 0;
+    uint32_t flags = 0;
+
+    bool has(Flag flag) const { return (flags & flag) != 0; }
+    // A copy of the stored fields as the API type.
+    std::shared_ptr<PublicComment> toPublicComment() const;
+};
+
+struct CommentStoreOptions {
+    // Size of each data file. Files are created sparse at this size and
+    // mapped whole; a comment bigger than this gets a file of its own size.
+    size_t segmentBytes = 64 * 1024 * 1024;
+};
+
+struct CommentStoreStats {
+    size_t segments = 0;
+    size_t threads = 0;
+    size_t comments = 0;     // current, across all threads
+    uint64_t records = 0;    // including replaced and removed versions
+    uint64_t bytes = 0;      // of records written
+};
+
+// An on-disk store of comments by tenantId and urlId, for a render tier that
+// should come back warm after a restart instead of refetching every thread.
+//
+// Records are appended to memory-mapped segment files in the directory and
+// never rewritten: a changed comment is appended again and a removed one gets
+// a tombstone. Opening the store scans the records once to rebuild the
+// per-thread index, which points into the mappings, so reads copy nothing and
+// the data itself is paged in by the OS on demand. A record torn by a crash
+// fails its checksum and ends the scan of its segment.
+//
+// Records use the host's byte order. Space taken by replaced versions is not
+// reclaimed. Safe for concurrent readers and writers within one process; one
+// process at a time may open a directory.
+class CommentStore {
+public:
+    // Creates the directory if needed. Throws std::system_error if a segment
+    // can't be opened or mapped.
+    explicit CommentStore(std::string directory, CommentStoreOptions options = {});
+    ~CommentStore();
+
+    CommentStore(const CommentStore&) = delete;
+    CommentStore& operator=(const CommentStore&) = delete;
+
+    // Adds the comment, or a new version of it, to the thread. A thread's
+    // comments keep the order they were first added in. Nested children
+    // (asTree) are not stored; add them as comments of their own.
+    void put(const utility::string_t& tenantId, const utility::string_t& urlId, const PublicComment& comment);
+    void put(const utility::string_t& tenantId, const utility::string_t& urlId,
+             const std::vector<std::shared_ptr<PublicComment>>& comments);
+    // Returns false if the thread doesn't hold the comment.
+    bool remove(const utility::string_t& tenantId, const utility::string_t& urlId, const utility::string_t& commentId);
+
+    std::vector<CommentView> thread(const utility::string_t& tenantId, const utility::string_t& urlId) const;
+    boost::optional<CommentView> find(const utility::string_t& tenantId, const utility::string_t& urlId,
+                                      const utility::string_t& commentId) const;
+    size_t threadSize(const utility::string_t& tenantId, const utility::string_t& urlId) const;
+
+    // Writes what has been put so far to disk.
+    void flush();
+
+    const std::string& directory() const { return directory_; }
+    CommentStoreStats stats() const;
+
+private:
+    struct State;
+    std::string directory_;
+    std::unique_ptr<State> state_;
+};
+
+} // namespace store
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_STORE_COMMENT_STORE_HPP
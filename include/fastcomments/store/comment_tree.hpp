@@ -0,0 +1,106 @@
+#ifndef FASTCOMMENTS_STORE_COMMENT_TREE_HPP
+#define FASTCOMMENTS_STORE_COMMENT_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/PubSubComment.h"
+#include "FastCommentsClient/model/PublicComment.h"
+#include "fastcomments/live/live_stream.hpp"
+
+namespace fastcomments {
+namespace store {
+
+using org::openapitools::client::model::APIComment;
+using org::openapitools::client::model::PubSubComment;
+using org::openapitools::client::model::PublicComment;
+
+// The same comment as the render type. Fields PublicComment lacks are dropped.
+std::shared_ptr<PublicComment> toPublicComment(const APIComment& comment);
+std::shared_ptr<PublicComment> toPublicComment(const PubSubComment& comment);
+
+// Sibling order; the same orders as SortDirections OF, NF and MR. Ties are
+// broken by newer date, then by id.
+enum class CommentOrder {
+    Oldest,
+    Newest,
+    MostVotes
+};
+
+// An index of one thread's comments by id and by parent, with every child
+// list kept sorted and every comment's reply count kept current, so a render
+// is a walk over the tree rather than a rebuild from a flat list.
+//
+// upsert() and remove() cost O(log siblings) plus the comment's depth, for
+// the reply counts of its ancestors. A comment whose parent has not arrived
+// yet is held aside and attached when the parent comes; until then it is not
+// part of the tree. Removing a comment removes its replies with it.
+//
+// Not synchronized: callers share one between threads under their own lock.
+class CommentTree {
+public:
+    // Return false to skip the comment's replies.
+    using Visitor = std::function<bool(const std::shared_ptr<PublicComment>& comment, int depth)>;
+
+    explicit CommentTree(CommentOrder order = CommentOrder::Newest);
+    ~CommentTree();
+
+    CommentTree(const CommentTree&) = delete;
+    CommentTree& operator=(const CommentTree&) = delete;
+
+    // Inserts the comment or replaces the one with its id, moving it if its
+    // parent, date or votes changed. A comment's nested children (asTree
+    // pages) are inserted as comments of their own.
+    void upsert(std::shared_ptr<PublicComment> comment);
+    void upsert(const std::vector<std::shared_ptr<PublicComment>>& comments);
+    void upsert(const std::vector<std::shared_ptr<APIComment>>& comments);
+    // Returns false if the id is unknown.
+    bool remove(const utility::string_t& commentId);
+    // new-comment, updated-comment and deleted-comment events; returns
+    // whether the tree changed. Other events are ignored.
+    bool apply(const live::LiveEvent& event);
+    void clear();
+
+    std::shared_ptr<PublicComment> find(const utility::string_t& commentId) const;
+    // The direct replies in order; the top-level comments for an empty id.
+    std::vector<std::shared_ptr<PublicComment>> children(const utility::string_t& parentId = {}) const;
+    // Replies at any depth below the comment; the whole thread for an empty id.
+    size_t replyCount(const utility::string_t& commentId = {}) const;
+    // Depth-first in order, from the replies of parentId (depth 0).
+    void walk(const Visitor& visit, const utility::string_t& parentId = {}) const;
+
+    size_t size() const;       // comments in the tree
+    size_t detached() const;   // waiting for their parent
+
+private:
+    struct Node;
+    struct Less {
+        CommentOrder order;
+        bool operator()(const Node* a, const Node* b) const;
+    };
+
+    const Node* node(const utility::string_t& commentId) const;
+    void attach(Node* node);
+    void detach(Node* node);
+    void erase(Node* node);
+    void walk(const Node* parent, const Visitor& visit, int depth) const;
+
+    CommentOrder order_;
+    std::unique_ptr<Node> root_;
+    std::unordered_map<utility::string_t, std::unique_ptr<Node>> nodes_;
+    // parentId -> ids of comments waiting for it.
+    std::unordered_map<utility::string_t, std::unordered_set<utility::string_t>> waiting_;
+};
+
+} // namespace store
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_STORE_COMMENT_TREE_HPP
@@ -0,0 +1,145 @@
+#ifndef FASTCOMMENTS_SYNC_EVENT_LOG_SYNC_HPP
+#define FASTCOMMENTS_SYNC_EVENT_LOG_SYNC_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace api {
+class PublicApi;
+}
+namespace model {
+class EventLogEntry;
+class LiveEvent;
+class PubSubComment;
+class PubSubVote;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace sync {
+
+using org::openapitools::client::api::PublicApi;
+using org::openapitools::client::model::EventLogEntry;
+using org::openapitools::client::model::LiveEvent;
+using org::openapitools::client::model::PubSubComment;
+using org::openapitools::client::model::PubSubVote;
+
+// Reads the event log between two times (ms since epoch). threadEventLog() and
+// globalEventLog() wire it to PublicApi; tests substitute their own.
+using EventLogFetch = std::function<pplx::task<std::vector<std::shared_ptr<EventLogEntry>>>(int64_t startTime, int64_t endTime)>;
+
+// getEventLog: the events of one thread.
+EventLogFetch threadEventLog(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId,
+                             utility::string_t userIdWS);
+// getGlobalEventLog: the tenant-wide events visible to the subscriber.
+EventLogFetch globalEventLog(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId,
+                             utility::string_t userIdWS);
+
+// What an event does to the local copy. Calls come one at a time and in
+// event order. Members left empty ignore that kind of event.
+struct ReplicaStore {
+    // new-comment and updated-comment.
+    std::function<void(const PubSubComment& comment)> upsertComment;
+    // deleted-comment.
+    std::function<void(const PubSubComment& comment)> removeComment;
+    // new-vote (added) and deleted-vote.
+    std::function<void(const PubSubVote& vote, bool added)> applyVote;
+    // Every other event type.
+    std::function<void(const LiveEvent& event)> other;
+};
+
+// A ReplicaStore that keeps the comments in memory, keyed by id, with vote
+// events applied to their counts.
+class MemoryReplica {
+public:
+    ReplicaStore store();
+
+    std::shared_ptr<const PubSubComment> find(const utility::string_t& commentId) const;
+    size_t size() const;
+
+private:
+    mutable std::mutex mu_;
+    std::unordered_map<utility::string_t, std::shared_ptr<PubSubComment>> comments_;
+};
+
+// Position in the log. Events already applied within `overlap` of timestamp
+// are remembered by id, so re-reading that window applies nothing twice.
+struct SyncCheckpoint {
+    int64_t timestamp = 0;   // newest applied event, ms since epoch
+    // (event id, createdAt) of the applied events within overlap of timestamp.
+    std::vector<std::pair<utility::string_t, int64_t>> recent;
+
+    static bool read(const std::string& path, SyncCheckpoint& out);
+    // Replaces path atomically.
+    void write(const std::string& path) const;
+};
+
+struct SyncResult {
+    size_t requests = 0;
+    size_t fetched = 0;
+    size_t applied = 0;
+    size_t duplicates = 0;       // already applied by an earlier sync or request
+    size_t undecodable = 0;      // data that isn't a live event; skipped
+};
+
+struct EventLogSyncOptions {
+    // Each sync re-reads this much of the log before the checkpoint, to pick
+    // up events that were written late. Duplicates are dropped by id.
+    std::chrono::milliseconds overlap{5000};
+    // Saved after every sync that applied something. Empty keeps the
+    // checkpoint in memory only.
+    std::string checkpointPath;
+};
+
+// Keeps a ReplicaStore current by applying the event log since the last sync,
+// so the cost of staying fresh follows the number of changes rather than the
+// size of the threads.
+//
+// A sync reads from the checkpoint (minus the overlap) to endTime and applies
+// the events it has not applied before in (createdAt, id) order. In case the
+// server capped the response, it reads again from the newest event returned
+// for as long as responses come back as long as the longest one seen, and
+// stops at a shorter one. The first sync starts from the checkpoint passed in or
+// read from checkpointPath; with neither it starts at 0, which replays the
+// whole log.
+class EventLogSync {
+public:
+    EventLogSync(EventLogFetch fetch, ReplicaStore store, EventLogSyncOptions options = {});
+    EventLogSync(EventLogFetch fetch, ReplicaStore store, SyncCheckpoint from, EventLogSyncOptions options = {});
+
+    EventLogSync(const EventLogSync&) = delete;
+    EventLogSync& operator=(const EventLogSync&) = delete;
+
+    // Applies events up to endTime (ms since epoch). Syncs on one object run
+    // one after another.
+    pplx::task<SyncResult> sync(int64_t endTime);
+    // Up to now.
+    pplx::task<SyncResult> sync();
+
+    SyncCheckpoint checkpoint() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace sync
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_SYNC_EVENT_LOG_SYNC_HPP
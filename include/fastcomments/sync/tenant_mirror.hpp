@@ -0,0 +1,118 @@
+#ifndef FASTCOMMENTS_SYNC_TENANT_MIRROR_HPP
+#define FASTCOMMENTS_SYNC_TENANT_MIRROR_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpprest/details/basic_types.h>
+#include <pplx/pplxtasks.h>
+
+namespace org {
+namespace openapitools {
+namespace client {
+namespace api {
+class DefaultApi;
+}
+namespace model {
+class APIComment;
+class APIPage;
+class PublicVote;
+class User;
+}
+}
+}
+}
+
+namespace fastcomments {
+namespace sync {
+
+using org::openapitools::client::api::DefaultApi;
+using org::openapitools::client::model::APIComment;
+using org::openapitools::client::model::APIPage;
+using org::openapitools::client::model::PublicVote;
+using org::openapitools::client::model::User;
+
+// The reads a mirror makes. tenantMirrorSource() wires them to a DefaultApi;
+// tests substitute their own.
+struct MirrorSource {
+    // getPages: every page of the tenant.
+    std::function<pplx::task<std::vector<std::shared_ptr<APIPage>>>()> pages;
+    // getComments for one urlId, oldest first.
+    std::function<pplx::task<std::vector<std::shared_ptr<APIComment>>>(const utility::string_t& urlId, int32_t skip,
+                                                                        int32_t limit)> comments;
+    // getVotes for one urlId; applied votes only.
+    std::function<pplx::task<std::vector<std::shared_ptr<PublicVote>>>(const utility::string_t& urlId)> votes;
+    // getTenantUsers; an empty page ends the list.
+    std::function<pplx::task<std::vector<std::shared_ptr<User>>>(int32_t skip)> users;
+};
+
+MirrorSource tenantMirrorSource(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId);
+
+// Where mirrored records go. Calls are made one at a time, so a sink needs no
+// locking of its own. A resumed run repeats the thread that was in progress,
+// so sinks should upsert by id. Leave a member empty to skip that entity: an
+// empty comments and votes skips the per-page crawl altogether.
+struct MirrorSink {
+    std::function<void(const std::vector<std::shared_ptr<APIPage>>& pages)> pages;
+    std::function<void(const utility::string_t& urlId, const std::vector<std::shared_ptr<APIComment>>& comments)> comments;
+    std::function<void(const utility::string_t& urlId, const std::vector<std::shared_ptr<PublicVote>>& votes)> votes;
+    std::function<void(const std::vector<std::shared_ptr<User>>& users)> users;
+};
+
+struct MirrorStats {
+    uint64_t requests = 0;
+    uint64_t pages = 0;
+    uint64_t threads = 0;           // urlIds whose comments and votes are done, this run
+    uint64_t threadsResumed = 0;    // skipped because the checkpoint had them
+    uint64_t threadsTotal = 0;
+    uint64_t comments = 0;
+    uint64_t votes = 0;
+    uint64_t users = 0;
+    std::chrono::milliseconds elapsed{0};
+    // Comments, votes and users written per second of elapsed time.
+    double recordsPerSecond = 0;
+};
+
+struct MirrorOptions {
+    // Requests in flight for the tenant at once.
+    size_t concurrency = 8;
+    int32_t commentPageSize = 100;
+    // Journal of finished threads, appended as they complete. An interrupted
+    // run started again with the same path skips everything the journal
+    // lists. Empty disables checkpointing.
+    std::string checkpointPath;
+    // Called after every finished thread and after the users, one call at a
+    // time.
+    std::function<void(const MirrorStats&)> onProgress;
+};
+
+// Copies a tenant's pages, comments, votes and users into a sink.
+//
+// The page list comes first; then the threads (comments page by page, then
+// votes) and the user list are crawled by `concurrency` lanes that each keep
+// one request in flight, so a tenant with many small threads is fetched
+// `concurrency` threads at a time. The first failed request stops the lanes
+// from starting new work and fails run() once the requests in flight are
+// done; everything finished before that is in the checkpoint.
+class TenantMirror {
+public:
+    TenantMirror(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, MirrorSink sink, MirrorOptions options = {});
+    TenantMirror(MirrorSource source, MirrorSink sink, MirrorOptions options = {});
+
+    pplx::task<MirrorStats> run() const;
+
+private:
+    MirrorSource source_;
+    MirrorSink sink_;
+    MirrorOptions options_;
+};
+
+} // namespace sync
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_SYNC_TENANT_MIRROR_HPP
@@ -0,0 +1,522 @@
+#!/usr/bin/env python3
+"""Post-generation passes over the cpp-restsdk models and APIs.
+
+The generator templates can't express a few things we need from the models, so
+update.sh runs this over ./client after every regeneration. Each pass rewrites
+generated code it recognises and leaves everything else alone, which also makes
+the script safe to run twice.
+
+Usage: ./postprocess_models.py [client_dir]
+"""
+
+import pathlib
+import re
+import sys
+
+# One generated `if(val.has_field(...)) { ... }` block of a model's fromJson().
+FIELD_BLOCK = re.compile(
+    r'    if\(val\.has_field\(utility::conversions::to_string_t\(_XPLATSTR\("(?P<key>[^"]+)"\)\)\)\)\n'
+    r'    \{\n'
+    r'        const web::json::value& fieldValue = val\.at\(utility::conversions::to_string_t\(_XPLATSTR\("(?P=key)"\)\)\);\n'
+    r'        if\(!fieldValue\.is_null\(\)\)\n'
+    r'        \{\n'
+    r'(?P<body>(?:            .*\n|[ \t]*\n)*?)'
+    r'        \}\n'
+    r'    \}\n'
+)
+
+FROM_JSON = re.compile(
+    r'^bool (?P<model>\w+)::fromJson\(const web::json::value& val\)\n'
+    r'\{\n'
+    r'    bool ok = true;\n'
+    r'(?P<blocks>(?:' + FIELD_BLOCK.pattern + r')*)'
+    r'(?P<additional>    // Capture additional properties[\s\S]*?\n    \}\n)?'
+    r'    return ok;\n'
+    r'\}\n',
+    re.M,
+)
+
+
+def _dispatch_case(key, body):
+    lines = [line for line in body.split('\n') if line.strip()]
+    out = [
+        '        case ModelBase::fieldHash(_XPLATSTR("%s")):' % key,
+        '            if(field.first == _XPLATSTR("%s"))' % key,
+        '            {',
+        '                if(!fieldValue.is_null())',
+        '                {',
+    ]
+    out += ['        ' + line for line in lines]
+    out += [
+        '                }',
+        '                continue;',
+        '            }',
+        '            break;',
+    ]
+    return '\n'.join(out) + '\n'
+
+
+def _rewrite_from_json(match):
+    blocks = list(FIELD_BLOCK.finditer(match.group('blocks')))
+    if not blocks:
+        return match.group(0)
+    has_additional = match.group('additional') is not None
+
+    out = 'bool %s::fromJson(const web::json::value& val)\n{\n' % match.group('model')
+    out += '    bool ok = true;\n'
+    out += '    if(!val.is_object())\n    {\n        return ok;\n    }\n'
+    out += '    // Single pass over the payload; each key is dispatched on its hash.\n'
+    out += '    for(const auto& field : val.as_object())\n    {\n'
+    out += '        const web::json::value& fieldValue = field.second;\n'
+    out += '        switch(ModelBase::fieldHash(field.first))\n        {\n'
+    for block in blocks:
+        out += _dispatch_case(block.group('key'), block.group('body'))
+    out += '        default:\n            break;\n        }\n'
+    if has_additional:
+        out += '        // This is an additional property\n'
+        out += '        m_AdditionalProperties[field.first] = fieldValue;\n'
+        out += '        m_AdditionalPropertiesIsSet = true;\n'
+    out += '    }\n    return ok;\n}\n'
+    return out
+
+
+def single_pass_from_json(model):
+    """Decode with one walk over the JSON object instead of a has_field()/at()
+    lookup per schema field; unknown keys fall through the switch."""
+    model.source = FROM_JSON.sub(_rewrite_from_json, model.source)
+
+
+# Member block of a generated model header, which ends right before `};`.
+MEMBERS = re.compile(r'^protected:\n(?P<members>(?:    .+;\n|\n)*)(?=^\};)', re.M)
+MEMBER = re.compile(r'^    (?P<type>.+) m_(?P<name>\w+);\n(?P<flag>    bool m_(?P=name)IsSet;\n)?', re.M)
+
+SCALAR_DEFAULTS = {
+    'bool': 'false',
+    'int32_t': '0',
+    'int64_t': '0L',
+    'double': '0.0',
+    'float': '0.0f',
+}
+
+
+class Field(object):
+    def __init__(self, name, type_, optional):
+        self.name = name
+        self.type = type_
+        self.optional = optional
+        self.bit = 'FieldBit_%s' % name
+
+    def size_rank(self):
+        # Smallest members first: they pack into the tail padding of ModelBase
+        # and leave no holes in front of the 8-byte aligned members.
+        if self.type == 'bool':
+            return 0
+        if self.type in ('int32_t', 'float') or self.type.endswith('Enum'):
+            return 1
+        return 2
+
+
+def _generated_fields(header):
+    """Fields still using the generated `bool m_XIsSet` / boost::optional layout."""
+    match = MEMBERS.search(header)
+    if match is None:
+        return []
+    fields = []
+    for member in MEMBER.finditer(match.group('members')):
+        type_ = member.group('type')
+        optional = type_.startswith('boost::optional<')
+        if optional:
+            type_ = type_[len('boost::optional<'):-1]
+        elif member.group('flag') is None:
+            return []
+        fields.append(Field(member.group('name'), type_, optional))
+    return fields
+
+
+def _compact_members(header, fields):
+    members = 'protected:\n'
+    members += '    enum FieldBit\n    {\n'
+    members += ''.join('        %s,\n' % field.bit for field in fields)
+    members += '        FieldBitCount\n    };\n\n'
+    for field in sorted(fields, key=Field.size_rank):
+        members += '    %s m_%s;\n' % (field.type, field.name)
+    members += '    std::bitset<FieldBitCount> m_FieldsSet;\n\n'
+    match = MEMBERS.search(header)
+    header = header[:match.start()] + members + header[match.end():]
+    return header.replace('#include <boost/optional.hpp>\n', '#include <bitset>\n', 1)
+
+
+def _compact_constructor(source, model_name, fields):
+    match = re.search(r'^%s::%s\(\)\n\{\n(?P<body>(?:    .*\n)*)\}\n' % (model_name, model_name), source, re.M)
+    if match is None:
+        return source
+    body = match.group('body')
+    for field in fields:
+        name = re.escape(field.name)
+        # Presence lives in m_FieldsSet, which starts out clear, and strings and
+        # datetimes are already empty when default-constructed.
+        body = re.sub(r'^    m_%sIsSet = false;\n' % name, '', body, flags=re.M)
+        body = re.sub(r'^    m_%s = (?:utility::conversions::to_string_t\(""\)|utility::datetime\(\));\n' % name,
+                      '', body, flags=re.M)
+        if field.optional and field.type in SCALAR_DEFAULTS:
+            body += '    m_%s = %s;\n' % (field.name, SCALAR_DEFAULTS[field.type])
+    return source[:match.start('body')] + body + source[match.end('body'):]
+
+
+def _compact_accessors(source, fields):
+    for field in fields:
+        name, bit = re.escape(field.name), field.bit
+        if field.optional:
+            source = re.sub(r'^(    m_%s = value;\n)\}' % name, r'\1    m_FieldsSet.set(%s);\n}' % bit, source, flags=re.M)
+            source = re.sub(r'\bm_%s\.has_value\(\)' % name, 'm_FieldsSet.test(%s)' % bit, source)
+            source = re.sub(r'\bm_%s\.get\(\)' % name, 'm_%s' % field.name, source)
+            source = re.sub(r'\bm_%s\.reset\(\);' % name, 'm_FieldsSet.reset(%s);' % bit, source)
+        else:
+            source = re.sub(r'\bm_%sIsSet = true;' % name, 'm_FieldsSet.set(%s);' % bit, source)
+            source = re.sub(r'\bm_%sIsSet = false;' % name, 'm_FieldsSet.reset(%s);' % bit, source)
+            source = re.sub(r'\bm_%sIsSet\b' % name, 'm_FieldsSet.test(%s)' % bit, source)
+    return source
+
+
+def compact_layout(model):
+    """Replace the per-field `bool m_XIsSet` flags and boost::optional wrappers
+    with one presence bitset, order members by size and drop the default
+    construction of empty strings."""
+    fields = _generated_fields(model.header)
+    if not fields:
+        return
+    model.header = _compact_members(model.header, fields)
+    model.source = _compact_constructor(model.source, model.name, fields)
+    model.source = _compact_accessors(model.source, fields)
+
+
+TO_JSON = re.compile(
+    r'^web::json::value (?P<model>\w+)::toJson\(\) const\n'
+    r'\{\n'
+    r'    web::json::value val = web::json::value::object\(\);\n'
+    r'(?P<body>[\s\S]*?)'
+    r'    return val;\n'
+    r'\}\n',
+    re.M,
+)
+TO_JSON_MEMBER = re.compile(
+    r'^(?P<indent> +)val\[utility::conversions::to_string_t\(_XPLATSTR\("(?P<key>[^"]+)"\)\)\] = ModelBase::toJson\((?P<expr>.+)\);$',
+    re.M,
+)
+TO_JSON_ADDITIONAL = re.compile(r'^(?P<indent> +)val\[item\.first\] = item\.second;$', re.M)
+
+
+def _write_json_body(body):
+    body = TO_JSON_MEMBER.sub(
+        lambda m: '%(indent)swriter.key(_XPLATSTR("%(key)s"));\n%(indent)sModelBase::writeJson(writer, %(expr)s);' % m.groupdict(),
+        body)
+    body = TO_JSON_ADDITIONAL.sub(
+        lambda m: '%(indent)swriter.key(item.first);\n%(indent)swriter.value(item.second);' % m.groupdict(),
+        body)
+    if re.search(r'\bval\b', body):
+        return None
+    return body
+
+
+def direct_json_writer(model):
+    """Add a writeJson(JsonWriter&) that mirrors toJson() but streams each field
+    straight into the writer, so request bodies never build a json::value DOM."""
+    if '::writeJson(JsonWriter& writer) const' in model.source:
+        return
+    match = TO_JSON.search(model.source)
+    if match is None:
+        return
+    body = _write_json_body(match.group('body'))
+    if body is None:
+        return
+    writer = (
+        'void %s::writeJson(JsonWriter& writer) const\n'
+        '{\n'
+        '    writer.beginObject();\n'
+        '%s'
+        '    writer.endObject();\n'
+        '}\n' % (match.group('model'), body)
+    )
+    model.source = model.source[:match.end()] + '\n' + writer + model.source[match.end():]
+    model.header = model.header.replace(
+        '    web::json::value toJson() const override;\n',
+        '    web::json::value toJson() const override;\n'
+        '    void writeJson(JsonWriter& writer) const override;\n',
+        1)
+
+
+# One dispatch case of the single-pass fromJson() written by single_pass_from_json.
+FROM_JSON_CASE = re.compile(
+    r'^        case ModelBase::fieldHash\(_XPLATSTR\("(?P<key>[^"]+)"\)\):\n'
+    r'            if\(field\.first == _XPLATSTR\("(?P=key)"\)\)\n'
+    r'            \{\n'
+    r'                if\(!fieldValue\.is_null\(\)\)\n'
+    r'                \{\n'
+    r'(?P<body>(?:                    .*\n)*?)'
+    r'                \}\n'
+    r'                continue;\n'
+    r'            \}\n'
+    r'            break;\n',
+    re.M,
+)
+SINGLE_PASS_FROM_JSON = re.compile(
+    r'^bool (?P<model>\w+)::fromJson\(const web::json::value& val\)\n\{\n[\s\S]*?^\}\n', re.M)
+
+
+def _write_binary_body(body):
+    body = TO_JSON_MEMBER.sub(
+        lambda m: '%(indent)sModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("%(key)s")), %(expr)s);' % m.groupdict(),
+        body)
+    body = TO_JSON_ADDITIONAL.sub(
+        lambda m: ('%(indent)swriter.fieldHeader(ModelBase::fieldHash(item.first), BinaryWireType::Named);\n'
+                   '%(indent)swriter.writeString(item.first);\n'
+                   '%(indent)swriter.writeString(item.second.serialize());') % m.groupdict(),
+        body)
+    if re.search(r'\bval\b', body):
+        return None
+    return body
+
+
+READ_JSON_VALUE = re.compile(r'^(?P<indent> +)ok &= ModelBase::fromJson\(fieldValue, (?P<ref>\w+)\);$', re.M)
+
+
+def _read_binary_case(match):
+    body = ''.join(line[4:] + '\n' for line in match.group('body').splitlines())
+    body = READ_JSON_VALUE.sub(
+        lambda m: ('%(indent)sif(!ModelBase::readBinary(reader, field, %(ref)s))\n'
+                   '%(indent)s{\n'
+                   '%(indent)s    ok = false;\n'
+                   '%(indent)s    continue;\n'
+                   '%(indent)s}') % m.groupdict(),
+        body)
+    out = '        case ModelBase::fieldHash(_XPLATSTR("%s")):\n' % match.group('key')
+    out += '            {\n'
+    out += body
+    out += '            }\n'
+    out += '            continue;\n'
+    return out
+
+
+def binary_codec(model):
+    """Add writeBinary()/readBinary(), the tagged binary encoding used by
+    ModelBase::toBinary()/fromBinary(). Field tags are the fieldHash of the JSON
+    key, so the encoding evolves the same way the JSON does."""
+    if '::writeBinary(BinaryWriter& writer) const' in model.source:
+        return
+    to_json = TO_JSON.search(model.source)
+    from_json = SINGLE_PASS_FROM_JSON.search(model.source)
+    if to_json is None or from_json is None or 'switch(ModelBase::fieldHash(field.first))' not in from_json.group(0):
+        return
+    write_body = _write_binary_body(to_json.group('body'))
+    if write_body is None:
+        return
+    cases = ''.join(_read_binary_case(m) for m in FROM_JSON_CASE.finditer(from_json.group(0)))
+    if 'fieldValue' in cases:
+        return
+    name = model.name
+    writer = (
+        'void %s::writeBinary(BinaryWriter& writer) const\n'
+        '{\n'
+        '%s'
+        '}\n' % (name, write_body.rstrip('\n') + '\n')
+    )
+    reader = (
+        'bool %s::readBinary(BinaryReader& reader)\n'
+        '{\n'
+        '    bool ok = true;\n'
+        '    BinaryField field;\n'
+        '    while(reader.nextField(field))\n'
+        '    {\n'
+        '        switch(field.tag)\n'
+        '        {\n'
+        '%s'
+        '        default:\n'
+        '            break;\n'
+        '        }\n' % (name, cases)
+    )
+    if 'm_AdditionalProperties[field.first] = fieldValue;' in from_json.group(0):
+        reader += (
+            '        if(field.wireType == BinaryWireType::Named)\n'
+            '        {\n'
+            '            utility::string_t key;\n'
+            '            utility::string_t text;\n'
+            '            if(reader.readString(key) && reader.readString(text))\n'
+            '            {\n'
+            '                try\n'
+            '                {\n'
+            '                    m_AdditionalProperties[key] = web::json::value::parse(text);\n'
+            '                }\n'
+            '                catch(const web::json::json_exception&)\n'
+            '                {\n'
+            '                    return false;\n'
+            '                }\n'
+            '                m_FieldsSet.set(FieldBit_AdditionalProperties);\n'
+            '            }\n'
+            '            continue;\n'
+            '        }\n'
+        )
+    reader += (
+        '        reader.skip(field);\n'
+        '    }\n'
+        '    return ok && reader.ok();\n'
+        '}\n'
+    )
+    end = from_json.end()
+    model.source = model.source[:end] + '\n' + writer + '\n' + reader + model.source[end:]
+    model.header = model.header.replace(
+        '    bool fromJson(const web::json::value& json) override;\n',
+        '    bool fromJson(const web::json::value& json) override;\n'
+        '    void writeBinary(BinaryWriter& writer) const override;\n'
+        '    bool readBinary(BinaryReader& reader) override;\n',
+        1)
+
+
+# Fields whose values repeat on every comment of a thread (one tenant, one page),
+# per model carrying them. Their decoders intern instead of copying.
+INTERNED_FIELDS = ('TenantId', 'UrlId', 'Url', 'UrlIdRaw', 'PageTitle', 'AvatarSrc', 'CommenterName')
+INTERNED_MODELS = (
+    'APIComment', 'APICommentBase', 'FComment', 'ModerationAPIComment',
+    'PubSubComment', 'PubSubCommentBase', 'PublicComment', 'PublicCommentBase',
+)
+
+
+def intern_strings(model):
+    """Hold the repeated string fields of comment models as InternedString and
+    decode them (JSON and binary) straight into the member through
+    StringInternTable::current()."""
+    if model.name not in INTERNED_MODELS:
+        return
+    for name in INTERNED_FIELDS:
+        model.header = model.header.replace(
+            '    utility::string_t m_%s;\n' % name, '    InternedString m_%s;\n' % name, 1)
+        if '    InternedString m_%s;\n' % name not in model.header:
+            continue
+        model.source = re.sub(
+            r'^(?P<indent> +)utility::string_t refVal_set%(name)s;\n'
+            r'(?P=indent)ok &= ModelBase::fromJson\(fieldValue, refVal_set%(name)s\);\n'
+            r'(?P=indent)set%(name)s\(refVal_set%(name)s\);\n' % {'name': name},
+            lambda m: ('%(indent)sok &= ModelBase::fromJson(fieldValue, m_%(name)s);\n'
+                       '%(indent)sm_FieldsSet.set(FieldBit_%(name)s);\n') % dict(indent=m.group('indent'), name=name),
+            model.source, flags=re.M)
+        model.source = re.sub(
+            r'^(?P<indent> +)utility::string_t refVal_set%(name)s;\n'
+            r'(?P=indent)if\(!ModelBase::readBinary\(reader, field, refVal_set%(name)s\)\)\n'
+            r'(?P<fail>(?P=indent)\{\n(?:(?P=indent)    .*\n)*?(?P=indent)\}\n)'
+            r'(?P=indent)set%(name)s\(refVal_set%(name)s\);\n' % {'name': name},
+            lambda m: ('%(indent)sif(!ModelBase::readBinary(reader, field, m_%(name)s))\n'
+                       '%(fail)s'
+                       '%(indent)sm_FieldsSet.set(FieldBit_%(name)s);\n') % dict(indent=m.group('indent'), name=name,
+                                                                          fail=m.group('fail')),
+            model.source, flags=re.M)
+
+
+PASSES = [
+    single_pass_from_json,
+    compact_layout,
+    direct_json_writer,
+    binary_codec,
+    intern_strings,
+]
+
+
+# JSON request body of a generated API operation: the parameter is converted to a
+# json::value (element by element for array bodies) and wrapped in a JsonBody.
+REQUEST_BODY = re.compile(
+    r'^        web::json::value localVarJson;\n'
+    r'\n'
+    r'(?:'
+    r'        localVarJson = ModelBase::toJson\((?P<param>\w+)\);\n'
+    r'|'
+    r'        \{\n'
+    r'            std::vector<web::json::value> localVarJsonArray;\n'
+    r'            for\( auto& localVarItem : (?P<array>\w+) \)\n'
+    r'            \{\n'
+    r'                localVarJsonArray\.push_back\( localVarItem\.get\(\) \? localVarItem->toJson\(\) : web::json::value::null\(\) \);\n'
+    r'[ \t]*\n'
+    r'            \}\n'
+    r'            localVarJson = web::json::value::array\(localVarJsonArray\);\n'
+    r'        \}\n'
+    r')'
+    r'[ \t]*\n'
+    r'        localVarHttpBody = std::shared_ptr<IHttpBody>\( new JsonBody\( localVarJson \) \);\n',
+    re.M,
+)
+
+
+def _stream_request_body(match):
+    param = match.group('param') or match.group('array')
+    return '        localVarHttpBody = std::shared_ptr<IHttpBody>( new JsonBody( %s ) );\n' % param
+
+
+def stream_request_bodies(api):
+    """Hand the body parameter itself to JsonBody, which streams it through
+    writeJson() when the request is sent."""
+    api.source = REQUEST_BODY.sub(_stream_request_body, api.source)
+
+
+API_PASSES = [
+    stream_request_bodies,
+]
+
+
+class Model(object):
+    """Header and source text of one generated model."""
+
+    def __init__(self, client_dir, source_path):
+        self.name = source_path.stem
+        self.source_path = source_path
+        self.header_path = client_dir / 'include' / 'FastCommentsClient' / 'model' / (self.name + '.h')
+        self.source = source_path.read_text()
+        self.header = self.header_path.read_text()
+
+    def save(self):
+        changed = False
+        for path, text in ((self.source_path, self.source), (self.header_path, self.header)):
+            if path.read_text() != text:
+                path.write_text(text)
+                changed = True
+        return changed
+
+
+class Api(object):
+    """Source text of one generated API class."""
+
+    def __init__(self, source_path):
+        self.name = source_path.stem
+        self.source_path = source_path
+        self.source = source_path.read_text()
+
+    def save(self):
+        if self.source_path.read_text() == self.source:
+            return False
+        self.source_path.write_text(self.source)
+        return True
+
+
+def main(argv):
+    client_dir = pathlib.Path(argv[1] if len(argv) > 1 else 'client')
+    model_sources = sorted((client_dir / 'src' / 'model').glob('*.cpp'))
+    if not model_sources:
+        sys.exit('no generated models under %s' % client_dir)
+    changed = 0
+    for path in model_sources:
+        model = Model(client_dir, path)
+        for rewrite in PASSES:
+            rewrite(model)
+        if model.save():
+            changed += 1
+    print('post-processed %d of %d models' % (changed, len(model_sources)))
+
+    api_sources = sorted((client_dir / 'src' / 'api').glob('*.cpp'))
+    changed = 0
+    for path in api_sources:
+        api = Api(path)
+        for rewrite in API_PASSES:
+            rewrite(api)
+        if api.save():
+            changed += 1
+    print('post-processed %d of %d apis' % (changed, len(api_sources)))
+
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -0,0 +1,569 @@
+#include "fastcomments/analytics/aggregation_query.hpp"
+
+#include "FastCommentsClient/ApiConfiguration.h"
+#include "FastCommentsClient/ApiException.h"
+#include "FastCommentsClient/JsonBody.h"
+#include "FastCommentsClient/JsonWriter.h"
+#include "internal/util.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace fastcomments {
+namespace analytics {
+
+using org::openapitools::client::api::ApiException;
+using org::openapitools::client::api::JsonBody;
+using org::openapitools::client::model::JsonWriter;
+
+namespace {
+
+using detail::fnv1a;
+
+constexpr int64_t kDayMs = 86400000;
+
+int64_t floorDiv(int64_t a, int64_t b) {
+    return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+}
+
+// Days since 1970-01-01 for a proleptic Gregorian date, and back.
+int64_t daysFromCivil(int64_t y, int64_t m, int64_t d) {
+    y -= m <= 2;
+    const int64_t era = floorDiv(y, 400);
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+void civilFromDays(int64_t z, int64_t& y, int64_t& m) {
+    z += 719468;
+    const int64_t era = floorDiv(z, 146097);
+    const int64_t doe = z - era * 146097;
+    const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int64_t mp = (5 * doy + 2) / 153;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = yoe + era * 400 + (m <= 2);
+}
+
+int64_t monthStartMs(int64_t monthIndex) {
+    return daysFromCivil(floorDiv(monthIndex, 12), monthIndex - floorDiv(monthIndex, 12) * 12 + 1, 1) * kDayMs;
+}
+
+const utility::char_t* opName(AggregateOp op) {
+    switch (op) {
+    case AggregateOp::Sum: return _XPLATSTR("SUM");
+    case AggregateOp::CountDistinct: return _XPLATSTR("COUNTDISTINCT");
+    case AggregateOp::Distinct: return _XPLATSTR("DISTINCT");
+    case AggregateOp::Avg: return _XPLATSTR("AVG");
+    case AggregateOp::Min: return _XPLATSTR("MIN");
+    case AggregateOp::Max: return _XPLATSTR("MAX");
+    case AggregateOp::Count: return _XPLATSTR("COUNT");
+    }
+    return _XPLATSTR("COUNT");
+}
+
+const utility::char_t* predicateName(PredicateOp op) {
+    switch (op) {
+    case PredicateOp::Eq: return _XPLATSTR("eq");
+    case PredicateOp::NotEq: return _XPLATSTR("not_eq");
+    case PredicateOp::GreaterThan: return _XPLATSTR("greater_than");
+    case PredicateOp::LessThan: return _XPLATSTR("less_than");
+    case PredicateOp::Contains: return _XPLATSTR("contains");
+    }
+    return _XPLATSTR("eq");
+}
+
+const utility::char_t* bucketName(TimeBucket bucket) {
+    switch (bucket) {
+    case TimeBucket::Day: return _XPLATSTR("DAY");
+    case TimeBucket::Month: return _XPLATSTR("MONTH");
+    case TimeBucket::Year: return _XPLATSTR("YEAR");
+    }
+    return _XPLATSTR("DAY");
+}
+
+std::string serialize(const web::json::value& value) {
+    JsonWriter writer;
+    writer.value(value);
+    return writer.str();
+}
+
+web::json::value predicateJson(const utility::string_t& key, PredicateOp op, web::json::value value) {
+    web::json::value predicate = web::json::value::object();
+    predicate[_XPLATSTR("key")] = web::json::value::string(key);
+    predicate[_XPLATSTR("value")] = std::move(value);
+    predicate[_XPLATSTR("operator")] = web::json::value::string(predicateName(op));
+    return predicate;
+}
+
+std::vector<AggregationRow> parseRows(const web::json::value& data, int64_t bucketStartMs) {
+    std::vector<AggregationRow> rows;
+    if (!data.is_array()) return rows;
+    const auto& items = data.as_array();
+    rows.reserve(items.size());
+    for (const auto& item : items) {
+        if (!item.is_object()) continue;
+        AggregationRow row;
+        row.bucketStartMs = bucketStartMs;
+        for (const auto& field : item.as_object()) {
+            if (field.first == _XPLATSTR("groups")) {
+                if (!field.second.is_object()) continue;
+                for (const auto& group : field.second.as_object()) {
+                    row.groups[group.first] = group.second.is_string() ? group.second.as_string()
+                                                                       : group.second.serialize();
+                }
+            } else {
+                row.values[field.first] = field.second;
+            }
+        }
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+
+int64_t systemNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+BucketRange bucketAt(TimeBucket bucket, int64_t timeMs, int64_t offset) {
+    BucketRange range;
+    const int64_t day = floorDiv(timeMs, kDayMs);
+    switch (bucket) {
+    case TimeBucket::Day:
+        range.startMs = (day + offset) * kDayMs;
+        range.endMs = range.startMs + kDayMs;
+        break;
+    case TimeBucket::Month:
+    case TimeBucket::Year: {
+        int64_t y, m;
+        civilFromDays(day, y, m);
+        const int64_t step = bucket == TimeBucket::Month ? 1 : 12;
+        const int64_t first = bucket == TimeBucket::Month ? y * 12 + (m - 1) + offset : (y + offset) * 12;
+        range.startMs = monthStartMs(first);
+        range.endMs = monthStartMs(first + step);
+        break;
+    }
+    }
+    return range;
+}
+
+AggregationQuery::AggregationQuery(utility::string_t resourceName) : resourceName_(std::move(resourceName)) {}
+
+AggregationQuery& AggregationQuery::where(const utility::string_t& key, PredicateOp op, const utility::string_t& value) {
+    predicates_.push_back({key, op, web::json::value::string(value)});
+    return *this;
+}
+
+AggregationQuery& AggregationQuery::where(const utility::string_t& key, PredicateOp op, const utility::char_t* value) {
+    return where(key, op, utility::string_t(value));
+}
+
+AggregationQuery& AggregationQuery::where(const utility::string_t& key, PredicateOp op, double value) {
+    predicates_.push_back({key, op, web::json::value::number(value)});
+    return *this;
+}
+
+AggregationQuery& AggregationQuery::where(const utility::string_t& key, PredicateOp op, bool value) {
+    predicates_.push_back({key, op, web::json::value::boolean(value)});
+    return *this;
+}
+
+AggregationQuery& AggregationQuery::groupBy(const utility::string_t& field) {
+    groupBy_.push_back(field);
+    return *this;
+}
+
+AggregationQuery& AggregationQuery::aggregate(AggregateOp op, const utility::string_t& field,
+                                              const utility::string_t& alias, bool expandArray) {
+    operations_.push_back({op, field, alias, expandArray});
+    return *this;
+}
+
+AggregationQuery& AggregationQuery::count(const utility::string_t& field, const utility::string_t& alias) {
+    return aggregate(AggregateOp::Count, field, alias);
+}
+
+AggregationQuery& AggregationQuery::sum(const utility::string_t& field, const utility::string_t& alias) {
+    return aggregate(AggregateOp::Sum, field, alias);
+}
+
+AggregationQuery& AggregationQuery::sortBy(const utility::string_t& field, bool ascending) {
+    sortField_ = field;
+    sortAscending_ = ascending;
+    return *this;
+}
+
+AggregationQuery& AggregationQuery::bucketBy(const utility::string_t& timeField, TimeBucket bucket, size_t count) {
+    if (timeField.empty()) throw std::invalid_argument("AggregationQuery::bucketBy: timeField is empty");
+    timeField_ = timeField;
+    bucket_ = bucket;
+    bucketCount_ = count;
+    return *this;
+}
+
+std::vector<BucketRange> AggregationQuery::buckets(int64_t nowMs) const {
+    std::vector<BucketRange> ranges;
+    ranges.reserve(bucketCount_);
+    for (size_t i = bucketCount_; i-- > 0;) {
+        ranges.push_back(bucketAt(bucket_, nowMs, -static_cast<int64_t>(i)));
+    }
+    return ranges;
+}
+
+web::json::value AggregationQuery::toJson() const {
+    return toJson(nullptr);
+}
+
+web::json::value AggregationQuery::toJson(const BucketRange& bucket) const {
+    return toJson(&bucket);
+}
+
+web::json::value AggregationQuery::toJson(const BucketRange* bucket) const {
+    web::json::value request = web::json::value::object();
+    request[_XPLATSTR("resourceName")] = web::json::value::string(resourceName_);
+
+    std::vector<web::json::value> query;
+    query.reserve(predicates_.size() + 2);
+    for (const auto& predicate : predicates_) query.push_back(predicateJson(predicate.key, predicate.op, predicate.value));
+    if (bucket != nullptr && bucketed()) {
+        // greater_than is exclusive; the bucket starts at startMs inclusive.
+        query.push_back(predicateJson(timeField_, PredicateOp::GreaterThan,
+                                      web::json::value::number(static_cast<double>(bucket->startMs - 1))));
+        query.push_back(predicateJson(timeField_, PredicateOp::LessThan,
+                                      web::json::value::number(static_cast<double>(bucket->endMs))));
+    }
+    if (!query.empty()) request[_XPLATSTR("query")] = web::json::value::array(std::move(query));
+
+    if (!groupBy_.empty()) {
+        std::vector<web::json::value> fields;
+        fields.reserve(groupBy_.size());
+        for (const auto& field : groupBy_) fields.push_back(web::json::value::string(field));
+        request[_XPLATSTR("groupBy")] = web::json::value::array(std::move(fields));
+    }
+
+    std::vector<web::json::value> operations;
+    operations.reserve(operations_.size());
+    for (const auto& op : operations_) {
+        web::json::value operation = web::json::value::object();
+        operation[_XPLATSTR("field")] = web::json::value::string(op.field);
+        operation[_XPLATSTR("op")] = web::json::value::string(opName(op.op));
+        if (!op.alias.empty()) operation[_XPLATSTR("alias")] = web::json::value::string(op.alias);
+        if (op.expandArray) operation[_XPLATSTR("expandArray")] = web::json::value::boolean(true);
+        operations.push_back(std::move(operation));
+    }
+    request[_XPLATSTR("operations")] = web::json::value::array(std::move(operations));
+
+    if (!sortField_.empty()) {
+        web::json::value sort = web::json::value::object();
+        sort[_XPLATSTR("dir")] = web::json::value::string(sortAscending_ ? _XPLATSTR("asc") : _XPLATSTR("desc"));
+        sort[_XPLATSTR("field")] = web::json::value::string(sortField_);
+        request[_XPLATSTR("sort")] = sort;
+    }
+    return request;
+}
+
+std::string AggregationQuery::canonicalKey() const {
+    // Predicates are ANDed, groups and results are keyed by name: none of
+    // their orders change the answer, so all three are sorted.
+    using PredicateKey = std::tuple<utility::string_t, int, std::string>;
+    std::vector<PredicateKey> predicates;
+    predicates.reserve(predicates_.size());
+    for (const auto& p : predicates_) predicates.emplace_back(p.key, static_cast<int>(p.op), serialize(p.value));
+    std::sort(predicates.begin(), predicates.end());
+    predicates.erase(std::unique(predicates.begin(), predicates.end()), predicates.end());
+
+    std::vector<utility::string_t> groupBy = groupBy_;
+    std::sort(groupBy.begin(), groupBy.end());
+    groupBy.erase(std::unique(groupBy.begin(), groupBy.end()), groupBy.end());
+
+    using OperationKey = std::tuple<utility::string_t, int, utility::string_t, bool>;
+    std::vector<OperationKey> operations;
+    operations.reserve(operations_.size());
+    for (const auto& op : operations_) {
+        operations.emplace_back(op.alias.empty() ? op.field : op.alias, static_cast<int>(op.op), op.field, op.expandArray);
+    }
+    std::sort(operations.begin(), operations.end());
+
+    JsonWriter writer;
+    writer.beginArray();
+    writer.value(resourceName_);
+    writer.beginArray();
+    for (const auto& p : predicates) {
+        writer.value(std::get<0>(p));
+        writer.value(predicateName(static_cast<PredicateOp>(std::get<1>(p))));
+        writer.value(utility::conversions::to_string_t(std::get<2>(p)));
+    }
+    writer.endArray();
+    writer.beginArray();
+    for (const auto& field : groupBy) writer.value(field);
+    writer.endArray();
+    writer.beginArray();
+    for (const auto& op : operations) {
+        writer.value(std::get<0>(op));
+        writer.value(opName(static_cast<AggregateOp>(std::get<1>(op))));
+        writer.value(std::get<2>(op));
+        writer.value(std::get<3>(op));
+    }
+    writer.endArray();
+    writer.value(sortField_);
+    writer.value(sortAscending_);
+    writer.value(timeField_);
+    writer.value(bucketName(bucket_));
+    writer.value(static_cast<int64_t>(bucketCount_));
+    writer.endArray();
+    return writer.str();
+}
+
+uint64_t AggregationQuery::hash() const {
+    return fnv1a(canonicalKey());
+}
+
+double AggregationRow::number(const utility::string_t& key) const {
+    auto it = values.find(key);
+    if (it == values.end()) return 0;
+    const web::json::value& value = it->second;
+    if (value.is_number()) return value.as_double();
+    if (value.is_object() && value.has_field(_XPLATSTR("numericValue"))) {
+        const web::json::value& number = value.at(_XPLATSTR("numericValue"));
+        if (number.is_number()) return number.as_double();
+    }
+    return 0;
+}
+
+AggregateFetch aggregateFetch(std::shared_ptr<const ApiClient> apiClient, utility::string_t tenantId,
+                              AggregateOptions options) {
+    return [apiClient, tenantId, options](const web::json::value& request) {
+        std::shared_ptr<const org::openapitools::client::api::ApiConfiguration> configuration = apiClient->getConfiguration();
+        std::map<utility::string_t, utility::string_t> queryParams;
+        std::map<utility::string_t, utility::string_t> headerParams(configuration->getDefaultHeaders());
+        std::map<utility::string_t, utility::string_t> formParams;
+        std::map<utility::string_t, std::shared_ptr<org::openapitools::client::model::HttpContent>> fileParams;
+
+        queryParams[_XPLATSTR("tenantId")] = ApiClient::parameterToString(tenantId);
+        if (options.parentTenantId) queryParams[_XPLATSTR("parentTenantId")] = ApiClient::parameterToString(*options.parentTenantId);
+        if (options.includeStats) queryParams[_XPLATSTR("includeStats")] = ApiClient::parameterToString(*options.includeStats);
+        headerParams[_XPLATSTR("Accept")] = _XPLATSTR("application/json");
+        const utility::string_t apiKey = configuration->getApiKey(_XPLATSTR("api_key"));
+        if (!apiKey.empty()) headerParams[_XPLATSTR("x-api-key")] = apiKey;
+
+        return apiClient
+            ->callApi(_XPLATSTR("/api/v1/aggregate"), _XPLATSTR("POST"), queryParams, std::make_shared<JsonBody>(request),
+                      headerParams, formParams, fileParams, _XPLATSTR("application/json"))
+            .then([apiClient](web::http::http_response response) {
+                if (apiClient->getResponseHandler()) apiClient->getResponseHandler()(response.status_code(), response.headers());
+                if (response.status_code() >= 400) {
+                    throw ApiException(response.status_code(),
+                                       utility::conversions::to_string_t("error calling aggregate: ") + response.reason_phrase(),
+                                       std::make_shared<std::stringstream>(response.extract_utf8string(true).get()));
+                }
+                return response.extract_json(true);
+            })
+            .then([](web::json::value body) {
+                if (body.has_field(_XPLATSTR("status")) && body.at(_XPLATSTR("status")).is_string() &&
+                    body.at(_XPLATSTR("status")).as_string() == _XPLATSTR("failed")) {
+                    utility::string_t message = _XPLATSTR("aggregate failed");
+                    if (body.has_field(_XPLATSTR("reason")) && body.at(_XPLATSTR("reason")).is_string()) {
+                        message += _XPLATSTR(": ") + body.at(_XPLATSTR("reason")).as_string();
+                    }
+                    throw ApiException(400, message);
+                }
+                return body.has_field(_XPLATSTR("data")) ? body.at(_XPLATSTR("data")) : web::json::value::array();
+            });
+    };
+}
+
+struct AggregationCache::State : std::enable_shared_from_this<State> {
+    struct Bucket {
+        std::vector<AggregationRow> rows;
+        int64_t fetchedAt = -1;
+        bool final = false;
+        bool loading = false;
+        pplx::task<void> pending;
+    };
+
+    struct Entry {
+        std::string key;
+        std::map<int64_t, Bucket> buckets;
+        std::list<uint64_t>::iterator lru;
+    };
+
+    struct Load {
+        std::shared_ptr<Entry> entry;
+        BucketRange range;
+        web::json::value request;
+        pplx::task_completion_event<void> done;
+    };
+
+    AggregateFetch fetch;
+    AggregationCacheOptions options;
+
+    mutable std::mutex mu;
+    std::unordered_map<uint64_t, std::shared_ptr<Entry>> entries;
+    std::list<uint64_t> lru;   // most recently used first
+    AggregationCacheStats stats;
+
+    // Caller holds mu.
+    std::shared_ptr<Entry> touch(uint64_t hash, const std::string& key) {
+        auto it = entries.find(hash);
+        if (it != entries.end() && it->second->key == key) {
+            lru.splice(lru.begin(), lru, it->second->lru);
+            return it->second;
+        }
+        if (it != entries.end()) {
+            // A hash collision: the newer query takes the slot.
+            lru.erase(it->second->lru);
+            entries.erase(it);
+        }
+        auto entry = std::make_shared<Entry>();
+        entry->key = key;
+        lru.push_front(hash);
+        entry->lru = lru.begin();
+        entries.emplace(hash, entry);
+        while (entries.size() > options.maxEntries) {
+            entries.erase(lru.back());
+            lru.pop_back();
+        }
+        return entry;
+    }
+
+    bool stale(const Bucket& bucket, const BucketRange& range, int64_t now) const {
+        if (bucket.fetchedAt < 0) return true;
+        if (bucket.final) return false;
+        return now >= range.endMs || now - bucket.fetchedAt >= options.maxAge.count();
+    }
+
+    void start(Load load, int64_t issuedAt, bool bucketed) {
+        pplx::task<web::json::value> call;
+        try {
+            call = fetch(load.request);
+        } catch (...) {
+            call = pplx::task_from_exception<web::json::value>(std::current_exception());
+        }
+        auto self = shared_from_this();
+        call.then([self, load, issuedAt, bucketed](pplx::task<web::json::value> t) {
+            std::exception_ptr error;
+            std::vector<AggregationRow> rows;
+            try {
+                rows = parseRows(t.get(), bucketed ? load.range.startMs : 0);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                auto it = load.entry->buckets.find(load.range.startMs);
+                if (it != load.entry->buckets.end()) {
+                    it->second.loading = false;
+                    if (!error) {
+                        it->second.rows = std::move(rows);
+                        it->second.fetchedAt = issuedAt;
+                        it->second.final = issuedAt >= load.range.endMs;
+                    }
+                }
+            }
+            if (error) {
+                load.done.set_exception(error);
+            } else {
+                load.done.set();
+            }
+        });
+    }
+};
+
+AggregationCache::AggregationCache(AggregateFetch fetch, AggregationCacheOptions options)
+    : state_(std::make_shared<State>()) {
+    if (options.maxEntries == 0) options.maxEntries = 1;
+    if (!options.now) options.now = systemNowMs;
+    state_->fetch = std::move(fetch);
+    state_->options = std::move(options);
+}
+
+pplx::task<AggregationResult> AggregationCache::get(const AggregationQuery& query) {
+    auto state = state_;
+    const int64_t now = state->options.now();
+    const bool bucketed = query.bucketed();
+    std::vector<BucketRange> ranges =
+        bucketed ? query.buckets(now) : std::vector<BucketRange>{{0, std::numeric_limits<int64_t>::max()}};
+    const std::string key = query.canonicalKey();
+
+    auto result = std::make_shared<AggregationResult>();
+    std::shared_ptr<State::Entry> entry;
+    std::vector<State::Load> loads;
+    std::vector<pplx::task<void>> waits;
+    {
+        std::lock_guard<std::mutex> lock(state->mu);
+        entry = state->touch(fnv1a(key), key);
+        if (bucketed && !ranges.empty()) {
+            // Buckets that have scrolled out of the window.
+            entry->buckets.erase(entry->buckets.begin(), entry->buckets.lower_bound(ranges.front().startMs));
+        }
+        for (const auto& range : ranges) {
+            State::Bucket& bucket = entry->buckets[range.startMs];
+            if (bucket.loading) {
+                waits.push_back(bucket.pending);
+            } else if (state->stale(bucket, range, now)) {
+                State::Load load;
+                load.entry = entry;
+                load.range = range;
+                load.request = bucketed ? query.toJson(range) : query.toJson();
+                bucket.loading = true;
+                bucket.pending = pplx::create_task(load.done);
+                waits.push_back(bucket.pending);
+                loads.push_back(std::move(load));
+            } else {
+                ++result->cachedBuckets;
+            }
+        }
+        result->requests = loads.size();
+        state->stats.requests += loads.size();
+        state->stats.cachedBuckets += result->cachedBuckets;
+    }
+    for (auto& load : loads) state->start(std::move(load), now, bucketed);
+
+    auto assemble = [state, entry, ranges, result]() {
+        std::lock_guard<std::mutex> lock(state->mu);
+        for (const auto& range : ranges) {
+            auto it = entry->buckets.find(range.startMs);
+            if (it == entry->buckets.end()) continue;
+            result->rows.insert(result->rows.end(), it->second.rows.begin(), it->second.rows.end());
+        }
+        return std::move(*result);
+    };
+    if (waits.empty()) return pplx::task_from_result(assemble());
+    return pplx::when_all(waits.begin(), waits.end()).then(assemble);
+}
+
+void AggregationCache::invalidate(const AggregationQuery& query) {
+    const std::string key = query.canonicalKey();
+    std::lock_guard<std::mutex> lock(state_->mu);
+    auto it = state_->entries.find(fnv1a(key));
+    if (it == state_->entries.end() || it->second->key != key) return;
+    state_->lru.erase(it->second->lru);
+    state_->entries.erase(it);
+}
+
+void AggregationCache::clear() {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    state_->entries.clear();
+    state_->lru.clear();
+}
+
+AggregationCacheStats AggregationCache::stats() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    AggregationCacheStats stats = state_->stats;
+    stats.entries = state_->entries.size();
+    return stats;
+}
+
+} // namespace analytics
+} // namespace fastcomments
@@ -0,0 +1,419 @@
+#include "fastcomments/analytics/comment_batch.hpp"
+
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/APIGetCommentsResponse.h"
+#include "FastCommentsClient/model/ModerationAPIComment.h"
+#include "FastCommentsClient/model/ModerationAPIGetCommentsResponse.h"
+#include "internal/util.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+namespace fastcomments {
+namespace analytics {
+
+namespace {
+
+using detail::toEpochMs;
+using detail::toUtf8;
+
+int64_t jsonDate(const web::json::value& v) {
+    if (v.is_number()) return static_cast<int64_t>(v.as_double());
+    if (v.is_string()) {
+        return toEpochMs(utility::datetime::from_string(v.as_string(), utility::datetime::ISO_8601));
+    }
+    return 0;
+}
+
+int32_t jsonInt(const web::json::value& v) {
+    return v.is_number() ? static_cast<int32_t>(v.as_double()) : 0;
+}
+
+bool jsonBool(const web::json::value& v) {
+    return v.is_boolean() && v.as_bool();
+}
+
+std::string jsonString(const web::json::value& v) {
+    return v.is_string() ? toUtf8(v.as_string()) : std::string();
+}
+
+// Builds a bitmap 64 rows at a time from a per-row predicate. The inner loop has a
+// fixed trip count and no branches, so it vectorizes for simple column compares.
+template <typename Pred>
+Bitmap buildBitmap(size_t size, Pred pred) {
+    Bitmap out(size);
+    std::vector<uint64_t>& words = out.words();
+    const size_t full = size / 64;
+    for (size_t w = 0; w < full; ++w) {
+        uint64_t word = 0;
+        const size_t base = w * 64;
+        for (size_t j = 0; j < 64; ++j) {
+            word |= static_cast<uint64_t>(pred(base + j)) << j;
+        }
+        words[w] = word;
+    }
+    uint64_t tail = 0;
+    for (size_t i = full * 64; i < size; ++i) {
+        tail |= static_cast<uint64_t>(pred(i)) << (i & 63);
+    }
+    if (size & 63) words[full] = tail;
+    return out;
+}
+
+// Stable LSD radix sort of row indices by 64-bit unsigned key, 8 bits per pass.
+// Passes where every key has the same digit are skipped, so small-range columns
+// (votes, dates within a few days) only pay for the bytes that actually vary.
+std::vector<uint32_t> radixOrder(std::vector<uint64_t> keys) {
+    const size_t n = keys.size();
+    std::vector<uint32_t> order(n);
+    for (size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+    std::vector<uint64_t> keysTmp(n);
+    std::vector<uint32_t> orderTmp(n);
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {};
+        for (size_t i = 0; i < n; ++i) ++counts[(keys[i] >> shift) & 0xff];
+        if (n == 0 || counts[(keys[0] >> shift) & 0xff] == n) continue;
+
+        size_t offset = 0;
+        for (size_t& c : counts) {
+            size_t next = offset + c;
+            c = offset;
+            offset = next;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            size_t dst = counts[(keys[i] >> shift) & 0xff]++;
+            keysTmp[dst] = keys[i];
+            orderTmp[dst] = order[i];
+        }
+        keys.swap(keysTmp);
+        order.swap(orderTmp);
+    }
+    return order;
+}
+
+// Maps a signed key to an unsigned one with the same ordering, reversed when
+// descending so that the single ascending radix sort serves both directions.
+uint64_t sortKey(int64_t v, bool descending) {
+    uint64_t k = static_cast<uint64_t>(v) ^ (uint64_t(1) << 63);
+    return descending ? ~k : k;
+}
+
+} // anonymous namespace
+
+// ---- Bitmap ----
+
+Bitmap::Bitmap(size_t size, bool value)
+    : size_(size), words_((size + 63) / 64, value ? ~uint64_t(0) : 0) {
+    clearTail();
+}
+
+void Bitmap::set(size_t row, bool value) {
+    uint64_t bit = uint64_t(1) << (row & 63);
+    if (value) {
+        words_[row >> 6] |= bit;
+    } else {
+        words_[row >> 6] &= ~bit;
+    }
+}
+
+void Bitmap::resize(size_t size) {
+    size_ = size;
+    words_.resize((size + 63) / 64, 0);
+    clearTail();
+}
+
+size_t Bitmap::count() const {
+    size_t total = 0;
+    for (uint64_t w : words_) total += static_cast<size_t>(__builtin_popcountll(w));
+    return total;
+}
+
+std::vector<uint32_t> Bitmap::rows() const {
+    std::vector<uint32_t> out;
+    out.reserve(count());
+    for (size_t w = 0; w < words_.size(); ++w) {
+        uint64_t word = words_[w];
+        while (word) {
+            out.push_back(static_cast<uint32_t>(w * 64 + __builtin_ctzll(word)));
+            word &= word - 1;
+        }
+    }
+    return out;
+}
+
+Bitmap& Bitmap::operator&=(const Bitmap& other) {
+    const size_t n = std::min(words_.size(), other.words_.size());
+    for (size_t i = 0; i < n; ++i) words_[i] &= other.words_[i];
+    for (size_t i = n; i < words_.size(); ++i) words_[i] = 0;
+    return *this;
+}
+
+Bitmap& Bitmap::operator|=(const Bitmap& other) {
+    const size_t n = std::min(words_.size(), other.words_.size());
+    for (size_t i = 0; i < n; ++i) words_[i] |= other.words_[i];
+    clearTail();
+    return *this;
+}
+
+Bitmap Bitmap::operator~() const {
+    Bitmap out(*this);
+    for (uint64_t& w : out.words_) w = ~w;
+    out.clearTail();
+    return out;
+}
+
+void Bitmap::clearTail() {
+    if (size_ & 63) words_.back() &= (uint64_t(1) << (size_ & 63)) - 1;
+}
+
+Bitmap operator&(Bitmap a, const Bitmap& b) {
+    a &= b;
+    return a;
+}
+
+Bitmap operator|(Bitmap a, const Bitmap& b) {
+    a |= b;
+    return a;
+}
+
+// ---- CommentBatch ----
+
+CommentBatch CommentBatch::fromJson(const web::json::value& response) {
+    CommentBatch batch;
+    if (!response.is_object()) return batch;
+    const auto& root = response.as_object();
+    auto commentsIt = root.find(_XPLATSTR("comments"));
+    if (commentsIt == root.end() || !commentsIt->second.is_array()) return batch;
+
+    const auto& comments = commentsIt->second.as_array();
+    batch.reserve(comments.size());
+    for (const auto& comment : comments) {
+        if (!comment.is_object()) continue;
+        std::string id;
+        std::string parentId;
+        int64_t date = 0;
+        int32_t votes = 0;
+        int32_t votesUp = 0;
+        int32_t votesDown = 0;
+        bool flags[kCommentFlagCount] = {};
+        for (const auto& field : comment.as_object()) {
+            const auto& key = field.first;
+            const auto& value = field.second;
+            if (key == _XPLATSTR("id") || key == _XPLATSTR("_id")) id = jsonString(value);
+            else if (key == _XPLATSTR("date")) date = jsonDate(value);
+            else if (key == _XPLATSTR("votes")) votes = jsonInt(value);
+            else if (key == _XPLATSTR("votesUp")) votesUp = jsonInt(value);
+            else if (key == _XPLATSTR("votesDown")) votesDown = jsonInt(value);
+            else if (key == _XPLATSTR("parentId")) parentId = jsonString(value);
+            else if (key == _XPLATSTR("approved")) flags[static_cast<size_t>(CommentFlag::Approved)] = jsonBool(value);
+            else if (key == _XPLATSTR("reviewed")) flags[static_cast<size_t>(CommentFlag::Reviewed)] = jsonBool(value);
+            else if (key == _XPLATSTR("isSpam")) flags[static_cast<size_t>(CommentFlag::Spam)] = jsonBool(value);
+            else if (key == _XPLATSTR("isDeleted")) flags[static_cast<size_t>(CommentFlag::Deleted)] = jsonBool(value);
+            else if (key == _XPLATSTR("isPinned")) flags[static_cast<size_t>(CommentFlag::Pinned)] = jsonBool(value);
+            else if (key == _XPLATSTR("isLocked")) flags[static_cast<size_t>(CommentFlag::Locked)] = jsonBool(value);
+            else if (key == _XPLATSTR("isByAdmin")) flags[static_cast<size_t>(CommentFlag::ByAdmin)] = jsonBool(value);
+            else if (key == _XPLATSTR("isByModerator")) flags[static_cast<size_t>(CommentFlag::ByModerator)] = jsonBool(value);
+            else if (key == _XPLATSTR("verified")) flags[static_cast<size_t>(CommentFlag::Verified)] = jsonBool(value);
+        }
+        batch.addRow(std::move(id), date, votes, votesUp, votesDown, flags, std::move(parentId));
+    }
+    batch.linkParents();
+    return batch;
+}
+
+CommentBatch CommentBatch::fromResponse(const org::openapitools::client::model::APIGetCommentsResponse& response) {
+    CommentBatch batch;
+    const auto comments = response.getComments();
+    batch.reserve(comments.size());
+    for (const auto& c : comments) {
+        if (!c) continue;
+        const bool flags[kCommentFlagCount] = {
+            c->isApproved(), c->isReviewed(), c->isIsSpam(), c->isIsDeleted(), c->isIsPinned(),
+            c->isIsLocked(), c->isIsByAdmin(), c->isIsByModerator(), c->isVerified()
+        };
+        batch.addRow(toUtf8(c->getId()), static_cast<int64_t>(c->getDate()),
+                     c->getVotes(), c->getVotesUp(), c->getVotesDown(),
+                     flags, c->parentIdIsSet() ? toUtf8(c->getParentId()) : std::string());
+    }
+    batch.linkParents();
+    return batch;
+}
+
+CommentBatch CommentBatch::fromResponse(const org::openapitools::client::model::ModerationAPIGetCommentsResponse& response) {
+    CommentBatch batch;
+    const auto comments = response.getComments();
+    batch.reserve(comments.size());
+    for (const auto& c : comments) {
+        if (!c) continue;
+        const bool flags[kCommentFlagCount] = {
+            c->isApproved(), c->isReviewed(), c->isIsSpam(), c->isIsDeleted(), c->isIsPinned(),
+            c->isIsLocked(), c->isIsByAdmin(), c->isIsByModerator(), c->isVerified()
+        };
+        batch.addRow(toUtf8(c->getId()), toEpochMs(c->getDate()),
+                     static_cast<int32_t>(c->getVotes()), static_cast<int32_t>(c->getVotesUp()),
+                     static_cast<int32_t>(c->getVotesDown()),
+                     flags, c->parentIdIsSet() ? toUtf8(c->getParentId()) : std::string());
+    }
+    batch.linkParents();
+    return batch;
+}
+
+void CommentBatch::reserve(size_t rows) {
+    ids_.reserve(rows);
+    dates_.reserve(rows);
+    votes_.reserve(rows);
+    votesUp_.reserve(rows);
+    votesDown_.reserve(rows);
+    parents_.reserve(rows);
+    parentIds_.reserve(rows);
+}
+
+void CommentBatch::append(const CommentBatch& other) {
+    appendRows(other);
+    linkParents();
+}
+
+CommentBatch CommentBatch::concat(const std::vector<CommentBatch>& parts) {
+    CommentBatch batch;
+    size_t total = 0;
+    for (const auto& part : parts) total += part.size();
+    batch.reserve(total);
+    for (const auto& part : parts) batch.appendRows(part);
+    batch.linkParents();
+    return batch;
+}
+
+void CommentBatch::appendRows(const CommentBatch& other) {
+    const size_t offset = size();
+    const size_t total = offset + other.size();
+    reserve(total);
+    ids_.insert(ids_.end(), other.ids_.begin(), other.ids_.end());
+    dates_.insert(dates_.end(), other.dates_.begin(), other.dates_.end());
+    votes_.insert(votes_.end(), other.votes_.begin(), other.votes_.end());
+    votesUp_.insert(votesUp_.end(), other.votesUp_.begin(), other.votesUp_.end());
+    votesDown_.insert(votesDown_.end(), other.votesDown_.begin(), other.votesDown_.end());
+    parentIds_.insert(parentIds_.end(), other.parentIds_.begin(), other.parentIds_.end());
+    parents_.resize(total);
+    for (size_t f = 0; f < kCommentFlagCount; ++f) {
+        flags_[f].resize(total);
+        for (size_t i = 0; i < other.size(); ++i) {
+            if (other.flags_[f].test(i)) flags_[f].set(offset + i);
+        }
+    }
+}
+
+void CommentBatch::addRow(std::string id, int64_t date, int32_t votes, int32_t votesUp, int32_t votesDown,
+                          const bool (&flags)[kCommentFlagCount], std::string parentId) {
+    const size_t row = size();
+    ids_.push_back(std::move(id));
+    dates_.push_back(date);
+    votes_.push_back(votes);
+    votesUp_.push_back(votesUp);
+    votesDown_.push_back(votesDown);
+    parents_.push_back(kNoParent);
+    parentIds_.push_back(std::move(parentId));
+    for (size_t f = 0; f < kCommentFlagCount; ++f) {
+        flags_[f].resize(row + 1);
+        if (flags[f]) flags_[f].set(row);
+    }
+}
+
+void CommentBatch::linkParents() {
+    std::unordered_map<std::string, int32_t> rowById;
+    rowById.reserve(size());
+    for (size_t i = 0; i < size(); ++i) rowById.emplace(ids_[i], static_cast<int32_t>(i));
+    for (size_t i = 0; i < size(); ++i) {
+        if (parentIds_[i].empty()) {
+            parents_[i] = kNoParent;
+            continue;
+        }
+        auto it = rowById.find(parentIds_[i]);
+        parents_[i] = it == rowById.end() ? kParentNotInBatch : it->second;
+    }
+}
+
+Bitmap CommentBatch::dateBetween(int64_t fromMs, int64_t toMs) const {
+    const int64_t* dates = dates_.data();
+    return buildBitmap(size(), [dates, fromMs, toMs](size_t i) {
+        return (dates[i] >= fromMs) & (dates[i] < toMs);
+    });
+}
+
+Bitmap CommentBatch::votesAtLeast(int32_t minVotes) const {
+    const int32_t* votes = votes_.data();
+    return buildBitmap(size(), [votes, minVotes](size_t i) { return votes[i] >= minVotes; });
+}
+
+Bitmap CommentBatch::topLevel() const {
+    const int32_t* parents = parents_.data();
+    return buildBitmap(size(), [parents](size_t i) { return parents[i] == kNoParent; });
+}
+
+VoteStats CommentBatch::voteStats() const {
+    return voteStats(Bitmap(size(), true));
+}
+
+VoteStats CommentBatch::voteStats(const Bitmap& selection) const {
+    VoteStats stats;
+    size_t count = 0;
+    int64_t votes = 0;
+    int64_t up = 0;
+    int64_t down = 0;
+    int64_t minDate = std::numeric_limits<int64_t>::max();
+    int64_t maxDate = std::numeric_limits<int64_t>::min();
+    const size_t n = std::min(size(), selection.size());
+    const std::vector<uint64_t>& words = selection.words();
+    // Unselected rows are masked to zero (sums) or to the identity (min/max)
+    // instead of branched around, keeping the loop body straight-line.
+    for (size_t i = 0; i < n; ++i) {
+        const size_t bit = (words[i >> 6] >> (i & 63)) & 1u;
+        const int64_t keep = -static_cast<int64_t>(bit);
+        count += bit;
+        votes += votes_[i] & keep;
+        up += votesUp_[i] & keep;
+        down += votesDown_[i] & keep;
+        const int64_t date = dates_[i];
+        minDate = std::min(minDate, (date & keep) | (std::numeric_limits<int64_t>::max() & ~keep));
+        maxDate = std::max(maxDate, (date & keep) | (std::numeric_limits<int64_t>::min() & ~keep));
+    }
+    // Bits past the batch's last row are not rows, so only n are counted.
+    stats.count = count;
+    stats.votes = votes;
+    stats.votesUp = up;
+    stats.votesDown = down;
+    if (stats.count > 0) {
+        stats.minDate = minDate;
+        stats.maxDate = maxDate;
+    }
+    return stats;
+}
+
+std::vector<uint32_t> CommentBatch::orderByDate(bool descending) const {
+    std::vector<uint64_t> keys(size());
+    for (size_t i = 0; i < keys.size(); ++i) keys[i] = sortKey(dates_[i], descending);
+    return radixOrder(std::move(keys));
+}
+
+std::vector<uint32_t> CommentBatch::orderByVotes(bool descending) const {
+    std::vector<uint64_t> keys(size());
+    for (size_t i = 0; i < keys.size(); ++i) keys[i] = sortKey(votes_[i], descending);
+    return radixOrder(std::move(keys));
+}
+
+CommentBatch CommentBatch::gather(const std::vector<uint32_t>& rows) const {
+    CommentBatch out;
+    out.reserve(rows.size());
+    for (uint32_t row : rows) {
+        bool flags[kCommentFlagCount];
+        for (size_t f = 0; f < kCommentFlagCount; ++f) flags[f] = flags_[f].test(row);
+        out.addRow(ids_[row], dates_[row], votes_[row], votesUp_[row], votesDown_[row], flags, parentIds_[row]);
+    }
+    out.linkParents();
+    return out;
+}
+
+} // namespace analytics
+} // namespace fastcomments
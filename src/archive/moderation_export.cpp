@@ -0,0 +1,551 @@
+#include "fastcomments/archive/moderation_export.hpp"
+
+#include "FastCommentsClient/api/ModerationApi.h"
+#include "FastCommentsClient/model/ModerationExportResponse.h"
+#include "FastCommentsClient/model/ModerationExportStatusResponse.h"
+#include "internal/timer.hpp"
+#include "internal/util.hpp"
+
+#include <cpprest/http_client.h>
+
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fastcomments {
+namespace archive {
+
+namespace {
+
+using detail::toUtf8;
+
+using Clock = std::chrono::steady_clock;
+using analytics::CommentBatch;
+
+// jobStatus is free text; anything mentioning a failure ends the wait.
+bool reportsFailure(const utility::string_t& jobStatus) {
+    std::string status = toUtf8(jobStatus);
+    std::transform(status.begin(), status.end(), status.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return status.find("fail") != std::string::npos || status.find("error") != std::string::npos ||
+           status.find("cancel") != std::string::npos;
+}
+
+pplx::task<void> readBody(concurrency::streams::istream body, std::shared_ptr<std::vector<uint8_t>> buffer,
+                          ExportJobBackend::ChunkHandler onChunk) {
+    return body.streambuf().getn(buffer->data(), buffer->size()).then([body, buffer, onChunk](size_t read) {
+        if (read == 0) return pplx::task_from_result();
+        return onChunk(reinterpret_cast<const char*>(buffer->data()), read).then([body, buffer, onChunk]() {
+            return readBody(body, buffer, onChunk);
+        });
+    });
+}
+
+// Hands downloaded chunks to the consumer thread. push() never blocks the
+// download: once maxChunks are waiting, the task it returns completes only when
+// the consumer has made room, and the download reads on after that. It fails
+// with the consumer's error once the consumer has failed, so the download stops.
+class ChunkQueue {
+public:
+    explicit ChunkQueue(size_t maxChunks) : maxChunks_(std::max<size_t>(maxChunks, 1)) {}
+
+    pplx::task<void> push(const char* data, size_t size) {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (error_ != nullptr) return pplx::task_from_exception<void>(error_);
+        chunks_.emplace_back(data, size);
+        changed_.notify_all();
+        if (chunks_.size() < maxChunks_) return pplx::task_from_result();
+        room_ = pplx::task_completion_event<void>();
+        full_ = true;
+        return pplx::create_task(room_);
+    }
+
+    // False once the queue is closed and drained, or aborted.
+    bool pop(std::string& chunk) {
+        pplx::task_completion_event<void> room;
+        bool freed = false;
+        {
+            std::unique_lock<std::mutex> lock(mu_);
+            changed_.wait(lock, [this]() { return !chunks_.empty() || closed_ || aborted_; });
+            if (aborted_ || chunks_.empty()) return false;
+            chunk = std::move(chunks_.front());
+            chunks_.pop_front();
+            if (full_ && chunks_.size() < maxChunks_) {
+                full_ = false;
+                freed = true;
+                room = room_;
+            }
+        }
+        if (freed) room.set();
+        return true;
+    }
+
+    // No more chunks; the consumer finishes what is queued.
+    void close() {
+        std::lock_guard<std::mutex> lock(mu_);
+        closed_ = true;
+        changed_.notify_all();
+    }
+
+    // The download failed; the consumer stops without finishing.
+    void abort() {
+        std::lock_guard<std::mutex> lock(mu_);
+        aborted_ = true;
+        changed_.notify_all();
+    }
+
+    void fail(std::exception_ptr error) {
+        pplx::task_completion_event<void> room;
+        bool waiting = false;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            error_ = error;
+            waiting = full_;
+            full_ = false;
+            room = room_;
+        }
+        if (waiting) room.set_exception(error);
+    }
+
+    std::exception_ptr error() const {
+        std::lock_guard<std::mutex> lock(mu_);
+        return error_;
+    }
+
+    bool aborted() const {
+        std::lock_guard<std::mutex> lock(mu_);
+        return aborted_;
+    }
+
+private:
+    const size_t maxChunks_;
+    mutable std::mutex mu_;
+    std::condition_variable changed_;
+    std::deque<std::string> chunks_;
+    bool closed_ = false;
+    bool aborted_ = false;
+    std::exception_ptr error_;
+    bool full_ = false;   // a push is waiting on room_
+    pplx::task_completion_event<void> room_;
+};
+
+// Cuts comment records out of a JSON export as it arrives, without parsing
+// them: the elements of a top-level array, the elements of a top-level
+// object's "comments" array, or top-level objects one after another (NDJSON).
+class RecordSplitter {
+public:
+    template <typename OnRecord>
+    void feed(const char* data, size_t size, OnRecord&& onRecord) {
+        for (size_t i = 0; i < size; ++i) {
+            const char c = data[i];
+            if (inRecord_) record_.push_back(c);
+            if (inString_) {
+                if (escaped_) {
+                    escaped_ = false;
+                } else if (c == '\\') {
+                    escaped_ = true;
+                } else if (c == '"') {
+                    inString_ = false;
+                } else if (capturingKey_) {
+                    key_.push_back(c);
+                }
+                continue;
+            }
+            switch (c) {
+            case '"':
+                inString_ = true;
+                // A string directly inside a top-level object: the last one
+                // before a '[' is that array's key.
+                capturingKey_ = candidate_ && stack_.size() == 1;
+                if (capturingKey_) key_.clear();
+                break;
+            case '{':
+            case '[':
+                open(c);
+                break;
+            case '}':
+            case ']':
+                if (stack_.empty()) throw std::runtime_error("ExportPipeline: malformed export body");
+                stack_.pop_back();
+                if (inRecord_ && stack_.size() == openDepth_) {
+                    onRecord(record_);
+                    record_.clear();
+                    inRecord_ = false;
+                    if (candidate_) {
+                        candidate_ = false;
+                        recordDepth_ = 0;
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void finish() const {
+        if (inRecord_ || !stack_.empty()) throw std::runtime_error("ExportPipeline: export body ended mid-record");
+    }
+
+private:
+    static constexpr size_t kUnknown = static_cast<size_t>(-1);
+
+    void open(char c) {
+        const size_t depth = stack_.size();
+        stack_.push_back(c);
+        if (inRecord_) {
+            // {"comments": [...]}: the candidate was the wrapper, not a record.
+            if (candidate_ && depth == 1 && c == '[' && key_ == "comments") {
+                candidate_ = false;
+                inRecord_ = false;
+                record_.clear();
+                recordDepth_ = 2;
+            }
+            return;
+        }
+        if (recordDepth_ == kUnknown) {
+            if (depth != 0) return;
+            if (c == '[') {
+                recordDepth_ = 1;
+                return;
+            }
+            // A record, or the wrapper object; which is known at its first array.
+            candidate_ = true;
+        } else if (depth != recordDepth_ || c != '{') {
+            return;
+        }
+        inRecord_ = true;
+        openDepth_ = depth;
+        record_.assign(1, c);
+    }
+
+    std::string record_;
+    std::vector<char> stack_;
+    std::string key_;
+    size_t recordDepth_ = kUnknown;
+    size_t openDepth_ = 0;
+    bool inRecord_ = false;
+    bool candidate_ = false;
+    bool inString_ = false;
+    bool escaped_ = false;
+    bool capturingKey_ = false;
+};
+
+// Serializes progress callbacks and keeps the running totals.
+class ProgressReporter {
+public:
+    explicit ProgressReporter(std::function<void(const ExportProgress&)> onProgress)
+        : onProgress_(std::move(onProgress)) {}
+
+    template <typename Update>
+    void update(Update&& change) {
+        std::lock_guard<std::mutex> lock(mu_);
+        change(progress_);
+        if (onProgress_) onProgress_(progress_);
+    }
+
+    ExportProgress snapshot() const {
+        std::lock_guard<std::mutex> lock(mu_);
+        return progress_;
+    }
+
+private:
+    std::function<void(const ExportProgress&)> onProgress_;
+    mutable std::mutex mu_;
+    ExportProgress progress_;
+};
+
+// What happens to the downloaded bytes. Runs on the consumer thread.
+class Consumer {
+public:
+    virtual ~Consumer() = default;
+    virtual void consume(const std::string& chunk) = 0;
+    virtual void finish() = 0;
+};
+
+class FileConsumer : public Consumer {
+public:
+    explicit FileConsumer(std::string path) : path_(std::move(path)), partPath_(path_ + ".part") {
+        file_.open(partPath_, std::ios::binary | std::ios::trunc);
+        if (!file_) throw std::runtime_error("ExportPipeline: cannot open " + partPath_);
+    }
+
+    ~FileConsumer() override {
+        if (finished_) return;
+        file_.close();
+        std::error_code ignored;
+        std::filesystem::remove(partPath_, ignored);
+    }
+
+    void consume(const std::string& chunk) override {
+        file_.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        if (!file_) throw std::runtime_error("ExportPipeline: write to " + partPath_ + " failed");
+    }
+
+    void finish() override {
+        file_.close();
+        if (!file_) throw std::runtime_error("ExportPipeline: write to " + partPath_ + " failed");
+        std::filesystem::rename(partPath_, path_);
+        finished_ = true;
+    }
+
+private:
+    std::string path_;
+    std::string partPath_;
+    std::ofstream file_;
+    bool finished_ = false;
+};
+
+class BatchConsumer : public Consumer {
+public:
+    explicit BatchConsumer(std::shared_ptr<ProgressReporter> progress) : progress_(std::move(progress)) {}
+
+    void consume(const std::string& chunk) override {
+        splitter_.feed(chunk.data(), chunk.size(), [this](const std::string& record) {
+            group_.append(groupSize_ == 0 ? "{\"comments\":[" : ",");
+            group_.append(record);
+            ++groupSize_;
+        });
+        if (groupSize_ >= kGroupSize) decodeGroup();
+    }
+
+    void finish() override {
+        splitter_.finish();
+        decodeGroup();
+        result = CommentBatch::concat(parts_);
+        parts_.clear();
+    }
+
+    CommentBatch result;
+
+private:
+    // Records are decoded a group at a time, from one parse of the group.
+    static constexpr size_t kGroupSize = 512;
+
+    void decodeGroup() {
+        if (groupSize_ == 0) return;
+        group_.append("]}");
+        parts_.push_back(CommentBatch::fromJson(web::json::value::parse(utility::conversions::to_string_t(group_))));
+        const uint64_t decoded = groupSize_;
+        progress_->update([decoded](ExportProgress& p) { p.records += decoded; });
+        group_.clear();
+        groupSize_ = 0;
+    }
+
+    std::shared_ptr<ProgressReporter> progress_;
+    RecordSplitter splitter_;
+    std::string group_;
+    size_t groupSize_ = 0;
+    std::vector<CommentBatch> parts_;
+};
+
+// One export: start, wait for the download URL, download into the consumer.
+struct Job : std::enable_shared_from_this<Job> {
+    ExportJobBackend backend;
+    ExportPipelineOptions options;
+    std::shared_ptr<ProgressReporter> progress;
+    Clock::time_point startedAt = Clock::now();
+    utility::string_t batchJobId;
+    std::chrono::milliseconds interval{0};
+    int32_t lastCount = -1;
+    uint32_t polls = 0;
+
+    pplx::task<utility::string_t> waitForDownload() {
+        auto self = shared_from_this();
+        return detail::delay(interval)
+            .then([self]() { return self->backend.status(self->batchJobId); })
+            .then([self](std::shared_ptr<ModerationExportStatusResponse> status) {
+                return self->afterPoll(status);
+            });
+    }
+
+    pplx::task<utility::string_t> afterPoll(const std::shared_ptr<ModerationExportStatusResponse>& status) {
+        ++polls;
+        const utility::string_t jobStatus = status != nullptr ? status->getJobStatus() : utility::string_t();
+        const int32_t count = status != nullptr ? status->getRecordCount() : 0;
+        if (status != nullptr && (reportsFailure(jobStatus) || reportsFailure(status->getStatus()))) {
+            throw std::runtime_error("ExportPipeline: export job " + toUtf8(batchJobId) + " failed: " + toUtf8(jobStatus));
+        }
+        if (status != nullptr && status->downloadUrlIsSet() && !status->getDownloadUrl().empty()) {
+            progress->update([&](ExportProgress& p) {
+                p.phase = ExportPhase::Downloading;
+                p.jobStatus = jobStatus;
+                p.recordCount = count;
+                p.polls = polls;
+                p.nextPoll = std::chrono::milliseconds(0);
+            });
+            return pplx::task_from_result(status->getDownloadUrl());
+        }
+
+        if (lastCount >= 0 && count > lastCount) {
+            interval = std::max(interval / 2, options.minPollInterval);
+        } else if (lastCount >= 0) {
+            interval = std::min(interval * 2, options.maxPollInterval);
+        }
+        lastCount = count;
+
+        if (Clock::now() + interval - startedAt > options.timeout) {
+            throw std::runtime_error("ExportPipeline: export job " + toUtf8(batchJobId) + " did not finish in time");
+        }
+        progress->update([&](ExportProgress& p) {
+            p.phase = ExportPhase::Waiting;
+            p.jobStatus = jobStatus;
+            p.recordCount = count;
+            p.polls = polls;
+            p.nextPoll = interval;
+        });
+        return waitForDownload();
+    }
+
+    pplx::task<void> download(const utility::string_t& url, std::shared_ptr<Consumer> consumer) {
+        auto queue = std::make_shared<ChunkQueue>(options.maxQueuedChunks);
+        // The consumer does blocking I/O, so it gets a thread of its own rather
+        // than a pool thread; consumed completes when it is done.
+        pplx::task_completion_event<void> consumed;
+        std::thread([queue, consumer, consumed]() {
+            try {
+                std::string chunk;
+                while (queue->pop(chunk)) consumer->consume(chunk);
+                if (!queue->aborted()) consumer->finish();
+            } catch (...) {
+                queue->fail(std::current_exception());
+            }
+            consumed.set();
+        }).detach();
+
+        auto reporter = progress;
+        pplx::task<void> body;
+        try {
+            body = backend.download(url, [queue, reporter](const char* data, size_t size) {
+                reporter->update([size](ExportProgress& p) { p.bytes += size; });
+                return queue->push(data, size);
+            });
+        } catch (...) {
+            body = pplx::task_from_exception<void>(std::current_exception());
+        }
+        return body
+            .then([queue, consumed](pplx::task<void> t) {
+                std::exception_ptr downloadError;
+                try {
+                    t.get();
+                } catch (...) {
+                    downloadError = std::current_exception();
+                }
+                if (downloadError != nullptr) queue->abort();
+                else queue->close();
+                return pplx::create_task(consumed).then([downloadError]() { return downloadError; });
+            })
+            .then([queue](std::exception_ptr downloadError) {
+                // The consumer's error explains a download stopped by push().
+                if (auto consumerError = queue->error()) std::rethrow_exception(consumerError);
+                if (downloadError != nullptr) std::rethrow_exception(downloadError);
+            });
+    }
+
+    pplx::task<ExportSummary> run(std::shared_ptr<Consumer> consumer) {
+        auto self = shared_from_this();
+        progress->update([](ExportProgress& p) { p.phase = ExportPhase::Starting; });
+        return backend.start()
+            .then([self](utility::string_t id) {
+                if (id.empty()) throw std::runtime_error("ExportPipeline: postApiExport returned no batch job id");
+                self->batchJobId = id;
+                self->interval = self->options.initialPollInterval;
+                self->progress->update([&](ExportProgress& p) {
+                    p.phase = ExportPhase::Waiting;
+                    p.batchJobId = id;
+                    p.nextPoll = self->interval;
+                });
+                return self->waitForDownload();
+            })
+            .then([self, consumer](utility::string_t url) { return self->download(url, consumer); })
+            .then([self]() {
+                ExportSummary summary;
+                self->progress->update([&](ExportProgress& p) {
+                    p.phase = ExportPhase::Done;
+                    summary.batchJobId = p.batchJobId;
+                    summary.recordCount = p.recordCount;
+                    summary.polls = p.polls;
+                    summary.bytes = p.bytes;
+                });
+                summary.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - self->startedAt);
+                return summary;
+            });
+    }
+};
+
+std::shared_ptr<Job> makeJob(const ExportJobBackend& backend, const ExportPipelineOptions& options) {
+    auto job = std::make_shared<Job>();
+    job->backend = backend;
+    job->options = options;
+    job->progress = std::make_shared<ProgressReporter>(options.onProgress);
+    return job;
+}
+
+} // namespace
+
+ExportJobBackend moderationExportBackend(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId) {
+    return moderationExportBackend(std::move(api), std::move(tenantId), PostApiExportOptions());
+}
+
+ExportJobBackend moderationExportBackend(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId,
+                                         const PostApiExportOptions& filters) {
+    namespace client = org::openapitools::client;
+    ExportJobBackend backend;
+    backend.start = [api, tenantId, filters]() {
+        return api->postApiExport(tenantId, filters).then([](std::shared_ptr<client::model::ModerationExportResponse> response) {
+            return response != nullptr ? response->getBatchJobId() : utility::string_t();
+        });
+    };
+    backend.status = [api, tenantId, sso = filters.sso](const utility::string_t& batchJobId) {
+        client::api::GetApiExportStatusOptions options;
+        options.batchJobId = batchJobId;
+        options.sso = sso;
+        return api->getApiExportStatus(tenantId, options);
+    };
+    backend.download = [](const utility::string_t& downloadUrl, ExportJobBackend::ChunkHandler onChunk) {
+        auto client = std::make_shared<web::http::client::http_client>(web::uri(downloadUrl));
+        return client->request(web::http::methods::GET).then([client, onChunk](web::http::http_response response) {
+            if (response.status_code() != web::http::status_codes::OK) {
+                throw web::http::http_exception(
+                    response.status_code(),
+                    utility::conversions::to_string_t("export download failed with HTTP " + std::to_string(response.status_code())));
+            }
+            return readBody(response.body(), std::make_shared<std::vector<uint8_t>>(64 * 1024), onChunk);
+        });
+    };
+    return backend;
+}
+
+ExportPipeline::ExportPipeline(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId,
+                               ExportPipelineOptions options)
+    : ExportPipeline(moderationExportBackend(std::move(api), std::move(tenantId)), std::move(options)) {}
+
+ExportPipeline::ExportPipeline(ExportJobBackend backend, ExportPipelineOptions options)
+    : backend_(std::move(backend)), options_(std::move(options)) {
+    if (options_.minPollInterval.count() < 1) options_.minPollInterval = std::chrono::milliseconds(1);
+    options_.maxPollInterval = std::max(options_.maxPollInterval, options_.minPollInterval);
+    options_.initialPollInterval =
+        std::min(std::max(options_.initialPollInterval, options_.minPollInterval), options_.maxPollInterval);
+}
+
+pplx::task<ExportSummary> ExportPipeline::toFile(std::string path) const {
+    auto consumer = std::make_shared<FileConsumer>(std::move(path));
+    return makeJob(backend_, options_)->run(consumer);
+}
+
+pplx::task<CommentBatch> ExportPipeline::toBatch() const {
+    auto job = makeJob(backend_, options_);
+    auto consumer = std::make_shared<BatchConsumer>(job->progress);
+    return job->run(consumer).then([consumer](ExportSummary) { return std::move(consumer->result); });
+}
+
+} // namespace archive
+} // namespace fastcomments
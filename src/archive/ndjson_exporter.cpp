@@ -0,0 +1,306 @@
+#include "fastcomments/archive/ndjson_exporter.hpp"
+
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/api/DefaultApi.h"
+#include "FastCommentsClient/model/APIGetCommentsResponse.h"
+#include "FastCommentsClient/model/GetAuditLogsResponse.h"
+#include "FastCommentsClient/model/GetVotesResponse.h"
+#include "FastCommentsClient/model/SORT_DIR.h"
+#include "FastCommentsClient/model/SortDirections.h"
+
+#include <cpprest/json.h>
+#include <zlib.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <utility>
+
+namespace fastcomments {
+namespace archive {
+
+namespace {
+
+using org::openapitools::client::model::JsonWriter;
+
+// Compresses everything written through it into gzip members on `file`. Each
+// finishMember() closes the current member so the file is valid gzip up to there.
+class GzipStreamBuf : public std::streambuf {
+public:
+    explicit GzipStreamBuf(std::ostream& file) : file_(file), in_(64 * 1024), out_(64 * 1024) {
+        setp(in_.data(), in_.data() + in_.size());
+    }
+
+    ~GzipStreamBuf() override {
+        if (started_) deflateEnd(&zs_);
+    }
+
+    void finishMember() {
+        deflateBuffer(Z_FINISH);
+        deflateEnd(&zs_);
+        started_ = false;
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        deflateBuffer(Z_NO_FLUSH);
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    int sync() override {
+        deflateBuffer(Z_NO_FLUSH);
+        return 0;
+    }
+
+private:
+    void deflateBuffer(int flush) {
+        if (!started_) {
+            zs_ = z_stream();
+            // 15 window bits + 16 selects the gzip wrapper.
+            if (deflateInit2(&zs_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+                throw std::runtime_error("NdjsonExporter: deflateInit2 failed");
+            }
+            started_ = true;
+        }
+        zs_.next_in = reinterpret_cast<Bytef*>(pbase());
+        zs_.avail_in = static_cast<uInt>(pptr() - pbase());
+        int rc = Z_OK;
+        do {
+            zs_.next_out = reinterpret_cast<Bytef*>(out_.data());
+            zs_.avail_out = static_cast<uInt>(out_.size());
+            rc = deflate(&zs_, flush);
+            if (rc == Z_STREAM_ERROR) throw std::runtime_error("NdjsonExporter: deflate failed");
+            file_.write(out_.data(), static_cast<std::streamsize>(out_.size() - zs_.avail_out));
+        } while (zs_.avail_out == 0 || (flush == Z_FINISH && rc != Z_STREAM_END));
+        setp(in_.data(), in_.data() + in_.size());
+    }
+
+    std::ostream& file_;
+    std::vector<char> in_;
+    std::vector<char> out_;
+    z_stream zs_{};
+    bool started_ = false;
+};
+
+template <typename Models>
+void appendRecords(ExportPage& page, const Models& models) {
+    page.records.reserve(page.records.size() + models.size());
+    for (const auto& model : models) {
+        if (model != nullptr) page.records.push_back(model);
+    }
+}
+
+int64_t advanceBySkip(int64_t cursor, const ExportPage& page) {
+    return cursor + static_cast<int64_t>(page.records.size());
+}
+
+} // namespace
+
+ExportSource commentsSource(std::shared_ptr<DefaultApi> api, utility::string_t tenantId, int32_t pageSize) {
+    using org::openapitools::client::model::SortDirections;
+    ExportSource source;
+    source.name = "comments";
+    source.fetch = [api, tenantId, pageSize](int64_t cursor) {
+        org::openapitools::client::api::GetCommentsOptions options;
+        options.skip = static_cast<int32_t>(cursor);
+        options.limit = pageSize;
+        auto direction = std::make_shared<SortDirections>();
+        direction->setValue(SortDirections::eSortDirections::OF);
+        options.direction = direction;
+        return api->getComments(tenantId, options).then([pageSize](std::shared_ptr<org::openapitools::client::model::APIGetCommentsResponse> response) {
+            ExportPage page;
+            if (response != nullptr) appendRecords(page, response->getComments());
+            page.last = page.records.size() < static_cast<size_t>(pageSize);
+            return page;
+        });
+    };
+    source.next = advanceBySkip;
+    return source;
+}
+
+ExportSource auditLogsSource(std::shared_ptr<DefaultApi> api, utility::string_t tenantId, int32_t pageSize) {
+    using org::openapitools::client::model::SORT_DIR;
+    ExportSource source;
+    source.name = "audit-logs";
+    source.fetch = [api, tenantId, pageSize](int64_t cursor) {
+        org::openapitools::client::api::GetAuditLogsOptions options;
+        options.skip = static_cast<double>(cursor);
+        options.limit = static_cast<double>(pageSize);
+        auto order = std::make_shared<SORT_DIR>();
+        order->setValue(SORT_DIR::eSORT_DIR::ASC);
+        options.order = order;
+        return api->getAuditLogs(tenantId, options).then([pageSize](std::shared_ptr<org::openapitools::client::model::GetAuditLogsResponse> response) {
+            ExportPage page;
+            if (response != nullptr) appendRecords(page, response->getAuditLogs());
+            page.last = page.records.size() < static_cast<size_t>(pageSize);
+            return page;
+        });
+    };
+    source.next = advanceBySkip;
+    return source;
+}
+
+ExportSource votesSource(std::shared_ptr<DefaultApi> api, utility::string_t tenantId,
+                         std::vector<utility::string_t> urlIds) {
+    auto ids = std::make_shared<const std::vector<utility::string_t>>(std::move(urlIds));
+    ExportSource source;
+    source.name = "votes";
+    source.fetch = [api, tenantId, ids](int64_t cursor) {
+        const size_t index = static_cast<size_t>(cursor);
+        if (index >= ids->size()) return pplx::task_from_result(ExportPage{{}, true});
+        return api->getVotes(tenantId, (*ids)[index]).then([ids, index](std::shared_ptr<org::openapitools::client::model::GetVotesResponse> response) {
+            ExportPage page;
+            if (response != nullptr) {
+                appendRecords(page, response->getAppliedAuthorizedVotes());
+                appendRecords(page, response->getAppliedAnonymousVotes());
+            }
+            page.last = index + 1 >= ids->size();
+            return page;
+        });
+    };
+    source.next = [](int64_t cursor, const ExportPage&) { return cursor + 1; };
+    return source;
+}
+
+NdjsonExporter::NdjsonExporter(std::string path, ExportOptions options)
+    : path_(std::move(path)), options_(options) {}
+
+bool NdjsonExporter::readCheckpoint(const std::string& path, ExportCheckpoint& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::stringstream text;
+    text << in.rdbuf();
+    web::json::value json;
+    try {
+        json = web::json::value::parse(utility::conversions::to_string_t(text.str()));
+        out.source = utility::conversions::to_utf8string(json.at(utility::conversions::to_string_t("source")).as_string());
+        out.cursor = static_cast<int64_t>(json.at(utility::conversions::to_string_t("cursor")).as_double());
+        out.records = static_cast<uint64_t>(json.at(utility::conversions::to_string_t("records")).as_double());
+        out.bytes = static_cast<uint64_t>(json.at(utility::conversions::to_string_t("bytes")).as_double());
+        out.complete = json.at(utility::conversions::to_string_t("complete")).as_bool();
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+void NdjsonExporter::writeCheckpoint(const ExportCheckpoint& checkpoint) const {
+    JsonWriter writer;
+    writer.beginObject();
+    writer.key(utility::conversions::to_string_t("source"));
+    writer.value(utility::conversions::to_string_t(checkpoint.source));
+    writer.key(utility::conversions::to_string_t("cursor"));
+    writer.value(checkpoint.cursor);
+    writer.key(utility::conversions::to_string_t("records"));
+    writer.value(static_cast<int64_t>(checkpoint.records));
+    writer.key(utility::conversions::to_string_t("bytes"));
+    writer.value(static_cast<int64_t>(checkpoint.bytes));
+    writer.key(utility::conversions::to_string_t("complete"));
+    writer.value(checkpoint.complete);
+    writer.endObject();
+
+    // Replace atomically so a crash mid-write leaves the previous checkpoint.
+    const std::string tmp = checkpointPath() + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out << writer.str();
+        out.flush();
+        if (!out) throw std::runtime_error("NdjsonExporter: cannot write " + tmp);
+    }
+    std::filesystem::rename(tmp, checkpointPath());
+}
+
+ExportStats NdjsonExporter::run(const ExportSource& source) {
+    ExportStats stats;
+    ExportCheckpoint checkpoint;
+    checkpoint.source = source.name;
+
+    ExportCheckpoint saved;
+    bool resumable = options_.resume && readCheckpoint(checkpointPath(), saved);
+    if (resumable && saved.source != source.name) {
+        throw std::runtime_error("NdjsonExporter: " + checkpointPath() + " belongs to a '" + saved.source +
+                                 "' export, not '" + source.name + "'");
+    }
+    if (resumable) {
+        // A missing file, or one shorter than the checkpoint says, lost
+        // records it counts: start the export over.
+        std::error_code error;
+        const uintmax_t size = std::filesystem::file_size(path_, error);
+        resumable = !error && size >= saved.bytes;
+    }
+    if (resumable) {
+        checkpoint = saved;
+        stats.resumed = true;
+        stats.records = saved.records;
+        stats.bytes = saved.bytes;
+        if (saved.complete) return stats;
+        // Anything past the checkpoint is a page that was not fully written.
+        std::filesystem::resize_file(path_, saved.bytes);
+    }
+
+    std::ofstream file(path_, std::ios::binary | (stats.resumed ? std::ios::app : std::ios::trunc));
+    if (!file) throw std::runtime_error("NdjsonExporter: cannot open " + path_);
+    std::unique_ptr<GzipStreamBuf> gzip;
+    std::ostream gzipStream(nullptr);
+    if (options_.compression == Compression::Gzip) {
+        gzip.reset(new GzipStreamBuf(file));
+        gzipStream.rdbuf(gzip.get());
+    }
+    JsonWriter writer(gzip != nullptr ? gzipStream : file);
+
+    int64_t cursor = checkpoint.cursor;
+    pplx::task<ExportPage> pending = source.fetch(cursor);
+    while (true) {
+        ExportPage page = pending.get();
+        ++stats.pages;
+        const int64_t next = source.next(cursor, page);
+        // Overlap the next request with writing this page.
+        if (!page.last) pending = source.fetch(next);
+
+        try {
+            for (const auto& record : page.records) {
+                record->writeJson(writer);
+                writer.endLine();
+            }
+            writer.flush();
+            if (gzip != nullptr) {
+                gzipStream.flush();
+                gzip->finishMember();
+            }
+            file.flush();
+            if (!file) throw std::runtime_error("NdjsonExporter: write to " + path_ + " failed");
+
+            stats.records += page.records.size();
+            stats.bytes = static_cast<uint64_t>(file.tellp());
+            checkpoint.cursor = next;
+            checkpoint.records = stats.records;
+            checkpoint.bytes = stats.bytes;
+            checkpoint.complete = page.last;
+            writeCheckpoint(checkpoint);
+        } catch (...) {
+            // Observe the prefetch so its result or error isn't left dangling.
+            if (!page.last) {
+                pending.then([](pplx::task<ExportPage> t) {
+                    try {
+                        t.get();
+                    } catch (...) {
+                    }
+                });
+            }
+            throw;
+        }
+
+        if (page.last) break;
+        cursor = next;
+    }
+    return stats;
+}
+
+} // namespace archive
+} // namespace fastcomments
@@ -0,0 +1,255 @@
+#include "fastcomments/batch/moderation_executor.hpp"
+
+#include "FastCommentsClient/ApiException.h"
+#include "FastCommentsClient/api/ModerationApi.h"
+#include "FastCommentsClient/model/APIEmptyResponse.h"
+#include "FastCommentsClient/model/CommentsByIdsParams.h"
+#include "FastCommentsClient/model/ModerationAPIChildCommentsResponse.h"
+#include "FastCommentsClient/model/ModerationAPIComment.h"
+#include "FastCommentsClient/model/PostRemoveCommentApiResponse.h"
+#include "FastCommentsClient/model/SetCommentApprovedResponse.h"
+#include "internal/timer.hpp"
+#include "internal/util.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::ApiException;
+
+namespace {
+
+using detail::describe;
+
+using Comments = std::vector<std::shared_ptr<ModerationAPIComment>>;
+
+// 5xx and 429 are worth another attempt, as is a request that never got an
+// answer. Any other error response would only come back again.
+bool retriable(std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const ApiException& e) {
+        const int status = e.error_code().value();
+        return status >= 500 || status == 429;
+    } catch (const web::http::http_exception&) {
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+// One run(): the ids still to do and what has happened to the rest.
+struct Run : std::enable_shared_from_this<Run> {
+    ModerationBackend backend;
+    ModerationOptions options;
+    ModerationAction action;
+    std::vector<utility::string_t> ids;
+
+    std::mutex mu;
+    size_t next = 0;
+    size_t lanes = 0;
+    ModerationProgress progress;
+    ModerationReport report;
+    pplx::task_completion_event<ModerationReport> done;
+
+    void start() {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            lanes = std::min(options.concurrency, ids.size());
+            if (lanes == 0) {
+                done.set(std::move(report));
+                return;
+            }
+        }
+        for (size_t lane = 0, n = lanes; lane < n; ++lane) takeNext();
+    }
+
+    void takeNext() {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            if (next == ids.size()) {
+                if (--lanes == 0) done.set(std::move(report));
+                return;
+            }
+            index = next++;
+        }
+        attempt(index, 1);
+    }
+
+    void attempt(size_t index, int attemptNumber) {
+        auto self = shared_from_this();
+        pplx::task<void> call;
+        try {
+            call = backend.apply(action, ids[index]);
+        } catch (...) {
+            call = pplx::task_from_exception<void>(std::current_exception());
+        }
+        call.then([self, index, attemptNumber](pplx::task<void> t) {
+            std::exception_ptr error;
+            try {
+                t.get();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            if (error && attemptNumber < self->options.maxAttempts && retriable(error)) {
+                const auto wait = self->options.retryDelay * (1 << (attemptNumber - 1));
+                detail::delay(wait).then([self, index, attemptNumber]() { self->attempt(index, attemptNumber + 1); });
+                return;
+            }
+            self->finish(index, attemptNumber, error);
+            self->takeNext();
+        });
+    }
+
+    void finish(size_t index, int attempts, std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(mu);
+        if (error) {
+            report.failures.push_back({ids[index], describe(error), attempts});
+            ++progress.failed;
+        } else {
+            report.succeeded.push_back(ids[index]);
+            ++progress.succeeded;
+        }
+        ++progress.done;
+        if (options.onProgress) options.onProgress(progress);
+    }
+};
+
+} // namespace
+
+bool alreadyApplied(const ModerationAction& action, const ModerationAPIComment& comment) {
+    switch (action.kind) {
+    case ModerationAction::Kind::SetApproved:
+        return comment.isApproved() == action.value;
+    case ModerationAction::Kind::SetSpam: {
+        const bool spam = comment.isSpamIsSet() && comment.isIsSpam();
+        if (spam != action.value) return false;
+        return action.value || !action.permNotSpam || comment.isPermNotSpam();
+    }
+    case ModerationAction::Kind::SetReviewed:
+        return comment.isReviewed() == action.value;
+    case ModerationAction::Kind::Remove:
+        return comment.isLocalDeletedIsSet() && comment.isIsLocalDeleted();
+    }
+    return false;
+}
+
+ModerationBackend moderationBackend(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId,
+                                    boost::optional<utility::string_t> sso,
+                                    boost::optional<utility::string_t> broadcastId) {
+    namespace client = org::openapitools::client;
+    ModerationBackend backend;
+    backend.apply = [api, tenantId, sso, broadcastId](const ModerationAction& action, const utility::string_t& commentId) {
+        switch (action.kind) {
+        case ModerationAction::Kind::SetApproved: {
+            client::api::PostSetCommentApprovalStatusOptions options;
+            options.approved = action.value;
+            options.broadcastId = broadcastId;
+            options.sso = sso;
+            return api->postSetCommentApprovalStatus(tenantId, commentId, options)
+                .then([](std::shared_ptr<client::model::SetCommentApprovedResponse>) {});
+        }
+        case ModerationAction::Kind::SetSpam: {
+            client::api::PostSetCommentSpamStatusOptions options;
+            options.spam = action.value;
+            if (!action.value && action.permNotSpam) options.permNotSpam = true;
+            options.broadcastId = broadcastId;
+            options.sso = sso;
+            return api->postSetCommentSpamStatus(tenantId, commentId, options)
+                .then([](std::shared_ptr<client::model::APIEmptyResponse>) {});
+        }
+        case ModerationAction::Kind::SetReviewed: {
+            client::api::PostSetCommentReviewStatusOptions options;
+            options.reviewed = action.value;
+            options.broadcastId = broadcastId;
+            options.sso = sso;
+            return api->postSetCommentReviewStatus(tenantId, commentId, options)
+                .then([](std::shared_ptr<client::model::APIEmptyResponse>) {});
+        }
+        case ModerationAction::Kind::Remove:
+            break;
+        }
+        client::api::PostRemoveCommentOptions options;
+        options.broadcastId = broadcastId;
+        options.sso = sso;
+        return api->postRemoveComment(tenantId, commentId, options)
+            .then([](std::shared_ptr<client::model::PostRemoveCommentApiResponse>) {});
+    };
+    backend.lookup = [api, tenantId, sso](const std::vector<utility::string_t>& commentIds) {
+        auto params = std::make_shared<client::model::CommentsByIdsParams>();
+        params->setIds(commentIds);
+        return api->postCommentsByIds(tenantId, params, sso)
+            .then([](std::shared_ptr<client::model::ModerationAPIChildCommentsResponse> response) {
+                return response != nullptr ? response->getComments() : Comments();
+            });
+    };
+    return backend;
+}
+
+ModerationExecutor::ModerationExecutor(std::shared_ptr<const ModerationApi> api, utility::string_t tenantId,
+                                       ModerationOptions options)
+    : ModerationExecutor(moderationBackend(std::move(api), std::move(tenantId)), std::move(options)) {}
+
+ModerationExecutor::ModerationExecutor(ModerationBackend backend, ModerationOptions options)
+    : backend_(std::move(backend)), options_(std::move(options)) {
+    if (options_.concurrency == 0) options_.concurrency = 1;
+    if (options_.maxAttempts < 1) options_.maxAttempts = 1;
+    if (options_.lookupChunk == 0) options_.lookupChunk = 100;
+}
+
+pplx::task<ModerationReport> ModerationExecutor::run(std::vector<utility::string_t> commentIds, ModerationAction action) const {
+    auto run = std::make_shared<Run>();
+    run->backend = backend_;
+    run->options = options_;
+    run->action = action;
+    {
+        std::unordered_set<utility::string_t> seen;
+        for (auto& id : commentIds) {
+            if (seen.insert(id).second) run->ids.push_back(std::move(id));
+        }
+    }
+    run->progress.total = run->ids.size();
+
+    if (!options_.skipUnchanged || run->ids.empty()) {
+        run->start();
+        return pplx::create_task(run->done);
+    }
+
+    std::vector<pplx::task<Comments>> lookups;
+    for (size_t begin = 0; begin < run->ids.size(); begin += options_.lookupChunk) {
+        const size_t end = std::min(begin + options_.lookupChunk, run->ids.size());
+        lookups.push_back(backend_.lookup(std::vector<utility::string_t>(run->ids.begin() + begin, run->ids.begin() + end)));
+    }
+    return pplx::when_all(lookups.begin(), lookups.end()).then([run](std::vector<Comments> found) {
+        std::unordered_map<utility::string_t, std::shared_ptr<ModerationAPIComment>> byId;
+        for (const auto& chunk : found) {
+            for (const auto& comment : chunk) {
+                if (comment != nullptr) byId.emplace(comment->getId(), comment);
+            }
+        }
+        std::vector<utility::string_t> todo;
+        for (auto& id : run->ids) {
+            auto it = byId.find(id);
+            if (it == byId.end() || alreadyApplied(run->action, *it->second)) {
+                run->report.skipped.push_back(std::move(id));
+                ++run->progress.skipped;
+                ++run->progress.done;
+            } else {
+                todo.push_back(std::move(id));
+            }
+        }
+        run->ids = std::move(todo);
+        if (run->options.onProgress && run->progress.skipped > 0) run->options.onProgress(run->progress);
+        run->start();
+        return pplx::create_task(run->done);
+    });
+}
+
+} // namespace batch
+} // namespace fastcomments
@@ -0,0 +1,194 @@
+#include "fastcomments/batch/question_result_batcher.hpp"
+
+#include "FastCommentsClient/ApiException.h"
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/model/APIStatus.h"
+#include "FastCommentsClient/model/BulkAggregateQuestionItem.h"
+#include "FastCommentsClient/model/BulkAggregateQuestionResultsRequest.h"
+#include "FastCommentsClient/model/BulkAggregateQuestionResultsResponse.h"
+#include "FastCommentsClient/model/QuestionResultAggregationOverall.h"
+#include "internal/batcher.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::ApiException;
+using org::openapitools::client::model::APIStatus;
+using org::openapitools::client::model::BulkAggregateQuestionItem;
+using org::openapitools::client::model::JsonWriter;
+
+namespace {
+
+using Result = std::shared_ptr<QuestionResultAggregationOverall>;
+using Response = std::shared_ptr<BulkAggregateQuestionResultsResponse>;
+
+std::shared_ptr<BulkAggregateQuestionItem> toItem(const AggregateQuestionResultsOptions& query) {
+    auto item = std::make_shared<BulkAggregateQuestionItem>();
+    if (query.questionId) item->setQuestionId(*query.questionId);
+    if (query.questionIds) item->setQuestionIds(*query.questionIds);
+    if (query.urlId) item->setUrlId(*query.urlId);
+    if (query.timeBucket && *query.timeBucket != nullptr) item->setTimeBucket(*query.timeBucket);
+    if (query.startDate) item->setStartDate(*query.startDate);
+    return item;
+}
+
+// The item's JSON before it gets an aggId: equal for identical aggregations.
+std::string itemKey(const BulkAggregateQuestionItem& item) {
+    JsonWriter writer;
+    item.writeJson(writer);
+    return writer.str();
+}
+
+struct QuestionBatch {
+    struct Entry {
+        std::shared_ptr<BulkAggregateQuestionItem> item;
+        pplx::task_completion_event<Result> result;
+        pplx::task<Result> shared;
+        size_t callers = 0;
+    };
+    bool forceRecalculate = false;
+    std::vector<Entry> entries;
+    std::unordered_map<std::string, size_t> byKey;   // itemKey -> index in entries
+};
+
+} // namespace
+
+struct QuestionResultBatcher::State : detail::Batcher<State, QuestionBatch, Response> {
+    SendBatch send;
+    QuestionBatcherOptions options;
+    uint64_t calls = 0;
+    uint64_t aggregations = 0;
+
+    pplx::task<Response> request(QuestionBatch& batch) {
+        auto request = std::make_shared<BulkAggregateQuestionResultsRequest>();
+        std::vector<std::shared_ptr<BulkAggregateQuestionItem>> items;
+        items.reserve(batch.entries.size());
+        for (size_t i = 0; i < batch.entries.size(); ++i) {
+            batch.entries[i].item->setAggId(utility::conversions::to_string_t(std::to_string(i)));
+            items.push_back(batch.entries[i].item);
+        }
+        request->setAggregations(items);
+        return send(request, batch.forceRecalculate);
+    }
+
+    // Splits the response's data map back out by aggId. Failures count once
+    // per caller sharing the entry.
+    uint64_t settle(QuestionBatch& batch, pplx::task<Response>& call) {
+        uint64_t failed = 0;
+        try {
+            const auto response = call.get();
+            if (response == nullptr) throw std::runtime_error("bulkAggregateQuestionResults returned no response");
+            if (response->statusIsSet() && response->getStatus() != nullptr &&
+                response->getStatus()->getValue() == APIStatus::eAPIStatus::FAILED) {
+                throw ApiException(400, utility::conversions::to_string_t("bulkAggregateQuestionResults failed"));
+            }
+            const auto data = response->getData();
+            for (auto& entry : batch.entries) {
+                auto it = data.find(entry.item->getAggId());
+                if (it == data.end() || it->second == nullptr) {
+                    entry.result.set_exception(
+                        std::runtime_error("bulkAggregateQuestionResults returned no result for this aggregation"));
+                    failed += entry.callers;
+                } else {
+                    entry.result.set(it->second);
+                }
+            }
+        } catch (...) {
+            const auto error = std::current_exception();
+            failed = 0;
+            for (auto& entry : batch.entries) {
+                entry.result.set_exception(error);
+                failed += entry.callers;
+            }
+        }
+        return failed;
+    }
+};
+
+QuestionResultBatcher::QuestionResultBatcher(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+                                             QuestionBatcherOptions options)
+    : QuestionResultBatcher(
+          [api, tenantId](std::shared_ptr<BulkAggregateQuestionResultsRequest> request, bool forceRecalculate) {
+              return api->bulkAggregateQuestionResults(tenantId, std::move(request),
+                                                       forceRecalculate ? boost::optional<bool>(true) : boost::none);
+          },
+          options) {}
+
+QuestionResultBatcher::QuestionResultBatcher(SendBatch send, QuestionBatcherOptions options)
+    : state_(std::make_shared<State>()) {
+    if (options.maxCount == 0) options.maxCount = 1;
+    if (options.maxInFlight == 0) options.maxInFlight = 1;
+    state_->maxDelay = options.maxDelay;
+    state_->maxInFlight = options.maxInFlight;
+    state_->send = std::move(send);
+    state_->options = std::move(options);
+}
+
+QuestionResultBatcher::~QuestionResultBatcher() {
+    state_->stop();
+}
+
+pplx::task<std::shared_ptr<QuestionResultAggregationOverall>> QuestionResultBatcher::aggregate(
+    const AggregateQuestionResultsOptions& query) {
+    auto item = toItem(query);
+    std::string key = itemKey(*item);
+    const bool force = query.forceRecalculate.value_or(false);
+
+    pplx::task<Result> result;
+    bool sealed = false;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        ++state_->calls;
+        auto* open = &state_->open;
+        if (!open->entries.empty() && open->forceRecalculate != force) {
+            state_->seal();
+            sealed = true;
+        }
+        auto existing = open->byKey.find(key);
+        if (existing != open->byKey.end()) {
+            QuestionBatch::Entry& entry = open->entries[existing->second];
+            ++entry.callers;
+            return entry.shared;
+        }
+        const bool opened = open->entries.empty();
+        if (opened) open->forceRecalculate = force;
+        QuestionBatch::Entry entry;
+        entry.item = std::move(item);
+        entry.shared = pplx::create_task(entry.result);
+        entry.callers = 1;
+        result = entry.shared;
+        open->byKey.emplace(std::move(key), open->entries.size());
+        open->entries.push_back(std::move(entry));
+        if (opened) state_->opened();
+        ++state_->aggregations;
+        if (open->entries.size() >= state_->options.maxCount) {
+            state_->seal();
+            sealed = true;
+        }
+    }
+    if (sealed) state_->dispatch();
+    return result;
+}
+
+pplx::task<void> QuestionResultBatcher::flush() {
+    return state_->flush();
+}
+
+QuestionBatcherStats QuestionResultBatcher::stats() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    QuestionBatcherStats stats;
+    stats.calls = state_->calls;
+    stats.aggregations = state_->aggregations;
+    stats.requests = state_->requests;
+    stats.failed = state_->failed;
+    return stats;
+}
+
+} // namespace batch
+} // namespace fastcomments
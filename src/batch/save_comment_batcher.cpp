@@ -0,0 +1,163 @@
+#include "fastcomments/batch/save_comment_batcher.hpp"
+
+#include "FastCommentsClient/ApiException.h"
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/model/APIStatus.h"
+#include "FastCommentsClient/model/CreateCommentParams.h"
+#include "FastCommentsClient/model/SaveCommentsBulkResponse.h"
+#include "internal/batcher.hpp"
+
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace fastcomments {
+namespace batch {
+
+using org::openapitools::client::api::ApiException;
+using org::openapitools::client::model::APIStatus;
+using org::openapitools::client::model::JsonWriter;
+
+namespace {
+
+using Result = std::shared_ptr<SaveCommentsBulkResponse>;
+
+size_t serializedSize(const CreateCommentParams& comment) {
+    JsonWriter writer;
+    comment.writeJson(writer);
+    return writer.str().size() + 1;   // the separating comma
+}
+
+bool rejected(const SaveCommentsBulkResponse& response) {
+    return response.statusIsSet() && response.getStatus() != nullptr &&
+           response.getStatus()->getValue() == APIStatus::eAPIStatus::FAILED;
+}
+
+std::exception_ptr rejectionError(const SaveCommentsBulkResponse& response) {
+    utility::string_t message = response.getCode();
+    if (response.reasonIsSet()) {
+        if (!message.empty()) message += utility::conversions::to_string_t(": ");
+        message += response.getReason();
+    }
+    if (message.empty()) message = utility::conversions::to_string_t("comment was rejected");
+    return std::make_exception_ptr(ApiException(400, message));
+}
+
+struct SaveBatch {
+    struct Entry {
+        std::shared_ptr<CreateCommentParams> comment;
+        pplx::task_completion_event<Result> result;
+    };
+    std::vector<Entry> entries;
+    size_t bytes = 0;
+};
+
+} // namespace
+
+struct SaveCommentBatcher::State : detail::Batcher<State, SaveBatch, std::vector<Result>> {
+    SendBatch send;
+    SaveBatcherOptions options;
+    uint64_t comments = 0;
+
+    pplx::task<std::vector<Result>> request(SaveBatch& batch) {
+        std::vector<std::shared_ptr<CreateCommentParams>> params;
+        params.reserve(batch.entries.size());
+        for (const auto& entry : batch.entries) params.push_back(entry.comment);
+        return send(std::move(params));
+    }
+
+    // The bulk response is matched to the batch by position.
+    uint64_t settle(SaveBatch& batch, pplx::task<std::vector<Result>>& response) {
+        uint64_t failed = 0;
+        try {
+            const std::vector<Result> results = response.get();
+            for (size_t i = 0; i < batch.entries.size(); ++i) {
+                const Result result = i < results.size() ? results[i] : nullptr;
+                if (result == nullptr) {
+                    batch.entries[i].result.set_exception(
+                        std::runtime_error("saveCommentsBulk returned no result for this comment"));
+                    ++failed;
+                } else if (rejected(*result)) {
+                    batch.entries[i].result.set_exception(rejectionError(*result));
+                    ++failed;
+                } else {
+                    batch.entries[i].result.set(result);
+                }
+            }
+        } catch (...) {
+            const auto error = std::current_exception();
+            for (auto& entry : batch.entries) entry.result.set_exception(error);
+            failed = batch.entries.size();
+        }
+        return failed;
+    }
+};
+
+SaveCommentBatcher::SaveCommentBatcher(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+                                       SaveBatcherOptions options)
+    : SaveCommentBatcher(
+          [api, tenantId, bulkOptions = options.bulkOptions](std::vector<std::shared_ptr<CreateCommentParams>> batch) {
+              return api->saveCommentsBulk(tenantId, std::move(batch), bulkOptions);
+          },
+          options) {}
+
+SaveCommentBatcher::SaveCommentBatcher(SendBatch send, SaveBatcherOptions options)
+    : state_(std::make_shared<State>()) {
+    if (options.maxCount == 0) options.maxCount = 1;
+    if (options.maxInFlight == 0) options.maxInFlight = 1;
+    state_->maxDelay = options.maxDelay;
+    state_->maxInFlight = options.maxInFlight;
+    state_->send = std::move(send);
+    state_->options = std::move(options);
+}
+
+SaveCommentBatcher::~SaveCommentBatcher() {
+    state_->stop();
+}
+
+pplx::task<std::shared_ptr<SaveCommentsBulkResponse>> SaveCommentBatcher::save(std::shared_ptr<CreateCommentParams> comment) {
+    if (comment == nullptr) throw std::invalid_argument("SaveCommentBatcher::save: comment is null");
+    const size_t bytes = serializedSize(*comment);
+    SaveBatch::Entry entry;
+    entry.comment = std::move(comment);
+    auto result = pplx::create_task(entry.result);
+
+    bool sealed = false;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        auto& open = state_->open;
+        // Start a new batch rather than push this one past maxBytes.
+        if (!open.entries.empty() && open.bytes + bytes > state_->options.maxBytes) {
+            state_->seal();
+            sealed = true;
+        }
+        const bool opened = open.entries.empty();
+        open.entries.push_back(std::move(entry));
+        open.bytes += bytes;
+        if (opened) state_->opened();
+        ++state_->comments;
+        if (open.entries.size() >= state_->options.maxCount || open.bytes >= state_->options.maxBytes) {
+            state_->seal();
+            sealed = true;
+        }
+    }
+    if (sealed) state_->dispatch();
+    return result;
+}
+
+pplx::task<void> SaveCommentBatcher::flush() {
+    return state_->flush();
+}
+
+SaveBatcherStats SaveCommentBatcher::stats() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    SaveBatcherStats stats;
+    stats.comments = state_->comments;
+    stats.requests = state_->requests;
+    stats.failed = state_->failed;
+    return stats;
+}
+
+} // namespace batch
+} // namespace fastcomments
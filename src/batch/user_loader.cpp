@@ -0,0 +1,336 @@
+#include "fastcomments/batch/user_loader.hpp"
+
+#include "FastCommentsClient/api/DefaultApi.h"
+#include "FastCommentsClient/api/PublicApi.h"
+#include "FastCommentsClient/model/GetUserResponse.h"
+#include "FastCommentsClient/model/PageUserEntry.h"
+#include "FastCommentsClient/model/PageUsersInfoResponse.h"
+#include "FastCommentsClient/model/User.h"
+#include "internal/timer.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace fastcomments {
+namespace batch {
+
+namespace {
+
+using Clock = detail::Timer::Clock;
+
+// The queue and memo for one kind of load.
+template <typename Value>
+struct Channel {
+    using Result = std::shared_ptr<Value>;
+
+    struct Pending {
+        utility::string_t userId;
+        pplx::task_completion_event<Result> result;
+    };
+
+    std::vector<Pending> queue;
+    Clock::time_point openedAt;
+    // Queued, in flight and, with memoize, settled loads.
+    std::unordered_map<utility::string_t, pplx::task<Result>> memo;
+
+    // Caller holds the state's mutex.
+    pplx::task<Result> load(const utility::string_t& userId, bool& opened, bool& shared) {
+        auto it = memo.find(userId);
+        if (it != memo.end()) {
+            shared = true;
+            return it->second;
+        }
+        Pending pending{userId, {}};
+        auto result = pplx::create_task(pending.result);
+        memo.emplace(userId, result);
+        if (queue.empty()) {
+            openedAt = Clock::now();
+            opened = true;
+        }
+        queue.push_back(std::move(pending));
+        return result;
+    }
+
+    // Caller holds the state's mutex. Failed loads are forgotten so the next
+    // load retries; successful ones are kept only when memoizing.
+    void settle(const std::vector<Pending>& done, bool failed, bool memoize) {
+        if (!failed && memoize) return;
+        for (const auto& pending : done) memo.erase(pending.userId);
+    }
+};
+
+} // namespace
+
+UserLoaderBackend userLoaderBackend(std::shared_ptr<const PublicApi> publicApi,
+                                    std::shared_ptr<const DefaultApi> defaultApi, utility::string_t tenantId) {
+    namespace model = org::openapitools::client::model;
+    UserLoaderBackend backend;
+    if (publicApi != nullptr) {
+        backend.usersInfo = [publicApi, tenantId](const std::vector<utility::string_t>& userIds) {
+            utility::string_t ids;
+            for (const auto& userId : userIds) {
+                if (!ids.empty()) ids += _XPLATSTR(",");
+                ids += userId;
+            }
+            return publicApi->getUsersInfo(tenantId, ids).then([](std::shared_ptr<model::PageUsersInfoResponse> response) {
+                return response != nullptr ? response->getUsers() : std::vector<std::shared_ptr<PageUserEntry>>();
+            });
+        };
+    }
+    if (defaultApi != nullptr) {
+        backend.user = [defaultApi, tenantId](const utility::string_t& userId) {
+            return defaultApi->getUser(tenantId, userId).then([](std::shared_ptr<model::GetUserResponse> response) {
+                return response != nullptr ? response->getUser() : std::shared_ptr<User>();
+            });
+        };
+    }
+    return backend;
+}
+
+struct UserLoader::State : std::enable_shared_from_this<State> {
+    using InfoChannel = Channel<PageUserEntry>;
+    using UserChannel = Channel<User>;
+
+    // One getUsersInfo request, or the getUser calls of one dispatch.
+    struct Work {
+        uint64_t id = 0;
+        std::vector<InfoChannel::Pending> info;
+        std::vector<UserChannel::Pending> users;
+        pplx::task_completion_event<void> done;
+    };
+
+    UserLoaderBackend backend;
+    UserLoaderOptions options;
+
+    mutable std::mutex mu;
+    InfoChannel info;
+    UserChannel users;
+    std::map<uint64_t, pplx::task<void>> unfinished;
+    uint64_t nextId = 0;
+    UserLoaderStats stats;
+
+    // Caller holds mu.
+    Work track() {
+        Work work;
+        work.id = nextId++;
+        unfinished.emplace(work.id, pplx::create_task(work.done));
+        return work;
+    }
+
+    // Caller holds mu. Full getUsersInfo batches only, unless `all`.
+    void take(std::vector<Work>& out, bool all) {
+        while (info.queue.size() >= options.maxIdsPerRequest || (all && !info.queue.empty())) {
+            Work work = track();
+            const size_t n = std::min(info.queue.size(), options.maxIdsPerRequest);
+            work.info.assign(std::make_move_iterator(info.queue.begin()), std::make_move_iterator(info.queue.begin() + n));
+            info.queue.erase(info.queue.begin(), info.queue.begin() + n);
+            if (!info.queue.empty()) {
+                info.openedAt = Clock::now();
+                arm(info.openedAt);
+            }
+            ++stats.infoRequests;
+            out.push_back(std::move(work));
+        }
+        if (all && !users.queue.empty()) {
+            Work work = track();
+            work.users = std::move(users.queue);
+            users.queue.clear();
+            stats.userRequests += work.users.size();
+            out.push_back(std::move(work));
+        }
+    }
+
+    void finish(const Work& work) {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            unfinished.erase(work.id);
+        }
+        work.done.set();
+    }
+
+    void run(Work work) {
+        auto self = shared_from_this();
+        auto shared = std::make_shared<Work>(std::move(work));
+        if (!shared->info.empty()) {
+            std::vector<utility::string_t> userIds;
+            userIds.reserve(shared->info.size());
+            for (const auto& pending : shared->info) userIds.push_back(pending.userId);
+            pplx::task<std::vector<InfoChannel::Result>> call;
+            try {
+                if (!backend.usersInfo) throw std::logic_error("UserLoader: no getUsersInfo backend");
+                call = backend.usersInfo(userIds);
+            } catch (...) {
+                call = pplx::task_from_exception<std::vector<InfoChannel::Result>>(std::current_exception());
+            }
+            call.then([self, shared](pplx::task<std::vector<InfoChannel::Result>> t) {
+                std::exception_ptr error;
+                std::unordered_map<utility::string_t, InfoChannel::Result> byId;
+                try {
+                    for (auto& entry : t.get()) {
+                        if (entry != nullptr) byId.emplace(entry->getId(), entry);
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(self->mu);
+                    self->info.settle(shared->info, error != nullptr, self->options.memoize);
+                }
+                for (auto& pending : shared->info) {
+                    if (error) {
+                        pending.result.set_exception(error);
+                    } else {
+                        auto it = byId.find(pending.userId);
+                        pending.result.set(it != byId.end() ? it->second : nullptr);
+                    }
+                }
+                self->finish(*shared);
+            });
+            return;
+        }
+
+        std::vector<pplx::task<void>> calls;
+        calls.reserve(shared->users.size());
+        for (auto& pending : shared->users) {
+            pplx::task<UserChannel::Result> call;
+            try {
+                if (!backend.user) throw std::logic_error("UserLoader: no getUser backend");
+                call = backend.user(pending.userId);
+            } catch (...) {
+                call = pplx::task_from_exception<UserChannel::Result>(std::current_exception());
+            }
+            calls.push_back(call.then([self, pending](pplx::task<UserChannel::Result> t) {
+                try {
+                    auto user = t.get();
+                    {
+                        std::lock_guard<std::mutex> lock(self->mu);
+                        self->users.settle({pending}, false, self->options.memoize);
+                    }
+                    pending.result.set(user);
+                } catch (...) {
+                    {
+                        std::lock_guard<std::mutex> lock(self->mu);
+                        self->users.settle({pending}, true, self->options.memoize);
+                    }
+                    pending.result.set_exception(std::current_exception());
+                }
+            }));
+        }
+        pplx::when_all(calls.begin(), calls.end()).then([self, shared](pplx::task<void>) { self->finish(*shared); });
+    }
+
+    // Caller holds mu. Sends what is queued once a queue opened at openedAt
+    // has waited batchWindow.
+    void arm(Clock::time_point openedAt) {
+        std::weak_ptr<State> weak = weak_from_this();
+        detail::Timer::shared().schedule(openedAt + options.batchWindow, [weak]() {
+            auto self = weak.lock();
+            if (self == nullptr) return;
+            std::vector<Work> work;
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                const auto now = Clock::now();
+                const bool due = (!self->info.queue.empty() && self->info.openedAt + self->options.batchWindow <= now) ||
+                                 (!self->users.queue.empty() && self->users.openedAt + self->options.batchWindow <= now);
+                // Otherwise what this was armed for already went out.
+                if (due) self->take(work, true);
+            }
+            for (auto& w : work) self->run(std::move(w));
+        });
+    }
+};
+
+UserLoader::UserLoader(std::shared_ptr<const PublicApi> publicApi, std::shared_ptr<const DefaultApi> defaultApi,
+                       utility::string_t tenantId, UserLoaderOptions options)
+    : UserLoader(userLoaderBackend(std::move(publicApi), std::move(defaultApi), std::move(tenantId)), std::move(options)) {}
+
+UserLoader::UserLoader(UserLoaderBackend backend, UserLoaderOptions options) : state_(std::make_shared<State>()) {
+    if (options.maxIdsPerRequest == 0) options.maxIdsPerRequest = 1;
+    state_->backend = std::move(backend);
+    state_->options = std::move(options);
+}
+
+UserLoader::~UserLoader() {
+    std::vector<State::Work> work;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        state_->take(work, true);
+    }
+    for (auto& w : work) state_->run(std::move(w));
+}
+
+pplx::task<std::shared_ptr<PageUserEntry>> UserLoader::loadInfo(const utility::string_t& userId) {
+    pplx::task<std::shared_ptr<PageUserEntry>> result;
+    std::vector<State::Work> work;
+    bool opened = false;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        bool shared = false;
+        result = state_->info.load(userId, opened, shared);
+        if (opened) state_->arm(state_->info.openedAt);
+        ++state_->stats.loads;
+        if (shared) ++state_->stats.shared;
+        state_->take(work, false);
+    }
+    for (auto& w : work) state_->run(std::move(w));
+    return result;
+}
+
+pplx::task<std::vector<std::shared_ptr<PageUserEntry>>> UserLoader::loadInfos(const std::vector<utility::string_t>& userIds) {
+    std::vector<pplx::task<std::shared_ptr<PageUserEntry>>> loads;
+    loads.reserve(userIds.size());
+    for (const auto& userId : userIds) loads.push_back(loadInfo(userId));
+    if (loads.empty()) return pplx::task_from_result(std::vector<std::shared_ptr<PageUserEntry>>());
+    return pplx::when_all(loads.begin(), loads.end());
+}
+
+pplx::task<std::shared_ptr<User>> UserLoader::loadUser(const utility::string_t& userId) {
+    pplx::task<std::shared_ptr<User>> result;
+    bool opened = false;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        bool shared = false;
+        result = state_->users.load(userId, opened, shared);
+        if (opened) state_->arm(state_->users.openedAt);
+        ++state_->stats.loads;
+        if (shared) ++state_->stats.shared;
+    }
+    return result;
+}
+
+pplx::task<void> UserLoader::dispatch() {
+    std::vector<State::Work> work;
+    std::vector<pplx::task<void>> pending;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        state_->take(work, true);
+        pending.reserve(state_->unfinished.size());
+        for (const auto& w : state_->unfinished) pending.push_back(w.second);
+    }
+    for (auto& w : work) state_->run(std::move(w));
+    if (pending.empty()) return pplx::task_from_result();
+    return pplx::when_all(pending.begin(), pending.end());
+}
+
+void UserLoader::clear() {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    // Loads still queued or in flight stay; callers are waiting on them.
+    for (auto it = state_->info.memo.begin(); it != state_->info.memo.end();) {
+        it = it->second.is_done() ? state_->info.memo.erase(it) : std::next(it);
+    }
+    for (auto it = state_->users.memo.begin(); it != state_->users.memo.end();) {
+        it = it->second.is_done() ? state_->users.memo.erase(it) : std::next(it);
+    }
+}
+
+UserLoaderStats UserLoader::stats() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    return state_->stats;
+}
+
+} // namespace batch
+} // namespace fastcomments
@@ -0,0 +1,321 @@
+#include "fastcomments/batch/webhook_drainer.hpp"
+
+#include "fastcomments/paging/skip_fan_out.hpp"
+
+#include "FastCommentsClient/model/APIEmptyResponse.h"
+#include "FastCommentsClient/model/GetPendingWebhookEventCountResponse.h"
+#include "FastCommentsClient/model/GetPendingWebhookEventsResponse.h"
+#include "FastCommentsClient/model/PendingCommentToSyncOutbound.h"
+#include "internal/util.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace fastcomments {
+namespace batch {
+
+namespace {
+
+using detail::toEpochMs;
+using detail::describe;
+
+using Clock = std::chrono::steady_clock;
+using Event = std::shared_ptr<PendingCommentToSyncOutbound>;
+
+// One drain(): the listing rounds, the handler queue and the delete queue.
+struct Drain : std::enable_shared_from_this<Drain> {
+    WebhookBackend backend;
+    WebhookHandler handler;
+    DrainOptions options;
+    Clock::time_point startedAt = Clock::now();
+
+    std::mutex mu;
+    std::deque<Event> queue;                               // listed, waiting for a worker
+    size_t working = 0;
+    std::deque<utility::string_t> acks;                    // handled, waiting to be deleted
+    size_t acksInFlight = 0;
+    std::unordered_set<utility::string_t> taken;           // handed to the handler this drain
+    std::unordered_set<utility::string_t> deleted;
+    std::unordered_map<utility::string_t, int> ackAttempts;
+    std::unordered_set<utility::string_t> unacked;         // handled, delete failed, retry left
+    bool listing = false;
+    std::exception_ptr listError;
+    uint64_t newThisRound = 0;
+    DrainReport report;
+    pplx::task_completion_event<DrainReport> done;
+
+    // Serializes onProgress.
+    std::mutex progressMu;
+
+    void startRound() {
+        auto self = shared_from_this();
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            listing = true;
+            newThisRound = 0;
+            ++report.metrics.rounds;
+        }
+        pplx::task<int64_t> count;
+        try {
+            count = backend.count ? backend.count() : pplx::task_from_result<int64_t>(-1);
+        } catch (...) {
+            count = pplx::task_from_exception<int64_t>(std::current_exception());
+        }
+        count.then([self](pplx::task<int64_t> t) {
+            int64_t pending = -1;
+            try {
+                pending = t.get();
+            } catch (...) {
+                // Only a gauge; listing works without it.
+            }
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                self->report.metrics.pending = pending;
+                if (self->report.metrics.rounds == 1) self->report.metrics.pendingAtStart = pending;
+            }
+            self->progress();
+
+            paging::FanOutOptions fanOut;
+            fanOut.parallelism = self->options.fetchParallelism;
+            if (pending >= 0) fanOut.total = [pending]() { return pplx::task_from_result(pending); };
+            paging::SkipFanOut<Event> scan(self->backend.fetch, fanOut);
+            return scan.run([self](std::vector<Event>& page) { self->listed(page); });
+        }).then([self](pplx::task<paging::FanOutStats> t) {
+            std::exception_ptr error;
+            try {
+                t.get();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(self->mu);
+            self->listing = false;
+            if (error != nullptr && self->listError == nullptr) self->listError = error;
+            self->maybeEndRound();
+        });
+    }
+
+    void listed(std::vector<Event>& page) {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            for (auto& event : page) {
+                if (event == nullptr) continue;
+                ++report.metrics.fetched;
+                const utility::string_t id = event->getId();
+                if (deleted.count(id) > 0) continue;   // listing lags the delete
+                if (unacked.erase(id) > 0) {
+                    acks.push_back(id);
+                    ++newThisRound;
+                    continue;
+                }
+                if (!taken.insert(id).second) continue;
+                queue.push_back(std::move(event));
+                ++newThisRound;
+            }
+        }
+        pump();
+    }
+
+    // Starts handlers and deletes while there is room.
+    void pump() {
+        std::vector<Event> starting;
+        std::vector<utility::string_t> deleting;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            while (working < options.workers && !queue.empty()) {
+                starting.push_back(std::move(queue.front()));
+                queue.pop_front();
+                ++working;
+            }
+            while (acksInFlight < options.maxAcksInFlight && !acks.empty()) {
+                deleting.push_back(std::move(acks.front()));
+                acks.pop_front();
+                ++acksInFlight;
+            }
+        }
+        for (auto& event : starting) handle(std::move(event));
+        for (auto& id : deleting) ack(std::move(id));
+    }
+
+    void handle(Event event) {
+        auto self = shared_from_this();
+        pplx::task<void> call;
+        try {
+            call = handler(event);
+        } catch (...) {
+            call = pplx::task_from_exception<void>(std::current_exception());
+        }
+        call.then([self, event](pplx::task<void> t) {
+            std::exception_ptr error;
+            try {
+                t.get();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                --self->working;
+                auto& metrics = self->report.metrics;
+                if (error != nullptr) {
+                    ++metrics.failed;
+                    self->report.failures.push_back({event->getId(), describe(error), false});
+                } else {
+                    ++metrics.handled;
+                    const int64_t createdAt = toEpochMs(event->getCreatedAt());
+                    if (createdAt > 0) {
+                        metrics.maxLagMs = std::max(metrics.maxLagMs, toEpochMs(utility::datetime::utc_now()) - createdAt);
+                    }
+                    self->acks.push_back(event->getId());
+                }
+            }
+            self->progress();
+            self->pump();
+            self->settle();
+        });
+    }
+
+    void ack(utility::string_t id) {
+        auto self = shared_from_this();
+        pplx::task<void> call;
+        try {
+            call = backend.remove(id);
+        } catch (...) {
+            call = pplx::task_from_exception<void>(std::current_exception());
+        }
+        call.then([self, id](pplx::task<void> t) {
+            std::exception_ptr error;
+            try {
+                t.get();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                --self->acksInFlight;
+                if (error == nullptr) {
+                    ++self->report.metrics.acked;
+                    self->deleted.insert(id);
+                } else {
+                    ++self->report.metrics.ackFailures;
+                    if (++self->ackAttempts[id] < self->options.maxAckAttempts) {
+                        self->unacked.insert(id);
+                    } else {
+                        self->report.failures.push_back({id, describe(error), true});
+                    }
+                }
+            }
+            self->pump();
+            self->settle();
+        });
+    }
+
+    void settle() {
+        std::lock_guard<std::mutex> lock(mu);
+        maybeEndRound();
+    }
+
+    // Caller holds mu. Once the listing and all the work it produced are
+    // finished, lists again or completes the drain.
+    void maybeEndRound() {
+        if (listing || working > 0 || acksInFlight > 0 || !queue.empty() || !acks.empty()) return;
+        const bool again = listError == nullptr && newThisRound > 0 && report.metrics.rounds < options.maxRounds;
+        if (again) {
+            listing = true;   // claimed; startRound() runs without the lock
+            auto self = shared_from_this();
+            pplx::create_task([self]() { self->startRound(); });
+            return;
+        }
+        // Deletes that failed and were never listed again.
+        for (const auto& id : unacked) report.failures.push_back({id, "delete failed", true});
+        unacked.clear();
+        if (listError != nullptr) {
+            done.set_exception(listError);
+            return;
+        }
+        updateRates();
+        done.set(report);
+    }
+
+    // Caller holds mu.
+    void updateRates() {
+        auto& metrics = report.metrics;
+        metrics.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startedAt);
+        const double seconds = std::max<int64_t>(metrics.elapsed.count(), 1) / 1000.0;
+        metrics.eventsPerSecond = static_cast<double>(metrics.handled) / seconds;
+    }
+
+    void progress() {
+        if (!options.onProgress) return;
+        std::lock_guard<std::mutex> progressLock(progressMu);
+        DrainMetrics snapshot;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            updateRates();
+            snapshot = report.metrics;
+        }
+        options.onProgress(snapshot);
+    }
+};
+
+} // namespace
+
+WebhookBackend pendingWebhookBackend(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId,
+                                     GetPendingWebhookEventsOptions filter) {
+    namespace client = org::openapitools::client;
+    WebhookBackend backend;
+    backend.fetch = [api, tenantId, filter](int64_t skip) {
+        auto request = filter;
+        request.skip = static_cast<double>(skip);
+        return api->getPendingWebhookEvents(tenantId, request)
+            .then([](std::shared_ptr<client::model::GetPendingWebhookEventsResponse> response) {
+                return response != nullptr ? response->getPendingWebhookEvents() : std::vector<Event>();
+            });
+    };
+    backend.count = [api, tenantId, filter]() {
+        client::api::GetPendingWebhookEventCountOptions options;
+        options.commentId = filter.commentId;
+        options.externalId = filter.externalId;
+        options.eventType = filter.eventType;
+        options.type = filter.type;
+        options.domain = filter.domain;
+        options.attemptCountGT = filter.attemptCountGT;
+        return api->getPendingWebhookEventCount(tenantId, options)
+            .then([](std::shared_ptr<client::model::GetPendingWebhookEventCountResponse> response) {
+                return response != nullptr ? static_cast<int64_t>(response->getCount()) : int64_t(-1);
+            });
+    };
+    backend.remove = [api, tenantId](const utility::string_t& eventId) {
+        return api->deletePendingWebhookEvent(tenantId, eventId)
+            .then([](std::shared_ptr<client::model::APIEmptyResponse>) {});
+    };
+    return backend;
+}
+
+WebhookDrainer::WebhookDrainer(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, WebhookHandler handler,
+                               GetPendingWebhookEventsOptions filter, DrainOptions options)
+    : WebhookDrainer(pendingWebhookBackend(std::move(api), std::move(tenantId), std::move(filter)), std::move(handler),
+                     std::move(options)) {}
+
+WebhookDrainer::WebhookDrainer(WebhookBackend backend, WebhookHandler handler, DrainOptions options)
+    : backend_(std::move(backend)), handler_(std::move(handler)), options_(std::move(options)) {
+    if (options_.fetchParallelism == 0) options_.fetchParallelism = 1;
+    if (options_.workers == 0) options_.workers = 1;
+    if (options_.maxAcksInFlight == 0) options_.maxAcksInFlight = 1;
+    if (options_.maxAckAttempts < 1) options_.maxAckAttempts = 1;
+    if (options_.maxRounds == 0) options_.maxRounds = 1;
+}
+
+pplx::task<DrainReport> WebhookDrainer::drain() const {
+    auto drain = std::make_shared<Drain>();
+    drain->backend = backend_;
+    drain->handler = handler_;
+    drain->options = options_;
+    drain->startRound();
+    return pplx::create_task(drain->done);
+}
+
+} // namespace batch
+} // namespace fastcomments
@@ -0,0 +1,152 @@
+#ifndef FASTCOMMENTS_INTERNAL_BATCHER_HPP
+#define FASTCOMMENTS_INTERNAL_BATCHER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <pplx/pplxtasks.h>
+
+#include "internal/timer.hpp"
+
+namespace fastcomments {
+namespace detail {
+
+// The queueing behind the bulk-request batchers: callers add entries to the
+// open batch, which is sealed when the owner says it is full or maxDelay after
+// it opened, and sealed batches are sent with at most maxInFlight requests out
+// at once.
+//
+// Owner derives from it and supplies
+//   pplx::task<Response> request(Batch& batch);   // may throw
+//   uint64_t settle(Batch& batch, pplx::task<Response>& response);
+// where settle resolves the entries' futures and returns how many failed.
+// Batch needs an `entries` vector. Call stop() from the owning object's
+// destructor. The maxDelay deadlines run on the shared Timer.
+template <typename Owner, typename Batch, typename Response>
+struct Batcher : std::enable_shared_from_this<Batcher<Owner, Batch, Response>> {
+    using Clock = Timer::Clock;
+
+    struct Sealed {
+        uint64_t id = 0;
+        Batch batch;
+        pplx::task_completion_event<void> done;
+    };
+
+    std::chrono::milliseconds maxDelay{0};
+    size_t maxInFlight = 1;
+
+    mutable std::mutex mu;
+    Batch open;
+    uint64_t openings = 0;   // tells a stale deadline from the open batch's
+    std::deque<Sealed> ready;
+    std::map<uint64_t, pplx::task<void>> unfinished;
+    uint64_t nextId = 0;
+    size_t inFlight = 0;
+    uint64_t requests = 0;
+    uint64_t failed = 0;
+
+    // Sends whatever is queued; batches in flight still complete.
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            seal();
+        }
+        dispatch();
+    }
+
+    // Call after adding the first entry to the open batch. Caller holds mu.
+    void opened() {
+        const uint64_t opening = ++openings;
+        std::weak_ptr<Batcher> weak = this->weak_from_this();
+        Timer::shared().schedule(Clock::now() + maxDelay, [weak, opening]() {
+            auto self = weak.lock();
+            if (self == nullptr) return;
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                // That batch went out early; the open one has its own deadline.
+                if (self->openings != opening) return;
+                self->seal();
+            }
+            self->dispatch();
+        });
+    }
+
+    // Caller holds mu.
+    void seal() {
+        if (open.entries.empty()) return;
+        Sealed sealed;
+        sealed.id = nextId++;
+        sealed.batch = std::move(open);
+        unfinished.emplace(sealed.id, pplx::create_task(sealed.done));
+        ready.push_back(std::move(sealed));
+        open = Batch();
+    }
+
+    // Sends ready batches while there is room in flight. Takes mu itself.
+    void dispatch() {
+        std::vector<Sealed> sending;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            while (!ready.empty() && inFlight < maxInFlight) {
+                sending.push_back(std::move(ready.front()));
+                ready.pop_front();
+                ++inFlight;
+                ++requests;
+            }
+        }
+        for (auto& sealed : sending) send(std::move(sealed));
+    }
+
+    // Seals the open batch and resolves once every batch sealed so far is done.
+    pplx::task<void> flush() {
+        std::vector<pplx::task<void>> pending;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            seal();
+            pending.reserve(unfinished.size());
+            for (const auto& batch : unfinished) pending.push_back(batch.second);
+        }
+        dispatch();
+        if (pending.empty()) return pplx::task_from_result();
+        return pplx::when_all(pending.begin(), pending.end());
+    }
+
+private:
+    Owner& owner() { return static_cast<Owner&>(*this); }
+
+    void send(Sealed sealed) {
+        auto shared = std::make_shared<Sealed>(std::move(sealed));
+        pplx::task<Response> call;
+        try {
+            call = owner().request(shared->batch);
+        } catch (...) {
+            call = pplx::task_from_exception<Response>(std::current_exception());
+        }
+        auto self = this->shared_from_this();
+        call.then([self, shared](pplx::task<Response> t) { self->complete(*shared, t); });
+    }
+
+    void complete(Sealed& sealed, pplx::task<Response>& response) {
+        const uint64_t settled = owner().settle(sealed.batch, response);
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            --inFlight;
+            failed += settled;
+            unfinished.erase(sealed.id);
+        }
+        sealed.done.set();
+        dispatch();
+    }
+};
+
+} // namespace detail
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_INTERNAL_BATCHER_HPP
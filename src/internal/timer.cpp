@@ -0,0 +1,67 @@
+#include "internal/timer.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace fastcomments {
+namespace detail {
+
+Timer& Timer::shared() {
+    static Timer timer;
+    return timer;
+}
+
+Timer::Timer() : thread_([this]() { run(); }) {}
+
+Timer::~Timer() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+void Timer::schedule(Clock::time_point at, std::function<void()> callback) {
+    bool earliest;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        earliest = due_.empty() || at < due_.begin()->first;
+        due_.emplace(at, std::move(callback));
+    }
+    if (earliest) wake_.notify_all();
+}
+
+void Timer::run() {
+    std::unique_lock<std::mutex> lock(mu_);
+    while (!stopping_) {
+        if (due_.empty()) {
+            wake_.wait(lock);
+            continue;
+        }
+        const auto deadline = due_.begin()->first;
+        if (Clock::now() < deadline) {
+            wake_.wait_until(lock, deadline);
+            continue;
+        }
+        std::vector<std::function<void()>> callbacks;
+        const auto now = Clock::now();
+        while (!due_.empty() && due_.begin()->first <= now) {
+            callbacks.push_back(std::move(due_.begin()->second));
+            due_.erase(due_.begin());
+        }
+        lock.unlock();
+        // Off this thread, so a slow callback can't hold up other deadlines.
+        for (auto& callback : callbacks) pplx::create_task(std::move(callback));
+        lock.lock();
+    }
+}
+
+pplx::task<void> delay(std::chrono::milliseconds wait) {
+    pplx::task_completion_event<void> done;
+    Timer::shared().schedule(Timer::Clock::now() + wait, [done]() { done.set(); });
+    return pplx::create_task(done);
+}
+
+} // namespace detail
+} // namespace fastcomments
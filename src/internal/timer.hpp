@@ -0,0 +1,51 @@
+#ifndef FASTCOMMENTS_INTERNAL_TIMER_HPP
+#define FASTCOMMENTS_INTERNAL_TIMER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <pplx/pplxtasks.h>
+
+namespace fastcomments {
+namespace detail {
+
+// One thread for the deadlines of every batcher, loader and presence service
+// in the process, rather than a parked thread per instance. Callbacks run on
+// the task pool once their deadline passes; one that needs its owner should
+// hold a weak_ptr to it, since the owner may be gone by then.
+class Timer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static Timer& shared();
+
+    Timer();
+    // Drops the callbacks still waiting.
+    ~Timer();
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    void schedule(Clock::time_point at, std::function<void()> callback);
+
+private:
+    void run();
+
+    std::mutex mu_;
+    std::condition_variable wake_;
+    std::multimap<Clock::time_point, std::function<void()>> due_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+// Completes after wait, without holding a pool thread in the meantime.
+pplx::task<void> delay(std::chrono::milliseconds wait);
+
+} // namespace detail
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_INTERNAL_TIMER_HPP
@@ -0,0 +1,63 @@
+#ifndef FASTCOMMENTS_INTERNAL_UTIL_HPP
+#define FASTCOMMENTS_INTERNAL_UTIL_HPP
+
+#include <cstdint>
+#include <exception>
+#include <string>
+
+#include <cpprest/asyncrt_utils.h>
+#include <cpprest/details/basic_types.h>
+
+namespace fastcomments {
+namespace detail {
+
+// Ticks of 100ns between 1601-01-01 (utility::datetime's epoch) and 1970-01-01.
+constexpr int64_t kWindowsToUnixEpoch = 116444736000000000LL;
+
+// 0 for an unset datetime.
+inline int64_t toEpochMs(const utility::datetime& dt) {
+    if (!dt.is_initialized()) return 0;
+    return (static_cast<int64_t>(dt.to_interval()) - kWindowsToUnixEpoch) / 10000;
+}
+
+inline utility::datetime fromEpochMs(int64_t ms) {
+    return utility::datetime() + static_cast<utility::datetime::interval_type>(ms * 10000 + kWindowsToUnixEpoch);
+}
+
+inline std::string toUtf8(const utility::string_t& s) {
+    return utility::conversions::to_utf8string(s);
+}
+
+// 64-bit FNV-1a.
+inline uint64_t fnv1a(const std::string& s) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : s) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// The message of an exception, for reports and logs.
+inline std::string describe(std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const std::exception& e) {
+        return e.what();
+    } catch (...) {
+        return "unknown error";
+    }
+}
+
+// Identifies a comment thread: tenantId and urlId, '\0'-separated.
+inline std::string threadKey(const utility::string_t& tenantId, const utility::string_t& urlId) {
+    std::string key = toUtf8(tenantId);
+    key.push_back('\0');
+    key += toUtf8(urlId);
+    return key;
+}
+
+} // namespace detail
+} // namespace fastcomments
+
+#endif // FASTCOMMENTS_INTERNAL_UTIL_HPP
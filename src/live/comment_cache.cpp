@@ -0,0 +1,476 @@
+#include "fastcomments/live/comment_cache.hpp"
+
+#include "FastCommentsClient/model/GetCommentsResponseWithPresence_PublicComment_.h"
+#include "FastCommentsClient/model/LiveEvent.h"
+#include "FastCommentsClient/model/PubSubComment.h"
+#include "FastCommentsClient/model/PubSubVote.h"
+#include "FastCommentsClient/model/PublicComment.h"
+#include "FastCommentsClient/model/SortDirections.h"
+#include "internal/util.hpp"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace fastcomments {
+namespace live {
+
+using org::openapitools::client::model::PubSubComment;
+using org::openapitools::client::model::PublicComment;
+using org::openapitools::client::model::SortDirections;
+
+namespace {
+
+using detail::fnv1a;
+using detail::threadKey;
+
+using Shared = std::shared_ptr<const CommentsResponse>;
+using Comments = std::vector<std::shared_ptr<PublicComment>>;
+
+// Appends "name=value;" for an option that is set. Strings are
+// length-prefixed so no value can run into the next.
+void field(std::string& key, const char* name, const boost::optional<int32_t>& value) {
+    if (value) key += std::string(name) + "=" + std::to_string(*value) + ";";
+}
+
+void field(std::string& key, const char* name, const boost::optional<bool>& value) {
+    if (value) key += std::string(name) + "=" + (*value ? "1" : "0") + ";";
+}
+
+void field(std::string& key, const char* name, const boost::optional<utility::string_t>& value) {
+    if (!value) return;
+    const std::string utf8 = utility::conversions::to_utf8string(*value);
+    key += std::string(name) + "=" + std::to_string(utf8.size()) + ":" + utf8 + ";";
+}
+
+void field(std::string& key, const char* name, const boost::optional<std::vector<utility::string_t>>& value) {
+    if (!value) return;
+    key += std::string(name) + "=[";
+    for (const auto& item : *value) {
+        const std::string utf8 = utility::conversions::to_utf8string(item);
+        key += std::to_string(utf8.size()) + ":" + utf8 + ",";
+    }
+    key += "];";
+}
+
+void field(std::string& key, const char* name, const boost::optional<std::shared_ptr<SortDirections>>& value) {
+    if (value && *value != nullptr) key += std::string(name) + "=" + std::to_string(static_cast<int>((*value)->getValue())) + ";";
+}
+
+bool byVotes(const GetCommentsPublicOptions& options) {
+    return options.direction && *options.direction != nullptr &&
+           (*options.direction)->getValue() == SortDirections::eSortDirections::MR;
+}
+
+std::shared_ptr<PublicComment> findComment(const Comments& comments, const utility::string_t& commentId) {
+    for (const auto& comment : comments) {
+        if (comment == nullptr) continue;
+        if (comment->getId() == commentId) return comment;
+        if (auto found = findComment(comment->getChildren(), commentId)) return found;
+    }
+    return nullptr;
+}
+
+// Replaces the comment, at any depth, with a patched copy, copying the
+// parents on the way down so nothing handed out before changes.
+bool patchComment(Comments& comments, const utility::string_t& commentId, const std::function<void(PublicComment&)>& patch) {
+    for (auto& comment : comments) {
+        if (comment == nullptr) continue;
+        if (comment->getId() == commentId) {
+            comment = std::make_shared<PublicComment>(*comment);
+            patch(*comment);
+            return true;
+        }
+        auto children = comment->getChildren();
+        if (!children.empty() && patchComment(children, commentId, patch)) {
+            comment = std::make_shared<PublicComment>(*comment);
+            comment->setChildren(children);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether the update can change which comments a response lists, or where.
+bool movesComment(const PublicComment& cached, const PubSubComment& update) {
+    return (update.approvedIsSet() && update.isApproved() != cached.isApproved()) ||
+           (update.isSpamIsSet() && update.isIsSpam() != cached.isIsSpam()) ||
+           (update.isDeletedIsSet() && update.isIsDeleted() != cached.isIsDeleted()) ||
+           (update.isPinnedIsSet() && update.isIsPinned() != cached.isIsPinned()) ||
+           (update.parentIdIsSet() && update.getParentId() != cached.getParentId()) ||
+           (update.hiddenIsSet() && update.isHidden());
+}
+
+void patchFields(PublicComment& comment, const PubSubComment& update) {
+    if (update.commentHTMLIsSet()) comment.setCommentHTML(update.getCommentHTML());
+    if (update.commenterNameIsSet()) comment.setCommenterName(update.getCommenterName());
+    if (update.commenterLinkIsSet()) comment.setCommenterLink(update.getCommenterLink());
+    if (update.avatarSrcIsSet()) comment.setAvatarSrc(update.getAvatarSrc());
+    if (update.displayLabelIsSet()) comment.setDisplayLabel(update.getDisplayLabel());
+    if (update.hasImagesIsSet()) comment.setHasImages(update.isHasImages());
+    if (update.isLockedIsSet()) comment.setIsLocked(update.isIsLocked());
+    if (update.votesIsSet()) comment.setVotes(update.getVotes());
+    if (update.votesUpIsSet()) comment.setVotesUp(update.getVotesUp());
+    if (update.votesDownIsSet()) comment.setVotesDown(update.getVotesDown());
+}
+
+// Every option that is set, in a fixed order.
+std::string canonicalOptions(const GetCommentsPublicOptions& options) {
+    std::string key;
+    field(key, "page", options.page);
+    field(key, "direction", options.direction);
+    field(key, "sso", options.sso);
+    field(key, "skip", options.skip);
+    field(key, "skipChildren", options.skipChildren);
+    field(key, "limit", options.limit);
+    field(key, "limitChildren", options.limitChildren);
+    field(key, "countChildren", options.countChildren);
+    field(key, "fetchPageForCommentId", options.fetchPageForCommentId);
+    field(key, "includeConfig", options.includeConfig);
+    field(key, "countAll", options.countAll);
+    field(key, "includei10n", options.includei10n);
+    field(key, "locale", options.locale);
+    field(key, "modules", options.modules);
+    field(key, "isCrawler", options.isCrawler);
+    field(key, "includeNotificationCount", options.includeNotificationCount);
+    field(key, "asTree", options.asTree);
+    field(key, "maxTreeDepth", options.maxTreeDepth);
+    field(key, "useFullTranslationIds", options.useFullTranslationIds);
+    field(key, "parentId", options.parentId);
+    field(key, "searchText", options.searchText);
+    field(key, "hashTags", options.hashTags);
+    field(key, "userId", options.userId);
+    field(key, "customConfigStr", options.customConfigStr);
+    field(key, "afterCommentId", options.afterCommentId);
+    field(key, "beforeCommentId", options.beforeCommentId);
+    return key;
+}
+
+} // namespace
+
+CommentsFetch commentsFetch(std::shared_ptr<const PublicApi> api) {
+    return [api](const utility::string_t& tenantId, const utility::string_t& urlId, const GetCommentsPublicOptions& options) {
+        return api->getCommentsPublic(tenantId, urlId, options);
+    };
+}
+
+uint64_t optionsHash(const GetCommentsPublicOptions& options) {
+    return fnv1a(canonicalOptions(options));
+}
+
+struct CommentCache::State {
+    struct Entry {
+        std::string thread;
+        std::string options;   // canonicalOptions, to tell a hash collision apart
+        Shared response;
+        bool byVotes = false;
+        std::list<std::string>::iterator recent;
+    };
+
+    // What is cached or being fetched for one thread. version counts its
+    // events, so a response requested before one is not cached.
+    struct Thread {
+        uint64_t version = 0;
+        std::unordered_set<std::string> entries;
+        size_t fetching = 0;
+    };
+
+    struct Pending {
+        std::string options;
+        pplx::task<Shared> result;
+    };
+
+    CommentsFetch fetch;
+    CommentCacheOptions options;
+
+    mutable std::mutex mu;
+    std::unordered_map<std::string, Entry> entries;
+    std::list<std::string> recent;   // most recently used first
+    std::unordered_map<std::string, Pending> pending;
+    std::unordered_map<std::string, Thread> threads;
+    CommentCacheStats stats;
+
+    // Caller holds mu.
+    void drop(const std::string& key) {
+        auto it = entries.find(key);
+        if (it == entries.end()) return;
+        recent.erase(it->second.recent);
+        auto thread = threads.find(it->second.thread);
+        thread->second.entries.erase(key);
+        entries.erase(it);
+        release(thread);
+    }
+
+    // Caller holds mu. Forgets a thread with nothing cached or in flight.
+    void release(std::unordered_map<std::string, Thread>::iterator thread) {
+        if (thread->second.entries.empty() && thread->second.fetching == 0) threads.erase(thread);
+    }
+
+    // Caller holds mu.
+    void dropThread(std::unordered_map<std::string, Thread>::iterator thread) {
+        ++thread->second.version;
+        const auto keys = thread->second.entries;
+        for (const auto& key : keys) {
+            auto it = entries.find(key);
+            recent.erase(it->second.recent);
+            entries.erase(it);
+        }
+        stats.invalidated += keys.size();
+        thread->second.entries.clear();
+        release(thread);
+    }
+
+    // Caller holds mu.
+    void insert(const std::string& key, const std::string& thread, std::string canonical, Shared response,
+                bool sortedByVotes) {
+        recent.push_front(key);
+        entries[key] = {thread, std::move(canonical), std::move(response), sortedByVotes, recent.begin()};
+        threads[thread].entries.insert(key);
+        while (entries.size() > options.maxEntries) {
+            const std::string oldest = recent.back();
+            drop(oldest);
+        }
+    }
+
+    // Caller holds mu. Replaces the response with a copy in which `patch` has
+    // been applied to the comment.
+    void patchEntry(Entry& entry, const utility::string_t& commentId, const std::function<void(PublicComment&)>& patch) {
+        auto copy = std::make_shared<CommentsResponse>(*entry.response);
+        auto comments = copy->getComments();
+        patchComment(comments, commentId, patch);
+        copy->setComments(comments);
+        entry.response = copy;
+        ++stats.patched;
+    }
+
+    // Caller holds mu.
+    void applyUpdate(std::unordered_map<std::string, Thread>::iterator thread, const PubSubComment& update) {
+        bool listed = false;
+        const auto keys = thread->second.entries;
+        for (const auto& key : keys) {
+            Entry& entry = entries.at(key);
+            const auto cached = findComment(entry.response->getComments(), update.getId());
+            if (cached == nullptr) continue;
+            listed = true;
+            if (movesComment(*cached, update)) {
+                dropThread(thread);
+                return;
+            }
+            if (entry.byVotes && update.votesIsSet() && update.getVotes() != cached->getVotes()) {
+                drop(key);
+                ++stats.invalidated;
+                continue;
+            }
+            patchEntry(entry, update.getId(), [&update](PublicComment& comment) {
+                patchFields(comment, update);
+            });
+        }
+        // It may be one no response listed because it was hidden until now.
+        if (!listed) dropThread(thread);
+    }
+
+    // Caller holds mu. sign is +1 for a new vote and -1 for a removed one.
+    void applyVote(std::unordered_map<std::string, Thread>::iterator thread, const utility::string_t& commentId,
+                   int32_t direction, int32_t sign) {
+        const auto keys = thread->second.entries;
+        for (const auto& key : keys) {
+            Entry& entry = entries.at(key);
+            if (entry.byVotes) {
+                drop(key);
+                ++stats.invalidated;
+                continue;
+            }
+            if (findComment(entry.response->getComments(), commentId) == nullptr) continue;
+            patchEntry(entry, commentId, [direction, sign](PublicComment& comment) {
+                comment.setVotes(comment.getVotes() + sign * direction);
+                if (direction > 0) {
+                    comment.setVotesUp(comment.getVotesUp() + sign);
+                } else if (direction < 0) {
+                    comment.setVotesDown(comment.getVotesDown() + sign);
+                }
+            });
+        }
+    }
+
+    // Takes mu itself.
+    void apply(const std::string& threadId, const LiveEvent& event) {
+        switch (event.type) {
+        case EventType::NewComment:
+        case EventType::DeletedComment:
+        case EventType::ThreadStateChange:
+            invalidate(threadId);
+            return;
+        case EventType::UpdatedComment:
+        case EventType::NewVote:
+        case EventType::DeletedVote:
+            break;
+        default:
+            return;
+        }
+        // Fields this event doesn't carry may fail to parse; the comment or
+        // vote is all that is needed.
+        org::openapitools::client::model::LiveEvent parsed;
+        parsed.fromJson(event.payload);
+
+        std::lock_guard<std::mutex> lock(mu);
+        auto thread = threads.find(threadId);
+        if (thread == threads.end()) return;
+        if (event.type == EventType::UpdatedComment) {
+            const auto comment = parsed.getComment();
+            if (comment == nullptr) {
+                dropThread(thread);
+                return;
+            }
+            ++thread->second.version;
+            applyUpdate(thread, *comment);
+            return;
+        }
+        const auto vote = parsed.getVote();
+        if (vote == nullptr) {
+            dropThread(thread);
+            return;
+        }
+        ++thread->second.version;
+        applyVote(thread, vote->getCommentId(), vote->getDirection(), event.type == EventType::NewVote ? 1 : -1);
+    }
+
+    // Takes mu itself.
+    void invalidate(const std::string& threadId) {
+        std::lock_guard<std::mutex> lock(mu);
+        auto thread = threads.find(threadId);
+        if (thread != threads.end()) dropThread(thread);
+    }
+};
+
+CommentCache::CommentCache(std::shared_ptr<const PublicApi> api, CommentCacheOptions options)
+    : CommentCache(commentsFetch(std::move(api)), options) {}
+
+CommentCache::CommentCache(CommentsFetch fetch, CommentCacheOptions options) : state_(std::make_shared<State>()) {
+    if (options.maxEntries == 0) options.maxEntries = 1;
+    state_->fetch = std::move(fetch);
+    state_->options = options;
+}
+
+pplx::task<std::shared_ptr<const CommentsResponse>> CommentCache::get(const utility::string_t& tenantId,
+                                                                      const utility::string_t& urlId,
+                                                                      const GetCommentsPublicOptions& options) {
+    const std::string thread = threadKey(tenantId, urlId);
+    const std::string canonical = canonicalOptions(options);
+    const std::string key = thread + '\0' + std::to_string(fnv1a(canonical));
+    const bool sortedByVotes = byVotes(options);
+
+    pplx::task_completion_event<Shared> loaded;
+    uint64_t version;
+    bool cacheable = true;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        auto entry = state_->entries.find(key);
+        if (entry != state_->entries.end()) {
+            if (entry->second.options == canonical) {
+                state_->recent.splice(state_->recent.begin(), state_->recent, entry->second.recent);
+                ++state_->stats.hits;
+                return pplx::task_from_result(entry->second.response);
+            }
+            // A hash collision: the newer options take the slot.
+            state_->drop(key);
+        }
+        auto inFlight = state_->pending.find(key);
+        if (inFlight != state_->pending.end()) {
+            if (inFlight->second.options == canonical) {
+                ++state_->stats.shared;
+                return inFlight->second.result;
+            }
+            // Colliding options are in flight: fetch these without caching.
+            cacheable = false;
+        }
+        auto& record = state_->threads[thread];
+        ++record.fetching;
+        version = record.version;
+        if (cacheable) state_->pending.emplace(key, State::Pending{canonical, pplx::create_task(loaded)});
+        ++state_->stats.requests;
+    }
+
+    pplx::task<std::shared_ptr<CommentsResponse>> request;
+    try {
+        request = state_->fetch(tenantId, urlId, options);
+    } catch (...) {
+        request = pplx::task_from_exception<std::shared_ptr<CommentsResponse>>(std::current_exception());
+    }
+    auto state = state_;
+    request.then([state, key, thread, canonical, version, sortedByVotes, cacheable,
+                  loaded](pplx::task<std::shared_ptr<CommentsResponse>> t) {
+        Shared response;
+        std::exception_ptr error;
+        try {
+            response = t.get();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(state->mu);
+            if (cacheable) state->pending.erase(key);
+            auto record = state->threads.find(thread);
+            --record->second.fetching;
+            if (cacheable && !error && response != nullptr && record->second.version == version) {
+                state->insert(key, thread, canonical, response, sortedByVotes);
+            } else {
+                state->release(record);
+            }
+        }
+        if (error) {
+            loaded.set_exception(error);
+        } else {
+            loaded.set(response);
+        }
+    });
+    return pplx::create_task(loaded);
+}
+
+void CommentCache::apply(const utility::string_t& tenantId, const utility::string_t& urlId, const LiveEvent& event) {
+    state_->apply(threadKey(tenantId, urlId), event);
+}
+
+LiveStream::EventCallback CommentCache::eventHandler(const utility::string_t& tenantId,
+                                                    const utility::string_t& urlId) const {
+    std::weak_ptr<State> weak = state_;
+    const std::string thread = threadKey(tenantId, urlId);
+    return [weak, thread](const LiveEvent& event) {
+        if (auto state = weak.lock()) state->apply(thread, event);
+    };
+}
+
+LiveStream::ReconnectCallback CommentCache::reconnectHandler(const utility::string_t& tenantId,
+                                                            const utility::string_t& urlId) const {
+    std::weak_ptr<State> weak = state_;
+    const std::string thread = threadKey(tenantId, urlId);
+    return [weak, thread]() {
+        if (auto state = weak.lock()) state->invalidate(thread);
+    };
+}
+
+void CommentCache::invalidate(const utility::string_t& tenantId, const utility::string_t& urlId) {
+    state_->invalidate(threadKey(tenantId, urlId));
+}
+
+void CommentCache::clear() {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    for (auto thread = state_->threads.begin(); thread != state_->threads.end();) {
+        auto next = std::next(thread);
+        state_->dropThread(thread);
+        thread = next;
+    }
+}
+
+CommentCacheStats CommentCache::stats() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    CommentCacheStats stats = state_->stats;
+    stats.entries = state_->entries.size();
+    return stats;
+}
+
+} // namespace live
+} // namespace fastcomments
@@ -0,0 +1,256 @@
+#include "fastcomments/live/presence_service.hpp"
+
+#include "FastCommentsClient/api/PublicApi.h"
+#include "FastCommentsClient/model/GetUserPresenceStatusesResponse.h"
+#include "FastCommentsClient/model/LiveEvent.h"
+#include "internal/timer.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace fastcomments {
+namespace live {
+
+namespace {
+
+using Clock = detail::Timer::Clock;
+using Shared = std::shared_ptr<const PresenceStatuses>;
+
+} // namespace
+
+PresenceFetch presenceFetch(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlIdWS) {
+    return [api, tenantId, urlIdWS](const std::vector<utility::string_t>& userIds) {
+        utility::string_t joined;
+        for (const auto& userId : userIds) {
+            if (!joined.empty()) joined += _XPLATSTR(",");
+            joined += userId;
+        }
+        return api->getUserPresenceStatuses(tenantId, urlIdWS, joined)
+            .then([](std::shared_ptr<org::openapitools::client::model::GetUserPresenceStatusesResponse> response) {
+                return response != nullptr ? response->getUserIdsOnline() : PresenceStatuses();
+            });
+    };
+}
+
+struct PresenceService::State : std::enable_shared_from_this<State> {
+    struct Entry {
+        bool online = false;
+        Clock::time_point at;
+    };
+
+    struct Batch {
+        uint64_t id = 0;
+        std::vector<utility::string_t> userIds;
+        Clock::time_point openedAt;
+        Clock::time_point sealedAt;
+        pplx::task_completion_event<Shared> done;
+        pplx::task<Shared> result;
+    };
+
+    PresenceFetch fetch;
+    PresenceOptions options;
+
+    mutable std::mutex mu;
+    std::unordered_map<utility::string_t, Entry> entries;
+    // Users being fetched, and the request they are in.
+    std::unordered_map<utility::string_t, std::pair<uint64_t, pplx::task<Shared>>> pending;
+    Batch open;
+    uint64_t nextId = 1;
+    PresenceStats stats;
+
+    bool fresh(const Entry& entry, Clock::time_point now) const {
+        return now - entry.at < options.ttl;
+    }
+
+    // Caller holds mu. Starts a new open batch and returns the sealed one.
+    Batch seal() {
+        Batch sealed = std::move(open);
+        sealed.sealedAt = Clock::now();
+        open = Batch();
+        open.id = nextId++;
+        open.result = pplx::create_task(open.done);
+        ++stats.requests;
+        stats.usersRequested += sealed.userIds.size();
+        // Drop expired entries while we're here; once per request keeps the
+        // map bounded by the users seen within a ttl.
+        for (auto it = entries.begin(); it != entries.end();) {
+            it = fresh(it->second, sealed.sealedAt) ? std::next(it) : entries.erase(it);
+        }
+        return sealed;
+    }
+
+    void send(Batch batch) {
+        pplx::task<PresenceStatuses> call;
+        try {
+            call = fetch(batch.userIds);
+        } catch (...) {
+            call = pplx::task_from_exception<PresenceStatuses>(std::current_exception());
+        }
+        auto self = shared_from_this();
+        auto shared = std::make_shared<Batch>(std::move(batch));
+        call.then([self, shared](pplx::task<PresenceStatuses> t) {
+            std::exception_ptr error;
+            auto statuses = std::make_shared<PresenceStatuses>();
+            try {
+                const PresenceStatuses response = t.get();
+                for (const auto& userId : shared->userIds) {
+                    auto it = response.find(userId);
+                    (*statuses)[userId] = it != response.end() && it->second;
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                const auto now = Clock::now();
+                for (const auto& userId : shared->userIds) {
+                    auto it = self->pending.find(userId);
+                    if (it != self->pending.end() && it->second.first == shared->id) self->pending.erase(it);
+                    if (error) continue;
+                    Entry& entry = self->entries[userId];
+                    // An event that arrived after the request went out is
+                    // newer, for the cache and for the answer alike.
+                    if (entry.at > shared->sealedAt) {
+                        (*statuses)[userId] = entry.online;
+                        continue;
+                    }
+                    entry.online = statuses->at(userId);
+                    entry.at = now;
+                }
+            }
+            if (error) {
+                shared->done.set_exception(error);
+            } else {
+                shared->done.set(statuses);
+            }
+        });
+    }
+
+    // Caller holds mu. Sends the open batch batchWindow after it opened,
+    // unless it filled up and went out before then.
+    void arm() {
+        std::weak_ptr<State> weak = weak_from_this();
+        detail::Timer::shared().schedule(open.openedAt + options.batchWindow, [weak, id = open.id]() {
+            auto self = weak.lock();
+            if (self == nullptr) return;
+            Batch batch;
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                if (self->open.id != id || self->open.userIds.empty()) return;
+                batch = self->seal();
+            }
+            self->send(std::move(batch));
+        });
+    }
+};
+
+PresenceService::PresenceService(std::shared_ptr<const PublicApi> api, utility::string_t tenantId,
+                                 utility::string_t urlIdWS, PresenceOptions options)
+    : PresenceService(presenceFetch(std::move(api), std::move(tenantId), std::move(urlIdWS)), std::move(options)) {}
+
+PresenceService::PresenceService(PresenceFetch fetch, PresenceOptions options) : state_(std::make_shared<State>()) {
+    if (options.maxUsersPerRequest == 0) options.maxUsersPerRequest = 1;
+    state_->fetch = std::move(fetch);
+    state_->options = std::move(options);
+    state_->open.id = state_->nextId++;
+    state_->open.result = pplx::create_task(state_->open.done);
+}
+
+PresenceService::~PresenceService() {
+    State::Batch last;
+    bool send = false;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        if (!state_->open.userIds.empty()) {
+            last = state_->seal();
+            send = true;
+        }
+    }
+    if (send) state_->send(std::move(last));
+}
+
+pplx::task<PresenceStatuses> PresenceService::lookup(const std::vector<utility::string_t>& userIds) {
+    auto known = std::make_shared<PresenceStatuses>();
+    std::vector<pplx::task<Shared>> waits;
+    std::vector<State::Batch> full;
+    {
+        std::lock_guard<std::mutex> lock(state_->mu);
+        ++state_->stats.lookups;
+        const auto now = Clock::now();
+        std::unordered_set<uint64_t> waiting;
+        std::unordered_set<utility::string_t> seen;
+        for (const auto& userId : userIds) {
+            if (!seen.insert(userId).second) continue;
+            auto entry = state_->entries.find(userId);
+            if (entry != state_->entries.end() && state_->fresh(entry->second, now)) {
+                (*known)[userId] = entry->second.online;
+                ++state_->stats.cached;
+                continue;
+            }
+            auto pending = state_->pending.find(userId);
+            if (pending != state_->pending.end()) {
+                if (waiting.insert(pending->second.first).second) waits.push_back(pending->second.second);
+                ++state_->stats.shared;
+                continue;
+            }
+            State::Batch& open = state_->open;
+            if (open.userIds.empty()) {
+                open.openedAt = now;
+                state_->arm();
+            }
+            open.userIds.push_back(userId);
+            state_->pending[userId] = {open.id, open.result};
+            if (waiting.insert(open.id).second) waits.push_back(open.result);
+            if (open.userIds.size() >= state_->options.maxUsersPerRequest) full.push_back(state_->seal());
+        }
+    }
+    for (auto& batch : full) state_->send(std::move(batch));
+
+    if (waits.empty()) return pplx::task_from_result(std::move(*known));
+    return pplx::when_all(waits.begin(), waits.end()).then([known, userIds](std::vector<Shared> results) {
+        for (const auto& statuses : results) {
+            for (const auto& status : *statuses) known->insert(status);
+        }
+        // Only what was asked for, even when a shared request covered more.
+        PresenceStatuses answer;
+        for (const auto& userId : userIds) {
+            auto it = known->find(userId);
+            if (it != known->end()) answer[userId] = it->second;
+        }
+        return answer;
+    });
+}
+
+boost::optional<bool> PresenceService::cached(const utility::string_t& userId) const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    auto it = state_->entries.find(userId);
+    if (it == state_->entries.end() || !state_->fresh(it->second, Clock::now())) return boost::none;
+    return it->second.online;
+}
+
+void PresenceService::apply(const LiveEvent& event) {
+    if (event.type != EventType::PresenceUpdate) return;
+    // Fields of other event types may not parse; uj and ul are all we need.
+    org::openapitools::client::model::LiveEvent presence;
+    presence.fromJson(event.payload);
+    applyPresence(presence.getUj(), presence.getUl());
+}
+
+void PresenceService::applyPresence(const std::vector<utility::string_t>& joined,
+                                    const std::vector<utility::string_t>& left) {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    const auto now = Clock::now();
+    for (const auto& userId : joined) state_->entries[userId] = {true, now};
+    for (const auto& userId : left) state_->entries[userId] = {false, now};
+    state_->stats.eventUpdates += joined.size() + left.size();
+}
+
+PresenceStats PresenceService::stats() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    return state_->stats;
+}
+
+} // namespace live
+} // namespace fastcomments
@@ -0,0 +1,403 @@
+#include "fastcomments/paging/comment_window.hpp"
+
+#include "FastCommentsClient/model/CommentUserBadgeInfo.h"
+#include "FastCommentsClient/model/GetCommentsResponseWithPresence_PublicComment_.h"
+#include "FastCommentsClient/model/PublicComment.h"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace fastcomments {
+namespace paging {
+
+using org::openapitools::client::model::GetCommentsResponseWithPresence_PublicComment_;
+
+namespace {
+
+using Comments = std::vector<std::shared_ptr<PublicComment>>;
+
+enum Direction { Forward = 0, Backward = 1 };
+
+size_t stringBytes(const utility::string_t& s) {
+    return s.size() * sizeof(utility::char_t);
+}
+
+} // namespace
+
+size_t estimateBytes(const PublicComment& comment) {
+    size_t bytes = sizeof(PublicComment);
+    bytes += stringBytes(comment.getId()) + stringBytes(comment.getUserId()) + stringBytes(comment.getCommenterName()) +
+             stringBytes(comment.getCommenterLink()) + stringBytes(comment.getCommentHTML()) +
+             stringBytes(comment.getParentId()) + stringBytes(comment.getAvatarSrc()) +
+             stringBytes(comment.getDisplayLabel()) + stringBytes(comment.getAnonUserId()) +
+             stringBytes(comment.getEditKey()) + stringBytes(comment.getMyVoteId());
+    bytes += comment.getBadges().size() * sizeof(org::openapitools::client::model::CommentUserBadgeInfo);
+    for (const auto& id : comment.getFeedbackIds()) bytes += stringBytes(id);
+    for (const auto& child : comment.getChildren()) {
+        if (child != nullptr) bytes += estimateBytes(*child);
+    }
+    return bytes;
+}
+
+CommentPageFetch commentPageFetch(std::shared_ptr<const PublicApi> api, utility::string_t tenantId,
+                                  utility::string_t urlId, GetCommentsPublicOptions options) {
+    options.page = boost::none;
+    options.skip = boost::none;
+    return [api, tenantId, urlId, options](const CommentCursor& cursor, int32_t limit) {
+        auto request = options;
+        request.limit = limit;
+        request.afterCommentId = cursor.afterCommentId;
+        request.beforeCommentId = cursor.beforeCommentId;
+        return api->getCommentsPublic(tenantId, urlId, request)
+            .then([](std::shared_ptr<GetCommentsResponseWithPresence_PublicComment_> response) {
+                return response != nullptr ? response->getComments() : Comments();
+            });
+    };
+}
+
+struct CommentWindow::State : std::enable_shared_from_this<State> {
+    struct Entry {
+        std::shared_ptr<PublicComment> comment;
+        size_t bytes = 0;
+    };
+
+    // A run of entries added by one fetch; the unit of eviction.
+    struct Page {
+        size_t count = 0;
+        size_t bytes = 0;
+    };
+
+    CommentPageFetch fetch;
+    CommentWindowOptions options;
+
+    mutable std::mutex mu;
+    // entries[i] has sequence number frontSeq + i; sequence numbers grow in
+    // thread order and survive eviction at either end.
+    std::deque<Entry> entries;
+    std::deque<Page> pages;
+    int64_t frontSeq = 0;
+    std::unordered_map<utility::string_t, int64_t> seqById;
+    size_t bytes = 0;
+    // The comments just outside the window, when known: requests for the
+    // comments after frontAnchor or before backAnchor are adjacent too.
+    boost::optional<utility::string_t> frontAnchor;
+    boost::optional<utility::string_t> backAnchor;
+    bool atStart = false;
+    bool atEnd = false;
+
+    // Per direction: the fetch in flight, and a generation that moving or
+    // trimming that end of the window bumps so a stale result is dropped.
+    pplx::task<void> inFlight[2];
+    bool fetching[2] = {false, false};
+    uint64_t generation[2] = {0, 0};
+
+    CommentWindowStats stats;
+    pplx::task<void> tail = pplx::task_from_result();
+
+    int64_t endSeq() const { return frontSeq + static_cast<int64_t>(entries.size()); }
+
+    // Caller holds mu.
+    void reset() {
+        entries.clear();
+        pages.clear();
+        seqById.clear();
+        frontSeq = 0;
+        bytes = 0;
+        frontAnchor = boost::none;
+        backAnchor = boost::none;
+        atStart = false;
+        atEnd = false;
+        ++generation[Forward];
+        ++generation[Backward];
+        fetching[Forward] = fetching[Backward] = false;
+    }
+
+    // Caller holds mu. Returns the number of comments added.
+    size_t add(Direction direction, const Comments& page) {
+        Page added;
+        Comments fresh;
+        for (const auto& comment : page) {
+            if (comment == nullptr || seqById.count(comment->getId()) != 0) continue;
+            seqById.emplace(comment->getId(), 0);
+            fresh.push_back(comment);
+        }
+        if (fresh.empty()) return 0;
+        if (direction == Forward) {
+            for (const auto& comment : fresh) {
+                seqById[comment->getId()] = endSeq();
+                entries.push_back({comment, estimateBytes(*comment)});
+                added.bytes += entries.back().bytes;
+            }
+            added.count = fresh.size();
+            pages.push_back(added);
+            backAnchor = boost::none;
+        } else {
+            for (auto it = fresh.rbegin(); it != fresh.rend(); ++it) {
+                --frontSeq;
+                seqById[(*it)->getId()] = frontSeq;
+                entries.push_front({*it, estimateBytes(**it)});
+                added.bytes += entries.front().bytes;
+            }
+            added.count = fresh.size();
+            pages.push_front(added);
+            frontAnchor = boost::none;
+        }
+        bytes += added.bytes;
+        return added.count;
+    }
+
+    // Caller holds mu. The comment the next page in `direction` is fetched
+    // relative to; none for the start of the thread.
+    CommentCursor cursorFor(Direction direction) const {
+        CommentCursor cursor;
+        if (direction == Forward) {
+            cursor.afterCommentId = entries.empty() ? frontAnchor : entries.back().comment->getId();
+        } else {
+            cursor.beforeCommentId = entries.empty() ? backAnchor : entries.front().comment->getId();
+        }
+        return cursor;
+    }
+
+    // Caller holds mu. The fetch in flight in that direction, or a new one.
+    pplx::task<void> fetchPage(Direction direction, std::unique_lock<std::mutex>& lock) {
+        if (fetching[direction]) return inFlight[direction];
+        const CommentCursor cursor = cursorFor(direction);
+        const uint64_t gen = generation[direction];
+        pplx::task_completion_event<void> done;
+        auto pending = pplx::create_task(done);
+        fetching[direction] = true;
+        inFlight[direction] = pending;
+        ++stats.fetches;
+        const int32_t limit = options.pageSize;
+        lock.unlock();
+
+        pplx::task<Comments> request;
+        try {
+            request = fetch(cursor, limit);
+        } catch (...) {
+            request = pplx::task_from_exception<Comments>(std::current_exception());
+        }
+        auto self = shared_from_this();
+        request.then([self, direction, gen, limit, done](pplx::task<Comments> t) {
+            std::exception_ptr error;
+            {
+                std::lock_guard<std::mutex> guard(self->mu);
+                const bool current = self->generation[direction] == gen;
+                if (current) self->fetching[direction] = false;
+                try {
+                    const Comments page = t.get();
+                    if (current) {
+                        // A short page is the end of the thread; so is a
+                        // page of nothing new, which would otherwise loop.
+                        const size_t added = self->add(direction, page);
+                        if (page.size() < static_cast<size_t>(limit) || added == 0) {
+                            (direction == Forward ? self->atEnd : self->atStart) = true;
+                        }
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+            if (error) {
+                done.set_exception(error);
+            } else {
+                done.set();
+            }
+        });
+        lock.lock();
+        return pending;
+    }
+
+    // Caller holds mu. Starts a background fetch when fewer than
+    // prefetchPages pages are held beyond `edge` in `direction`.
+    void prefetch(Direction direction, int64_t edge, std::unique_lock<std::mutex>& lock) {
+        if (options.prefetchPages == 0) return;
+        const bool done = direction == Forward ? atEnd : atStart;
+        if (done || fetching[direction] || entries.empty()) return;
+        const int64_t ahead = direction == Forward ? endSeq() - edge : edge - frontSeq;
+        if (ahead >= static_cast<int64_t>(options.prefetchPages) * options.pageSize) return;
+        fetchPage(direction, lock).then([](pplx::task<void> t) {
+            try {
+                t.get();
+            } catch (...) {
+                // The request that needs these comments fetches them again.
+            }
+        });
+    }
+
+    // Caller holds mu. Drops whole pages from the end behind `direction`,
+    // then from the end ahead of it, until within budget. Pages overlapping
+    // the served range [from, to) are kept.
+    void evict(Direction direction, int64_t from, int64_t to) {
+        auto dropFront = [this, from]() {
+            if (pages.empty() || frontSeq + static_cast<int64_t>(pages.front().count) > from) return false;
+            const Page page = pages.front();
+            pages.pop_front();
+            for (size_t i = 0; i < page.count; ++i) {
+                seqById.erase(entries.front().comment->getId());
+                if (i + 1 == page.count) frontAnchor = entries.front().comment->getId();
+                entries.pop_front();
+            }
+            frontSeq += static_cast<int64_t>(page.count);
+            bytes -= page.bytes;
+            atStart = false;
+            ++generation[Backward];
+            fetching[Backward] = false;
+            ++stats.evictedPages;
+            return true;
+        };
+        auto dropBack = [this, to]() {
+            if (pages.empty() || endSeq() - static_cast<int64_t>(pages.back().count) < to) return false;
+            const Page page = pages.back();
+            pages.pop_back();
+            for (size_t i = 0; i < page.count; ++i) {
+                seqById.erase(entries.back().comment->getId());
+                if (i + 1 == page.count) backAnchor = entries.back().comment->getId();
+                entries.pop_back();
+            }
+            bytes -= page.bytes;
+            atEnd = false;
+            ++generation[Forward];
+            fetching[Forward] = false;
+            ++stats.evictedPages;
+            return true;
+        };
+        auto dropBehind = direction == Forward ? std::function<bool()>(dropFront) : std::function<bool()>(dropBack);
+        auto dropAhead = direction == Forward ? std::function<bool()>(dropBack) : std::function<bool()>(dropFront);
+        while (bytes > options.maxBytes && dropBehind()) {}
+        while (bytes > options.maxBytes && dropAhead()) {}
+    }
+
+    // Serves up to `count` comments after (Forward) or before (Backward)
+    // commentId, or from the matching end of the window without one, fetching
+    // in that direction until they are held or the thread ends. `waited` is
+    // set once a fetch has been waited on, so the request is not a hit.
+    pplx::task<Comments> fill(Direction direction, boost::optional<utility::string_t> commentId, size_t count,
+                              bool waited) {
+        std::unique_lock<std::mutex> lock(mu);
+        boost::optional<int64_t> anchor;
+        if (commentId) {
+            auto it = seqById.find(*commentId);
+            if (it != seqById.end()) anchor = it->second;
+        }
+        const int64_t want = static_cast<int64_t>(count);
+        int64_t from;
+        int64_t to;
+        bool complete;
+        if (direction == Forward) {
+            from = anchor ? *anchor + 1 : frontSeq;
+            to = std::min(from + want, endSeq());
+            complete = to - from == want || atEnd;
+        } else {
+            to = anchor ? *anchor : endSeq();
+            from = std::max(to - want, frontSeq);
+            complete = to - from == want || atStart;
+        }
+        if (complete) {
+            Comments result;
+            result.reserve(static_cast<size_t>(to - from));
+            for (int64_t seq = from; seq < to; ++seq) result.push_back(entries[static_cast<size_t>(seq - frontSeq)].comment);
+            if (!waited) ++stats.hits;
+            evict(direction, from, to);
+            prefetch(direction, direction == Forward ? to : from, lock);
+            return pplx::task_from_result(result);
+        }
+
+        // A prefetch that failed is retried once by this request; a fetch it
+        // started itself fails it.
+        const bool joined = fetching[direction];
+        auto self = shared_from_this();
+        return fetchPage(direction, lock).then([self, direction, commentId, count, joined](pplx::task<void> t) {
+            try {
+                t.get();
+            } catch (...) {
+                if (!joined) throw;
+            }
+            return self->fill(direction, commentId, count, true);
+        });
+    }
+
+    // Runs op after every request before it has finished.
+    pplx::task<Comments> enqueue(std::function<pplx::task<Comments>()> op) {
+        std::lock_guard<std::mutex> lock(mu);
+        ++stats.requests;
+        auto result = tail.then([op](pplx::task<void>) { return op(); });
+        tail = result.then([](pplx::task<Comments> t) {
+            try {
+                t.get();
+            } catch (...) {
+                // Reported to that request's caller; the next one runs anyway.
+            }
+        });
+        return result;
+    }
+};
+
+CommentWindow::CommentWindow(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId,
+                             GetCommentsPublicOptions options, CommentWindowOptions windowOptions)
+    : CommentWindow(commentPageFetch(std::move(api), std::move(tenantId), std::move(urlId), std::move(options)),
+                    windowOptions) {}
+
+CommentWindow::CommentWindow(CommentPageFetch fetch, CommentWindowOptions options) : state_(std::make_shared<State>()) {
+    if (options.pageSize <= 0) options.pageSize = 30;
+    state_->fetch = std::move(fetch);
+    state_->options = options;
+}
+
+pplx::task<std::vector<std::shared_ptr<PublicComment>>> CommentWindow::first(size_t count) {
+    auto state = state_;
+    return state->enqueue([state, count]() {
+        {
+            std::lock_guard<std::mutex> lock(state->mu);
+            if (!state->atStart) {
+                state->reset();
+                state->atStart = true;
+            }
+        }
+        return state->fill(Forward, boost::none, count, false);
+    });
+}
+
+pplx::task<std::vector<std::shared_ptr<PublicComment>>> CommentWindow::after(const utility::string_t& commentId, size_t count) {
+    auto state = state_;
+    return state->enqueue([state, commentId, count]() {
+        {
+            std::lock_guard<std::mutex> lock(state->mu);
+            if (state->seqById.count(commentId) == 0 && state->frontAnchor != commentId) {
+                state->reset();
+                state->frontAnchor = commentId;
+            }
+        }
+        return state->fill(Forward, commentId, count, false);
+    });
+}
+
+pplx::task<std::vector<std::shared_ptr<PublicComment>>> CommentWindow::before(const utility::string_t& commentId, size_t count) {
+    auto state = state_;
+    return state->enqueue([state, commentId, count]() {
+        {
+            std::lock_guard<std::mutex> lock(state->mu);
+            if (state->seqById.count(commentId) == 0 && state->backAnchor != commentId) {
+                state->reset();
+                state->backAnchor = commentId;
+            }
+        }
+        return state->fill(Backward, commentId, count, false);
+    });
+}
+
+CommentWindowStats CommentWindow::stats() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    CommentWindowStats stats = state_->stats;
+    stats.comments = state_->entries.size();
+    stats.bytes = state_->bytes;
+    return stats;
+}
+
+} // namespace paging
+} // namespace fastcomments
@@ -0,0 +1,199 @@
+#include "fastcomments/paging/page_iterator.hpp"
+
+#include "FastCommentsClient/model/APIGetCommentsResponse.h"
+#include "FastCommentsClient/model/GetAuditLogsResponse.h"
+#include "FastCommentsClient/model/GetPublicPagesResponse.h"
+#include "FastCommentsClient/model/GetSSOUsersResponse.h"
+#include "FastCommentsClient/model/ModerationAPIGetCommentIdsResponse.h"
+#include "FastCommentsClient/model/PageUsersOfflineResponse.h"
+#include "FastCommentsClient/model/PageUsersOnlineResponse.h"
+#include "FastCommentsClient/model/PublicFeedPostsResponse.h"
+
+#include <utility>
+
+namespace fastcomments {
+namespace paging {
+
+namespace {
+
+using namespace org::openapitools::client::model;
+using org::openapitools::client::api::GetAuditLogsOptions;
+using org::openapitools::client::api::GetApiIdsOptions;
+using org::openapitools::client::api::GetCommentsOptions;
+using org::openapitools::client::api::GetFeedPostsPublicOptions;
+using org::openapitools::client::api::GetOfflineUsersOptions;
+using org::openapitools::client::api::GetOnlineUsersOptions;
+using org::openapitools::client::api::GetPagesPublicOptions;
+
+constexpr int32_t kDefaultPageSize = 100;
+
+// Next offset after a skip page, or none when the page came back short.
+template <typename Item>
+boost::optional<SkipCursor> nextSkip(SkipCursor skip, const std::vector<Item>& items, int64_t limit) {
+    if (items.empty() || static_cast<int64_t>(items.size()) < limit) return boost::none;
+    return skip + static_cast<int64_t>(items.size());
+}
+
+// Users endpoints return the cursor of the following page, or nothing after the last.
+template <typename Response>
+boost::optional<UserCursor> nextUsers(const Response& response) {
+    if (response.getUsers().empty() || !response.nextAfterNameIsSet() || response.getNextAfterName().empty()) {
+        return boost::none;
+    }
+    UserCursor cursor;
+    cursor.afterName = response.getNextAfterName();
+    cursor.afterUserId = response.getNextAfterUserId();
+    return cursor;
+}
+
+GetOnlineUsersOptions userOptions(const UserCursor& cursor, GetOnlineUsersOptions options = {}) {
+    if (!cursor.afterName.empty()) {
+        options.afterName = cursor.afterName;
+        options.afterUserId = cursor.afterUserId;
+    }
+    return options;
+}
+
+} // namespace
+
+PageIterator<std::shared_ptr<APIComment>, SkipCursor> commentPages(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, GetCommentsOptions options) {
+    const int32_t limit = options.limit ? *options.limit : kDefaultPageSize;
+    const SkipCursor first = options.skip ? *options.skip : 0;
+    options.limit = limit;
+    options.page = boost::none;
+    using Iterator = PageIterator<std::shared_ptr<APIComment>, SkipCursor>;
+    return Iterator([api, tenantId, options, limit](const SkipCursor& skip) {
+        auto request = options;
+        request.skip = static_cast<int32_t>(skip);
+        return api->getComments(tenantId, request).then([skip, limit](std::shared_ptr<APIGetCommentsResponse> response) {
+            Iterator::PageType page;
+            if (response != nullptr) page.items = response->getComments();
+            page.next = nextSkip(skip, page.items, limit);
+            return page;
+        });
+    }, first);
+}
+
+PageIterator<std::shared_ptr<APIAuditLog>, SkipCursor> auditLogPages(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, GetAuditLogsOptions options) {
+    const int64_t limit = options.limit ? static_cast<int64_t>(*options.limit) : kDefaultPageSize;
+    const SkipCursor first = options.skip ? static_cast<SkipCursor>(*options.skip) : 0;
+    options.limit = static_cast<double>(limit);
+    using Iterator = PageIterator<std::shared_ptr<APIAuditLog>, SkipCursor>;
+    return Iterator([api, tenantId, options, limit](const SkipCursor& skip) {
+        auto request = options;
+        request.skip = static_cast<double>(skip);
+        return api->getAuditLogs(tenantId, request).then([skip, limit](std::shared_ptr<GetAuditLogsResponse> response) {
+            Iterator::PageType page;
+            if (response != nullptr) page.items = response->getAuditLogs();
+            page.next = nextSkip(skip, page.items, limit);
+            return page;
+        });
+    }, first);
+}
+
+PageIterator<std::shared_ptr<APISSOUser>, SkipCursor> ssoUserPages(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, int32_t skip) {
+    using Iterator = PageIterator<std::shared_ptr<APISSOUser>, SkipCursor>;
+    return Iterator([api, tenantId](const SkipCursor& at) {
+        return api->getSSOUsers(tenantId, static_cast<int32_t>(at)).then([at](std::shared_ptr<GetSSOUsersResponse> response) {
+            Iterator::PageType page;
+            if (response != nullptr) page.items = response->getUsers();
+            if (!page.items.empty()) page.next = at + static_cast<SkipCursor>(page.items.size());
+            return page;
+        });
+    }, skip);
+}
+
+PageIterator<std::shared_ptr<PublicPage>, utility::string_t> publicPagePages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId, GetPagesPublicOptions options) {
+    utility::string_t first = options.cursor ? *options.cursor : utility::string_t();
+    using Iterator = PageIterator<std::shared_ptr<PublicPage>, utility::string_t>;
+    return Iterator([api, tenantId, options](const utility::string_t& cursor) {
+        auto request = options;
+        request.cursor = boost::none;
+        if (!cursor.empty()) request.cursor = cursor;
+        return api->getPagesPublic(tenantId, request).then([](std::shared_ptr<GetPublicPagesResponse> response) {
+            Iterator::PageType page;
+            if (response == nullptr) return page;
+            page.items = response->getPages();
+            if (response->nextCursorIsSet() && !response->getNextCursor().empty()) page.next = response->getNextCursor();
+            return page;
+        });
+    }, std::move(first));
+}
+
+PageIterator<std::shared_ptr<FeedPost>, utility::string_t> feedPostPages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId, GetFeedPostsPublicOptions options) {
+    utility::string_t first = options.afterId ? *options.afterId : utility::string_t();
+    using Iterator = PageIterator<std::shared_ptr<FeedPost>, utility::string_t>;
+    return Iterator([api, tenantId, options](const utility::string_t& afterId) {
+        auto request = options;
+        request.afterId = boost::none;
+        if (!afterId.empty()) request.afterId = afterId;
+        const int32_t limit = options.limit ? *options.limit : 0;
+        return api->getFeedPostsPublic(tenantId, request).then([limit](std::shared_ptr<PublicFeedPostsResponse> response) {
+            Iterator::PageType page;
+            if (response != nullptr) page.items = response->getFeedPosts();
+            const bool shortPage = limit > 0 && static_cast<int32_t>(page.items.size()) < limit;
+            if (!page.items.empty() && !shortPage && page.items.back() != nullptr) page.next = page.items.back()->getId();
+            return page;
+        });
+    }, std::move(first));
+}
+
+PageIterator<utility::string_t, utility::string_t> commentIdPages(
+    std::shared_ptr<const ModerationApi> api, utility::string_t tenantId, GetApiIdsOptions options) {
+    utility::string_t first = options.afterId ? *options.afterId : utility::string_t();
+    using Iterator = PageIterator<utility::string_t, utility::string_t>;
+    return Iterator([api, tenantId, options](const utility::string_t& afterId) {
+        auto request = options;
+        request.afterId = boost::none;
+        if (!afterId.empty()) request.afterId = afterId;
+        return api->getApiIds(tenantId, request).then([](std::shared_ptr<ModerationAPIGetCommentIdsResponse> response) {
+            Iterator::PageType page;
+            if (response == nullptr) return page;
+            page.items = response->getIds();
+            // Servers that leave hasMore out are walked until an empty page.
+            const bool hasMore = response->hasMoreIsSet() ? response->isHasMore() : true;
+            if (hasMore && !page.items.empty()) page.next = page.items.back();
+            return page;
+        });
+    }, std::move(first));
+}
+
+PageIterator<std::shared_ptr<PageUserEntry>, UserCursor> onlineUserPages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId) {
+    using Iterator = PageIterator<std::shared_ptr<PageUserEntry>, UserCursor>;
+    return Iterator([api, tenantId, urlId](const UserCursor& cursor) {
+        return api->getOnlineUsers(tenantId, urlId, userOptions(cursor)).then([](std::shared_ptr<PageUsersOnlineResponse> response) {
+            Iterator::PageType page;
+            if (response == nullptr) return page;
+            page.items = response->getUsers();
+            page.next = nextUsers(*response);
+            return page;
+        });
+    }, UserCursor());
+}
+
+PageIterator<std::shared_ptr<PageUserEntry>, UserCursor> offlineUserPages(
+    std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId) {
+    using Iterator = PageIterator<std::shared_ptr<PageUserEntry>, UserCursor>;
+    return Iterator([api, tenantId, urlId](const UserCursor& cursor) {
+        const auto online = userOptions(cursor);
+        GetOfflineUsersOptions options;
+        options.afterName = online.afterName;
+        options.afterUserId = online.afterUserId;
+        return api->getOfflineUsers(tenantId, urlId, options).then([](std::shared_ptr<PageUsersOfflineResponse> response) {
+            Iterator::PageType page;
+            if (response == nullptr) return page;
+            page.items = response->getUsers();
+            page.next = nextUsers(*response);
+            return page;
+        });
+    }, UserCursor());
+}
+
+} // namespace paging
+} // namespace fastcomments
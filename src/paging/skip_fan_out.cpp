@@ -0,0 +1,123 @@
+#include "fastcomments/paging/skip_fan_out.hpp"
+
+#include "FastCommentsClient/model/GetAuditLogsResponse.h"
+#include "FastCommentsClient/model/GetPendingWebhookEventCountResponse.h"
+#include "FastCommentsClient/model/GetPendingWebhookEventsResponse.h"
+#include "FastCommentsClient/model/GetQuestionResultsResponse.h"
+#include "FastCommentsClient/model/GetSSOUsersResponse.h"
+#include "FastCommentsClient/model/GetTenantDailyUsagesResponse.h"
+#include "FastCommentsClient/model/GetTenantUsersResponse.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace fastcomments {
+namespace paging {
+
+namespace {
+
+using namespace org::openapitools::client::model;
+using org::openapitools::client::api::GetAuditLogsOptions;
+using org::openapitools::client::api::GetPendingWebhookEventCountOptions;
+using org::openapitools::client::api::GetPendingWebhookEventsOptions;
+using org::openapitools::client::api::GetQuestionResultsOptions;
+using org::openapitools::client::api::GetTenantDailyUsagesOptions;
+
+constexpr int32_t kDefaultAuditLogPageSize = 100;
+
+// Unwraps the list from a response, treating a null response as an empty page.
+template <typename Response, typename Items>
+std::vector<Items> itemsOf(const std::shared_ptr<Response>& response, std::vector<Items> (Response::*get)() const) {
+    if (response == nullptr) return {};
+    return ((*response).*get)();
+}
+
+} // namespace
+
+SkipFanOut<std::shared_ptr<APIAuditLog>> auditLogScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, GetAuditLogsOptions options, FanOutOptions fanOut) {
+    const int64_t limit = options.limit ? static_cast<int64_t>(*options.limit) : kDefaultAuditLogPageSize;
+    options.limit = static_cast<double>(limit);
+    fanOut.pageSize = limit;
+    return SkipFanOut<std::shared_ptr<APIAuditLog>>([api, tenantId, options](int64_t skip) {
+        auto request = options;
+        request.skip = static_cast<double>(skip);
+        return api->getAuditLogs(tenantId, request).then([](std::shared_ptr<GetAuditLogsResponse> response) {
+            return itemsOf(response, &GetAuditLogsResponse::getAuditLogs);
+        });
+    }, std::move(fanOut));
+}
+
+SkipFanOut<std::shared_ptr<User>> tenantUserScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, FanOutOptions fanOut) {
+    return SkipFanOut<std::shared_ptr<User>>([api, tenantId](int64_t skip) {
+        return api->getTenantUsers(tenantId, static_cast<double>(skip)).then([](std::shared_ptr<GetTenantUsersResponse> response) {
+            return itemsOf(response, &GetTenantUsersResponse::getTenantUsers);
+        });
+    }, std::move(fanOut));
+}
+
+SkipFanOut<std::shared_ptr<APISSOUser>> ssoUserScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, FanOutOptions fanOut) {
+    return SkipFanOut<std::shared_ptr<APISSOUser>>([api, tenantId](int64_t skip) {
+        return api->getSSOUsers(tenantId, static_cast<int32_t>(skip)).then([](std::shared_ptr<GetSSOUsersResponse> response) {
+            return itemsOf(response, &GetSSOUsersResponse::getUsers);
+        });
+    }, std::move(fanOut));
+}
+
+SkipFanOut<std::shared_ptr<PendingCommentToSyncOutbound>> pendingWebhookEventScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, GetPendingWebhookEventsOptions options,
+    FanOutOptions fanOut) {
+    if (!fanOut.total) {
+        GetPendingWebhookEventCountOptions countOptions;
+        countOptions.commentId = options.commentId;
+        countOptions.externalId = options.externalId;
+        countOptions.eventType = options.eventType;
+        countOptions.type = options.type;
+        countOptions.domain = options.domain;
+        countOptions.attemptCountGT = options.attemptCountGT;
+        const int64_t startSkip = fanOut.startSkip;
+        fanOut.total = [api, tenantId, countOptions, startSkip]() {
+            return api->getPendingWebhookEventCount(tenantId, countOptions)
+                .then([startSkip](std::shared_ptr<GetPendingWebhookEventCountResponse> response) -> int64_t {
+                    if (response == nullptr || !response->countIsSet()) return -1;
+                    return std::max<int64_t>(static_cast<int64_t>(response->getCount()) - startSkip, 0);
+                });
+        };
+    }
+    return SkipFanOut<std::shared_ptr<PendingCommentToSyncOutbound>>([api, tenantId, options](int64_t skip) {
+        auto request = options;
+        request.skip = static_cast<double>(skip);
+        return api->getPendingWebhookEvents(tenantId, request).then([](std::shared_ptr<GetPendingWebhookEventsResponse> response) {
+            return itemsOf(response, &GetPendingWebhookEventsResponse::getPendingWebhookEvents);
+        });
+    }, std::move(fanOut));
+}
+
+SkipFanOut<std::shared_ptr<QuestionResult>> questionResultScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, GetQuestionResultsOptions options,
+    FanOutOptions fanOut) {
+    return SkipFanOut<std::shared_ptr<QuestionResult>>([api, tenantId, options](int64_t skip) {
+        auto request = options;
+        request.skip = static_cast<double>(skip);
+        return api->getQuestionResults(tenantId, request).then([](std::shared_ptr<GetQuestionResultsResponse> response) {
+            return itemsOf(response, &GetQuestionResultsResponse::getQuestionResults);
+        });
+    }, std::move(fanOut));
+}
+
+SkipFanOut<std::shared_ptr<APITenantDailyUsage>> tenantDailyUsageScan(
+    std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, GetTenantDailyUsagesOptions options,
+    FanOutOptions fanOut) {
+    return SkipFanOut<std::shared_ptr<APITenantDailyUsage>>([api, tenantId, options](int64_t skip) {
+        auto request = options;
+        request.skip = static_cast<double>(skip);
+        return api->getTenantDailyUsages(tenantId, request).then([](std::shared_ptr<GetTenantDailyUsagesResponse> response) {
+            return itemsOf(response, &GetTenantDailyUsagesResponse::getTenantDailyUsages);
+        });
+    }, std::move(fanOut));
+}
+
+} // namespace paging
+} // namespace fastcomments
@@ -0,0 +1,513 @@
+#include "fastcomments/store/comment_store.hpp"
+
+#include "internal/util.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fastcomments {
+namespace store {
+
+namespace {
+
+using detail::toEpochMs;
+using detail::fromEpochMs;
+using detail::threadKey;
+
+// Record header: magic, body length, FNV-1a of the body.
+constexpr uint32_t kMagic = 0x31524346;   // "FCR1"
+constexpr size_t kHeaderBytes = 12;
+
+enum RecordKind : uint8_t {
+    Put = 1,
+    Remove = 2
+};
+
+uint32_t checksum(const char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+std::string segmentName(size_t index) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "segment-%06zu.dat", index);
+    return name;
+}
+
+class Writer {
+public:
+    void u8(uint8_t v) { bytes_.push_back(static_cast<char>(v)); }
+    void u32(uint32_t v) { raw(&v, sizeof(v)); }
+    void i32(int32_t v) { raw(&v, sizeof(v)); }
+    void i64(int64_t v) { raw(&v, sizeof(v)); }
+    // Stored as UTF-8.
+    void str(const utility::string_t& s) {
+        const std::string utf8 = utility::conversions::to_utf8string(s);
+        u32(static_cast<uint32_t>(utf8.size()));
+        bytes_.append(utf8);
+    }
+
+    const std::string& bytes() const { return bytes_; }
+
+private:
+    void raw(const void* v, size_t size) { bytes_.append(static_cast<const char*>(v), size); }
+    std::string bytes_;
+};
+
+// Reads a record body in place. Stops (ok() false) instead of reading past
+// the end.
+class Reader {
+public:
+    Reader(const char* data, size_t size) : p_(data), end_(data + size) {}
+
+    uint8_t u8() {
+        uint8_t v = 0;
+        raw(&v, sizeof(v));
+        return v;
+    }
+    uint32_t u32() {
+        uint32_t v = 0;
+        raw(&v, sizeof(v));
+        return v;
+    }
+    int32_t i32() {
+        int32_t v = 0;
+        raw(&v, sizeof(v));
+        return v;
+    }
+    int64_t i64() {
+        int64_t v = 0;
+        raw(&v, sizeof(v));
+        return v;
+    }
+    std::string_view str() {
+        const uint32_t size = u32();
+        if (!ok_ || static_cast<size_t>(end_ - p_) < size) {
+            ok_ = false;
+            return {};
+        }
+        std::string_view s(p_, size);
+        p_ += size;
+        return s;
+    }
+
+    bool ok() const { return ok_; }
+
+private:
+    void raw(void* v, size_t size) {
+        if (!ok_ || static_cast<size_t>(end_ - p_) < size) {
+            ok_ = false;
+            return;
+        }
+        std::memcpy(v, p_, size);
+        p_ += size;
+    }
+
+    const char* p_;
+    const char* end_;
+    bool ok_ = true;
+};
+
+struct RecordKeys {
+    RecordKind kind = Put;
+    std::string_view tenantId;
+    std::string_view urlId;
+    std::string_view id;
+};
+
+RecordKeys readKeys(Reader& reader) {
+    RecordKeys keys;
+    keys.kind = static_cast<RecordKind>(reader.u8());
+    keys.tenantId = reader.str();
+    keys.urlId = reader.str();
+    keys.id = reader.str();
+    return keys;
+}
+
+// Body layout after the keys of a Put record.
+CommentView readComment(const char* body, size_t size) {
+    Reader reader(body, size);
+    CommentView view;
+    view.id = readKeys(reader).id;
+    view.parentId = reader.str();
+    view.userId = reader.str();
+    view.anonUserId = reader.str();
+    view.commenterName = reader.str();
+    view.commenterLink = reader.str();
+    view.avatarSrc = reader.str();
+    view.displayLabel = reader.str();
+    view.commentHTML = reader.str();
+    view.date = reader.i64();
+    view.votes = reader.i32();
+    view.votesUp = reader.i32();
+    view.votesDown = reader.i32();
+    view.childCount = reader.i32();
+    view.flags = reader.u32();
+    return view;
+}
+
+uint32_t flagsOf(const PublicComment& comment) {
+    uint32_t flags = 0;
+    auto set = [&flags](bool on, CommentView::Flag flag) {
+        if (on) flags |= flag;
+    };
+    set(comment.isVerified(), CommentView::Verified);
+    set(comment.isHasImages(), CommentView::HasImages);
+    set(comment.isIsByAdmin(), CommentView::ByAdmin);
+    set(comment.isIsByModerator(), CommentView::ByModerator);
+    set(comment.isIsPinned(), CommentView::Pinned);
+    set(comment.isIsLocked(), CommentView::Locked);
+    set(comment.isIsDeleted(), CommentView::Deleted);
+    set(comment.isIsDeletedUser(), CommentView::DeletedUser);
+    set(comment.isIsSpam(), CommentView::Spam);
+    set(comment.isApproved(), CommentView::Approved);
+    set(comment.isHasChildren(), CommentView::HasChildren);
+    return flags;
+}
+
+[[noreturn]] void throwLastError(const std::string& what) {
+#if defined(_WIN32)
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), what);
+#else
+    throw std::system_error(errno, std::generic_category(), what);
+#endif
+}
+
+// One data file, mapped read-write in full for the life of the store.
+class Segment {
+public:
+    // Opens the file at its current size, or creates it at `capacity`.
+    Segment(const std::string& path, size_t capacity) {
+#if defined(_WIN32)
+        file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) throwLastError("open " + path);
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size)) {
+            CloseHandle(file_);
+            throwLastError("stat " + path);
+        }
+        capacity_ = size.QuadPart > 0 ? static_cast<size_t>(size.QuadPart) : capacity;
+        const auto bytes = static_cast<unsigned long long>(capacity_);
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, static_cast<DWORD>(bytes >> 32),
+                                      static_cast<DWORD>(bytes), nullptr);
+        if (mapping_ == nullptr) {
+            CloseHandle(file_);
+            throwLastError("map " + path);
+        }
+        data_ = static_cast<char*>(MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, capacity_));
+        if (data_ == nullptr) {
+            CloseHandle(mapping_);
+            CloseHandle(file_);
+            throwLastError("map " + path);
+        }
+#else
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) throwLastError("open " + path);
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) {
+            ::close(fd_);
+            throwLastError("stat " + path);
+        }
+        capacity_ = st.st_size > 0 ? static_cast<size_t>(st.st_size) : capacity;
+        if (st.st_size == 0 && ::ftruncate(fd_, static_cast<off_t>(capacity_)) != 0) {
+            ::close(fd_);
+            throwLastError("size " + path);
+        }
+        void* data = ::mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd_);
+            throwLastError("map " + path);
+        }
+        data_ = static_cast<char*>(data);
+#endif
+    }
+
+    ~Segment() {
+#if defined(_WIN32)
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_);
+        CloseHandle(file_);
+#else
+        ::munmap(data_, capacity_);
+        ::close(fd_);
+#endif
+    }
+
+    Segment(const Segment&) = delete;
+    Segment& operator=(const Segment&) = delete;
+
+    char* data() const { return data_; }
+    size_t capacity() const { return capacity_; }
+
+    void flush() const {
+#if defined(_WIN32)
+        FlushViewOfFile(data_, 0);
+        FlushFileBuffers(file_);
+#else
+        ::msync(data_, capacity_, MS_SYNC);
+#endif
+    }
+
+private:
+    char* data_ = nullptr;
+    size_t capacity_ = 0;
+#if defined(_WIN32)
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
+
+} // namespace
+
+std::shared_ptr<PublicComment> CommentView::toPublicComment() const {
+    auto comment = std::make_shared<PublicComment>();
+    auto text = [](std::string_view s) { return utility::conversions::to_string_t(std::string(s)); };
+    comment->setId(text(id));
+    if (!parentId.empty()) comment->setParentId(text(parentId));
+    if (!userId.empty()) comment->setUserId(text(userId));
+    if (!anonUserId.empty()) comment->setAnonUserId(text(anonUserId));
+    comment->setCommenterName(text(commenterName));
+    if (!commenterLink.empty()) comment->setCommenterLink(text(commenterLink));
+    if (!avatarSrc.empty()) comment->setAvatarSrc(text(avatarSrc));
+    if (!displayLabel.empty()) comment->setDisplayLabel(text(displayLabel));
+    comment->setCommentHTML(text(commentHTML));
+    comment->setDate(fromEpochMs(date));
+    comment->setVotes(votes);
+    comment->setVotesUp(votesUp);
+    comment->setVotesDown(votesDown);
+    comment->setChildCount(childCount);
+    comment->setVerified(has(Verified));
+    comment->setHasImages(has(HasImages));
+    comment->setIsByAdmin(has(ByAdmin));
+    comment->setIsByModerator(has(ByModerator));
+    comment->setIsPinned(has(Pinned));
+    comment->setIsLocked(has(Locked));
+    comment->setIsDeleted(has(Deleted));
+    comment->setIsDeletedUser(has(DeletedUser));
+    comment->setIsSpam(has(Spam));
+    comment->setApproved(has(Approved));
+    comment->setHasChildren(has(HasChildren));
+    return comment;
+}
+
+struct CommentStore::State {
+    // A thread's comments in the order they were first added. Removed
+    // comments leave a null slot; ids point into the mapped records.
+    struct Thread {
+        std::vector<std::pair<const char*, uint32_t>> records;
+        std::unordered_map<std::string_view, size_t> slots;
+    };
+
+    CommentStoreOptions options;
+    mutable std::shared_mutex mu;
+    std::vector<std::unique_ptr<Segment>> segments;
+    size_t writeOffset = 0;   // in segments.back()
+    size_t firstDirty = 0;
+    std::unordered_map<std::string, Thread> threads;
+    CommentStoreStats stats;
+
+    // Caller holds mu exclusively.
+    void index(const char* body, uint32_t size) {
+        Reader reader(body, size);
+        const RecordKeys keys = readKeys(reader);
+        if (!reader.ok()) return;
+        std::string key(keys.tenantId);
+        key.push_back('\0');
+        key.append(keys.urlId);
+        if (keys.kind == Remove) {
+            auto thread = threads.find(key);
+            if (thread == threads.end()) return;
+            auto slot = thread->second.slots.find(keys.id);
+            if (slot == thread->second.slots.end()) return;
+            thread->second.records[slot->second] = {nullptr, 0};
+            thread->second.slots.erase(slot);
+            --stats.comments;
+            return;
+        }
+        Thread& thread = threads[key];
+        auto inserted = thread.slots.emplace(keys.id, thread.records.size());
+        if (inserted.second) {
+            thread.records.emplace_back(body, size);
+            ++stats.comments;
+        } else {
+            thread.records[inserted.first->second] = {body, size};
+        }
+    }
+
+    // Caller holds mu exclusively. Indexes the valid records at the start of
+    // a segment; returns where they end.
+    size_t scan(const Segment& segment) {
+        size_t offset = 0;
+        while (offset + kHeaderBytes <= segment.capacity()) {
+            const char* at = segment.data() + offset;
+            uint32_t header[3];
+            std::memcpy(header, at, sizeof(header));
+            if (header[0] != kMagic || header[1] > segment.capacity() - offset - kHeaderBytes) break;
+            if (checksum(at + kHeaderBytes, header[1]) != header[2]) break;
+            index(at + kHeaderBytes, header[1]);
+            offset += kHeaderBytes + header[1];
+            ++stats.records;
+            stats.bytes += kHeaderBytes + header[1];
+        }
+        return offset;
+    }
+
+    // Caller holds mu exclusively.
+    void append(const std::string& directory, const std::string& body) {
+        const size_t needed = kHeaderBytes + body.size();
+        if (segments.empty() || writeOffset + needed > segments.back()->capacity()) {
+            const size_t index = segments.size();
+            segments.push_back(std::unique_ptr<Segment>(new Segment(
+                (std::filesystem::path(directory) / segmentName(index)).string(), std::max(options.segmentBytes, needed))));
+            writeOffset = 0;
+        }
+        char* at = segments.back()->data() + writeOffset;
+        std::memcpy(at + kHeaderBytes, body.data(), body.size());
+        const uint32_t header[3] = {kMagic, static_cast<uint32_t>(body.size()), checksum(body.data(), body.size())};
+        std::memcpy(at, header, sizeof(header));
+        writeOffset += needed;
+        ++stats.records;
+        stats.bytes += needed;
+        index(at + kHeaderBytes, static_cast<uint32_t>(body.size()));
+    }
+
+    const Thread* thread(const utility::string_t& tenantId, const utility::string_t& urlId) const {
+        auto it = threads.find(threadKey(tenantId, urlId));
+        return it == threads.end() ? nullptr : &it->second;
+    }
+};
+
+CommentStore::CommentStore(std::string directory, CommentStoreOptions options)
+    : directory_(std::move(directory)), state_(new State()) {
+    if (options.segmentBytes < kHeaderBytes) options.segmentBytes = kHeaderBytes;
+    state_->options = options;
+    std::filesystem::create_directories(directory_);
+    for (size_t index = 0;; ++index) {
+        const auto path = std::filesystem::path(directory_) / segmentName(index);
+        if (!std::filesystem::exists(path)) break;
+        state_->segments.push_back(std::unique_ptr<Segment>(new Segment(path.string(), options.segmentBytes)));
+        state_->writeOffset = state_->scan(*state_->segments.back());
+    }
+    state_->firstDirty = state_->segments.size();
+}
+
+CommentStore::~CommentStore() = default;
+
+void CommentStore::put(const utility::string_t& tenantId, const utility::string_t& urlId, const PublicComment& comment) {
+    Writer writer;
+    writer.u8(Put);
+    writer.str(tenantId);
+    writer.str(urlId);
+    writer.str(comment.getId());
+    writer.str(comment.getParentId());
+    writer.str(comment.getUserId());
+    writer.str(comment.getAnonUserId());
+    writer.str(comment.getCommenterName());
+    writer.str(comment.getCommenterLink());
+    writer.str(comment.getAvatarSrc());
+    writer.str(comment.getDisplayLabel());
+    writer.str(comment.getCommentHTML());
+    writer.i64(toEpochMs(comment.getDate()));
+    writer.i32(comment.getVotes());
+    writer.i32(comment.getVotesUp());
+    writer.i32(comment.getVotesDown());
+    writer.i32(comment.getChildCount());
+    writer.u32(flagsOf(comment));
+
+    std::unique_lock<std::shared_mutex> lock(state_->mu);
+    state_->firstDirty = std::min(state_->firstDirty, state_->segments.empty() ? 0 : state_->segments.size() - 1);
+    state_->append(directory_, writer.bytes());
+}
+
+void CommentStore::put(const utility::string_t& tenantId, const utility::string_t& urlId,
+                       const std::vector<std::shared_ptr<PublicComment>>& comments) {
+    for (const auto& comment : comments) {
+        if (comment != nullptr) put(tenantId, urlId, *comment);
+    }
+}
+
+bool CommentStore::remove(const utility::string_t& tenantId, const utility::string_t& urlId,
+                          const utility::string_t& commentId) {
+    Writer writer;
+    writer.u8(Remove);
+    writer.str(tenantId);
+    writer.str(urlId);
+    writer.str(commentId);
+
+    std::unique_lock<std::shared_mutex> lock(state_->mu);
+    const State::Thread* thread = state_->thread(tenantId, urlId);
+    if (thread == nullptr || thread->slots.count(utility::conversions::to_utf8string(commentId)) == 0) return false;
+    state_->firstDirty = std::min(state_->firstDirty, state_->segments.size() - 1);
+    state_->append(directory_, writer.bytes());
+    return true;
+}
+
+std::vector<CommentView> CommentStore::thread(const utility::string_t& tenantId, const utility::string_t& urlId) const {
+    std::vector<CommentView> views;
+    std::shared_lock<std::shared_mutex> lock(state_->mu);
+    const State::Thread* thread = state_->thread(tenantId, urlId);
+    if (thread == nullptr) return views;
+    views.reserve(thread->slots.size());
+    for (const auto& record : thread->records) {
+        if (record.first != nullptr) views.push_back(readComment(record.first, record.second));
+    }
+    return views;
+}
+
+boost::optional<CommentView> CommentStore::find(const utility::string_t& tenantId, const utility::string_t& urlId,
+                                                const utility::string_t& commentId) const {
+    std::shared_lock<std::shared_mutex> lock(state_->mu);
+    const State::Thread* thread = state_->thread(tenantId, urlId);
+    if (thread == nullptr) return boost::none;
+    auto it = thread->slots.find(utility::conversions::to_utf8string(commentId));
+    if (it == thread->slots.end()) return boost::none;
+    const auto& record = thread->records[it->second];
+    return readComment(record.first, record.second);
+}
+
+size_t CommentStore::threadSize(const utility::string_t& tenantId, const utility::string_t& urlId) const {
+    std::shared_lock<std::shared_mutex> lock(state_->mu);
+    const State::Thread* thread = state_->thread(tenantId, urlId);
+    return thread == nullptr ? 0 : thread->slots.size();
+}
+
+void CommentStore::flush() {
+    std::unique_lock<std::shared_mutex> lock(state_->mu);
+    for (size_t i = state_->firstDirty; i < state_->segments.size(); ++i) state_->segments[i]->flush();
+    state_->firstDirty = state_->segments.size();
+}
+
+CommentStoreStats CommentStore::stats() const {
+    std::shared_lock<std::shared_mutex> lock(state_->mu);
+    CommentStoreStats stats = state_->stats;
+    stats.segments = state_->segments.size();
+    stats.threads = state_->threads.size();
+    return stats;
+}
+
+} // namespace store
+} // namespace fastcomments
@@ -0,0 +1,228 @@
+#include "fastcomments/store/comment_tree.hpp"
+
+#include "FastCommentsClient/model/LiveEvent.h"
+#include "internal/util.hpp"
+
+#include <set>
+#include <utility>
+
+namespace fastcomments {
+namespace store {
+
+using detail::fromEpochMs;
+using detail::toEpochMs;
+
+// Both are read through their wire JSON, which PublicComment shares apart
+// from APIComment's "id" (not "_id") and numeric date.
+std::shared_ptr<PublicComment> toPublicComment(const APIComment& comment) {
+    auto result = std::make_shared<PublicComment>();
+    result->fromJson(comment.toJson());
+    result->setId(comment.getId());
+    result->setDate(fromEpochMs(static_cast<int64_t>(comment.getDate())));
+    return result;
+}
+
+std::shared_ptr<PublicComment> toPublicComment(const PubSubComment& comment) {
+    auto result = std::make_shared<PublicComment>();
+    result->fromJson(comment.toJson());
+    return result;
+}
+
+struct CommentTree::Node {
+    std::shared_ptr<PublicComment> comment;
+    utility::string_t id;
+    utility::string_t parentId;
+    int64_t date = 0;
+    int32_t votes = 0;
+    Node* parent = nullptr;
+    std::set<Node*, Less> children;
+    size_t replies = 0;
+
+    explicit Node(CommentOrder order) : children(Less{order}) {}
+};
+
+bool CommentTree::Less::operator()(const Node* a, const Node* b) const {
+    switch (order) {
+    case CommentOrder::Oldest:
+        if (a->date != b->date) return a->date < b->date;
+        break;
+    case CommentOrder::Newest:
+        break;
+    case CommentOrder::MostVotes:
+        if (a->votes != b->votes) return a->votes > b->votes;
+        break;
+    }
+    if (a->date != b->date) return a->date > b->date;
+    return a->id < b->id;
+}
+
+CommentTree::CommentTree(CommentOrder order) : order_(order), root_(new Node(order)) {}
+
+CommentTree::~CommentTree() = default;
+
+const CommentTree::Node* CommentTree::node(const utility::string_t& commentId) const {
+    if (commentId.empty()) return root_.get();
+    auto it = nodes_.find(commentId);
+    return it == nodes_.end() ? nullptr : it->second.get();
+}
+
+void CommentTree::attach(Node* node) {
+    Node* parent = root_.get();
+    if (!node->parentId.empty()) {
+        auto it = nodes_.find(node->parentId);
+        parent = it == nodes_.end() ? nullptr : it->second.get();
+        // A parent among the comment's own replies would make a cycle; wait
+        // for an update that fixes one or the other.
+        for (Node* p = parent; p != nullptr; p = p->parent) {
+            if (p == node) {
+                parent = nullptr;
+                break;
+            }
+        }
+    }
+    if (parent == nullptr) {
+        waiting_[node->parentId].insert(node->id);
+        return;
+    }
+    node->parent = parent;
+    parent->children.insert(node);
+    for (Node* p = parent; p != nullptr; p = p->parent) p->replies += 1 + node->replies;
+}
+
+void CommentTree::detach(Node* node) {
+    if (node->parent == nullptr) {
+        auto it = waiting_.find(node->parentId);
+        if (it != waiting_.end()) {
+            it->second.erase(node->id);
+            if (it->second.empty()) waiting_.erase(it);
+        }
+        return;
+    }
+    node->parent->children.erase(node);
+    for (Node* p = node->parent; p != nullptr; p = p->parent) p->replies -= 1 + node->replies;
+    node->parent = nullptr;
+}
+
+void CommentTree::erase(Node* node) {
+    for (Node* child : node->children) erase(child);
+    const utility::string_t id = node->id;
+    nodes_.erase(id);
+}
+
+void CommentTree::upsert(std::shared_ptr<PublicComment> comment) {
+    if (comment == nullptr || comment->getId().empty()) return;
+    const auto nested = comment->getChildren();
+    if (!nested.empty()) {
+        // The tree holds the replies; don't keep a second copy of them.
+        comment = std::make_shared<PublicComment>(*comment);
+        comment->setChildren({});
+    }
+
+    auto& slot = nodes_[comment->getId()];
+    const bool inserted = slot == nullptr;
+    if (inserted) {
+        slot.reset(new Node(order_));
+        slot->id = comment->getId();
+    } else {
+        detach(slot.get());
+    }
+    Node* node = slot.get();
+    node->comment = std::move(comment);
+    node->parentId = node->comment->getParentId();
+    node->date = toEpochMs(node->comment->getDate());
+    node->votes = node->comment->getVotes();
+    attach(node);
+
+    if (inserted) {
+        auto it = waiting_.find(node->id);
+        if (it != waiting_.end()) {
+            const auto adopted = std::move(it->second);
+            waiting_.erase(it);
+            for (const auto& childId : adopted) attach(nodes_.at(childId).get());
+        }
+    }
+    for (const auto& child : nested) upsert(child);
+}
+
+void CommentTree::upsert(const std::vector<std::shared_ptr<PublicComment>>& comments) {
+    for (const auto& comment : comments) upsert(comment);
+}
+
+void CommentTree::upsert(const std::vector<std::shared_ptr<APIComment>>& comments) {
+    for (const auto& comment : comments) {
+        if (comment != nullptr) upsert(toPublicComment(*comment));
+    }
+}
+
+bool CommentTree::remove(const utility::string_t& commentId) {
+    auto it = nodes_.find(commentId);
+    if (it == nodes_.end()) return false;
+    Node* node = it->second.get();
+    detach(node);
+    // Replies go with it; none of them can be waiting for it.
+    erase(node);
+    return true;
+}
+
+bool CommentTree::apply(const live::LiveEvent& event) {
+    using live::EventType;
+    if (event.type != EventType::NewComment && event.type != EventType::UpdatedComment &&
+        event.type != EventType::DeletedComment) {
+        return false;
+    }
+    org::openapitools::client::model::LiveEvent parsed;
+    parsed.fromJson(event.payload);
+    const auto comment = parsed.getComment();
+    if (comment == nullptr || comment->getId().empty()) return false;
+    if (event.type == EventType::DeletedComment) return remove(comment->getId());
+    upsert(toPublicComment(*comment));
+    return true;
+}
+
+void CommentTree::clear() {
+    nodes_.clear();
+    waiting_.clear();
+    root_->children.clear();
+    root_->replies = 0;
+}
+
+std::shared_ptr<PublicComment> CommentTree::find(const utility::string_t& commentId) const {
+    auto it = nodes_.find(commentId);
+    return it == nodes_.end() ? nullptr : it->second->comment;
+}
+
+std::vector<std::shared_ptr<PublicComment>> CommentTree::children(const utility::string_t& parentId) const {
+    std::vector<std::shared_ptr<PublicComment>> result;
+    const Node* parent = node(parentId);
+    if (parent == nullptr) return result;
+    result.reserve(parent->children.size());
+    for (const Node* child : parent->children) result.push_back(child->comment);
+    return result;
+}
+
+size_t CommentTree::replyCount(const utility::string_t& commentId) const {
+    const Node* n = node(commentId);
+    return n == nullptr ? 0 : n->replies;
+}
+
+void CommentTree::walk(const Visitor& visit, const utility::string_t& parentId) const {
+    const Node* parent = node(parentId);
+    if (parent != nullptr) walk(parent, visit, 0);
+}
+
+void CommentTree::walk(const Node* parent, const Visitor& visit, int depth) const {
+    for (const Node* child : parent->children) {
+        if (visit(child->comment, depth)) walk(child, visit, depth + 1);
+    }
+}
+
+size_t CommentTree::size() const {
+    return root_->replies;
+}
+
+size_t CommentTree::detached() const {
+    return nodes_.size() - root_->replies;
+}
+
+} // namespace store
+} // namespace fastcomments
@@ -0,0 +1,336 @@
+#include "fastcomments/sync/event_log_sync.hpp"
+
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/api/PublicApi.h"
+#include "FastCommentsClient/model/EventLogEntry.h"
+#include "FastCommentsClient/model/GetEventLogResponse.h"
+#include "FastCommentsClient/model/LiveEvent.h"
+#include "FastCommentsClient/model/LiveEventType.h"
+#include "FastCommentsClient/model/PubSubComment.h"
+#include "FastCommentsClient/model/PubSubVote.h"
+#include "internal/util.hpp"
+
+#include <cpprest/json.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace fastcomments {
+namespace sync {
+
+namespace {
+
+using detail::toEpochMs;
+
+using org::openapitools::client::model::GetEventLogResponse;
+using org::openapitools::client::model::JsonWriter;
+using org::openapitools::client::model::LiveEventType;
+using Entries = std::vector<std::shared_ptr<EventLogEntry>>;
+
+int64_t nowMs() {
+    return toEpochMs(utility::datetime::utc_now());
+}
+
+Entries eventsOf(const std::shared_ptr<GetEventLogResponse>& response) {
+    return response != nullptr ? response->getEvents() : Entries();
+}
+
+} // namespace
+
+EventLogFetch threadEventLog(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId,
+                             utility::string_t userIdWS) {
+    return [api, tenantId, urlId, userIdWS](int64_t startTime, int64_t endTime) {
+        return api->getEventLog(tenantId, urlId, userIdWS, startTime, endTime).then(eventsOf);
+    };
+}
+
+EventLogFetch globalEventLog(std::shared_ptr<const PublicApi> api, utility::string_t tenantId, utility::string_t urlId,
+                             utility::string_t userIdWS) {
+    return [api, tenantId, urlId, userIdWS](int64_t startTime, int64_t endTime) {
+        return api->getGlobalEventLog(tenantId, urlId, userIdWS, startTime, endTime).then(eventsOf);
+    };
+}
+
+ReplicaStore MemoryReplica::store() {
+    ReplicaStore store;
+    store.upsertComment = [this](const PubSubComment& comment) {
+        std::lock_guard<std::mutex> lock(mu_);
+        comments_[comment.getId()] = std::make_shared<PubSubComment>(comment);
+    };
+    store.removeComment = [this](const PubSubComment& comment) {
+        std::lock_guard<std::mutex> lock(mu_);
+        comments_.erase(comment.getId());
+    };
+    store.applyVote = [this](const PubSubVote& vote, bool added) {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = comments_.find(vote.getCommentId());
+        if (it == comments_.end()) return;
+        // Copy on write: readers may still hold the previous version.
+        auto comment = std::make_shared<PubSubComment>(*it->second);
+        const int32_t change = added ? 1 : -1;
+        if (vote.getDirection() > 0) {
+            comment->setVotesUp(comment->getVotesUp() + change);
+            comment->setVotes(comment->getVotes() + change);
+        } else {
+            comment->setVotesDown(comment->getVotesDown() + change);
+            comment->setVotes(comment->getVotes() - change);
+        }
+        it->second = comment;
+    };
+    return store;
+}
+
+std::shared_ptr<const PubSubComment> MemoryReplica::find(const utility::string_t& commentId) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = comments_.find(commentId);
+    return it != comments_.end() ? it->second : nullptr;
+}
+
+size_t MemoryReplica::size() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return comments_.size();
+}
+
+bool SyncCheckpoint::read(const std::string& path, SyncCheckpoint& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::stringstream text;
+    text << in.rdbuf();
+    try {
+        const auto json = web::json::value::parse(utility::conversions::to_string_t(text.str()));
+        SyncCheckpoint checkpoint;
+        checkpoint.timestamp = json.at(utility::conversions::to_string_t("timestamp")).as_number().to_int64();
+        for (const auto& event : json.at(utility::conversions::to_string_t("recent")).as_array()) {
+            checkpoint.recent.emplace_back(event.at(utility::conversions::to_string_t("id")).as_string(),
+                                           event.at(utility::conversions::to_string_t("createdAt")).as_number().to_int64());
+        }
+        out = std::move(checkpoint);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+void SyncCheckpoint::write(const std::string& path) const {
+    JsonWriter writer;
+    writer.beginObject();
+    writer.key(utility::conversions::to_string_t("timestamp"));
+    writer.value(timestamp);
+    writer.key(utility::conversions::to_string_t("recent"));
+    writer.beginArray();
+    for (const auto& event : recent) {
+        writer.beginObject();
+        writer.key(utility::conversions::to_string_t("id"));
+        writer.value(event.first);
+        writer.key(utility::conversions::to_string_t("createdAt"));
+        writer.value(event.second);
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.endObject();
+
+    // Replace atomically so a crash mid-write leaves the previous checkpoint.
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out << writer.str();
+        out.flush();
+        if (!out) throw std::runtime_error("EventLogSync: cannot write " + tmp);
+    }
+    std::filesystem::rename(tmp, path);
+}
+
+struct EventLogSync::State : std::enable_shared_from_this<State> {
+    EventLogFetch fetch;
+    ReplicaStore store;
+    EventLogSyncOptions options;
+
+    mutable std::mutex mu;
+    int64_t timestamp = 0;
+    std::unordered_map<utility::string_t, int64_t> recent;   // event id -> createdAt
+    size_t longestResponse = 0;
+    pplx::task<void> tail = pplx::task_from_result();         // the sync before the next one
+
+    int64_t windowStart() const {
+        return std::max<int64_t>(timestamp - options.overlap.count(), 0);
+    }
+
+    SyncCheckpoint checkpoint() const {
+        SyncCheckpoint out;
+        out.timestamp = timestamp;
+        out.recent.assign(recent.begin(), recent.end());
+        std::sort(out.recent.begin(), out.recent.end(),
+                  [](const auto& a, const auto& b) { return a.second != b.second ? a.second < b.second : a.first < b.first; });
+        return out;
+    }
+
+    void restore(const SyncCheckpoint& from) {
+        timestamp = from.timestamp;
+        recent.clear();
+        for (const auto& event : from.recent) recent.emplace(event.first, event.second);
+    }
+
+    void apply(const EventLogEntry& entry) {
+        const web::json::value json = web::json::value::parse(entry.getData());
+        if (!json.is_object()) throw web::json::json_exception("not a live event");
+        LiveEvent event;
+        event.fromJson(json);
+        if (event.getType() == nullptr) {
+            if (store.other) store.other(event);
+            return;
+        }
+        const auto type = event.getType()->getValue();
+        switch (type) {
+        case LiveEventType::eLiveEventType::NEW_COMMENT:
+        case LiveEventType::eLiveEventType::UPDATED_COMMENT:
+            if (store.upsertComment && event.getComment() != nullptr) store.upsertComment(*event.getComment());
+            return;
+        case LiveEventType::eLiveEventType::DELETED_COMMENT:
+            if (store.removeComment && event.getComment() != nullptr) store.removeComment(*event.getComment());
+            return;
+        case LiveEventType::eLiveEventType::NEW_VOTE:
+        case LiveEventType::eLiveEventType::DELETED_VOTE:
+            if (store.applyVote && event.getVote() != nullptr) {
+                store.applyVote(*event.getVote(), type == LiveEventType::eLiveEventType::NEW_VOTE);
+            }
+            return;
+        default:
+            if (store.other) store.other(event);
+            return;
+        }
+    }
+
+    // Applies the entries not seen before. On a follow-up read, the events at
+    // its start were returned by the previous read and aren't counted again.
+    // Caller holds mu.
+    void applyNew(Entries entries, int64_t start, bool followUp, SyncResult& result) {
+        std::vector<std::pair<int64_t, std::shared_ptr<EventLogEntry>>> ordered;
+        ordered.reserve(entries.size());
+        for (auto& entry : entries) {
+            if (entry != nullptr) ordered.emplace_back(toEpochMs(entry->getCreatedAt()), std::move(entry));
+        }
+        std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) {
+            return a.first != b.first ? a.first < b.first : a.second->getId() < b.second->getId();
+        });
+
+        const int64_t from = windowStart();
+        for (const auto& item : ordered) {
+            const int64_t createdAt = item.first;
+            const EventLogEntry& entry = *item.second;
+            if (followUp && createdAt == start && recent.count(entry.getId()) > 0) continue;
+            ++result.fetched;
+            // Older than the window: applied by an earlier sync.
+            if (createdAt < from || recent.count(entry.getId()) > 0) {
+                ++result.duplicates;
+                continue;
+            }
+            try {
+                apply(entry);
+                ++result.applied;
+            } catch (const web::json::json_exception&) {
+                ++result.undecodable;
+            }
+            recent.emplace(entry.getId(), createdAt);
+            timestamp = std::max(timestamp, createdAt);
+        }
+    }
+
+    void prune() {
+        const int64_t from = windowStart();
+        for (auto it = recent.begin(); it != recent.end();) {
+            if (it->second < from) it = recent.erase(it);
+            else ++it;
+        }
+    }
+
+    // Reads [from, endTime]. While responses come back full, reads again from
+    // the newest event returned; the overlap only applies to the first read.
+    pplx::task<SyncResult> round(int64_t from, int64_t endTime, bool followUp, SyncResult result) {
+        auto self = shared_from_this();
+        ++result.requests;
+        return fetch(from, endTime).then([self, from, endTime, followUp, result](Entries entries) mutable {
+            const size_t count = entries.size();
+            int64_t newest = from;
+            for (const auto& entry : entries) {
+                if (entry != nullptr) newest = std::max(newest, toEpochMs(entry->getCreatedAt()));
+            }
+            bool full;
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                // The server's cap isn't known; no response is longer than
+                // it, so one shorter than the longest seen was not capped.
+                self->longestResponse = std::max(self->longestResponse, count);
+                full = count > 0 && count == self->longestResponse;
+                std::exception_ptr error;
+                try {
+                    self->applyNew(std::move(entries), from, followUp, result);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                self->prune();
+                // Saved even after a store error: what was applied must not be
+                // applied again.
+                if (result.applied + result.undecodable > 0 && !self->options.checkpointPath.empty()) {
+                    self->checkpoint().write(self->options.checkpointPath);
+                }
+                if (error != nullptr) std::rethrow_exception(error);
+            }
+            // A full response within one millisecond can't be paged past.
+            if (!full || newest <= from) return pplx::task_from_result(result);
+            return self->round(newest, endTime, true, result);
+        });
+    }
+};
+
+EventLogSync::EventLogSync(EventLogFetch fetch, ReplicaStore store, EventLogSyncOptions options)
+    : EventLogSync(std::move(fetch), std::move(store), SyncCheckpoint(), std::move(options)) {
+    SyncCheckpoint saved;
+    if (!state_->options.checkpointPath.empty() && SyncCheckpoint::read(state_->options.checkpointPath, saved)) {
+        state_->restore(saved);
+    }
+}
+
+EventLogSync::EventLogSync(EventLogFetch fetch, ReplicaStore store, SyncCheckpoint from, EventLogSyncOptions options)
+    : state_(std::make_shared<State>()) {
+    state_->fetch = std::move(fetch);
+    state_->store = std::move(store);
+    state_->options = std::move(options);
+    if (state_->options.overlap.count() < 0) state_->options.overlap = std::chrono::milliseconds(0);
+    state_->restore(from);
+}
+
+pplx::task<SyncResult> EventLogSync::sync(int64_t endTime) {
+    auto state = state_;
+    std::lock_guard<std::mutex> lock(state->mu);
+    auto result = state->tail.then([state, endTime](pplx::task<void>) {
+        int64_t from;
+        {
+            std::lock_guard<std::mutex> lock(state->mu);
+            from = state->windowStart();
+        }
+        return state->round(from, endTime, false, SyncResult());
+    });
+    state->tail = result.then([](pplx::task<SyncResult> t) {
+        try {
+            t.get();
+        } catch (...) {
+            // Reported to the caller of that sync; the next one runs anyway.
+        }
+    });
+    return result;
+}
+
+pplx::task<SyncResult> EventLogSync::sync() {
+    return sync(nowMs());
+}
+
+SyncCheckpoint EventLogSync::checkpoint() const {
+    std::lock_guard<std::mutex> lock(state_->mu);
+    return state_->checkpoint();
+}
+
+} // namespace sync
+} // namespace fastcomments
@@ -0,0 +1,331 @@
+#include "fastcomments/sync/tenant_mirror.hpp"
+
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/api/DefaultApi.h"
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/APIGetCommentsResponse.h"
+#include "FastCommentsClient/model/APIPage.h"
+#include "FastCommentsClient/model/GetPagesAPIResponse.h"
+#include "FastCommentsClient/model/GetTenantUsersResponse.h"
+#include "FastCommentsClient/model/GetVotesResponse.h"
+#include "FastCommentsClient/model/PublicVote.h"
+#include "FastCommentsClient/model/SortDirections.h"
+#include "FastCommentsClient/model/User.h"
+
+#include <cpprest/json.h>
+
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+namespace fastcomments {
+namespace sync {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using org::openapitools::client::model::JsonWriter;
+
+// Finished work, one JSON object per line: {"urlId":"..."} for a thread,
+// {"users":true} for the user list. A torn last line is ignored on read.
+class Journal {
+public:
+    explicit Journal(std::string path) : path_(std::move(path)) {
+        if (path_.empty()) return;
+        std::ifstream in(path_, std::ios::binary);
+        std::string line;
+        while (std::getline(in, line)) {
+            try {
+                const auto entry = web::json::value::parse(utility::conversions::to_string_t(line));
+                if (entry.has_field(utility::conversions::to_string_t("urlId"))) {
+                    threads_.insert(entry.at(utility::conversions::to_string_t("urlId")).as_string());
+                } else if (entry.has_field(utility::conversions::to_string_t("users"))) {
+                    users_ = true;
+                }
+            } catch (const std::exception&) {
+                // Partially written before the previous run stopped.
+            }
+        }
+        in.close();
+        out_.open(path_, std::ios::binary | std::ios::app);
+        if (!out_) throw std::runtime_error("TenantMirror: cannot open " + path_);
+    }
+
+    bool threadDone(const utility::string_t& urlId) const { return threads_.count(urlId) > 0; }
+    bool usersDone() const { return users_; }
+
+    void markThread(const utility::string_t& urlId) {
+        JsonWriter writer;
+        writer.beginObject();
+        writer.key(utility::conversions::to_string_t("urlId"));
+        writer.value(urlId);
+        writer.endObject();
+        append(writer);
+    }
+
+    void markUsers() {
+        JsonWriter writer;
+        writer.beginObject();
+        writer.key(utility::conversions::to_string_t("users"));
+        writer.value(true);
+        writer.endObject();
+        append(writer);
+    }
+
+private:
+    void append(JsonWriter& writer) {
+        if (path_.empty()) return;
+        writer.endLine();
+        out_ << writer.str();
+        out_.flush();
+        if (!out_) throw std::runtime_error("TenantMirror: cannot write " + path_);
+    }
+
+    std::string path_;
+    std::ofstream out_;
+    std::unordered_set<utility::string_t> threads_;
+    bool users_ = false;
+};
+
+// One run(): the work still to start and the lanes working through it.
+struct Crawl : std::enable_shared_from_this<Crawl> {
+    MirrorSource source;
+    MirrorSink sink;
+    MirrorOptions options;
+    std::unique_ptr<Journal> journal;
+    Clock::time_point startedAt = Clock::now();
+
+    std::mutex mu;
+    std::vector<utility::string_t> threads;   // urlIds still to crawl
+    size_t nextThread = 0;
+    bool usersPending = false;
+    size_t lanes = 0;
+    std::exception_ptr error;
+    MirrorStats stats;
+    pplx::task_completion_event<MirrorStats> done;
+
+    // Serializes sink calls, journal appends and progress callbacks.
+    std::mutex sinkMu;
+
+    bool crawlThreads() const { return sink.comments || sink.votes; }
+
+    void start(std::vector<std::shared_ptr<APIPage>> pages) {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            stats.pages = pages.size();
+            if (crawlThreads()) {
+                for (const auto& page : pages) {
+                    if (page == nullptr) continue;
+                    ++stats.threadsTotal;
+                    if (journal->threadDone(page->getUrlId())) ++stats.threadsResumed;
+                    else threads.push_back(page->getUrlId());
+                }
+            }
+            usersPending = sink.users && !journal->usersDone();
+            lanes = std::max<size_t>(options.concurrency, 1);
+        }
+        if (sink.pages) {
+            std::lock_guard<std::mutex> lock(sinkMu);
+            sink.pages(pages);
+        }
+        for (size_t lane = 0, n = lanes; lane < n; ++lane) takeNext();
+    }
+
+    // Starts the lane's next unit of work, or retires the lane.
+    void takeNext() {
+        utility::string_t urlId;
+        bool users = false;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            if (error == nullptr && usersPending) {
+                usersPending = false;
+                users = true;
+            } else if (error == nullptr && nextThread < threads.size()) {
+                urlId = threads[nextThread++];
+            } else {
+                if (--lanes == 0) finish();
+                return;
+            }
+        }
+        auto self = shared_from_this();
+        auto work = users ? fetchUsers(0) : fetchComments(urlId, 0);
+        work.then([self, urlId, users](pplx::task<void> t) {
+            try {
+                t.get();
+                self->completed(users, urlId);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(self->mu);
+                if (self->error == nullptr) self->error = std::current_exception();
+            }
+            self->takeNext();
+        });
+    }
+
+    // Caller holds mu.
+    void finish() {
+        if (error != nullptr) {
+            done.set_exception(error);
+            return;
+        }
+        updateRates();
+        done.set(stats);
+    }
+
+    // Caller holds mu.
+    void updateRates() {
+        stats.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startedAt);
+        const double seconds = std::max(stats.elapsed.count(), int64_t(1)) / 1000.0;
+        stats.recordsPerSecond = static_cast<double>(stats.comments + stats.votes + stats.users) / seconds;
+    }
+
+    void completed(bool users, const utility::string_t& urlId) {
+        std::lock_guard<std::mutex> sinkLock(sinkMu);
+        if (users) journal->markUsers();
+        else journal->markThread(urlId);
+        MirrorStats snapshot;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            if (!users) ++stats.threads;
+            updateRates();
+            snapshot = stats;
+        }
+        if (options.onProgress) options.onProgress(snapshot);
+    }
+
+    template <typename T>
+    pplx::task<T> request(std::function<pplx::task<T>()> call) {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            ++stats.requests;
+        }
+        try {
+            return call();
+        } catch (...) {
+            return pplx::task_from_exception<T>(std::current_exception());
+        }
+    }
+
+    pplx::task<void> fetchComments(utility::string_t urlId, int32_t skip) {
+        if (!sink.comments) return fetchVotes(urlId);
+        auto self = shared_from_this();
+        const int32_t limit = options.commentPageSize;
+        using Comments = std::vector<std::shared_ptr<APIComment>>;
+        return request<Comments>([self, urlId, skip, limit]() { return self->source.comments(urlId, skip, limit); })
+            .then([self, urlId, skip, limit](Comments comments) {
+                {
+                    std::lock_guard<std::mutex> lock(self->sinkMu);
+                    if (!comments.empty()) self->sink.comments(urlId, comments);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(self->mu);
+                    self->stats.comments += comments.size();
+                }
+                if (comments.size() < static_cast<size_t>(limit)) return self->fetchVotes(urlId);
+                return self->fetchComments(urlId, skip + static_cast<int32_t>(comments.size()));
+            });
+    }
+
+    pplx::task<void> fetchVotes(utility::string_t urlId) {
+        if (!sink.votes) return pplx::task_from_result();
+        auto self = shared_from_this();
+        using Votes = std::vector<std::shared_ptr<PublicVote>>;
+        return request<Votes>([self, urlId]() { return self->source.votes(urlId); }).then([self, urlId](Votes votes) {
+            {
+                std::lock_guard<std::mutex> lock(self->sinkMu);
+                if (!votes.empty()) self->sink.votes(urlId, votes);
+            }
+            std::lock_guard<std::mutex> lock(self->mu);
+            self->stats.votes += votes.size();
+        });
+    }
+
+    pplx::task<void> fetchUsers(int32_t skip) {
+        auto self = shared_from_this();
+        using Users = std::vector<std::shared_ptr<User>>;
+        return request<Users>([self, skip]() { return self->source.users(skip); }).then([self, skip](Users users) {
+            if (users.empty()) return pplx::task_from_result();
+            {
+                std::lock_guard<std::mutex> lock(self->sinkMu);
+                self->sink.users(users);
+            }
+            {
+                std::lock_guard<std::mutex> lock(self->mu);
+                self->stats.users += users.size();
+            }
+            return self->fetchUsers(skip + static_cast<int32_t>(users.size()));
+        });
+    }
+};
+
+} // namespace
+
+MirrorSource tenantMirrorSource(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId) {
+    namespace client = org::openapitools::client;
+    MirrorSource source;
+    source.pages = [api, tenantId]() {
+        return api->getPages(tenantId).then([](std::shared_ptr<client::model::GetPagesAPIResponse> response) {
+            return response != nullptr ? response->getPages() : std::vector<std::shared_ptr<APIPage>>();
+        });
+    };
+    source.comments = [api, tenantId](const utility::string_t& urlId, int32_t skip, int32_t limit) {
+        using client::model::SortDirections;
+        client::api::GetCommentsOptions options;
+        options.urlId = urlId;
+        options.skip = skip;
+        options.limit = limit;
+        auto direction = std::make_shared<SortDirections>();
+        direction->setValue(SortDirections::eSortDirections::OF);
+        options.direction = direction;
+        return api->getComments(tenantId, options).then([](std::shared_ptr<client::model::APIGetCommentsResponse> response) {
+            return response != nullptr ? response->getComments() : std::vector<std::shared_ptr<APIComment>>();
+        });
+    };
+    source.votes = [api, tenantId](const utility::string_t& urlId) {
+        return api->getVotes(tenantId, urlId).then([](std::shared_ptr<client::model::GetVotesResponse> response) {
+            std::vector<std::shared_ptr<PublicVote>> votes;
+            if (response == nullptr) return votes;
+            votes = response->getAppliedAuthorizedVotes();
+            const auto anonymous = response->getAppliedAnonymousVotes();
+            votes.insert(votes.end(), anonymous.begin(), anonymous.end());
+            return votes;
+        });
+    };
+    source.users = [api, tenantId](int32_t skip) {
+        return api->getTenantUsers(tenantId, static_cast<double>(skip))
+            .then([](std::shared_ptr<client::model::GetTenantUsersResponse> response) {
+                return response != nullptr ? response->getTenantUsers() : std::vector<std::shared_ptr<User>>();
+            });
+    };
+    return source;
+}
+
+TenantMirror::TenantMirror(std::shared_ptr<const DefaultApi> api, utility::string_t tenantId, MirrorSink sink,
+                           MirrorOptions options)
+    : TenantMirror(tenantMirrorSource(std::move(api), std::move(tenantId)), std::move(sink), std::move(options)) {}
+
+TenantMirror::TenantMirror(MirrorSource source, MirrorSink sink, MirrorOptions options)
+    : source_(std::move(source)), sink_(std::move(sink)), options_(std::move(options)) {
+    if (options_.concurrency == 0) options_.concurrency = 1;
+    if (options_.commentPageSize <= 0) options_.commentPageSize = 100;
+}
+
+pplx::task<MirrorStats> TenantMirror::run() const {
+    auto crawl = std::make_shared<Crawl>();
+    crawl->source = source_;
+    crawl->sink = sink_;
+    crawl->options = options_;
+    crawl->journal.reset(new Journal(options_.checkpointPath));
+    {
+        std::lock_guard<std::mutex> lock(crawl->mu);
+        ++crawl->stats.requests;
+    }
+    return source_.pages().then([crawl](std::vector<std::shared_ptr<APIPage>> pages) {
+        crawl->start(std::move(pages));
+        return pplx::create_task(crawl->done);
+    });
+}
+
+} // namespace sync
+} // namespace fastcomments
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/analytics/aggregation_query.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using fastcomments::analytics::AggregateFetch;
+using fastcomments::analytics::AggregateOp;
+using fastcomments::analytics::AggregationCache;
+using fastcomments::analytics::AggregationCacheOptions;
+using fastcomments::analytics::AggregationQuery;
+using fastcomments::analytics::AggregationResult;
+using fastcomments::analytics::bucketAt;
+using fastcomments::analytics::BucketRange;
+using fastcomments::analytics::PredicateOp;
+using fastcomments::analytics::TimeBucket;
+
+namespace {
+
+constexpr int64_t kDay = 86400000;
+// 2024-03-10T12:00:00Z
+constexpr int64_t kNow = 1710072000000LL;
+
+AggregationQuery votesPerDay() {
+    return AggregationQuery(U("votes"))
+        .where(U("urlId"), PredicateOp::Eq, U("page-1"))
+        .groupBy(U("direction"))
+        .count(U("id"), U("votes"))
+        .bucketBy(U("createdAt"), TimeBucket::Day, 7);
+}
+
+// Answers each request with one row whose count is the number of requests
+// made so far, so a refetched bucket is visible in the result.
+struct FakeAggregate {
+    std::mutex mu;
+    std::vector<web::json::value> requests;
+    bool fail = false;
+
+    AggregateFetch fetch() {
+        return [this](const web::json::value& request) {
+            std::lock_guard<std::mutex> lock(mu);
+            requests.push_back(request);
+            if (fail) return pplx::task_from_exception<web::json::value>(std::runtime_error("HTTP 503"));
+            web::json::value row = web::json::value::object();
+            row[U("groups")][U("direction")] = web::json::value::string(U("up"));
+            row[U("votes")][U("numericValue")] = web::json::value::number(static_cast<double>(requests.size()));
+            return pplx::task_from_result(web::json::value::array({row}));
+        };
+    }
+
+    size_t count() {
+        std::lock_guard<std::mutex> lock(mu);
+        return requests.size();
+    }
+};
+
+} // anonymous namespace
+
+TEST(AggregationQueryTest, canonical_key_ignores_clause_order) {
+    auto a = AggregationQuery(U("comments"))
+                 .where(U("approved"), PredicateOp::Eq, true)
+                 .where(U("votes"), PredicateOp::GreaterThan, 3.0)
+                 .groupBy(U("urlId"))
+                 .groupBy(U("userId"))
+                 .count(U("id"), U("n"))
+                 .sum(U("votes"), U("total"));
+    auto b = AggregationQuery(U("comments"))
+                 .sum(U("votes"), U("total"))
+                 .groupBy(U("userId"))
+                 .where(U("votes"), PredicateOp::GreaterThan, 3.0)
+                 .count(U("id"), U("n"))
+                 .groupBy(U("urlId"))
+                 .where(U("approved"), PredicateOp::Eq, true);
+    EXPECT_EQ(a.canonicalKey(), b.canonicalKey());
+    EXPECT_EQ(a.hash(), b.hash());
+
+    auto c = AggregationQuery(a).where(U("urlId"), PredicateOp::Eq, U("page-2"));
+    EXPECT_NE(a.hash(), c.hash());
+    EXPECT_NE(a.hash(), AggregationQuery(a).sortBy(U("n"), false).hash());
+    EXPECT_NE(votesPerDay().hash(), AggregationQuery(votesPerDay()).bucketBy(U("createdAt"), TimeBucket::Day, 30).hash());
+
+    const web::json::value body = a.toJson();
+    EXPECT_EQ(body.at(U("resourceName")).as_string(), U("comments"));
+    EXPECT_EQ(body.at(U("query")).as_array().size(), 2u);
+    EXPECT_EQ(body.at(U("query")).at(1).at(U("operator")).as_string(), U("greater_than"));
+    EXPECT_EQ(body.at(U("operations")).at(1).at(U("op")).as_string(), U("SUM"));
+}
+
+TEST(AggregationQueryTest, buckets_follow_the_calendar) {
+    BucketRange month = bucketAt(TimeBucket::Month, kNow);
+    EXPECT_EQ(month.startMs, 1709251200000LL);   // 2024-03-01
+    EXPECT_EQ(month.endMs, 1711929600000LL);     // 2024-04-01
+    BucketRange february = bucketAt(TimeBucket::Month, kNow, -1);
+    EXPECT_EQ(february.endMs, month.startMs);
+    EXPECT_EQ(february.endMs - february.startMs, 29 * kDay);   // leap year
+    BucketRange year = bucketAt(TimeBucket::Year, kNow, -1);
+    EXPECT_EQ(year.startMs, 1672531200000LL);    // 2023-01-01
+    EXPECT_EQ(year.endMs, 1704067200000LL);      // 2024-01-01
+    EXPECT_EQ(bucketAt(TimeBucket::Day, -1).startMs, -kDay);
+
+    auto days = votesPerDay().buckets(kNow);
+    ASSERT_EQ(days.size(), 7u);
+    EXPECT_EQ(days.back().startMs, 1710028800000LL);   // 2024-03-10
+    EXPECT_EQ(days.front().startMs, days.back().startMs - 6 * kDay);
+
+    const web::json::value body = votesPerDay().toJson(days.back());
+    const web::json::value& query = body.at(U("query"));
+    ASSERT_EQ(query.as_array().size(), 3u);
+    EXPECT_EQ(query.at(1).at(U("value")).as_double(), static_cast<double>(days.back().startMs - 1));
+    EXPECT_EQ(query.at(2).at(U("operator")).as_string(), U("less_than"));
+    EXPECT_EQ(query.at(2).at(U("value")).as_double(), static_cast<double>(days.back().endMs));
+}
+
+TEST(AggregationCacheTest, refreshes_only_the_open_bucket) {
+    FakeAggregate server;
+    int64_t now = kNow;
+    AggregationCacheOptions options;
+    options.now = [&now]() { return now; };
+    options.maxAge = std::chrono::seconds(60);
+    AggregationCache cache(server.fetch(), options);
+
+    AggregationResult first = cache.get(votesPerDay()).get();
+    EXPECT_EQ(first.requests, 7u);
+    ASSERT_EQ(first.rows.size(), 7u);
+    EXPECT_EQ(first.rows[0].groups.at(U("direction")), U("up"));
+    EXPECT_LT(first.rows[0].bucketStartMs, first.rows[6].bucketStartMs);
+
+    // Within maxAge nothing is fetched, whatever order the clauses come in.
+    now += 30000;
+    AggregationResult second = cache.get(votesPerDay()).get();
+    EXPECT_EQ(second.requests, 0u);
+    EXPECT_EQ(second.cachedBuckets, 7u);
+
+    // Past maxAge only today's bucket is asked for again.
+    now += 60000;
+    AggregationResult third = cache.get(votesPerDay()).get();
+    EXPECT_EQ(third.requests, 1u);
+    EXPECT_EQ(server.count(), 8u);
+    EXPECT_EQ(third.rows[6].number(U("votes")), 8);
+    EXPECT_EQ(third.rows[5].number(U("votes")), first.rows[5].number(U("votes")));
+
+    // The next day: yesterday is fetched once more to settle it, today is new,
+    // and the oldest day leaves the window.
+    now += kDay;
+    AggregationResult fourth = cache.get(votesPerDay()).get();
+    EXPECT_EQ(fourth.requests, 2u);
+    ASSERT_EQ(fourth.rows.size(), 7u);
+    EXPECT_EQ(fourth.rows[0].bucketStartMs, first.rows[1].bucketStartMs);
+
+    now += 120000;
+    EXPECT_EQ(cache.get(votesPerDay()).get().requests, 1u);
+    EXPECT_EQ(cache.stats().entries, 1u);
+}
+
+TEST(AggregationCacheTest, concurrent_gets_share_one_request) {
+    pplx::task_completion_event<web::json::value> reply;
+    int calls = 0;
+    AggregationCache cache([&](const web::json::value&) {
+        ++calls;
+        return pplx::create_task(reply);
+    });
+    auto query = AggregationQuery(U("comments")).count(U("id"), U("n"));
+
+    auto a = cache.get(query);
+    auto b = cache.get(query);
+    web::json::value row = web::json::value::object();
+    row[U("n")][U("numericValue")] = web::json::value::number(42);
+    reply.set(web::json::value::array({row}));
+
+    EXPECT_EQ(a.get().rows.at(0).number(U("n")), 42);
+    EXPECT_EQ(b.get().rows.at(0).number(U("n")), 42);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(cache.get(query).get().cachedBuckets, 1u);
+}
+
+TEST(AggregationCacheTest, a_failed_refresh_keeps_the_cached_rows) {
+    FakeAggregate server;
+    int64_t now = kNow;
+    AggregationCacheOptions options;
+    options.now = [&now]() { return now; };
+    AggregationCache cache(server.fetch(), options);
+    auto query = AggregationQuery(U("comments")).count(U("id"), U("votes"));
+
+    EXPECT_EQ(cache.get(query).get().rows.at(0).number(U("votes")), 1);
+    now += 120000;
+    server.fail = true;
+    EXPECT_THROW(cache.get(query).get(), std::runtime_error);
+    server.fail = false;
+    AggregationResult retried = cache.get(query).get();
+    EXPECT_EQ(retried.requests, 1u);
+    EXPECT_EQ(retried.rows.at(0).number(U("votes")), 3);
+
+    cache.invalidate(query);
+    EXPECT_EQ(cache.stats().entries, 0u);
+    EXPECT_EQ(cache.get(query).get().requests, 1u);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/analytics/comment_batch.hpp"
+
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/APIGetCommentsResponse.h"
+
+using fastcomments::analytics::Bitmap;
+using fastcomments::analytics::CommentBatch;
+using fastcomments::analytics::CommentFlag;
+
+namespace {
+
+web::json::value parse(const char* json) {
+    return web::json::value::parse(utility::conversions::to_string_t(json));
+}
+
+const char* kResponse = R"({
+    "status": "success",
+    "comments": [
+        {"id": "a", "date": 1000, "votes": 3, "votesUp": 4, "votesDown": 1, "approved": true},
+        {"id": "b", "date": 3000, "votes": -2, "votesUp": 0, "votesDown": 2, "parentId": "a", "isSpam": true},
+        {"id": "c", "date": 2000, "votes": 7, "votesUp": 7, "votesDown": 0, "approved": true, "isPinned": true},
+        {"id": "d", "date": 2000, "votes": 0, "parentId": "zz"}
+    ]
+})";
+
+} // anonymous namespace
+
+TEST(CommentBatchTest, fromJson_decodes_columns) {
+    CommentBatch batch = CommentBatch::fromJson(parse(kResponse));
+    ASSERT_EQ(batch.size(), 4u);
+    EXPECT_EQ(batch.ids()[2], "c");
+    EXPECT_EQ(batch.dates()[1], 3000);
+    EXPECT_EQ(batch.votes()[1], -2);
+    EXPECT_EQ(batch.votesUp()[0], 4);
+    EXPECT_TRUE(batch.flag(CommentFlag::Approved).test(0));
+    EXPECT_FALSE(batch.flag(CommentFlag::Approved).test(1));
+    EXPECT_TRUE(batch.flag(CommentFlag::Spam).test(1));
+    EXPECT_EQ(batch.flag(CommentFlag::Pinned).count(), 1u);
+}
+
+TEST(CommentBatchTest, parents_are_row_indices) {
+    CommentBatch batch = CommentBatch::fromJson(parse(kResponse));
+    EXPECT_EQ(batch.parents()[0], CommentBatch::kNoParent);
+    EXPECT_EQ(batch.parents()[1], 0);
+    EXPECT_EQ(batch.parents()[3], CommentBatch::kParentNotInBatch);
+    EXPECT_EQ(batch.topLevel().rows(), (std::vector<uint32_t>{0, 2}));
+}
+
+TEST(CommentBatchTest, fromResponse_matches_fromJson) {
+    org::openapitools::client::model::APIGetCommentsResponse response;
+    ASSERT_TRUE(response.fromJson(parse(kResponse)));
+    CommentBatch fromModels = CommentBatch::fromResponse(response);
+    CommentBatch fromJson = CommentBatch::fromJson(parse(kResponse));
+    EXPECT_EQ(fromModels.ids(), fromJson.ids());
+    EXPECT_EQ(fromModels.dates(), fromJson.dates());
+    EXPECT_EQ(fromModels.votes(), fromJson.votes());
+    EXPECT_EQ(fromModels.parents(), fromJson.parents());
+    EXPECT_EQ(fromModels.flag(CommentFlag::Approved).words(), fromJson.flag(CommentFlag::Approved).words());
+}
+
+TEST(CommentBatchTest, filters_combine_and_aggregate) {
+    CommentBatch batch = CommentBatch::fromJson(parse(kResponse));
+    Bitmap recent = batch.dateBetween(2000, 4000);
+    EXPECT_EQ(recent.rows(), (std::vector<uint32_t>{1, 2, 3}));
+
+    Bitmap selected = recent & batch.flag(CommentFlag::Approved);
+    EXPECT_EQ(selected.rows(), (std::vector<uint32_t>{2}));
+    EXPECT_EQ((~selected).count(), 3u);
+
+    auto stats = batch.voteStats(batch.votesAtLeast(0));
+    EXPECT_EQ(stats.count, 3u);
+    EXPECT_EQ(stats.votes, 10);
+    EXPECT_EQ(stats.votesUp, 11);
+    EXPECT_EQ(stats.minDate, 1000);
+    EXPECT_EQ(stats.maxDate, 2000);
+
+    auto all = batch.voteStats();
+    EXPECT_EQ(all.count, 4u);
+    EXPECT_EQ(all.votesDown, 3);
+    EXPECT_EQ(all.maxDate, 3000);
+
+    EXPECT_EQ(batch.voteStats(Bitmap(batch.size())).count, 0u);
+    // A longer selection's bits past the last row are not rows.
+    EXPECT_EQ(batch.voteStats(Bitmap(batch.size() + 70, true)).count, 4u);
+}
+
+TEST(CommentBatchTest, orderings_are_stable) {
+    CommentBatch batch = CommentBatch::fromJson(parse(kResponse));
+    EXPECT_EQ(batch.orderByDate(), (std::vector<uint32_t>{0, 2, 3, 1}));
+    EXPECT_EQ(batch.orderByDate(true), (std::vector<uint32_t>{1, 2, 3, 0}));
+    EXPECT_EQ(batch.orderByVotes(), (std::vector<uint32_t>{1, 3, 0, 2}));
+    EXPECT_EQ(batch.orderByVotes(true), (std::vector<uint32_t>{2, 0, 3, 1}));
+}
+
+TEST(CommentBatchTest, bitmap_filters_span_multiple_words) {
+    web::json::value response = web::json::value::object();
+    web::json::value comments = web::json::value::array(200);
+    for (int i = 0; i < 200; ++i) {
+        web::json::value c = web::json::value::object();
+        c[utility::conversions::to_string_t("id")] = web::json::value::string(utility::conversions::to_string_t(std::to_string(i)));
+        c[utility::conversions::to_string_t("votes")] = web::json::value::number(i % 10);
+        c[utility::conversions::to_string_t("date")] = web::json::value::number(i);
+        comments[i] = c;
+    }
+    response[utility::conversions::to_string_t("comments")] = comments;
+
+    CommentBatch batch = CommentBatch::fromJson(response);
+    EXPECT_EQ(batch.votesAtLeast(5).count(), 100u);
+    EXPECT_EQ(batch.dateBetween(60, 130).count(), 70u);
+    EXPECT_EQ(batch.voteStats(batch.dateBetween(60, 130)).minDate, 60);
+    EXPECT_EQ(batch.orderByDate(true).front(), 199u);
+}
+
+TEST(CommentBatchTest, append_and_gather_relink_parents) {
+    CommentBatch first = CommentBatch::fromJson(parse(R"({"comments": [{"id": "child", "parentId": "root", "votes": 1}]})"));
+    EXPECT_EQ(first.parents()[0], CommentBatch::kParentNotInBatch);
+
+    first.append(CommentBatch::fromJson(parse(R"({"comments": [{"id": "root", "votes": 2, "approved": true}]})")));
+    ASSERT_EQ(first.size(), 2u);
+    EXPECT_EQ(first.parents()[0], 1);
+    EXPECT_TRUE(first.flag(CommentFlag::Approved).test(1));
+
+    CommentBatch reordered = first.gather({1, 0});
+    EXPECT_EQ(reordered.ids()[0], "root");
+    EXPECT_EQ(reordered.parents()[1], 0);
+    EXPECT_TRUE(reordered.flag(CommentFlag::Approved).test(0));
+}
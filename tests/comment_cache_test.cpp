@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/live/comment_cache.hpp"
+
+#include "FastCommentsClient/model/GetCommentsResponseWithPresence_PublicComment_.h"
+#include "FastCommentsClient/model/PubSubComment.h"
+#include "FastCommentsClient/model/PubSubVote.h"
+#include "FastCommentsClient/model/PublicComment.h"
+#include "FastCommentsClient/model/SortDirections.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using fastcomments::live::CommentCache;
+using fastcomments::live::CommentCacheOptions;
+using fastcomments::live::CommentsFetch;
+using fastcomments::live::CommentsResponse;
+using fastcomments::live::EventType;
+using fastcomments::live::LiveEvent;
+using fastcomments::live::optionsHash;
+using org::openapitools::client::api::GetCommentsPublicOptions;
+using org::openapitools::client::model::PubSubComment;
+using org::openapitools::client::model::PubSubVote;
+using org::openapitools::client::model::PublicComment;
+using org::openapitools::client::model::SortDirections;
+
+namespace {
+
+utility::string_t str(const std::string& s) {
+    return utility::conversions::to_string_t(s);
+}
+
+std::shared_ptr<PublicComment> comment(const std::string& id, int32_t votes) {
+    auto c = std::make_shared<PublicComment>();
+    c->setId(str(id));
+    c->setCommentHTML(str("<p>" + id + "</p>"));
+    c->setVotes(votes);
+    c->setVotesUp(votes);
+    c->setVotesDown(0);
+    c->setApproved(true);
+    return c;
+}
+
+// Serves c1, c2 and c3 (c2 with a reply c2r) for every request, or holds
+// requests until release() while `hold` is set.
+struct FakeComments {
+    std::mutex mu;
+    int requests = 0;
+    bool hold = false;
+    std::vector<pplx::task_completion_event<std::shared_ptr<CommentsResponse>>> held;
+
+    CommentsFetch fetch() {
+        return [this](const utility::string_t&, const utility::string_t&, const GetCommentsPublicOptions&) {
+            std::lock_guard<std::mutex> lock(mu);
+            ++requests;
+            if (hold) {
+                held.emplace_back();
+                return pplx::create_task(held.back());
+            }
+            return pplx::task_from_result(response());
+        };
+    }
+
+    void release() {
+        std::lock_guard<std::mutex> lock(mu);
+        for (auto& request : held) request.set(response());
+        held.clear();
+    }
+
+    int count() {
+        std::lock_guard<std::mutex> lock(mu);
+        return requests;
+    }
+
+    static std::shared_ptr<CommentsResponse> response() {
+        auto r = std::make_shared<CommentsResponse>();
+        auto parent = comment("c2", 2);
+        parent->setChildren({comment("c2r", 0)});
+        r->setComments({comment("c1", 5), parent, comment("c3", 1)});
+        r->setCommentCount(4);
+        return r;
+    }
+};
+
+LiveEvent event(EventType type, const std::string& rawType) {
+    LiveEvent e;
+    e.type = type;
+    e.rawType = rawType;
+    e.payload = web::json::value::object();
+    e.payload[U("type")] = web::json::value::string(str(rawType));
+    return e;
+}
+
+LiveEvent updated(const PubSubComment& c) {
+    auto e = event(EventType::UpdatedComment, "updated-comment");
+    e.payload[U("comment")] = c.toJson();
+    return e;
+}
+
+LiveEvent vote(EventType type, const std::string& rawType, const std::string& commentId, int32_t direction) {
+    PubSubVote v;
+    v.setId(str("v1"));
+    v.setCommentId(str(commentId));
+    v.setDirection(direction);
+    auto e = event(type, rawType);
+    e.payload[U("vote")] = v.toJson();
+    return e;
+}
+
+std::shared_ptr<PublicComment> find(const std::shared_ptr<const CommentsResponse>& r, const std::string& id) {
+    for (const auto& c : r->getComments()) {
+        if (c->getId() == str(id)) return c;
+        for (const auto& child : c->getChildren()) {
+            if (child->getId() == str(id)) return child;
+        }
+    }
+    return nullptr;
+}
+
+const utility::string_t kTenant = U("tenant");
+const utility::string_t kUrl = U("page-1");
+
+} // anonymous namespace
+
+TEST(CommentCacheTest, caches_each_thread_and_options_separately) {
+    FakeComments fake;
+    CommentCache cache(fake.fetch());
+    GetCommentsPublicOptions first;
+    GetCommentsPublicOptions second;
+    second.page = 1;
+    GetCommentsPublicOptions viewer;
+    viewer.sso = str("sso-payload");
+
+    const auto a = cache.get(kTenant, kUrl, first).get();
+    EXPECT_EQ(cache.get(kTenant, kUrl, first).get(), a);
+    cache.get(kTenant, kUrl, second).get();
+    cache.get(kTenant, kUrl, viewer).get();
+    cache.get(kTenant, U("page-2"), first).get();
+    EXPECT_EQ(fake.count(), 4);
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().entries, 4u);
+    EXPECT_NE(optionsHash(first), optionsHash(second));
+    EXPECT_EQ(optionsHash(second), optionsHash(second));
+}
+
+TEST(CommentCacheTest, concurrent_gets_share_one_request) {
+    FakeComments fake;
+    fake.hold = true;
+    CommentCache cache(fake.fetch());
+    auto a = cache.get(kTenant, kUrl, {});
+    auto b = cache.get(kTenant, kUrl, {});
+    fake.release();
+    EXPECT_EQ(a.get(), b.get());
+    EXPECT_EQ(fake.count(), 1);
+    EXPECT_EQ(cache.stats().shared, 1u);
+}
+
+TEST(CommentCacheTest, patches_updated_comments_into_a_copy) {
+    FakeComments fake;
+    CommentCache cache(fake.fetch());
+    const auto before = cache.get(kTenant, kUrl, {}).get();
+
+    PubSubComment update;
+    update.setId(str("c2r"));
+    update.setCommentHTML(str("<p>edited</p>"));
+    update.setApproved(true);
+    cache.apply(kTenant, kUrl, updated(update));
+
+    const auto after = cache.get(kTenant, kUrl, {}).get();
+    EXPECT_EQ(fake.count(), 1);
+    EXPECT_EQ(find(after, "c2r")->getCommentHTML(), str("<p>edited</p>"));
+    EXPECT_EQ(find(before, "c2r")->getCommentHTML(), str("<p>c2r</p>"));
+    // Untouched comments are shared with the old response.
+    EXPECT_EQ(find(after, "c1"), find(before, "c1"));
+    EXPECT_EQ(cache.stats().patched, 1u);
+}
+
+TEST(CommentCacheTest, updates_that_move_comments_drop_the_thread) {
+    FakeComments fake;
+    CommentCache cache(fake.fetch());
+    cache.get(kTenant, kUrl, {}).get();
+
+    PubSubComment unapproved;
+    unapproved.setId(str("c1"));
+    unapproved.setApproved(false);
+    cache.apply(kTenant, kUrl, updated(unapproved));
+    EXPECT_EQ(cache.stats().entries, 0u);
+
+    cache.get(kTenant, kUrl, {}).get();
+    PubSubComment unlisted;
+    unlisted.setId(str("c9"));
+    unlisted.setCommentHTML(str("<p>now visible</p>"));
+    cache.apply(kTenant, kUrl, updated(unlisted));
+    EXPECT_EQ(cache.stats().entries, 0u);
+    EXPECT_EQ(cache.stats().invalidated, 2u);
+}
+
+TEST(CommentCacheTest, votes_patch_counts_and_drop_most_voted_pages) {
+    FakeComments fake;
+    CommentCache cache(fake.fetch());
+    GetCommentsPublicOptions mostVoted;
+    auto mr = std::make_shared<SortDirections>();
+    mr->setValue(SortDirections::eSortDirections::MR);
+    mostVoted.direction = mr;
+    cache.get(kTenant, kUrl, {}).get();
+    cache.get(kTenant, kUrl, mostVoted).get();
+
+    cache.apply(kTenant, kUrl, vote(EventType::NewVote, "new-vote", "c3", 1));
+    cache.apply(kTenant, kUrl, vote(EventType::NewVote, "new-vote", "c3", -1));
+    cache.apply(kTenant, kUrl, vote(EventType::DeletedVote, "deleted-vote", "c1", 1));
+
+    const auto after = cache.get(kTenant, kUrl, {}).get();
+    EXPECT_EQ(find(after, "c3")->getVotes(), 1);
+    EXPECT_EQ(find(after, "c3")->getVotesUp(), 2);
+    EXPECT_EQ(find(after, "c3")->getVotesDown(), 1);
+    EXPECT_EQ(find(after, "c1")->getVotes(), 4);
+    EXPECT_EQ(fake.count(), 2);
+    cache.get(kTenant, kUrl, mostVoted).get();
+    EXPECT_EQ(fake.count(), 3);
+}
+
+TEST(CommentCacheTest, new_comments_and_state_changes_drop_the_thread) {
+    FakeComments fake;
+    CommentCache cache(fake.fetch());
+    cache.get(kTenant, kUrl, {}).get();
+    cache.get(kTenant, U("page-2"), {}).get();
+
+    cache.apply(kTenant, kUrl, event(EventType::NewComment, "new-comment"));
+    EXPECT_EQ(cache.stats().entries, 1u);
+    cache.get(kTenant, kUrl, {}).get();
+    cache.apply(kTenant, kUrl, event(EventType::ThreadStateChange, "thread-state-change"));
+    cache.apply(kTenant, kUrl, event(EventType::PresenceUpdate, "p-u"));
+    EXPECT_EQ(cache.stats().entries, 1u);
+    EXPECT_EQ(fake.count(), 3);
+
+    // The stream callbacks do the same, and a reconnect drops the thread.
+    cache.get(kTenant, kUrl, {}).get();
+    cache.eventHandler(kTenant, U("page-2"))(event(EventType::DeletedComment, "deleted-comment"));
+    EXPECT_EQ(cache.stats().entries, 1u);
+    cache.reconnectHandler(kTenant, kUrl)();
+    EXPECT_EQ(cache.stats().entries, 0u);
+}
+
+TEST(CommentCacheTest, a_response_requested_before_an_event_is_not_cached) {
+    FakeComments fake;
+    fake.hold = true;
+    CommentCache cache(fake.fetch());
+    auto pending = cache.get(kTenant, kUrl, {});
+    cache.apply(kTenant, kUrl, vote(EventType::NewVote, "new-vote", "c1", 1));
+    fake.release();
+    EXPECT_NE(pending.get(), nullptr);
+    EXPECT_EQ(cache.stats().entries, 0u);
+
+    fake.hold = false;
+    cache.get(kTenant, kUrl, {}).get();
+    EXPECT_EQ(cache.stats().entries, 1u);
+}
+
+TEST(CommentCacheTest, drops_the_least_recently_used) {
+    FakeComments fake;
+    CommentCacheOptions options;
+    options.maxEntries = 2;
+    CommentCache cache(fake.fetch(), options);
+    GetCommentsPublicOptions pages[3];
+    for (int i = 0; i < 3; ++i) pages[i].page = i;
+
+    cache.get(kTenant, kUrl, pages[0]).get();
+    cache.get(kTenant, kUrl, pages[1]).get();
+    cache.get(kTenant, kUrl, pages[0]).get();
+    cache.get(kTenant, kUrl, pages[2]).get();   // drops page 1
+    EXPECT_EQ(fake.count(), 3);
+    cache.get(kTenant, kUrl, pages[0]).get();
+    EXPECT_EQ(fake.count(), 3);
+    cache.get(kTenant, kUrl, pages[1]).get();
+    EXPECT_EQ(fake.count(), 4);
+}
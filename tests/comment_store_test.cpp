@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/store/comment_store.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using fastcomments::store::CommentStore;
+using fastcomments::store::CommentStoreOptions;
+using fastcomments::store::CommentView;
+using org::openapitools::client::model::PublicComment;
+
+namespace {
+
+constexpr int64_t kWindowsToUnixEpoch = 116444736000000000LL;
+
+utility::string_t str(const std::string& s) {
+    return utility::conversions::to_string_t(s);
+}
+
+std::string tempDir(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / ("fastcomments_" + name);
+    std::filesystem::remove_all(path);
+    return path.string();
+}
+
+std::shared_ptr<PublicComment> comment(const std::string& id, const std::string& html, int32_t votes = 0) {
+    auto c = std::make_shared<PublicComment>();
+    c->setId(str(id));
+    c->setCommenterName(str("Ana"));
+    c->setCommentHTML(str(html));
+    c->setDate(utility::datetime() + static_cast<utility::datetime::interval_type>(1700000000000LL * 10000 + kWindowsToUnixEpoch));
+    c->setVotes(votes);
+    c->setIsPinned(votes > 10);
+    return c;
+}
+
+std::vector<std::string> ids(const std::vector<CommentView>& views) {
+    std::vector<std::string> result;
+    for (const auto& view : views) result.emplace_back(view.id);
+    return result;
+}
+
+} // anonymous namespace
+
+TEST(CommentStoreTest, stores_threads_by_tenant_and_url) {
+    CommentStore store(tempDir("store_basic"));
+    store.put(str("t1"), str("page-a"), {comment("a1", "<p>one</p>"), comment("a2", "<p>two</p>", 20)});
+    store.put(str("t1"), str("page-b"), *comment("b1", "<p>other page</p>"));
+    store.put(str("t2"), str("page-a"), *comment("x1", "<p>other tenant</p>"));
+
+    EXPECT_EQ(ids(store.thread(str("t1"), str("page-a"))), (std::vector<std::string>{"a1", "a2"}));
+    EXPECT_EQ(store.threadSize(str("t1"), str("page-b")), 1u);
+    EXPECT_TRUE(store.thread(str("t1"), str("page-c")).empty());
+
+    const auto view = store.find(str("t1"), str("page-a"), str("a2"));
+    ASSERT_TRUE(view.is_initialized());
+    EXPECT_EQ(view->commentHTML, "<p>two</p>");
+    EXPECT_EQ(view->commenterName, "Ana");
+    EXPECT_EQ(view->votes, 20);
+    EXPECT_EQ(view->date, 1700000000000LL);
+    EXPECT_TRUE(view->has(CommentView::Pinned));
+    EXPECT_FALSE(view->has(CommentView::Locked));
+
+    const auto copy = view->toPublicComment();
+    EXPECT_EQ(copy->getId(), str("a2"));
+    EXPECT_EQ(copy->getCommentHTML(), str("<p>two</p>"));
+    EXPECT_TRUE(copy->isIsPinned());
+    EXPECT_EQ(copy->getDate(), comment("a2", "")->getDate());
+}
+
+TEST(CommentStoreTest, replaces_and_removes_in_place) {
+    CommentStore store(tempDir("store_replace"));
+    store.put(str("t"), str("u"), {comment("c1", "<p>1</p>"), comment("c2", "<p>2</p>"), comment("c3", "<p>3</p>")});
+    const auto before = store.find(str("t"), str("u"), str("c2"));
+
+    store.put(str("t"), str("u"), *comment("c2", "<p>edited</p>", 4));
+    EXPECT_EQ(ids(store.thread(str("t"), str("u"))), (std::vector<std::string>{"c1", "c2", "c3"}));
+    EXPECT_EQ(store.find(str("t"), str("u"), str("c2"))->commentHTML, "<p>edited</p>");
+    // Views of the old version still read the old bytes.
+    EXPECT_EQ(before->commentHTML, "<p>2</p>");
+
+    EXPECT_TRUE(store.remove(str("t"), str("u"), str("c1")));
+    EXPECT_FALSE(store.remove(str("t"), str("u"), str("c1")));
+    EXPECT_FALSE(store.find(str("t"), str("u"), str("c1")).is_initialized());
+    EXPECT_EQ(ids(store.thread(str("t"), str("u"))), (std::vector<std::string>{"c2", "c3"}));
+    EXPECT_EQ(store.stats().comments, 2u);
+    EXPECT_EQ(store.stats().records, 5u);
+}
+
+TEST(CommentStoreTest, reopens_with_the_same_contents) {
+    const auto dir = tempDir("store_reopen");
+    CommentStoreOptions options;
+    options.segmentBytes = 4096;
+    {
+        CommentStore store(dir, options);
+        for (int i = 0; i < 200; ++i) {
+            store.put(str("t"), str("u" + std::to_string(i % 3)),
+                      *comment("c" + std::to_string(i), "<p>" + std::string(static_cast<size_t>(i), 'x') + "</p>"));
+        }
+        store.remove(str("t"), str("u0"), str("c0"));
+        store.flush();
+        EXPECT_GT(store.stats().segments, 3u);
+    }
+    CommentStore store(dir, options);
+    EXPECT_EQ(store.stats().comments, 199u);
+    EXPECT_EQ(store.stats().threads, 3u);
+    EXPECT_EQ(store.threadSize(str("t"), str("u1")), 67u);
+    EXPECT_FALSE(store.find(str("t"), str("u0"), str("c0")).is_initialized());
+    EXPECT_EQ(store.find(str("t"), str("u2"), str("c197"))->commentHTML, "<p>" + std::string(197, 'x') + "</p>");
+
+    // Appends continue after what was there.
+    store.put(str("t"), str("u1"), *comment("new", "<p>new</p>"));
+    EXPECT_EQ(ids(store.thread(str("t"), str("u1"))).back(), "new");
+}
+
+TEST(CommentStoreTest, a_torn_record_ends_the_log) {
+    const auto dir = tempDir("store_torn");
+    {
+        CommentStore store(dir);
+        store.put(str("t"), str("u"), {comment("c1", "<p>kept</p>"), comment("c2", "<p>torn</p>")});
+        store.flush();
+    }
+    {
+        // Damage the last record's body.
+        const auto path = std::filesystem::path(dir) / "segment-000000.dat";
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        std::string head(4096, '\0');
+        file.read(&head[0], static_cast<std::streamsize>(head.size()));
+        const auto at = head.find("<p>torn</p>");
+        ASSERT_NE(at, std::string::npos);
+        file.clear();
+        file.seekp(static_cast<std::streamoff>(at));
+        file.write("<p>TORN", 7);
+    }
+    CommentStore store(dir);
+    EXPECT_EQ(ids(store.thread(str("t"), str("u"))), (std::vector<std::string>{"c1"}));
+    store.put(str("t"), str("u"), *comment("c3", "<p>after</p>"));
+    EXPECT_EQ(ids(store.thread(str("t"), str("u"))), (std::vector<std::string>{"c1", "c3"}));
+}
+
+TEST(CommentStoreTest, reads_while_another_thread_writes) {
+    CommentStoreOptions options;
+    options.segmentBytes = 8192;
+    CommentStore store(tempDir("store_concurrent"), options);
+    std::thread writer([&store]() {
+        for (int i = 0; i < 500; ++i) store.put(str("t"), str("u"), *comment("c" + std::to_string(i), "<p>body</p>"));
+    });
+    size_t last = 0;
+    while (last < 500) {
+        const auto views = store.thread(str("t"), str("u"));
+        EXPECT_GE(views.size(), last);
+        for (const auto& view : views) ASSERT_EQ(view.commentHTML, "<p>body</p>");
+        last = views.size();
+    }
+    writer.join();
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/store/comment_tree.hpp"
+
+#include <string>
+#include <vector>
+
+using fastcomments::live::EventType;
+using fastcomments::live::LiveEvent;
+using fastcomments::store::CommentOrder;
+using fastcomments::store::CommentTree;
+using org::openapitools::client::model::APIComment;
+using org::openapitools::client::model::PubSubComment;
+using org::openapitools::client::model::PublicComment;
+
+namespace {
+
+constexpr int64_t kWindowsToUnixEpoch = 116444736000000000LL;
+
+utility::string_t str(const std::string& s) {
+    return utility::conversions::to_string_t(s);
+}
+
+std::shared_ptr<PublicComment> comment(const std::string& id, const std::string& parentId, int64_t dateMs, int votes = 0) {
+    auto c = std::make_shared<PublicComment>();
+    c->setId(str(id));
+    if (!parentId.empty()) c->setParentId(str(parentId));
+    c->setDate(utility::datetime() + static_cast<utility::datetime::interval_type>(dateMs * 10000 + kWindowsToUnixEpoch));
+    c->setVotes(votes);
+    c->setCommentHTML(str("<p>" + id + "</p>"));
+    return c;
+}
+
+std::vector<std::string> ids(const std::vector<std::shared_ptr<PublicComment>>& comments) {
+    std::vector<std::string> result;
+    for (const auto& c : comments) result.push_back(utility::conversions::to_utf8string(c->getId()));
+    return result;
+}
+
+// "id@depth" for every comment in walk order.
+std::vector<std::string> walked(const CommentTree& tree) {
+    std::vector<std::string> result;
+    tree.walk([&](const std::shared_ptr<PublicComment>& c, int depth) {
+        result.push_back(utility::conversions::to_utf8string(c->getId()) + "@" + std::to_string(depth));
+        return true;
+    });
+    return result;
+}
+
+LiveEvent commentEvent(EventType type, const std::string& rawType, const PubSubComment& comment) {
+    LiveEvent event;
+    event.type = type;
+    event.rawType = rawType;
+    event.payload = web::json::value::object();
+    event.payload[U("type")] = web::json::value::string(str(rawType));
+    event.payload[U("comment")] = comment.toJson();
+    return event;
+}
+
+} // anonymous namespace
+
+TEST(CommentTreeTest, builds_sorted_tree_from_an_unordered_page) {
+    CommentTree tree(CommentOrder::Oldest);
+    // Replies arrive before their parents.
+    tree.upsert({comment("b1", "b", 40), comment("a", "", 10), comment("a2", "a", 30), comment("b", "", 20),
+                 comment("a1", "a", 25), comment("a1x", "a1", 50)});
+
+    EXPECT_EQ(walked(tree), (std::vector<std::string>{"a@0", "a1@1", "a1x@2", "a2@1", "b@0", "b1@1"}));
+    EXPECT_EQ(ids(tree.children()), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(ids(tree.children(str("a"))), (std::vector<std::string>{"a1", "a2"}));
+    EXPECT_EQ(tree.replyCount(str("a")), 3u);
+    EXPECT_EQ(tree.replyCount(), 6u);
+    EXPECT_EQ(tree.size(), 6u);
+    EXPECT_EQ(tree.detached(), 0u);
+}
+
+TEST(CommentTreeTest, holds_replies_until_their_parent_arrives) {
+    CommentTree tree;
+    tree.upsert(comment("r1", "p", 20));
+    tree.upsert(comment("r2", "r1", 30));
+    EXPECT_EQ(tree.size(), 0u);
+    EXPECT_EQ(tree.detached(), 2u);
+    EXPECT_TRUE(walked(tree).empty());
+    EXPECT_EQ(tree.find(str("r2"))->getParentId(), str("r1"));
+
+    tree.upsert(comment("p", "", 10));
+    EXPECT_EQ(walked(tree), (std::vector<std::string>{"p@0", "r1@1", "r2@2"}));
+    EXPECT_EQ(tree.replyCount(str("p")), 2u);
+    EXPECT_EQ(tree.detached(), 0u);
+}
+
+TEST(CommentTreeTest, updates_reorder_and_move_comments) {
+    CommentTree tree(CommentOrder::MostVotes);
+    tree.upsert({comment("a", "", 10, 5), comment("b", "", 20, 3), comment("c", "", 30, 3), comment("b1", "b", 40)});
+    // Equal votes: newer first.
+    EXPECT_EQ(ids(tree.children()), (std::vector<std::string>{"a", "c", "b"}));
+
+    tree.upsert(comment("c", "", 30, 9));
+    EXPECT_EQ(ids(tree.children()), (std::vector<std::string>{"c", "a", "b"}));
+
+    // Moving b under a takes its reply along.
+    tree.upsert(comment("b", "a", 20, 3));
+    EXPECT_EQ(ids(tree.children()), (std::vector<std::string>{"c", "a"}));
+    EXPECT_EQ(tree.replyCount(str("a")), 2u);
+    EXPECT_EQ(tree.size(), 4u);
+
+    // A comment can't become a reply to its own reply.
+    tree.upsert(comment("a", "b1", 10, 5));
+    EXPECT_EQ(ids(tree.children()), (std::vector<std::string>{"c"}));
+    EXPECT_EQ(tree.size(), 1u);
+    EXPECT_EQ(tree.detached(), 3u);
+    tree.upsert(comment("a", "", 10, 5));
+    EXPECT_EQ(tree.size(), 4u);
+}
+
+TEST(CommentTreeTest, removing_a_comment_removes_its_replies) {
+    CommentTree tree;
+    tree.upsert({comment("a", "", 10), comment("a1", "a", 20), comment("a1x", "a1", 30), comment("b", "", 40)});
+    EXPECT_TRUE(tree.remove(str("a1")));
+    EXPECT_FALSE(tree.remove(str("a1x")));
+    EXPECT_EQ(tree.find(str("a1x")), nullptr);
+    EXPECT_EQ(tree.replyCount(str("a")), 0u);
+    EXPECT_EQ(walked(tree), (std::vector<std::string>{"b@0", "a@0"}));
+}
+
+TEST(CommentTreeTest, nested_pages_and_api_comments_are_flattened) {
+    CommentTree tree(CommentOrder::Oldest);
+    auto top = comment("t", "", 10);
+    top->setChildren({comment("t1", "t", 20), comment("t2", "t", 30)});
+    tree.upsert(std::vector<std::shared_ptr<PublicComment>>{top});
+    EXPECT_TRUE(tree.find(str("t"))->getChildren().empty());
+    EXPECT_EQ(tree.replyCount(str("t")), 2u);
+
+    auto api = std::make_shared<APIComment>();
+    api->setId(str("t3"));
+    api->setParentId(str("t"));
+    api->setDate(15.0);   // epoch ms, between t and t1
+    api->setCommentHTML(str("<p>t3</p>"));
+    tree.upsert(std::vector<std::shared_ptr<APIComment>>{api});
+    EXPECT_EQ(ids(tree.children(str("t"))), (std::vector<std::string>{"t3", "t1", "t2"}));
+    EXPECT_EQ(tree.find(str("t3"))->getCommentHTML(), str("<p>t3</p>"));
+}
+
+TEST(CommentTreeTest, applies_comment_events) {
+    CommentTree tree(CommentOrder::Oldest);
+    tree.upsert(comment("a", "", 10));
+
+    PubSubComment reply;
+    reply.setId(str("r"));
+    reply.setParentId(str("a"));
+    reply.setCommentHTML(str("<p>hi</p>"));
+    reply.setDate(str("2024-01-01T00:00:00Z"));
+    EXPECT_TRUE(tree.apply(commentEvent(EventType::NewComment, "new-comment", reply)));
+    EXPECT_EQ(tree.replyCount(str("a")), 1u);
+
+    reply.setCommentHTML(str("<p>edited</p>"));
+    EXPECT_TRUE(tree.apply(commentEvent(EventType::UpdatedComment, "updated-comment", reply)));
+    EXPECT_EQ(tree.find(str("r"))->getCommentHTML(), str("<p>edited</p>"));
+
+    EXPECT_FALSE(tree.apply(commentEvent(EventType::NewVote, "new-vote", reply)));
+    EXPECT_TRUE(tree.apply(commentEvent(EventType::DeletedComment, "deleted-comment", reply)));
+    EXPECT_EQ(tree.size(), 1u);
+    EXPECT_FALSE(tree.apply(commentEvent(EventType::DeletedComment, "deleted-comment", reply)));
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/paging/comment_window.hpp"
+
+#include "FastCommentsClient/model/PublicComment.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using fastcomments::paging::CommentCursor;
+using fastcomments::paging::CommentPageFetch;
+using fastcomments::paging::CommentWindow;
+using fastcomments::paging::CommentWindowOptions;
+using fastcomments::paging::estimateBytes;
+using org::openapitools::client::model::PublicComment;
+
+namespace {
+
+using Comments = std::vector<std::shared_ptr<PublicComment>>;
+
+utility::string_t id(int i) {
+    return utility::conversions::to_string_t("c" + std::to_string(i));
+}
+
+// A thread of `size` comments c0, c1, ... A page after (before) a cursor
+// also repeats the `overlap` comments just before (after) it, the way pages
+// shift when comments are posted while someone scrolls.
+struct FakeThread {
+    int size = 100;
+    int overlap = 0;
+    int failures = 0;
+    std::mutex mu;
+    std::vector<std::string> requests;
+
+    static int indexOf(const utility::string_t& commentId) {
+        return std::stoi(utility::conversions::to_utf8string(commentId).substr(1));
+    }
+
+    CommentPageFetch fetch() {
+        return [this](const CommentCursor& cursor, int32_t limit) {
+            int begin = 0;
+            std::string request = "first";
+            if (cursor.afterCommentId) {
+                begin = indexOf(*cursor.afterCommentId) + 1 - overlap;
+                request = "after " + utility::conversions::to_utf8string(*cursor.afterCommentId);
+            } else if (cursor.beforeCommentId) {
+                begin = indexOf(*cursor.beforeCommentId) - limit;
+                request = "before " + utility::conversions::to_utf8string(*cursor.beforeCommentId);
+            }
+            int end = begin + limit;
+            begin = std::max(begin, 0);
+            end = std::min(end, size);
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                requests.push_back(request);
+                if (failures > 0) {
+                    --failures;
+                    return pplx::task_from_exception<Comments>(std::runtime_error("connection reset"));
+                }
+            }
+            Comments page;
+            for (int i = begin; i < end; ++i) {
+                auto comment = std::make_shared<PublicComment>();
+                comment->setId(id(i));
+                comment->setCommentHTML(utility::conversions::to_string_t("<p>comment " + std::to_string(i) + "</p>"));
+                page.push_back(comment);
+            }
+            return pplx::task_from_result(page);
+        };
+    }
+
+    std::vector<std::string> seen() {
+        std::lock_guard<std::mutex> lock(mu);
+        return requests;
+    }
+};
+
+std::vector<int> indexes(const Comments& comments) {
+    std::vector<int> result;
+    for (const auto& comment : comments) result.push_back(FakeThread::indexOf(comment->getId()));
+    return result;
+}
+
+std::vector<int> range(int from, int to) {
+    std::vector<int> result;
+    for (int i = from; i < to; ++i) result.push_back(i);
+    return result;
+}
+
+} // anonymous namespace
+
+TEST(CommentWindowTest, scrolls_forward_with_one_page_prefetched) {
+    FakeThread thread;
+    CommentWindowOptions options;
+    options.pageSize = 10;
+    CommentWindow window(thread.fetch(), options);
+
+    EXPECT_EQ(indexes(window.first(10).get()), range(0, 10));
+    EXPECT_EQ(indexes(window.after(id(9), 10).get()), range(10, 20));
+    EXPECT_EQ(indexes(window.after(id(19), 5).get()), range(20, 25));
+    // Each request left a full page ready after what it returned.
+    EXPECT_EQ(thread.seen(), (std::vector<std::string>{"first", "after c9", "after c19", "after c29"}));
+
+    // Scrolling back over what is held needs no request.
+    EXPECT_EQ(indexes(window.before(id(10), 10).get()), range(0, 10));
+    EXPECT_EQ(thread.seen().size(), 4u);
+    const auto stats = window.stats();
+    EXPECT_EQ(stats.requests, 4u);
+    EXPECT_GE(stats.hits, 1u);
+    EXPECT_EQ(stats.fetches, 4u);
+    EXPECT_EQ(stats.comments, 40u);
+}
+
+TEST(CommentWindowTest, stays_within_the_memory_budget) {
+    FakeThread thread;
+    thread.size = 1000;
+    CommentWindowOptions options;
+    options.pageSize = 10;
+    PublicComment sample;
+    sample.setId(id(500));
+    sample.setCommentHTML(utility::conversions::to_string_t("<p>comment 500</p>"));
+    const size_t pageBytes = 10 * estimateBytes(sample);
+    options.maxBytes = 3 * pageBytes;
+    CommentWindow window(thread.fetch(), options);
+
+    auto page = window.first(10).get();
+    for (int i = 1; i < 100; ++i) {
+        page = window.after(page.back()->getId(), 10).get();
+        ASSERT_EQ(indexes(page), range(10 * i, 10 * i + 10));
+        // At most the prefetched page on top of the budget.
+        EXPECT_LE(window.stats().bytes, options.maxBytes + pageBytes);
+    }
+    EXPECT_GT(window.stats().evictedPages, 90u);
+
+    // The start of the thread was dropped long ago: asking for it again
+    // starts a new window there.
+    EXPECT_EQ(indexes(window.before(id(500), 10).get()), range(490, 500));
+    const auto requests = thread.seen();
+    EXPECT_NE(std::find(requests.begin(), requests.end(), "before c500"), requests.end());
+    EXPECT_EQ(indexes(window.after(id(499), 3).get()), range(500, 503));
+}
+
+TEST(CommentWindowTest, overlapping_pages_are_deduplicated) {
+    FakeThread thread;
+    thread.overlap = 3;
+    CommentWindowOptions options;
+    options.pageSize = 10;
+    options.prefetchPages = 0;
+    CommentWindow window(thread.fetch(), options);
+
+    EXPECT_EQ(indexes(window.first(10).get()), range(0, 10));
+    EXPECT_EQ(indexes(window.after(id(9), 10).get()), range(10, 20));
+    EXPECT_EQ(indexes(window.before(id(20), 20).get()), range(0, 20));
+    EXPECT_EQ(window.stats().comments, 24u);
+}
+
+TEST(CommentWindowTest, stops_at_the_ends_of_the_thread) {
+    FakeThread thread;
+    thread.size = 25;
+    CommentWindowOptions options;
+    options.pageSize = 10;
+    CommentWindow window(thread.fetch(), options);
+
+    EXPECT_EQ(indexes(window.after(id(9), 30).get()), range(10, 25));
+    EXPECT_EQ(indexes(window.after(id(22), 10).get()), range(23, 25));
+    EXPECT_TRUE(window.after(id(24), 10).get().empty());
+    EXPECT_EQ(indexes(window.before(id(3), 10).get()), range(0, 3));
+    const auto requests = thread.seen();
+    EXPECT_EQ(requests.front(), "after c9");
+    EXPECT_EQ(requests.back(), "before c3");
+}
+
+TEST(CommentWindowTest, a_failed_fetch_fails_only_its_request) {
+    FakeThread thread;
+    thread.failures = 1;
+    CommentWindowOptions options;
+    options.pageSize = 10;
+    CommentWindow window(thread.fetch(), options);
+
+    EXPECT_THROW(window.first(10).get(), std::runtime_error);
+    EXPECT_EQ(indexes(window.first(10).get()), range(0, 10));
+}
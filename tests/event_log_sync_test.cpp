@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/sync/event_log_sync.hpp"
+
+#include "FastCommentsClient/model/EventLogEntry.h"
+#include "FastCommentsClient/model/PubSubComment.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using fastcomments::sync::EventLogFetch;
+using fastcomments::sync::EventLogSync;
+using fastcomments::sync::EventLogSyncOptions;
+using fastcomments::sync::MemoryReplica;
+using fastcomments::sync::SyncCheckpoint;
+using fastcomments::sync::SyncResult;
+using org::openapitools::client::model::EventLogEntry;
+
+namespace {
+
+utility::string_t str(const std::string& s) {
+    return utility::conversions::to_string_t(s);
+}
+
+std::string commentEvent(const std::string& type, const std::string& id, const std::string& text, int votes = 0) {
+    return "{\"type\":\"" + type + "\",\"comment\":{\"_id\":\"" + id + "\",\"urlId\":\"page-1\",\"comment\":\"" + text +
+           "\",\"votes\":" + std::to_string(votes) + ",\"votesUp\":" + std::to_string(votes) + ",\"votesDown\":0}}";
+}
+
+std::string voteEvent(const std::string& type, const std::string& commentId, int direction) {
+    return "{\"type\":\"" + type + "\",\"vote\":{\"_id\":\"v-" + commentId + "\",\"commentId\":\"" + commentId +
+           "\",\"direction\":" + std::to_string(direction) + "}}";
+}
+
+// An event log that answers [startTime, endTime] inclusively, oldest first,
+// with at most `cap` events per response.
+struct FakeEventLog {
+    struct Event {
+        std::string id;
+        int64_t createdAt;
+        std::string data;
+    };
+
+    std::mutex mu;
+    std::vector<Event> events;
+    size_t cap = 100;
+    std::vector<std::pair<int64_t, int64_t>> requests;
+
+    void add(const std::string& id, int64_t createdAt, const std::string& data) {
+        std::lock_guard<std::mutex> lock(mu);
+        events.push_back({id, createdAt, data});
+    }
+
+    EventLogFetch fetch() {
+        return [this](int64_t startTime, int64_t endTime) {
+            std::lock_guard<std::mutex> lock(mu);
+            requests.emplace_back(startTime, endTime);
+            auto sorted = events;
+            std::stable_sort(sorted.begin(), sorted.end(), [](const Event& a, const Event& b) { return a.createdAt < b.createdAt; });
+            std::vector<std::shared_ptr<EventLogEntry>> page;
+            for (const auto& event : sorted) {
+                if (event.createdAt < startTime || event.createdAt > endTime) continue;
+                if (page.size() == cap) break;
+                auto entry = std::make_shared<EventLogEntry>();
+                entry->setId(str(event.id));
+                entry->setCreatedAt(utility::datetime(static_cast<utility::datetime::interval_type>(
+                    event.createdAt * 10000 + 116444736000000000LL)));
+                entry->setData(str(event.data));
+                page.push_back(entry);
+            }
+            return pplx::task_from_result(page);
+        };
+    }
+};
+
+} // anonymous namespace
+
+TEST(EventLogSyncTest, applies_comment_and_vote_events_in_order) {
+    FakeEventLog log;
+    log.add("e3", 1002, voteEvent("new-vote", "c1", 1));
+    log.add("e1", 1000, commentEvent("new-comment", "c1", "first"));
+    log.add("e2", 1001, commentEvent("new-comment", "c2", "second"));
+    log.add("e4", 1003, commentEvent("updated-comment", "c1", "first, edited", 1));
+    log.add("e5", 1004, commentEvent("deleted-comment", "c2", ""));
+    log.add("e6", 1005, voteEvent("new-vote", "c1", -1));
+
+    MemoryReplica replica;
+    EventLogSync sync(log.fetch(), replica.store());
+    SyncResult result = sync.sync(2000).get();
+
+    EXPECT_EQ(result.applied, 6u);
+    EXPECT_EQ(replica.size(), 1u);
+    auto c1 = replica.find(str("c1"));
+    ASSERT_NE(c1, nullptr);
+    EXPECT_EQ(c1->getComment(), str("first, edited"));
+    EXPECT_EQ(c1->getVotes(), 0);
+    EXPECT_EQ(c1->getVotesUp(), 1);
+    EXPECT_EQ(c1->getVotesDown(), 1);
+    EXPECT_EQ(sync.checkpoint().timestamp, 1005);
+}
+
+TEST(EventLogSyncTest, overlapping_reads_apply_each_event_once) {
+    FakeEventLog log;
+    log.add("e1", 10000, commentEvent("new-comment", "c1", "hello"));
+    log.add("e2", 10500, voteEvent("new-vote", "c1", 1));
+
+    MemoryReplica replica;
+    EventLogSyncOptions options;
+    options.overlap = std::chrono::milliseconds(1000);
+    EventLogSync sync(log.fetch(), replica.store(), options);
+    EXPECT_EQ(sync.sync(11000).get().applied, 2u);
+
+    // Written late, with a time the last sync already read past, and a new one.
+    log.add("e3", 10200, voteEvent("new-vote", "c1", 1));
+    log.add("e4", 12000, voteEvent("new-vote", "c1", 1));
+    const size_t before = log.requests.size();
+    SyncResult second = sync.sync(13000).get();
+    EXPECT_EQ(second.applied, 2u);
+    EXPECT_GE(second.duplicates, 1u);
+    // The read starts one overlap before the newest applied event.
+    EXPECT_EQ(log.requests[before].first, 9500);
+    EXPECT_EQ(replica.find(str("c1"))->getVotes(), 3);
+
+    EXPECT_EQ(sync.sync(13000).get().applied, 0u);
+    EXPECT_EQ(replica.find(str("c1"))->getVotes(), 3);
+}
+
+TEST(EventLogSyncTest, reads_again_when_the_response_is_capped) {
+    FakeEventLog log;
+    log.cap = 3;
+    log.add("e0", 100, commentEvent("new-comment", "c1", "x"));
+    for (int i = 1; i < 10; ++i) log.add("e" + std::to_string(i), 100 + i, voteEvent("new-vote", "c1", 1));
+
+    MemoryReplica replica;
+    EventLogSyncOptions options;
+    options.overlap = std::chrono::milliseconds(0);
+    EventLogSync sync(log.fetch(), replica.store(), options);
+    SyncResult result = sync.sync(1000).get();
+    EXPECT_EQ(result.applied, 10u);
+    EXPECT_GE(result.requests, 4u);
+    EXPECT_EQ(replica.find(str("c1"))->getVotes(), 9);
+}
+
+TEST(EventLogSyncTest, pages_past_a_capped_response_with_the_default_overlap) {
+    FakeEventLog log;
+    log.cap = 3;
+    log.add("e0", 100, commentEvent("new-comment", "c1", "x"));
+    for (int i = 1; i < 10; ++i) log.add("e" + std::to_string(i), 100 + i, voteEvent("new-vote", "c1", 1));
+
+    MemoryReplica replica;
+    EventLogSync sync(log.fetch(), replica.store());
+    // The overlap re-reads applied events; they must not end the sync.
+    SyncResult first = sync.sync(1000).get();
+    SyncResult second = sync.sync(1000).get();
+    EXPECT_EQ(first.applied + second.applied, 10u);
+    EXPECT_EQ(first.applied, 10u);
+    EXPECT_EQ(replica.find(str("c1"))->getVotes(), 9);
+    // Follow-up reads start at the newest event returned, not the overlap.
+    EXPECT_EQ(log.requests[1].first, 102);
+}
+
+TEST(EventLogSyncTest, the_checkpoint_survives_a_restart) {
+    const std::string path = testing::TempDir() + "event_log_sync.checkpoint";
+    std::remove(path.c_str());
+    FakeEventLog log;
+    log.add("e1", 5000, commentEvent("new-comment", "c1", "x"));
+    log.add("e2", 5001, voteEvent("new-vote", "c1", 1));
+    log.add("e3", 5002, "not json");
+
+    EventLogSyncOptions options;
+    options.checkpointPath = path;
+    {
+        MemoryReplica replica;
+        EventLogSync sync(log.fetch(), replica.store(), options);
+        SyncResult result = sync.sync(6000).get();
+        EXPECT_EQ(result.applied, 2u);
+        EXPECT_EQ(result.undecodable, 1u);
+    }
+
+    SyncCheckpoint saved;
+    ASSERT_TRUE(SyncCheckpoint::read(path, saved));
+    EXPECT_EQ(saved.timestamp, 5002);
+    EXPECT_EQ(saved.recent.size(), 3u);
+
+    int votes = 0;
+    fastcomments::sync::ReplicaStore counting;
+    counting.applyVote = [&](const org::openapitools::client::model::PubSubVote&, bool) { ++votes; };
+    EventLogSync restarted(log.fetch(), counting, options);
+    SyncResult result = restarted.sync(6000).get();
+    EXPECT_EQ(result.applied, 0u);
+    EXPECT_EQ(result.duplicates, 3u);
+    EXPECT_EQ(votes, 0);
+    std::remove(path.c_str());
+}
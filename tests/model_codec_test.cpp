@@ -0,0 +1,434 @@
+#include <gtest/gtest.h>
+
+#include "FastCommentsClient/BinaryCodec.h"
+#include "FastCommentsClient/JsonBody.h"
+#include "FastCommentsClient/JsonWriter.h"
+#include "FastCommentsClient/ModelBase.h"
+#include "FastCommentsClient/StringInternTable.h"
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/APICommentBase_meta.h"
+#include "FastCommentsClient/model/APITenant.h"
+#include "FastCommentsClient/model/BulkAggregateQuestionResultsResponse.h"
+#include "FastCommentsClient/model/GetDomainConfigsResponse.h"
+
+#include <cpprest/details/basic_types.h>
+#include <cpprest/json.h>
+
+#include <map>
+#include <sstream>
+#include <vector>
+
+using org::openapitools::client::model::APIComment;
+using org::openapitools::client::model::APICommentBase_meta;
+using org::openapitools::client::model::APITenant;
+using org::openapitools::client::model::BulkAggregateQuestionResultsResponse;
+using org::openapitools::client::model::GetDomainConfigsResponse;
+using org::openapitools::client::model::BinaryWireType;
+using org::openapitools::client::model::BinaryWriter;
+using org::openapitools::client::model::InternedString;
+using org::openapitools::client::model::JsonBody;
+using org::openapitools::client::model::JsonWriter;
+using org::openapitools::client::model::ModelBase;
+using org::openapitools::client::model::StringInternTable;
+
+namespace {
+
+web::json::value parse(const char* json) {
+    return web::json::value::parse(utility::conversions::to_string_t(json));
+}
+
+const char* kComment = R"({
+    "id": "c1",
+    "tenantId": "t1",
+    "urlId": "page-1",
+    "url": "https://example.com/page-1",
+    "commenterName": "Ann",
+    "comment": "hello",
+    "commentHTML": "<p>hello</p>",
+    "date": 1700000000000,
+    "votes": 4,
+    "votesUp": 5,
+    "votesDown": 1,
+    "approved": true,
+    "isSpam": false,
+    "parentId": null,
+    "someFutureField": {"nested": [1, 2, 3]},
+    "badges": [{"id": "b1", "type": 2, "displayLabel": "Top"}],
+    "feedbackIds": ["f1", "f2"],
+    "meta": {"wpUserId": "7", "custom": "x"}
+})";
+
+} // anonymous namespace
+
+TEST(ModelCodecTest, fieldHash_is_the_same_at_compile_time_and_run_time) {
+    constexpr uint32_t compileTime = ModelBase::fieldHash(_XPLATSTR("commenterName"));
+    EXPECT_EQ(compileTime, ModelBase::fieldHash(utility::conversions::to_string_t("commenterName")));
+    EXPECT_NE(ModelBase::fieldHash(_XPLATSTR("url")), ModelBase::fieldHash(_XPLATSTR("urlId")));
+}
+
+TEST(ModelCodecTest, fromJson_decodes_known_fields_and_skips_unknown_ones) {
+    APIComment comment;
+    ASSERT_TRUE(comment.fromJson(parse(kComment)));
+
+    EXPECT_EQ(comment.getId(), utility::conversions::to_string_t("c1"));
+    EXPECT_EQ(comment.getTenantId(), utility::conversions::to_string_t("t1"));
+    EXPECT_EQ(comment.getUrlId(), utility::conversions::to_string_t("page-1"));
+    EXPECT_EQ(comment.getCommenterName(), utility::conversions::to_string_t("Ann"));
+    EXPECT_EQ(comment.getCommentHTML(), utility::conversions::to_string_t("<p>hello</p>"));
+    EXPECT_DOUBLE_EQ(comment.getDate(), 1700000000000.0);
+    EXPECT_EQ(comment.getVotes(), 4);
+    EXPECT_EQ(comment.getVotesUp(), 5);
+    EXPECT_EQ(comment.getVotesDown(), 1);
+    EXPECT_TRUE(comment.isApproved());
+    EXPECT_TRUE(comment.isSpamIsSet());
+    EXPECT_FALSE(comment.isIsSpam());
+    ASSERT_EQ(comment.getBadges().size(), 1u);
+    EXPECT_EQ(comment.getBadges()[0]->getDisplayLabel(), utility::conversions::to_string_t("Top"));
+    EXPECT_EQ(comment.getFeedbackIds().size(), 2u);
+    ASSERT_TRUE(comment.metaIsSet());
+    EXPECT_EQ(comment.getMeta()->getWpUserId(), utility::conversions::to_string_t("7"));
+}
+
+TEST(ModelCodecTest, fromJson_leaves_null_and_missing_fields_unset) {
+    APIComment comment;
+    ASSERT_TRUE(comment.fromJson(parse(kComment)));
+
+    EXPECT_FALSE(comment.parentIdIsSet());
+    EXPECT_FALSE(comment.avatarSrcIsSet());
+    EXPECT_FALSE(comment.verifiedDateIsSet());
+}
+
+TEST(ModelCodecTest, fromJson_ignores_non_object_values) {
+    APIComment comment;
+    EXPECT_TRUE(comment.fromJson(parse("[1, 2]")));
+    EXPECT_FALSE(comment.idIsSet());
+}
+
+TEST(ModelCodecTest, fromJson_keeps_additional_properties) {
+    APICommentBase_meta meta;
+    ASSERT_TRUE(meta.fromJson(parse(R"({"wpUserId": "7", "wpPostId": null, "custom": "x"})")));
+
+    EXPECT_EQ(meta.getWpUserId(), utility::conversions::to_string_t("7"));
+    EXPECT_FALSE(meta.wpPostIdIsSet());
+    auto additional = meta.getAdditionalProperties();
+    ASSERT_EQ(additional.size(), 1u);
+    EXPECT_EQ(additional.begin()->first, utility::conversions::to_string_t("custom"));
+}
+
+TEST(ModelCodecTest, default_constructed_model_has_no_fields_set) {
+    APIComment comment;
+    EXPECT_FALSE(comment.idIsSet());
+    EXPECT_FALSE(comment.votesIsSet());
+    EXPECT_FALSE(comment.approvedIsSet());
+    EXPECT_TRUE(comment.getId().empty());
+    EXPECT_EQ(comment.getVotes(), 0);
+    EXPECT_EQ(comment.toJson().as_object().size(), 0u);
+}
+
+TEST(ModelCodecTest, set_and_unset_track_presence_per_field) {
+    APIComment comment;
+    comment.setVotes(3);
+    comment.setCommenterName(utility::conversions::to_string_t("Ann"));
+    EXPECT_TRUE(comment.votesIsSet());
+    EXPECT_TRUE(comment.commenterNameIsSet());
+    EXPECT_FALSE(comment.votesUpIsSet());
+
+    comment.unsetVotes();
+    EXPECT_FALSE(comment.votesIsSet());
+    EXPECT_TRUE(comment.commenterNameIsSet());
+
+    web::json::value json = comment.toJson();
+    EXPECT_FALSE(json.has_field(utility::conversions::to_string_t("votes")));
+    EXPECT_TRUE(json.has_field(utility::conversions::to_string_t("commenterName")));
+}
+
+TEST(ModelCodecTest, writeJson_matches_toJson) {
+    APIComment comment;
+    ASSERT_TRUE(comment.fromJson(parse(kComment)));
+
+    JsonWriter writer;
+    comment.writeJson(writer);
+    web::json::value streamed = web::json::value::parse(utility::conversions::to_string_t(writer.str()));
+    EXPECT_EQ(streamed.serialize(), comment.toJson().serialize());
+}
+
+TEST(ModelCodecTest, writeJson_escapes_strings) {
+    JsonWriter writer;
+    writer.beginObject();
+    writer.key(_XPLATSTR("text"));
+    writer.value(utility::conversions::to_string_t("say \"hi\"\\\n\t\x01"));
+    writer.key(_XPLATSTR("list"));
+    writer.beginArray();
+    writer.value(int32_t(1));
+    writer.null();
+    writer.value(2.5);
+    writer.value(true);
+    writer.endArray();
+    writer.endObject();
+    EXPECT_EQ(writer.str(), "{\"text\":\"say \\\"hi\\\"\\\\\\n\\t\\u0001\",\"list\":[1,null,2.5,true]}");
+}
+
+TEST(ModelCodecTest, JsonBody_streams_vectors_of_models) {
+    auto first = std::make_shared<APIComment>();
+    first->setId(utility::conversions::to_string_t("a"));
+    first->setVotes(2);
+    std::vector<std::shared_ptr<APIComment>> comments{first, nullptr};
+
+    JsonBody body(comments);
+    std::stringstream out;
+    body.writeTo(out);
+    EXPECT_EQ(out.str(), "[{\"id\":\"a\",\"votes\":2},null]");
+}
+
+TEST(ModelCodecTest, binary_round_trip_preserves_fields) {
+    APIComment comment;
+    ASSERT_TRUE(comment.fromJson(parse(kComment)));
+    comment.setVerifiedDate(utility::datetime::from_string(
+        utility::conversions::to_string_t("2024-05-01T10:20:30.5Z"), utility::datetime::ISO_8601));
+
+    std::string encoded = comment.toBinary();
+    APIComment decoded;
+    ASSERT_TRUE(decoded.fromBinary(encoded));
+    EXPECT_EQ(decoded.toJson().serialize(), comment.toJson().serialize());
+    EXPECT_EQ(decoded.getVerifiedDate().to_interval(), comment.getVerifiedDate().to_interval());
+    EXPECT_FALSE(decoded.parentIdIsSet());
+    EXPECT_LT(encoded.size(), utility::conversions::to_utf8string(comment.toJson().serialize()).size());
+}
+
+TEST(ModelCodecTest, binary_keeps_additional_properties) {
+    APICommentBase_meta meta;
+    ASSERT_TRUE(meta.fromJson(parse(R"({"wpUserId": "7", "custom": {"a": [1, 2]}})")));
+
+    APICommentBase_meta decoded;
+    ASSERT_TRUE(decoded.fromBinary(meta.toBinary()));
+    EXPECT_EQ(decoded.getWpUserId(), utility::conversions::to_string_t("7"));
+    ASSERT_EQ(decoded.getAdditionalProperties().size(), 1u);
+    EXPECT_EQ(decoded.toJson().serialize(), meta.toJson().serialize());
+}
+
+TEST(ModelCodecTest, binary_skips_unknown_fields) {
+    BinaryWriter writer;
+    writer.writeByte(org::openapitools::client::model::kBinaryMagic);
+    writer.writeByte(org::openapitools::client::model::kBinaryFormatVersion);
+    ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("someFutureField")), utility::conversions::to_string_t("x"));
+    ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("futureList")), std::vector<int64_t>{1, 2, 3});
+    ModelBase::writeBinary(writer, ModelBase::fieldHash(_XPLATSTR("votes")), int32_t(-3));
+
+    APIComment decoded;
+    ASSERT_TRUE(decoded.fromBinary(writer.data()));
+    EXPECT_EQ(decoded.getVotes(), -3);
+}
+
+TEST(ModelCodecTest, binary_rejects_other_versions_and_truncated_data) {
+    APIComment comment;
+    ASSERT_TRUE(comment.fromJson(parse(kComment)));
+    std::string encoded = comment.toBinary();
+
+    std::string otherVersion = encoded;
+    otherVersion[1] = static_cast<char>(org::openapitools::client::model::kBinaryFormatVersion + 1);
+    APIComment decoded;
+    EXPECT_FALSE(decoded.fromBinary(otherVersion));
+    EXPECT_FALSE(decoded.fromBinary(encoded.substr(0, encoded.size() - 3)));
+    EXPECT_FALSE(decoded.fromBinary(std::string()));
+}
+
+TEST(ModelCodecTest, binary_rejects_counts_past_the_end_of_the_block) {
+    BinaryWriter writer;
+    writer.writeByte(org::openapitools::client::model::kBinaryMagic);
+    writer.writeByte(org::openapitools::client::model::kBinaryFormatVersion);
+    writer.fieldHeader(ModelBase::fieldHash(_XPLATSTR("feedbackIds")), BinaryWireType::Block);
+    const size_t block = writer.beginBlock();
+    writer.writeVarint(uint64_t(1) << 60);
+    writer.writeString(utility::conversions::to_string_t("f1"));
+    writer.endBlock(block);
+
+    APIComment decoded;
+    EXPECT_FALSE(decoded.fromBinary(writer.data()));
+}
+
+TEST(ModelCodecTest, binary_rejects_additional_properties_that_are_not_json) {
+    BinaryWriter writer;
+    writer.writeByte(org::openapitools::client::model::kBinaryMagic);
+    writer.writeByte(org::openapitools::client::model::kBinaryFormatVersion);
+    writer.fieldHeader(ModelBase::fieldHash(_XPLATSTR("custom")), BinaryWireType::Named);
+    writer.writeString(utility::conversions::to_string_t("custom"));
+    writer.writeString(utility::conversions::to_string_t("{not json"));
+
+    APICommentBase_meta decoded;
+    EXPECT_FALSE(decoded.fromBinary(writer.data()));
+}
+
+TEST(ModelCodecTest, intern_table_shares_storage_for_equal_values) {
+    StringInternTable table;
+    InternedString a = table.intern(utility::conversions::to_string_t("demo-tenant"));
+    InternedString b = table.intern(utility::conversions::to_string_t("demo-tenant"));
+    InternedString other = table.intern(utility::conversions::to_string_t("other"));
+    InternedString copy(utility::conversions::to_string_t("demo-tenant"));
+
+    EXPECT_TRUE(a.sharesStorageWith(b));
+    EXPECT_FALSE(a.sharesStorageWith(copy));
+    EXPECT_EQ(a, copy);
+    EXPECT_NE(a, other);
+    EXPECT_TRUE(table.intern(utility::string_t()).empty());
+    EXPECT_EQ(table.size(), 2u);
+
+    other = InternedString();
+    table.prune();
+    EXPECT_EQ(table.size(), 1u);
+}
+
+TEST(ModelCodecTest, decoders_intern_repeated_comment_fields) {
+    StringInternTable table;
+    {
+        StringInternTable::Scope scope(table);
+        APIComment first;
+        APIComment second;
+        ASSERT_TRUE(first.fromJson(parse(kComment)));
+        ASSERT_TRUE(second.fromBinary(first.toBinary()));
+        EXPECT_EQ(&StringInternTable::current(), &table);
+
+        // tenantId, urlId, url and commenterName, once each for both comments.
+        EXPECT_EQ(table.size(), 4u);
+        EXPECT_EQ(second.getTenantId(), utility::conversions::to_string_t("t1"));
+        EXPECT_TRUE(second.urlIdIsSet());
+        EXPECT_FALSE(second.pageTitleIsSet());
+        EXPECT_EQ(second.toJson().serialize(), first.toJson().serialize());
+
+        second.setTenantId(utility::conversions::to_string_t("t2"));
+        EXPECT_EQ(second.getTenantId(), utility::conversions::to_string_t("t2"));
+        EXPECT_EQ(table.size(), 4u);
+    }
+    EXPECT_EQ(&StringInternTable::current(), &StringInternTable::shared());
+    table.prune();
+    EXPECT_EQ(table.size(), 0u);
+}
+
+TEST(ModelCodecTest, iso8601_parses_offsets_fractions_and_date_only_values) {
+    auto format = [](const char* text) {
+        utility::datetime parsed;
+        if (!ModelBase::parseDateTime(utility::conversions::to_string_t(text), parsed)) {
+            return std::string("invalid");
+        }
+        return utility::conversions::to_utf8string(ModelBase::formatDateTime(parsed));
+    };
+    EXPECT_EQ(format("2024-05-01T10:20:30.512Z"), "2024-05-01T10:20:30.512Z");
+    EXPECT_EQ(format("2024-05-01T10:20:30.5000000Z"), "2024-05-01T10:20:30.5Z");
+    EXPECT_EQ(format("2024-05-01T10:20:30.123456789Z"), "2024-05-01T10:20:30.1234567Z");
+    EXPECT_EQ(format("2024-02-29T00:00:00+05:30"), "2024-02-28T18:30:00Z");
+    EXPECT_EQ(format("2024-05-01T10:20:30-0700"), "2024-05-01T17:20:30Z");
+    EXPECT_EQ(format("2024-05-01T10:20Z"), "2024-05-01T10:20:00Z");
+    EXPECT_EQ(format("2024-05-01"), "2024-05-01T00:00:00Z");
+    EXPECT_EQ(format("1969-12-31T23:59:59Z"), "1969-12-31T23:59:59Z");
+
+    EXPECT_EQ(format("2023-02-29T00:00:00Z"), "invalid");
+    EXPECT_EQ(format("2024-05-01T24:00:00Z"), "invalid");
+    EXPECT_EQ(format("2024-05-01T10:20:30+24:00"), "invalid");
+    EXPECT_EQ(format("2024-05-01T10:20:30-0560"), "invalid");
+    EXPECT_EQ(format("2024-05-01T10:20:30.Z"), "invalid");
+    EXPECT_EQ(format("2024-05-01T10:20:30Zjunk"), "invalid");
+    EXPECT_EQ(format("May 1 2024"), "invalid");
+}
+
+TEST(ModelCodecTest, datetime_fields_round_trip_through_json) {
+    APIComment comment;
+    // The malformed date fails the decode but leaves the other fields in place.
+    EXPECT_FALSE(comment.fromJson(parse(R"({"verifiedDate": "2024-05-01T10:20:30.25+02:00", "expireAt": "not a date"})")));
+    EXPECT_EQ(utility::conversions::to_utf8string(comment.toJson().at(_XPLATSTR("verifiedDate")).as_string()),
+              "2024-05-01T08:20:30.25Z");
+    EXPECT_FALSE(comment.getExpireAt().is_initialized());
+}
+
+TEST(ModelCodecTest, fromString_parses_whole_numbers_only) {
+    int64_t integer = 0;
+    EXPECT_TRUE(ModelBase::fromString(utility::conversions::to_string_t(" +1700000000000 "), integer));
+    EXPECT_EQ(integer, 1700000000000);
+    EXPECT_FALSE(ModelBase::fromString(utility::conversions::to_string_t("12abc"), integer));
+    EXPECT_EQ(integer, 1700000000000);
+
+    int32_t small = 0;
+    EXPECT_FALSE(ModelBase::fromString(utility::conversions::to_string_t("4294967296"), small));
+
+    double real = 0;
+    EXPECT_TRUE(ModelBase::fromString(utility::conversions::to_string_t("0.8125"), real));
+    EXPECT_EQ(real, 0.8125);
+    EXPECT_TRUE(ModelBase::fromString(utility::conversions::to_string_t("7"), real));
+    EXPECT_EQ(real, 7.0);
+
+    bool flag = false;
+    EXPECT_TRUE(ModelBase::fromString(utility::conversions::to_string_t("true"), flag));
+    EXPECT_TRUE(flag);
+    EXPECT_TRUE(ModelBase::fromString(utility::conversions::to_string_t("0"), flag));
+    EXPECT_FALSE(flag);
+    EXPECT_FALSE(ModelBase::fromString(utility::conversions::to_string_t("yes"), flag));
+
+    EXPECT_EQ(ModelBase::toString(0.1), utility::conversions::to_string_t("0.1"));
+    EXPECT_EQ(ModelBase::toString(int64_t(-5)), utility::conversions::to_string_t("-5"));
+}
+
+TEST(ModelCodecTest, fromString_map_uses_the_object_keys) {
+    std::map<utility::string_t, int32_t> counts;
+    EXPECT_TRUE(ModelBase::fromString(utility::conversions::to_string_t(R"({"1": 4, "5": 9})"), counts));
+    ASSERT_EQ(counts.size(), 2u);
+    EXPECT_EQ(counts[utility::conversions::to_string_t("1")], 4);
+    EXPECT_EQ(counts[utility::conversions::to_string_t("5")], 9);
+
+    std::map<utility::string_t, int32_t> notAMap;
+    EXPECT_FALSE(ModelBase::fromString(utility::conversions::to_string_t("[1, 2]"), notAMap));
+    EXPECT_TRUE(notAMap.empty());
+}
+
+TEST(ModelCodecTest, nested_maps_decode_with_their_keys_and_values) {
+    BulkAggregateQuestionResultsResponse response;
+    ASSERT_TRUE(response.fromJson(parse(R"({
+        "status": "success",
+        "data": {
+            "q2": {"total": 2, "countsByValue": {"1": 2}},
+            "q1": {"total": 7, "average": 3.5, "countsByValue": {"3": 4, "5": 3},
+                   "dataByUrlId": {"page-b": {"v": {"5": 1.0}, "total": 1}, "page-a": {"v": {"3": 0.5, "5": 0.5}, "total": 6}}}
+        }
+    })")));
+    auto data = response.getData();
+    ASSERT_EQ(data.size(), 2u);
+    auto q1 = data[utility::conversions::to_string_t("q1")];
+    ASSERT_NE(q1, nullptr);
+    EXPECT_EQ(q1->getTotal(), 7);
+    auto counts = q1->getCountsByValue();
+    EXPECT_EQ(counts[utility::conversions::to_string_t("3")], 4);
+    EXPECT_EQ(counts[utility::conversions::to_string_t("5")], 3);
+    auto byUrl = q1->getDataByUrlId();
+    ASSERT_EQ(byUrl.size(), 2u);
+    EXPECT_EQ(byUrl.begin()->first, utility::conversions::to_string_t("page-a"));
+    EXPECT_EQ(byUrl.begin()->second->getTotal(), 6);
+    EXPECT_EQ(byUrl.begin()->second->getV().size(), 2u);
+    EXPECT_EQ(data[utility::conversions::to_string_t("q2")]->getTotal(), 2);
+
+    BulkAggregateQuestionResultsResponse copy;
+    ASSERT_TRUE(copy.fromJson(response.toJson()));
+    EXPECT_EQ(copy.toJson().serialize(), response.toJson().serialize());
+}
+
+TEST(ModelCodecTest, vectors_decode_in_order_and_append_to_existing_items) {
+    APITenant tenant;
+    ASSERT_TRUE(tenant.fromJson(parse(R"({"id": "t", "domainConfiguration": [
+        {"id": "c1", "domain": "a.example.com", "emailHeaders": {"X-A": "1"}},
+        {"id": "c2", "domain": "b.example.com"},
+        {"id": "c3", "domain": "c.example.com"}
+    ]})")));
+    auto configs = tenant.getDomainConfiguration();
+    ASSERT_EQ(configs.size(), 3u);
+    EXPECT_EQ(configs[0]->getDomain(), utility::conversions::to_string_t("a.example.com"));
+    EXPECT_EQ(configs[0]->getEmailHeaders().at(utility::conversions::to_string_t("X-A")), utility::conversions::to_string_t("1"));
+    EXPECT_EQ(configs[2]->getId(), utility::conversions::to_string_t("c3"));
+
+    std::vector<int64_t> values = {1};
+    EXPECT_TRUE(ModelBase::fromJson(parse("[2, 3]"), values));
+    EXPECT_EQ(values, (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_FALSE(ModelBase::fromJson(parse(R"({"a": 1})"), values));
+
+    GetDomainConfigsResponse domains;
+    ASSERT_TRUE(domains.fromJson(parse(R"({"configurations": {"a.example.com": {"id": "c1"}}, "status": {}})")));
+    ASSERT_NE(domains.getConfigurations(), nullptr);
+    EXPECT_EQ(domains.getConfigurations()->getValue(utility::conversions::to_string_t("a.example.com"))
+                  .at(utility::conversions::to_string_t("id")).as_string(),
+              utility::conversions::to_string_t("c1"));
+}
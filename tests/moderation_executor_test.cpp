@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/batch/moderation_executor.hpp"
+
+#include "FastCommentsClient/ApiException.h"
+#include "FastCommentsClient/model/ModerationAPIComment.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using fastcomments::batch::ModerationAction;
+using fastcomments::batch::ModerationBackend;
+using fastcomments::batch::ModerationExecutor;
+using fastcomments::batch::ModerationOptions;
+using fastcomments::batch::ModerationProgress;
+using org::openapitools::client::api::ApiException;
+using org::openapitools::client::model::ModerationAPIComment;
+
+namespace {
+
+utility::string_t id(int i) {
+    return utility::conversions::to_string_t("c" + std::to_string(i));
+}
+
+// Approves comments after a short delay. failures[id] lists the HTTP statuses
+// the first attempts fail with.
+struct FakeModeration {
+    std::mutex mu;
+    int active = 0;
+    int maxActive = 0;
+    std::map<utility::string_t, int> calls;
+    std::map<utility::string_t, std::vector<int>> failures;
+    std::vector<std::vector<utility::string_t>> lookups;
+    std::map<utility::string_t, bool> approved;
+
+    ModerationBackend backend() {
+        ModerationBackend backend;
+        backend.apply = [this](const ModerationAction&, const utility::string_t& commentId) {
+            int status = 0;
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                maxActive = std::max(maxActive, ++active);
+                auto& pending = failures[commentId];
+                if (!pending.empty()) {
+                    status = pending.front();
+                    pending.erase(pending.begin());
+                }
+                ++calls[commentId];
+            }
+            return pplx::create_task([this, status]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                {
+                    std::lock_guard<std::mutex> lock(mu);
+                    --active;
+                }
+                if (status != 0) throw ApiException(status, utility::conversions::to_string_t("HTTP " + std::to_string(status)));
+            });
+        };
+        backend.lookup = [this](const std::vector<utility::string_t>& ids) {
+            std::vector<std::shared_ptr<ModerationAPIComment>> found;
+            std::lock_guard<std::mutex> lock(mu);
+            lookups.push_back(ids);
+            for (const auto& commentId : ids) {
+                auto it = approved.find(commentId);
+                if (it == approved.end()) continue;
+                auto comment = std::make_shared<ModerationAPIComment>();
+                comment->setId(commentId);
+                comment->setApproved(it->second);
+                found.push_back(comment);
+            }
+            return pplx::task_from_result(found);
+        };
+        return backend;
+    }
+};
+
+} // anonymous namespace
+
+TEST(ModerationExecutorTest, applies_each_comment_once_with_bounded_concurrency) {
+    FakeModeration fake;
+    ModerationOptions options;
+    options.concurrency = 4;
+    std::vector<size_t> done;
+    options.onProgress = [&](const ModerationProgress& progress) { done.push_back(progress.done); };
+
+    std::vector<utility::string_t> ids;
+    for (int i = 0; i < 40; ++i) ids.push_back(id(i));
+    ids.push_back(id(3));   // duplicates are acted on once
+
+    auto report = ModerationExecutor(fake.backend(), options).run(ids, ModerationAction::approve()).get();
+    EXPECT_EQ(report.succeeded.size(), 40u);
+    EXPECT_TRUE(report.failures.empty());
+    EXPECT_EQ(fake.calls.size(), 40u);
+    EXPECT_EQ(fake.calls[id(3)], 1);
+    EXPECT_EQ(fake.maxActive, 4);
+    ASSERT_EQ(done.size(), 40u);
+    EXPECT_EQ(done.back(), 40u);
+    EXPECT_TRUE(std::is_sorted(done.begin(), done.end()));
+}
+
+TEST(ModerationExecutorTest, retries_server_errors_but_not_client_errors) {
+    FakeModeration fake;
+    fake.failures[id(1)] = {503, 502};
+    fake.failures[id(2)] = {403};
+    fake.failures[id(3)] = {500, 500, 500};
+    ModerationOptions options;
+    options.retryDelay = std::chrono::milliseconds(1);
+
+    auto report = ModerationExecutor(fake.backend(), options)
+                      .run({id(1), id(2), id(3), id(4)}, ModerationAction::markSpam())
+                      .get();
+    EXPECT_EQ(fake.calls[id(1)], 3);
+    EXPECT_EQ(fake.calls[id(2)], 1);
+    EXPECT_EQ(fake.calls[id(3)], 3);
+    EXPECT_EQ(report.succeeded.size(), 2u);
+    ASSERT_EQ(report.failures.size(), 2u);
+    std::sort(report.failures.begin(), report.failures.end(),
+              [](const auto& a, const auto& b) { return a.commentId < b.commentId; });
+    EXPECT_EQ(report.failures[0].commentId, id(2));
+    EXPECT_EQ(report.failures[0].attempts, 1);
+    EXPECT_EQ(report.failures[1].commentId, id(3));
+    EXPECT_EQ(report.failures[1].attempts, 3);
+}
+
+TEST(ModerationExecutorTest, skips_comments_already_in_the_target_state) {
+    FakeModeration fake;
+    for (int i = 0; i < 250; ++i) fake.approved[id(i)] = i % 2 == 0;
+    ModerationOptions options;
+    options.skipUnchanged = true;
+
+    std::vector<utility::string_t> ids;
+    for (int i = 0; i < 260; ++i) ids.push_back(id(i));   // the last ten don't exist
+    auto report = ModerationExecutor(fake.backend(), options).run(ids, ModerationAction::approve()).get();
+
+    EXPECT_EQ(fake.lookups.size(), 3u);
+    EXPECT_EQ(fake.lookups[0].size(), 100u);
+    EXPECT_EQ(report.succeeded.size(), 125u);
+    EXPECT_EQ(report.skipped.size(), 135u);
+    EXPECT_EQ(fake.calls.count(id(0)), 0u);
+    EXPECT_EQ(fake.calls[id(1)], 1);
+}
+
+TEST(ModerationExecutorTest, an_empty_selection_finishes_immediately) {
+    FakeModeration fake;
+    auto report = ModerationExecutor(fake.backend()).run({}, ModerationAction::remove()).get();
+    EXPECT_TRUE(report.succeeded.empty());
+    EXPECT_TRUE(fake.calls.empty());
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/archive/moderation_export.hpp"
+
+#include "FastCommentsClient/model/ModerationExportStatusResponse.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using fastcomments::analytics::CommentBatch;
+using fastcomments::archive::ExportJobBackend;
+using fastcomments::archive::ExportPhase;
+using fastcomments::archive::ExportPipeline;
+using fastcomments::archive::ExportPipelineOptions;
+using fastcomments::archive::ExportProgress;
+using org::openapitools::client::model::ModerationExportStatusResponse;
+
+namespace {
+
+// A job that reports the given record counts, one per poll, and then the
+// download URL. The body is served in chunkSize pieces.
+struct FakeExportJob {
+    std::vector<int32_t> counts;
+    std::string jobStatus = "running";
+    std::string body;
+    size_t chunkSize = 7;
+    bool failDownload = false;
+    size_t polls = 0;
+
+    ExportJobBackend backend() {
+        ExportJobBackend backend;
+        backend.start = []() { return pplx::task_from_result(utility::conversions::to_string_t("job-1")); };
+        backend.status = [this](const utility::string_t& batchJobId) {
+            EXPECT_EQ(batchJobId, utility::conversions::to_string_t("job-1"));
+            auto status = std::make_shared<ModerationExportStatusResponse>();
+            status->setStatus(utility::conversions::to_string_t("success"));
+            status->setJobStatus(utility::conversions::to_string_t(jobStatus));
+            if (polls < counts.size()) {
+                status->setRecordCount(counts[polls]);
+            } else {
+                status->setRecordCount(counts.empty() ? 0 : counts.back());
+                status->setDownloadUrl(utility::conversions::to_string_t("https://example.com/export.json"));
+            }
+            ++polls;
+            return pplx::task_from_result(status);
+        };
+        backend.download = [this](const utility::string_t&, ExportJobBackend::ChunkHandler onChunk) {
+            return pplx::create_task([this, onChunk]() {
+                for (size_t at = 0; at < body.size(); at += chunkSize) {
+                    if (failDownload && at >= body.size() / 2) throw std::runtime_error("connection reset");
+                    onChunk(body.data() + at, std::min(chunkSize, body.size() - at)).get();
+                }
+            });
+        };
+        return backend;
+    }
+};
+
+ExportPipelineOptions fastPolling() {
+    ExportPipelineOptions options;
+    options.initialPollInterval = std::chrono::milliseconds(8);
+    options.minPollInterval = std::chrono::milliseconds(1);
+    options.maxPollInterval = std::chrono::milliseconds(32);
+    return options;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+std::vector<std::string> ids(const CommentBatch& batch) {
+    return batch.ids();
+}
+
+} // anonymous namespace
+
+TEST(ModerationExportTest, polls_faster_while_the_job_progresses_and_slower_while_it_stalls) {
+    FakeExportJob job;
+    job.counts = {0, 0, 0, 10, 20, 20};
+    job.body = "[]";
+    auto options = fastPolling();
+    std::vector<long long> intervals;
+    options.onProgress = [&](const ExportProgress& progress) {
+        if (progress.phase == ExportPhase::Waiting && progress.polls > 0) intervals.push_back(progress.nextPoll.count());
+    };
+
+    auto summary = ExportPipeline(job.backend(), options).toFile(testing::TempDir() + "export_polling.json").get();
+    EXPECT_EQ(intervals, (std::vector<long long>{8, 16, 32, 16, 8, 16}));
+    EXPECT_EQ(summary.polls, 7u);
+    EXPECT_EQ(summary.recordCount, 20);
+    EXPECT_EQ(summary.batchJobId, utility::conversions::to_string_t("job-1"));
+}
+
+TEST(ModerationExportTest, writes_the_download_to_the_file) {
+    FakeExportJob job;
+    job.counts = {5};
+    for (int i = 0; i < 200; ++i) job.body += "{\"_id\":\"c" + std::to_string(i) + "\"}\n";
+    uint64_t lastBytes = 0;
+    auto options = fastPolling();
+    options.maxQueuedChunks = 2;   // the download has to wait for the writer
+    options.onProgress = [&](const ExportProgress& progress) {
+        EXPECT_GE(progress.bytes, lastBytes);
+        lastBytes = progress.bytes;
+    };
+
+    const std::string path = testing::TempDir() + "export_file.json";
+    std::remove(path.c_str());
+    auto summary = ExportPipeline(job.backend(), options).toFile(path).get();
+    EXPECT_EQ(readFile(path), job.body);
+    EXPECT_FALSE(std::filesystem::exists(path + ".part"));
+    EXPECT_EQ(summary.bytes, job.body.size());
+    EXPECT_EQ(lastBytes, job.body.size());
+}
+
+TEST(ModerationExportTest, decodes_each_body_shape_into_a_comment_batch) {
+    // Braces and quotes inside strings, and arrays inside records, must not
+    // confuse the record boundaries.
+    const std::vector<std::string> records = {
+        "{\"_id\":\"a\",\"comment\":\"{[\\\"}\",\"votes\":3,\"mentions\":[{\"id\":\"m\"}]}",
+        "{\"_id\":\"b\",\"parentId\":\"a\",\"approved\":true}",
+        "{\"_id\":\"c\",\"parentId\":\"zz\"}",
+    };
+    const std::string joined = records[0] + "," + records[1] + "," + records[2];
+    const std::vector<std::string> bodies = {
+        "[" + joined + "]",
+        "{\"status\":\"success\",\"comments\":[" + joined + "],\"count\":3}",
+        records[0] + "\n" + records[1] + "\n" + records[2] + "\n",
+    };
+
+    for (const auto& body : bodies) {
+        FakeExportJob job;
+        job.body = body;
+        job.chunkSize = 5;
+        uint64_t decoded = 0;
+        auto options = fastPolling();
+        options.onProgress = [&](const ExportProgress& progress) { decoded = progress.records; };
+
+        auto batch = ExportPipeline(job.backend(), options).toBatch().get();
+        ASSERT_EQ(ids(batch), (std::vector<std::string>{"a", "b", "c"})) << body;
+        EXPECT_EQ(batch.votes()[0], 3);
+        EXPECT_EQ(batch.parents()[1], 0);
+        EXPECT_EQ(batch.parents()[2], CommentBatch::kParentNotInBatch);
+        EXPECT_TRUE(batch.flag(fastcomments::analytics::CommentFlag::Approved).test(1));
+        EXPECT_EQ(decoded, 3u);
+    }
+}
+
+TEST(ModerationExportTest, failed_jobs_and_downloads_fail_the_export) {
+    {
+        FakeExportJob job;
+        job.counts = {1, 2};
+        job.jobStatus = "FAILED";
+        EXPECT_THROW(ExportPipeline(job.backend(), fastPolling()).toBatch().get(), std::runtime_error);
+        EXPECT_EQ(job.polls, 1u);
+    }
+    {
+        FakeExportJob job;
+        job.body = std::string(1000, ' ');
+        job.failDownload = true;
+        const std::string path = testing::TempDir() + "export_failed.json";
+        std::remove(path.c_str());
+        EXPECT_THROW(ExportPipeline(job.backend(), fastPolling()).toFile(path).get(), std::runtime_error);
+        EXPECT_FALSE(std::filesystem::exists(path));
+        EXPECT_FALSE(std::filesystem::exists(path + ".part"));
+    }
+    {
+        FakeExportJob job;
+        job.body = "[{\"_id\":\"a\"},{\"_id\":";   // cut off mid-record
+        EXPECT_THROW(ExportPipeline(job.backend(), fastPolling()).toBatch().get(), std::runtime_error);
+    }
+    {
+        FakeExportJob job;
+        job.counts = {0, 0, 0, 0, 0, 0, 0, 0};
+        auto options = fastPolling();
+        options.timeout = std::chrono::milliseconds(40);
+        EXPECT_THROW(ExportPipeline(job.backend(), options).toBatch().get(), std::runtime_error);
+    }
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/archive/ndjson_exporter.hpp"
+
+#include "FastCommentsClient/model/APIComment.h"
+
+#include <zlib.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using fastcomments::archive::Compression;
+using fastcomments::archive::ExportCheckpoint;
+using fastcomments::archive::ExportOptions;
+using fastcomments::archive::ExportPage;
+using fastcomments::archive::ExportSource;
+using fastcomments::archive::NdjsonExporter;
+using org::openapitools::client::model::APIComment;
+
+namespace {
+
+// A skip-paged source over `total` comments with ids "c0".."c<total-1>". Fetching
+// the page at failAt throws once.
+struct FakeComments {
+    int total = 0;
+    int pageSize = 3;
+    int64_t failAt = -1;
+    std::vector<int64_t> fetched;
+
+    ExportSource source() {
+        ExportSource s;
+        s.name = "comments";
+        s.fetch = [this](int64_t cursor) {
+            fetched.push_back(cursor);
+            if (cursor == failAt) {
+                failAt = -1;
+                return pplx::task_from_exception<ExportPage>(std::runtime_error("network down"));
+            }
+            ExportPage page;
+            for (int64_t i = cursor; i < total && i < cursor + pageSize; ++i) {
+                auto comment = std::make_shared<APIComment>();
+                comment->setId(utility::conversions::to_string_t("c" + std::to_string(i)));
+                comment->setVotes(static_cast<int32_t>(i));
+                page.records.push_back(comment);
+            }
+            page.last = static_cast<int>(page.records.size()) < pageSize;
+            return pplx::task_from_result(page);
+        };
+        s.next = [](int64_t cursor, const ExportPage& page) {
+            return cursor + static_cast<int64_t>(page.records.size());
+        };
+        return s;
+    }
+};
+
+std::string tempPath(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / ("fastcomments_" + name);
+    std::filesystem::remove(path);
+    std::filesystem::remove(path.string() + ".checkpoint");
+    return path.string();
+}
+
+std::vector<std::string> readLines(const std::string& text) {
+    std::vector<std::string> lines;
+    std::istringstream in(text);
+    for (std::string line; std::getline(in, line);) lines.push_back(line);
+    return lines;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+std::string readGzip(const std::string& path) {
+    gzFile in = gzopen(path.c_str(), "rb");
+    std::string text;
+    char buf[4096];
+    for (int n; (n = gzread(in, buf, sizeof(buf))) > 0;) text.append(buf, static_cast<size_t>(n));
+    gzclose(in);
+    return text;
+}
+
+} // anonymous namespace
+
+TEST(NdjsonExporterTest, writes_one_line_per_record) {
+    const std::string path = tempPath("export.ndjson");
+    FakeComments comments;
+    comments.total = 7;
+
+    NdjsonExporter exporter(path);
+    auto stats = exporter.run(comments.source());
+    EXPECT_EQ(stats.records, 7u);
+    EXPECT_EQ(stats.pages, 3u);
+    EXPECT_FALSE(stats.resumed);
+    EXPECT_EQ(comments.fetched, (std::vector<int64_t>{0, 3, 6}));
+
+    auto lines = readLines(readFile(path));
+    ASSERT_EQ(lines.size(), 7u);
+    auto first = web::json::value::parse(utility::conversions::to_string_t(lines[0]));
+    EXPECT_EQ(first.at(utility::conversions::to_string_t("id")).as_string(), utility::conversions::to_string_t("c0"));
+    auto last = web::json::value::parse(utility::conversions::to_string_t(lines[6]));
+    EXPECT_EQ(last.at(utility::conversions::to_string_t("votes")).as_integer(), 6);
+
+    ExportCheckpoint checkpoint;
+    ASSERT_TRUE(NdjsonExporter::readCheckpoint(exporter.checkpointPath(), checkpoint));
+    EXPECT_TRUE(checkpoint.complete);
+    EXPECT_EQ(checkpoint.records, 7u);
+    EXPECT_EQ(checkpoint.bytes, std::filesystem::file_size(path));
+}
+
+TEST(NdjsonExporterTest, resumes_after_a_failed_page_without_duplicates) {
+    const std::string path = tempPath("resume.ndjson");
+    FakeComments comments;
+    comments.total = 10;
+    comments.failAt = 6;
+
+    NdjsonExporter exporter(path);
+    EXPECT_THROW(exporter.run(comments.source()), std::runtime_error);
+    EXPECT_EQ(readLines(readFile(path)).size(), 6u);
+
+    // Simulate a crash halfway through writing the next page.
+    {
+        std::ofstream partial(path, std::ios::binary | std::ios::app);
+        partial << "{\"id\":\"c6\",\"vo";
+    }
+
+    comments.fetched.clear();
+    auto stats = exporter.run(comments.source());
+    EXPECT_TRUE(stats.resumed);
+    EXPECT_EQ(stats.records, 10u);
+    EXPECT_EQ(comments.fetched.front(), 6);
+
+    auto lines = readLines(readFile(path));
+    ASSERT_EQ(lines.size(), 10u);
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto record = web::json::value::parse(utility::conversions::to_string_t(lines[i]));
+        EXPECT_EQ(record.at(utility::conversions::to_string_t("votes")).as_integer(), static_cast<int>(i));
+    }
+
+    // A finished export is not fetched again.
+    comments.fetched.clear();
+    EXPECT_TRUE(exporter.run(comments.source()).resumed);
+    EXPECT_TRUE(comments.fetched.empty());
+}
+
+TEST(NdjsonExporterTest, starts_over_when_the_file_lost_checkpointed_records) {
+    const std::string path = tempPath("lost.ndjson");
+    FakeComments comments;
+    comments.total = 10;
+    comments.failAt = 6;
+
+    NdjsonExporter exporter(path);
+    EXPECT_THROW(exporter.run(comments.source()), std::runtime_error);
+    std::filesystem::remove(path);
+
+    comments.fetched.clear();
+    auto stats = exporter.run(comments.source());
+    EXPECT_FALSE(stats.resumed);
+    EXPECT_EQ(stats.records, 10u);
+    EXPECT_EQ(comments.fetched.front(), 0);
+    EXPECT_EQ(readLines(readFile(path)).size(), 10u);
+
+    // Shorter than the checkpoint says: also a fresh start, not a file
+    // padded with zero bytes.
+    comments.failAt = 6;
+    NdjsonExporter again(tempPath("short.ndjson"));
+    EXPECT_THROW(again.run(comments.source()), std::runtime_error);
+    std::filesystem::resize_file(again.path(), 5);
+    EXPECT_FALSE(again.run(comments.source()).resumed);
+    EXPECT_EQ(readLines(readFile(again.path())).size(), 10u);
+}
+
+TEST(NdjsonExporterTest, gzip_output_survives_resume) {
+    const std::string path = tempPath("export.ndjson.gz");
+    FakeComments comments;
+    comments.total = 8;
+    comments.failAt = 3;
+
+    ExportOptions options;
+    options.compression = Compression::Gzip;
+    NdjsonExporter exporter(path, options);
+    EXPECT_THROW(exporter.run(comments.source()), std::runtime_error);
+    EXPECT_EQ(exporter.run(comments.source()).records, 8u);
+
+    auto lines = readLines(readGzip(path));
+    ASSERT_EQ(lines.size(), 8u);
+    EXPECT_NE(lines[3].find("\"c3\""), std::string::npos);
+}
+
+TEST(NdjsonExporterTest, refuses_to_resume_a_different_source) {
+    const std::string path = tempPath("mismatch.ndjson");
+    FakeComments comments;
+    comments.total = 2;
+    NdjsonExporter exporter(path);
+    exporter.run(comments.source());
+
+    ExportSource other = comments.source();
+    other.name = "votes";
+    EXPECT_THROW(exporter.run(other), std::runtime_error);
+
+    ExportOptions fresh;
+    fresh.resume = false;
+    EXPECT_EQ(NdjsonExporter(path, fresh).run(other).records, 2u);
+}
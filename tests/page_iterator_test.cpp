@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/paging/page_iterator.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using fastcomments::paging::PageIterator;
+
+namespace {
+
+using IntPages = PageIterator<int, int>;
+
+// Serves pages of `pageSize` ints from [0, total) with the offset as cursor and
+// records every cursor requested.
+struct FakeEndpoint {
+    int total = 0;
+    int pageSize = 4;
+    int failAt = -1;
+    std::mutex mu;
+    std::vector<int> requested;
+
+    IntPages::Fetch fetch() {
+        return [this](const int& cursor) {
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                requested.push_back(cursor);
+            }
+            if (cursor == failAt) {
+                failAt = -1;
+                return pplx::task_from_exception<IntPages::PageType>(std::runtime_error("timeout"));
+            }
+            IntPages::PageType page;
+            for (int i = cursor; i < total && i < cursor + pageSize; ++i) page.items.push_back(i);
+            if (cursor + pageSize < total) page.next = cursor + pageSize;
+            return pplx::task_from_result(page);
+        };
+    }
+
+    std::vector<int> requests() {
+        std::lock_guard<std::mutex> lock(mu);
+        return requested;
+    }
+};
+
+} // anonymous namespace
+
+TEST(PageIteratorTest, prefetches_the_next_page_and_stops_after_the_last) {
+    FakeEndpoint endpoint;
+    endpoint.total = 10;
+    IntPages pages(endpoint.fetch(), 0);
+
+    auto first = pages.next().get();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(*first, (std::vector<int>{0, 1, 2, 3}));
+    // Page two was requested before the caller asked for it.
+    EXPECT_EQ(endpoint.requests(), (std::vector<int>{0, 4}));
+
+    EXPECT_EQ(pages.next().get()->size(), 4u);
+    EXPECT_EQ(*pages.next().get(), (std::vector<int>{8, 9}));
+    EXPECT_TRUE(pages.done());
+    EXPECT_FALSE(pages.next().get().has_value());
+    EXPECT_EQ(endpoint.requests(), (std::vector<int>{0, 4, 8}));
+}
+
+TEST(PageIteratorTest, a_failed_page_is_fetched_again) {
+    FakeEndpoint endpoint;
+    endpoint.total = 8;
+    endpoint.failAt = 4;
+    IntPages pages(endpoint.fetch(), 0);
+
+    EXPECT_EQ(pages.next().get()->front(), 0);
+    EXPECT_THROW(pages.next().get(), std::runtime_error);
+    ASSERT_TRUE(pages.cursor().has_value());
+    EXPECT_EQ(*pages.cursor(), 4);
+
+    auto retried = pages.next().get();
+    ASSERT_TRUE(retried.has_value());
+    EXPECT_EQ(*retried, (std::vector<int>{4, 5, 6, 7}));
+    EXPECT_FALSE(pages.next().get().has_value());
+    EXPECT_EQ(endpoint.requests(), (std::vector<int>{0, 4, 4}));
+}
+
+TEST(PageIteratorTest, forEachPage_visits_pages_in_order) {
+    FakeEndpoint endpoint;
+    endpoint.total = 23;
+    IntPages pages(endpoint.fetch(), 0);
+
+    std::vector<int> seen;
+    int calls = 0;
+    pages.forEachPage([&](std::vector<int>& items) {
+        ++calls;
+        seen.insert(seen.end(), items.begin(), items.end());
+    }).get();
+
+    EXPECT_EQ(calls, 6);
+    ASSERT_EQ(seen.size(), 23u);
+    for (int i = 0; i < 23; ++i) EXPECT_EQ(seen[i], i);
+}
+
+TEST(PageIteratorTest, an_empty_first_page_ends_the_walk) {
+    FakeEndpoint endpoint;
+    IntPages pages(endpoint.fetch(), 0);
+    auto first = pages.next().get();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_TRUE(first->empty());
+    EXPECT_TRUE(pages.done());
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/live/presence_service.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using fastcomments::live::EventType;
+using fastcomments::live::LiveEvent;
+using fastcomments::live::PresenceFetch;
+using fastcomments::live::PresenceOptions;
+using fastcomments::live::PresenceService;
+using fastcomments::live::PresenceStatuses;
+
+namespace {
+
+utility::string_t user(const std::string& id) {
+    return utility::conversions::to_string_t(id);
+}
+
+// Users whose id starts with "on" are online; everyone else is left out of
+// the response, which means offline.
+struct FakePresence {
+    std::mutex mu;
+    std::vector<std::vector<utility::string_t>> requests;
+    bool fail = false;
+
+    PresenceFetch fetch() {
+        return [this](const std::vector<utility::string_t>& userIds) {
+            std::lock_guard<std::mutex> lock(mu);
+            requests.push_back(userIds);
+            if (fail) return pplx::task_from_exception<PresenceStatuses>(std::runtime_error("HTTP 502"));
+            PresenceStatuses statuses;
+            for (const auto& userId : userIds) {
+                if (userId.compare(0, 2, user("on")) == 0) statuses[userId] = true;
+            }
+            return pplx::task_from_result(statuses);
+        };
+    }
+
+    size_t count() {
+        std::lock_guard<std::mutex> lock(mu);
+        return requests.size();
+    }
+};
+
+} // anonymous namespace
+
+TEST(PresenceServiceTest, concurrent_lookups_share_one_request) {
+    FakePresence server;
+    PresenceOptions options;
+    options.batchWindow = std::chrono::milliseconds(20);
+    PresenceService presence(server.fetch(), options);
+
+    auto a = presence.lookup({user("on-1"), user("off-1"), user("on-1")});
+    auto b = presence.lookup({user("off-1"), user("on-2")});
+    auto c = presence.lookup({user("on-2")});
+
+    EXPECT_EQ(a.get(), (PresenceStatuses{{user("on-1"), true}, {user("off-1"), false}}));
+    EXPECT_EQ(b.get(), (PresenceStatuses{{user("off-1"), false}, {user("on-2"), true}}));
+    EXPECT_EQ(c.get(), (PresenceStatuses{{user("on-2"), true}}));
+    ASSERT_EQ(server.count(), 1u);
+    EXPECT_EQ(server.requests[0].size(), 3u);
+    EXPECT_EQ(presence.stats().shared, 2u);
+}
+
+TEST(PresenceServiceTest, statuses_are_cached_for_the_ttl) {
+    FakePresence server;
+    PresenceOptions options;
+    options.batchWindow = std::chrono::milliseconds(1);
+    options.ttl = std::chrono::milliseconds(100);
+    PresenceService presence(server.fetch(), options);
+
+    presence.lookup({user("on-1"), user("off-1")}).get();
+    EXPECT_EQ(presence.lookup({user("off-1"), user("on-1")}).get().size(), 2u);
+    EXPECT_EQ(server.count(), 1u);
+    EXPECT_TRUE(presence.cached(user("on-1")).value_or(false));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_FALSE(presence.cached(user("on-1")));
+    presence.lookup({user("on-1")}).get();
+    EXPECT_EQ(server.count(), 2u);
+}
+
+TEST(PresenceServiceTest, large_lookups_are_split_into_full_requests) {
+    FakePresence server;
+    PresenceOptions options;
+    options.batchWindow = std::chrono::seconds(60);
+    options.maxUsersPerRequest = 100;
+    PresenceService presence(server.fetch(), options);
+
+    std::vector<utility::string_t> userIds;
+    for (int i = 0; i < 200; ++i) userIds.push_back(user("on-" + std::to_string(i)));
+    // Two full requests go out at once; nothing is left waiting for the window.
+    EXPECT_EQ(presence.lookup(userIds).get().size(), 200u);
+    EXPECT_EQ(server.count(), 2u);
+}
+
+TEST(PresenceServiceTest, presence_events_refresh_the_cache) {
+    pplx::task_completion_event<PresenceStatuses> reply;
+    int calls = 0;
+    PresenceOptions options;
+    options.batchWindow = std::chrono::milliseconds(1);
+    PresenceService presence([&](const std::vector<utility::string_t>&) {
+        ++calls;
+        return pplx::create_task(reply);
+    }, options);
+
+    LiveEvent event;
+    event.type = EventType::PresenceUpdate;
+    event.payload = web::json::value::parse(U(R"({"type":"p-u","uj":["a"],"ul":["b"]})"));
+    presence.apply(event);
+    EXPECT_EQ(presence.lookup({user("a"), user("b")}).get(),
+              (PresenceStatuses{{user("a"), true}, {user("b"), false}}));
+    EXPECT_EQ(calls, 0);
+
+    // x joins while a request for it is in flight; the older answer loses,
+    // in the cache and in the lookup waiting on that request.
+    auto lookup = presence.lookup({user("x")});
+    while (presence.stats().requests == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    presence.applyPresence({user("x")}, {});
+    reply.set(PresenceStatuses{});
+    EXPECT_EQ(lookup.get(), (PresenceStatuses{{user("x"), true}}));
+    EXPECT_TRUE(presence.cached(user("x")).value_or(false));
+}
+
+TEST(PresenceServiceTest, a_failed_request_fails_its_lookups_only) {
+    FakePresence server;
+    PresenceOptions options;
+    options.batchWindow = std::chrono::milliseconds(1);
+    PresenceService presence(server.fetch(), options);
+
+    presence.lookup({user("on-1")}).get();
+    server.fail = true;
+    EXPECT_THROW(presence.lookup({user("on-1"), user("on-2")}).get(), std::runtime_error);
+    server.fail = false;
+    EXPECT_EQ(presence.lookup({user("on-2")}).get(), (PresenceStatuses{{user("on-2"), true}}));
+    EXPECT_EQ(server.count(), 3u);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/batch/question_result_batcher.hpp"
+
+#include "FastCommentsClient/model/BulkAggregateQuestionItem.h"
+#include "FastCommentsClient/model/BulkAggregateQuestionResultsRequest.h"
+#include "FastCommentsClient/model/BulkAggregateQuestionResultsResponse.h"
+#include "FastCommentsClient/model/QuestionResultAggregationOverall.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using fastcomments::batch::QuestionBatcherOptions;
+using fastcomments::batch::QuestionResultBatcher;
+using org::openapitools::client::api::AggregateQuestionResultsOptions;
+using org::openapitools::client::model::BulkAggregateQuestionResultsRequest;
+using org::openapitools::client::model::BulkAggregateQuestionResultsResponse;
+using org::openapitools::client::model::QuestionResultAggregationOverall;
+
+namespace {
+
+AggregateQuestionResultsOptions question(int id) {
+    AggregateQuestionResultsOptions query;
+    query.questionId = utility::conversions::to_string_t(std::to_string(id));
+    return query;
+}
+
+// Answers each aggregation with its question id as the average. Question
+// "13" is left out of every response.
+struct FakeBulkEndpoint {
+    std::mutex mu;
+    std::vector<size_t> batchSizes;
+    std::vector<bool> forced;
+    bool failRequests = false;
+
+    QuestionResultBatcher::SendBatch send() {
+        return [this](std::shared_ptr<BulkAggregateQuestionResultsRequest> request, bool forceRecalculate) {
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                batchSizes.push_back(request->getAggregations().size());
+                forced.push_back(forceRecalculate);
+            }
+            if (failRequests) {
+                return pplx::task_from_exception<std::shared_ptr<BulkAggregateQuestionResultsResponse>>(
+                    std::runtime_error("connection reset"));
+            }
+            std::map<utility::string_t, std::shared_ptr<QuestionResultAggregationOverall>> data;
+            for (const auto& item : request->getAggregations()) {
+                if (item->getQuestionId() == utility::conversions::to_string_t("13")) continue;
+                auto overall = std::make_shared<QuestionResultAggregationOverall>();
+                overall->setAverage(std::stod(utility::conversions::to_utf8string(item->getQuestionId())));
+                data[item->getAggId()] = overall;
+            }
+            auto response = std::make_shared<BulkAggregateQuestionResultsResponse>();
+            response->setData(data);
+            return pplx::task_from_result(response);
+        };
+    }
+
+    std::vector<size_t> sizes() {
+        std::lock_guard<std::mutex> lock(mu);
+        return batchSizes;
+    }
+};
+
+} // anonymous namespace
+
+TEST(QuestionResultBatcherTest, concurrent_calls_share_one_bulk_request) {
+    FakeBulkEndpoint endpoint;
+    QuestionBatcherOptions options;
+    options.maxDelay = std::chrono::seconds(60);
+    QuestionResultBatcher batcher(endpoint.send(), options);
+
+    std::vector<pplx::task<std::shared_ptr<QuestionResultAggregationOverall>>> results;
+    for (int i = 0; i < 30; ++i) results.push_back(batcher.aggregate(question(i % 12)));
+    batcher.flush().get();
+
+    // Twelve distinct questions, each sent once.
+    EXPECT_EQ(endpoint.sizes(), (std::vector<size_t>{12}));
+    for (int i = 0; i < 30; ++i) EXPECT_EQ(results[i].get()->getAverage(), i % 12);
+    EXPECT_EQ(results[0].get(), results[12].get());
+    EXPECT_EQ(batcher.stats().calls, 30u);
+    EXPECT_EQ(batcher.stats().aggregations, 12u);
+}
+
+TEST(QuestionResultBatcherTest, splits_by_count_and_by_force_recalculate) {
+    FakeBulkEndpoint endpoint;
+    QuestionBatcherOptions options;
+    options.maxCount = 10;
+    options.maxDelay = std::chrono::seconds(60);
+    QuestionResultBatcher batcher(endpoint.send(), options);
+
+    for (int i = 0; i < 15; ++i) batcher.aggregate(question(i));
+    auto forced = question(100);
+    forced.forceRecalculate = true;
+    auto recalculated = batcher.aggregate(forced);
+    batcher.flush().get();
+
+    EXPECT_EQ(endpoint.sizes(), (std::vector<size_t>{10, 5, 1}));
+    EXPECT_EQ(endpoint.forced, (std::vector<bool>{false, false, true}));
+    EXPECT_EQ(recalculated.get()->getAverage(), 100);
+}
+
+TEST(QuestionResultBatcherTest, sends_a_partial_batch_after_max_delay) {
+    FakeBulkEndpoint endpoint;
+    QuestionBatcherOptions options;
+    options.maxDelay = std::chrono::milliseconds(5);
+    QuestionResultBatcher batcher(endpoint.send(), options);
+
+    auto first = batcher.aggregate(question(1));
+    auto second = batcher.aggregate(question(2));
+    EXPECT_EQ(second.get()->getAverage(), 2);
+    EXPECT_EQ(first.get()->getAverage(), 1);
+    EXPECT_EQ(endpoint.sizes(), (std::vector<size_t>{2}));
+}
+
+TEST(QuestionResultBatcherTest, missing_results_and_failed_requests_reach_only_their_callers) {
+    FakeBulkEndpoint endpoint;
+    QuestionBatcherOptions options;
+    options.maxDelay = std::chrono::seconds(60);
+    {
+        QuestionResultBatcher batcher(endpoint.send(), options);
+        auto present = batcher.aggregate(question(12));
+        auto missing = batcher.aggregate(question(13));
+        batcher.flush().get();
+        EXPECT_NO_THROW(present.get());
+        EXPECT_THROW(missing.get(), std::runtime_error);
+        EXPECT_EQ(batcher.stats().failed, 1u);
+    }
+
+    endpoint.failRequests = true;
+    pplx::task<std::shared_ptr<QuestionResultAggregationOverall>> lost;
+    {
+        QuestionResultBatcher batcher(endpoint.send(), options);
+        lost = batcher.aggregate(question(1));
+        // Destroying the batcher sends what is queued.
+    }
+    EXPECT_THROW(lost.get(), std::runtime_error);
+}
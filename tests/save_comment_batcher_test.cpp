@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/batch/save_comment_batcher.hpp"
+
+#include "FastCommentsClient/ApiException.h"
+#include "FastCommentsClient/model/APIStatus.h"
+#include "FastCommentsClient/model/CreateCommentParams.h"
+#include "FastCommentsClient/model/SaveCommentsBulkResponse.h"
+
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using fastcomments::batch::SaveBatcherOptions;
+using fastcomments::batch::SaveCommentBatcher;
+using org::openapitools::client::api::ApiException;
+using org::openapitools::client::model::APIStatus;
+using org::openapitools::client::model::CreateCommentParams;
+using org::openapitools::client::model::SaveCommentsBulkResponse;
+
+namespace {
+
+std::shared_ptr<CreateCommentParams> comment(const std::string& text) {
+    auto params = std::make_shared<CreateCommentParams>();
+    params->setComment(utility::conversions::to_string_t(text));
+    params->setCommenterName(utility::conversions::to_string_t("importer"));
+    params->setUrlId(utility::conversions::to_string_t("page-1"));
+    return params;
+}
+
+std::shared_ptr<APIStatus> status(APIStatus::eAPIStatus value) {
+    auto s = std::make_shared<APIStatus>();
+    s->setValue(value);
+    return s;
+}
+
+// Answers every bulk request; comments whose text is "spam" are rejected.
+struct FakeBulkEndpoint {
+    std::mutex mu;
+    std::vector<size_t> batchSizes;
+    bool failRequests = false;
+
+    SaveCommentBatcher::SendBatch send() {
+        return [this](std::vector<std::shared_ptr<CreateCommentParams>> batch) {
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                batchSizes.push_back(batch.size());
+            }
+            if (failRequests) {
+                return pplx::task_from_exception<std::vector<std::shared_ptr<SaveCommentsBulkResponse>>>(
+                    std::runtime_error("connection reset"));
+            }
+            std::vector<std::shared_ptr<SaveCommentsBulkResponse>> results;
+            for (const auto& params : batch) {
+                auto result = std::make_shared<SaveCommentsBulkResponse>();
+                if (params->getComment() == utility::conversions::to_string_t("spam")) {
+                    result->setStatus(status(APIStatus::eAPIStatus::FAILED));
+                    result->setCode(utility::conversions::to_string_t("spam"));
+                    result->setReason(utility::conversions::to_string_t("Looks like spam"));
+                } else {
+                    result->setStatus(status(APIStatus::eAPIStatus::SUCCESS));
+                    result->setReason(params->getComment());
+                }
+                results.push_back(result);
+            }
+            return pplx::task_from_result(results);
+        };
+    }
+
+    std::vector<size_t> sizes() {
+        std::lock_guard<std::mutex> lock(mu);
+        return batchSizes;
+    }
+};
+
+} // anonymous namespace
+
+TEST(SaveCommentBatcherTest, fills_batches_up_to_max_count) {
+    FakeBulkEndpoint endpoint;
+    SaveBatcherOptions options;
+    options.maxCount = 10;
+    options.maxDelay = std::chrono::seconds(60);
+    SaveCommentBatcher batcher(endpoint.send(), options);
+
+    std::vector<pplx::task<std::shared_ptr<SaveCommentsBulkResponse>>> results;
+    for (int i = 0; i < 25; ++i) results.push_back(batcher.save(comment("comment " + std::to_string(i))));
+    batcher.flush().get();
+
+    EXPECT_EQ(endpoint.sizes(), (std::vector<size_t>{10, 10, 5}));
+    for (int i = 0; i < 25; ++i) {
+        // Each caller gets the result for its own comment.
+        EXPECT_EQ(results[i].get()->getReason(), utility::conversions::to_string_t("comment " + std::to_string(i)));
+    }
+    EXPECT_EQ(batcher.stats().comments, 25u);
+    EXPECT_EQ(batcher.stats().requests, 3u);
+}
+
+TEST(SaveCommentBatcherTest, splits_batches_by_size) {
+    FakeBulkEndpoint endpoint;
+    SaveBatcherOptions options;
+    options.maxBytes = 1000;
+    options.maxDelay = std::chrono::seconds(60);
+    SaveCommentBatcher batcher(endpoint.send(), options);
+
+    const std::string big(400, 'x');
+    for (int i = 0; i < 5; ++i) batcher.save(comment(big));
+    batcher.flush().get();
+
+    // Two 400-character comments fit in 1000 bytes, three do not.
+    EXPECT_EQ(endpoint.sizes(), (std::vector<size_t>{2, 2, 1}));
+}
+
+TEST(SaveCommentBatcherTest, sends_a_partial_batch_after_max_delay) {
+    FakeBulkEndpoint endpoint;
+    SaveBatcherOptions options;
+    options.maxDelay = std::chrono::milliseconds(20);
+    SaveCommentBatcher batcher(endpoint.send(), options);
+
+    auto first = batcher.save(comment("a"));
+    auto second = batcher.save(comment("b"));
+    // No flush: the timer sends the batch.
+    EXPECT_EQ(second.get()->getReason(), utility::conversions::to_string_t("b"));
+    EXPECT_EQ(first.get()->getReason(), utility::conversions::to_string_t("a"));
+    EXPECT_EQ(endpoint.sizes(), (std::vector<size_t>{2}));
+}
+
+TEST(SaveCommentBatcherTest, rejections_and_request_failures_reach_only_their_callers) {
+    FakeBulkEndpoint endpoint;
+    SaveBatcherOptions options;
+    options.maxDelay = std::chrono::seconds(60);
+    {
+        SaveCommentBatcher batcher(endpoint.send(), options);
+        auto good = batcher.save(comment("fine"));
+        auto bad = batcher.save(comment("spam"));
+        batcher.flush().get();
+        EXPECT_NO_THROW(good.get());
+        EXPECT_THROW(bad.get(), ApiException);
+        EXPECT_EQ(batcher.stats().failed, 1u);
+    }
+
+    endpoint.failRequests = true;
+    pplx::task<std::shared_ptr<SaveCommentsBulkResponse>> lost;
+    {
+        SaveCommentBatcher batcher(endpoint.send(), options);
+        lost = batcher.save(comment("x"));
+        // Destroying the batcher sends what is queued.
+    }
+    EXPECT_THROW(lost.get(), std::runtime_error);
+}
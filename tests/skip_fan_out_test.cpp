@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/paging/skip_fan_out.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using fastcomments::paging::FanOutOptions;
+using fastcomments::paging::FanOutStats;
+using fastcomments::paging::SkipFanOut;
+
+namespace {
+
+// Serves [0, total) in pages of pageSize after a short delay, tracking how many
+// requests overlap.
+struct SlowEndpoint {
+    int64_t total = 0;
+    int64_t pageSize = 10;
+    int64_t failAtSkip = -1;
+    std::mutex mu;
+    int active = 0;
+    int maxActive = 0;
+    std::vector<int64_t> skips;
+
+    SkipFanOut<int>::Fetch fetch() {
+        return [this](int64_t skip) {
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                skips.push_back(skip);
+                maxActive = std::max(maxActive, ++active);
+            }
+            return pplx::create_task([this, skip]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                std::lock_guard<std::mutex> lock(mu);
+                --active;
+                if (skip == failAtSkip) throw std::runtime_error("502");
+                std::vector<int> items;
+                for (int64_t i = skip; i < total && i < skip + pageSize; ++i) items.push_back(static_cast<int>(i));
+                return items;
+            });
+        };
+    }
+};
+
+} // anonymous namespace
+
+TEST(SkipFanOutTest, reassembles_concurrent_pages_in_order) {
+    SlowEndpoint endpoint;
+    endpoint.total = 95;
+    FanOutOptions options;
+    options.parallelism = 4;
+
+    std::vector<int> seen;
+    FanOutStats stats = SkipFanOut<int>(endpoint.fetch(), options).run([&](std::vector<int>& page) {
+        seen.insert(seen.end(), page.begin(), page.end());
+    }).get();
+
+    ASSERT_EQ(seen.size(), 95u);
+    for (int i = 0; i < 95; ++i) EXPECT_EQ(seen[i], i);
+    EXPECT_EQ(stats.pages, 10u);
+    EXPECT_EQ(stats.items, 95u);
+    EXPECT_EQ(stats.pageSize, 10);
+    EXPECT_EQ(endpoint.maxActive, 4);
+    // Walking ahead costs at most parallelism - 1 requests past the end.
+    EXPECT_GE(stats.requests, 10u);
+    EXPECT_LE(stats.requests, 13u);
+}
+
+TEST(SkipFanOutTest, a_probed_total_avoids_requests_past_the_end) {
+    SlowEndpoint endpoint;
+    endpoint.total = 40;
+    FanOutOptions options;
+    options.parallelism = 8;
+    options.pageSize = 10;
+    options.total = [] { return pplx::task_from_result<int64_t>(40); };
+
+    auto items = SkipFanOut<int>(endpoint.fetch(), options).collect().get();
+    ASSERT_EQ(items.size(), 40u);
+    EXPECT_EQ(items.back(), 39);
+    // The last page is full, so one extra page confirms the end.
+    std::sort(endpoint.skips.begin(), endpoint.skips.end());
+    EXPECT_EQ(endpoint.skips, (std::vector<int64_t>{0, 10, 20, 30, 40}));
+}
+
+TEST(SkipFanOutTest, a_stale_total_does_not_truncate_the_scan) {
+    SlowEndpoint endpoint;
+    endpoint.total = 57;
+    FanOutOptions options;
+    options.parallelism = 3;
+    options.total = [] { return pplx::task_from_result<int64_t>(20); };
+
+    auto items = SkipFanOut<int>(endpoint.fetch(), options).collect().get();
+    EXPECT_EQ(items.size(), 57u);
+}
+
+TEST(SkipFanOutTest, failures_inside_the_data_fail_the_scan_and_past_it_do_not) {
+    SlowEndpoint endpoint;
+    endpoint.total = 60;
+    endpoint.failAtSkip = 30;
+    FanOutOptions options;
+    options.parallelism = 4;
+    options.pageSize = 10;
+
+    std::vector<int> seen;
+    auto scan = SkipFanOut<int>(endpoint.fetch(), options).run([&](std::vector<int>& page) {
+        seen.insert(seen.end(), page.begin(), page.end());
+    });
+    EXPECT_THROW(scan.get(), std::runtime_error);
+    // Everything before the failed page was still delivered.
+    EXPECT_EQ(seen.size(), 30u);
+
+    SlowEndpoint shortEndpoint;
+    shortEndpoint.total = 15;
+    shortEndpoint.failAtSkip = 30;
+    auto items = SkipFanOut<int>(shortEndpoint.fetch(), options).collect().get();
+    EXPECT_EQ(items.size(), 15u);
+}
+
+TEST(SkipFanOutTest, an_empty_endpoint_resolves_with_nothing) {
+    SlowEndpoint endpoint;
+    auto stats = SkipFanOut<int>(endpoint.fetch()).run([](std::vector<int>&) { FAIL(); }).get();
+    EXPECT_EQ(stats.items, 0u);
+    EXPECT_EQ(stats.requests, 1u);
+}
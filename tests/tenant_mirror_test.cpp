@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/sync/tenant_mirror.hpp"
+
+#include "FastCommentsClient/model/APIComment.h"
+#include "FastCommentsClient/model/APIPage.h"
+#include "FastCommentsClient/model/PublicVote.h"
+#include "FastCommentsClient/model/User.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using fastcomments::sync::MirrorOptions;
+using fastcomments::sync::MirrorSink;
+using fastcomments::sync::MirrorSource;
+using fastcomments::sync::MirrorStats;
+using fastcomments::sync::TenantMirror;
+using org::openapitools::client::model::APIComment;
+using org::openapitools::client::model::APIPage;
+using org::openapitools::client::model::PublicVote;
+using org::openapitools::client::model::User;
+
+namespace {
+
+utility::string_t urlId(int i) {
+    return utility::conversions::to_string_t("page-" + std::to_string(i));
+}
+
+// A tenant of `pageCount` pages; page i has 37 * i comments and two votes.
+struct FakeTenant {
+    int pageCount = 30;
+    int userCount = 250;
+    utility::string_t failingUrlId;
+
+    std::mutex mu;
+    int active = 0;
+    int maxActive = 0;
+    std::map<std::string, int> requests;   // "comments", "votes", "users"
+    std::set<utility::string_t> crawled;
+
+    template <typename T>
+    pplx::task<T> respond(const std::string& kind, T result, bool fail = false) {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            maxActive = std::max(maxActive, ++active);
+            ++requests[kind];
+        }
+        return pplx::create_task([this, result, fail]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                --active;
+            }
+            if (fail) throw std::runtime_error("HTTP 500");
+            return result;
+        });
+    }
+
+    MirrorSource source() {
+        MirrorSource source;
+        source.pages = [this]() {
+            std::vector<std::shared_ptr<APIPage>> pages;
+            for (int i = 0; i < pageCount; ++i) {
+                auto page = std::make_shared<APIPage>();
+                page->setUrlId(urlId(i));
+                pages.push_back(page);
+            }
+            return pplx::task_from_result(pages);
+        };
+        source.comments = [this](const utility::string_t& url, int32_t skip, int32_t limit) {
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                crawled.insert(url);
+            }
+            const int total = 37 * std::stoi(utility::conversions::to_utf8string(url).substr(5));
+            std::vector<std::shared_ptr<APIComment>> comments;
+            for (int i = skip; i < std::min(total, skip + limit); ++i) {
+                auto comment = std::make_shared<APIComment>();
+                comment->setId(url + utility::conversions::to_string_t("-" + std::to_string(i)));
+                comments.push_back(comment);
+            }
+            return respond("comments", comments, url == failingUrlId);
+        };
+        source.votes = [this](const utility::string_t& url) {
+            std::vector<std::shared_ptr<PublicVote>> votes;
+            for (int i = 0; i < 2; ++i) {
+                auto vote = std::make_shared<PublicVote>();
+                vote->setUrlId(url);
+                votes.push_back(vote);
+            }
+            return respond("votes", votes);
+        };
+        source.users = [this](int32_t skip) {
+            std::vector<std::shared_ptr<User>> users;
+            for (int i = skip; i < std::min(userCount, skip + 100); ++i) {
+                auto user = std::make_shared<User>();
+                user->setId(utility::conversions::to_string_t("u" + std::to_string(i)));
+                users.push_back(user);
+            }
+            return respond("users", users);
+        };
+        return source;
+    }
+};
+
+// Records what it is given; the mirror serializes the calls.
+struct RecordingSink {
+    size_t pages = 0;
+    std::map<utility::string_t, std::set<utility::string_t>> comments;
+    std::map<utility::string_t, size_t> votes;
+    std::set<utility::string_t> users;
+
+    MirrorSink sink() {
+        MirrorSink sink;
+        sink.pages = [this](const std::vector<std::shared_ptr<APIPage>>& p) { pages += p.size(); };
+        sink.comments = [this](const utility::string_t& url, const std::vector<std::shared_ptr<APIComment>>& c) {
+            for (const auto& comment : c) comments[url].insert(comment->getId());
+        };
+        sink.votes = [this](const utility::string_t& url, const std::vector<std::shared_ptr<PublicVote>>& v) {
+            votes[url] += v.size();
+        };
+        sink.users = [this](const std::vector<std::shared_ptr<User>>& u) {
+            for (const auto& user : u) users.insert(user->getId());
+        };
+        return sink;
+    }
+};
+
+} // anonymous namespace
+
+TEST(TenantMirrorTest, mirrors_every_thread_and_the_users_within_the_concurrency_budget) {
+    FakeTenant tenant;
+    RecordingSink sink;
+    MirrorOptions options;
+    options.concurrency = 4;
+    std::vector<uint64_t> finished;
+    options.onProgress = [&](const MirrorStats& stats) { finished.push_back(stats.threads); };
+
+    auto stats = TenantMirror(tenant.source(), sink.sink(), options).run().get();
+
+    EXPECT_EQ(sink.pages, 30u);
+    EXPECT_EQ(sink.comments.size(), 29u);   // page-0 has no comments
+    EXPECT_EQ(sink.comments[urlId(29)].size(), 37u * 29u);
+    EXPECT_EQ(sink.votes.size(), 30u);
+    EXPECT_EQ(sink.users.size(), 250u);
+    EXPECT_EQ(tenant.maxActive, 4);
+
+    EXPECT_EQ(stats.threads, 30u);
+    EXPECT_EQ(stats.threadsTotal, 30u);
+    EXPECT_EQ(stats.comments, 37u * 29u * 30u / 2u);
+    EXPECT_EQ(stats.votes, 60u);
+    EXPECT_EQ(stats.users, 250u);
+    EXPECT_EQ(stats.requests, 1u + static_cast<uint64_t>(tenant.requests["comments"] + tenant.requests["votes"] +
+                                                          tenant.requests["users"]));
+    EXPECT_GT(stats.recordsPerSecond, 0);
+    ASSERT_EQ(finished.size(), 31u);   // every thread, plus the users
+    EXPECT_EQ(finished.back(), 30u);
+}
+
+TEST(TenantMirrorTest, an_interrupted_mirror_resumes_from_its_checkpoint) {
+    const std::string checkpoint = testing::TempDir() + "tenant_mirror.checkpoint";
+    std::remove(checkpoint.c_str());
+    MirrorOptions options;
+    options.concurrency = 2;
+    options.checkpointPath = checkpoint;
+
+    FakeTenant first;
+    first.failingUrlId = urlId(12);
+    RecordingSink firstSink;
+    EXPECT_THROW(TenantMirror(first.source(), firstSink.sink(), options).run().get(), std::runtime_error);
+    const size_t finishedBefore = firstSink.votes.size();
+    EXPECT_GT(finishedBefore, 0u);
+    EXPECT_LT(finishedBefore, 30u);
+
+    FakeTenant second;
+    RecordingSink secondSink;
+    auto stats = TenantMirror(second.source(), secondSink.sink(), options).run().get();
+    EXPECT_EQ(stats.threadsResumed, finishedBefore);
+    EXPECT_EQ(stats.threads + stats.threadsResumed, 30u);
+    EXPECT_EQ(second.requests["users"], firstSink.users.size() == 250u ? 0 : 3);
+    for (const auto& done : firstSink.votes) {
+        EXPECT_EQ(second.crawled.count(done.first), 0u);
+    }
+    EXPECT_EQ(firstSink.votes.size() + secondSink.votes.size(), 30u);
+    std::remove(checkpoint.c_str());
+}
+
+TEST(TenantMirrorTest, entities_the_sink_leaves_out_are_not_fetched) {
+    FakeTenant tenant;
+    RecordingSink recording;
+    MirrorSink sink = recording.sink();
+    sink.comments = nullptr;
+    sink.votes = nullptr;
+
+    auto stats = TenantMirror(tenant.source(), sink).run().get();
+    EXPECT_EQ(recording.pages, 30u);
+    EXPECT_EQ(recording.users.size(), 250u);
+    EXPECT_EQ(tenant.requests.count("comments"), 0u);
+    EXPECT_EQ(tenant.requests.count("votes"), 0u);
+    EXPECT_EQ(stats.threadsTotal, 0u);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/batch/user_loader.hpp"
+
+#include "FastCommentsClient/model/PageUserEntry.h"
+#include "FastCommentsClient/model/User.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using fastcomments::batch::UserLoader;
+using fastcomments::batch::UserLoaderBackend;
+using fastcomments::batch::UserLoaderOptions;
+using org::openapitools::client::model::PageUserEntry;
+using org::openapitools::client::model::User;
+
+namespace {
+
+utility::string_t id(const std::string& s) {
+    return utility::conversions::to_string_t(s);
+}
+
+// Knows every user except "ghost"; "broken" fails getUser once.
+struct FakeUsers {
+    std::mutex mu;
+    std::vector<std::vector<utility::string_t>> infoRequests;
+    std::vector<utility::string_t> userRequests;
+    bool failInfo = false;
+    bool brokenOnce = true;
+
+    UserLoaderBackend backend() {
+        UserLoaderBackend backend;
+        backend.usersInfo = [this](const std::vector<utility::string_t>& userIds) {
+            std::lock_guard<std::mutex> lock(mu);
+            infoRequests.push_back(userIds);
+            std::vector<std::shared_ptr<PageUserEntry>> users;
+            if (failInfo) return pplx::task_from_exception<decltype(users)>(std::runtime_error("HTTP 500"));
+            for (const auto& userId : userIds) {
+                if (userId == id("ghost")) continue;
+                auto entry = std::make_shared<PageUserEntry>();
+                entry->setId(userId);
+                entry->setDisplayName(userId + id(" name"));
+                users.push_back(entry);
+            }
+            return pplx::task_from_result(users);
+        };
+        backend.user = [this](const utility::string_t& userId) {
+            std::lock_guard<std::mutex> lock(mu);
+            userRequests.push_back(userId);
+            if (userId == id("broken") && brokenOnce) {
+                brokenOnce = false;
+                return pplx::task_from_exception<std::shared_ptr<User>>(std::runtime_error("HTTP 503"));
+            }
+            auto user = std::make_shared<User>();
+            user->setId(userId);
+            return pplx::task_from_result(user);
+        };
+        return backend;
+    }
+};
+
+UserLoaderOptions manual() {
+    UserLoaderOptions options;
+    options.batchWindow = std::chrono::seconds(60);
+    return options;
+}
+
+} // anonymous namespace
+
+TEST(UserLoaderTest, loads_from_many_callers_become_one_request) {
+    FakeUsers server;
+    UserLoader loader(server.backend(), manual());
+
+    // Three code paths asking for overlapping users.
+    auto comments = loader.loadInfos({id("a"), id("b"), id("c")});
+    auto mentions = loader.loadInfos({id("b"), id("ghost")});
+    auto author = loader.loadInfo(id("a"));
+    loader.dispatch().get();
+
+    ASSERT_EQ(server.infoRequests.size(), 1u);
+    EXPECT_EQ(server.infoRequests[0], (std::vector<utility::string_t>{id("a"), id("b"), id("c"), id("ghost")}));
+    EXPECT_EQ(comments.get()[2]->getDisplayName(), id("c name"));
+    EXPECT_EQ(mentions.get()[0], comments.get()[1]);
+    EXPECT_EQ(mentions.get()[1], nullptr);
+    EXPECT_EQ(author.get()->getId(), id("a"));
+    EXPECT_EQ(loader.stats().loads, 6u);
+    EXPECT_EQ(loader.stats().shared, 2u);
+}
+
+TEST(UserLoaderTest, memoizes_for_the_loaders_lifetime) {
+    FakeUsers server;
+    UserLoader loader(server.backend(), manual());
+    loader.loadInfo(id("a"));
+    loader.dispatch().get();
+    loader.loadInfo(id("a")).get();   // no dispatch needed
+    EXPECT_EQ(server.infoRequests.size(), 1u);
+
+    loader.clear();
+    auto again = loader.loadInfo(id("a"));
+    loader.dispatch().get();
+    EXPECT_EQ(server.infoRequests.size(), 2u);
+
+    UserLoaderOptions options = manual();
+    options.memoize = false;
+    UserLoader unmemoized(server.backend(), options);
+    unmemoized.loadInfo(id("a"));
+    unmemoized.dispatch().get();
+    unmemoized.loadInfo(id("a"));
+    unmemoized.dispatch().get();
+    EXPECT_EQ(server.infoRequests.size(), 4u);
+}
+
+TEST(UserLoaderTest, splits_batches_and_sends_after_the_window) {
+    FakeUsers server;
+    UserLoaderOptions options;
+    options.batchWindow = std::chrono::milliseconds(5);
+    options.maxIdsPerRequest = 10;
+    UserLoader loader(server.backend(), options);
+
+    std::vector<utility::string_t> userIds;
+    for (int i = 0; i < 25; ++i) userIds.push_back(id("u" + std::to_string(i)));
+    auto users = loader.loadInfos(userIds).get();   // the window sends the last 5
+    EXPECT_EQ(users.size(), 25u);
+    std::vector<size_t> sizes;
+    for (const auto& request : server.infoRequests) sizes.push_back(request.size());
+    EXPECT_EQ(sizes, (std::vector<size_t>{10, 10, 5}));
+}
+
+TEST(UserLoaderTest, get_user_is_deduped_and_failures_are_not_memoized) {
+    FakeUsers server;
+    UserLoader loader(server.backend(), manual());
+    auto first = loader.loadUser(id("x"));
+    auto second = loader.loadUser(id("x"));
+    auto broken = loader.loadUser(id("broken"));
+    loader.dispatch().get();
+
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_THROW(broken.get(), std::runtime_error);
+    EXPECT_EQ(server.userRequests.size(), 2u);
+
+    auto retried = loader.loadUser(id("broken"));
+    loader.dispatch().get();
+    EXPECT_EQ(retried.get()->getId(), id("broken"));
+    EXPECT_EQ(server.userRequests.size(), 3u);
+
+    server.failInfo = true;
+    auto lost = loader.loadInfo(id("a"));
+    loader.dispatch().get();
+    EXPECT_THROW(lost.get(), std::runtime_error);
+}
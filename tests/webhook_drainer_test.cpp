@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include "fastcomments/batch/webhook_drainer.hpp"
+
+#include "FastCommentsClient/model/PendingCommentToSyncOutbound.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using fastcomments::batch::DrainMetrics;
+using fastcomments::batch::DrainOptions;
+using fastcomments::batch::DrainReport;
+using fastcomments::batch::WebhookBackend;
+using fastcomments::batch::WebhookDrainer;
+using fastcomments::batch::WebhookHandler;
+using org::openapitools::client::model::PendingCommentToSyncOutbound;
+
+namespace {
+
+utility::string_t id(int i) {
+    return utility::conversions::to_string_t("e" + std::to_string(i));
+}
+
+// A pending-webhook queue listed by skip, 10 events a page. Deleting an
+// event shifts the ones after it, as on the server.
+struct FakeWebhookQueue {
+    std::mutex mu;
+    std::vector<utility::string_t> pending;
+    std::set<utility::string_t> failDeleteOnce;
+    int failListingFromSkip = -1;
+    int deletes = 0;
+
+    explicit FakeWebhookQueue(int count) {
+        for (int i = 0; i < count; ++i) pending.push_back(id(i));
+    }
+
+    WebhookBackend backend() {
+        WebhookBackend backend;
+        backend.fetch = [this](int64_t skip) {
+            std::vector<std::shared_ptr<PendingCommentToSyncOutbound>> page;
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                if (failListingFromSkip >= 0 && skip >= failListingFromSkip) {
+                    return pplx::task_from_exception<decltype(page)>(std::runtime_error("HTTP 500"));
+                }
+                for (size_t i = static_cast<size_t>(skip); i < pending.size() && page.size() < 10; ++i) {
+                    auto event = std::make_shared<PendingCommentToSyncOutbound>();
+                    event->setId(pending[i]);
+                    event->setCreatedAt(utility::datetime::utc_now());
+                    page.push_back(event);
+                }
+            }
+            return pplx::create_task([page]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                return page;
+            });
+        };
+        backend.count = [this]() {
+            std::lock_guard<std::mutex> lock(mu);
+            return pplx::task_from_result(static_cast<int64_t>(pending.size()));
+        };
+        backend.remove = [this](const utility::string_t& eventId) {
+            std::lock_guard<std::mutex> lock(mu);
+            ++deletes;
+            if (failDeleteOnce.erase(eventId) > 0) return pplx::task_from_exception<void>(std::runtime_error("HTTP 503"));
+            pending.erase(std::remove(pending.begin(), pending.end(), eventId), pending.end());
+            return pplx::task_from_result();
+        };
+        return backend;
+    }
+
+    std::vector<utility::string_t> remaining() {
+        std::lock_guard<std::mutex> lock(mu);
+        return pending;
+    }
+};
+
+struct RecordingHandler {
+    std::mutex mu;
+    std::map<utility::string_t, int> calls;
+    std::set<utility::string_t> failing;
+    int active = 0;
+    int maxActive = 0;
+
+    WebhookHandler handler() {
+        return [this](std::shared_ptr<PendingCommentToSyncOutbound> event) {
+            bool fail;
+            {
+                std::lock_guard<std::mutex> lock(mu);
+                ++calls[event->getId()];
+                maxActive = std::max(maxActive, ++active);
+                fail = failing.count(event->getId()) > 0;
+            }
+            return pplx::create_task([this, fail]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                {
+                    std::lock_guard<std::mutex> lock(mu);
+                    --active;
+                }
+                if (fail) throw std::runtime_error("endpoint rejected the event");
+            });
+        };
+    }
+};
+
+} // anonymous namespace
+
+TEST(WebhookDrainerTest, drains_every_event_once_although_deletes_shift_the_pages) {
+    FakeWebhookQueue queue(95);
+    RecordingHandler handler;
+    DrainOptions options;
+    options.workers = 4;
+    int64_t lastPending = -2;
+    options.onProgress = [&](const DrainMetrics& metrics) { lastPending = metrics.pending; };
+
+    DrainReport report = WebhookDrainer(queue.backend(), handler.handler(), options).drain().get();
+
+    EXPECT_TRUE(queue.remaining().empty());
+    EXPECT_EQ(handler.calls.size(), 95u);
+    for (const auto& call : handler.calls) EXPECT_EQ(call.second, 1) << call.first;
+    EXPECT_LE(handler.maxActive, 4);
+    EXPECT_EQ(report.metrics.pendingAtStart, 95);
+    EXPECT_EQ(report.metrics.handled, 95u);
+    EXPECT_EQ(report.metrics.acked, 95u);
+    EXPECT_GE(report.metrics.rounds, 2u);
+    EXPECT_GE(lastPending, 0);
+    EXPECT_TRUE(report.failures.empty());
+}
+
+TEST(WebhookDrainerTest, failed_handlers_stay_pending_and_failed_deletes_are_retried) {
+    FakeWebhookQueue queue(30);
+    queue.failDeleteOnce.insert(id(5));
+    RecordingHandler handler;
+    handler.failing.insert(id(3));
+
+    DrainReport report = WebhookDrainer(queue.backend(), handler.handler()).drain().get();
+
+    EXPECT_EQ(queue.remaining(), (std::vector<utility::string_t>{id(3)}));
+    EXPECT_EQ(handler.calls[id(3)], 1);   // not retried within the drain
+    EXPECT_EQ(handler.calls[id(5)], 1);   // deleted again, not handled again
+    EXPECT_EQ(report.metrics.failed, 1u);
+    EXPECT_EQ(report.metrics.ackFailures, 1u);
+    EXPECT_EQ(report.metrics.acked, 29u);
+    ASSERT_EQ(report.failures.size(), 1u);
+    EXPECT_EQ(report.failures[0].eventId, id(3));
+    EXPECT_FALSE(report.failures[0].handled);
+}
+
+TEST(WebhookDrainerTest, a_listing_error_fails_the_drain_after_the_listed_events) {
+    FakeWebhookQueue queue(50);
+    queue.failListingFromSkip = 20;
+    RecordingHandler handler;
+    DrainOptions options;
+    options.fetchParallelism = 1;
+
+    EXPECT_THROW(WebhookDrainer(queue.backend(), handler.handler(), options).drain().get(), std::runtime_error);
+    EXPECT_EQ(handler.calls.size(), 20u);
+    EXPECT_EQ(queue.remaining().size(), 30u);
+}
@@ -9,7 +9,9 @@ JAR_FILE="./openapi-generator-cli.jar"
 
 [ -f "$JAR_FILE" ] || wget -q "$JAR_URL" -O "$JAR_FILE"
 
-rm -rf ./client
+# Only the generated models and APIs are wiped; the hand-maintained support files are
+# listed in client/.openapi-generator-ignore so the generator leaves them alone.
+rm -rf ./client/src/model ./client/include/FastCommentsClient/model ./client/src/api ./client/include/FastCommentsClient/api
 
 if wget -q http://localhost:3001/js/swagger.json -O ./openapi.json; then
     echo "Downloaded OpenAPI spec from running server"
@@ -27,6 +29,8 @@ java -jar "$JAR_FILE" generate \
 
 echo "Generated C++ client in ./client"
 
+python3 ./postprocess_models.py ./client
+
 # Generate markdown documentation
 echo "Generating markdown documentation..."
 rm -rf ./docs